@@ -124,4 +124,45 @@
   OCMVerify([_mockDevice setFocusPointOfInterest:CGPointMake(1, 1)]);
 }
 
+
+- (void)testApplyFrameRateRange_ShouldSetFrameDurations {
+  id mockRange = OCMClassMock([AVFrameRateRange class]);
+  OCMStub([mockRange minFrameRate]).andReturn(1.0);
+  OCMStub([mockRange maxFrameRate]).andReturn(60.0);
+  id mockFormat = OCMClassMock([AVCaptureDeviceFormat class]);
+  OCMStub([mockFormat videoSupportedFrameRateRanges]).andReturn(@[ mockRange ]);
+  OCMStub([_mockDevice activeFormat]).andReturn(mockFormat);
+  OCMStub([_mockDevice lockForConfiguration:[OCMArg anyObjectRef]]).andReturn(YES);
+
+  NSError *error;
+  BOOL applied = [_camera applyFrameRateRangeWithMinFrameRate:@15
+                                                 maxFrameRate:@24
+                                                     onDevice:_mockDevice
+                                                        error:&error];
+
+  XCTAssertTrue(applied);
+  XCTAssertNil(error);
+  OCMVerify([_mockDevice setActiveVideoMinFrameDuration:CMTimeMake(1000, 24000)]);
+  OCMVerify([_mockDevice setActiveVideoMaxFrameDuration:CMTimeMake(1000, 15000)]);
+}
+
+- (void)testApplyFrameRateRange_ShouldFailForUnsupportedFrameRate {
+  id mockRange = OCMClassMock([AVFrameRateRange class]);
+  OCMStub([mockRange minFrameRate]).andReturn(1.0);
+  OCMStub([mockRange maxFrameRate]).andReturn(30.0);
+  id mockFormat = OCMClassMock([AVCaptureDeviceFormat class]);
+  OCMStub([mockFormat videoSupportedFrameRateRanges]).andReturn(@[ mockRange ]);
+  OCMStub([_mockDevice activeFormat]).andReturn(mockFormat);
+  [[_mockDevice reject] lockForConfiguration:[OCMArg anyObjectRef]];
+
+  NSError *error;
+  BOOL applied = [_camera applyFrameRateRangeWithMinFrameRate:nil
+                                                 maxFrameRate:@60
+                                                     onDevice:_mockDevice
+                                                        error:&error];
+
+  XCTAssertFalse(applied);
+  XCTAssertNotNil(error);
+}
+
 @end
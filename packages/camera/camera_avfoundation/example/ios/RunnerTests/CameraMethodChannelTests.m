@@ -45,4 +45,155 @@
   XCTAssert([[dictionaryResult allKeys] containsObject:@"cameraId"]);
 }
 
+- (void)testCreate_ShouldUsePrewarmedCameraWithSameArguments {
+  CameraPlugin *camera = [[CameraPlugin alloc] initWithRegistry:nil messenger:nil];
+
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Result finished"];
+
+  id avCaptureDeviceMock = OCMClassMock([AVCaptureDevice class]);
+  OCMStub([avCaptureDeviceMock authorizationStatusForMediaType:AVMediaTypeVideo])
+      .andReturn(AVAuthorizationStatusAuthorized);
+
+  id avCaptureDeviceInputMock = OCMClassMock([AVCaptureDeviceInput class]);
+  OCMStub([avCaptureDeviceInputMock deviceInputWithDevice:[OCMArg any] error:[OCMArg anyObjectRef]])
+      .andReturn([AVCaptureInput alloc]);
+
+  id avCaptureSessionMock = OCMClassMock([AVCaptureSession class]);
+  OCMStub([avCaptureSessionMock alloc]).andReturn(avCaptureSessionMock);
+  OCMStub([avCaptureSessionMock canSetSessionPreset:[OCMArg any]]).andReturn(YES);
+
+  MockFLTThreadSafeFlutterResult *resultObject =
+      [[MockFLTThreadSafeFlutterResult alloc] initWithExpectation:expectation];
+
+  NSDictionary *arguments = @{@"resolutionPreset" : @"medium", @"enableAudio" : @(1)};
+  [camera prewarmCameraWithMethodCall:[FlutterMethodCall methodCallWithMethodName:@"prewarm"
+                                                                        arguments:arguments]];
+  FLTCam *prewarmedCamera = camera.prewarmedCamera;
+  XCTAssertNotNil(prewarmedCamera);
+
+  FlutterMethodCall *call = [FlutterMethodCall methodCallWithMethodName:@"create"
+                                                              arguments:arguments];
+  [camera createCameraOnSessionQueueWithCreateMethodCall:call result:resultObject];
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+
+  XCTAssertEqual(camera.camera, prewarmedCamera);
+  XCTAssertNil(camera.prewarmedCamera);
+}
+
+- (void)testCreate_ShouldReuseSessionPresetChosenForSameDevice {
+  [FLTCam clearSessionPresetCache];
+  CameraPlugin *camera = [[CameraPlugin alloc] initWithRegistry:nil messenger:nil];
+
+  id deviceMock = OCMClassMock([AVCaptureDevice class]);
+  OCMStub([deviceMock uniqueID]).andReturn(@"camera");
+  id avCaptureDeviceMock = OCMClassMock([AVCaptureDevice class]);
+  OCMStub([avCaptureDeviceMock deviceWithUniqueID:OCMOCK_ANY]).andReturn(deviceMock);
+
+  id avCaptureDeviceInputMock = OCMClassMock([AVCaptureDeviceInput class]);
+  OCMStub([avCaptureDeviceInputMock deviceInputWithDevice:[OCMArg any] error:[OCMArg anyObjectRef]])
+      .andReturn([AVCaptureInput alloc]);
+
+  __block NSUInteger probeCount = 0;
+  id avCaptureSessionMock = OCMClassMock([AVCaptureSession class]);
+  OCMStub([avCaptureSessionMock alloc]).andReturn(avCaptureSessionMock);
+  OCMStub([avCaptureSessionMock canSetSessionPreset:AVCaptureSessionPreset1920x1080])
+      .andDo(^(NSInvocation *invocation) {
+        probeCount++;
+      })
+      .andReturn(NO);
+  OCMStub([avCaptureSessionMock canSetSessionPreset:[OCMArg any]]).andReturn(YES);
+
+  FlutterMethodCall *call = [FlutterMethodCall
+      methodCallWithMethodName:@"create"
+                     arguments:@{@"cameraName" : @"camera", @"resolutionPreset" : @"veryHigh"}];
+  for (int i = 0; i < 2; i++) {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Result finished"];
+    MockFLTThreadSafeFlutterResult *resultObject =
+        [[MockFLTThreadSafeFlutterResult alloc] initWithExpectation:expectation];
+    [camera createCameraOnSessionQueueWithCreateMethodCall:call result:resultObject];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+  }
+
+  // Only the first camera probes the unsupported preset; the second uses the cached fallback.
+  XCTAssertEqual(probeCount, 1);
+  [FLTCam clearSessionPresetCache];
+}
+
+- (void)testCreate_ShouldKeepCamerasSharingMultiCamSessionOpen {
+  if (@available(iOS 13.0, *)) {
+    __block int64_t nextTextureId = 1;
+    id registryMock = OCMProtocolMock(@protocol(FlutterTextureRegistry));
+    OCMStub([registryMock registerTexture:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+      int64_t textureId = nextTextureId++;
+      [invocation setReturnValue:&textureId];
+    });
+    CameraPlugin *camera = [[CameraPlugin alloc] initWithRegistry:registryMock messenger:nil];
+
+    CMVideoFormatDescriptionRef smallDescription;
+    CMVideoFormatDescriptionCreate(kCFAllocatorDefault, kCVPixelFormatType_32BGRA, 640, 480, NULL,
+                                   &smallDescription);
+    CMVideoFormatDescriptionRef largeDescription;
+    CMVideoFormatDescriptionCreate(kCFAllocatorDefault, kCVPixelFormatType_32BGRA, 1920, 1080,
+                                   NULL, &largeDescription);
+    id smallFormatMock = OCMClassMock([AVCaptureDeviceFormat class]);
+    OCMStub([smallFormatMock isMultiCamSupported]).andReturn(YES);
+    OCMStub([smallFormatMock formatDescription]).andReturn(smallDescription);
+    id largeFormatMock = OCMClassMock([AVCaptureDeviceFormat class]);
+    OCMStub([largeFormatMock isMultiCamSupported]).andReturn(YES);
+    OCMStub([largeFormatMock formatDescription]).andReturn(largeDescription);
+
+    id deviceMock = OCMClassMock([AVCaptureDevice class]);
+    OCMStub([deviceMock formats]).andReturn((@[ smallFormatMock, largeFormatMock ]));
+    OCMStub([deviceMock lockForConfiguration:[OCMArg setTo:nil]]).andReturn(YES);
+    id avCaptureDeviceMock = OCMClassMock([AVCaptureDevice class]);
+    OCMStub([avCaptureDeviceMock deviceWithUniqueID:OCMOCK_ANY]).andReturn(deviceMock);
+
+    id avCaptureDeviceInputMock = OCMClassMock([AVCaptureDeviceInput class]);
+    OCMStub([avCaptureDeviceInputMock deviceInputWithDevice:[OCMArg any]
+                                                      error:[OCMArg anyObjectRef]])
+        .andReturn([AVCaptureInput alloc]);
+
+    id multiCamSessionMock = OCMClassMock([AVCaptureMultiCamSession class]);
+    OCMStub([multiCamSessionMock isMultiCamSupported]).andReturn(YES);
+    OCMStub([multiCamSessionMock alloc]).andReturn(multiCamSessionMock);
+    OCMReject([multiCamSessionMock stopRunning]);
+
+    NSDictionary *arguments = @{@"resolutionPreset" : @"medium", @"multiCam" : @YES};
+    for (int i = 0; i < 2; i++) {
+      XCTestExpectation *expectation = [self expectationWithDescription:@"Result finished"];
+      MockFLTThreadSafeFlutterResult *resultObject =
+          [[MockFLTThreadSafeFlutterResult alloc] initWithExpectation:expectation];
+      FlutterMethodCall *call = [FlutterMethodCall methodCallWithMethodName:@"create"
+                                                                  arguments:arguments];
+      [camera createCameraOnSessionQueueWithCreateMethodCall:call result:resultObject];
+      [self waitForExpectationsWithTimeout:1 handler:nil];
+    }
+
+    XCTAssertEqual(camera.cameras.count, 2);
+    XCTAssertTrue(camera.cameras[@1].usesMultiCamSession);
+    XCTAssertTrue(camera.cameras[@2].usesMultiCamSession);
+    // The largest multi-cam format within the resolution preset.
+    XCTAssertTrue(CGSizeEqualToSize(camera.cameras[@2].previewSize, CGSizeMake(640, 480)));
+    OCMVerify([deviceMock setActiveFormat:smallFormatMock]);
+
+    CFRelease(smallDescription);
+    CFRelease(largeDescription);
+  }
+}
+
+- (void)testGetMultiCamCost_ShouldBeZeroWithoutMultiCamSession {
+  CameraPlugin *camera = [[CameraPlugin alloc] initWithRegistry:nil messenger:nil];
+
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Result finished"];
+  MockFLTThreadSafeFlutterResult *resultObject =
+      [[MockFLTThreadSafeFlutterResult alloc] initWithExpectation:expectation];
+  [camera handleMethodCallAsync:[FlutterMethodCall methodCallWithMethodName:@"getMultiCamCost"
+                                                                  arguments:nil]
+                         result:resultObject];
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+
+  NSDictionary *expectedCost = @{@"hardwareCost" : @(0), @"systemPressureCost" : @(0)};
+  XCTAssertEqualObjects(resultObject.receivedResult, expectedCost);
+}
+
 @end
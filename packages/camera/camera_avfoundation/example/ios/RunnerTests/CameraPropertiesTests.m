@@ -76,9 +76,52 @@
   XCTAssertEqual(kCVPixelFormatType_32BGRA, FLTGetVideoFormatFromString(@"bgra8888"));
   XCTAssertEqual(kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange,
                  FLTGetVideoFormatFromString(@"yuv420"));
+  XCTAssertEqual(kCVPixelFormatType_420YpCbCr8BiPlanarFullRange,
+                 FLTGetVideoFormatFromString(@"yuv420FullRange"));
   XCTAssertEqual(kCVPixelFormatType_32BGRA, FLTGetVideoFormatFromString(@"unknown"));
 }
 
+#pragma mark - video codec tests
+
+- (void)testFLTGetAVVideoCodecTypeForString {
+  XCTAssertEqualObjects(AVVideoCodecTypeH264, FLTGetAVVideoCodecTypeForString(@"h264"));
+  XCTAssertEqualObjects(AVVideoCodecTypeHEVC, FLTGetAVVideoCodecTypeForString(@"hevc"));
+  if (@available(iOS 13.0, *)) {
+    XCTAssertEqualObjects(AVVideoCodecTypeHEVCWithAlpha,
+                          FLTGetAVVideoCodecTypeForString(@"hevcWithAlpha"));
+  }
+  XCTAssertNil(FLTGetAVVideoCodecTypeForString(@"unknown"));
+}
+
+#pragma mark - picture settings tests
+
+- (void)testFLTGetFLTPictureFormatForString {
+  XCTAssertEqual(FLTPictureFormatJPEG, FLTGetFLTPictureFormatForString(@"jpeg"));
+  XCTAssertEqual(FLTPictureFormatHEIC, FLTGetFLTPictureFormatForString(@"heic"));
+  XCTAssertEqual(FLTPictureFormatInvalid, FLTGetFLTPictureFormatForString(@"unknown"));
+}
+
+- (void)testFLTGetFLTPhotoQualityPrioritizationForString {
+  XCTAssertEqual(FLTPhotoQualityPrioritizationSpeed,
+                 FLTGetFLTPhotoQualityPrioritizationForString(@"speed"));
+  XCTAssertEqual(FLTPhotoQualityPrioritizationBalanced,
+                 FLTGetFLTPhotoQualityPrioritizationForString(@"balanced"));
+  XCTAssertEqual(FLTPhotoQualityPrioritizationQuality,
+                 FLTGetFLTPhotoQualityPrioritizationForString(@"quality"));
+  XCTAssertEqual(FLTPhotoQualityPrioritizationInvalid,
+                 FLTGetFLTPhotoQualityPrioritizationForString(@"unknown"));
+}
+
+#pragma mark - image stream format tests
+
+- (void)testFLTGetFLTImageStreamFormatForString {
+  XCTAssertEqual(FLTImageStreamFormatNative, FLTGetFLTImageStreamFormatForString(@"native"));
+  XCTAssertEqual(FLTImageStreamFormatRGB888, FLTGetFLTImageStreamFormatForString(@"rgb888"));
+  XCTAssertEqual(FLTImageStreamFormatRGBA8888, FLTGetFLTImageStreamFormatForString(@"rgba8888"));
+  XCTAssertEqual(FLTImageStreamFormatGray8, FLTGetFLTImageStreamFormatForString(@"gray8"));
+  XCTAssertEqual(FLTImageStreamFormatInvalid, FLTGetFLTImageStreamFormatForString(@"unknown"));
+}
+
 #pragma mark - device orientation tests
 
 - (void)testFLTGetUIDeviceOrientationForString {
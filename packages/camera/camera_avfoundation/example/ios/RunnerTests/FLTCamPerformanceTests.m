@@ -0,0 +1,248 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import camera_avfoundation;
+@import camera_avfoundation.Test;
+@import AVFoundation;
+@import XCTest;
+#import <OCMock/OCMock.h>
+#import "CameraTestUtils.h"
+
+/// The number of frames fed to the camera in each measured iteration. Divide a measurement by it
+/// for the cost per frame.
+static const int kFLTMeasuredFrameCount = 60;
+
+/// The number of distinct pixel buffers that frames cycle through, like a capture output's pool.
+static const int kFLTPixelBufferPoolSize = 4;
+
+typedef NS_ENUM(NSInteger, FLTCamPerformanceMode) {
+  /// Frames only go to the preview, which picks up each one.
+  FLTCamPerformanceModePreview,
+  /// Frames also go to an image stream whose listener acknowledges each one.
+  FLTCamPerformanceModeImageStream,
+  /// Frames are also appended to a recording.
+  FLTCamPerformanceModeRecording,
+};
+
+/// Measures the cost of FLTCam's sample buffer callback with synthetic frames, per pixel format,
+/// frame size and mode.
+///
+/// Each test feeds `kFLTMeasuredFrameCount` frames per iteration and waits for the work that the
+/// callback hands to other queues, so the measurements cover the whole cost of a frame. The writer
+/// is mocked, so recording measurements cover FLTCam's work but not the encoder's.
+@interface FLTCamPerformanceTests : XCTestCase
+@end
+
+@implementation FLTCamPerformanceTests
+
+#pragma mark - preview
+
+- (void)testPreviewBGRA720p {
+  [self measureMode:FLTCamPerformanceModePreview
+        pixelFormat:kCVPixelFormatType_32BGRA
+              width:1280
+             height:720];
+}
+
+- (void)testPreviewBGRA4K {
+  [self measureMode:FLTCamPerformanceModePreview
+        pixelFormat:kCVPixelFormatType_32BGRA
+              width:3840
+             height:2160];
+}
+
+- (void)testPreviewYUV720p {
+  [self measureMode:FLTCamPerformanceModePreview
+        pixelFormat:kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+              width:1280
+             height:720];
+}
+
+- (void)testPreviewYUV4K {
+  [self measureMode:FLTCamPerformanceModePreview
+        pixelFormat:kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+              width:3840
+             height:2160];
+}
+
+#pragma mark - image stream
+
+- (void)testImageStreamBGRA720p {
+  [self measureMode:FLTCamPerformanceModeImageStream
+        pixelFormat:kCVPixelFormatType_32BGRA
+              width:1280
+             height:720];
+}
+
+- (void)testImageStreamBGRA4K {
+  [self measureMode:FLTCamPerformanceModeImageStream
+        pixelFormat:kCVPixelFormatType_32BGRA
+              width:3840
+             height:2160];
+}
+
+- (void)testImageStreamYUV720p {
+  [self measureMode:FLTCamPerformanceModeImageStream
+        pixelFormat:kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+              width:1280
+             height:720];
+}
+
+- (void)testImageStreamYUV4K {
+  [self measureMode:FLTCamPerformanceModeImageStream
+        pixelFormat:kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+              width:3840
+             height:2160];
+}
+
+#pragma mark - recording
+
+- (void)testRecordingBGRA720p {
+  [self measureMode:FLTCamPerformanceModeRecording
+        pixelFormat:kCVPixelFormatType_32BGRA
+              width:1280
+             height:720];
+}
+
+- (void)testRecordingBGRA4K {
+  [self measureMode:FLTCamPerformanceModeRecording
+        pixelFormat:kCVPixelFormatType_32BGRA
+              width:3840
+             height:2160];
+}
+
+- (void)testRecordingYUV720p {
+  [self measureMode:FLTCamPerformanceModeRecording
+        pixelFormat:kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+              width:1280
+             height:720];
+}
+
+- (void)testRecordingYUV4K {
+  [self measureMode:FLTCamPerformanceModeRecording
+        pixelFormat:kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+              width:3840
+             height:2160];
+}
+
+#pragma mark - helpers
+
+- (void)measureMode:(FLTCamPerformanceMode)mode
+        pixelFormat:(OSType)pixelFormat
+              width:(size_t)width
+             height:(size_t)height {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  NSArray *sampleBuffers = [self sampleBuffersWithPixelFormat:pixelFormat
+                                                        width:width
+                                                       height:height];
+  id connectionMock = OCMClassMock([AVCaptureConnection class]);
+
+  switch (mode) {
+    case FLTCamPerformanceModePreview:
+      break;
+    case FLTCamPerformanceModeImageStream:
+      [self startImageStreamOnCamera:cam];
+      break;
+    case FLTCamPerformanceModeRecording:
+      [self startRecordingOnCamera:cam];
+      break;
+  }
+
+  void (^feedFrames)(void) = ^{
+    for (int i = 0; i < kFLTMeasuredFrameCount; i++) {
+      CMSampleBufferRef sampleBuffer =
+          (__bridge CMSampleBufferRef)sampleBuffers[i % kFLTPixelBufferPoolSize];
+      [cam captureOutput:cam.captureVideoOutput
+          didOutputSampleBuffer:sampleBuffer
+                 fromConnection:connectionMock];
+      CVPixelBufferRef pixelBuffer = [cam copyPixelBuffer];
+      if (pixelBuffer) {
+        CFRelease(pixelBuffer);
+      }
+      if (mode == FLTCamPerformanceModeImageStream) {
+        [cam receivedImageStreamData];
+      }
+    }
+    // Wait for the work handed to other queues.
+    dispatch_sync(cam.imageStreamQueue, ^{
+    });
+    dispatch_sync(cam.writerQueue, ^{
+    });
+  };
+
+  if (@available(iOS 13.0, *)) {
+    NSArray<id<XCTMetric>> *metrics = @[
+      [[XCTClockMetric alloc] init], [[XCTCPUMetric alloc] init], [[XCTMemoryMetric alloc] init]
+    ];
+    [self measureWithMetrics:metrics block:feedFrames];
+  } else {
+    [self measureBlock:feedFrames];
+  }
+}
+
+/// Returns `kFLTPixelBufferPoolSize` sample buffers with IOSurface backed pixel buffers, like the
+/// ones a capture output delivers.
+- (NSArray *)sampleBuffersWithPixelFormat:(OSType)pixelFormat
+                                    width:(size_t)width
+                                   height:(size_t)height {
+  NSDictionary *attributes = @{(NSString *)kCVPixelBufferIOSurfacePropertiesKey : @{}};
+  NSMutableArray *sampleBuffers = [NSMutableArray array];
+  for (int i = 0; i < kFLTPixelBufferPoolSize; i++) {
+    CVPixelBufferRef pixelBuffer;
+    CVPixelBufferCreate(kCFAllocatorDefault, width, height, pixelFormat,
+                        (__bridge CFDictionaryRef)attributes, &pixelBuffer);
+    CMFormatDescriptionRef formatDescription;
+    CMVideoFormatDescriptionCreateForImageBuffer(kCFAllocatorDefault, pixelBuffer,
+                                                 &formatDescription);
+    CMSampleTimingInfo timingInfo = {CMTimeMake(1, 30), CMTimeMake(i, 30), kCMTimeInvalid};
+    CMSampleBufferRef sampleBuffer;
+    CMSampleBufferCreateReadyWithImageBuffer(kCFAllocatorDefault, pixelBuffer, formatDescription,
+                                             &timingInfo, &sampleBuffer);
+    [sampleBuffers addObject:(__bridge_transfer id)sampleBuffer];
+    CFRelease(pixelBuffer);
+    CFRelease(formatDescription);
+  }
+  return sampleBuffers;
+}
+
+- (void)startImageStreamOnCamera:(FLTCam *)cam {
+  id handlerMock = OCMClassMock([FLTImageStreamHandler class]);
+  OCMStub([handlerMock eventSink]).andReturn(^(id event){
+  });
+  id messenger = OCMProtocolMock(@protocol(FlutterBinaryMessenger));
+  [cam startImageStreamWithMessenger:messenger imageStreamHandler:handlerMock];
+
+  XCTKVOExpectation *expectation = [[XCTKVOExpectation alloc] initWithKeyPath:@"isStreamingImages"
+                                                                       object:cam
+                                                                expectedValue:@YES];
+  XCTWaiterResult result = [XCTWaiter waitForExpectations:@[ expectation ] timeout:1];
+  XCTAssertEqual(result, XCTWaiterResultCompleted);
+}
+
+- (void)startRecordingOnCamera:(FLTCam *)cam {
+  id writerMock = OCMClassMock([AVAssetWriter class]);
+  OCMStub([writerMock alloc]).andReturn(writerMock);
+  OCMStub([writerMock initWithURL:OCMOCK_ANY fileType:OCMOCK_ANY error:[OCMArg setTo:nil]])
+      .andReturn(writerMock);
+  __block AVAssetWriterStatus status = AVAssetWriterStatusUnknown;
+  OCMStub([writerMock startWriting]).andDo(^(NSInvocation *invocation) {
+    status = AVAssetWriterStatusWriting;
+  });
+  OCMStub([writerMock status]).andDo(^(NSInvocation *invocation) {
+    [invocation setReturnValue:&status];
+  });
+
+  id inputMock = OCMClassMock([AVAssetWriterInput class]);
+  OCMStub([inputMock assetWriterInputWithMediaType:OCMOCK_ANY outputSettings:OCMOCK_ANY])
+      .andReturn(inputMock);
+  OCMStub([inputMock isReadyForMoreMediaData]).andReturn(YES);
+  OCMStub([inputMock appendSampleBuffer:[OCMArg anyPointer]]).andReturn(YES);
+
+  FLTThreadSafeFlutterResult *result =
+      [[FLTThreadSafeFlutterResult alloc] initWithResult:^(id result){
+      }];
+  [cam startVideoRecordingWithResult:result];
+}
+
+@end
@@ -94,4 +94,88 @@
   [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testCaptureToMemory_mustReportDataToResultIfSavePhotoDelegateCompletionsWithData {
+  XCTestExpectation *dataExpectation =
+      [self expectationWithDescription:
+                @"Must send photo data to result if save photo delegate completes with data."];
+
+  dispatch_queue_t captureSessionQueue = dispatch_queue_create("capture_session_queue", NULL);
+  dispatch_queue_set_specific(captureSessionQueue, FLTCaptureSessionQueueSpecific,
+                              (void *)FLTCaptureSessionQueueSpecific, NULL);
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(captureSessionQueue);
+
+  AVCapturePhotoSettings *settings = [AVCapturePhotoSettings photoSettings];
+  id mockSettings = OCMClassMock([AVCapturePhotoSettings class]);
+  OCMStub([mockSettings photoSettings]).andReturn(settings);
+
+  NSData *data = [@"test" dataUsingEncoding:NSUTF8StringEncoding];
+  id mockResult = OCMClassMock([FLTThreadSafeFlutterResult class]);
+  OCMStub([mockResult sendSuccessWithData:[OCMArg checkWithBlock:^BOOL(id obj) {
+                        return [obj isKindOfClass:[FlutterStandardTypedData class]] &&
+                               [((FlutterStandardTypedData *)obj).data isEqualToData:data];
+                      }]])
+      .andDo(^(NSInvocation *invocation) {
+        [dataExpectation fulfill];
+      });
+
+  id mockOutput = OCMClassMock([AVCapturePhotoOutput class]);
+  OCMStub([mockOutput capturePhotoWithSettings:OCMOCK_ANY delegate:OCMOCK_ANY])
+      .andDo(^(NSInvocation *invocation) {
+        FLTSavePhotoDelegate *delegate = cam.inProgressSavePhotoDelegates[@(settings.uniqueID)];
+        // Completion runs on IO queue.
+        dispatch_queue_t ioQueue = dispatch_queue_create("io_queue", NULL);
+        dispatch_async(ioQueue, ^{
+          delegate.dataCompletionHandler(data, nil);
+        });
+      });
+  cam.capturePhotoOutput = mockOutput;
+
+  // `FLTCam::captureToMemory` runs on capture session queue.
+  dispatch_async(captureSessionQueue, ^{
+    [cam captureToMemory:mockResult];
+  });
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testPhotoSettingsForCapture_mustUseHEVCIfPictureFormatIsHEICAndAvailable {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  id mockOutput = OCMClassMock([AVCapturePhotoOutput class]);
+  OCMStub([mockOutput availablePhotoCodecTypes]).andReturn(@[
+    AVVideoCodecTypeHEVC, AVVideoCodecTypeJPEG
+  ]);
+  cam.capturePhotoOutput = mockOutput;
+
+  cam.pictureFormat = FLTPictureFormatHEIC;
+
+  AVCapturePhotoSettings *settings = [cam photoSettingsForCapture];
+  XCTAssertEqualObjects(settings.format[AVVideoCodecKey], AVVideoCodecTypeHEVC);
+}
+
+- (void)testPhotoSettingsForCapture_mustFallBackToJPEGIfHEVCIsUnavailable {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  id mockOutput = OCMClassMock([AVCapturePhotoOutput class]);
+  OCMStub([mockOutput availablePhotoCodecTypes]).andReturn(@[ AVVideoCodecTypeJPEG ]);
+  cam.capturePhotoOutput = mockOutput;
+
+  cam.pictureFormat = FLTPictureFormatHEIC;
+
+  AVCapturePhotoSettings *settings = [cam photoSettingsForCapture];
+  XCTAssertNotEqualObjects(settings.format[AVVideoCodecKey], AVVideoCodecTypeHEVC);
+}
+
+- (void)testPhotoSettingsForCapture_mustPrioritizeSpeedIfRequested {
+  if (@available(iOS 13.0, *)) {
+    FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+    id mockOutput = OCMClassMock([AVCapturePhotoOutput class]);
+    OCMStub([mockOutput maxPhotoQualityPrioritization])
+        .andReturn(AVCapturePhotoQualityPrioritizationBalanced);
+    cam.capturePhotoOutput = mockOutput;
+
+    cam.photoQualityPrioritization = FLTPhotoQualityPrioritizationSpeed;
+
+    AVCapturePhotoSettings *settings = [cam photoSettingsForCapture];
+    XCTAssertEqual(settings.photoQualityPrioritization, AVCapturePhotoQualityPrioritizationSpeed);
+  }
+}
+
 @end
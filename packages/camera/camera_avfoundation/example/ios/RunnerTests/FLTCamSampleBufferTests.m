@@ -23,6 +23,107 @@
                  @"Sample buffer callback queue must be the capture session queue.");
 }
 
+- (void)testVideoSampleBuffersAreSentToConsumers {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  CMSampleBufferRef videoSampleBuffer = FLTCreateTestSampleBuffer();
+  CMSampleBufferRef audioSampleBuffer = FLTCreateTestAudioSampleBuffer();
+  // A strict mock fails on any unexpected call, such as one for the audio sample.
+  id consumerMock = OCMStrictProtocolMock(@protocol(FLTSampleBufferConsumer));
+  OCMExpect([consumerMock cameraDidOutputSampleBuffer:videoSampleBuffer]);
+  cam.sampleBufferConsumers = [NSHashTable weakObjectsHashTable];
+  [cam.sampleBufferConsumers addObject:consumerMock];
+
+  [cam captureOutput:cam.captureVideoOutput
+      didOutputSampleBuffer:videoSampleBuffer
+             fromConnection:OCMClassMock([AVCaptureConnection class])];
+  [cam captureOutput:nil
+      didOutputSampleBuffer:audioSampleBuffer
+             fromConnection:OCMClassMock([AVCaptureConnection class])];
+
+  OCMVerifyAll(consumerMock);
+  CFRelease(videoSampleBuffer);
+  CFRelease(audioSampleBuffer);
+}
+
+- (void)testCopyPixelBufferReturnsEachBufferOnce {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  CMSampleBufferRef capturedSampleBuffer = FLTCreateTestSampleBuffer();
+  [cam captureOutput:cam.captureVideoOutput
+      didOutputSampleBuffer:capturedSampleBuffer
+             fromConnection:OCMClassMock([AVCaptureConnection class])];
+
+  CVPixelBufferRef deliveredPixelBuffer = [cam copyPixelBuffer];
+  XCTAssert(deliveredPixelBuffer != NULL);
+  XCTAssert([cam copyPixelBuffer] == NULL,
+            @"A pixel buffer must not be delivered to the engine more than once.");
+  CFRelease(capturedSampleBuffer);
+  CFRelease(deliveredPixelBuffer);
+}
+
+- (void)testCountsPixelBuffersReplacedBeforeBeingCopied {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  CMSampleBufferRef firstSampleBuffer = FLTCreateTestSampleBuffer();
+  CMSampleBufferRef secondSampleBuffer = FLTCreateTestSampleBuffer();
+  [cam captureOutput:cam.captureVideoOutput
+      didOutputSampleBuffer:firstSampleBuffer
+             fromConnection:OCMClassMock([AVCaptureConnection class])];
+  [cam captureOutput:cam.captureVideoOutput
+      didOutputSampleBuffer:secondSampleBuffer
+             fromConnection:OCMClassMock([AVCaptureConnection class])];
+  XCTAssertEqual(cam.replacedPixelBufferCount, 1);
+
+  CVPixelBufferRef deliveredPixelBuffer = [cam copyPixelBuffer];
+  XCTAssertEqual(deliveredPixelBuffer, CMSampleBufferGetImageBuffer(secondSampleBuffer));
+  [cam captureOutput:cam.captureVideoOutput
+      didOutputSampleBuffer:firstSampleBuffer
+             fromConnection:OCMClassMock([AVCaptureConnection class])];
+  XCTAssertEqual(cam.replacedPixelBufferCount, 1);
+
+  CFRelease(firstSampleBuffer);
+  CFRelease(secondSampleBuffer);
+  CFRelease(deliveredPixelBuffer);
+}
+
+- (void)testVideoWriterSettingsApplyRecordingProperties {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  id outputMock = OCMPartialMock(cam.captureVideoOutput);
+  OCMStub([outputMock availableVideoCodecTypesForAssetWriterWithOutputFileType:AVFileTypeMPEG4])
+      .andReturn((@[ AVVideoCodecTypeH264, AVVideoCodecTypeHEVC ]));
+  OCMStub([outputMock recommendedVideoSettingsForVideoCodecType:AVVideoCodecTypeHEVC
+                                      assetWriterOutputFileType:AVFileTypeMPEG4])
+      .andReturn((@{
+        AVVideoCodecKey : AVVideoCodecTypeHEVC,
+        AVVideoCompressionPropertiesKey : @{AVVideoAverageBitRateKey : @(20000000)},
+      }));
+
+  cam.videoCodec = AVVideoCodecTypeHEVC;
+  cam.videoAverageBitRate = @(4000000);
+  cam.videoMaxKeyFrameInterval = @(60);
+  cam.videoExpectedFrameRate = @(30);
+  NSDictionary *settings = [cam videoWriterSettings];
+
+  XCTAssertEqualObjects(settings[AVVideoCodecKey], AVVideoCodecTypeHEVC);
+  NSDictionary *compressionProperties = settings[AVVideoCompressionPropertiesKey];
+  XCTAssertEqualObjects(compressionProperties[AVVideoAverageBitRateKey], @(4000000));
+  XCTAssertEqualObjects(compressionProperties[AVVideoMaxKeyFrameIntervalKey], @(60));
+  XCTAssertEqualObjects(compressionProperties[AVVideoExpectedSourceFrameRateKey], @(30));
+}
+
+- (void)testVideoWriterSettingsFallBackToRecommendedCodec {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
+  id outputMock = OCMPartialMock(cam.captureVideoOutput);
+  OCMStub([outputMock availableVideoCodecTypesForAssetWriterWithOutputFileType:AVFileTypeMPEG4])
+      .andReturn((@[ AVVideoCodecTypeH264 ]));
+  OCMStub([outputMock recommendedVideoSettingsForAssetWriterWithOutputFileType:AVFileTypeMPEG4])
+      .andReturn((@{AVVideoCodecKey : AVVideoCodecTypeH264}));
+
+  cam.videoCodec = AVVideoCodecTypeHEVC;
+  NSDictionary *settings = [cam videoWriterSettings];
+
+  XCTAssertEqualObjects(settings[AVVideoCodecKey], AVVideoCodecTypeH264);
+  XCTAssertNil(settings[AVVideoCompressionPropertiesKey]);
+}
+
 - (void)testCopyPixelBuffer {
   FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("test", NULL));
   CMSampleBufferRef capturedSampleBuffer = FLTCreateTestSampleBuffer();
@@ -59,17 +160,25 @@
 
   __block NSArray *writtenSamples = @[];
 
-  id videoMock = OCMClassMock([AVAssetWriterInputPixelBufferAdaptor class]);
-  OCMStub([videoMock assetWriterInputPixelBufferAdaptorWithAssetWriterInput:OCMOCK_ANY
-                                                sourcePixelBufferAttributes:OCMOCK_ANY])
-      .andReturn(videoMock);
-  OCMStub([videoMock appendPixelBuffer:[OCMArg anyPointer] withPresentationTime:kCMTimeZero])
-      .ignoringNonObjectArgs()
-      .andDo(^(NSInvocation *invocation) {
-        writtenSamples = [writtenSamples arrayByAddingObject:@"video"];
-      });
+  id adaptorMock = OCMClassMock([AVAssetWriterInputPixelBufferAdaptor class]);
+  OCMStub([adaptorMock assetWriterInputPixelBufferAdaptorWithAssetWriterInput:OCMOCK_ANY
+                                                  sourcePixelBufferAttributes:OCMOCK_ANY])
+      .andReturn(adaptorMock);
+  // Without a pause there is no time offset to apply, so video samples must be appended
+  // directly instead of being re-wrapped by the adaptor.
+  OCMReject([adaptorMock appendPixelBuffer:[OCMArg anyPointer] withPresentationTime:kCMTimeZero])
+      .ignoringNonObjectArgs();
+
+  id videoMock = OCMClassMock([AVAssetWriterInput class]);
+  OCMStub([videoMock isReadyForMoreMediaData]).andReturn(YES);
+  OCMStub([videoMock appendSampleBuffer:[OCMArg anyPointer]]).andDo(^(NSInvocation *invocation) {
+    writtenSamples = [writtenSamples arrayByAddingObject:@"video"];
+  });
 
   id audioMock = OCMClassMock([AVAssetWriterInput class]);
+  OCMStub([audioMock assetWriterInputWithMediaType:[OCMArg isEqual:AVMediaTypeVideo]
+                                    outputSettings:OCMOCK_ANY])
+      .andReturn(videoMock);
   OCMStub([audioMock assetWriterInputWithMediaType:[OCMArg isEqual:AVMediaTypeAudio]
                                     outputSettings:OCMOCK_ANY])
       .andReturn(audioMock);
@@ -89,6 +198,9 @@
       didOutputSampleBuffer:videoSample
              fromConnection:connectionMock];
   [cam captureOutput:nil didOutputSampleBuffer:audioSample fromConnection:connectionMock];
+  // Samples are appended on the writer queue.
+  dispatch_sync(cam.writerQueue, ^{
+  });
 
   NSArray *expectedSamples = @[ @"video", @"audio" ];
   XCTAssertEqualObjects(writtenSamples, expectedSamples, @"First appended sample must be video.");
@@ -97,4 +209,157 @@
   CFRelease(audioSample);
 }
 
+- (void)testDropsRecordingSamplesWhileWriterQueueIsFull {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("testing", NULL));
+  CMSampleBufferRef videoSample = FLTCreateTestSampleBuffer();
+  id connectionMock = OCMClassMock([AVCaptureConnection class]);
+
+  id writerMock = OCMClassMock([AVAssetWriter class]);
+  OCMStub([writerMock alloc]).andReturn(writerMock);
+  OCMStub([writerMock initWithURL:OCMOCK_ANY fileType:OCMOCK_ANY error:[OCMArg setTo:nil]])
+      .andReturn(writerMock);
+  __block AVAssetWriterStatus status = AVAssetWriterStatusUnknown;
+  OCMStub([writerMock startWriting]).andDo(^(NSInvocation *invocation) {
+    status = AVAssetWriterStatusWriting;
+  });
+  OCMStub([writerMock status]).andDo(^(NSInvocation *invocation) {
+    [invocation setReturnValue:&status];
+  });
+
+  __block int appendedSampleCount = 0;
+  id inputMock = OCMClassMock([AVAssetWriterInput class]);
+  OCMStub([inputMock assetWriterInputWithMediaType:OCMOCK_ANY outputSettings:OCMOCK_ANY])
+      .andReturn(inputMock);
+  OCMStub([inputMock isReadyForMoreMediaData]).andReturn(YES);
+  OCMStub([inputMock appendSampleBuffer:[OCMArg anyPointer]]).andDo(^(NSInvocation *invocation) {
+    appendedSampleCount++;
+  });
+
+  FLTThreadSafeFlutterResult *result =
+      [[FLTThreadSafeFlutterResult alloc] initWithResult:^(id result){
+      }];
+  [cam startVideoRecordingWithResult:result];
+
+  // Stall the writer, as slow storage would.
+  dispatch_semaphore_t writerStall = dispatch_semaphore_create(0);
+  dispatch_async(cam.writerQueue, ^{
+    dispatch_semaphore_wait(writerStall, DISPATCH_TIME_FOREVER);
+  });
+  for (int i = 0; i < 10; i++) {
+    [cam captureOutput:cam.captureVideoOutput
+        didOutputSampleBuffer:videoSample
+               fromConnection:connectionMock];
+  }
+  // The preview keeps receiving frames while the writer is stalled.
+  CVPixelBufferRef deliveredPixelBuffer = [cam copyPixelBuffer];
+  XCTAssert(deliveredPixelBuffer != NULL);
+
+  dispatch_semaphore_signal(writerStall);
+  dispatch_sync(cam.writerQueue, ^{
+  });
+
+  XCTAssertEqual(appendedSampleCount, 8);
+  XCTAssertEqual(cam.droppedRecordingSampleCount, 2);
+
+  CFRelease(deliveredPixelBuffer);
+  CFRelease(videoSample);
+}
+
+- (void)testCountsRecordingSamplesTheWriterIsNotReadyFor {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("testing", NULL));
+  CMSampleBufferRef videoSample = FLTCreateTestSampleBuffer();
+  id connectionMock = OCMClassMock([AVCaptureConnection class]);
+
+  id writerMock = OCMClassMock([AVAssetWriter class]);
+  OCMStub([writerMock alloc]).andReturn(writerMock);
+  OCMStub([writerMock initWithURL:OCMOCK_ANY fileType:OCMOCK_ANY error:[OCMArg setTo:nil]])
+      .andReturn(writerMock);
+  __block AVAssetWriterStatus status = AVAssetWriterStatusUnknown;
+  OCMStub([writerMock startWriting]).andDo(^(NSInvocation *invocation) {
+    status = AVAssetWriterStatusWriting;
+  });
+  OCMStub([writerMock status]).andDo(^(NSInvocation *invocation) {
+    [invocation setReturnValue:&status];
+  });
+
+  id inputMock = OCMClassMock([AVAssetWriterInput class]);
+  OCMStub([inputMock assetWriterInputWithMediaType:OCMOCK_ANY outputSettings:OCMOCK_ANY])
+      .andReturn(inputMock);
+  OCMStub([inputMock isReadyForMoreMediaData]).andReturn(NO);
+  OCMReject([inputMock appendSampleBuffer:[OCMArg anyPointer]]);
+
+  FLTThreadSafeFlutterResult *result =
+      [[FLTThreadSafeFlutterResult alloc] initWithResult:^(id result){
+      }];
+  [cam startVideoRecordingWithResult:result];
+
+  for (int i = 0; i < 3; i++) {
+    [cam captureOutput:cam.captureVideoOutput
+        didOutputSampleBuffer:videoSample
+               fromConnection:connectionMock];
+  }
+  dispatch_sync(cam.writerQueue, ^{
+  });
+
+  XCTAssertEqual(cam.droppedRecordingSampleCount, 3);
+
+  CFRelease(videoSample);
+}
+
+- (void)testCanRecordWithMovieFileOutputOnlyForPlainRecordings {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("testing", NULL));
+  XCTAssertFalse([cam canRecordWithMovieFileOutput]);
+
+  cam.prefersMovieFileOutput = YES;
+  cam.videoCodec = AVVideoCodecTypeHEVC;
+  XCTAssertTrue([cam canRecordWithMovieFileOutput]);
+
+  cam.videoAverageBitRate = @4000000;
+  XCTAssertFalse([cam canRecordWithMovieFileOutput]);
+
+  cam.videoAverageBitRate = nil;
+  cam.isStreamingImages = YES;
+  XCTAssertFalse([cam canRecordWithMovieFileOutput]);
+}
+
+- (void)testRecordingFallsBackToWriterWhenSessionCannotAddMovieFileOutput {
+  FLTCam *cam = FLTCreateCamWithCaptureSessionQueue(dispatch_queue_create("testing", NULL));
+  cam.prefersMovieFileOutput = YES;
+  CMSampleBufferRef videoSample = FLTCreateTestSampleBuffer();
+  id connectionMock = OCMClassMock([AVCaptureConnection class]);
+
+  id writerMock = OCMClassMock([AVAssetWriter class]);
+  OCMStub([writerMock alloc]).andReturn(writerMock);
+  OCMStub([writerMock initWithURL:OCMOCK_ANY fileType:OCMOCK_ANY error:[OCMArg setTo:nil]])
+      .andReturn(writerMock);
+  __block AVAssetWriterStatus status = AVAssetWriterStatusUnknown;
+  OCMStub([writerMock startWriting]).andDo(^(NSInvocation *invocation) {
+    status = AVAssetWriterStatusWriting;
+  });
+  OCMStub([writerMock status]).andDo(^(NSInvocation *invocation) {
+    [invocation setReturnValue:&status];
+  });
+  id inputMock = OCMClassMock([AVAssetWriterInput class]);
+  OCMStub([inputMock assetWriterInputWithMediaType:OCMOCK_ANY outputSettings:OCMOCK_ANY])
+      .andReturn(inputMock);
+  OCMStub([inputMock isReadyForMoreMediaData]).andReturn(YES);
+
+  // The mocked session can't add outputs, so the movie file output is never added.
+  FLTThreadSafeFlutterResult *result =
+      [[FLTThreadSafeFlutterResult alloc] initWithResult:^(id result){
+      }];
+  [cam startVideoRecordingWithResult:result];
+  XCTAssertNil(cam.movieFileOutput);
+
+  [cam captureOutput:cam.captureVideoOutput
+      didOutputSampleBuffer:videoSample
+             fromConnection:connectionMock];
+  dispatch_sync(cam.writerQueue, ^{
+  });
+  XCTAssertEqual(status, AVAssetWriterStatusWriting);
+  OCMVerify([inputMock appendSampleBuffer:[OCMArg anyPointer]]);
+
+  CFRelease(videoSample);
+}
+
 @end
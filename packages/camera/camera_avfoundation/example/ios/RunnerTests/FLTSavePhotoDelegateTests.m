@@ -137,4 +137,31 @@
   [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+- (void)testHandlePhotoCaptureResult_mustCompleteWithDataIfKeptInMemory {
+  XCTestExpectation *completionExpectation =
+      [self expectationWithDescription:@"Must complete with photo data if kept in memory."];
+
+  dispatch_queue_t ioQueue = dispatch_queue_create("test", NULL);
+  // Do not use OCMClassMock for NSData because some XCTest APIs uses NSData (e.g.
+  // `XCTRunnerIDESession::logDebugMessage:`) on a private queue.
+  id mockData = OCMPartialMock([NSData data]);
+  OCMReject([mockData writeToFile:OCMOCK_ANY
+                          options:NSDataWritingAtomic
+                            error:[OCMArg anyObjectRef]]);
+
+  FLTSavePhotoDelegate *delegate = [[FLTSavePhotoDelegate alloc]
+            initWithIOQueue:ioQueue
+      dataCompletionHandler:^(NSData *_Nullable data, NSError *_Nullable error) {
+        XCTAssertNil(error);
+        XCTAssertEqual(mockData, data);
+        [completionExpectation fulfill];
+      }];
+
+  [delegate handlePhotoCaptureResultWithError:nil
+                            photoDataProvider:^NSData * {
+                              return mockData;
+                            }];
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
 @end
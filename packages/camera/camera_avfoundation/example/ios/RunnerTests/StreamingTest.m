@@ -14,6 +14,28 @@
 @property(readonly, nonatomic) CMSampleBufferRef sampleBuffer;
 @end
 
+/// Creates a pixel buffer whose BGRA pixels are all (10, 20, 30, 40), or whose YUV pixels all have
+/// a luma of 10 and neutral chroma.
+static CVPixelBufferRef FLTCreateFilledPixelBuffer(OSType pixelFormat, size_t width,
+                                                   size_t height) {
+  CVPixelBufferRef pixelBuffer;
+  CVPixelBufferCreate(kCFAllocatorDefault, width, height, pixelFormat, NULL, &pixelBuffer);
+  CVPixelBufferLockBaseAddress(pixelBuffer, 0);
+  if (CVPixelBufferIsPlanar(pixelBuffer)) {
+    memset(CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0), 10,
+           CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0) * height);
+    memset(CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 1), 128,
+           CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 1) * height / 2);
+  } else {
+    uint8_t *bytes = CVPixelBufferGetBaseAddress(pixelBuffer);
+    for (size_t i = 0; i < CVPixelBufferGetBytesPerRow(pixelBuffer) * height; i++) {
+      bytes[i] = (i % 4 + 1) * 10;
+    }
+  }
+  CVPixelBufferUnlockBaseAddress(pixelBuffer, 0);
+  return pixelBuffer;
+}
+
 @implementation StreamingTests
 
 - (void)setUp {
@@ -50,6 +72,7 @@
   }
 
   [self waitForExpectationsWithTimeout:1.0 handler:nil];
+  XCTAssertEqual(_camera.droppedImageStreamFrameCount, 6);
 }
 
 - (void)testReceivedImageStreamData {
@@ -82,4 +105,166 @@
   [self waitForExpectationsWithTimeout:1.0 handler:nil];
 }
 
+- (void)testReceivedImageStreamDataCount {
+  XCTestExpectation *streamingExpectation = [self
+      expectationWithDescription:@"Must release one pending frame per acknowledged frame"];
+
+  id handlerMock = OCMClassMock([FLTImageStreamHandler class]);
+  OCMStub([handlerMock eventSink]).andReturn(^(id event) {
+    [streamingExpectation fulfill];
+  });
+
+  id messenger = OCMProtocolMock(@protocol(FlutterBinaryMessenger));
+  [_camera startImageStreamWithMessenger:messenger imageStreamHandler:handlerMock];
+
+  XCTKVOExpectation *expectation = [[XCTKVOExpectation alloc] initWithKeyPath:@"isStreamingImages"
+                                                                       object:_camera
+                                                                expectedValue:@YES];
+  XCTWaiterResult result = [XCTWaiter waitForExpectations:@[ expectation ] timeout:1];
+  XCTAssertEqual(result, XCTWaiterResultCompleted);
+
+  streamingExpectation.expectedFulfillmentCount = 6;
+  for (int i = 0; i < 10; i++) {
+    [_camera captureOutput:nil didOutputSampleBuffer:self.sampleBuffer fromConnection:nil];
+  }
+
+  [_camera receivedImageStreamDataCount:2];
+  for (int i = 0; i < 10; i++) {
+    [_camera captureOutput:nil didOutputSampleBuffer:self.sampleBuffer fromConnection:nil];
+  }
+
+  [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testStreamedPlanesReferencePixelBufferWithoutCopying {
+  XCTestExpectation *streamingExpectation =
+      [self expectationWithDescription:@"Must send an image to the handler"];
+
+  __block NSData *planeBytes;
+  id handlerMock = OCMClassMock([FLTImageStreamHandler class]);
+  OCMStub([handlerMock eventSink]).andReturn(^(id event) {
+    FlutterStandardTypedData *typedData = event[@"planes"][0][@"bytes"];
+    planeBytes = typedData.data;
+    [streamingExpectation fulfill];
+  });
+
+  id messenger = OCMProtocolMock(@protocol(FlutterBinaryMessenger));
+  [_camera startImageStreamWithMessenger:messenger imageStreamHandler:handlerMock];
+
+  XCTKVOExpectation *expectation = [[XCTKVOExpectation alloc] initWithKeyPath:@"isStreamingImages"
+                                                                       object:_camera
+                                                                expectedValue:@YES];
+  XCTWaiterResult result = [XCTWaiter waitForExpectations:@[ expectation ] timeout:1];
+  XCTAssertEqual(result, XCTWaiterResultCompleted);
+
+  [_camera captureOutput:nil didOutputSampleBuffer:self.sampleBuffer fromConnection:nil];
+  [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+  CVPixelBufferRef pixelBuffer = CMSampleBufferGetImageBuffer(self.sampleBuffer);
+  CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+  XCTAssertEqual(planeBytes.bytes, CVPixelBufferGetBaseAddress(pixelBuffer));
+  XCTAssertEqual(planeBytes.length,
+                 CVPixelBufferGetBytesPerRow(pixelBuffer) * CVPixelBufferGetHeight(pixelBuffer));
+  CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+}
+
+- (void)testStreamsFramesThroughImageStreamConverter {
+  XCTestExpectation *streamingExpectation =
+      [self expectationWithDescription:@"Must send a converted image to the handler"];
+
+  __block NSDictionary *streamedImage;
+  id handlerMock = OCMClassMock([FLTImageStreamHandler class]);
+  OCMStub([handlerMock eventSink]).andReturn(^(id event) {
+    streamedImage = event;
+    [streamingExpectation fulfill];
+  });
+
+  _camera.imageStreamConverter =
+      [[FLTImageStreamConverter alloc] initWithFormat:FLTImageStreamFormatRGB888
+                                                width:20
+                                               height:10
+                                             cropRect:CGRectNull];
+  id messenger = OCMProtocolMock(@protocol(FlutterBinaryMessenger));
+  [_camera startImageStreamWithMessenger:messenger imageStreamHandler:handlerMock];
+
+  XCTKVOExpectation *expectation = [[XCTKVOExpectation alloc] initWithKeyPath:@"isStreamingImages"
+                                                                       object:_camera
+                                                                expectedValue:@YES];
+  XCTWaiterResult result = [XCTWaiter waitForExpectations:@[ expectation ] timeout:1];
+  XCTAssertEqual(result, XCTWaiterResultCompleted);
+
+  [_camera captureOutput:nil didOutputSampleBuffer:self.sampleBuffer fromConnection:nil];
+  [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+  XCTAssertEqualObjects(streamedImage[@"width"], @20);
+  XCTAssertEqualObjects(streamedImage[@"height"], @10);
+  XCTAssertEqualObjects(streamedImage[@"format"], @(kCVPixelFormatType_24RGB));
+  XCTAssertNotNil(streamedImage[@"sensorSensitivity"]);
+  FlutterStandardTypedData *bytes = streamedImage[@"planes"][0][@"bytes"];
+  XCTAssertEqual(bytes.data.length, 20 * 3 * 10);
+}
+
+- (void)testImageStreamConverterConvertsBGRAToRGB {
+  CVPixelBufferRef pixelBuffer = FLTCreateFilledPixelBuffer(kCVPixelFormatType_32BGRA, 64, 48);
+  FLTImageStreamConverter *converter =
+      [[FLTImageStreamConverter alloc] initWithFormat:FLTImageStreamFormatRGB888
+                                                width:8
+                                               height:6
+                                             cropRect:CGRectNull];
+
+  NSDictionary *image = [converter imageWithPixelBuffer:pixelBuffer];
+
+  XCTAssertEqualObjects(image[@"format"], @(kCVPixelFormatType_24RGB));
+  NSDictionary *plane = image[@"planes"][0];
+  XCTAssertEqualObjects(plane[@"bytesPerRow"], @(8 * 3));
+  const uint8_t *pixels = ((FlutterStandardTypedData *)plane[@"bytes"]).data.bytes;
+  // The buffer is filled with B = 10, G = 20, R = 30.
+  XCTAssertEqual(pixels[0], 30);
+  XCTAssertEqual(pixels[1], 20);
+  XCTAssertEqual(pixels[2], 10);
+  CVPixelBufferRelease(pixelBuffer);
+}
+
+- (void)testImageStreamConverterCropsAndConvertsYUVToGray {
+  CVPixelBufferRef pixelBuffer =
+      FLTCreateFilledPixelBuffer(kCVPixelFormatType_420YpCbCr8BiPlanarFullRange, 64, 48);
+  FLTImageStreamConverter *converter =
+      [[FLTImageStreamConverter alloc] initWithFormat:FLTImageStreamFormatGray8
+                                                width:0
+                                               height:0
+                                             cropRect:CGRectMake(0.5, 0.5, 0.5, 0.5)];
+
+  NSDictionary *image = [converter imageWithPixelBuffer:pixelBuffer];
+
+  XCTAssertEqualObjects(image[@"width"], @32);
+  XCTAssertEqualObjects(image[@"height"], @24);
+  XCTAssertEqualObjects(image[@"format"], @(kCVPixelFormatType_OneComponent8));
+  NSData *pixels = ((FlutterStandardTypedData *)image[@"planes"][0][@"bytes"]).data;
+  XCTAssertEqual(pixels.length, 32 * 24);
+  // Full range luma is the grayscale value as is.
+  XCTAssertEqual(((const uint8_t *)pixels.bytes)[0], 10);
+  CVPixelBufferRelease(pixelBuffer);
+}
+
+- (void)testImageStreamConverterConvertsYUVToRGBAOfOddSize {
+  CVPixelBufferRef pixelBuffer =
+      FLTCreateFilledPixelBuffer(kCVPixelFormatType_420YpCbCr8BiPlanarFullRange, 64, 48);
+  FLTImageStreamConverter *converter =
+      [[FLTImageStreamConverter alloc] initWithFormat:FLTImageStreamFormatRGBA8888
+                                                width:7
+                                               height:5
+                                             cropRect:CGRectNull];
+
+  NSDictionary *image = [converter imageWithPixelBuffer:pixelBuffer];
+
+  XCTAssertEqualObjects(image[@"width"], @7);
+  XCTAssertEqualObjects(image[@"height"], @5);
+  XCTAssertEqualObjects(image[@"format"], @(kCVPixelFormatType_32RGBA));
+  NSDictionary *plane = image[@"planes"][0];
+  NSData *pixels = ((FlutterStandardTypedData *)plane[@"bytes"]).data;
+  XCTAssertEqual(pixels.length, [plane[@"bytesPerRow"] unsignedLongValue] * 5);
+  XCTAssertEqual(((const uint8_t *)pixels.bytes)[3], 255, @"Alpha must be opaque.");
+  CVPixelBufferRelease(pixelBuffer);
+}
+
 @end
@@ -51,4 +51,37 @@
   [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+
+- (void)testInvokeMethod_shouldKeepCallOrderWhenBatchingBackgroundInvocations {
+  FlutterMethodChannel *mockMethodChannel = OCMClassMock([FlutterMethodChannel class]);
+  FLTThreadSafeMethodChannel *threadSafeMethodChannel =
+      [[FLTThreadSafeMethodChannel alloc] initWithMethodChannel:mockMethodChannel];
+
+  XCTestExpectation *invokeExpectation =
+      [self expectationWithDescription:@"invokeMethod must be called for each invocation"];
+  invokeExpectation.expectedFulfillmentCount = 4;
+
+  NSMutableArray<NSString *> *methods = [NSMutableArray array];
+  OCMStub([mockMethodChannel invokeMethod:[OCMArg any] arguments:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        XCTAssertTrue(NSThread.isMainThread);
+        __unsafe_unretained NSString *method;
+        [invocation getArgument:&method atIndex:2];
+        [methods addObject:method];
+        [invokeExpectation fulfill];
+      });
+
+  dispatch_sync(dispatch_queue_create("test", NULL), ^{
+    [threadSafeMethodChannel invokeMethod:@"first" arguments:nil];
+    [threadSafeMethodChannel invokeMethod:@"second" arguments:nil];
+    [threadSafeMethodChannel invokeMethod:@"third" arguments:nil];
+  });
+  // A main thread invocation must not overtake the pending background invocations.
+  [threadSafeMethodChannel invokeMethod:@"fourth" arguments:nil];
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+
+  NSArray *expectedMethods = @[ @"first", @"second", @"third", @"fourth" ];
+  XCTAssertEqualObjects(methods, expectedMethods);
+}
+
 @end
@@ -105,4 +105,34 @@
   [self waitForExpectationsWithTimeout:1 handler:nil];
 }
 
+
+- (void)testTextureFrameAvailable_shouldCoalesceFramesFromBackgroundThread {
+  NSObject<FlutterTextureRegistry> *mockTextureRegistry =
+      OCMProtocolMock(@protocol(FlutterTextureRegistry));
+  FLTThreadSafeTextureRegistry *threadSafeTextureRegistry =
+      [[FLTThreadSafeTextureRegistry alloc] initWithTextureRegistry:mockTextureRegistry];
+
+  XCTestExpectation *textureFrameAvailableExpectation =
+      [self expectationWithDescription:@"textureFrameAvailable must be called for each texture"];
+  textureFrameAvailableExpectation.expectedFulfillmentCount = 2;
+  textureFrameAvailableExpectation.assertForOverFulfill = YES;
+
+  OCMStub([mockTextureRegistry textureFrameAvailable:1]).andDo(^(NSInvocation *invocation) {
+    [textureFrameAvailableExpectation fulfill];
+  });
+  OCMStub([mockTextureRegistry textureFrameAvailable:2]).andDo(^(NSInvocation *invocation) {
+    [textureFrameAvailableExpectation fulfill];
+  });
+
+  // The main queue is blocked until all frames have been reported, so they must share one
+  // notification per texture.
+  dispatch_sync(dispatch_queue_create("test", NULL), ^{
+    [threadSafeTextureRegistry textureFrameAvailable:1];
+    [threadSafeTextureRegistry textureFrameAvailable:1];
+    [threadSafeTextureRegistry textureFrameAvailable:2];
+    [threadSafeTextureRegistry textureFrameAvailable:1];
+  });
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
 @end
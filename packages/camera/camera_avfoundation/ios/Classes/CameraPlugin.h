@@ -4,5 +4,24 @@
 
 #import <Flutter/Flutter.h>
 
+#import "FLTSampleBufferConsumer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
 @interface CameraPlugin : NSObject <FlutterPlugin>
+
+/// Adds a consumer that receives the video frames of the active camera, and of any camera created
+/// later, on the capture session queue.
+///
+/// The consumer is held weakly. Other plugins can get the registered instance with
+/// `[registry valuePublishedByPlugin:@"CameraPlugin"]`.
+- (void)addSampleBufferConsumer:(NSObject<FLTSampleBufferConsumer> *)consumer;
+
+/// Stops sending video frames to a consumer added with `addSampleBufferConsumer:`.
+///
+/// Frames that are already being delivered may still reach the consumer.
+- (void)removeSampleBufferConsumer:(NSObject<FLTSampleBufferConsumer> *)consumer;
+
 @end
+
+NS_ASSUME_NONNULL_END
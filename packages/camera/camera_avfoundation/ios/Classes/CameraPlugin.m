@@ -16,9 +16,18 @@
 #import "FLTThreadSafeTextureRegistry.h"
 #import "QueueUtils.h"
 
+/// Handles one method channel method on the capture session queue.
+/// `camera` is the camera that the call's `cameraId` argument refers to, or the most recently
+/// created camera.
+typedef void (^FLTMethodCallHandler)(CameraPlugin *plugin, FlutterMethodCall *call,
+                                     FLTThreadSafeFlutterResult *result, FLTCam *camera);
+
 @interface CameraPlugin ()
 @property(readonly, nonatomic) FLTThreadSafeTextureRegistry *registry;
 @property(readonly, nonatomic) NSObject<FlutterBinaryMessenger> *messenger;
+/// Native frame consumers, shared with each camera. Only accessed on `captureSessionQueue`.
+@property(readonly, nonatomic)
+    NSHashTable<NSObject<FLTSampleBufferConsumer> *> *sampleBufferConsumers;
 @end
 
 @implementation CameraPlugin
@@ -30,6 +39,8 @@
   CameraPlugin *instance = [[CameraPlugin alloc] initWithRegistry:[registrar textures]
                                                         messenger:[registrar messenger]];
   [registrar addMethodCallDelegate:instance channel:channel];
+  // Allows other plugins to find this instance to add sample buffer consumers.
+  [registrar publish:instance];
 }
 
 - (instancetype)initWithRegistry:(NSObject<FlutterTextureRegistry> *)registry
@@ -38,6 +49,8 @@
   NSAssert(self, @"super init cannot be nil");
   _registry = [[FLTThreadSafeTextureRegistry alloc] initWithTextureRegistry:registry];
   _messenger = messenger;
+  _sampleBufferConsumers = [NSHashTable weakObjectsHashTable];
+  _cameras = [NSMutableDictionary dictionary];
   _captureSessionQueue = dispatch_queue_create("io.flutter.camera.captureSessionQueue", NULL);
   dispatch_queue_set_specific(_captureSessionQueue, FLTCaptureSessionQueueSpecific,
                               (void *)FLTCaptureSessionQueueSpecific, NULL);
@@ -47,6 +60,18 @@
   return self;
 }
 
+- (void)addSampleBufferConsumer:(NSObject<FLTSampleBufferConsumer> *)consumer {
+  dispatch_async(self.captureSessionQueue, ^{
+    [self.sampleBufferConsumers addObject:consumer];
+  });
+}
+
+- (void)removeSampleBufferConsumer:(NSObject<FLTSampleBufferConsumer> *)consumer {
+  dispatch_async(self.captureSessionQueue, ^{
+    [self.sampleBufferConsumers removeObject:consumer];
+  });
+}
+
 - (void)initDeviceEventMethodChannel {
   FlutterMethodChannel *methodChannel = [FlutterMethodChannel
       methodChannelWithName:@"plugins.flutter.io/camera_avfoundation/fromPlatform"
@@ -79,7 +104,9 @@
   __weak typeof(self) weakSelf = self;
   dispatch_async(self.captureSessionQueue, ^{
     // `FLTCam::setDeviceOrientation` must be called on capture session queue.
-    [weakSelf.camera setDeviceOrientation:orientation];
+    for (FLTCam *camera in [weakSelf allCameras]) {
+      [camera setDeviceOrientation:orientation];
+    }
     // `CameraPlugin::sendDeviceOrientation` can be called on any queue.
     [weakSelf sendDeviceOrientation:orientation];
   });
@@ -103,162 +130,293 @@
 
 - (void)handleMethodCallAsync:(FlutterMethodCall *)call
                        result:(FLTThreadSafeFlutterResult *)result {
-  if ([@"availableCameras" isEqualToString:call.method]) {
-    NSMutableArray *discoveryDevices =
-        [@[ AVCaptureDeviceTypeBuiltInWideAngleCamera, AVCaptureDeviceTypeBuiltInTelephotoCamera ]
-            mutableCopy];
-    if (@available(iOS 13.0, *)) {
-      [discoveryDevices addObject:AVCaptureDeviceTypeBuiltInUltraWideCamera];
-    }
-    AVCaptureDeviceDiscoverySession *discoverySession = [AVCaptureDeviceDiscoverySession
-        discoverySessionWithDeviceTypes:discoveryDevices
-                              mediaType:AVMediaTypeVideo
-                               position:AVCaptureDevicePositionUnspecified];
-    NSArray<AVCaptureDevice *> *devices = discoverySession.devices;
-    NSMutableArray<NSDictionary<NSString *, NSObject *> *> *reply =
-        [[NSMutableArray alloc] initWithCapacity:devices.count];
-    for (AVCaptureDevice *device in devices) {
-      NSString *lensFacing;
-      switch ([device position]) {
-        case AVCaptureDevicePositionBack:
-          lensFacing = @"back";
-          break;
-        case AVCaptureDevicePositionFront:
-          lensFacing = @"front";
-          break;
-        case AVCaptureDevicePositionUnspecified:
-          lensFacing = @"external";
-          break;
-      }
-      [reply addObject:@{
-        @"name" : [device uniqueID],
-        @"lensFacing" : lensFacing,
-        @"sensorOrientation" : @90,
-      }];
-    }
-    [result sendSuccessWithData:reply];
-  } else if ([@"create" isEqualToString:call.method]) {
-    [self handleCreateMethodCall:call result:result];
-  } else if ([@"startImageStream" isEqualToString:call.method]) {
-    [_camera startImageStreamWithMessenger:_messenger];
-    [result sendSuccess];
-  } else if ([@"stopImageStream" isEqualToString:call.method]) {
-    [_camera stopImageStream];
-    [result sendSuccess];
-  } else if ([@"receivedImageStreamData" isEqualToString:call.method]) {
-    [_camera receivedImageStreamData];
-    [result sendSuccess];
+  FLTMethodCallHandler handler = [CameraPlugin methodCallHandlers][call.method];
+  if (handler) {
+    handler(self, call, result, [self cameraForArguments:call.arguments]);
   } else {
-    NSDictionary *argsMap = call.arguments;
-    NSUInteger cameraId = ((NSNumber *)argsMap[@"cameraId"]).unsignedIntegerValue;
-    if ([@"initialize" isEqualToString:call.method]) {
-      NSString *videoFormatValue = ((NSString *)argsMap[@"imageFormatGroup"]);
-      [_camera setVideoFormat:FLTGetVideoFormatFromString(videoFormatValue)];
-
-      __weak CameraPlugin *weakSelf = self;
-      _camera.onFrameAvailable = ^{
-        if (![weakSelf.camera isPreviewPaused]) {
-          [weakSelf.registry textureFrameAvailable:cameraId];
+    [result sendNotImplemented];
+  }
+}
+
+/// The handler for each method, looked up by name instead of comparing the name against every
+/// method in turn. Some methods, such as `receivedImageStreamData` and `setZoomLevel`, are called
+/// many times per second.
++ (NSDictionary<NSString *, FLTMethodCallHandler> *)methodCallHandlers {
+  static NSDictionary<NSString *, FLTMethodCallHandler> *handlers;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    handlers = @{
+      @"availableCameras" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                              FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin handleAvailableCamerasWithResult:result];
+      },
+      @"create" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                    FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin handleCreateMethodCall:call result:result];
+      },
+      @"isMultiCamSupported" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                 FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        BOOL supported = NO;
+        if (@available(iOS 13.0, *)) {
+          supported = AVCaptureMultiCamSession.isMultiCamSupported;
         }
-      };
-      FlutterMethodChannel *methodChannel = [FlutterMethodChannel
-          methodChannelWithName:
-              [NSString stringWithFormat:@"plugins.flutter.io/camera_avfoundation/camera%lu",
-                                         (unsigned long)cameraId]
-                binaryMessenger:_messenger];
-      FLTThreadSafeMethodChannel *threadSafeMethodChannel =
-          [[FLTThreadSafeMethodChannel alloc] initWithMethodChannel:methodChannel];
-      _camera.methodChannel = threadSafeMethodChannel;
-      [threadSafeMethodChannel
-          invokeMethod:@"initialized"
-             arguments:@{
-               @"previewWidth" : @(_camera.previewSize.width),
-               @"previewHeight" : @(_camera.previewSize.height),
-               @"exposureMode" : FLTGetStringForFLTExposureMode([_camera exposureMode]),
-               @"focusMode" : FLTGetStringForFLTFocusMode([_camera focusMode]),
-               @"exposurePointSupported" :
-                   @([_camera.captureDevice isExposurePointOfInterestSupported]),
-               @"focusPointSupported" : @([_camera.captureDevice isFocusPointOfInterestSupported]),
-             }];
-      [self sendDeviceOrientation:[UIDevice currentDevice].orientation];
-      [_camera start];
-      [result sendSuccess];
-    } else if ([@"takePicture" isEqualToString:call.method]) {
-      [_camera captureToFile:result];
-    } else if ([@"dispose" isEqualToString:call.method]) {
-      [_registry unregisterTexture:cameraId];
-      [_camera close];
-      [result sendSuccess];
-    } else if ([@"prepareForVideoRecording" isEqualToString:call.method]) {
-      [self.camera setUpCaptureSessionForAudio];
-      [result sendSuccess];
-    } else if ([@"startVideoRecording" isEqualToString:call.method]) {
-      BOOL enableStream = [call.arguments[@"enableStream"] boolValue];
-      if (enableStream) {
-        [_camera startVideoRecordingWithResult:result messengerForStreaming:_messenger];
-      } else {
-        [_camera startVideoRecordingWithResult:result];
-      }
-    } else if ([@"stopVideoRecording" isEqualToString:call.method]) {
-      [_camera stopVideoRecordingWithResult:result];
-    } else if ([@"pauseVideoRecording" isEqualToString:call.method]) {
-      [_camera pauseVideoRecordingWithResult:result];
-    } else if ([@"resumeVideoRecording" isEqualToString:call.method]) {
-      [_camera resumeVideoRecordingWithResult:result];
-    } else if ([@"getMaxZoomLevel" isEqualToString:call.method]) {
-      [_camera getMaxZoomLevelWithResult:result];
-    } else if ([@"getMinZoomLevel" isEqualToString:call.method]) {
-      [_camera getMinZoomLevelWithResult:result];
-    } else if ([@"setZoomLevel" isEqualToString:call.method]) {
-      CGFloat zoom = ((NSNumber *)argsMap[@"zoom"]).floatValue;
-      [_camera setZoomLevel:zoom Result:result];
-    } else if ([@"setFlashMode" isEqualToString:call.method]) {
-      [_camera setFlashModeWithResult:result mode:call.arguments[@"mode"]];
-    } else if ([@"setExposureMode" isEqualToString:call.method]) {
-      [_camera setExposureModeWithResult:result mode:call.arguments[@"mode"]];
-    } else if ([@"setExposurePoint" isEqualToString:call.method]) {
-      BOOL reset = ((NSNumber *)call.arguments[@"reset"]).boolValue;
-      double x = 0.5;
-      double y = 0.5;
-      if (!reset) {
-        x = ((NSNumber *)call.arguments[@"x"]).doubleValue;
-        y = ((NSNumber *)call.arguments[@"y"]).doubleValue;
-      }
-      [_camera setExposurePointWithResult:result x:x y:y];
-    } else if ([@"getMinExposureOffset" isEqualToString:call.method]) {
-      [result sendSuccessWithData:@(_camera.captureDevice.minExposureTargetBias)];
-    } else if ([@"getMaxExposureOffset" isEqualToString:call.method]) {
-      [result sendSuccessWithData:@(_camera.captureDevice.maxExposureTargetBias)];
-    } else if ([@"getExposureOffsetStepSize" isEqualToString:call.method]) {
-      [result sendSuccessWithData:@(0.0)];
-    } else if ([@"setExposureOffset" isEqualToString:call.method]) {
-      [_camera setExposureOffsetWithResult:result
-                                    offset:((NSNumber *)call.arguments[@"offset"]).doubleValue];
-    } else if ([@"lockCaptureOrientation" isEqualToString:call.method]) {
-      [_camera lockCaptureOrientationWithResult:result orientation:call.arguments[@"orientation"]];
-    } else if ([@"unlockCaptureOrientation" isEqualToString:call.method]) {
-      [_camera unlockCaptureOrientationWithResult:result];
-    } else if ([@"setFocusMode" isEqualToString:call.method]) {
-      [_camera setFocusModeWithResult:result mode:call.arguments[@"mode"]];
-    } else if ([@"setFocusPoint" isEqualToString:call.method]) {
-      BOOL reset = ((NSNumber *)call.arguments[@"reset"]).boolValue;
-      double x = 0.5;
-      double y = 0.5;
-      if (!reset) {
-        x = ((NSNumber *)call.arguments[@"x"]).doubleValue;
-        y = ((NSNumber *)call.arguments[@"y"]).doubleValue;
-      }
-      [_camera setFocusPointWithResult:result x:x y:y];
-    } else if ([@"pausePreview" isEqualToString:call.method]) {
-      [_camera pausePreviewWithResult:result];
-    } else if ([@"resumePreview" isEqualToString:call.method]) {
-      [_camera resumePreviewWithResult:result];
-    } else if ([@"setDescriptionWhileRecording" isEqualToString:call.method]) {
-      [_camera setDescriptionWhileRecording:(call.arguments[@"cameraName"]) result:result];
-    } else {
-      [result sendNotImplemented];
+        [result sendSuccessWithData:@(supported)];
+      },
+      @"getMultiCamCost" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                             FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin handleGetMultiCamCostWithResult:result];
+      },
+      @"prewarm" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                     FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin prewarmCameraWithMethodCall:call];
+        [result sendSuccess];
+      },
+      @"startImageStream" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                              FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera startImageStreamWithMessenger:plugin.messenger];
+        [result sendSuccess];
+      },
+      @"stopImageStream" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                             FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera stopImageStream];
+        [result sendSuccess];
+      },
+      @"receivedImageStreamData" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                     FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        // Dart acknowledges the frames that arrived in the same event loop turn together.
+        NSNumber *count = [plugin numberArgument:call.arguments[@"count"]];
+        [camera receivedImageStreamDataCount:count ? count.intValue : 1];
+        [result sendSuccess];
+      },
+      @"initialize" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                        FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin initializeCameraWithMethodCall:call result:result];
+      },
+      @"takePicture" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                         FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera captureToFile:result];
+      },
+      @"takePictureToMemory" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                 FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera captureToMemory:result];
+      },
+      @"setFrameRateRange" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                               FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera
+            setFrameRateRangeWithResult:result
+                           minFrameRate:[plugin numberArgument:call.arguments[@"minFrameRate"]]
+                           maxFrameRate:[plugin numberArgument:call.arguments[@"maxFrameRate"]]];
+      },
+      @"setPreviewPixelFormat" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                   FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera setPreviewPixelFormatWithResult:result format:call.arguments[@"format"]];
+      },
+      @"setPictureSettings" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin setPictureSettingsWithArguments:call.arguments result:result];
+      },
+      @"setImageStreamSettings" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                    FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin setImageStreamSettingsWithArguments:call.arguments result:result];
+      },
+      @"dispose" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                     FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        NSNumber *cameraId = call.arguments[@"cameraId"];
+        [plugin.registry unregisterTexture:cameraId.unsignedIntegerValue];
+        [camera close];
+        [plugin.cameras removeObjectForKey:cameraId];
+        [result sendSuccess];
+      },
+      @"prepareForVideoRecording" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                      FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera setUpCaptureSessionForAudio];
+        [result sendSuccess];
+      },
+      @"startVideoRecording" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                 FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        BOOL enableStream = [call.arguments[@"enableStream"] boolValue];
+        if (enableStream) {
+          [camera startVideoRecordingWithResult:result messengerForStreaming:plugin.messenger];
+        } else {
+          [camera startVideoRecordingWithResult:result];
+        }
+      },
+      @"setVideoRecordingSettings" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                       FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [plugin setVideoRecordingSettingsWithArguments:call.arguments result:result];
+      },
+      @"stopVideoRecording" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera stopVideoRecordingWithResult:result];
+      },
+      @"pauseVideoRecording" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                 FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera pauseVideoRecordingWithResult:result];
+      },
+      @"resumeVideoRecording" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                  FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera resumeVideoRecordingWithResult:result];
+      },
+      @"getMaxZoomLevel" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                             FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera getMaxZoomLevelWithResult:result];
+      },
+      @"getMinZoomLevel" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                             FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera getMinZoomLevelWithResult:result];
+      },
+      @"setZoomLevel" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                          FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        CGFloat zoom = ((NSNumber *)call.arguments[@"zoom"]).floatValue;
+        [camera setZoomLevel:zoom Result:result];
+      },
+      @"setFlashMode" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                          FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera setFlashModeWithResult:result mode:call.arguments[@"mode"]];
+      },
+      @"setExposureMode" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                             FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera setExposureModeWithResult:result mode:call.arguments[@"mode"]];
+      },
+      @"setExposurePoint" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                              FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        CGPoint point = [plugin pointOfInterestForArguments:call.arguments];
+        [camera setExposurePointWithResult:result x:point.x y:point.y];
+      },
+      @"getMinExposureOffset" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                  FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [result sendSuccessWithData:@(camera.captureDevice.minExposureTargetBias)];
+      },
+      @"getMaxExposureOffset" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                  FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [result sendSuccessWithData:@(camera.captureDevice.maxExposureTargetBias)];
+      },
+      @"getExposureOffsetStepSize" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                       FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [result sendSuccessWithData:@(0.0)];
+      },
+      @"setExposureOffset" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                               FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera setExposureOffsetWithResult:result
+                                     offset:((NSNumber *)call.arguments[@"offset"]).doubleValue];
+      },
+      @"lockCaptureOrientation" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                    FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera lockCaptureOrientationWithResult:result
+                                     orientation:call.arguments[@"orientation"]];
+      },
+      @"unlockCaptureOrientation" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                      FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera unlockCaptureOrientationWithResult:result];
+      },
+      @"setFocusMode" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                          FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera setFocusModeWithResult:result mode:call.arguments[@"mode"]];
+      },
+      @"setFocusPoint" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                           FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        CGPoint point = [plugin pointOfInterestForArguments:call.arguments];
+        [camera setFocusPointWithResult:result x:point.x y:point.y];
+      },
+      @"pausePreview" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                          FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera pausePreviewWithResult:result];
+      },
+      @"resumePreview" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                           FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera resumePreviewWithResult:result];
+      },
+      @"setDescriptionWhileRecording" : ^(CameraPlugin *plugin, FlutterMethodCall *call,
+                                          FLTThreadSafeFlutterResult *result, FLTCam *camera) {
+        [camera setDescriptionWhileRecording:call.arguments[@"cameraName"] result:result];
+      },
+    };
+  });
+  return handlers;
+}
+
+- (void)handleAvailableCamerasWithResult:(FLTThreadSafeFlutterResult *)result {
+  NSMutableArray *discoveryDevices =
+      [@[ AVCaptureDeviceTypeBuiltInWideAngleCamera, AVCaptureDeviceTypeBuiltInTelephotoCamera ]
+          mutableCopy];
+  if (@available(iOS 13.0, *)) {
+    [discoveryDevices addObject:AVCaptureDeviceTypeBuiltInUltraWideCamera];
+  }
+  AVCaptureDeviceDiscoverySession *discoverySession = [AVCaptureDeviceDiscoverySession
+      discoverySessionWithDeviceTypes:discoveryDevices
+                            mediaType:AVMediaTypeVideo
+                             position:AVCaptureDevicePositionUnspecified];
+  NSArray<AVCaptureDevice *> *devices = discoverySession.devices;
+  NSMutableArray<NSDictionary<NSString *, NSObject *> *> *reply =
+      [[NSMutableArray alloc] initWithCapacity:devices.count];
+  for (AVCaptureDevice *device in devices) {
+    NSString *lensFacing;
+    switch ([device position]) {
+      case AVCaptureDevicePositionBack:
+        lensFacing = @"back";
+        break;
+      case AVCaptureDevicePositionFront:
+        lensFacing = @"front";
+        break;
+      case AVCaptureDevicePositionUnspecified:
+        lensFacing = @"external";
+        break;
     }
+    [reply addObject:@{
+      @"name" : [device uniqueID],
+      @"lensFacing" : lensFacing,
+      @"sensorOrientation" : @90,
+    }];
   }
+  [result sendSuccessWithData:reply];
+}
+
+- (void)initializeCameraWithMethodCall:(FlutterMethodCall *)call
+                                result:(FLTThreadSafeFlutterResult *)result {
+  NSUInteger cameraId = ((NSNumber *)call.arguments[@"cameraId"]).unsignedIntegerValue;
+  FLTCam *camera = [self cameraForArguments:call.arguments];
+  NSString *videoFormatValue = ((NSString *)call.arguments[@"imageFormatGroup"]);
+  [camera setVideoFormat:FLTGetVideoFormatFromString(videoFormatValue)];
+
+  __weak CameraPlugin *weakSelf = self;
+  __weak FLTCam *weakCamera = camera;
+  camera.onFrameAvailable = ^{
+    if (![weakCamera isPreviewPaused]) {
+      [weakSelf.registry textureFrameAvailable:cameraId];
+    }
+  };
+  FlutterMethodChannel *methodChannel = [FlutterMethodChannel
+      methodChannelWithName:
+          [NSString stringWithFormat:@"plugins.flutter.io/camera_avfoundation/camera%lu",
+                                     (unsigned long)cameraId]
+            binaryMessenger:_messenger];
+  FLTThreadSafeMethodChannel *threadSafeMethodChannel =
+      [[FLTThreadSafeMethodChannel alloc] initWithMethodChannel:methodChannel];
+  camera.methodChannel = threadSafeMethodChannel;
+  [threadSafeMethodChannel
+      invokeMethod:@"initialized"
+         arguments:@{
+           @"previewWidth" : @(camera.previewSize.width),
+           @"previewHeight" : @(camera.previewSize.height),
+           @"exposureMode" : FLTGetStringForFLTExposureMode([camera exposureMode]),
+           @"focusMode" : FLTGetStringForFLTFocusMode([camera focusMode]),
+           @"exposurePointSupported" : @([camera.captureDevice isExposurePointOfInterestSupported]),
+           @"focusPointSupported" : @([camera.captureDevice isFocusPointOfInterestSupported]),
+         }];
+  [self sendDeviceOrientation:[UIDevice currentDevice].orientation];
+  [camera start];
+  [result sendSuccess];
+}
+
+/// Returns the point of interest in `setExposurePoint` or `setFocusPoint` arguments, or the center
+/// of the frame if the point is being reset.
+- (CGPoint)pointOfInterestForArguments:(NSDictionary *)arguments {
+  BOOL reset = ((NSNumber *)arguments[@"reset"]).boolValue;
+  if (reset) {
+    return CGPointMake(0.5, 0.5);
+  }
+  return CGPointMake(((NSNumber *)arguments[@"x"]).doubleValue,
+                     ((NSNumber *)arguments[@"y"]).doubleValue);
 }
 
 - (void)handleCreateMethodCall:(FlutterMethodCall *)call
@@ -295,6 +453,230 @@
   });
 }
 
+- (void)prewarmCameraWithMethodCall:(FlutterMethodCall *)call {
+  // Prewarming must not show a permission prompt, so it does nothing until access is granted.
+  if ([AVCaptureDevice authorizationStatusForMediaType:AVMediaTypeVideo] !=
+      AVAuthorizationStatusAuthorized) {
+    return;
+  }
+  if ([self.prewarmedCameraArguments isEqual:call.arguments]) {
+    return;
+  }
+  [self.prewarmedCamera close];
+  self.prewarmedCamera = nil;
+  self.prewarmedCameraArguments = nil;
+
+  NSError *error;
+  FLTCam *cam = [self cameraWithCreateArguments:call.arguments error:&error];
+  if (!error) {
+    self.prewarmedCamera = cam;
+    self.prewarmedCameraArguments = call.arguments;
+  }
+}
+
+- (nullable FLTCam *)cameraWithCreateArguments:(NSDictionary *)arguments
+                                         error:(NSError **)error {
+  // Reuse the prewarmed camera if it was configured the same way, so that only the texture is left
+  // to set up.
+  FLTCam *prewarmedCamera = self.prewarmedCamera;
+  BOOL canUsePrewarmedCamera = [self.prewarmedCameraArguments isEqual:arguments];
+  self.prewarmedCamera = nil;
+  self.prewarmedCameraArguments = nil;
+  if (canUsePrewarmedCamera) {
+    return prewarmedCamera;
+  }
+  [prewarmedCamera close];
+
+  NSString *cameraName = arguments[@"cameraName"];
+  NSString *resolutionPreset = arguments[@"resolutionPreset"];
+  NSNumber *enableAudio = arguments[@"enableAudio"];
+  if ([arguments[@"multiCam"] boolValue]) {
+    AVCaptureSession *multiCamSession = [self sharedMultiCamSession];
+    if (!multiCamSession) {
+      *error = [NSError errorWithDomain:NSCocoaErrorDomain
+                                   code:NSURLErrorUnknown
+                               userInfo:@{
+                                 NSLocalizedDescriptionKey :
+                                     @"Multi-cam sessions are not supported on this device."
+                               }];
+      return nil;
+    }
+    return [[FLTCam alloc] initWithCameraName:cameraName
+                             resolutionPreset:resolutionPreset
+                                  enableAudio:[enableAudio boolValue]
+                                  orientation:[[UIDevice currentDevice] orientation]
+                          videoCaptureSession:multiCamSession
+                          captureSessionQueue:self.captureSessionQueue
+                                        error:error];
+  }
+  return [[FLTCam alloc] initWithCameraName:cameraName
+                           resolutionPreset:resolutionPreset
+                                enableAudio:[enableAudio boolValue]
+                                orientation:[[UIDevice currentDevice] orientation]
+                        captureSessionQueue:self.captureSessionQueue
+                                      error:error];
+}
+
+/// Returns the multi-cam session shared by cameras created with `multiCam`, creating it if needed,
+/// or nil if the device doesn't support multi-cam sessions.
+- (nullable AVCaptureSession *)sharedMultiCamSession {
+  if (@available(iOS 13.0, *)) {
+    if (!AVCaptureMultiCamSession.isMultiCamSupported) {
+      return nil;
+    }
+    if (!self.multiCamSession) {
+      self.multiCamSession = [[AVCaptureMultiCamSession alloc] init];
+    }
+    return self.multiCamSession;
+  }
+  return nil;
+}
+
+- (void)setVideoRecordingSettingsWithArguments:(NSDictionary *)arguments
+                                        result:(FLTThreadSafeFlutterResult *)result {
+  NSString *codecString = arguments[@"codec"];
+  AVVideoCodecType codec = nil;
+  if (codecString != nil && codecString != (id)[NSNull null]) {
+    codec = FLTGetAVVideoCodecTypeForString(codecString);
+    if (!codec) {
+      [result sendErrorWithCode:@"UnsupportedCodec"
+                        message:[NSString stringWithFormat:@"Unsupported video codec %@",
+                                                           codecString]
+                        details:nil];
+      return;
+    }
+  }
+  NSNumber *fragmentIntervalMilliseconds =
+      [self numberArgument:arguments[@"movieFragmentInterval"]];
+
+  FLTCam *camera = [self cameraForArguments:arguments];
+  camera.videoCodec = codec;
+  camera.videoAverageBitRate = [self numberArgument:arguments[@"averageBitRate"]];
+  camera.videoMaxKeyFrameInterval = [self numberArgument:arguments[@"maxKeyFrameInterval"]];
+  camera.videoExpectedFrameRate = [self numberArgument:arguments[@"expectedFrameRate"]];
+  camera.movieFragmentInterval =
+      fragmentIntervalMilliseconds
+          ? CMTimeMake(fragmentIntervalMilliseconds.longLongValue, 1000)
+          : kCMTimeInvalid;
+  camera.prefersMovieFileOutput = [arguments[@"preferMovieFileOutput"] boolValue];
+  [result sendSuccess];
+}
+
+- (void)setPictureSettingsWithArguments:(NSDictionary *)arguments
+                                 result:(FLTThreadSafeFlutterResult *)result {
+  NSString *formatString = arguments[@"format"];
+  FLTPictureFormat format = FLTGetFLTPictureFormatForString(formatString);
+  if (format == FLTPictureFormatInvalid) {
+    [result sendErrorWithCode:@"UnsupportedPictureFormat"
+                      message:[NSString stringWithFormat:@"Unsupported picture format %@",
+                                                         formatString]
+                      details:nil];
+    return;
+  }
+  NSString *prioritizationString = arguments[@"qualityPrioritization"];
+  FLTPhotoQualityPrioritization prioritization =
+      FLTGetFLTPhotoQualityPrioritizationForString(prioritizationString);
+  if (prioritization == FLTPhotoQualityPrioritizationInvalid) {
+    [result sendErrorWithCode:@"UnsupportedQualityPrioritization"
+                      message:[NSString stringWithFormat:@"Unsupported quality prioritization %@",
+                                                         prioritizationString]
+                      details:nil];
+    return;
+  }
+
+  FLTCam *camera = [self cameraForArguments:arguments];
+  camera.pictureFormat = format;
+  camera.photoQualityPrioritization = prioritization;
+  [result sendSuccess];
+}
+
+- (void)setImageStreamSettingsWithArguments:(NSDictionary *)arguments
+                                     result:(FLTThreadSafeFlutterResult *)result {
+  NSString *formatString = arguments[@"format"];
+  FLTImageStreamFormat format = FLTGetFLTImageStreamFormatForString(formatString);
+  if (format == FLTImageStreamFormatInvalid) {
+    [result sendErrorWithCode:@"UnsupportedImageStreamFormat"
+                      message:[NSString stringWithFormat:@"Unsupported image stream format %@",
+                                                         formatString]
+                      details:nil];
+    return;
+  }
+  NSNumber *width = [self numberArgument:arguments[@"width"]];
+  NSNumber *height = [self numberArgument:arguments[@"height"]];
+  if ((width == nil) != (height == nil) || (width && width.longLongValue <= 0) ||
+      (height && height.longLongValue <= 0)) {
+    [result sendErrorWithCode:@"InvalidImageStreamSize"
+                      message:@"Width and height must both be positive, or both be null"
+                      details:nil];
+    return;
+  }
+  CGRect cropRect = CGRectNull;
+  id cropArgument = arguments[@"cropRect"];
+  if ([cropArgument isKindOfClass:[NSDictionary class]]) {
+    cropRect = CGRectMake([cropArgument[@"x"] doubleValue], [cropArgument[@"y"] doubleValue],
+                          [cropArgument[@"width"] doubleValue],
+                          [cropArgument[@"height"] doubleValue]);
+    if (CGRectIsEmpty(cropRect) || !CGRectContainsRect(CGRectMake(0, 0, 1, 1), cropRect)) {
+      [result sendErrorWithCode:@"InvalidImageStreamCropRect"
+                        message:@"The crop rect must be a non-empty part of the unit square"
+                        details:nil];
+      return;
+    }
+  }
+
+  FLTCam *camera = [self cameraForArguments:arguments];
+  if (format == FLTImageStreamFormatNative && width == nil && CGRectIsNull(cropRect)) {
+    camera.imageStreamConverter = nil;
+  } else {
+    camera.imageStreamConverter =
+        [[FLTImageStreamConverter alloc] initWithFormat:format
+                                                  width:width.unsignedLongValue
+                                                 height:height.unsignedLongValue
+                                               cropRect:cropRect];
+  }
+  [result sendSuccess];
+}
+
+/// Returns the camera that `arguments` refer to by `cameraId`, or the most recently created camera
+/// for arguments without a known camera id.
+- (nullable FLTCam *)cameraForArguments:(id)arguments {
+  if ([arguments isKindOfClass:[NSDictionary class]]) {
+    NSNumber *cameraId = [self numberArgument:arguments[@"cameraId"]];
+    FLTCam *camera = cameraId ? self.cameras[cameraId] : nil;
+    if (camera) {
+      return camera;
+    }
+  }
+  return self.camera;
+}
+
+/// Returns every open camera.
+- (NSSet<FLTCam *> *)allCameras {
+  NSMutableSet<FLTCam *> *cameras = [NSMutableSet setWithArray:self.cameras.allValues];
+  if (self.camera) {
+    [cameras addObject:self.camera];
+  }
+  return cameras;
+}
+
+- (void)handleGetMultiCamCostWithResult:(FLTThreadSafeFlutterResult *)result {
+  float hardwareCost = 0;
+  float systemPressureCost = 0;
+  if (@available(iOS 13.0, *)) {
+    hardwareCost = self.multiCamSession.hardwareCost;
+    systemPressureCost = self.multiCamSession.systemPressureCost;
+  }
+  [result sendSuccessWithData:@{
+    @"hardwareCost" : @(hardwareCost),
+    @"systemPressureCost" : @(systemPressureCost),
+  }];
+}
+
+/// Returns `argument` if it is a number, or nil if it is missing or null.
+- (nullable NSNumber *)numberArgument:(id)argument {
+  return [argument isKindOfClass:[NSNumber class]] ? argument : nil;
+}
+
 - (void)createCameraOnSessionQueueWithCreateMethodCall:(FlutterMethodCall *)createMethodCall
                                                 result:(FLTThreadSafeFlutterResult *)result {
   __weak typeof(self) weakSelf = self;
@@ -302,29 +684,32 @@
     typeof(self) strongSelf = weakSelf;
     if (!strongSelf) return;
 
-    NSString *cameraName = createMethodCall.arguments[@"cameraName"];
-    NSString *resolutionPreset = createMethodCall.arguments[@"resolutionPreset"];
-    NSNumber *enableAudio = createMethodCall.arguments[@"enableAudio"];
     NSError *error;
-    FLTCam *cam = [[FLTCam alloc] initWithCameraName:cameraName
-                                    resolutionPreset:resolutionPreset
-                                         enableAudio:[enableAudio boolValue]
-                                         orientation:[[UIDevice currentDevice] orientation]
-                                 captureSessionQueue:strongSelf.captureSessionQueue
-                                               error:&error];
+    FLTCam *cam = [strongSelf cameraWithCreateArguments:createMethodCall.arguments error:&error];
 
     if (error) {
       [result sendError:error];
     } else {
-      if (strongSelf.camera) {
-        [strongSelf.camera close];
+      // Only cameras sharing a multi-cam session can run at the same time.
+      for (FLTCam *camera in [strongSelf allCameras]) {
+        if (!(cam.usesMultiCamSession && camera.usesMultiCamSession)) {
+          [camera close];
+          [strongSelf.cameras removeObjectsForKeys:[strongSelf.cameras allKeysForObject:camera]];
+        }
       }
+      cam.sampleBufferConsumers = strongSelf.sampleBufferConsumers;
       strongSelf.camera = cam;
+      dispatch_queue_t captureSessionQueue = strongSelf.captureSessionQueue;
       [strongSelf.registry registerTexture:cam
                                 completion:^(int64_t textureId) {
-                                  [result sendSuccessWithData:@{
-                                    @"cameraId" : @(textureId),
-                                  }];
+                                  // The completion runs on the main queue, but `cameras` is only
+                                  // accessed on the capture session queue.
+                                  dispatch_async(captureSessionQueue, ^{
+                                    weakSelf.cameras[@(textureId)] = cam;
+                                    [result sendSuccessWithData:@{
+                                      @"cameraId" : @(textureId),
+                                    }];
+                                  });
                                 }];
     }
   });
@@ -14,9 +14,26 @@
 /// All FLTCam's state access and capture session related operations should be on run on this queue.
 @property(nonatomic, strong) dispatch_queue_t captureSessionQueue;
 
-/// An internal camera object that manages camera's state and performs camera operations.
+/// An internal camera object that manages camera's state and performs camera operations. The most
+/// recently created camera, which handles method calls that don't refer to another camera.
 @property(nonatomic, strong) FLTCam *camera;
 
+/// The open cameras, keyed by camera id. Several cameras can be open at once when they share
+/// `multiCamSession`. Only accessed on `captureSessionQueue`.
+@property(nonatomic, strong) NSMutableDictionary<NSNumber *, FLTCam *> *cameras;
+
+/// The session shared by cameras created with the `multiCam` argument, or nil until the first one
+/// is created. Only accessed on `captureSessionQueue`.
+@property(nonatomic, strong) AVCaptureMultiCamSession *multiCamSession API_AVAILABLE(ios(13.0));
+
+/// A camera configured ahead of a `create` call by `prewarm`, or nil. Only accessed on
+/// `captureSessionQueue`.
+@property(nonatomic, strong) FLTCam *prewarmedCamera;
+
+/// The `prewarm` arguments that `prewarmedCamera` was configured with. A `create` call with equal
+/// arguments takes over the prewarmed camera.
+@property(nonatomic, copy) NSDictionary *prewarmedCameraArguments;
+
 /// A thread safe wrapper of the method channel used to send device events such as orientation
 /// changes.
 @property(nonatomic, strong) FLTThreadSafeMethodChannel *deviceEventMethodChannel;
@@ -42,6 +59,11 @@
 /// that triggered the orientation change.
 - (void)orientationChanged:(NSNotification *)notification;
 
+/// Configures a camera on the session queue ahead of a `create` call with the same arguments.
+/// Does nothing if camera access has not been granted.
+/// @param call the prewarm method call, with the same arguments as a create method call.
+- (void)prewarmCameraWithMethodCall:(FlutterMethodCall *)call;
+
 /// Creates FLTCam on session queue and reports the creation result.
 /// @param createMethodCall the create method call
 /// @param result a thread safe flutter result wrapper object to report creation result.
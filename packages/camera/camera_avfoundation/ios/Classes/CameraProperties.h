@@ -127,4 +127,83 @@ extern FLTResolutionPreset FLTGetFLTResolutionPresetForString(NSString *preset);
  */
 extern OSType FLTGetVideoFormatFromString(NSString *videoFormatString);
 
+#pragma mark - video codec
+
+/**
+ * Gets the AVVideoCodecType for a string representation of a recording codec. Mirrors
+ * `AVFoundationVideoCodec` in video_recording_settings.dart.
+ * @return nil if the codec is unknown, or not available on this version of iOS.
+ */
+extern _Nullable AVVideoCodecType FLTGetAVVideoCodecTypeForString(NSString *codec);
+
+#pragma mark - picture settings
+
+/**
+ * Represents the file format of captured pictures. Mirrors `AVFoundationPictureFormat` in
+ * picture_settings.dart.
+ */
+typedef NS_ENUM(NSInteger, FLTPictureFormat) {
+  FLTPictureFormatJPEG,
+  FLTPictureFormatHEIC,
+  // This should never occur; it indicates an unknown value was received over
+  // the platform channel.
+  FLTPictureFormatInvalid,
+};
+
+/**
+ * Gets FLTPictureFormat from its string representation.
+ * @param format a string representation of the FLTPictureFormat.
+ */
+extern FLTPictureFormat FLTGetFLTPictureFormatForString(NSString *format);
+
+/**
+ * Represents how picture quality is traded against capture speed. Mirrors
+ * `AVFoundationPhotoQualityPrioritization` in picture_settings.dart.
+ */
+typedef NS_ENUM(NSInteger, FLTPhotoQualityPrioritization) {
+  FLTPhotoQualityPrioritizationSpeed,
+  FLTPhotoQualityPrioritizationBalanced,
+  FLTPhotoQualityPrioritizationQuality,
+  // This should never occur; it indicates an unknown value was received over
+  // the platform channel.
+  FLTPhotoQualityPrioritizationInvalid,
+};
+
+/**
+ * Gets FLTPhotoQualityPrioritization from its string representation.
+ * @param prioritization a string representation of the FLTPhotoQualityPrioritization.
+ */
+extern FLTPhotoQualityPrioritization FLTGetFLTPhotoQualityPrioritizationForString(
+    NSString *prioritization);
+
+/**
+ * Gets AVCapturePhotoQualityPrioritization from FLTPhotoQualityPrioritization.
+ * @param prioritization a valid quality prioritization.
+ */
+extern AVCapturePhotoQualityPrioritization
+FLTGetAVCapturePhotoQualityPrioritizationForFLTPhotoQualityPrioritization(
+    FLTPhotoQualityPrioritization prioritization) API_AVAILABLE(ios(13.0));
+
+#pragma mark - image stream format
+
+/**
+ * Represents the pixel format of image stream frames. Mirrors `AVFoundationImageStreamFormat` in
+ * image_stream_settings.dart.
+ */
+typedef NS_ENUM(NSInteger, FLTImageStreamFormat) {
+  FLTImageStreamFormatNative,
+  FLTImageStreamFormatRGB888,
+  FLTImageStreamFormatRGBA8888,
+  FLTImageStreamFormatGray8,
+  // This should never occur; it indicates an unknown value was received over
+  // the platform channel.
+  FLTImageStreamFormatInvalid,
+};
+
+/**
+ * Gets FLTImageStreamFormat from its string representation.
+ * @param format a string representation of the FLTImageStreamFormat.
+ */
+extern FLTImageStreamFormat FLTGetFLTImageStreamFormatForString(NSString *format);
+
 NS_ASSUME_NONNULL_END
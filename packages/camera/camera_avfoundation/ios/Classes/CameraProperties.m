@@ -143,8 +143,81 @@ OSType FLTGetVideoFormatFromString(NSString *videoFormatString) {
     return kCVPixelFormatType_32BGRA;
   } else if ([videoFormatString isEqualToString:@"yuv420"]) {
     return kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
+  } else if ([videoFormatString isEqualToString:@"yuv420FullRange"]) {
+    return kCVPixelFormatType_420YpCbCr8BiPlanarFullRange;
   } else {
     NSLog(@"The selected imageFormatGroup is not supported by iOS. Defaulting to brga8888");
     return kCVPixelFormatType_32BGRA;
   }
 }
+
+#pragma mark - video codec
+
+AVVideoCodecType FLTGetAVVideoCodecTypeForString(NSString *codec) {
+  if ([codec isEqualToString:@"h264"]) {
+    return AVVideoCodecTypeH264;
+  } else if ([codec isEqualToString:@"hevc"]) {
+    return AVVideoCodecTypeHEVC;
+  } else if ([codec isEqualToString:@"hevcWithAlpha"]) {
+    if (@available(iOS 13.0, *)) {
+      return AVVideoCodecTypeHEVCWithAlpha;
+    }
+    return nil;
+  }
+  return nil;
+}
+
+#pragma mark - picture settings
+
+FLTPictureFormat FLTGetFLTPictureFormatForString(NSString *format) {
+  if ([format isEqualToString:@"jpeg"]) {
+    return FLTPictureFormatJPEG;
+  } else if ([format isEqualToString:@"heic"]) {
+    return FLTPictureFormatHEIC;
+  } else {
+    return FLTPictureFormatInvalid;
+  }
+}
+
+FLTPhotoQualityPrioritization FLTGetFLTPhotoQualityPrioritizationForString(
+    NSString *prioritization) {
+  if ([prioritization isEqualToString:@"speed"]) {
+    return FLTPhotoQualityPrioritizationSpeed;
+  } else if ([prioritization isEqualToString:@"balanced"]) {
+    return FLTPhotoQualityPrioritizationBalanced;
+  } else if ([prioritization isEqualToString:@"quality"]) {
+    return FLTPhotoQualityPrioritizationQuality;
+  } else {
+    return FLTPhotoQualityPrioritizationInvalid;
+  }
+}
+
+AVCapturePhotoQualityPrioritization
+FLTGetAVCapturePhotoQualityPrioritizationForFLTPhotoQualityPrioritization(
+    FLTPhotoQualityPrioritization prioritization) {
+  switch (prioritization) {
+    case FLTPhotoQualityPrioritizationSpeed:
+      return AVCapturePhotoQualityPrioritizationSpeed;
+    case FLTPhotoQualityPrioritizationQuality:
+      return AVCapturePhotoQualityPrioritizationQuality;
+    case FLTPhotoQualityPrioritizationBalanced:
+    default:
+      return AVCapturePhotoQualityPrioritizationBalanced;
+  }
+}
+
+#pragma mark - image stream format
+
+FLTImageStreamFormat FLTGetFLTImageStreamFormatForString(NSString *format) {
+  if ([format isEqualToString:@"native"]) {
+    return FLTImageStreamFormatNative;
+  } else if ([format isEqualToString:@"rgb888"]) {
+    return FLTImageStreamFormatRGB888;
+  } else if ([format isEqualToString:@"rgba8888"]) {
+    return FLTImageStreamFormatRGBA8888;
+  } else if ([format isEqualToString:@"gray8"]) {
+    return FLTImageStreamFormatGray8;
+  } else {
+    return FLTImageStreamFormatInvalid;
+  }
+}
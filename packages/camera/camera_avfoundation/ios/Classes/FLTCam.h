@@ -7,6 +7,8 @@
 @import Flutter;
 
 #import "CameraProperties.h"
+#import "FLTImageStreamConverter.h"
+#import "FLTSampleBufferConsumer.h"
 #import "FLTThreadSafeEventChannel.h"
 #import "FLTThreadSafeFlutterResult.h"
 #import "FLTThreadSafeMethodChannel.h"
@@ -30,6 +32,52 @@ NS_ASSUME_NONNULL_BEGIN
 @property(assign, nonatomic) FLTFlashMode flashMode;
 // Format used for video and image streaming.
 @property(assign, nonatomic) FourCharCode videoFormat;
+/// The codec for later video recordings, or nil to use the capture output's recommended codec.
+/// Falls back to the recommended codec if the device cannot record with this one.
+@property(nonatomic, copy, nullable) AVVideoCodecType videoCodec;
+/// The average bit rate for later video recordings, in bits per second, or nil for the default.
+@property(nonatomic, nullable) NSNumber *videoAverageBitRate;
+/// The maximum number of frames between key frames for later video recordings, or nil for the
+/// default.
+@property(nonatomic, nullable) NSNumber *videoMaxKeyFrameInterval;
+/// The frame rate the encoder should expect for later video recordings, or nil for the default.
+@property(nonatomic, nullable) NSNumber *videoExpectedFrameRate;
+/// How often later recordings write a movie fragment, so that a recording interrupted by a crash is
+/// still readable up to the last fragment. Invalid (the default) to write a single fragment at the
+/// end.
+@property(assign, nonatomic) CMTime movieFragmentInterval;
+/// Whether later recordings should be written by an `AVCaptureMovieFileOutput`, which encodes
+/// and writes the samples without them passing through the sample buffer callback.
+///
+/// Only plain recordings use the movie file output: recordings that stream images, set encoder
+/// properties other than the codec, or run in a multi-cam session use the asset writer, as do
+/// recordings on devices that can't feed the preview and a movie file output at once. Recordings
+/// that use the movie file output are QuickTime movies and can't be paused.
+@property(assign, nonatomic) BOOL prefersMovieFileOutput;
+/// The file format of later pictures. HEIC falls back to JPEG if the device cannot encode it.
+@property(assign, nonatomic) FLTPictureFormat pictureFormat;
+/// How later pictures trade image quality against capture speed. Ignored before iOS 13.
+@property(assign, nonatomic) FLTPhotoQualityPrioritization photoQualityPrioritization;
+/// The number of captured frames that were replaced by a newer frame before the engine picked them
+/// up with `copyPixelBuffer`. Can be read on any thread.
+@property(readonly, nonatomic) uint64_t replacedPixelBufferCount;
+/// The number of captured frames that were not sent to the image stream because the listener had
+/// not acknowledged enough of the earlier ones. Can be read on any thread.
+@property(readonly, nonatomic) uint64_t droppedImageStreamFrameCount;
+/// The number of video and audio samples that were left out of recordings because the writer could
+/// not keep up with them. Can be read on any thread.
+@property(readonly, nonatomic) uint64_t droppedRecordingSampleCount;
+/// YES if the camera shares an `AVCaptureMultiCamSession` with other cameras. Such a camera picks a
+/// multi-cam capable device format for its resolution preset instead of a session preset, and
+/// leaves the session running when it is closed while other cameras still use it.
+@property(readonly, nonatomic) BOOL usesMultiCamSession;
+/// Crops, scales and converts image stream frames, or nil to stream the camera's frames as they
+/// are. Should only be accessed on the capture session queue.
+@property(nonatomic, nullable) FLTImageStreamConverter *imageStreamConverter;
+/// Native consumers that receive each video frame. Should only be accessed on the capture session
+/// queue.
+@property(nonatomic, nullable)
+    NSHashTable<NSObject<FLTSampleBufferConsumer> *> *sampleBufferConsumers;
 
 /// Initializes an `FLTCam` instance.
 /// @param cameraName a name used to uniquely identify the camera.
@@ -44,10 +92,23 @@ NS_ASSUME_NONNULL_BEGIN
                        orientation:(UIDeviceOrientation)orientation
                captureSessionQueue:(dispatch_queue_t)captureSessionQueue
                              error:(NSError **)error;
+/// Initializes an `FLTCam` instance that adds its input and outputs to `videoCaptureSession`, such
+/// as an `AVCaptureMultiCamSession` shared with other cameras.
+/// @param videoCaptureSession the session that captures video from the camera.
+- (instancetype)initWithCameraName:(NSString *)cameraName
+                  resolutionPreset:(NSString *)resolutionPreset
+                       enableAudio:(BOOL)enableAudio
+                       orientation:(UIDeviceOrientation)orientation
+               videoCaptureSession:(AVCaptureSession *)videoCaptureSession
+               captureSessionQueue:(dispatch_queue_t)captureSessionQueue
+                             error:(NSError **)error;
 - (void)start;
 - (void)stop;
 - (void)setDeviceOrientation:(UIDeviceOrientation)orientation;
 - (void)captureToFile:(FLTThreadSafeFlutterResult *)result;
+/// Captures a picture and sends its file data to `result` as typed data, without writing it to a
+/// file.
+- (void)captureToMemory:(FLTThreadSafeFlutterResult *)result;
 - (void)close;
 - (void)startVideoRecordingWithResult:(FLTThreadSafeFlutterResult *)result;
 /**
@@ -78,6 +139,11 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)receivedImageStreamData;
 
+/**
+ * Acknowledges the receipt of `count` image stream frames at once.
+ */
+- (void)receivedImageStreamDataCount:(int)count;
+
 /**
  * Applies FocusMode on the AVCaptureDevice.
  *
@@ -93,6 +159,43 @@ NS_ASSUME_NONNULL_BEGIN
  * @param captureDevice The AVCaptureDevice to which the @focusMode will be applied.
  */
 - (void)applyFocusMode:(FLTFocusMode)focusMode onDevice:(AVCaptureDevice *)captureDevice;
+
+/**
+ * Limits the rate at which the camera captures frames, which applies to the preview, image
+ * streams and recordings alike. Lowering the maximum frame rate reduces power use and heat.
+ *
+ * @param minFrameRate The lowest frame rate, or nil for the current format's default.
+ * @param maxFrameRate The highest frame rate, or nil for the current format's default.
+ */
+- (void)setFrameRateRangeWithResult:(FLTThreadSafeFlutterResult *)result
+                       minFrameRate:(nullable NSNumber *)minFrameRate
+                       maxFrameRate:(nullable NSNumber *)maxFrameRate;
+
+/**
+ * Applies a frame rate range on the AVCaptureDevice.
+ *
+ * @param minFrameRate The lowest frame rate, or nil for the active format's default.
+ * @param maxFrameRate The highest frame rate, or nil for the active format's default.
+ * @param captureDevice The AVCaptureDevice to which the frame rate range will be applied.
+ * @param error Set if the range is empty, the active format doesn't support one of the frame
+ * rates, or the device can't be locked for configuration.
+ * @return YES if the frame rate range was applied.
+ */
+- (BOOL)applyFrameRateRangeWithMinFrameRate:(nullable NSNumber *)minFrameRate
+                               maxFrameRate:(nullable NSNumber *)maxFrameRate
+                                   onDevice:(AVCaptureDevice *)captureDevice
+                                      error:(NSError **)error;
+
+/**
+ * Sets the pixel format of preview frames, which image streams also use.
+ *
+ * The engine converts YUV frames to RGB on the GPU when drawing the preview, so a YUV format that
+ * matches the camera's native output avoids a conversion by the image signal processor.
+ *
+ * @param formatStr One of "bgra8888", "yuv420" (video range) or "yuv420FullRange".
+ */
+- (void)setPreviewPixelFormatWithResult:(FLTThreadSafeFlutterResult *)result
+                                 format:(NSString *)formatStr;
 - (void)pausePreviewWithResult:(FLTThreadSafeFlutterResult *)result;
 - (void)resumePreviewWithResult:(FLTThreadSafeFlutterResult *)result;
 - (void)setDescriptionWhileRecording:(NSString *)cameraName
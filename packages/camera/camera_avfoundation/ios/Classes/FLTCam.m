@@ -9,6 +9,7 @@
 
 @import CoreMotion;
 #import <libkern/OSAtomic.h>
+#import <stdatomic.h>
 
 @implementation FLTImageStreamHandler
 
@@ -38,7 +39,23 @@
 @end
 
 @interface FLTCam () <AVCaptureVideoDataOutputSampleBufferDelegate,
-                      AVCaptureAudioDataOutputSampleBufferDelegate>
+                      AVCaptureAudioDataOutputSampleBufferDelegate,
+                      AVCaptureFileOutputRecordingDelegate> {
+  /// Tracks the latest pixel buffer sent from AVFoundation's sample buffer delegate callback.
+  /// Used to deliver the latest pixel buffer to the flutter engine via the `copyPixelBuffer` API.
+  ///
+  /// The capture session queue and the raster thread hand buffers over by atomically exchanging
+  /// this pointer, so neither has to wait for the other.
+  _Atomic(CVPixelBufferRef) _latestPixelBuffer;
+  /// Backs `replacedPixelBufferCount`.
+  atomic_uint_fast64_t _replacedPixelBufferCount;
+  /// Backs `droppedImageStreamFrameCount`.
+  atomic_uint_fast64_t _droppedImageStreamFrameCount;
+  /// Backs `droppedRecordingSampleCount`.
+  atomic_uint_fast64_t _droppedRecordingSampleCount;
+  /// The number of samples handed to `writerQueue` that have not been appended or dropped yet.
+  atomic_int _pendingRecordingSampleCount;
+}
 
 @property(readonly, nonatomic) int64_t textureId;
 @property BOOL enableAudio;
@@ -47,9 +64,6 @@
 @property(readonly, nonatomic) AVCaptureSession *audioCaptureSession;
 
 @property(readonly, nonatomic) AVCaptureInput *captureVideoInput;
-/// Tracks the latest pixel buffer sent from AVFoundation's sample buffer delegate callback.
-/// Used to deliver the latest pixel buffer to the flutter engine via the `copyPixelBuffer` API.
-@property(readwrite, nonatomic) CVPixelBufferRef latestPixelBuffer;
 @property(readonly, nonatomic) CGSize captureSize;
 @property(strong, nonatomic) AVAssetWriter *videoWriter;
 @property(strong, nonatomic) AVAssetWriterInput *videoWriterInput;
@@ -57,6 +71,10 @@
 @property(strong, nonatomic) AVAssetWriterInputPixelBufferAdaptor *assetWriterPixelBufferAdaptor;
 @property(strong, nonatomic) AVCaptureVideoDataOutput *videoOutput;
 @property(strong, nonatomic) AVCaptureAudioDataOutput *audioOutput;
+@property(strong, nonatomic) AVCaptureDeviceInput *audioInput;
+/// The result of the call that stopped the recording written by `movieFileOutput`, completed when
+/// the output has finished the file.
+@property(strong, nonatomic) FLTThreadSafeFlutterResult *movieFileOutputStopResult;
 @property(strong, nonatomic) NSString *videoRecordingPath;
 @property(assign, nonatomic) BOOL isRecording;
 @property(assign, nonatomic) BOOL isRecordingPaused;
@@ -79,15 +97,37 @@
 @property AVAssetWriterInputPixelBufferAdaptor *videoAdaptor;
 /// All FLTCam's state access and capture session related operations should be on run on this queue.
 @property(strong, nonatomic) dispatch_queue_t captureSessionQueue;
-/// The queue on which `latestPixelBuffer` property is accessed.
-/// To avoid unnecessary contention, do not access `latestPixelBuffer` on the `captureSessionQueue`.
-@property(strong, nonatomic) dispatch_queue_t pixelBufferSynchronizationQueue;
 /// The queue on which captured photos (not videos) are written to disk.
-/// Videos are written to disk by `videoAdaptor` on an internal queue managed by AVFoundation.
+/// Videos are handed to their writer on `writerQueue`.
 @property(strong, nonatomic) dispatch_queue_t photoIOQueue;
 @property(assign, nonatomic) UIDeviceOrientation deviceOrientation;
 @end
 
+/// Returns data that refers to `length` bytes at `address` inside `pixelBuffer`, without copying
+/// them.
+///
+/// The data keeps `pixelBuffer` retained and its base address locked for reading until the data
+/// is deallocated, so that the message codec can read the pixels directly after the sample buffer
+/// callback has returned.
+static NSData *FLTCreateNoCopyPlaneData(CVPixelBufferRef pixelBuffer, void *address,
+                                        size_t length) {
+  CVPixelBufferRetain(pixelBuffer);
+  // Base address locks are counted, so each plane can hold its own lock.
+  CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+  return [[NSData alloc] initWithBytesNoCopy:address
+                                      length:length
+                                 deallocator:^(void *bytes, NSUInteger dataLength) {
+                                   CVPixelBufferUnlockBaseAddress(pixelBuffer,
+                                                                  kCVPixelBufferLock_ReadOnly);
+                                   CVPixelBufferRelease(pixelBuffer);
+                                 }];
+}
+
+/// The maximum number of samples waiting on the writer queue. Samples arriving while the queue is
+/// full are dropped, so that a stalled writer neither holds up the preview nor keeps buffers from
+/// the capture output's small pool.
+static const int kFLTMaxPendingRecordingSampleCount = 8;
+
 @implementation FLTCam
 
 NSString *const errorMethod = @"error";
@@ -108,6 +148,23 @@ NSString *const errorMethod = @"error";
                             error:error];
 }
 
+- (instancetype)initWithCameraName:(NSString *)cameraName
+                  resolutionPreset:(NSString *)resolutionPreset
+                       enableAudio:(BOOL)enableAudio
+                       orientation:(UIDeviceOrientation)orientation
+               videoCaptureSession:(AVCaptureSession *)videoCaptureSession
+               captureSessionQueue:(dispatch_queue_t)captureSessionQueue
+                             error:(NSError **)error {
+  return [self initWithCameraName:cameraName
+                 resolutionPreset:resolutionPreset
+                      enableAudio:enableAudio
+                      orientation:orientation
+              videoCaptureSession:videoCaptureSession
+              audioCaptureSession:[[AVCaptureSession alloc] init]
+              captureSessionQueue:captureSessionQueue
+                            error:error];
+}
+
 - (instancetype)initWithCameraName:(NSString *)cameraName
                   resolutionPreset:(NSString *)resolutionPreset
                        enableAudio:(BOOL)enableAudio
@@ -130,12 +187,19 @@ NSString *const errorMethod = @"error";
     return nil;
   }
   _enableAudio = enableAudio;
+  _movieFragmentInterval = kCMTimeInvalid;
   _captureSessionQueue = captureSessionQueue;
-  _pixelBufferSynchronizationQueue =
-      dispatch_queue_create("io.flutter.camera.pixelBufferSynchronizationQueue", NULL);
-  _photoIOQueue = dispatch_queue_create("io.flutter.camera.photoIOQueue", NULL);
+  // Each capture writes to its own file, so back-to-back captures don't need to wait for each
+  // other's disk writes.
+  _photoIOQueue =
+      dispatch_queue_create("io.flutter.camera.photoIOQueue", DISPATCH_QUEUE_CONCURRENT);
+  _imageStreamQueue = dispatch_queue_create("io.flutter.camera.imageStreamQueue", NULL);
+  _writerQueue = dispatch_queue_create("io.flutter.camera.writerQueue", NULL);
   _videoCaptureSession = videoCaptureSession;
   _audioCaptureSession = audioCaptureSession;
+  if (@available(iOS 13.0, *)) {
+    _usesMultiCamSession = [videoCaptureSession isKindOfClass:[AVCaptureMultiCamSession class]];
+  }
   _captureDevice = [AVCaptureDevice deviceWithUniqueID:cameraName];
   _flashMode = _captureDevice.hasFlash ? FLTFlashModeAuto : FLTFlashModeOff;
   _exposureMode = FLTExposureModeAuto;
@@ -143,6 +207,8 @@ NSString *const errorMethod = @"error";
   _lockedCaptureOrientation = UIDeviceOrientationUnknown;
   _deviceOrientation = orientation;
   _videoFormat = kCVPixelFormatType_32BGRA;
+  _pictureFormat = FLTPictureFormatJPEG;
+  _photoQualityPrioritization = FLTPhotoQualityPrioritizationBalanced;
   _inProgressSavePhotoDelegates = [NSMutableDictionary dictionary];
 
   // To limit memory consumption, limit the number of frames pending processing.
@@ -157,13 +223,25 @@ NSString *const errorMethod = @"error";
     return nil;
   }
 
+  // A shared session may already be running other cameras, so add everything in one change.
+  [_videoCaptureSession beginConfiguration];
   [_videoCaptureSession addInputWithNoConnections:_captureVideoInput];
   [_videoCaptureSession addOutputWithNoConnections:_captureVideoOutput];
   [_videoCaptureSession addConnection:connection];
 
   _capturePhotoOutput = [AVCapturePhotoOutput new];
   [_capturePhotoOutput setHighResolutionCaptureEnabled:YES];
-  [_videoCaptureSession addOutput:_capturePhotoOutput];
+  if (_usesMultiCamSession) {
+    // A multi-cam session can't tell which camera an output belongs to, so it must be connected
+    // explicitly.
+    [_videoCaptureSession addOutputWithNoConnections:_capturePhotoOutput];
+    [_videoCaptureSession
+        addConnection:[AVCaptureConnection connectionWithInputPorts:_captureVideoInput.ports
+                                                             output:_capturePhotoOutput]];
+  } else {
+    [_videoCaptureSession addOutput:_capturePhotoOutput];
+  }
+  [_videoCaptureSession commitConfiguration];
 
   _motionManager = [[CMMotionManager alloc] init];
   [_motionManager startAccelerometerUpdates];
@@ -208,7 +286,10 @@ NSString *const errorMethod = @"error";
 }
 
 - (void)stop {
-  [_videoCaptureSession stopRunning];
+  // Other cameras may still be using a shared session.
+  if (!_usesMultiCamSession) {
+    [_videoCaptureSession stopRunning];
+  }
   [_audioCaptureSession stopRunning];
 }
 
@@ -253,17 +334,10 @@ NSString *const errorMethod = @"error";
 }
 
 - (void)captureToFile:(FLTThreadSafeFlutterResult *)result {
-  AVCapturePhotoSettings *settings = [AVCapturePhotoSettings photoSettings];
-  if (_resolutionPreset == FLTResolutionPresetMax) {
-    [settings setHighResolutionPhotoEnabled:YES];
-  }
-
-  AVCaptureFlashMode avFlashMode = FLTGetAVCaptureFlashModeForFLTFlashMode(_flashMode);
-  if (avFlashMode != -1) {
-    [settings setFlashMode:avFlashMode];
-  }
+  AVCapturePhotoSettings *settings = [self photoSettingsForCapture];
+  NSString *extension = [self isHEICPhotoSettings:settings] ? @"heic" : @"jpg";
   NSError *error;
-  NSString *path = [self getTemporaryFilePathWithExtension:@"jpg"
+  NSString *path = [self getTemporaryFilePathWithExtension:extension
                                                  subfolder:@"pictures"
                                                     prefix:@"CAP_"
                                                      error:error];
@@ -277,15 +351,7 @@ NSString *const errorMethod = @"error";
            initWithPath:path
                 ioQueue:self.photoIOQueue
       completionHandler:^(NSString *_Nullable path, NSError *_Nullable error) {
-        typeof(self) strongSelf = weakSelf;
-        if (!strongSelf) return;
-        dispatch_async(strongSelf.captureSessionQueue, ^{
-          // cannot use the outter `strongSelf`
-          typeof(self) strongSelf = weakSelf;
-          if (!strongSelf) return;
-          [strongSelf.inProgressSavePhotoDelegates removeObjectForKey:@(settings.uniqueID)];
-        });
-
+        [weakSelf removeSavePhotoDelegateForSettings:settings];
         if (error) {
           [result sendError:error];
         } else {
@@ -293,13 +359,89 @@ NSString *const errorMethod = @"error";
           [result sendSuccessWithData:path];
         }
       }];
+  [self capturePhotoWithSettings:settings delegate:savePhotoDelegate];
+}
 
+- (void)captureToMemory:(FLTThreadSafeFlutterResult *)result {
+  AVCapturePhotoSettings *settings = [self photoSettingsForCapture];
+  __weak typeof(self) weakSelf = self;
+  FLTSavePhotoDelegate *savePhotoDelegate = [[FLTSavePhotoDelegate alloc]
+             initWithIOQueue:self.photoIOQueue
+      dataCompletionHandler:^(NSData *_Nullable data, NSError *_Nullable error) {
+        [weakSelf removeSavePhotoDelegateForSettings:settings];
+        if (error) {
+          [result sendError:error];
+        } else {
+          NSAssert(data, @"Data must not be nil if no error.");
+          [result sendSuccessWithData:[FlutterStandardTypedData typedDataWithBytes:data]];
+        }
+      }];
+  [self capturePhotoWithSettings:settings delegate:savePhotoDelegate];
+}
+
+- (AVCapturePhotoSettings *)photoSettingsForCapture {
+  AVCapturePhotoSettings *settings;
+  if (_pictureFormat == FLTPictureFormatHEIC &&
+      [_capturePhotoOutput.availablePhotoCodecTypes containsObject:AVVideoCodecTypeHEVC]) {
+    settings = [AVCapturePhotoSettings
+        photoSettingsWithFormat:@{AVVideoCodecKey : AVVideoCodecTypeHEVC}];
+  } else {
+    settings = [AVCapturePhotoSettings photoSettings];
+  }
+  if (_resolutionPreset == FLTResolutionPresetMax) {
+    [settings setHighResolutionPhotoEnabled:YES];
+  }
+
+  AVCaptureFlashMode avFlashMode = FLTGetAVCaptureFlashModeForFLTFlashMode(_flashMode);
+  if (avFlashMode != -1) {
+    [settings setFlashMode:avFlashMode];
+  }
+
+  if (@available(iOS 13.0, *)) {
+    AVCapturePhotoQualityPrioritization prioritization =
+        FLTGetAVCapturePhotoQualityPrioritizationForFLTPhotoQualityPrioritization(
+            _photoQualityPrioritization);
+    // Requesting more than the output's maximum raises an exception.
+    if (prioritization <= _capturePhotoOutput.maxPhotoQualityPrioritization) {
+      settings.photoQualityPrioritization = prioritization;
+    }
+  }
+  return settings;
+}
+
+- (BOOL)isHEICPhotoSettings:(AVCapturePhotoSettings *)settings {
+  return [settings.format[AVVideoCodecKey] isEqual:AVVideoCodecTypeHEVC];
+}
+
+- (void)capturePhotoWithSettings:(AVCapturePhotoSettings *)settings
+                        delegate:(FLTSavePhotoDelegate *)savePhotoDelegate {
   NSAssert(dispatch_get_specific(FLTCaptureSessionQueueSpecific),
            @"save photo delegate references must be updated on the capture session queue");
   self.inProgressSavePhotoDelegates[@(settings.uniqueID)] = savePhotoDelegate;
   [self.capturePhotoOutput capturePhotoWithSettings:settings delegate:savePhotoDelegate];
 }
 
+- (void)removeSavePhotoDelegateForSettings:(AVCapturePhotoSettings *)settings {
+  __weak typeof(self) weakSelf = self;
+  dispatch_async(self.captureSessionQueue, ^{
+    typeof(self) strongSelf = weakSelf;
+    if (!strongSelf) return;
+    [strongSelf.inProgressSavePhotoDelegates removeObjectForKey:@(settings.uniqueID)];
+  });
+}
+
+- (void)setPhotoQualityPrioritization:(FLTPhotoQualityPrioritization)photoQualityPrioritization {
+  _photoQualityPrioritization = photoQualityPrioritization;
+  if (@available(iOS 13.0, *)) {
+    if (photoQualityPrioritization == FLTPhotoQualityPrioritizationQuality &&
+        _capturePhotoOutput.maxPhotoQualityPrioritization <
+            AVCapturePhotoQualityPrioritizationQuality) {
+      _capturePhotoOutput.maxPhotoQualityPrioritization =
+          AVCapturePhotoQualityPrioritizationQuality;
+    }
+  }
+}
+
 - (AVCaptureVideoOrientation)getVideoOrientationForDeviceOrientation:
     (UIDeviceOrientation)deviceOrientation {
   if (deviceOrientation == UIDeviceOrientationPortrait) {
@@ -345,62 +487,193 @@ NSString *const errorMethod = @"error";
   return file;
 }
 
+/// The session preset chosen for each device and resolution preset, so that later cameras on the
+/// same device don't have to probe the presets one by one. Guarded by `@synchronized` on itself.
+static NSMutableDictionary<NSString *, AVCaptureSessionPreset> *FLTSessionPresetCache(void) {
+  static NSMutableDictionary<NSString *, AVCaptureSessionPreset> *cache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    cache = [NSMutableDictionary dictionary];
+  });
+  return cache;
+}
+
++ (void)clearSessionPresetCache {
+  NSMutableDictionary *cache = FLTSessionPresetCache();
+  @synchronized(cache) {
+    [cache removeAllObjects];
+  }
+}
+
 - (BOOL)setCaptureSessionPreset:(FLTResolutionPreset)resolutionPreset withError:(NSError **)error {
+  if (_usesMultiCamSession) {
+    // Multi-cam sessions don't support presets, so each camera picks its own format instead.
+    return [self setMultiCamFormatForResolutionPreset:resolutionPreset withError:error];
+  }
+  NSString *uniqueID = _captureDevice.uniqueID;
+  NSString *cacheKey =
+      uniqueID ? [NSString stringWithFormat:@"%@/%ld", uniqueID, (long)resolutionPreset] : nil;
+  NSMutableDictionary<NSString *, AVCaptureSessionPreset> *cache = FLTSessionPresetCache();
+  AVCaptureSessionPreset cachedPreset = nil;
+  if (cacheKey) {
+    @synchronized(cache) {
+      cachedPreset = cache[cacheKey];
+    }
+  }
+  if (cachedPreset && [_videoCaptureSession canSetSessionPreset:cachedPreset]) {
+    [self applySessionPreset:cachedPreset];
+    return YES;
+  }
+
+  AVCaptureSessionPreset preset = [self bestSessionPresetForResolutionPreset:resolutionPreset];
+  if (!preset) {
+    *error = [NSError errorWithDomain:NSCocoaErrorDomain
+                                 code:NSURLErrorUnknown
+                             userInfo:@{
+                               NSLocalizedDescriptionKey :
+                                   @"No capture session available for current capture session."
+                             }];
+    return NO;
+  }
+  [self applySessionPreset:preset];
+  if (cacheKey) {
+    @synchronized(cache) {
+      cache[cacheKey] = preset;
+    }
+  }
+  return YES;
+}
+
+/// Returns the largest video dimensions that `resolutionPreset` allows, which match the session
+/// presets chosen by `bestSessionPresetForResolutionPreset:`.
+static CMVideoDimensions FLTMaxVideoDimensionsForResolutionPreset(
+    FLTResolutionPreset resolutionPreset) {
+  switch (resolutionPreset) {
+    case FLTResolutionPresetMax:
+    case FLTResolutionPresetUltraHigh:
+      return (CMVideoDimensions){3840, 2160};
+    case FLTResolutionPresetVeryHigh:
+      return (CMVideoDimensions){1920, 1080};
+    case FLTResolutionPresetHigh:
+      return (CMVideoDimensions){1280, 720};
+    case FLTResolutionPresetMedium:
+      return (CMVideoDimensions){640, 480};
+    default:
+      return (CMVideoDimensions){352, 288};
+  }
+}
+
+- (BOOL)setMultiCamFormatForResolutionPreset:(FLTResolutionPreset)resolutionPreset
+                                   withError:(NSError **)error {
+  AVCaptureDeviceFormat *format = [self bestMultiCamFormatForResolutionPreset:resolutionPreset];
+  if (!format) {
+    *error = [NSError errorWithDomain:NSCocoaErrorDomain
+                                 code:NSURLErrorUnknown
+                             userInfo:@{
+                               NSLocalizedDescriptionKey :
+                                   @"No multi-cam format available for the resolution preset."
+                             }];
+    return NO;
+  }
+  if (![_captureDevice lockForConfiguration:error]) {
+    return NO;
+  }
+  _captureDevice.activeFormat = format;
+  [_captureDevice unlockForConfiguration];
+  CMVideoDimensions dimensions = CMVideoFormatDescriptionGetDimensions(format.formatDescription);
+  _previewSize = CGSizeMake(dimensions.width, dimensions.height);
+  return YES;
+}
+
+/// Returns the largest multi-cam capable format of the device that does not exceed
+/// `resolutionPreset`, or the smallest one if they all do. Returns nil if the device can't be used
+/// in a multi-cam session.
+- (nullable AVCaptureDeviceFormat *)bestMultiCamFormatForResolutionPreset:
+    (FLTResolutionPreset)resolutionPreset {
+  if (@available(iOS 13.0, *)) {
+    CMVideoDimensions maxDimensions = FLTMaxVideoDimensionsForResolutionPreset(resolutionPreset);
+    AVCaptureDeviceFormat *bestFormat = nil;
+    int64_t bestArea = 0;
+    AVCaptureDeviceFormat *smallestFormat = nil;
+    int64_t smallestArea = INT64_MAX;
+    for (AVCaptureDeviceFormat *format in _captureDevice.formats) {
+      if (!format.isMultiCamSupported) {
+        continue;
+      }
+      CMVideoDimensions dimensions =
+          CMVideoFormatDescriptionGetDimensions(format.formatDescription);
+      int64_t area = (int64_t)dimensions.width * dimensions.height;
+      if (area < smallestArea) {
+        smallestFormat = format;
+        smallestArea = area;
+      }
+      if (dimensions.width <= maxDimensions.width && dimensions.height <= maxDimensions.height &&
+          area > bestArea) {
+        bestFormat = format;
+        bestArea = area;
+      }
+    }
+    return bestFormat ?: smallestFormat;
+  }
+  return nil;
+}
+
+/// Returns the highest session preset the capture session supports that does not exceed
+/// `resolutionPreset`, or nil if it supports none of them.
+- (nullable AVCaptureSessionPreset)bestSessionPresetForResolutionPreset:
+    (FLTResolutionPreset)resolutionPreset {
   switch (resolutionPreset) {
     case FLTResolutionPresetMax:
     case FLTResolutionPresetUltraHigh:
       if ([_videoCaptureSession canSetSessionPreset:AVCaptureSessionPreset3840x2160]) {
-        _videoCaptureSession.sessionPreset = AVCaptureSessionPreset3840x2160;
-        _previewSize = CGSizeMake(3840, 2160);
-        break;
+        return AVCaptureSessionPreset3840x2160;
       }
       if ([_videoCaptureSession canSetSessionPreset:AVCaptureSessionPresetHigh]) {
-        _videoCaptureSession.sessionPreset = AVCaptureSessionPresetHigh;
-        _previewSize =
-            CGSizeMake(_captureDevice.activeFormat.highResolutionStillImageDimensions.width,
-                       _captureDevice.activeFormat.highResolutionStillImageDimensions.height);
-        break;
+        return AVCaptureSessionPresetHigh;
       }
     case FLTResolutionPresetVeryHigh:
       if ([_videoCaptureSession canSetSessionPreset:AVCaptureSessionPreset1920x1080]) {
-        _videoCaptureSession.sessionPreset = AVCaptureSessionPreset1920x1080;
-        _previewSize = CGSizeMake(1920, 1080);
-        break;
+        return AVCaptureSessionPreset1920x1080;
       }
     case FLTResolutionPresetHigh:
       if ([_videoCaptureSession canSetSessionPreset:AVCaptureSessionPreset1280x720]) {
-        _videoCaptureSession.sessionPreset = AVCaptureSessionPreset1280x720;
-        _previewSize = CGSizeMake(1280, 720);
-        break;
+        return AVCaptureSessionPreset1280x720;
       }
     case FLTResolutionPresetMedium:
       if ([_videoCaptureSession canSetSessionPreset:AVCaptureSessionPreset640x480]) {
-        _videoCaptureSession.sessionPreset = AVCaptureSessionPreset640x480;
-        _previewSize = CGSizeMake(640, 480);
-        break;
+        return AVCaptureSessionPreset640x480;
       }
     case FLTResolutionPresetLow:
       if ([_videoCaptureSession canSetSessionPreset:AVCaptureSessionPreset352x288]) {
-        _videoCaptureSession.sessionPreset = AVCaptureSessionPreset352x288;
-        _previewSize = CGSizeMake(352, 288);
-        break;
+        return AVCaptureSessionPreset352x288;
       }
     default:
       if ([_videoCaptureSession canSetSessionPreset:AVCaptureSessionPresetLow]) {
-        _videoCaptureSession.sessionPreset = AVCaptureSessionPresetLow;
-        _previewSize = CGSizeMake(352, 288);
-      } else {
-        *error = [NSError errorWithDomain:NSCocoaErrorDomain
-                                     code:NSURLErrorUnknown
-                                 userInfo:@{
-                                   NSLocalizedDescriptionKey :
-                                       @"No capture session available for current capture session."
-                                 }];
-        return NO;
+        return AVCaptureSessionPresetLow;
       }
+      return nil;
+  }
+}
+
+/// Sets `preset` on both capture sessions and updates the preview size to match.
+- (void)applySessionPreset:(AVCaptureSessionPreset)preset {
+  _videoCaptureSession.sessionPreset = preset;
+  if ([preset isEqualToString:AVCaptureSessionPreset3840x2160]) {
+    _previewSize = CGSizeMake(3840, 2160);
+  } else if ([preset isEqualToString:AVCaptureSessionPresetHigh]) {
+    _previewSize =
+        CGSizeMake(_captureDevice.activeFormat.highResolutionStillImageDimensions.width,
+                   _captureDevice.activeFormat.highResolutionStillImageDimensions.height);
+  } else if ([preset isEqualToString:AVCaptureSessionPreset1920x1080]) {
+    _previewSize = CGSizeMake(1920, 1080);
+  } else if ([preset isEqualToString:AVCaptureSessionPreset1280x720]) {
+    _previewSize = CGSizeMake(1280, 720);
+  } else if ([preset isEqualToString:AVCaptureSessionPreset640x480]) {
+    _previewSize = CGSizeMake(640, 480);
+  } else {
+    _previewSize = CGSizeMake(352, 288);
   }
   _audioCaptureSession.sessionPreset = _videoCaptureSession.sessionPreset;
-  return YES;
 }
 
 - (void)captureOutput:(AVCaptureOutput *)output
@@ -410,21 +683,18 @@ NSString *const errorMethod = @"error";
     CVPixelBufferRef newBuffer = CMSampleBufferGetImageBuffer(sampleBuffer);
     CFRetain(newBuffer);
 
-    __block CVPixelBufferRef previousPixelBuffer = nil;
-    // Use `dispatch_sync` to avoid unnecessary context switch under common non-contest scenarios;
-    // Under rare contest scenarios, it will not block for too long since the critical section is
-    // quite lightweight.
-    dispatch_sync(self.pixelBufferSynchronizationQueue, ^{
-      // No need weak self because it's dispatch_sync.
-      previousPixelBuffer = self.latestPixelBuffer;
-      self.latestPixelBuffer = newBuffer;
-    });
+    CVPixelBufferRef previousPixelBuffer = atomic_exchange(&_latestPixelBuffer, newBuffer);
     if (previousPixelBuffer) {
+      // The previous frame was never picked up by `copyPixelBuffer`.
+      atomic_fetch_add_explicit(&_replacedPixelBufferCount, 1, memory_order_relaxed);
       CFRelease(previousPixelBuffer);
     }
     if (_onFrameAvailable) {
       _onFrameAvailable();
     }
+    for (NSObject<FLTSampleBufferConsumer> *consumer in _sampleBufferConsumers) {
+      [consumer cameraDidOutputSampleBuffer:sampleBuffer];
+    }
   }
   if (!CMSampleBufferDataIsReady(sampleBuffer)) {
     [_methodChannel invokeMethod:errorMethod
@@ -435,73 +705,18 @@ NSString *const errorMethod = @"error";
     FlutterEventSink eventSink = _imageStreamHandler.eventSink;
     if (eventSink && (self.streamingPendingFramesCount < self.maxStreamingPendingFramesCount)) {
       self.streamingPendingFramesCount++;
-      CVPixelBufferRef pixelBuffer = CMSampleBufferGetImageBuffer(sampleBuffer);
-      // Must lock base address before accessing the pixel data
-      CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
-
-      size_t imageWidth = CVPixelBufferGetWidth(pixelBuffer);
-      size_t imageHeight = CVPixelBufferGetHeight(pixelBuffer);
-
-      NSMutableArray *planes = [NSMutableArray array];
-
-      const Boolean isPlanar = CVPixelBufferIsPlanar(pixelBuffer);
-      size_t planeCount;
-      if (isPlanar) {
-        planeCount = CVPixelBufferGetPlaneCount(pixelBuffer);
-      } else {
-        planeCount = 1;
-      }
-
-      for (int i = 0; i < planeCount; i++) {
-        void *planeAddress;
-        size_t bytesPerRow;
-        size_t height;
-        size_t width;
-
-        if (isPlanar) {
-          planeAddress = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, i);
-          bytesPerRow = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, i);
-          height = CVPixelBufferGetHeightOfPlane(pixelBuffer, i);
-          width = CVPixelBufferGetWidthOfPlane(pixelBuffer, i);
-        } else {
-          planeAddress = CVPixelBufferGetBaseAddress(pixelBuffer);
-          bytesPerRow = CVPixelBufferGetBytesPerRow(pixelBuffer);
-          height = CVPixelBufferGetHeight(pixelBuffer);
-          width = CVPixelBufferGetWidth(pixelBuffer);
-        }
-
-        NSNumber *length = @(bytesPerRow * height);
-        NSData *bytes = [NSData dataWithBytes:planeAddress length:length.unsignedIntegerValue];
-
-        NSMutableDictionary *planeBuffer = [NSMutableDictionary dictionary];
-        planeBuffer[@"bytesPerRow"] = @(bytesPerRow);
-        planeBuffer[@"width"] = @(width);
-        planeBuffer[@"height"] = @(height);
-        planeBuffer[@"bytes"] = [FlutterStandardTypedData typedDataWithBytes:bytes];
-
-        [planes addObject:planeBuffer];
-      }
-      // Lock the base address before accessing pixel data, and unlock it afterwards.
-      // Done accessing the `pixelBuffer` at this point.
-      CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
-
-      NSMutableDictionary *imageBuffer = [NSMutableDictionary dictionary];
-      imageBuffer[@"width"] = [NSNumber numberWithUnsignedLong:imageWidth];
-      imageBuffer[@"height"] = [NSNumber numberWithUnsignedLong:imageHeight];
-      imageBuffer[@"format"] = @(_videoFormat);
-      imageBuffer[@"planes"] = planes;
-      imageBuffer[@"lensAperture"] = [NSNumber numberWithFloat:[_captureDevice lensAperture]];
-      Float64 exposureDuration = CMTimeGetSeconds([_captureDevice exposureDuration]);
-      Float64 nsExposureDuration = 1000000000 * exposureDuration;
-      imageBuffer[@"sensorExposureTime"] = [NSNumber numberWithInt:nsExposureDuration];
-      imageBuffer[@"sensorSensitivity"] = [NSNumber numberWithFloat:[_captureDevice ISO]];
-
-      dispatch_async(dispatch_get_main_queue(), ^{
-        eventSink(imageBuffer);
+      FLTImageStreamConverter *converter = _imageStreamConverter;
+      CFRetain(sampleBuffer);
+      dispatch_async(_imageStreamQueue, ^{
+        [self sendImageStreamFrame:sampleBuffer converter:converter toEventSink:eventSink];
+        CFRelease(sampleBuffer);
       });
+    } else if (eventSink) {
+      atomic_fetch_add_explicit(&_droppedImageStreamFrameCount, 1, memory_order_relaxed);
     }
   }
-  if (_isRecording && !_isRecordingPaused) {
+  // Recordings written by a movie file output get their samples from the session directly.
+  if (_isRecording && !_isRecordingPaused && !_movieFileOutput) {
     if (_videoWriter.status == AVAssetWriterStatusFailed) {
       [_methodChannel invokeMethod:errorMethod
                          arguments:[NSString stringWithFormat:@"%@", _videoWriter.error]];
@@ -514,7 +729,6 @@ NSString *const errorMethod = @"error";
       return;
     }
 
-    CFRetain(sampleBuffer);
     CMTime currentSampleTime = CMSampleBufferGetPresentationTimeStamp(sampleBuffer);
 
     if (_videoWriter.status != AVAssetWriterStatusWriting) {
@@ -538,9 +752,25 @@ NSString *const errorMethod = @"error";
 
       _lastVideoSampleTime = currentSampleTime;
 
-      CVPixelBufferRef nextBuffer = CMSampleBufferGetImageBuffer(sampleBuffer);
-      CMTime nextSampleTime = CMTimeSubtract(_lastVideoSampleTime, _videoTimeOffset);
-      [_videoAdaptor appendPixelBuffer:nextBuffer withPresentationTime:nextSampleTime];
+      if (_videoTimeOffset.value == 0) {
+        // The sample's timing is already correct, so it can be appended as is instead of
+        // being re-wrapped by the pixel buffer adaptor.
+        [self enqueueRecordingSample:sampleBuffer toInput:_videoWriterInput];
+      } else if ([self reservePendingRecordingSample]) {
+        CVPixelBufferRef nextBuffer = CMSampleBufferGetImageBuffer(sampleBuffer);
+        CMTime nextSampleTime = CMTimeSubtract(_lastVideoSampleTime, _videoTimeOffset);
+        AVAssetWriterInputPixelBufferAdaptor *adaptor = _videoAdaptor;
+        CVPixelBufferRetain(nextBuffer);
+        dispatch_async(_writerQueue, ^{
+          if (adaptor.assetWriterInput.readyForMoreMediaData) {
+            [adaptor appendPixelBuffer:nextBuffer withPresentationTime:nextSampleTime];
+          } else {
+            [self countDroppedRecordingSample];
+          }
+          CVPixelBufferRelease(nextBuffer);
+          atomic_fetch_sub(&self->_pendingRecordingSampleCount, 1);
+        });
+      }
     } else {
       CMTime dur = CMSampleBufferGetDuration(sampleBuffer);
 
@@ -564,21 +794,23 @@ NSString *const errorMethod = @"error";
       _lastAudioSampleTime = currentSampleTime;
 
       if (_audioTimeOffset.value != 0) {
-        CFRelease(sampleBuffer);
-        sampleBuffer = [self adjustTime:sampleBuffer by:_audioTimeOffset];
+        CMSampleBufferRef adjustedBuffer = [self adjustTime:sampleBuffer by:_audioTimeOffset];
+        [self enqueueRecordingSample:adjustedBuffer toInput:_audioWriterInput];
+        CFRelease(adjustedBuffer);
+      } else {
+        [self enqueueRecordingSample:sampleBuffer toInput:_audioWriterInput];
       }
-
-      [self newAudioSample:sampleBuffer];
     }
-
-    CFRelease(sampleBuffer);
   }
 }
 
 - (CMSampleBufferRef)adjustTime:(CMSampleBufferRef)sample by:(CMTime)offset CF_RETURNS_RETAINED {
+  // Audio buffers almost always carry a single timing entry, so avoid a heap allocation
+  // per sample unless the buffer has more entries than fit on the stack.
+  CMSampleTimingInfo stackInfo[8];
   CMItemCount count;
   CMSampleBufferGetSampleTimingInfoArray(sample, 0, nil, &count);
-  CMSampleTimingInfo *pInfo = malloc(sizeof(CMSampleTimingInfo) * count);
+  CMSampleTimingInfo *pInfo = count <= 8 ? stackInfo : malloc(sizeof(CMSampleTimingInfo) * count);
   CMSampleBufferGetSampleTimingInfoArray(sample, count, pInfo, &count);
   for (CMItemCount i = 0; i < count; i++) {
     pInfo[i].decodeTimeStamp = CMTimeSubtract(pInfo[i].decodeTimeStamp, offset);
@@ -586,51 +818,161 @@ NSString *const errorMethod = @"error";
   }
   CMSampleBufferRef sout;
   CMSampleBufferCreateCopyWithNewTiming(nil, sample, count, pInfo, &sout);
-  free(pInfo);
+  if (pInfo != stackInfo) {
+    free(pInfo);
+  }
   return sout;
 }
 
-- (void)newVideoSample:(CMSampleBufferRef)sampleBuffer {
-  if (_videoWriter.status != AVAssetWriterStatusWriting) {
-    if (_videoWriter.status == AVAssetWriterStatusFailed) {
-      [_methodChannel invokeMethod:errorMethod
-                         arguments:[NSString stringWithFormat:@"%@", _videoWriter.error]];
-    }
-    return;
+- (void)sendImageStreamFrame:(CMSampleBufferRef)sampleBuffer
+                   converter:(nullable FLTImageStreamConverter *)converter
+                 toEventSink:(FlutterEventSink)eventSink {
+  CVPixelBufferRef pixelBuffer = CMSampleBufferGetImageBuffer(sampleBuffer);
+  NSMutableDictionary *imageBuffer = [converter imageWithPixelBuffer:pixelBuffer];
+  if (!imageBuffer) {
+    imageBuffer = [self imageWithPixelBuffer:pixelBuffer];
   }
-  if (_videoWriterInput.readyForMoreMediaData) {
-    if (![_videoWriterInput appendSampleBuffer:sampleBuffer]) {
-      [_methodChannel
-          invokeMethod:errorMethod
-             arguments:[NSString stringWithFormat:@"%@", @"Unable to write to video input"]];
+  imageBuffer[@"lensAperture"] = [NSNumber numberWithFloat:[_captureDevice lensAperture]];
+  Float64 exposureDuration = CMTimeGetSeconds([_captureDevice exposureDuration]);
+  Float64 nsExposureDuration = 1000000000 * exposureDuration;
+  imageBuffer[@"sensorExposureTime"] = [NSNumber numberWithInt:nsExposureDuration];
+  imageBuffer[@"sensorSensitivity"] = [NSNumber numberWithFloat:[_captureDevice ISO]];
+
+  dispatch_async(dispatch_get_main_queue(), ^{
+    eventSink(imageBuffer);
+  });
+}
+
+/// Returns an image stream event with the planes of `pixelBuffer` as they are.
+- (NSMutableDictionary *)imageWithPixelBuffer:(CVPixelBufferRef)pixelBuffer {
+  // Must lock base address before accessing the pixel data
+  CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+
+  size_t imageWidth = CVPixelBufferGetWidth(pixelBuffer);
+  size_t imageHeight = CVPixelBufferGetHeight(pixelBuffer);
+
+  NSMutableArray *planes = [NSMutableArray array];
+
+  const Boolean isPlanar = CVPixelBufferIsPlanar(pixelBuffer);
+  size_t planeCount;
+  if (isPlanar) {
+    planeCount = CVPixelBufferGetPlaneCount(pixelBuffer);
+  } else {
+    planeCount = 1;
+  }
+
+  for (int i = 0; i < planeCount; i++) {
+    void *planeAddress;
+    size_t bytesPerRow;
+    size_t height;
+    size_t width;
+
+    if (isPlanar) {
+      planeAddress = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, i);
+      bytesPerRow = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, i);
+      height = CVPixelBufferGetHeightOfPlane(pixelBuffer, i);
+      width = CVPixelBufferGetWidthOfPlane(pixelBuffer, i);
+    } else {
+      planeAddress = CVPixelBufferGetBaseAddress(pixelBuffer);
+      bytesPerRow = CVPixelBufferGetBytesPerRow(pixelBuffer);
+      height = CVPixelBufferGetHeight(pixelBuffer);
+      width = CVPixelBufferGetWidth(pixelBuffer);
     }
+
+    // The only copy of the pixels is the one made when the event is encoded.
+    NSData *bytes = FLTCreateNoCopyPlaneData(pixelBuffer, planeAddress, bytesPerRow * height);
+
+    NSMutableDictionary *planeBuffer = [NSMutableDictionary dictionary];
+    planeBuffer[@"bytesPerRow"] = @(bytesPerRow);
+    planeBuffer[@"width"] = @(width);
+    planeBuffer[@"height"] = @(height);
+    planeBuffer[@"bytes"] = [FlutterStandardTypedData typedDataWithBytes:bytes];
+
+    [planes addObject:planeBuffer];
   }
+  // Each plane's data now holds its own lock until the event has been sent.
+  CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+
+  NSMutableDictionary *imageBuffer = [NSMutableDictionary dictionary];
+  imageBuffer[@"width"] = [NSNumber numberWithUnsignedLong:imageWidth];
+  imageBuffer[@"height"] = [NSNumber numberWithUnsignedLong:imageHeight];
+  imageBuffer[@"format"] = @(_videoFormat);
+  imageBuffer[@"planes"] = planes;
+  return imageBuffer;
 }
 
-- (void)newAudioSample:(CMSampleBufferRef)sampleBuffer {
-  if (_videoWriter.status != AVAssetWriterStatusWriting) {
-    if (_videoWriter.status == AVAssetWriterStatusFailed) {
+/// Reserves a place on the writer queue for a sample, or counts the sample as dropped if the queue
+/// is full.
+- (BOOL)reservePendingRecordingSample {
+  if (atomic_fetch_add(&_pendingRecordingSampleCount, 1) >= kFLTMaxPendingRecordingSampleCount) {
+    atomic_fetch_sub(&_pendingRecordingSampleCount, 1);
+    [self countDroppedRecordingSample];
+    return NO;
+  }
+  return YES;
+}
+
+- (void)countDroppedRecordingSample {
+  atomic_fetch_add_explicit(&_droppedRecordingSampleCount, 1, memory_order_relaxed);
+}
+
+/// Appends the sample to the input on the writer queue, unless the queue is full.
+- (void)enqueueRecordingSample:(CMSampleBufferRef)sampleBuffer
+                       toInput:(AVAssetWriterInput *)input {
+  if (![self reservePendingRecordingSample]) {
+    return;
+  }
+  // A later recording replaces the writer, so the block must append to this one.
+  AVAssetWriter *writer = _videoWriter;
+  CFRetain(sampleBuffer);
+  dispatch_async(_writerQueue, ^{
+    [self appendRecordingSample:sampleBuffer toInput:input ofWriter:writer];
+    CFRelease(sampleBuffer);
+    atomic_fetch_sub(&self->_pendingRecordingSampleCount, 1);
+  });
+}
+
+- (void)appendRecordingSample:(CMSampleBufferRef)sampleBuffer
+                      toInput:(AVAssetWriterInput *)input
+                     ofWriter:(AVAssetWriter *)writer {
+  if (writer.status != AVAssetWriterStatusWriting) {
+    if (writer.status == AVAssetWriterStatusFailed) {
       [_methodChannel invokeMethod:errorMethod
-                         arguments:[NSString stringWithFormat:@"%@", _videoWriter.error]];
+                         arguments:[NSString stringWithFormat:@"%@", writer.error]];
     }
     return;
   }
-  if (_audioWriterInput.readyForMoreMediaData) {
-    if (![_audioWriterInput appendSampleBuffer:sampleBuffer]) {
-      [_methodChannel
-          invokeMethod:errorMethod
-             arguments:[NSString stringWithFormat:@"%@", @"Unable to write to audio input"]];
-    }
+  if (!input.readyForMoreMediaData) {
+    [self countDroppedRecordingSample];
+    return;
+  }
+  if (![input appendSampleBuffer:sampleBuffer]) {
+    NSString *mediaName = input == _audioWriterInput ? @"audio" : @"video";
+    [_methodChannel invokeMethod:errorMethod
+                       arguments:[NSString stringWithFormat:@"Unable to write to %@ input",
+                                                            mediaName]];
   }
 }
 
 - (void)close {
   [self stop];
-  for (AVCaptureInput *input in [_videoCaptureSession inputs]) {
-    [_videoCaptureSession removeInput:input];
-  }
-  for (AVCaptureOutput *output in [_videoCaptureSession outputs]) {
-    [_videoCaptureSession removeOutput:output];
+  if (_usesMultiCamSession) {
+    // Only remove this camera from the shared session, which removes its connections too.
+    [_videoCaptureSession beginConfiguration];
+    [_videoCaptureSession removeInput:_captureVideoInput];
+    [_videoCaptureSession removeOutput:_captureVideoOutput];
+    [_videoCaptureSession removeOutput:_capturePhotoOutput];
+    [_videoCaptureSession commitConfiguration];
+    if (_videoCaptureSession.inputs.count == 0) {
+      [_videoCaptureSession stopRunning];
+    }
+  } else {
+    for (AVCaptureInput *input in [_videoCaptureSession inputs]) {
+      [_videoCaptureSession removeInput:input];
+    }
+    for (AVCaptureOutput *output in [_videoCaptureSession outputs]) {
+      [_videoCaptureSession removeOutput:output];
+    }
   }
   for (AVCaptureInput *input in [_audioCaptureSession inputs]) {
     [_audioCaptureSession removeInput:input];
@@ -641,21 +983,29 @@ NSString *const errorMethod = @"error";
 }
 
 - (void)dealloc {
-  if (_latestPixelBuffer) {
-    CFRelease(_latestPixelBuffer);
+  CVPixelBufferRef latestPixelBuffer = atomic_load(&_latestPixelBuffer);
+  if (latestPixelBuffer) {
+    CFRelease(latestPixelBuffer);
   }
   [_motionManager stopAccelerometerUpdates];
 }
 
 - (CVPixelBufferRef)copyPixelBuffer {
-  __block CVPixelBufferRef pixelBuffer = nil;
-  // Use `dispatch_sync` because `copyPixelBuffer` API requires synchronous return.
-  dispatch_sync(self.pixelBufferSynchronizationQueue, ^{
-    // No need weak self because it's dispatch_sync.
-    pixelBuffer = self.latestPixelBuffer;
-    self.latestPixelBuffer = nil;
-  });
-  return pixelBuffer;
+  // Takes ownership of the latest buffer, if there is one, without waiting for the capture
+  // session queue.
+  return atomic_exchange(&_latestPixelBuffer, NULL);
+}
+
+- (uint64_t)replacedPixelBufferCount {
+  return atomic_load_explicit(&_replacedPixelBufferCount, memory_order_relaxed);
+}
+
+- (uint64_t)droppedImageStreamFrameCount {
+  return atomic_load_explicit(&_droppedImageStreamFrameCount, memory_order_relaxed);
+}
+
+- (uint64_t)droppedRecordingSampleCount {
+  return atomic_load_explicit(&_droppedRecordingSampleCount, memory_order_relaxed);
 }
 
 - (void)startVideoRecordingWithResult:(FLTThreadSafeFlutterResult *)result {
@@ -665,6 +1015,24 @@ NSString *const errorMethod = @"error";
 - (void)startVideoRecordingWithResult:(FLTThreadSafeFlutterResult *)result
                 messengerForStreaming:(nullable NSObject<FlutterBinaryMessenger> *)messenger {
   if (!_isRecording) {
+    if (messenger == nil && [self canRecordWithMovieFileOutput]) {
+      NSError *error;
+      NSString *path = [self getTemporaryFilePathWithExtension:@"mov"
+                                                     subfolder:@"videos"
+                                                        prefix:@"REC_"
+                                                         error:error];
+      if (error) {
+        [result sendError:error];
+        return;
+      }
+      if ([self startMovieFileOutputRecordingToPath:path]) {
+        _videoRecordingPath = path;
+        _isRecording = YES;
+        _isRecordingPaused = NO;
+        [result sendSuccess];
+        return;
+      }
+    }
     if (messenger != nil) {
       [self startImageStreamWithMessenger:messenger];
     }
@@ -698,18 +1066,33 @@ NSString *const errorMethod = @"error";
   if (_isRecording) {
     _isRecording = NO;
 
-    if (_videoWriter.status != AVAssetWriterStatusUnknown) {
-      [_videoWriter finishWritingWithCompletionHandler:^{
-        if (self->_videoWriter.status == AVAssetWriterStatusCompleted) {
-          [self updateOrientation];
-          [result sendSuccessWithData:self->_videoRecordingPath];
-          self->_videoRecordingPath = nil;
-        } else {
-          [result sendErrorWithCode:@"IOError"
-                            message:@"AVAssetWriter could not finish writing!"
-                            details:nil];
-        }
-      }];
+    if (_movieFileOutput) {
+      // Completed by the recording delegate once the file is finished.
+      AVCaptureMovieFileOutput *movieFileOutput = _movieFileOutput;
+      _movieFileOutput = nil;
+      _movieFileOutputStopResult = result;
+      [movieFileOutput stopRecording];
+    } else if (_videoWriter.status != AVAssetWriterStatusUnknown) {
+      // Finish on the writer queue, after the samples that are still waiting there.
+      AVAssetWriter *writer = _videoWriter;
+      NSString *videoRecordingPath = _videoRecordingPath;
+      dispatch_async(_writerQueue, ^{
+        [writer finishWritingWithCompletionHandler:^{
+          if (writer.status == AVAssetWriterStatusCompleted) {
+            dispatch_async(self.captureSessionQueue, ^{
+              [self updateOrientation];
+              if (self->_videoRecordingPath == videoRecordingPath) {
+                self->_videoRecordingPath = nil;
+              }
+            });
+            [result sendSuccessWithData:videoRecordingPath];
+          } else {
+            [result sendErrorWithCode:@"IOError"
+                              message:@"AVAssetWriter could not finish writing!"
+                              details:nil];
+          }
+        }];
+      });
     }
   } else {
     NSError *error =
@@ -721,6 +1104,13 @@ NSString *const errorMethod = @"error";
 }
 
 - (void)pauseVideoRecordingWithResult:(FLTThreadSafeFlutterResult *)result {
+  if (_movieFileOutput) {
+    // AVCaptureMovieFileOutput can only pause on macOS.
+    [result sendErrorWithCode:@"PauseUnsupported"
+                      message:@"Recordings written by a movie file output can't be paused"
+                      details:nil];
+    return;
+  }
   _isRecordingPaused = YES;
   _videoIsDisconnected = YES;
   _audioIsDisconnected = YES;
@@ -898,6 +1288,77 @@ NSString *const errorMethod = @"error";
   [captureDevice unlockForConfiguration];
 }
 
+- (void)setFrameRateRangeWithResult:(FLTThreadSafeFlutterResult *)result
+                       minFrameRate:(nullable NSNumber *)minFrameRate
+                       maxFrameRate:(nullable NSNumber *)maxFrameRate {
+  NSError *error;
+  if ([self applyFrameRateRangeWithMinFrameRate:minFrameRate
+                                   maxFrameRate:maxFrameRate
+                                       onDevice:_captureDevice
+                                          error:&error]) {
+    [result sendSuccess];
+  } else {
+    [result sendErrorWithCode:@"setFrameRateRangeFailed"
+                      message:error.localizedDescription
+                      details:nil];
+  }
+}
+
+- (BOOL)applyFrameRateRangeWithMinFrameRate:(nullable NSNumber *)minFrameRate
+                               maxFrameRate:(nullable NSNumber *)maxFrameRate
+                                   onDevice:(AVCaptureDevice *)captureDevice
+                                      error:(NSError **)error {
+  NSString *failure = nil;
+  if (minFrameRate && maxFrameRate && minFrameRate.doubleValue > maxFrameRate.doubleValue) {
+    failure = @"The minimum frame rate must not be higher than the maximum frame rate";
+  } else if ((minFrameRate && ![self isFrameRate:minFrameRate.doubleValue
+                                   supportedByFormat:captureDevice.activeFormat]) ||
+             (maxFrameRate && ![self isFrameRate:maxFrameRate.doubleValue
+                                   supportedByFormat:captureDevice.activeFormat])) {
+    failure = @"The camera's current format does not support this frame rate";
+  }
+  if (failure) {
+    *error = [NSError errorWithDomain:NSCocoaErrorDomain
+                                 code:NSURLErrorUnknown
+                             userInfo:@{NSLocalizedDescriptionKey : failure}];
+    return NO;
+  }
+
+  if (![captureDevice lockForConfiguration:error]) {
+    return NO;
+  }
+  // Frame durations are the inverse of frame rates. An invalid time restores the format's default.
+  captureDevice.activeVideoMinFrameDuration =
+      maxFrameRate ? CMTimeMake(1000, (int32_t)(maxFrameRate.doubleValue * 1000)) : kCMTimeInvalid;
+  captureDevice.activeVideoMaxFrameDuration =
+      minFrameRate ? CMTimeMake(1000, (int32_t)(minFrameRate.doubleValue * 1000)) : kCMTimeInvalid;
+  [captureDevice unlockForConfiguration];
+  return YES;
+}
+
+- (BOOL)isFrameRate:(double)frameRate supportedByFormat:(AVCaptureDeviceFormat *)format {
+  for (AVFrameRateRange *range in format.videoSupportedFrameRateRanges) {
+    if (range.minFrameRate <= frameRate && frameRate <= range.maxFrameRate) {
+      return YES;
+    }
+  }
+  return NO;
+}
+
+- (void)setPreviewPixelFormatWithResult:(FLTThreadSafeFlutterResult *)result
+                                 format:(NSString *)formatStr {
+  OSType format = FLTGetVideoFormatFromString(formatStr);
+  if (![_captureVideoOutput.availableVideoCVPixelFormatTypes containsObject:@(format)]) {
+    [result sendErrorWithCode:@"setPreviewPixelFormatFailed"
+                      message:[NSString stringWithFormat:@"Pixel format %@ is not supported",
+                                                         formatStr]
+                      details:nil];
+    return;
+  }
+  [self setVideoFormat:format];
+  [result sendSuccess];
+}
+
 - (void)pausePreviewWithResult:(FLTThreadSafeFlutterResult *)result {
   _isPreviewPaused = true;
   [result sendSuccess];
@@ -916,6 +1377,13 @@ NSString *const errorMethod = @"error";
                       details:nil];
     return;
   }
+  if (_movieFileOutput) {
+    // Replacing the input would end the movie file output's recording.
+    [result sendErrorWithCode:@"setDescriptionWhileRecordingFailed"
+                      message:@"Recordings written by a movie file output can't switch cameras"
+                      details:nil];
+    return;
+  }
 
   _captureDevice = [AVCaptureDevice deviceWithUniqueID:cameraName];
 
@@ -952,6 +1420,12 @@ NSString *const errorMethod = @"error";
   if (![_videoCaptureSession canAddConnection:newConnection])
     [result sendErrorWithCode:@"VideoError" message:@"Unable switch video connection" details:nil];
   [_videoCaptureSession addConnection:newConnection];
+  if (_usesMultiCamSession) {
+    // Removing the old input also removed the photo output's connection.
+    [_videoCaptureSession
+        addConnection:[AVCaptureConnection connectionWithInputPorts:_captureVideoInput.ports
+                                                             output:_capturePhotoOutput]];
+  }
   [_videoCaptureSession commitConfiguration];
 
   [result sendSuccess];
@@ -1073,7 +1547,11 @@ NSString *const errorMethod = @"error";
 }
 
 - (void)receivedImageStreamData {
-  self.streamingPendingFramesCount--;
+  [self receivedImageStreamDataCount:1];
+}
+
+- (void)receivedImageStreamDataCount:(int)count {
+  self.streamingPendingFramesCount = MAX(0, self.streamingPendingFramesCount - count);
 }
 
 - (void)getMaxZoomLevelWithResult:(FLTThreadSafeFlutterResult *)result {
@@ -1119,6 +1597,42 @@ NSString *const errorMethod = @"error";
   return _captureDevice.maxAvailableVideoZoomFactor;
 }
 
+- (NSDictionary *)videoWriterSettings {
+  NSMutableDictionary *videoSettings;
+  // The recommended settings for a codec already use its hardware encoder, so start from those,
+  // rather than building settings that may not suit the codec.
+  if (_videoCodec &&
+      [[_captureVideoOutput availableVideoCodecTypesForAssetWriterWithOutputFileType:AVFileTypeMPEG4]
+          containsObject:_videoCodec]) {
+    videoSettings = [[_captureVideoOutput
+        recommendedVideoSettingsForVideoCodecType:_videoCodec
+                        assetWriterOutputFileType:AVFileTypeMPEG4] mutableCopy];
+  } else {
+    videoSettings = [[_captureVideoOutput
+        recommendedVideoSettingsForAssetWriterWithOutputFileType:AVFileTypeMPEG4] mutableCopy];
+  }
+  if (!videoSettings) {
+    return nil;
+  }
+
+  NSMutableDictionary *compressionProperties =
+      [videoSettings[AVVideoCompressionPropertiesKey] mutableCopy]
+          ?: [NSMutableDictionary dictionary];
+  if (_videoAverageBitRate) {
+    compressionProperties[AVVideoAverageBitRateKey] = _videoAverageBitRate;
+  }
+  if (_videoMaxKeyFrameInterval) {
+    compressionProperties[AVVideoMaxKeyFrameIntervalKey] = _videoMaxKeyFrameInterval;
+  }
+  if (_videoExpectedFrameRate) {
+    compressionProperties[AVVideoExpectedSourceFrameRateKey] = _videoExpectedFrameRate;
+  }
+  if (compressionProperties.count > 0) {
+    videoSettings[AVVideoCompressionPropertiesKey] = compressionProperties;
+  }
+  return videoSettings;
+}
+
 - (BOOL)setupWriterForPath:(NSString *)path {
   NSError *error = nil;
   NSURL *outputURL;
@@ -1139,9 +1653,11 @@ NSString *const errorMethod = @"error";
     [_methodChannel invokeMethod:errorMethod arguments:error.description];
     return NO;
   }
+  if (CMTIME_IS_VALID(_movieFragmentInterval)) {
+    _videoWriter.movieFragmentInterval = _movieFragmentInterval;
+  }
 
-  NSDictionary *videoSettings = [_captureVideoOutput
-      recommendedVideoSettingsForAssetWriterWithOutputFileType:AVFileTypeMPEG4];
+  NSDictionary *videoSettings = [self videoWriterSettings];
   _videoWriterInput = [AVAssetWriterInput assetWriterInputWithMediaType:AVMediaTypeVideo
                                                          outputSettings:videoSettings];
 
@@ -1189,6 +1705,134 @@ NSString *const errorMethod = @"error";
   return YES;
 }
 
+- (BOOL)canRecordWithMovieFileOutput {
+  // A multi-cam session doesn't support movie file outputs, and the asset writer is needed to
+  // hand samples to the image stream or to apply encoder properties other than the codec. The
+  // previous movie file output has to finish its file before another one is added.
+  return _prefersMovieFileOutput && !_usesMultiCamSession && !_isStreamingImages &&
+         !_videoAverageBitRate && !_videoMaxKeyFrameInterval && !_videoExpectedFrameRate &&
+         !_movieFileOutputStopResult;
+}
+
+/// Starts a recording to `path` that is written by a new movie file output.
+///
+/// Returns NO, leaving the session as it was, if the session can't record with a movie file
+/// output while it keeps delivering preview frames.
+- (BOOL)startMovieFileOutputRecordingToPath:(NSString *)path {
+  if (path == nil) {
+    return NO;
+  }
+  if (_enableAudio && !_isAudioSetup) {
+    [self setUpCaptureSessionForAudio];
+  }
+
+  AVCaptureMovieFileOutput *movieFileOutput = [AVCaptureMovieFileOutput new];
+  // Unlike the asset writer, the movie file output writes fragments by default.
+  movieFileOutput.movieFragmentInterval = _movieFragmentInterval;
+
+  [_videoCaptureSession beginConfiguration];
+  if (![_videoCaptureSession canAddOutput:movieFileOutput]) {
+    [_videoCaptureSession commitConfiguration];
+    return NO;
+  }
+  // The movie file output can only record audio from its own session, so the audio input moves
+  // over from the audio session until the recording is finished.
+  if (_enableAudio && _audioInput) {
+    [_audioCaptureSession removeInput:_audioInput];
+    if ([_videoCaptureSession canAddInput:_audioInput]) {
+      [_videoCaptureSession addInput:_audioInput];
+    } else {
+      [_audioCaptureSession addInput:_audioInput];
+      [_videoCaptureSession commitConfiguration];
+      return NO;
+    }
+  }
+  [_videoCaptureSession addOutput:movieFileOutput];
+  [_videoCaptureSession commitConfiguration];
+
+  AVCaptureConnection *previewConnection =
+      [_captureVideoOutput connectionWithMediaType:AVMediaTypeVideo];
+  AVCaptureConnection *movieConnection =
+      [movieFileOutput connectionWithMediaType:AVMediaTypeVideo];
+  // Some devices stop feeding the video data output, and with it the preview, while a movie file
+  // output is connected.
+  if (!previewConnection.isActive || !movieConnection.isActive) {
+    [self removeMovieFileOutput:movieFileOutput];
+    return NO;
+  }
+
+  if (movieConnection.isVideoOrientationSupported) {
+    movieConnection.videoOrientation = previewConnection.videoOrientation;
+  }
+  if (movieConnection.isVideoMirroringSupported) {
+    movieConnection.automaticallyAdjustsVideoMirroring = NO;
+    movieConnection.videoMirrored = previewConnection.isVideoMirrored;
+  }
+  if (_videoCodec && [movieFileOutput.availableVideoCodecTypes containsObject:_videoCodec]) {
+    [movieFileOutput setOutputSettings:@{AVVideoCodecKey : _videoCodec}
+                         forConnection:movieConnection];
+  }
+
+  if (_flashMode == FLTFlashModeTorch) {
+    [self.captureDevice lockForConfiguration:nil];
+    [self.captureDevice setTorchMode:AVCaptureTorchModeOn];
+    [self.captureDevice unlockForConfiguration];
+  }
+
+  _movieFileOutput = movieFileOutput;
+  [movieFileOutput startRecordingToOutputFileURL:[NSURL fileURLWithPath:path]
+                               recordingDelegate:self];
+  return YES;
+}
+
+/// Removes `movieFileOutput` from the video session, and moves the audio input back to the audio
+/// session.
+- (void)removeMovieFileOutput:(AVCaptureMovieFileOutput *)movieFileOutput {
+  [_videoCaptureSession beginConfiguration];
+  [_videoCaptureSession removeOutput:movieFileOutput];
+  if (_audioInput && [_videoCaptureSession.inputs containsObject:_audioInput]) {
+    [_videoCaptureSession removeInput:_audioInput];
+    if ([_audioCaptureSession canAddInput:_audioInput]) {
+      [_audioCaptureSession addInput:_audioInput];
+    }
+  }
+  [_videoCaptureSession commitConfiguration];
+}
+
+- (void)captureOutput:(AVCaptureFileOutput *)output
+    didFinishRecordingToOutputFileAtURL:(NSURL *)outputFileURL
+                        fromConnections:(NSArray<AVCaptureConnection *> *)connections
+                                  error:(NSError *)error {
+  // A recording that stopped early, for example because the disk was full, can still have been
+  // finished into a readable file.
+  BOOL finished =
+      error == nil || [error.userInfo[AVErrorRecordingSuccessfullyFinishedKey] boolValue];
+  dispatch_async(self.captureSessionQueue, ^{
+    [self removeMovieFileOutput:(AVCaptureMovieFileOutput *)output];
+    if (output == self.movieFileOutput) {
+      // The recording ended without being stopped, for example because the session was
+      // interrupted.
+      self->_movieFileOutput = nil;
+      self.isRecording = NO;
+      [self.methodChannel invokeMethod:errorMethod
+                             arguments:error.description ?: @"Recording ended unexpectedly"];
+      return;
+    }
+    FLTThreadSafeFlutterResult *result = self.movieFileOutputStopResult;
+    self.movieFileOutputStopResult = nil;
+    if (!finished) {
+      [result sendError:error];
+      return;
+    }
+    [self updateOrientation];
+    NSString *videoRecordingPath = outputFileURL.path;
+    if ([self.videoRecordingPath isEqualToString:videoRecordingPath]) {
+      self.videoRecordingPath = nil;
+    }
+    [result sendSuccessWithData:videoRecordingPath];
+  });
+}
+
 - (void)setUpCaptureSessionForAudio {
   // Don't setup audio twice or we will lose the audio.
   if (_isAudioSetup) {
@@ -1209,6 +1853,7 @@ NSString *const errorMethod = @"error";
 
   if ([_audioCaptureSession canAddInput:audioInput]) {
     [_audioCaptureSession addInput:audioInput];
+    _audioInput = audioInput;
 
     if ([_audioCaptureSession canAddOutput:_audioOutput]) {
       [_audioCaptureSession addOutput:_audioOutput];
@@ -27,6 +27,17 @@
 /// The output for photo capturing. Exposed setter for unit tests.
 @property(strong, nonatomic) AVCapturePhotoOutput *capturePhotoOutput;
 
+/// The serial queue on which image stream frames are packaged into events, so that a slow listener
+/// does not hold up the preview.
+@property(readonly, nonatomic) dispatch_queue_t imageStreamQueue;
+
+/// The serial queue on which samples are appended to recordings and recordings are finished.
+@property(readonly, nonatomic) dispatch_queue_t writerQueue;
+
+/// The output writing the current recording, or nil if there is no recording or it is written by
+/// the asset writer.
+@property(readonly, nonatomic, nullable) AVCaptureMovieFileOutput *movieFileOutput;
+
 /// True when images from the camera are being streamed.
 @property(assign, nonatomic) BOOL isStreamingImages;
 
@@ -55,6 +66,21 @@
                captureSessionQueue:(dispatch_queue_t)captureSessionQueue
                              error:(NSError **)error;
 
+/// The output settings used for the video input of recordings, based on the capture output's
+/// recommended settings and the video recording properties.
+- (nullable NSDictionary *)videoWriterSettings;
+
+/// Whether the next recording can be written by a movie file output, based on the recording
+/// properties and the features in use.
+- (BOOL)canRecordWithMovieFileOutput;
+
+/// The settings for the next photo capture, based on the flash mode, resolution preset and
+/// picture properties.
+- (AVCapturePhotoSettings *)photoSettingsForCapture;
+
+/// Forgets the session presets chosen for each device and resolution preset.
++ (void)clearSessionPresetCache;
+
 /// Start streaming images.
 - (void)startImageStreamWithMessenger:(NSObject<FlutterBinaryMessenger> *)messenger
                    imageStreamHandler:(FLTImageStreamHandler *)imageStreamHandler;
@@ -0,0 +1,48 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import CoreGraphics;
+@import CoreVideo;
+@import Foundation;
+
+#import "CameraProperties.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Crops, scales and converts camera frames for image streams with Accelerate, so that listeners
+/// receive frames in the size and format they process instead of full resolution camera output.
+///
+/// A converter reuses its intermediate buffers between frames, so it must only be used on one
+/// queue at a time.
+@interface FLTImageStreamConverter : NSObject
+
+/// Creates a converter.
+/// @param format the pixel format of converted frames.
+/// @param width the width of converted frames, or 0 for the width of the crop rect.
+/// @param height the height of converted frames, or 0 for the height of the crop rect.
+/// @param cropRect the part of each frame to convert, in coordinates from 0 to 1 of the frame's
+/// size, or `CGRectNull` for the whole frame.
+- (instancetype)initWithFormat:(FLTImageStreamFormat)format
+                         width:(size_t)width
+                        height:(size_t)height
+                      cropRect:(CGRect)cropRect NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property(readonly, nonatomic) FLTImageStreamFormat format;
+@property(readonly, nonatomic) size_t width;
+@property(readonly, nonatomic) size_t height;
+@property(readonly, nonatomic) CGRect cropRect;
+
+/// Returns the converted `pixelBuffer` as an image stream event with `width`, `height`, `format`
+/// and `planes` entries, or nil if the buffer's pixel format is not a BGRA or bi-planar YUV 4:2:0
+/// format.
+///
+/// The `format` entry is the Core Video pixel format type of the planes.
+- (nullable NSMutableDictionary<NSString *, id> *)imageWithPixelBuffer:
+    (CVPixelBufferRef)pixelBuffer;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,300 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTImageStreamConverter.h"
+
+@import Accelerate;
+@import Flutter;
+
+/// Returns an image stream plane entry for `data`.
+static NSDictionary<NSString *, id> *FLTPlane(NSData *data, size_t bytesPerRow, size_t width,
+                                              size_t height) {
+  return @{
+    @"bytesPerRow" : @(bytesPerRow),
+    @"width" : @(width),
+    @"height" : @(height),
+    @"bytes" : [FlutterStandardTypedData typedDataWithBytes:data],
+  };
+}
+
+/// Returns a buffer describing `data` as an image of the given size.
+static vImage_Buffer FLTBufferWithData(NSMutableData *data, size_t width, size_t height,
+                                       size_t bytesPerRow) {
+  return (vImage_Buffer){
+      .data = data.mutableBytes, .height = height, .width = width, .rowBytes = bytesPerRow};
+}
+
+/// Returns `data` resized to at least `length` bytes.
+static NSMutableData *FLTScratch(NSMutableData *data, size_t length) {
+  if (data.length < length) {
+    data.length = length;
+  }
+  return data;
+}
+
+@interface FLTImageStreamConverter ()
+/// Scaled luma and chroma planes of YUV frames, reused between frames.
+@property(nonatomic) NSMutableData *lumaScratch;
+@property(nonatomic) NSMutableData *chromaScratch;
+/// Scaled 4-channel frames, reused between frames.
+@property(nonatomic) NSMutableData *colorScratch;
+@end
+
+@implementation FLTImageStreamConverter {
+  vImage_YpCbCrToARGB _conversionInfo;
+  /// The source format and matrix that `_conversionInfo` was generated for.
+  OSType _conversionPixelFormat;
+  BOOL _conversionUsesITU601;
+  /// Expands video range luma to full range for grayscale frames.
+  Pixel_8 _videoRangeLumaTable[256];
+}
+
+- (instancetype)initWithFormat:(FLTImageStreamFormat)format
+                         width:(size_t)width
+                        height:(size_t)height
+                      cropRect:(CGRect)cropRect {
+  self = [super init];
+  if (self) {
+    _format = format;
+    _width = width;
+    _height = height;
+    _cropRect = cropRect;
+    _lumaScratch = [NSMutableData data];
+    _chromaScratch = [NSMutableData data];
+    _colorScratch = [NSMutableData data];
+    for (int i = 0; i < 256; i++) {
+      _videoRangeLumaTable[i] = (Pixel_8)MIN(255, MAX(0, (i - 16) * 255 / 219));
+    }
+  }
+  return self;
+}
+
+- (nullable NSMutableDictionary<NSString *, id> *)imageWithPixelBuffer:
+    (CVPixelBufferRef)pixelBuffer {
+  OSType pixelFormat = CVPixelBufferGetPixelFormatType(pixelBuffer);
+  BOOL isYUV = pixelFormat == kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange ||
+               pixelFormat == kCVPixelFormatType_420YpCbCr8BiPlanarFullRange;
+  if (!isYUV && pixelFormat != kCVPixelFormatType_32BGRA) {
+    return nil;
+  }
+
+  size_t bufferWidth = CVPixelBufferGetWidth(pixelBuffer);
+  size_t bufferHeight = CVPixelBufferGetHeight(pixelBuffer);
+  CGRect crop = CGRectMake(0, 0, bufferWidth, bufferHeight);
+  if (!CGRectIsNull(_cropRect)) {
+    crop = CGRectIntegral(CGRectMake(_cropRect.origin.x * bufferWidth,
+                                     _cropRect.origin.y * bufferHeight,
+                                     _cropRect.size.width * bufferWidth,
+                                     _cropRect.size.height * bufferHeight));
+    crop = CGRectIntersection(crop, CGRectMake(0, 0, bufferWidth, bufferHeight));
+  }
+  size_t cropX = (size_t)crop.origin.x;
+  size_t cropY = (size_t)crop.origin.y;
+  size_t cropWidth = (size_t)crop.size.width;
+  size_t cropHeight = (size_t)crop.size.height;
+  if (isYUV) {
+    // Chroma samples cover 2x2 luma samples, so the crop must start and end between them.
+    cropX &= ~(size_t)1;
+    cropY &= ~(size_t)1;
+    cropWidth &= ~(size_t)1;
+    cropHeight &= ~(size_t)1;
+  }
+  if (cropWidth == 0 || cropHeight == 0) {
+    return nil;
+  }
+  size_t width = _width ?: cropWidth;
+  size_t height = _height ?: cropHeight;
+
+  CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+  NSMutableDictionary<NSString *, id> *image = [NSMutableDictionary dictionary];
+  image[@"width"] = @(width);
+  image[@"height"] = @(height);
+  if (isYUV) {
+    [self convertYUVPixelBuffer:pixelBuffer
+                          cropX:cropX
+                          cropY:cropY
+                      cropWidth:cropWidth
+                     cropHeight:cropHeight
+                          width:width
+                         height:height
+                        toImage:image];
+  } else {
+    [self convertBGRAPixelBuffer:pixelBuffer
+                           cropX:cropX
+                           cropY:cropY
+                       cropWidth:cropWidth
+                      cropHeight:cropHeight
+                           width:width
+                          height:height
+                         toImage:image];
+  }
+  CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+  return image;
+}
+
+- (void)convertBGRAPixelBuffer:(CVPixelBufferRef)pixelBuffer
+                         cropX:(size_t)cropX
+                         cropY:(size_t)cropY
+                     cropWidth:(size_t)cropWidth
+                    cropHeight:(size_t)cropHeight
+                         width:(size_t)width
+                        height:(size_t)height
+                       toImage:(NSMutableDictionary<NSString *, id> *)image {
+  size_t sourceBytesPerRow = CVPixelBufferGetBytesPerRow(pixelBuffer);
+  uint8_t *sourceAddress = CVPixelBufferGetBaseAddress(pixelBuffer);
+  vImage_Buffer source = {.data = sourceAddress + cropY * sourceBytesPerRow + cropX * 4,
+                          .height = cropHeight,
+                          .width = cropWidth,
+                          .rowBytes = sourceBytesPerRow};
+
+  // Native frames are scaled straight into the event's plane.
+  BOOL isNative = _format == FLTImageStreamFormatNative;
+  NSMutableData *scaledData = isNative ? [NSMutableData dataWithLength:width * 4 * height]
+                                       : FLTScratch(_colorScratch, width * 4 * height);
+  vImage_Buffer scaled = FLTBufferWithData(scaledData, width, height, width * 4);
+  vImageScale_ARGB8888(&source, &scaled, NULL, kvImageNoFlags);
+
+  switch (_format) {
+    case FLTImageStreamFormatRGB888: {
+      NSMutableData *data = [NSMutableData dataWithLength:width * 3 * height];
+      vImage_Buffer output = FLTBufferWithData(data, width, height, width * 3);
+      vImageConvert_BGRA8888toRGB888(&scaled, &output, kvImageNoFlags);
+      image[@"format"] = @(kCVPixelFormatType_24RGB);
+      image[@"planes"] = @[ FLTPlane(data, width * 3, width, height) ];
+      break;
+    }
+    case FLTImageStreamFormatRGBA8888: {
+      NSMutableData *data = [NSMutableData dataWithLength:width * 4 * height];
+      vImage_Buffer output = FLTBufferWithData(data, width, height, width * 4);
+      const uint8_t bgraToRGBA[4] = {2, 1, 0, 3};
+      vImagePermuteChannels_ARGB8888(&scaled, &output, bgraToRGBA, kvImageNoFlags);
+      image[@"format"] = @(kCVPixelFormatType_32RGBA);
+      image[@"planes"] = @[ FLTPlane(data, width * 4, width, height) ];
+      break;
+    }
+    case FLTImageStreamFormatGray8: {
+      NSMutableData *data = [NSMutableData dataWithLength:width * height];
+      vImage_Buffer output = FLTBufferWithData(data, width, height, width);
+      // ITU-R BT.601 luma weights for B, G, R and A, in 1/256ths.
+      const int16_t lumaWeights[4] = {29, 150, 77, 0};
+      vImageMatrixMultiply_ARGB8888ToPlanar8(&scaled, &output, lumaWeights, 256, NULL, 0,
+                                             kvImageNoFlags);
+      image[@"format"] = @(kCVPixelFormatType_OneComponent8);
+      image[@"planes"] = @[ FLTPlane(data, width, width, height) ];
+      break;
+    }
+    default:
+      image[@"format"] = @(kCVPixelFormatType_32BGRA);
+      image[@"planes"] = @[ FLTPlane(scaledData, width * 4, width, height) ];
+      break;
+  }
+}
+
+- (void)convertYUVPixelBuffer:(CVPixelBufferRef)pixelBuffer
+                        cropX:(size_t)cropX
+                        cropY:(size_t)cropY
+                    cropWidth:(size_t)cropWidth
+                   cropHeight:(size_t)cropHeight
+                        width:(size_t)width
+                       height:(size_t)height
+                      toImage:(NSMutableDictionary<NSString *, id> *)image {
+  OSType pixelFormat = CVPixelBufferGetPixelFormatType(pixelBuffer);
+  BOOL isFullRange = pixelFormat == kCVPixelFormatType_420YpCbCr8BiPlanarFullRange;
+
+  size_t lumaBytesPerRow = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0);
+  uint8_t *lumaAddress = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0);
+  vImage_Buffer sourceLuma = {.data = lumaAddress + cropY * lumaBytesPerRow + cropX,
+                              .height = cropHeight,
+                              .width = cropWidth,
+                              .rowBytes = lumaBytesPerRow};
+
+  if (_format == FLTImageStreamFormatGray8) {
+    // Luma alone is the grayscale image.
+    NSMutableData *data = [NSMutableData dataWithLength:width * height];
+    vImage_Buffer output = FLTBufferWithData(data, width, height, width);
+    vImageScale_Planar8(&sourceLuma, &output, NULL, kvImageNoFlags);
+    if (!isFullRange) {
+      vImageTableLookUp_Planar8(&output, &output, _videoRangeLumaTable, kvImageNoFlags);
+    }
+    image[@"format"] = @(kCVPixelFormatType_OneComponent8);
+    image[@"planes"] = @[ FLTPlane(data, width, width, height) ];
+    return;
+  }
+
+  size_t chromaBytesPerRow = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 1);
+  uint8_t *chromaAddress = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 1);
+  vImage_Buffer sourceChroma = {.data = chromaAddress + cropY / 2 * chromaBytesPerRow + cropX,
+                                .height = cropHeight / 2,
+                                .width = cropWidth / 2,
+                                .rowBytes = chromaBytesPerRow};
+
+  // Both planes are scaled to an even size, from which the requested size is taken.
+  size_t evenWidth = width + width % 2;
+  size_t evenHeight = height + height % 2;
+  size_t chromaWidth = evenWidth / 2;
+  size_t chromaHeight = evenHeight / 2;
+  BOOL isNative = _format == FLTImageStreamFormatNative;
+  NSMutableData *lumaData = isNative ? [NSMutableData dataWithLength:evenWidth * evenHeight]
+                                     : FLTScratch(_lumaScratch, evenWidth * evenHeight);
+  NSMutableData *chromaData =
+      isNative ? [NSMutableData dataWithLength:chromaWidth * 2 * chromaHeight]
+               : FLTScratch(_chromaScratch, chromaWidth * 2 * chromaHeight);
+  vImage_Buffer luma = FLTBufferWithData(lumaData, evenWidth, evenHeight, evenWidth);
+  vImage_Buffer chroma = FLTBufferWithData(chromaData, chromaWidth, chromaHeight, chromaWidth * 2);
+  vImageScale_Planar8(&sourceLuma, &luma, NULL, kvImageNoFlags);
+  vImageScale_CbCr8(&sourceChroma, &chroma, NULL, kvImageNoFlags);
+
+  if (isNative) {
+    // Drops the row that only made the height even.
+    lumaData.length = evenWidth * height;
+    image[@"format"] = @(pixelFormat);
+    image[@"planes"] = @[
+      FLTPlane(lumaData, evenWidth, width, height),
+      FLTPlane(chromaData, chromaWidth * 2, chromaWidth, chromaHeight)
+    ];
+    return;
+  }
+
+  BOOL usesITU601 = NO;
+  CFTypeRef matrix = CVBufferGetAttachment(pixelBuffer, kCVImageBufferYCbCrMatrixKey, NULL);
+  if (matrix && CFEqual(matrix, kCVImageBufferYCbCrMatrix_ITU_R_601_4)) {
+    usesITU601 = YES;
+  }
+  if (_conversionPixelFormat != pixelFormat || _conversionUsesITU601 != usesITU601) {
+    vImage_YpCbCrPixelRange pixelRange =
+        isFullRange ? (vImage_YpCbCrPixelRange){0, 128, 255, 255, 255, 1, 255, 0}
+                    : (vImage_YpCbCrPixelRange){16, 128, 235, 240, 235, 16, 240, 16};
+    vImageConvert_YpCbCrToARGB_GenerateConversion(
+        usesITU601 ? kvImage_YpCbCrToARGBMatrix_ITU_R_601_4
+                   : kvImage_YpCbCrToARGBMatrix_ITU_R_709_2,
+        &pixelRange, &_conversionInfo, kvImage420Yp8_CbCr8, kvImageARGB8888, kvImageNoFlags);
+    _conversionPixelFormat = pixelFormat;
+    _conversionUsesITU601 = usesITU601;
+  }
+
+  // Converted to RGBA first, since vImage has no direct conversion from YUV to 3 channels.
+  BOOL isRGBA = _format == FLTImageStreamFormatRGBA8888;
+  NSMutableData *rgbaData = isRGBA ? [NSMutableData dataWithLength:evenWidth * 4 * evenHeight]
+                                   : FLTScratch(_colorScratch, evenWidth * 4 * evenHeight);
+  vImage_Buffer rgba = FLTBufferWithData(rgbaData, evenWidth, evenHeight, evenWidth * 4);
+  const uint8_t argbToRGBA[4] = {1, 2, 3, 0};
+  vImageConvert_420Yp8_CbCr8ToARGB8888(&luma, &chroma, &rgba, &_conversionInfo, argbToRGBA, 255,
+                                       kvImageNoFlags);
+
+  if (isRGBA) {
+    rgbaData.length = evenWidth * 4 * height;
+    image[@"format"] = @(kCVPixelFormatType_32RGBA);
+    image[@"planes"] = @[ FLTPlane(rgbaData, evenWidth * 4, width, height) ];
+    return;
+  }
+  NSMutableData *data = [NSMutableData dataWithLength:width * 3 * height];
+  vImage_Buffer output = FLTBufferWithData(data, width, height, width * 3);
+  rgba.width = width;
+  rgba.height = height;
+  vImageConvert_RGBA8888toRGB888(&rgba, &output, kvImageNoFlags);
+  image[@"format"] = @(kCVPixelFormatType_24RGB);
+  image[@"planes"] = @[ FLTPlane(data, width * 3, width, height) ];
+}
+
+@end
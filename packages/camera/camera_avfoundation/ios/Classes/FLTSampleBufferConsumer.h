@@ -0,0 +1,28 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import CoreMedia;
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A native consumer of camera video frames.
+///
+/// This lets other native plugins, such as on-device inference plugins, process frames directly
+/// instead of receiving them through the image stream, which sends every frame to Dart.
+///
+/// Register a consumer with `-[CameraPlugin addSampleBufferConsumer:]`.
+@protocol FLTSampleBufferConsumer <NSObject>
+
+/// Called for each video frame captured by the active camera.
+///
+/// This is called on the camera's capture session queue, and blocks later frames until it
+/// returns, so long-running work should be moved to another queue. The sample buffer is only
+/// guaranteed to be valid during the call; retain it to keep it longer, but holding many buffers
+/// causes the camera to drop frames.
+- (void)cameraDidOutputSampleBuffer:(CMSampleBufferRef)sampleBuffer;
+
+@end
+
+NS_ASSUME_NONNULL_END
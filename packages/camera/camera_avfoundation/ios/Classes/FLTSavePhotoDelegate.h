@@ -18,6 +18,15 @@ NS_ASSUME_NONNULL_BEGIN
 typedef void (^FLTSavePhotoDelegateCompletionHandler)(NSString *_Nullable path,
                                                       NSError *_Nullable error);
 
+/// The completion handler block for photo captures that are kept in memory.
+/// Called from the IO queue.
+/// If success, `data` will be present and `error` will be nil. Otherwise, `error` will be present
+/// and `data` will be nil.
+/// @param data the captured photo's file data.
+/// @param error photo capture error.
+typedef void (^FLTSavePhotoDelegateDataCompletionHandler)(NSData *_Nullable data,
+                                                          NSError *_Nullable error);
+
 /**
  Delegate object that handles photo capture results.
  */
@@ -33,6 +42,16 @@ typedef void (^FLTSavePhotoDelegateCompletionHandler)(NSString *_Nullable path,
 - (instancetype)initWithPath:(NSString *)path
                      ioQueue:(dispatch_queue_t)ioQueue
            completionHandler:(FLTSavePhotoDelegateCompletionHandler)completionHandler;
+
+/**
+ * Initialize a photo capture delegate that hands the captured photo's file data to
+ * `dataCompletionHandler` instead of writing it to disk.
+ * @param ioQueue the queue on which the captured photo's file data is produced.
+ * @param dataCompletionHandler The completion handler block for the capture. Can be called from
+ * either main queue or IO queue.
+ */
+- (instancetype)initWithIOQueue:(dispatch_queue_t)ioQueue
+          dataCompletionHandler:(FLTSavePhotoDelegateDataCompletionHandler)dataCompletionHandler;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -6,8 +6,8 @@
 #import "FLTSavePhotoDelegate_Test.h"
 
 @interface FLTSavePhotoDelegate ()
-/// The file path for the captured photo.
-@property(readonly, nonatomic) NSString *path;
+/// The file path for the captured photo, or nil if the photo is kept in memory.
+@property(readonly, nonatomic, nullable) NSString *path;
 /// The queue on which captured photos are written to disk.
 @property(readonly, nonatomic) dispatch_queue_t ioQueue;
 @end
@@ -25,10 +25,23 @@
   return self;
 }
 
+- (instancetype)initWithIOQueue:(dispatch_queue_t)ioQueue
+          dataCompletionHandler:(FLTSavePhotoDelegateDataCompletionHandler)dataCompletionHandler {
+  self = [super init];
+  NSAssert(self, @"super init cannot be nil");
+  _ioQueue = ioQueue;
+  _dataCompletionHandler = dataCompletionHandler;
+  return self;
+}
+
 - (void)handlePhotoCaptureResultWithError:(NSError *)error
                         photoDataProvider:(NSData * (^)(void))photoDataProvider {
   if (error) {
-    self.completionHandler(nil, error);
+    if (self.dataCompletionHandler) {
+      self.dataCompletionHandler(nil, error);
+    } else {
+      self.completionHandler(nil, error);
+    }
     return;
   }
   __weak typeof(self) weakSelf = self;
@@ -37,6 +50,20 @@
     if (!strongSelf) return;
 
     NSData *data = photoDataProvider();
+    if (strongSelf.dataCompletionHandler) {
+      if (data) {
+        strongSelf.dataCompletionHandler(data, nil);
+      } else {
+        strongSelf.dataCompletionHandler(
+            nil, [NSError errorWithDomain:NSCocoaErrorDomain
+                                     code:NSFileReadUnknownError
+                                 userInfo:@{
+                                   NSLocalizedDescriptionKey : @"Captured photo has no file data"
+                                 }]);
+      }
+      return;
+    }
+
     NSError *ioError;
     if ([data writeToFile:strongSelf.path options:NSDataWritingAtomic error:&ioError]) {
       strongSelf.completionHandler(self.path, nil);
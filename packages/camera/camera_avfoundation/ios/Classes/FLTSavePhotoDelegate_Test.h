@@ -14,6 +14,10 @@
 /// Exposed for unit tests to manually trigger the completion.
 @property(readonly, nonatomic) FLTSavePhotoDelegateCompletionHandler completionHandler;
 
+/// The completion handler block for photo captures that are kept in memory, or nil if the photo
+/// is written to a file. Exposed for unit tests to manually trigger the completion.
+@property(readonly, nonatomic) FLTSavePhotoDelegateDataCompletionHandler dataCompletionHandler;
+
 /// Handler to write captured photo data into a file.
 /// @param error the capture error.
 /// @param photoDataProvider a closure that provides photo data.
@@ -3,9 +3,17 @@
 // found in the LICENSE file.
 
 #import "FLTThreadSafeMethodChannel.h"
-#import "QueueUtils.h"
 
-@interface FLTThreadSafeMethodChannel ()
+#import <os/lock.h>
+
+@interface FLTThreadSafeMethodChannel () {
+  // Guards `_pendingInvocations` and `_invocationsScheduled`.
+  os_unfair_lock _pendingInvocationsLock;
+  // Invocations from background threads that have not been sent yet, in call order.
+  NSMutableArray<dispatch_block_t> *_pendingInvocations;
+  // Whether a main queue block that sends the pending invocations is scheduled.
+  BOOL _invocationsScheduled;
+}
 @property(nonatomic, strong) FlutterMethodChannel *channel;
 @end
 
@@ -15,15 +23,52 @@
   self = [super init];
   if (self) {
     _channel = channel;
+    _pendingInvocationsLock = OS_UNFAIR_LOCK_INIT;
+    _pendingInvocations = [NSMutableArray array];
   }
   return self;
 }
 
 - (void)invokeMethod:(NSString *)method arguments:(id)arguments {
+  if (NSThread.isMainThread) {
+    // Send earlier invocations from background threads first to keep the call order.
+    [self sendPendingInvocations];
+    [self.channel invokeMethod:method arguments:arguments];
+    return;
+  }
+  // Invocations made before the scheduled block runs are sent together by that block, instead of
+  // each taking its own trip through the main queue.
+  FlutterMethodChannel *channel = self.channel;
+  dispatch_block_t invocation = ^{
+    [channel invokeMethod:method arguments:arguments];
+  };
+  os_unfair_lock_lock(&_pendingInvocationsLock);
+  [_pendingInvocations addObject:invocation];
+  BOOL shouldSchedule = !_invocationsScheduled;
+  _invocationsScheduled = YES;
+  os_unfair_lock_unlock(&_pendingInvocationsLock);
+  if (!shouldSchedule) {
+    return;
+  }
+
   __weak typeof(self) weakSelf = self;
-  FLTEnsureToRunOnMainQueue(^{
-    [weakSelf.channel invokeMethod:method arguments:arguments];
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [weakSelf sendPendingInvocations];
   });
 }
 
+- (void)sendPendingInvocations {
+  os_unfair_lock_lock(&_pendingInvocationsLock);
+  NSArray<dispatch_block_t> *invocations = nil;
+  if (_pendingInvocations.count > 0) {
+    invocations = _pendingInvocations;
+    _pendingInvocations = [NSMutableArray array];
+  }
+  _invocationsScheduled = NO;
+  os_unfair_lock_unlock(&_pendingInvocationsLock);
+  for (dispatch_block_t invocation in invocations) {
+    invocation();
+  }
+}
+
 @end
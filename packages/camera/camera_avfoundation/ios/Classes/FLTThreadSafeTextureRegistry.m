@@ -5,7 +5,16 @@
 #import "FLTThreadSafeTextureRegistry.h"
 #import "QueueUtils.h"
 
-@interface FLTThreadSafeTextureRegistry ()
+#import <os/lock.h>
+
+@interface FLTThreadSafeTextureRegistry () {
+  // Guards `_pendingFrameTextureIds` and `_frameNotificationScheduled`.
+  os_unfair_lock _pendingFramesLock;
+  // Textures with a new frame that the engine has not been notified about yet.
+  NSMutableSet<NSNumber *> *_pendingFrameTextureIds;
+  // Whether a main queue block that notifies the engine about pending frames is scheduled.
+  BOOL _frameNotificationScheduled;
+}
 @property(nonatomic, strong) NSObject<FlutterTextureRegistry> *registry;
 @end
 
@@ -15,6 +24,8 @@
   self = [super init];
   if (self) {
     _registry = registry;
+    _pendingFramesLock = OS_UNFAIR_LOCK_INIT;
+    _pendingFrameTextureIds = [NSMutableSet set];
   }
   return self;
 }
@@ -30,12 +41,39 @@
 }
 
 - (void)textureFrameAvailable:(int64_t)textureId {
+  if (NSThread.isMainThread) {
+    [self.registry textureFrameAvailable:textureId];
+    return;
+  }
+  // Frames can arrive faster than the main queue picks up blocks. Rather than scheduling a block
+  // per frame, all frames that arrive before the scheduled block runs share it, and each texture
+  // is notified once.
+  os_unfair_lock_lock(&_pendingFramesLock);
+  [_pendingFrameTextureIds addObject:@(textureId)];
+  BOOL shouldSchedule = !_frameNotificationScheduled;
+  _frameNotificationScheduled = YES;
+  os_unfair_lock_unlock(&_pendingFramesLock);
+  if (!shouldSchedule) {
+    return;
+  }
+
   __weak typeof(self) weakSelf = self;
-  FLTEnsureToRunOnMainQueue(^{
-    [weakSelf.registry textureFrameAvailable:textureId];
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [weakSelf notifyPendingFrames];
   });
 }
 
+- (void)notifyPendingFrames {
+  os_unfair_lock_lock(&_pendingFramesLock);
+  NSSet<NSNumber *> *textureIds = [_pendingFrameTextureIds copy];
+  [_pendingFrameTextureIds removeAllObjects];
+  _frameNotificationScheduled = NO;
+  os_unfair_lock_unlock(&_pendingFramesLock);
+  for (NSNumber *textureId in textureIds) {
+    [self.registry textureFrameAvailable:textureId.longLongValue];
+  }
+}
+
 - (void)unregisterTexture:(int64_t)textureId {
   __weak typeof(self) weakSelf = self;
   FLTEnsureToRunOnMainQueue(^{
@@ -4,6 +4,7 @@
 
 #import <Foundation/Foundation.h>
 #import <camera_avfoundation/CameraPlugin.h>
+#import <camera_avfoundation/FLTSampleBufferConsumer.h>
 
 FOUNDATION_EXPORT double cameraVersionNumber;
 FOUNDATION_EXPORT const unsigned char cameraVersionString[];
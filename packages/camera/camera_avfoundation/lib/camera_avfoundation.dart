@@ -3,3 +3,8 @@
 // found in the LICENSE file.
 
 export 'src/avfoundation_camera.dart';
+export 'src/image_stream_settings.dart';
+export 'src/multi_cam_cost.dart';
+export 'src/picture_settings.dart';
+export 'src/preview_pixel_format.dart';
+export 'src/video_recording_settings.dart';
@@ -11,8 +11,13 @@ import 'package:flutter/services.dart';
 import 'package:flutter/widgets.dart';
 import 'package:stream_transform/stream_transform.dart';
 
+import 'image_stream_settings.dart';
+import 'multi_cam_cost.dart';
+import 'picture_settings.dart';
+import 'preview_pixel_format.dart';
 import 'type_conversion.dart';
 import 'utils.dart';
+import 'video_recording_settings.dart';
 
 const MethodChannel _channel =
     MethodChannel('plugins.flutter.io/camera_avfoundation');
@@ -64,6 +69,10 @@ class AVFoundationCamera extends CameraPlatform {
   // The stream for vending frames to platform interface clients.
   StreamController<CameraImageData>? _frameStreamController;
 
+  // The number of streamed frames that have not been acknowledged to the
+  // native code yet.
+  int _unacknowledgedFrameCount = 0;
+
   Stream<CameraEvent> _cameraEvents(int cameraId) =>
       cameraEventStreamController.stream
           .where((CameraEvent event) => event.cameraId == cameraId);
@@ -113,6 +122,81 @@ class AVFoundationCamera extends CameraPlatform {
     }
   }
 
+  /// Returns whether the device can run several cameras at once, for cameras
+  /// created with [createMultiCamCamera].
+  ///
+  /// Multi-cam sessions require iOS 13 or later and an A12 chip or later.
+  Future<bool> isMultiCamSupported() async {
+    final bool? supported =
+        await _channel.invokeMethod<bool>('isMultiCamSupported');
+    return supported ?? false;
+  }
+
+  /// Creates a camera that shares one capture session with the other cameras
+  /// created this way, so that they can all run at the same time.
+  ///
+  /// Each camera has its own preview texture and can be controlled on its own.
+  /// Creating a camera with [createCamera] closes the cameras in the shared
+  /// session, and creating one with this method closes any camera created
+  /// with [createCamera]. Image streams always come from the most recently
+  /// created camera.
+  ///
+  /// Throws a [CameraException] if [isMultiCamSupported] is false. Use
+  /// [getMultiCamCost] to check that the chosen resolution presets fit within
+  /// the device's budget.
+  Future<int> createMultiCamCamera(
+    CameraDescription cameraDescription,
+    ResolutionPreset? resolutionPreset, {
+    bool enableAudio = false,
+  }) async {
+    try {
+      final Map<String, dynamic>? reply = await _channel
+          .invokeMapMethod<String, dynamic>('create', <String, dynamic>{
+        'cameraName': cameraDescription.name,
+        'resolutionPreset': resolutionPreset != null
+            ? _serializeResolutionPreset(resolutionPreset)
+            : null,
+        'enableAudio': enableAudio,
+        'multiCam': true,
+      });
+
+      return reply!['cameraId']! as int;
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Returns the cost of running the cameras created with
+  /// [createMultiCamCamera] with their current formats.
+  ///
+  /// Both costs are zero if no such camera has been created.
+  Future<AVFoundationMultiCamCost> getMultiCamCost() async {
+    final Map<String, dynamic>? cost =
+        await _channel.invokeMapMethod<String, dynamic>('getMultiCamCost');
+    return AVFoundationMultiCamCost.fromMap(cost!);
+  }
+
+  /// Configures a capture session for [cameraDescription] ahead of time, so
+  /// that a later [createCamera] call with the same arguments only has to set
+  /// up the preview texture.
+  ///
+  /// This does nothing if camera access has not been granted yet, since it
+  /// never shows a permission prompt. The camera is not started, so the camera
+  /// privacy indicator does not turn on until the camera is initialized.
+  Future<void> prewarmCamera(
+    CameraDescription cameraDescription,
+    ResolutionPreset? resolutionPreset, {
+    bool enableAudio = false,
+  }) async {
+    await _channel.invokeMethod<void>('prewarm', <String, dynamic>{
+      'cameraName': cameraDescription.name,
+      'resolutionPreset': resolutionPreset != null
+          ? _serializeResolutionPreset(resolutionPreset)
+          : null,
+      'enableAudio': enableAudio,
+    });
+  }
+
   @override
   Future<void> initializeCamera(
     int cameraId, {
@@ -242,6 +326,39 @@ class AVFoundationCamera extends CameraPlatform {
     return XFile(path);
   }
 
+  /// Captures a picture and returns its encoded file data, without writing it
+  /// to a file.
+  ///
+  /// This avoids a disk write and read per picture when the bytes are all the
+  /// app needs, for example when taking bursts of pictures.
+  Future<Uint8List> takePictureBytes(int cameraId) async {
+    final Uint8List? bytes = await _channel.invokeMethod<Uint8List>(
+      'takePictureToMemory',
+      <String, dynamic>{'cameraId': cameraId},
+    );
+
+    if (bytes == null) {
+      throw CameraException(
+        'INVALID_DATA',
+        'The platform "$defaultTargetPlatform" did not return picture data while reporting success. The platform should always return picture data or report an error.',
+      );
+    }
+
+    return bytes;
+  }
+
+  /// Sets the settings used by pictures taken by [cameraId] after this call.
+  Future<void> setPictureSettings(
+      int cameraId, AVFoundationPictureSettings settings) async {
+    await _channel.invokeMethod<void>(
+      'setPictureSettings',
+      <String, dynamic>{
+        'cameraId': cameraId,
+        ...settings.toMap(),
+      },
+    );
+  }
+
   @override
   Future<void> prepareForVideoRecording() =>
       _channel.invokeMethod<void>('prepareForVideoRecording');
@@ -271,6 +388,19 @@ class AVFoundationCamera extends CameraPlatform {
     }
   }
 
+  /// Sets the encoder settings used by video recordings from [cameraId] that
+  /// start after this call.
+  Future<void> setVideoRecordingSettings(
+      int cameraId, AVFoundationVideoRecordingSettings settings) async {
+    await _channel.invokeMethod<void>(
+      'setVideoRecordingSettings',
+      <String, dynamic>{
+        'cameraId': cameraId,
+        ...settings.toMap(),
+      },
+    );
+  }
+
   @override
   Future<XFile> stopVideoRecording(int cameraId) async {
     final String? path = await _channel.invokeMethod<String>(
@@ -333,16 +463,29 @@ class AVFoundationCamera extends CameraPlatform {
         EventChannel('plugins.flutter.io/camera_avfoundation/imageStream');
     _platformImageStreamSubscription =
         cameraEventChannel.receiveBroadcastStream().listen((dynamic imageData) {
-      try {
-        _channel.invokeMethod<void>('receivedImageStreamData');
-      } on PlatformException catch (e) {
-        throw CameraException(e.code, e.message);
-      }
+      _acknowledgeStreamedFrame();
       _frameStreamController!
           .add(cameraImageFromPlatformData(imageData as Map<dynamic, dynamic>));
     });
   }
 
+  // Lets the native code send another frame. Frames that arrive before the
+  // acknowledgement is sent share a single message.
+  void _acknowledgeStreamedFrame() {
+    _unacknowledgedFrameCount++;
+    if (_unacknowledgedFrameCount > 1) {
+      return;
+    }
+    Timer.run(() {
+      final int count = _unacknowledgedFrameCount;
+      _unacknowledgedFrameCount = 0;
+      _channel.invokeMethod<void>(
+        'receivedImageStreamData',
+        <String, dynamic>{'count': count},
+      );
+    });
+  }
+
   FutureOr<void> _onFrameStreamCancel() async {
     await _channel.invokeMethod<void>('stopImageStream');
     await _platformImageStreamSubscription?.cancel();
@@ -480,6 +623,56 @@ class AVFoundationCamera extends CameraPlatform {
     return minZoomLevel!;
   }
 
+  /// Sets the pixel format of [cameraId]'s preview frames, which image streams
+  /// also use.
+  ///
+  /// The preview is converted to RGB on the GPU, so a YUV format avoids a
+  /// conversion by the camera hardware and reduces power use.
+  Future<void> setPreviewPixelFormat(
+      int cameraId, AVFoundationPreviewPixelFormat format) async {
+    await _channel.invokeMethod<void>(
+      'setPreviewPixelFormat',
+      <String, dynamic>{
+        'cameraId': cameraId,
+        'format': format.name,
+      },
+    );
+  }
+
+  /// Sets how [cameraId]'s image stream frames are cropped, scaled and
+  /// converted, from the next frame on.
+  Future<void> setImageStreamSettings(
+      int cameraId, AVFoundationImageStreamSettings settings) async {
+    await _channel.invokeMethod<void>(
+      'setImageStreamSettings',
+      <String, dynamic>{
+        'cameraId': cameraId,
+        ...settings.toMap(),
+      },
+    );
+  }
+
+  /// Limits the rate at which [cameraId] captures frames, in frames per
+  /// second.
+  ///
+  /// This applies to the preview, image streams and recordings alike. A null
+  /// bound restores the default of the camera's current format. Lowering
+  /// [maxFrameRate] reduces power use and heat during long previews.
+  Future<void> setFrameRateRange(
+    int cameraId, {
+    int? minFrameRate,
+    int? maxFrameRate,
+  }) async {
+    await _channel.invokeMethod<void>(
+      'setFrameRateRange',
+      <String, dynamic>{
+        'cameraId': cameraId,
+        'minFrameRate': minFrameRate,
+        'maxFrameRate': maxFrameRate,
+      },
+    );
+  }
+
   @override
   Future<void> setZoomLevel(int cameraId, double zoom) async {
     try {
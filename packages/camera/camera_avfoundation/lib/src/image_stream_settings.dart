@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'dart:ui' show Rect;
+
+import 'package:flutter/foundation.dart';
+
+/// The pixel formats that image stream frames can be delivered in.
+enum AVFoundationImageStreamFormat {
+  /// The preview's pixel format, see `setPreviewPixelFormat`.
+  native,
+
+  /// Packed 8-bit red, green and blue, with a raw format of
+  /// `kCVPixelFormatType_24RGB`.
+  rgb888,
+
+  /// Packed 8-bit red, green, blue and alpha, with a raw format of
+  /// `kCVPixelFormatType_32RGBA`.
+  rgba8888,
+
+  /// 8-bit full range luma, with a raw format of
+  /// `kCVPixelFormatType_OneComponent8`.
+  gray8,
+}
+
+/// Settings for image stream frames.
+///
+/// Frames are cropped, scaled and converted on the native side, so listeners
+/// such as ML models can receive small frames in the format they consume
+/// without converting them in Dart.
+@immutable
+class AVFoundationImageStreamSettings {
+  /// Creates a new set of image stream settings.
+  ///
+  /// [width] and [height] must both be set or both be null.
+  const AVFoundationImageStreamSettings({
+    this.format = AVFoundationImageStreamFormat.native,
+    this.width,
+    this.height,
+    this.cropRect,
+  }) : assert((width == null) == (height == null));
+
+  /// The pixel format of frames.
+  ///
+  /// The RGB and grayscale formats have no matching `ImageFormatGroup`, so
+  /// their frames report `ImageFormatGroup.unknown` and the Core Video pixel
+  /// format as `CameraImageFormat.raw`.
+  final AVFoundationImageStreamFormat format;
+
+  /// The width that frames are scaled to, or null for the width of
+  /// [cropRect].
+  final int? width;
+
+  /// The height that frames are scaled to, or null for the height of
+  /// [cropRect].
+  final int? height;
+
+  /// The part of each frame to keep, in coordinates from 0 to 1 of the
+  /// frame's size, or null for the whole frame.
+  ///
+  /// The cropped part is stretched to [width] by [height], so it should have
+  /// the same aspect ratio to avoid distortion. YUV frames are cropped at even
+  /// pixel coordinates.
+  final Rect? cropRect;
+
+  /// Returns the settings in the format sent to the platform.
+  Map<String, Object?> toMap() {
+    final Rect? cropRect = this.cropRect;
+    return <String, Object?>{
+      'format': format.name,
+      'width': width,
+      'height': height,
+      'cropRect': cropRect == null
+          ? null
+          : <String, double>{
+              'x': cropRect.left,
+              'y': cropRect.top,
+              'width': cropRect.width,
+              'height': cropRect.height,
+            },
+    };
+  }
+}
@@ -0,0 +1,37 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// How much of the device's capacity the cameras sharing a multi-cam session
+/// use with their current formats and frame rates.
+///
+/// Each cost is a fraction of the budget, so the session can't run while a
+/// cost is above 1.0. Choosing lower resolution presets or frame rates lowers
+/// both costs.
+@immutable
+class AVFoundationMultiCamCost {
+  /// Creates a new multi-cam cost.
+  const AVFoundationMultiCamCost({
+    required this.hardwareCost,
+    required this.systemPressureCost,
+  });
+
+  /// Creates a multi-cam cost from the format sent by the platform.
+  factory AVFoundationMultiCamCost.fromMap(Map<String, dynamic> map) {
+    return AVFoundationMultiCamCost(
+      hardwareCost: (map['hardwareCost']! as num).toDouble(),
+      systemPressureCost: (map['systemPressureCost']! as num).toDouble(),
+    );
+  }
+
+  /// The share of the camera hardware's bandwidth that the session uses.
+  final double hardwareCost;
+
+  /// The share of the budget for power use and heat that the session uses.
+  ///
+  /// Above 1.0, the system lowers the frame rates of the cameras or stops the
+  /// session to protect the device.
+  final double systemPressureCost;
+}
@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// The file formats that pictures can be captured in.
+enum AVFoundationPictureFormat {
+  /// JPEG.
+  jpeg,
+
+  /// HEIC, which produces smaller files than JPEG at the same quality on
+  /// devices with a hardware HEVC encoder.
+  heic,
+}
+
+/// How picture capture trades image quality against capture speed.
+///
+/// Mirrors `AVCapturePhotoQualityPrioritization`, which requires iOS 13 or
+/// later. Older versions of iOS ignore it.
+enum AVFoundationPhotoQualityPrioritization {
+  /// Captures as quickly as possible, for example for burst shots, at the
+  /// cost of image processing.
+  speed,
+
+  /// Balances image quality against capture speed. The default.
+  balanced,
+
+  /// Prioritizes image quality, which can make each capture slower.
+  quality,
+}
+
+/// Settings for capturing pictures.
+@immutable
+class AVFoundationPictureSettings {
+  /// Creates a new set of picture settings.
+  const AVFoundationPictureSettings({
+    this.format = AVFoundationPictureFormat.jpeg,
+    this.qualityPrioritization =
+        AVFoundationPhotoQualityPrioritization.balanced,
+  });
+
+  /// The file format to capture pictures in.
+  ///
+  /// If the device can't encode HEIC, pictures are captured as JPEG instead.
+  final AVFoundationPictureFormat format;
+
+  /// How to trade image quality against capture speed.
+  final AVFoundationPhotoQualityPrioritization qualityPrioritization;
+
+  /// Returns the settings in the format sent to the platform.
+  Map<String, Object?> toMap() {
+    return <String, Object?>{
+      'format': format.name,
+      'qualityPrioritization': qualityPrioritization.name,
+    };
+  }
+}
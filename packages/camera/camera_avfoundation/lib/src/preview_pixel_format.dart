@@ -0,0 +1,18 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// The pixel formats that preview frames can be delivered in.
+///
+/// Image streams receive frames in the same format.
+enum AVFoundationPreviewPixelFormat {
+  /// 32-bit BGRA. The camera converts each frame from its native YUV output.
+  bgra8888,
+
+  /// Bi-planar YUV 4:2:0 with video range luma.
+  yuv420,
+
+  /// Bi-planar YUV 4:2:0 with full range luma, which is the native output of
+  /// most iOS cameras.
+  yuv420FullRange,
+}
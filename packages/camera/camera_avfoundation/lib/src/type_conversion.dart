@@ -29,6 +29,7 @@ CameraImageFormat _cameraImageFormatFromPlatformData(dynamic data) {
 ImageFormatGroup _imageFormatGroupFromPlatformData(dynamic data) {
   switch (data) {
     case 875704438: // kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange
+    case 875704422: // kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
       return ImageFormatGroup.yuv420;
 
     case 1111970369: // kCVPixelFormatType_32BGRA
@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// The codecs that video recordings can be encoded with.
+enum AVFoundationVideoCodec {
+  /// H.264 (AVC).
+  h264,
+
+  /// H.265 (HEVC), which produces smaller files than H.264 at the same
+  /// quality on devices with a hardware HEVC encoder.
+  hevc,
+
+  /// H.265 (HEVC) with an alpha channel. Requires iOS 13 or later.
+  hevcWithAlpha,
+}
+
+/// Encoder settings for video recordings.
+///
+/// Any setting left null uses the default that AVFoundation recommends for
+/// the camera's current configuration.
+@immutable
+class AVFoundationVideoRecordingSettings {
+  /// Creates a new set of recording settings.
+  const AVFoundationVideoRecordingSettings({
+    this.codec,
+    this.averageBitRate,
+    this.maxKeyFrameInterval,
+    this.expectedFrameRate,
+    this.movieFragmentInterval,
+    this.preferMovieFileOutput = false,
+  });
+
+  /// The codec to record with.
+  ///
+  /// If the device can't record with this codec, the recommended codec is used
+  /// instead.
+  final AVFoundationVideoCodec? codec;
+
+  /// The average bit rate, in bits per second.
+  final int? averageBitRate;
+
+  /// The maximum number of frames between key frames.
+  final int? maxKeyFrameInterval;
+
+  /// The frame rate the encoder should expect, in frames per second.
+  final int? expectedFrameRate;
+
+  /// How often to write a movie fragment to the file.
+  ///
+  /// If this is set, a recording that is interrupted, for example by a crash,
+  /// is still playable up to the last fragment that was written. If it is
+  /// null, the whole movie is only finalized when recording stops.
+  final Duration? movieFragmentInterval;
+
+  /// Whether plain recordings should be written by the system's movie file
+  /// output instead of passing each frame through the plugin.
+  ///
+  /// This lowers the CPU use of long recordings. Recordings that stream
+  /// images, or that set [averageBitRate], [maxKeyFrameInterval] or
+  /// [expectedFrameRate], are still written by the plugin, as are recordings
+  /// on devices that can't show the preview while the movie file output is
+  /// recording.
+  ///
+  /// Recordings written by the movie file output are QuickTime (`.mov`)
+  /// files, and can't be paused or switch to another camera.
+  final bool preferMovieFileOutput;
+
+  /// Returns the settings in the format sent to the platform.
+  Map<String, Object?> toMap() {
+    return <String, Object?>{
+      'codec': codec?.name,
+      'averageBitRate': averageBitRate,
+      'maxKeyFrameInterval': maxKeyFrameInterval,
+      'expectedFrameRate': expectedFrameRate,
+      'movieFragmentInterval': movieFragmentInterval?.inMilliseconds,
+      'preferMovieFileOutput': preferMovieFileOutput,
+    };
+  }
+}
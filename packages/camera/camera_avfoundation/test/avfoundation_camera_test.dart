@@ -7,7 +7,12 @@ import 'dart:math';
 
 import 'package:async/async.dart';
 import 'package:camera_avfoundation/src/avfoundation_camera.dart';
+import 'package:camera_avfoundation/src/image_stream_settings.dart';
+import 'package:camera_avfoundation/src/multi_cam_cost.dart';
+import 'package:camera_avfoundation/src/picture_settings.dart';
+import 'package:camera_avfoundation/src/preview_pixel_format.dart';
 import 'package:camera_avfoundation/src/utils.dart';
+import 'package:camera_avfoundation/src/video_recording_settings.dart';
 import 'package:camera_platform_interface/camera_platform_interface.dart';
 import 'package:flutter/services.dart';
 import 'package:flutter/widgets.dart';
@@ -80,6 +85,108 @@ void main() {
       expect(cameraId, 1);
     });
 
+    test('Should send prewarm data', () async {
+      // Arrange
+      final MethodChannelMock cameraMockChannel = MethodChannelMock(
+          channelName: _channelName, methods: <String, dynamic>{'prewarm': null});
+      final AVFoundationCamera camera = AVFoundationCamera();
+
+      // Act
+      await camera.prewarmCamera(
+        const CameraDescription(
+            name: 'Test',
+            lensDirection: CameraLensDirection.back,
+            sensorOrientation: 0),
+        ResolutionPreset.high,
+        enableAudio: true,
+      );
+
+      // Assert
+      expect(cameraMockChannel.log, <Matcher>[
+        isMethodCall(
+          'prewarm',
+          arguments: <String, Object?>{
+            'cameraName': 'Test',
+            'resolutionPreset': 'high',
+            'enableAudio': true
+          },
+        ),
+      ]);
+    });
+
+    test('Should send creation data for a multi-cam camera', () async {
+      // Arrange
+      final MethodChannelMock cameraMockChannel = MethodChannelMock(
+          channelName: _channelName,
+          methods: <String, dynamic>{
+            'create': <String, dynamic>{'cameraId': 2},
+          });
+      final AVFoundationCamera camera = AVFoundationCamera();
+
+      // Act
+      final int cameraId = await camera.createMultiCamCamera(
+        const CameraDescription(
+            name: 'Test',
+            lensDirection: CameraLensDirection.front,
+            sensorOrientation: 0),
+        ResolutionPreset.medium,
+      );
+
+      // Assert
+      expect(cameraMockChannel.log, <Matcher>[
+        isMethodCall(
+          'create',
+          arguments: <String, Object?>{
+            'cameraName': 'Test',
+            'resolutionPreset': 'medium',
+            'enableAudio': false,
+            'multiCam': true,
+          },
+        ),
+      ]);
+      expect(cameraId, 2);
+    });
+
+    test('Should report whether multi-cam sessions are supported', () async {
+      // Arrange
+      final MethodChannelMock cameraMockChannel = MethodChannelMock(
+          channelName: _channelName,
+          methods: <String, dynamic>{'isMultiCamSupported': true});
+      final AVFoundationCamera camera = AVFoundationCamera();
+
+      // Act
+      final bool supported = await camera.isMultiCamSupported();
+
+      // Assert
+      expect(cameraMockChannel.log, <Matcher>[
+        isMethodCall('isMultiCamSupported', arguments: null),
+      ]);
+      expect(supported, isTrue);
+    });
+
+    test('Should get the multi-cam cost', () async {
+      // Arrange
+      final MethodChannelMock cameraMockChannel = MethodChannelMock(
+          channelName: _channelName,
+          methods: <String, dynamic>{
+            'getMultiCamCost': <String, dynamic>{
+              'hardwareCost': 0.75,
+              'systemPressureCost': 0.5,
+            },
+          });
+      final AVFoundationCamera camera = AVFoundationCamera();
+
+      // Act
+      final AVFoundationMultiCamCost cost = await camera.getMultiCamCost();
+
+      // Assert
+      expect(cameraMockChannel.log, <Matcher>[
+        isMethodCall('getMultiCamCost', arguments: null),
+      ]);
+      expect(cost.hardwareCost, 0.75);
+      expect(cost.systemPressureCost, 0.5);
+    });
+
     test('Should throw CameraException when create throws a PlatformException',
         () {
       // Arrange
@@ -563,6 +670,51 @@ void main() {
       expect(file.path, '/test/path.jpg');
     });
 
+    test('Should take a picture and return its bytes', () async {
+      // Arrange
+      final Uint8List bytes = Uint8List.fromList(<int>[0xFF, 0xD8, 0xFF]);
+      final MethodChannelMock channel = MethodChannelMock(
+          channelName: _channelName,
+          methods: <String, dynamic>{'takePictureToMemory': bytes});
+
+      // Act
+      final Uint8List result = await camera.takePictureBytes(cameraId);
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('takePictureToMemory', arguments: <String, Object?>{
+          'cameraId': cameraId,
+        }),
+      ]);
+      expect(result, bytes);
+    });
+
+    test('Should set picture settings', () async {
+      // Arrange
+      final MethodChannelMock channel = MethodChannelMock(
+        channelName: _channelName,
+        methods: <String, dynamic>{'setPictureSettings': null},
+      );
+
+      // Act
+      await camera.setPictureSettings(
+        cameraId,
+        const AVFoundationPictureSettings(
+          format: AVFoundationPictureFormat.heic,
+          qualityPrioritization: AVFoundationPhotoQualityPrioritization.speed,
+        ),
+      );
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('setPictureSettings', arguments: <String, Object?>{
+          'cameraId': cameraId,
+          'format': 'heic',
+          'qualityPrioritization': 'speed',
+        }),
+      ]);
+    });
+
     test('Should prepare for video recording', () async {
       // Arrange
       final MethodChannelMock channel = MethodChannelMock(
@@ -646,6 +798,67 @@ void main() {
       ]);
     });
 
+    test('Should set video recording settings', () async {
+      // Arrange
+      final MethodChannelMock channel = MethodChannelMock(
+        channelName: _channelName,
+        methods: <String, dynamic>{'setVideoRecordingSettings': null},
+      );
+
+      // Act
+      await camera.setVideoRecordingSettings(
+        cameraId,
+        const AVFoundationVideoRecordingSettings(
+          codec: AVFoundationVideoCodec.hevc,
+          averageBitRate: 4000000,
+          maxKeyFrameInterval: 60,
+          expectedFrameRate: 30,
+          movieFragmentInterval: Duration(seconds: 10),
+          preferMovieFileOutput: true,
+        ),
+      );
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('setVideoRecordingSettings',
+            arguments: <String, Object?>{
+              'cameraId': cameraId,
+              'codec': 'hevc',
+              'averageBitRate': 4000000,
+              'maxKeyFrameInterval': 60,
+              'expectedFrameRate': 30,
+              'movieFragmentInterval': 10000,
+              'preferMovieFileOutput': true,
+            }),
+      ]);
+    });
+
+    test('Should send null for unset video recording settings', () async {
+      // Arrange
+      final MethodChannelMock channel = MethodChannelMock(
+        channelName: _channelName,
+        methods: <String, dynamic>{'setVideoRecordingSettings': null},
+      );
+
+      // Act
+      await camera.setVideoRecordingSettings(
+          cameraId, const AVFoundationVideoRecordingSettings());
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('setVideoRecordingSettings',
+            arguments: <String, Object?>{
+              'cameraId': cameraId,
+              'codec': null,
+              'averageBitRate': null,
+              'maxKeyFrameInterval': null,
+              'expectedFrameRate': null,
+              'movieFragmentInterval': null,
+              'preferMovieFileOutput': false,
+            }),
+      ]);
+    });
+
     test('Should stop a video recording and return the file', () async {
       // Arrange
       final MethodChannelMock channel = MethodChannelMock(
@@ -1007,6 +1220,104 @@ void main() {
       ]);
     });
 
+    test('Should set the preview pixel format', () async {
+      // Arrange
+      final MethodChannelMock channel = MethodChannelMock(
+        channelName: _channelName,
+        methods: <String, dynamic>{'setPreviewPixelFormat': null},
+      );
+
+      // Act
+      await camera.setPreviewPixelFormat(
+          cameraId, AVFoundationPreviewPixelFormat.yuv420FullRange);
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('setPreviewPixelFormat', arguments: <String, Object?>{
+          'cameraId': cameraId,
+          'format': 'yuv420FullRange',
+        }),
+      ]);
+    });
+
+    test('Should set the image stream settings', () async {
+      // Arrange
+      final MethodChannelMock channel = MethodChannelMock(
+        channelName: _channelName,
+        methods: <String, dynamic>{'setImageStreamSettings': null},
+      );
+
+      // Act
+      await camera.setImageStreamSettings(
+        cameraId,
+        const AVFoundationImageStreamSettings(
+          format: AVFoundationImageStreamFormat.rgb888,
+          width: 224,
+          height: 224,
+          cropRect: Rect.fromLTWH(0.25, 0, 0.5, 1),
+        ),
+      );
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('setImageStreamSettings', arguments: <String, Object?>{
+          'cameraId': cameraId,
+          'format': 'rgb888',
+          'width': 224,
+          'height': 224,
+          'cropRect': <String, double>{
+            'x': 0.25,
+            'y': 0,
+            'width': 0.5,
+            'height': 1,
+          },
+        }),
+      ]);
+    });
+
+    test('Should reset the image stream settings', () async {
+      // Arrange
+      final MethodChannelMock channel = MethodChannelMock(
+        channelName: _channelName,
+        methods: <String, dynamic>{'setImageStreamSettings': null},
+      );
+
+      // Act
+      await camera.setImageStreamSettings(
+          cameraId, const AVFoundationImageStreamSettings());
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('setImageStreamSettings', arguments: <String, Object?>{
+          'cameraId': cameraId,
+          'format': 'native',
+          'width': null,
+          'height': null,
+          'cropRect': null,
+        }),
+      ]);
+    });
+
+    test('Should set the frame rate range', () async {
+      // Arrange
+      final MethodChannelMock channel = MethodChannelMock(
+        channelName: _channelName,
+        methods: <String, dynamic>{'setFrameRateRange': null},
+      );
+
+      // Act
+      await camera.setFrameRateRange(cameraId, maxFrameRate: 24);
+
+      // Assert
+      expect(channel.log, <Matcher>[
+        isMethodCall('setFrameRateRange', arguments: <String, Object?>{
+          'cameraId': cameraId,
+          'minFrameRate': null,
+          'maxFrameRate': 24,
+        }),
+      ]);
+    });
+
     test('Should throw CameraException when illegal zoom level is supplied',
         () async {
       // Arrange
@@ -55,4 +55,23 @@ void main() {
     });
     expect(cameraImage.format.group, ImageFormatGroup.yuv420);
   });
+
+  test('CameraImageData has ImageFormatGroup.yuv420 for full range YUV', () {
+    final CameraImageData cameraImage =
+        cameraImageFromPlatformData(<dynamic, dynamic>{
+      'format': 875704422,
+      'height': 1,
+      'width': 4,
+      'planes': <dynamic>[
+        <dynamic, dynamic>{
+          'bytes': Uint8List.fromList(<int>[1, 2, 3, 4]),
+          'bytesPerPixel': 1,
+          'bytesPerRow': 4,
+          'height': 1,
+          'width': 4
+        }
+      ]
+    });
+    expect(cameraImage.format.group, ImageFormatGroup.yuv420);
+  });
 }
@@ -10,22 +10,59 @@ import 'package:flutter/services.dart';
 import 'package:flutter/widgets.dart';
 import 'package:stream_transform/stream_transform.dart';
 
+import 'src/messages.g.dart';
+import 'src/windows_audio_device.dart';
+import 'src/windows_capture_backend.dart';
+import 'src/windows_capture_format.dart';
+import 'src/windows_photo_capture_priority.dart';
+import 'src/windows_picture_settings.dart';
+import 'src/windows_preview_pixel_format.dart';
+import 'src/windows_preview_rotation.dart';
+import 'src/windows_preview_stats.dart';
+import 'src/windows_preview_texture_mode.dart';
+import 'src/windows_video_recording_chunk.dart';
+import 'src/windows_video_recording_settings.dart';
+
+export 'src/windows_audio_device.dart';
+export 'src/windows_capture_backend.dart';
+export 'src/windows_capture_format.dart';
+export 'src/windows_photo_capture_priority.dart';
+export 'src/windows_picture_settings.dart';
+export 'src/windows_preview_pixel_format.dart';
+export 'src/windows_preview_rotation.dart';
+export 'src/windows_preview_stats.dart';
+export 'src/windows_preview_texture_mode.dart';
+export 'src/windows_recording_stats.dart';
+export 'src/windows_video_recording_chunk.dart';
+export 'src/windows_video_recording_settings.dart';
+
 /// An implementation of [CameraPlatform] for Windows.
 class CameraWindows extends CameraPlatform {
+  /// Creates a new Windows [CameraPlatform] implementation instance.
+  CameraWindows({@visibleForTesting CameraApi? api})
+      : _hostApi = api ?? CameraApi();
+
   /// Registers the Windows implementation of CameraPlatform.
   static void registerWith() {
     CameraPlatform.instance = CameraWindows();
   }
 
-  /// The method channel used to interact with the native platform.
-  @visibleForTesting
-  final MethodChannel pluginChannel =
-      const MethodChannel('plugins.flutter.io/camera_windows');
+  /// Digital zoom range of the preview, matching the native implementation.
+  static const double _minZoomLevel = 1.0;
+  static const double _maxZoomLevel = 4.0;
+
+  /// Interface for calling host-side code.
+  final CameraApi _hostApi;
 
-  /// Camera specific method channels to allow communicating with specific cameras.
-  final Map<int, MethodChannel> _cameraChannels = <int, MethodChannel>{};
+  /// Receives the events of all cameras, which are keyed by camera id.
+  late final CameraEventApi _cameraEventHandler = _CameraEventHandler(
+      cameraEventStreamController, _camerasChangedStreamController);
 
-  /// The controller that broadcasts events coming from handleCameraMethodCall
+  /// Image format groups requested for each camera on initialization.
+  final Map<int, ImageFormatGroup> _imageFormatGroups =
+      <int, ImageFormatGroup>{};
+
+  /// The controller that broadcasts events coming from [CameraEventApi].
   ///
   /// It is a `broadcast` because multiple controllers will connect to
   /// different stream views of this Controller.
@@ -35,27 +72,38 @@ class CameraWindows extends CameraPlatform {
   final StreamController<CameraEvent> cameraEventStreamController =
       StreamController<CameraEvent>.broadcast();
 
+  /// The controller that broadcasts the camerasChanged events coming from
+  /// [CameraEventApi].
+  final StreamController<void> _camerasChangedStreamController =
+      StreamController<void>.broadcast();
+
   /// Returns a stream of camera events for the given [cameraId].
   Stream<CameraEvent> _cameraEvents(int cameraId) =>
       cameraEventStreamController.stream
           .where((CameraEvent event) => event.cameraId == cameraId);
 
+  /// Returns a stream that emits whenever a camera is connected to or
+  /// disconnected from the system.
+  ///
+  /// [availableCameras] results are cached by the plugin until then, so
+  /// repeated calls return without enumerating the devices again.
+  Stream<void> onCamerasChanged() {
+    CameraEventApi.setup(_cameraEventHandler);
+    return _camerasChangedStreamController.stream;
+  }
+
   @override
   Future<List<CameraDescription>> availableCameras() async {
     try {
-      final List<Map<dynamic, dynamic>>? cameras = await pluginChannel
-          .invokeListMethod<Map<dynamic, dynamic>>('availableCameras');
-
-      if (cameras == null) {
-        return <CameraDescription>[];
-      }
+      final List<String?> cameras = await _hostApi.getAvailableCameras();
 
-      return cameras.map((Map<dynamic, dynamic> camera) {
+      // Windows does not report the lens direction or sensor orientation of
+      // cameras.
+      return cameras.map((String? name) {
         return CameraDescription(
-          name: camera['name'] as String,
-          lensDirection:
-              parseCameraLensDirection(camera['lensFacing'] as String),
-          sensorOrientation: camera['sensorOrientation'] as int,
+          name: name!,
+          lensDirection: CameraLensDirection.front,
+          sensorOrientation: 0,
         );
       }).toList();
     } on PlatformException catch (e) {
@@ -68,21 +116,120 @@ class CameraWindows extends CameraPlatform {
     CameraDescription cameraDescription,
     ResolutionPreset? resolutionPreset, {
     bool enableAudio = false,
-  }) async {
+  }) {
+    return createCameraWithWindowsSettings(
+      cameraDescription,
+      resolutionPreset,
+      enableAudio: enableAudio,
+    );
+  }
+
+  /// Returns the audio capture devices of the system.
+  ///
+  /// The [WindowsAudioDevice.id] of a device selects it as the audio source of
+  /// [createCameraWithWindowsSettings].
+  Future<List<WindowsAudioDevice>> availableAudioDevices() async {
     try {
-      // If resolutionPreset is not specified, plugin selects the highest resolution possible.
-      final Map<String, dynamic>? reply = await pluginChannel
-          .invokeMapMethod<String, dynamic>('create', <String, dynamic>{
-        'cameraName': cameraDescription.name,
-        'resolutionPreset': _serializeResolutionPreset(resolutionPreset),
-        'enableAudio': enableAudio,
-      });
+      final List<PlatformAudioDevice?> devices =
+          await _hostApi.getAvailableAudioDevices();
 
-      if (reply == null) {
-        throw CameraException('System', 'Cannot create camera');
-      }
+      return devices.map((PlatformAudioDevice? device) {
+        return WindowsAudioDevice(name: device!.name, id: device.id);
+      }).toList();
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
 
-      return reply['cameraId']! as int;
+  /// Prepares the camera described by [cameraDescription] to be opened.
+  ///
+  /// Creates the capture engine and opens the camera device in the
+  /// background, so that a later [createCamera] call for the same camera
+  /// only needs to initialize them. The prepared camera is kept until it is
+  /// created, or until all cameras are disposed.
+  Future<void> prewarmCamera(CameraDescription cameraDescription) async {
+    try {
+      await _hostApi.prewarm(cameraDescription.name);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Creates an uninitialized camera instance like [createCamera], with
+  /// additional Windows specific settings.
+  ///
+  /// [previewTextureMode] selects the kind of texture used for the camera
+  /// preview.
+  ///
+  /// If [adaptivePreview] is true, preview frames are captured at the size the
+  /// preview is displayed at instead of the full size of [resolutionPreset].
+  /// This reduces the processing cost of small previews. Captured pictures and
+  /// videos are not affected.
+  ///
+  /// [targetFrameRate] selects the capture format with the closest frame rate,
+  /// instead of the highest frame rate available. See [getCaptureFormats] for
+  /// the frame rates supported by a camera.
+  ///
+  /// [previewPixelFormat] selects the pixel format preview frames are captured
+  /// in.
+  ///
+  /// If [zeroShutterLag] is true, the most recent preview frames are kept and
+  /// [takePicture] encodes the frame captured when it was called, instead of
+  /// waiting for the camera to capture a new photo. Pictures then have the
+  /// preview resolution, and [adaptivePreview] is ignored.
+  ///
+  /// If [previewStats] is true, the timing of each preview frame is recorded
+  /// and can be read with [getPreviewStats]. The frames are also written as
+  /// events of the `Flutter.Camera.Windows` TraceLogging provider.
+  ///
+  /// [previewMaxFrameRate] limits the rate at which the preview texture is
+  /// updated. Frames above the rate are skipped before they are read, so a
+  /// camera recording at 60 fps can be previewed at 30 fps for half of the
+  /// preview cost. Recordings and image stream frames keep the capture frame
+  /// rate.
+  ///
+  /// [audioDeviceId] selects the device audio is recorded from if
+  /// `enableAudio` is true, see [availableAudioDevices]. If null, the default
+  /// audio capture device of the system is used.
+  ///
+  /// [captureBackend] selects the Media Foundation API the camera is captured
+  /// with. [WindowsCaptureBackend.sourceReader] lowers the preview latency,
+  /// but records videos without audio and at the preview resolution, and
+  /// does not support [adaptivePreview] or [takePictureBurst].
+  Future<int> createCameraWithWindowsSettings(
+    CameraDescription cameraDescription,
+    ResolutionPreset? resolutionPreset, {
+    bool enableAudio = false,
+    WindowsPreviewTextureMode previewTextureMode =
+        WindowsPreviewTextureMode.pixelBuffer,
+    bool adaptivePreview = false,
+    int? targetFrameRate,
+    WindowsPreviewPixelFormat previewPixelFormat =
+        WindowsPreviewPixelFormat.rgb32,
+    bool zeroShutterLag = false,
+    bool previewStats = false,
+    int? previewMaxFrameRate,
+    String? audioDeviceId,
+    WindowsCaptureBackend captureBackend = WindowsCaptureBackend.captureEngine,
+  }) async {
+    try {
+      // If resolutionPreset is not specified, plugin selects the highest resolution possible.
+      return await _hostApi.create(
+        cameraDescription.name,
+        PlatformMediaSettings(
+          resolutionPreset: _pigeonResolutionPreset(resolutionPreset),
+          enableAudio: enableAudio,
+          audioDeviceId: audioDeviceId,
+          previewTextureMode: _pigeonPreviewTextureMode(previewTextureMode),
+          adaptivePreview: adaptivePreview,
+          targetFrameRate: targetFrameRate,
+          previewPixelFormat: _pigeonPreviewPixelFormat(previewPixelFormat),
+          zeroShutterLag: zeroShutterLag,
+          previewStats: previewStats,
+          previewMaxFrameRate: previewMaxFrameRate,
+          captureBackend: _pigeonCaptureBackend(captureBackend),
+        ),
+      );
     } on PlatformException catch (e) {
       throw CameraException(e.code, e.message);
     }
@@ -94,25 +241,13 @@ class CameraWindows extends CameraPlatform {
     ImageFormatGroup imageFormatGroup = ImageFormatGroup.unknown,
   }) async {
     final int requestedCameraId = cameraId;
+    _imageFormatGroups[requestedCameraId] = imageFormatGroup;
 
-    /// Creates channel for camera events.
-    _cameraChannels.putIfAbsent(requestedCameraId, () {
-      final MethodChannel channel = MethodChannel(
-          'plugins.flutter.io/camera_windows/camera$requestedCameraId');
-      channel.setMethodCallHandler(
-        (MethodCall call) => handleCameraMethodCall(call, requestedCameraId),
-      );
-      return channel;
-    });
+    CameraEventApi.setup(_cameraEventHandler);
 
-    final Map<String, double>? reply;
+    final PlatformSize reply;
     try {
-      reply = await pluginChannel.invokeMapMethod<String, double>(
-        'initialize',
-        <String, dynamic>{
-          'cameraId': requestedCameraId,
-        },
-      );
+      reply = await _hostApi.initialize(requestedCameraId);
     } on PlatformException catch (e) {
       throw CameraException(e.code, e.message);
     }
@@ -120,8 +255,8 @@ class CameraWindows extends CameraPlatform {
     cameraEventStreamController.add(
       CameraInitializedEvent(
         requestedCameraId,
-        reply!['previewWidth']!,
-        reply['previewHeight']!,
+        reply.width,
+        reply.height,
         ExposureMode.auto,
         false,
         FocusMode.auto,
@@ -130,19 +265,135 @@ class CameraWindows extends CameraPlatform {
     );
   }
 
+  /// Returns the capture formats supported by the camera device.
+  ///
+  /// The formats are enumerated when the camera is initialized, and only once
+  /// per device while the application runs. The list is empty before the
+  /// camera is initialized.
+  Future<List<WindowsCaptureFormat>> getCaptureFormats(int cameraId) async {
+    final List<PlatformCaptureFormat?> formats;
+    try {
+      formats = await _hostApi.getCaptureFormats(cameraId);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+
+    return formats.map((PlatformCaptureFormat? format) {
+      return WindowsCaptureFormat(
+        width: format!.width,
+        height: format.height,
+        frameRate: format.frameRate,
+      );
+    }).toList();
+  }
+
+  /// Returns the preview pipeline statistics of the camera.
+  ///
+  /// The camera must have been created with `previewStats: true` through
+  /// [createCameraWithWindowsSettings].
+  Future<WindowsPreviewStats> getPreviewStats(int cameraId) async {
+    final PlatformPreviewStats stats;
+    try {
+      stats = await _hostApi.getPreviewStats(cameraId);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+
+    return WindowsPreviewStats(
+      receivedFrames: stats.receivedFrames,
+      renderedFrames: stats.renderedFrames,
+      droppedFrames: stats.droppedFrames,
+      captureFrameRate: stats.captureFrameRate,
+      renderFrameRate: stats.renderFrameRate,
+      latencyP50: Duration(microseconds: stats.latencyP50),
+      latencyP95: Duration(microseconds: stats.latencyP95),
+      latencyP99: Duration(microseconds: stats.latencyP99),
+      conversionTimeP50: Duration(microseconds: stats.conversionTimeP50),
+      conversionTimeP95: Duration(microseconds: stats.conversionTimeP95),
+      conversionTimeP99: Duration(microseconds: stats.conversionTimeP99),
+    );
+  }
+
+  /// Returns the statistics of the current or last video recording of the
+  /// camera.
+  ///
+  /// The statistics are updated as samples are written to the file, and are
+  /// kept until the next recording starts. Throws a [CameraException] if the
+  /// camera has not recorded a video.
+  Future<WindowsRecordingStats> getRecordingStats(int cameraId) async {
+    final PlatformRecordingStats stats;
+    try {
+      stats = await _hostApi.getRecordingStats(cameraId);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+
+    return WindowsRecordingStats(
+      encodedFrames: stats.encodedFrames,
+      droppedFrames: stats.droppedFrames,
+      duration: Duration(microseconds: stats.duration),
+      avDrift: Duration(microseconds: stats.avDrift),
+    );
+  }
+
   @override
   Future<void> dispose(int cameraId) async {
-    await pluginChannel.invokeMethod<void>(
-      'dispose',
-      <String, dynamic>{'cameraId': cameraId},
-    );
+    await _hostApi.dispose(cameraId);
+
+    _imageFormatGroups.remove(cameraId);
+  }
+
+  @override
+  Stream<CameraImageData> onStreamedFrameAvailable(int cameraId,
+      {CameraImageStreamOptions? options}) {
+    late StreamController<CameraImageData> controller;
+    StreamSubscription<dynamic>? platformSubscription;
 
-    // Destroy method channel after camera is disposed to be able to handle last messages.
-    if (_cameraChannels.containsKey(cameraId)) {
-      final MethodChannel? cameraChannel = _cameraChannels[cameraId];
-      cameraChannel?.setMethodCallHandler(null);
-      _cameraChannels.remove(cameraId);
+    Future<void> onListen() async {
+      try {
+        await _hostApi.startImageStream(
+          cameraId,
+          _pigeonImageFormatGroup(
+              _imageFormatGroups[cameraId] ?? ImageFormatGroup.unknown),
+        );
+      } on PlatformException catch (e) {
+        controller.addError(CameraException(e.code, e.message));
+        return;
+      }
+      // The stream may have been cancelled while the platform was starting.
+      if (!controller.hasListener) {
+        return;
+      }
+
+      platformSubscription = EventChannel(
+              'plugins.flutter.io/camera_windows/imageStream/$cameraId')
+          .receiveBroadcastStream()
+          .listen((dynamic imageData) {
+        // Acknowledges the frame so that the platform side can send more.
+        _hostApi.receivedImageStreamData(cameraId);
+        controller.add(
+            _cameraImageFromPlatformData(imageData as Map<dynamic, dynamic>));
+      });
+    }
+
+    Future<void> onCancel() async {
+      await platformSubscription?.cancel();
+      platformSubscription = null;
+      await _hostApi.stopImageStream(cameraId);
+    }
+
+    void onPauseResume() {
+      throw CameraException('InvalidCall',
+          'Pause and resume are not supported for onStreamedFrameAvailable');
     }
+
+    controller = StreamController<CameraImageData>(
+      onListen: onListen,
+      onPause: onPauseResume,
+      onResume: onPauseResume,
+      onCancel: onCancel,
+    );
+    return controller.stream;
   }
 
   @override
@@ -200,18 +451,72 @@ class CameraWindows extends CameraPlatform {
 
   @override
   Future<XFile> takePicture(int cameraId) async {
-    final String? path;
-    path = await pluginChannel.invokeMethod<String>(
-      'takePicture',
-      <String, dynamic>{'cameraId': cameraId},
-    );
+    final String path = await _hostApi.takePicture(cameraId);
+
+    return XFile(path);
+  }
+
+  /// Sets the clockwise rotation of the pictures taken after this call.
+  ///
+  /// Picture files captured by the camera get the rotation as their EXIF
+  /// orientation, so they are not decoded or re-encoded. Pictures encoded by
+  /// the plugin, which are those returned by [takePictureData] and those of
+  /// cameras created with zero shutter lag, are rotated as they are encoded.
+  Future<void> setPictureRotation(
+    int cameraId,
+    WindowsPictureRotation rotation,
+  ) async {
+    try {
+      await _hostApi.setPictureRotation(cameraId, rotation.degrees);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
 
-    return XFile(path!);
+  /// Captures [photoCount] pictures in a row, as fast as the camera allows.
+  ///
+  /// The camera is configured once for the whole burst, and each picture is
+  /// requested as soon as the previous one is taken. [photoCount] must be
+  /// between 1 and 30.
+  ///
+  /// Returns the pictures in capture order.
+  Future<List<XFile>> takePictureBurst(int cameraId, int photoCount) async {
+    assert(photoCount >= 1 && photoCount <= 30);
+    try {
+      final List<String?> paths =
+          await _hostApi.takePictureBurst(cameraId, photoCount);
+
+      return paths.map((String? path) => XFile(path!)).toList();
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Captures a picture and returns it encoded in memory, without writing a
+  /// file.
+  ///
+  /// The picture is encoded with the given [settings]. Pictures of cameras
+  /// created with zero shutter lag are encoded from the most recent preview
+  /// frame.
+  Future<Uint8List> takePictureData(
+    int cameraId, {
+    WindowsPictureSettings settings = const WindowsPictureSettings(),
+  }) async {
+    try {
+      return await _hostApi.takePictureData(
+        cameraId,
+        _pigeonPictureFormat(settings.format),
+        settings.quality,
+      );
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
   }
 
   @override
-  Future<void> prepareForVideoRecording() =>
-      pluginChannel.invokeMethod<void>('prepareForVideoRecording');
+  Future<void> prepareForVideoRecording() async {
+    // No-op on Windows, where recordings need no preparation.
+  }
 
   @override
   Future<void> startVideoRecording(int cameraId,
@@ -227,49 +532,102 @@ class CameraWindows extends CameraPlatform {
           'Streaming is not currently supported on Windows');
     }
 
-    await pluginChannel.invokeMethod<void>(
-      'startVideoRecording',
-      <String, dynamic>{
-        'cameraId': options.cameraId,
-        'maxVideoDuration': options.maxDuration?.inMilliseconds,
-      },
+    await startVideoRecordingWithWindowsSettings(
+      options.cameraId,
+      maxVideoDuration: options.maxDuration,
+    );
+  }
+
+  /// Starts a video recording like [startVideoRecording], with Windows
+  /// specific encoder [settings].
+  Future<void> startVideoRecordingWithWindowsSettings(
+    int cameraId, {
+    Duration? maxVideoDuration,
+    WindowsVideoRecordingSettings settings =
+        const WindowsVideoRecordingSettings(),
+  }) async {
+    final WindowsVideoRateControlMode? rateControlMode =
+        settings.rateControlMode;
+    await _hostApi.startVideoRecording(
+      cameraId,
+      maxVideoDuration?.inMilliseconds,
+      PlatformVideoRecordingSettings(
+        videoCodec: _pigeonVideoCodec(settings.videoCodec),
+        preferHardwareEncoder: settings.preferHardwareEncoder,
+        bitrate: settings.bitrate,
+        rateControlMode: rateControlMode == null
+            ? null
+            : _pigeonRateControlMode(rateControlMode),
+        quality: settings.quality,
+        keyframeInterval: settings.keyframeInterval,
+        streamChunks: settings.streamChunks,
+        audioSampleRate: settings.audioSampleRate,
+        audioChannels: settings.audioChannels,
+        audioBitrate: settings.audioBitrate,
+        proxyHeight: settings.proxyHeight,
+        proxyBitrate: settings.proxyBitrate,
+      ),
     );
   }
 
+  /// Returns a stream of the chunks written to recordings of the given camera
+  /// that were started with [WindowsVideoRecordingSettings.streamChunks].
+  ///
+  /// Chunks are only emitted while the stream is listened to, so it should be
+  /// listened to before the recording starts. All chunks of a recording are
+  /// emitted before [stopVideoRecording] completes.
+  Stream<WindowsVideoRecordingChunk> onVideoRecordingChunk(int cameraId) {
+    return EventChannel(
+            'plugins.flutter.io/camera_windows/recordChunks/$cameraId')
+        .receiveBroadcastStream()
+        .map((dynamic chunk) {
+      final Map<dynamic, dynamic> data = chunk as Map<dynamic, dynamic>;
+      return WindowsVideoRecordingChunk(
+        offset: data['offset'] as int,
+        bytes: data['bytes'] as Uint8List,
+      );
+    });
+  }
+
   @override
   Future<XFile> stopVideoRecording(int cameraId) async {
-    final String? path;
+    final String path = await _hostApi.stopVideoRecording(cameraId);
 
-    path = await pluginChannel.invokeMethod<String>(
-      'stopVideoRecording',
-      <String, dynamic>{'cameraId': cameraId},
-    );
-
-    return XFile(path!);
+    return XFile(path);
   }
 
   @override
   Future<void> pauseVideoRecording(int cameraId) async {
-    throw UnsupportedError(
-        'pauseVideoRecording() is not supported due to Win32 API limitations.');
+    await _hostApi.pauseVideoRecording(cameraId);
   }
 
   @override
   Future<void> resumeVideoRecording(int cameraId) async {
-    throw UnsupportedError(
-        'resumeVideoRecording() is not supported due to Win32 API limitations.');
+    await _hostApi.resumeVideoRecording(cameraId);
   }
 
+  /// Sets the flash of the camera, or keeps its torch on with
+  /// [FlashMode.torch].
+  ///
+  /// Turning the flash off succeeds on cameras without a flash.
   @override
   Future<void> setFlashMode(int cameraId, FlashMode mode) async {
-    // TODO(jokerttu): Implement flash mode support, https://github.com/flutter/flutter/issues/97537.
-    throw UnimplementedError('setFlashMode() is not implemented.');
+    try {
+      await _hostApi.setFlashMode(cameraId, _pigeonFlashMode(mode));
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
   }
 
+  /// Sets the exposure of the camera to automatic, or locks it at its
+  /// current value.
   @override
   Future<void> setExposureMode(int cameraId, ExposureMode mode) async {
-    // TODO(jokerttu): Implement explosure mode support, https://github.com/flutter/flutter/issues/97537.
-    throw UnimplementedError('setExposureMode() is not implemented.');
+    try {
+      await _hostApi.setExposureMode(cameraId, mode == ExposureMode.locked);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
   }
 
   @override
@@ -283,35 +641,100 @@ class CameraWindows extends CameraPlatform {
 
   @override
   Future<double> getMinExposureOffset(int cameraId) async {
-    // TODO(jokerttu): Implement exposure control support, https://github.com/flutter/flutter/issues/97537.
-    // Value is returned to support existing implementations.
-    return 0.0;
+    final PlatformExposureOffsetRange range =
+        await _getExposureOffsetRange(cameraId);
+    return range.min;
   }
 
   @override
   Future<double> getMaxExposureOffset(int cameraId) async {
-    // TODO(jokerttu): Implement exposure control support, https://github.com/flutter/flutter/issues/97537.
-    // Value is returned to support existing implementations.
-    return 0.0;
+    final PlatformExposureOffsetRange range =
+        await _getExposureOffsetRange(cameraId);
+    return range.max;
   }
 
+  /// Returns the step of the exposure offset.
+  ///
+  /// If the camera does not support exposure compensation, the minimum and
+  /// maximum offsets are 0.0 and the step is 1.0, as before exposure control
+  /// was supported.
   @override
   Future<double> getExposureOffsetStepSize(int cameraId) async {
-    // TODO(jokerttu): Implement exposure control support, https://github.com/flutter/flutter/issues/97537.
+    final PlatformExposureOffsetRange range =
+        await _getExposureOffsetRange(cameraId);
+    final double step = range.step;
     // Value is returned to support existing implementations.
-    return 1.0;
+    return step > 0 ? step : 1.0;
   }
 
+  /// Sets the exposure compensation of the camera, and returns the offset
+  /// applied after rounding it to the closest supported step.
   @override
   Future<double> setExposureOffset(int cameraId, double offset) async {
-    // TODO(jokerttu): Implement exposure control support, https://github.com/flutter/flutter/issues/97537.
-    throw UnimplementedError('setExposureOffset() is not implemented.');
+    try {
+      return await _hostApi.setExposureOffset(cameraId, offset);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
   }
 
+  /// Sets the focus of the camera to automatic, or locks it at its current
+  /// distance.
   @override
   Future<void> setFocusMode(int cameraId, FocusMode mode) async {
-    // TODO(jokerttu): Implement focus mode support, https://github.com/flutter/flutter/issues/97537.
-    throw UnimplementedError('setFocusMode() is not implemented.');
+    try {
+      await _hostApi.setFocusMode(cameraId, mode == FocusMode.locked);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets the white balance of the camera to automatic, or locks it at its
+  /// current temperature when [locked] is true.
+  Future<void> setWhiteBalanceLocked(int cameraId, bool locked) async {
+    try {
+      await _hostApi.setWhiteBalanceMode(cameraId, locked);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Keeps the frame rate of the camera constant while the exposure is
+  /// automatic, instead of letting auto exposure lower it in low light.
+  ///
+  /// Cameras that cannot keep the frame rate with auto exposure get a manual
+  /// exposure that fits in a frame instead, until the lock is released.
+  Future<void> setFrameRateLocked(int cameraId, bool locked) async {
+    try {
+      await _hostApi.setFrameRateLock(cameraId, locked);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets whether the pictures of the camera favor the shutter lag over the
+  /// focus.
+  ///
+  /// With [WindowsPhotoCapturePriority.speed], pictures are taken without
+  /// waiting for the auto focus to converge, and the flash fires without a
+  /// pre-flash where the camera supports it.
+  Future<void> setPhotoCapturePriority(
+      int cameraId, WindowsPhotoCapturePriority priority) async {
+    try {
+      await _hostApi.setPhotoCapturePriority(
+          cameraId, _pigeonPhotoCapturePriority(priority));
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  Future<PlatformExposureOffsetRange> _getExposureOffsetRange(
+      int cameraId) async {
+    try {
+      return await _hostApi.getExposureOffsetRange(cameraId);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
   }
 
   @override
@@ -325,38 +748,101 @@ class CameraWindows extends CameraPlatform {
 
   @override
   Future<double> getMinZoomLevel(int cameraId) async {
-    // TODO(jokerttu): Implement zoom level support, https://github.com/flutter/flutter/issues/97537.
-    // Value is returned to support existing implementations.
-    return 1.0;
+    return _minZoomLevel;
   }
 
   @override
   Future<double> getMaxZoomLevel(int cameraId) async {
-    // TODO(jokerttu): Implement zoom level support, https://github.com/flutter/flutter/issues/97537.
-    // Value is returned to support existing implementations.
-    return 1.0;
+    return _maxZoomLevel;
   }
 
+  /// Sets the digital zoom of the camera preview.
+  ///
+  /// The zoom crops the preview around the center of the region set with
+  /// [setCropRect] at capture time, so only the visible region is converted
+  /// for the preview texture. Recordings, pictures and image stream frames
+  /// are not zoomed.
   @override
   Future<void> setZoomLevel(int cameraId, double zoom) async {
-    // TODO(jokerttu): Implement zoom level support, https://github.com/flutter/flutter/issues/97537.
-    throw UnimplementedError('setZoomLevel() is not implemented.');
+    if (zoom < _minZoomLevel || zoom > _maxZoomLevel) {
+      throw CameraException(
+        'ZOOM_ERROR',
+        'Zoom level out of bounds (zoom level should be between '
+            '$_minZoomLevel and $_maxZoomLevel).',
+      );
+    }
+
+    try {
+      await _hostApi.setZoomLevel(cameraId, zoom);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Sets the region of the camera preview shown in the preview texture.
+  ///
+  /// [rect] is given in fractions of the preview size, from `(0, 0)` at the
+  /// top left corner to `(1, 1)` at the bottom right corner of the preview as
+  /// it is shown, and must lie within the preview. The region is cropped at
+  /// capture time, so the texture has the size of the region and only the
+  /// region is converted. Recordings, pictures and image stream frames are not
+  /// cropped.
+  Future<void> setCropRect(int cameraId, Rect rect) async {
+    try {
+      await _hostApi.setCropRect(
+          cameraId, rect.left, rect.top, rect.width, rect.height);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Rotates the camera preview clockwise by [rotation].
+  ///
+  /// The preview is rotated while its frames are converted for the texture,
+  /// or by the GPU video processor with [WindowsPreviewTextureMode.gpuSurface],
+  /// so no `Transform` widget is needed to show it upright. Quarter turns swap
+  /// the width and height of the texture. Rotation is applied after mirroring,
+  /// and the rectangle set with [setCropRect] stays in the rotated
+  /// orientation. Recordings, pictures and image stream frames are not
+  /// rotated.
+  Future<void> setPreviewRotation(
+      int cameraId, WindowsPreviewRotation rotation) async {
+    try {
+      await _hostApi.setPreviewRotation(cameraId, rotation.degrees);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
+  }
+
+  /// Limits the rate at which the preview texture of the camera is updated
+  /// to [framesPerSecond].
+  ///
+  /// Frames above the rate are not converted or uploaded for the texture,
+  /// and a rate of 0 stops updating it, for example while the preview widget
+  /// is scrolled out of view or covered. A null rate removes the limit. The
+  /// camera keeps capturing, so recordings, pictures and image stream frames
+  /// are not affected, and the preview resumes without restarting the camera.
+  ///
+  /// The preview is also not updated while the application window is
+  /// minimized or hidden, whatever the rate, nor faster than the
+  /// `previewMaxFrameRate` given to [createCameraWithWindowsSettings].
+  Future<void> setPreviewFrameRate(
+      int cameraId, double? framesPerSecond) async {
+    try {
+      await _hostApi.setPreviewFrameRate(cameraId, framesPerSecond);
+    } on PlatformException catch (e) {
+      throw CameraException(e.code, e.message);
+    }
   }
 
   @override
   Future<void> pausePreview(int cameraId) async {
-    await pluginChannel.invokeMethod<double>(
-      'pausePreview',
-      <String, dynamic>{'cameraId': cameraId},
-    );
+    await _hostApi.pausePreview(cameraId);
   }
 
   @override
   Future<void> resumePreview(int cameraId) async {
-    await pluginChannel.invokeMethod<double>(
-      'resumePreview',
-      <String, dynamic>{'cameraId': cameraId},
-    );
+    await _hostApi.resumePreview(cameraId);
   }
 
   @override
@@ -364,79 +850,181 @@ class CameraWindows extends CameraPlatform {
     return Texture(textureId: cameraId);
   }
 
-  /// Returns the resolution preset as a nullable String.
-  String? _serializeResolutionPreset(ResolutionPreset? resolutionPreset) {
+  /// Returns the resolution preset as a nullable [PlatformResolutionPreset].
+  PlatformResolutionPreset? _pigeonResolutionPreset(
+      ResolutionPreset? resolutionPreset) {
     switch (resolutionPreset) {
       case null:
         return null;
       case ResolutionPreset.max:
-        return 'max';
+        return PlatformResolutionPreset.max;
       case ResolutionPreset.ultraHigh:
-        return 'ultraHigh';
+        return PlatformResolutionPreset.ultraHigh;
       case ResolutionPreset.veryHigh:
-        return 'veryHigh';
+        return PlatformResolutionPreset.veryHigh;
       case ResolutionPreset.high:
-        return 'high';
+        return PlatformResolutionPreset.high;
       case ResolutionPreset.medium:
-        return 'medium';
+        return PlatformResolutionPreset.medium;
       case ResolutionPreset.low:
-        return 'low';
+        return PlatformResolutionPreset.low;
+    }
+  }
+
+  /// Returns the [PlatformPreviewTextureMode] of the given mode.
+  PlatformPreviewTextureMode _pigeonPreviewTextureMode(
+      WindowsPreviewTextureMode mode) {
+    switch (mode) {
+      case WindowsPreviewTextureMode.pixelBuffer:
+        return PlatformPreviewTextureMode.pixelBuffer;
+      case WindowsPreviewTextureMode.gpuSurface:
+        return PlatformPreviewTextureMode.gpuSurface;
+    }
+  }
+
+  /// Returns the [PlatformPreviewPixelFormat] of the given format.
+  PlatformPreviewPixelFormat _pigeonPreviewPixelFormat(
+      WindowsPreviewPixelFormat format) {
+    switch (format) {
+      case WindowsPreviewPixelFormat.rgb32:
+        return PlatformPreviewPixelFormat.rgb32;
+      case WindowsPreviewPixelFormat.nv12:
+        return PlatformPreviewPixelFormat.nv12;
+    }
+  }
+
+  /// Returns the [PlatformCaptureBackend] of the given backend.
+  PlatformCaptureBackend _pigeonCaptureBackend(WindowsCaptureBackend backend) {
+    switch (backend) {
+      case WindowsCaptureBackend.captureEngine:
+        return PlatformCaptureBackend.captureEngine;
+      case WindowsCaptureBackend.sourceReader:
+        return PlatformCaptureBackend.sourceReader;
     }
   }
 
-  /// Converts messages received from the native platform into camera events.
+  /// Returns the image stream format requested for the given format group.
   ///
-  /// This is only exposed for test purposes. It shouldn't be used by clients
-  /// of the plugin as it may break or change at any time.
-  @visibleForTesting
-  Future<dynamic> handleCameraMethodCall(MethodCall call, int cameraId) async {
-    switch (call.method) {
-      case 'camera_closing':
-        cameraEventStreamController.add(
-          CameraClosingEvent(
-            cameraId,
-          ),
-        );
-        break;
-      case 'video_recorded':
-        final Map<String, Object?> arguments =
-            (call.arguments as Map<Object?, Object?>).cast<String, Object?>();
-        final int? maxDuration = arguments['maxVideoDuration'] as int?;
-        // This is called if maxVideoDuration was given on record start.
-        cameraEventStreamController.add(
-          VideoRecordedEvent(
-            cameraId,
-            XFile(arguments['path']! as String),
-            maxDuration != null ? Duration(milliseconds: maxDuration) : null,
-          ),
-        );
-        break;
-      case 'error':
-        final Map<String, Object?> arguments =
-            (call.arguments as Map<Object?, Object?>).cast<String, Object?>();
-        cameraEventStreamController.add(
-          CameraErrorEvent(
-            cameraId,
-            arguments['description']! as String,
-          ),
-        );
-        break;
-      default:
-        throw UnimplementedError();
+  /// Only NV12 (reported as [ImageFormatGroup.yuv420]) and BGRA8888 frames are
+  /// supported; all other groups fall back to BGRA8888.
+  PlatformImageFormatGroup _pigeonImageFormatGroup(
+      ImageFormatGroup imageFormatGroup) {
+    return imageFormatGroup == ImageFormatGroup.yuv420
+        ? PlatformImageFormatGroup.yuv420
+        : PlatformImageFormatGroup.bgra8888;
+  }
+
+  /// Returns the [PlatformVideoCodec] of the given codec.
+  PlatformVideoCodec _pigeonVideoCodec(WindowsVideoCodec codec) {
+    switch (codec) {
+      case WindowsVideoCodec.h264:
+        return PlatformVideoCodec.h264;
+      case WindowsVideoCodec.hevc:
+        return PlatformVideoCodec.hevc;
     }
   }
 
-  /// Parses string presentation of the camera lens direction and returns enum value.
-  @visibleForTesting
-  CameraLensDirection parseCameraLensDirection(String string) {
-    switch (string) {
-      case 'front':
-        return CameraLensDirection.front;
-      case 'back':
-        return CameraLensDirection.back;
-      case 'external':
-        return CameraLensDirection.external;
-    }
-    throw ArgumentError('Unknown CameraLensDirection value');
+  /// Returns the [PlatformRateControlMode] of the given mode.
+  PlatformRateControlMode _pigeonRateControlMode(
+      WindowsVideoRateControlMode mode) {
+    switch (mode) {
+      case WindowsVideoRateControlMode.constantBitrate:
+        return PlatformRateControlMode.constantBitrate;
+      case WindowsVideoRateControlMode.variableBitrate:
+        return PlatformRateControlMode.variableBitrate;
+      case WindowsVideoRateControlMode.quality:
+        return PlatformRateControlMode.quality;
+    }
+  }
+
+  /// Returns the [PlatformPictureFormat] of the given format.
+  PlatformPictureFormat _pigeonPictureFormat(WindowsPictureFormat format) {
+    switch (format) {
+      case WindowsPictureFormat.jpeg:
+        return PlatformPictureFormat.jpeg;
+      case WindowsPictureFormat.png:
+        return PlatformPictureFormat.png;
+    }
+  }
+
+  /// Returns the [PlatformFlashMode] of the given mode.
+  PlatformFlashMode _pigeonFlashMode(FlashMode mode) {
+    switch (mode) {
+      case FlashMode.off:
+        return PlatformFlashMode.off;
+      case FlashMode.auto:
+        return PlatformFlashMode.autoFlash;
+      case FlashMode.always:
+        return PlatformFlashMode.always;
+      case FlashMode.torch:
+        return PlatformFlashMode.torch;
+    }
+  }
+
+  /// Returns the [PlatformPhotoCapturePriority] of the given priority.
+  PlatformPhotoCapturePriority _pigeonPhotoCapturePriority(
+      WindowsPhotoCapturePriority priority) {
+    switch (priority) {
+      case WindowsPhotoCapturePriority.balanced:
+        return PlatformPhotoCapturePriority.balanced;
+      case WindowsPhotoCapturePriority.speed:
+        return PlatformPhotoCapturePriority.speed;
+    }
+  }
+
+  /// Converts an image stream frame received from the native platform.
+  CameraImageData _cameraImageFromPlatformData(Map<dynamic, dynamic> data) {
+    final String format = data['format']! as String;
+    return CameraImageData(
+      format: CameraImageFormat(
+        format == 'nv12' ? ImageFormatGroup.yuv420 : ImageFormatGroup.bgra8888,
+        raw: format,
+      ),
+      width: data['width']! as int,
+      height: data['height']! as int,
+      planes: List<CameraImagePlane>.unmodifiable(
+          (data['planes']! as List<dynamic>).map<CameraImagePlane>(
+              (dynamic planeData) {
+        final Map<dynamic, dynamic> plane = planeData as Map<dynamic, dynamic>;
+        return CameraImagePlane(
+          bytes: plane['bytes']! as Uint8List,
+          bytesPerRow: plane['bytesPerRow']! as int,
+          width: plane['width'] as int?,
+          height: plane['height'] as int?,
+        );
+      })),
+    );
+  }
+}
+
+/// Adds the events sent by the native cameras to a [CameraWindows] stream.
+class _CameraEventHandler implements CameraEventApi {
+  _CameraEventHandler(this._controller, this._camerasChangedController);
+
+  final StreamController<CameraEvent> _controller;
+  final StreamController<void> _camerasChangedController;
+
+  @override
+  void cameraClosing(int cameraId) {
+    _controller.add(CameraClosingEvent(cameraId));
+  }
+
+  @override
+  void videoRecorded(int cameraId, String path, int maxVideoDurationMs) {
+    _controller.add(VideoRecordedEvent(
+      cameraId,
+      XFile(path),
+      Duration(milliseconds: maxVideoDurationMs),
+    ));
+  }
+
+  @override
+  void error(int cameraId, String description) {
+    _controller.add(CameraErrorEvent(cameraId, description));
+  }
+
+  @override
+  void camerasChanged() {
+    _camerasChangedController.add(null);
   }
 }
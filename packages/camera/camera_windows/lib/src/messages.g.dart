@@ -0,0 +1,1485 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+// Autogenerated from Pigeon (v10.1.2), do not edit directly.
+// See also: https://pub.dev/packages/pigeon
+// ignore_for_file: public_member_api_docs, non_constant_identifier_names, avoid_as, unused_import, unnecessary_parenthesis, prefer_null_aware_operators, omit_local_variable_types, unused_shown_name, unnecessary_import
+
+import 'dart:async';
+import 'dart:typed_data' show Float64List, Int32List, Int64List, Uint8List;
+
+import 'package:flutter/foundation.dart' show ReadBuffer, WriteBuffer;
+import 'package:flutter/services.dart';
+
+/// Pigeon version of ResolutionPreset.
+enum PlatformResolutionPreset {
+  low,
+  medium,
+  high,
+  veryHigh,
+  ultraHigh,
+  max,
+}
+
+/// Pigeon version of WindowsPreviewTextureMode.
+enum PlatformPreviewTextureMode {
+  pixelBuffer,
+  gpuSurface,
+}
+
+/// Pigeon version of WindowsPreviewPixelFormat.
+enum PlatformPreviewPixelFormat {
+  rgb32,
+  nv12,
+}
+
+/// Pigeon version of WindowsCaptureBackend.
+enum PlatformCaptureBackend {
+  captureEngine,
+  sourceReader,
+}
+
+/// Pigeon version of the image stream formats, which are NV12 for yuv420
+/// and BGRA for every other ImageFormatGroup.
+enum PlatformImageFormatGroup {
+  bgra8888,
+  yuv420,
+}
+
+/// Pigeon version of WindowsVideoCodec.
+enum PlatformVideoCodec {
+  h264,
+  hevc,
+}
+
+/// Pigeon version of WindowsVideoRateControlMode.
+enum PlatformRateControlMode {
+  constantBitrate,
+  variableBitrate,
+  quality,
+}
+
+/// Pigeon version of WindowsPictureFormat.
+enum PlatformPictureFormat {
+  jpeg,
+  png,
+}
+
+/// Pigeon version of FlashMode.
+enum PlatformFlashMode {
+  off,
+  autoFlash,
+  always,
+  torch,
+}
+
+/// Pigeon version of WindowsPhotoCapturePriority.
+enum PlatformPhotoCapturePriority {
+  balanced,
+  speed,
+}
+
+/// The settings a camera is created with.
+class PlatformMediaSettings {
+  PlatformMediaSettings({
+    this.resolutionPreset,
+    required this.enableAudio,
+    this.audioDeviceId,
+    required this.previewTextureMode,
+    required this.adaptivePreview,
+    this.targetFrameRate,
+    required this.previewPixelFormat,
+    required this.zeroShutterLag,
+    required this.previewStats,
+    this.previewMaxFrameRate,
+    required this.captureBackend,
+  });
+
+  /// The resolution to capture at, or null for the highest resolution.
+  PlatformResolutionPreset? resolutionPreset;
+
+  bool enableAudio;
+
+  String? audioDeviceId;
+
+  PlatformPreviewTextureMode previewTextureMode;
+
+  bool adaptivePreview;
+
+  int? targetFrameRate;
+
+  PlatformPreviewPixelFormat previewPixelFormat;
+
+  bool zeroShutterLag;
+
+  bool previewStats;
+
+  int? previewMaxFrameRate;
+
+  PlatformCaptureBackend captureBackend;
+
+  Object encode() {
+    return <Object?>[
+      resolutionPreset?.index,
+      enableAudio,
+      audioDeviceId,
+      previewTextureMode.index,
+      adaptivePreview,
+      targetFrameRate,
+      previewPixelFormat.index,
+      zeroShutterLag,
+      previewStats,
+      previewMaxFrameRate,
+      captureBackend.index,
+    ];
+  }
+
+  static PlatformMediaSettings decode(Object result) {
+    result as List<Object?>;
+    return PlatformMediaSettings(
+      resolutionPreset: result[0] != null
+          ? PlatformResolutionPreset.values[result[0]! as int]
+          : null,
+      enableAudio: result[1]! as bool,
+      audioDeviceId: result[2] as String?,
+      previewTextureMode: PlatformPreviewTextureMode.values[result[3]! as int],
+      adaptivePreview: result[4]! as bool,
+      targetFrameRate: result[5] as int?,
+      previewPixelFormat: PlatformPreviewPixelFormat.values[result[6]! as int],
+      zeroShutterLag: result[7]! as bool,
+      previewStats: result[8]! as bool,
+      previewMaxFrameRate: result[9] as int?,
+      captureBackend: PlatformCaptureBackend.values[result[10]! as int],
+    );
+  }
+}
+
+/// The encoder settings a video is recorded with.
+class PlatformVideoRecordingSettings {
+  PlatformVideoRecordingSettings({
+    required this.videoCodec,
+    required this.preferHardwareEncoder,
+    this.bitrate,
+    this.rateControlMode,
+    this.quality,
+    this.keyframeInterval,
+    required this.streamChunks,
+    this.audioSampleRate,
+    this.audioChannels,
+    this.audioBitrate,
+    this.proxyHeight,
+    this.proxyBitrate,
+  });
+
+  PlatformVideoCodec videoCodec;
+
+  bool preferHardwareEncoder;
+
+  int? bitrate;
+
+  PlatformRateControlMode? rateControlMode;
+
+  int? quality;
+
+  int? keyframeInterval;
+
+  bool streamChunks;
+
+  int? audioSampleRate;
+
+  int? audioChannels;
+
+  int? audioBitrate;
+
+  int? proxyHeight;
+
+  int? proxyBitrate;
+
+  Object encode() {
+    return <Object?>[
+      videoCodec.index,
+      preferHardwareEncoder,
+      bitrate,
+      rateControlMode?.index,
+      quality,
+      keyframeInterval,
+      streamChunks,
+      audioSampleRate,
+      audioChannels,
+      audioBitrate,
+      proxyHeight,
+      proxyBitrate,
+    ];
+  }
+
+  static PlatformVideoRecordingSettings decode(Object result) {
+    result as List<Object?>;
+    return PlatformVideoRecordingSettings(
+      videoCodec: PlatformVideoCodec.values[result[0]! as int],
+      preferHardwareEncoder: result[1]! as bool,
+      bitrate: result[2] as int?,
+      rateControlMode: result[3] != null
+          ? PlatformRateControlMode.values[result[3]! as int]
+          : null,
+      quality: result[4] as int?,
+      keyframeInterval: result[5] as int?,
+      streamChunks: result[6]! as bool,
+      audioSampleRate: result[7] as int?,
+      audioChannels: result[8] as int?,
+      audioBitrate: result[9] as int?,
+      proxyHeight: result[10] as int?,
+      proxyBitrate: result[11] as int?,
+    );
+  }
+}
+
+/// A size of the camera preview, in pixels.
+class PlatformSize {
+  PlatformSize({
+    required this.width,
+    required this.height,
+  });
+
+  double width;
+
+  double height;
+
+  Object encode() {
+    return <Object?>[
+      width,
+      height,
+    ];
+  }
+
+  static PlatformSize decode(Object result) {
+    result as List<Object?>;
+    return PlatformSize(
+      width: result[0]! as double,
+      height: result[1]! as double,
+    );
+  }
+}
+
+/// Pigeon version of WindowsAudioDevice.
+class PlatformAudioDevice {
+  PlatformAudioDevice({
+    required this.name,
+    required this.id,
+  });
+
+  String name;
+
+  String id;
+
+  Object encode() {
+    return <Object?>[
+      name,
+      id,
+    ];
+  }
+
+  static PlatformAudioDevice decode(Object result) {
+    result as List<Object?>;
+    return PlatformAudioDevice(
+      name: result[0]! as String,
+      id: result[1]! as String,
+    );
+  }
+}
+
+/// Pigeon version of WindowsCaptureFormat.
+class PlatformCaptureFormat {
+  PlatformCaptureFormat({
+    required this.width,
+    required this.height,
+    required this.frameRate,
+  });
+
+  int width;
+
+  int height;
+
+  double frameRate;
+
+  Object encode() {
+    return <Object?>[
+      width,
+      height,
+      frameRate,
+    ];
+  }
+
+  static PlatformCaptureFormat decode(Object result) {
+    result as List<Object?>;
+    return PlatformCaptureFormat(
+      width: result[0]! as int,
+      height: result[1]! as int,
+      frameRate: result[2]! as double,
+    );
+  }
+}
+
+/// Pigeon version of WindowsPreviewStats, with durations in microseconds.
+class PlatformPreviewStats {
+  PlatformPreviewStats({
+    required this.receivedFrames,
+    required this.renderedFrames,
+    required this.droppedFrames,
+    required this.captureFrameRate,
+    required this.renderFrameRate,
+    required this.latencyP50,
+    required this.latencyP95,
+    required this.latencyP99,
+    required this.conversionTimeP50,
+    required this.conversionTimeP95,
+    required this.conversionTimeP99,
+  });
+
+  int receivedFrames;
+
+  int renderedFrames;
+
+  int droppedFrames;
+
+  double captureFrameRate;
+
+  double renderFrameRate;
+
+  int latencyP50;
+
+  int latencyP95;
+
+  int latencyP99;
+
+  int conversionTimeP50;
+
+  int conversionTimeP95;
+
+  int conversionTimeP99;
+
+  Object encode() {
+    return <Object?>[
+      receivedFrames,
+      renderedFrames,
+      droppedFrames,
+      captureFrameRate,
+      renderFrameRate,
+      latencyP50,
+      latencyP95,
+      latencyP99,
+      conversionTimeP50,
+      conversionTimeP95,
+      conversionTimeP99,
+    ];
+  }
+
+  static PlatformPreviewStats decode(Object result) {
+    result as List<Object?>;
+    return PlatformPreviewStats(
+      receivedFrames: result[0]! as int,
+      renderedFrames: result[1]! as int,
+      droppedFrames: result[2]! as int,
+      captureFrameRate: result[3]! as double,
+      renderFrameRate: result[4]! as double,
+      latencyP50: result[5]! as int,
+      latencyP95: result[6]! as int,
+      latencyP99: result[7]! as int,
+      conversionTimeP50: result[8]! as int,
+      conversionTimeP95: result[9]! as int,
+      conversionTimeP99: result[10]! as int,
+    );
+  }
+}
+
+/// Pigeon version of WindowsRecordingStats, with durations in microseconds.
+class PlatformRecordingStats {
+  PlatformRecordingStats({
+    required this.encodedFrames,
+    required this.droppedFrames,
+    required this.duration,
+    required this.avDrift,
+  });
+
+  int encodedFrames;
+
+  int droppedFrames;
+
+  int duration;
+
+  int avDrift;
+
+  Object encode() {
+    return <Object?>[
+      encodedFrames,
+      droppedFrames,
+      duration,
+      avDrift,
+    ];
+  }
+
+  static PlatformRecordingStats decode(Object result) {
+    result as List<Object?>;
+    return PlatformRecordingStats(
+      encodedFrames: result[0]! as int,
+      droppedFrames: result[1]! as int,
+      duration: result[2]! as int,
+      avDrift: result[3]! as int,
+    );
+  }
+}
+
+/// The exposure offsets supported by a camera.
+class PlatformExposureOffsetRange {
+  PlatformExposureOffsetRange({
+    required this.min,
+    required this.max,
+    required this.step,
+  });
+
+  double min;
+
+  double max;
+
+  double step;
+
+  Object encode() {
+    return <Object?>[
+      min,
+      max,
+      step,
+    ];
+  }
+
+  static PlatformExposureOffsetRange decode(Object result) {
+    result as List<Object?>;
+    return PlatformExposureOffsetRange(
+      min: result[0]! as double,
+      max: result[1]! as double,
+      step: result[2]! as double,
+    );
+  }
+}
+
+class _CameraApiCodec extends StandardMessageCodec {
+  const _CameraApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is PlatformAudioDevice) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    }} else if (value is PlatformCaptureFormat) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
+    }} else if (value is PlatformExposureOffsetRange) {
+      buffer.putUint8(130);
+      writeValue(buffer, value.encode());
+    }} else if (value is PlatformMediaSettings) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    }} else if (value is PlatformPreviewStats) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
+    }} else if (value is PlatformRecordingStats) {
+      buffer.putUint8(133);
+      writeValue(buffer, value.encode());
+    }} else if (value is PlatformSize) {
+      buffer.putUint8(134);
+      writeValue(buffer, value.encode());
+    }} else if (value is PlatformVideoRecordingSettings) {
+      buffer.putUint8(135);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return PlatformAudioDevice.decode(readValue(buffer)!);
+      case 129:
+        return PlatformCaptureFormat.decode(readValue(buffer)!);
+      case 130:
+        return PlatformExposureOffsetRange.decode(readValue(buffer)!);
+      case 131:
+        return PlatformMediaSettings.decode(readValue(buffer)!);
+      case 132:
+        return PlatformPreviewStats.decode(readValue(buffer)!);
+      case 133:
+        return PlatformRecordingStats.decode(readValue(buffer)!);
+      case 134:
+        return PlatformSize.decode(readValue(buffer)!);
+      case 135:
+        return PlatformVideoRecordingSettings.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Calls from Dart to the native cameras.
+///
+/// Cameras are keyed by the [cameraId] returned by [create].
+class CameraApi {
+  /// Constructor for [CameraApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  CameraApi({BinaryMessenger? binaryMessenger})
+      : _binaryMessenger = binaryMessenger;
+  final BinaryMessenger? _binaryMessenger;
+
+  static const MessageCodec<Object?> codec = _CameraApiCodec();
+
+  /// Returns the names of the available cameras.
+  Future<List<String?>> getAvailableCameras() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.getAvailableCameras', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as List<Object?>?)!.cast<String?>();
+    }
+  }
+
+  /// Returns the audio capture devices of the system.
+  Future<List<PlatformAudioDevice?>> getAvailableAudioDevices() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.getAvailableAudioDevices', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as List<Object?>?)!.cast<PlatformAudioDevice?>();
+    }
+  }
+
+  /// Opens the camera [cameraName] in the background, ahead of [create].
+  Future<void> prewarm(String arg_cameraName) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.prewarm', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraName]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Creates a camera with the given [settings], and returns its id.
+  Future<int> create(
+      String arg_cameraName, PlatformMediaSettings arg_settings) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.create', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraName, arg_settings]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as int?)!;
+    }
+  }
+
+  /// Starts the preview of the camera, and returns the preview size.
+  Future<PlatformSize> initialize(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.initialize', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as PlatformSize?)!;
+    }
+  }
+
+  /// Disposes the camera, if it exists.
+  Future<void> dispose(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.dispose', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Takes a picture, and returns the path of the picture file.
+  Future<String> takePicture(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.takePicture', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as String?)!;
+    }
+  }
+
+  /// Takes a picture, and returns it encoded in memory.
+  Future<Uint8List> takePictureData(int arg_cameraId,
+      PlatformPictureFormat arg_format, int? arg_quality) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.takePictureData', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_cameraId, arg_format.index, arg_quality])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as Uint8List?)!;
+    }
+  }
+
+  /// Takes [photoCount] pictures in a row, and returns their paths.
+  Future<List<String?>> takePictureBurst(
+      int arg_cameraId, int arg_photoCount) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.takePictureBurst', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_photoCount]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as List<Object?>?)!.cast<String?>();
+    }
+  }
+
+  /// Sets the clockwise rotation of the pictures taken after this call.
+  Future<void> setPictureRotation(int arg_cameraId, int arg_degrees) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setPictureRotation', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_degrees]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Starts recording a video, for at most [maxVideoDurationMs] if it is not
+  /// null.
+  Future<void> startVideoRecording(
+      int arg_cameraId,
+      int? arg_maxVideoDurationMs,
+      PlatformVideoRecordingSettings arg_settings) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.startVideoRecording', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_cameraId, arg_maxVideoDurationMs, arg_settings])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Stops recording a video, and returns the path of the video file.
+  Future<String> stopVideoRecording(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.stopVideoRecording', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as String?)!;
+    }
+  }
+
+  Future<void> pauseVideoRecording(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.pauseVideoRecording', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> resumeVideoRecording(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.resumeVideoRecording', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> pausePreview(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.pausePreview', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> resumePreview(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.resumePreview', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Starts sending frames in [format] on the image stream event channel.
+  Future<void> startImageStream(
+      int arg_cameraId, PlatformImageFormatGroup arg_format) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.startImageStream', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_format.index]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> stopImageStream(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.stopImageStream', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Acknowledges an image stream frame, so that the next one can be sent.
+  Future<void> receivedImageStreamData(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.receivedImageStreamData', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<List<PlatformCaptureFormat?>> getCaptureFormats(
+      int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.getCaptureFormats', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as List<Object?>?)!.cast<PlatformCaptureFormat?>();
+    }
+  }
+
+  Future<PlatformPreviewStats> getPreviewStats(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.getPreviewStats', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as PlatformPreviewStats?)!;
+    }
+  }
+
+  Future<PlatformRecordingStats> getRecordingStats(int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.getRecordingStats', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as PlatformRecordingStats?)!;
+    }
+  }
+
+  Future<void> setZoomLevel(int arg_cameraId, double arg_zoom) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setZoomLevel', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId, arg_zoom]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets the region of the preview shown in the texture, in fractions of the
+  /// preview size.
+  Future<void> setCropRect(int arg_cameraId, double arg_left, double arg_top,
+      double arg_width, double arg_height) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setCropRect', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(
+            <Object?>[arg_cameraId, arg_left, arg_top, arg_width, arg_height])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Rotates the preview clockwise by [degrees].
+  Future<void> setPreviewRotation(int arg_cameraId, int arg_degrees) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setPreviewRotation', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_degrees]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Limits the preview texture updates to [framesPerSecond], or removes the
+  /// limit if it is null.
+  Future<void> setPreviewFrameRate(
+      int arg_cameraId, double? arg_framesPerSecond) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setPreviewFrameRate', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_framesPerSecond]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setExposureMode(int arg_cameraId, bool arg_locked) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setExposureMode', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_locked]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setFocusMode(int arg_cameraId, bool arg_locked) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setFocusMode', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_locked]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setWhiteBalanceMode(int arg_cameraId, bool arg_locked) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setWhiteBalanceMode', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_locked]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<PlatformExposureOffsetRange> getExposureOffsetRange(
+      int arg_cameraId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.getExposureOffsetRange', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_cameraId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as PlatformExposureOffsetRange?)!;
+    }
+  }
+
+  /// Sets the exposure offset, and returns the offset applied after rounding
+  /// it to the closest supported step.
+  Future<double> setExposureOffset(int arg_cameraId, double arg_offset) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setExposureOffset', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_offset]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as double?)!;
+    }
+  }
+
+  Future<void> setFrameRateLock(int arg_cameraId, bool arg_locked) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setFrameRateLock', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_locked]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setFlashMode(
+      int arg_cameraId, PlatformFlashMode arg_mode) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setFlashMode', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_mode.index]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setPhotoCapturePriority(
+      int arg_cameraId, PlatformPhotoCapturePriority arg_priority) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.CameraApi.setPhotoCapturePriority', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_cameraId, arg_priority.index]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+}
+
+/// Events sent by the native cameras to Dart.
+///
+/// The events of all cameras share the same channels, and are keyed by the
+/// [cameraId] given on creation.
+abstract class CameraEventApi {
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  /// Called when the camera [cameraId] is about to be closed.
+  void cameraClosing(int cameraId);
+
+  /// Called when the recording of the camera [cameraId] stopped because it
+  /// reached [maxVideoDurationMs], with the recorded file at [path].
+  void videoRecorded(int cameraId, String path, int maxVideoDurationMs);
+
+  /// Called when the camera [cameraId] fails with [description].
+  void error(int cameraId, String description);
+
+  /// Called when a camera is connected to or disconnected from the system.
+  void camerasChanged();
+
+  static void setup(CameraEventApi? api, {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.CameraEventApi.cameraClosing', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.cameraClosing was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_cameraId = (args[0] as int?);
+          assert(arg_cameraId != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.cameraClosing was null, expected non-null int.');
+          api.cameraClosing(arg_cameraId!);
+          return;
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.CameraEventApi.videoRecorded', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.videoRecorded was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_cameraId = (args[0] as int?);
+          assert(arg_cameraId != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.videoRecorded was null, expected non-null int.');
+          final String? arg_path = (args[1] as String?);
+          assert(arg_path != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.videoRecorded was null, expected non-null String.');
+          final int? arg_maxVideoDurationMs = (args[2] as int?);
+          assert(arg_maxVideoDurationMs != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.videoRecorded was null, expected non-null int.');
+          api.videoRecorded(arg_cameraId!, arg_path!, arg_maxVideoDurationMs!);
+          return;
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.CameraEventApi.error', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.error was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_cameraId = (args[0] as int?);
+          assert(arg_cameraId != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.error was null, expected non-null int.');
+          final String? arg_description = (args[1] as String?);
+          assert(arg_description != null,
+              'Argument for dev.flutter.pigeon.CameraEventApi.error was null, expected non-null String.');
+          api.error(arg_cameraId!, arg_description!);
+          return;
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.CameraEventApi.camerasChanged', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          api.camerasChanged();
+          return;
+        });
+      }
+    }
+  }
+}
@@ -0,0 +1,32 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// An audio capture device on Windows.
+@immutable
+class WindowsAudioDevice {
+  /// Creates a new audio device description.
+  const WindowsAudioDevice({
+    required this.name,
+    required this.id,
+  });
+
+  /// The display name of the device.
+  final String name;
+
+  /// The endpoint ID of the device, used to select it with
+  /// `CameraWindows.createCameraWithWindowsSettings`.
+  final String id;
+
+  @override
+  bool operator ==(Object other) =>
+      other is WindowsAudioDevice && other.name == name && other.id == id;
+
+  @override
+  int get hashCode => Object.hash(name, id);
+
+  @override
+  String toString() => 'WindowsAudioDevice($name, $id)';
+}
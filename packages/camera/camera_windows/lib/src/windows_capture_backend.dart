@@ -0,0 +1,18 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// The Media Foundation API a camera is captured with on Windows.
+enum WindowsCaptureBackend {
+  /// Captures with the Media Foundation capture engine, which supports all
+  /// camera features.
+  captureEngine,
+
+  /// Reads frames with a low latency source reader, one frame at a time.
+  ///
+  /// Reduces the latency of the preview. Videos are recorded at the preview
+  /// resolution without audio, so cameras must be created with audio
+  /// disabled. Pictures are taken from preview frames, and photo bursts are
+  /// not supported.
+  sourceReader,
+}
@@ -0,0 +1,38 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// A capture format supported by a camera device on Windows.
+@immutable
+class WindowsCaptureFormat {
+  /// Creates a new capture format.
+  const WindowsCaptureFormat({
+    required this.width,
+    required this.height,
+    required this.frameRate,
+  });
+
+  /// The frame width in pixels.
+  final int width;
+
+  /// The frame height in pixels.
+  final int height;
+
+  /// The number of frames per second.
+  final double frameRate;
+
+  @override
+  bool operator ==(Object other) =>
+      other is WindowsCaptureFormat &&
+      other.width == width &&
+      other.height == height &&
+      other.frameRate == frameRate;
+
+  @override
+  int get hashCode => Object.hash(width, height, frameRate);
+
+  @override
+  String toString() => 'WindowsCaptureFormat($width x $height @ $frameRate)';
+}
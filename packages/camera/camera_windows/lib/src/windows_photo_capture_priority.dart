@@ -0,0 +1,14 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// What a camera favors when taking pictures on Windows.
+enum WindowsPhotoCapturePriority {
+  /// The driver default, which usually waits for the auto focus to converge
+  /// before taking a picture.
+  balanced,
+
+  /// Pictures are taken immediately, without waiting for the auto focus and
+  /// without a pre-flash, to shorten the shutter lag.
+  speed,
+}
@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// The image format of pictures returned in memory on Windows.
+enum WindowsPictureFormat {
+  /// JPEG, encoded with [WindowsPictureSettings.quality].
+  jpeg,
+
+  /// Lossless PNG.
+  png,
+}
+
+/// Clockwise rotations of pictures on Windows.
+enum WindowsPictureRotation {
+  /// The picture is not rotated.
+  none(0),
+
+  /// The picture is rotated by 90 degrees clockwise.
+  clockwise90(90),
+
+  /// The picture is rotated by 180 degrees.
+  clockwise180(180),
+
+  /// The picture is rotated by 90 degrees counterclockwise.
+  clockwise270(270);
+
+  const WindowsPictureRotation(this.degrees);
+
+  /// The clockwise rotation in degrees.
+  final int degrees;
+}
+
+/// Encoder settings for pictures returned in memory on Windows.
+@immutable
+class WindowsPictureSettings {
+  /// Creates a new set of picture settings.
+  const WindowsPictureSettings({
+    this.format = WindowsPictureFormat.jpeg,
+    this.quality,
+  }) : assert(quality == null || (quality >= 1 && quality <= 100));
+
+  /// The image format of the picture.
+  final WindowsPictureFormat format;
+
+  /// The JPEG quality in range 1 to 100.
+  ///
+  /// Ignored for [WindowsPictureFormat.png]. If null, a quality of 90 is
+  /// used.
+  final int? quality;
+}
@@ -0,0 +1,18 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// The pixel format the camera preview is captured in on Windows.
+enum WindowsPreviewPixelFormat {
+  /// Frames are converted to RGB32 by Media Foundation before they reach the
+  /// plugin.
+  rgb32,
+
+  /// Frames are captured in NV12 and converted to RGB while updating the
+  /// preview texture.
+  ///
+  /// Avoids the color conversion of Media Foundation for cameras that produce
+  /// NV12 natively. The conversion runs on the GPU with
+  /// [WindowsPreviewTextureMode.gpuSurface], and on the CPU otherwise.
+  nv12,
+}
@@ -0,0 +1,23 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// The rotation of the camera preview on Windows.
+enum WindowsPreviewRotation {
+  /// The preview is not rotated.
+  none(0),
+
+  /// The preview is rotated by 90 degrees clockwise.
+  clockwise90(90),
+
+  /// The preview is rotated by 180 degrees.
+  clockwise180(180),
+
+  /// The preview is rotated by 90 degrees counterclockwise.
+  clockwise270(270);
+
+  const WindowsPreviewRotation(this.degrees);
+
+  /// The clockwise rotation in degrees.
+  final int degrees;
+}
@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// Preview pipeline statistics of a camera on Windows.
+///
+/// Frame rates, latencies and conversion times are measured over the most
+/// recent frames.
+@immutable
+class WindowsPreviewStats {
+  /// Creates a new set of preview statistics.
+  const WindowsPreviewStats({
+    required this.receivedFrames,
+    required this.renderedFrames,
+    required this.droppedFrames,
+    required this.captureFrameRate,
+    required this.renderFrameRate,
+    required this.latencyP50,
+    required this.latencyP95,
+    required this.latencyP99,
+    required this.conversionTimeP50,
+    required this.conversionTimeP95,
+    required this.conversionTimeP99,
+  });
+
+  /// The number of frames delivered by the camera to the preview.
+  final int receivedFrames;
+
+  /// The number of frames read by the Flutter engine.
+  final int renderedFrames;
+
+  /// The number of frames replaced by a newer frame before the Flutter engine
+  /// read them.
+  final int droppedFrames;
+
+  /// The number of frames per second captured by the camera.
+  final double captureFrameRate;
+
+  /// The number of frames per second read by the Flutter engine.
+  final double renderFrameRate;
+
+  /// The median time from the delivery of a frame to the preview until the
+  /// Flutter engine releases it.
+  final Duration latencyP50;
+
+  /// The 95th percentile of the preview latency.
+  final Duration latencyP95;
+
+  /// The 99th percentile of the preview latency.
+  final Duration latencyP99;
+
+  /// The median time spent converting a frame into the preview texture.
+  ///
+  /// For the GPU preview surface, this is the time spent uploading and
+  /// rendering a frame. Frames the camera delivers as GPU textures are not
+  /// converted and are not included.
+  final Duration conversionTimeP50;
+
+  /// The 95th percentile of the frame conversion time.
+  final Duration conversionTimeP95;
+
+  /// The 99th percentile of the frame conversion time.
+  final Duration conversionTimeP99;
+
+  @override
+  String toString() => 'WindowsPreviewStats('
+      'receivedFrames: $receivedFrames, '
+      'renderedFrames: $renderedFrames, '
+      'droppedFrames: $droppedFrames, '
+      'captureFrameRate: $captureFrameRate, '
+      'renderFrameRate: $renderFrameRate, '
+      'latencyP50: $latencyP50, '
+      'latencyP95: $latencyP95, '
+      'latencyP99: $latencyP99, '
+      'conversionTimeP50: $conversionTimeP50, '
+      'conversionTimeP95: $conversionTimeP95, '
+      'conversionTimeP99: $conversionTimeP99)';
+}
@@ -0,0 +1,15 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// The kind of texture used to display the camera preview on Windows.
+enum WindowsPreviewTextureMode {
+  /// Frames are converted on the CPU and uploaded as a pixel buffer.
+  pixelBuffer,
+
+  /// Frames are rendered on the GPU into a shared DXGI surface.
+  ///
+  /// Falls back to [pixelBuffer] if the capture device or graphics adapter
+  /// does not support shared surfaces.
+  gpuSurface,
+}
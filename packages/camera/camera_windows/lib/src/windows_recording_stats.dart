@@ -0,0 +1,43 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// Statistics of a video recording of a camera on Windows.
+///
+/// The statistics cover the samples written to the recorded file, so time
+/// the recording was paused is left out.
+@immutable
+class WindowsRecordingStats {
+  /// Creates a new set of recording statistics.
+  const WindowsRecordingStats({
+    required this.encodedFrames,
+    required this.droppedFrames,
+    required this.duration,
+    required this.avDrift,
+  });
+
+  /// The number of encoded video frames written to the file.
+  final int encodedFrames;
+
+  /// The number of video frames missing from the file, found from gaps in
+  /// the timestamps of the written frames.
+  final int droppedFrames;
+
+  /// The duration of the recorded video.
+  final Duration duration;
+
+  /// How far the audio of the file ends after its video.
+  ///
+  /// Negative if the audio ends first, and zero for recordings without
+  /// audio.
+  final Duration avDrift;
+
+  @override
+  String toString() => 'WindowsRecordingStats('
+      'encodedFrames: $encodedFrames, '
+      'droppedFrames: $droppedFrames, '
+      'duration: $duration, '
+      'avDrift: $avDrift)';
+}
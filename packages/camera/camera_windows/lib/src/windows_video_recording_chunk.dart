@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// A chunk written to a video recording on Windows.
+///
+/// Recordings started with `WindowsVideoRecordingSettings.streamChunks` emit
+/// their chunks while they are being recorded.
+@immutable
+class WindowsVideoRecordingChunk {
+  /// Creates a new recorded chunk.
+  const WindowsVideoRecordingChunk({
+    required this.offset,
+    required this.bytes,
+  });
+
+  /// The byte offset of the chunk in the recorded file.
+  ///
+  /// Chunks are usually emitted in order. A chunk with an offset before the
+  /// end of the previous chunks replaces those bytes.
+  final int offset;
+
+  /// The written bytes.
+  final Uint8List bytes;
+
+  @override
+  String toString() =>
+      'WindowsVideoRecordingChunk(offset: $offset, length: ${bytes.length})';
+}
@@ -0,0 +1,118 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// The codec used to encode video recordings on Windows.
+enum WindowsVideoCodec {
+  /// H.264 (AVC). Supported by all Windows versions.
+  h264,
+
+  /// H.265 (HEVC).
+  ///
+  /// Falls back to [h264] if no HEVC encoder is installed.
+  hevc,
+}
+
+/// The rate control mode of the video encoder on Windows.
+enum WindowsVideoRateControlMode {
+  /// Keeps the bitrate constant at [WindowsVideoRecordingSettings.bitrate].
+  constantBitrate,
+
+  /// Varies the bitrate, averaging [WindowsVideoRecordingSettings.bitrate].
+  variableBitrate,
+
+  /// Varies the bitrate to reach [WindowsVideoRecordingSettings.quality].
+  quality,
+}
+
+/// Encoder settings for video recordings on Windows.
+///
+/// Settings that are null are left to the encoder defaults.
+@immutable
+class WindowsVideoRecordingSettings {
+  /// Creates a new set of video recording settings.
+  const WindowsVideoRecordingSettings({
+    this.videoCodec = WindowsVideoCodec.h264,
+    this.preferHardwareEncoder = false,
+    this.bitrate,
+    this.rateControlMode,
+    this.quality,
+    this.keyframeInterval,
+    this.streamChunks = false,
+    this.audioSampleRate,
+    this.audioChannels,
+    this.audioBitrate,
+    this.proxyHeight,
+    this.proxyBitrate,
+  })  : assert(bitrate == null || bitrate > 0),
+        assert(quality == null || (quality >= 1 && quality <= 100)),
+        assert(keyframeInterval == null || keyframeInterval > 0),
+        assert(audioSampleRate == null || audioSampleRate > 0),
+        assert(audioChannels == null || audioChannels > 0),
+        assert(audioBitrate == null || audioBitrate > 0),
+        assert(proxyHeight == null || proxyHeight > 0),
+        assert(proxyBitrate == null || proxyBitrate > 0);
+
+  /// The codec of the recorded video.
+  final WindowsVideoCodec videoCodec;
+
+  /// Whether [WindowsVideoCodec.hevc] recordings require a hardware encoder.
+  ///
+  /// If true and no hardware HEVC encoder is available, the video is encoded
+  /// with [WindowsVideoCodec.h264] instead. Hardware encoders are always used
+  /// when available.
+  final bool preferHardwareEncoder;
+
+  /// The target bitrate in bits per second.
+  final int? bitrate;
+
+  /// The rate control mode of the encoder.
+  final WindowsVideoRateControlMode? rateControlMode;
+
+  /// The target quality in range 1 to 100, used with
+  /// [WindowsVideoRateControlMode.quality].
+  final int? quality;
+
+  /// The number of frames between two keyframes.
+  final int? keyframeInterval;
+
+  /// Whether the recording is written as fragmented MP4 and emitted in chunks
+  /// through `CameraWindows.onVideoRecordingChunk` while it is recorded.
+  ///
+  /// The recorded file is written as well.
+  final bool streamChunks;
+
+  /// The sample rate of the recorded AAC audio in Hz.
+  ///
+  /// The Windows AAC encoder supports 44100 and 48000 Hz. Recording fails if
+  /// the encoder does not support the sample rate.
+  final int? audioSampleRate;
+
+  /// The number of channels of the recorded AAC audio.
+  ///
+  /// Recording fails if the encoder does not support the number of channels.
+  final int? audioChannels;
+
+  /// The target bitrate of the recorded AAC audio in bits per second.
+  ///
+  /// The closest bitrate supported by the encoder is used, which is one of
+  /// 96, 128, 160 and 192 kbps for the Windows AAC encoder.
+  final int? audioBitrate;
+
+  /// The height of a low resolution proxy recorded alongside the recording,
+  /// or null for no proxy.
+  ///
+  /// The proxy is encoded from the same captured frames as the recording, so
+  /// both are available when the recording stops. It keeps the aspect ratio
+  /// and audio of the recording, and is written next to the recording with
+  /// `_proxy` appended to its file name, for example `VideoCapture_1_proxy.mp4`
+  /// for `VideoCapture_1.mp4`.
+  final int? proxyHeight;
+
+  /// The target bitrate of the proxy video in bits per second.
+  ///
+  /// If null, the encoder default for the proxy resolution is used.
+  final int? proxyBitrate;
+}
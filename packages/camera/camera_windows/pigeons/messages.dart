@@ -0,0 +1,360 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:pigeon/pigeon.dart';
+
+@ConfigurePigeon(PigeonOptions(
+  dartOut: 'lib/src/messages.g.dart',
+  cppOptions: CppOptions(namespace: 'camera_windows'),
+  cppHeaderOut: 'windows/messages.g.h',
+  cppSourceOut: 'windows/messages.g.cpp',
+  copyrightHeader: 'pigeons/copyright.txt',
+))
+
+/// Pigeon version of ResolutionPreset.
+enum PlatformResolutionPreset {
+  low,
+  medium,
+  high,
+  veryHigh,
+  ultraHigh,
+  max,
+}
+
+/// Pigeon version of WindowsPreviewTextureMode.
+enum PlatformPreviewTextureMode {
+  pixelBuffer,
+  gpuSurface,
+}
+
+/// Pigeon version of WindowsPreviewPixelFormat.
+enum PlatformPreviewPixelFormat {
+  rgb32,
+  nv12,
+}
+
+/// Pigeon version of WindowsCaptureBackend.
+enum PlatformCaptureBackend {
+  captureEngine,
+  sourceReader,
+}
+
+/// Pigeon version of the image stream formats, which are NV12 for yuv420
+/// and BGRA for every other ImageFormatGroup.
+enum PlatformImageFormatGroup {
+  bgra8888,
+  yuv420,
+}
+
+/// Pigeon version of WindowsVideoCodec.
+enum PlatformVideoCodec {
+  h264,
+  hevc,
+}
+
+/// Pigeon version of WindowsVideoRateControlMode.
+enum PlatformRateControlMode {
+  constantBitrate,
+  variableBitrate,
+  quality,
+}
+
+/// Pigeon version of WindowsPictureFormat.
+enum PlatformPictureFormat {
+  jpeg,
+  png,
+}
+
+/// Pigeon version of FlashMode.
+enum PlatformFlashMode {
+  off,
+  autoFlash,
+  always,
+  torch,
+}
+
+/// Pigeon version of WindowsPhotoCapturePriority.
+enum PlatformPhotoCapturePriority {
+  balanced,
+  speed,
+}
+
+/// The settings a camera is created with.
+class PlatformMediaSettings {
+  PlatformMediaSettings({
+    required this.resolutionPreset,
+    required this.enableAudio,
+    required this.audioDeviceId,
+    required this.previewTextureMode,
+    required this.adaptivePreview,
+    required this.targetFrameRate,
+    required this.previewPixelFormat,
+    required this.zeroShutterLag,
+    required this.previewStats,
+    required this.previewMaxFrameRate,
+    required this.captureBackend,
+  });
+
+  /// The resolution to capture at, or null for the highest resolution.
+  final PlatformResolutionPreset? resolutionPreset;
+  final bool enableAudio;
+  final String? audioDeviceId;
+  final PlatformPreviewTextureMode previewTextureMode;
+  final bool adaptivePreview;
+  final int? targetFrameRate;
+  final PlatformPreviewPixelFormat previewPixelFormat;
+  final bool zeroShutterLag;
+  final bool previewStats;
+  final int? previewMaxFrameRate;
+  final PlatformCaptureBackend captureBackend;
+}
+
+/// The encoder settings a video is recorded with.
+class PlatformVideoRecordingSettings {
+  PlatformVideoRecordingSettings({
+    required this.videoCodec,
+    required this.preferHardwareEncoder,
+    required this.bitrate,
+    required this.rateControlMode,
+    required this.quality,
+    required this.keyframeInterval,
+    required this.streamChunks,
+    required this.audioSampleRate,
+    required this.audioChannels,
+    required this.audioBitrate,
+    required this.proxyHeight,
+    required this.proxyBitrate,
+  });
+
+  final PlatformVideoCodec videoCodec;
+  final bool preferHardwareEncoder;
+  final int? bitrate;
+  final PlatformRateControlMode? rateControlMode;
+  final int? quality;
+  final int? keyframeInterval;
+  final bool streamChunks;
+  final int? audioSampleRate;
+  final int? audioChannels;
+  final int? audioBitrate;
+  final int? proxyHeight;
+  final int? proxyBitrate;
+}
+
+/// A size of the camera preview, in pixels.
+class PlatformSize {
+  PlatformSize({required this.width, required this.height});
+
+  final double width;
+  final double height;
+}
+
+/// Pigeon version of WindowsAudioDevice.
+class PlatformAudioDevice {
+  PlatformAudioDevice({required this.name, required this.id});
+
+  final String name;
+  final String id;
+}
+
+/// Pigeon version of WindowsCaptureFormat.
+class PlatformCaptureFormat {
+  PlatformCaptureFormat({
+    required this.width,
+    required this.height,
+    required this.frameRate,
+  });
+
+  final int width;
+  final int height;
+  final double frameRate;
+}
+
+/// Pigeon version of WindowsPreviewStats, with durations in microseconds.
+class PlatformPreviewStats {
+  PlatformPreviewStats({
+    required this.receivedFrames,
+    required this.renderedFrames,
+    required this.droppedFrames,
+    required this.captureFrameRate,
+    required this.renderFrameRate,
+    required this.latencyP50,
+    required this.latencyP95,
+    required this.latencyP99,
+    required this.conversionTimeP50,
+    required this.conversionTimeP95,
+    required this.conversionTimeP99,
+  });
+
+  final int receivedFrames;
+  final int renderedFrames;
+  final int droppedFrames;
+  final double captureFrameRate;
+  final double renderFrameRate;
+  final int latencyP50;
+  final int latencyP95;
+  final int latencyP99;
+  final int conversionTimeP50;
+  final int conversionTimeP95;
+  final int conversionTimeP99;
+}
+
+/// Pigeon version of WindowsRecordingStats, with durations in microseconds.
+class PlatformRecordingStats {
+  PlatformRecordingStats({
+    required this.encodedFrames,
+    required this.droppedFrames,
+    required this.duration,
+    required this.avDrift,
+  });
+
+  final int encodedFrames;
+  final int droppedFrames;
+  final int duration;
+  final int avDrift;
+}
+
+/// The exposure offsets supported by a camera.
+class PlatformExposureOffsetRange {
+  PlatformExposureOffsetRange({
+    required this.min,
+    required this.max,
+    required this.step,
+  });
+
+  final double min;
+  final double max;
+  final double step;
+}
+
+/// Calls from Dart to the native cameras.
+///
+/// Cameras are keyed by the [cameraId] returned by [create].
+@HostApi()
+abstract class CameraApi {
+  /// Returns the names of the available cameras.
+  @async
+  List<String?> getAvailableCameras();
+
+  /// Returns the audio capture devices of the system.
+  List<PlatformAudioDevice?> getAvailableAudioDevices();
+
+  /// Opens the camera [cameraName] in the background, ahead of [create].
+  void prewarm(String cameraName);
+
+  /// Creates a camera with the given [settings], and returns its id.
+  @async
+  int create(String cameraName, PlatformMediaSettings settings);
+
+  /// Starts the preview of the camera, and returns the preview size.
+  @async
+  PlatformSize initialize(int cameraId);
+
+  /// Disposes the camera, if it exists.
+  void dispose(int cameraId);
+
+  /// Takes a picture, and returns the path of the picture file.
+  @async
+  String takePicture(int cameraId);
+
+  /// Takes a picture, and returns it encoded in memory.
+  @async
+  Uint8List takePictureData(
+      int cameraId, PlatformPictureFormat format, int? quality);
+
+  /// Takes [photoCount] pictures in a row, and returns their paths.
+  @async
+  List<String?> takePictureBurst(int cameraId, int photoCount);
+
+  /// Sets the clockwise rotation of the pictures taken after this call.
+  void setPictureRotation(int cameraId, int degrees);
+
+  /// Starts recording a video, for at most [maxVideoDurationMs] if it is not
+  /// null.
+  @async
+  void startVideoRecording(int cameraId, int? maxVideoDurationMs,
+      PlatformVideoRecordingSettings settings);
+
+  /// Stops recording a video, and returns the path of the video file.
+  @async
+  String stopVideoRecording(int cameraId);
+
+  @async
+  void pauseVideoRecording(int cameraId);
+
+  @async
+  void resumeVideoRecording(int cameraId);
+
+  @async
+  void pausePreview(int cameraId);
+
+  @async
+  void resumePreview(int cameraId);
+
+  /// Starts sending frames in [format] on the image stream event channel.
+  void startImageStream(int cameraId, PlatformImageFormatGroup format);
+
+  void stopImageStream(int cameraId);
+
+  /// Acknowledges an image stream frame, so that the next one can be sent.
+  void receivedImageStreamData(int cameraId);
+
+  List<PlatformCaptureFormat?> getCaptureFormats(int cameraId);
+
+  PlatformPreviewStats getPreviewStats(int cameraId);
+
+  PlatformRecordingStats getRecordingStats(int cameraId);
+
+  void setZoomLevel(int cameraId, double zoom);
+
+  /// Sets the region of the preview shown in the texture, in fractions of the
+  /// preview size.
+  void setCropRect(
+      int cameraId, double left, double top, double width, double height);
+
+  /// Rotates the preview clockwise by [degrees].
+  void setPreviewRotation(int cameraId, int degrees);
+
+  /// Limits the preview texture updates to [framesPerSecond], or removes the
+  /// limit if it is null.
+  void setPreviewFrameRate(int cameraId, double? framesPerSecond);
+
+  void setExposureMode(int cameraId, bool locked);
+
+  void setFocusMode(int cameraId, bool locked);
+
+  void setWhiteBalanceMode(int cameraId, bool locked);
+
+  PlatformExposureOffsetRange getExposureOffsetRange(int cameraId);
+
+  /// Sets the exposure offset, and returns the offset applied after rounding
+  /// it to the closest supported step.
+  double setExposureOffset(int cameraId, double offset);
+
+  void setFrameRateLock(int cameraId, bool locked);
+
+  void setFlashMode(int cameraId, PlatformFlashMode mode);
+
+  void setPhotoCapturePriority(
+      int cameraId, PlatformPhotoCapturePriority priority);
+}
+
+/// Events sent by the native cameras to Dart.
+///
+/// The events of all cameras share the same channels, and are keyed by the
+/// [cameraId] given on creation.
+@FlutterApi()
+abstract class CameraEventApi {
+  /// Called when the camera [cameraId] is about to be closed.
+  void cameraClosing(int cameraId);
+
+  /// Called when the recording of the camera [cameraId] stopped because it
+  /// reached [maxVideoDurationMs], with the recorded file at [path].
+  void videoRecorded(int cameraId, String path, int maxVideoDurationMs);
+
+  /// Called when the camera [cameraId] fails with [description].
+  void error(int cameraId, String description);
+
+  /// Called when a camera is connected to or disconnected from the system.
+  void camerasChanged();
+}
@@ -2,18 +2,28 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:async';
+
 import 'package:async/async.dart';
 import 'package:camera_platform_interface/camera_platform_interface.dart';
 import 'package:camera_windows/camera_windows.dart';
+import 'package:camera_windows/src/messages.g.dart';
 import 'package:flutter/services.dart';
 import 'package:flutter/widgets.dart';
 import 'package:flutter_test/flutter_test.dart';
+import './utils/camera_api_mock.dart';
 import './utils/method_channel_mock.dart';
 
 void main() {
-  const String pluginChannelName = 'plugins.flutter.io/camera_windows';
   TestWidgetsFlutterBinding.ensureInitialized();
 
+  // Sends a [CameraEventApi] message, as the native cameras do.
+  Future<void> sendCameraEvent(String method, List<Object?>? arguments) async {
+    await TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+        .handlePlatformMessage('dev.flutter.pigeon.CameraEventApi.$method',
+            CameraEventApi.codec.encodeMessage(arguments), (_) {});
+  }
+
   group('$CameraWindows()', () {
     test('registered instance', () {
       CameraWindows.registerWith();
@@ -23,14 +33,8 @@ void main() {
     group('Creation, Initialization & Disposal Tests', () {
       test('Should send creation data and receive back a camera id', () async {
         // Arrange
-        final MethodChannelMock cameraMockChannel = MethodChannelMock(
-            channelName: pluginChannelName,
-            methods: <String, dynamic>{
-              'create': <String, dynamic>{
-                'cameraId': 1,
-                'imageFormatGroup': 'unknown',
-              }
-            });
+        final CameraApiMock cameraMockChannel =
+            CameraApiMock(methods: <String, Object?>{'create': 1});
         final CameraWindows plugin = CameraWindows();
 
         // Act
@@ -46,28 +50,106 @@ void main() {
         expect(cameraMockChannel.log, <Matcher>[
           isMethodCall(
             'create',
-            arguments: <String, Object?>{
-              'cameraName': 'Test',
-              'resolutionPreset': 'high',
-              'enableAudio': false
-            },
+            arguments: <Object?>[
+              'Test',
+              PlatformMediaSettings(
+                resolutionPreset: PlatformResolutionPreset.high,
+                enableAudio: false,
+                previewTextureMode: PlatformPreviewTextureMode.pixelBuffer,
+                adaptivePreview: false,
+                previewPixelFormat: PlatformPreviewPixelFormat.rgb32,
+                zeroShutterLag: false,
+                previewStats: false,
+                captureBackend: PlatformCaptureBackend.captureEngine,
+              ).encode(),
+            ],
           ),
         ]);
         expect(cameraId, 1);
       });
 
+      test('Should send Windows settings on creation', () async {
+        // Arrange
+        final CameraApiMock cameraMockChannel =
+            CameraApiMock(methods: <String, Object?>{'create': 1});
+        final CameraWindows plugin = CameraWindows();
+
+        // Act
+        final int cameraId = await plugin.createCameraWithWindowsSettings(
+          const CameraDescription(
+              name: 'Test',
+              lensDirection: CameraLensDirection.front,
+              sensorOrientation: 0),
+          ResolutionPreset.high,
+          previewTextureMode: WindowsPreviewTextureMode.gpuSurface,
+          adaptivePreview: true,
+          targetFrameRate: 30,
+          previewPixelFormat: WindowsPreviewPixelFormat.nv12,
+          zeroShutterLag: true,
+          previewStats: true,
+          previewMaxFrameRate: 30,
+          audioDeviceId: 'audio-device',
+          captureBackend: WindowsCaptureBackend.sourceReader,
+        );
+
+        // Assert
+        expect(cameraMockChannel.log, <Matcher>[
+          isMethodCall(
+            'create',
+            arguments: <Object?>[
+              'Test',
+              PlatformMediaSettings(
+                resolutionPreset: PlatformResolutionPreset.high,
+                enableAudio: false,
+                audioDeviceId: 'audio-device',
+                previewTextureMode: PlatformPreviewTextureMode.gpuSurface,
+                adaptivePreview: true,
+                targetFrameRate: 30,
+                previewPixelFormat: PlatformPreviewPixelFormat.nv12,
+                zeroShutterLag: true,
+                previewStats: true,
+                previewMaxFrameRate: 30,
+                captureBackend: PlatformCaptureBackend.sourceReader,
+              ).encode(),
+            ],
+          ),
+        ]);
+        expect(cameraId, 1);
+      });
+
+      test('Should send prewarm data', () async {
+        // Arrange
+        final CameraApiMock cameraMockChannel =
+            CameraApiMock(methods: <String, Object?>{'prewarm': null});
+        final CameraWindows plugin = CameraWindows();
+
+        // Act
+        await plugin.prewarmCamera(
+          const CameraDescription(
+              name: 'Test',
+              lensDirection: CameraLensDirection.front,
+              sensorOrientation: 0),
+        );
+
+        // Assert
+        expect(cameraMockChannel.log, <Matcher>[
+          isMethodCall(
+            'prewarm',
+            arguments: <Object?>['Test'],
+          ),
+        ]);
+      });
+
       test(
           'Should throw CameraException when create throws a PlatformException',
           () {
         // Arrange
-        MethodChannelMock(
-            channelName: pluginChannelName,
-            methods: <String, dynamic>{
-              'create': PlatformException(
-                code: 'TESTING_ERROR_CODE',
-                message: 'Mock error message used during testing.',
-              )
-            });
+        CameraApiMock(methods: <String, Object?>{
+          'create': PlatformException(
+            code: 'TESTING_ERROR_CODE',
+            message: 'Mock error message used during testing.',
+          )
+        });
         final CameraWindows plugin = CameraWindows();
 
         // Act
@@ -94,9 +176,8 @@ void main() {
         'Should throw CameraException when initialize throws a PlatformException',
         () {
           // Arrange
-          MethodChannelMock(
-            channelName: pluginChannelName,
-            methods: <String, dynamic>{
+          CameraApiMock(
+            methods: <String, Object?>{
               'initialize': PlatformException(
                 code: 'TESTING_ERROR_CODE',
                 message: 'Mock error message used during testing.',
@@ -124,18 +205,11 @@ void main() {
 
       test('Should send initialization data', () async {
         // Arrange
-        final MethodChannelMock cameraMockChannel = MethodChannelMock(
-            channelName: pluginChannelName,
-            methods: <String, dynamic>{
-              'create': <String, dynamic>{
-                'cameraId': 1,
-                'imageFormatGroup': 'unknown',
-              },
-              'initialize': <String, dynamic>{
-                'previewWidth': 1920.toDouble(),
-                'previewHeight': 1080.toDouble()
-              },
-            });
+        final CameraApiMock cameraMockChannel =
+            CameraApiMock(methods: <String, Object?>{
+          'create': 1,
+          'initialize': PlatformSize(width: 1920, height: 1080),
+        });
         final CameraWindows plugin = CameraWindows();
         final int cameraId = await plugin.createCamera(
           const CameraDescription(
@@ -155,23 +229,19 @@ void main() {
           anything,
           isMethodCall(
             'initialize',
-            arguments: <String, Object?>{'cameraId': 1},
+            arguments: <Object?>[1],
           ),
         ]);
       });
 
       test('Should send a disposal call on dispose', () async {
         // Arrange
-        final MethodChannelMock cameraMockChannel = MethodChannelMock(
-            channelName: pluginChannelName,
-            methods: <String, dynamic>{
-              'create': <String, dynamic>{'cameraId': 1},
-              'initialize': <String, dynamic>{
-                'previewWidth': 1920.toDouble(),
-                'previewHeight': 1080.toDouble()
-              },
-              'dispose': <String, dynamic>{'cameraId': 1}
-            });
+        final CameraApiMock cameraMockChannel =
+            CameraApiMock(methods: <String, Object?>{
+          'create': 1,
+          'initialize': PlatformSize(width: 1920, height: 1080),
+          'dispose': null,
+        });
 
         final CameraWindows plugin = CameraWindows();
         final int cameraId = await plugin.createCamera(
@@ -194,7 +264,7 @@ void main() {
           anything,
           isMethodCall(
             'dispose',
-            arguments: <String, Object?>{'cameraId': 1},
+            arguments: <Object?>[1],
           ),
         ]);
       });
@@ -204,14 +274,10 @@ void main() {
       late CameraWindows plugin;
       late int cameraId;
       setUp(() async {
-        MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{
-            'create': <String, dynamic>{'cameraId': 1},
-            'initialize': <String, dynamic>{
-              'previewWidth': 1920.toDouble(),
-              'previewHeight': 1080.toDouble()
-            },
+        CameraApiMock(
+          methods: <String, Object?>{
+            'create': 1,
+            'initialize': PlatformSize(width: 1920, height: 1080),
           },
         );
 
@@ -236,12 +302,9 @@ void main() {
 
         // Emit test events
         final CameraClosingEvent event = CameraClosingEvent(cameraId);
-        await plugin.handleCameraMethodCall(
-            MethodCall('camera_closing', event.toJson()), cameraId);
-        await plugin.handleCameraMethodCall(
-            MethodCall('camera_closing', event.toJson()), cameraId);
-        await plugin.handleCameraMethodCall(
-            MethodCall('camera_closing', event.toJson()), cameraId);
+        await sendCameraEvent('cameraClosing', <Object?>[cameraId]);
+        await sendCameraEvent('cameraClosing', <Object?>[cameraId]);
+        await sendCameraEvent('cameraClosing', <Object?>[cameraId]);
 
         // Assert
         expect(await streamQueue.next, event);
@@ -262,12 +325,12 @@ void main() {
         // Emit test events
         final CameraErrorEvent event =
             CameraErrorEvent(cameraId, 'Error Description');
-        await plugin.handleCameraMethodCall(
-            MethodCall('error', event.toJson()), cameraId);
-        await plugin.handleCameraMethodCall(
-            MethodCall('error', event.toJson()), cameraId);
-        await plugin.handleCameraMethodCall(
-            MethodCall('error', event.toJson()), cameraId);
+        await sendCameraEvent(
+            'error', <Object?>[cameraId, 'Error Description']);
+        await sendCameraEvent(
+            'error', <Object?>[cameraId, 'Error Description']);
+        await sendCameraEvent(
+            'error', <Object?>[cameraId, 'Error Description']);
 
         // Assert
         expect(await streamQueue.next, event);
@@ -277,6 +340,59 @@ void main() {
         // Clean up
         await streamQueue.cancel();
       });
+
+      test('Should receive video recorded events', () async {
+        // Act
+        final StreamQueue<VideoRecordedEvent> streamQueue =
+            StreamQueue<VideoRecordedEvent>(
+                plugin.onVideoRecordedEvent(cameraId));
+
+        // Emit test events
+        await sendCameraEvent(
+            'videoRecorded', <Object?>[cameraId, 'C:\\video.mp4', 1000]);
+
+        // Assert
+        final VideoRecordedEvent event = await streamQueue.next;
+        expect(event.cameraId, cameraId);
+        expect(event.file.path, 'C:\\video.mp4');
+        expect(event.maxVideoDuration, const Duration(seconds: 1));
+
+        // Clean up
+        await streamQueue.cancel();
+      });
+
+      test('Should only receive events of the given camera', () async {
+        // Act
+        final StreamQueue<CameraClosingEvent> streamQueue =
+            StreamQueue<CameraClosingEvent>(plugin.onCameraClosing(cameraId));
+
+        // Emit test events
+        await sendCameraEvent('cameraClosing', <Object?>[cameraId + 1]);
+        await sendCameraEvent('cameraClosing', <Object?>[cameraId]);
+
+        // Assert
+        expect(await streamQueue.next, CameraClosingEvent(cameraId));
+
+        // Clean up
+        await streamQueue.cancel();
+      });
+
+      test('Should receive cameras changed events', () async {
+        // Act
+        final StreamQueue<void> streamQueue =
+            StreamQueue<void>(plugin.onCamerasChanged());
+
+        // Emit test events
+        await sendCameraEvent('camerasChanged', null);
+        await sendCameraEvent('camerasChanged', null);
+
+        // Assert
+        await expectLater(streamQueue.next, completes);
+        await expectLater(streamQueue.next, completes);
+
+        // Clean up
+        await streamQueue.cancel();
+      });
     });
 
     group('Function Tests', () {
@@ -284,14 +400,10 @@ void main() {
       late int cameraId;
 
       setUp(() async {
-        MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{
-            'create': <String, dynamic>{'cameraId': 1},
-            'initialize': <String, dynamic>{
-              'previewWidth': 1920.toDouble(),
-              'previewHeight': 1080.toDouble()
-            },
+        CameraApiMock(
+          methods: <String, Object?>{
+            'create': 1,
+            'initialize': PlatformSize(width: 1920, height: 1080),
           },
         );
         plugin = CameraWindows();
@@ -309,21 +421,10 @@ void main() {
       test('Should fetch CameraDescription instances for available cameras',
           () async {
         // Arrange
-        final List<dynamic> returnData = <dynamic>[
-          <String, dynamic>{
-            'name': 'Test 1',
-            'lensFacing': 'front',
-            'sensorOrientation': 1
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'getAvailableCameras': <String?>['Test 1', 'Test 2'],
           },
-          <String, dynamic>{
-            'name': 'Test 2',
-            'lensFacing': 'back',
-            'sensorOrientation': 2
-          }
-        ];
-        final MethodChannelMock channel = MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{'availableCameras': returnData},
         );
 
         // Act
@@ -331,34 +432,32 @@ void main() {
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('availableCameras', arguments: null),
-        ]);
-        expect(cameras.length, returnData.length);
-        for (int i = 0; i < returnData.length; i++) {
-          final Map<String, Object?> typedData =
-              (returnData[i] as Map<dynamic, dynamic>).cast<String, Object?>();
-          final CameraDescription cameraDescription = CameraDescription(
-            name: typedData['name']! as String,
-            lensDirection: plugin
-                .parseCameraLensDirection(typedData['lensFacing']! as String),
-            sensorOrientation: typedData['sensorOrientation']! as int,
-          );
-          expect(cameras[i], cameraDescription);
-        }
+          isMethodCall('getAvailableCameras', arguments: null),
+        ]);
+        expect(cameras, const <CameraDescription>[
+          CameraDescription(
+            name: 'Test 1',
+            lensDirection: CameraLensDirection.front,
+            sensorOrientation: 0,
+          ),
+          CameraDescription(
+            name: 'Test 2',
+            lensDirection: CameraLensDirection.front,
+            sensorOrientation: 0,
+          ),
+        ]);
       });
 
       test(
           'Should throw CameraException when availableCameras throws a PlatformException',
           () {
         // Arrange
-        MethodChannelMock(
-            channelName: pluginChannelName,
-            methods: <String, dynamic>{
-              'availableCameras': PlatformException(
-                code: 'TESTING_ERROR_CODE',
-                message: 'Mock error message used during testing.',
-              )
-            });
+        CameraApiMock(methods: <String, Object?>{
+          'getAvailableCameras': PlatformException(
+            code: 'TESTING_ERROR_CODE',
+            message: 'Mock error message used during testing.',
+          )
+        });
 
         // Act
         expect(
@@ -373,45 +472,103 @@ void main() {
         );
       });
 
+      test('Should fetch audio devices', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'getAvailableAudioDevices': <PlatformAudioDevice?>[
+              PlatformAudioDevice(name: 'Microphone', id: 'audio-device'),
+            ],
+          },
+        );
+
+        // Act
+        final List<WindowsAudioDevice> devices =
+            await plugin.availableAudioDevices();
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('getAvailableAudioDevices', arguments: null),
+        ]);
+        expect(devices, const <WindowsAudioDevice>[
+          WindowsAudioDevice(name: 'Microphone', id: 'audio-device'),
+        ]);
+      });
+
       test('Should take a picture and return an XFile instance', () async {
         // Arrange
-        final MethodChannelMock channel = MethodChannelMock(
-            channelName: pluginChannelName,
-            methods: <String, dynamic>{'takePicture': '/test/path.jpg'});
+        final CameraApiMock channel = CameraApiMock(
+            methods: <String, Object?>{'takePicture': '/test/path.jpg'});
 
         // Act
         final XFile file = await plugin.takePicture(cameraId);
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('takePicture', arguments: <String, Object?>{
-            'cameraId': cameraId,
-          }),
+          isMethodCall('takePicture', arguments: <Object?>[cameraId]),
         ]);
         expect(file.path, '/test/path.jpg');
       });
 
-      test('Should prepare for video recording', () async {
+      test('Should take a picture burst and return XFile instances',
+          () async {
         // Arrange
-        final MethodChannelMock channel = MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{'prepareForVideoRecording': null},
-        );
+        final CameraApiMock channel = CameraApiMock(methods: <String, Object?>{
+          'takePictureBurst': <String?>['/test/path_1.jpg', '/test/path_2.jpg']
+        });
 
         // Act
-        await plugin.prepareForVideoRecording();
+        final List<XFile> files = await plugin.takePictureBurst(cameraId, 2);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('takePictureBurst', arguments: <Object?>[cameraId, 2]),
+        ]);
+        expect(files.map((XFile file) => file.path),
+            <String>['/test/path_1.jpg', '/test/path_2.jpg']);
+      });
+
+      test('Should take a picture in memory', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(methods: <String, Object?>{
+          'takePictureData': Uint8List.fromList(<int>[0x89, 0x50])
+        });
+
+        // Act
+        final Uint8List data = await plugin.takePictureData(
+          cameraId,
+          settings: const WindowsPictureSettings(
+            format: WindowsPictureFormat.png,
+          ),
+        );
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('prepareForVideoRecording', arguments: null),
+          isMethodCall('takePictureData', arguments: <Object?>[
+            cameraId,
+            PlatformPictureFormat.png.index,
+            null,
+          ]),
         ]);
+        expect(data, <int>[0x89, 0x50]);
+      });
+
+      test('Should prepare for video recording without a host call', () async {
+        // Arrange
+        final CameraApiMock channel =
+            CameraApiMock(methods: <String, Object?>{});
+
+        // Act
+        await plugin.prepareForVideoRecording();
+
+        // Assert
+        expect(channel.log, isEmpty);
       });
 
       test('Should start recording a video', () async {
         // Arrange
-        final MethodChannelMock channel = MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{'startVideoRecording': null},
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'startVideoRecording': null},
         );
 
         // Act
@@ -419,19 +576,23 @@ void main() {
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('startVideoRecording', arguments: <String, Object?>{
-            'cameraId': cameraId,
-            'maxVideoDuration': null,
-          }),
+          isMethodCall('startVideoRecording', arguments: <Object?>[
+            cameraId,
+            null,
+            PlatformVideoRecordingSettings(
+              videoCodec: PlatformVideoCodec.h264,
+              preferHardwareEncoder: false,
+              streamChunks: false,
+            ).encode(),
+          ]),
         ]);
       });
 
       test('Should pass maxVideoDuration when starting recording a video',
           () async {
         // Arrange
-        final MethodChannelMock channel = MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{'startVideoRecording': null},
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'startVideoRecording': null},
         );
 
         // Act
@@ -442,10 +603,61 @@ void main() {
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('startVideoRecording', arguments: <String, Object?>{
-            'cameraId': cameraId,
-            'maxVideoDuration': 10000
-          }),
+          isMethodCall('startVideoRecording', arguments: <Object?>[
+            cameraId,
+            10000,
+            PlatformVideoRecordingSettings(
+              videoCodec: PlatformVideoCodec.h264,
+              preferHardwareEncoder: false,
+              streamChunks: false,
+            ).encode(),
+          ]),
+        ]);
+      });
+
+      test('Should pass Windows settings when starting recording a video',
+          () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'startVideoRecording': null},
+        );
+
+        // Act
+        await plugin.startVideoRecordingWithWindowsSettings(
+          cameraId,
+          settings: const WindowsVideoRecordingSettings(
+            videoCodec: WindowsVideoCodec.hevc,
+            preferHardwareEncoder: true,
+            bitrate: 4000000,
+            rateControlMode: WindowsVideoRateControlMode.constantBitrate,
+            keyframeInterval: 60,
+            audioSampleRate: 48000,
+            audioChannels: 1,
+            audioBitrate: 128000,
+            proxyHeight: 360,
+            proxyBitrate: 800000,
+          ),
+        );
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('startVideoRecording', arguments: <Object?>[
+            cameraId,
+            null,
+            PlatformVideoRecordingSettings(
+              videoCodec: PlatformVideoCodec.hevc,
+              preferHardwareEncoder: true,
+              bitrate: 4000000,
+              rateControlMode: PlatformRateControlMode.constantBitrate,
+              keyframeInterval: 60,
+              streamChunks: false,
+              audioSampleRate: 48000,
+              audioChannels: 1,
+              audioBitrate: 128000,
+              proxyHeight: 360,
+              proxyBitrate: 800000,
+            ).encode(),
+          ]),
         ]);
       });
 
@@ -460,9 +672,8 @@ void main() {
 
       test('Should stop a video recording and return the file', () async {
         // Arrange
-        final MethodChannelMock channel = MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{'stopVideoRecording': '/test/path.mp4'},
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'stopVideoRecording': '/test/path.mp4'},
         );
 
         // Act
@@ -470,46 +681,162 @@ void main() {
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('stopVideoRecording', arguments: <String, Object?>{
-            'cameraId': cameraId,
-          }),
+          isMethodCall('stopVideoRecording', arguments: <Object?>[cameraId]),
         ]);
         expect(file.path, '/test/path.mp4');
       });
 
-      test('Should throw UnsupportedError when pause video recording is called',
-          () async {
+      test('Should start a recording that streams chunks', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'startVideoRecording': null},
+        );
+
         // Act
-        expect(
-          () => plugin.pauseVideoRecording(cameraId),
-          throwsA(isA<UnsupportedError>()),
+        await plugin.startVideoRecordingWithWindowsSettings(
+          cameraId,
+          settings: const WindowsVideoRecordingSettings(streamChunks: true),
         );
+
+        // Assert
+        final List<Object?> arguments =
+            channel.log.single.arguments as List<Object?>;
+        final PlatformVideoRecordingSettings settings =
+            PlatformVideoRecordingSettings.decode(arguments[2]!);
+        expect(settings.streamChunks, isTrue);
       });
 
-      test(
-          'Should throw UnsupportedError when resume video recording is called',
-          () async {
+      test('Should emit recorded chunks', () async {
+        // Arrange
+        final String channelName =
+            'plugins.flutter.io/camera_windows/recordChunks/$cameraId';
+        MethodChannelMock(
+          channelName: channelName,
+          methods: <String, dynamic>{'listen': null, 'cancel': null},
+        );
+        final List<WindowsVideoRecordingChunk> chunks =
+            <WindowsVideoRecordingChunk>[];
+
         // Act
-        expect(
-          () => plugin.resumeVideoRecording(cameraId),
-          throwsA(isA<UnsupportedError>()),
+        final StreamSubscription<WindowsVideoRecordingChunk> subscription =
+            plugin.onVideoRecordingChunk(cameraId).listen(chunks.add);
+        await Future<void>.delayed(Duration.zero);
+        await TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+            .handlePlatformMessage(
+          channelName,
+          const StandardMethodCodec().encodeSuccessEnvelope(<String, Object?>{
+            'offset': 16,
+            'bytes': Uint8List.fromList(<int>[1, 2, 3]),
+          }),
+          (ByteData? data) {},
+        );
+
+        // Assert
+        expect(chunks, hasLength(1));
+        expect(chunks.single.offset, 16);
+        expect(chunks.single.bytes, <int>[1, 2, 3]);
+
+        await subscription.cancel();
+      });
+
+      test('Should pause a video recording', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'pauseVideoRecording': null},
         );
+
+        // Act
+        await plugin.pauseVideoRecording(cameraId);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('pauseVideoRecording', arguments: <Object?>[cameraId]),
+        ]);
       });
 
-      test('Should throw UnimplementedError when flash mode is set', () async {
+      test('Should resume a video recording', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'resumeVideoRecording': null},
+        );
+
         // Act
-        expect(
-          () => plugin.setFlashMode(cameraId, FlashMode.torch),
-          throwsA(isA<UnimplementedError>()),
+        await plugin.resumeVideoRecording(cameraId);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('resumeVideoRecording', arguments: <Object?>[cameraId]),
+        ]);
+      });
+
+      test('Should set the flash mode', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setFlashMode': null},
+        );
+
+        // Act
+        await plugin.setFlashMode(cameraId, FlashMode.torch);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setFlashMode',
+              arguments: <Object?>[cameraId, PlatformFlashMode.torch.index]),
+        ]);
+      });
+
+      test('Should set the photo capture priority', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setPhotoCapturePriority': null},
         );
+
+        // Act
+        await plugin.setPhotoCapturePriority(
+            cameraId, WindowsPhotoCapturePriority.speed);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setPhotoCapturePriority', arguments: <Object?>[
+            cameraId,
+            PlatformPhotoCapturePriority.speed.index,
+          ]),
+        ]);
       });
 
-      test('Should throw UnimplementedError when exposure mode is set',
+      test('Should set the exposure mode', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setExposureMode': null},
+        );
+
+        // Act
+        await plugin.setExposureMode(cameraId, ExposureMode.locked);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setExposureMode', arguments: <Object?>[cameraId, true]),
+        ]);
+      });
+
+      test(
+          'Should throw CameraException when exposure mode is not supported',
           () async {
+        // Arrange
+        CameraApiMock(
+          methods: <String, Object?>{
+            'setExposureMode': PlatformException(
+              code: 'camera_error',
+              message: 'Camera does not support setting exposure mode',
+            ),
+          },
+        );
+
         // Act
         expect(
           () => plugin.setExposureMode(cameraId, ExposureMode.auto),
-          throwsA(isA<UnimplementedError>()),
+          throwsA(isA<CameraException>()
+              .having((CameraException e) => e.code, 'code', 'camera_error')),
         );
       });
 
@@ -522,25 +849,43 @@ void main() {
         );
       });
 
-      test('Should get the min exposure offset', () async {
+      test('Should get the exposure offset range', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'getExposureOffsetRange':
+                PlatformExposureOffsetRange(min: -2.0, max: 2.0, step: 0.5),
+          },
+        );
+
         // Act
         final double minExposureOffset =
             await plugin.getMinExposureOffset(cameraId);
-
-        // Assert
-        expect(minExposureOffset, 0.0);
-      });
-
-      test('Should get the max exposure offset', () async {
-        // Act
         final double maxExposureOffset =
             await plugin.getMaxExposureOffset(cameraId);
+        final double stepSize =
+            await plugin.getExposureOffsetStepSize(cameraId);
 
         // Assert
-        expect(maxExposureOffset, 0.0);
+        expect(minExposureOffset, -2.0);
+        expect(maxExposureOffset, 2.0);
+        expect(stepSize, 0.5);
+        final Matcher rangeCall = isMethodCall('getExposureOffsetRange',
+            arguments: <Object?>[cameraId]);
+        expect(channel.log, <Matcher>[rangeCall, rangeCall, rangeCall]);
       });
 
-      test('Should get the exposure offset step size', () async {
+      test(
+          'Should get a step size of 1.0 when exposure offset is not supported',
+          () async {
+        // Arrange
+        CameraApiMock(
+          methods: <String, Object?>{
+            'getExposureOffsetRange':
+                PlatformExposureOffsetRange(min: 0.0, max: 0.0, step: 0.0),
+          },
+        );
+
         // Act
         final double stepSize =
             await plugin.getExposureOffsetStepSize(cameraId);
@@ -549,30 +894,94 @@ void main() {
         expect(stepSize, 1.0);
       });
 
-      test('Should throw UnimplementedError when exposure offset is set',
-          () async {
+      test('Should set the exposure offset', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setExposureOffset': 0.5},
+        );
+
         // Act
-        expect(
-          () => plugin.setExposureOffset(cameraId, 0.5),
-          throwsA(isA<UnimplementedError>()),
+        final double appliedOffset =
+            await plugin.setExposureOffset(cameraId, 0.6);
+
+        // Assert
+        expect(appliedOffset, 0.5);
+        expect(channel.log, <Matcher>[
+          isMethodCall('setExposureOffset',
+              arguments: <Object?>[cameraId, 0.6]),
+        ]);
+      });
+
+      test('Should set the focus mode', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setFocusMode': null},
         );
+
+        // Act
+        await plugin.setFocusMode(cameraId, FocusMode.auto);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setFocusMode', arguments: <Object?>[cameraId, false]),
+        ]);
       });
 
-      test('Should throw UnimplementedError when focus mode is set', () async {
+      test('Should throw UnsupportedError when focus point is set', () async {
         // Act
         expect(
-          () => plugin.setFocusMode(cameraId, FocusMode.auto),
-          throwsA(isA<UnimplementedError>()),
+          () => plugin.setFocusPoint(cameraId, null),
+          throwsA(isA<UnsupportedError>()),
         );
       });
 
-      test('Should throw UnsupportedError when exposure point is set',
-          () async {
+      test('Should lock the white balance', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setWhiteBalanceMode': null},
+        );
+
         // Act
-        expect(
-          () => plugin.setFocusMode(cameraId, FocusMode.auto),
-          throwsA(isA<UnsupportedError>()),
+        await plugin.setWhiteBalanceLocked(cameraId, true);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setWhiteBalanceMode',
+              arguments: <Object?>[cameraId, true]),
+        ]);
+      });
+
+      test('Should lock the frame rate', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setFrameRateLock': null},
         );
+
+        // Act
+        await plugin.setFrameRateLocked(cameraId, true);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setFrameRateLock',
+              arguments: <Object?>[cameraId, true]),
+        ]);
+      });
+
+      test('Should set the picture rotation', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setPictureRotation': null},
+        );
+
+        // Act
+        await plugin.setPictureRotation(
+            cameraId, WindowsPictureRotation.clockwise90);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setPictureRotation',
+              arguments: <Object?>[cameraId, 90]),
+        ]);
       });
 
       test('Should build a texture widget as preview widget', () async {
@@ -584,21 +993,12 @@ void main() {
         expect((widget as Texture).textureId, cameraId);
       });
 
-      test('Should throw UnimplementedError when handling unknown method', () {
-        final CameraWindows plugin = CameraWindows();
-
-        expect(
-            () => plugin.handleCameraMethodCall(
-                const MethodCall('unknown_method'), 1),
-            throwsA(isA<UnimplementedError>()));
-      });
-
       test('Should get the max zoom level', () async {
         // Act
         final double maxZoomLevel = await plugin.getMaxZoomLevel(cameraId);
 
         // Assert
-        expect(maxZoomLevel, 1.0);
+        expect(maxZoomLevel, 4.0);
       });
 
       test('Should get the min zoom level', () async {
@@ -609,11 +1009,143 @@ void main() {
         expect(maxZoomLevel, 1.0);
       });
 
-      test('Should throw UnimplementedError when zoom level is set', () async {
+      test('Should set the zoom level', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setZoomLevel': null},
+        );
+
+        // Act
+        await plugin.setZoomLevel(cameraId, 2.0);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setZoomLevel', arguments: <Object?>[cameraId, 2.0]),
+        ]);
+      });
+
+      test('Should throw CameraException when zoom level is out of bounds',
+          () async {
         // Act
         expect(
-          () => plugin.setZoomLevel(cameraId, 2.0),
-          throwsA(isA<UnimplementedError>()),
+          () => plugin.setZoomLevel(cameraId, 5.0),
+          throwsA(isA<CameraException>()
+              .having((CameraException e) => e.code, 'code', 'ZOOM_ERROR')),
+        );
+      });
+
+      test('Should set the crop rect', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setCropRect': null},
+        );
+
+        // Act
+        await plugin.setCropRect(
+            cameraId, const Rect.fromLTWH(0.25, 0.125, 0.5, 0.75));
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setCropRect',
+              arguments: <Object?>[cameraId, 0.25, 0.125, 0.5, 0.75]),
+        ]);
+      });
+
+      test('Should throw CameraException when crop rect is rejected',
+          () async {
+        // Arrange
+        CameraApiMock(
+          methods: <String, Object?>{
+            'setCropRect': PlatformException(
+              code: 'argument_error',
+              message: 'Crop rectangle must be within the preview',
+            ),
+          },
+        );
+
+        // Act
+        expect(
+          () => plugin.setCropRect(
+              cameraId, const Rect.fromLTWH(0.75, 0.0, 0.5, 1.0)),
+          throwsA(isA<CameraException>()
+              .having((CameraException e) => e.code, 'code', 'argument_error')),
+        );
+      });
+
+      test('Should set the preview rotation', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setPreviewRotation': null},
+        );
+
+        // Act
+        await plugin.setPreviewRotation(
+            cameraId, WindowsPreviewRotation.clockwise270);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setPreviewRotation',
+              arguments: <Object?>[cameraId, 270]),
+        ]);
+      });
+
+      test('Should throw CameraException when preview rotation is rejected',
+          () async {
+        // Arrange
+        CameraApiMock(
+          methods: <String, Object?>{
+            'setPreviewRotation': PlatformException(
+              code: 'camera_error',
+              message: 'Preview rotation not supported by the GPU surface',
+            ),
+          },
+        );
+
+        // Act
+        expect(
+          () => plugin.setPreviewRotation(
+              cameraId, WindowsPreviewRotation.clockwise90),
+          throwsA(isA<CameraException>()
+              .having((CameraException e) => e.code, 'code', 'camera_error')),
+        );
+      });
+
+      test('Should set the preview frame rate', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'setPreviewFrameRate': null},
+        );
+
+        // Act
+        await plugin.setPreviewFrameRate(cameraId, 0);
+        await plugin.setPreviewFrameRate(cameraId, null);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('setPreviewFrameRate',
+              arguments: <Object?>[cameraId, 0.0]),
+          isMethodCall('setPreviewFrameRate',
+              arguments: <Object?>[cameraId, null]),
+        ]);
+      });
+
+      test('Should throw CameraException when preview frame rate is rejected',
+          () async {
+        // Arrange
+        CameraApiMock(
+          methods: <String, Object?>{
+            'setPreviewFrameRate': PlatformException(
+              code: 'camera_error',
+              message: 'Camera not created',
+            ),
+          },
+        );
+
+        // Act
+        expect(
+          () => plugin.setPreviewFrameRate(cameraId, 5),
+          throwsA(isA<CameraException>()
+              .having((CameraException e) => e.code, 'code', 'camera_error')),
         );
       });
 
@@ -622,7 +1154,8 @@ void main() {
           () async {
         // Act
         expect(
-          () => plugin.setZoomLevel(cameraId, 2.0),
+          () => plugin.lockCaptureOrientation(
+              cameraId, DeviceOrientation.portraitUp),
           throwsA(isA<UnimplementedError>()),
         );
       });
@@ -639,9 +1172,8 @@ void main() {
 
       test('Should pause the camera preview', () async {
         // Arrange
-        final MethodChannelMock channel = MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{'pausePreview': null},
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'pausePreview': null},
         );
 
         // Act
@@ -649,16 +1181,14 @@ void main() {
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('pausePreview',
-              arguments: <String, Object?>{'cameraId': cameraId}),
+          isMethodCall('pausePreview', arguments: <Object?>[cameraId]),
         ]);
       });
 
       test('Should resume the camera preview', () async {
         // Arrange
-        final MethodChannelMock channel = MethodChannelMock(
-          channelName: pluginChannelName,
-          methods: <String, dynamic>{'resumePreview': null},
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{'resumePreview': null},
         );
 
         // Act
@@ -666,8 +1196,158 @@ void main() {
 
         // Assert
         expect(channel.log, <Matcher>[
-          isMethodCall('resumePreview',
-              arguments: <String, Object?>{'cameraId': cameraId}),
+          isMethodCall('resumePreview', arguments: <Object?>[cameraId]),
+        ]);
+      });
+
+      test('Should fetch capture formats of the camera', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'getCaptureFormats': <PlatformCaptureFormat?>[
+              PlatformCaptureFormat(width: 1280, height: 720, frameRate: 30.0),
+              PlatformCaptureFormat(width: 640, height: 480, frameRate: 15.0),
+            ],
+          },
+        );
+
+        // Act
+        final List<WindowsCaptureFormat> formats =
+            await plugin.getCaptureFormats(cameraId);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('getCaptureFormats', arguments: <Object?>[cameraId]),
+        ]);
+        expect(formats, const <WindowsCaptureFormat>[
+          WindowsCaptureFormat(width: 1280, height: 720, frameRate: 30),
+          WindowsCaptureFormat(width: 640, height: 480, frameRate: 15),
+        ]);
+      });
+
+      test('Should get preview stats', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'getPreviewStats': PlatformPreviewStats(
+              receivedFrames: 30,
+              renderedFrames: 28,
+              droppedFrames: 2,
+              captureFrameRate: 30.0,
+              renderFrameRate: 29.0,
+              latencyP50: 4000,
+              latencyP95: 9000,
+              latencyP99: 12000,
+              conversionTimeP50: 1500,
+              conversionTimeP95: 2500,
+              conversionTimeP99: 3000,
+            ),
+          },
+        );
+
+        // Act
+        final WindowsPreviewStats stats =
+            await plugin.getPreviewStats(cameraId);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('getPreviewStats', arguments: <Object?>[cameraId]),
+        ]);
+        expect(stats.receivedFrames, 30);
+        expect(stats.droppedFrames, 2);
+        expect(stats.renderFrameRate, 29.0);
+        expect(stats.latencyP50, const Duration(milliseconds: 4));
+        expect(stats.latencyP99, const Duration(milliseconds: 12));
+        expect(stats.conversionTimeP50, const Duration(microseconds: 1500));
+        expect(stats.conversionTimeP99, const Duration(milliseconds: 3));
+      });
+
+      test('Should get recording stats', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'getRecordingStats': PlatformRecordingStats(
+              encodedFrames: 300,
+              droppedFrames: 3,
+              duration: 10000000,
+              avDrift: -20000,
+            ),
+          },
+        );
+
+        // Act
+        final WindowsRecordingStats stats =
+            await plugin.getRecordingStats(cameraId);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('getRecordingStats', arguments: <Object?>[cameraId]),
+        ]);
+        expect(stats.encodedFrames, 300);
+        expect(stats.droppedFrames, 3);
+        expect(stats.duration, const Duration(seconds: 10));
+        expect(stats.avDrift, const Duration(milliseconds: -20));
+      });
+
+      test('Should start streaming', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'startImageStream': null,
+            'stopImageStream': null,
+          },
+        );
+        MethodChannelMock(
+          channelName:
+              'plugins.flutter.io/camera_windows/imageStream/$cameraId',
+          methods: <String, dynamic>{'listen': null, 'cancel': null},
+        );
+
+        // Act
+        final StreamSubscription<CameraImageData> subscription = plugin
+            .onStreamedFrameAvailable(cameraId)
+            .listen((CameraImageData imageData) {});
+        await Future<void>.delayed(Duration.zero);
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('startImageStream', arguments: <Object?>[
+            cameraId,
+            PlatformImageFormatGroup.bgra8888.index,
+          ]),
+        ]);
+
+        await subscription.cancel();
+      });
+
+      test('Should stop streaming', () async {
+        // Arrange
+        final CameraApiMock channel = CameraApiMock(
+          methods: <String, Object?>{
+            'startImageStream': null,
+            'stopImageStream': null,
+          },
+        );
+        MethodChannelMock(
+          channelName:
+              'plugins.flutter.io/camera_windows/imageStream/$cameraId',
+          methods: <String, dynamic>{'listen': null, 'cancel': null},
+        );
+
+        // Act
+        final StreamSubscription<CameraImageData> subscription = plugin
+            .onStreamedFrameAvailable(cameraId)
+            .listen((CameraImageData imageData) {});
+        await Future<void>.delayed(Duration.zero);
+        await subscription.cancel();
+
+        // Assert
+        expect(channel.log, <Matcher>[
+          isMethodCall('startImageStream', arguments: <Object?>[
+            cameraId,
+            PlatformImageFormatGroup.bgra8888.index,
+          ]),
+          isMethodCall('stopImageStream', arguments: <Object?>[cameraId]),
         ]);
       });
     });
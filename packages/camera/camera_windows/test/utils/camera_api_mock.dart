@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:camera_windows/src/messages.g.dart';
+import 'package:flutter/services.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+/// A mock of the native side of [CameraApi] for use in tests.
+class CameraApiMock {
+  /// Creates a new instance that handles the given [CameraApi] methods.
+  ///
+  /// Each method replies with the value mapped to its name, or with an error
+  /// if that value is a [PlatformException]. If a delay is specified, replies
+  /// are sent after the delay has elapsed.
+  CameraApiMock({
+    this.delay,
+    required this.methods,
+  }) {
+    for (final String method in methods.keys) {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockDecodedMessageHandler<Object?>(
+        BasicMessageChannel<Object?>(
+            'dev.flutter.pigeon.CameraApi.$method', CameraApi.codec),
+        (Object? message) => _handler(method, message as List<Object?>?),
+      );
+    }
+  }
+
+  final Duration? delay;
+  final Map<String, Object?> methods;
+
+  /// The calls received, with the arguments in [CameraApi] parameter order.
+  ///
+  /// Settings objects are logged encoded so that they can be compared.
+  final List<MethodCall> log = <MethodCall>[];
+
+  Future<Object?> _handler(String method, List<Object?>? arguments) async {
+    log.add(MethodCall(method, arguments?.map(_encodeArgument).toList()));
+
+    return Future<Object?>.delayed(delay ?? Duration.zero, () {
+      final Object? result = methods[method];
+      if (result is PlatformException) {
+        return <Object?>[result.code, result.message, result.details];
+      }
+
+      return <Object?>[result];
+    });
+  }
+
+  static Object? _encodeArgument(Object? argument) {
+    if (argument is PlatformMediaSettings) {
+      return argument.encode();
+    }
+    if (argument is PlatformVideoRecordingSettings) {
+      return argument.encode();
+    }
+    return argument;
+  }
+}
+
+/// This allows a value of type T or T? to be treated as a value of type T?.
+///
+/// We use this so that APIs that have become non-nullable can still be used
+/// with `!` and `?` on the stable branch.
+T? _ambiguate<T>(T? value) => value;
@@ -0,0 +1,145 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "audio_media_type_cache.h"
+
+#include <mfapi.h>
+#include <mfidl.h>
+
+#include <cassert>
+#include <utility>
+
+namespace camera_windows {
+
+namespace {
+
+template <class Q>
+HRESULT GetCollectionObject(IMFCollection* pCollection, DWORD index,
+                            Q** ppObj) {
+  ComPtr<IUnknown> pUnk;
+  HRESULT hr = pCollection->GetElement(index, pUnk.GetAddressOf());
+  if (FAILED(hr)) {
+    return hr;
+  }
+  return pUnk->QueryInterface(IID_PPV_ARGS(ppObj));
+}
+
+// Returns the absolute difference of two unsigned values.
+uint32_t GetDistance(uint32_t a, uint32_t b) { return a > b ? a - b : b - a; }
+
+}  // namespace
+
+// static
+AacMediaTypeCache& AacMediaTypeCache::GetInstance() {
+  static AacMediaTypeCache instance;
+  return instance;
+}
+
+std::shared_ptr<const AacMediaTypeCache::MediaTypeList>
+AacMediaTypeCache::GetMediaTypes() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (media_types_) {
+      return media_types_;
+    }
+  }
+
+  // Enumerates outside of the lock, as this can take a long time. If two
+  // recordings start concurrently, the first result wins.
+  MediaTypeList media_types;
+  if (FAILED(EnumerateMediaTypes(&media_types)) || media_types.empty()) {
+    // Failed enumerations are not cached, so that they are retried.
+    return std::make_shared<const MediaTypeList>();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!media_types_) {
+    media_types_ =
+        std::make_shared<const MediaTypeList>(std::move(media_types));
+  }
+  return media_types_;
+}
+
+void AacMediaTypeCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  media_types_ = nullptr;
+}
+
+HRESULT AacMediaTypeCache::EnumerateMediaTypes(MediaTypeList* media_types) {
+  assert(media_types);
+
+  ComPtr<IMFAttributes> audio_output_attributes;
+  HRESULT hr = MFCreateAttributes(&audio_output_attributes, 1);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Enumerates only low latency audio outputs.
+  hr = audio_output_attributes->SetUINT32(MF_LOW_LATENCY, TRUE);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  DWORD mft_flags = (MFT_ENUM_FLAG_ALL & (~MFT_ENUM_FLAG_FIELDOFUSE)) |
+                    MFT_ENUM_FLAG_SORTANDFILTER;
+
+  ComPtr<IMFCollection> available_output_types;
+  hr = MFTranscodeGetAudioOutputAvailableTypes(
+      MFAudioFormat_AAC, mft_flags, audio_output_attributes.Get(),
+      available_output_types.GetAddressOf());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  DWORD mt_count = 0;
+  hr = available_output_types->GetElementCount(&mt_count);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  for (DWORD i = 0; i < mt_count; i++) {
+    AacMediaType aac_media_type;
+    if (FAILED(GetCollectionObject(available_output_types.Get(), i,
+                                   aac_media_type.media_type.GetAddressOf()))) {
+      continue;
+    }
+
+    IMFMediaType* media_type = aac_media_type.media_type.Get();
+    aac_media_type.sample_rate =
+        MFGetAttributeUINT32(media_type, MF_MT_AUDIO_SAMPLES_PER_SECOND, 0);
+    aac_media_type.channels =
+        MFGetAttributeUINT32(media_type, MF_MT_AUDIO_NUM_CHANNELS, 0);
+    aac_media_type.bitrate =
+        MFGetAttributeUINT32(media_type, MF_MT_AUDIO_AVG_BYTES_PER_SECOND, 0) *
+        8;
+    media_types->push_back(std::move(aac_media_type));
+  }
+
+  return S_OK;
+}
+
+const AacMediaType* FindBestAacMediaType(
+    const AacMediaTypeCache::MediaTypeList& media_types, uint32_t sample_rate,
+    uint32_t channels, uint32_t bitrate) {
+  const AacMediaType* best = nullptr;
+  uint32_t best_distance = 0;
+
+  for (const AacMediaType& media_type : media_types) {
+    if ((sample_rate > 0 && media_type.sample_rate != sample_rate) ||
+        (channels > 0 && media_type.channels != channels)) {
+      continue;
+    }
+
+    uint32_t distance =
+        bitrate > 0 ? GetDistance(media_type.bitrate, bitrate) : 0;
+    if (!best || distance < best_distance) {
+      best = &media_type;
+      best_distance = distance;
+    }
+  }
+
+  return best;
+}
+
+}  // namespace camera_windows
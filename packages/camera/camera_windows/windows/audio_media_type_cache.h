@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_AUDIO_MEDIA_TYPE_CACHE_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_AUDIO_MEDIA_TYPE_CACHE_H_
+
+#include <mfapi.h>
+#include <mfidl.h>
+#include <wrl/client.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+// An AAC output type of the audio encoder.
+struct AacMediaType {
+  // The media type as returned by the transcoder. Shared between all users of
+  // the cache, so it must not be modified.
+  ComPtr<IMFMediaType> media_type;
+  uint32_t sample_rate = 0;
+  uint32_t channels = 0;
+  // Average bitrate in bits per second.
+  uint32_t bitrate = 0;
+};
+
+// Process-wide cache of the AAC output types of the audio encoder.
+//
+// |MFTranscodeGetAudioOutputAvailableTypes| enumerates and activates the
+// installed audio encoders, which is slow enough to delay the start of a
+// recording. The types are enumerated once and reused by every recording.
+class AacMediaTypeCache {
+ public:
+  using MediaTypeList = std::vector<AacMediaType>;
+
+  // Returns the process-wide cache instance.
+  static AacMediaTypeCache& GetInstance();
+
+  AacMediaTypeCache() = default;
+  virtual ~AacMediaTypeCache() = default;
+
+  // Prevent copying.
+  AacMediaTypeCache(AacMediaTypeCache const&) = delete;
+  AacMediaTypeCache& operator=(AacMediaTypeCache const&) = delete;
+
+  // Returns the low latency AAC output types of the audio encoder, in the
+  // order of preference of the transcoder.
+  //
+  // The types are enumerated on the first call. A failed enumeration is not
+  // cached, so that it is retried by the next call. Returns an empty list if
+  // no type could be enumerated.
+  std::shared_ptr<const MediaTypeList> GetMediaTypes();
+
+  // Removes the cached media types.
+  void Clear();
+
+ protected:
+  // Enumerates the AAC output types. Virtual for testing purposes.
+  virtual HRESULT EnumerateMediaTypes(MediaTypeList* media_types);
+
+ private:
+  std::mutex mutex_;
+  std::shared_ptr<const MediaTypeList> media_types_;
+};
+
+// Returns the best AAC type of |media_types|, or nullptr if none fits.
+//
+// Zero values accept any value. Types with a different sample rate or number
+// of channels are skipped, and the remaining types are ranked by the distance
+// of their bitrate to |bitrate|. Ties keep the order of |media_types|.
+const AacMediaType* FindBestAacMediaType(
+    const AacMediaTypeCache::MediaTypeList& media_types, uint32_t sample_rate,
+    uint32_t channels, uint32_t bitrate);
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_AUDIO_MEDIA_TYPE_CACHE_H_
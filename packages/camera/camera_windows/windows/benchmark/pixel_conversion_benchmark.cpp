@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/preset_frame_sizes.h"
+#include "pixel_conversion.h"
+
+namespace camera_windows {
+
+namespace {
+
+void BM_ConvertRGB32ToRGBA(benchmark::State& state, PixelConversionPath path,
+                           uint32_t width, uint32_t height, bool mirror) {
+  if (!IsPixelConversionPathSupported(path)) {
+    state.SkipWithError("Conversion path not supported by this CPU");
+    return;
+  }
+
+  const size_t frame_size = static_cast<size_t>(width) * height * 4;
+  std::vector<uint8_t> source(frame_size, 0x80);
+  std::vector<uint8_t> dest(frame_size);
+
+  for (auto _ : state) {
+    ConvertRGB32ToRGBA(path, source.data(), dest.data(), width, height,
+                       mirror);
+    benchmark::DoNotOptimize(dest.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(frame_size));
+}
+
+// Registers a benchmark for every conversion path, preset and mirror state.
+int RegisterConversionBenchmarks() {
+  const std::pair<const char*, PixelConversionPath> paths[] = {
+      {"scalar", PixelConversionPath::kScalar},
+      {"ssse3", PixelConversionPath::kSSSE3},
+      {"avx2", PixelConversionPath::kAVX2},
+  };
+
+  for (const auto& preset : kPresetFrameSizes) {
+    for (const auto& path : paths) {
+      for (bool mirror : {false, true}) {
+        std::string name = std::string("ConvertRGB32ToRGBA/") + preset.name +
+                           "/" + path.first + (mirror ? "/mirror" : "");
+        benchmark::RegisterBenchmark(name.c_str(), BM_ConvertRGB32ToRGBA,
+                                     path.second, preset.width, preset.height,
+                                     mirror);
+      }
+    }
+  }
+  return 0;
+}
+
+const int kConversionBenchmarksRegistered = RegisterConversionBenchmarks();
+
+}  // namespace
+
+}  // namespace camera_windows
@@ -0,0 +1,27 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_BENCHMARK_PRESET_FRAME_SIZES_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_BENCHMARK_PRESET_FRAME_SIZES_H_
+
+#include <cstdint>
+
+namespace camera_windows {
+
+// Frame sizes matching each ResolutionPreset.
+struct PresetFrameSize {
+  const char* name;
+  uint32_t width;
+  uint32_t height;
+};
+
+inline constexpr PresetFrameSize kPresetFrameSizes[] = {
+    {"low", 320, 240},        {"medium", 720, 480},
+    {"high", 1280, 720},      {"veryHigh", 1920, 1080},
+    {"ultraHigh", 4096, 2160},
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_BENCHMARK_PRESET_FRAME_SIZES_H_
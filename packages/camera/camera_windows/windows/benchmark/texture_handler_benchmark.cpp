@@ -0,0 +1,271 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <benchmark/benchmark.h>
+#include <flutter/texture_registrar.h>
+#include <gmock/gmock.h>
+#include <windows.h>
+#include <wrl/client.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "benchmark/preset_frame_sizes.h"
+#include "capture_engine_listener.h"
+#include "pixel_conversion.h"
+#include "test/mocks.h"
+#include "texture_handler.h"
+
+namespace camera_windows {
+
+using Microsoft::WRL::ComPtr;
+using ::testing::NiceMock;
+
+namespace {
+
+// Frame rate at which samples are replayed through the capture engine
+// listener.
+constexpr int kReplayFrameRate = 30;
+
+// Number of replayed samples per benchmark, two seconds at
+// |kReplayFrameRate|.
+constexpr int kReplayFrameCount = 60;
+
+// Returns the size of a tightly packed frame in the given format.
+size_t GetFrameSize(PreviewPixelFormat format, uint32_t width,
+                    uint32_t height) {
+  if (format == PreviewPixelFormat::kNV12) {
+    return static_cast<size_t>(GetNV12UVPlaneRowSize(width)) *
+           (height + GetNV12UVPlaneHeight(height));
+  }
+  return static_cast<size_t>(width) * height * 4;
+}
+
+// A texture handler with a registered pixel buffer texture.
+class PreviewTexture {
+ public:
+  PreviewTexture(PreviewPixelFormat format, uint32_t width, uint32_t height,
+                 bool mirror)
+      : texture_handler_(
+            std::make_unique<TextureHandler>(&texture_registrar_)) {
+    texture_handler_->SetPixelFormat(format);
+    texture_handler_->SetMirrorPreviewState(mirror);
+    texture_handler_->RegisterTexture();
+    texture_handler_->UpdateTextureSize(width, height);
+  }
+
+  TextureHandler* texture_handler() { return texture_handler_.get(); }
+
+  // Reads the latest frame like the raster thread, via
+  // |TextureHandler::ConvertPixelBufferForFlutter|, and releases it.
+  bool Render(uint32_t width, uint32_t height) {
+    auto texture = std::get_if<flutter::PixelBufferTexture>(
+        texture_registrar_.texture_);
+    if (!texture) {
+      return false;
+    }
+    const FlutterDesktopPixelBuffer* buffer =
+        texture->CopyPixelBuffer(width, height);
+    if (!buffer) {
+      return false;
+    }
+    benchmark::DoNotOptimize(buffer->buffer);
+    buffer->release_callback(buffer->release_context);
+    return true;
+  }
+
+ private:
+  NiceMock<test::MockTextureRegistrar> texture_registrar_;
+  std::unique_ptr<TextureHandler> texture_handler_;
+};
+
+// Forwards samples of a |CaptureEngineListener| to a texture handler, like a
+// previewing capture controller.
+class PreviewObserver : public CaptureEngineObserver {
+ public:
+  explicit PreviewObserver(TextureHandler* texture_handler)
+      : texture_handler_(texture_handler) {}
+
+  bool IsReadyForSample() const override { return true; }
+  void OnEvent(IMFMediaEvent*) override {}
+  void OnSynchronizedEvent(IMFMediaEvent*) override {}
+  bool UpdateBuffer(const uint8_t* data, uint32_t data_length,
+                    int32_t stride) override {
+    return texture_handler_->UpdateBuffer(data, data_length, stride);
+  }
+  bool UpdateTexture(ID3D11Texture2D*, UINT) override { return false; }
+  void UpdateCaptureTime(uint64_t) override {}
+
+ private:
+  TextureHandler* texture_handler_;
+};
+
+void BM_UpdateBuffer(benchmark::State& state, PreviewPixelFormat format,
+                     uint32_t width, uint32_t height, bool mirror) {
+  PreviewTexture texture(format, width, height, mirror);
+  const size_t frame_size = GetFrameSize(format, width, height);
+  std::vector<uint8_t> frame(frame_size, 0x80);
+
+  for (auto _ : state) {
+    if (!texture.texture_handler()->UpdateBuffer(
+            frame.data(), static_cast<uint32_t>(frame.size()), 0)) {
+      state.SkipWithError("UpdateBuffer failed");
+      break;
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(frame_size));
+}
+
+// Measures a full frame hand-off: conversion on the capture thread and the
+// triple buffer swap when Flutter reads the texture.
+void BM_UpdateBufferAndRender(benchmark::State& state,
+                              PreviewPixelFormat format, uint32_t width,
+                              uint32_t height, bool mirror) {
+  PreviewTexture texture(format, width, height, mirror);
+  const size_t frame_size = GetFrameSize(format, width, height);
+  std::vector<uint8_t> frame(frame_size, 0x80);
+
+  for (auto _ : state) {
+    if (!texture.texture_handler()->UpdateBuffer(
+            frame.data(), static_cast<uint32_t>(frame.size()), 0) ||
+        !texture.Render(width, height)) {
+      state.SkipWithError("Frame was not rendered");
+      break;
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(frame_size));
+}
+
+// Replays samples through |CaptureEngineListener::OnSample| at
+// |kReplayFrameRate|, so that frames are processed with the cache state of a
+// running preview rather than in a tight loop. Only the sample processing
+// and rendering time is measured.
+void BM_ReplayPreviewSamples(benchmark::State& state,
+                             PreviewPixelFormat format, uint32_t width,
+                             uint32_t height, bool mirror) {
+  PreviewTexture texture(format, width, height, mirror);
+  PreviewObserver observer(texture.texture_handler());
+  ComPtr<CaptureEngineListener> listener =
+      new CaptureEngineListener(&observer);
+  ComPtr<test::MockCapturePreviewSink> preview_sink =
+      new test::MockCapturePreviewSink();
+  preview_sink->sample_callback_ = listener.Get();
+
+  std::vector<uint8_t> frame(GetFrameSize(format, width, height), 0x80);
+  const auto frame_interval =
+      std::chrono::microseconds(1000000 / kReplayFrameRate);
+  auto next_frame_time = std::chrono::steady_clock::now();
+
+  for (auto _ : state) {
+    std::this_thread::sleep_until(next_frame_time);
+    next_frame_time += frame_interval;
+
+    const auto start = std::chrono::steady_clock::now();
+    preview_sink->SendFakeSample(frame.data(),
+                                 static_cast<uint32_t>(frame.size()));
+    const bool rendered = texture.Render(width, height);
+    const auto end = std::chrono::steady_clock::now();
+
+    if (!rendered) {
+      state.SkipWithError("Frame was not rendered");
+      break;
+    }
+    state.SetIterationTime(
+        std::chrono::duration<double>(end - start).count());
+  }
+
+  preview_sink->sample_callback_ = nullptr;
+}
+
+// Replays samples split across several buffers, which are copied into a
+// pooled frame buffer before conversion. Fails if any sample after the first
+// one allocates a frame buffer.
+void BM_ReplayMultipleBufferSamples(benchmark::State& state,
+                                    PreviewPixelFormat format, uint32_t width,
+                                    uint32_t height, bool mirror) {
+  PreviewTexture texture(format, width, height, mirror);
+  PreviewObserver observer(texture.texture_handler());
+  ComPtr<CaptureEngineListener> listener =
+      new CaptureEngineListener(&observer);
+  ComPtr<test::MockCapturePreviewSink> preview_sink =
+      new test::MockCapturePreviewSink();
+  preview_sink->sample_callback_ = listener.Get();
+
+  std::vector<uint8_t> frame(GetFrameSize(format, width, height), 0x80);
+  const uint32_t frame_size = static_cast<uint32_t>(frame.size());
+
+  // The first sample fills the pool.
+  preview_sink->SendFakeMultipleBufferSample(frame.data(), frame_size, 2);
+  const uint64_t allocation_count =
+      listener->GetFrameBufferPool().GetAllocationCount();
+
+  for (auto _ : state) {
+    preview_sink->SendFakeMultipleBufferSample(frame.data(), frame_size, 2);
+    if (!texture.Render(width, height)) {
+      state.SkipWithError("Frame was not rendered");
+      break;
+    }
+  }
+
+  if (listener->GetFrameBufferPool().GetAllocationCount() !=
+      allocation_count) {
+    state.SkipWithError("Frame buffers were allocated per sample");
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(frame_size));
+  preview_sink->sample_callback_ = nullptr;
+}
+
+// Registers the benchmarks for every preset, pixel format and mirror state.
+int RegisterTextureHandlerBenchmarks() {
+  const std::pair<const char*, PreviewPixelFormat> formats[] = {
+      {"rgb32", PreviewPixelFormat::kRGB32},
+      {"nv12", PreviewPixelFormat::kNV12},
+  };
+
+  for (const auto& preset : kPresetFrameSizes) {
+    for (const auto& format : formats) {
+      for (bool mirror : {false, true}) {
+        std::string suffix = std::string("/") + preset.name + "/" +
+                             format.first + (mirror ? "/mirror" : "");
+        benchmark::RegisterBenchmark(
+            ("TextureHandler/UpdateBuffer" + suffix).c_str(),
+            BM_UpdateBuffer, format.second, preset.width, preset.height,
+            mirror);
+        benchmark::RegisterBenchmark(
+            ("TextureHandler/UpdateBufferAndRender" + suffix).c_str(),
+            BM_UpdateBufferAndRender, format.second, preset.width,
+            preset.height, mirror);
+        benchmark::RegisterBenchmark(
+            ("CaptureEngineListener/ReplayPreviewSamples" + suffix).c_str(),
+            BM_ReplayPreviewSamples, format.second, preset.width,
+            preset.height, mirror)
+            ->UseManualTime()
+            ->Iterations(kReplayFrameCount);
+        benchmark::RegisterBenchmark(
+            ("CaptureEngineListener/ReplayMultipleBufferSamples" + suffix)
+                .c_str(),
+            BM_ReplayMultipleBufferSamples, format.second, preset.width,
+            preset.height, mirror);
+      }
+    }
+  }
+  return 0;
+}
+
+const int kTextureHandlerBenchmarksRegistered =
+    RegisterTextureHandlerBenchmarks();
+
+}  // namespace
+
+}  // namespace camera_windows
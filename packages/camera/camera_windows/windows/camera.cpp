@@ -4,17 +4,22 @@
 
 #include "camera.h"
 
+#include <flutter/event_stream_handler_functions.h>
+
 namespace camera_windows {
 using flutter::EncodableList;
 using flutter::EncodableMap;
 using flutter::EncodableValue;
 
-// Camera channel events.
-constexpr char kCameraMethodChannelBaseName[] =
-    "plugins.flutter.io/camera_windows/camera";
-constexpr char kVideoRecordedEvent[] = "video_recorded";
-constexpr char kCameraClosingEvent[] = "camera_closing";
-constexpr char kErrorEvent[] = "error";
+// Image stream event channel.
+constexpr char kImageStreamEventChannelBaseName[] =
+    "plugins.flutter.io/camera_windows/imageStream/";
+constexpr char kImageStreamFormatValueBGRA8888[] = "bgra8888";
+constexpr char kImageStreamFormatValueNV12[] = "nv12";
+
+// Record chunk event channel.
+constexpr char kRecordChunkEventChannelBaseName[] =
+    "plugins.flutter.io/camera_windows/recordChunks/";
 
 // Camera error codes
 constexpr char kCameraAccessDenied[] = "CameraAccessDenied";
@@ -35,39 +40,62 @@ std::string GetErrorCode(CameraResult result) {
   }
 }
 
-CameraImpl::CameraImpl(const std::string& device_id)
-    : device_id_(device_id), Camera(device_id) {}
+CameraImpl::CameraImpl(const std::string& device_id,
+                       std::shared_ptr<PlatformThreadDispatcher> dispatcher)
+    : device_id_(device_id),
+      dispatcher_(std::move(dispatcher)),
+      Camera(device_id) {}
 
 CameraImpl::~CameraImpl() {
   // Sends camera closing event.
   OnCameraClosing();
 
   capture_controller_ = nullptr;
+  if (platform_thread_listener_) {
+    // Results that were not delivered yet fail with the pending results.
+    platform_thread_listener_->Cancel();
+  }
   SendErrorForPendingResults(kPluginDisposed,
                              "Plugin disposed before request was handled");
+
+  if (image_stream_channel_) {
+    image_stream_channel_->SetStreamHandler(nullptr);
+  }
+  if (record_chunk_channel_) {
+    record_chunk_channel_->SetStreamHandler(nullptr);
+  }
 }
 
 bool CameraImpl::InitCamera(flutter::TextureRegistrar* texture_registrar,
                             flutter::BinaryMessenger* messenger,
-                            bool record_audio,
-                            ResolutionPreset resolution_preset) {
+                            const CaptureSettings& settings,
+                            std::shared_ptr<CaptureContext> capture_context) {
   auto capture_controller_factory =
-      std::make_unique<CaptureControllerFactoryImpl>();
+      std::make_unique<CaptureControllerFactoryImpl>(settings.capture_backend);
   return InitCamera(std::move(capture_controller_factory), texture_registrar,
-                    messenger, record_audio, resolution_preset);
+                    messenger, settings, std::move(capture_context));
 }
 
 bool CameraImpl::InitCamera(
     std::unique_ptr<CaptureControllerFactory> capture_controller_factory,
     flutter::TextureRegistrar* texture_registrar,
-    flutter::BinaryMessenger* messenger, bool record_audio,
-    ResolutionPreset resolution_preset) {
+    flutter::BinaryMessenger* messenger, const CaptureSettings& settings,
+    std::shared_ptr<CaptureContext> capture_context) {
   assert(!device_id_.empty());
   messenger_ = messenger;
+  event_api_ = std::make_unique<CameraEventApi>(messenger);
+  CaptureControllerListener* listener = this;
+  if (dispatcher_) {
+    if (!platform_thread_listener_) {
+      platform_thread_listener_ =
+          std::make_unique<PlatformThreadListener>(this, dispatcher_);
+    }
+    listener = platform_thread_listener_.get();
+  }
   capture_controller_ =
-      capture_controller_factory->CreateCaptureController(this);
+      capture_controller_factory->CreateCaptureController(listener);
   return capture_controller_->InitCaptureDevice(
-      texture_registrar, device_id_, record_audio, resolution_preset);
+      texture_registrar, device_id_, settings, std::move(capture_context));
 }
 
 bool CameraImpl::AddPendingResult(
@@ -111,32 +139,73 @@ void CameraImpl::SendErrorForPendingResults(const std::string& error_code,
   pending_results_.clear();
 }
 
-MethodChannel<>* CameraImpl::GetMethodChannel() {
+void CameraImpl::InitImageStreamChannel() {
   assert(messenger_);
-  assert(camera_id_);
 
-  // Use existing channel if initialized
-  if (camera_channel_) {
-    return camera_channel_.get();
-  }
+  auto channel_name = std::string(kImageStreamEventChannelBaseName) +
+                      std::to_string(camera_id_);
 
-  auto channel_name =
-      std::string(kCameraMethodChannelBaseName) + std::to_string(camera_id_);
+  image_stream_channel_ = std::make_unique<flutter::EventChannel<>>(
+      messenger_, channel_name, &flutter::StandardMethodCodec::GetInstance());
+
+  // Frames are only sent while Dart listens to the channel.
+  image_stream_channel_->SetStreamHandler(
+      std::make_unique<flutter::StreamHandlerFunctions<>>(
+          [this](const EncodableValue* arguments,
+                 std::unique_ptr<flutter::EventSink<>>&& events)
+              -> std::unique_ptr<flutter::StreamHandlerError<>> {
+            const std::lock_guard<std::mutex> lock(image_stream_mutex_);
+            image_stream_sink_ = std::move(events);
+            return nullptr;
+          },
+          [this](const EncodableValue* arguments)
+              -> std::unique_ptr<flutter::StreamHandlerError<>> {
+            const std::lock_guard<std::mutex> lock(image_stream_mutex_);
+            image_stream_sink_ = nullptr;
+            return nullptr;
+          }));
+}
 
-  camera_channel_ = std::make_unique<flutter::MethodChannel<>>(
+void CameraImpl::InitRecordChunkChannel() {
+  assert(messenger_);
+
+  auto channel_name = std::string(kRecordChunkEventChannelBaseName) +
+                      std::to_string(camera_id_);
+
+  record_chunk_channel_ = std::make_unique<flutter::EventChannel<>>(
       messenger_, channel_name, &flutter::StandardMethodCodec::GetInstance());
 
-  return camera_channel_.get();
+  // Chunks are only sent while Dart listens to the channel.
+  record_chunk_channel_->SetStreamHandler(
+      std::make_unique<flutter::StreamHandlerFunctions<>>(
+          [this](const EncodableValue* arguments,
+                 std::unique_ptr<flutter::EventSink<>>&& events)
+              -> std::unique_ptr<flutter::StreamHandlerError<>> {
+            const std::lock_guard<std::mutex> lock(record_chunk_mutex_);
+            record_chunk_sink_ = std::move(events);
+            return nullptr;
+          },
+          [this](const EncodableValue* arguments)
+              -> std::unique_ptr<flutter::StreamHandlerError<>> {
+            const std::lock_guard<std::mutex> lock(record_chunk_mutex_);
+            record_chunk_sink_ = nullptr;
+            return nullptr;
+          }));
 }
 
 void CameraImpl::OnCreateCaptureEngineSucceeded(int64_t texture_id) {
   // Use texture id as camera id
   camera_id_ = texture_id;
+  if (messenger_ && !image_stream_channel_) {
+    InitImageStreamChannel();
+  }
+  if (messenger_ && !record_chunk_channel_) {
+    InitRecordChunkChannel();
+  }
   auto pending_result =
       GetPendingResultByType(PendingResultType::kCreateCamera);
   if (pending_result) {
-    pending_result->Success(EncodableMap(
-        {{EncodableValue("cameraId"), EncodableValue(texture_id)}}));
+    pending_result->Success(EncodableValue(texture_id));
   }
 }
 
@@ -153,12 +222,9 @@ void CameraImpl::OnCreateCaptureEngineFailed(CameraResult result,
 void CameraImpl::OnStartPreviewSucceeded(int32_t width, int32_t height) {
   auto pending_result = GetPendingResultByType(PendingResultType::kInitialize);
   if (pending_result) {
-    pending_result->Success(EncodableValue(EncodableMap({
-        {EncodableValue("previewWidth"),
-         EncodableValue(static_cast<float>(width))},
-        {EncodableValue("previewHeight"),
-         EncodableValue(static_cast<float>(height))},
-    })));
+    PlatformSize size(static_cast<double>(width), static_cast<double>(height));
+    pending_result->Success(
+        EncodableValue(flutter::CustomEncodableValue(size)));
   }
 };
 
@@ -239,6 +305,40 @@ void CameraImpl::OnStopRecordFailed(CameraResult result,
   }
 };
 
+void CameraImpl::OnPauseRecordSucceeded() {
+  auto pending_result = GetPendingResultByType(PendingResultType::kPauseRecord);
+  if (pending_result) {
+    pending_result->Success();
+  }
+}
+
+void CameraImpl::OnPauseRecordFailed(CameraResult result,
+                                     const std::string& error) {
+  auto pending_result = GetPendingResultByType(PendingResultType::kPauseRecord);
+  if (pending_result) {
+    std::string error_code = GetErrorCode(result);
+    pending_result->Error(error_code, error);
+  }
+}
+
+void CameraImpl::OnResumeRecordSucceeded() {
+  auto pending_result =
+      GetPendingResultByType(PendingResultType::kResumeRecord);
+  if (pending_result) {
+    pending_result->Success();
+  }
+}
+
+void CameraImpl::OnResumeRecordFailed(CameraResult result,
+                                      const std::string& error) {
+  auto pending_result =
+      GetPendingResultByType(PendingResultType::kResumeRecord);
+  if (pending_result) {
+    std::string error_code = GetErrorCode(result);
+    pending_result->Error(error_code, error);
+  }
+}
+
 void CameraImpl::OnTakePictureSucceeded(const std::string& file_path) {
   auto pending_result = GetPendingResultByType(PendingResultType::kTakePicture);
   if (pending_result) {
@@ -256,18 +356,52 @@ void CameraImpl::OnTakePictureFailed(CameraResult result,
   }
 };
 
-void CameraImpl::OnVideoRecordSucceeded(const std::string& file_path,
-                                        int64_t video_duration_ms) {
-  if (messenger_ && camera_id_ >= 0) {
-    auto channel = GetMethodChannel();
+void CameraImpl::OnTakePictureDataSucceeded(std::vector<uint8_t>& data) {
+  auto pending_result =
+      GetPendingResultByType(PendingResultType::kTakePictureData);
+  if (pending_result) {
+    pending_result->Success(EncodableValue(std::move(data)));
+  }
+};
+
+void CameraImpl::OnTakePictureDataFailed(CameraResult result,
+                                         const std::string& error) {
+  auto pending_result =
+      GetPendingResultByType(PendingResultType::kTakePictureData);
+  if (pending_result) {
+    std::string error_code = GetErrorCode(result);
+    pending_result->Error(error_code, error);
+  }
+};
+
+void CameraImpl::OnTakePictureBurstSucceeded(
+    const std::vector<std::string>& file_paths) {
+  auto pending_result =
+      GetPendingResultByType(PendingResultType::kTakePictureBurst);
+  if (pending_result) {
+    EncodableList paths;
+    for (const std::string& file_path : file_paths) {
+      paths.push_back(EncodableValue(file_path));
+    }
+    pending_result->Success(EncodableValue(std::move(paths)));
+  }
+};
 
-    std::unique_ptr<EncodableValue> message_data =
-        std::make_unique<EncodableValue>(
-            EncodableMap({{EncodableValue("path"), EncodableValue(file_path)},
-                          {EncodableValue("maxVideoDuration"),
-                           EncodableValue(video_duration_ms)}}));
+void CameraImpl::OnTakePictureBurstFailed(CameraResult result,
+                                          const std::string& error) {
+  auto pending_result =
+      GetPendingResultByType(PendingResultType::kTakePictureBurst);
+  if (pending_result) {
+    std::string error_code = GetErrorCode(result);
+    pending_result->Error(error_code, error);
+  }
+};
 
-    channel->InvokeMethod(kVideoRecordedEvent, std::move(message_data));
+void CameraImpl::OnVideoRecordSucceeded(const std::string& file_path,
+                                        int64_t video_duration_ms) {
+  if (event_api_ && camera_id_ >= 0) {
+    event_api_->VideoRecorded(camera_id_, file_path, video_duration_ms, [] {},
+                              [](const FlutterError&) {});
   }
 }
 
@@ -275,24 +409,61 @@ void CameraImpl::OnVideoRecordFailed(CameraResult result,
                                      const std::string& error){};
 
 void CameraImpl::OnCaptureError(CameraResult result, const std::string& error) {
-  if (messenger_ && camera_id_ >= 0) {
-    auto channel = GetMethodChannel();
-
-    std::unique_ptr<EncodableValue> message_data =
-        std::make_unique<EncodableValue>(EncodableMap(
-            {{EncodableValue("description"), EncodableValue(error)}}));
-    channel->InvokeMethod(kErrorEvent, std::move(message_data));
+  if (event_api_ && camera_id_ >= 0) {
+    event_api_->Error(camera_id_, error, [] {}, [](const FlutterError&) {});
   }
 
   std::string error_code = GetErrorCode(result);
   SendErrorForPendingResults(error_code, error);
 }
 
+bool CameraImpl::OnImageStreamFrameAvailable(ImageStreamFrame& frame) {
+  const std::lock_guard<std::mutex> lock(image_stream_mutex_);
+  if (!image_stream_sink_) {
+    return false;
+  }
+
+  EncodableList planes;
+  for (ImageStreamPlane& plane : frame.planes) {
+    planes.push_back(EncodableValue(EncodableMap(
+        {{EncodableValue("bytes"), EncodableValue(std::move(plane.bytes))},
+         {EncodableValue("bytesPerRow"),
+          EncodableValue(static_cast<int32_t>(plane.bytes_per_row))},
+         {EncodableValue("width"),
+          EncodableValue(static_cast<int32_t>(plane.width))},
+         {EncodableValue("height"),
+          EncodableValue(static_cast<int32_t>(plane.height))}})));
+  }
+
+  const char* format = frame.format == ImageStreamFormat::kNV12
+                           ? kImageStreamFormatValueNV12
+                           : kImageStreamFormatValueBGRA8888;
+  image_stream_sink_->Success(EncodableValue(EncodableMap(
+      {{EncodableValue("format"), EncodableValue(format)},
+       {EncodableValue("width"),
+        EncodableValue(static_cast<int32_t>(frame.width))},
+       {EncodableValue("height"),
+        EncodableValue(static_cast<int32_t>(frame.height))},
+       {EncodableValue("planes"), EncodableValue(std::move(planes))}})));
+  return true;
+}
+
+void CameraImpl::OnVideoRecordChunkAvailable(uint64_t offset,
+                                             std::vector<uint8_t>& data) {
+  const std::lock_guard<std::mutex> lock(record_chunk_mutex_);
+  if (!record_chunk_sink_) {
+    return;
+  }
+
+  record_chunk_sink_->Success(EncodableValue(EncodableMap(
+      {{EncodableValue("offset"),
+        EncodableValue(static_cast<int64_t>(offset))},
+       {EncodableValue("bytes"), EncodableValue(std::move(data))}})));
+}
+
 void CameraImpl::OnCameraClosing() {
-  if (messenger_ && camera_id_ >= 0) {
-    auto channel = GetMethodChannel();
-    channel->InvokeMethod(kCameraClosingEvent,
-                          std::move(std::make_unique<EncodableValue>()));
+  if (event_api_ && camera_id_ >= 0) {
+    event_api_->CameraClosing(camera_id_, [] {}, [](const FlutterError&) {});
   }
 }
 
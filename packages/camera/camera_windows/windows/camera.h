@@ -5,12 +5,20 @@
 #ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAMERA_H_
 #define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAMERA_H_
 
+#include <flutter/event_channel.h>
+#include <flutter/event_sink.h>
 #include <flutter/method_channel.h>
 #include <flutter/standard_method_codec.h>
 
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
 
 #include "capture_controller.h"
+#include "messages.g.h"
+#include "platform_thread_dispatcher.h"
+#include "platform_thread_listener.h"
 
 namespace camera_windows {
 
@@ -24,8 +32,12 @@ enum class PendingResultType {
   kCreateCamera,
   kInitialize,
   kTakePicture,
+  kTakePictureData,
+  kTakePictureBurst,
   kStartRecord,
   kStopRecord,
+  kPauseRecord,
+  kResumeRecord,
   kPausePreview,
   kResumePreview,
 };
@@ -64,21 +76,30 @@ class Camera : public CaptureControllerListener {
 
   // Initializes this camera and its associated capture controller.
   //
+  // The capture controller captures through the given |capture_context|,
+  // which is shared by all cameras of the plugin.
+  //
   // Returns false if initialization fails.
   virtual bool InitCamera(flutter::TextureRegistrar* texture_registrar,
                           flutter::BinaryMessenger* messenger,
-                          bool record_audio,
-                          ResolutionPreset resolution_preset) = 0;
+                          const CaptureSettings& settings,
+                          std::shared_ptr<CaptureContext> capture_context) = 0;
 };
 
 // Concrete implementation of the |Camera| interface.
 //
 // This implementation is responsible for initializing the capture controller,
 // listening for camera events, processing pending results, and notifying
-// application code of processed events via the method channel.
+// application code of processed events via |CameraEventApi|.
+//
+// If a |PlatformThreadDispatcher| is given, the callbacks of the capture
+// controller are handled on the platform thread, so that pending results and
+// the event API are only used from there.
 class CameraImpl : public Camera {
  public:
-  explicit CameraImpl(const std::string& device_id);
+  explicit CameraImpl(
+      const std::string& device_id,
+      std::shared_ptr<PlatformThreadDispatcher> dispatcher = nullptr);
   virtual ~CameraImpl();
 
   // Disallow copy and move.
@@ -104,14 +125,30 @@ class CameraImpl : public Camera {
   void OnStopRecordSucceeded(const std::string& file_path) override;
   void OnStopRecordFailed(CameraResult result,
                           const std::string& error) override;
+  void OnPauseRecordSucceeded() override;
+  void OnPauseRecordFailed(CameraResult result,
+                           const std::string& error) override;
+  void OnResumeRecordSucceeded() override;
+  void OnResumeRecordFailed(CameraResult result,
+                            const std::string& error) override;
   void OnTakePictureSucceeded(const std::string& file_path) override;
   void OnTakePictureFailed(CameraResult result,
                            const std::string& error) override;
+  void OnTakePictureDataSucceeded(std::vector<uint8_t>& data) override;
+  void OnTakePictureDataFailed(CameraResult result,
+                               const std::string& error) override;
+  void OnTakePictureBurstSucceeded(
+      const std::vector<std::string>& file_paths) override;
+  void OnTakePictureBurstFailed(CameraResult result,
+                                const std::string& error) override;
   void OnVideoRecordSucceeded(const std::string& file_path,
                               int64_t video_duration) override;
   void OnVideoRecordFailed(CameraResult result,
                            const std::string& error) override;
   void OnCaptureError(CameraResult result, const std::string& error) override;
+  bool OnImageStreamFrameAvailable(ImageStreamFrame& frame) override;
+  void OnVideoRecordChunkAvailable(uint64_t offset,
+                                   std::vector<uint8_t>& data) override;
 
   // Camera
   bool HasDeviceId(std::string& device_id) const override {
@@ -127,8 +164,9 @@ class CameraImpl : public Camera {
     return capture_controller_.get();
   }
   bool InitCamera(flutter::TextureRegistrar* texture_registrar,
-                  flutter::BinaryMessenger* messenger, bool record_audio,
-                  ResolutionPreset resolution_preset) override;
+                  flutter::BinaryMessenger* messenger,
+                  const CaptureSettings& settings,
+                  std::shared_ptr<CaptureContext> capture_context) override;
 
   // Initializes the camera and its associated capture controller.
   //
@@ -139,8 +177,8 @@ class CameraImpl : public Camera {
   bool InitCamera(
       std::unique_ptr<CaptureControllerFactory> capture_controller_factory,
       flutter::TextureRegistrar* texture_registrar,
-      flutter::BinaryMessenger* messenger, bool record_audio,
-      ResolutionPreset resolution_preset);
+      flutter::BinaryMessenger* messenger, const CaptureSettings& settings,
+      std::shared_ptr<CaptureContext> capture_context);
 
  private:
   // Loops through all pending results and calls their error handler with given
@@ -152,11 +190,14 @@ class CameraImpl : public Camera {
                                   const std::string& description);
 
   // Called when camera is disposed.
-  // Sends camera closing message to the cameras method channel.
+  // Sends camera closing event to Dart.
   void OnCameraClosing();
 
-  // Initializes method channel instance and returns pointer it.
-  MethodChannel<>* GetMethodChannel();
+  // Initializes the event channel that image stream frames are sent to.
+  void InitImageStreamChannel();
+
+  // Initializes the event channel that recorded chunks are sent to.
+  void InitRecordChunkChannel();
 
   // Finds pending result by type.
   // Returns nullptr if type is not present.
@@ -164,8 +205,19 @@ class CameraImpl : public Camera {
       PendingResultType type);
 
   std::map<PendingResultType, std::unique_ptr<MethodResult<>>> pending_results_;
+  std::shared_ptr<PlatformThreadDispatcher> dispatcher_;
+  // Declared before |capture_controller_|, which reports to it.
+  std::unique_ptr<PlatformThreadListener> platform_thread_listener_;
   std::unique_ptr<CaptureController> capture_controller_;
-  std::unique_ptr<MethodChannel<>> camera_channel_;
+  // Sends the events of this camera, keyed by |camera_id_|, on the channels
+  // shared by all cameras.
+  std::unique_ptr<CameraEventApi> event_api_;
+  std::unique_ptr<flutter::EventChannel<>> image_stream_channel_;
+  std::unique_ptr<flutter::EventSink<>> image_stream_sink_;
+  std::mutex image_stream_mutex_;
+  std::unique_ptr<flutter::EventChannel<>> record_chunk_channel_;
+  std::unique_ptr<flutter::EventSink<>> record_chunk_sink_;
+  std::mutex record_chunk_mutex_;
   flutter::BinaryMessenger* messenger_ = nullptr;
   int64_t camera_id_ = -1;
   std::string device_id_;
@@ -187,9 +239,14 @@ class CameraFactory {
 };
 
 // Concrete implementation of |CameraFactory|.
+//
+// Cameras handle their capture controller callbacks on the platform thread
+// through |dispatcher|, if it is not null.
 class CameraFactoryImpl : public CameraFactory {
  public:
-  CameraFactoryImpl() {}
+  explicit CameraFactoryImpl(
+      std::shared_ptr<PlatformThreadDispatcher> dispatcher = nullptr)
+      : dispatcher_(std::move(dispatcher)) {}
   virtual ~CameraFactoryImpl() = default;
 
   // Disallow copy and move.
@@ -197,8 +254,11 @@ class CameraFactoryImpl : public CameraFactory {
   CameraFactoryImpl& operator=(const CameraFactoryImpl&) = delete;
 
   std::unique_ptr<Camera> CreateCamera(const std::string& device_id) override {
-    return std::make_unique<CameraImpl>(device_id);
+    return std::make_unique<CameraImpl>(device_id, dispatcher_);
   }
+
+ private:
+  std::shared_ptr<PlatformThreadDispatcher> dispatcher_;
 };
 
 }  // namespace camera_windows
@@ -0,0 +1,480 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "camera_controls.h"
+
+#include <mfapi.h>
+#include <mfcaptureengine.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace camera_windows {
+
+namespace {
+
+// Returns the offset in EV of one step of the exposure compensation control
+// for the step flag set on the control, or 0 if no step is set.
+double GetEvCompensationStep(ULONGLONG flags) {
+  if (flags & KSCAMERA_EXTENDEDPROP_EVCOMP_SIXTHSTEP) {
+    return 1.0 / 6.0;
+  } else if (flags & KSCAMERA_EXTENDEDPROP_EVCOMP_QUARTERSTEP) {
+    return 1.0 / 4.0;
+  } else if (flags & KSCAMERA_EXTENDEDPROP_EVCOMP_THIRDSTEP) {
+    return 1.0 / 3.0;
+  } else if (flags & KSCAMERA_EXTENDEDPROP_EVCOMP_HALFSTEP) {
+    return 1.0 / 2.0;
+  } else if (flags & KSCAMERA_EXTENDEDPROP_EVCOMP_FULLSTEP) {
+    return 1.0;
+  }
+  return 0.0;
+}
+
+// Returns the exposure compensation settings following the header of the
+// payload of |control|. If |value| is given, it is written to the payload.
+HRESULT AccessEvCompensation(IMFExtendedCameraControl* control,
+                             KSCAMERA_EXTENDEDPROP_EVCOMPENSATION* settings,
+                             const LONG* value) {
+  assert(control);
+  assert(settings);
+
+  BYTE* payload = nullptr;
+  ULONG payload_size = 0;
+  HRESULT hr = control->LockPayload(&payload, &payload_size);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  constexpr size_t kSettingsOffset = sizeof(KSCAMERA_EXTENDEDPROP_HEADER);
+  if (!payload || payload_size < kSettingsOffset + sizeof(*settings)) {
+    hr = E_UNEXPECTED;
+  } else {
+    BYTE* settings_data = payload + kSettingsOffset;
+    if (value) {
+      KSCAMERA_EXTENDEDPROP_EVCOMPENSATION* payload_settings =
+          reinterpret_cast<KSCAMERA_EXTENDEDPROP_EVCOMPENSATION*>(
+              settings_data);
+      payload_settings->Value = *value;
+    }
+    memcpy(settings, settings_data, sizeof(*settings));
+  }
+
+  control->UnlockPayload();
+  return hr;
+}
+
+}  // namespace
+
+CameraControlsImpl::CameraControlsImpl(IMFMediaSource* video_source)
+    : video_source_(video_source) {
+  if (!video_source_) {
+    return;
+  }
+
+  // The extended controller is only available on Windows 10 version 1803
+  // and later, and for cameras with extended control support.
+  ComPtr<IMFGetService> get_service;
+  if (SUCCEEDED(video_source_.As(&get_service)) &&
+      FAILED(get_service->GetService(GUID_NULL,
+                                     IID_PPV_ARGS(&extended_controller_)))) {
+    extended_controller_ = nullptr;
+  }
+
+  video_source_.As(&camera_control_);
+  video_source_.As(&video_proc_amp_);
+  video_source_.As(&ks_control_);
+}
+
+HRESULT CameraControlsImpl::SetExposureMode(CameraControlMode mode) {
+  // The exposure is set explicitly, so a manual exposure set to lock the
+  // frame rate is not restored anymore.
+  exposure_flags_before_frame_rate_lock_ = 0;
+
+  if (SUCCEEDED(SetExtendedVideoProcMode(
+          KSPROPERTY_CAMERACONTROL_EXTENDED_EXPOSUREMODE, mode))) {
+    return S_OK;
+  }
+  return SetCameraControlMode(CameraControl_Exposure, mode);
+}
+
+HRESULT CameraControlsImpl::SetFocusMode(CameraControlMode mode) {
+  return SetCameraControlMode(CameraControl_Focus, mode);
+}
+
+HRESULT CameraControlsImpl::SetWhiteBalanceMode(CameraControlMode mode) {
+  if (SUCCEEDED(SetExtendedVideoProcMode(
+          KSPROPERTY_CAMERACONTROL_EXTENDED_WHITEBALANCEMODE, mode))) {
+    return S_OK;
+  }
+
+  if (!video_proc_amp_) {
+    return E_NOTIMPL;
+  }
+
+  long min = 0;
+  long max = 0;
+  long step = 0;
+  long default_value = 0;
+  long capabilities = 0;
+  HRESULT hr =
+      video_proc_amp_->GetRange(VideoProcAmp_WhiteBalance, &min, &max, &step,
+                                &default_value, &capabilities);
+  const long flag = mode == CameraControlMode::kAuto
+                        ? VideoProcAmp_Flags_Auto
+                        : VideoProcAmp_Flags_Manual;
+  if (FAILED(hr) || (capabilities & flag) == 0) {
+    return E_NOTIMPL;
+  }
+
+  // Locks the white balance at the temperature chosen by the camera.
+  long value = default_value;
+  long flags = 0;
+  hr = video_proc_amp_->Get(VideoProcAmp_WhiteBalance, &value, &flags);
+  if (FAILED(hr)) {
+    return hr;
+  }
+  return video_proc_amp_->Set(VideoProcAmp_WhiteBalance, value, flag);
+}
+
+ExposureOffsetRange CameraControlsImpl::GetExposureOffsetRange() {
+  ExposureOffsetRange range;
+  IMFExtendedCameraControl* control =
+      GetExtendedControl(KSPROPERTY_CAMERACONTROL_EXTENDED_EVCOMPENSATION);
+  if (!control) {
+    return range;
+  }
+
+  const double step = GetEvCompensationStep(control->GetFlags());
+  KSCAMERA_EXTENDEDPROP_EVCOMPENSATION settings = {};
+  if (step == 0.0 ||
+      FAILED(AccessEvCompensation(control, &settings, nullptr))) {
+    return range;
+  }
+
+  range.min = settings.Min * step;
+  range.max = settings.Max * step;
+  range.step = step;
+  return range;
+}
+
+HRESULT CameraControlsImpl::SetExposureOffset(double offset,
+                                              double* applied_offset) {
+  assert(applied_offset);
+
+  IMFExtendedCameraControl* control =
+      GetExtendedControl(KSPROPERTY_CAMERACONTROL_EXTENDED_EVCOMPENSATION);
+  if (!control) {
+    return E_NOTIMPL;
+  }
+
+  const ULONGLONG step_flags = control->GetFlags();
+  const double step = GetEvCompensationStep(step_flags);
+  KSCAMERA_EXTENDEDPROP_EVCOMPENSATION settings = {};
+  HRESULT hr = AccessEvCompensation(control, &settings, nullptr);
+  if (step == 0.0 || FAILED(hr)) {
+    return E_NOTIMPL;
+  }
+
+  // Rounds to the closest step within the supported range.
+  LONG steps = static_cast<LONG>(std::lround(offset / step));
+  if (steps < settings.Min) {
+    steps = settings.Min;
+  } else if (steps > settings.Max) {
+    steps = settings.Max;
+  }
+
+  hr = AccessEvCompensation(control, &settings, &steps);
+  if (SUCCEEDED(hr)) {
+    hr = control->SetFlags(step_flags);
+  }
+  if (SUCCEEDED(hr)) {
+    hr = control->CommitSettings();
+  }
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  *applied_offset = steps * step;
+  return S_OK;
+}
+
+HRESULT CameraControlsImpl::SetFrameRateLock(bool locked) {
+  // Auto exposure priority tells the driver whether auto exposure may lower
+  // the frame rate, while keeping the exposure automatic.
+  if (ks_control_) {
+    KSPROPERTY_CAMERACONTROL_S property = {};
+    property.Property.Set = PROPSETID_VIDCAP_CAMERACONTROL;
+    property.Property.Id = KSPROPERTY_CAMERACONTROL_AUTO_EXPOSURE_PRIORITY;
+    property.Property.Flags = KSPROPERTY_TYPE_SET;
+    property.Value = locked ? 0 : 1;
+    property.Flags = KSPROPERTY_CAMERACONTROL_FLAGS_MANUAL;
+    ULONG bytes_returned = 0;
+    if (SUCCEEDED(ks_control_->KsProperty(&property.Property,
+                                          sizeof(property), &property,
+                                          sizeof(property), &bytes_returned))) {
+      return S_OK;
+    }
+  }
+
+  // Otherwise the exposure is set to the longest manual exposure that fits
+  // in a frame, and restored to automatic when unlocked.
+  if (!camera_control_) {
+    return E_NOTIMPL;
+  }
+
+  if (!locked) {
+    HRESULT hr = S_OK;
+    if (exposure_flags_before_frame_rate_lock_ & CameraControl_Flags_Auto) {
+      long value = 0;
+      long flags = 0;
+      hr = camera_control_->Get(CameraControl_Exposure, &value, &flags);
+      if (SUCCEEDED(hr)) {
+        hr = camera_control_->Set(CameraControl_Exposure, value,
+                                  CameraControl_Flags_Auto);
+      }
+    }
+    exposure_flags_before_frame_rate_lock_ = 0;
+    return hr;
+  }
+
+  const PropertyRange& range = GetCameraControlRange(CameraControl_Exposure);
+  const float frame_rate = GetCurrentFrameRate();
+  if (FAILED(range.result) || (range.flags & CameraControl_Flags_Manual) == 0 ||
+      frame_rate <= 0.f) {
+    return E_NOTIMPL;
+  }
+
+  // Exposure values are log2 of the exposure time in seconds.
+  long exposure =
+      static_cast<long>(std::floor(std::log2(1.0 / frame_rate)));
+  if (exposure > range.max) {
+    exposure = range.max;
+  }
+  if (exposure < range.min) {
+    exposure = range.min;
+  }
+
+  long value = 0;
+  long flags = 0;
+  HRESULT hr = camera_control_->Get(CameraControl_Exposure, &value, &flags);
+  if (FAILED(hr)) {
+    return hr;
+  }
+  hr = camera_control_->Set(CameraControl_Exposure, exposure,
+                            CameraControl_Flags_Manual);
+  if (SUCCEEDED(hr) && exposure_flags_before_frame_rate_lock_ == 0) {
+    exposure_flags_before_frame_rate_lock_ = flags;
+  }
+  return hr;
+}
+
+HRESULT CameraControlsImpl::SetFlashMode(CameraFlashMode mode) {
+  const bool torch = mode == CameraFlashMode::kTorch;
+  HRESULT hr = SetExtendedControlFlags(
+      KSPROPERTY_CAMERACONTROL_EXTENDED_TORCHMODE,
+      torch ? KSCAMERA_EXTENDEDPROP_VIDEOTORCH_ON
+            : KSCAMERA_EXTENDEDPROP_VIDEOTORCH_OFF);
+  if (torch && FAILED(hr)) {
+    return hr;
+  }
+
+  const CameraFlashMode previous_mode = flash_mode_;
+  flash_mode_ = mode;
+  hr = ApplyFlashMode();
+  // Only the torch is needed in torch mode, and cameras without a flash are
+  // always off.
+  if (hr == E_NOTIMPL &&
+      (mode == CameraFlashMode::kOff || mode == CameraFlashMode::kTorch)) {
+    return S_OK;
+  }
+  if (FAILED(hr)) {
+    flash_mode_ = previous_mode;
+  }
+  return hr;
+}
+
+HRESULT CameraControlsImpl::SetPhotoCapturePriority(
+    PhotoCapturePriority priority) {
+  // Without focus priority, the driver takes pictures without waiting for
+  // the auto focus to converge.
+  HRESULT hr = SetExtendedControlFlags(
+      KSPROPERTY_CAMERACONTROL_EXTENDED_FOCUSPRIORITY,
+      priority == PhotoCapturePriority::kSpeed
+          ? KSCAMERA_EXTENDEDPROP_FOCUSPRIORITY_OFF
+          : KSCAMERA_EXTENDEDPROP_FOCUSPRIORITY_ON);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  photo_capture_priority_ = priority;
+  if (flash_mode_ == CameraFlashMode::kAuto ||
+      flash_mode_ == CameraFlashMode::kAlways) {
+    // Switches between a single flash and the driver default, which may
+    // fire a pre-flash to meter the exposure.
+    ApplyFlashMode();
+  }
+  return S_OK;
+}
+
+IMFExtendedCameraControl* CameraControlsImpl::GetExtendedControl(
+    ULONG property_id) {
+  auto it = extended_controls_.find(property_id);
+  if (it != extended_controls_.end()) {
+    return it->second.Get();
+  }
+
+  // Unsupported controls are cached as well, so that they are only queried
+  // once.
+  ComPtr<IMFExtendedCameraControl> control;
+  if (extended_controller_ &&
+      FAILED(extended_controller_->GetExtendedCameraControl(
+          MF_CAPTURE_ENGINE_MEDIASOURCE, property_id, &control))) {
+    control = nullptr;
+  }
+  IMFExtendedCameraControl* result = control.Get();
+  extended_controls_[property_id] = std::move(control);
+  return result;
+}
+
+HRESULT CameraControlsImpl::SetExtendedVideoProcMode(ULONG property_id,
+                                                     CameraControlMode mode) {
+  IMFExtendedCameraControl* control = GetExtendedControl(property_id);
+  if (!control) {
+    return E_NOTIMPL;
+  }
+
+  const ULONGLONG flag = mode == CameraControlMode::kAuto
+                             ? KSCAMERA_EXTENDEDPROP_VIDEOPROCFLAG_AUTO
+                             : KSCAMERA_EXTENDEDPROP_VIDEOPROCFLAG_LOCK;
+  if ((control->GetCapabilities() & flag) == 0) {
+    return E_NOTIMPL;
+  }
+
+  HRESULT hr = control->SetFlags(flag);
+  if (SUCCEEDED(hr)) {
+    hr = control->CommitSettings();
+  }
+  return hr;
+}
+
+HRESULT CameraControlsImpl::SetExtendedControlFlags(ULONG property_id,
+                                                    ULONGLONG flags) {
+  IMFExtendedCameraControl* control = GetExtendedControl(property_id);
+  if (!control) {
+    return E_NOTIMPL;
+  }
+
+  // Off modes have no flag, and are supported by every control.
+  if ((control->GetCapabilities() & flags) != flags) {
+    return E_NOTIMPL;
+  }
+
+  HRESULT hr = control->SetFlags(flags);
+  if (SUCCEEDED(hr)) {
+    hr = control->CommitSettings();
+  }
+  return hr;
+}
+
+HRESULT CameraControlsImpl::ApplyFlashMode() {
+  ULONGLONG flags = KSCAMERA_EXTENDEDPROP_FLASH_OFF;
+  if (flash_mode_ == CameraFlashMode::kAuto) {
+    flags = KSCAMERA_EXTENDEDPROP_FLASH_AUTO;
+  } else if (flash_mode_ == CameraFlashMode::kAlways) {
+    flags = KSCAMERA_EXTENDEDPROP_FLASH_ON;
+  }
+
+  IMFExtendedCameraControl* control =
+      GetExtendedControl(KSPROPERTY_CAMERACONTROL_EXTENDED_FLASHMODE);
+  if (flags != KSCAMERA_EXTENDEDPROP_FLASH_OFF &&
+      photo_capture_priority_ == PhotoCapturePriority::kSpeed && control &&
+      (control->GetCapabilities() & KSCAMERA_EXTENDEDPROP_FLASH_SINGLEFLASH)) {
+    // Skips the pre-flash, which delays the picture.
+    flags |= KSCAMERA_EXTENDEDPROP_FLASH_SINGLEFLASH;
+  }
+  return SetExtendedControlFlags(KSPROPERTY_CAMERACONTROL_EXTENDED_FLASHMODE,
+                                 flags);
+}
+
+const CameraControlsImpl::PropertyRange&
+CameraControlsImpl::GetCameraControlRange(long property) {
+  auto it = camera_control_ranges_.find(property);
+  if (it != camera_control_ranges_.end()) {
+    return it->second;
+  }
+
+  PropertyRange range;
+  if (camera_control_) {
+    range.result =
+        camera_control_->GetRange(property, &range.min, &range.max,
+                                  &range.step, &range.default_value,
+                                  &range.flags);
+  }
+  return camera_control_ranges_[property] = range;
+}
+
+HRESULT CameraControlsImpl::SetCameraControlMode(long property,
+                                                 CameraControlMode mode) {
+  if (!camera_control_) {
+    return E_NOTIMPL;
+  }
+
+  const PropertyRange& range = GetCameraControlRange(property);
+  const long flag = mode == CameraControlMode::kAuto
+                        ? CameraControl_Flags_Auto
+                        : CameraControl_Flags_Manual;
+  if (FAILED(range.result) || (range.flags & flag) == 0) {
+    return E_NOTIMPL;
+  }
+
+  // Locks the control at the value chosen by the camera.
+  long value = range.default_value;
+  long flags = 0;
+  HRESULT hr = camera_control_->Get(property, &value, &flags);
+  if (FAILED(hr)) {
+    return hr;
+  }
+  return camera_control_->Set(property, value, flag);
+}
+
+float CameraControlsImpl::GetCurrentFrameRate() const {
+  if (!video_source_) {
+    return 0.f;
+  }
+
+  ComPtr<IMFPresentationDescriptor> presentation_descriptor;
+  DWORD stream_count = 0;
+  if (FAILED(video_source_->CreatePresentationDescriptor(
+          &presentation_descriptor)) ||
+      FAILED(presentation_descriptor->GetStreamDescriptorCount(
+          &stream_count))) {
+    return 0.f;
+  }
+
+  // Uses the first selected stream with a frame rate, which is the stream
+  // the capture engine previews.
+  for (DWORD i = 0; i < stream_count; i++) {
+    BOOL selected = FALSE;
+    ComPtr<IMFStreamDescriptor> stream_descriptor;
+    ComPtr<IMFMediaTypeHandler> media_type_handler;
+    ComPtr<IMFMediaType> media_type;
+    UINT32 numerator = 0;
+    UINT32 denominator = 0;
+    if (SUCCEEDED(presentation_descriptor->GetStreamDescriptorByIndex(
+            i, &selected, &stream_descriptor)) &&
+        selected &&
+        SUCCEEDED(
+            stream_descriptor->GetMediaTypeHandler(&media_type_handler)) &&
+        SUCCEEDED(media_type_handler->GetCurrentMediaType(&media_type)) &&
+        SUCCEEDED(MFGetAttributeRatio(media_type.Get(), MF_MT_FRAME_RATE,
+                                      &numerator, &denominator)) &&
+        denominator > 0) {
+      return static_cast<float>(numerator) / denominator;
+    }
+  }
+  return 0.f;
+}
+
+}  // namespace camera_windows
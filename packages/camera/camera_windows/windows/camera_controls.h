@@ -0,0 +1,190 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAMERA_CONTROLS_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAMERA_CONTROLS_H_
+
+// ks.h must be included before ksmedia.h.
+#include <ks.h>
+#include <ksmedia.h>
+#include <mfidl.h>
+#include <strmif.h>
+#include <windows.h>
+#include <wrl/client.h>
+
+#include <map>
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+// Modes of the automatic camera controls.
+enum class CameraControlMode {
+  // The camera adjusts the control continuously.
+  kAuto,
+  // The control keeps its current value.
+  kLocked,
+};
+
+// Modes of the flash of a camera.
+enum class CameraFlashMode {
+  // Neither the flash nor the torch is used.
+  kOff,
+  // The flash fires for pictures taken in low light.
+  kAuto,
+  // The flash fires for every picture.
+  kAlways,
+  // The torch stays on, and the flash is not used.
+  kTorch,
+};
+
+// What the camera favors when taking pictures.
+enum class PhotoCapturePriority {
+  // The driver default, which usually waits for the focus to converge
+  // before taking a picture.
+  kBalanced,
+  // Pictures are taken immediately, without waiting for the focus and
+  // without a pre-flash.
+  kSpeed,
+};
+
+// Range of the exposure offset, in EV.
+struct ExposureOffsetRange {
+  double min = 0.0;
+  double max = 0.0;
+  // Distance between two supported offsets, or 0 if the exposure offset is
+  // not supported.
+  double step = 0.0;
+};
+
+// Interface for the exposure, focus, white balance and flash controls of a
+// camera.
+//
+// Methods return E_NOTIMPL if the camera does not support the control.
+class CameraControls {
+ public:
+  CameraControls() = default;
+  virtual ~CameraControls() = default;
+
+  // Disallow copy and move.
+  CameraControls(const CameraControls&) = delete;
+  CameraControls& operator=(const CameraControls&) = delete;
+
+  // Sets the exposure to automatic, or locks it at its current value.
+  virtual HRESULT SetExposureMode(CameraControlMode mode) = 0;
+
+  // Sets the focus to automatic, or locks it at its current distance.
+  virtual HRESULT SetFocusMode(CameraControlMode mode) = 0;
+
+  // Sets the white balance to automatic, or locks it at its current
+  // temperature.
+  virtual HRESULT SetWhiteBalanceMode(CameraControlMode mode) = 0;
+
+  // Returns the supported exposure offset range. The range is empty, with a
+  // step of 0, if the exposure offset is not supported.
+  virtual ExposureOffsetRange GetExposureOffsetRange() = 0;
+
+  // Sets the exposure compensation, rounded to the closest supported step.
+  //
+  // offset:         Requested offset in EV.
+  // applied_offset: Receives the offset set on the camera.
+  virtual HRESULT SetExposureOffset(double offset, double* applied_offset) = 0;
+
+  // Keeps the capture frame rate constant while the exposure is automatic,
+  // instead of letting auto exposure lower it in low light.
+  virtual HRESULT SetFrameRateLock(bool locked) = 0;
+
+  // Sets the flash or torch mode.
+  //
+  // Turning them off succeeds on cameras without a flash or torch.
+  virtual HRESULT SetFlashMode(CameraFlashMode mode) = 0;
+
+  // Sets whether pictures favor the shutter lag over the focus.
+  virtual HRESULT SetPhotoCapturePriority(PhotoCapturePriority priority) = 0;
+};
+
+// Implements |CameraControls| for a Media Foundation video capture source.
+//
+// Controls are set through |IMFExtendedCameraController| where the camera
+// supports them, and otherwise through the |IAMCameraControl|,
+// |IAMVideoProcAmp| and |IKsControl| interfaces of the source. The control
+// interfaces and the control ranges are queried once, and reused for the
+// lifetime of the controls.
+class CameraControlsImpl : public CameraControls {
+ public:
+  explicit CameraControlsImpl(IMFMediaSource* video_source);
+  ~CameraControlsImpl() override = default;
+
+  // Disallow copy and move.
+  CameraControlsImpl(const CameraControlsImpl&) = delete;
+  CameraControlsImpl& operator=(const CameraControlsImpl&) = delete;
+
+  // CameraControls
+  HRESULT SetExposureMode(CameraControlMode mode) override;
+  HRESULT SetFocusMode(CameraControlMode mode) override;
+  HRESULT SetWhiteBalanceMode(CameraControlMode mode) override;
+  ExposureOffsetRange GetExposureOffsetRange() override;
+  HRESULT SetExposureOffset(double offset, double* applied_offset) override;
+  HRESULT SetFrameRateLock(bool locked) override;
+  HRESULT SetFlashMode(CameraFlashMode mode) override;
+  HRESULT SetPhotoCapturePriority(PhotoCapturePriority priority) override;
+
+ private:
+  // Range of an |IAMCameraControl| or |IAMVideoProcAmp| property.
+  struct PropertyRange {
+    HRESULT result = E_FAIL;
+    long min = 0;
+    long max = 0;
+    long step = 0;
+    long default_value = 0;
+    long flags = 0;
+  };
+
+  // Returns the extended control for |property_id|, or nullptr if the camera
+  // does not support it.
+  IMFExtendedCameraControl* GetExtendedControl(ULONG property_id);
+
+  // Sets a video processing control of the extended controller, such as
+  // the exposure or white balance mode, to automatic or locked.
+  HRESULT SetExtendedVideoProcMode(ULONG property_id, CameraControlMode mode);
+
+  // Sets an extended control whose mode is selected by its flags, such as
+  // the flash or torch mode, to |flags|.
+  //
+  // Returns E_NOTIMPL if the control does not support all of |flags|.
+  HRESULT SetExtendedControlFlags(ULONG property_id, ULONGLONG flags);
+
+  // Sets the flash control for |flash_mode_| and |photo_capture_priority_|.
+  HRESULT ApplyFlashMode();
+
+  // Returns the range of an |IAMCameraControl| property.
+  const PropertyRange& GetCameraControlRange(long property);
+
+  // Sets an |IAMCameraControl| property to automatic, or to manual at its
+  // current value.
+  HRESULT SetCameraControlMode(long property, CameraControlMode mode);
+
+  // Returns the frame rate of the current media type of the video source, or
+  // 0 if it cannot be read.
+  float GetCurrentFrameRate() const;
+
+  ComPtr<IMFMediaSource> video_source_;
+  ComPtr<IMFExtendedCameraController> extended_controller_;
+  ComPtr<IAMCameraControl> camera_control_;
+  ComPtr<IAMVideoProcAmp> video_proc_amp_;
+  ComPtr<IKsControl> ks_control_;
+  std::map<ULONG, ComPtr<IMFExtendedCameraControl>> extended_controls_;
+  std::map<long, PropertyRange> camera_control_ranges_;
+
+  // Exposure flags before the frame rate was locked by setting a manual
+  // exposure, or 0 if it was not.
+  long exposure_flags_before_frame_rate_lock_ = 0;
+
+  CameraFlashMode flash_mode_ = CameraFlashMode::kOff;
+  PhotoCapturePriority photo_capture_priority_ =
+      PhotoCapturePriority::kBalanced;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAMERA_CONTROLS_H_
@@ -5,105 +5,263 @@
 #include "camera_plugin.h"
 
 #include <flutter/flutter_view.h>
-#include <flutter/method_channel.h>
+#include <flutter/method_result_functions.h>
 #include <flutter/plugin_registrar_windows.h>
-#include <flutter/standard_method_codec.h>
 #include <mfapi.h>
 #include <mfidl.h>
 #include <shlobj.h>
 #include <shobjidl.h>
+#include <dbt.h>
 #include <windows.h>
 
+#include <any>
 #include <cassert>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <memory>
 
 #include "capture_device_info.h"
 #include "com_heap_ptr.h"
 #include "string_utils.h"
+#include "tracing.h"
 
 namespace camera_windows {
+using flutter::CustomEncodableValue;
 using flutter::EncodableList;
-using flutter::EncodableMap;
 using flutter::EncodableValue;
+using windows_plugin_utils::Utf8FromUtf16;
 
 namespace {
 
-// Channel events
-constexpr char kChannelName[] = "plugins.flutter.io/camera_windows";
-
-constexpr char kAvailableCamerasMethod[] = "availableCameras";
-constexpr char kCreateMethod[] = "create";
-constexpr char kInitializeMethod[] = "initialize";
-constexpr char kTakePictureMethod[] = "takePicture";
-constexpr char kStartVideoRecordingMethod[] = "startVideoRecording";
-constexpr char kStopVideoRecordingMethod[] = "stopVideoRecording";
-constexpr char kPausePreview[] = "pausePreview";
-constexpr char kResumePreview[] = "resumePreview";
-constexpr char kDisposeMethod[] = "dispose";
-
-constexpr char kCameraNameKey[] = "cameraName";
-constexpr char kResolutionPresetKey[] = "resolutionPreset";
-constexpr char kEnableAudioKey[] = "enableAudio";
-
-constexpr char kCameraIdKey[] = "cameraId";
-constexpr char kMaxVideoDurationKey[] = "maxVideoDuration";
-
-constexpr char kResolutionPresetValueLow[] = "low";
-constexpr char kResolutionPresetValueMedium[] = "medium";
-constexpr char kResolutionPresetValueHigh[] = "high";
-constexpr char kResolutionPresetValueVeryHigh[] = "veryHigh";
-constexpr char kResolutionPresetValueUltraHigh[] = "ultraHigh";
-constexpr char kResolutionPresetValueMax[] = "max";
+// KSCATEGORY_VIDEO_CAMERA, the device interface class of the cameras
+// enumerated by Media Foundation.
+constexpr GUID kVideoCameraInterfaceCategory = {
+    0xe5323777,
+    0xf976,
+    0x4f5b,
+    {0x9b, 0x55, 0xb9, 0x46, 0x99, 0xc4, 0x6e, 0x44}};
+
+// Name of the window message posted when the worker thread has enumerated
+// the available cameras.
+constexpr wchar_t kCamerasEnumeratedMessageName[] =
+    L"FlutterCameraWindowsCamerasEnumerated";
+
+// Name of the window message posted when capture controller callbacks are
+// queued for the platform thread.
+constexpr wchar_t kPlatformTasksMessageName[] =
+    L"FlutterCameraWindowsPlatformTasks";
+
+constexpr uint32_t kMaxVideoQuality = 100;
+constexpr uint32_t kMaxPictureQuality = 100;
+
+// Maximum number of photos of a single burst.
+constexpr uint32_t kMaxPictureBurstCount = 30;
 
 const std::string kPictureCaptureExtension = "jpeg";
 const std::string kVideoCaptureExtension = "mp4";
 
-// Looks for |key| in |map|, returning the associated value if it is present, or
-// a nullptr if not.
-const EncodableValue* ValueOrNull(const EncodableMap& map, const char* key) {
-  auto it = map.find(EncodableValue(key));
-  if (it == map.end()) {
-    return nullptr;
+// Returns the positive |value| clamped to the uint32 range, or 0 if it is
+// null.
+uint32_t ClampToUint32(const int64_t* value) {
+  if (!value || *value <= 0) {
+    return 0;
   }
-  return &(it->second);
+  return *value > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(*value);
 }
 
-// Looks for |key| in |map|, returning the associated int64 value if it is
-// present, or std::nullopt if not.
-std::optional<int64_t> GetInt64ValueOrNull(const EncodableMap& map,
-                                           const char* key) {
-  auto value = ValueOrNull(map, key);
-  if (!value) {
-    return std::nullopt;
+// Returns the ResolutionPreset of |preset|, or kAuto if it is null.
+ResolutionPreset GetResolutionPreset(const PlatformResolutionPreset* preset) {
+  if (!preset) {
+    return ResolutionPreset::kAuto;
+  }
+  switch (*preset) {
+    case PlatformResolutionPreset::low:
+      return ResolutionPreset::kLow;
+    case PlatformResolutionPreset::medium:
+      return ResolutionPreset::kMedium;
+    case PlatformResolutionPreset::high:
+      return ResolutionPreset::kHigh;
+    case PlatformResolutionPreset::veryHigh:
+      return ResolutionPreset::kVeryHigh;
+    case PlatformResolutionPreset::ultraHigh:
+      return ResolutionPreset::kUltraHigh;
+    case PlatformResolutionPreset::max:
+      return ResolutionPreset::kMax;
   }
+  return ResolutionPreset::kAuto;
+}
 
-  if (std::holds_alternative<int32_t>(*value)) {
-    return static_cast<int64_t>(std::get<int32_t>(*value));
+// Returns the VideoRateControlMode of |mode|, or kDefault if it is null.
+VideoRateControlMode GetRateControlMode(const PlatformRateControlMode* mode) {
+  if (!mode) {
+    return VideoRateControlMode::kDefault;
   }
-  auto val64 = std::get_if<int64_t>(value);
-  if (!val64) {
-    return std::nullopt;
+  switch (*mode) {
+    case PlatformRateControlMode::constantBitrate:
+      return VideoRateControlMode::kConstantBitrate;
+    case PlatformRateControlMode::variableBitrate:
+      return VideoRateControlMode::kVariableBitrate;
+    case PlatformRateControlMode::quality:
+      return VideoRateControlMode::kQuality;
   }
-  return *val64;
+  return VideoRateControlMode::kDefault;
 }
 
-// Parses resolution preset argument to enum value.
-ResolutionPreset ParseResolutionPreset(const std::string& resolution_preset) {
-  if (resolution_preset.compare(kResolutionPresetValueLow) == 0) {
-    return ResolutionPreset::kLow;
-  } else if (resolution_preset.compare(kResolutionPresetValueMedium) == 0) {
-    return ResolutionPreset::kMedium;
-  } else if (resolution_preset.compare(kResolutionPresetValueHigh) == 0) {
-    return ResolutionPreset::kHigh;
-  } else if (resolution_preset.compare(kResolutionPresetValueVeryHigh) == 0) {
-    return ResolutionPreset::kVeryHigh;
-  } else if (resolution_preset.compare(kResolutionPresetValueUltraHigh) == 0) {
-    return ResolutionPreset::kUltraHigh;
-  } else if (resolution_preset.compare(kResolutionPresetValueMax) == 0) {
-    return ResolutionPreset::kMax;
+// Returns the CameraFlashMode of |mode|.
+CameraFlashMode GetCameraFlashMode(PlatformFlashMode mode) {
+  switch (mode) {
+    case PlatformFlashMode::off:
+      return CameraFlashMode::kOff;
+    case PlatformFlashMode::autoFlash:
+      return CameraFlashMode::kAuto;
+    case PlatformFlashMode::always:
+      return CameraFlashMode::kAlways;
+    case PlatformFlashMode::torch:
+      return CameraFlashMode::kTorch;
   }
-  return ResolutionPreset::kAuto;
+  return CameraFlashMode::kOff;
+}
+
+// Returns the camera control mode of a control that is |locked| or
+// automatic.
+CameraControlMode GetCameraControlMode(bool locked) {
+  return locked ? CameraControlMode::kLocked : CameraControlMode::kAuto;
+}
+
+// Returns the error of a failed camera control call for |control|.
+FlutterError GetCameraControlError(HRESULT hr, const std::string& control) {
+  if (hr == E_NOTIMPL) {
+    return FlutterError("camera_error",
+                        "Camera does not support setting " + control);
+  }
+  return FlutterError("camera_error", "Failed to set " + control);
+}
+
+// Returns the encoder settings of a StartVideoRecording call.
+VideoRecordSettings GetVideoRecordSettings(
+    const PlatformVideoRecordingSettings& platform_settings) {
+  VideoRecordSettings settings;
+  if (platform_settings.video_codec() == PlatformVideoCodec::hevc) {
+    settings.codec = VideoCodec::kHEVC;
+  }
+  settings.prefer_hardware_encoder =
+      platform_settings.prefer_hardware_encoder();
+  settings.rate_control_mode =
+      GetRateControlMode(platform_settings.rate_control_mode());
+  settings.bitrate = ClampToUint32(platform_settings.bitrate());
+  settings.quality = ClampToUint32(platform_settings.quality());
+  if (settings.quality > kMaxVideoQuality) {
+    settings.quality = kMaxVideoQuality;
+  }
+  settings.keyframe_interval =
+      ClampToUint32(platform_settings.keyframe_interval());
+  settings.stream_chunks = platform_settings.stream_chunks();
+  settings.audio_sample_rate =
+      ClampToUint32(platform_settings.audio_sample_rate());
+  settings.audio_channels = ClampToUint32(platform_settings.audio_channels());
+  settings.audio_bitrate = ClampToUint32(platform_settings.audio_bitrate());
+  settings.proxy_height = ClampToUint32(platform_settings.proxy_height());
+  settings.proxy_bitrate = ClampToUint32(platform_settings.proxy_bitrate());
+  return settings;
+}
+
+// Returns the picture encoder settings of a TakePictureData call.
+PhotoSettings GetPhotoSettings(PlatformPictureFormat format,
+                               const int64_t* quality) {
+  PhotoSettings settings;
+  if (format == PlatformPictureFormat::png) {
+    settings.format = PhotoFormat::kPng;
+  }
+  settings.quality = ClampToUint32(quality);
+  if (settings.quality > kMaxPictureQuality) {
+    settings.quality = kMaxPictureQuality;
+  }
+  return settings;
+}
+
+// Returns the value sent to a pending camera result as the reply type |T|.
+template <typename T>
+T GetReplyValue(const EncodableValue& value) {
+  return std::get<T>(value);
+}
+
+template <>
+int64_t GetReplyValue<int64_t>(const EncodableValue& value) {
+  return value.LongValue();
+}
+
+template <>
+PlatformSize GetReplyValue<PlatformSize>(const EncodableValue& value) {
+  return std::any_cast<PlatformSize>(std::get<CustomEncodableValue>(value));
+}
+
+// Returns the error sent to a pending camera result.
+FlutterError GetReplyError(const std::string& error_code,
+                           const std::string& error_message,
+                           const EncodableValue* details) {
+  return FlutterError(error_code, error_message,
+                      details ? *details : EncodableValue());
+}
+
+// Wraps |result| in a MethodResult, so that it can be stored as a pending
+// result of a camera until the capture controller completes the request.
+template <typename T>
+std::unique_ptr<MethodResult<>> WrapResult(
+    std::function<void(ErrorOr<T> reply)> result) {
+  return std::make_unique<flutter::MethodResultFunctions<>>(
+      [result](const EncodableValue* value) {
+        assert(value);
+        result(GetReplyValue<T>(*value));
+      },
+      [result](const std::string& error_code, const std::string& error_message,
+               const EncodableValue* details) {
+        result(GetReplyError(error_code, error_message, details));
+      },
+      nullptr);
+}
+
+std::unique_ptr<MethodResult<>> WrapResult(
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  return std::make_unique<flutter::MethodResultFunctions<>>(
+      [result](const EncodableValue* value) { result(std::nullopt); },
+      [result](const std::string& error_code, const std::string& error_message,
+               const EncodableValue* details) {
+        result(GetReplyError(error_code, error_message, details));
+      },
+      nullptr);
+}
+
+// Returns the photo rotation of |degrees| clockwise, or std::nullopt if it is
+// not a multiple of 90 degrees in range 0 to 270.
+std::optional<PhotoRotation> ParsePhotoRotation(int64_t degrees) {
+  switch (degrees) {
+    case 0:
+      return PhotoRotation::kNone;
+    case 90:
+      return PhotoRotation::kRotate90;
+    case 180:
+      return PhotoRotation::kRotate180;
+    case 270:
+      return PhotoRotation::kRotate270;
+  }
+  return std::nullopt;
+}
+
+// Returns the preview rotation of |degrees| clockwise, or std::nullopt if it
+// is not a multiple of 90 degrees in range 0 to 270.
+std::optional<PreviewRotation> ParsePreviewRotation(int64_t degrees) {
+  switch (degrees) {
+    case 0:
+      return PreviewRotation::kNone;
+    case 90:
+      return PreviewRotation::kRotate90;
+    case 180:
+      return PreviewRotation::kRotate180;
+    case 270:
+      return PreviewRotation::kRotate270;
+  }
+  return std::nullopt;
 }
 
 // Builds CaptureDeviceInfo object from given device holding device name and id.
@@ -128,8 +286,9 @@ std::unique_ptr<CaptureDeviceInfo> GetDeviceInfo(IMFActivate* device) {
     return device_info;
   }
 
-  device_info->SetDisplayName(Utf8FromUtf16(std::wstring(name, name_size)));
-  device_info->SetDeviceID(Utf8FromUtf16(std::wstring(id, id_size)));
+  device_info->SetDisplayName(
+      Utf8FromUtf16(std::wstring_view(name, name_size)));
+  device_info->SetDeviceID(Utf8FromUtf16(std::wstring_view(id, id_size)));
   return device_info;
 }
 
@@ -167,12 +326,29 @@ std::optional<std::string> GetFilePathForPicture() {
     return std::nullopt;
   }
 
-  std::string path = Utf8FromUtf16(std::wstring(known_folder_path));
+  std::string path = Utf8FromUtf16(std::wstring_view(known_folder_path));
 
   return path + "\\" + "PhotoCapture_" + GetCurrentTimeString() + "." +
          kPictureCaptureExtension;
 }
 
+// Builds file paths for a picture burst, numbered in capture order.
+std::optional<std::vector<std::string>> GetFilePathsForPictureBurst(
+    uint32_t count) {
+  std::optional<std::string> path = GetFilePathForPicture();
+  if (!path) {
+    return std::nullopt;
+  }
+
+  const std::string extension = "." + kPictureCaptureExtension;
+  const std::string base = path->substr(0, path->size() - extension.size());
+  std::vector<std::string> paths;
+  for (uint32_t i = 0; i < count; i++) {
+    paths.push_back(base + "_" + std::to_string(i + 1) + extension);
+  }
+  return paths;
+}
+
 // Builds file path for video capture.
 std::optional<std::string> GetFilePathForVideo() {
   ComHeapPtr<wchar_t> known_folder_path;
@@ -182,7 +358,7 @@ std::optional<std::string> GetFilePathForVideo() {
     return std::nullopt;
   }
 
-  std::string path = Utf8FromUtf16(std::wstring(known_folder_path));
+  std::string path = Utf8FromUtf16(std::wstring_view(known_folder_path));
 
   return path + "\\" + "VideoCapture_" + GetCurrentTimeString() + "." +
          kVideoCaptureExtension;
@@ -192,94 +368,81 @@ std::optional<std::string> GetFilePathForVideo() {
 // static
 void CameraPlugin::RegisterWithRegistrar(
     flutter::PluginRegistrarWindows* registrar) {
-  auto channel = std::make_unique<flutter::MethodChannel<>>(
-      registrar->messenger(), kChannelName,
-      &flutter::StandardMethodCodec::GetInstance());
-
   std::unique_ptr<CameraPlugin> plugin = std::make_unique<CameraPlugin>(
       registrar->texture_registrar(), registrar->messenger());
 
-  channel->SetMethodCallHandler(
-      [plugin_pointer = plugin.get()](const auto& call, auto result) {
-        plugin_pointer->HandleMethodCall(call, std::move(result));
-      });
+  CameraApi::SetUp(registrar->messenger(), plugin.get());
 
+  plugin->EnableDeviceMonitoring(registrar);
   registrar->AddPlugin(std::move(plugin));
 }
 
 CameraPlugin::CameraPlugin(flutter::TextureRegistrar* texture_registrar,
                            flutter::BinaryMessenger* messenger)
-    : texture_registrar_(texture_registrar),
-      messenger_(messenger),
-      camera_factory_(std::make_unique<CameraFactoryImpl>()) {}
+    : dispatcher_(std::make_shared<PlatformThreadDispatcher>()),
+      camera_factory_(std::make_unique<CameraFactoryImpl>(dispatcher_)),
+      texture_registrar_(texture_registrar),
+      messenger_(messenger) {
+  RegisterTraceProvider();
+}
 
 CameraPlugin::CameraPlugin(flutter::TextureRegistrar* texture_registrar,
                            flutter::BinaryMessenger* messenger,
                            std::unique_ptr<CameraFactory> camera_factory)
-    : texture_registrar_(texture_registrar),
-      messenger_(messenger),
-      camera_factory_(std::move(camera_factory)) {}
-
-CameraPlugin::~CameraPlugin() {}
-
-void CameraPlugin::HandleMethodCall(
-    const flutter::MethodCall<>& method_call,
-    std::unique_ptr<flutter::MethodResult<>> result) {
-  const std::string& method_name = method_call.method_name();
-
-  if (method_name.compare(kAvailableCamerasMethod) == 0) {
-    return AvailableCamerasMethodHandler(std::move(result));
-  } else if (method_name.compare(kCreateMethod) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return CreateMethodHandler(*arguments, std::move(result));
-  } else if (method_name.compare(kInitializeMethod) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return this->InitializeMethodHandler(*arguments, std::move(result));
-  } else if (method_name.compare(kTakePictureMethod) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return TakePictureMethodHandler(*arguments, std::move(result));
-  } else if (method_name.compare(kStartVideoRecordingMethod) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return StartVideoRecordingMethodHandler(*arguments, std::move(result));
-  } else if (method_name.compare(kStopVideoRecordingMethod) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return StopVideoRecordingMethodHandler(*arguments, std::move(result));
-  } else if (method_name.compare(kPausePreview) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return PausePreviewMethodHandler(*arguments, std::move(result));
-  } else if (method_name.compare(kResumePreview) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return ResumePreviewMethodHandler(*arguments, std::move(result));
-  } else if (method_name.compare(kDisposeMethod) == 0) {
-    const auto* arguments =
-        std::get_if<flutter::EncodableMap>(method_call.arguments());
-    assert(arguments);
-
-    return DisposeMethodHandler(*arguments, std::move(result));
-  } else {
-    result->NotImplemented();
+    : dispatcher_(std::make_shared<PlatformThreadDispatcher>()),
+      camera_factory_(std::move(camera_factory)),
+      texture_registrar_(texture_registrar),
+      messenger_(messenger) {
+  RegisterTraceProvider();
+}
+
+CameraPlugin::~CameraPlugin() {
+  // Callbacks of cameras destroyed with the plugin run immediately, as the
+  // window message is no longer handled.
+  dispatcher_->SetWindow(nullptr, 0);
+  if (device_notification_) {
+    UnregisterDeviceNotification(device_notification_);
   }
+  if (registrar_ && window_proc_delegate_id_ >= 0) {
+    registrar_->UnregisterTopLevelWindowProcDelegate(window_proc_delegate_id_);
+  }
+  if (enumeration_thread_.joinable()) {
+    enumeration_thread_.join();
+  }
+  UnregisterTraceProvider();
+}
+
+void CameraPlugin::EnableDeviceMonitoring(
+    flutter::PluginRegistrarWindows* registrar) {
+  assert(registrar);
+  assert(!registrar_);
+
+  flutter::FlutterView* view = registrar->GetView();
+  HWND window = view ? GetAncestor(view->GetNativeWindow(), GA_ROOT) : nullptr;
+  if (!window) {
+    return;
+  }
+
+  registrar_ = registrar;
+  window_ = window;
+  enumeration_complete_message_ =
+      RegisterWindowMessage(kCamerasEnumeratedMessageName);
+  platform_tasks_message_ = RegisterWindowMessage(kPlatformTasksMessageName);
+  dispatcher_->SetWindow(window_, platform_tasks_message_);
+  window_proc_delegate_id_ = registrar->RegisterTopLevelWindowProcDelegate(
+      [this](HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam) {
+        return HandleWindowProc(hwnd, message, wparam, lparam);
+      });
+
+  DEV_BROADCAST_DEVICEINTERFACE filter = {};
+  filter.dbcc_size = sizeof(filter);
+  filter.dbcc_devicetype = DBT_DEVTYP_DEVICEINTERFACE;
+  filter.dbcc_classguid = kVideoCameraInterfaceCategory;
+  device_notification_ =
+      RegisterDeviceNotification(window_, &filter, DEVICE_NOTIFY_WINDOW_HANDLE);
+
+  // Cameras can only be cached while changes are observed.
+  cache_available_cameras_ = device_notification_ != nullptr;
 }
 
 Camera* CameraPlugin::GetCameraByDeviceId(std::string& device_id) {
@@ -304,41 +467,168 @@ void CameraPlugin::DisposeCameraByCameraId(int64_t camera_id) {
   for (auto it = begin(cameras_); it != end(cameras_); ++it) {
     if ((*it)->HasCameraId(camera_id)) {
       cameras_.erase(it);
+      if (cameras_.empty()) {
+        // Shuts down Media Foundation once the last camera is released.
+        capture_context_ = nullptr;
+      }
       return;
     }
   }
 }
 
-void CameraPlugin::AvailableCamerasMethodHandler(
-    std::unique_ptr<flutter::MethodResult<>> result) {
-  // Enumerate devices.
-  ComHeapPtr<IMFActivate*> devices;
-  UINT32 count = 0;
-  if (!this->EnumerateVideoCaptureDeviceSources(&devices, &count)) {
-    result->Error("System error", "Failed to get available cameras");
-    // No need to free devices here, cos allocation failed.
+void CameraPlugin::GetAvailableCameras(
+    std::function<void(ErrorOr<EncodableList> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "getAvailableCameras");
+  if (available_cameras_) {
+    result(*available_cameras_);
     return;
   }
 
-  if (count == 0) {
-    result->Success(EncodableValue(EncodableList()));
+  if (!window_) {
+    // Enumerate devices.
+    EncodableList cameras;
+    if (!EnumerateAvailableCameras(&cameras)) {
+      result(FlutterError("System error", "Failed to get available cameras"));
+      return;
+    }
+
+    if (cache_available_cameras_) {
+      available_cameras_ = cameras;
+    }
+    result(std::move(cameras));
     return;
   }
 
+  // Waits for the enumeration that is already running, if any.
+  pending_available_cameras_.push_back(std::move(result));
+  if (pending_available_cameras_.size() > 1) {
+    return;
+  }
+
+  if (enumeration_thread_.joinable()) {
+    enumeration_thread_.join();
+  }
+
+  const uint64_t generation = available_cameras_generation_;
+  enumeration_thread_ = std::thread([this, generation]() {
+    // Media Foundation device enumeration requires COM on the worker thread.
+    HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+    EncodableList cameras;
+    bool success = EnumerateAvailableCameras(&cameras);
+    if (SUCCEEDED(hr)) {
+      CoUninitialize();
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock(enumeration_mutex_);
+      if (success) {
+        enumerated_cameras_ = std::move(cameras);
+      } else {
+        enumerated_cameras_ = std::nullopt;
+      }
+      enumerated_cameras_generation_ = generation;
+    }
+    PostMessage(window_, enumeration_complete_message_, 0, 0);
+  });
+}
+
+bool CameraPlugin::EnumerateAvailableCameras(EncodableList* cameras) {
+  assert(cameras);
+
+  ComHeapPtr<IMFActivate*> devices;
+  UINT32 count = 0;
+  if (!this->EnumerateVideoCaptureDeviceSources(&devices, &count)) {
+    // No need to free devices here, cos allocation failed.
+    return false;
+  }
+
   // Format found devices to the response.
-  EncodableList devices_list;
   for (UINT32 i = 0; i < count; ++i) {
     auto device_info = GetDeviceInfo(devices[i]);
-    auto deviceName = device_info->GetUniqueDeviceName();
+    cameras->push_back(EncodableValue(device_info->GetUniqueDeviceName()));
+  }
+  return true;
+}
+
+std::optional<LRESULT> CameraPlugin::HandleWindowProc(HWND hwnd, UINT message,
+                                                      WPARAM wparam,
+                                                      LPARAM lparam) {
+  if (message == enumeration_complete_message_) {
+    OnAvailableCamerasEnumerated();
+    return 0;
+  }
+
+  if (message == platform_tasks_message_) {
+    dispatcher_->RunPendingTasks();
+    return 0;
+  }
+
+  if (message == WM_DEVICECHANGE &&
+      (wparam == DBT_DEVICEARRIVAL || wparam == DBT_DEVICEREMOVECOMPLETE)) {
+    const auto* header = reinterpret_cast<const DEV_BROADCAST_HDR*>(lparam);
+    if (header && header->dbch_devicetype == DBT_DEVTYP_DEVICEINTERFACE &&
+        reinterpret_cast<const DEV_BROADCAST_DEVICEINTERFACE*>(header)
+                ->dbcc_classguid == kVideoCameraInterfaceCategory) {
+      OnAvailableCamerasChanged();
+    }
+  }
+
+  // Minimizing, hiding or showing the window resizes it or changes its
+  // position.
+  if (message == WM_SIZE || message == WM_WINDOWPOSCHANGED) {
+    OnWindowVisibilityChanged(IsIconic(hwnd) || !IsWindowVisible(hwnd));
+  }
+
+  // Device change and window messages are left to other handlers of the
+  // window.
+  return std::nullopt;
+}
+
+void CameraPlugin::OnWindowVisibilityChanged(bool hidden) {
+  if (hidden == preview_window_hidden_) {
+    return;
+  }
+  preview_window_hidden_ = hidden;
+  for (const auto& camera : cameras_) {
+    if (CaptureController* cc = camera->GetCaptureController()) {
+      cc->SetPreviewWindowHidden(hidden);
+    }
+  }
+}
+
+void CameraPlugin::OnAvailableCamerasEnumerated() {
+  std::optional<EncodableList> cameras;
+  uint64_t generation;
+  {
+    const std::lock_guard<std::mutex> lock(enumeration_mutex_);
+    cameras = std::move(enumerated_cameras_);
+    enumerated_cameras_ = std::nullopt;
+    generation = enumerated_cameras_generation_;
+  }
 
-    devices_list.push_back(EncodableMap({
-        {EncodableValue("name"), EncodableValue(deviceName)},
-        {EncodableValue("lensFacing"), EncodableValue("front")},
-        {EncodableValue("sensorOrientation"), EncodableValue(0)},
-    }));
+  if (cameras && cache_available_cameras_ &&
+      generation == available_cameras_generation_) {
+    available_cameras_ = cameras;
   }
 
-  result->Success(std::move(EncodableValue(devices_list)));
+  std::vector<std::function<void(ErrorOr<EncodableList> reply)>> results =
+      std::move(pending_available_cameras_);
+  pending_available_cameras_.clear();
+  for (auto& result : results) {
+    if (cameras) {
+      result(*cameras);
+    } else {
+      result(FlutterError("System error", "Failed to get available cameras"));
+    }
+  }
+}
+
+void CameraPlugin::OnAvailableCamerasChanged() {
+  available_cameras_ = std::nullopt;
+  available_cameras_generation_++;
+
+  CameraEventApi event_api(messenger_);
+  event_api.CamerasChanged([] {}, [](const FlutterError&) {});
 }
 
 bool CameraPlugin::EnumerateVideoCaptureDeviceSources(IMFActivate*** devices,
@@ -347,250 +637,757 @@ bool CameraPlugin::EnumerateVideoCaptureDeviceSources(IMFActivate*** devices,
                                                                    count);
 }
 
-void CameraPlugin::CreateMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  // Parse enableAudio argument.
-  const auto* record_audio =
-      std::get_if<bool>(ValueOrNull(args, kEnableAudioKey));
-  if (!record_audio) {
-    return result->Error("argument_error",
-                         std::string(kEnableAudioKey) + " argument missing");
+bool CameraPlugin::EnumerateAudioCaptureDeviceSources(IMFActivate*** devices,
+                                                      UINT32* count) {
+  return CaptureControllerImpl::EnumerateAudioCaptureDeviceSources(devices,
+                                                                   count);
+}
+
+ErrorOr<EncodableList> CameraPlugin::GetAvailableAudioDevices() {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "getAvailableAudioDevices");
+  ComHeapPtr<IMFActivate*> devices;
+  UINT32 count = 0;
+  if (!this->EnumerateAudioCaptureDeviceSources(&devices, &count)) {
+    return FlutterError("System error",
+                        "Failed to get available audio devices");
+  }
+
+  EncodableList audio_devices;
+  for (UINT32 i = 0; i < count; ++i) {
+    ComHeapPtr<wchar_t> name;
+    UINT32 name_size;
+    ComHeapPtr<wchar_t> id;
+    UINT32 id_size;
+    if (SUCCEEDED(devices[i]->GetAllocatedString(
+            MF_DEVSOURCE_ATTRIBUTE_FRIENDLY_NAME, &name, &name_size)) &&
+        SUCCEEDED(devices[i]->GetAllocatedString(
+            MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_ENDPOINT_ID, &id,
+            &id_size))) {
+      audio_devices.push_back(CustomEncodableValue(PlatformAudioDevice(
+          Utf8FromUtf16(std::wstring_view(name, name_size)),
+          Utf8FromUtf16(std::wstring_view(id, id_size)))));
+    }
+    devices[i]->Release();
+  }
+  return audio_devices;
+}
+
+bool CameraPlugin::EnsureCaptureContext() {
+  // All cameras capture through the same Media Foundation and D3D11 state.
+  if (!capture_context_) {
+    auto capture_context = std::make_shared<CaptureContext>();
+    if (FAILED(capture_context->Initialize())) {
+      return false;
+    }
+    capture_context_ = std::move(capture_context);
   }
+  return true;
+}
 
-  // Parse cameraName argument.
-  const auto* camera_name =
-      std::get_if<std::string>(ValueOrNull(args, kCameraNameKey));
-  if (!camera_name) {
-    return result->Error("argument_error",
-                         std::string(kCameraNameKey) + " argument missing");
+ErrorOr<CameraControls*> CameraPlugin::GetCameraControls(int64_t camera_id) {
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
   }
 
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  CameraControls* controls = cc->GetCameraControls();
+  if (!controls) {
+    return FlutterError("camera_error", "Camera not initialized");
+  }
+  return controls;
+}
+
+std::optional<FlutterError> CameraPlugin::Prewarm(
+    const std::string& camera_name) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "prewarm");
   auto device_info = std::make_unique<CaptureDeviceInfo>();
-  if (!device_info->ParseDeviceInfoFromCameraName(*camera_name)) {
-    return result->Error(
-        "camera_error", "Cannot parse argument " + std::string(kCameraNameKey));
+  if (!device_info->ParseDeviceInfoFromCameraName(camera_name)) {
+    return FlutterError("camera_error", "Cannot parse argument cameraName");
+  }
+
+  if (!EnsureCaptureContext()) {
+    return FlutterError("camera_error", "Failed to initialize capture");
+  }
+
+  // Completes immediately, a create call for the device waits for the
+  // prewarm to finish.
+  capture_context_->PrewarmDevice(device_info->GetDeviceId());
+  return std::nullopt;
+}
+
+void CameraPlugin::Create(const std::string& camera_name,
+                          const PlatformMediaSettings& settings,
+                          std::function<void(ErrorOr<int64_t> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "create");
+  auto device_info = std::make_unique<CaptureDeviceInfo>();
+  if (!device_info->ParseDeviceInfoFromCameraName(camera_name)) {
+    return result(
+        FlutterError("camera_error", "Cannot parse argument cameraName"));
   }
 
   auto device_id = device_info->GetDeviceId();
   if (GetCameraByDeviceId(device_id)) {
-    return result->Error("camera_error",
-                         "Camera with given device id already exists. Existing "
-                         "camera must be disposed before creating it again.");
+    return result(
+        FlutterError("camera_error",
+                     "Camera with given device id already exists. Existing "
+                     "camera must be disposed before creating it again."));
+  }
+
+  if (!EnsureCaptureContext()) {
+    return result(
+        FlutterError("camera_error", "Failed to initialize capture"));
   }
 
   std::unique_ptr<camera_windows::Camera> camera =
       camera_factory_->CreateCamera(device_id);
 
   if (camera->HasPendingResultByType(PendingResultType::kCreateCamera)) {
-    return result->Error("camera_error",
-                         "Pending camera creation request exists");
+    return result(
+        FlutterError("camera_error", "Pending camera creation request exists"));
   }
 
   if (camera->AddPendingResult(PendingResultType::kCreateCamera,
-                               std::move(result))) {
-    // Parse resolution preset argument.
-    const auto* resolution_preset_argument =
-        std::get_if<std::string>(ValueOrNull(args, kResolutionPresetKey));
-    ResolutionPreset resolution_preset;
-    if (resolution_preset_argument) {
-      resolution_preset = ParseResolutionPreset(*resolution_preset_argument);
-    } else {
-      resolution_preset = ResolutionPreset::kAuto;
+                               WrapResult(std::move(result)))) {
+    CaptureSettings capture_settings;
+    capture_settings.record_audio = settings.enable_audio();
+    capture_settings.resolution_preset =
+        GetResolutionPreset(settings.resolution_preset());
+    if (settings.audio_device_id()) {
+      capture_settings.audio_device_id = *settings.audio_device_id();
+    }
+    if (settings.preview_texture_mode() ==
+        PlatformPreviewTextureMode::gpuSurface) {
+      capture_settings.preview_texture_mode = PreviewTextureMode::kGpuSurface;
+    }
+    capture_settings.adaptive_preview = settings.adaptive_preview();
+    capture_settings.target_frame_rate =
+        ClampToUint32(settings.target_frame_rate());
+    if (settings.preview_pixel_format() == PlatformPreviewPixelFormat::nv12) {
+      capture_settings.preview_pixel_format = PreviewPixelFormat::kNV12;
+    }
+    capture_settings.zero_shutter_lag = settings.zero_shutter_lag();
+    capture_settings.preview_stats = settings.preview_stats();
+    capture_settings.preview_max_frame_rate =
+        ClampToUint32(settings.preview_max_frame_rate());
+    if (settings.capture_backend() == PlatformCaptureBackend::sourceReader) {
+      capture_settings.capture_backend = CaptureBackend::kSourceReader;
     }
 
-    bool initialized = camera->InitCamera(texture_registrar_, messenger_,
-                                          *record_audio, resolution_preset);
+    bool initialized =
+        camera->InitCamera(texture_registrar_, messenger_, capture_settings,
+                           capture_context_);
     if (initialized) {
+      if (preview_window_hidden_) {
+        camera->GetCaptureController()->SetPreviewWindowHidden(true);
+      }
       cameras_.push_back(std::move(camera));
     }
   }
 }
 
-void CameraPlugin::InitializeMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  auto camera_id = GetInt64ValueOrNull(args, kCameraIdKey);
-  if (!camera_id) {
-    return result->Error("argument_error",
-                         std::string(kCameraIdKey) + " missing");
-  }
-
-  auto camera = GetCameraByCameraId(*camera_id);
+void CameraPlugin::Initialize(
+    int64_t camera_id,
+    std::function<void(ErrorOr<PlatformSize> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "initialize");
+  auto camera = GetCameraByCameraId(camera_id);
   if (!camera) {
-    return result->Error("camera_error", "Camera not created");
+    return result(FlutterError("camera_error", "Camera not created"));
   }
 
   if (camera->HasPendingResultByType(PendingResultType::kInitialize)) {
-    return result->Error("camera_error",
-                         "Pending initialization request exists");
+    return result(
+        FlutterError("camera_error", "Pending initialization request exists"));
   }
 
   if (camera->AddPendingResult(PendingResultType::kInitialize,
-                               std::move(result))) {
+                               WrapResult(std::move(result)))) {
     auto cc = camera->GetCaptureController();
     assert(cc);
     cc->StartPreview();
   }
 }
 
-void CameraPlugin::PausePreviewMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  auto camera_id = GetInt64ValueOrNull(args, kCameraIdKey);
-  if (!camera_id) {
-    return result->Error("argument_error",
-                         std::string(kCameraIdKey) + " missing");
+std::optional<FlutterError> CameraPlugin::Dispose(int64_t camera_id) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "dispose");
+  DisposeCameraByCameraId(camera_id);
+  return std::nullopt;
+}
+
+void CameraPlugin::TakePicture(
+    int64_t camera_id, std::function<void(ErrorOr<std::string> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "takePicture");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return result(FlutterError("camera_error", "Camera not created"));
+  }
+
+  if (camera->HasPendingResultByType(PendingResultType::kTakePicture)) {
+    return result(
+        FlutterError("camera_error", "Pending take picture request exists"));
   }
 
-  auto camera = GetCameraByCameraId(*camera_id);
+  std::optional<std::string> path = GetFilePathForPicture();
+  if (!path) {
+    return result(FlutterError("system_error",
+                               "Failed to get capture path for picture"));
+  }
+
+  if (camera->AddPendingResult(PendingResultType::kTakePicture,
+                               WrapResult(std::move(result)))) {
+    auto cc = camera->GetCaptureController();
+    assert(cc);
+    cc->TakePicture(*path);
+  }
+}
+
+void CameraPlugin::TakePictureData(
+    int64_t camera_id, const PlatformPictureFormat& format,
+    const int64_t* quality,
+    std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "takePictureData");
+  auto camera = GetCameraByCameraId(camera_id);
   if (!camera) {
-    return result->Error("camera_error", "Camera not created");
+    return result(FlutterError("camera_error", "Camera not created"));
   }
 
-  if (camera->HasPendingResultByType(PendingResultType::kPausePreview)) {
-    return result->Error("camera_error",
-                         "Pending pause preview request exists");
+  if (camera->HasPendingResultByType(PendingResultType::kTakePictureData)) {
+    return result(
+        FlutterError("camera_error", "Pending take picture request exists"));
   }
 
-  if (camera->AddPendingResult(PendingResultType::kPausePreview,
-                               std::move(result))) {
+  if (camera->AddPendingResult(PendingResultType::kTakePictureData,
+                               WrapResult(std::move(result)))) {
     auto cc = camera->GetCaptureController();
     assert(cc);
-    cc->PausePreview();
+    cc->TakePictureData(GetPhotoSettings(format, quality));
   }
 }
 
-void CameraPlugin::ResumePreviewMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  auto camera_id = GetInt64ValueOrNull(args, kCameraIdKey);
-  if (!camera_id) {
-    return result->Error("argument_error",
-                         std::string(kCameraIdKey) + " missing");
+void CameraPlugin::TakePictureBurst(
+    int64_t camera_id, int64_t photo_count,
+    std::function<void(ErrorOr<EncodableList> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "takePictureBurst");
+  if (photo_count < 1 || photo_count > kMaxPictureBurstCount) {
+    return result(FlutterError(
+        "argument_error", "photoCount must be between 1 and " +
+                              std::to_string(kMaxPictureBurstCount)));
   }
 
-  auto camera = GetCameraByCameraId(*camera_id);
+  auto camera = GetCameraByCameraId(camera_id);
   if (!camera) {
-    return result->Error("camera_error", "Camera not created");
+    return result(FlutterError("camera_error", "Camera not created"));
   }
 
-  if (camera->HasPendingResultByType(PendingResultType::kResumePreview)) {
-    return result->Error("camera_error",
-                         "Pending resume preview request exists");
+  if (camera->HasPendingResultByType(PendingResultType::kTakePicture) ||
+      camera->HasPendingResultByType(PendingResultType::kTakePictureBurst)) {
+    return result(
+        FlutterError("camera_error", "Pending take picture request exists"));
   }
 
-  if (camera->AddPendingResult(PendingResultType::kResumePreview,
-                               std::move(result))) {
+  std::optional<std::vector<std::string>> paths =
+      GetFilePathsForPictureBurst(static_cast<uint32_t>(photo_count));
+  if (!paths) {
+    return result(FlutterError("system_error",
+                               "Failed to get capture path for picture"));
+  }
+
+  if (camera->AddPendingResult(PendingResultType::kTakePictureBurst,
+                               WrapResult(std::move(result)))) {
     auto cc = camera->GetCaptureController();
     assert(cc);
-    cc->ResumePreview();
+    cc->TakePictureBurst(*paths);
   }
 }
 
-void CameraPlugin::StartVideoRecordingMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  auto camera_id = GetInt64ValueOrNull(args, kCameraIdKey);
-  if (!camera_id) {
-    return result->Error("argument_error",
-                         std::string(kCameraIdKey) + " missing");
+std::optional<FlutterError> CameraPlugin::SetPictureRotation(int64_t camera_id,
+                                                             int64_t degrees) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setPictureRotation");
+  std::optional<PhotoRotation> rotation = ParsePhotoRotation(degrees);
+  if (!rotation) {
+    return FlutterError("argument_error",
+                        "Rotation must be 0, 90, 180 or 270 degrees");
   }
 
-  auto camera = GetCameraByCameraId(*camera_id);
+  auto camera = GetCameraByCameraId(camera_id);
   if (!camera) {
-    return result->Error("camera_error", "Camera not created");
+    return FlutterError("camera_error", "Camera not created");
   }
 
-  if (camera->HasPendingResultByType(PendingResultType::kStartRecord)) {
-    return result->Error("camera_error",
-                         "Pending start recording request exists");
-  }
+  auto cc = camera->GetCaptureController();
+  assert(cc);
 
-  int64_t max_video_duration_ms = -1;
-  auto requested_max_video_duration_ms =
-      std::get_if<std::int32_t>(ValueOrNull(args, kMaxVideoDurationKey));
+  cc->SetPictureRotation(*rotation);
+  return std::nullopt;
+}
 
-  if (requested_max_video_duration_ms != nullptr) {
-    max_video_duration_ms = *requested_max_video_duration_ms;
+void CameraPlugin::StartVideoRecording(
+    int64_t camera_id, const int64_t* max_video_duration_ms,
+    const PlatformVideoRecordingSettings& settings,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "startVideoRecording");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return result(FlutterError("camera_error", "Camera not created"));
+  }
+
+  if (camera->HasPendingResultByType(PendingResultType::kStartRecord)) {
+    return result(FlutterError("camera_error",
+                               "Pending start recording request exists"));
   }
 
   std::optional<std::string> path = GetFilePathForVideo();
-  if (path) {
-    if (camera->AddPendingResult(PendingResultType::kStartRecord,
-                                 std::move(result))) {
-      auto cc = camera->GetCaptureController();
-      assert(cc);
-      cc->StartRecord(*path, max_video_duration_ms);
-    }
-  } else {
-    return result->Error("system_error",
-                         "Failed to get path for video capture");
+  if (!path) {
+    return result(
+        FlutterError("system_error", "Failed to get path for video capture"));
   }
-}
 
-void CameraPlugin::StopVideoRecordingMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  auto camera_id = GetInt64ValueOrNull(args, kCameraIdKey);
-  if (!camera_id) {
-    return result->Error("argument_error",
-                         std::string(kCameraIdKey) + " missing");
+  if (camera->AddPendingResult(PendingResultType::kStartRecord,
+                               WrapResult(std::move(result)))) {
+    auto cc = camera->GetCaptureController();
+    assert(cc);
+    cc->StartRecord(*path,
+                    max_video_duration_ms ? *max_video_duration_ms : -1,
+                    GetVideoRecordSettings(settings));
   }
+}
 
-  auto camera = GetCameraByCameraId(*camera_id);
+void CameraPlugin::StopVideoRecording(
+    int64_t camera_id, std::function<void(ErrorOr<std::string> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "stopVideoRecording");
+  auto camera = GetCameraByCameraId(camera_id);
   if (!camera) {
-    return result->Error("camera_error", "Camera not created");
+    return result(FlutterError("camera_error", "Camera not created"));
   }
 
   if (camera->HasPendingResultByType(PendingResultType::kStopRecord)) {
-    return result->Error("camera_error",
-                         "Pending stop recording request exists");
+    return result(
+        FlutterError("camera_error", "Pending stop recording request exists"));
   }
 
   if (camera->AddPendingResult(PendingResultType::kStopRecord,
-                               std::move(result))) {
+                               WrapResult(std::move(result)))) {
     auto cc = camera->GetCaptureController();
     assert(cc);
     cc->StopRecord();
   }
 }
 
-void CameraPlugin::TakePictureMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  auto camera_id = GetInt64ValueOrNull(args, kCameraIdKey);
-  if (!camera_id) {
-    return result->Error("argument_error",
-                         std::string(kCameraIdKey) + " missing");
+void CameraPlugin::PauseVideoRecording(
+    int64_t camera_id,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "pauseVideoRecording");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return result(FlutterError("camera_error", "Camera not created"));
+  }
+
+  if (camera->HasPendingResultByType(PendingResultType::kPauseRecord)) {
+    return result(
+        FlutterError("camera_error", "Pending pause recording request exists"));
+  }
+
+  if (camera->AddPendingResult(PendingResultType::kPauseRecord,
+                               WrapResult(std::move(result)))) {
+    auto cc = camera->GetCaptureController();
+    assert(cc);
+    cc->PauseRecord();
+  }
+}
+
+void CameraPlugin::ResumeVideoRecording(
+    int64_t camera_id,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "resumeVideoRecording");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return result(FlutterError("camera_error", "Camera not created"));
   }
 
-  auto camera = GetCameraByCameraId(*camera_id);
+  if (camera->HasPendingResultByType(PendingResultType::kResumeRecord)) {
+    return result(FlutterError("camera_error",
+                               "Pending resume recording request exists"));
+  }
+
+  if (camera->AddPendingResult(PendingResultType::kResumeRecord,
+                               WrapResult(std::move(result)))) {
+    auto cc = camera->GetCaptureController();
+    assert(cc);
+    cc->ResumeRecord();
+  }
+}
+
+void CameraPlugin::PausePreview(
+    int64_t camera_id,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "pausePreview");
+  auto camera = GetCameraByCameraId(camera_id);
   if (!camera) {
-    return result->Error("camera_error", "Camera not created");
+    return result(FlutterError("camera_error", "Camera not created"));
   }
 
-  if (camera->HasPendingResultByType(PendingResultType::kTakePicture)) {
-    return result->Error("camera_error", "Pending take picture request exists");
+  if (camera->HasPendingResultByType(PendingResultType::kPausePreview)) {
+    return result(
+        FlutterError("camera_error", "Pending pause preview request exists"));
   }
 
-  std::optional<std::string> path = GetFilePathForPicture();
-  if (path) {
-    if (camera->AddPendingResult(PendingResultType::kTakePicture,
-                                 std::move(result))) {
-      auto cc = camera->GetCaptureController();
-      assert(cc);
-      cc->TakePicture(*path);
-    }
-  } else {
-    return result->Error("system_error",
-                         "Failed to get capture path for picture");
+  if (camera->AddPendingResult(PendingResultType::kPausePreview,
+                               WrapResult(std::move(result)))) {
+    auto cc = camera->GetCaptureController();
+    assert(cc);
+    cc->PausePreview();
+  }
+}
+
+void CameraPlugin::ResumePreview(
+    int64_t camera_id,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "resumePreview");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return result(FlutterError("camera_error", "Camera not created"));
+  }
+
+  if (camera->HasPendingResultByType(PendingResultType::kResumePreview)) {
+    return result(
+        FlutterError("camera_error", "Pending resume preview request exists"));
+  }
+
+  if (camera->AddPendingResult(PendingResultType::kResumePreview,
+                               WrapResult(std::move(result)))) {
+    auto cc = camera->GetCaptureController();
+    assert(cc);
+    cc->ResumePreview();
+  }
+}
+
+std::optional<FlutterError> CameraPlugin::StartImageStream(
+    int64_t camera_id, const PlatformImageFormatGroup& format) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "startImageStream");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+  if (!cc->StartImageStream(format == PlatformImageFormatGroup::yuv420
+                                ? ImageStreamFormat::kNV12
+                                : ImageStreamFormat::kBGRA8888)) {
+    return FlutterError("camera_error", "Camera not initialized");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::StopImageStream(int64_t camera_id) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "stopImageStream");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+  cc->StopImageStream();
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::ReceivedImageStreamData(
+    int64_t camera_id) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "receivedImageStreamData");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+  cc->OnImageStreamFrameReceived();
+  return std::nullopt;
+}
+
+ErrorOr<EncodableList> CameraPlugin::GetCaptureFormats(int64_t camera_id) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "getCaptureFormats");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  EncodableList formats;
+  for (const CaptureFormat& format : cc->GetCaptureFormats()) {
+    formats.push_back(CustomEncodableValue(PlatformCaptureFormat(
+        static_cast<int64_t>(format.width), static_cast<int64_t>(format.height),
+        static_cast<double>(format.frame_rate))));
+  }
+  return formats;
+}
+
+ErrorOr<PlatformPreviewStats> CameraPlugin::GetPreviewStats(
+    int64_t camera_id) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "getPreviewStats");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
   }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  std::optional<PreviewStatsSnapshot> stats = cc->GetPreviewStats();
+  if (!stats) {
+    return FlutterError("camera_error", "Preview stats not enabled");
+  }
+
+  return PlatformPreviewStats(
+      static_cast<int64_t>(stats->received_frame_count),
+      static_cast<int64_t>(stats->rendered_frame_count),
+      static_cast<int64_t>(stats->dropped_frame_count),
+      stats->capture_frame_rate, stats->render_frame_rate,
+      static_cast<int64_t>(stats->latency_p50_us),
+      static_cast<int64_t>(stats->latency_p95_us),
+      static_cast<int64_t>(stats->latency_p99_us),
+      static_cast<int64_t>(stats->conversion_p50_us),
+      static_cast<int64_t>(stats->conversion_p95_us),
+      static_cast<int64_t>(stats->conversion_p99_us));
+}
+
+ErrorOr<PlatformRecordingStats> CameraPlugin::GetRecordingStats(
+    int64_t camera_id) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "getRecordingStats");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  std::optional<RecordSampleStats> stats = cc->GetRecordingStats();
+  if (!stats) {
+    return FlutterError("camera_error", "No video recorded");
+  }
+
+  // Times of the recorded file are in 100-nanosecond units.
+  return PlatformRecordingStats(
+      static_cast<int64_t>(stats->video_frame_count),
+      static_cast<int64_t>(stats->dropped_video_frame_count),
+      static_cast<int64_t>(stats->video_end_time / 10),
+      static_cast<int64_t>(stats->GetAudioVideoDrift() / 10));
+}
+
+std::optional<FlutterError> CameraPlugin::SetZoomLevel(int64_t camera_id,
+                                                       double zoom) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setZoomLevel");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  if (!cc->SetZoomLevel(zoom)) {
+    return FlutterError("argument_error", "Zoom level out of range");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::SetCropRect(int64_t camera_id,
+                                                      double left, double top,
+                                                      double width,
+                                                      double height) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setCropRect");
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  PreviewCropRect crop_rect;
+  crop_rect.left = left;
+  crop_rect.top = top;
+  crop_rect.width = width;
+  crop_rect.height = height;
+  if (!cc->SetPreviewCropRect(crop_rect)) {
+    return FlutterError("argument_error",
+                        "Crop rectangle must be within the preview");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::SetPreviewRotation(int64_t camera_id,
+                                                             int64_t degrees) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setPreviewRotation");
+  std::optional<PreviewRotation> rotation = ParsePreviewRotation(degrees);
+  if (!rotation) {
+    return FlutterError("argument_error",
+                        "Rotation must be 0, 90, 180 or 270 degrees");
+  }
+
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  if (!cc->SetPreviewRotation(*rotation)) {
+    return FlutterError("camera_error",
+                        "Preview rotation not supported by the GPU surface");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::SetPreviewFrameRate(
+    int64_t camera_id, const double* frames_per_second) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setPreviewFrameRate");
+  // A missing frame rate removes the limit.
+  if (frames_per_second && !std::isfinite(*frames_per_second)) {
+    return FlutterError("argument_error", "framesPerSecond must be finite");
+  }
+
+  auto camera = GetCameraByCameraId(camera_id);
+  if (!camera) {
+    return FlutterError("camera_error", "Camera not created");
+  }
+
+  auto cc = camera->GetCaptureController();
+  assert(cc);
+
+  cc->SetPreviewTargetFrameRate(
+      frames_per_second ? std::optional<double>(*frames_per_second)
+                        : std::nullopt);
+  return std::nullopt;
 }
 
-void CameraPlugin::DisposeMethodHandler(
-    const EncodableMap& args, std::unique_ptr<flutter::MethodResult<>> result) {
-  auto camera_id = GetInt64ValueOrNull(args, kCameraIdKey);
-  if (!camera_id) {
-    return result->Error("argument_error",
-                         std::string(kCameraIdKey) + " missing");
+std::optional<FlutterError> CameraPlugin::SetExposureMode(int64_t camera_id,
+                                                          bool locked) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setExposureMode");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
   }
 
-  DisposeCameraByCameraId(*camera_id);
-  result->Success();
+  HRESULT hr = controls.value()->SetExposureMode(GetCameraControlMode(locked));
+  if (FAILED(hr)) {
+    return GetCameraControlError(hr, "exposure mode");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::SetFocusMode(int64_t camera_id,
+                                                       bool locked) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setFocusMode");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
+  }
+
+  HRESULT hr = controls.value()->SetFocusMode(GetCameraControlMode(locked));
+  if (FAILED(hr)) {
+    return GetCameraControlError(hr, "focus mode");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::SetWhiteBalanceMode(int64_t camera_id,
+                                                              bool locked) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setWhiteBalanceMode");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
+  }
+
+  HRESULT hr =
+      controls.value()->SetWhiteBalanceMode(GetCameraControlMode(locked));
+  if (FAILED(hr)) {
+    return GetCameraControlError(hr, "white balance mode");
+  }
+  return std::nullopt;
+}
+
+ErrorOr<PlatformExposureOffsetRange> CameraPlugin::GetExposureOffsetRange(
+    int64_t camera_id) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "getExposureOffsetRange");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
+  }
+
+  ExposureOffsetRange range = controls.value()->GetExposureOffsetRange();
+  return PlatformExposureOffsetRange(range.min, range.max, range.step);
+}
+
+ErrorOr<double> CameraPlugin::SetExposureOffset(int64_t camera_id,
+                                                double offset) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setExposureOffset");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
+  }
+
+  double applied_offset = 0.0;
+  HRESULT hr = controls.value()->SetExposureOffset(offset, &applied_offset);
+  if (FAILED(hr)) {
+    return GetCameraControlError(hr, "exposure offset");
+  }
+  return applied_offset;
+}
+
+std::optional<FlutterError> CameraPlugin::SetFrameRateLock(int64_t camera_id,
+                                                           bool locked) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setFrameRateLock");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
+  }
+
+  HRESULT hr = controls.value()->SetFrameRateLock(locked);
+  if (FAILED(hr)) {
+    return GetCameraControlError(hr, "frame rate lock");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::SetFlashMode(
+    int64_t camera_id, const PlatformFlashMode& mode) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setFlashMode");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
+  }
+
+  HRESULT hr = controls.value()->SetFlashMode(GetCameraFlashMode(mode));
+  if (FAILED(hr)) {
+    return GetCameraControlError(hr, "flash mode");
+  }
+  return std::nullopt;
+}
+
+std::optional<FlutterError> CameraPlugin::SetPhotoCapturePriority(
+    int64_t camera_id, const PlatformPhotoCapturePriority& priority) {
+  CAMERA_TRACE_SCOPE_WITH_DETAIL("CameraApi", "setPhotoCapturePriority");
+  ErrorOr<CameraControls*> controls = GetCameraControls(camera_id);
+  if (controls.has_error()) {
+    return controls.error();
+  }
+
+  HRESULT hr = controls.value()->SetPhotoCapturePriority(
+      priority == PlatformPhotoCapturePriority::speed
+          ? PhotoCapturePriority::kSpeed
+          : PhotoCapturePriority::kBalanced);
+  if (FAILED(hr)) {
+    return GetCameraControlError(hr, "photo capture priority");
+  }
+  return std::nullopt;
 }
 
 }  // namespace camera_windows
@@ -6,18 +6,24 @@
 #define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAMERA_PLUGIN_H_
 
 #include <flutter/flutter_view.h>
-#include <flutter/method_channel.h>
 #include <flutter/plugin_registrar_windows.h>
-#include <flutter/standard_method_codec.h>
+
+#include <windows.h>
 
 #include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
 
 #include "camera.h"
 #include "capture_controller.h"
 #include "capture_controller_listener.h"
+#include "messages.g.h"
+#include "platform_thread_dispatcher.h"
 
 namespace camera_windows {
-using flutter::MethodResult;
+using flutter::EncodableList;
 
 namespace test {
 namespace {
@@ -27,7 +33,9 @@ class MockCameraPlugin;
 }  // namespace test
 
 class CameraPlugin : public flutter::Plugin,
-                     public VideoCaptureDeviceEnumerator {
+                     public CameraApi,
+                     public VideoCaptureDeviceEnumerator,
+                     public AudioCaptureDeviceEnumerator {
  public:
   static void RegisterWithRegistrar(flutter::PluginRegistrarWindows* registrar);
 
@@ -46,84 +54,265 @@ class CameraPlugin : public flutter::Plugin,
   CameraPlugin(const CameraPlugin&) = delete;
   CameraPlugin& operator=(const CameraPlugin&) = delete;
 
-  // Called when a method is called on plugin channel.
-  void HandleMethodCall(const flutter::MethodCall<>& method_call,
-                        std::unique_ptr<MethodResult<>> result);
+  // Enables asynchronous camera enumeration and camera change notifications.
+  //
+  // Cameras are enumerated on a worker thread, and the result is delivered
+  // back to the platform thread through the top-level window of |registrar|.
+  // The result is cached until a camera is connected or disconnected, which
+  // is also reported to Dart with a camerasChanged event. Without a window,
+  // cameras are enumerated synchronously on every call.
+  void EnableDeviceMonitoring(flutter::PluginRegistrarWindows* registrar);
 
- private:
-  // Loops through cameras and returns camera
-  // with matching device_id or nullptr.
-  Camera* GetCameraByDeviceId(std::string& device_id);
+  // CameraApi:
 
-  // Loops through cameras and returns camera
-  // with matching camera_id or nullptr.
-  Camera* GetCameraByCameraId(int64_t camera_id);
+  // Enumerates video capture devices and returns the names of the available
+  // cameras.
+  void GetAvailableCameras(
+      std::function<void(ErrorOr<EncodableList> reply)> result) override;
 
-  // Disposes camera by camera id.
-  void DisposeCameraByCameraId(int64_t camera_id);
+  // Enumerates audio capture devices and returns their names and endpoint
+  // IDs, which can be passed to Create.
+  ErrorOr<EncodableList> GetAvailableAudioDevices() override;
 
-  // Enumerates video capture devices.
-  bool EnumerateVideoCaptureDeviceSources(IMFActivate*** devices,
-                                          UINT32* count) override;
+  // Creates the capture engine and video source of a camera device in the
+  // background, so that a later Create call for it starts faster.
+  std::optional<FlutterError> Prewarm(const std::string& camera_name) override;
 
-  // Handles availableCameras method calls.
-  // Enumerates video capture devices and
-  // returns list of available camera devices.
-  void AvailableCamerasMethodHandler(
-      std::unique_ptr<flutter::MethodResult<>> result);
-
-  // Handles create method calls.
   // Creates camera and initializes capture controller for requested device.
   // Stores result object to be handled after request is processed.
-  void CreateMethodHandler(const EncodableMap& args,
-                           std::unique_ptr<MethodResult<>> result);
+  void Create(const std::string& camera_name,
+              const PlatformMediaSettings& settings,
+              std::function<void(ErrorOr<int64_t> reply)> result) override;
 
-  // Handles initialize method calls.
   // Requests existing camera controller to start preview.
   // Stores result object to be handled after request is processed.
-  void InitializeMethodHandler(const EncodableMap& args,
-                               std::unique_ptr<MethodResult<>> result);
+  void Initialize(
+      int64_t camera_id,
+      std::function<void(ErrorOr<PlatformSize> reply)> result) override;
+
+  // Disposes camera if exists.
+  std::optional<FlutterError> Dispose(int64_t camera_id) override;
 
-  // Handles takePicture method calls.
   // Requests existing camera controller to take photo.
   // Stores result object to be handled after request is processed.
-  void TakePictureMethodHandler(const EncodableMap& args,
-                                std::unique_ptr<MethodResult<>> result);
+  void TakePicture(
+      int64_t camera_id,
+      std::function<void(ErrorOr<std::string> reply)> result) override;
+
+  // Requests existing camera controller to take photo in memory.
+  // Stores result object to be handled after request is processed.
+  void TakePictureData(
+      int64_t camera_id, const PlatformPictureFormat& format,
+      const int64_t* quality,
+      std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result)
+      override;
+
+  // Requests existing camera controller to take a burst of photos.
+  // Stores result object to be handled after request is processed.
+  void TakePictureBurst(
+      int64_t camera_id, int64_t photo_count,
+      std::function<void(ErrorOr<EncodableList> reply)> result) override;
+
+  // Sets the clockwise rotation of the photos taken by the camera.
+  std::optional<FlutterError> SetPictureRotation(int64_t camera_id,
+                                                 int64_t degrees) override;
 
-  // Handles startVideoRecording method calls.
   // Requests existing camera controller to start recording.
   // Stores result object to be handled after request is processed.
-  void StartVideoRecordingMethodHandler(const EncodableMap& args,
-                                        std::unique_ptr<MethodResult<>> result);
+  void StartVideoRecording(
+      int64_t camera_id, const int64_t* max_video_duration_ms,
+      const PlatformVideoRecordingSettings& settings,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
 
-  // Handles stopVideoRecording method calls.
   // Requests existing camera controller to stop recording.
   // Stores result object to be handled after request is processed.
-  void StopVideoRecordingMethodHandler(const EncodableMap& args,
-                                       std::unique_ptr<MethodResult<>> result);
+  void StopVideoRecording(
+      int64_t camera_id,
+      std::function<void(ErrorOr<std::string> reply)> result) override;
 
-  // Handles pausePreview method calls.
   // Requests existing camera controller to pause recording.
   // Stores result object to be handled after request is processed.
-  void PausePreviewMethodHandler(const EncodableMap& args,
-                                 std::unique_ptr<MethodResult<>> result);
+  void PauseVideoRecording(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
+
+  // Requests existing camera controller to resume recording.
+  // Stores result object to be handled after request is processed.
+  void ResumeVideoRecording(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
+
+  // Requests existing camera controller to pause preview.
+  // Stores result object to be handled after request is processed.
+  void PausePreview(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
 
-  // Handles resumePreview method calls.
   // Requests existing camera controller to resume preview.
   // Stores result object to be handled after request is processed.
-  void ResumePreviewMethodHandler(const EncodableMap& args,
-                                  std::unique_ptr<MethodResult<>> result);
+  void ResumePreview(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
 
-  // Handles dsipose method calls.
-  // Disposes camera if exists.
-  void DisposeMethodHandler(const EncodableMap& args,
-                            std::unique_ptr<MethodResult<>> result);
+  // Requests existing camera controller to stream frames in the requested
+  // image format group to the camera's image stream event channel.
+  std::optional<FlutterError> StartImageStream(
+      int64_t camera_id, const PlatformImageFormatGroup& format) override;
+
+  // Requests existing camera controller to stop streaming frames.
+  std::optional<FlutterError> StopImageStream(int64_t camera_id) override;
+
+  // Acknowledges a streamed frame so that the next one can be sent.
+  std::optional<FlutterError> ReceivedImageStreamData(
+      int64_t camera_id) override;
+
+  // Returns the capture formats supported by the camera device.
+  ErrorOr<EncodableList> GetCaptureFormats(int64_t camera_id) override;
+
+  // Returns the preview pipeline statistics of the camera.
+  ErrorOr<PlatformPreviewStats> GetPreviewStats(int64_t camera_id) override;
+
+  // Returns the statistics of the current or last video recording.
+  ErrorOr<PlatformRecordingStats> GetRecordingStats(
+      int64_t camera_id) override;
+
+  // Sets the digital zoom of the camera preview.
+  std::optional<FlutterError> SetZoomLevel(int64_t camera_id,
+                                           double zoom) override;
+
+  // Sets the region of the camera preview shown in the preview texture.
+  std::optional<FlutterError> SetCropRect(int64_t camera_id, double left,
+                                          double top, double width,
+                                          double height) override;
+
+  // Sets the clockwise rotation of the camera preview.
+  std::optional<FlutterError> SetPreviewRotation(int64_t camera_id,
+                                                 int64_t degrees) override;
+
+  // Limits the rate at which the preview texture is updated.
+  std::optional<FlutterError> SetPreviewFrameRate(
+      int64_t camera_id, const double* frames_per_second) override;
+
+  // Sets the exposure of the camera to automatic or locked.
+  std::optional<FlutterError> SetExposureMode(int64_t camera_id,
+                                              bool locked) override;
+
+  // Sets the focus of the camera to automatic or locked.
+  std::optional<FlutterError> SetFocusMode(int64_t camera_id,
+                                           bool locked) override;
 
+  // Sets the white balance of the camera to automatic or locked.
+  std::optional<FlutterError> SetWhiteBalanceMode(int64_t camera_id,
+                                                  bool locked) override;
+
+  // Returns the minimum, maximum and step of the exposure offset, in EV.
+  ErrorOr<PlatformExposureOffsetRange> GetExposureOffsetRange(
+      int64_t camera_id) override;
+
+  // Sets the exposure compensation and returns the applied offset.
+  ErrorOr<double> SetExposureOffset(int64_t camera_id, double offset) override;
+
+  // Keeps the frame rate constant while the exposure is automatic.
+  std::optional<FlutterError> SetFrameRateLock(int64_t camera_id,
+                                               bool locked) override;
+
+  // Sets the flash of the camera to off, auto, always or torch.
+  std::optional<FlutterError> SetFlashMode(
+      int64_t camera_id, const PlatformFlashMode& mode) override;
+
+  // Sets whether pictures favor the shutter lag over the focus.
+  std::optional<FlutterError> SetPhotoCapturePriority(
+      int64_t camera_id, const PlatformPhotoCapturePriority& priority) override;
+
+ private:
+  // Loops through cameras and returns camera
+  // with matching device_id or nullptr.
+  Camera* GetCameraByDeviceId(std::string& device_id);
+
+  // Loops through cameras and returns camera
+  // with matching camera_id or nullptr.
+  Camera* GetCameraByCameraId(int64_t camera_id);
+
+  // Disposes camera by camera id.
+  void DisposeCameraByCameraId(int64_t camera_id);
+
+  // Enumerates video capture devices.
+  bool EnumerateVideoCaptureDeviceSources(IMFActivate*** devices,
+                                          UINT32* count) override;
+
+  // Enumerates video capture devices into the GetAvailableCameras response.
+  //
+  // Returns false if the devices cannot be enumerated. Called on the worker
+  // thread when device monitoring is enabled.
+  bool EnumerateAvailableCameras(EncodableList* cameras);
+
+  // Enumerates audio capture devices.
+  bool EnumerateAudioCaptureDeviceSources(IMFActivate*** devices,
+                                          UINT32* count) override;
+
+  // Handles messages of the top-level window for device monitoring.
+  std::optional<LRESULT> HandleWindowProc(HWND hwnd, UINT message,
+                                          WPARAM wparam, LPARAM lparam);
+
+  // Pauses the preview of all cameras while the top-level window is
+  // minimized or hidden.
+  void OnWindowVisibilityChanged(bool hidden);
+
+  // Completes pending GetAvailableCameras calls with the result of the
+  // worker thread.
+  void OnAvailableCamerasEnumerated();
+
+  // Invalidates the cached cameras and sends a camerasChanged event.
+  void OnAvailableCamerasChanged();
+
+  // Creates the capture context shared by all cameras, if needed.
+  //
+  // Returns false if Media Foundation or Direct3D cannot be initialized.
+  bool EnsureCaptureContext();
+
+  // Returns the camera controls of the camera |camera_id|, or the error to
+  // reply with if the camera is not created or not initialized.
+  ErrorOr<CameraControls*> GetCameraControls(int64_t camera_id);
+
+  // Runs the capture controller callbacks of the cameras on the platform
+  // thread once device monitoring is enabled. Declared before
+  // |camera_factory_|, which passes it to the cameras.
+  std::shared_ptr<PlatformThreadDispatcher> dispatcher_;
   std::unique_ptr<CameraFactory> camera_factory_;
   flutter::TextureRegistrar* texture_registrar_;
   flutter::BinaryMessenger* messenger_;
   std::vector<std::unique_ptr<Camera>> cameras_;
 
+  // Shared by all cameras, created with the first camera.
+  std::shared_ptr<CaptureContext> capture_context_;
+
+  // Cached GetAvailableCameras response. Only used while camera changes are
+  // observed, and only accessed on the platform thread.
+  bool cache_available_cameras_ = false;
+  std::optional<EncodableList> available_cameras_;
+
+  // Incremented on every camera change, so that enumerations started before
+  // a change are not cached.
+  uint64_t available_cameras_generation_ = 0;
+
+  // GetAvailableCameras calls waiting for the worker thread.
+  std::vector<std::function<void(ErrorOr<EncodableList> reply)>>
+      pending_available_cameras_;
+
+  // Result of the worker thread, guarded by |enumeration_mutex_|.
+  std::mutex enumeration_mutex_;
+  std::optional<EncodableList> enumerated_cameras_;
+  uint64_t enumerated_cameras_generation_ = 0;
+  std::thread enumeration_thread_;
+
+  flutter::PluginRegistrarWindows* registrar_ = nullptr;
+  int window_proc_delegate_id_ = -1;
+  HWND window_ = nullptr;
+  HDEVNOTIFY device_notification_ = nullptr;
+  bool preview_window_hidden_ = false;
+  UINT enumeration_complete_message_ = 0;
+  UINT platform_tasks_message_ = 0;
+
   friend class camera_windows::test::MockCameraPlugin;
 };
 
@@ -0,0 +1,169 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "capture_context.h"
+
+#include <cassert>
+
+#include "string_utils.h"
+
+namespace camera_windows {
+using windows_plugin_utils::Utf16FromUtf8;
+
+HRESULT CreateCaptureEngineInstance(IMFCaptureEngine** capture_engine) {
+  ComPtr<IMFCaptureEngineClassFactory> capture_engine_factory;
+
+  HRESULT hr = CoCreateInstance(CLSID_MFCaptureEngineClassFactory, nullptr,
+                                CLSCTX_INPROC_SERVER,
+                                IID_PPV_ARGS(&capture_engine_factory));
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return capture_engine_factory->CreateInstance(
+      CLSID_MFCaptureEngine, IID_PPV_ARGS(capture_engine));
+}
+
+HRESULT CreateVideoCaptureSource(const std::string& device_id,
+                                 IMFMediaSource** video_source) {
+  ComPtr<IMFAttributes> video_capture_source_attributes;
+
+  HRESULT hr = MFCreateAttributes(&video_capture_source_attributes, 2);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = video_capture_source_attributes->SetGUID(
+      MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
+      MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_VIDCAP_GUID);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = video_capture_source_attributes->SetString(
+      MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_VIDCAP_SYMBOLIC_LINK,
+      Utf16FromUtf8(device_id).c_str());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return MFCreateDeviceSource(video_capture_source_attributes.Get(),
+                              video_source);
+}
+
+CaptureContext::~CaptureContext() {
+  for (std::thread& thread : prewarm_threads_) {
+    thread.join();
+  }
+  prewarmed_devices_.clear();
+
+  dxgi_device_manager_ = nullptr;
+  dx11_device_ = nullptr;
+
+  // Application should call MFShutdown the same number of times as MFStartup.
+  if (media_foundation_started_) {
+    MFShutdown();
+  }
+}
+
+HRESULT CaptureContext::Initialize() {
+  assert(!media_foundation_started_);
+
+  // MFStartup must be called before using Media Foundation.
+  HRESULT hr = MFStartup(MF_VERSION);
+  if (FAILED(hr)) {
+    return hr;
+  }
+  media_foundation_started_ = true;
+
+  // TODO: Use existing ANGLE device
+  hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr,
+                         D3D11_CREATE_DEVICE_VIDEO_SUPPORT, nullptr, 0,
+                         D3D11_SDK_VERSION, &dx11_device_, nullptr, nullptr);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Enable multithread protection, as the device is used from the sample
+  // threads of every capture engine.
+  ComPtr<ID3D10Multithread> multi_thread;
+  hr = dx11_device_.As(&multi_thread);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  multi_thread->SetMultithreadProtected(TRUE);
+
+  hr = MFCreateDXGIDeviceManager(&dx_device_reset_token_,
+                                 dxgi_device_manager_.GetAddressOf());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return dxgi_device_manager_->ResetDevice(dx11_device_.Get(),
+                                           dx_device_reset_token_);
+}
+
+void CaptureContext::PrewarmDevice(const std::string& device_id) {
+  {
+    const std::lock_guard<std::mutex> lock(prewarm_mutex_);
+    if (!prewarmed_devices_.emplace(device_id, PrewarmedDevice()).second) {
+      return;
+    }
+  }
+
+  prewarm_threads_.emplace_back([this, device_id]() {
+    // Media Foundation objects are created in the multithreaded apartment,
+    // which outlives this thread as long as Media Foundation is started.
+    HRESULT com_hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    ComPtr<IMFCaptureEngine> capture_engine;
+    ComPtr<IMFMediaSource> video_source;
+    HRESULT hr = CreateCaptureEngineInstance(capture_engine.GetAddressOf());
+    if (SUCCEEDED(hr)) {
+      hr = CreateVideoCaptureSource(device_id, video_source.GetAddressOf());
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock(prewarm_mutex_);
+      auto it = prewarmed_devices_.find(device_id);
+      if (FAILED(hr)) {
+        prewarmed_devices_.erase(it);
+      } else {
+        it->second.ready = true;
+        it->second.capture_engine = std::move(capture_engine);
+        it->second.video_source = std::move(video_source);
+      }
+    }
+    prewarm_condition_.notify_all();
+
+    if (SUCCEEDED(com_hr)) {
+      CoUninitialize();
+    }
+  });
+}
+
+bool CaptureContext::TakePrewarmedDevice(
+    const std::string& device_id, ComPtr<IMFCaptureEngine>* capture_engine,
+    ComPtr<IMFMediaSource>* video_source) {
+  assert(capture_engine);
+  assert(video_source);
+
+  std::unique_lock<std::mutex> lock(prewarm_mutex_);
+  auto it = prewarmed_devices_.find(device_id);
+  while (it != prewarmed_devices_.end() && !it->second.ready) {
+    prewarm_condition_.wait(lock);
+    it = prewarmed_devices_.find(device_id);
+  }
+  if (it == prewarmed_devices_.end()) {
+    return false;
+  }
+
+  *capture_engine = std::move(it->second.capture_engine);
+  *video_source = std::move(it->second.video_source);
+  prewarmed_devices_.erase(it);
+  return true;
+}
+
+}  // namespace camera_windows
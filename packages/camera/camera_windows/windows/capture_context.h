@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_CONTEXT_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_CONTEXT_H_
+
+#include <d3d11.h>
+#include <mfapi.h>
+#include <mfcaptureengine.h>
+#include <mfidl.h>
+#include <windows.h>
+#include <wrl/client.h>
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+// Creates a new, uninitialized capture engine.
+HRESULT CreateCaptureEngineInstance(IMFCaptureEngine** capture_engine);
+
+// Creates the media source of the video capture device with the given
+// symbolic link.
+HRESULT CreateVideoCaptureSource(const std::string& device_id,
+                                 IMFMediaSource** video_source);
+
+// Media Foundation and Direct3D state shared by all capture controllers.
+//
+// Every camera opened by the plugin captures through the same D3D11 device
+// and DXGI device manager, so frames of multiple cameras share GPU memory
+// and never need to be copied between devices. The context is shared with
+// |std::shared_ptr|: Media Foundation is started once when the context is
+// initialized and shut down when the last owner releases it.
+class CaptureContext {
+ public:
+  CaptureContext() = default;
+  virtual ~CaptureContext();
+
+  // Prevent copying.
+  CaptureContext(CaptureContext const&) = delete;
+  CaptureContext& operator=(CaptureContext const&) = delete;
+
+  // Starts Media Foundation and creates the shared D3D11 device.
+  //
+  // Returns a failure if either cannot be initialized, in which case the
+  // context cannot be used.
+  HRESULT Initialize();
+
+  // Returns the D3D11 device used by the capture engines and for rendering
+  // GPU preview surfaces.
+  ID3D11Device* GetD3DDevice() const { return dx11_device_.Get(); }
+
+  // Returns the DXGI device manager passed to the capture engines.
+  IMFDXGIDeviceManager* GetDXGIDeviceManager() const {
+    return dxgi_device_manager_.Get();
+  }
+
+  // Creates a capture engine and the video source of a device on a
+  // background thread, so that opening the device later only needs to
+  // initialize them.
+  //
+  // Does nothing if the device is already prewarmed or being prewarmed.
+  void PrewarmDevice(const std::string& device_id);
+
+  // Takes the prewarmed capture engine and video source of a device.
+  //
+  // Waits for a prewarm of the device that is still running. Returns false
+  // if the device was not prewarmed or prewarming failed.
+  bool TakePrewarmedDevice(const std::string& device_id,
+                           ComPtr<IMFCaptureEngine>* capture_engine,
+                           ComPtr<IMFMediaSource>* video_source);
+
+ private:
+  // Capture objects created ahead of time for a device.
+  struct PrewarmedDevice {
+    bool ready = false;
+    ComPtr<IMFCaptureEngine> capture_engine;
+    ComPtr<IMFMediaSource> video_source;
+  };
+
+  bool media_foundation_started_ = false;
+  UINT dx_device_reset_token_ = 0;
+  ComPtr<ID3D11Device> dx11_device_;
+  ComPtr<IMFDXGIDeviceManager> dxgi_device_manager_;
+
+  // Prewarmed devices by device id, guarded by |prewarm_mutex_|.
+  std::mutex prewarm_mutex_;
+  std::condition_variable prewarm_condition_;
+  std::map<std::string, PrewarmedDevice> prewarmed_devices_;
+  std::vector<std::thread> prewarm_threads_;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_CONTEXT_H_
@@ -5,22 +5,44 @@
 #include "capture_controller.h"
 
 #include <comdef.h>
+#include <mmdeviceapi.h>
 #include <wincodec.h>
 #include <wrl/client.h>
 
 #include <cassert>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <utility>
 
 #include "com_heap_ptr.h"
+#include "media_type_cache.h"
 #include "photo_handler.h"
+#include "pixel_conversion.h"
 #include "preview_handler.h"
 #include "record_handler.h"
+#include "source_reader_capture_controller.h"
 #include "string_utils.h"
 #include "texture_handler.h"
 
 namespace camera_windows {
 
 using Microsoft::WRL::ComPtr;
+using windows_plugin_utils::Utf16FromUtf8;
+using windows_plugin_utils::Utf8FromUtf16;
+
+// Number of preview frames kept for zero shutter lag photos.
+constexpr size_t kZeroShutterLagFrameCount = 3;
+
+// Copies |rows| rows of |row_size| bytes between planes of different pitch.
+void CopyPlane(const uint8_t* src, uint32_t src_pitch, uint8_t* dst,
+               uint32_t row_size, uint32_t rows) {
+  for (uint32_t y = 0; y < rows; y++) {
+    std::memcpy(dst + static_cast<size_t>(y) * row_size,
+                src + static_cast<size_t>(y) * src_pitch, row_size);
+  }
+}
 
 CameraResult GetCameraResult(HRESULT hr) {
   if (SUCCEEDED(hr)) {
@@ -31,12 +53,100 @@ CameraResult GetCameraResult(HRESULT hr) {
                               : CameraResult::kError;
 }
 
+bool BuildImageStreamFrame(const uint8_t* data, uint32_t data_length,
+                           int32_t stride, uint32_t width, uint32_t height,
+                           PreviewPixelFormat source_format,
+                           ImageStreamFormat format, ImageStreamFrame* frame) {
+  const bool is_nv12_source = source_format == PreviewPixelFormat::kNV12;
+
+  // NV12 samples hold the chroma plane after the luma plane.
+  const uint32_t row_size = is_nv12_source ? GetNV12UVPlaneRowSize(width)
+                                           : width * 4;
+  const uint32_t row_count =
+      is_nv12_source ? height + GetNV12UVPlaneHeight(height) : height;
+  if (stride == 0) {
+    stride = static_cast<int32_t>(row_size);
+  }
+  const uint32_t row_pitch = static_cast<uint32_t>(std::abs(stride));
+  if (!data || width == 0 || height == 0 || row_pitch < row_size ||
+      (is_nv12_source && stride < 0) ||
+      data_length < row_pitch * (row_count - 1) + row_size) {
+    return false;
+  }
+  const uint8_t* source_uv_plane =
+      is_nv12_source ? data + static_cast<size_t>(row_pitch) * height
+                     : nullptr;
+
+  frame->format = format;
+  frame->width = width;
+  frame->height = height;
+  frame->planes.clear();
+  if (format == ImageStreamFormat::kNV12) {
+    ImageStreamPlane y_plane;
+    y_plane.bytes.resize(static_cast<size_t>(width) * height);
+    y_plane.bytes_per_row = width;
+    y_plane.width = width;
+    y_plane.height = height;
+
+    ImageStreamPlane uv_plane;
+    uv_plane.bytes_per_row = GetNV12UVPlaneRowSize(width);
+    uv_plane.width = (width + 1) / 2;
+    uv_plane.height = GetNV12UVPlaneHeight(height);
+    uv_plane.bytes.resize(static_cast<size_t>(uv_plane.bytes_per_row) *
+                          uv_plane.height);
+
+    if (is_nv12_source) {
+      // Only removes the row padding of the native planes.
+      CopyPlane(data, row_pitch, y_plane.bytes.data(), y_plane.bytes_per_row,
+                height);
+      CopyPlane(source_uv_plane, row_pitch, uv_plane.bytes.data(),
+                uv_plane.bytes_per_row, uv_plane.height);
+    } else {
+      ConvertRGB32ToNV12(data, stride, y_plane.bytes.data(),
+                         uv_plane.bytes.data(), width, height);
+    }
+    frame->planes.push_back(std::move(y_plane));
+    frame->planes.push_back(std::move(uv_plane));
+  } else {
+    ImageStreamPlane plane;
+    plane.bytes_per_row = width * 4;
+    plane.bytes.resize(static_cast<size_t>(plane.bytes_per_row) * height);
+    plane.width = width;
+    plane.height = height;
+
+    if (is_nv12_source) {
+      ConvertNV12ToBGRA(data, stride, source_uv_plane, stride,
+                        plane.bytes.data(), width, height);
+    } else {
+      ConvertRGB32ToBGRA(data, stride, plane.bytes.data(), width, height);
+    }
+    frame->planes.push_back(std::move(plane));
+  }
+
+  return true;
+}
+
 CaptureControllerImpl::CaptureControllerImpl(
-    CaptureControllerListener* listener)
-    : capture_controller_listener_(listener), CaptureController(){};
+    CaptureControllerListener* listener,
+    std::unique_ptr<CaptureWorkQueue> work_queue)
+    : capture_controller_listener_(listener),
+      work_queue_(std::move(work_queue)),
+      CaptureController(){};
 
 CaptureControllerImpl::~CaptureControllerImpl() {
-  ResetCaptureController();
+  if (work_queue_) {
+    // Resets on the work queue, so that the reset cannot overlap the handling
+    // of an event. Events queued after the reset are discarded.
+    std::promise<void> reset;
+    work_queue_->Post([this, &reset]() {
+      ResetCaptureController();
+      reset.set_value();
+    });
+    reset.get_future().wait();
+    work_queue_ = nullptr;
+  } else {
+    ResetCaptureController();
+  }
   capture_controller_listener_ = nullptr;
 };
 
@@ -64,148 +174,150 @@ bool CaptureControllerImpl::EnumerateVideoCaptureDeviceSources(
   return true;
 }
 
-HRESULT CaptureControllerImpl::CreateDefaultAudioCaptureSource() {
-  audio_source_ = nullptr;
-  ComHeapPtr<IMFActivate*> devices;
-  UINT32 count = 0;
-
+// static
+bool CaptureControllerImpl::EnumerateAudioCaptureDeviceSources(
+    IMFActivate*** devices, UINT32* count) {
   ComPtr<IMFAttributes> attributes;
-  HRESULT hr = MFCreateAttributes(&attributes, 1);
 
-  if (SUCCEEDED(hr)) {
-    hr = attributes->SetGUID(MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
-                             MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_GUID);
+  HRESULT hr = MFCreateAttributes(&attributes, 1);
+  if (FAILED(hr)) {
+    return false;
   }
 
-  if (SUCCEEDED(hr)) {
-    hr = MFEnumDeviceSources(attributes.Get(), &devices, &count);
+  hr = attributes->SetGUID(MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
+                           MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_GUID);
+  if (FAILED(hr)) {
+    return false;
   }
 
-  if (SUCCEEDED(hr) && count > 0) {
-    ComHeapPtr<wchar_t> audio_device_id;
-    UINT32 audio_device_id_size;
-
-    // Use first audio device.
-    hr = devices[0]->GetAllocatedString(
-        MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_ENDPOINT_ID, &audio_device_id,
-        &audio_device_id_size);
-
-    if (SUCCEEDED(hr)) {
-      ComPtr<IMFAttributes> audio_capture_source_attributes;
-      hr = MFCreateAttributes(&audio_capture_source_attributes, 2);
-
-      if (SUCCEEDED(hr)) {
-        hr = audio_capture_source_attributes->SetGUID(
-            MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
-            MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_GUID);
-      }
-
-      if (SUCCEEDED(hr)) {
-        hr = audio_capture_source_attributes->SetString(
-            MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_ENDPOINT_ID,
-            audio_device_id);
-      }
-
-      if (SUCCEEDED(hr)) {
-        hr = MFCreateDeviceSource(audio_capture_source_attributes.Get(),
-                                  audio_source_.GetAddressOf());
-      }
-    }
+  hr = MFEnumDeviceSources(attributes.Get(), devices, count);
+  if (FAILED(hr)) {
+    return false;
   }
 
-  return hr;
+  return true;
 }
 
-HRESULT CaptureControllerImpl::CreateVideoCaptureSourceForDevice(
-    const std::string& video_device_id) {
-  video_source_ = nullptr;
-
-  ComPtr<IMFAttributes> video_capture_source_attributes;
-
-  HRESULT hr = MFCreateAttributes(&video_capture_source_attributes, 2);
+// Returns the endpoint ID of the default audio capture device of the system,
+// or an empty string if there is none.
+std::wstring GetDefaultAudioCaptureEndpointId() {
+  ComPtr<IMMDeviceEnumerator> enumerator;
+  HRESULT hr =
+      CoCreateInstance(__uuidof(MMDeviceEnumerator), nullptr,
+                       CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&enumerator));
   if (FAILED(hr)) {
-    return hr;
+    return std::wstring();
   }
 
-  hr = video_capture_source_attributes->SetGUID(
-      MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
-      MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_VIDCAP_GUID);
+  ComPtr<IMMDevice> device;
+  hr = enumerator->GetDefaultAudioEndpoint(eCapture, eConsole, &device);
   if (FAILED(hr)) {
-    return hr;
+    return std::wstring();
   }
 
-  hr = video_capture_source_attributes->SetString(
-      MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_VIDCAP_SYMBOLIC_LINK,
-      Utf16FromUtf8(video_device_id).c_str());
+  ComHeapPtr<wchar_t> endpoint_id;
+  hr = device->GetId(&endpoint_id);
   if (FAILED(hr)) {
-    return hr;
+    return std::wstring();
   }
+  return std::wstring(endpoint_id);
+}
 
-  hr = MFCreateDeviceSource(video_capture_source_attributes.Get(),
-                            video_source_.GetAddressOf());
-  return hr;
+// Returns the endpoint ID of the first audio capture device, or an empty
+// string if there is none.
+std::wstring GetFirstAudioCaptureEndpointId() {
+  ComHeapPtr<IMFActivate*> devices;
+  UINT32 count = 0;
+  if (!CaptureControllerImpl::EnumerateAudioCaptureDeviceSources(&devices,
+                                                                 &count) ||
+      count == 0) {
+    return std::wstring();
+  }
+
+  ComHeapPtr<wchar_t> audio_device_id;
+  UINT32 audio_device_id_size;
+  HRESULT hr = devices[0]->GetAllocatedString(
+      MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_ENDPOINT_ID, &audio_device_id,
+      &audio_device_id_size);
+
+  std::wstring endpoint_id;
+  if (SUCCEEDED(hr)) {
+    endpoint_id = std::wstring(audio_device_id, audio_device_id_size);
+  }
+
+  for (UINT32 i = 0; i < count; i++) {
+    devices[i]->Release();
+  }
+  return endpoint_id;
 }
 
-HRESULT CaptureControllerImpl::CreateD3DManagerWithDX11Device() {
-  // TODO: Use existing ANGLE device
+HRESULT CaptureControllerImpl::CreateAudioCaptureSource() {
+  audio_source_ = nullptr;
 
-  HRESULT hr = S_OK;
-  hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr,
-                         D3D11_CREATE_DEVICE_VIDEO_SUPPORT, nullptr, 0,
-                         D3D11_SDK_VERSION, &dx11_device_, nullptr, nullptr);
-  if (FAILED(hr)) {
-    return hr;
+  // The first enumerated device is often a virtual device, so the device
+  // selected as default by the user is preferred.
+  std::wstring endpoint_id = audio_device_id_.empty()
+                                 ? GetDefaultAudioCaptureEndpointId()
+                                 : Utf16FromUtf8(audio_device_id_);
+  if (endpoint_id.empty()) {
+    endpoint_id = GetFirstAudioCaptureEndpointId();
+  }
+  if (endpoint_id.empty()) {
+    // Audio is not recorded if there is no audio capture device.
+    return S_OK;
   }
 
-  // Enable multithread protection
-  ComPtr<ID3D10Multithread> multi_thread;
-  hr = dx11_device_.As(&multi_thread);
-  if (FAILED(hr)) {
-    return hr;
+  // The device source is created directly from the endpoint ID, without
+  // activating the other audio devices.
+  ComPtr<IMFAttributes> audio_capture_source_attributes;
+  HRESULT hr = MFCreateAttributes(&audio_capture_source_attributes, 2);
+
+  if (SUCCEEDED(hr)) {
+    hr = audio_capture_source_attributes->SetGUID(
+        MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
+        MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_GUID);
   }
 
-  multi_thread->SetMultithreadProtected(TRUE);
+  if (SUCCEEDED(hr)) {
+    hr = audio_capture_source_attributes->SetString(
+        MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_ENDPOINT_ID,
+        endpoint_id.c_str());
+  }
 
-  hr = MFCreateDXGIDeviceManager(&dx_device_reset_token_,
-                                 dxgi_device_manager_.GetAddressOf());
-  if (FAILED(hr)) {
-    return hr;
+  if (SUCCEEDED(hr)) {
+    hr = MFCreateDeviceSource(audio_capture_source_attributes.Get(),
+                              audio_source_.GetAddressOf());
   }
 
-  hr = dxgi_device_manager_->ResetDevice(dx11_device_.Get(),
-                                         dx_device_reset_token_);
   return hr;
 }
 
+HRESULT CaptureControllerImpl::CreateVideoCaptureSourceForDevice(
+    const std::string& video_device_id) {
+  video_source_ = nullptr;
+  return CreateVideoCaptureSource(video_device_id,
+                                  video_source_.GetAddressOf());
+}
+
 HRESULT CaptureControllerImpl::CreateCaptureEngine() {
   assert(!video_device_id_.empty());
 
   HRESULT hr = S_OK;
   ComPtr<IMFAttributes> attributes;
 
+  // Uses the capture engine and video source prewarmed for the device, if
+  // any.
+  if (!capture_engine_ && !video_source_) {
+    capture_context_->TakePrewarmedDevice(video_device_id_, &capture_engine_,
+                                          &video_source_);
+  }
+
   // Creates capture engine only if not already initialized by test framework
   if (!capture_engine_) {
-    ComPtr<IMFCaptureEngineClassFactory> capture_engine_factory;
-
-    hr = CoCreateInstance(CLSID_MFCaptureEngineClassFactory, nullptr,
-                          CLSCTX_INPROC_SERVER,
-                          IID_PPV_ARGS(&capture_engine_factory));
+    hr = CreateCaptureEngineInstance(capture_engine_.GetAddressOf());
     if (FAILED(hr)) {
       return hr;
     }
-
-    // Creates CaptureEngine.
-    hr = capture_engine_factory->CreateInstance(CLSID_MFCaptureEngine,
-                                                IID_PPV_ARGS(&capture_engine_));
-    if (FAILED(hr)) {
-      return hr;
-    }
-  }
-
-  hr = CreateD3DManagerWithDX11Device();
-
-  if (FAILED(hr)) {
-    return hr;
   }
 
   // Creates video source only if not already initialized by test framework
@@ -218,7 +330,7 @@ HRESULT CaptureControllerImpl::CreateCaptureEngine() {
 
   // Creates audio source only if not already initialized by test framework
   if (record_audio_ && !audio_source_) {
-    hr = CreateDefaultAudioCaptureSource();
+    hr = CreateAudioCaptureSource();
     if (FAILED(hr)) {
       return hr;
     }
@@ -234,8 +346,9 @@ HRESULT CaptureControllerImpl::CreateCaptureEngine() {
     return hr;
   }
 
+  // All capture engines share the device manager of the capture context.
   hr = attributes->SetUnknown(MF_CAPTURE_ENGINE_D3D_MANAGER,
-                              dxgi_device_manager_.Get());
+                              capture_context_->GetDXGIDeviceManager());
   if (FAILED(hr)) {
     return hr;
   }
@@ -267,41 +380,39 @@ void CaptureControllerImpl::ResetCaptureController() {
     StopPreview();
   }
 
-  // Shuts down the media foundation platform object.
-  // Releases all resources including threads.
-  // Application should call MFShutdown the same number of times as MFStartup
-  if (media_foundation_started_) {
-    MFShutdown();
-  }
-
   // States
-  media_foundation_started_ = false;
+  image_streaming_.store(false, std::memory_order_release);
+  last_capture_time_us_.store(0, std::memory_order_relaxed);
   capture_engine_state_ = CaptureEngineState::kNotInitialized;
   preview_frame_width_ = 0;
   preview_frame_height_ = 0;
   capture_engine_callback_handler_ = nullptr;
   capture_engine_ = nullptr;
   audio_source_ = nullptr;
+  camera_controls_ = nullptr;
   video_source_ = nullptr;
   base_preview_media_type_ = nullptr;
   base_capture_media_type_ = nullptr;
-
-  if (dxgi_device_manager_) {
-    dxgi_device_manager_->ResetDevice(dx11_device_.Get(),
-                                      dx_device_reset_token_);
-  }
-  dxgi_device_manager_ = nullptr;
-  dx11_device_ = nullptr;
+  capture_formats_.clear();
 
   record_handler_ = nullptr;
   preview_handler_ = nullptr;
   photo_handler_ = nullptr;
-  texture_handler_ = nullptr;
+  // Flutter may still be reading the last frame, so the texture handler is
+  // destroyed once its texture is unregistered instead of waiting here.
+  TextureHandler::UnregisterAndDestroy(std::move(texture_handler_));
+  preview_stats_ = nullptr;
+  zero_shutter_lag_buffer_ = nullptr;
+
+  // Released last, as the context may shut down Media Foundation if no other
+  // capture controller is using it.
+  capture_context_ = nullptr;
 }
 
 bool CaptureControllerImpl::InitCaptureDevice(
     flutter::TextureRegistrar* texture_registrar, const std::string& device_id,
-    bool record_audio, ResolutionPreset resolution_preset) {
+    const CaptureSettings& settings,
+    std::shared_ptr<CaptureContext> capture_context) {
   assert(capture_controller_listener_);
 
   if (IsInitialized()) {
@@ -315,23 +426,34 @@ bool CaptureControllerImpl::InitCaptureDevice(
   }
 
   capture_engine_state_ = CaptureEngineState::kInitializing;
-  resolution_preset_ = resolution_preset;
-  record_audio_ = record_audio;
+  resolution_preset_ = settings.resolution_preset;
+  target_frame_rate_ = static_cast<float>(settings.target_frame_rate);
+  record_audio_ = settings.record_audio;
+  audio_device_id_ = settings.audio_device_id;
+  preview_texture_mode_ = settings.preview_texture_mode;
+  preview_pixel_format_ = settings.preview_pixel_format;
+  // Zero shutter lag photos are encoded from preview frames, which must keep
+  // the captured resolution.
+  adaptive_preview_ = settings.adaptive_preview && !settings.zero_shutter_lag;
+  if (settings.zero_shutter_lag) {
+    zero_shutter_lag_buffer_ =
+        std::make_unique<ZeroShutterLagBuffer>(kZeroShutterLagFrameCount);
+  }
+  if (settings.preview_stats) {
+    preview_stats_ = std::make_shared<PreviewStats>();
+  }
+  if (settings.preview_max_frame_rate > 0) {
+    preview_frame_throttle_.SetMaxFrameRate(settings.preview_max_frame_rate);
+  }
   texture_registrar_ = texture_registrar;
   video_device_id_ = device_id;
 
-  // MFStartup must be called before using Media Foundation.
-  if (!media_foundation_started_) {
-    HRESULT hr = MFStartup(MF_VERSION);
-
-    if (FAILED(hr)) {
-      capture_controller_listener_->OnCreateCaptureEngineFailed(
-          GetCameraResult(hr), "Failed to create camera");
-      ResetCaptureController();
-      return false;
-    }
-
-    media_foundation_started_ = true;
+  capture_context_ = std::move(capture_context);
+  if (!capture_context_) {
+    capture_controller_listener_->OnCreateCaptureEngineFailed(
+        CameraResult::kError, "Failed to create camera");
+    ResetCaptureController();
+    return false;
   }
 
   HRESULT hr = CreateCaptureEngine();
@@ -345,6 +467,10 @@ bool CaptureControllerImpl::InitCaptureDevice(
   return true;
 }
 
+void CaptureControllerImpl::SetPictureRotation(PhotoRotation rotation) {
+  picture_rotation_ = rotation;
+}
+
 void CaptureControllerImpl::TakePicture(const std::string& file_path) {
   assert(capture_engine_callback_handler_);
   assert(capture_engine_);
@@ -355,6 +481,24 @@ void CaptureControllerImpl::TakePicture(const std::string& file_path) {
 
   HRESULT hr = S_OK;
 
+  // Uses the photo sink until the preview has delivered a frame.
+  BufferedFrame frame;
+  if (zero_shutter_lag_buffer_ &&
+      zero_shutter_lag_buffer_->GetClosestFrame(
+          last_capture_time_us_.load(std::memory_order_relaxed), &frame)) {
+    if (!photo_handler_) {
+      photo_handler_ = std::make_unique<PhotoHandler>();
+    }
+
+    hr = photo_handler_->TakeZeroShutterLagPhoto(file_path, frame,
+                                                 picture_rotation_);
+    if (FAILED(hr)) {
+      return capture_controller_listener_->OnTakePictureFailed(
+          GetCameraResult(hr), "Failed to take photo");
+    }
+    return capture_controller_listener_->OnTakePictureSucceeded(file_path);
+  }
+
   if (!base_capture_media_type_) {
     // Enumerates mediatypes and finds media type for video capture.
     hr = FindBaseMediaTypes();
@@ -372,7 +516,8 @@ void CaptureControllerImpl::TakePicture(const std::string& file_path) {
 
   // Check MF_CAPTURE_ENGINE_PHOTO_TAKEN event handling
   // for response process.
-  hr = photo_handler_->TakePhoto(file_path, capture_engine_.Get(),
+  hr = photo_handler_->TakePhoto(file_path, picture_rotation_,
+                                 capture_engine_.Get(),
                                  base_capture_media_type_.Get());
   if (FAILED(hr)) {
     // Destroy photo handler on error cases to make sure state is resetted.
@@ -381,8 +526,110 @@ void CaptureControllerImpl::TakePicture(const std::string& file_path) {
   }
 }
 
-uint32_t CaptureControllerImpl::GetMaxPreviewHeight() const {
-  switch (resolution_preset_) {
+void CaptureControllerImpl::TakePictureData(const PhotoSettings& settings) {
+  assert(capture_engine_callback_handler_);
+  assert(capture_engine_);
+
+  if (!IsInitialized()) {
+    return capture_controller_listener_->OnTakePictureDataFailed(
+        CameraResult::kError, "Not initialized");
+  }
+
+  HRESULT hr = S_OK;
+  PhotoSettings rotated_settings = settings;
+  rotated_settings.rotation = picture_rotation_;
+
+  // Uses the photo sink until the preview has delivered a frame.
+  BufferedFrame frame;
+  if (zero_shutter_lag_buffer_ &&
+      zero_shutter_lag_buffer_->GetClosestFrame(
+          last_capture_time_us_.load(std::memory_order_relaxed), &frame)) {
+    if (!photo_handler_) {
+      photo_handler_ = std::make_unique<PhotoHandler>();
+    }
+
+    std::vector<uint8_t> data;
+    hr = photo_handler_->EncodeZeroShutterLagPhoto(frame, rotated_settings,
+                                                   &data);
+    if (FAILED(hr)) {
+      return capture_controller_listener_->OnTakePictureDataFailed(
+          GetCameraResult(hr), "Failed to take photo");
+    }
+    return capture_controller_listener_->OnTakePictureDataSucceeded(data);
+  }
+
+  if (!base_capture_media_type_) {
+    // Enumerates mediatypes and finds media type for video capture.
+    hr = FindBaseMediaTypes();
+    if (FAILED(hr)) {
+      return capture_controller_listener_->OnTakePictureDataFailed(
+          GetCameraResult(hr), "Failed to initialize photo capture");
+    }
+  }
+
+  if (!photo_handler_) {
+    photo_handler_ = std::make_unique<PhotoHandler>();
+  } else if (photo_handler_->IsTakingPhoto()) {
+    return capture_controller_listener_->OnTakePictureDataFailed(
+        CameraResult::kError, "Photo already requested");
+  }
+
+  // Check MF_CAPTURE_ENGINE_PHOTO_TAKEN event handling
+  // for response process.
+  hr = photo_handler_->TakePhotoData(rotated_settings, capture_engine_.Get(),
+                                     base_capture_media_type_.Get());
+  if (FAILED(hr)) {
+    // Destroy photo handler on error cases to make sure state is resetted.
+    photo_handler_ = nullptr;
+    return capture_controller_listener_->OnTakePictureDataFailed(
+        GetCameraResult(hr), "Failed to take photo");
+  }
+}
+
+void CaptureControllerImpl::TakePictureBurst(
+    const std::vector<std::string>& file_paths) {
+  assert(capture_engine_callback_handler_);
+  assert(capture_engine_);
+  assert(!file_paths.empty());
+
+  if (!IsInitialized()) {
+    return capture_controller_listener_->OnTakePictureBurstFailed(
+        CameraResult::kError, "Not initialized");
+  }
+
+  HRESULT hr = S_OK;
+
+  if (!base_capture_media_type_) {
+    // Enumerates mediatypes and finds media type for video capture.
+    hr = FindBaseMediaTypes();
+    if (FAILED(hr)) {
+      return capture_controller_listener_->OnTakePictureBurstFailed(
+          GetCameraResult(hr), "Failed to initialize photo capture");
+    }
+  }
+
+  if (!photo_handler_) {
+    photo_handler_ = std::make_unique<PhotoHandler>();
+  } else if (photo_handler_->IsTakingPhoto()) {
+    return capture_controller_listener_->OnTakePictureBurstFailed(
+        CameraResult::kError, "Photo already requested");
+  }
+
+  // Check MF_CAPTURE_ENGINE_PHOTO_TAKEN event handling
+  // for response process.
+  hr = photo_handler_->TakePhotoBurst(file_paths, picture_rotation_,
+                                      capture_engine_.Get(),
+                                      base_capture_media_type_.Get());
+  if (FAILED(hr)) {
+    // Destroy photo handler on error cases to make sure state is resetted.
+    photo_handler_ = nullptr;
+    return capture_controller_listener_->OnTakePictureBurstFailed(
+        GetCameraResult(hr), "Failed to take photo");
+  }
+}
+
+uint32_t GetResolutionPresetMaxHeight(ResolutionPreset resolution_preset) {
+  switch (resolution_preset) {
     case ResolutionPreset::kLow:
       return 240;
       break;
@@ -407,62 +654,50 @@ uint32_t CaptureControllerImpl::GetMaxPreviewHeight() const {
   }
 }
 
-// Finds best media type for given source stream index and max height;
-bool FindBestMediaType(DWORD source_stream_index, IMFCaptureSource* source,
-                       IMFMediaType** target_media_type, uint32_t max_height,
-                       uint32_t* target_frame_width,
-                       uint32_t* target_frame_height,
-                       float minimum_accepted_framerate = 15.f) {
-  assert(source);
-  ComPtr<IMFMediaType> media_type;
-
-  uint32_t best_width = 0;
-  uint32_t best_height = 0;
-  float best_framerate = 0.f;
-
-  // Loop native media types.
-  for (int i = 0;; i++) {
-    if (FAILED(source->GetAvailableDeviceMediaType(
-            source_stream_index, i, media_type.GetAddressOf()))) {
-      break;
-    }
+uint32_t CaptureControllerImpl::GetMaxPreviewHeight() const {
+  return GetResolutionPresetMaxHeight(resolution_preset_);
+}
 
-    uint32_t frame_rate_numerator, frame_rate_denominator;
-    if (FAILED(MFGetAttributeRatio(media_type.Get(), MF_MT_FRAME_RATE,
-                                   &frame_rate_numerator,
-                                   &frame_rate_denominator)) ||
-        !frame_rate_denominator) {
-      continue;
-    }
-
-    float frame_rate =
-        static_cast<float>(frame_rate_numerator) / frame_rate_denominator;
-    if (frame_rate < minimum_accepted_framerate) {
-      continue;
-    }
-
-    uint32_t frame_width;
-    uint32_t frame_height;
-    if (SUCCEEDED(MFGetAttributeSize(media_type.Get(), MF_MT_FRAME_SIZE,
-                                     &frame_width, &frame_height))) {
-      // Update target mediatype
-      if (frame_height <= max_height &&
-          (best_width < frame_width || best_height < frame_height ||
-           best_framerate < frame_rate)) {
-        media_type.CopyTo(target_media_type);
-        best_width = frame_width;
-        best_height = frame_height;
-        best_framerate = frame_rate;
+std::vector<CaptureFormat> GetDistinctCaptureFormats(
+    const MediaTypeCache::MediaTypeList& media_types) {
+  // Native types often only differ by subtype, which is hidden from Dart.
+  std::vector<CaptureFormat> capture_formats;
+  for (const DeviceMediaType& media_type : media_types) {
+    bool duplicate = false;
+    for (const CaptureFormat& format : capture_formats) {
+      if (format.width == media_type.width &&
+          format.height == media_type.height &&
+          format.frame_rate == media_type.frame_rate) {
+        duplicate = true;
+        break;
       }
     }
+    if (!duplicate) {
+      capture_formats.push_back(
+          {media_type.width, media_type.height, media_type.frame_rate});
+    }
   }
+  return capture_formats;
+}
 
-  if (target_frame_width && target_frame_height) {
-    *target_frame_width = best_width;
-    *target_frame_height = best_height;
+// Finds best media type for given max height and frame rate from the native
+// media types of a source stream.
+bool FindBestMediaType(const MediaTypeCache::MediaTypeList& media_types,
+                       IMFMediaType** target_media_type, uint32_t max_height,
+                       float target_frame_rate, uint32_t* target_frame_width,
+                       uint32_t* target_frame_height) {
+  const DeviceMediaType* best =
+      FindBestDeviceMediaType(media_types, max_height, target_frame_rate);
+  if (!best) {
+    return false;
   }
 
-  return *target_media_type != nullptr;
+  best->media_type.CopyTo(target_media_type);
+  if (target_frame_width && target_frame_height) {
+    *target_frame_width = best->width;
+    *target_frame_height = best->height;
+  }
+  return true;
 }
 
 HRESULT CaptureControllerImpl::FindBaseMediaTypes() {
@@ -476,28 +711,40 @@ HRESULT CaptureControllerImpl::FindBaseMediaTypes() {
     return hr;
   }
 
+  MediaTypeCache& cache = MediaTypeCache::GetInstance();
+
   // Find base media type for previewing.
-  if (!FindBestMediaType(
+  std::shared_ptr<const MediaTypeCache::MediaTypeList> preview_media_types =
+      cache.GetMediaTypes(
+          video_device_id_,
           (DWORD)MF_CAPTURE_ENGINE_PREFERRED_SOURCE_STREAM_FOR_VIDEO_PREVIEW,
-          source.Get(), base_preview_media_type_.GetAddressOf(),
-          GetMaxPreviewHeight(), &preview_frame_width_,
-          &preview_frame_height_)) {
+          source.Get());
+  if (!FindBestMediaType(*preview_media_types,
+                         base_preview_media_type_.GetAddressOf(),
+                         GetMaxPreviewHeight(), target_frame_rate_,
+                         &preview_frame_width_, &preview_frame_height_)) {
     return E_FAIL;
   }
 
   // Find base media type for record and photo capture.
-  if (!FindBestMediaType(
+  std::shared_ptr<const MediaTypeCache::MediaTypeList> capture_media_types =
+      cache.GetMediaTypes(
+          video_device_id_,
           (DWORD)MF_CAPTURE_ENGINE_PREFERRED_SOURCE_STREAM_FOR_VIDEO_RECORD,
-          source.Get(), base_capture_media_type_.GetAddressOf(), 0xffffffff,
-          nullptr, nullptr)) {
+          source.Get());
+  if (!FindBestMediaType(*capture_media_types,
+                         base_capture_media_type_.GetAddressOf(), 0xffffffff,
+                         target_frame_rate_, nullptr, nullptr)) {
     return E_FAIL;
   }
 
+  capture_formats_ = GetDistinctCaptureFormats(*capture_media_types);
   return S_OK;
 }
 
 void CaptureControllerImpl::StartRecord(const std::string& file_path,
-                                        int64_t max_video_duration_ms) {
+                                        int64_t max_video_duration_ms,
+                                        const VideoRecordSettings& settings) {
   assert(capture_engine_);
 
   if (!IsInitialized()) {
@@ -519,6 +766,24 @@ void CaptureControllerImpl::StartRecord(const std::string& file_path,
 
   if (!record_handler_) {
     record_handler_ = std::make_unique<RecordHandler>(record_audio_);
+    record_handler_->SetRecordChunkCallback(
+        [this](uint64_t offset, const uint8_t* data, uint32_t size) {
+          if (capture_controller_listener_) {
+            std::vector<uint8_t> chunk(data, data + size);
+            capture_controller_listener_->OnVideoRecordChunkAvailable(offset,
+                                                                      chunk);
+          }
+        });
+    // Timed recordings are stopped on the work queue, as the record handler
+    // reports the maximum duration from a sample callback of the record
+    // sink, which stopping the recording waits for.
+    record_handler_->SetMaxDurationReachedCallback([this]() {
+      if (work_queue_) {
+        work_queue_->Post([this]() { StopTimedRecord(); });
+      } else {
+        StopTimedRecord();
+      }
+    });
   } else if (!record_handler_->CanStart()) {
     return OnRecordStarted(
         CameraResult::kError,
@@ -530,7 +795,7 @@ void CaptureControllerImpl::StartRecord(const std::string& file_path,
   // process.
   hr = record_handler_->StartRecord(file_path, max_video_duration_ms,
                                     capture_engine_.Get(),
-                                    base_capture_media_type_.Get());
+                                    base_capture_media_type_.Get(), settings);
   if (FAILED(hr)) {
     // Destroy record handler on error cases to make sure state is resetted.
     record_handler_ = nullptr;
@@ -579,6 +844,93 @@ void CaptureControllerImpl::StopTimedRecord() {
   }
 }
 
+// Pauses the current recording. Captured samples are dropped until the
+// recording is resumed, so that paused time is left out of the recording.
+void CaptureControllerImpl::PauseRecord() {
+  assert(capture_controller_listener_);
+
+  if (!record_handler_ || !record_handler_->CanPause()) {
+    return capture_controller_listener_->OnPauseRecordFailed(
+        CameraResult::kError, "Recording not running");
+  }
+
+  HRESULT hr = record_handler_->PauseRecord();
+  if (FAILED(hr)) {
+    return capture_controller_listener_->OnPauseRecordFailed(
+        GetCameraResult(hr), "Failed to pause video recording");
+  }
+  capture_controller_listener_->OnPauseRecordSucceeded();
+}
+
+// Resumes the paused recording at the next video keyframe.
+void CaptureControllerImpl::ResumeRecord() {
+  assert(capture_controller_listener_);
+
+  if (!record_handler_ || !record_handler_->CanResume()) {
+    return capture_controller_listener_->OnResumeRecordFailed(
+        CameraResult::kError, "Recording not paused");
+  }
+
+  HRESULT hr = record_handler_->ResumeRecord();
+  if (FAILED(hr)) {
+    return capture_controller_listener_->OnResumeRecordFailed(
+        GetCameraResult(hr), "Failed to resume video recording");
+  }
+  capture_controller_listener_->OnResumeRecordSucceeded();
+}
+
+bool CaptureControllerImpl::SetZoomLevel(double zoom_level) {
+  if (!IsValidPreviewZoomLevel(zoom_level)) {
+    return false;
+  }
+  zoom_level_ = zoom_level;
+  if (texture_handler_) {
+    texture_handler_->SetCrop(preview_crop_rect_, zoom_level_);
+  }
+  return true;
+}
+
+bool CaptureControllerImpl::SetPreviewCropRect(
+    const PreviewCropRect& crop_rect) {
+  if (!IsValidPreviewCropRect(crop_rect)) {
+    return false;
+  }
+  preview_crop_rect_ = crop_rect;
+  if (texture_handler_) {
+    texture_handler_->SetCrop(preview_crop_rect_, zoom_level_);
+  }
+  return true;
+}
+
+bool CaptureControllerImpl::SetPreviewRotation(PreviewRotation rotation) {
+  if (texture_handler_ && !texture_handler_->SetRotation(rotation)) {
+    return false;
+  }
+  preview_rotation_ = rotation;
+  return true;
+}
+
+void CaptureControllerImpl::SetPreviewTargetFrameRate(
+    std::optional<double> frames_per_second) {
+  preview_frame_throttle_.SetTargetFrameRate(frames_per_second);
+}
+
+void CaptureControllerImpl::SetPreviewWindowHidden(bool hidden) {
+  preview_frame_throttle_.SetHidden(hidden);
+}
+
+CameraControls* CaptureControllerImpl::GetCameraControls() {
+  if (!video_source_) {
+    return nullptr;
+  }
+  // Control interfaces and ranges are queried once per device.
+  if (!camera_controls_) {
+    camera_controls_ =
+        std::make_unique<CameraControlsImpl>(video_source_.Get());
+  }
+  return camera_controls_.get();
+}
+
 // Starts capturing preview frames using preview handler
 // After first frame is captured, OnPreviewStarted is called
 void CaptureControllerImpl::StartPreview() {
@@ -605,6 +957,9 @@ void CaptureControllerImpl::StartPreview() {
 
   texture_handler_->UpdateTextureSize(preview_frame_width_,
                                       preview_frame_height_);
+  adaptive_preview_width_ = preview_frame_width_;
+  adaptive_preview_height_ = preview_frame_height_;
+  adaptive_preview_size_pending_ = false;
 
   // TODO(loic-sharma): This does not handle duplicate calls properly.
   // See: https://github.com/flutter/flutter/issues/108404
@@ -620,7 +975,8 @@ void CaptureControllerImpl::StartPreview() {
   // process.
   hr = preview_handler_->StartPreview(capture_engine_.Get(),
                                       base_preview_media_type_.Get(),
-                                      capture_engine_callback_handler_.Get());
+                                      capture_engine_callback_handler_.Get(),
+                                      preview_pixel_format_);
 
   if (FAILED(hr)) {
     // Destroy preview handler on error cases to make sure state is resetted.
@@ -693,6 +1049,24 @@ void CaptureControllerImpl::OnEvent(IMFMediaEvent* event) {
     return;
   }
 
+  if (!work_queue_) {
+    return HandleEvent(event);
+  }
+
+  // Returns to the capture engine right away, so that the thread raising the
+  // event can go on delivering samples.
+  ComPtr<IMFMediaEvent> queued_event = event;
+  work_queue_->Post(
+      [this, queued_event]() { HandleEvent(queued_event.Get()); });
+}
+
+void CaptureControllerImpl::HandleEvent(IMFMediaEvent* event) {
+  // The controller may have been reset while the event was queued.
+  if (!IsInitialized() &&
+      capture_engine_state_ != CaptureEngineState::kInitializing) {
+    return;
+  }
+
   GUID extended_type_guid;
   if (SUCCEEDED(event->GetExtendedType(&extended_type_guid))) {
     std::string error;
@@ -737,19 +1111,96 @@ void CaptureControllerImpl::OnEvent(IMFMediaEvent* event) {
 // Handles Picture event and informs CaptureControllerListener.
 void CaptureControllerImpl::OnPicture(CameraResult result,
                                       const std::string& error) {
+  if (photo_handler_ && photo_handler_->IsTakingBurst()) {
+    return OnPictureBurst(result, error);
+  } else if (photo_handler_ && photo_handler_->IsTakingPhotoData()) {
+    return OnPictureData(result, error);
+  }
+
+  HRESULT hr = S_OK;
   if (result == CameraResult::kSuccess && photo_handler_) {
+    hr = photo_handler_->OnPhotoTaken();
+    if (SUCCEEDED(hr)) {
+      if (capture_controller_listener_) {
+        std::string path = photo_handler_->GetPhotoPath();
+        capture_controller_listener_->OnTakePictureSucceeded(path);
+      }
+      return;
+    }
+  }
+
+  if (capture_controller_listener_) {
+    if (FAILED(hr)) {
+      capture_controller_listener_->OnTakePictureFailed(
+          GetCameraResult(hr), "Failed to write photo orientation");
+    } else {
+      capture_controller_listener_->OnTakePictureFailed(result, error);
+    }
+  }
+  // Destroy photo handler on error cases to make sure state is resetted.
+  photo_handler_ = nullptr;
+}
+
+// Handles Picture event of a photo taken in memory and informs
+// CaptureControllerListener.
+void CaptureControllerImpl::OnPictureData(CameraResult result,
+                                          const std::string& error) {
+  assert(photo_handler_);
+
+  std::vector<uint8_t> data;
+  HRESULT hr = photo_handler_->OnPhotoDataTaken(&data);
+  if (result == CameraResult::kSuccess && SUCCEEDED(hr)) {
     if (capture_controller_listener_) {
-      std::string path = photo_handler_->GetPhotoPath();
-      capture_controller_listener_->OnTakePictureSucceeded(path);
+      capture_controller_listener_->OnTakePictureDataSucceeded(data);
     }
-    photo_handler_->OnPhotoTaken();
-  } else {
+    return;
+  }
+
+  if (capture_controller_listener_) {
+    if (result == CameraResult::kSuccess) {
+      capture_controller_listener_->OnTakePictureDataFailed(
+          GetCameraResult(hr), "Failed to encode photo");
+    } else {
+      capture_controller_listener_->OnTakePictureDataFailed(result, error);
+    }
+  }
+  // Destroy photo handler on error cases to make sure state is resetted.
+  photo_handler_ = nullptr;
+}
+
+// Handles Picture event of a burst and informs CaptureControllerListener once
+// all photos are taken.
+void CaptureControllerImpl::OnPictureBurst(CameraResult result,
+                                           const std::string& error) {
+  assert(photo_handler_);
+
+  HRESULT hr = E_FAIL;
+  if (result == CameraResult::kSuccess) {
+    hr = photo_handler_->OnBurstPhotoTaken(capture_engine_.Get());
+    if (hr == S_OK) {
+      // The next photo of the burst was requested.
+      return;
+    }
+  }
+
+  if (hr == S_FALSE) {
     if (capture_controller_listener_) {
-      capture_controller_listener_->OnTakePictureFailed(result, error);
+      capture_controller_listener_->OnTakePictureBurstSucceeded(
+          photo_handler_->GetBurstPhotoPaths());
+    }
+    return;
+  }
+
+  if (capture_controller_listener_) {
+    if (result == CameraResult::kSuccess) {
+      capture_controller_listener_->OnTakePictureBurstFailed(
+          GetCameraResult(hr), "Failed to take photo");
+    } else {
+      capture_controller_listener_->OnTakePictureBurstFailed(result, error);
     }
-    // Destroy photo handler on error cases to make sure state is resetted.
-    photo_handler_ = nullptr;
   }
+  // Destroy photo handler on error cases to make sure state is resetted.
+  photo_handler_ = nullptr;
 }
 
 // Handles CaptureEngineInitialized event and informs
@@ -766,6 +1217,14 @@ void CaptureControllerImpl::OnCaptureEngineInitialized(
 
     // Create texture handler and register new texture.
     texture_handler_ = std::make_unique<TextureHandler>(texture_registrar_);
+    texture_handler_->SetPixelFormat(preview_pixel_format_);
+    texture_handler_->SetPreviewStats(preview_stats_);
+    texture_handler_->SetCrop(preview_crop_rect_, zoom_level_);
+    texture_handler_->SetRotation(preview_rotation_);
+    if (preview_texture_mode_ == PreviewTextureMode::kGpuSurface) {
+      // Falls back to pixel buffer texture if GPU surface is not supported.
+      texture_handler_->EnableGpuSurface(capture_context_->GetD3DDevice());
+    }
 
     int64_t texture_id = texture_handler_->RegisterTexture();
     if (texture_id >= 0) {
@@ -843,6 +1302,16 @@ void CaptureControllerImpl::OnRecordStarted(CameraResult result,
 // Handles RecordStopped event and informs CaptureControllerListener.
 void CaptureControllerImpl::OnRecordStopped(CameraResult result,
                                             const std::string& error) {
+  std::string stop_error = error;
+  if (result == CameraResult::kSuccess && record_handler_) {
+    // The file is complete only after the remaining samples are written.
+    HRESULT hr = record_handler_->FinalizeRecord();
+    if (FAILED(hr)) {
+      result = GetCameraResult(hr);
+      stop_error = "Failed to write video recording";
+    }
+  }
+
   if (capture_controller_listener_ && record_handler_) {
     // Always calls OnStopRecord listener methods
     // to handle separate stop record request for timed records.
@@ -855,9 +1324,9 @@ void CaptureControllerImpl::OnRecordStopped(CameraResult result,
             path, (record_handler_->GetRecordedDuration() / 1000));
       }
     } else {
-      capture_controller_listener_->OnStopRecordFailed(result, error);
+      capture_controller_listener_->OnStopRecordFailed(result, stop_error);
       if (record_handler_->IsTimedRecording()) {
-        capture_controller_listener_->OnVideoRecordFailed(result, error);
+        capture_controller_listener_->OnVideoRecordFailed(result, stop_error);
       }
     }
   }
@@ -873,16 +1342,214 @@ void CaptureControllerImpl::OnRecordStopped(CameraResult result,
 // Updates texture handlers buffer with given data.
 // Called via IMFCaptureEngineOnSampleCallback implementation.
 // Implements CaptureEngineObserver::UpdateBuffer.
-bool CaptureControllerImpl::UpdateBuffer(uint8_t* buffer,
-                                         uint32_t data_length) {
-  if (!texture_handler_) {
+bool CaptureControllerImpl::UpdateBuffer(const uint8_t* buffer,
+                                         uint32_t data_length,
+                                         int32_t stride) {
+  const bool preview_frame_due =
+      preview_frame_due_.load(std::memory_order_relaxed);
+  if (preview_stats_ && preview_frame_due) {
+    preview_stats_->OnFrameReceived(
+        last_capture_time_us_.load(std::memory_order_relaxed),
+        PreviewStats::GetTimeUs());
+  }
+
+  DeliverImageStreamFrame(buffer, data_length, stride);
+
+  if (zero_shutter_lag_buffer_) {
+    zero_shutter_lag_buffer_->AddFrame(
+        buffer, data_length, stride, adaptive_preview_width_,
+        adaptive_preview_height_, preview_pixel_format_,
+        last_capture_time_us_.load(std::memory_order_relaxed));
+  }
+
+  // Throttled frames are not converted into the preview texture.
+  if (!preview_frame_due) {
+    return true;
+  }
+
+  if (!texture_handler_ ||
+      !texture_handler_->UpdateBuffer(buffer, data_length, stride)) {
+    return false;
+  }
+  UpdateAdaptivePreviewSize();
+  return true;
+}
+
+// Updates texture handlers GPU surface with given texture.
+// Called via IMFCaptureEngineOnSampleCallback implementation.
+// Implements CaptureEngineObserver::UpdateTexture.
+bool CaptureControllerImpl::UpdateTexture(ID3D11Texture2D* texture,
+                                          UINT subresource_index) {
+  // Throttled frames only reach the image stream and zero shutter lag
+  // buffer, which read them in |UpdateBuffer|.
+  if (!preview_frame_due_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  // A sample that is not rendered here is delivered to |UpdateBuffer| with
+  // the same capture time, and keeps its frame id.
+  if (preview_stats_) {
+    preview_stats_->OnFrameReceived(
+        last_capture_time_us_.load(std::memory_order_relaxed),
+        PreviewStats::GetTimeUs());
+  }
+
+  // Image stream and zero shutter lag frames are read on the CPU, so the
+  // sample is delivered to |UpdateBuffer| instead while they are used.
+  if (image_streaming_.load(std::memory_order_acquire) ||
+      zero_shutter_lag_buffer_ || !texture_handler_ ||
+      !texture_handler_->IsGpuSurfaceEnabled() ||
+      !texture_handler_->UpdateTexture(texture, subresource_index)) {
+    return false;
+  }
+  UpdateAdaptivePreviewSize();
+  return true;
+}
+
+// Called via IMFCaptureEngineOnSampleCallback2 implementation from the sample
+// thread, so that size changes are ordered with the samples.
+// Implements CaptureEngineObserver::OnSynchronizedEvent.
+void CaptureControllerImpl::OnSynchronizedEvent(IMFMediaEvent* event) {
+  GUID extended_type_guid;
+  if (!texture_handler_ || !adaptive_preview_size_pending_ ||
+      FAILED(event->GetExtendedType(&extended_type_guid)) ||
+      extended_type_guid != MF_CAPTURE_ENGINE_OUTPUT_MEDIA_TYPE_SET) {
+    return;
+  }
+
+  // Samples after this event have the new output size.
+  adaptive_preview_size_pending_ = false;
+  adaptive_preview_width_ = pending_adaptive_preview_width_;
+  adaptive_preview_height_ = pending_adaptive_preview_height_;
+  texture_handler_->UpdateTextureSize(adaptive_preview_width_,
+                                      adaptive_preview_height_);
+}
+
+bool CaptureControllerImpl::StartImageStream(ImageStreamFormat format) {
+  if (!IsInitialized()) {
     return false;
   }
-  return texture_handler_->UpdateBuffer(buffer, data_length);
+
+  image_stream_format_ = format;
+  image_stream_pending_frames_.store(0, std::memory_order_relaxed);
+  image_streaming_.store(true, std::memory_order_release);
+  return true;
+}
+
+void CaptureControllerImpl::StopImageStream() {
+  image_streaming_.store(false, std::memory_order_release);
+}
+
+void CaptureControllerImpl::OnImageStreamFrameReceived() {
+  if (image_stream_pending_frames_.fetch_sub(1, std::memory_order_relaxed) <=
+      0) {
+    image_stream_pending_frames_.store(0, std::memory_order_relaxed);
+  }
+}
+
+void CaptureControllerImpl::DeliverImageStreamFrame(const uint8_t* data,
+                                                    uint32_t data_length,
+                                                    int32_t stride) {
+  if (!image_streaming_.load(std::memory_order_acquire) ||
+      image_stream_pending_frames_.load(std::memory_order_relaxed) >=
+          kMaxImageStreamPendingFrames) {
+    return;
+  }
+
+  ImageStreamFrame frame;
+  if (!BuildImageStreamFrame(data, data_length, stride,
+                             adaptive_preview_width_, adaptive_preview_height_,
+                             preview_pixel_format_, image_stream_format_,
+                             &frame)) {
+    return;
+  }
+
+  if (capture_controller_listener_->OnImageStreamFrameAvailable(frame)) {
+    image_stream_pending_frames_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void CaptureControllerImpl::UpdateAdaptivePreviewSize() {
+  if (!adaptive_preview_ || adaptive_preview_size_pending_ ||
+      !preview_handler_ || preview_frame_width_ == 0 ||
+      preview_frame_height_ == 0 || adaptive_preview_width_ == 0) {
+    return;
+  }
+
+  // The requested size is in the orientation of the rotated texture.
+  uint32_t requested_width = texture_handler_->GetRequestedWidth();
+  uint32_t requested_height = texture_handler_->GetRequestedHeight();
+  if (IsQuarterTurn(preview_rotation_)) {
+    std::swap(requested_width, requested_height);
+  }
+  const uint32_t visible_width = texture_handler_->GetVisibleWidth();
+  const uint32_t visible_height = texture_handler_->GetVisibleHeight();
+  if (requested_width == 0 || requested_height == 0 || visible_width == 0 ||
+      visible_height == 0) {
+    return;
+  }
+
+  // Scales the preview so that its visible region covers the requested size
+  // with the original aspect ratio. The preview is never captured above the
+  // resolution preset.
+  double scale = static_cast<double>(requested_width) *
+                 adaptive_preview_width_ / visible_width /
+                 preview_frame_width_;
+  const double height_scale = static_cast<double>(requested_height) *
+                              adaptive_preview_height_ / visible_height /
+                              preview_frame_height_;
+  if (height_scale > scale) {
+    scale = height_scale;
+  }
+  if (scale > 1.0) {
+    scale = 1.0;
+  }
+
+  // Frame sizes are kept even for the video processor.
+  uint32_t width =
+      static_cast<uint32_t>(preview_frame_width_ * scale + 1.0) & ~1u;
+  uint32_t height =
+      static_cast<uint32_t>(preview_frame_height_ * scale + 1.0) & ~1u;
+  if (width > preview_frame_width_ || height > preview_frame_height_) {
+    width = preview_frame_width_;
+    height = preview_frame_height_;
+  }
+  if (width < 2 || height < 2) {
+    return;
+  }
+
+  // Grows immediately, but only shrinks on significant changes to avoid
+  // reconfiguring the sink while the preview is being resized.
+  if (width == adaptive_preview_width_ ||
+      (width < adaptive_preview_width_ &&
+       width > adaptive_preview_width_ * 3 / 4)) {
+    return;
+  }
+
+  if (SUCCEEDED(preview_handler_->SetPreviewFrameSize(width, height))) {
+    adaptive_preview_size_pending_ = true;
+    pending_adaptive_preview_width_ = width;
+    pending_adaptive_preview_height_ = height;
+  }
+}
+
+std::optional<PreviewStatsSnapshot> CaptureControllerImpl::GetPreviewStats()
+    const {
+  if (!preview_stats_) {
+    return std::nullopt;
+  }
+  return preview_stats_->GetSnapshot();
+}
+
+std::optional<RecordSampleStats> CaptureControllerImpl::GetRecordingStats()
+    const {
+  if (!record_handler_) {
+    return std::nullopt;
+  }
+  return record_handler_->GetRecordStats();
 }
 
 // Handles capture time update from each processed frame.
-// Stops timed recordings if requested recording duration has passed.
 // Called via IMFCaptureEngineOnSampleCallback implementation.
 // Implements CaptureEngineObserver::UpdateCaptureTime.
 void CaptureControllerImpl::UpdateCaptureTime(uint64_t capture_time_us) {
@@ -890,19 +1557,28 @@ void CaptureControllerImpl::UpdateCaptureTime(uint64_t capture_time_us) {
     return;
   }
 
+  // Used as the shutter time of zero shutter lag photos.
+  last_capture_time_us_.store(capture_time_us, std::memory_order_relaxed);
+  preview_frame_due_.store(
+      preview_frame_throttle_.ShouldDeliverFrame(capture_time_us),
+      std::memory_order_relaxed);
+
   if (preview_handler_ && preview_handler_->IsStarting()) {
     // Informs that first frame is captured successfully and preview has
     // started.
     OnPreviewStarted(CameraResult::kSuccess, "");
   }
+}
 
-  // Checks if max_video_duration_ms is passed.
-  if (record_handler_) {
-    record_handler_->UpdateRecordingTime(capture_time_us);
-    if (record_handler_->ShouldStopTimedRecording()) {
-      StopTimedRecord();
-    }
+std::unique_ptr<CaptureController>
+CaptureControllerFactoryImpl::CreateCaptureController(
+    CaptureControllerListener* listener) {
+  if (backend_ == CaptureBackend::kSourceReader) {
+    return std::make_unique<SourceReaderCaptureController>(
+        listener, std::make_unique<CaptureWorkQueue>());
   }
+  return std::make_unique<CaptureControllerImpl>(
+      listener, std::make_unique<CaptureWorkQueue>());
 }
 
 }  // namespace camera_windows
@@ -14,15 +14,26 @@
 #include <windows.h>
 #include <wrl/client.h>
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
+#include "camera_controls.h"
+#include "capture_context.h"
 #include "capture_controller_listener.h"
 #include "capture_engine_listener.h"
+#include "capture_work_queue.h"
+#include "media_type_cache.h"
 #include "photo_handler.h"
+#include "preview_crop.h"
+#include "preview_frame_throttle.h"
 #include "preview_handler.h"
+#include "preview_stats.h"
 #include "record_handler.h"
 #include "texture_handler.h"
+#include "zero_shutter_lag_buffer.h"
 
 namespace camera_windows {
 using flutter::TextureRegistrar;
@@ -46,6 +57,107 @@ enum class ResolutionPreset {
   kMax,
 };
 
+// Texture types that can be used for the camera preview.
+enum class PreviewTextureMode {
+  // Frames are converted on the CPU into a Flutter pixel buffer.
+  kPixelBuffer,
+  // Frames are rendered on the GPU into a DXGI shared surface. If the device
+  // cannot render shared surfaces, |kPixelBuffer| is used instead.
+  kGpuSurface,
+};
+
+// Media Foundation pipelines that capture controllers are built on.
+enum class CaptureBackend {
+  // |IMFCaptureEngine|, which supports every feature of the plugin.
+  kCaptureEngine,
+  // An asynchronous |IMFSourceReader| in low latency mode, which delivers
+  // camera frames to the preview without the queuing of the capture engine.
+  // Recordings are encoded with an |IMFSinkWriter| and have no audio.
+  kSourceReader,
+};
+
+// Maximum number of image stream frames sent to Dart but not yet acknowledged.
+// Frames are dropped while this many are in flight.
+constexpr int kMaxImageStreamPendingFrames = 4;
+
+// Returns the camera result of an HRESULT.
+CameraResult GetCameraResult(HRESULT hr);
+
+// Converts a preview frame into an image stream frame of |format|.
+//
+// Returns false if the frame does not fit in |data_length| bytes.
+//
+// data:          First byte of the top row of the frame.
+// data_length:   Number of bytes readable from |data|.
+// stride:        Distance in bytes between the starts of two rows, negative
+//                for bottom-up frames, or 0 if the rows are tightly packed.
+// source_format: Pixel format of the preview frame.
+bool BuildImageStreamFrame(const uint8_t* data, uint32_t data_length,
+                           int32_t stride, uint32_t width, uint32_t height,
+                           PreviewPixelFormat source_format,
+                           ImageStreamFormat format, ImageStreamFrame* frame);
+
+// Settings used to initialize a capture device.
+struct CaptureSettings {
+  // A boolean value telling if audio should be captured on video recording.
+  bool record_audio = false;
+
+  // Endpoint ID of the audio capture device, or empty for the default audio
+  // capture device of the system.
+  std::string audio_device_id;
+
+  // Maximum capture resolution height.
+  ResolutionPreset resolution_preset = ResolutionPreset::kAuto;
+
+  // Texture type used for the camera preview.
+  PreviewTextureMode preview_texture_mode = PreviewTextureMode::kPixelBuffer;
+
+  // If true, the preview is captured at the size Flutter renders the preview
+  // texture at, limited by |resolution_preset|.
+  bool adaptive_preview = false;
+
+  // Preferred capture frame rate, or 0 for the highest available frame rate.
+  uint32_t target_frame_rate = 0;
+
+  // Maximum rate at which frames are converted into the preview texture, or
+  // 0 to update it at the capture frame rate. Recordings are still captured
+  // at the capture frame rate.
+  uint32_t preview_max_frame_rate = 0;
+
+  // Pixel format of the preview samples. NV12 samples are converted to RGBA
+  // while updating the preview texture instead of by the capture engine.
+  PreviewPixelFormat preview_pixel_format = PreviewPixelFormat::kRGB32;
+
+  // If true, recent preview frames are kept so that photos are encoded from
+  // the frame captured closest to the shutter instead of with the photo
+  // sink. Photos then have the preview resolution, so |adaptive_preview| is
+  // ignored.
+  bool zero_shutter_lag = false;
+
+  // If true, the timing of each preview frame is recorded and can be read
+  // with |CaptureController::GetPreviewStats|.
+  bool preview_stats = false;
+
+  // Pipeline the capture controller is built on. Only used by
+  // |CaptureControllerFactoryImpl|.
+  CaptureBackend capture_backend = CaptureBackend::kCaptureEngine;
+};
+
+// A capture format supported by the video capture device.
+struct CaptureFormat {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  float frame_rate = 0.f;
+};
+
+// Returns the maximum capture height of a resolution preset.
+uint32_t GetResolutionPresetMaxHeight(ResolutionPreset resolution_preset);
+
+// Returns the capture formats of |media_types|, without the media types that
+// only differ by subtype.
+std::vector<CaptureFormat> GetDistinctCaptureFormats(
+    const MediaTypeCache::MediaTypeList& media_types);
+
 // Camera capture engine state.
 //
 // On creation, |CaptureControllers| start in state |kNotInitialized|.
@@ -60,6 +172,13 @@ class VideoCaptureDeviceEnumerator {
                                                   UINT32* count) = 0;
 };
 
+// Interface for a class that enumerates audio capture device sources.
+class AudioCaptureDeviceEnumerator {
+ private:
+  virtual bool EnumerateAudioCaptureDeviceSources(IMFActivate*** devices,
+                                                  UINT32* count) = 0;
+};
+
 // Interface implemented by capture controllers.
 //
 // Capture controllers are used to capture video streams or still photos from
@@ -82,13 +201,13 @@ class CaptureController {
   //                    register texture for capture preview.
   // device_id:         A string that holds information of camera device id to
   //                    be captured.
-  // record_audio:      A boolean value telling if audio should be captured on
-  //                    video recording.
-  // resolution_preset: Maximum capture resolution height.
-  virtual bool InitCaptureDevice(TextureRegistrar* texture_registrar,
-                                 const std::string& device_id,
-                                 bool record_audio,
-                                 ResolutionPreset resolution_preset) = 0;
+  // settings:          Settings for audio capture, resolution and preview.
+  // capture_context:   Media Foundation and Direct3D state shared with the
+  //                    other capture controllers of the plugin.
+  virtual bool InitCaptureDevice(
+      TextureRegistrar* texture_registrar, const std::string& device_id,
+      const CaptureSettings& settings,
+      std::shared_ptr<CaptureContext> capture_context) = 0;
 
   // Returns preview frame width
   virtual uint32_t GetPreviewWidth() const = 0;
@@ -96,6 +215,60 @@ class CaptureController {
   // Returns preview frame height
   virtual uint32_t GetPreviewHeight() const = 0;
 
+  // Returns the capture formats supported by the device.
+  //
+  // The formats are available once the preview has been started, and are
+  // enumerated only once per device in the process.
+  virtual std::vector<CaptureFormat> GetCaptureFormats() const = 0;
+
+  // Returns the preview pipeline statistics, or std::nullopt if the capture
+  // device was not initialized with |CaptureSettings::preview_stats|.
+  virtual std::optional<PreviewStatsSnapshot> GetPreviewStats() const = 0;
+
+  // Returns the statistics of the current or last video recording, or
+  // std::nullopt if no video has been recorded.
+  virtual std::optional<RecordSampleStats> GetRecordingStats() const = 0;
+
+  // Sets the digital zoom of the preview, which narrows the preview crop
+  // around its center.
+  //
+  // Returns false if |zoom_level| is outside of |kMinPreviewZoomLevel| and
+  // |kMaxPreviewZoomLevel|.
+  virtual bool SetZoomLevel(double zoom_level) = 0;
+
+  // Sets the region of the preview frames shown in the preview texture. Only
+  // the region is converted for the texture. Recordings, photos and image
+  // stream frames are not cropped.
+  //
+  // Returns false if |crop_rect| is not within the frame.
+  virtual bool SetPreviewCropRect(const PreviewCropRect& crop_rect) = 0;
+
+  // Sets the clockwise rotation of the preview texture, applied after the
+  // preview is mirrored. Frames are rotated as they are converted or
+  // rendered into the texture. Recordings, photos and image stream frames are
+  // not rotated.
+  //
+  // Returns false if the preview is rendered to a GPU surface whose video
+  // processor cannot rotate frames.
+  virtual bool SetPreviewRotation(PreviewRotation rotation) = 0;
+
+  // Sets the maximum rate at which frames are converted into the preview
+  // texture. The rate is not limited if |frames_per_second| is std::nullopt,
+  // and the texture is not updated if it is 0 or less. The capture engine
+  // keeps running, so recordings, photos and image stream frames are not
+  // affected.
+  virtual void SetPreviewTargetFrameRate(
+      std::optional<double> frames_per_second) = 0;
+
+  // Stops updating the preview texture while |hidden| is true, such as while
+  // the window showing the preview is minimized.
+  virtual void SetPreviewWindowHidden(bool hidden) = 0;
+
+  // Returns the exposure, focus and white balance controls of the camera, or
+  // nullptr if the capture device is not initialized. The controls are owned
+  // by the capture controller and valid until it is reset.
+  virtual CameraControls* GetCameraControls() = 0;
+
   // Starts the preview.
   virtual void StartPreview() = 0;
 
@@ -106,14 +279,55 @@ class CaptureController {
   virtual void ResumePreview() = 0;
 
   // Starts recording video.
+  //
+  // file_path:             Path of the recorded video file.
+  // max_video_duration_ms: Maximum duration of the recording, or -1 for a
+  //                        recording that continues until it is stopped.
+  // settings:              Encoder settings of the recording.
   virtual void StartRecord(const std::string& file_path,
-                           int64_t max_video_duration_ms) = 0;
+                           int64_t max_video_duration_ms,
+                           const VideoRecordSettings& settings) = 0;
 
   // Stops the current video recording.
   virtual void StopRecord() = 0;
 
+  // Pauses the current video recording. The encoder keeps running, so the
+  // recording can be resumed into the same file.
+  virtual void PauseRecord() = 0;
+
+  // Resumes the paused video recording.
+  virtual void ResumeRecord() = 0;
+
+  // Sets the clockwise rotation of the photos taken after this call.
+  //
+  // Photos written by the photo sink get the rotation as their EXIF
+  // orientation, while photos encoded by the plugin are rotated as they are
+  // encoded.
+  virtual void SetPictureRotation(PhotoRotation rotation) = 0;
+
   // Captures a still photo.
   virtual void TakePicture(const std::string& file_path) = 0;
+
+  // Captures a still photo and returns it encoded in memory, without writing
+  // it to a file.
+  virtual void TakePictureData(const PhotoSettings& settings) = 0;
+
+  // Captures a burst of still photos, one per path of |file_paths|, each
+  // requested as soon as the previous one is taken.
+  virtual void TakePictureBurst(const std::vector<std::string>& file_paths) = 0;
+
+  // Starts delivering preview frames in the given format to
+  // |CaptureControllerListener::OnImageStreamFrameAvailable|.
+  //
+  // Returns false if the capture engine is not initialized.
+  virtual bool StartImageStream(ImageStreamFormat format) = 0;
+
+  // Stops delivering image stream frames.
+  virtual void StopImageStream() = 0;
+
+  // Acknowledges that an image stream frame was received by Dart, allowing
+  // another frame to be delivered.
+  virtual void OnImageStreamFrameReceived() = 0;
 };
 
 // Concrete implementation of the |CaptureController| interface.
@@ -121,13 +335,24 @@ class CaptureController {
 // Handles the video preview stream via a |PreviewHandler| instance, video
 // capture via a |RecordHandler| instance, and still photo capture via a
 // |PhotoHandler| instance.
+//
+// Capture engine events are handled in order on a |CaptureWorkQueue|, if one
+// is given, instead of on the Media Foundation thread that raised them.
+// Listener callbacks for events are then made on the thread of the queue.
 class CaptureControllerImpl : public CaptureController,
                               public CaptureEngineObserver {
  public:
   static bool EnumerateVideoCaptureDeviceSources(IMFActivate*** devices,
                                                  UINT32* count);
+  static bool EnumerateAudioCaptureDeviceSources(IMFActivate*** devices,
+                                                 UINT32* count);
 
-  explicit CaptureControllerImpl(CaptureControllerListener* listener);
+  // listener:   Listener informed of the results of the capture controller.
+  // work_queue: Queue that capture engine events are handled on, or nullptr
+  //             to handle events on the thread that raised them.
+  explicit CaptureControllerImpl(
+      CaptureControllerListener* listener,
+      std::unique_ptr<CaptureWorkQueue> work_queue = nullptr);
   virtual ~CaptureControllerImpl();
 
   // Disallow copy and move.
@@ -135,26 +360,55 @@ class CaptureControllerImpl : public CaptureController,
   CaptureControllerImpl& operator=(const CaptureControllerImpl&) = delete;
 
   // CaptureController
-  bool InitCaptureDevice(TextureRegistrar* texture_registrar,
-                         const std::string& device_id, bool record_audio,
-                         ResolutionPreset resolution_preset) override;
+  bool InitCaptureDevice(
+      TextureRegistrar* texture_registrar, const std::string& device_id,
+      const CaptureSettings& settings,
+      std::shared_ptr<CaptureContext> capture_context) override;
   uint32_t GetPreviewWidth() const override { return preview_frame_width_; }
   uint32_t GetPreviewHeight() const override { return preview_frame_height_; }
+  std::vector<CaptureFormat> GetCaptureFormats() const override {
+    return capture_formats_;
+  }
+  std::optional<PreviewStatsSnapshot> GetPreviewStats() const override;
+  std::optional<RecordSampleStats> GetRecordingStats() const override;
+  bool SetZoomLevel(double zoom_level) override;
+  bool SetPreviewCropRect(const PreviewCropRect& crop_rect) override;
+  bool SetPreviewRotation(PreviewRotation rotation) override;
+  void SetPreviewTargetFrameRate(
+      std::optional<double> frames_per_second) override;
+  void SetPreviewWindowHidden(bool hidden) override;
+  CameraControls* GetCameraControls() override;
   void StartPreview() override;
   void PausePreview() override;
   void ResumePreview() override;
-  void StartRecord(const std::string& file_path,
-                   int64_t max_video_duration_ms) override;
+  void StartRecord(const std::string& file_path, int64_t max_video_duration_ms,
+                   const VideoRecordSettings& settings) override;
   void StopRecord() override;
+  void PauseRecord() override;
+  void ResumeRecord() override;
+  void SetPictureRotation(PhotoRotation rotation) override;
   void TakePicture(const std::string& file_path) override;
+  void TakePictureData(const PhotoSettings& settings) override;
+  void TakePictureBurst(const std::vector<std::string>& file_paths) override;
+  bool StartImageStream(ImageStreamFormat format) override;
+  void StopImageStream() override;
+  void OnImageStreamFrameReceived() override;
 
   // CaptureEngineObserver
   void OnEvent(IMFMediaEvent* event) override;
+  void OnSynchronizedEvent(IMFMediaEvent* event) override;
   bool IsReadyForSample() const override {
+    // Frames skipped by |preview_frame_throttle_| are still delivered while
+    // they are used by the image stream or the zero shutter lag buffer.
     return capture_engine_state_ == CaptureEngineState::kInitialized &&
-           preview_handler_ && preview_handler_->IsRunning();
+           preview_handler_ && preview_handler_->IsRunning() &&
+           (preview_frame_due_.load(std::memory_order_relaxed) ||
+            image_streaming_.load(std::memory_order_relaxed) ||
+            zero_shutter_lag_buffer_);
   }
-  bool UpdateBuffer(uint8_t* data, uint32_t data_length) override;
+  bool UpdateBuffer(const uint8_t* data, uint32_t data_length,
+                    int32_t stride) override;
+  bool UpdateTexture(ID3D11Texture2D* texture, UINT subresource_index) override;
   void UpdateCaptureTime(uint64_t capture_time) override;
 
   // Sets capture engine, for testing purposes.
@@ -185,16 +439,14 @@ class CaptureControllerImpl : public CaptureController,
   // Returns max preview height calculated from resolution present.
   uint32_t GetMaxPreviewHeight() const;
 
-  // Uses first audio source to capture audio.
-  // Note: Enumerating audio sources via platform interface is not supported.
-  HRESULT CreateDefaultAudioCaptureSource();
+  // Initializes audio capture source from the audio device of the capture
+  // settings. Uses the default audio capture device of the system if no
+  // device was set, or the first audio device if there is no default device.
+  HRESULT CreateAudioCaptureSource();
 
   // Initializes video capture source from camera device.
   HRESULT CreateVideoCaptureSourceForDevice(const std::string& video_device_id);
 
-  // Creates DX11 Device and D3D Manager.
-  HRESULT CreateD3DManagerWithDX11Device();
-
   // Initializes capture engine object.
   HRESULT CreateCaptureEngine();
 
@@ -209,6 +461,20 @@ class CaptureControllerImpl : public CaptureController,
   // Stops preview. Called internally on camera reset and dispose.
   HRESULT StopPreview();
 
+  // Converts a preview frame and delivers it to the image stream, unless too
+  // many frames are already waiting for Dart.
+  void DeliverImageStreamFrame(const uint8_t* data, uint32_t data_length,
+                               int32_t stride);
+
+  // Requests a new preview sink output size if the preview texture is
+  // rendered at a different size than it is captured at. Only used if
+  // adaptive preview is enabled.
+  void UpdateAdaptivePreviewSize();
+
+  // Handles a capture engine event on the work queue, or on the thread that
+  // raised it if there is no work queue.
+  void HandleEvent(IMFMediaEvent* event);
+
   // Handles capture engine initalization event.
   void OnCaptureEngineInitialized(CameraResult result,
                                   const std::string& error);
@@ -219,6 +485,13 @@ class CaptureControllerImpl : public CaptureController,
   // Handles picture events.
   void OnPicture(CameraResult result, const std::string& error);
 
+  // Handles picture events of photos taken in memory.
+  void OnPictureData(CameraResult result, const std::string& error);
+
+  // Handles picture events of a burst, requesting the next photo or
+  // informing CaptureControllerListener once the burst is complete.
+  void OnPictureBurst(CameraResult result, const std::string& error);
+
   // Handles preview started events.
   void OnPreviewStarted(CameraResult result, const std::string& error);
 
@@ -231,27 +504,52 @@ class CaptureControllerImpl : public CaptureController,
   // Handles record stopped events.
   void OnRecordStopped(CameraResult result, const std::string& error);
 
-  bool media_foundation_started_ = false;
   bool record_audio_ = false;
+  bool adaptive_preview_ = false;
+  bool adaptive_preview_size_pending_ = false;
   uint32_t preview_frame_width_ = 0;
   uint32_t preview_frame_height_ = 0;
-  UINT dx_device_reset_token_ = 0;
+  uint32_t adaptive_preview_width_ = 0;
+  uint32_t adaptive_preview_height_ = 0;
+  uint32_t pending_adaptive_preview_width_ = 0;
+  uint32_t pending_adaptive_preview_height_ = 0;
+  PreviewCropRect preview_crop_rect_;
+  PreviewRotation preview_rotation_ = PreviewRotation::kNone;
+  double zoom_level_ = kMinPreviewZoomLevel;
+  PhotoRotation picture_rotation_ = PhotoRotation::kNone;
+  ImageStreamFormat image_stream_format_ = ImageStreamFormat::kBGRA8888;
+  std::atomic<bool> image_streaming_{false};
+  std::atomic<int> image_stream_pending_frames_{0};
+  std::atomic<uint64_t> last_capture_time_us_{0};
+  PreviewFrameThrottle preview_frame_throttle_;
+  // Whether the last sample should be converted into the preview texture.
+  std::atomic<bool> preview_frame_due_{true};
+  std::unique_ptr<ZeroShutterLagBuffer> zero_shutter_lag_buffer_;
   std::unique_ptr<RecordHandler> record_handler_;
   std::unique_ptr<PreviewHandler> preview_handler_;
   std::unique_ptr<PhotoHandler> photo_handler_;
+  // Shared with |texture_handler_|, which may outlive the controller until
+  // its texture is unregistered.
+  std::shared_ptr<PreviewStats> preview_stats_;
   std::unique_ptr<TextureHandler> texture_handler_;
+  std::unique_ptr<CameraControls> camera_controls_;
   CaptureControllerListener* capture_controller_listener_;
+  std::unique_ptr<CaptureWorkQueue> work_queue_;
 
   std::string video_device_id_;
+  std::string audio_device_id_;
   CaptureEngineState capture_engine_state_ =
       CaptureEngineState::kNotInitialized;
   ResolutionPreset resolution_preset_ = ResolutionPreset::kMedium;
+  float target_frame_rate_ = 0.f;
+  PreviewTextureMode preview_texture_mode_ = PreviewTextureMode::kPixelBuffer;
+  PreviewPixelFormat preview_pixel_format_ = PreviewPixelFormat::kRGB32;
+  std::shared_ptr<CaptureContext> capture_context_;
   ComPtr<IMFCaptureEngine> capture_engine_;
   ComPtr<CaptureEngineListener> capture_engine_callback_handler_;
-  ComPtr<IMFDXGIDeviceManager> dxgi_device_manager_;
-  ComPtr<ID3D11Device> dx11_device_;
   ComPtr<IMFMediaType> base_capture_media_type_;
   ComPtr<IMFMediaType> base_preview_media_type_;
+  std::vector<CaptureFormat> capture_formats_;
   ComPtr<IMFMediaSource> video_source_;
   ComPtr<IMFMediaSource> audio_source_;
 
@@ -275,9 +573,14 @@ class CaptureControllerFactory {
 };
 
 // Concreate implementation of |CaptureControllerFactory|.
+//
+// Creates a |CaptureControllerImpl|, or a |SourceReaderCaptureController| for
+// |CaptureBackend::kSourceReader|.
 class CaptureControllerFactoryImpl : public CaptureControllerFactory {
  public:
-  CaptureControllerFactoryImpl() {}
+  explicit CaptureControllerFactoryImpl(
+      CaptureBackend backend = CaptureBackend::kCaptureEngine)
+      : backend_(backend) {}
   virtual ~CaptureControllerFactoryImpl() = default;
 
   // Disallow copy and move.
@@ -286,9 +589,10 @@ class CaptureControllerFactoryImpl : public CaptureControllerFactory {
       delete;
 
   std::unique_ptr<CaptureController> CreateCaptureController(
-      CaptureControllerListener* listener) override {
-    return std::make_unique<CaptureControllerImpl>(listener);
-  }
+      CaptureControllerListener* listener) override;
+
+ private:
+  CaptureBackend backend_;
 };
 
 }  // namespace camera_windows
@@ -5,7 +5,10 @@
 #ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_CONTROLLER_LISTENER_H_
 #define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_CONTROLLER_LISTENER_H_
 
+#include <cstdint>
 #include <functional>
+#include <string>
+#include <vector>
 
 namespace camera_windows {
 
@@ -21,6 +24,31 @@ enum class CameraResult {
   kAccessDenied,
 };
 
+// Pixel formats of image stream frames.
+enum class ImageStreamFormat {
+  // A single plane of 32 bit BGRA pixels.
+  kBGRA8888,
+
+  // A luma plane followed by an interleaved chroma plane at half resolution.
+  kNV12,
+};
+
+// A plane of an image stream frame.
+struct ImageStreamPlane {
+  std::vector<uint8_t> bytes;
+  uint32_t bytes_per_row = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+};
+
+// A frame delivered by an image stream.
+struct ImageStreamFrame {
+  ImageStreamFormat format = ImageStreamFormat::kBGRA8888;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::vector<ImageStreamPlane> planes;
+};
+
 // Interface for classes that receives callbacks on events from the associated
 // |CaptureController|.
 class CaptureControllerListener {
@@ -94,6 +122,26 @@ class CaptureControllerListener {
   virtual void OnStopRecordFailed(CameraResult result,
                                   const std::string& error) = 0;
 
+  // Called by CaptureController on successfully paused recording.
+  virtual void OnPauseRecordSucceeded() = 0;
+
+  // Called by CaptureController if pausing the recording fails.
+  //
+  // result: The kind of result.
+  // error: A string describing the error.
+  virtual void OnPauseRecordFailed(CameraResult result,
+                                   const std::string& error) = 0;
+
+  // Called by CaptureController on successfully resumed recording.
+  virtual void OnResumeRecordSucceeded() = 0;
+
+  // Called by CaptureController if resuming the recording fails.
+  //
+  // result: The kind of result.
+  // error: A string describing the error.
+  virtual void OnResumeRecordFailed(CameraResult result,
+                                    const std::string& error) = 0;
+
   // Called by CaptureController on successfully captured picture.
   //
   // file_path: Filesystem path of the captured image.
@@ -106,6 +154,31 @@ class CaptureControllerListener {
   virtual void OnTakePictureFailed(CameraResult result,
                                    const std::string& error) = 0;
 
+  // Called by CaptureController on successfully captured picture data.
+  //
+  // data: The encoded image. Its bytes may be moved by the listener.
+  virtual void OnTakePictureDataSucceeded(std::vector<uint8_t>& data) = 0;
+
+  // Called by CaptureController if taking picture data fails.
+  //
+  // result: The kind of result.
+  // error: A string describing the error.
+  virtual void OnTakePictureDataFailed(CameraResult result,
+                                       const std::string& error) = 0;
+
+  // Called by CaptureController on successfully captured picture burst.
+  //
+  // file_paths: Filesystem paths of the captured images, in capture order.
+  virtual void OnTakePictureBurstSucceeded(
+      const std::vector<std::string>& file_paths) = 0;
+
+  // Called by CaptureController if taking a picture burst fails.
+  //
+  // result: The kind of result.
+  // error: A string describing the error.
+  virtual void OnTakePictureBurstFailed(CameraResult result,
+                                        const std::string& error) = 0;
+
   // Called by CaptureController when timed recording is successfully recorded.
   //
   // file_path: Filesystem path of the captured image.
@@ -127,6 +200,24 @@ class CaptureControllerListener {
   // error: A string describing the error.
   virtual void OnCaptureError(CameraResult result,
                               const std::string& error) = 0;
+
+  // Called by CaptureController on the sample thread when a frame is
+  // available for the image stream.
+  //
+  // frame: The captured frame. Its data may be moved by the listener.
+  //
+  // Returns true if the frame was delivered. Delivered frames count towards
+  // the in-flight limit until they are acknowledged with
+  // |CaptureController::OnImageStreamFrameReceived|.
+  virtual bool OnImageStreamFrameAvailable(ImageStreamFrame& frame) = 0;
+
+  // Called by CaptureController on a Media Foundation thread with each chunk
+  // written to a recording started with |VideoRecordSettings::stream_chunks|.
+  //
+  // offset: Byte offset of the chunk in the recorded file.
+  // data:   The written bytes. May be moved by the listener.
+  virtual void OnVideoRecordChunkAvailable(uint64_t offset,
+                                           std::vector<uint8_t>& data) = 0;
 };
 
 }  // namespace camera_windows
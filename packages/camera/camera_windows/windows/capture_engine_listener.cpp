@@ -5,9 +5,14 @@
 
 #include "capture_engine_listener.h"
 
+#include <mfapi.h>
 #include <mfcaptureengine.h>
 #include <wrl/client.h>
 
+#include <cstring>
+
+#include "tracing.h"
+
 namespace camera_windows {
 
 using Microsoft::WRL::ComPtr;
@@ -40,6 +45,10 @@ CaptureEngineListener::QueryInterface(const IID& riid, void** ppv) {
     *ppv = static_cast<IMFCaptureEngineOnSampleCallback*>(this);
     ((IUnknown*)*ppv)->AddRef();
     return S_OK;
+  } else if (riid == IID_IMFCaptureEngineOnSampleCallback2) {
+    *ppv = static_cast<IMFCaptureEngineOnSampleCallback2*>(this);
+    ((IUnknown*)*ppv)->AddRef();
+    return S_OK;
   }
 
   return E_NOINTERFACE;
@@ -54,6 +63,7 @@ STDMETHODIMP CaptureEngineListener::OnEvent(IMFMediaEvent* event) {
 
 // IMFCaptureEngineOnSampleCallback
 HRESULT CaptureEngineListener::OnSample(IMFSample* sample) {
+  CAMERA_TRACE_SCOPE("OnSample");
   HRESULT hr = S_OK;
 
   if (this->observer_ && sample) {
@@ -70,21 +80,108 @@ HRESULT CaptureEngineListener::OnSample(IMFSample* sample) {
       return hr;
     }
 
-    ComPtr<IMFMediaBuffer> buffer;
-    hr = sample->ConvertToContiguousBuffer(&buffer);
+    // Samples produced with a DXGI device manager are backed by D3D11
+    // textures and can be rendered without copying them to system memory.
+    ComPtr<IMFMediaBuffer> first_buffer;
+    ComPtr<IMFDXGIBuffer> dxgi_buffer;
+    if (SUCCEEDED(sample->GetBufferByIndex(0, &first_buffer)) &&
+        SUCCEEDED(first_buffer.As(&dxgi_buffer))) {
+      ComPtr<ID3D11Texture2D> texture;
+      UINT subresource_index = 0;
+      if (SUCCEEDED(dxgi_buffer->GetResource(IID_PPV_ARGS(&texture))) &&
+          SUCCEEDED(dxgi_buffer->GetSubresourceIndex(&subresource_index)) &&
+          this->observer_->UpdateTexture(texture.Get(), subresource_index)) {
+        return hr;
+      }
+    }
+
+    // Single buffer 2D samples are read in place with their real stride,
+    // which avoids the copy made by ConvertToContiguousBuffer.
+    DWORD buffer_count = 0;
+    ComPtr<IMF2DBuffer2> buffer_2d;
+    if (first_buffer && SUCCEEDED(sample->GetBufferCount(&buffer_count)) &&
+        buffer_count == 1 && SUCCEEDED(first_buffer.As(&buffer_2d))) {
+      BYTE* scanline0 = nullptr;
+      LONG pitch = 0;
+      BYTE* buffer_start = nullptr;
+      DWORD buffer_length = 0;
+      if (SUCCEEDED(buffer_2d->Lock2DSize(MF2DBuffer_LockFlags_Read,
+                                          &scanline0, &pitch, &buffer_start,
+                                          &buffer_length))) {
+        // Bytes available from the top row towards the end of the frame.
+        const ptrdiff_t available =
+            pitch >= 0 ? (buffer_start + buffer_length) - scanline0
+                       : (scanline0 - buffer_start) - pitch;
+        this->observer_->UpdateBuffer(scanline0,
+                                      static_cast<uint32_t>(available),
+                                      static_cast<int32_t>(pitch));
+        return buffer_2d->Unlock2D();
+      }
+    }
+
+    // Single buffer samples are read in place.
+    if (first_buffer && buffer_count == 1) {
+      DWORD max_length = 0;
+      DWORD current_length = 0;
+      uint8_t* data;
+      hr = first_buffer->Lock(&data, &max_length, &current_length);
+      if (SUCCEEDED(hr)) {
+        this->observer_->UpdateBuffer(data, current_length, 0);
+        hr = first_buffer->Unlock();
+      }
+      return hr;
+    }
+
+    // Samples split across several buffers are copied into a pooled frame
+    // buffer instead of the buffer allocated by ConvertToContiguousBuffer.
+    DWORD total_length = 0;
+    hr = sample->GetTotalLength(&total_length);
+    if (FAILED(hr) || total_length == 0) {
+      return hr;
+    }
+
+    FrameBuffer frame = frame_buffer_pool_.Acquire(total_length);
+    if (!frame.data()) {
+      return E_OUTOFMEMORY;
+    }
+
+    DWORD copied_length = 0;
+    for (DWORD i = 0; i < buffer_count && SUCCEEDED(hr); i++) {
+      ComPtr<IMFMediaBuffer> buffer;
+      hr = sample->GetBufferByIndex(i, &buffer);
+      if (FAILED(hr)) {
+        break;
+      }
 
-    // Draw the frame.
-    if (SUCCEEDED(hr) && buffer) {
       DWORD max_length = 0;
       DWORD current_length = 0;
       uint8_t* data;
-      if (SUCCEEDED(buffer->Lock(&data, &max_length, &current_length))) {
-        this->observer_->UpdateBuffer(data, current_length);
+      hr = buffer->Lock(&data, &max_length, &current_length);
+      if (FAILED(hr)) {
+        break;
       }
+      if (current_length > total_length - copied_length) {
+        current_length = total_length - copied_length;
+      }
+      memcpy(frame.data() + copied_length, data, current_length);
+      copied_length += current_length;
       hr = buffer->Unlock();
     }
+
+    // Draw the frame.
+    if (SUCCEEDED(hr)) {
+      this->observer_->UpdateBuffer(frame.data(), copied_length, 0);
+    }
   }
   return hr;
 }
 
+// IMFCaptureEngineOnSampleCallback2
+HRESULT CaptureEngineListener::OnSynchronizedEvent(IMFMediaEvent* event) {
+  if (observer_ && event) {
+    observer_->OnSynchronizedEvent(event);
+  }
+  return S_OK;
+}
+
 }  // namespace camera_windows
@@ -5,11 +5,14 @@
 #ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_ENGINE_LISTENER_H_
 #define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_ENGINE_LISTENER_H_
 
+#include <d3d11.h>
 #include <mfcaptureengine.h>
 
 #include <cassert>
 #include <functional>
 
+#include "frame_buffer_pool.h"
+
 namespace camera_windows {
 
 // A class that implements callbacks for events from a |CaptureEngineListener|.
@@ -23,8 +26,25 @@ class CaptureEngineObserver {
   // Handles Capture Engine media events.
   virtual void OnEvent(IMFMediaEvent* event) = 0;
 
-  // Updates texture buffer
-  virtual bool UpdateBuffer(uint8_t* data, uint32_t new_length) = 0;
+  // Handles preview sink events that are synchronized with the samples, such
+  // as output media type changes.
+  virtual void OnSynchronizedEvent(IMFMediaEvent* event) = 0;
+
+  // Updates texture buffer from a locked sample buffer.
+  //
+  // data:        First byte of the top row of the frame.
+  // data_length: Number of bytes readable from |data|.
+  // stride:      Distance in bytes between the starts of two rows, negative
+  //              for bottom-up frames, or 0 if the rows are tightly packed.
+  virtual bool UpdateBuffer(const uint8_t* data, uint32_t data_length,
+                            int32_t stride) = 0;
+
+  // Updates texture from a sample backed by a D3D11 texture.
+  //
+  // Returns false if the texture was not used, in which case the sample is
+  // delivered to |UpdateBuffer| instead.
+  virtual bool UpdateTexture(ID3D11Texture2D* texture,
+                             UINT subresource_index) = 0;
 
   // Handles capture timestamps updates.
   // Used to stop timed recordings when recorded time is exceeded.
@@ -35,7 +55,7 @@ class CaptureEngineObserver {
 //
 // Events are redirected to observers for processing. Samples are preprosessed
 // and sent to the associated observer if it is ready to process samples.
-class CaptureEngineListener : public IMFCaptureEngineOnSampleCallback,
+class CaptureEngineListener : public IMFCaptureEngineOnSampleCallback2,
                               public IMFCaptureEngineOnEventCallback {
  public:
   CaptureEngineListener(CaptureEngineObserver* observer) : observer_(observer) {
@@ -59,8 +79,20 @@ class CaptureEngineListener : public IMFCaptureEngineOnSampleCallback,
   // IMFCaptureEngineOnSampleCallback
   STDMETHODIMP_(HRESULT) OnSample(IMFSample* pSample);
 
+  // IMFCaptureEngineOnSampleCallback2
+  STDMETHODIMP_(HRESULT) OnSynchronizedEvent(IMFMediaEvent* pEvent);
+
+  // Returns the pool of the buffers that multiple buffer samples are copied
+  // into.
+  const FrameBufferPool& GetFrameBufferPool() const {
+    return frame_buffer_pool_;
+  }
+
  private:
   CaptureEngineObserver* observer_;
+  // Reused by all samples of the listener, which lives as long as its capture
+  // controller, so that preview restarts keep the pooled buffers.
+  FrameBufferPool frame_buffer_pool_;
   volatile ULONG ref_ = 0;
 };
 
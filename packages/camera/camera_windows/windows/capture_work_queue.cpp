@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "capture_work_queue.h"
+
+#include <objbase.h>
+
+#include <cassert>
+#include <utility>
+
+namespace camera_windows {
+
+CaptureWorkQueue::CaptureWorkQueue() : thread_([this]() { Run(); }) {}
+
+CaptureWorkQueue::~CaptureWorkQueue() {
+  assert(!IsCurrentThread());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    tasks_.clear();
+  }
+  condition_.notify_one();
+  thread_.join();
+}
+
+void CaptureWorkQueue::Post(std::function<void()> task) {
+  assert(task);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return;
+    }
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+bool CaptureWorkQueue::IsCurrentThread() const {
+  return std::this_thread::get_id() == thread_.get_id();
+}
+
+void CaptureWorkQueue::Run() {
+  // Capture engine and sink writer calls made by the tasks require COM.
+  HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+      if (stopped_) {
+        break;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+
+  if (SUCCEEDED(hr)) {
+    CoUninitialize();
+  }
+}
+
+}  // namespace camera_windows
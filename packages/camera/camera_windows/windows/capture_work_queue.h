@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_WORK_QUEUE_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_WORK_QUEUE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace camera_windows {
+
+// A serial queue of tasks run in order on a dedicated thread.
+//
+// The capture controller handles capture engine events on this queue instead
+// of on the Media Foundation threads that raise them, which also deliver the
+// preview and record samples.
+class CaptureWorkQueue {
+ public:
+  // Starts the thread of the queue. COM is initialized on the thread in the
+  // multithreaded apartment.
+  CaptureWorkQueue();
+
+  // Stops the thread after the running task. Tasks that have not started yet
+  // are discarded. Must not be called from a task of the queue.
+  ~CaptureWorkQueue();
+
+  // Disallow copy and move.
+  CaptureWorkQueue(const CaptureWorkQueue&) = delete;
+  CaptureWorkQueue& operator=(const CaptureWorkQueue&) = delete;
+
+  // Adds |task| to the end of the queue. Can be called from any thread.
+  void Post(std::function<void()> task);
+
+  // Returns true if called from a task of the queue.
+  bool IsCurrentThread() const;
+
+ private:
+  // Runs the tasks of the queue until it is stopped.
+  void Run();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::function<void()>> tasks_;
+  bool stopped_ = false;
+  std::thread thread_;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_CAPTURE_WORK_QUEUE_H_
@@ -0,0 +1,163 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "frame_buffer_pool.h"
+
+#include <windows.h>
+
+#include <cassert>
+#include <utility>
+
+namespace camera_windows {
+
+namespace {
+
+// Returns |size| rounded up to a multiple of |alignment|, a power of two.
+size_t AlignSize(size_t size, size_t alignment) {
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+// Returns the size of a memory page.
+size_t GetPageSize() {
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+  return system_info.dwPageSize;
+}
+
+}  // namespace
+
+FrameBuffer::FrameBuffer(FrameBuffer&& other) noexcept
+    : pool_(other.pool_), data_(other.data_), capacity_(other.capacity_) {
+  other.pool_ = nullptr;
+  other.data_ = nullptr;
+  other.capacity_ = 0;
+}
+
+FrameBuffer& FrameBuffer::operator=(FrameBuffer&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    pool_ = other.pool_;
+    data_ = other.data_;
+    capacity_ = other.capacity_;
+    other.pool_ = nullptr;
+    other.data_ = nullptr;
+    other.capacity_ = 0;
+  }
+  return *this;
+}
+
+void FrameBuffer::Reset() {
+  if (pool_ && data_) {
+    pool_->Release(data_, capacity_);
+  }
+  pool_ = nullptr;
+  data_ = nullptr;
+  capacity_ = 0;
+}
+
+FrameBufferPool::FrameBufferPool(size_t max_free_buffers)
+    : max_free_buffers_(max_free_buffers) {}
+
+FrameBufferPool::~FrameBufferPool() {
+  for (const FreeBuffer& buffer : free_buffers_) {
+    Free(buffer.data);
+  }
+}
+
+FrameBuffer FrameBufferPool::Acquire(size_t size) {
+  if (size == 0) {
+    return FrameBuffer();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Takes the smallest released buffer that fits.
+    size_t best = free_buffers_.size();
+    for (size_t i = 0; i < free_buffers_.size(); i++) {
+      if (free_buffers_[i].capacity >= size &&
+          (best == free_buffers_.size() ||
+           free_buffers_[i].capacity < free_buffers_[best].capacity)) {
+        best = i;
+      }
+    }
+    if (best < free_buffers_.size()) {
+      FreeBuffer buffer = free_buffers_[best];
+      free_buffers_.erase(free_buffers_.begin() + best);
+      return FrameBuffer(this, buffer.data, buffer.capacity);
+    }
+  }
+
+  size_t capacity = size;
+  uint8_t* data = Allocate(&capacity);
+  if (!data) {
+    return FrameBuffer();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  allocation_count_++;
+  return FrameBuffer(this, data, capacity);
+}
+
+uint64_t FrameBufferPool::GetAllocationCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return allocation_count_;
+}
+
+// static
+uint8_t* FrameBufferPool::Allocate(size_t* capacity) {
+  assert(capacity);
+
+  // Large pages are only used if the allocation fills them, as they are
+  // always committed and cannot be paged out.
+  const size_t large_page_size = GetLargePageMinimum();
+  if (large_page_size > 0 && *capacity >= large_page_size) {
+    const size_t large_capacity = AlignSize(*capacity, large_page_size);
+    void* data = VirtualAlloc(nullptr, large_capacity,
+                              MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+                              PAGE_READWRITE);
+    if (data) {
+      *capacity = large_capacity;
+      return static_cast<uint8_t*>(data);
+    }
+    // Fails without SeLockMemoryPrivilege. Falls back to regular pages.
+  }
+
+  const size_t page_capacity = AlignSize(*capacity, GetPageSize());
+  void* data = VirtualAlloc(nullptr, page_capacity, MEM_COMMIT | MEM_RESERVE,
+                            PAGE_READWRITE);
+  if (!data) {
+    return nullptr;
+  }
+  *capacity = page_capacity;
+  return static_cast<uint8_t*>(data);
+}
+
+// static
+void FrameBufferPool::Free(uint8_t* data) {
+  VirtualFree(data, 0, MEM_RELEASE);
+}
+
+void FrameBufferPool::Release(uint8_t* data, size_t capacity) {
+  uint8_t* freed = data;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_buffers_.size() < max_free_buffers_) {
+      free_buffers_.push_back({data, capacity});
+      return;
+    }
+
+    // Keeps the larger buffers, which can be reused for any frame size seen
+    // so far.
+    for (FreeBuffer& buffer : free_buffers_) {
+      if (buffer.capacity < capacity) {
+        std::swap(buffer.data, freed);
+        buffer.capacity = capacity;
+        break;
+      }
+    }
+  }
+  Free(freed);
+}
+
+}  // namespace camera_windows
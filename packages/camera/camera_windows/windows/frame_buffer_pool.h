@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_FRAME_BUFFER_POOL_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_FRAME_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace camera_windows {
+
+class FrameBufferPool;
+
+// A page-aligned block of memory taken from a |FrameBufferPool|, returned to
+// the pool when destroyed.
+class FrameBuffer {
+ public:
+  FrameBuffer() = default;
+  ~FrameBuffer() { Reset(); }
+
+  // Disallow copy, allow move.
+  FrameBuffer(const FrameBuffer&) = delete;
+  FrameBuffer& operator=(const FrameBuffer&) = delete;
+  FrameBuffer(FrameBuffer&& other) noexcept;
+  FrameBuffer& operator=(FrameBuffer&& other) noexcept;
+
+  // Returns the first byte of the buffer, or nullptr if the buffer is empty.
+  uint8_t* data() const { return data_; }
+
+  // Returns the number of bytes that can be written to the buffer.
+  size_t capacity() const { return capacity_; }
+
+  // Returns the buffer to its pool.
+  void Reset();
+
+ private:
+  friend class FrameBufferPool;
+
+  FrameBuffer(FrameBufferPool* pool, uint8_t* data, size_t capacity)
+      : pool_(pool), data_(data), capacity_(capacity) {}
+
+  FrameBufferPool* pool_ = nullptr;
+  uint8_t* data_ = nullptr;
+  size_t capacity_ = 0;
+};
+
+// Keeps released frame buffers for reuse, so that copying samples at the
+// capture frame rate does not allocate once the pool holds a buffer of the
+// frame size.
+//
+// Buffers are allocated with VirtualAlloc, page-aligned and rounded up to
+// whole pages. Buffers of at least the large page size use large pages when
+// the process holds the privilege to lock pages in memory.
+//
+// Buffers can be acquired and released from any thread. The pool must
+// outlive its buffers.
+class FrameBufferPool {
+ public:
+  // max_free_buffers: Number of released buffers kept for reuse. Buffers
+  //                   released to a full pool are freed.
+  explicit FrameBufferPool(size_t max_free_buffers = 2);
+  virtual ~FrameBufferPool();
+
+  // Disallow copy and move.
+  FrameBufferPool(const FrameBufferPool&) = delete;
+  FrameBufferPool& operator=(const FrameBufferPool&) = delete;
+
+  // Returns a buffer of at least |size| bytes, reusing a released buffer if
+  // one is large enough. Returns an empty buffer if the allocation fails.
+  FrameBuffer Acquire(size_t size);
+
+  // Returns the number of buffers allocated by the pool so far.
+  uint64_t GetAllocationCount() const;
+
+ private:
+  friend class FrameBuffer;
+
+  // Allocates at least |*capacity| bytes, updating it to the allocated size.
+  static uint8_t* Allocate(size_t* capacity);
+
+  // Frees a buffer returned by |Allocate|.
+  static void Free(uint8_t* data);
+
+  // A released buffer kept for reuse.
+  struct FreeBuffer {
+    uint8_t* data;
+    size_t capacity;
+  };
+
+  // Keeps the buffer of a destroyed |FrameBuffer| for reuse, or frees it.
+  void Release(uint8_t* data, size_t capacity);
+
+  size_t max_free_buffers_;
+  mutable std::mutex mutex_;
+  std::vector<FreeBuffer> free_buffers_;
+  uint64_t allocation_count_ = 0;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_FRAME_BUFFER_POOL_H_
@@ -0,0 +1,334 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "gpu_surface_renderer.h"
+
+#include <dxgi.h>
+
+#include <cassert>
+#include <cstddef>
+
+namespace camera_windows {
+
+using Microsoft::WRL::ComPtr;
+
+namespace {
+
+// Returns the video processor rotation of |rotation|.
+D3D11_VIDEO_PROCESSOR_ROTATION GetVideoProcessorRotation(
+    PreviewRotation rotation) {
+  switch (rotation) {
+    case PreviewRotation::kRotate90:
+      return D3D11_VIDEO_PROCESSOR_ROTATION_90;
+    case PreviewRotation::kRotate180:
+      return D3D11_VIDEO_PROCESSOR_ROTATION_180;
+    case PreviewRotation::kRotate270:
+      return D3D11_VIDEO_PROCESSOR_ROTATION_270;
+    case PreviewRotation::kNone:
+    default:
+      return D3D11_VIDEO_PROCESSOR_ROTATION_IDENTITY;
+  }
+}
+
+}  // namespace
+
+HRESULT GpuSurfaceRenderer::Initialize() {
+  if (!device_) {
+    return E_POINTER;
+  }
+
+  HRESULT hr = device_.As(&video_device_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  device_->GetImmediateContext(&context_);
+  if (!context_) {
+    return E_FAIL;
+  }
+
+  hr = context_.As(&video_context_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Mirroring is only supported via ID3D11VideoContext1. If it is not
+  // available, frames can still be rendered without mirroring.
+  if (FAILED(context_.As(&video_context1_))) {
+    video_context1_ = nullptr;
+  }
+
+  // Rotation is a capability of the video processor of the device, which is
+  // the same for all frame sizes.
+  D3D11_VIDEO_PROCESSOR_CONTENT_DESC content_desc = {};
+  content_desc.InputFrameFormat = D3D11_VIDEO_FRAME_FORMAT_PROGRESSIVE;
+  content_desc.InputWidth = 640;
+  content_desc.InputHeight = 480;
+  content_desc.OutputWidth = 640;
+  content_desc.OutputHeight = 480;
+  content_desc.Usage = D3D11_VIDEO_USAGE_PLAYBACK_NORMAL;
+
+  ComPtr<ID3D11VideoProcessorEnumerator> enumerator;
+  D3D11_VIDEO_PROCESSOR_CAPS caps = {};
+  supports_rotation_ =
+      SUCCEEDED(video_device_->CreateVideoProcessorEnumerator(&content_desc,
+                                                              &enumerator)) &&
+      SUCCEEDED(enumerator->GetVideoProcessorCaps(&caps)) &&
+      (caps.FeatureCaps & D3D11_VIDEO_PROCESSOR_FEATURE_CAPS_ROTATION) != 0;
+
+  return S_OK;
+}
+
+HRESULT GpuSurfaceRenderer::EnsureResources(uint32_t input_width,
+                                            uint32_t input_height,
+                                            uint32_t width, uint32_t height) {
+  assert(video_device_);
+  assert(video_context_);
+
+  if (video_processor_ && shared_texture_ && input_width_ == input_width &&
+      input_height_ == input_height && width_ == width && height_ == height) {
+    return S_OK;
+  }
+
+  // Release resources of the previous frame size.
+  output_view_ = nullptr;
+  shared_texture_ = nullptr;
+  upload_texture_ = nullptr;
+  video_processor_ = nullptr;
+  video_processor_enumerator_ = nullptr;
+  shared_handle_ = nullptr;
+  input_width_ = 0;
+  input_height_ = 0;
+  width_ = 0;
+  height_ = 0;
+
+  D3D11_VIDEO_PROCESSOR_CONTENT_DESC content_desc = {};
+  content_desc.InputFrameFormat = D3D11_VIDEO_FRAME_FORMAT_PROGRESSIVE;
+  content_desc.InputWidth = input_width;
+  content_desc.InputHeight = input_height;
+  content_desc.OutputWidth = width;
+  content_desc.OutputHeight = height;
+  content_desc.Usage = D3D11_VIDEO_USAGE_PLAYBACK_NORMAL;
+
+  HRESULT hr = video_device_->CreateVideoProcessorEnumerator(
+      &content_desc, &video_processor_enumerator_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = video_device_->CreateVideoProcessor(video_processor_enumerator_.Get(),
+                                           0, &video_processor_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Fills the unused alpha channel of RGB32 frames with opaque alpha.
+  video_context_->VideoProcessorSetOutputAlphaFillMode(
+      video_processor_.Get(), D3D11_VIDEO_PROCESSOR_ALPHA_FILL_MODE_OPAQUE, 0);
+  video_context_->VideoProcessorSetStreamFrameFormat(
+      video_processor_.Get(), 0, D3D11_VIDEO_FRAME_FORMAT_PROGRESSIVE);
+  video_context_->VideoProcessorSetStreamAutoProcessingMode(
+      video_processor_.Get(), 0, FALSE);
+
+  D3D11_TEXTURE2D_DESC texture_desc = {};
+  texture_desc.Width = width;
+  texture_desc.Height = height;
+  texture_desc.MipLevels = 1;
+  texture_desc.ArraySize = 1;
+  texture_desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+  texture_desc.SampleDesc.Count = 1;
+  texture_desc.Usage = D3D11_USAGE_DEFAULT;
+  texture_desc.BindFlags =
+      D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+  texture_desc.MiscFlags = D3D11_RESOURCE_MISC_SHARED;
+
+  hr = device_->CreateTexture2D(&texture_desc, nullptr, &shared_texture_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  D3D11_VIDEO_PROCESSOR_OUTPUT_VIEW_DESC output_view_desc = {};
+  output_view_desc.ViewDimension = D3D11_VPOV_DIMENSION_TEXTURE2D;
+  output_view_desc.Texture2D.MipSlice = 0;
+
+  hr = video_device_->CreateVideoProcessorOutputView(
+      shared_texture_.Get(), video_processor_enumerator_.Get(),
+      &output_view_desc, &output_view_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IDXGIResource> dxgi_resource;
+  hr = shared_texture_.As(&dxgi_resource);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = dxgi_resource->GetSharedHandle(&shared_handle_);
+  if (FAILED(hr)) {
+    shared_handle_ = nullptr;
+    return hr;
+  }
+
+  input_width_ = input_width;
+  input_height_ = input_height;
+  width_ = width;
+  height_ = height;
+  return S_OK;
+}
+
+HRESULT GpuSurfaceRenderer::EnsureResources(uint32_t input_width,
+                                            uint32_t input_height,
+                                            const PixelRect& source_rect,
+                                            PreviewRotation rotation) {
+  // Quarter turns swap the size of the shared surface.
+  return IsQuarterTurn(rotation)
+             ? EnsureResources(input_width, input_height, source_rect.height,
+                               source_rect.width)
+             : EnsureResources(input_width, input_height, source_rect.width,
+                               source_rect.height);
+}
+
+HRESULT GpuSurfaceRenderer::Blit(ID3D11Texture2D* texture, UINT array_slice,
+                                 const PixelRect& source_rect, bool mirror,
+                                 PreviewRotation rotation) {
+  assert(texture);
+
+  if ((mirror && !SupportsMirroring()) ||
+      (rotation != PreviewRotation::kNone && !SupportsRotation())) {
+    return E_NOTIMPL;
+  }
+
+  D3D11_VIDEO_PROCESSOR_INPUT_VIEW_DESC input_view_desc = {};
+  input_view_desc.FourCC = 0;
+  input_view_desc.ViewDimension = D3D11_VPIV_DIMENSION_TEXTURE2D;
+  input_view_desc.Texture2D.MipSlice = 0;
+  input_view_desc.Texture2D.ArraySlice = array_slice;
+
+  ComPtr<ID3D11VideoProcessorInputView> input_view;
+  HRESULT hr = video_device_->CreateVideoProcessorInputView(
+      texture, video_processor_enumerator_.Get(), &input_view_desc,
+      &input_view);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  if (video_context1_) {
+    video_context1_->VideoProcessorSetStreamMirror(
+        video_processor_.Get(), 0, TRUE, mirror ? TRUE : FALSE, FALSE);
+  }
+  if (supports_rotation_) {
+    // The stream is mirrored before it is rotated.
+    video_context_->VideoProcessorSetStreamRotation(
+        video_processor_.Get(), 0, rotation != PreviewRotation::kNone,
+        GetVideoProcessorRotation(rotation));
+  }
+
+  // The source region is scaled to the whole shared surface, which has the
+  // size of the rotated region.
+  RECT source = {static_cast<LONG>(source_rect.x),
+                 static_cast<LONG>(source_rect.y),
+                 static_cast<LONG>(source_rect.x + source_rect.width),
+                 static_cast<LONG>(source_rect.y + source_rect.height)};
+  video_context_->VideoProcessorSetStreamSourceRect(video_processor_.Get(), 0,
+                                                    TRUE, &source);
+
+  D3D11_VIDEO_PROCESSOR_STREAM stream = {};
+  stream.Enable = TRUE;
+  stream.pInputSurface = input_view.Get();
+
+  hr = video_context_->VideoProcessorBlt(video_processor_.Get(),
+                                         output_view_.Get(), 0, 1, &stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Submits the blit so that the shared surface is updated before Flutter
+  // samples it from its own device.
+  context_->Flush();
+  return S_OK;
+}
+
+HRESULT GpuSurfaceRenderer::RenderTexture(ID3D11Texture2D* texture,
+                                          UINT subresource_index,
+                                          uint32_t width, uint32_t height,
+                                          const PixelRect& source_rect,
+                                          bool mirror,
+                                          PreviewRotation rotation) {
+  assert(texture);
+
+  HRESULT hr = EnsureResources(width, height, source_rect, rotation);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Capture engine textures have a single mip level, so the subresource index
+  // is the array slice.
+  return Blit(texture, subresource_index, source_rect, mirror, rotation);
+}
+
+HRESULT GpuSurfaceRenderer::RenderBuffer(const uint8_t* data, int32_t stride,
+                                         uint32_t width, uint32_t height,
+                                         const PixelRect& source_rect,
+                                         bool mirror, PreviewRotation rotation,
+                                         PreviewPixelFormat format) {
+  assert(data);
+  const bool is_nv12 = format == PreviewPixelFormat::kNV12;
+  if (is_nv12 && stride <= 0) {
+    return E_INVALIDARG;
+  }
+
+  HRESULT hr = EnsureResources(width, height, source_rect, rotation);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  if (upload_texture_ && upload_texture_format_ != format) {
+    upload_texture_ = nullptr;
+  }
+
+  if (!upload_texture_) {
+    D3D11_TEXTURE2D_DESC texture_desc = {};
+    texture_desc.Width = width;
+    texture_desc.Height = height;
+    texture_desc.MipLevels = 1;
+    texture_desc.ArraySize = 1;
+    texture_desc.SampleDesc.Count = 1;
+    texture_desc.Usage = D3D11_USAGE_DEFAULT;
+    if (is_nv12) {
+      // The video processor converts NV12 to the BGRA shared surface on the
+      // GPU, so the CPU only copies the planes.
+      texture_desc.Format = DXGI_FORMAT_NV12;
+      texture_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    } else {
+      texture_desc.Format = DXGI_FORMAT_B8G8R8X8_UNORM;
+      texture_desc.BindFlags = D3D11_BIND_RENDER_TARGET;
+    }
+
+    hr = device_->CreateTexture2D(&texture_desc, nullptr, &upload_texture_);
+    if (FAILED(hr)) {
+      return hr;
+    }
+    upload_texture_format_ = format;
+  }
+
+  if (stride > 0) {
+    // For NV12 textures, the chroma plane is read from the rows following
+    // the luma plane with the same pitch.
+    context_->UpdateSubresource(upload_texture_.Get(), 0, nullptr, data,
+                                static_cast<UINT>(stride), 0);
+  } else {
+    // Bottom-up frames are uploaded row by row, as the row pitch of
+    // UpdateSubresource cannot be negative.
+    for (uint32_t y = 0; y < height; y++) {
+      D3D11_BOX row_box = {0, y, 0, width, y + 1, 1};
+      context_->UpdateSubresource(
+          upload_texture_.Get(), 0, &row_box,
+          data + static_cast<ptrdiff_t>(y) * stride, width * 4, 0);
+    }
+  }
+  return Blit(upload_texture_.Get(), 0, source_rect, mirror, rotation);
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,129 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_GPU_SURFACE_RENDERER_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_GPU_SURFACE_RENDERER_H_
+
+#include <d3d11.h>
+#include <d3d11_1.h>
+#include <windows.h>
+#include <wrl/client.h>
+
+#include "pixel_conversion.h"
+#include "preview_crop.h"
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+// Renders captured frames into a DXGI shared texture that can be handed to
+// Flutter as a GPU surface.
+//
+// Frames are copied with the D3D11 video processor of the device shared with
+// the capture engine, which also converts the frame format to BGRA and handles
+// mirroring, rotation and cropping. Frames that are only available in system
+// memory are uploaded to an intermediate texture first.
+class GpuSurfaceRenderer {
+ public:
+  explicit GpuSurfaceRenderer(ID3D11Device* device) : device_(device) {}
+  virtual ~GpuSurfaceRenderer() = default;
+
+  // Prevent copying.
+  GpuSurfaceRenderer(GpuSurfaceRenderer const&) = delete;
+  GpuSurfaceRenderer& operator=(GpuSurfaceRenderer const&) = delete;
+
+  // Queries the video processing interfaces of the device.
+  //
+  // Returns a failure if the device has no video processing support, in which
+  // case the renderer cannot be used.
+  HRESULT Initialize();
+
+  // Returns true if the video processor can mirror frames horizontally.
+  bool SupportsMirroring() const { return video_context1_ != nullptr; }
+
+  // Returns true if the video processor can rotate frames.
+  bool SupportsRotation() const { return supports_rotation_; }
+
+  // Renders a subresource of a captured texture into the shared surface.
+  //
+  // texture:           Texture of the captured sample.
+  // subresource_index: Index of the frame inside the texture array.
+  // width:             Frame width.
+  // height:            Frame height.
+  // source_rect:       Region of the frame rendered into the shared surface,
+  //                    which has the size of the rotated region.
+  // mirror:            If true, the frame is mirrored horizontally.
+  // rotation:          Clockwise rotation applied after mirroring.
+  HRESULT RenderTexture(ID3D11Texture2D* texture, UINT subresource_index,
+                        uint32_t width, uint32_t height,
+                        const PixelRect& source_rect, bool mirror,
+                        PreviewRotation rotation);
+
+  // Uploads a frame from system memory and renders it into the shared
+  // surface.
+  //
+  // data:   First byte of the top row of the frame. For NV12 frames, the
+  //         chroma plane directly follows |height| luma rows.
+  // stride: Distance in bytes between the starts of two rows. Negative for
+  //         bottom-up frames, which are only supported for RGB32.
+  // width:       Frame width.
+  // height:      Frame height.
+  // source_rect: Region of the frame rendered into the shared surface.
+  // mirror:      If true, the frame is mirrored horizontally.
+  // rotation:    Clockwise rotation applied after mirroring.
+  // format:      Pixel format of the frame.
+  HRESULT RenderBuffer(const uint8_t* data, int32_t stride, uint32_t width,
+                       uint32_t height, const PixelRect& source_rect,
+                       bool mirror, PreviewRotation rotation,
+                       PreviewPixelFormat format);
+
+  // Returns the DXGI shared handle of the surface, or nullptr if nothing has
+  // been rendered yet.
+  HANDLE GetSharedHandle() const { return shared_handle_; }
+
+  // Returns the width of the shared surface.
+  uint32_t GetWidth() const { return width_; }
+
+  // Returns the height of the shared surface.
+  uint32_t GetHeight() const { return height_; }
+
+ private:
+  // (Re)creates the video processor and the shared surface if the frame size
+  // or the size of the shared surface has changed.
+  HRESULT EnsureResources(uint32_t input_width, uint32_t input_height,
+                          uint32_t width, uint32_t height);
+
+  // (Re)creates the resources for rendering |source_rect| of a frame rotated
+  // by |rotation| into the shared surface.
+  HRESULT EnsureResources(uint32_t input_width, uint32_t input_height,
+                          const PixelRect& source_rect,
+                          PreviewRotation rotation);
+
+  // Blits a region of an array slice of the given texture into the shared
+  // surface.
+  HRESULT Blit(ID3D11Texture2D* texture, UINT array_slice,
+               const PixelRect& source_rect, bool mirror,
+               PreviewRotation rotation);
+
+  bool supports_rotation_ = false;
+  uint32_t input_width_ = 0;
+  uint32_t input_height_ = 0;
+  uint32_t width_ = 0;
+  uint32_t height_ = 0;
+  HANDLE shared_handle_ = nullptr;
+  ComPtr<ID3D11Device> device_;
+  ComPtr<ID3D11DeviceContext> context_;
+  ComPtr<ID3D11VideoDevice> video_device_;
+  ComPtr<ID3D11VideoContext> video_context_;
+  ComPtr<ID3D11VideoContext1> video_context1_;
+  ComPtr<ID3D11VideoProcessorEnumerator> video_processor_enumerator_;
+  ComPtr<ID3D11VideoProcessor> video_processor_;
+  ComPtr<ID3D11Texture2D> shared_texture_;
+  ComPtr<ID3D11VideoProcessorOutputView> output_view_;
+  ComPtr<ID3D11Texture2D> upload_texture_;
+  PreviewPixelFormat upload_texture_format_ = PreviewPixelFormat::kRGB32;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_GPU_SURFACE_RENDERER_H_
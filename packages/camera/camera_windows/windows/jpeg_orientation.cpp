@@ -0,0 +1,188 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "jpeg_orientation.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace camera_windows {
+
+namespace {
+
+constexpr uint8_t kMarkerPrefix = 0xFF;
+constexpr uint8_t kStartOfImage = 0xD8;
+constexpr uint8_t kStartOfScan = 0xDA;
+constexpr uint8_t kApp0 = 0xE0;
+constexpr uint8_t kApp1 = 0xE1;
+
+// Identifier at the start of the APP1 segment holding EXIF data.
+constexpr uint8_t kExifIdentifier[] = {'E', 'x', 'i', 'f', 0, 0};
+
+constexpr uint16_t kOrientationTag = 0x0112;
+constexpr uint16_t kShortType = 3;
+constexpr size_t kIfdEntrySize = 12;
+
+// A JPEG marker segment.
+struct Segment {
+  uint8_t marker = 0;
+  // Offset of the marker prefix.
+  size_t offset = 0;
+  // Offset and length of the payload that follows the length field.
+  size_t payload_offset = 0;
+  size_t payload_length = 0;
+};
+
+uint16_t ReadUint16(const uint8_t* data, bool big_endian) {
+  return big_endian ? static_cast<uint16_t>((data[0] << 8) | data[1])
+                    : static_cast<uint16_t>((data[1] << 8) | data[0]);
+}
+
+uint32_t ReadUint32(const uint8_t* data, bool big_endian) {
+  return big_endian
+             ? (static_cast<uint32_t>(ReadUint16(data, true)) << 16) |
+                   ReadUint16(data + 2, true)
+             : (static_cast<uint32_t>(ReadUint16(data + 2, false)) << 16) |
+                   ReadUint16(data, false);
+}
+
+void WriteUint16(uint16_t value, bool big_endian, uint8_t* data) {
+  const uint8_t high = static_cast<uint8_t>(value >> 8);
+  const uint8_t low = static_cast<uint8_t>(value & 0xFF);
+  data[0] = big_endian ? high : low;
+  data[1] = big_endian ? low : high;
+}
+
+// Reads the segment at |offset| of |jpeg|.
+//
+// Returns false if there is no complete segment at |offset|.
+bool ReadSegment(const std::vector<uint8_t>& jpeg, size_t offset,
+                 Segment* segment) {
+  if (offset + 4 > jpeg.size() || jpeg[offset] != kMarkerPrefix) {
+    return false;
+  }
+
+  const size_t length = ReadUint16(&jpeg[offset + 2], true);
+  if (length < 2 || offset + 2 + length > jpeg.size()) {
+    return false;
+  }
+
+  segment->marker = jpeg[offset + 1];
+  segment->offset = offset;
+  segment->payload_offset = offset + 4;
+  segment->payload_length = length - 2;
+  return true;
+}
+
+// Overwrites the orientation tag of the EXIF data in the APP1 |segment|.
+//
+// Returns false if the EXIF data has no orientation tag in its first IFD.
+bool OverwriteExifOrientation(const Segment& segment, uint16_t orientation,
+                              std::vector<uint8_t>* jpeg) {
+  uint8_t* exif = jpeg->data() + segment.payload_offset;
+  const size_t exif_length = segment.payload_length;
+
+  // The TIFF header follows the identifier, and IFD offsets are relative to
+  // it.
+  uint8_t* tiff = exif + sizeof(kExifIdentifier);
+  const size_t tiff_length = exif_length - sizeof(kExifIdentifier);
+  if (tiff_length < 8) {
+    return false;
+  }
+
+  bool big_endian;
+  if (tiff[0] == 'M' && tiff[1] == 'M') {
+    big_endian = true;
+  } else if (tiff[0] == 'I' && tiff[1] == 'I') {
+    big_endian = false;
+  } else {
+    return false;
+  }
+
+  const size_t ifd_offset = ReadUint32(tiff + 4, big_endian);
+  if (ifd_offset + 2 > tiff_length) {
+    return false;
+  }
+
+  const size_t entry_count = ReadUint16(tiff + ifd_offset, big_endian);
+  const size_t entries_offset = ifd_offset + 2;
+  if (entries_offset + entry_count * kIfdEntrySize > tiff_length) {
+    return false;
+  }
+
+  for (size_t i = 0; i < entry_count; i++) {
+    uint8_t* entry = tiff + entries_offset + i * kIfdEntrySize;
+    if (ReadUint16(entry, big_endian) != kOrientationTag) {
+      continue;
+    }
+    if (ReadUint16(entry + 2, big_endian) != kShortType ||
+        ReadUint32(entry + 4, big_endian) != 1) {
+      return false;
+    }
+    // A single short is stored at the start of the value field.
+    WriteUint16(orientation, big_endian, entry + 8);
+    return true;
+  }
+  return false;
+}
+
+// Inserts an APP1 segment with EXIF data holding only |orientation| at
+// |offset| of |jpeg|.
+void InsertExifOrientation(size_t offset, uint16_t orientation,
+                           std::vector<uint8_t>* jpeg) {
+  const uint8_t high = static_cast<uint8_t>(orientation >> 8);
+  const uint8_t low = static_cast<uint8_t>(orientation & 0xFF);
+  const uint8_t segment[] = {
+      // APP1 marker and segment length.
+      kMarkerPrefix, kApp1, 0x00, 0x22,
+      // EXIF identifier.
+      'E', 'x', 'i', 'f', 0x00, 0x00,
+      // Big endian TIFF header, with the IFD following it.
+      'M', 'M', 0x00, 0x2A, 0x00, 0x00, 0x00, 0x08,
+      // IFD with a single entry: the orientation as one short.
+      0x00, 0x01, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, high, low,
+      0x00, 0x00,
+      // No next IFD.
+      0x00, 0x00, 0x00, 0x00};
+  jpeg->insert(jpeg->begin() + offset, std::begin(segment),
+               std::end(segment));
+}
+
+}  // namespace
+
+bool SetJpegExifOrientation(uint16_t orientation, std::vector<uint8_t>* jpeg) {
+  assert(jpeg);
+
+  if (jpeg->size() < 2 || (*jpeg)[0] != kMarkerPrefix ||
+      (*jpeg)[1] != kStartOfImage) {
+    return false;
+  }
+
+  // EXIF data is inserted after a JFIF segment, which must come first.
+  size_t insert_offset = 2;
+  size_t offset = 2;
+  Segment segment;
+  while (ReadSegment(*jpeg, offset, &segment) &&
+         segment.marker != kStartOfScan) {
+    if (segment.marker == kApp0 && segment.offset == 2) {
+      insert_offset = segment.payload_offset + segment.payload_length;
+    } else if (segment.marker == kApp1 &&
+               segment.payload_length >= sizeof(kExifIdentifier) &&
+               std::memcmp(jpeg->data() + segment.payload_offset,
+                           kExifIdentifier, sizeof(kExifIdentifier)) == 0) {
+      return OverwriteExifOrientation(segment, orientation, jpeg);
+    }
+    offset = segment.payload_offset + segment.payload_length;
+  }
+
+  if (segment.marker != kStartOfScan) {
+    // The segments before the image data are truncated.
+    return false;
+  }
+
+  InsertExifOrientation(insert_offset, orientation, jpeg);
+  return true;
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,33 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_JPEG_ORIENTATION_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_JPEG_ORIENTATION_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace camera_windows {
+
+// EXIF orientations of images that are displayed after rotating them
+// clockwise by the given angle.
+constexpr uint16_t kExifOrientationNormal = 1;
+constexpr uint16_t kExifOrientationRotate90 = 6;
+constexpr uint16_t kExifOrientationRotate180 = 3;
+constexpr uint16_t kExifOrientationRotate270 = 8;
+
+// Sets the EXIF orientation tag of the JPEG image in |jpeg| to |orientation|
+// without changing its compressed image data.
+//
+// The orientation tag of existing EXIF data is overwritten in place. Images
+// without EXIF data get an EXIF segment holding only the orientation tag.
+//
+// Returns false if |jpeg| is not a JPEG image, or if its EXIF data has no
+// orientation tag, which cannot be added without rewriting the EXIF data.
+bool SetJpegExifOrientation(uint16_t orientation, std::vector<uint8_t>* jpeg);
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_JPEG_ORIENTATION_H_
@@ -0,0 +1,198 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "media_type_cache.h"
+
+#include <cassert>
+
+namespace camera_windows {
+
+namespace {
+
+// Frame rate below which media types are only used if requested explicitly.
+constexpr float kMinimumAcceptedFrameRate = 15.f;
+
+// Frame rates closer than this to the target are considered exact matches.
+constexpr float kFrameRateTolerance = 0.5f;
+
+// Returns the relative cost of turning frames of |subtype| into the RGB32
+// preview frames and the encoder input.
+int GetSubtypeConversionCost(const GUID& subtype) {
+  if (subtype == MFVideoFormat_RGB32) {
+    return 0;
+  } else if (subtype == MFVideoFormat_NV12 || subtype == MFVideoFormat_YUY2) {
+    // Converted by the video processor.
+    return 1;
+  } else if (subtype == MFVideoFormat_MJPG) {
+    // Needs a decoder MFT.
+    return 3;
+  }
+  return 2;
+}
+
+// Returns a score for how well |frame_rate| fits |target_frame_rate|, where
+// higher is better.
+float GetFrameRateScore(float frame_rate, float target_frame_rate) {
+  if (target_frame_rate <= 0.f) {
+    return frame_rate;
+  }
+  float distance = frame_rate > target_frame_rate
+                       ? frame_rate - target_frame_rate
+                       : target_frame_rate - frame_rate;
+  return distance < kFrameRateTolerance ? 0.f : -distance;
+}
+
+// Enumerates native media types with |get_media_type|, which returns the
+// media type at an index until it fails.
+MediaTypeCache::MediaTypeList EnumerateMediaTypes(
+    const std::function<HRESULT(DWORD, IMFMediaType**)>& get_media_type) {
+  MediaTypeCache::MediaTypeList media_types;
+
+  for (DWORD i = 0;; i++) {
+    ComPtr<IMFMediaType> media_type;
+    if (FAILED(get_media_type(i, media_type.GetAddressOf()))) {
+      break;
+    }
+
+    uint32_t frame_rate_numerator, frame_rate_denominator;
+    if (FAILED(MFGetAttributeRatio(media_type.Get(), MF_MT_FRAME_RATE,
+                                   &frame_rate_numerator,
+                                   &frame_rate_denominator)) ||
+        !frame_rate_denominator) {
+      continue;
+    }
+
+    DeviceMediaType device_media_type;
+    if (FAILED(media_type->GetGUID(MF_MT_SUBTYPE,
+                                   &device_media_type.subtype))) {
+      continue;
+    }
+    if (FAILED(MFGetAttributeSize(media_type.Get(), MF_MT_FRAME_SIZE,
+                                  &device_media_type.width,
+                                  &device_media_type.height))) {
+      continue;
+    }
+
+    device_media_type.frame_rate =
+        static_cast<float>(frame_rate_numerator) / frame_rate_denominator;
+    device_media_type.media_type = std::move(media_type);
+    media_types.push_back(std::move(device_media_type));
+  }
+
+  return media_types;
+}
+
+}  // namespace
+
+// static
+MediaTypeCache& MediaTypeCache::GetInstance() {
+  static MediaTypeCache instance;
+  return instance;
+}
+
+std::shared_ptr<const MediaTypeCache::MediaTypeList>
+MediaTypeCache::GetMediaTypes(const std::string& device_id,
+                              DWORD source_stream_index,
+                              IMFCaptureSource* source) {
+  assert(source);
+  return GetOrEnumerateMediaTypes(
+      std::make_pair(device_id, source_stream_index),
+      [source, source_stream_index](DWORD index, IMFMediaType** media_type) {
+        return source->GetAvailableDeviceMediaType(source_stream_index, index,
+                                                   media_type);
+      });
+}
+
+std::shared_ptr<const MediaTypeCache::MediaTypeList>
+MediaTypeCache::GetMediaTypes(const std::string& device_id,
+                              IMFSourceReader* source_reader) {
+  assert(source_reader);
+  return GetOrEnumerateMediaTypes(
+      std::make_pair(device_id,
+                     static_cast<DWORD>(MF_SOURCE_READER_FIRST_VIDEO_STREAM)),
+      [source_reader](DWORD index, IMFMediaType** media_type) {
+        return source_reader->GetNativeMediaType(
+            static_cast<DWORD>(MF_SOURCE_READER_FIRST_VIDEO_STREAM), index,
+            media_type);
+      });
+}
+
+std::shared_ptr<const MediaTypeCache::MediaTypeList>
+MediaTypeCache::GetOrEnumerateMediaTypes(
+    const std::pair<std::string, DWORD>& key,
+    const std::function<HRESULT(DWORD, IMFMediaType**)>& get_media_type) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = media_types_.find(key);
+    if (it != media_types_.end()) {
+      return it->second;
+    }
+  }
+
+  // Enumerates outside of the lock, as this can take a long time. If two
+  // controllers open the same device concurrently, the first result wins.
+  auto media_types = std::make_shared<const MediaTypeList>(
+      EnumerateMediaTypes(get_media_type));
+  if (media_types->empty()) {
+    // Failed enumerations are not cached, so that they are retried.
+    return media_types;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return media_types_.emplace(key, std::move(media_types)).first->second;
+}
+
+void MediaTypeCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  media_types_.clear();
+}
+
+const DeviceMediaType* FindBestDeviceMediaType(
+    const MediaTypeCache::MediaTypeList& media_types, uint32_t max_height,
+    float target_frame_rate) {
+  float minimum_frame_rate = kMinimumAcceptedFrameRate;
+  if (target_frame_rate > 0.f && target_frame_rate < minimum_frame_rate) {
+    minimum_frame_rate = target_frame_rate - kFrameRateTolerance;
+  }
+
+  const DeviceMediaType* best = nullptr;
+  uint64_t best_pixels = 0;
+  float best_frame_rate_score = 0.f;
+  int best_cost = 0;
+
+  for (const DeviceMediaType& media_type : media_types) {
+    if (media_type.frame_rate < minimum_frame_rate ||
+        media_type.height > max_height) {
+      continue;
+    }
+
+    uint64_t pixels = static_cast<uint64_t>(media_type.width) *
+                      static_cast<uint64_t>(media_type.height);
+    float frame_rate_score =
+        GetFrameRateScore(media_type.frame_rate, target_frame_rate);
+    int cost = GetSubtypeConversionCost(media_type.subtype);
+
+    bool is_better;
+    if (!best) {
+      is_better = true;
+    } else if (pixels != best_pixels) {
+      is_better = pixels > best_pixels;
+    } else if (frame_rate_score != best_frame_rate_score) {
+      is_better = frame_rate_score > best_frame_rate_score;
+    } else {
+      is_better = cost < best_cost;
+    }
+
+    if (is_better) {
+      best = &media_type;
+      best_pixels = pixels;
+      best_frame_rate_score = frame_rate_score;
+      best_cost = cost;
+    }
+  }
+
+  return best;
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,106 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_MEDIA_TYPE_CACHE_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_MEDIA_TYPE_CACHE_H_
+
+#include <mfapi.h>
+#include <mfcaptureengine.h>
+#include <mfreadwrite.h>
+#include <wrl/client.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+// A native media type of a video capture device stream.
+struct DeviceMediaType {
+  // The media type as returned by the capture source. Shared between all
+  // users of the cache, so it must not be modified.
+  ComPtr<IMFMediaType> media_type;
+  GUID subtype = GUID_NULL;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  float frame_rate = 0.f;
+};
+
+// Process-wide cache of the native media types of video capture devices.
+//
+// Enumerating media types with |IMFCaptureSource::GetAvailableDeviceMediaType|
+// or |IMFSourceReader::GetNativeMediaType| is slow for devices that expose
+// hundreds of types, so each device stream is enumerated once and the result
+// is reused by every capture controller opening the same device.
+class MediaTypeCache {
+ public:
+  using MediaTypeList = std::vector<DeviceMediaType>;
+
+  // Returns the process-wide cache instance.
+  static MediaTypeCache& GetInstance();
+
+  MediaTypeCache() = default;
+  virtual ~MediaTypeCache() = default;
+
+  // Prevent copying.
+  MediaTypeCache(MediaTypeCache const&) = delete;
+  MediaTypeCache& operator=(MediaTypeCache const&) = delete;
+
+  // Returns the native media types of a device stream.
+  //
+  // The media types are enumerated from |source| if the stream of the device
+  // is not cached yet. Media types without a valid frame size or frame rate
+  // are skipped. Returns an empty list if no media type could be enumerated.
+  //
+  // device_id:           Symbolic link of the device, as used to create the
+  //                      video source.
+  // source_stream_index: Stream of |source| to enumerate.
+  // source:              Capture source of the capture engine opening the
+  //                      device.
+  std::shared_ptr<const MediaTypeList> GetMediaTypes(
+      const std::string& device_id, DWORD source_stream_index,
+      IMFCaptureSource* source);
+
+  // Returns the native media types of the first video stream of a source
+  // reader, enumerated from |source_reader| if they are not cached yet.
+  std::shared_ptr<const MediaTypeList> GetMediaTypes(
+      const std::string& device_id, IMFSourceReader* source_reader);
+
+  // Removes all cached media types.
+  void Clear();
+
+ private:
+  // Returns the cached media types of |key|, or enumerates them with
+  // |get_media_type| and caches them.
+  std::shared_ptr<const MediaTypeList> GetOrEnumerateMediaTypes(
+      const std::pair<std::string, DWORD>& key,
+      const std::function<HRESULT(DWORD, IMFMediaType**)>& get_media_type);
+
+  std::mutex mutex_;
+  std::map<std::pair<std::string, DWORD>, std::shared_ptr<const MediaTypeList>>
+      media_types_;
+};
+
+// Returns the best media type of |media_types|, or nullptr if none fits.
+//
+// Media types taller than |max_height| or slower than the minimum accepted
+// frame rate are skipped. The remaining types are ranked by pixel count, then
+// frame rate, then subtype: uncompressed subtypes beat compressed ones such as
+// MJPG, which need a decoder before frames reach the preview or the encoder.
+//
+// target_frame_rate: Preferred frame rate, or 0 to prefer the highest frame
+//                    rate. Types closer to the target rank higher, and the
+//                    minimum accepted frame rate is lowered to the target.
+const DeviceMediaType* FindBestDeviceMediaType(
+    const MediaTypeCache::MediaTypeList& media_types, uint32_t max_height,
+    float target_frame_rate);
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_MEDIA_TYPE_CACHE_H_
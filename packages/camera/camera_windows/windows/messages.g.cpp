@@ -0,0 +1,2308 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+// Autogenerated from Pigeon (v10.1.2), do not edit directly.
+// See also: https://pub.dev/packages/pigeon
+
+#undef _HAS_EXCEPTIONS
+
+#include "messages.g.h"
+
+#include <flutter/basic_message_channel.h>
+#include <flutter/binary_messenger.h>
+#include <flutter/encodable_value.h>
+#include <flutter/standard_message_codec.h>
+
+#include <map>
+#include <optional>
+#include <string>
+
+namespace camera_windows {
+using flutter::BasicMessageChannel;
+using flutter::CustomEncodableValue;
+using flutter::EncodableList;
+using flutter::EncodableMap;
+using flutter::EncodableValue;
+
+// PlatformMediaSettings
+
+PlatformMediaSettings::PlatformMediaSettings(
+    bool enable_audio, const PlatformPreviewTextureMode& preview_texture_mode,
+    bool adaptive_preview,
+    const PlatformPreviewPixelFormat& preview_pixel_format,
+    bool zero_shutter_lag, bool preview_stats,
+    const PlatformCaptureBackend& capture_backend)
+    : enable_audio_(enable_audio),
+      preview_texture_mode_(preview_texture_mode),
+      adaptive_preview_(adaptive_preview),
+      preview_pixel_format_(preview_pixel_format),
+      zero_shutter_lag_(zero_shutter_lag),
+      preview_stats_(preview_stats),
+      capture_backend_(capture_backend) {}
+
+PlatformMediaSettings::PlatformMediaSettings(
+    const PlatformResolutionPreset* resolution_preset, bool enable_audio,
+    const std::string* audio_device_id,
+    const PlatformPreviewTextureMode& preview_texture_mode,
+    bool adaptive_preview, const int64_t* target_frame_rate,
+    const PlatformPreviewPixelFormat& preview_pixel_format,
+    bool zero_shutter_lag, bool preview_stats,
+    const int64_t* preview_max_frame_rate,
+    const PlatformCaptureBackend& capture_backend)
+    : resolution_preset_(
+          resolution_preset
+              ? std::optional<PlatformResolutionPreset>(*resolution_preset)
+              : std::nullopt),
+      enable_audio_(enable_audio),
+      audio_device_id_(audio_device_id
+                           ? std::optional<std::string>(*audio_device_id)
+                           : std::nullopt),
+      preview_texture_mode_(preview_texture_mode),
+      adaptive_preview_(adaptive_preview),
+      target_frame_rate_(target_frame_rate
+                             ? std::optional<int64_t>(*target_frame_rate)
+                             : std::nullopt),
+      preview_pixel_format_(preview_pixel_format),
+      zero_shutter_lag_(zero_shutter_lag),
+      preview_stats_(preview_stats),
+      preview_max_frame_rate_(
+          preview_max_frame_rate
+              ? std::optional<int64_t>(*preview_max_frame_rate)
+              : std::nullopt),
+      capture_backend_(capture_backend) {}
+
+const PlatformResolutionPreset* PlatformMediaSettings::resolution_preset()
+    const {
+  return resolution_preset_ ? &(*resolution_preset_) : nullptr;
+}
+
+void PlatformMediaSettings::set_resolution_preset(
+    const PlatformResolutionPreset* value_arg) {
+  resolution_preset_ = value_arg
+                           ? std::optional<PlatformResolutionPreset>(*value_arg)
+                           : std::nullopt;
+}
+
+void PlatformMediaSettings::set_resolution_preset(
+    const PlatformResolutionPreset& value_arg) {
+  resolution_preset_ = value_arg;
+}
+
+bool PlatformMediaSettings::enable_audio() const { return enable_audio_; }
+
+void PlatformMediaSettings::set_enable_audio(bool value_arg) {
+  enable_audio_ = value_arg;
+}
+
+const std::string* PlatformMediaSettings::audio_device_id() const {
+  return audio_device_id_ ? &(*audio_device_id_) : nullptr;
+}
+
+void PlatformMediaSettings::set_audio_device_id(
+    const std::string_view* value_arg) {
+  audio_device_id_ =
+      value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void PlatformMediaSettings::set_audio_device_id(std::string_view value_arg) {
+  audio_device_id_ = value_arg;
+}
+
+const PlatformPreviewTextureMode& PlatformMediaSettings::preview_texture_mode()
+    const {
+  return preview_texture_mode_;
+}
+
+void PlatformMediaSettings::set_preview_texture_mode(
+    const PlatformPreviewTextureMode& value_arg) {
+  preview_texture_mode_ = value_arg;
+}
+
+bool PlatformMediaSettings::adaptive_preview() const {
+  return adaptive_preview_;
+}
+
+void PlatformMediaSettings::set_adaptive_preview(bool value_arg) {
+  adaptive_preview_ = value_arg;
+}
+
+const int64_t* PlatformMediaSettings::target_frame_rate() const {
+  return target_frame_rate_ ? &(*target_frame_rate_) : nullptr;
+}
+
+void PlatformMediaSettings::set_target_frame_rate(const int64_t* value_arg) {
+  target_frame_rate_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformMediaSettings::set_target_frame_rate(int64_t value_arg) {
+  target_frame_rate_ = value_arg;
+}
+
+const PlatformPreviewPixelFormat& PlatformMediaSettings::preview_pixel_format()
+    const {
+  return preview_pixel_format_;
+}
+
+void PlatformMediaSettings::set_preview_pixel_format(
+    const PlatformPreviewPixelFormat& value_arg) {
+  preview_pixel_format_ = value_arg;
+}
+
+bool PlatformMediaSettings::zero_shutter_lag() const {
+  return zero_shutter_lag_;
+}
+
+void PlatformMediaSettings::set_zero_shutter_lag(bool value_arg) {
+  zero_shutter_lag_ = value_arg;
+}
+
+bool PlatformMediaSettings::preview_stats() const { return preview_stats_; }
+
+void PlatformMediaSettings::set_preview_stats(bool value_arg) {
+  preview_stats_ = value_arg;
+}
+
+const int64_t* PlatformMediaSettings::preview_max_frame_rate() const {
+  return preview_max_frame_rate_ ? &(*preview_max_frame_rate_) : nullptr;
+}
+
+void PlatformMediaSettings::set_preview_max_frame_rate(
+    const int64_t* value_arg) {
+  preview_max_frame_rate_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformMediaSettings::set_preview_max_frame_rate(int64_t value_arg) {
+  preview_max_frame_rate_ = value_arg;
+}
+
+const PlatformCaptureBackend& PlatformMediaSettings::capture_backend() const {
+  return capture_backend_;
+}
+
+void PlatformMediaSettings::set_capture_backend(
+    const PlatformCaptureBackend& value_arg) {
+  capture_backend_ = value_arg;
+}
+
+EncodableList PlatformMediaSettings::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(11);
+  list.push_back(resolution_preset_ ? EncodableValue((int)(*resolution_preset_))
+                                    : EncodableValue());
+  list.push_back(EncodableValue(enable_audio_));
+  list.push_back(audio_device_id_ ? EncodableValue(*audio_device_id_)
+                                  : EncodableValue());
+  list.push_back(EncodableValue((int)preview_texture_mode_));
+  list.push_back(EncodableValue(adaptive_preview_));
+  list.push_back(target_frame_rate_ ? EncodableValue(*target_frame_rate_)
+                                    : EncodableValue());
+  list.push_back(EncodableValue((int)preview_pixel_format_));
+  list.push_back(EncodableValue(zero_shutter_lag_));
+  list.push_back(EncodableValue(preview_stats_));
+  list.push_back(preview_max_frame_rate_
+                     ? EncodableValue(*preview_max_frame_rate_)
+                     : EncodableValue());
+  list.push_back(EncodableValue((int)capture_backend_));
+  return list;
+}
+
+PlatformMediaSettings PlatformMediaSettings::FromEncodableList(
+    const EncodableList& list) {
+  PlatformMediaSettings decoded(
+      std::get<bool>(list[1]),
+      (PlatformPreviewTextureMode)(std::get<int32_t>(list[3])),
+      std::get<bool>(list[4]),
+      (PlatformPreviewPixelFormat)(std::get<int32_t>(list[6])),
+      std::get<bool>(list[7]), std::get<bool>(list[8]),
+      (PlatformCaptureBackend)(std::get<int32_t>(list[10])));
+  auto& encodable_resolution_preset = list[0];
+  if (!encodable_resolution_preset.IsNull()) {
+    decoded.set_resolution_preset((PlatformResolutionPreset)(
+        std::get<int32_t>(encodable_resolution_preset)));
+  }
+  auto& encodable_audio_device_id = list[2];
+  if (!encodable_audio_device_id.IsNull()) {
+    decoded.set_audio_device_id(
+        std::get<std::string>(encodable_audio_device_id));
+  }
+  auto& encodable_target_frame_rate = list[5];
+  if (!encodable_target_frame_rate.IsNull()) {
+    decoded.set_target_frame_rate(encodable_target_frame_rate.LongValue());
+  }
+  auto& encodable_preview_max_frame_rate = list[9];
+  if (!encodable_preview_max_frame_rate.IsNull()) {
+    decoded.set_preview_max_frame_rate(
+        encodable_preview_max_frame_rate.LongValue());
+  }
+  return decoded;
+}
+
+// PlatformVideoRecordingSettings
+
+PlatformVideoRecordingSettings::PlatformVideoRecordingSettings(
+    const PlatformVideoCodec& video_codec, bool prefer_hardware_encoder,
+    bool stream_chunks)
+    : video_codec_(video_codec),
+      prefer_hardware_encoder_(prefer_hardware_encoder),
+      stream_chunks_(stream_chunks) {}
+
+PlatformVideoRecordingSettings::PlatformVideoRecordingSettings(
+    const PlatformVideoCodec& video_codec, bool prefer_hardware_encoder,
+    const int64_t* bitrate, const PlatformRateControlMode* rate_control_mode,
+    const int64_t* quality, const int64_t* keyframe_interval,
+    bool stream_chunks, const int64_t* audio_sample_rate,
+    const int64_t* audio_channels, const int64_t* audio_bitrate,
+    const int64_t* proxy_height, const int64_t* proxy_bitrate)
+    : video_codec_(video_codec),
+      prefer_hardware_encoder_(prefer_hardware_encoder),
+      bitrate_(bitrate ? std::optional<int64_t>(*bitrate) : std::nullopt),
+      rate_control_mode_(
+          rate_control_mode
+              ? std::optional<PlatformRateControlMode>(*rate_control_mode)
+              : std::nullopt),
+      quality_(quality ? std::optional<int64_t>(*quality) : std::nullopt),
+      keyframe_interval_(keyframe_interval
+                             ? std::optional<int64_t>(*keyframe_interval)
+                             : std::nullopt),
+      stream_chunks_(stream_chunks),
+      audio_sample_rate_(audio_sample_rate
+                             ? std::optional<int64_t>(*audio_sample_rate)
+                             : std::nullopt),
+      audio_channels_(audio_channels ? std::optional<int64_t>(*audio_channels)
+                                     : std::nullopt),
+      audio_bitrate_(audio_bitrate ? std::optional<int64_t>(*audio_bitrate)
+                                   : std::nullopt),
+      proxy_height_(proxy_height ? std::optional<int64_t>(*proxy_height)
+                                 : std::nullopt),
+      proxy_bitrate_(proxy_bitrate ? std::optional<int64_t>(*proxy_bitrate)
+                                   : std::nullopt) {}
+
+const PlatformVideoCodec& PlatformVideoRecordingSettings::video_codec() const {
+  return video_codec_;
+}
+
+void PlatformVideoRecordingSettings::set_video_codec(
+    const PlatformVideoCodec& value_arg) {
+  video_codec_ = value_arg;
+}
+
+bool PlatformVideoRecordingSettings::prefer_hardware_encoder() const {
+  return prefer_hardware_encoder_;
+}
+
+void PlatformVideoRecordingSettings::set_prefer_hardware_encoder(
+    bool value_arg) {
+  prefer_hardware_encoder_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::bitrate() const {
+  return bitrate_ ? &(*bitrate_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_bitrate(const int64_t* value_arg) {
+  bitrate_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_bitrate(int64_t value_arg) {
+  bitrate_ = value_arg;
+}
+
+const PlatformRateControlMode*
+PlatformVideoRecordingSettings::rate_control_mode() const {
+  return rate_control_mode_ ? &(*rate_control_mode_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_rate_control_mode(
+    const PlatformRateControlMode* value_arg) {
+  rate_control_mode_ = value_arg
+                           ? std::optional<PlatformRateControlMode>(*value_arg)
+                           : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_rate_control_mode(
+    const PlatformRateControlMode& value_arg) {
+  rate_control_mode_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::quality() const {
+  return quality_ ? &(*quality_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_quality(const int64_t* value_arg) {
+  quality_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_quality(int64_t value_arg) {
+  quality_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::keyframe_interval() const {
+  return keyframe_interval_ ? &(*keyframe_interval_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_keyframe_interval(
+    const int64_t* value_arg) {
+  keyframe_interval_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_keyframe_interval(int64_t value_arg) {
+  keyframe_interval_ = value_arg;
+}
+
+bool PlatformVideoRecordingSettings::stream_chunks() const {
+  return stream_chunks_;
+}
+
+void PlatformVideoRecordingSettings::set_stream_chunks(bool value_arg) {
+  stream_chunks_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::audio_sample_rate() const {
+  return audio_sample_rate_ ? &(*audio_sample_rate_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_audio_sample_rate(
+    const int64_t* value_arg) {
+  audio_sample_rate_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_audio_sample_rate(int64_t value_arg) {
+  audio_sample_rate_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::audio_channels() const {
+  return audio_channels_ ? &(*audio_channels_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_audio_channels(
+    const int64_t* value_arg) {
+  audio_channels_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_audio_channels(int64_t value_arg) {
+  audio_channels_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::audio_bitrate() const {
+  return audio_bitrate_ ? &(*audio_bitrate_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_audio_bitrate(
+    const int64_t* value_arg) {
+  audio_bitrate_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_audio_bitrate(int64_t value_arg) {
+  audio_bitrate_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::proxy_height() const {
+  return proxy_height_ ? &(*proxy_height_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_proxy_height(
+    const int64_t* value_arg) {
+  proxy_height_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_proxy_height(int64_t value_arg) {
+  proxy_height_ = value_arg;
+}
+
+const int64_t* PlatformVideoRecordingSettings::proxy_bitrate() const {
+  return proxy_bitrate_ ? &(*proxy_bitrate_) : nullptr;
+}
+
+void PlatformVideoRecordingSettings::set_proxy_bitrate(
+    const int64_t* value_arg) {
+  proxy_bitrate_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PlatformVideoRecordingSettings::set_proxy_bitrate(int64_t value_arg) {
+  proxy_bitrate_ = value_arg;
+}
+
+EncodableList PlatformVideoRecordingSettings::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(12);
+  list.push_back(EncodableValue((int)video_codec_));
+  list.push_back(EncodableValue(prefer_hardware_encoder_));
+  list.push_back(bitrate_ ? EncodableValue(*bitrate_) : EncodableValue());
+  list.push_back(rate_control_mode_ ? EncodableValue((int)(*rate_control_mode_))
+                                    : EncodableValue());
+  list.push_back(quality_ ? EncodableValue(*quality_) : EncodableValue());
+  list.push_back(keyframe_interval_ ? EncodableValue(*keyframe_interval_)
+                                    : EncodableValue());
+  list.push_back(EncodableValue(stream_chunks_));
+  list.push_back(audio_sample_rate_ ? EncodableValue(*audio_sample_rate_)
+                                    : EncodableValue());
+  list.push_back(audio_channels_ ? EncodableValue(*audio_channels_)
+                                 : EncodableValue());
+  list.push_back(audio_bitrate_ ? EncodableValue(*audio_bitrate_)
+                                : EncodableValue());
+  list.push_back(proxy_height_ ? EncodableValue(*proxy_height_)
+                               : EncodableValue());
+  list.push_back(proxy_bitrate_ ? EncodableValue(*proxy_bitrate_)
+                                : EncodableValue());
+  return list;
+}
+
+PlatformVideoRecordingSettings
+PlatformVideoRecordingSettings::FromEncodableList(const EncodableList& list) {
+  PlatformVideoRecordingSettings decoded(
+      (PlatformVideoCodec)(std::get<int32_t>(list[0])), std::get<bool>(list[1]),
+      std::get<bool>(list[6]));
+  auto& encodable_bitrate = list[2];
+  if (!encodable_bitrate.IsNull()) {
+    decoded.set_bitrate(encodable_bitrate.LongValue());
+  }
+  auto& encodable_rate_control_mode = list[3];
+  if (!encodable_rate_control_mode.IsNull()) {
+    decoded.set_rate_control_mode((PlatformRateControlMode)(
+        std::get<int32_t>(encodable_rate_control_mode)));
+  }
+  auto& encodable_quality = list[4];
+  if (!encodable_quality.IsNull()) {
+    decoded.set_quality(encodable_quality.LongValue());
+  }
+  auto& encodable_keyframe_interval = list[5];
+  if (!encodable_keyframe_interval.IsNull()) {
+    decoded.set_keyframe_interval(encodable_keyframe_interval.LongValue());
+  }
+  auto& encodable_audio_sample_rate = list[7];
+  if (!encodable_audio_sample_rate.IsNull()) {
+    decoded.set_audio_sample_rate(encodable_audio_sample_rate.LongValue());
+  }
+  auto& encodable_audio_channels = list[8];
+  if (!encodable_audio_channels.IsNull()) {
+    decoded.set_audio_channels(encodable_audio_channels.LongValue());
+  }
+  auto& encodable_audio_bitrate = list[9];
+  if (!encodable_audio_bitrate.IsNull()) {
+    decoded.set_audio_bitrate(encodable_audio_bitrate.LongValue());
+  }
+  auto& encodable_proxy_height = list[10];
+  if (!encodable_proxy_height.IsNull()) {
+    decoded.set_proxy_height(encodable_proxy_height.LongValue());
+  }
+  auto& encodable_proxy_bitrate = list[11];
+  if (!encodable_proxy_bitrate.IsNull()) {
+    decoded.set_proxy_bitrate(encodable_proxy_bitrate.LongValue());
+  }
+  return decoded;
+}
+
+// PlatformSize
+
+PlatformSize::PlatformSize(double width, double height)
+    : width_(width), height_(height) {}
+
+double PlatformSize::width() const { return width_; }
+
+void PlatformSize::set_width(double value_arg) { width_ = value_arg; }
+
+double PlatformSize::height() const { return height_; }
+
+void PlatformSize::set_height(double value_arg) { height_ = value_arg; }
+
+EncodableList PlatformSize::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(width_));
+  list.push_back(EncodableValue(height_));
+  return list;
+}
+
+PlatformSize PlatformSize::FromEncodableList(const EncodableList& list) {
+  PlatformSize decoded(std::get<double>(list[0]), std::get<double>(list[1]));
+  return decoded;
+}
+
+// PlatformAudioDevice
+
+PlatformAudioDevice::PlatformAudioDevice(const std::string& name,
+                                         const std::string& id)
+    : name_(name), id_(id) {}
+
+const std::string& PlatformAudioDevice::name() const { return name_; }
+
+void PlatformAudioDevice::set_name(std::string_view value_arg) {
+  name_ = value_arg;
+}
+
+const std::string& PlatformAudioDevice::id() const { return id_; }
+
+void PlatformAudioDevice::set_id(std::string_view value_arg) {
+  id_ = value_arg;
+}
+
+EncodableList PlatformAudioDevice::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(name_));
+  list.push_back(EncodableValue(id_));
+  return list;
+}
+
+PlatformAudioDevice PlatformAudioDevice::FromEncodableList(
+    const EncodableList& list) {
+  PlatformAudioDevice decoded(std::get<std::string>(list[0]),
+                              std::get<std::string>(list[1]));
+  return decoded;
+}
+
+// PlatformCaptureFormat
+
+PlatformCaptureFormat::PlatformCaptureFormat(int64_t width, int64_t height,
+                                             double frame_rate)
+    : width_(width), height_(height), frame_rate_(frame_rate) {}
+
+int64_t PlatformCaptureFormat::width() const { return width_; }
+
+void PlatformCaptureFormat::set_width(int64_t value_arg) { width_ = value_arg; }
+
+int64_t PlatformCaptureFormat::height() const { return height_; }
+
+void PlatformCaptureFormat::set_height(int64_t value_arg) {
+  height_ = value_arg;
+}
+
+double PlatformCaptureFormat::frame_rate() const { return frame_rate_; }
+
+void PlatformCaptureFormat::set_frame_rate(double value_arg) {
+  frame_rate_ = value_arg;
+}
+
+EncodableList PlatformCaptureFormat::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(3);
+  list.push_back(EncodableValue(width_));
+  list.push_back(EncodableValue(height_));
+  list.push_back(EncodableValue(frame_rate_));
+  return list;
+}
+
+PlatformCaptureFormat PlatformCaptureFormat::FromEncodableList(
+    const EncodableList& list) {
+  PlatformCaptureFormat decoded(list[0].LongValue(), list[1].LongValue(),
+                                std::get<double>(list[2]));
+  return decoded;
+}
+
+// PlatformPreviewStats
+
+PlatformPreviewStats::PlatformPreviewStats(
+    int64_t received_frames, int64_t rendered_frames, int64_t dropped_frames,
+    double capture_frame_rate, double render_frame_rate, int64_t latency_p50,
+    int64_t latency_p95, int64_t latency_p99, int64_t conversion_time_p50,
+    int64_t conversion_time_p95, int64_t conversion_time_p99)
+    : received_frames_(received_frames),
+      rendered_frames_(rendered_frames),
+      dropped_frames_(dropped_frames),
+      capture_frame_rate_(capture_frame_rate),
+      render_frame_rate_(render_frame_rate),
+      latency_p50_(latency_p50),
+      latency_p95_(latency_p95),
+      latency_p99_(latency_p99),
+      conversion_time_p50_(conversion_time_p50),
+      conversion_time_p95_(conversion_time_p95),
+      conversion_time_p99_(conversion_time_p99) {}
+
+int64_t PlatformPreviewStats::received_frames() const {
+  return received_frames_;
+}
+
+void PlatformPreviewStats::set_received_frames(int64_t value_arg) {
+  received_frames_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::rendered_frames() const {
+  return rendered_frames_;
+}
+
+void PlatformPreviewStats::set_rendered_frames(int64_t value_arg) {
+  rendered_frames_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::dropped_frames() const { return dropped_frames_; }
+
+void PlatformPreviewStats::set_dropped_frames(int64_t value_arg) {
+  dropped_frames_ = value_arg;
+}
+
+double PlatformPreviewStats::capture_frame_rate() const {
+  return capture_frame_rate_;
+}
+
+void PlatformPreviewStats::set_capture_frame_rate(double value_arg) {
+  capture_frame_rate_ = value_arg;
+}
+
+double PlatformPreviewStats::render_frame_rate() const {
+  return render_frame_rate_;
+}
+
+void PlatformPreviewStats::set_render_frame_rate(double value_arg) {
+  render_frame_rate_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::latency_p50() const { return latency_p50_; }
+
+void PlatformPreviewStats::set_latency_p50(int64_t value_arg) {
+  latency_p50_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::latency_p95() const { return latency_p95_; }
+
+void PlatformPreviewStats::set_latency_p95(int64_t value_arg) {
+  latency_p95_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::latency_p99() const { return latency_p99_; }
+
+void PlatformPreviewStats::set_latency_p99(int64_t value_arg) {
+  latency_p99_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::conversion_time_p50() const {
+  return conversion_time_p50_;
+}
+
+void PlatformPreviewStats::set_conversion_time_p50(int64_t value_arg) {
+  conversion_time_p50_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::conversion_time_p95() const {
+  return conversion_time_p95_;
+}
+
+void PlatformPreviewStats::set_conversion_time_p95(int64_t value_arg) {
+  conversion_time_p95_ = value_arg;
+}
+
+int64_t PlatformPreviewStats::conversion_time_p99() const {
+  return conversion_time_p99_;
+}
+
+void PlatformPreviewStats::set_conversion_time_p99(int64_t value_arg) {
+  conversion_time_p99_ = value_arg;
+}
+
+EncodableList PlatformPreviewStats::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(11);
+  list.push_back(EncodableValue(received_frames_));
+  list.push_back(EncodableValue(rendered_frames_));
+  list.push_back(EncodableValue(dropped_frames_));
+  list.push_back(EncodableValue(capture_frame_rate_));
+  list.push_back(EncodableValue(render_frame_rate_));
+  list.push_back(EncodableValue(latency_p50_));
+  list.push_back(EncodableValue(latency_p95_));
+  list.push_back(EncodableValue(latency_p99_));
+  list.push_back(EncodableValue(conversion_time_p50_));
+  list.push_back(EncodableValue(conversion_time_p95_));
+  list.push_back(EncodableValue(conversion_time_p99_));
+  return list;
+}
+
+PlatformPreviewStats PlatformPreviewStats::FromEncodableList(
+    const EncodableList& list) {
+  PlatformPreviewStats decoded(
+      list[0].LongValue(), list[1].LongValue(), list[2].LongValue(),
+      std::get<double>(list[3]), std::get<double>(list[4]), list[5].LongValue(),
+      list[6].LongValue(), list[7].LongValue(), list[8].LongValue(),
+      list[9].LongValue(), list[10].LongValue());
+  return decoded;
+}
+
+// PlatformRecordingStats
+
+PlatformRecordingStats::PlatformRecordingStats(
+    int64_t encoded_frames, int64_t dropped_frames, int64_t duration,
+    int64_t av_drift)
+    : encoded_frames_(encoded_frames),
+      dropped_frames_(dropped_frames),
+      duration_(duration),
+      av_drift_(av_drift) {}
+
+int64_t PlatformRecordingStats::encoded_frames() const {
+  return encoded_frames_;
+}
+
+void PlatformRecordingStats::set_encoded_frames(int64_t value_arg) {
+  encoded_frames_ = value_arg;
+}
+
+int64_t PlatformRecordingStats::dropped_frames() const {
+  return dropped_frames_;
+}
+
+void PlatformRecordingStats::set_dropped_frames(int64_t value_arg) {
+  dropped_frames_ = value_arg;
+}
+
+int64_t PlatformRecordingStats::duration() const { return duration_; }
+
+void PlatformRecordingStats::set_duration(int64_t value_arg) {
+  duration_ = value_arg;
+}
+
+int64_t PlatformRecordingStats::av_drift() const { return av_drift_; }
+
+void PlatformRecordingStats::set_av_drift(int64_t value_arg) {
+  av_drift_ = value_arg;
+}
+
+EncodableList PlatformRecordingStats::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(EncodableValue(encoded_frames_));
+  list.push_back(EncodableValue(dropped_frames_));
+  list.push_back(EncodableValue(duration_));
+  list.push_back(EncodableValue(av_drift_));
+  return list;
+}
+
+PlatformRecordingStats PlatformRecordingStats::FromEncodableList(
+    const EncodableList& list) {
+  PlatformRecordingStats decoded(list[0].LongValue(), list[1].LongValue(),
+                                 list[2].LongValue(), list[3].LongValue());
+  return decoded;
+}
+
+// PlatformExposureOffsetRange
+
+PlatformExposureOffsetRange::PlatformExposureOffsetRange(double min, double max,
+                                                         double step)
+    : min_(min), max_(max), step_(step) {}
+
+double PlatformExposureOffsetRange::min() const { return min_; }
+
+void PlatformExposureOffsetRange::set_min(double value_arg) {
+  min_ = value_arg;
+}
+
+double PlatformExposureOffsetRange::max() const { return max_; }
+
+void PlatformExposureOffsetRange::set_max(double value_arg) {
+  max_ = value_arg;
+}
+
+double PlatformExposureOffsetRange::step() const { return step_; }
+
+void PlatformExposureOffsetRange::set_step(double value_arg) {
+  step_ = value_arg;
+}
+
+EncodableList PlatformExposureOffsetRange::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(3);
+  list.push_back(EncodableValue(min_));
+  list.push_back(EncodableValue(max_));
+  list.push_back(EncodableValue(step_));
+  return list;
+}
+
+PlatformExposureOffsetRange PlatformExposureOffsetRange::FromEncodableList(
+    const EncodableList& list) {
+  PlatformExposureOffsetRange decoded(std::get<double>(list[0]),
+                                      std::get<double>(list[1]),
+                                      std::get<double>(list[2]));
+  return decoded;
+}
+
+CameraApiCodecSerializer::CameraApiCodecSerializer() {}
+
+EncodableValue CameraApiCodecSerializer::ReadValueOfType(
+    uint8_t type, flutter::ByteStreamReader* stream) const {
+  switch (type) {
+    case 128:
+      return CustomEncodableValue(PlatformAudioDevice::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 129:
+      return CustomEncodableValue(PlatformCaptureFormat::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 130:
+      return CustomEncodableValue(
+          PlatformExposureOffsetRange::FromEncodableList(
+              std::get<EncodableList>(ReadValue(stream))));
+    case 131:
+      return CustomEncodableValue(PlatformMediaSettings::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 132:
+      return CustomEncodableValue(PlatformPreviewStats::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 133:
+      return CustomEncodableValue(PlatformRecordingStats::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 134:
+      return CustomEncodableValue(PlatformSize::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 135:
+      return CustomEncodableValue(
+          PlatformVideoRecordingSettings::FromEncodableList(
+              std::get<EncodableList>(ReadValue(stream))));
+    default:
+      return flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
+  }
+}
+
+void CameraApiCodecSerializer::WriteValue(
+    const EncodableValue& value, flutter::ByteStreamWriter* stream) const {
+  if (const CustomEncodableValue* custom_value =
+          std::get_if<CustomEncodableValue>(&value)) {
+    if (custom_value->type() == typeid(PlatformAudioDevice)) {
+      stream->WriteByte(128);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformAudioDevice>(*custom_value)
+                  .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PlatformCaptureFormat)) {
+      stream->WriteByte(129);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformCaptureFormat>(*custom_value)
+                  .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PlatformExposureOffsetRange)) {
+      stream->WriteByte(130);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformExposureOffsetRange>(*custom_value)
+                  .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PlatformMediaSettings)) {
+      stream->WriteByte(131);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformMediaSettings>(*custom_value)
+                  .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PlatformPreviewStats)) {
+      stream->WriteByte(132);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformPreviewStats>(*custom_value)
+                  .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PlatformRecordingStats)) {
+      stream->WriteByte(133);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformRecordingStats>(*custom_value)
+                  .ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PlatformSize)) {
+      stream->WriteByte(134);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformSize>(*custom_value).ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PlatformVideoRecordingSettings)) {
+      stream->WriteByte(135);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<PlatformVideoRecordingSettings>(*custom_value)
+                  .ToEncodableList()),
+          stream);
+      return;
+    }
+  }
+  flutter::StandardCodecSerializer::WriteValue(value, stream);
+}
+
+/// The codec used by CameraApi.
+const flutter::StandardMessageCodec& CameraApi::GetCodec() {
+  return flutter::StandardMessageCodec::GetInstance(
+      &CameraApiCodecSerializer::GetInstance());
+}
+
+// Sets up an instance of `CameraApi` to handle messages through the
+// `binary_messenger`.
+void CameraApi::SetUp(flutter::BinaryMessenger* binary_messenger,
+                      CameraApi* api) {
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.getAvailableCameras",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              api->GetAvailableCameras(
+                  [reply](ErrorOr<EncodableList>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.CameraApi.getAvailableAudioDevices", &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              ErrorOr<EncodableList> output = api->GetAvailableAudioDevices();
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.prewarm", &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_name_arg = args.at(0);
+              if (encodable_camera_name_arg.IsNull()) {
+                reply(WrapError("camera_name_arg unexpectedly null."));
+                return;
+              }
+              const auto& camera_name_arg =
+                  std::get<std::string>(encodable_camera_name_arg);
+              std::optional<FlutterError> output =
+                  api->Prewarm(camera_name_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.create", &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_name_arg = args.at(0);
+              if (encodable_camera_name_arg.IsNull()) {
+                reply(WrapError("camera_name_arg unexpectedly null."));
+                return;
+              }
+              const auto& camera_name_arg =
+                  std::get<std::string>(encodable_camera_name_arg);
+              const auto& encodable_settings_arg = args.at(1);
+              if (encodable_settings_arg.IsNull()) {
+                reply(WrapError("settings_arg unexpectedly null."));
+                return;
+              }
+              const auto& settings_arg =
+                  std::any_cast<const PlatformMediaSettings&>(
+                      std::get<CustomEncodableValue>(encodable_settings_arg));
+              api->Create(
+                  camera_name_arg, settings_arg,
+                  [reply](ErrorOr<int64_t>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.initialize",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              api->Initialize(
+                  camera_id_arg, [reply](ErrorOr<PlatformSize>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        CustomEncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.dispose", &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              std::optional<FlutterError> output = api->Dispose(camera_id_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.takePicture",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              api->TakePicture(
+                  camera_id_arg, [reply](ErrorOr<std::string>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.takePictureData",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_format_arg = args.at(1);
+              if (encodable_format_arg.IsNull()) {
+                reply(WrapError("format_arg unexpectedly null."));
+                return;
+              }
+              const PlatformPictureFormat& format_arg =
+                  (PlatformPictureFormat)encodable_format_arg.LongValue();
+              const auto& encodable_quality_arg = args.at(2);
+              const int64_t quality_arg_value =
+                  encodable_quality_arg.IsNull()
+                      ? 0
+                      : encodable_quality_arg.LongValue();
+              const auto* quality_arg =
+                  encodable_quality_arg.IsNull() ? nullptr : &quality_arg_value;
+              api->TakePictureData(
+                  camera_id_arg, format_arg, quality_arg,
+                  [reply](ErrorOr<std::vector<uint8_t>>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.takePictureBurst",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_photo_count_arg = args.at(1);
+              if (encodable_photo_count_arg.IsNull()) {
+                reply(WrapError("photo_count_arg unexpectedly null."));
+                return;
+              }
+              const int64_t photo_count_arg =
+                  encodable_photo_count_arg.LongValue();
+              api->TakePictureBurst(
+                  camera_id_arg, photo_count_arg,
+                  [reply](ErrorOr<EncodableList>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setPictureRotation",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_degrees_arg = args.at(1);
+              if (encodable_degrees_arg.IsNull()) {
+                reply(WrapError("degrees_arg unexpectedly null."));
+                return;
+              }
+              const int64_t degrees_arg = encodable_degrees_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->SetPictureRotation(camera_id_arg, degrees_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.startVideoRecording",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_max_video_duration_ms_arg = args.at(1);
+              const int64_t max_video_duration_ms_arg_value =
+                  encodable_max_video_duration_ms_arg.IsNull()
+                      ? 0
+                      : encodable_max_video_duration_ms_arg.LongValue();
+              const auto* max_video_duration_ms_arg =
+                  encodable_max_video_duration_ms_arg.IsNull()
+                      ? nullptr
+                      : &max_video_duration_ms_arg_value;
+              const auto& encodable_settings_arg = args.at(2);
+              if (encodable_settings_arg.IsNull()) {
+                reply(WrapError("settings_arg unexpectedly null."));
+                return;
+              }
+              const auto& settings_arg =
+                  std::any_cast<const PlatformVideoRecordingSettings&>(
+                      std::get<CustomEncodableValue>(encodable_settings_arg));
+              api->StartVideoRecording(
+                  camera_id_arg, max_video_duration_ms_arg, settings_arg,
+                  [reply](std::optional<FlutterError>&& output) {
+                    if (output.has_value()) {
+                      reply(WrapError(output.value()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(EncodableValue());
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.stopVideoRecording",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              api->StopVideoRecording(
+                  camera_id_arg, [reply](ErrorOr<std::string>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.pauseVideoRecording",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              api->PauseVideoRecording(
+                  camera_id_arg, [reply](std::optional<FlutterError>&& output) {
+                    if (output.has_value()) {
+                      reply(WrapError(output.value()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(EncodableValue());
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.resumeVideoRecording",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              api->ResumeVideoRecording(
+                  camera_id_arg, [reply](std::optional<FlutterError>&& output) {
+                    if (output.has_value()) {
+                      reply(WrapError(output.value()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(EncodableValue());
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.pausePreview",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              api->PausePreview(
+                  camera_id_arg, [reply](std::optional<FlutterError>&& output) {
+                    if (output.has_value()) {
+                      reply(WrapError(output.value()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(EncodableValue());
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.resumePreview",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              api->ResumePreview(
+                  camera_id_arg, [reply](std::optional<FlutterError>&& output) {
+                    if (output.has_value()) {
+                      reply(WrapError(output.value()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(EncodableValue());
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.startImageStream",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_format_arg = args.at(1);
+              if (encodable_format_arg.IsNull()) {
+                reply(WrapError("format_arg unexpectedly null."));
+                return;
+              }
+              const PlatformImageFormatGroup& format_arg =
+                  (PlatformImageFormatGroup)encodable_format_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->StartImageStream(camera_id_arg, format_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.stopImageStream",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->StopImageStream(camera_id_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.CameraApi.receivedImageStreamData", &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->ReceivedImageStreamData(camera_id_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.getCaptureFormats",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              ErrorOr<EncodableList> output =
+                  api->GetCaptureFormats(camera_id_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.getPreviewStats",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              ErrorOr<PlatformPreviewStats> output =
+                  api->GetPreviewStats(camera_id_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(
+                  CustomEncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.getRecordingStats",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              ErrorOr<PlatformRecordingStats> output =
+                  api->GetRecordingStats(camera_id_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(
+                  CustomEncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setZoomLevel",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_zoom_arg = args.at(1);
+              if (encodable_zoom_arg.IsNull()) {
+                reply(WrapError("zoom_arg unexpectedly null."));
+                return;
+              }
+              const auto& zoom_arg = std::get<double>(encodable_zoom_arg);
+              std::optional<FlutterError> output =
+                  api->SetZoomLevel(camera_id_arg, zoom_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setCropRect",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_left_arg = args.at(1);
+              if (encodable_left_arg.IsNull()) {
+                reply(WrapError("left_arg unexpectedly null."));
+                return;
+              }
+              const auto& left_arg = std::get<double>(encodable_left_arg);
+              const auto& encodable_top_arg = args.at(2);
+              if (encodable_top_arg.IsNull()) {
+                reply(WrapError("top_arg unexpectedly null."));
+                return;
+              }
+              const auto& top_arg = std::get<double>(encodable_top_arg);
+              const auto& encodable_width_arg = args.at(3);
+              if (encodable_width_arg.IsNull()) {
+                reply(WrapError("width_arg unexpectedly null."));
+                return;
+              }
+              const auto& width_arg = std::get<double>(encodable_width_arg);
+              const auto& encodable_height_arg = args.at(4);
+              if (encodable_height_arg.IsNull()) {
+                reply(WrapError("height_arg unexpectedly null."));
+                return;
+              }
+              const auto& height_arg = std::get<double>(encodable_height_arg);
+              std::optional<FlutterError> output = api->SetCropRect(
+                  camera_id_arg, left_arg, top_arg, width_arg, height_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setPreviewRotation",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_degrees_arg = args.at(1);
+              if (encodable_degrees_arg.IsNull()) {
+                reply(WrapError("degrees_arg unexpectedly null."));
+                return;
+              }
+              const int64_t degrees_arg = encodable_degrees_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->SetPreviewRotation(camera_id_arg, degrees_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setPreviewFrameRate",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_frames_per_second_arg = args.at(1);
+              const auto* frames_per_second_arg =
+                  std::get_if<double>(&encodable_frames_per_second_arg);
+              std::optional<FlutterError> output = api->SetPreviewFrameRate(
+                  camera_id_arg, frames_per_second_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setExposureMode",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_locked_arg = args.at(1);
+              if (encodable_locked_arg.IsNull()) {
+                reply(WrapError("locked_arg unexpectedly null."));
+                return;
+              }
+              const auto& locked_arg = std::get<bool>(encodable_locked_arg);
+              std::optional<FlutterError> output =
+                  api->SetExposureMode(camera_id_arg, locked_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setFocusMode",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_locked_arg = args.at(1);
+              if (encodable_locked_arg.IsNull()) {
+                reply(WrapError("locked_arg unexpectedly null."));
+                return;
+              }
+              const auto& locked_arg = std::get<bool>(encodable_locked_arg);
+              std::optional<FlutterError> output =
+                  api->SetFocusMode(camera_id_arg, locked_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setWhiteBalanceMode",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_locked_arg = args.at(1);
+              if (encodable_locked_arg.IsNull()) {
+                reply(WrapError("locked_arg unexpectedly null."));
+                return;
+              }
+              const auto& locked_arg = std::get<bool>(encodable_locked_arg);
+              std::optional<FlutterError> output =
+                  api->SetWhiteBalanceMode(camera_id_arg, locked_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.getExposureOffsetRange",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              ErrorOr<PlatformExposureOffsetRange> output =
+                  api->GetExposureOffsetRange(camera_id_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(
+                  CustomEncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setExposureOffset",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_offset_arg = args.at(1);
+              if (encodable_offset_arg.IsNull()) {
+                reply(WrapError("offset_arg unexpectedly null."));
+                return;
+              }
+              const auto& offset_arg = std::get<double>(encodable_offset_arg);
+              ErrorOr<double> output =
+                  api->SetExposureOffset(camera_id_arg, offset_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setFrameRateLock",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_locked_arg = args.at(1);
+              if (encodable_locked_arg.IsNull()) {
+                reply(WrapError("locked_arg unexpectedly null."));
+                return;
+              }
+              const auto& locked_arg = std::get<bool>(encodable_locked_arg);
+              std::optional<FlutterError> output =
+                  api->SetFrameRateLock(camera_id_arg, locked_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.CameraApi.setFlashMode",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_mode_arg = args.at(1);
+              if (encodable_mode_arg.IsNull()) {
+                reply(WrapError("mode_arg unexpectedly null."));
+                return;
+              }
+              const PlatformFlashMode& mode_arg =
+                  (PlatformFlashMode)encodable_mode_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->SetFlashMode(camera_id_arg, mode_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.CameraApi.setPhotoCapturePriority", &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_camera_id_arg = args.at(0);
+              if (encodable_camera_id_arg.IsNull()) {
+                reply(WrapError("camera_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t camera_id_arg = encodable_camera_id_arg.LongValue();
+              const auto& encodable_priority_arg = args.at(1);
+              if (encodable_priority_arg.IsNull()) {
+                reply(WrapError("priority_arg unexpectedly null."));
+                return;
+              }
+              const PlatformPhotoCapturePriority& priority_arg =
+                  (PlatformPhotoCapturePriority)
+                      encodable_priority_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->SetPhotoCapturePriority(camera_id_arg, priority_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+}
+
+EncodableValue CameraApi::WrapError(std::string_view error_message) {
+  return EncodableValue(
+      EncodableList{EncodableValue(std::string(error_message)),
+                    EncodableValue("Error"), EncodableValue()});
+}
+
+EncodableValue CameraApi::WrapError(const FlutterError& error) {
+  return EncodableValue(EncodableList{EncodableValue(error.code()),
+                                      EncodableValue(error.message()),
+                                      error.details()});
+}
+
+// Generated class from Pigeon that represents Flutter messages that can be
+// called from C++.
+CameraEventApi::CameraEventApi(flutter::BinaryMessenger* binary_messenger) {
+  this->binary_messenger_ = binary_messenger;
+}
+
+const flutter::StandardMessageCodec& CameraEventApi::GetCodec() {
+  return flutter::StandardMessageCodec::GetInstance(
+      &flutter::StandardCodecSerializer::GetInstance());
+}
+
+void CameraEventApi::CameraClosing(
+    int64_t camera_id_arg, std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error) {
+  auto channel = std::make_unique<BasicMessageChannel<>>(
+      binary_messenger_, "dev.flutter.pigeon.CameraEventApi.cameraClosing",
+      &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+      EncodableValue(camera_id_arg),
+  });
+  channel->Send(
+      encoded_api_arguments,
+      [on_success = std::move(on_success), on_error = std::move(on_error)](
+          const uint8_t* reply, size_t reply_size) { on_success(); });
+}
+
+void CameraEventApi::VideoRecorded(
+    int64_t camera_id_arg, const std::string& path_arg,
+    int64_t max_video_duration_ms_arg, std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error) {
+  auto channel = std::make_unique<BasicMessageChannel<>>(
+      binary_messenger_, "dev.flutter.pigeon.CameraEventApi.videoRecorded",
+      &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+      EncodableValue(camera_id_arg),
+      EncodableValue(path_arg),
+      EncodableValue(max_video_duration_ms_arg),
+  });
+  channel->Send(
+      encoded_api_arguments,
+      [on_success = std::move(on_success), on_error = std::move(on_error)](
+          const uint8_t* reply, size_t reply_size) { on_success(); });
+}
+
+void CameraEventApi::Error(
+    int64_t camera_id_arg, const std::string& description_arg,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error) {
+  auto channel = std::make_unique<BasicMessageChannel<>>(
+      binary_messenger_, "dev.flutter.pigeon.CameraEventApi.error",
+      &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+      EncodableValue(camera_id_arg),
+      EncodableValue(description_arg),
+  });
+  channel->Send(
+      encoded_api_arguments,
+      [on_success = std::move(on_success), on_error = std::move(on_error)](
+          const uint8_t* reply, size_t reply_size) { on_success(); });
+}
+
+void CameraEventApi::CamerasChanged(
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error) {
+  auto channel = std::make_unique<BasicMessageChannel<>>(
+      binary_messenger_, "dev.flutter.pigeon.CameraEventApi.camerasChanged",
+      &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue();
+  channel->Send(
+      encoded_api_arguments,
+      [on_success = std::move(on_success), on_error = std::move(on_error)](
+          const uint8_t* reply, size_t reply_size) { on_success(); });
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,660 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+// Autogenerated from Pigeon (v10.1.2), do not edit directly.
+// See also: https://pub.dev/packages/pigeon
+
+#ifndef PIGEON_MESSAGES_G_H_
+#define PIGEON_MESSAGES_G_H_
+#include <flutter/basic_message_channel.h>
+#include <flutter/binary_messenger.h>
+#include <flutter/encodable_value.h>
+#include <flutter/standard_message_codec.h>
+
+#include <map>
+#include <optional>
+#include <string>
+
+namespace camera_windows {
+
+// Generated class from Pigeon.
+
+class FlutterError {
+ public:
+  explicit FlutterError(const std::string& code) : code_(code) {}
+  explicit FlutterError(const std::string& code, const std::string& message)
+      : code_(code), message_(message) {}
+  explicit FlutterError(const std::string& code, const std::string& message,
+                        const flutter::EncodableValue& details)
+      : code_(code), message_(message), details_(details) {}
+
+  const std::string& code() const { return code_; }
+  const std::string& message() const { return message_; }
+  const flutter::EncodableValue& details() const { return details_; }
+
+ private:
+  std::string code_;
+  std::string message_;
+  flutter::EncodableValue details_;
+};
+
+template <class T>
+class ErrorOr {
+ public:
+  ErrorOr(const T& rhs) : v_(rhs) {}
+  ErrorOr(const T&& rhs) : v_(std::move(rhs)) {}
+  ErrorOr(const FlutterError& rhs) : v_(rhs) {}
+  ErrorOr(const FlutterError&& rhs) : v_(std::move(rhs)) {}
+
+  bool has_error() const { return std::holds_alternative<FlutterError>(v_); }
+  const T& value() const { return std::get<T>(v_); };
+  const FlutterError& error() const { return std::get<FlutterError>(v_); };
+
+ private:
+  friend class CameraApi;
+  friend class CameraEventApi;
+  ErrorOr() = default;
+  T TakeValue() && { return std::get<T>(std::move(v_)); }
+
+  std::variant<T, FlutterError> v_;
+};
+
+// Pigeon version of ResolutionPreset.
+enum class PlatformResolutionPreset {
+  low = 0,
+  medium = 1,
+  high = 2,
+  veryHigh = 3,
+  ultraHigh = 4,
+  max = 5
+};
+
+// Pigeon version of WindowsPreviewTextureMode.
+enum class PlatformPreviewTextureMode { pixelBuffer = 0, gpuSurface = 1 };
+
+// Pigeon version of WindowsPreviewPixelFormat.
+enum class PlatformPreviewPixelFormat { rgb32 = 0, nv12 = 1 };
+
+// Pigeon version of WindowsCaptureBackend.
+enum class PlatformCaptureBackend { captureEngine = 0, sourceReader = 1 };
+
+// Pigeon version of the image stream formats, which are NV12 for yuv420
+// and BGRA for every other ImageFormatGroup.
+enum class PlatformImageFormatGroup { bgra8888 = 0, yuv420 = 1 };
+
+// Pigeon version of WindowsVideoCodec.
+enum class PlatformVideoCodec { h264 = 0, hevc = 1 };
+
+// Pigeon version of WindowsVideoRateControlMode.
+enum class PlatformRateControlMode {
+  constantBitrate = 0,
+  variableBitrate = 1,
+  quality = 2
+};
+
+// Pigeon version of WindowsPictureFormat.
+enum class PlatformPictureFormat { jpeg = 0, png = 1 };
+
+// Pigeon version of FlashMode.
+enum class PlatformFlashMode { off = 0, autoFlash = 1, always = 2, torch = 3 };
+
+// Pigeon version of WindowsPhotoCapturePriority.
+enum class PlatformPhotoCapturePriority { balanced = 0, speed = 1 };
+
+// The settings a camera is created with.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformMediaSettings {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  explicit PlatformMediaSettings(
+      bool enable_audio, const PlatformPreviewTextureMode& preview_texture_mode,
+      bool adaptive_preview,
+      const PlatformPreviewPixelFormat& preview_pixel_format,
+      bool zero_shutter_lag, bool preview_stats,
+      const PlatformCaptureBackend& capture_backend);
+
+  // Constructs an object setting all fields.
+  explicit PlatformMediaSettings(
+      const PlatformResolutionPreset* resolution_preset, bool enable_audio,
+      const std::string* audio_device_id,
+      const PlatformPreviewTextureMode& preview_texture_mode,
+      bool adaptive_preview, const int64_t* target_frame_rate,
+      const PlatformPreviewPixelFormat& preview_pixel_format,
+      bool zero_shutter_lag, bool preview_stats,
+      const int64_t* preview_max_frame_rate,
+      const PlatformCaptureBackend& capture_backend);
+
+  // The resolution to capture at, or null for the highest resolution.
+  const PlatformResolutionPreset* resolution_preset() const;
+  void set_resolution_preset(const PlatformResolutionPreset* value_arg);
+  void set_resolution_preset(const PlatformResolutionPreset& value_arg);
+
+  bool enable_audio() const;
+  void set_enable_audio(bool value_arg);
+
+  const std::string* audio_device_id() const;
+  void set_audio_device_id(const std::string_view* value_arg);
+  void set_audio_device_id(std::string_view value_arg);
+
+  const PlatformPreviewTextureMode& preview_texture_mode() const;
+  void set_preview_texture_mode(const PlatformPreviewTextureMode& value_arg);
+
+  bool adaptive_preview() const;
+  void set_adaptive_preview(bool value_arg);
+
+  const int64_t* target_frame_rate() const;
+  void set_target_frame_rate(const int64_t* value_arg);
+  void set_target_frame_rate(int64_t value_arg);
+
+  const PlatformPreviewPixelFormat& preview_pixel_format() const;
+  void set_preview_pixel_format(const PlatformPreviewPixelFormat& value_arg);
+
+  bool zero_shutter_lag() const;
+  void set_zero_shutter_lag(bool value_arg);
+
+  bool preview_stats() const;
+  void set_preview_stats(bool value_arg);
+
+  const int64_t* preview_max_frame_rate() const;
+  void set_preview_max_frame_rate(const int64_t* value_arg);
+  void set_preview_max_frame_rate(int64_t value_arg);
+
+  const PlatformCaptureBackend& capture_backend() const;
+  void set_capture_backend(const PlatformCaptureBackend& value_arg);
+
+ private:
+  static PlatformMediaSettings FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  std::optional<PlatformResolutionPreset> resolution_preset_;
+  bool enable_audio_;
+  std::optional<std::string> audio_device_id_;
+  PlatformPreviewTextureMode preview_texture_mode_;
+  bool adaptive_preview_;
+  std::optional<int64_t> target_frame_rate_;
+  PlatformPreviewPixelFormat preview_pixel_format_;
+  bool zero_shutter_lag_;
+  bool preview_stats_;
+  std::optional<int64_t> preview_max_frame_rate_;
+  PlatformCaptureBackend capture_backend_;
+};
+
+// The encoder settings a video is recorded with.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformVideoRecordingSettings {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  explicit PlatformVideoRecordingSettings(const PlatformVideoCodec& video_codec,
+                                          bool prefer_hardware_encoder,
+                                          bool stream_chunks);
+
+  // Constructs an object setting all fields.
+  explicit PlatformVideoRecordingSettings(
+      const PlatformVideoCodec& video_codec, bool prefer_hardware_encoder,
+      const int64_t* bitrate, const PlatformRateControlMode* rate_control_mode,
+      const int64_t* quality, const int64_t* keyframe_interval,
+      bool stream_chunks, const int64_t* audio_sample_rate,
+      const int64_t* audio_channels, const int64_t* audio_bitrate,
+      const int64_t* proxy_height, const int64_t* proxy_bitrate);
+
+  const PlatformVideoCodec& video_codec() const;
+  void set_video_codec(const PlatformVideoCodec& value_arg);
+
+  bool prefer_hardware_encoder() const;
+  void set_prefer_hardware_encoder(bool value_arg);
+
+  const int64_t* bitrate() const;
+  void set_bitrate(const int64_t* value_arg);
+  void set_bitrate(int64_t value_arg);
+
+  const PlatformRateControlMode* rate_control_mode() const;
+  void set_rate_control_mode(const PlatformRateControlMode* value_arg);
+  void set_rate_control_mode(const PlatformRateControlMode& value_arg);
+
+  const int64_t* quality() const;
+  void set_quality(const int64_t* value_arg);
+  void set_quality(int64_t value_arg);
+
+  const int64_t* keyframe_interval() const;
+  void set_keyframe_interval(const int64_t* value_arg);
+  void set_keyframe_interval(int64_t value_arg);
+
+  bool stream_chunks() const;
+  void set_stream_chunks(bool value_arg);
+
+  const int64_t* audio_sample_rate() const;
+  void set_audio_sample_rate(const int64_t* value_arg);
+  void set_audio_sample_rate(int64_t value_arg);
+
+  const int64_t* audio_channels() const;
+  void set_audio_channels(const int64_t* value_arg);
+  void set_audio_channels(int64_t value_arg);
+
+  const int64_t* audio_bitrate() const;
+  void set_audio_bitrate(const int64_t* value_arg);
+  void set_audio_bitrate(int64_t value_arg);
+
+  const int64_t* proxy_height() const;
+  void set_proxy_height(const int64_t* value_arg);
+  void set_proxy_height(int64_t value_arg);
+
+  const int64_t* proxy_bitrate() const;
+  void set_proxy_bitrate(const int64_t* value_arg);
+  void set_proxy_bitrate(int64_t value_arg);
+
+ private:
+  static PlatformVideoRecordingSettings FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  PlatformVideoCodec video_codec_;
+  bool prefer_hardware_encoder_;
+  std::optional<int64_t> bitrate_;
+  std::optional<PlatformRateControlMode> rate_control_mode_;
+  std::optional<int64_t> quality_;
+  std::optional<int64_t> keyframe_interval_;
+  bool stream_chunks_;
+  std::optional<int64_t> audio_sample_rate_;
+  std::optional<int64_t> audio_channels_;
+  std::optional<int64_t> audio_bitrate_;
+  std::optional<int64_t> proxy_height_;
+  std::optional<int64_t> proxy_bitrate_;
+};
+
+// A size of the camera preview, in pixels.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformSize {
+ public:
+  // Constructs an object setting all fields.
+  explicit PlatformSize(double width, double height);
+
+  double width() const;
+  void set_width(double value_arg);
+
+  double height() const;
+  void set_height(double value_arg);
+
+ private:
+  static PlatformSize FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  double width_;
+  double height_;
+};
+
+// Pigeon version of WindowsAudioDevice.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformAudioDevice {
+ public:
+  // Constructs an object setting all fields.
+  explicit PlatformAudioDevice(const std::string& name, const std::string& id);
+
+  const std::string& name() const;
+  void set_name(std::string_view value_arg);
+
+  const std::string& id() const;
+  void set_id(std::string_view value_arg);
+
+ private:
+  static PlatformAudioDevice FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  std::string name_;
+  std::string id_;
+};
+
+// Pigeon version of WindowsCaptureFormat.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformCaptureFormat {
+ public:
+  // Constructs an object setting all fields.
+  explicit PlatformCaptureFormat(int64_t width, int64_t height,
+                                 double frame_rate);
+
+  int64_t width() const;
+  void set_width(int64_t value_arg);
+
+  int64_t height() const;
+  void set_height(int64_t value_arg);
+
+  double frame_rate() const;
+  void set_frame_rate(double value_arg);
+
+ private:
+  static PlatformCaptureFormat FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  int64_t width_;
+  int64_t height_;
+  double frame_rate_;
+};
+
+// Pigeon version of WindowsPreviewStats, with durations in microseconds.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformPreviewStats {
+ public:
+  // Constructs an object setting all fields.
+  explicit PlatformPreviewStats(
+      int64_t received_frames, int64_t rendered_frames, int64_t dropped_frames,
+      double capture_frame_rate, double render_frame_rate, int64_t latency_p50,
+      int64_t latency_p95, int64_t latency_p99, int64_t conversion_time_p50,
+      int64_t conversion_time_p95, int64_t conversion_time_p99);
+
+  int64_t received_frames() const;
+  void set_received_frames(int64_t value_arg);
+
+  int64_t rendered_frames() const;
+  void set_rendered_frames(int64_t value_arg);
+
+  int64_t dropped_frames() const;
+  void set_dropped_frames(int64_t value_arg);
+
+  double capture_frame_rate() const;
+  void set_capture_frame_rate(double value_arg);
+
+  double render_frame_rate() const;
+  void set_render_frame_rate(double value_arg);
+
+  int64_t latency_p50() const;
+  void set_latency_p50(int64_t value_arg);
+
+  int64_t latency_p95() const;
+  void set_latency_p95(int64_t value_arg);
+
+  int64_t latency_p99() const;
+  void set_latency_p99(int64_t value_arg);
+
+  int64_t conversion_time_p50() const;
+  void set_conversion_time_p50(int64_t value_arg);
+
+  int64_t conversion_time_p95() const;
+  void set_conversion_time_p95(int64_t value_arg);
+
+  int64_t conversion_time_p99() const;
+  void set_conversion_time_p99(int64_t value_arg);
+
+ private:
+  static PlatformPreviewStats FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  int64_t received_frames_;
+  int64_t rendered_frames_;
+  int64_t dropped_frames_;
+  double capture_frame_rate_;
+  double render_frame_rate_;
+  int64_t latency_p50_;
+  int64_t latency_p95_;
+  int64_t latency_p99_;
+  int64_t conversion_time_p50_;
+  int64_t conversion_time_p95_;
+  int64_t conversion_time_p99_;
+};
+
+// Pigeon version of WindowsRecordingStats, with durations in microseconds.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformRecordingStats {
+ public:
+  // Constructs an object setting all fields.
+  explicit PlatformRecordingStats(int64_t encoded_frames,
+                                  int64_t dropped_frames, int64_t duration,
+                                  int64_t av_drift);
+
+  int64_t encoded_frames() const;
+  void set_encoded_frames(int64_t value_arg);
+
+  int64_t dropped_frames() const;
+  void set_dropped_frames(int64_t value_arg);
+
+  int64_t duration() const;
+  void set_duration(int64_t value_arg);
+
+  int64_t av_drift() const;
+  void set_av_drift(int64_t value_arg);
+
+ private:
+  static PlatformRecordingStats FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  int64_t encoded_frames_;
+  int64_t dropped_frames_;
+  int64_t duration_;
+  int64_t av_drift_;
+};
+
+// The exposure offsets supported by a camera.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PlatformExposureOffsetRange {
+ public:
+  // Constructs an object setting all fields.
+  explicit PlatformExposureOffsetRange(double min, double max, double step);
+
+  double min() const;
+  void set_min(double value_arg);
+
+  double max() const;
+  void set_max(double value_arg);
+
+  double step() const;
+  void set_step(double value_arg);
+
+ private:
+  static PlatformExposureOffsetRange FromEncodableList(
+      const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class CameraApi;
+  friend class CameraApiCodecSerializer;
+  friend class CameraEventApi;
+  friend class CameraEventApiCodecSerializer;
+  double min_;
+  double max_;
+  double step_;
+};
+
+class CameraApiCodecSerializer : public flutter::StandardCodecSerializer {
+ public:
+  CameraApiCodecSerializer();
+  inline static CameraApiCodecSerializer& GetInstance() {
+    static CameraApiCodecSerializer sInstance;
+    return sInstance;
+  }
+
+  void WriteValue(const flutter::EncodableValue& value,
+                  flutter::ByteStreamWriter* stream) const override;
+
+ protected:
+  flutter::EncodableValue ReadValueOfType(
+      uint8_t type, flutter::ByteStreamReader* stream) const override;
+};
+
+// Calls from Dart to the native cameras.
+//
+// Cameras are keyed by the [cameraId] returned by [create].
+//
+// Generated interface from Pigeon that represents a handler of messages from
+// Flutter.
+class CameraApi {
+ public:
+  CameraApi(const CameraApi&) = delete;
+  CameraApi& operator=(const CameraApi&) = delete;
+  virtual ~CameraApi() {}
+  // Returns the names of the available cameras.
+  virtual void GetAvailableCameras(
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Returns the audio capture devices of the system.
+  virtual ErrorOr<flutter::EncodableList> GetAvailableAudioDevices() = 0;
+  // Opens the camera [cameraName] in the background, ahead of [create].
+  virtual std::optional<FlutterError> Prewarm(
+      const std::string& camera_name) = 0;
+  // Creates a camera with the given [settings], and returns its id.
+  virtual void Create(const std::string& camera_name,
+                      const PlatformMediaSettings& settings,
+                      std::function<void(ErrorOr<int64_t> reply)> result) = 0;
+  // Starts the preview of the camera, and returns the preview size.
+  virtual void Initialize(
+      int64_t camera_id,
+      std::function<void(ErrorOr<PlatformSize> reply)> result) = 0;
+  // Disposes the camera, if it exists.
+  virtual std::optional<FlutterError> Dispose(int64_t camera_id) = 0;
+  // Takes a picture, and returns the path of the picture file.
+  virtual void TakePicture(
+      int64_t camera_id,
+      std::function<void(ErrorOr<std::string> reply)> result) = 0;
+  // Takes a picture, and returns it encoded in memory.
+  virtual void TakePictureData(
+      int64_t camera_id, const PlatformPictureFormat& format,
+      const int64_t* quality,
+      std::function<void(ErrorOr<std::vector<uint8_t>> reply)> result) = 0;
+  // Takes [photoCount] pictures in a row, and returns their paths.
+  virtual void TakePictureBurst(
+      int64_t camera_id, int64_t photo_count,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Sets the clockwise rotation of the pictures taken after this call.
+  virtual std::optional<FlutterError> SetPictureRotation(int64_t camera_id,
+                                                         int64_t degrees) = 0;
+  // Starts recording a video, for at most [maxVideoDurationMs] if it is not
+  // null.
+  virtual void StartVideoRecording(
+      int64_t camera_id, const int64_t* max_video_duration_ms,
+      const PlatformVideoRecordingSettings& settings,
+      std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  // Stops recording a video, and returns the path of the video file.
+  virtual void StopVideoRecording(
+      int64_t camera_id,
+      std::function<void(ErrorOr<std::string> reply)> result) = 0;
+  virtual void PauseVideoRecording(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void ResumeVideoRecording(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void PausePreview(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  virtual void ResumePreview(
+      int64_t camera_id,
+      std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  // Starts sending frames in [format] on the image stream event channel.
+  virtual std::optional<FlutterError> StartImageStream(
+      int64_t camera_id, const PlatformImageFormatGroup& format) = 0;
+  virtual std::optional<FlutterError> StopImageStream(int64_t camera_id) = 0;
+  // Acknowledges an image stream frame, so that the next one can be sent.
+  virtual std::optional<FlutterError> ReceivedImageStreamData(
+      int64_t camera_id) = 0;
+  virtual ErrorOr<flutter::EncodableList> GetCaptureFormats(
+      int64_t camera_id) = 0;
+  virtual ErrorOr<PlatformPreviewStats> GetPreviewStats(int64_t camera_id) = 0;
+  virtual ErrorOr<PlatformRecordingStats> GetRecordingStats(
+      int64_t camera_id) = 0;
+  virtual std::optional<FlutterError> SetZoomLevel(int64_t camera_id,
+                                                   double zoom) = 0;
+  // Sets the region of the preview shown in the texture, in fractions of the
+  // preview size.
+  virtual std::optional<FlutterError> SetCropRect(
+      int64_t camera_id, double left, double top, double width,
+      double height) = 0;
+  // Rotates the preview clockwise by [degrees].
+  virtual std::optional<FlutterError> SetPreviewRotation(int64_t camera_id,
+                                                         int64_t degrees) = 0;
+  // Limits the preview texture updates to [framesPerSecond], or removes the
+  // limit if it is null.
+  virtual std::optional<FlutterError> SetPreviewFrameRate(
+      int64_t camera_id, const double* frames_per_second) = 0;
+  virtual std::optional<FlutterError> SetExposureMode(int64_t camera_id,
+                                                      bool locked) = 0;
+  virtual std::optional<FlutterError> SetFocusMode(int64_t camera_id,
+                                                   bool locked) = 0;
+  virtual std::optional<FlutterError> SetWhiteBalanceMode(int64_t camera_id,
+                                                          bool locked) = 0;
+  virtual ErrorOr<PlatformExposureOffsetRange> GetExposureOffsetRange(
+      int64_t camera_id) = 0;
+  // Sets the exposure offset, and returns the offset applied after rounding
+  // it to the closest supported step.
+  virtual ErrorOr<double> SetExposureOffset(int64_t camera_id,
+                                            double offset) = 0;
+  virtual std::optional<FlutterError> SetFrameRateLock(int64_t camera_id,
+                                                       bool locked) = 0;
+  virtual std::optional<FlutterError> SetFlashMode(
+      int64_t camera_id, const PlatformFlashMode& mode) = 0;
+  virtual std::optional<FlutterError> SetPhotoCapturePriority(
+      int64_t camera_id, const PlatformPhotoCapturePriority& priority) = 0;
+
+  // The codec used by CameraApi.
+  static const flutter::StandardMessageCodec& GetCodec();
+  // Sets up an instance of `CameraApi` to handle messages through the
+  // `binary_messenger`.
+  static void SetUp(flutter::BinaryMessenger* binary_messenger,
+                    CameraApi* api);
+  static flutter::EncodableValue WrapError(std::string_view error_message);
+  static flutter::EncodableValue WrapError(const FlutterError& error);
+
+ protected:
+  CameraApi() = default;
+};
+// Events sent by the native cameras to Dart.
+//
+// The events of all cameras share the same channels, and are keyed by the
+// [cameraId] given on creation.
+//
+// Generated class from Pigeon that represents Flutter messages that can be
+// called from C++.
+class CameraEventApi {
+ public:
+  CameraEventApi(flutter::BinaryMessenger* binary_messenger);
+  static const flutter::StandardMessageCodec& GetCodec();
+  // Called when the camera [cameraId] is about to be closed.
+  void CameraClosing(int64_t camera_id, std::function<void(void)>&& on_success,
+                     std::function<void(const FlutterError&)>&& on_error);
+  // Called when the recording of the camera [cameraId] stopped because it
+  // reached [maxVideoDurationMs], with the recorded file at [path].
+  void VideoRecorded(int64_t camera_id, const std::string& path,
+                     int64_t max_video_duration_ms,
+                     std::function<void(void)>&& on_success,
+                     std::function<void(const FlutterError&)>&& on_error);
+  // Called when the camera [cameraId] fails with [description].
+  void Error(int64_t camera_id, const std::string& description,
+             std::function<void(void)>&& on_success,
+             std::function<void(const FlutterError&)>&& on_error);
+  // Called when a camera is connected to or disconnected from the system.
+  void CamerasChanged(std::function<void(void)>&& on_success,
+                      std::function<void(const FlutterError&)>&& on_error);
+
+ private:
+  flutter::BinaryMessenger* binary_messenger_;
+};
+
+}  // namespace camera_windows
+#endif  // PIGEON_MESSAGES_G_H_
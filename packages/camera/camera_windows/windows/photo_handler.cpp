@@ -9,13 +9,428 @@
 #include <wincodec.h>
 
 #include <cassert>
+#include <fstream>
 
 #include "capture_engine_listener.h"
+#include "jpeg_orientation.h"
+#include "pixel_conversion.h"
 #include "string_utils.h"
 
 namespace camera_windows {
 
 using Microsoft::WRL::ComPtr;
+using windows_plugin_utils::Utf16FromUtf8;
+
+// JPEG quality used if none is requested, in range 1 to 100.
+constexpr uint32_t kDefaultJpegQuality = 90;
+
+// Metadata query of the EXIF orientation of a JPEG image.
+constexpr wchar_t kExifOrientationQuery[] = L"/app1/ifd/{ushort=274}";
+
+// Writes |length| bytes of |data| to a new file at |file_path|.
+HRESULT WritePhotoFile(const std::string& file_path, const uint8_t* data,
+                       size_t length) {
+  std::ofstream file(Utf16FromUtf8(file_path).c_str(),
+                     std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return E_ACCESSDENIED;
+  }
+  file.write(reinterpret_cast<const char*>(data),
+             static_cast<std::streamsize>(length));
+  file.close();
+  return file ? S_OK : E_FAIL;
+}
+
+// Returns the WIC container format of |format|.
+const GUID& GetContainerFormat(PhotoFormat format) {
+  return format == PhotoFormat::kPng ? GUID_ContainerFormatPng
+                                     : GUID_ContainerFormatJpeg;
+}
+
+// Returns the EXIF orientation of a photo that is displayed rotated by
+// |rotation|.
+uint16_t GetExifOrientation(PhotoRotation rotation) {
+  switch (rotation) {
+    case PhotoRotation::kRotate90:
+      return kExifOrientationRotate90;
+    case PhotoRotation::kRotate180:
+      return kExifOrientationRotate180;
+    case PhotoRotation::kRotate270:
+      return kExifOrientationRotate270;
+    case PhotoRotation::kNone:
+      break;
+  }
+  return kExifOrientationNormal;
+}
+
+// Returns the WIC transform that rotates pixels by |rotation|.
+WICBitmapTransformOptions GetBitmapTransform(PhotoRotation rotation) {
+  switch (rotation) {
+    case PhotoRotation::kRotate90:
+      return WICBitmapTransformRotate90;
+    case PhotoRotation::kRotate180:
+      return WICBitmapTransformRotate180;
+    case PhotoRotation::kRotate270:
+      return WICBitmapTransformRotate270;
+    case PhotoRotation::kNone:
+      break;
+  }
+  return WICBitmapTransformRotate0;
+}
+
+HRESULT CreateImagingFactory(IWICImagingFactory** factory) {
+  return CoCreateInstance(CLSID_WICImagingFactory, nullptr,
+                          CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory));
+}
+
+// Sets the EXIF orientation of the JPEG photo in |jpeg| for |rotation|. Only
+// the metadata is changed, so the photo is not decoded or re-encoded.
+HRESULT SetPhotoOrientation(PhotoRotation rotation,
+                            std::vector<uint8_t>* jpeg) {
+  assert(jpeg);
+
+  const uint16_t orientation = GetExifOrientation(rotation);
+  if (SetJpegExifOrientation(orientation, jpeg)) {
+    return S_OK;
+  }
+
+  // Falls back to WIC to add the tag to existing EXIF data. The metadata is
+  // updated in place, which fails if it has no padding to grow into.
+  ComPtr<IWICImagingFactory> factory;
+  HRESULT hr = CreateImagingFactory(&factory);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICStream> stream;
+  hr = factory->CreateStream(&stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = stream->InitializeFromMemory(jpeg->data(),
+                                    static_cast<DWORD>(jpeg->size()));
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmapDecoder> decoder;
+  hr = factory->CreateDecoderFromStream(
+      stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, &decoder);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmapFrameDecode> frame;
+  hr = decoder->GetFrame(0, &frame);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICFastMetadataEncoder> encoder;
+  hr = factory->CreateFastMetadataEncoderFromFrameDecode(frame.Get(),
+                                                         &encoder);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICMetadataQueryWriter> writer;
+  hr = encoder->GetMetadataQueryWriter(&writer);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  PROPVARIANT value;
+  PropVariantInit(&value);
+  value.vt = VT_UI2;
+  value.uiVal = orientation;
+  hr = writer->SetMetadataByName(kExifOrientationQuery, &value);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return encoder->Commit();
+}
+
+// Reads the photo file at |file_path| into |data|.
+HRESULT ReadPhotoFile(const std::string& file_path,
+                      std::vector<uint8_t>* data) {
+  assert(data);
+
+  std::ifstream file(Utf16FromUtf8(file_path).c_str(),
+                     std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file) {
+    return E_ACCESSDENIED;
+  }
+  const std::streamsize length = file.tellg();
+  if (length <= 0) {
+    return E_FAIL;
+  }
+  data->resize(static_cast<size_t>(length));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(data->data()), length);
+  return file ? S_OK : E_FAIL;
+}
+
+// Encodes |source| to |stream| with the encoder of |settings|.
+HRESULT EncodeImage(IWICImagingFactory* factory, IWICBitmapSource* source,
+                    const PhotoSettings& settings, IStream* stream) {
+  assert(factory);
+  assert(source);
+  assert(stream);
+
+  HRESULT hr = S_OK;
+
+  // Rotates the pixels as they are read by the encoder, so the photo is
+  // still encoded once.
+  ComPtr<IWICBitmapFlipRotator> rotator;
+  if (settings.rotation != PhotoRotation::kNone) {
+    hr = factory->CreateBitmapFlipRotator(&rotator);
+    if (FAILED(hr)) {
+      return hr;
+    }
+
+    hr = rotator->Initialize(source, GetBitmapTransform(settings.rotation));
+    if (FAILED(hr)) {
+      return hr;
+    }
+    source = rotator.Get();
+  }
+
+  // Drops the alpha channel, which is undefined for camera frames.
+  ComPtr<IWICFormatConverter> converter;
+  hr = factory->CreateFormatConverter(&converter);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = converter->Initialize(source, GUID_WICPixelFormat24bppBGR,
+                             WICBitmapDitherTypeNone, nullptr, 0.0,
+                             WICBitmapPaletteTypeCustom);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmapEncoder> encoder;
+  hr = factory->CreateEncoder(GetContainerFormat(settings.format), nullptr,
+                              &encoder);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = encoder->Initialize(stream, WICBitmapEncoderNoCache);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmapFrameEncode> frame;
+  ComPtr<IPropertyBag2> options;
+  hr = encoder->CreateNewFrame(&frame, &options);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  if (settings.format == PhotoFormat::kJpeg) {
+    const uint32_t quality =
+        settings.quality > 0 ? settings.quality : kDefaultJpegQuality;
+    PROPBAG2 quality_option = {};
+    quality_option.pstrName = const_cast<LPOLESTR>(L"ImageQuality");
+    VARIANT quality_value;
+    VariantInit(&quality_value);
+    quality_value.vt = VT_R4;
+    quality_value.fltVal = static_cast<float>(quality) / 100.f;
+    hr = options->Write(1, &quality_option, &quality_value);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  hr = frame->Initialize(options.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  UINT width, height;
+  hr = converter->GetSize(&width, &height);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = frame->SetSize(width, height);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = frame->WriteSource(converter.Get(), nullptr);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = frame->Commit();
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return encoder->Commit();
+}
+
+// Encodes |source| into |data| with the encoder of |settings|.
+HRESULT EncodeImageToMemory(IWICImagingFactory* factory,
+                            IWICBitmapSource* source,
+                            const PhotoSettings& settings,
+                            std::vector<uint8_t>* data) {
+  assert(data);
+
+  ComPtr<IStream> stream;
+  HRESULT hr = CreateStreamOnHGlobal(nullptr, TRUE, &stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = EncodeImage(factory, source, settings, stream.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  STATSTG stat;
+  hr = stream->Stat(&stat, STATFLAG_NONAME);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  LARGE_INTEGER start = {};
+  hr = stream->Seek(start, STREAM_SEEK_SET, nullptr);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  const ULONG size = static_cast<ULONG>(stat.cbSize.QuadPart);
+  data->resize(size);
+  ULONG read = 0;
+  hr = stream->Read(data->data(), size, &read);
+  if (SUCCEEDED(hr) && read != size) {
+    hr = E_FAIL;
+  }
+  return hr;
+}
+
+// Creates a bitmap from a buffered preview frame.
+HRESULT CreateBitmapFromFrame(IWICImagingFactory* factory,
+                              const BufferedFrame& frame,
+                              IWICBitmap** bitmap) {
+  if (frame.width == 0 || frame.height == 0) {
+    return E_INVALIDARG;
+  }
+
+  const UINT stride = frame.width * 4;
+  if (frame.format == PreviewPixelFormat::kRGB32) {
+    return factory->CreateBitmapFromMemory(
+        frame.width, frame.height, GUID_WICPixelFormat32bppBGR, stride,
+        stride * frame.height, const_cast<BYTE*>(frame.bytes.data()), bitmap);
+  }
+
+  const int32_t nv12_stride =
+      static_cast<int32_t>(GetNV12UVPlaneRowSize(frame.width));
+  const uint8_t* uv_plane =
+      frame.bytes.data() + static_cast<size_t>(nv12_stride) * frame.height;
+  std::vector<uint8_t> pixels(static_cast<size_t>(stride) * frame.height);
+  ConvertNV12ToBGRA(frame.bytes.data(), nv12_stride, uv_plane, nv12_stride,
+                    pixels.data(), frame.width, frame.height);
+
+  // The pixels are copied to the bitmap.
+  return factory->CreateBitmapFromMemory(
+      frame.width, frame.height, GUID_WICPixelFormat32bppBGR, stride,
+      stride * frame.height, pixels.data(), bitmap);
+}
+
+// Decodes the image in |data| and encodes it into |encoded_data| with the
+// encoder of |settings|.
+HRESULT TranscodeImage(const uint8_t* data, DWORD length,
+                       const PhotoSettings& settings,
+                       std::vector<uint8_t>* encoded_data) {
+  ComPtr<IWICImagingFactory> factory;
+  HRESULT hr = CreateImagingFactory(&factory);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICStream> stream;
+  hr = factory->CreateStream(&stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = stream->InitializeFromMemory(const_cast<BYTE*>(data), length);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmapDecoder> decoder;
+  hr = factory->CreateDecoderFromStream(
+      stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, &decoder);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmapFrameDecode> frame;
+  hr = decoder->GetFrame(0, &frame);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return EncodeImageToMemory(factory.Get(), frame.Get(), settings,
+                             encoded_data);
+}
+
+void PhotoSampleListener::Detach() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  handler_ = nullptr;
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG) PhotoSampleListener::AddRef() {
+  return InterlockedIncrement(&ref_);
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG)
+PhotoSampleListener::Release() {
+  LONG ref = InterlockedDecrement(&ref_);
+  if (ref == 0) {
+    delete this;
+  }
+  return ref;
+}
+
+// IUnknown
+STDMETHODIMP_(HRESULT)
+PhotoSampleListener::QueryInterface(const IID& riid, void** ppv) {
+  *ppv = nullptr;
+
+  if (riid == IID_IMFCaptureEngineOnSampleCallback ||
+      riid == IID_IUnknown) {
+    *ppv = static_cast<IMFCaptureEngineOnSampleCallback*>(this);
+    ((IUnknown*)*ppv)->AddRef();
+    return S_OK;
+  }
+
+  return E_NOINTERFACE;
+}
+
+// IMFCaptureEngineOnSampleCallback
+HRESULT PhotoSampleListener::OnSample(IMFSample* sample) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (handler_ && sample) {
+    handler_->OnPhotoSample(sample);
+  }
+  return S_OK;
+}
+
+PhotoHandler::~PhotoHandler() {
+  if (photo_sample_listener_) {
+    photo_sample_listener_->Detach();
+  }
+}
 
 // Initializes media type for photo capture for jpeg images.
 HRESULT BuildMediaTypeForPhotoCapture(IMFMediaType* src_media_type,
@@ -50,37 +465,33 @@ HRESULT BuildMediaTypeForPhotoCapture(IMFMediaType* src_media_type,
 }
 
 HRESULT PhotoHandler::InitPhotoSink(IMFCaptureEngine* capture_engine,
-                                    IMFMediaType* base_media_type) {
+                                    IMFMediaType* base_media_type,
+                                    const GUID& image_format) {
   assert(capture_engine);
   assert(base_media_type);
 
   HRESULT hr = S_OK;
 
-  if (photo_sink_) {
-    // If photo sink already exists, only update output filename.
-    hr = photo_sink_->SetOutputFileName(Utf16FromUtf8(file_path_).c_str());
-
-    if (FAILED(hr)) {
-      photo_sink_ = nullptr;
-    }
-
+  if (photo_sink_ && photo_sink_format_ == image_format) {
+    // If photo sink already exists, only the output is updated by the caller.
     return hr;
   }
 
-  ComPtr<IMFMediaType> photo_media_type;
-  ComPtr<IMFCaptureSink> capture_sink;
+  if (!photo_sink_) {
+    ComPtr<IMFCaptureSink> capture_sink;
 
-  // Get sink with photo type.
-  hr =
-      capture_engine->GetSink(MF_CAPTURE_ENGINE_SINK_TYPE_PHOTO, &capture_sink);
-  if (FAILED(hr)) {
-    return hr;
-  }
+    // Get sink with photo type.
+    hr = capture_engine->GetSink(MF_CAPTURE_ENGINE_SINK_TYPE_PHOTO,
+                                 &capture_sink);
+    if (FAILED(hr)) {
+      return hr;
+    }
 
-  hr = capture_sink.As(&photo_sink_);
-  if (FAILED(hr)) {
-    photo_sink_ = nullptr;
-    return hr;
+    hr = capture_sink.As(&photo_sink_);
+    if (FAILED(hr)) {
+      photo_sink_ = nullptr;
+      return hr;
+    }
   }
 
   hr = photo_sink_->RemoveAllStreams();
@@ -89,9 +500,9 @@ HRESULT PhotoHandler::InitPhotoSink(IMFCaptureEngine* capture_engine,
     return hr;
   }
 
-  hr = BuildMediaTypeForPhotoCapture(base_media_type,
-                                     photo_media_type.GetAddressOf(),
-                                     GUID_ContainerFormatJpeg);
+  ComPtr<IMFMediaType> photo_media_type;
+  hr = BuildMediaTypeForPhotoCapture(
+      base_media_type, photo_media_type.GetAddressOf(), image_format);
 
   if (FAILED(hr)) {
     photo_sink_ = nullptr;
@@ -107,16 +518,25 @@ HRESULT PhotoHandler::InitPhotoSink(IMFCaptureEngine* capture_engine,
     return hr;
   }
 
-  hr = photo_sink_->SetOutputFileName(Utf16FromUtf8(file_path_).c_str());
+  photo_sink_format_ = image_format;
+  return hr;
+}
+
+HRESULT PhotoHandler::SetSampleCallbackOutput() {
+  if (!photo_sample_listener_) {
+    photo_sample_listener_ = new PhotoSampleListener(this);
+  }
+
+  // Replaces the output file of a previous photo, if any.
+  HRESULT hr = photo_sink_->SetSampleCallback(photo_sample_listener_.Get());
   if (FAILED(hr)) {
     photo_sink_ = nullptr;
-    return hr;
   }
-
   return hr;
 }
 
 HRESULT PhotoHandler::TakePhoto(const std::string& file_path,
+                                PhotoRotation rotation,
                                 IMFCaptureEngine* capture_engine,
                                 IMFMediaType* base_media_type) {
   assert(!file_path.empty());
@@ -125,19 +545,269 @@ HRESULT PhotoHandler::TakePhoto(const std::string& file_path,
 
   file_path_ = file_path;
 
-  HRESULT hr = InitPhotoSink(capture_engine, base_media_type);
+  HRESULT hr = InitPhotoSink(capture_engine, base_media_type,
+                             GUID_ContainerFormatJpeg);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Replaces the sample callback of a previous photo, if any.
+  hr = photo_sink_->SetOutputFileName(Utf16FromUtf8(file_path_).c_str());
+  if (FAILED(hr)) {
+    photo_sink_ = nullptr;
+    return hr;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    photo_output_ = PhotoOutput::kFile;
+    rotation_ = rotation;
+  }
+  photo_state_ = PhotoState::kTakingPhoto;
+
+  return capture_engine->TakePhoto();
+}
+
+HRESULT PhotoHandler::TakePhotoBurst(const std::vector<std::string>& file_paths,
+                                     PhotoRotation rotation,
+                                     IMFCaptureEngine* capture_engine,
+                                     IMFMediaType* base_media_type) {
+  assert(!file_paths.empty());
+  assert(capture_engine);
+  assert(base_media_type);
+
+  HRESULT hr = InitPhotoSink(capture_engine, base_media_type,
+                             GUID_ContainerFormatJpeg);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = SetSampleCallbackOutput();
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    photo_output_ = PhotoOutput::kBurst;
+    rotation_ = rotation;
+    burst_paths_ = file_paths;
+    burst_photos_taken_ = 0;
+    burst_photos_written_ = 0;
+    burst_write_failed_ = false;
+  }
+  file_path_ = file_paths.front();
+  photo_state_ = PhotoState::kTakingPhoto;
+
+  return capture_engine->TakePhoto();
+}
+
+HRESULT PhotoHandler::TakePhotoData(const PhotoSettings& settings,
+                                    IMFCaptureEngine* capture_engine,
+                                    IMFMediaType* base_media_type) {
+  assert(capture_engine);
+  assert(base_media_type);
+
+  // The photo sink encoders do not expose their quality, so the sink
+  // captures a bitmap that is encoded with |settings| once received.
+  HRESULT hr = InitPhotoSink(capture_engine, base_media_type,
+                             GUID_ContainerFormatBmp);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = SetSampleCallbackOutput();
   if (FAILED(hr)) {
     return hr;
   }
 
+  {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    photo_output_ = PhotoOutput::kMemory;
+    photo_settings_ = settings;
+    photo_data_.clear();
+    photo_data_result_ = E_PENDING;
+  }
   photo_state_ = PhotoState::kTakingPhoto;
 
   return capture_engine->TakePhoto();
 }
 
-void PhotoHandler::OnPhotoTaken() {
+HRESULT PhotoHandler::OnBurstPhotoTaken(IMFCaptureEngine* capture_engine) {
+  assert(IsTakingBurst());
+  assert(capture_engine);
+
+  size_t photo_count;
+  {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    // The photo sink delivers the sample before reporting the photo as
+    // taken, so each event must follow a written photo.
+    if (burst_write_failed_ ||
+        burst_photos_written_ <= burst_photos_taken_) {
+      return E_FAIL;
+    }
+    burst_photos_taken_++;
+    photo_count = burst_photos_taken_;
+  }
+
+  if (photo_count == burst_paths_.size()) {
+    photo_state_ = PhotoState::kIdle;
+    return S_FALSE;
+  }
+
+  file_path_ = burst_paths_[photo_count];
+  return capture_engine->TakePhoto();
+}
+
+HRESULT PhotoHandler::OnPhotoDataTaken(std::vector<uint8_t>* data) {
+  assert(IsTakingPhotoData());
+  assert(data);
+
+  photo_state_ = PhotoState::kIdle;
+
+  std::lock_guard<std::mutex> lock(sample_mutex_);
+  HRESULT hr = photo_data_result_;
+  if (hr == E_PENDING) {
+    // The photo sink delivers the sample before reporting the photo as
+    // taken.
+    hr = E_FAIL;
+  }
+  if (SUCCEEDED(hr)) {
+    *data = std::move(photo_data_);
+  }
+  photo_data_.clear();
+  return hr;
+}
+
+void PhotoHandler::OnPhotoSample(IMFSample* sample) {
+  assert(sample);
+
+  std::lock_guard<std::mutex> lock(sample_mutex_);
+  if (photo_output_ == PhotoOutput::kFile ||
+      (photo_output_ == PhotoOutput::kBurst &&
+       burst_photos_written_ >= burst_paths_.size()) ||
+      (photo_output_ == PhotoOutput::kMemory &&
+       photo_data_result_ != E_PENDING)) {
+    // Not expecting a sample, or a duplicate sample.
+    return;
+  }
+
+  ComPtr<IMFMediaBuffer> buffer;
+  HRESULT hr = sample->ConvertToContiguousBuffer(&buffer);
+  if (SUCCEEDED(hr)) {
+    BYTE* data = nullptr;
+    DWORD current_length = 0;
+    hr = buffer->Lock(&data, nullptr, &current_length);
+    if (SUCCEEDED(hr)) {
+      if (photo_output_ == PhotoOutput::kBurst &&
+          rotation_ != PhotoRotation::kNone) {
+        std::vector<uint8_t> photo(data, data + current_length);
+        hr = SetPhotoOrientation(rotation_, &photo);
+        if (SUCCEEDED(hr)) {
+          hr = WritePhotoFile(burst_paths_[burst_photos_written_],
+                              photo.data(), photo.size());
+        }
+      } else if (photo_output_ == PhotoOutput::kBurst) {
+        hr = WritePhotoFile(burst_paths_[burst_photos_written_], data,
+                            current_length);
+      } else {
+        hr = TranscodeImage(data, current_length, photo_settings_,
+                            &photo_data_);
+      }
+      buffer->Unlock();
+    }
+  }
+
+  if (photo_output_ == PhotoOutput::kBurst) {
+    if (FAILED(hr)) {
+      burst_write_failed_ = true;
+    }
+    burst_photos_written_++;
+  } else {
+    photo_data_result_ = hr;
+  }
+}
+
+HRESULT PhotoHandler::TakeZeroShutterLagPhoto(const std::string& file_path,
+                                              const BufferedFrame& frame,
+                                              PhotoRotation rotation) {
+  assert(!file_path.empty());
+
+  ComPtr<IWICImagingFactory> factory;
+  HRESULT hr = CreateImagingFactory(&factory);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmap> bitmap;
+  hr = CreateBitmapFromFrame(factory.Get(), frame, &bitmap);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICStream> stream;
+  hr = factory->CreateStream(&stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = stream->InitializeFromFilename(Utf16FromUtf8(file_path).c_str(),
+                                      GENERIC_WRITE);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  PhotoSettings settings;
+  settings.rotation = rotation;
+  return EncodeImage(factory.Get(), bitmap.Get(), settings, stream.Get());
+}
+
+HRESULT PhotoHandler::EncodeZeroShutterLagPhoto(const BufferedFrame& frame,
+                                                const PhotoSettings& settings,
+                                                std::vector<uint8_t>* data) {
+  assert(data);
+
+  ComPtr<IWICImagingFactory> factory;
+  HRESULT hr = CreateImagingFactory(&factory);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IWICBitmap> bitmap;
+  hr = CreateBitmapFromFrame(factory.Get(), frame, &bitmap);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return EncodeImageToMemory(factory.Get(), bitmap.Get(), settings, data);
+}
+
+HRESULT PhotoHandler::OnPhotoTaken() {
   assert(photo_state_ == PhotoState::kTakingPhoto);
   photo_state_ = PhotoState::kIdle;
+
+  PhotoRotation rotation;
+  {
+    std::lock_guard<std::mutex> lock(sample_mutex_);
+    rotation = rotation_;
+  }
+  if (rotation == PhotoRotation::kNone) {
+    return S_OK;
+  }
+
+  // The photo sink has written the file, so only its metadata is rewritten.
+  std::vector<uint8_t> photo;
+  HRESULT hr = ReadPhotoFile(file_path_, &photo);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = SetPhotoOrientation(rotation, &photo);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return WritePhotoFile(file_path_, photo.data(), photo.size());
 }
 
 }  // namespace camera_windows
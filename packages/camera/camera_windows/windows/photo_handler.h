@@ -9,10 +9,14 @@
 #include <mfcaptureengine.h>
 #include <wrl/client.h>
 
+#include <cassert>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "capture_engine_listener.h"
+#include "zero_shutter_lag_buffer.h"
 
 namespace camera_windows {
 using Microsoft::WRL::ComPtr;
@@ -27,11 +31,70 @@ enum class PhotoState {
   kTakingPhoto,
 };
 
+// Image formats of photos returned in memory.
+enum class PhotoFormat {
+  kJpeg,
+  kPng,
+};
+
+// Clockwise rotations of photos.
+enum class PhotoRotation {
+  kNone,
+  kRotate90,
+  kRotate180,
+  kRotate270,
+};
+
+// Encoder settings of photos returned in memory.
+struct PhotoSettings {
+  PhotoFormat format = PhotoFormat::kJpeg;
+
+  // JPEG quality in range 1 to 100, or 0 for the default quality.
+  uint32_t quality = 0;
+
+  // Rotation applied to the pixels while the photo is encoded.
+  PhotoRotation rotation = PhotoRotation::kNone;
+};
+
+class PhotoHandler;
+
+// Receives the encoded photos of a burst from the photo sink and forwards them
+// to a |PhotoHandler|.
+class PhotoSampleListener : public IMFCaptureEngineOnSampleCallback {
+ public:
+  explicit PhotoSampleListener(PhotoHandler* handler) : handler_(handler) {
+    assert(handler);
+  }
+
+  ~PhotoSampleListener() {}
+
+  // Disallow copy and move.
+  PhotoSampleListener(const PhotoSampleListener&) = delete;
+  PhotoSampleListener& operator=(const PhotoSampleListener&) = delete;
+
+  // Stops forwarding samples, as the photo sink may keep the listener alive
+  // after the handler is destroyed.
+  void Detach();
+
+  // IUnknown
+  STDMETHODIMP_(ULONG) AddRef();
+  STDMETHODIMP_(ULONG) Release();
+  STDMETHODIMP_(HRESULT) QueryInterface(const IID& riid, void** ppv);
+
+  // IMFCaptureEngineOnSampleCallback
+  STDMETHODIMP_(HRESULT) OnSample(IMFSample* pSample);
+
+ private:
+  std::mutex mutex_;
+  PhotoHandler* handler_;
+  volatile ULONG ref_ = 0;
+};
+
 // Handles photo sink initialization and tracks photo capture states.
 class PhotoHandler {
  public:
   PhotoHandler() {}
-  virtual ~PhotoHandler() = default;
+  virtual ~PhotoHandler();
 
   // Prevent copying.
   PhotoHandler(PhotoHandler const&) = delete;
@@ -42,17 +105,102 @@ class PhotoHandler {
   //
   // Sets photo state to: kTakingPhoto.
   //
+  // file_path:       A string that hold file path for photo capture.
+  // rotation:        Rotation written to the EXIF orientation of the photo
+  //                  by |OnPhotoTaken|.
   // capture_engine:  A pointer to capture engine instance.
   //                  Called to take the photo.
   // base_media_type: A pointer to base media type used as a base
   //                  for the actual photo capture media type.
-  // file_path:       A string that hold file path for photo capture.
-  HRESULT TakePhoto(const std::string& file_path,
+  HRESULT TakePhoto(const std::string& file_path, PhotoRotation rotation,
                     IMFCaptureEngine* capture_engine,
                     IMFMediaType* base_media_type);
 
-  // Set the photo handler recording state to: kIdle.
-  void OnPhotoTaken();
+  // Initializes photo sink if not initialized and requests the capture engine
+  // to take the first photo of a burst.
+  //
+  // Photos are received through a sample callback instead of being written
+  // by the photo sink, so that the sink is configured once for the whole
+  // burst. Each following photo is requested by |OnBurstPhotoTaken|.
+  //
+  // Sets photo state to: kTakingPhoto.
+  //
+  // file_paths:      File paths of the photos, one per photo of the burst.
+  // rotation:        Rotation written to the EXIF orientation of the photos.
+  // capture_engine:  A pointer to capture engine instance.
+  //                  Called to take the photos.
+  // base_media_type: A pointer to base media type used as a base
+  //                  for the actual photo capture media type.
+  HRESULT TakePhotoBurst(const std::vector<std::string>& file_paths,
+                         PhotoRotation rotation,
+                         IMFCaptureEngine* capture_engine,
+                         IMFMediaType* base_media_type);
+
+  // Initializes photo sink if not initialized and requests the capture engine
+  // to take a photo that is kept in memory instead of written to a file.
+  //
+  // The photo sink captures a bitmap, which is encoded with |settings| when
+  // it is received.
+  //
+  // Sets photo state to: kTakingPhoto.
+  //
+  // settings:        Encoder settings of the photo.
+  // capture_engine:  A pointer to capture engine instance.
+  //                  Called to take the photo.
+  // base_media_type: A pointer to base media type used as a base
+  //                  for the actual photo capture media type.
+  HRESULT TakePhotoData(const PhotoSettings& settings,
+                        IMFCaptureEngine* capture_engine,
+                        IMFMediaType* base_media_type);
+
+  // Handles a photo taken event of a burst, and requests the next photo of
+  // the burst from |capture_engine|.
+  //
+  // Returns S_OK if another photo was requested, or S_FALSE and sets photo
+  // state to kIdle if the burst is complete. Returns an error if the photo
+  // was not written or the next photo could not be requested.
+  HRESULT OnBurstPhotoTaken(IMFCaptureEngine* capture_engine);
+
+  // Handles the photo taken event of |TakePhotoData|, and moves the encoded
+  // photo to |data|.
+  //
+  // Sets photo state to: kIdle.
+  //
+  // Returns an error if the photo was not received or could not be encoded.
+  HRESULT OnPhotoDataTaken(std::vector<uint8_t>* data);
+
+  // Writes the photo of |sample| to the next file of the burst, or encodes
+  // it in memory.
+  // Called by |PhotoSampleListener| on a Media Foundation thread.
+  void OnPhotoSample(IMFSample* sample);
+
+  // Encodes a buffered preview frame as a JPEG file.
+  //
+  // The photo is written synchronously, so the photo state is not changed.
+  //
+  // file_path: A string that hold file path for photo capture.
+  // frame:     The frame to encode.
+  // rotation:  Rotation applied to the pixels while the frame is encoded.
+  HRESULT TakeZeroShutterLagPhoto(const std::string& file_path,
+                                  const BufferedFrame& frame,
+                                  PhotoRotation rotation);
+
+  // Encodes a buffered preview frame in memory.
+  //
+  // frame:    The frame to encode.
+  // settings: Encoder settings of the photo.
+  // data:     Receives the encoded photo.
+  HRESULT EncodeZeroShutterLagPhoto(const BufferedFrame& frame,
+                                    const PhotoSettings& settings,
+                                    std::vector<uint8_t>* data);
+
+  // Handles the photo taken event of |TakePhoto|, and writes the EXIF
+  // orientation of the photo file if it is rotated.
+  //
+  // Sets photo state to: kIdle.
+  //
+  // Returns an error if the orientation could not be written.
+  HRESULT OnPhotoTaken();
 
   // Returns true if photo state is kIdle.
   bool IsInitialized() const { return photo_state_ == PhotoState::kIdle; }
@@ -62,17 +210,62 @@ class PhotoHandler {
     return photo_state_ == PhotoState::kTakingPhoto;
   }
 
+  // Returns true if a burst is being captured.
+  bool IsTakingBurst() const {
+    return IsTakingPhoto() && photo_output_ == PhotoOutput::kBurst;
+  }
+
+  // Returns true if a photo is being taken by |TakePhotoData|.
+  bool IsTakingPhotoData() const {
+    return IsTakingPhoto() && photo_output_ == PhotoOutput::kMemory;
+  }
+
   // Returns the filesystem path of the captured photo.
   std::string GetPhotoPath() const { return file_path_; }
 
+  // Returns the filesystem paths of the photos of the last burst.
+  const std::vector<std::string>& GetBurstPhotoPaths() const {
+    return burst_paths_;
+  }
+
  private:
-  // Initializes record sink for video file capture.
+  // Destinations of the photos taken by the photo sink.
+  enum class PhotoOutput {
+    // Written to a file by the photo sink.
+    kFile,
+    // Written to the files of a burst from the sample callback.
+    kBurst,
+    // Encoded in memory from the sample callback.
+    kMemory,
+  };
+
+  // Initializes photo sink with a stream of |image_format| if not
+  // initialized with it. The output of the sink is set by the caller.
   HRESULT InitPhotoSink(IMFCaptureEngine* capture_engine,
-                        IMFMediaType* base_media_type);
+                        IMFMediaType* base_media_type,
+                        const GUID& image_format);
+
+  // Sets the photo sink output to |photo_sample_listener_|.
+  HRESULT SetSampleCallbackOutput();
 
   std::string file_path_;
   PhotoState photo_state_ = PhotoState::kNotStarted;
+  PhotoOutput photo_output_ = PhotoOutput::kFile;
   ComPtr<IMFCapturePhotoSink> photo_sink_;
+  GUID photo_sink_format_ = GUID_NULL;
+  ComPtr<PhotoSampleListener> photo_sample_listener_;
+
+  // Guards the sample callback results, which are updated on the sample
+  // thread.
+  std::mutex sample_mutex_;
+  PhotoSettings photo_settings_;
+  PhotoRotation rotation_ = PhotoRotation::kNone;
+  std::vector<uint8_t> photo_data_;
+  HRESULT photo_data_result_ = E_PENDING;
+  std::vector<std::string> burst_paths_;
+  size_t burst_photos_taken_ = 0;
+  size_t burst_photos_written_ = 0;
+  bool burst_write_failed_ = false;
 };
 
 }  // namespace camera_windows
@@ -0,0 +1,459 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "pixel_conversion.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#define CAMERA_WINDOWS_X86_SIMD 1
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace camera_windows {
+
+namespace {
+
+constexpr uint32_t kBytesPerPixel = 4;
+
+// Converts pixels [begin, width) of a single row one pixel at a time.
+//
+// Source pixels are in MFVideoFormat_RGB32 order (b, g, r, x) and destination
+// pixels in FlutterDesktopPixel order (r, g, b, a).
+template <bool kMirror>
+void ConvertPixelsScalar(const uint8_t* src, uint8_t* dst, uint32_t width,
+                         uint32_t begin) {
+  for (uint32_t x = begin; x < width; x++) {
+    const uint8_t* sp = src + x * kBytesPerPixel;
+    uint8_t* tp = dst + (kMirror ? (width - 1) - x : x) * kBytesPerPixel;
+    tp[0] = sp[2];
+    tp[1] = sp[1];
+    tp[2] = sp[0];
+    tp[3] = 255;
+  }
+}
+
+#ifdef CAMERA_WINDOWS_X86_SIMD
+
+// Converts a single row four pixels at a time.
+//
+// The shuffle swaps the red and blue channels and zeroes the padding byte,
+// which is then set to opaque alpha. When mirroring, the shuffle also reverses
+// the pixel order inside the block, and the block is written to the mirrored
+// position of the row.
+template <bool kMirror>
+void ConvertRowSSSE3(const uint8_t* src, uint8_t* dst, uint32_t width) {
+  constexpr uint32_t kPixelsPerBlock = 4;
+  const __m128i shuffle =
+      kMirror ? _mm_setr_epi8(14, 13, 12, -1, 10, 9, 8, -1, 6, 5, 4, -1, 2, 1,
+                              0, -1)
+              : _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13,
+                              12, -1);
+  const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+  uint32_t x = 0;
+  for (; x + kPixelsPerBlock <= width; x += kPixelsPerBlock) {
+    __m128i pixels = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(src + x * kBytesPerPixel));
+    pixels = _mm_or_si128(_mm_shuffle_epi8(pixels, shuffle), alpha);
+
+    uint32_t target = kMirror ? width - x - kPixelsPerBlock : x;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + target * kBytesPerPixel),
+                     pixels);
+  }
+  ConvertPixelsScalar<kMirror>(src, dst, width, x);
+}
+
+// Converts a single row eight pixels at a time.
+//
+// AVX2 byte shuffles only operate within 128-bit lanes, so mirroring reverses
+// the pixels inside each lane and then swaps the two lanes.
+template <bool kMirror>
+void ConvertRowAVX2(const uint8_t* src, uint8_t* dst, uint32_t width) {
+  constexpr uint32_t kPixelsPerBlock = 8;
+  const __m256i shuffle =
+      kMirror ? _mm256_setr_epi8(14, 13, 12, -1, 10, 9, 8, -1, 6, 5, 4, -1, 2,
+                                 1, 0, -1, 14, 13, 12, -1, 10, 9, 8, -1, 6, 5,
+                                 4, -1, 2, 1, 0, -1)
+              : _mm256_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14,
+                                 13, 12, -1, 2, 1, 0, -1, 6, 5, 4, -1, 10, 9,
+                                 8, -1, 14, 13, 12, -1);
+  const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+
+  uint32_t x = 0;
+  for (; x + kPixelsPerBlock <= width; x += kPixelsPerBlock) {
+    __m256i pixels = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(src + x * kBytesPerPixel));
+    pixels = _mm256_shuffle_epi8(pixels, shuffle);
+    if constexpr (kMirror) {
+      pixels = _mm256_permute4x64_epi64(pixels, _MM_SHUFFLE(1, 0, 3, 2));
+    }
+    pixels = _mm256_or_si256(pixels, alpha);
+
+    uint32_t target = kMirror ? width - x - kPixelsPerBlock : x;
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dst + target * kBytesPerPixel), pixels);
+  }
+  ConvertPixelsScalar<kMirror>(src, dst, width, x);
+}
+
+// Queries CPUID for SSSE3 and AVX2 support.
+//
+// AVX2 also requires the operating system to save the YMM register state,
+// which is checked via XGETBV.
+PixelConversionPath DetectPixelConversionPath() {
+  int info[4] = {0};
+  __cpuid(info, 0);
+  const int max_leaf = info[0];
+  if (max_leaf < 1) {
+    return PixelConversionPath::kScalar;
+  }
+
+  __cpuid(info, 1);
+  const bool has_ssse3 = (info[2] & (1 << 9)) != 0;
+  const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+  const bool has_avx = (info[2] & (1 << 28)) != 0;
+
+  if (max_leaf >= 7 && has_osxsave && has_avx &&
+      (_xgetbv(0) & 0x6) == 0x6) {
+    __cpuidex(info, 7, 0);
+    if ((info[1] & (1 << 5)) != 0) {
+      return PixelConversionPath::kAVX2;
+    }
+  }
+
+  return has_ssse3 ? PixelConversionPath::kSSSE3
+                   : PixelConversionPath::kScalar;
+}
+
+#else
+
+PixelConversionPath DetectPixelConversionPath() {
+  return PixelConversionPath::kScalar;
+}
+
+#endif  // CAMERA_WINDOWS_X86_SIMD
+
+template <bool kMirror>
+void ConvertFrame(PixelConversionPath path, const uint8_t* src,
+                  ptrdiff_t src_stride, uint8_t* dst, ptrdiff_t dst_stride,
+                  uint32_t width, uint32_t height) {
+  for (uint32_t y = 0; y < height; y++) {
+    const uint8_t* src_row = src + static_cast<ptrdiff_t>(y) * src_stride;
+    uint8_t* dst_row = dst + static_cast<ptrdiff_t>(y) * dst_stride;
+    switch (path) {
+#ifdef CAMERA_WINDOWS_X86_SIMD
+      case PixelConversionPath::kAVX2:
+        ConvertRowAVX2<kMirror>(src_row, dst_row, width);
+        break;
+      case PixelConversionPath::kSSSE3:
+        ConvertRowSSSE3<kMirror>(src_row, dst_row, width);
+        break;
+#endif
+      case PixelConversionPath::kScalar:
+      default:
+        ConvertPixelsScalar<kMirror>(src_row, dst_row, width, 0);
+        break;
+    }
+  }
+}
+
+// Where the pixels of a converted frame are written: source pixel (x, y) is
+// written at |origin| + x * |x_step| + y * |y_step|.
+struct DestinationLayout {
+  uint8_t* origin;
+  ptrdiff_t x_step;
+  ptrdiff_t y_step;
+};
+
+// Returns the layout of a |width| by |height| frame that is mirrored if
+// |mirror| is true, then rotated by |rotation| into |dst|.
+DestinationLayout GetDestinationLayout(uint8_t* dst, ptrdiff_t dst_stride,
+                                       uint32_t width, uint32_t height,
+                                       bool mirror, PreviewRotation rotation) {
+  const ptrdiff_t pixel = kBytesPerPixel;
+  const ptrdiff_t last_x = static_cast<ptrdiff_t>(width) - 1;
+  const ptrdiff_t last_y = static_cast<ptrdiff_t>(height) - 1;
+  switch (rotation) {
+    case PreviewRotation::kRotate90:
+      // Source rows become destination columns from right to left.
+      return {dst + (mirror ? last_x * dst_stride : 0) + last_y * pixel,
+              mirror ? -dst_stride : dst_stride, -pixel};
+    case PreviewRotation::kRotate180:
+      return {dst + (mirror ? 0 : last_x * pixel) + last_y * dst_stride,
+              mirror ? pixel : -pixel, -dst_stride};
+    case PreviewRotation::kRotate270:
+      // Source rows become destination columns from left to right.
+      return {dst + (mirror ? 0 : last_x * dst_stride),
+              mirror ? dst_stride : -dst_stride, pixel};
+    case PreviewRotation::kNone:
+    default:
+      return {dst + (mirror ? last_x * pixel : 0), mirror ? -pixel : pixel,
+              dst_stride};
+  }
+}
+
+// Number of source rows converted together for quarter turns, which write
+// each source column as a run of adjacent destination pixels.
+constexpr uint32_t kRotationTileRows = 8;
+
+// Converts each pixel of a |width| by |height| frame with
+// |convert_pixel|(x, y, target) into the destination given by |layout|.
+//
+// Rows are converted in order if they are written to destination rows.
+// Otherwise the frame is converted in tiles of |kRotationTileRows| rows, so
+// that the destination is written in runs of adjacent pixels and each source
+// row is read from the cache for the whole tile.
+template <typename ConvertPixel>
+void ConvertPixels(const DestinationLayout& layout, uint32_t width,
+                   uint32_t height, ConvertPixel convert_pixel) {
+  const ptrdiff_t pixel = kBytesPerPixel;
+  const bool writes_rows = layout.x_step == pixel || layout.x_step == -pixel;
+  const uint32_t tile_rows = writes_rows ? 1 : kRotationTileRows;
+  for (uint32_t tile_y = 0; tile_y < height; tile_y += tile_rows) {
+    const uint32_t tile_end =
+        height - tile_y < tile_rows ? height : tile_y + tile_rows;
+    for (uint32_t x = 0; x < width; x++) {
+      uint8_t* column =
+          layout.origin + static_cast<ptrdiff_t>(x) * layout.x_step;
+      for (uint32_t y = tile_y; y < tile_end; y++) {
+        convert_pixel(x, y, column + static_cast<ptrdiff_t>(y) * layout.y_step);
+      }
+    }
+  }
+}
+
+// Clamps a fixed-point color value with 8 fractional bits to a byte.
+inline uint8_t ClampToByte(int value) {
+  value >>= 8;
+  return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// Converts a NV12 frame to 4 byte pixels with opaque alpha, written to
+// |layout|.
+//
+// kBGRA selects the channel order of the destination pixels.
+template <bool kBGRA>
+void ConvertNV12Frame(const uint8_t* y_plane, ptrdiff_t y_stride,
+                      const uint8_t* uv_plane, ptrdiff_t uv_stride,
+                      const DestinationLayout& layout, uint32_t width,
+                      uint32_t height) {
+  ConvertPixels(layout, width, height,
+                [=](uint32_t x, uint32_t y, uint8_t* tp) {
+                  const uint8_t* y_row =
+                      y_plane + static_cast<ptrdiff_t>(y) * y_stride;
+                  const uint8_t* uv_row =
+                      uv_plane + static_cast<ptrdiff_t>(y / 2) * uv_stride;
+                  const int c = 298 * (y_row[x] - 16) + 128;
+                  const int d = uv_row[x & ~1u] - 128;
+                  const int e = uv_row[x | 1u] - 128;
+
+                  const uint8_t r = ClampToByte(c + 409 * e);
+                  const uint8_t g = ClampToByte(c - 100 * d - 208 * e);
+                  const uint8_t b = ClampToByte(c + 516 * d);
+                  tp[0] = kBGRA ? b : r;
+                  tp[1] = g;
+                  tp[2] = kBGRA ? r : b;
+                  tp[3] = 255;
+                });
+}
+
+}  // namespace
+
+bool IsPixelConversionPathSupported(PixelConversionPath path) {
+  switch (path) {
+    case PixelConversionPath::kScalar:
+      return true;
+    case PixelConversionPath::kSSSE3:
+      return GetPreferredPixelConversionPath() != PixelConversionPath::kScalar;
+    case PixelConversionPath::kAVX2:
+      return GetPreferredPixelConversionPath() == PixelConversionPath::kAVX2;
+  }
+  return false;
+}
+
+PixelConversionPath GetPreferredPixelConversionPath() {
+  static const PixelConversionPath preferred_path = DetectPixelConversionPath();
+  return preferred_path;
+}
+
+void ConvertRGB32ToRGBA(const uint8_t* src, uint8_t* dst, uint32_t width,
+                        uint32_t height, bool mirror) {
+  ConvertRGB32ToRGBA(GetPreferredPixelConversionPath(), src, dst, width,
+                     height, mirror);
+}
+
+void ConvertRGB32ToRGBA(const uint8_t* src, int32_t src_stride, uint8_t* dst,
+                        uint32_t width, uint32_t height, bool mirror) {
+  ConvertRGB32ToRGBA(src, src_stride, dst,
+                     static_cast<int32_t>(width * kBytesPerPixel), width,
+                     height, mirror, PreviewRotation::kNone);
+}
+
+void ConvertRGB32ToRGBA(const uint8_t* src, int32_t src_stride, uint8_t* dst,
+                        int32_t dst_stride, uint32_t width, uint32_t height,
+                        bool mirror, PreviewRotation rotation) {
+  assert(src);
+  assert(dst);
+  assert(static_cast<uint32_t>(std::abs(src_stride)) >=
+         width * kBytesPerPixel);
+  if (width == 0 || height == 0) {
+    return;
+  }
+
+  const DestinationLayout layout =
+      GetDestinationLayout(dst, dst_stride, width, height, mirror, rotation);
+  if (IsQuarterTurn(rotation)) {
+    ConvertPixels(layout, width, height,
+                  [=](uint32_t x, uint32_t y, uint8_t* tp) {
+                    const uint8_t* sp =
+                        src + static_cast<ptrdiff_t>(y) * src_stride +
+                        x * kBytesPerPixel;
+                    tp[0] = sp[2];
+                    tp[1] = sp[1];
+                    tp[2] = sp[0];
+                    tp[3] = 255;
+                  });
+    return;
+  }
+
+  // Rows are written left to right or mirrored, from the pixel at the left
+  // edge of the destination row.
+  const PixelConversionPath path = GetPreferredPixelConversionPath();
+  if (layout.x_step < 0) {
+    ConvertFrame<true>(path, src, src_stride,
+                       layout.origin - (width - 1) * kBytesPerPixel,
+                       layout.y_step, width, height);
+  } else {
+    ConvertFrame<false>(path, src, src_stride, layout.origin, layout.y_step,
+                        width, height);
+  }
+}
+
+void ConvertRGB32ToBGRA(const uint8_t* src, int32_t src_stride, uint8_t* dst,
+                        uint32_t width, uint32_t height) {
+  assert(src);
+  assert(dst);
+
+  for (uint32_t y = 0; y < height; y++) {
+    const uint8_t* sp = src + static_cast<ptrdiff_t>(y) * src_stride;
+    uint8_t* tp = dst + static_cast<size_t>(y) * width * kBytesPerPixel;
+    for (uint32_t x = 0; x < width; x++) {
+      tp[0] = sp[0];
+      tp[1] = sp[1];
+      tp[2] = sp[2];
+      tp[3] = 255;
+      sp += kBytesPerPixel;
+      tp += kBytesPerPixel;
+    }
+  }
+}
+
+void ConvertRGB32ToNV12(const uint8_t* src, int32_t src_stride,
+                        uint8_t* y_plane, uint8_t* uv_plane, uint32_t width,
+                        uint32_t height) {
+  assert(src);
+  assert(y_plane);
+  assert(uv_plane);
+
+  for (uint32_t y = 0; y < height; y++) {
+    const uint8_t* sp = src + static_cast<ptrdiff_t>(y) * src_stride;
+    uint8_t* tp = y_plane + static_cast<size_t>(y) * width;
+    for (uint32_t x = 0; x < width; x++) {
+      const int b = sp[0];
+      const int g = sp[1];
+      const int r = sp[2];
+      tp[x] = static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) +
+                                   16);
+      sp += kBytesPerPixel;
+    }
+  }
+
+  // Edge pixels are repeated for frames with an odd width or height.
+  const uint32_t uv_row_size = GetNV12UVPlaneRowSize(width);
+  for (uint32_t y = 0; y < height; y += 2) {
+    const uint8_t* row0 = src + static_cast<ptrdiff_t>(y) * src_stride;
+    const uint8_t* row1 = y + 1 < height ? row0 + src_stride : row0;
+    uint8_t* tp = uv_plane + static_cast<size_t>(y / 2) * uv_row_size;
+    for (uint32_t x = 0; x < width; x += 2) {
+      const uint32_t offset0 = x * kBytesPerPixel;
+      const uint32_t offset1 =
+          x + 1 < width ? offset0 + kBytesPerPixel : offset0;
+      const int b = (row0[offset0] + row0[offset1] + row1[offset0] +
+                     row1[offset1] + 2) / 4;
+      const int g = (row0[offset0 + 1] + row0[offset1 + 1] +
+                     row1[offset0 + 1] + row1[offset1 + 1] + 2) / 4;
+      const int r = (row0[offset0 + 2] + row0[offset1 + 2] +
+                     row1[offset0 + 2] + row1[offset1 + 2] + 2) / 4;
+      tp[x] =
+          static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+      tp[x + 1] =
+          static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+    }
+  }
+}
+
+void ConvertNV12ToRGBA(const uint8_t* y_plane, int32_t y_stride,
+                       const uint8_t* uv_plane, int32_t uv_stride,
+                       uint8_t* dst, uint32_t width, uint32_t height,
+                       bool mirror) {
+  ConvertNV12ToRGBA(y_plane, y_stride, uv_plane, uv_stride, dst,
+                    static_cast<int32_t>(width * kBytesPerPixel), width,
+                    height, mirror, PreviewRotation::kNone);
+}
+
+void ConvertNV12ToRGBA(const uint8_t* y_plane, int32_t y_stride,
+                       const uint8_t* uv_plane, int32_t uv_stride,
+                       uint8_t* dst, int32_t dst_stride, uint32_t width,
+                       uint32_t height, bool mirror, PreviewRotation rotation) {
+  assert(y_plane);
+  assert(uv_plane);
+  assert(dst);
+  if (width == 0 || height == 0) {
+    return;
+  }
+
+  ConvertNV12Frame<false>(
+      y_plane, y_stride, uv_plane, uv_stride,
+      GetDestinationLayout(dst, dst_stride, width, height, mirror, rotation),
+      width, height);
+}
+
+void ConvertNV12ToBGRA(const uint8_t* y_plane, int32_t y_stride,
+                       const uint8_t* uv_plane, int32_t uv_stride,
+                       uint8_t* dst, uint32_t width, uint32_t height) {
+  assert(y_plane);
+  assert(uv_plane);
+  assert(dst);
+
+  if (width == 0 || height == 0) {
+    return;
+  }
+
+  ConvertNV12Frame<true>(
+      y_plane, y_stride, uv_plane, uv_stride,
+      GetDestinationLayout(dst, static_cast<ptrdiff_t>(width) * kBytesPerPixel,
+                           width, height, false, PreviewRotation::kNone),
+      width, height);
+}
+
+void ConvertRGB32ToRGBA(PixelConversionPath path, const uint8_t* src,
+                        uint8_t* dst, uint32_t width, uint32_t height,
+                        bool mirror) {
+  assert(src);
+  assert(dst);
+  assert(IsPixelConversionPathSupported(path));
+
+  const ptrdiff_t stride = static_cast<ptrdiff_t>(width) * kBytesPerPixel;
+  if (mirror) {
+    ConvertFrame<true>(path, src, stride, dst, stride, width, height);
+  } else {
+    ConvertFrame<false>(path, src, stride, dst, stride, width, height);
+  }
+}
+
+}  // namespace camera_windows
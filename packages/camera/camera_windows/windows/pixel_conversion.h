@@ -0,0 +1,160 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PIXEL_CONVERSION_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PIXEL_CONVERSION_H_
+
+#include <stdint.h>
+
+namespace camera_windows {
+
+// Pixel formats of preview frames delivered by the capture engine.
+enum class PreviewPixelFormat {
+  // MFVideoFormat_RGB32, converted from the native camera format by Media
+  // Foundation.
+  kRGB32,
+  // MFVideoFormat_NV12, a full resolution luma plane followed by an
+  // interleaved half resolution chroma plane with the same stride.
+  kNV12,
+};
+
+// Clockwise rotations of the preview, applied after it is mirrored.
+enum class PreviewRotation {
+  kNone,
+  kRotate90,
+  kRotate180,
+  kRotate270,
+};
+
+// Returns true if |rotation| swaps the width and height of the frames.
+inline bool IsQuarterTurn(PreviewRotation rotation) {
+  return rotation == PreviewRotation::kRotate90 ||
+         rotation == PreviewRotation::kRotate270;
+}
+
+// Implementations available for converting MFVideoFormat_RGB32 frames to
+// Flutter desktop pixel buffers.
+enum class PixelConversionPath {
+  // Portable per-pixel loop. Always available.
+  kScalar,
+  // 128-bit byte shuffle. Requires SSSE3.
+  kSSSE3,
+  // 256-bit byte shuffle and lane permute. Requires AVX2.
+  kAVX2,
+};
+
+// Returns true if the given conversion path can run on the current CPU.
+bool IsPixelConversionPathSupported(PixelConversionPath path);
+
+// Returns the fastest conversion path supported by the current CPU.
+//
+// CPU features are detected once and the result is cached for the lifetime of
+// the process.
+PixelConversionPath GetPreferredPixelConversionPath();
+
+// Converts a frame of MFVideoFormat_RGB32 (BGRX) pixels to RGBA pixels with
+// opaque alpha, using the fastest path supported by the current CPU.
+//
+// src:    Source pixel data, |width| * |height| * 4 bytes.
+// dst:    Destination pixel data, |width| * |height| * 4 bytes. Must not
+//         overlap |src|.
+// mirror: If true, each row is horizontally mirrored.
+void ConvertRGB32ToRGBA(const uint8_t* src, uint8_t* dst, uint32_t width,
+                        uint32_t height, bool mirror);
+
+// Converts a frame like |ConvertRGB32ToRGBA| from a source whose rows are not
+// tightly packed, such as a locked IMF2DBuffer.
+//
+// src:        First byte of the top row of the frame.
+// src_stride: Distance in bytes from the start of one source row to the start
+//             of the next. Negative for bottom-up images. Its absolute value
+//             must be at least |width| * 4.
+void ConvertRGB32ToRGBA(const uint8_t* src, int32_t src_stride, uint8_t* dst,
+                        uint32_t width, uint32_t height, bool mirror);
+
+// Converts a frame like |ConvertRGB32ToRGBA|, rotated by |rotation| as it is
+// written, so that no separate pass is needed to rotate the frame.
+//
+// dst:        First byte of the top row of the rotated frame, which is
+//             |height| pixels wide for quarter turns.
+// dst_stride: Distance in bytes between the starts of two destination rows.
+//             Must be at least the row size of the rotated frame.
+//
+// Frames that are not rotated by a quarter turn are converted row by row
+// with the fastest path supported by the current CPU. Quarter turns write
+// each source row to a destination column, one pixel at a time.
+void ConvertRGB32ToRGBA(const uint8_t* src, int32_t src_stride, uint8_t* dst,
+                        int32_t dst_stride, uint32_t width, uint32_t height,
+                        bool mirror, PreviewRotation rotation);
+
+// Copies a frame of MFVideoFormat_RGB32 pixels to tightly packed BGRA pixels
+// with opaque alpha.
+//
+// src:        First byte of the top row of the frame.
+// src_stride: Distance in bytes between the starts of two source rows.
+// dst:        Destination pixel data, |width| * |height| * 4 bytes.
+void ConvertRGB32ToBGRA(const uint8_t* src, int32_t src_stride, uint8_t* dst,
+                        uint32_t width, uint32_t height);
+
+// Returns the row size in bytes of the interleaved UV plane of a NV12 frame.
+inline uint32_t GetNV12UVPlaneRowSize(uint32_t width) {
+  return ((width + 1) / 2) * 2;
+}
+
+// Returns the number of rows of the interleaved UV plane of a NV12 frame.
+inline uint32_t GetNV12UVPlaneHeight(uint32_t height) {
+  return (height + 1) / 2;
+}
+
+// Converts a frame of MFVideoFormat_RGB32 pixels to NV12 with BT.601 limited
+// range coefficients. Chroma is averaged over each 2x2 block of pixels.
+//
+// src:        First byte of the top row of the frame.
+// src_stride: Distance in bytes between the starts of two source rows.
+// y_plane:    Destination luma plane, |width| * |height| bytes.
+// uv_plane:   Destination chroma plane, |GetNV12UVPlaneRowSize| *
+//             |GetNV12UVPlaneHeight| bytes.
+void ConvertRGB32ToNV12(const uint8_t* src, int32_t src_stride,
+                        uint8_t* y_plane, uint8_t* uv_plane, uint32_t width,
+                        uint32_t height);
+
+// Converts a NV12 frame with BT.601 limited range coefficients to RGBA pixels
+// with opaque alpha.
+//
+// y_plane:   First byte of the top row of the luma plane.
+// y_stride:  Distance in bytes between the starts of two luma rows.
+// uv_plane:  First byte of the top row of the interleaved chroma plane.
+// uv_stride: Distance in bytes between the starts of two chroma rows.
+// dst:       Destination pixel data, |width| * |height| * 4 bytes.
+// mirror:    If true, each row is horizontally mirrored.
+void ConvertNV12ToRGBA(const uint8_t* y_plane, int32_t y_stride,
+                       const uint8_t* uv_plane, int32_t uv_stride,
+                       uint8_t* dst, uint32_t width, uint32_t height,
+                       bool mirror);
+
+// Converts a NV12 frame like |ConvertNV12ToRGBA|, rotated by |rotation| as it
+// is written. |dst| and |dst_stride| are as for the rotated
+// |ConvertRGB32ToRGBA|.
+void ConvertNV12ToRGBA(const uint8_t* y_plane, int32_t y_stride,
+                       const uint8_t* uv_plane, int32_t uv_stride,
+                       uint8_t* dst, int32_t dst_stride, uint32_t width,
+                       uint32_t height, bool mirror, PreviewRotation rotation);
+
+// Converts a NV12 frame like |ConvertNV12ToRGBA| to tightly packed BGRA
+// pixels, without mirroring.
+void ConvertNV12ToBGRA(const uint8_t* y_plane, int32_t y_stride,
+                       const uint8_t* uv_plane, int32_t uv_stride,
+                       uint8_t* dst, uint32_t width, uint32_t height);
+
+// Converts a frame like |ConvertRGB32ToRGBA| using an explicit conversion
+// path. The path must be supported by the current CPU.
+//
+// Exists for unit testing and benchmarking individual implementations.
+void ConvertRGB32ToRGBA(PixelConversionPath path, const uint8_t* src,
+                        uint8_t* dst, uint32_t width, uint32_t height,
+                        bool mirror);
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PIXEL_CONVERSION_H_
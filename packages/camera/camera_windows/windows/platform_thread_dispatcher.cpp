@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "platform_thread_dispatcher.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace camera_windows {
+
+PlatformThreadDispatcher::PlatformThreadDispatcher()
+    : platform_thread_id_(GetCurrentThreadId()) {}
+
+void PlatformThreadDispatcher::SetWindow(HWND window, UINT message) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  window_ = window;
+  message_ = message;
+  message_posted_ = false;
+}
+
+void PlatformThreadDispatcher::Post(const void* owner,
+                                    std::function<void()> task) {
+  assert(task);
+
+  bool run_immediately;
+  HWND window = nullptr;
+  UINT message = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    run_immediately =
+        !window_ ||
+        (GetCurrentThreadId() == platform_thread_id_ && tasks_.empty());
+    if (!run_immediately) {
+      tasks_.emplace_back(owner, std::move(task));
+      if (!message_posted_) {
+        message_posted_ = true;
+        window = window_;
+        message = message_;
+      }
+    }
+  }
+
+  if (run_immediately) {
+    task();
+  } else if (window) {
+    PostMessage(window, message, 0, 0);
+  }
+}
+
+void PlatformThreadDispatcher::Cancel(const void* owner) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  tasks_.erase(std::remove_if(tasks_.begin(), tasks_.end(),
+                              [owner](const auto& task) {
+                                return task.first == owner;
+                              }),
+               tasks_.end());
+}
+
+void PlatformThreadDispatcher::RunPendingTasks() {
+  size_t count;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    message_posted_ = false;
+    count = tasks_.size();
+  }
+
+  // Tasks are taken one at a time, so that a task can cancel the tasks of an
+  // owner it destroys. Tasks posted by the batch run with the next message.
+  for (size_t i = 0; i < count; i++) {
+    std::function<void()> task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (tasks_.empty()) {
+        break;
+      }
+      task = std::move(tasks_.front().second);
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PLATFORM_THREAD_DISPATCHER_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PLATFORM_THREAD_DISPATCHER_H_
+
+#include <windows.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace camera_windows {
+
+// Runs tasks posted from any thread on the platform thread.
+//
+// Tasks are queued and a single window message is posted to the top-level
+// window for all tasks queued until the message is handled, so that tasks
+// posted during one message loop iteration run in one batch.
+//
+// Until a window is set, tasks run immediately on the posting thread. Tasks
+// posted on the platform thread also run immediately while no other task is
+// queued.
+class PlatformThreadDispatcher {
+ public:
+  // Creates a dispatcher for the calling thread, which must be the platform
+  // thread.
+  PlatformThreadDispatcher();
+
+  ~PlatformThreadDispatcher() = default;
+
+  // Disallow copy and move.
+  PlatformThreadDispatcher(const PlatformThreadDispatcher&) = delete;
+  PlatformThreadDispatcher& operator=(const PlatformThreadDispatcher&) =
+      delete;
+
+  // Sets the window that |message| is posted to when tasks are queued. The
+  // owner of the window must call |RunPendingTasks| when it receives
+  // |message|. A null window makes tasks run immediately again.
+  void SetWindow(HWND window, UINT message);
+
+  // Runs |task| on the platform thread.
+  //
+  // owner: Identifies the tasks that are discarded by |Cancel|.
+  void Post(const void* owner, std::function<void()> task);
+
+  // Discards the queued tasks of |owner|. Must be called on the platform
+  // thread before |owner| is destroyed.
+  void Cancel(const void* owner);
+
+  // Runs the tasks queued before the call. Called on the platform thread.
+  void RunPendingTasks();
+
+ private:
+  std::mutex mutex_;
+  std::deque<std::pair<const void*, std::function<void()>>> tasks_;
+  HWND window_ = nullptr;
+  UINT message_ = 0;
+  bool message_posted_ = false;
+  DWORD platform_thread_id_ = 0;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PLATFORM_THREAD_DISPATCHER_H_
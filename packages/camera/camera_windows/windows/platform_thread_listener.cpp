@@ -0,0 +1,198 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "platform_thread_listener.h"
+
+namespace camera_windows {
+
+void PlatformThreadListener::Post(
+    std::function<void(CaptureControllerListener*)> callback) {
+  CaptureControllerListener* target = target_;
+  dispatcher_->Post(this, [target, callback = std::move(callback)]() {
+    callback(target);
+  });
+}
+
+void PlatformThreadListener::OnCreateCaptureEngineSucceeded(
+    int64_t texture_id) {
+  Post([texture_id](CaptureControllerListener* target) {
+    target->OnCreateCaptureEngineSucceeded(texture_id);
+  });
+}
+
+void PlatformThreadListener::OnCreateCaptureEngineFailed(
+    CameraResult result, const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnCreateCaptureEngineFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnStartPreviewSucceeded(int32_t width,
+                                                     int32_t height) {
+  Post([width, height](CaptureControllerListener* target) {
+    target->OnStartPreviewSucceeded(width, height);
+  });
+}
+
+void PlatformThreadListener::OnStartPreviewFailed(CameraResult result,
+                                                  const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnStartPreviewFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnPausePreviewSucceeded() {
+  Post([](CaptureControllerListener* target) {
+    target->OnPausePreviewSucceeded();
+  });
+}
+
+void PlatformThreadListener::OnPausePreviewFailed(CameraResult result,
+                                                  const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnPausePreviewFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnResumePreviewSucceeded() {
+  Post([](CaptureControllerListener* target) {
+    target->OnResumePreviewSucceeded();
+  });
+}
+
+void PlatformThreadListener::OnResumePreviewFailed(CameraResult result,
+                                                   const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnResumePreviewFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnStartRecordSucceeded() {
+  Post([](CaptureControllerListener* target) {
+    target->OnStartRecordSucceeded();
+  });
+}
+
+void PlatformThreadListener::OnStartRecordFailed(CameraResult result,
+                                                 const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnStartRecordFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnStopRecordSucceeded(
+    const std::string& file_path) {
+  Post([file_path](CaptureControllerListener* target) {
+    target->OnStopRecordSucceeded(file_path);
+  });
+}
+
+void PlatformThreadListener::OnStopRecordFailed(CameraResult result,
+                                                const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnStopRecordFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnPauseRecordSucceeded() {
+  Post([](CaptureControllerListener* target) {
+    target->OnPauseRecordSucceeded();
+  });
+}
+
+void PlatformThreadListener::OnPauseRecordFailed(CameraResult result,
+                                                 const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnPauseRecordFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnResumeRecordSucceeded() {
+  Post([](CaptureControllerListener* target) {
+    target->OnResumeRecordSucceeded();
+  });
+}
+
+void PlatformThreadListener::OnResumeRecordFailed(CameraResult result,
+                                                  const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnResumeRecordFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnTakePictureSucceeded(
+    const std::string& file_path) {
+  Post([file_path](CaptureControllerListener* target) {
+    target->OnTakePictureSucceeded(file_path);
+  });
+}
+
+void PlatformThreadListener::OnTakePictureFailed(CameraResult result,
+                                                 const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnTakePictureFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnTakePictureDataSucceeded(
+    std::vector<uint8_t>& data) {
+  // The data is moved to the platform thread instead of being copied.
+  Post([data = std::move(data)](CaptureControllerListener* target) mutable {
+    target->OnTakePictureDataSucceeded(data);
+  });
+}
+
+void PlatformThreadListener::OnTakePictureDataFailed(CameraResult result,
+                                                     const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnTakePictureDataFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnTakePictureBurstSucceeded(
+    const std::vector<std::string>& file_paths) {
+  Post([file_paths](CaptureControllerListener* target) {
+    target->OnTakePictureBurstSucceeded(file_paths);
+  });
+}
+
+void PlatformThreadListener::OnTakePictureBurstFailed(
+    CameraResult result, const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnTakePictureBurstFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnVideoRecordSucceeded(
+    const std::string& file_path, int64_t video_duration_ms) {
+  Post([file_path, video_duration_ms](CaptureControllerListener* target) {
+    target->OnVideoRecordSucceeded(file_path, video_duration_ms);
+  });
+}
+
+void PlatformThreadListener::OnVideoRecordFailed(CameraResult result,
+                                                 const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnVideoRecordFailed(result, error);
+  });
+}
+
+void PlatformThreadListener::OnCaptureError(CameraResult result,
+                                            const std::string& error) {
+  Post([result, error](CaptureControllerListener* target) {
+    target->OnCaptureError(result, error);
+  });
+}
+
+bool PlatformThreadListener::OnImageStreamFrameAvailable(
+    ImageStreamFrame& frame) {
+  return target_->OnImageStreamFrameAvailable(frame);
+}
+
+void PlatformThreadListener::OnVideoRecordChunkAvailable(
+    uint64_t offset, std::vector<uint8_t>& data) {
+  target_->OnVideoRecordChunkAvailable(offset, data);
+}
+
+}  // namespace camera_windows
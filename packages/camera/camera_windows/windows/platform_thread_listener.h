@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PLATFORM_THREAD_LISTENER_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PLATFORM_THREAD_LISTENER_H_
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "capture_controller_listener.h"
+#include "platform_thread_dispatcher.h"
+
+namespace camera_windows {
+
+// A |CaptureControllerListener| that forwards the callbacks of a capture
+// controller to another listener on the platform thread.
+//
+// Method results and channel messages of the target listener are then only
+// accessed from the platform thread, whichever thread the capture controller
+// reports from. Image stream frames and recorded chunks are forwarded
+// immediately, as they are sent through event sinks that can be used from any
+// thread, and delaying them would hold their data until the next message loop
+// iteration.
+class PlatformThreadListener : public CaptureControllerListener {
+ public:
+  // target:     Listener the callbacks are forwarded to. Must outlive the
+  //             listener, and call |Cancel| before it is destroyed.
+  // dispatcher: Dispatcher that runs the forwarded callbacks.
+  PlatformThreadListener(CaptureControllerListener* target,
+                         std::shared_ptr<PlatformThreadDispatcher> dispatcher)
+      : target_(target), dispatcher_(std::move(dispatcher)) {
+    assert(target);
+    assert(dispatcher_);
+  }
+
+  ~PlatformThreadListener() override = default;
+
+  // Disallow copy and move.
+  PlatformThreadListener(const PlatformThreadListener&) = delete;
+  PlatformThreadListener& operator=(const PlatformThreadListener&) = delete;
+
+  // Discards the callbacks that have not been forwarded yet. Must be called
+  // on the platform thread after the capture controller is destroyed.
+  void Cancel() { dispatcher_->Cancel(this); }
+
+  // CaptureControllerListener
+  void OnCreateCaptureEngineSucceeded(int64_t texture_id) override;
+  void OnCreateCaptureEngineFailed(CameraResult result,
+                                   const std::string& error) override;
+  void OnStartPreviewSucceeded(int32_t width, int32_t height) override;
+  void OnStartPreviewFailed(CameraResult result,
+                            const std::string& error) override;
+  void OnPausePreviewSucceeded() override;
+  void OnPausePreviewFailed(CameraResult result,
+                            const std::string& error) override;
+  void OnResumePreviewSucceeded() override;
+  void OnResumePreviewFailed(CameraResult result,
+                             const std::string& error) override;
+  void OnStartRecordSucceeded() override;
+  void OnStartRecordFailed(CameraResult result,
+                           const std::string& error) override;
+  void OnStopRecordSucceeded(const std::string& file_path) override;
+  void OnStopRecordFailed(CameraResult result,
+                          const std::string& error) override;
+  void OnPauseRecordSucceeded() override;
+  void OnPauseRecordFailed(CameraResult result,
+                           const std::string& error) override;
+  void OnResumeRecordSucceeded() override;
+  void OnResumeRecordFailed(CameraResult result,
+                            const std::string& error) override;
+  void OnTakePictureSucceeded(const std::string& file_path) override;
+  void OnTakePictureFailed(CameraResult result,
+                           const std::string& error) override;
+  void OnTakePictureDataSucceeded(std::vector<uint8_t>& data) override;
+  void OnTakePictureDataFailed(CameraResult result,
+                               const std::string& error) override;
+  void OnTakePictureBurstSucceeded(
+      const std::vector<std::string>& file_paths) override;
+  void OnTakePictureBurstFailed(CameraResult result,
+                                const std::string& error) override;
+  void OnVideoRecordSucceeded(const std::string& file_path,
+                              int64_t video_duration_ms) override;
+  void OnVideoRecordFailed(CameraResult result,
+                           const std::string& error) override;
+  void OnCaptureError(CameraResult result, const std::string& error) override;
+  bool OnImageStreamFrameAvailable(ImageStreamFrame& frame) override;
+  void OnVideoRecordChunkAvailable(uint64_t offset,
+                                   std::vector<uint8_t>& data) override;
+
+ private:
+  // Runs |callback| with the target listener on the platform thread.
+  void Post(std::function<void(CaptureControllerListener*)> callback);
+
+  CaptureControllerListener* target_;
+  std::shared_ptr<PlatformThreadDispatcher> dispatcher_;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PLATFORM_THREAD_LISTENER_H_
@@ -0,0 +1,100 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_crop.h"
+
+#include <utility>
+
+namespace camera_windows {
+
+namespace {
+
+// Returns the even pixel offset of |fraction| of |size|.
+uint32_t GetEvenOffset(double fraction, uint32_t size) {
+  return static_cast<uint32_t>(fraction * size) & ~1u;
+}
+
+// Returns the even pixel length of |fraction| of |size|, at least 2 pixels.
+uint32_t GetEvenLength(double fraction, uint32_t size) {
+  uint32_t length = static_cast<uint32_t>(fraction * size + 0.5) & ~1u;
+  return length < 2 ? 2 : length;
+}
+
+}  // namespace
+
+bool IsValidPreviewCropRect(const PreviewCropRect& rect) {
+  return rect.left >= 0.0 && rect.top >= 0.0 && rect.width > 0.0 &&
+         rect.height > 0.0 && rect.left + rect.width <= 1.0 &&
+         rect.top + rect.height <= 1.0;
+}
+
+bool IsValidPreviewZoomLevel(double zoom_level) {
+  return zoom_level >= kMinPreviewZoomLevel &&
+         zoom_level <= kMaxPreviewZoomLevel;
+}
+
+PixelRect GetPreviewSourceRect(uint32_t frame_width, uint32_t frame_height,
+                               const PreviewCropRect& crop, double zoom_level,
+                               bool mirror, PreviewRotation rotation) {
+  PixelRect full_frame = {0, 0, frame_width, frame_height};
+  if (frame_width < 2 || frame_height < 2 || !IsValidPreviewCropRect(crop) ||
+      !IsValidPreviewZoomLevel(zoom_level) ||
+      (crop == PreviewCropRect() && zoom_level == kMinPreviewZoomLevel)) {
+    return full_frame;
+  }
+
+  double width = crop.width / zoom_level;
+  double height = crop.height / zoom_level;
+  double left = crop.left + (crop.width - width) / 2.0;
+  double top = crop.top + (crop.height - height) / 2.0;
+
+  // Maps the region from the rotated preview to the mirrored frame.
+  const double right = 1.0 - left - width;
+  const double bottom = 1.0 - top - height;
+  switch (rotation) {
+    case PreviewRotation::kRotate90:
+      left = top;
+      top = right;
+      std::swap(width, height);
+      break;
+    case PreviewRotation::kRotate180:
+      left = right;
+      top = bottom;
+      break;
+    case PreviewRotation::kRotate270:
+      top = left;
+      left = bottom;
+      std::swap(width, height);
+      break;
+    case PreviewRotation::kNone:
+      break;
+  }
+
+  if (mirror) {
+    left = 1.0 - left - width;
+  }
+
+  PixelRect rect;
+  rect.x = GetEvenOffset(left, frame_width);
+  rect.y = GetEvenOffset(top, frame_height);
+  rect.width = GetEvenLength(width, frame_width);
+  rect.height = GetEvenLength(height, frame_height);
+
+  // Rounding can move the region past the frame edges.
+  if (rect.width > frame_width) {
+    rect.width = frame_width & ~1u;
+  }
+  if (rect.height > frame_height) {
+    rect.height = frame_height & ~1u;
+  }
+  if (rect.x + rect.width > frame_width) {
+    rect.x = (frame_width - rect.width) & ~1u;
+  }
+  if (rect.y + rect.height > frame_height) {
+    rect.y = (frame_height - rect.height) & ~1u;
+  }
+  return rect;
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_CROP_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_CROP_H_
+
+#include <cstdint>
+
+#include "pixel_conversion.h"
+
+namespace camera_windows {
+
+// Digital zoom range of the preview.
+constexpr double kMinPreviewZoomLevel = 1.0;
+constexpr double kMaxPreviewZoomLevel = 4.0;
+
+// Region of the preview shown in the texture, in fractions of the frame size.
+//
+// The region is given in the orientation shown to the user, so a mirrored or
+// rotated preview keeps |left| on the left side of the texture.
+struct PreviewCropRect {
+  double left = 0.0;
+  double top = 0.0;
+  double width = 1.0;
+  double height = 1.0;
+
+  bool operator==(const PreviewCropRect& other) const {
+    return left == other.left && top == other.top && width == other.width &&
+           height == other.height;
+  }
+};
+
+// A region of a frame, in pixels.
+struct PixelRect {
+  uint32_t x = 0;
+  uint32_t y = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+};
+
+// Returns true if |rect| has a positive size and lies within the frame.
+bool IsValidPreviewCropRect(const PreviewCropRect& rect);
+
+// Returns true if |zoom_level| is within the digital zoom range.
+bool IsValidPreviewZoomLevel(double zoom_level);
+
+// Returns the region of a source frame that is converted into the texture.
+//
+// The zoom level narrows |crop| around its center. If |mirror| is true, the
+// region is mirrored, as frames are mirrored after they are cropped, and it
+// is rotated back by |rotation| likewise. Offsets and sizes are kept even, so
+// that NV12 chroma samples stay aligned. The full frame is returned if
+// nothing is cropped, or if the frame is smaller than 2 pixels.
+PixelRect GetPreviewSourceRect(
+    uint32_t frame_width, uint32_t frame_height, const PreviewCropRect& crop,
+    double zoom_level, bool mirror,
+    PreviewRotation rotation = PreviewRotation::kNone);
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_CROP_H_
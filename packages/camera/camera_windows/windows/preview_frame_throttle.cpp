@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_frame_throttle.h"
+
+#include <algorithm>
+
+namespace camera_windows {
+
+void PreviewFrameThrottle::SetTargetFrameRate(
+    std::optional<double> frames_per_second) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  target_frame_rate_ = frames_per_second;
+  next_frame_time_us_ = std::nullopt;
+}
+
+void PreviewFrameThrottle::SetMaxFrameRate(
+    std::optional<double> frames_per_second) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (frames_per_second && *frames_per_second > 0.0) {
+    max_frame_rate_ = frames_per_second;
+  } else {
+    max_frame_rate_ = std::nullopt;
+  }
+  next_frame_time_us_ = std::nullopt;
+}
+
+void PreviewFrameThrottle::SetHidden(bool hidden) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (hidden_ != hidden) {
+    hidden_ = hidden;
+    next_frame_time_us_ = std::nullopt;
+  }
+}
+
+bool PreviewFrameThrottle::IsPaused() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return hidden_ || (target_frame_rate_ && *target_frame_rate_ <= 0.0);
+}
+
+std::optional<double> PreviewFrameThrottle::GetFrameRate() const {
+  if (target_frame_rate_ && max_frame_rate_) {
+    return std::min(*target_frame_rate_, *max_frame_rate_);
+  }
+  return target_frame_rate_ ? target_frame_rate_ : max_frame_rate_;
+}
+
+bool PreviewFrameThrottle::ShouldDeliverFrame(uint64_t capture_time_us) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (hidden_) {
+    return false;
+  }
+  const std::optional<double> frame_rate = GetFrameRate();
+  if (!frame_rate) {
+    return true;
+  }
+  if (*frame_rate <= 0.0) {
+    return false;
+  }
+
+  const auto interval_us = static_cast<uint64_t>(1e6 / *frame_rate);
+  // Frames arriving slightly early are delivered, as capture times jitter
+  // around the camera frame interval.
+  const uint64_t tolerance_us = interval_us / 8;
+  // Frames are spaced from the previous deadline to keep the average rate,
+  // unless frames were missed or the capture time went back.
+  const bool on_schedule =
+      next_frame_time_us_ &&
+      capture_time_us + interval_us >= *next_frame_time_us_ &&
+      capture_time_us < *next_frame_time_us_ + interval_us;
+  if (on_schedule) {
+    if (capture_time_us + tolerance_us < *next_frame_time_us_) {
+      return false;
+    }
+    *next_frame_time_us_ += interval_us;
+  } else {
+    next_frame_time_us_ = capture_time_us + interval_us;
+  }
+  return true;
+}
+
+}  // namespace camera_windows
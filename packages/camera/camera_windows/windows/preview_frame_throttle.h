@@ -0,0 +1,70 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_FRAME_THROTTLE_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_FRAME_THROTTLE_H_
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace camera_windows {
+
+// Decides which preview frames are converted into the preview texture, so
+// that the preview is not updated faster than it is shown.
+//
+// The preview is paused while its window is hidden or if the target frame
+// rate is 0, and limited to the lower of the target and maximum frame rates
+// otherwise. Frames are chosen by their capture times, so the average rate
+// matches the limit even if the camera rate is not a multiple of it.
+//
+// Settings are changed on the platform thread, and frames are checked on the
+// sample thread.
+class PreviewFrameThrottle {
+ public:
+  PreviewFrameThrottle() = default;
+  virtual ~PreviewFrameThrottle() = default;
+
+  // Prevent copying.
+  PreviewFrameThrottle(PreviewFrameThrottle const&) = delete;
+  PreviewFrameThrottle& operator=(PreviewFrameThrottle const&) = delete;
+
+  // Sets the maximum preview frame rate. The rate is not limited if
+  // |frames_per_second| is std::nullopt, and the preview is paused if it is
+  // 0 or less.
+  void SetTargetFrameRate(std::optional<double> frames_per_second);
+
+  // Sets a frame rate the preview is never updated faster than, whatever the
+  // target frame rate. The rate is not limited if |frames_per_second| is
+  // std::nullopt or 0 or less.
+  void SetMaxFrameRate(std::optional<double> frames_per_second);
+
+  // Pauses the preview while |hidden| is true, whatever the target frame
+  // rate.
+  void SetHidden(bool hidden);
+
+  // Returns true if no preview frame is currently delivered.
+  bool IsPaused() const;
+
+  // Returns true if the frame captured at |capture_time_us| should be
+  // delivered to the preview, and records it as delivered if so.
+  bool ShouldDeliverFrame(uint64_t capture_time_us);
+
+ private:
+  // Returns the frame rate frames are delivered at, or std::nullopt if all
+  // frames are delivered.
+  std::optional<double> GetFrameRate() const;
+
+  mutable std::mutex mutex_;
+  std::optional<double> target_frame_rate_;
+  std::optional<double> max_frame_rate_;
+  bool hidden_ = false;
+  // Capture time from which the next frame is delivered, if a frame was
+  // delivered since the settings last changed.
+  std::optional<uint64_t> next_frame_time_us_;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_FRAME_THROTTLE_H_
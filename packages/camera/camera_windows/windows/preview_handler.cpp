@@ -18,6 +18,7 @@ using Microsoft::WRL::ComPtr;
 
 // Initializes media type for video preview.
 HRESULT BuildMediaTypeForVideoPreview(IMFMediaType* src_media_type,
+                                      PreviewPixelFormat pixel_format,
                                       IMFMediaType** preview_media_type) {
   assert(src_media_type);
   ComPtr<IMFMediaType> new_media_type;
@@ -33,8 +34,13 @@ HRESULT BuildMediaTypeForVideoPreview(IMFMediaType* src_media_type,
     return hr;
   }
 
-  // Changes subtype to MFVideoFormat_RGB32.
-  hr = new_media_type->SetGUID(MF_MT_SUBTYPE, MFVideoFormat_RGB32);
+  // Changes subtype to MFVideoFormat_NV12 or MFVideoFormat_RGB32. NV12
+  // samples skip the color conversion of the capture engine and are
+  // converted while rendering the preview texture instead.
+  hr = new_media_type->SetGUID(MF_MT_SUBTYPE,
+                               pixel_format == PreviewPixelFormat::kNV12
+                                   ? MFVideoFormat_NV12
+                                   : MFVideoFormat_RGB32);
   if (FAILED(hr)) {
     return hr;
   }
@@ -51,7 +57,7 @@ HRESULT BuildMediaTypeForVideoPreview(IMFMediaType* src_media_type,
 
 HRESULT PreviewHandler::InitPreviewSink(
     IMFCaptureEngine* capture_engine, IMFMediaType* base_media_type,
-    CaptureEngineListener* sample_callback) {
+    CaptureEngineListener* sample_callback, PreviewPixelFormat pixel_format) {
   assert(capture_engine);
   assert(base_media_type);
   assert(sample_callback);
@@ -85,7 +91,7 @@ HRESULT PreviewHandler::InitPreviewSink(
     return hr;
   }
 
-  hr = BuildMediaTypeForVideoPreview(base_media_type,
+  hr = BuildMediaTypeForVideoPreview(base_media_type, pixel_format,
                                      preview_media_type.GetAddressOf());
 
   if (FAILED(hr)) {
@@ -110,17 +116,20 @@ HRESULT PreviewHandler::InitPreviewSink(
     return hr;
   }
 
+  preview_sink_stream_index_ = preview_sink_stream_index;
+  preview_media_type_ = preview_media_type;
   return hr;
 }
 
 HRESULT PreviewHandler::StartPreview(IMFCaptureEngine* capture_engine,
                                      IMFMediaType* base_media_type,
-                                     CaptureEngineListener* sample_callback) {
+                                     CaptureEngineListener* sample_callback,
+                                     PreviewPixelFormat pixel_format) {
   assert(capture_engine);
   assert(base_media_type);
 
-  HRESULT hr =
-      InitPreviewSink(capture_engine, base_media_type, sample_callback);
+  HRESULT hr = InitPreviewSink(capture_engine, base_media_type,
+                               sample_callback, pixel_format);
 
   if (FAILED(hr)) {
     return hr;
@@ -140,6 +149,41 @@ HRESULT PreviewHandler::StopPreview(IMFCaptureEngine* capture_engine) {
   return E_FAIL;
 }
 
+HRESULT PreviewHandler::SetPreviewFrameSize(uint32_t width, uint32_t height) {
+  if (preview_state_ != PreviewState::kRunning || !preview_sink_ ||
+      !preview_media_type_) {
+    return E_FAIL;
+  }
+
+  ComPtr<IMFCaptureSink2> preview_sink2;
+  HRESULT hr = preview_sink_.As(&preview_sink2);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IMFMediaType> media_type;
+  hr = MFCreateMediaType(&media_type);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = preview_media_type_->CopyAllItems(media_type.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = MFSetAttributeSize(media_type.Get(), MF_MT_FRAME_SIZE, width, height);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Stride of the base media type does not match the new size.
+  media_type->DeleteItem(MF_MT_DEFAULT_STRIDE);
+
+  return preview_sink2->SetOutputMediaType(preview_sink_stream_index_,
+                                           media_type.Get(), nullptr);
+}
+
 bool PreviewHandler::PausePreview() {
   if (preview_state_ != PreviewState::kRunning) {
     return false;
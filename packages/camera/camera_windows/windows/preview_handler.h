@@ -13,6 +13,7 @@
 #include <string>
 
 #include "capture_engine_listener.h"
+#include "pixel_conversion.h"
 
 namespace camera_windows {
 using Microsoft::WRL::ComPtr;
@@ -30,6 +31,12 @@ enum class PreviewState {
   kStopping
 };
 
+// Builds the media type of the preview samples from a native media type of
+// the camera, with the subtype of |pixel_format|.
+HRESULT BuildMediaTypeForVideoPreview(IMFMediaType* src_media_type,
+                                      PreviewPixelFormat pixel_format,
+                                      IMFMediaType** preview_media_type);
+
 // Handler for a camera's video preview.
 //
 // Handles preview sink initialization and manages the state of the video
@@ -52,9 +59,11 @@ class PreviewHandler {
   //                  for the actual video capture media type.
   // sample_callback: A pointer to capture engine listener.
   //                  This is set as sample callback for preview sink.
+  // pixel_format:    Pixel format of the preview samples.
   HRESULT StartPreview(IMFCaptureEngine* capture_engine,
                        IMFMediaType* base_media_type,
-                       CaptureEngineListener* sample_callback);
+                       CaptureEngineListener* sample_callback,
+                       PreviewPixelFormat pixel_format);
 
   // Stops existing recording.
   //
@@ -62,6 +71,14 @@ class PreviewHandler {
   //                  the ongoing recording.
   HRESULT StopPreview(IMFCaptureEngine* capture_engine);
 
+  // Changes the frame size of the preview sink output while the preview is
+  // running. The new size applies to samples after the
+  // MF_CAPTURE_ENGINE_OUTPUT_MEDIA_TYPE_SET synchronized event.
+  //
+  // width:  New frame width, not larger than the base media type.
+  // height: New frame height, not larger than the base media type.
+  HRESULT SetPreviewFrameSize(uint32_t width, uint32_t height);
+
   // Set the preview handler recording state to: paused.
   bool PausePreview();
 
@@ -90,10 +107,13 @@ class PreviewHandler {
   // Initializes record sink for video file capture.
   HRESULT InitPreviewSink(IMFCaptureEngine* capture_engine,
                           IMFMediaType* base_media_type,
-                          CaptureEngineListener* sample_callback);
+                          CaptureEngineListener* sample_callback,
+                          PreviewPixelFormat pixel_format);
 
   PreviewState preview_state_ = PreviewState::kNotStarted;
+  DWORD preview_sink_stream_index_ = 0;
   ComPtr<IMFCapturePreviewSink> preview_sink_;
+  ComPtr<IMFMediaType> preview_media_type_;
 };
 
 }  // namespace camera_windows
@@ -0,0 +1,188 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_stats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "tracing.h"
+
+namespace camera_windows {
+
+namespace {
+
+// Returns the nearest-rank percentile of the sorted values.
+uint64_t GetPercentile(const std::vector<uint64_t>& sorted_values,
+                       size_t percentile) {
+  if (sorted_values.empty()) {
+    return 0;
+  }
+  size_t rank = (percentile * sorted_values.size() + 99) / 100;
+  return sorted_values[rank > 0 ? rank - 1 : 0];
+}
+
+// Returns the sorted values of the first |count| entries of a window.
+std::vector<uint64_t> GetSortedWindow(
+    const std::array<uint64_t, PreviewStats::kFrameWindowSize>& window,
+    uint64_t count) {
+  const size_t size = count < PreviewStats::kFrameWindowSize
+                          ? static_cast<size_t>(count)
+                          : PreviewStats::kFrameWindowSize;
+  std::vector<uint64_t> values(window.begin(), window.begin() + size);
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+// Returns the rate of |count| events spread over the given time span.
+double GetFrameRate(uint64_t count, uint64_t first_time_us,
+                    uint64_t last_time_us) {
+  if (count < 2 || last_time_us <= first_time_us) {
+    return 0.0;
+  }
+  return static_cast<double>(count - 1) * 1000000.0 /
+         static_cast<double>(last_time_us - first_time_us);
+}
+
+}  // namespace
+
+PreviewStats::PreviewStats() { RegisterTraceProvider(); }
+
+PreviewStats::~PreviewStats() { UnregisterTraceProvider(); }
+
+// static
+uint64_t PreviewStats::GetTimeUs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+uint64_t PreviewStats::OnFrameReceived(uint64_t capture_time_us,
+                                       uint64_t time_us) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (last_frame_id_ > 0) {
+    const FrameRecord& last = records_[last_frame_id_ % kFrameWindowSize];
+    if (last.capture_time_us == capture_time_us) {
+      return last_frame_id_;
+    }
+  }
+
+  last_frame_id_++;
+  FrameRecord& record = records_[last_frame_id_ % kFrameWindowSize];
+  record = FrameRecord();
+  record.frame_id = last_frame_id_;
+  record.capture_time_us = capture_time_us;
+  record.received_time_us = time_us;
+  return last_frame_id_;
+}
+
+uint64_t PreviewStats::GetLastReceivedFrameId() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return last_frame_id_;
+}
+
+void PreviewStats::OnFrameRendered(uint64_t frame_id, uint64_t time_us) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Flutter reads the same frame again if no newer frame is available.
+  if (frame_id <= last_rendered_frame_id_) {
+    return;
+  }
+
+  const uint64_t dropped = frame_id - last_rendered_frame_id_ - 1;
+  if (dropped > 0) {
+    dropped_frame_count_ += dropped;
+    TraceLoggingWrite(g_camera_trace_provider, "PreviewFramesDropped",
+                      TraceLoggingUInt64(frame_id, "FrameId"),
+                      TraceLoggingUInt64(dropped, "DroppedFrameCount"));
+  }
+  last_rendered_frame_id_ = frame_id;
+
+  FrameRecord* record = GetRecord(frame_id);
+  if (record) {
+    record->rendered_time_us = time_us;
+  }
+  rendered_times_us_[rendered_frame_count_ % kFrameWindowSize] = time_us;
+  rendered_frame_count_++;
+}
+
+void PreviewStats::OnFrameReleased(uint64_t frame_id, uint64_t time_us) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  FrameRecord* record = GetRecord(frame_id);
+  if (!record || record->rendered_time_us == 0 ||
+      record->released_time_us != 0) {
+    return;
+  }
+  record->released_time_us = time_us;
+
+  latencies_us_[released_frame_count_ % kFrameWindowSize] =
+      time_us - record->received_time_us;
+  released_frame_count_++;
+
+  TraceLoggingWrite(
+      g_camera_trace_provider, "PreviewFrame",
+      TraceLoggingUInt64(record->frame_id, "FrameId"),
+      TraceLoggingUInt64(record->capture_time_us, "CaptureTimeUs"),
+      TraceLoggingUInt64(record->received_time_us, "ReceivedTimeUs"),
+      TraceLoggingUInt64(record->rendered_time_us, "RenderedTimeUs"),
+      TraceLoggingUInt64(record->released_time_us, "ReleasedTimeUs"));
+}
+
+void PreviewStats::OnFrameConverted(uint64_t duration_us) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  conversion_times_us_[converted_frame_count_ % kFrameWindowSize] =
+      duration_us;
+  converted_frame_count_++;
+}
+
+PreviewStatsSnapshot PreviewStats::GetSnapshot() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  PreviewStatsSnapshot snapshot;
+  snapshot.received_frame_count = last_frame_id_;
+  snapshot.rendered_frame_count = rendered_frame_count_;
+  snapshot.dropped_frame_count = dropped_frame_count_;
+
+  // Records of the most recent frames, in the order they were received.
+  const uint64_t received_window = last_frame_id_ < kFrameWindowSize
+                                       ? last_frame_id_
+                                       : kFrameWindowSize;
+  if (received_window > 0) {
+    const uint64_t first_id = last_frame_id_ - received_window + 1;
+    snapshot.capture_frame_rate = GetFrameRate(
+        received_window,
+        records_[first_id % kFrameWindowSize].capture_time_us,
+        records_[last_frame_id_ % kFrameWindowSize].capture_time_us);
+  }
+
+  const uint64_t rendered_window = rendered_frame_count_ < kFrameWindowSize
+                                       ? rendered_frame_count_
+                                       : kFrameWindowSize;
+  if (rendered_window > 0) {
+    const uint64_t first = rendered_frame_count_ - rendered_window;
+    snapshot.render_frame_rate = GetFrameRate(
+        rendered_window, rendered_times_us_[first % kFrameWindowSize],
+        rendered_times_us_[(rendered_frame_count_ - 1) % kFrameWindowSize]);
+  }
+
+  const std::vector<uint64_t> latencies =
+      GetSortedWindow(latencies_us_, released_frame_count_);
+  snapshot.latency_p50_us = GetPercentile(latencies, 50);
+  snapshot.latency_p95_us = GetPercentile(latencies, 95);
+  snapshot.latency_p99_us = GetPercentile(latencies, 99);
+
+  const std::vector<uint64_t> conversion_times =
+      GetSortedWindow(conversion_times_us_, converted_frame_count_);
+  snapshot.conversion_p50_us = GetPercentile(conversion_times, 50);
+  snapshot.conversion_p95_us = GetPercentile(conversion_times, 95);
+  snapshot.conversion_p99_us = GetPercentile(conversion_times, 99);
+  return snapshot;
+}
+
+PreviewStats::FrameRecord* PreviewStats::GetRecord(uint64_t frame_id) {
+  FrameRecord& record = records_[frame_id % kFrameWindowSize];
+  return record.frame_id == frame_id && frame_id != 0 ? &record : nullptr;
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,121 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_STATS_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_STATS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace camera_windows {
+
+// Aggregated preview pipeline statistics, returned by
+// |PreviewStats::GetSnapshot|.
+struct PreviewStatsSnapshot {
+  // Number of frames delivered to the preview.
+  uint64_t received_frame_count = 0;
+
+  // Number of frames read by Flutter.
+  uint64_t rendered_frame_count = 0;
+
+  // Number of frames replaced by a newer frame before Flutter read them.
+  uint64_t dropped_frame_count = 0;
+
+  // Frame rates over the recent frames, from the capture timestamps and from
+  // the times Flutter read the frames.
+  double capture_frame_rate = 0.0;
+  double render_frame_rate = 0.0;
+
+  // Latency percentiles over the recent frames, in microseconds, from the
+  // time a frame is delivered to the preview to the time Flutter releases it.
+  uint64_t latency_p50_us = 0;
+  uint64_t latency_p95_us = 0;
+  uint64_t latency_p99_us = 0;
+
+  // Conversion time percentiles over the recent frames, in microseconds,
+  // spent by the texture handler converting a frame into the texture.
+  uint64_t conversion_p50_us = 0;
+  uint64_t conversion_p95_us = 0;
+  uint64_t conversion_p99_us = 0;
+};
+
+// Records the timing of each preview frame through the preview pipeline, and
+// writes it as a TraceLogging event of the "Flutter.Camera.Windows" provider.
+//
+// Frames are received on the sample thread, rendered and released on the
+// raster thread, and snapshots are taken on the platform thread.
+class PreviewStats {
+ public:
+  // Number of recent frames used for the frame rates and percentiles.
+  static constexpr size_t kFrameWindowSize = 240;
+
+  PreviewStats();
+  virtual ~PreviewStats();
+
+  // Prevent copying.
+  PreviewStats(PreviewStats const&) = delete;
+  PreviewStats& operator=(PreviewStats const&) = delete;
+
+  // Returns a monotonic time in microseconds, used for all times passed to
+  // this class.
+  static uint64_t GetTimeUs();
+
+  // Records a frame delivered to the preview and returns its frame id.
+  //
+  // A frame with the same capture time as the previous frame is the same
+  // sample delivered through another path, and keeps its frame id.
+  //
+  // capture_time_us: Presentation time of the sample in microseconds.
+  // time_us:         Time the sample was delivered to the preview.
+  uint64_t OnFrameReceived(uint64_t capture_time_us, uint64_t time_us);
+
+  // Returns the id of the frame last passed to |OnFrameReceived|, or 0 if no
+  // frame was received yet.
+  uint64_t GetLastReceivedFrameId() const;
+
+  // Records the time Flutter read the frame with the given id. Frames
+  // received earlier that were never read are counted as dropped.
+  void OnFrameRendered(uint64_t frame_id, uint64_t time_us);
+
+  // Records the time Flutter released the frame with the given id.
+  void OnFrameReleased(uint64_t frame_id, uint64_t time_us);
+
+  // Records the time the texture handler spent converting a frame into the
+  // texture.
+  void OnFrameConverted(uint64_t duration_us);
+
+  // Returns the statistics aggregated since this instance was created.
+  PreviewStatsSnapshot GetSnapshot() const;
+
+ private:
+  // Timing of a single frame. Times are 0 until the frame reaches the stage.
+  struct FrameRecord {
+    uint64_t frame_id = 0;
+    uint64_t capture_time_us = 0;
+    uint64_t received_time_us = 0;
+    uint64_t rendered_time_us = 0;
+    uint64_t released_time_us = 0;
+  };
+
+  // Returns the record of the given frame, or nullptr if it was overwritten.
+  FrameRecord* GetRecord(uint64_t frame_id);
+
+  mutable std::mutex mutex_;
+  std::array<FrameRecord, kFrameWindowSize> records_;
+  std::array<uint64_t, kFrameWindowSize> latencies_us_ = {};
+  std::array<uint64_t, kFrameWindowSize> rendered_times_us_ = {};
+  std::array<uint64_t, kFrameWindowSize> conversion_times_us_ = {};
+  uint64_t last_frame_id_ = 0;
+  uint64_t last_rendered_frame_id_ = 0;
+  uint64_t released_frame_count_ = 0;
+  uint64_t rendered_frame_count_ = 0;
+  uint64_t dropped_frame_count_ = 0;
+  uint64_t converted_frame_count_ = 0;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_PREVIEW_STATS_H_
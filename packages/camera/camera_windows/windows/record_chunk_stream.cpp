@@ -0,0 +1,196 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "record_chunk_stream.h"
+
+#include <mfapi.h>
+
+#include <cassert>
+#include <utility>
+
+namespace camera_windows {
+
+using Microsoft::WRL::ComPtr;
+
+namespace {
+
+// Attribute of the result object of |RecordChunkStream::BeginWrite|, holding
+// the number of written bytes.
+// {c1f2d5a8-58a4-4f1e-9a4b-3f0b3e4a2c71}
+constexpr GUID kBytesWrittenAttribute = {
+    0xc1f2d5a8,
+    0x58a4,
+    0x4f1e,
+    {0x9a, 0x4b, 0x3f, 0x0b, 0x3e, 0x4a, 0x2c, 0x71}};
+
+}  // namespace
+
+RecordChunkStream::RecordChunkStream(IMFByteStream* stream,
+                                     RecordChunkCallback callback)
+    : stream_(stream), callback_(std::move(callback)) {
+  assert(stream);
+}
+
+void RecordChunkStream::Detach() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  callback_ = nullptr;
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG) RecordChunkStream::AddRef() {
+  return InterlockedIncrement(&ref_);
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG)
+RecordChunkStream::Release() {
+  LONG ref = InterlockedDecrement(&ref_);
+  if (ref == 0) {
+    delete this;
+  }
+  return ref;
+}
+
+// IUnknown
+STDMETHODIMP_(HRESULT)
+RecordChunkStream::QueryInterface(const IID& riid, void** ppv) {
+  *ppv = nullptr;
+
+  if (riid == IID_IMFByteStream || riid == IID_IUnknown) {
+    *ppv = static_cast<IMFByteStream*>(this);
+    ((IUnknown*)*ppv)->AddRef();
+    return S_OK;
+  }
+
+  return E_NOINTERFACE;
+}
+
+STDMETHODIMP RecordChunkStream::GetCapabilities(DWORD* pdwCapabilities) {
+  return stream_->GetCapabilities(pdwCapabilities);
+}
+
+STDMETHODIMP RecordChunkStream::GetLength(QWORD* pqwLength) {
+  return stream_->GetLength(pqwLength);
+}
+
+STDMETHODIMP RecordChunkStream::SetLength(QWORD qwLength) {
+  return stream_->SetLength(qwLength);
+}
+
+STDMETHODIMP RecordChunkStream::GetCurrentPosition(QWORD* pqwPosition) {
+  return stream_->GetCurrentPosition(pqwPosition);
+}
+
+STDMETHODIMP RecordChunkStream::SetCurrentPosition(QWORD qwPosition) {
+  return stream_->SetCurrentPosition(qwPosition);
+}
+
+STDMETHODIMP RecordChunkStream::IsEndOfStream(BOOL* pfEndOfStream) {
+  return stream_->IsEndOfStream(pfEndOfStream);
+}
+
+STDMETHODIMP RecordChunkStream::Read(BYTE* pb, ULONG cb, ULONG* pcbRead) {
+  return stream_->Read(pb, cb, pcbRead);
+}
+
+STDMETHODIMP RecordChunkStream::BeginRead(BYTE* pb, ULONG cb,
+                                          IMFAsyncCallback* pCallback,
+                                          IUnknown* punkState) {
+  return stream_->BeginRead(pb, cb, pCallback, punkState);
+}
+
+STDMETHODIMP RecordChunkStream::EndRead(IMFAsyncResult* pResult,
+                                        ULONG* pcbRead) {
+  return stream_->EndRead(pResult, pcbRead);
+}
+
+STDMETHODIMP RecordChunkStream::Write(const BYTE* pb, ULONG cb,
+                                      ULONG* pcbWritten) {
+  assert(pcbWritten);
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  QWORD offset = 0;
+  HRESULT hr = stream_->GetCurrentPosition(&offset);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = stream_->Write(pb, cb, pcbWritten);
+  if (SUCCEEDED(hr) && *pcbWritten > 0 && callback_) {
+    callback_(offset, pb, *pcbWritten);
+  }
+  return hr;
+}
+
+STDMETHODIMP RecordChunkStream::BeginWrite(const BYTE* pb, ULONG cb,
+                                           IMFAsyncCallback* pCallback,
+                                           IUnknown* punkState) {
+  ComPtr<IMFAttributes> write_result;
+  HRESULT hr = MFCreateAttributes(&write_result, 1);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ULONG written = 0;
+  HRESULT write_hr = Write(pb, cb, &written);
+  hr = write_result->SetUINT32(kBytesWrittenAttribute, written);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IMFAsyncResult> async_result;
+  hr = MFCreateAsyncResult(write_result.Get(), pCallback, punkState,
+                           &async_result);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  async_result->SetStatus(write_hr);
+  return MFInvokeCallback(async_result.Get());
+}
+
+STDMETHODIMP RecordChunkStream::EndWrite(IMFAsyncResult* pResult,
+                                         ULONG* pcbWritten) {
+  assert(pResult);
+  assert(pcbWritten);
+  *pcbWritten = 0;
+
+  HRESULT hr = pResult->GetStatus();
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IUnknown> object;
+  hr = pResult->GetObject(&object);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IMFAttributes> write_result;
+  hr = object.As(&write_result);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  UINT32 written = 0;
+  hr = write_result->GetUINT32(kBytesWrittenAttribute, &written);
+  if (SUCCEEDED(hr)) {
+    *pcbWritten = written;
+  }
+  return hr;
+}
+
+STDMETHODIMP RecordChunkStream::Seek(MFBYTESTREAM_SEEK_ORIGIN SeekOrigin,
+                                     LONGLONG llSeekOffset, DWORD dwSeekFlags,
+                                     QWORD* pqwCurrentPosition) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stream_->Seek(SeekOrigin, llSeekOffset, dwSeekFlags,
+                       pqwCurrentPosition);
+}
+
+STDMETHODIMP RecordChunkStream::Flush() { return stream_->Flush(); }
+
+STDMETHODIMP RecordChunkStream::Close() { return stream_->Close(); }
+
+}  // namespace camera_windows
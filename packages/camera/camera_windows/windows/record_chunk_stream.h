@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_RECORD_CHUNK_STREAM_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_RECORD_CHUNK_STREAM_H_
+
+#include <mfapi.h>
+#include <mfidl.h>
+#include <wrl/client.h>
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+// Called with each chunk written to a recording, at its byte offset in the
+// recorded file.
+//
+// Chunks are usually written sequentially. A chunk at an offset before the
+// end of the previously written data overwrites that data.
+using RecordChunkCallback =
+    std::function<void(uint64_t offset, const uint8_t* data, uint32_t size)>;
+
+// A byte stream that writes to another byte stream, and passes each written
+// chunk to a |RecordChunkCallback|.
+//
+// Asynchronous writes are completed synchronously, so that the chunk is
+// passed to the callback before the writer is notified.
+class RecordChunkStream : public IMFByteStream {
+ public:
+  RecordChunkStream(IMFByteStream* stream, RecordChunkCallback callback);
+
+  ~RecordChunkStream() {}
+
+  // Disallow copy and move.
+  RecordChunkStream(const RecordChunkStream&) = delete;
+  RecordChunkStream& operator=(const RecordChunkStream&) = delete;
+
+  // Stops passing chunks to the callback, as the sink writer may keep the
+  // stream alive after the owner of the callback is destroyed.
+  void Detach();
+
+  // IUnknown
+  STDMETHODIMP_(ULONG) AddRef();
+  STDMETHODIMP_(ULONG) Release();
+  STDMETHODIMP_(HRESULT) QueryInterface(const IID& riid, void** ppv);
+
+  // IMFByteStream
+  STDMETHODIMP GetCapabilities(DWORD* pdwCapabilities);
+  STDMETHODIMP GetLength(QWORD* pqwLength);
+  STDMETHODIMP SetLength(QWORD qwLength);
+  STDMETHODIMP GetCurrentPosition(QWORD* pqwPosition);
+  STDMETHODIMP SetCurrentPosition(QWORD qwPosition);
+  STDMETHODIMP IsEndOfStream(BOOL* pfEndOfStream);
+  STDMETHODIMP Read(BYTE* pb, ULONG cb, ULONG* pcbRead);
+  STDMETHODIMP BeginRead(BYTE* pb, ULONG cb, IMFAsyncCallback* pCallback,
+                         IUnknown* punkState);
+  STDMETHODIMP EndRead(IMFAsyncResult* pResult, ULONG* pcbRead);
+  STDMETHODIMP Write(const BYTE* pb, ULONG cb, ULONG* pcbWritten);
+  STDMETHODIMP BeginWrite(const BYTE* pb, ULONG cb,
+                          IMFAsyncCallback* pCallback, IUnknown* punkState);
+  STDMETHODIMP EndWrite(IMFAsyncResult* pResult, ULONG* pcbWritten);
+  STDMETHODIMP Seek(MFBYTESTREAM_SEEK_ORIGIN SeekOrigin,
+                    LONGLONG llSeekOffset, DWORD dwSeekFlags,
+                    QWORD* pqwCurrentPosition);
+  STDMETHODIMP Flush();
+  STDMETHODIMP Close();
+
+ private:
+  std::mutex mutex_;
+  ComPtr<IMFByteStream> stream_;
+  RecordChunkCallback callback_;
+  volatile ULONG ref_ = 0;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_RECORD_CHUNK_STREAM_H_
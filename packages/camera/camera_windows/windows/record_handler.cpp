@@ -4,17 +4,107 @@
 
 #include "record_handler.h"
 
+#include <codecapi.h>
 #include <mfapi.h>
 #include <mfcaptureengine.h>
+#include <mferror.h>
+#include <strmif.h>
 
+#include <algorithm>
 #include <cassert>
 
-#include "string_utils.h"
+#include "audio_media_type_cache.h"
 
 namespace camera_windows {
 
 using Microsoft::WRL::ComPtr;
 
+std::string GetProxyFilePath(const std::string& file_path) {
+  const size_t name_start = file_path.find_last_of("\\/");
+  const size_t extension_start = file_path.find_last_of('.');
+  if (extension_start == std::string::npos ||
+      (name_start != std::string::npos && extension_start < name_start)) {
+    return file_path + "_proxy";
+  }
+  return file_path.substr(0, extension_start) + "_proxy" +
+         file_path.substr(extension_start);
+}
+
+void GetProxyFrameSize(uint32_t width, uint32_t height, uint32_t proxy_height,
+                       uint32_t* scaled_width, uint32_t* scaled_height) {
+  assert(scaled_width);
+  assert(scaled_height);
+
+  if (height == 0 || proxy_height >= height) {
+    *scaled_width = width;
+    *scaled_height = height;
+    return;
+  }
+
+  // Keeps the aspect ratio, rounded down to even dimensions.
+  const uint64_t scaled = (static_cast<uint64_t>(width) * proxy_height +
+                           height / 2) /
+                          height;
+  *scaled_width = std::max<uint32_t>(2, static_cast<uint32_t>(scaled) & ~1u);
+  *scaled_height = std::max<uint32_t>(2, proxy_height & ~1u);
+}
+
+void RecordSampleListener::Detach() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  handler_ = nullptr;
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG) RecordSampleListener::AddRef() {
+  return InterlockedIncrement(&ref_);
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG)
+RecordSampleListener::Release() {
+  LONG ref = InterlockedDecrement(&ref_);
+  if (ref == 0) {
+    delete this;
+  }
+  return ref;
+}
+
+// IUnknown
+STDMETHODIMP_(HRESULT)
+RecordSampleListener::QueryInterface(const IID& riid, void** ppv) {
+  *ppv = nullptr;
+
+  if (riid == IID_IMFCaptureEngineOnSampleCallback ||
+      riid == IID_IUnknown) {
+    *ppv = static_cast<IMFCaptureEngineOnSampleCallback*>(this);
+    ((IUnknown*)*ppv)->AddRef();
+    return S_OK;
+  }
+
+  return E_NOINTERFACE;
+}
+
+// IMFCaptureEngineOnSampleCallback
+HRESULT RecordSampleListener::OnSample(IMFSample* sample) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (handler_ && sample) {
+    handler_->OnRecordSample(stream_, sample);
+  }
+  return S_OK;
+}
+
+RecordHandler::~RecordHandler() {
+  if (video_sample_listener_) {
+    video_sample_listener_->Detach();
+  }
+  if (audio_sample_listener_) {
+    audio_sample_listener_->Detach();
+  }
+  if (proxy_video_sample_listener_) {
+    proxy_video_sample_listener_->Detach();
+  }
+}
+
 // Initializes media type for video capture.
 HRESULT BuildMediaTypeForVideoCapture(IMFMediaType* src_media_type,
                                       IMFMediaType** video_record_media_type,
@@ -42,70 +132,182 @@ HRESULT BuildMediaTypeForVideoCapture(IMFMediaType* src_media_type,
   return S_OK;
 }
 
-// Queries interface object from collection.
-template <class Q>
-HRESULT GetCollectionObject(IMFCollection* pCollection, DWORD index,
-                            Q** ppObj) {
-  ComPtr<IUnknown> pUnk;
-  HRESULT hr = pCollection->GetElement(index, pUnk.GetAddressOf());
+// Returns true if a video encoder producing |subtype| is registered.
+//
+// hardware_only: If true, only hardware encoders are considered.
+bool HasVideoEncoder(const GUID& subtype, bool hardware_only) {
+  MFT_REGISTER_TYPE_INFO output_type = {MFMediaType_Video, subtype};
+  UINT32 mft_flags =
+      (hardware_only ? MFT_ENUM_FLAG_HARDWARE
+                     : (MFT_ENUM_FLAG_ALL & (~MFT_ENUM_FLAG_FIELDOFUSE))) |
+      MFT_ENUM_FLAG_SORTANDFILTER;
+
+  IMFActivate** activates = nullptr;
+  UINT32 count = 0;
+  HRESULT hr = MFTEnumEx(MFT_CATEGORY_VIDEO_ENCODER, mft_flags, nullptr,
+                         &output_type, &activates, &count);
   if (FAILED(hr)) {
-    return hr;
+    return false;
+  }
+
+  for (UINT32 i = 0; i < count; i++) {
+    activates[i]->Release();
   }
-  return pUnk->QueryInterface(IID_PPV_ARGS(ppObj));
+  CoTaskMemFree(activates);
+  return count > 0;
 }
 
-// Initializes media type for audo capture.
-HRESULT BuildMediaTypeForAudioCapture(IMFMediaType** audio_record_media_type) {
-  ComPtr<IMFAttributes> audio_output_attributes;
-  ComPtr<IMFMediaType> src_media_type;
-  ComPtr<IMFMediaType> new_media_type;
-  ComPtr<IMFCollection> available_output_types;
-  DWORD mt_count = 0;
+// Returns the media subtype recordings are encoded to.
+//
+// HEVC encoders are not available on all systems, so recordings fall back to
+// H.264 if no suitable HEVC encoder is registered.
+GUID GetVideoRecordFormat(const VideoRecordSettings& settings) {
+  if (settings.codec == VideoCodec::kHEVC &&
+      HasVideoEncoder(MFVideoFormat_HEVC, settings.prefer_hardware_encoder)) {
+    return MFVideoFormat_HEVC;
+  }
+  return MFVideoFormat_H264;
+}
 
-  HRESULT hr = MFCreateAttributes(&audio_output_attributes, 1);
+// Builds the encoder attributes passed to the record sink for the video
+// stream.
+HRESULT BuildVideoEncoderAttributes(const VideoRecordSettings& settings,
+                                    IMFAttributes** encoder_attributes) {
+  ComPtr<IMFAttributes> attributes;
+  HRESULT hr = MFCreateAttributes(&attributes, 4);
   if (FAILED(hr)) {
     return hr;
   }
 
-  // Enumerates only low latency audio outputs.
-  hr = audio_output_attributes->SetUINT32(MF_LOW_LATENCY, TRUE);
+  switch (settings.rate_control_mode) {
+    case VideoRateControlMode::kConstantBitrate:
+      hr = attributes->SetUINT32(CODECAPI_AVEncCommonRateControlMode,
+                                 eAVEncCommonRateControlMode_CBR);
+      break;
+    case VideoRateControlMode::kVariableBitrate:
+      hr = attributes->SetUINT32(CODECAPI_AVEncCommonRateControlMode,
+                                 eAVEncCommonRateControlMode_UnconstrainedVBR);
+      break;
+    case VideoRateControlMode::kQuality:
+      hr = attributes->SetUINT32(CODECAPI_AVEncCommonRateControlMode,
+                                 eAVEncCommonRateControlMode_Quality);
+      if (SUCCEEDED(hr) && settings.quality > 0) {
+        hr = attributes->SetUINT32(CODECAPI_AVEncCommonQuality,
+                                   settings.quality);
+      }
+      break;
+    case VideoRateControlMode::kDefault:
+      break;
+  }
   if (FAILED(hr)) {
     return hr;
   }
 
-  DWORD mft_flags = (MFT_ENUM_FLAG_ALL & (~MFT_ENUM_FLAG_FIELDOFUSE)) |
-                    MFT_ENUM_FLAG_SORTANDFILTER;
+  if (settings.bitrate > 0) {
+    hr = attributes->SetUINT32(CODECAPI_AVEncCommonMeanBitRate,
+                               settings.bitrate);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  if (settings.keyframe_interval > 0) {
+    hr = attributes->SetUINT32(CODECAPI_AVEncMPVGOPSize,
+                               settings.keyframe_interval);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  attributes.CopyTo(encoder_attributes);
+  return S_OK;
+}
 
-  hr = MFTranscodeGetAudioOutputAvailableTypes(
-      MFAudioFormat_AAC, mft_flags, audio_output_attributes.Get(),
-      available_output_types.GetAddressOf());
+// Copies |sample| into a new sample sharing its buffers, so that the copy
+// can be written with its own timestamp.
+HRESULT CopySample(IMFSample* sample, IMFSample** sample_copy) {
+  ComPtr<IMFSample> new_sample;
+  HRESULT hr = MFCreateSample(&new_sample);
   if (FAILED(hr)) {
     return hr;
   }
 
-  hr = GetCollectionObject(available_output_types.Get(), 0,
-                           src_media_type.GetAddressOf());
+  hr = sample->CopyAllItems(new_sample.Get());
   if (FAILED(hr)) {
     return hr;
   }
 
-  hr = available_output_types->GetElementCount(&mt_count);
+  DWORD buffer_count = 0;
+  hr = sample->GetBufferCount(&buffer_count);
   if (FAILED(hr)) {
     return hr;
   }
 
-  if (mt_count == 0) {
+  for (DWORD i = 0; i < buffer_count; i++) {
+    ComPtr<IMFMediaBuffer> buffer;
+    hr = sample->GetBufferByIndex(i, &buffer);
+    if (FAILED(hr)) {
+      return hr;
+    }
+
+    hr = new_sample->AddBuffer(buffer.Get());
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  LONGLONG time = 0;
+  hr = sample->GetSampleTime(&time);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = new_sample->SetSampleTime(time);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  LONGLONG duration = 0;
+  if (SUCCEEDED(sample->GetSampleDuration(&duration))) {
+    hr = new_sample->SetSampleDuration(duration);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  new_sample.CopyTo(sample_copy);
+  return S_OK;
+}
+
+// Queries interface object from collection.
+// Initializes media type for audio capture.
+//
+// Returns MF_E_INVALIDMEDIATYPE if the encoder supports no AAC type matching
+// the audio settings of |settings|.
+HRESULT BuildMediaTypeForAudioCapture(const VideoRecordSettings& settings,
+                                      IMFMediaType** audio_record_media_type) {
+  std::shared_ptr<const AacMediaTypeCache::MediaTypeList> media_types =
+      AacMediaTypeCache::GetInstance().GetMediaTypes();
+  if (media_types->empty()) {
     // No sources found, mark process as failure.
     return E_FAIL;
   }
 
-  // Create new media type to copy original media type to.
-  hr = MFCreateMediaType(&new_media_type);
+  const AacMediaType* media_type = FindBestAacMediaType(
+      *media_types, settings.audio_sample_rate, settings.audio_channels,
+      settings.audio_bitrate);
+  if (!media_type) {
+    return MF_E_INVALIDMEDIATYPE;
+  }
+
+  // The cached media type is shared, so the record sink gets a copy.
+  ComPtr<IMFMediaType> new_media_type;
+  HRESULT hr = MFCreateMediaType(&new_media_type);
   if (FAILED(hr)) {
     return hr;
   }
 
-  hr = src_media_type->CopyAllItems(new_media_type.Get());
+  hr = media_type->media_type->CopyAllItems(new_media_type.Get());
   if (FAILED(hr)) {
     return hr;
   }
@@ -121,23 +323,50 @@ HRESULT RecordHandler::InitRecordSink(IMFCaptureEngine* capture_engine,
   assert(base_media_type);
 
   HRESULT hr = S_OK;
-  if (record_sink_) {
-    // If record sink already exists, only update output filename.
-    hr = record_sink_->SetOutputFileName(Utf16FromUtf8(file_path_).c_str());
-
+  if (!record_sink_ || record_sink_settings_changed_) {
+    hr = InitRecordSinkStreams(capture_engine, base_media_type);
     if (FAILED(hr)) {
       record_sink_ = nullptr;
+      return hr;
     }
-    return hr;
   }
 
+  // An existing record sink keeps its streams and sample callbacks, so only
+  // the writers of the new files are created.
+  std::lock_guard<std::mutex> lock(sample_writer_mutex_);
+  sample_writer_ = std::make_unique<RecordSampleWriter>(
+      file_path_, video_record_media_type_.Get(),
+      audio_record_media_type_.Get(),
+      settings_.stream_chunks ? chunk_callback_ : nullptr);
+  proxy_sample_writer_ = nullptr;
+  if (proxy_video_record_media_type_) {
+    proxy_sample_writer_ = std::make_unique<RecordSampleWriter>(
+        proxy_file_path_, proxy_video_record_media_type_.Get(),
+        audio_record_media_type_.Get());
+  }
+  record_stats_ = RecordSampleStats();
+
+  // Times of the sample writers are in 100-nanosecond units.
+  if (max_video_duration_ms_ > 0) {
+    const int64_t max_duration = max_video_duration_ms_ * 10000;
+    sample_writer_->SetMaxDuration(max_duration);
+    if (proxy_sample_writer_) {
+      proxy_sample_writer_->SetMaxDuration(max_duration);
+    }
+  }
+  return S_OK;
+}
+
+HRESULT RecordHandler::InitRecordSinkStreams(IMFCaptureEngine* capture_engine,
+                                             IMFMediaType* base_media_type) {
   ComPtr<IMFMediaType> video_record_media_type;
+  ComPtr<IMFAttributes> video_encoder_attributes;
   ComPtr<IMFCaptureSink> capture_sink;
 
   // Gets sink from capture engine with record type.
 
-  hr = capture_engine->GetSink(MF_CAPTURE_ENGINE_SINK_TYPE_RECORD,
-                               &capture_sink);
+  HRESULT hr = capture_engine->GetSink(MF_CAPTURE_ENGINE_SINK_TYPE_RECORD,
+                                       &capture_sink);
   if (FAILED(hr)) {
     return hr;
   }
@@ -152,59 +381,192 @@ HRESULT RecordHandler::InitRecordSink(IMFCaptureEngine* capture_engine,
   if (FAILED(hr)) {
     return hr;
   }
+  video_record_media_type_ = nullptr;
+  audio_record_media_type_ = nullptr;
+  proxy_video_record_media_type_ = nullptr;
 
   hr = BuildMediaTypeForVideoCapture(base_media_type,
                                      video_record_media_type.GetAddressOf(),
-                                     MFVideoFormat_H264);
+                                     GetVideoRecordFormat(settings_));
   if (FAILED(hr)) {
     return hr;
   }
 
-  DWORD video_record_sink_stream_index;
+  if (settings_.bitrate > 0) {
+    hr = video_record_media_type->SetUINT32(MF_MT_AVG_BITRATE,
+                                            settings_.bitrate);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  hr = BuildVideoEncoderAttributes(settings_,
+                                   video_encoder_attributes.GetAddressOf());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  video_record_sink_stream_index_ = 0;
   hr = record_sink_->AddStream(
       (DWORD)MF_CAPTURE_ENGINE_PREFERRED_SOURCE_STREAM_FOR_VIDEO_RECORD,
-      video_record_media_type.Get(), nullptr, &video_record_sink_stream_index);
+      video_record_media_type.Get(), video_encoder_attributes.Get(),
+      &video_record_sink_stream_index_);
   if (FAILED(hr)) {
     return hr;
   }
 
+  if (!video_sample_listener_) {
+    video_sample_listener_ =
+        new RecordSampleListener(this, RecordStream::kVideo);
+  }
+
+  hr = record_sink_->SetSampleCallback(video_record_sink_stream_index_,
+                                       video_sample_listener_.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+  video_record_media_type_ = video_record_media_type;
+
+  if (settings_.proxy_height > 0) {
+    hr = InitProxyRecordSinkStream(base_media_type);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
   if (record_audio_) {
     ComPtr<IMFMediaType> audio_record_media_type;
-    HRESULT audio_capture_hr = S_OK;
-    audio_capture_hr =
-        BuildMediaTypeForAudioCapture(audio_record_media_type.GetAddressOf());
+    HRESULT audio_capture_hr = BuildMediaTypeForAudioCapture(
+        settings_, audio_record_media_type.GetAddressOf());
+
+    // Recordings continue without audio if no audio encoder is available, but
+    // not with different audio settings than requested.
+    if (audio_capture_hr == MF_E_INVALIDMEDIATYPE) {
+      return audio_capture_hr;
+    }
 
     if (SUCCEEDED(audio_capture_hr)) {
-      DWORD audio_record_sink_stream_index;
+      DWORD audio_record_sink_stream_index = 0;
       hr = record_sink_->AddStream(
           (DWORD)MF_CAPTURE_ENGINE_PREFERRED_SOURCE_STREAM_FOR_AUDIO,
           audio_record_media_type.Get(), nullptr,
           &audio_record_sink_stream_index);
+      if (FAILED(hr)) {
+        return hr;
+      }
+
+      if (!audio_sample_listener_) {
+        audio_sample_listener_ =
+            new RecordSampleListener(this, RecordStream::kAudio);
+      }
+
+      hr = record_sink_->SetSampleCallback(audio_record_sink_stream_index,
+                                           audio_sample_listener_.Get());
+      if (FAILED(hr)) {
+        return hr;
+      }
+      audio_record_media_type_ = audio_record_media_type;
     }
+  }
 
-    if (FAILED(hr)) {
-      return hr;
-    }
+  return S_OK;
+}
+
+HRESULT RecordHandler::InitProxyRecordSinkStream(
+    IMFMediaType* base_media_type) {
+  ComPtr<IMFMediaType> proxy_media_type;
+  HRESULT hr = BuildMediaTypeForVideoCapture(
+      base_media_type, proxy_media_type.GetAddressOf(),
+      GetVideoRecordFormat(settings_));
+  if (FAILED(hr)) {
+    return hr;
   }
 
-  hr = record_sink_->SetOutputFileName(Utf16FromUtf8(file_path_).c_str());
+  UINT32 width = 0;
+  UINT32 height = 0;
+  hr = MFGetAttributeSize(base_media_type, MF_MT_FRAME_SIZE, &width, &height);
+  if (FAILED(hr)) {
+    return hr;
+  }
 
-  return hr;
+  // The capture engine scales the captured frames to the frame size of the
+  // stream before they reach its encoder.
+  uint32_t proxy_width = 0;
+  uint32_t proxy_height = 0;
+  GetProxyFrameSize(width, height, settings_.proxy_height, &proxy_width,
+                    &proxy_height);
+  hr = MFSetAttributeSize(proxy_media_type.Get(), MF_MT_FRAME_SIZE,
+                          proxy_width, proxy_height);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // The bitrate of the recording does not fit the smaller frames, so the
+  // encoder picks one unless a proxy bitrate is requested.
+  if (settings_.proxy_bitrate > 0) {
+    hr = proxy_media_type->SetUINT32(MF_MT_AVG_BITRATE,
+                                     settings_.proxy_bitrate);
+  } else {
+    hr = proxy_media_type->DeleteItem(MF_MT_AVG_BITRATE);
+  }
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  VideoRecordSettings proxy_settings = settings_;
+  proxy_settings.bitrate = settings_.proxy_bitrate;
+  ComPtr<IMFAttributes> proxy_encoder_attributes;
+  hr = BuildVideoEncoderAttributes(proxy_settings,
+                                   proxy_encoder_attributes.GetAddressOf());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Both video streams are fed from the same capture stream, so the frames
+  // are captured once.
+  proxy_video_record_sink_stream_index_ = 0;
+  hr = record_sink_->AddStream(
+      (DWORD)MF_CAPTURE_ENGINE_PREFERRED_SOURCE_STREAM_FOR_VIDEO_RECORD,
+      proxy_media_type.Get(), proxy_encoder_attributes.Get(),
+      &proxy_video_record_sink_stream_index_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  if (!proxy_video_sample_listener_) {
+    proxy_video_sample_listener_ =
+        new RecordSampleListener(this, RecordStream::kProxyVideo);
+  }
+
+  hr = record_sink_->SetSampleCallback(proxy_video_record_sink_stream_index_,
+                                       proxy_video_sample_listener_.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+  proxy_video_record_media_type_ = proxy_media_type;
+  return S_OK;
 }
 
 HRESULT RecordHandler::StartRecord(const std::string& file_path,
                                    int64_t max_duration,
                                    IMFCaptureEngine* capture_engine,
-                                   IMFMediaType* base_media_type) {
+                                   IMFMediaType* base_media_type,
+                                   const VideoRecordSettings& settings) {
   assert(!file_path.empty());
   assert(capture_engine);
   assert(base_media_type);
 
+  // Streams of an existing record sink are rebuilt if the settings changed.
+  record_sink_settings_changed_ = settings != settings_;
+  settings_ = settings;
+
   type_ = max_duration < 0 ? RecordingType::kContinuous : RecordingType::kTimed;
   max_video_duration_ms_ = max_duration;
   file_path_ = file_path;
-  recording_start_timestamp_us_ = -1;
+  proxy_file_path_ =
+      settings.proxy_height > 0 ? GetProxyFilePath(file_path) : "";
   recording_duration_us_ = 0;
+  max_duration_reached_ = false;
 
   HRESULT hr = InitRecordSink(capture_engine, base_media_type);
   if (FAILED(hr)) {
@@ -216,13 +578,162 @@ HRESULT RecordHandler::StartRecord(const std::string& file_path,
 }
 
 HRESULT RecordHandler::StopRecord(IMFCaptureEngine* capture_engine) {
-  if (recording_state_ == RecordState::kRunning) {
+  if (CanStop()) {
     recording_state_ = RecordState::kStopping;
     return capture_engine->StopRecord(true, false);
   }
   return E_FAIL;
 }
 
+HRESULT RecordHandler::PauseRecord() {
+  if (!CanPause()) {
+    return E_FAIL;
+  }
+
+  std::lock_guard<std::mutex> lock(sample_writer_mutex_);
+  if (sample_writer_) {
+    sample_writer_->Pause();
+  }
+  if (proxy_sample_writer_) {
+    proxy_sample_writer_->Pause();
+  }
+  recording_state_ = RecordState::kPaused;
+  return S_OK;
+}
+
+HRESULT RecordHandler::ResumeRecord() {
+  if (!CanResume()) {
+    return E_FAIL;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sample_writer_mutex_);
+    if (sample_writer_) {
+      sample_writer_->Resume();
+    }
+    if (proxy_sample_writer_) {
+      proxy_sample_writer_->Resume();
+    }
+  }
+  RequestKeyFrame(video_record_sink_stream_index_);
+  if (proxy_video_record_media_type_) {
+    RequestKeyFrame(proxy_video_record_sink_stream_index_);
+  }
+  recording_state_ = RecordState::kRunning;
+  return S_OK;
+}
+
+void RecordHandler::RequestKeyFrame(DWORD stream_index) {
+  if (!record_sink_) {
+    return;
+  }
+
+  // Not all encoders expose ICodecAPI through the record sink, in which case
+  // the recording resumes at the next scheduled keyframe.
+  ComPtr<IUnknown> service;
+  HRESULT hr = record_sink_->GetService(stream_index, GUID_NULL,
+                                        __uuidof(ICodecAPI),
+                                        service.GetAddressOf());
+  if (FAILED(hr) || !service) {
+    return;
+  }
+
+  ComPtr<ICodecAPI> codec_api;
+  if (FAILED(service.As(&codec_api))) {
+    return;
+  }
+
+  VARIANT value;
+  VariantInit(&value);
+  value.vt = VT_UI4;
+  value.ulVal = 1;
+  codec_api->SetValue(&CODECAPI_AVEncVideoForceKeyFrame, &value);
+}
+
+void RecordHandler::OnRecordSample(RecordStream stream, IMFSample* sample) {
+  {
+    std::lock_guard<std::mutex> lock(sample_writer_mutex_);
+    WriteRecordSample(stream, sample);
+  }
+
+  // The callback is called without holding the lock, so that it can query
+  // the handler.
+  if (stream == RecordStream::kVideo && type_ == RecordingType::kTimed &&
+      max_video_duration_ms_ > 0 &&
+      recording_duration_us_ >=
+          static_cast<uint64_t>(max_video_duration_ms_) * 1000 &&
+      !max_duration_reached_.exchange(true) &&
+      max_duration_reached_callback_) {
+    max_duration_reached_callback_();
+  }
+}
+
+void RecordHandler::WriteRecordSample(RecordStream stream,
+                                      IMFSample* sample) {
+  switch (stream) {
+    case RecordStream::kVideo:
+      if (sample_writer_) {
+        sample_writer_->WriteSample(true, sample);
+        record_stats_ = sample_writer_->GetStats();
+        // The recording time follows the written video, independently of
+        // the preview.
+        recording_duration_us_ =
+            static_cast<uint64_t>(record_stats_.video_end_time / 10);
+        if (sample_writer_->HasReachedMaxDuration()) {
+          recording_duration_us_ =
+              static_cast<uint64_t>(max_video_duration_ms_) * 1000;
+        }
+      }
+      break;
+    case RecordStream::kProxyVideo:
+      if (proxy_sample_writer_) {
+        proxy_sample_writer_->WriteSample(true, sample);
+      }
+      break;
+    case RecordStream::kAudio:
+      // Each writer updates the timestamp of the samples it writes, so the
+      // proxy gets a copy of the audio sample.
+      if (proxy_sample_writer_) {
+        ComPtr<IMFSample> sample_copy;
+        if (SUCCEEDED(CopySample(sample, &sample_copy))) {
+          proxy_sample_writer_->WriteSample(false, sample_copy.Get());
+        }
+      }
+      if (sample_writer_) {
+        sample_writer_->WriteSample(false, sample);
+        record_stats_ = sample_writer_->GetStats();
+      }
+      break;
+  }
+}
+
+RecordSampleStats RecordHandler::GetRecordStats() const {
+  std::lock_guard<std::mutex> lock(sample_writer_mutex_);
+  return record_stats_;
+}
+
+HRESULT RecordHandler::FinalizeRecord() {
+  std::unique_ptr<RecordSampleWriter> sample_writer;
+  std::unique_ptr<RecordSampleWriter> proxy_sample_writer;
+  {
+    std::lock_guard<std::mutex> lock(sample_writer_mutex_);
+    sample_writer = std::move(sample_writer_);
+    proxy_sample_writer = std::move(proxy_sample_writer_);
+  }
+  if (!sample_writer) {
+    return E_FAIL;
+  }
+
+  HRESULT hr = sample_writer->Finalize();
+  if (proxy_sample_writer) {
+    HRESULT proxy_hr = proxy_sample_writer->Finalize();
+    if (SUCCEEDED(hr)) {
+      hr = proxy_hr;
+    }
+  }
+  return hr;
+}
+
 void RecordHandler::OnRecordStarted() {
   if (recording_state_ == RecordState::kStarting) {
     recording_state_ = RecordState::kRunning;
@@ -232,28 +743,11 @@ void RecordHandler::OnRecordStarted() {
 void RecordHandler::OnRecordStopped() {
   if (recording_state_ == RecordState::kStopping) {
     file_path_ = "";
-    recording_start_timestamp_us_ = -1;
-    recording_duration_us_ = 0;
+    proxy_file_path_ = "";
     max_video_duration_ms_ = -1;
     recording_state_ = RecordState::kNotStarted;
     type_ = RecordingType::kNone;
   }
 }
 
-void RecordHandler::UpdateRecordingTime(uint64_t timestamp) {
-  if (recording_start_timestamp_us_ < 0) {
-    recording_start_timestamp_us_ = timestamp;
-  }
-
-  recording_duration_us_ = (timestamp - recording_start_timestamp_us_);
-}
-
-bool RecordHandler::ShouldStopTimedRecording() const {
-  return type_ == RecordingType::kTimed &&
-         recording_state_ == RecordState::kRunning &&
-         max_video_duration_ms_ > 0 &&
-         recording_duration_us_ >=
-             (static_cast<uint64_t>(max_video_duration_ms_) * 1000);
-}
-
 }  // namespace camera_windows
@@ -9,8 +9,15 @@
 #include <mfcaptureengine.h>
 #include <wrl/client.h>
 
+#include <atomic>
+#include <cassert>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+
+#include "record_sample_writer.h"
 
 namespace camera_windows {
 using Microsoft::WRL::ComPtr;
@@ -24,19 +31,168 @@ enum class RecordingType {
   kTimed
 };
 
+// Video codecs that recordings can be encoded with.
+enum class VideoCodec { kH264, kHEVC };
+
+// Rate control modes of the video encoder.
+enum class VideoRateControlMode {
+  // Uses the default mode of the encoder.
+  kDefault,
+  // Constant bitrate.
+  kConstantBitrate,
+  // Variable bitrate with |VideoRecordSettings::bitrate| as the average.
+  kVariableBitrate,
+  // Variable bitrate targeting |VideoRecordSettings::quality|.
+  kQuality,
+};
+
+// Encoder settings for video recordings.
+//
+// Zero values leave the setting to the encoder default.
+struct VideoRecordSettings {
+  // Codec of the recorded video.
+  VideoCodec codec = VideoCodec::kH264;
+  // If true, HEVC recordings require a hardware encoder and fall back to
+  // H.264 otherwise. The capture engine picks hardware encoders whenever one
+  // is available, as it shares the D3D device manager of the preview.
+  bool prefer_hardware_encoder = false;
+  // Average bitrate in bits per second.
+  uint32_t bitrate = 0;
+  // Rate control mode of the encoder.
+  VideoRateControlMode rate_control_mode = VideoRateControlMode::kDefault;
+  // Quality in range [1, 100], used with |VideoRateControlMode::kQuality|.
+  uint32_t quality = 0;
+  // Distance in frames between two keyframes.
+  uint32_t keyframe_interval = 0;
+  // If true, the recording is written as fragmented MPEG-4 and each written
+  // chunk is passed to the chunk callback of the record handler.
+  bool stream_chunks = false;
+  // Sample rate of the recorded AAC audio in Hz.
+  uint32_t audio_sample_rate = 0;
+  // Number of channels of the recorded AAC audio.
+  uint32_t audio_channels = 0;
+  // Average bitrate of the recorded AAC audio in bits per second. The closest
+  // bitrate supported by the encoder is used.
+  uint32_t audio_bitrate = 0;
+  // Height of a low resolution proxy recorded alongside the recording, or 0
+  // for no proxy. The width keeps the aspect ratio of the recording.
+  uint32_t proxy_height = 0;
+  // Average bitrate of the proxy video in bits per second.
+  uint32_t proxy_bitrate = 0;
+
+  bool operator==(const VideoRecordSettings& other) const {
+    return codec == other.codec &&
+           prefer_hardware_encoder == other.prefer_hardware_encoder &&
+           bitrate == other.bitrate &&
+           rate_control_mode == other.rate_control_mode &&
+           quality == other.quality &&
+           keyframe_interval == other.keyframe_interval &&
+           stream_chunks == other.stream_chunks &&
+           audio_sample_rate == other.audio_sample_rate &&
+           audio_channels == other.audio_channels &&
+           audio_bitrate == other.audio_bitrate &&
+           proxy_height == other.proxy_height &&
+           proxy_bitrate == other.proxy_bitrate;
+  }
+  bool operator!=(const VideoRecordSettings& other) const {
+    return !(*this == other);
+  }
+};
+
 // States that the record handler can be in.
 //
 // When created, the handler starts in |kNotStarted| state and transtions in
-// sequential order through the states.
-enum class RecordState { kNotStarted, kStarting, kRunning, kStopping };
+// sequential order through the states. A running recording can move to
+// |kPaused| and back any number of times before it is stopped.
+enum class RecordState {
+  kNotStarted,
+  kStarting,
+  kRunning,
+  kPaused,
+  kStopping
+};
+
+// Streams of the record sink.
+enum class RecordStream {
+  kVideo,
+  kAudio,
+  // Low resolution video of the proxy recording.
+  kProxyVideo,
+};
+
+// Returns the path of the proxy of the recording at |file_path|, which has
+// "_proxy" appended to the file name.
+std::string GetProxyFilePath(const std::string& file_path);
+
+// Returns the frame size of the proxy of a recording of |width| by |height|
+// pixels, scaled to |proxy_height| with the same aspect ratio. The proxy is
+// never larger than the recording, and its dimensions are even, as required
+// by the video encoders.
+void GetProxyFrameSize(uint32_t width, uint32_t height, uint32_t proxy_height,
+                       uint32_t* scaled_width, uint32_t* scaled_height);
+
+// Returns the media subtype recordings with |settings| are encoded to.
+GUID GetVideoRecordFormat(const VideoRecordSettings& settings);
+
+// Builds the attributes configuring the video encoder of a recording with
+// |settings|.
+HRESULT BuildVideoEncoderAttributes(const VideoRecordSettings& settings,
+                                    IMFAttributes** encoder_attributes);
+
+class RecordHandler;
+
+// Forwards the encoded samples of a record sink stream to a |RecordHandler|.
+class RecordSampleListener : public IMFCaptureEngineOnSampleCallback {
+ public:
+  RecordSampleListener(RecordHandler* handler, RecordStream stream)
+      : handler_(handler), stream_(stream) {
+    assert(handler);
+  }
+
+  ~RecordSampleListener() {}
+
+  // Disallow copy and move.
+  RecordSampleListener(const RecordSampleListener&) = delete;
+  RecordSampleListener& operator=(const RecordSampleListener&) = delete;
+
+  // Stops forwarding samples, as the record sink may keep the listener alive
+  // after the handler is destroyed.
+  void Detach();
+
+  // IUnknown
+  STDMETHODIMP_(ULONG) AddRef();
+  STDMETHODIMP_(ULONG) Release();
+  STDMETHODIMP_(HRESULT) QueryInterface(const IID& riid, void** ppv);
+
+  // IMFCaptureEngineOnSampleCallback
+  STDMETHODIMP_(HRESULT) OnSample(IMFSample* pSample);
+
+ private:
+  std::mutex mutex_;
+  RecordHandler* handler_;
+  RecordStream stream_;
+  volatile ULONG ref_ = 0;
+};
 
 // Handler for video recording via the camera.
 //
 // Handles record sink initialization and manages the state of video recording.
+//
+// The record sink delivers the encoded samples to the handler, which writes
+// them with a |RecordSampleWriter|. This keeps the capture engine and the
+// encoders running while a recording is paused.
+//
+// The recording time is taken from the written video samples, so timed
+// recordings stop on time whether or not the preview is running.
+//
+// Recordings with a proxy get a second, downscaled video stream on the
+// record sink, fed from the same capture stream. Its samples are written
+// with the audio samples to a second file by another |RecordSampleWriter|,
+// so both files are encoded in a single capture pass.
 class RecordHandler {
  public:
   RecordHandler(bool record_audio) : record_audio_(record_audio) {}
-  virtual ~RecordHandler() = default;
+  virtual ~RecordHandler();
 
   // Prevent copying.
   RecordHandler(RecordHandler const&) = delete;
@@ -54,9 +210,11 @@ class RecordHandler {
   //                  the actual recording.
   // base_media_type: A pointer to base media type used as a base
   //                  for the actual video capture media type.
+  // settings:        Encoder settings of the recording.
   HRESULT StartRecord(const std::string& file_path, int64_t max_duration,
                       IMFCaptureEngine* capture_engine,
-                      IMFMediaType* base_media_type);
+                      IMFMediaType* base_media_type,
+                      const VideoRecordSettings& settings);
 
   // Stops existing recording.
   //
@@ -64,13 +222,52 @@ class RecordHandler {
   //                  the ongoing recording.
   HRESULT StopRecord(IMFCaptureEngine* capture_engine);
 
+  // Pauses a running recording.
+  //
+  // Samples are dropped until the recording is resumed, so the paused time
+  // is left out of the recorded file.
+  //
+  // Sets record state to: paused.
+  HRESULT PauseRecord();
+
+  // Resumes a paused recording.
+  //
+  // The recording continues at the next video keyframe. The encoder is asked
+  // for a keyframe, but encoders that do not support it continue after up to
+  // one keyframe interval.
+  //
+  // Sets record state to: running.
+  HRESULT ResumeRecord();
+
   // Set the record handler recording state to: running.
   void OnRecordStarted();
 
+  // Completes the recorded file once the capture engine has stopped
+  // recording.
+  HRESULT FinalizeRecord();
+
   // Resets the record handler state and
   // sets recording state to: not started.
   void OnRecordStopped();
 
+  // Sets the callback receiving the written chunks of recordings started
+  // with |VideoRecordSettings::stream_chunks|.
+  //
+  // The callback is called on Media Foundation threads.
+  void SetRecordChunkCallback(RecordChunkCallback callback) {
+    chunk_callback_ = std::move(callback);
+  }
+
+  // Sets the callback called once when a timed recording reaches its
+  // maximum duration. Samples past the maximum duration are dropped until
+  // the recording is stopped.
+  //
+  // The callback is called on Media Foundation threads, and must not stop
+  // the recording or destroy the handler before returning.
+  void SetMaxDurationReachedCallback(std::function<void()> callback) {
+    max_duration_reached_callback_ = std::move(callback);
+  }
+
   // Returns true if recording type is continuous recording.
   bool IsContinuousRecording() const {
     return type_ == RecordingType::kContinuous;
@@ -83,34 +280,87 @@ class RecordHandler {
   bool CanStart() const { return recording_state_ == RecordState::kNotStarted; }
 
   // Returns true if recording can be stopped.
-  bool CanStop() const { return recording_state_ == RecordState::kRunning; }
+  bool CanStop() const {
+    return recording_state_ == RecordState::kRunning ||
+           recording_state_ == RecordState::kPaused;
+  }
+
+  // Returns true if recording can be paused.
+  bool CanPause() const { return recording_state_ == RecordState::kRunning; }
+
+  // Returns true if recording can be resumed.
+  bool CanResume() const { return recording_state_ == RecordState::kPaused; }
 
   // Returns the filesystem path of the video recording.
   std::string GetRecordPath() const { return file_path_; }
 
-  // Returns the duration of the video recording in microseconds.
+  // Returns the filesystem path of the proxy of the video recording, or an
+  // empty string if the recording has no proxy.
+  std::string GetProxyRecordPath() const { return proxy_file_path_; }
+
+  // Returns the duration of the video recording in microseconds, excluding
+  // the time it was paused.
   uint64_t GetRecordedDuration() const { return recording_duration_us_; }
 
-  // Calculates new recording time from capture timestamp.
-  void UpdateRecordingTime(uint64_t timestamp);
+  // Returns the statistics of the samples written to the current or last
+  // recorded file.
+  RecordSampleStats GetRecordStats() const;
 
-  // Returns true if recording time has exceeded the maximum duration for timed
-  // recordings.
-  bool ShouldStopTimedRecording() const;
+  // Writes an encoded sample of the record sink.
+  //
+  // Called by |RecordSampleListener| on a Media Foundation thread.
+  void OnRecordSample(RecordStream stream, IMFSample* sample);
 
  private:
-  // Initializes record sink for video file capture.
+  // Initializes record sink and the writer of the recorded file.
   HRESULT InitRecordSink(IMFCaptureEngine* capture_engine,
                          IMFMediaType* base_media_type);
 
+  // Adds the video and audio streams to the record sink, and sets their
+  // sample callbacks.
+  HRESULT InitRecordSinkStreams(IMFCaptureEngine* capture_engine,
+                                IMFMediaType* base_media_type);
+
+  // Adds the downscaled video stream of the proxy to the record sink, and
+  // sets its sample callback.
+  HRESULT InitProxyRecordSinkStream(IMFMediaType* base_media_type);
+
+  // Writes a sample of |stream| with the sample writers, and updates the
+  // recording time and statistics. Must be called with
+  // |sample_writer_mutex_| held.
+  void WriteRecordSample(RecordStream stream, IMFSample* sample);
+
+  // Asks the video encoder of the record sink stream at |stream_index| to
+  // encode the next frame as a keyframe.
+  void RequestKeyFrame(DWORD stream_index);
+
   bool record_audio_ = false;
   int64_t max_video_duration_ms_ = -1;
-  int64_t recording_start_timestamp_us_ = -1;
-  uint64_t recording_duration_us_ = 0;
+  std::atomic<uint64_t> recording_duration_us_ = 0;
+  std::atomic<bool> max_duration_reached_ = false;
+  std::function<void()> max_duration_reached_callback_;
   std::string file_path_;
+  std::string proxy_file_path_;
+  VideoRecordSettings settings_;
+  bool record_sink_settings_changed_ = false;
   RecordState recording_state_ = RecordState::kNotStarted;
   RecordingType type_ = RecordingType::kNone;
   ComPtr<IMFCaptureRecordSink> record_sink_;
+  ComPtr<IMFMediaType> video_record_media_type_;
+  ComPtr<IMFMediaType> audio_record_media_type_;
+  ComPtr<IMFMediaType> proxy_video_record_media_type_;
+  DWORD video_record_sink_stream_index_ = 0;
+  DWORD proxy_video_record_sink_stream_index_ = 0;
+  ComPtr<RecordSampleListener> video_sample_listener_;
+  ComPtr<RecordSampleListener> audio_sample_listener_;
+  ComPtr<RecordSampleListener> proxy_video_sample_listener_;
+  RecordChunkCallback chunk_callback_;
+
+  // Guards the sample writers, which are used on the sample threads.
+  mutable std::mutex sample_writer_mutex_;
+  std::unique_ptr<RecordSampleWriter> sample_writer_;
+  std::unique_ptr<RecordSampleWriter> proxy_sample_writer_;
+  RecordSampleStats record_stats_;
 };
 
 }  // namespace camera_windows
@@ -0,0 +1,279 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "record_sample_writer.h"
+
+#include <mfapi.h>
+#include <mfreadwrite.h>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include "string_utils.h"
+
+namespace camera_windows {
+
+using Microsoft::WRL::ComPtr;
+using windows_plugin_utils::Utf16FromUtf8;
+
+void RecordTimeline::Pause() { state_ = State::kPaused; }
+
+void RecordTimeline::Resume() {
+  if (state_ == State::kPaused) {
+    state_ = State::kWaitingForKeyFrame;
+  }
+}
+
+bool RecordTimeline::MapSampleTime(bool is_video, bool is_key_frame,
+                                   int64_t time, int64_t duration,
+                                   int64_t* output_time) {
+  assert(output_time);
+
+  if (state_ == State::kPaused) {
+    return false;
+  }
+
+  if (state_ == State::kWaitingForKeyFrame) {
+    // Samples before the first keyframe of a segment cannot be decoded.
+    if (!is_video || !is_key_frame) {
+      return false;
+    }
+    offset_ = time - output_end_time_;
+    segment_start_time_ = time;
+    segment_has_no_video_ = true;
+    state_ = State::kRunning;
+  }
+
+  // Audio captured before the keyframe starting the segment is dropped, so
+  // that the segment starts with both streams in sync.
+  if (time < segment_start_time_) {
+    return false;
+  }
+
+  const int64_t mapped_time = time - offset_;
+  if (max_duration_ > 0 && mapped_time >= max_duration_) {
+    if (is_video) {
+      max_duration_reached_ = true;
+    }
+    return false;
+  }
+
+  *output_time = mapped_time;
+  const int64_t end_time = mapped_time + (duration > 0 ? duration : 0);
+  if (end_time > output_end_time_) {
+    output_end_time_ = end_time;
+  }
+
+  if (is_video) {
+    // A gap of at least half a frame after the previous frame of the segment
+    // means that the encoder or the capture pipeline dropped frames.
+    const int64_t gap = mapped_time - stats_.video_end_time;
+    if (!segment_has_no_video_ && duration > 0 && gap >= duration / 2) {
+      stats_.dropped_video_frame_count += (gap + duration / 2) / duration;
+    }
+    segment_has_no_video_ = false;
+    stats_.video_frame_count++;
+    stats_.video_end_time =
+        std::max<int64_t>(stats_.video_end_time, end_time);
+  } else {
+    stats_.audio_sample_count++;
+    stats_.audio_end_time =
+        std::max<int64_t>(stats_.audio_end_time, end_time);
+  }
+  return true;
+}
+
+RecordSampleWriter::RecordSampleWriter(const std::string& file_path,
+                                       IMFMediaType* video_type,
+                                       IMFMediaType* audio_type,
+                                       RecordChunkCallback chunk_callback)
+    : file_path_(file_path),
+      video_type_(video_type),
+      audio_type_(audio_type),
+      chunk_callback_(std::move(chunk_callback)) {
+  assert(!file_path.empty());
+  assert(video_type);
+}
+
+RecordSampleWriter::~RecordSampleWriter() {
+  if (chunk_stream_) {
+    chunk_stream_->Detach();
+  }
+}
+
+HRESULT RecordSampleWriter::CreateFragmentedSinkWriter(
+    IMFAttributes* attributes, IMFSinkWriter** sink_writer) {
+  ComPtr<IMFByteStream> file_stream;
+  HRESULT hr = MFCreateFile(MF_ACCESSMODE_READWRITE,
+                            MF_OPENMODE_DELETE_IF_EXIST, MF_FILEFLAGS_NONE,
+                            Utf16FromUtf8(file_path_).c_str(), &file_stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  chunk_stream_ = new RecordChunkStream(file_stream.Get(), chunk_callback_);
+  return MFCreateSinkWriterFromURL(nullptr, chunk_stream_.Get(), attributes,
+                                   sink_writer);
+}
+
+HRESULT RecordSampleWriter::InitSinkWriter() {
+  ComPtr<IMFAttributes> attributes;
+  HRESULT hr = MFCreateAttributes(&attributes, 2);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Fragments of a fragmented recording are written in order as the
+  // recording progresses, so that chunks can be uploaded while the recording
+  // continues.
+  hr = attributes->SetGUID(MF_TRANSCODE_CONTAINERTYPE,
+                           chunk_callback_ ? MFTranscodeContainerType_FMPEG4
+                                           : MFTranscodeContainerType_MPEG4);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Samples are written from the sample callbacks of the record sink, which
+  // must not block the capture pipeline.
+  hr = attributes->SetUINT32(MF_SINK_WRITER_DISABLE_THROTTLING, TRUE);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IMFSinkWriter> sink_writer;
+  if (chunk_callback_) {
+    hr = CreateFragmentedSinkWriter(attributes.Get(), &sink_writer);
+  } else {
+    hr = MFCreateSinkWriterFromURL(Utf16FromUtf8(file_path_).c_str(), nullptr,
+                                   attributes.Get(), &sink_writer);
+  }
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Input and output types are the same, so samples are not transcoded.
+  hr = sink_writer->AddStream(video_type_.Get(), &video_stream_index_);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = sink_writer->SetInputMediaType(video_stream_index_, video_type_.Get(),
+                                      nullptr);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  if (audio_type_) {
+    hr = sink_writer->AddStream(audio_type_.Get(), &audio_stream_index_);
+    if (FAILED(hr)) {
+      return hr;
+    }
+
+    hr = sink_writer->SetInputMediaType(audio_stream_index_,
+                                        audio_type_.Get(), nullptr);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  hr = sink_writer->BeginWriting();
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  sink_writer_ = sink_writer;
+  return S_OK;
+}
+
+void RecordSampleWriter::WriteSample(bool is_video, IMFSample* sample) {
+  assert(sample);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (finalized_ || FAILED(status_) || (!is_video && !audio_type_)) {
+    return;
+  }
+
+  LONGLONG time = 0;
+  if (FAILED(sample->GetSampleTime(&time))) {
+    return;
+  }
+
+  LONGLONG duration = 0;
+  if (FAILED(sample->GetSampleDuration(&duration))) {
+    duration = 0;
+  }
+
+  const bool is_key_frame =
+      !is_video ||
+      MFGetAttributeUINT32(sample, MFSampleExtension_CleanPoint, FALSE);
+
+  int64_t output_time = 0;
+  if (!timeline_.MapSampleTime(is_video, is_key_frame, time, duration,
+                               &output_time)) {
+    return;
+  }
+
+  if (!sink_writer_) {
+    status_ = InitSinkWriter();
+    if (FAILED(status_)) {
+      return;
+    }
+  }
+
+  // The record sink does not use the sample after the callback returns, so
+  // the sample time is updated in place.
+  HRESULT hr = sample->SetSampleTime(output_time);
+  if (SUCCEEDED(hr)) {
+    hr = sink_writer_->WriteSample(
+        is_video ? video_stream_index_ : audio_stream_index_, sample);
+  }
+  if (FAILED(hr)) {
+    status_ = hr;
+  }
+}
+
+void RecordSampleWriter::Pause() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  timeline_.Pause();
+}
+
+void RecordSampleWriter::Resume() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  timeline_.Resume();
+}
+
+void RecordSampleWriter::SetMaxDuration(int64_t max_duration) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  timeline_.SetMaxDuration(max_duration);
+}
+
+bool RecordSampleWriter::HasReachedMaxDuration() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return timeline_.HasReachedMaxDuration();
+}
+
+RecordSampleStats RecordSampleWriter::GetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return timeline_.stats();
+}
+
+HRESULT RecordSampleWriter::Finalize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (finalized_) {
+    return status_;
+  }
+  finalized_ = true;
+
+  // No file is created if the recording stopped before its first keyframe.
+  if (sink_writer_) {
+    HRESULT hr = sink_writer_->Finalize();
+    if (SUCCEEDED(status_)) {
+      status_ = hr;
+    }
+    sink_writer_ = nullptr;
+  }
+  return status_;
+}
+
+}  // namespace camera_windows
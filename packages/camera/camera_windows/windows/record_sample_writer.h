@@ -0,0 +1,184 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_RECORD_SAMPLE_WRITER_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_RECORD_SAMPLE_WRITER_H_
+
+#include <mfapi.h>
+#include <mfreadwrite.h>
+#include <wrl/client.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "record_chunk_stream.h"
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+// Statistics of the samples written to a recording. Times are in
+// 100-nanosecond units of the recorded file.
+struct RecordSampleStats {
+  // Number of video frames written.
+  uint64_t video_frame_count = 0;
+  // Number of video frames missing between the written frames, found from
+  // gaps in their timestamps. Time the recording was paused is not counted.
+  uint64_t dropped_video_frame_count = 0;
+  // Number of audio samples written.
+  uint64_t audio_sample_count = 0;
+  // Output time at which the last video sample ends.
+  int64_t video_end_time = 0;
+  // Output time at which the last audio sample ends.
+  int64_t audio_end_time = 0;
+
+  // Returns how far the audio stream ends after the video stream, or 0 if
+  // no audio has been written.
+  int64_t GetAudioVideoDrift() const {
+    return audio_sample_count > 0 ? audio_end_time - video_end_time : 0;
+  }
+};
+
+// Maps the timestamps of encoded record samples to the timeline of the
+// recorded file, leaving out the time the recording was paused.
+//
+// The output starts at the first video keyframe, and each resumed segment
+// starts at the next video keyframe after |Resume| is called, directly after
+// the end of the previous segment. Times are in 100-nanosecond units.
+class RecordTimeline {
+ public:
+  RecordTimeline() = default;
+  virtual ~RecordTimeline() = default;
+
+  // Drops the samples passed to |MapSampleTime| until |Resume| is called.
+  void Pause();
+
+  // Starts a new segment at the next video keyframe.
+  void Resume();
+
+  // Returns true if the timeline is paused.
+  bool IsPaused() const { return state_ == State::kPaused; }
+
+  // Drops the samples that would start at or after |max_duration| in the
+  // recorded file, so that timed recordings end on time even if they are
+  // stopped late. Values of 0 or less disable the limit.
+  void SetMaxDuration(int64_t max_duration) { max_duration_ = max_duration; }
+
+  // Returns true once a video sample has been dropped because of the
+  // maximum duration.
+  bool HasReachedMaxDuration() const { return max_duration_reached_; }
+
+  // Returns the statistics of the samples mapped so far.
+  const RecordSampleStats& stats() const { return stats_; }
+
+  // Returns the output time of a sample, or false if the sample is dropped.
+  //
+  // is_video:     True for samples of the video stream.
+  // is_key_frame: True if the video sample can be decoded on its own.
+  // time:         Presentation time of the sample.
+  // duration:     Duration of the sample, or 0 if unknown.
+  // output_time:  Receives the presentation time in the recorded file.
+  bool MapSampleTime(bool is_video, bool is_key_frame, int64_t time,
+                     int64_t duration, int64_t* output_time);
+
+ private:
+  enum class State { kWaitingForKeyFrame, kRunning, kPaused };
+
+  State state_ = State::kWaitingForKeyFrame;
+  // Subtracted from the times of the samples of the current segment.
+  int64_t offset_ = 0;
+  // Input time of the keyframe starting the current segment.
+  int64_t segment_start_time_ = 0;
+  // Output time at which the last written sample ends.
+  int64_t output_end_time_ = 0;
+  // True until the first video sample of the current segment is mapped.
+  bool segment_has_no_video_ = true;
+  int64_t max_duration_ = 0;
+  bool max_duration_reached_ = false;
+  RecordSampleStats stats_;
+};
+
+// Writes the encoded samples of the record sink to an MPEG-4 file.
+//
+// The record sink delivers the samples through sample callbacks instead of
+// writing the file itself, so that a recording can be paused without
+// stopping the capture engine and restarting the encoder. Samples are
+// remuxed as is, and their timestamps are mapped with a |RecordTimeline|.
+//
+// With a |RecordChunkCallback|, the file is written as fragmented MPEG-4,
+// which is playable while it is being written, and each written chunk is
+// also passed to the callback.
+//
+// Samples are written on Media Foundation threads, and the writer is
+// paused, resumed and finalized on the platform thread.
+class RecordSampleWriter {
+ public:
+  // file_path:      Path of the recorded file.
+  // video_type:     Media type of the encoded video stream.
+  // audio_type:     Media type of the encoded audio stream, or nullptr if
+  //                 the recording has no audio.
+  // chunk_callback: Receives the written chunks of a fragmented recording,
+  //                 or nullptr for a regular MPEG-4 file.
+  RecordSampleWriter(const std::string& file_path, IMFMediaType* video_type,
+                     IMFMediaType* audio_type,
+                     RecordChunkCallback chunk_callback = nullptr);
+  virtual ~RecordSampleWriter();
+
+  // Prevent copying.
+  RecordSampleWriter(RecordSampleWriter const&) = delete;
+  RecordSampleWriter& operator=(RecordSampleWriter const&) = delete;
+
+  // Writes an encoded sample of the video or audio stream.
+  //
+  // The file is created when the first sample is written. Errors are kept
+  // and returned by |Finalize|.
+  void WriteSample(bool is_video, IMFSample* sample);
+
+  // Drops the samples written until |Resume| is called.
+  void Pause();
+
+  // Continues the recording at the next video keyframe.
+  void Resume();
+
+  // Limits the duration of the recorded file. See
+  // |RecordTimeline::SetMaxDuration|.
+  void SetMaxDuration(int64_t max_duration);
+
+  // Returns true once the recorded file has reached its maximum duration.
+  bool HasReachedMaxDuration();
+
+  // Returns the statistics of the samples written so far.
+  RecordSampleStats GetStats();
+
+  // Completes the file. Samples written after this call are ignored.
+  //
+  // Returns the first error that occurred while writing the file.
+  HRESULT Finalize();
+
+ private:
+  // Creates the sink writer and starts writing the file.
+  HRESULT InitSinkWriter();
+
+  // Creates the sink writer of a fragmented recording, writing through a
+  // |RecordChunkStream|.
+  HRESULT CreateFragmentedSinkWriter(IMFAttributes* attributes,
+                                     IMFSinkWriter** sink_writer);
+
+  std::mutex mutex_;
+  std::string file_path_;
+  ComPtr<IMFMediaType> video_type_;
+  ComPtr<IMFMediaType> audio_type_;
+  RecordChunkCallback chunk_callback_;
+  ComPtr<RecordChunkStream> chunk_stream_;
+  ComPtr<IMFSinkWriter> sink_writer_;
+  DWORD video_stream_index_ = 0;
+  DWORD audio_stream_index_ = 0;
+  RecordTimeline timeline_;
+  HRESULT status_ = S_OK;
+  bool finalized_ = false;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_RECORD_SAMPLE_WRITER_H_
@@ -0,0 +1,1271 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "source_reader_capture_controller.h"
+
+#include <comdef.h>
+
+#include <cassert>
+#include <future>
+#include <utility>
+
+#include "media_type_cache.h"
+#include "string_utils.h"
+#include "tracing.h"
+
+namespace camera_windows {
+
+using Microsoft::WRL::ComPtr;
+using windows_plugin_utils::Utf16FromUtf8;
+using windows_plugin_utils::Utf8FromUtf16;
+
+// Number of preview frames kept for zero shutter lag photos.
+constexpr size_t kSourceReaderZeroShutterLagFrameCount = 3;
+
+// Bits per pixel of the default bitrate of recordings, which gives about
+// 6 Mbit/s at 1080p30.
+constexpr double kDefaultRecordBitsPerPixel = 0.1;
+
+namespace {
+
+// Returns the system error message of |hr|.
+std::string GetErrorMessage(HRESULT hr) {
+  _com_error err(hr);
+  return Utf8FromUtf16(err.ErrorMessage());
+}
+
+}  // namespace
+
+void SourceReaderListener::Detach() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  controller_ = nullptr;
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG) SourceReaderListener::AddRef() {
+  return InterlockedIncrement(&ref_);
+}
+
+// IUnknown
+STDMETHODIMP_(ULONG)
+SourceReaderListener::Release() {
+  LONG ref = InterlockedDecrement(&ref_);
+  if (ref == 0) {
+    delete this;
+  }
+  return ref;
+}
+
+// IUnknown
+STDMETHODIMP_(HRESULT)
+SourceReaderListener::QueryInterface(const IID& riid, void** ppv) {
+  *ppv = nullptr;
+
+  if (riid == IID_IMFSourceReaderCallback || riid == IID_IUnknown) {
+    *ppv = static_cast<IMFSourceReaderCallback*>(this);
+    ((IUnknown*)*ppv)->AddRef();
+    return S_OK;
+  }
+
+  return E_NOINTERFACE;
+}
+
+// IMFSourceReaderCallback
+STDMETHODIMP SourceReaderListener::OnReadSample(HRESULT status,
+                                                DWORD stream_index,
+                                                DWORD stream_flags,
+                                                LONGLONG timestamp,
+                                                IMFSample* sample) {
+  CAMERA_TRACE_SCOPE("OnReadSample");
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (controller_) {
+    controller_->OnReadSample(status, stream_flags, sample);
+  }
+  return S_OK;
+}
+
+// IMFSourceReaderCallback
+STDMETHODIMP SourceReaderListener::OnFlush(DWORD stream_index) { return S_OK; }
+
+// IMFSourceReaderCallback
+STDMETHODIMP SourceReaderListener::OnEvent(DWORD stream_index,
+                                           IMFMediaEvent* event) {
+  return S_OK;
+}
+
+SourceReaderCaptureController::SourceReaderCaptureController(
+    CaptureControllerListener* listener,
+    std::unique_ptr<CaptureWorkQueue> work_queue)
+    : capture_controller_listener_(listener),
+      work_queue_(std::move(work_queue)),
+      CaptureController(){};
+
+SourceReaderCaptureController::~SourceReaderCaptureController() {
+  if (work_queue_) {
+    // Resets on the work queue, so that the reset cannot overlap a picture
+    // being encoded. Tasks queued after the reset are discarded.
+    std::promise<void> reset;
+    work_queue_->Post([this, &reset]() {
+      ResetCaptureController();
+      reset.set_value();
+    });
+    reset.get_future().wait();
+    work_queue_ = nullptr;
+  } else {
+    ResetCaptureController();
+  }
+  capture_controller_listener_ = nullptr;
+};
+
+void SourceReaderCaptureController::ResetCaptureController() {
+  // Waits for the sample being read, after which no sample reaches the
+  // controller.
+  if (source_reader_listener_) {
+    source_reader_listener_->Detach();
+  }
+
+  // Completes the running recording, so that the file is playable.
+  FinalizeRecord();
+
+  // States
+  image_streaming_.store(false, std::memory_order_release);
+  last_capture_time_us_.store(0, std::memory_order_relaxed);
+  preview_state_.store(PreviewState::kNotStarted);
+  reading_samples_.store(false);
+  picture_frame_requested_.store(false);
+  {
+    std::lock_guard<std::mutex> lock(picture_mutex_);
+    picture_requests_.clear();
+  }
+  capture_engine_state_ = CaptureEngineState::kNotInitialized;
+  preview_frame_width_ = 0;
+  preview_frame_height_ = 0;
+  source_reader_listener_ = nullptr;
+  source_reader_ = nullptr;
+  sample_listener_ = nullptr;
+  camera_controls_ = nullptr;
+  video_source_ = nullptr;
+  capture_formats_.clear();
+
+  photo_handler_ = nullptr;
+  // Flutter may still be reading the last frame, so the texture handler is
+  // destroyed once its texture is unregistered instead of waiting here.
+  TextureHandler::UnregisterAndDestroy(std::move(texture_handler_));
+  preview_stats_ = nullptr;
+  zero_shutter_lag_buffer_ = nullptr;
+
+  // Released last, as the context may shut down Media Foundation if no other
+  // capture controller is using it.
+  capture_context_ = nullptr;
+}
+
+bool SourceReaderCaptureController::InitCaptureDevice(
+    flutter::TextureRegistrar* texture_registrar, const std::string& device_id,
+    const CaptureSettings& settings,
+    std::shared_ptr<CaptureContext> capture_context) {
+  assert(capture_controller_listener_);
+
+  if (IsInitialized()) {
+    capture_controller_listener_->OnCreateCaptureEngineFailed(
+        CameraResult::kError, "Capture device already initialized");
+    return false;
+  } else if (capture_engine_state_ == CaptureEngineState::kInitializing) {
+    capture_controller_listener_->OnCreateCaptureEngineFailed(
+        CameraResult::kError, "Capture device already initializing");
+    return false;
+  } else if (settings.record_audio) {
+    // Videos are recorded from the preview frames, which carry no audio.
+    capture_controller_listener_->OnCreateCaptureEngineFailed(
+        CameraResult::kError,
+        "Audio recording is not supported by the source reader backend");
+    return false;
+  }
+
+  capture_engine_state_ = CaptureEngineState::kInitializing;
+  resolution_preset_ = settings.resolution_preset;
+  target_frame_rate_ = static_cast<float>(settings.target_frame_rate);
+  preview_texture_mode_ = settings.preview_texture_mode;
+  preview_pixel_format_ = settings.preview_pixel_format;
+  if (settings.zero_shutter_lag) {
+    zero_shutter_lag_buffer_ = std::make_unique<ZeroShutterLagBuffer>(
+        kSourceReaderZeroShutterLagFrameCount);
+  }
+  if (settings.preview_stats) {
+    preview_stats_ = std::make_shared<PreviewStats>();
+  }
+  if (settings.preview_max_frame_rate > 0) {
+    preview_frame_throttle_.SetMaxFrameRate(settings.preview_max_frame_rate);
+  }
+  texture_registrar_ = texture_registrar;
+  video_device_id_ = device_id;
+
+  capture_context_ = std::move(capture_context);
+  if (!capture_context_) {
+    capture_controller_listener_->OnCreateCaptureEngineFailed(
+        CameraResult::kError, "Failed to create camera");
+    ResetCaptureController();
+    return false;
+  }
+
+  HRESULT hr = CreateSourceReader();
+  if (SUCCEEDED(hr)) {
+    hr = SetSourceReaderMediaTypes();
+  }
+  if (FAILED(hr)) {
+    capture_controller_listener_->OnCreateCaptureEngineFailed(
+        GetCameraResult(hr), "Failed to create camera");
+    ResetCaptureController();
+    return false;
+  }
+
+  // The source reader is ready right away, unlike the capture engine which
+  // is initialized asynchronously.
+  OnSourceReaderCreated();
+  return IsInitialized();
+}
+
+HRESULT SourceReaderCaptureController::CreateSourceReader() {
+  assert(!video_device_id_.empty());
+
+  HRESULT hr = S_OK;
+
+  // Creates video source only if not already initialized by test framework
+  if (!video_source_) {
+    hr = CreateVideoCaptureSource(video_device_id_,
+                                  video_source_.GetAddressOf());
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  if (!sample_listener_) {
+    sample_listener_ =
+        ComPtr<CaptureEngineListener>(new CaptureEngineListener(this));
+  }
+
+  if (!source_reader_listener_) {
+    source_reader_listener_ =
+        ComPtr<SourceReaderListener>(new SourceReaderListener(this));
+  }
+
+  // Creates source reader only if not already initialized by test framework
+  if (source_reader_) {
+    return hr;
+  }
+
+  ComPtr<IMFAttributes> attributes;
+  hr = MFCreateAttributes(&attributes, 4);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = attributes->SetUnknown(MF_SOURCE_READER_ASYNC_CALLBACK,
+                              source_reader_listener_.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Keeps the camera and the video processor from queuing frames ahead of
+  // the preview.
+  hr = attributes->SetUINT32(MF_LOW_LATENCY, TRUE);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Converts the native frames to the preview pixel format.
+  hr = attributes->SetUINT32(MF_SOURCE_READER_ENABLE_ADVANCED_VIDEO_PROCESSING,
+                             TRUE);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Samples read with the device manager of the capture context are backed by
+  // textures that the GPU surface renders without copying them.
+  if (preview_texture_mode_ == PreviewTextureMode::kGpuSurface) {
+    hr = attributes->SetUnknown(MF_SOURCE_READER_D3D_MANAGER,
+                                capture_context_->GetDXGIDeviceManager());
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  return MFCreateSourceReaderFromMediaSource(video_source_.Get(),
+                                             attributes.Get(), &source_reader_);
+}
+
+HRESULT SourceReaderCaptureController::SetSourceReaderMediaTypes() {
+  std::shared_ptr<const MediaTypeCache::MediaTypeList> media_types =
+      MediaTypeCache::GetInstance().GetMediaTypes(video_device_id_,
+                                                  source_reader_.Get());
+  const DeviceMediaType* best = FindBestDeviceMediaType(
+      *media_types, GetResolutionPresetMaxHeight(resolution_preset_),
+      target_frame_rate_);
+  if (!best) {
+    return E_FAIL;
+  }
+
+  // The cached media type is shared, so the source reader gets a copy.
+  ComPtr<IMFMediaType> native_media_type;
+  HRESULT hr = MFCreateMediaType(&native_media_type);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = best->media_type->CopyAllItems(native_media_type.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Setting a native media type selects the format of the camera.
+  hr = source_reader_->SetCurrentMediaType(
+      (DWORD)MF_SOURCE_READER_FIRST_VIDEO_STREAM, nullptr,
+      native_media_type.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IMFMediaType> output_media_type;
+  hr = BuildMediaTypeForVideoPreview(native_media_type.Get(),
+                                     preview_pixel_format_,
+                                     output_media_type.GetAddressOf());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = source_reader_->SetCurrentMediaType(
+      (DWORD)MF_SOURCE_READER_FIRST_VIDEO_STREAM, nullptr,
+      output_media_type.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  preview_frame_width_ = best->width;
+  preview_frame_height_ = best->height;
+  capture_formats_ = GetDistinctCaptureFormats(*media_types);
+  return S_OK;
+}
+
+void SourceReaderCaptureController::OnSourceReaderCreated() {
+  // Create texture handler and register new texture.
+  texture_handler_ = std::make_unique<TextureHandler>(texture_registrar_);
+  texture_handler_->SetPixelFormat(preview_pixel_format_);
+  texture_handler_->SetPreviewStats(preview_stats_);
+  texture_handler_->SetCrop(preview_crop_rect_, zoom_level_);
+  texture_handler_->SetRotation(preview_rotation_);
+  if (preview_texture_mode_ == PreviewTextureMode::kGpuSurface) {
+    // Falls back to pixel buffer texture if GPU surface is not supported.
+    texture_handler_->EnableGpuSurface(capture_context_->GetD3DDevice());
+  }
+
+  int64_t texture_id = texture_handler_->RegisterTexture();
+  if (texture_id >= 0) {
+    capture_controller_listener_->OnCreateCaptureEngineSucceeded(texture_id);
+    capture_engine_state_ = CaptureEngineState::kInitialized;
+  } else {
+    capture_controller_listener_->OnCreateCaptureEngineFailed(
+        CameraResult::kError, "Failed to create texture_id");
+    // Reset state
+    ResetCaptureController();
+  }
+}
+
+bool SourceReaderCaptureController::ShouldReadSamples() const {
+  if (preview_state_.load() != PreviewState::kNotStarted ||
+      picture_frame_requested_.load()) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(record_mutex_);
+  return sink_writer_ != nullptr;
+}
+
+HRESULT SourceReaderCaptureController::StartReadingSamples() {
+  assert(source_reader_);
+
+  if (reading_samples_.exchange(true)) {
+    return S_OK;
+  }
+
+  // Check OnReadSample for response process.
+  HRESULT hr = source_reader_->ReadSample(
+      (DWORD)MF_SOURCE_READER_FIRST_VIDEO_STREAM, 0, nullptr, nullptr, nullptr,
+      nullptr);
+  if (FAILED(hr)) {
+    reading_samples_.store(false);
+  }
+  return hr;
+}
+
+void SourceReaderCaptureController::ContinueReadingSamples() {
+  // Cleared before checking the state, so that a read requested meanwhile
+  // from the platform thread is not lost.
+  reading_samples_.store(false);
+  if (!IsInitialized() || !ShouldReadSamples()) {
+    return;
+  }
+
+  HRESULT hr = StartReadingSamples();
+  if (FAILED(hr)) {
+    OnReadError(hr);
+  }
+}
+
+void SourceReaderCaptureController::OnReadError(HRESULT status) {
+  PostTask([this, status]() {
+    if (IsInitialized() && capture_controller_listener_) {
+      capture_controller_listener_->OnCaptureError(GetCameraResult(status),
+                                                   GetErrorMessage(status));
+    }
+  });
+}
+
+// Handles the result of a sample read.
+// Called via IMFSourceReaderCallback implementation.
+void SourceReaderCaptureController::OnReadSample(HRESULT status,
+                                                 DWORD stream_flags,
+                                                 IMFSample* sample) {
+  if (!IsInitialized()) {
+    reading_samples_.store(false);
+    return;
+  }
+
+  if (FAILED(status) || (stream_flags & MF_SOURCE_READERF_ERROR)) {
+    // The source reader does not deliver samples after an error.
+    reading_samples_.store(false);
+    return OnReadError(FAILED(status) ? status : E_FAIL);
+  }
+
+  if (stream_flags & MF_SOURCE_READERF_ENDOFSTREAM) {
+    reading_samples_.store(false);
+    return;
+  }
+
+  // Stream ticks have no sample.
+  if (sample) {
+    // The preview is updated first, as the recording changes the sample time.
+    sample_listener_->OnSample(sample);
+    WriteRecordSample(sample);
+  }
+
+  ContinueReadingSamples();
+}
+
+void SourceReaderCaptureController::PostTask(std::function<void()> task) {
+  if (work_queue_) {
+    work_queue_->Post(std::move(task));
+  } else {
+    task();
+  }
+}
+
+void SourceReaderCaptureController::SetPictureRotation(
+    PhotoRotation rotation) {
+  picture_rotation_ = rotation;
+}
+
+void SourceReaderCaptureController::TakePicture(const std::string& file_path) {
+  if (!IsInitialized()) {
+    return capture_controller_listener_->OnTakePictureFailed(
+        CameraResult::kError, "Not initialized");
+  }
+
+  PictureRequest request;
+  request.file_path = file_path;
+  request.settings.rotation = picture_rotation_;
+  request.shutter_time_us =
+      last_capture_time_us_.load(std::memory_order_relaxed);
+  RequestPicture(std::move(request));
+}
+
+void SourceReaderCaptureController::TakePictureData(
+    const PhotoSettings& settings) {
+  if (!IsInitialized()) {
+    return capture_controller_listener_->OnTakePictureDataFailed(
+        CameraResult::kError, "Not initialized");
+  }
+
+  PictureRequest request;
+  request.return_data = true;
+  request.settings = settings;
+  request.settings.rotation = picture_rotation_;
+  request.shutter_time_us =
+      last_capture_time_us_.load(std::memory_order_relaxed);
+  RequestPicture(std::move(request));
+}
+
+void SourceReaderCaptureController::TakePictureBurst(
+    const std::vector<std::string>& file_paths) {
+  assert(!file_paths.empty());
+
+  // Bursts are taken by the photo sink of the capture engine.
+  capture_controller_listener_->OnTakePictureBurstFailed(
+      CameraResult::kError,
+      "Photo bursts are not supported by the source reader backend");
+}
+
+void SourceReaderCaptureController::RequestPicture(PictureRequest request) {
+  {
+    std::lock_guard<std::mutex> lock(picture_mutex_);
+    picture_requests_.push_back(std::move(request));
+  }
+
+  // The zero shutter lag buffer holds frames while the preview is running.
+  if (zero_shutter_lag_buffer_ &&
+      preview_state_.load() == PreviewState::kRunning) {
+    return PostTask([this]() { CompletePictureRequests(); });
+  }
+  RequestPictureFrame();
+}
+
+void SourceReaderCaptureController::RequestPictureFrame() {
+  picture_frame_requested_.store(true);
+  HRESULT hr = StartReadingSamples();
+  if (FAILED(hr)) {
+    picture_frame_requested_.store(false);
+
+    std::vector<PictureRequest> requests;
+    {
+      std::lock_guard<std::mutex> lock(picture_mutex_);
+      requests.swap(picture_requests_);
+    }
+    for (const PictureRequest& request : requests) {
+      OnPictureFailed(request, GetCameraResult(hr), "Failed to take photo");
+    }
+  }
+}
+
+void SourceReaderCaptureController::CompletePictureRequests() {
+  // The controller may have been reset while the task was queued.
+  if (!IsInitialized()) {
+    return;
+  }
+
+  std::vector<PictureRequest> requests;
+  {
+    std::lock_guard<std::mutex> lock(picture_mutex_);
+    requests.swap(picture_requests_);
+  }
+  if (requests.empty()) {
+    return;
+  }
+
+  if (!photo_handler_) {
+    photo_handler_ = std::make_unique<PhotoHandler>();
+  }
+
+  bool frame_missing = false;
+  for (PictureRequest& request : requests) {
+    BufferedFrame frame;
+    if (!(zero_shutter_lag_buffer_ &&
+          zero_shutter_lag_buffer_->GetClosestFrame(request.shutter_time_us,
+                                                    &frame)) &&
+        !picture_frame_buffer_.GetClosestFrame(request.shutter_time_us,
+                                               &frame)) {
+      // Waits for the next frame instead.
+      std::lock_guard<std::mutex> lock(picture_mutex_);
+      picture_requests_.push_back(std::move(request));
+      frame_missing = true;
+      continue;
+    }
+
+    if (request.return_data) {
+      std::vector<uint8_t> data;
+      HRESULT hr = photo_handler_->EncodeZeroShutterLagPhoto(
+          frame, request.settings, &data);
+      if (FAILED(hr)) {
+        OnPictureFailed(request, GetCameraResult(hr), "Failed to take photo");
+      } else if (capture_controller_listener_) {
+        capture_controller_listener_->OnTakePictureDataSucceeded(data);
+      }
+    } else {
+      HRESULT hr = photo_handler_->TakeZeroShutterLagPhoto(
+          request.file_path, frame, request.settings.rotation);
+      if (FAILED(hr)) {
+        OnPictureFailed(request, GetCameraResult(hr), "Failed to take photo");
+      } else if (capture_controller_listener_) {
+        capture_controller_listener_->OnTakePictureSucceeded(
+            request.file_path);
+      }
+    }
+  }
+
+  // Frames of earlier pictures are not reused for later ones.
+  picture_frame_buffer_.Clear();
+  if (frame_missing) {
+    RequestPictureFrame();
+  }
+}
+
+void SourceReaderCaptureController::OnPictureFailed(
+    const PictureRequest& request, CameraResult result,
+    const std::string& error) {
+  if (!capture_controller_listener_) {
+    return;
+  }
+  if (request.return_data) {
+    capture_controller_listener_->OnTakePictureDataFailed(result, error);
+  } else {
+    capture_controller_listener_->OnTakePictureFailed(result, error);
+  }
+}
+
+HRESULT SourceReaderCaptureController::CreateSinkWriter(
+    const std::string& file_path, const VideoRecordSettings& settings,
+    IMFSinkWriter** sink_writer, DWORD* stream_index) {
+  assert(source_reader_);
+
+  // Samples are recorded in the output media type of the source reader.
+  ComPtr<IMFMediaType> input_media_type;
+  HRESULT hr = source_reader_->GetCurrentMediaType(
+      (DWORD)MF_SOURCE_READER_FIRST_VIDEO_STREAM, &input_media_type);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  UINT32 width = 0;
+  UINT32 height = 0;
+  hr = MFGetAttributeSize(input_media_type.Get(), MF_MT_FRAME_SIZE, &width,
+                          &height);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  UINT32 frame_rate_numerator = 0;
+  UINT32 frame_rate_denominator = 0;
+  hr = MFGetAttributeRatio(input_media_type.Get(), MF_MT_FRAME_RATE,
+                           &frame_rate_numerator, &frame_rate_denominator);
+  if (FAILED(hr) || frame_rate_denominator == 0) {
+    return FAILED(hr) ? hr : E_FAIL;
+  }
+
+  ComPtr<IMFAttributes> attributes;
+  hr = MFCreateAttributes(&attributes, 3);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = attributes->SetUINT32(MF_READWRITE_ENABLE_HARDWARE_TRANSFORMS,
+                             settings.prefer_hardware_encoder);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Samples are written from the callbacks of the source reader, which must
+  // not block the preview.
+  hr = attributes->SetUINT32(MF_SINK_WRITER_DISABLE_THROTTLING, TRUE);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // Texture backed samples are encoded on the GPU that produced them.
+  if (preview_texture_mode_ == PreviewTextureMode::kGpuSurface) {
+    hr = attributes->SetUnknown(MF_SINK_WRITER_D3D_MANAGER,
+                                capture_context_->GetDXGIDeviceManager());
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  ComPtr<IMFSinkWriter> writer;
+  hr = MFCreateSinkWriterFromURL(Utf16FromUtf8(file_path).c_str(), nullptr,
+                                 attributes.Get(), &writer);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IMFMediaType> output_media_type;
+  hr = MFCreateMediaType(&output_media_type);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  uint32_t bitrate = settings.bitrate;
+  if (bitrate == 0) {
+    bitrate = static_cast<uint32_t>(static_cast<double>(width) * height *
+                                    frame_rate_numerator /
+                                    frame_rate_denominator *
+                                    kDefaultRecordBitsPerPixel);
+  }
+
+  hr = output_media_type->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Video);
+  if (SUCCEEDED(hr)) {
+    hr = output_media_type->SetGUID(MF_MT_SUBTYPE,
+                                    GetVideoRecordFormat(settings));
+  }
+  if (SUCCEEDED(hr)) {
+    hr = output_media_type->SetUINT32(MF_MT_AVG_BITRATE, bitrate);
+  }
+  if (SUCCEEDED(hr)) {
+    hr = output_media_type->SetUINT32(MF_MT_INTERLACE_MODE,
+                                      MFVideoInterlace_Progressive);
+  }
+  if (SUCCEEDED(hr)) {
+    hr = MFSetAttributeSize(output_media_type.Get(), MF_MT_FRAME_SIZE, width,
+                            height);
+  }
+  if (SUCCEEDED(hr)) {
+    hr = MFSetAttributeRatio(output_media_type.Get(), MF_MT_FRAME_RATE,
+                             frame_rate_numerator, frame_rate_denominator);
+  }
+  if (SUCCEEDED(hr)) {
+    hr = MFSetAttributeRatio(output_media_type.Get(), MF_MT_PIXEL_ASPECT_RATIO,
+                             1, 1);
+  }
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = writer->AddStream(output_media_type.Get(), stream_index);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  ComPtr<IMFAttributes> encoder_attributes;
+  hr = BuildVideoEncoderAttributes(settings,
+                                   encoder_attributes.GetAddressOf());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = writer->SetInputMediaType(*stream_index, input_media_type.Get(),
+                                 encoder_attributes.Get());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = writer->BeginWriting();
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  writer.CopyTo(sink_writer);
+  return S_OK;
+}
+
+void SourceReaderCaptureController::StartRecord(
+    const std::string& file_path, int64_t max_video_duration_ms,
+    const VideoRecordSettings& settings) {
+  assert(capture_controller_listener_);
+
+  if (!IsInitialized()) {
+    return capture_controller_listener_->OnStartRecordFailed(
+        CameraResult::kError,
+        "Camera not initialized. Camera should be disposed and "
+        "reinitialized.");
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (record_state_ != RecordState::kNotStarted) {
+      return capture_controller_listener_->OnStartRecordFailed(
+          CameraResult::kError,
+          "Recording cannot be started. Previous recording must be stopped "
+          "first.");
+    }
+    record_state_ = RecordState::kStarting;
+  }
+
+  ComPtr<IMFSinkWriter> sink_writer;
+  DWORD stream_index = 0;
+  HRESULT hr = CreateSinkWriter(file_path, settings, &sink_writer,
+                                &stream_index);
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (SUCCEEDED(hr)) {
+      sink_writer_ = sink_writer;
+      sink_writer_stream_index_ = stream_index;
+      record_status_ = S_OK;
+      record_timeline_ = RecordTimeline();
+      record_timeline_.SetMaxDuration(
+          max_video_duration_ms > 0 ? max_video_duration_ms * 10000 : 0);
+      max_duration_reached_ = false;
+      record_path_ = file_path;
+      recording_type_ = max_video_duration_ms > 0 ? RecordingType::kTimed
+                                                  : RecordingType::kContinuous;
+      record_state_ = RecordState::kRunning;
+    } else {
+      record_state_ = RecordState::kNotStarted;
+    }
+  }
+
+  if (SUCCEEDED(hr)) {
+    hr = StartReadingSamples();
+    if (FAILED(hr)) {
+      std::lock_guard<std::mutex> lock(record_mutex_);
+      sink_writer_ = nullptr;
+      record_state_ = RecordState::kNotStarted;
+    }
+  }
+
+  if (FAILED(hr)) {
+    return capture_controller_listener_->OnStartRecordFailed(
+        GetCameraResult(hr), "Failed to start video recording");
+  }
+  capture_controller_listener_->OnStartRecordSucceeded();
+}
+
+void SourceReaderCaptureController::StopRecord() {
+  assert(capture_controller_listener_);
+
+  if (!IsInitialized()) {
+    return capture_controller_listener_->OnStopRecordFailed(
+        CameraResult::kError,
+        "Camera not initialized. Camera should be disposed and "
+        "reinitialized.");
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (!sink_writer_ || record_state_ == RecordState::kStopping) {
+      return capture_controller_listener_->OnStopRecordFailed(
+          CameraResult::kError, "Recording cannot be stopped.");
+    }
+    // Keeps another stop request from being queued behind this one.
+    record_state_ = RecordState::kStopping;
+  }
+
+  // Finalizing the recording waits for the encoder to drain, so it is not
+  // done on the platform thread. The listener is informed once it completes.
+  PostTask([this]() { FinalizeRecord(); });
+}
+
+// Stops timed recording. Called on the work queue once the recording reached
+// its maximum duration.
+void SourceReaderCaptureController::StopTimedRecord() {
+  if (!IsInitialized()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (!sink_writer_ || recording_type_ != RecordingType::kTimed) {
+      return;
+    }
+  }
+
+  FinalizeRecord();
+}
+
+void SourceReaderCaptureController::FinalizeRecord() {
+  ComPtr<IMFSinkWriter> sink_writer;
+  HRESULT hr = S_OK;
+  std::string path;
+  bool is_timed_recording = false;
+  int64_t recorded_duration = 0;
+  {
+    // Taking the sink writer ends the writes of the sample threads.
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (!sink_writer_) {
+      return;
+    }
+    sink_writer = std::move(sink_writer_);
+    record_state_ = RecordState::kStopping;
+    hr = record_status_;
+    path = record_path_;
+    is_timed_recording = recording_type_ == RecordingType::kTimed;
+    recorded_duration = record_timeline_.stats().video_end_time;
+  }
+
+  // The file is complete only after the remaining samples are encoded.
+  if (SUCCEEDED(hr)) {
+    hr = sink_writer->Finalize();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    record_state_ = RecordState::kNotStarted;
+  }
+
+  if (!capture_controller_listener_) {
+    return;
+  }
+
+  // Always calls OnStopRecord listener methods to handle separate stop record
+  // request for timed records.
+  if (SUCCEEDED(hr)) {
+    capture_controller_listener_->OnStopRecordSucceeded(path);
+    if (is_timed_recording) {
+      capture_controller_listener_->OnVideoRecordSucceeded(
+          path, recorded_duration / 10000);
+    }
+  } else {
+    capture_controller_listener_->OnStopRecordFailed(
+        GetCameraResult(hr), "Failed to write video recording");
+    if (is_timed_recording) {
+      capture_controller_listener_->OnVideoRecordFailed(
+          GetCameraResult(hr), "Failed to write video recording");
+    }
+  }
+}
+
+void SourceReaderCaptureController::WriteRecordSample(IMFSample* sample) {
+  bool max_duration_reached = false;
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (!sink_writer_ || FAILED(record_status_)) {
+      return;
+    }
+
+    LONGLONG time = 0;
+    LONGLONG duration = 0;
+    HRESULT hr = sample->GetSampleTime(&time);
+    if (FAILED(hr)) {
+      record_status_ = hr;
+      return;
+    }
+    if (FAILED(sample->GetSampleDuration(&duration))) {
+      duration = 0;
+    }
+
+    // Uncompressed frames can all start a segment.
+    int64_t output_time = 0;
+    if (!record_timeline_.MapSampleTime(true, true, time, duration,
+                                        &output_time)) {
+      if (record_timeline_.HasReachedMaxDuration() && !max_duration_reached_) {
+        max_duration_reached_ = true;
+        max_duration_reached = true;
+      }
+    } else {
+      // The preview is done with the sample, so the sample time is updated
+      // in place.
+      hr = sample->SetSampleTime(output_time);
+      if (SUCCEEDED(hr)) {
+        hr = sink_writer_->WriteSample(sink_writer_stream_index_, sample);
+      }
+      if (FAILED(hr)) {
+        record_status_ = hr;
+      }
+    }
+  }
+
+  // Finalizing the recording waits for the encoder, so it is not done on the
+  // thread reading the samples.
+  if (max_duration_reached) {
+    PostTask([this]() { StopTimedRecord(); });
+  }
+}
+
+// Pauses the current recording. Read samples are dropped until the recording
+// is resumed, so that paused time is left out of the recording.
+void SourceReaderCaptureController::PauseRecord() {
+  assert(capture_controller_listener_);
+
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (record_state_ != RecordState::kRunning) {
+      return capture_controller_listener_->OnPauseRecordFailed(
+          CameraResult::kError, "Recording not running");
+    }
+    record_timeline_.Pause();
+    record_state_ = RecordState::kPaused;
+  }
+  capture_controller_listener_->OnPauseRecordSucceeded();
+}
+
+void SourceReaderCaptureController::ResumeRecord() {
+  assert(capture_controller_listener_);
+
+  {
+    std::lock_guard<std::mutex> lock(record_mutex_);
+    if (record_state_ != RecordState::kPaused) {
+      return capture_controller_listener_->OnResumeRecordFailed(
+          CameraResult::kError, "Recording not paused");
+    }
+    record_timeline_.Resume();
+    record_state_ = RecordState::kRunning;
+  }
+  capture_controller_listener_->OnResumeRecordSucceeded();
+}
+
+std::optional<RecordSampleStats>
+SourceReaderCaptureController::GetRecordingStats() const {
+  std::lock_guard<std::mutex> lock(record_mutex_);
+  if (recording_type_ == RecordingType::kNone) {
+    return std::nullopt;
+  }
+  return record_timeline_.stats();
+}
+
+std::optional<PreviewStatsSnapshot>
+SourceReaderCaptureController::GetPreviewStats() const {
+  if (!preview_stats_) {
+    return std::nullopt;
+  }
+  return preview_stats_->GetSnapshot();
+}
+
+bool SourceReaderCaptureController::SetZoomLevel(double zoom_level) {
+  if (!IsValidPreviewZoomLevel(zoom_level)) {
+    return false;
+  }
+  zoom_level_ = zoom_level;
+  if (texture_handler_) {
+    texture_handler_->SetCrop(preview_crop_rect_, zoom_level_);
+  }
+  return true;
+}
+
+bool SourceReaderCaptureController::SetPreviewCropRect(
+    const PreviewCropRect& crop_rect) {
+  if (!IsValidPreviewCropRect(crop_rect)) {
+    return false;
+  }
+  preview_crop_rect_ = crop_rect;
+  if (texture_handler_) {
+    texture_handler_->SetCrop(preview_crop_rect_, zoom_level_);
+  }
+  return true;
+}
+
+bool SourceReaderCaptureController::SetPreviewRotation(
+    PreviewRotation rotation) {
+  if (texture_handler_ && !texture_handler_->SetRotation(rotation)) {
+    return false;
+  }
+  preview_rotation_ = rotation;
+  return true;
+}
+
+void SourceReaderCaptureController::SetPreviewTargetFrameRate(
+    std::optional<double> frames_per_second) {
+  preview_frame_throttle_.SetTargetFrameRate(frames_per_second);
+}
+
+void SourceReaderCaptureController::SetPreviewWindowHidden(bool hidden) {
+  preview_frame_throttle_.SetHidden(hidden);
+}
+
+CameraControls* SourceReaderCaptureController::GetCameraControls() {
+  if (!video_source_) {
+    return nullptr;
+  }
+  // Control interfaces and ranges are queried once per device.
+  if (!camera_controls_) {
+    camera_controls_ =
+        std::make_unique<CameraControlsImpl>(video_source_.Get());
+  }
+  return camera_controls_.get();
+}
+
+// Starts reading samples for the preview.
+// After first frame is read, OnStartPreviewSucceeded is called.
+void SourceReaderCaptureController::StartPreview() {
+  assert(capture_controller_listener_);
+
+  if (!IsInitialized() || !texture_handler_) {
+    return capture_controller_listener_->OnStartPreviewFailed(
+        CameraResult::kError,
+        "Camera not initialized. Camera should be disposed and "
+        "reinitialized.");
+  }
+
+  PreviewState state = preview_state_.load();
+  if (state == PreviewState::kRunning || state == PreviewState::kPaused) {
+    return capture_controller_listener_->OnStartPreviewSucceeded(
+        preview_frame_width_, preview_frame_height_);
+  } else if (state != PreviewState::kNotStarted) {
+    return capture_controller_listener_->OnStartPreviewFailed(
+        CameraResult::kError, "Preview already exists");
+  }
+
+  texture_handler_->UpdateTextureSize(preview_frame_width_,
+                                      preview_frame_height_);
+  preview_state_.store(PreviewState::kStarting);
+
+  HRESULT hr = StartReadingSamples();
+  if (FAILED(hr)) {
+    preview_state_.store(PreviewState::kNotStarted);
+    return capture_controller_listener_->OnStartPreviewFailed(
+        GetCameraResult(hr), "Failed to start video preview");
+  }
+}
+
+// Marks preview as paused.
+// When preview is paused, read frames are not processed for preview
+// and flutter texture is not updated
+void SourceReaderCaptureController::PausePreview() {
+  assert(capture_controller_listener_);
+
+  PreviewState state = preview_state_.load();
+  if (state != PreviewState::kRunning && state != PreviewState::kPaused) {
+    return capture_controller_listener_->OnPausePreviewFailed(
+        CameraResult::kError, "Preview not started");
+  }
+
+  preview_state_.store(PreviewState::kPaused);
+  capture_controller_listener_->OnPausePreviewSucceeded();
+}
+
+// Marks preview as not paused.
+// When preview is not paused, read frames are processed for preview
+// and flutter texture is updated.
+void SourceReaderCaptureController::ResumePreview() {
+  assert(capture_controller_listener_);
+
+  PreviewState state = preview_state_.load();
+  if (state != PreviewState::kRunning && state != PreviewState::kPaused) {
+    return capture_controller_listener_->OnResumePreviewFailed(
+        CameraResult::kError, "Preview not started");
+  }
+
+  preview_state_.store(PreviewState::kRunning);
+  capture_controller_listener_->OnResumePreviewSucceeded();
+}
+
+bool SourceReaderCaptureController::IsReadyForSample() const {
+  if (!IsInitialized()) {
+    return false;
+  }
+
+  // Frames skipped by |preview_frame_throttle_| are still delivered while
+  // they are used by a picture, the image stream or the zero shutter lag
+  // buffer.
+  return picture_frame_requested_.load() ||
+         (preview_state_.load() == PreviewState::kRunning &&
+          (preview_frame_due_.load(std::memory_order_relaxed) ||
+           image_streaming_.load(std::memory_order_relaxed) ||
+           zero_shutter_lag_buffer_));
+}
+
+// Updates texture handlers buffer with given data.
+// Called via CaptureEngineListener for each read sample.
+// Implements CaptureEngineObserver::UpdateBuffer.
+bool SourceReaderCaptureController::UpdateBuffer(const uint8_t* buffer,
+                                                 uint32_t data_length,
+                                                 int32_t stride) {
+  const uint64_t capture_time_us =
+      last_capture_time_us_.load(std::memory_order_relaxed);
+
+  if (picture_frame_requested_.exchange(false)) {
+    picture_frame_buffer_.AddFrame(buffer, data_length, stride,
+                                   preview_frame_width_, preview_frame_height_,
+                                   preview_pixel_format_, capture_time_us);
+    PostTask([this]() { CompletePictureRequests(); });
+  }
+
+  if (preview_state_.load() != PreviewState::kRunning) {
+    return true;
+  }
+
+  const bool preview_frame_due =
+      preview_frame_due_.load(std::memory_order_relaxed);
+  if (preview_stats_ && preview_frame_due) {
+    preview_stats_->OnFrameReceived(capture_time_us,
+                                    PreviewStats::GetTimeUs());
+  }
+
+  DeliverImageStreamFrame(buffer, data_length, stride);
+
+  if (zero_shutter_lag_buffer_) {
+    zero_shutter_lag_buffer_->AddFrame(buffer, data_length, stride,
+                                       preview_frame_width_,
+                                       preview_frame_height_,
+                                       preview_pixel_format_, capture_time_us);
+  }
+
+  // Throttled frames are not converted into the preview texture.
+  if (!preview_frame_due) {
+    return true;
+  }
+
+  return texture_handler_ &&
+         texture_handler_->UpdateBuffer(buffer, data_length, stride);
+}
+
+// Updates texture handlers GPU surface with given texture.
+// Called via CaptureEngineListener for each read sample.
+// Implements CaptureEngineObserver::UpdateTexture.
+bool SourceReaderCaptureController::UpdateTexture(ID3D11Texture2D* texture,
+                                                  UINT subresource_index) {
+  // Throttled frames and pictures are read in |UpdateBuffer|.
+  if (preview_state_.load() != PreviewState::kRunning ||
+      !preview_frame_due_.load(std::memory_order_relaxed) ||
+      picture_frame_requested_.load()) {
+    return false;
+  }
+
+  // A sample that is not rendered here is delivered to |UpdateBuffer| with
+  // the same capture time, and keeps its frame id.
+  if (preview_stats_) {
+    preview_stats_->OnFrameReceived(
+        last_capture_time_us_.load(std::memory_order_relaxed),
+        PreviewStats::GetTimeUs());
+  }
+
+  // Image stream and zero shutter lag frames are read on the CPU, so the
+  // sample is delivered to |UpdateBuffer| instead while they are used.
+  return !image_streaming_.load(std::memory_order_acquire) &&
+         !zero_shutter_lag_buffer_ && texture_handler_ &&
+         texture_handler_->IsGpuSurfaceEnabled() &&
+         texture_handler_->UpdateTexture(texture, subresource_index);
+}
+
+// Handles capture time update from each read frame.
+// Called via CaptureEngineListener for each read sample.
+// Implements CaptureEngineObserver::UpdateCaptureTime.
+void SourceReaderCaptureController::UpdateCaptureTime(
+    uint64_t capture_time_us) {
+  if (!IsInitialized()) {
+    return;
+  }
+
+  // Used as the shutter time of pictures.
+  last_capture_time_us_.store(capture_time_us, std::memory_order_relaxed);
+  preview_frame_due_.store(
+      preview_frame_throttle_.ShouldDeliverFrame(capture_time_us),
+      std::memory_order_relaxed);
+
+  PreviewState starting = PreviewState::kStarting;
+  if (preview_state_.compare_exchange_strong(starting,
+                                             PreviewState::kRunning) &&
+      capture_controller_listener_) {
+    // Informs that first frame is read successfully and preview has started.
+    capture_controller_listener_->OnStartPreviewSucceeded(
+        preview_frame_width_, preview_frame_height_);
+  }
+}
+
+bool SourceReaderCaptureController::StartImageStream(
+    ImageStreamFormat format) {
+  if (!IsInitialized()) {
+    return false;
+  }
+
+  image_stream_format_ = format;
+  image_stream_pending_frames_.store(0, std::memory_order_relaxed);
+  image_streaming_.store(true, std::memory_order_release);
+  return true;
+}
+
+void SourceReaderCaptureController::StopImageStream() {
+  image_streaming_.store(false, std::memory_order_release);
+}
+
+void SourceReaderCaptureController::OnImageStreamFrameReceived() {
+  if (image_stream_pending_frames_.fetch_sub(1, std::memory_order_relaxed) <=
+      0) {
+    image_stream_pending_frames_.store(0, std::memory_order_relaxed);
+  }
+}
+
+void SourceReaderCaptureController::DeliverImageStreamFrame(
+    const uint8_t* data, uint32_t data_length, int32_t stride) {
+  if (!image_streaming_.load(std::memory_order_acquire) ||
+      image_stream_pending_frames_.load(std::memory_order_relaxed) >=
+          kMaxImageStreamPendingFrames) {
+    return;
+  }
+
+  ImageStreamFrame frame;
+  if (!BuildImageStreamFrame(data, data_length, stride, preview_frame_width_,
+                             preview_frame_height_, preview_pixel_format_,
+                             image_stream_format_, &frame)) {
+    return;
+  }
+
+  if (capture_controller_listener_->OnImageStreamFrameAvailable(frame)) {
+    image_stream_pending_frames_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,333 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_SOURCE_READER_CAPTURE_CONTROLLER_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_SOURCE_READER_CAPTURE_CONTROLLER_H_
+
+#include <d3d11.h>
+#include <flutter/texture_registrar.h>
+#include <mfapi.h>
+#include <mfidl.h>
+#include <mfreadwrite.h>
+#include <windows.h>
+#include <wrl/client.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "camera_controls.h"
+#include "capture_context.h"
+#include "capture_controller.h"
+#include "capture_controller_listener.h"
+#include "capture_engine_listener.h"
+#include "capture_work_queue.h"
+#include "photo_handler.h"
+#include "preview_crop.h"
+#include "preview_frame_throttle.h"
+#include "preview_handler.h"
+#include "preview_stats.h"
+#include "record_handler.h"
+#include "record_sample_writer.h"
+#include "texture_handler.h"
+#include "zero_shutter_lag_buffer.h"
+
+namespace camera_windows {
+using flutter::TextureRegistrar;
+using Microsoft::WRL::ComPtr;
+
+class SourceReaderCaptureController;
+
+// Forwards the results of an asynchronous |IMFSourceReader| to a
+// |SourceReaderCaptureController|.
+class SourceReaderListener : public IMFSourceReaderCallback {
+ public:
+  explicit SourceReaderListener(SourceReaderCaptureController* controller)
+      : controller_(controller) {
+    assert(controller);
+  }
+
+  ~SourceReaderListener() {}
+
+  // Disallow copy and move.
+  SourceReaderListener(const SourceReaderListener&) = delete;
+  SourceReaderListener& operator=(const SourceReaderListener&) = delete;
+
+  // Stops forwarding results, as the source reader may keep the listener
+  // alive after the controller is destroyed. Waits for a result that is being
+  // forwarded.
+  void Detach();
+
+  // IUnknown
+  STDMETHODIMP_(ULONG) AddRef();
+  STDMETHODIMP_(ULONG) Release();
+  STDMETHODIMP_(HRESULT) QueryInterface(const IID& riid, void** ppv);
+
+  // IMFSourceReaderCallback
+  STDMETHODIMP OnReadSample(HRESULT status, DWORD stream_index,
+                            DWORD stream_flags, LONGLONG timestamp,
+                            IMFSample* sample);
+  STDMETHODIMP OnFlush(DWORD stream_index);
+  STDMETHODIMP OnEvent(DWORD stream_index, IMFMediaEvent* event);
+
+ private:
+  std::mutex mutex_;
+  SourceReaderCaptureController* controller_;
+  volatile ULONG ref_ = 0;
+};
+
+// Implementation of the |CaptureController| interface on an asynchronous
+// |IMFSourceReader|, for previews that need the lowest latency.
+//
+// The capture engine queues samples between the camera, its preview sink
+// and the sample callback. The source reader is instead created in low
+// latency mode and reads a single sample at a time, which is delivered to the
+// preview texture from the callback of the read and followed by the next
+// read. Frames are converted to the preview pixel format by the advanced
+// video processor of the source reader, on the GPU for
+// |PreviewTextureMode::kGpuSurface|.
+//
+// Recordings are encoded from the same samples with an |IMFSinkWriter|, so
+// they have the preview resolution and no audio. Pictures are encoded from
+// the next preview frame, or from the buffered frame closest to the shutter
+// with |CaptureSettings::zero_shutter_lag|. Photo bursts, adaptive previews
+// and the recording settings only supported by the record sink of the
+// capture engine, such as proxies and chunk streaming, are not available.
+//
+// Pictures are encoded and timed recordings are stopped on a
+// |CaptureWorkQueue|, if one is given, instead of on the Media Foundation
+// thread delivering the samples.
+class SourceReaderCaptureController : public CaptureController,
+                                      public CaptureEngineObserver {
+ public:
+  // listener:   Listener informed of the results of the capture controller.
+  // work_queue: Queue that pictures are encoded and recordings finalized on,
+  //             or nullptr to do both on the calling thread.
+  explicit SourceReaderCaptureController(
+      CaptureControllerListener* listener,
+      std::unique_ptr<CaptureWorkQueue> work_queue = nullptr);
+  virtual ~SourceReaderCaptureController();
+
+  // Disallow copy and move.
+  SourceReaderCaptureController(const SourceReaderCaptureController&) = delete;
+  SourceReaderCaptureController& operator=(
+      const SourceReaderCaptureController&) = delete;
+
+  // CaptureController
+  bool InitCaptureDevice(
+      TextureRegistrar* texture_registrar, const std::string& device_id,
+      const CaptureSettings& settings,
+      std::shared_ptr<CaptureContext> capture_context) override;
+  uint32_t GetPreviewWidth() const override { return preview_frame_width_; }
+  uint32_t GetPreviewHeight() const override { return preview_frame_height_; }
+  std::vector<CaptureFormat> GetCaptureFormats() const override {
+    return capture_formats_;
+  }
+  std::optional<PreviewStatsSnapshot> GetPreviewStats() const override;
+  std::optional<RecordSampleStats> GetRecordingStats() const override;
+  bool SetZoomLevel(double zoom_level) override;
+  bool SetPreviewCropRect(const PreviewCropRect& crop_rect) override;
+  bool SetPreviewRotation(PreviewRotation rotation) override;
+  void SetPreviewTargetFrameRate(
+      std::optional<double> frames_per_second) override;
+  void SetPreviewWindowHidden(bool hidden) override;
+  CameraControls* GetCameraControls() override;
+  void StartPreview() override;
+  void PausePreview() override;
+  void ResumePreview() override;
+  void StartRecord(const std::string& file_path, int64_t max_video_duration_ms,
+                   const VideoRecordSettings& settings) override;
+  void StopRecord() override;
+  void PauseRecord() override;
+  void ResumeRecord() override;
+  void SetPictureRotation(PhotoRotation rotation) override;
+  void TakePicture(const std::string& file_path) override;
+  void TakePictureData(const PhotoSettings& settings) override;
+  void TakePictureBurst(const std::vector<std::string>& file_paths) override;
+  bool StartImageStream(ImageStreamFormat format) override;
+  void StopImageStream() override;
+  void OnImageStreamFrameReceived() override;
+
+  // CaptureEngineObserver
+  //
+  // Read samples are unpacked by a |CaptureEngineListener|, as the samples of
+  // the preview sink of the capture engine are.
+  void OnEvent(IMFMediaEvent* event) override {}
+  void OnSynchronizedEvent(IMFMediaEvent* event) override {}
+  bool IsReadyForSample() const override;
+  bool UpdateBuffer(const uint8_t* data, uint32_t data_length,
+                    int32_t stride) override;
+  bool UpdateTexture(ID3D11Texture2D* texture, UINT subresource_index) override;
+  void UpdateCaptureTime(uint64_t capture_time) override;
+
+  // Handles the result of a sample read. Writes the sample to the recording,
+  // delivers it to the preview and reads the next sample.
+  //
+  // Called by |SourceReaderListener| on a Media Foundation thread.
+  void OnReadSample(HRESULT status, DWORD stream_flags, IMFSample* sample);
+
+  // Sets source reader, for testing purposes.
+  void SetSourceReader(IMFSourceReader* source_reader) {
+    source_reader_ = source_reader;
+  }
+
+  // Sets video source, for testing purposes.
+  void SetVideoSource(IMFMediaSource* video_source) {
+    video_source_ = video_source;
+  }
+
+ private:
+  // A picture waiting for a preview frame.
+  struct PictureRequest {
+    // True for a photo returned in memory instead of written to |file_path|.
+    bool return_data = false;
+    std::string file_path;
+    // Encoder settings of the photo, including the picture rotation.
+    PhotoSettings settings;
+    // Capture time of the last frame when the picture was requested.
+    uint64_t shutter_time_us = 0;
+  };
+
+  // Returns true if the capture device is initialized.
+  bool IsInitialized() const {
+    return capture_engine_state_ == CaptureEngineState::kInitialized;
+  }
+
+  // Resets capture controller state.
+  // This is called if source reader creation fails or is disposed.
+  void ResetCaptureController();
+
+  // Creates the video source and the source reader reading from it.
+  HRESULT CreateSourceReader();
+
+  // Selects the native media type of the camera and the output media type
+  // of the source reader.
+  HRESULT SetSourceReaderMediaTypes();
+
+  // Creates and registers the preview texture, and informs the listener that
+  // the capture device is initialized.
+  void OnSourceReaderCreated();
+
+  // Returns true while samples are needed by the preview, a recording or a
+  // picture.
+  bool ShouldReadSamples() const;
+
+  // Requests the next sample unless a read is already pending.
+  HRESULT StartReadingSamples();
+
+  // Requests the next sample after a sample was read, or stops reading if no
+  // more samples are needed.
+  void ContinueReadingSamples();
+
+  // Handles a failed sample read.
+  void OnReadError(HRESULT status);
+
+  // Creates the sink writer of a recording encoding the output media type
+  // of the source reader.
+  HRESULT CreateSinkWriter(const std::string& file_path,
+                           const VideoRecordSettings& settings,
+                           IMFSinkWriter** sink_writer, DWORD* stream_index);
+
+  // Writes a read sample to the running recording.
+  void WriteRecordSample(IMFSample* sample);
+
+  // Completes the recorded file and informs the listener. Does nothing if
+  // the recording was already completed.
+  void FinalizeRecord();
+
+  // Stops a timed recording once it reached its maximum duration.
+  void StopTimedRecord();
+
+  // Queues a picture, which is encoded from the next preview frame, or from
+  // the zero shutter lag buffer while the preview is running.
+  void RequestPicture(PictureRequest request);
+
+  // Requests the next read sample for the queued pictures.
+  void RequestPictureFrame();
+
+  // Encodes the queued pictures, and informs the listener.
+  void CompletePictureRequests();
+
+  // Informs the listener that a picture failed.
+  void OnPictureFailed(const PictureRequest& request, CameraResult result,
+                       const std::string& error);
+
+  // Runs |task| on the work queue, or right away if there is none.
+  void PostTask(std::function<void()> task);
+
+  // Converts a preview frame and delivers it to the image stream, unless too
+  // many frames are already waiting for Dart.
+  void DeliverImageStreamFrame(const uint8_t* data, uint32_t data_length,
+                               int32_t stride);
+
+  uint32_t preview_frame_width_ = 0;
+  uint32_t preview_frame_height_ = 0;
+  PreviewCropRect preview_crop_rect_;
+  PreviewRotation preview_rotation_ = PreviewRotation::kNone;
+  double zoom_level_ = kMinPreviewZoomLevel;
+  PhotoRotation picture_rotation_ = PhotoRotation::kNone;
+  ImageStreamFormat image_stream_format_ = ImageStreamFormat::kBGRA8888;
+  std::atomic<bool> image_streaming_{false};
+  std::atomic<int> image_stream_pending_frames_{0};
+  std::atomic<uint64_t> last_capture_time_us_{0};
+  std::atomic<PreviewState> preview_state_{PreviewState::kNotStarted};
+  PreviewFrameThrottle preview_frame_throttle_;
+  // Whether the last sample should be converted into the preview texture.
+  std::atomic<bool> preview_frame_due_{true};
+  // True while a sample read is pending.
+  std::atomic<bool> reading_samples_{false};
+
+  // Frames kept for pictures. |picture_frame_buffer_| receives the next
+  // frame after a picture is requested.
+  std::unique_ptr<ZeroShutterLagBuffer> zero_shutter_lag_buffer_;
+  ZeroShutterLagBuffer picture_frame_buffer_{1};
+  std::atomic<bool> picture_frame_requested_{false};
+  std::mutex picture_mutex_;
+  std::vector<PictureRequest> picture_requests_;
+  std::unique_ptr<PhotoHandler> photo_handler_;
+
+  // Guards the recording, which is written on the sample threads.
+  mutable std::mutex record_mutex_;
+  ComPtr<IMFSinkWriter> sink_writer_;
+  DWORD sink_writer_stream_index_ = 0;
+  HRESULT record_status_ = S_OK;
+  RecordState record_state_ = RecordState::kNotStarted;
+  // Type of the last recording, which keeps its statistics after it stopped.
+  RecordingType recording_type_ = RecordingType::kNone;
+  RecordTimeline record_timeline_;
+  bool max_duration_reached_ = false;
+  std::string record_path_;
+
+  // Shared with |texture_handler_|, which may outlive the controller until
+  // its texture is unregistered.
+  std::shared_ptr<PreviewStats> preview_stats_;
+  std::unique_ptr<TextureHandler> texture_handler_;
+  std::unique_ptr<CameraControls> camera_controls_;
+  CaptureControllerListener* capture_controller_listener_;
+  std::unique_ptr<CaptureWorkQueue> work_queue_;
+
+  std::string video_device_id_;
+  CaptureEngineState capture_engine_state_ =
+      CaptureEngineState::kNotInitialized;
+  ResolutionPreset resolution_preset_ = ResolutionPreset::kMedium;
+  float target_frame_rate_ = 0.f;
+  PreviewTextureMode preview_texture_mode_ = PreviewTextureMode::kPixelBuffer;
+  PreviewPixelFormat preview_pixel_format_ = PreviewPixelFormat::kRGB32;
+  std::shared_ptr<CaptureContext> capture_context_;
+  ComPtr<IMFMediaSource> video_source_;
+  ComPtr<IMFSourceReader> source_reader_;
+  ComPtr<SourceReaderListener> source_reader_listener_;
+  ComPtr<CaptureEngineListener> sample_listener_;
+  std::vector<CaptureFormat> capture_formats_;
+
+  TextureRegistrar* texture_registrar_ = nullptr;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_SOURCE_READER_CAPTURE_CONTROLLER_H_
@@ -0,0 +1,106 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "audio_media_type_cache.h"
+
+#include <gtest/gtest.h>
+#include <mferror.h>
+#include <windows.h>
+
+namespace camera_windows {
+
+namespace test {
+
+namespace {
+
+AacMediaType CreateAacMediaType(uint32_t sample_rate, uint32_t channels,
+                                uint32_t bitrate) {
+  AacMediaType media_type;
+  media_type.sample_rate = sample_rate;
+  media_type.channels = channels;
+  media_type.bitrate = bitrate;
+  return media_type;
+}
+
+// Counts enumerations and returns |result|, without activating encoders.
+class FakeAacMediaTypeCache : public AacMediaTypeCache {
+ public:
+  int enumeration_count = 0;
+  HRESULT result = S_OK;
+
+ protected:
+  HRESULT EnumerateMediaTypes(MediaTypeList* media_types) override {
+    enumeration_count++;
+    if (SUCCEEDED(result)) {
+      media_types->push_back(CreateAacMediaType(44100, 2, 96000));
+      media_types->push_back(CreateAacMediaType(48000, 2, 128000));
+    }
+    return result;
+  }
+};
+
+}  // namespace
+
+TEST(AacMediaTypeCache, EnumeratesMediaTypesOnlyOnce) {
+  FakeAacMediaTypeCache cache;
+
+  auto first = cache.GetMediaTypes();
+  auto second = cache.GetMediaTypes();
+
+  EXPECT_EQ(cache.enumeration_count, 1);
+  ASSERT_EQ(first->size(), 2u);
+  EXPECT_EQ(first.get(), second.get());
+
+  cache.Clear();
+  cache.GetMediaTypes();
+  EXPECT_EQ(cache.enumeration_count, 2);
+}
+
+TEST(AacMediaTypeCache, RetriesFailedEnumeration) {
+  FakeAacMediaTypeCache cache;
+  cache.result = MF_E_TOPO_CODEC_NOT_FOUND;
+
+  EXPECT_TRUE(cache.GetMediaTypes()->empty());
+
+  cache.result = S_OK;
+  EXPECT_EQ(cache.GetMediaTypes()->size(), 2u);
+  EXPECT_EQ(cache.enumeration_count, 2);
+}
+
+TEST(FindBestAacMediaType, KeepsTranscoderOrderWithoutSettings) {
+  AacMediaTypeCache::MediaTypeList media_types = {
+      CreateAacMediaType(44100, 2, 96000),
+      CreateAacMediaType(48000, 2, 192000),
+  };
+
+  EXPECT_EQ(FindBestAacMediaType(media_types, 0, 0, 0), &media_types[0]);
+}
+
+TEST(FindBestAacMediaType, MatchesSampleRateAndChannels) {
+  AacMediaTypeCache::MediaTypeList media_types = {
+      CreateAacMediaType(44100, 2, 96000),
+      CreateAacMediaType(48000, 2, 96000),
+      CreateAacMediaType(48000, 1, 96000),
+  };
+
+  EXPECT_EQ(FindBestAacMediaType(media_types, 48000, 0, 0), &media_types[1]);
+  EXPECT_EQ(FindBestAacMediaType(media_types, 48000, 1, 0), &media_types[2]);
+  EXPECT_EQ(FindBestAacMediaType(media_types, 22050, 0, 0), nullptr);
+  EXPECT_EQ(FindBestAacMediaType(media_types, 44100, 6, 0), nullptr);
+}
+
+TEST(FindBestAacMediaType, PrefersClosestBitrate) {
+  AacMediaTypeCache::MediaTypeList media_types = {
+      CreateAacMediaType(48000, 2, 96000),
+      CreateAacMediaType(48000, 2, 128000),
+      CreateAacMediaType(48000, 2, 192000),
+  };
+
+  EXPECT_EQ(FindBestAacMediaType(media_types, 0, 0, 120000), &media_types[1]);
+  EXPECT_EQ(FindBestAacMediaType(media_types, 0, 0, 320000), &media_types[2]);
+  EXPECT_EQ(FindBestAacMediaType(media_types, 0, 0, 1), &media_types[0]);
+}
+
+}  // namespace test
+}  // namespace camera_windows
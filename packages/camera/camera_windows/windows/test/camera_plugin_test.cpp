@@ -4,31 +4,31 @@
 
 #include "camera_plugin.h"
 
-#include <flutter/method_call.h>
-#include <flutter/method_result_functions.h>
-#include <flutter/standard_method_codec.h>
 #include <flutter/texture_registrar.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <windows.h>
 
+#include <any>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "mocks.h"
 
 namespace camera_windows {
 namespace test {
 
-using flutter::EncodableMap;
+using flutter::EncodableList;
 using flutter::EncodableValue;
 using ::testing::_;
 using ::testing::DoAll;
 using ::testing::EndsWith;
 using ::testing::Eq;
-using ::testing::Pointee;
 using ::testing::Return;
+using ::testing::SetArgPointee;
 
 void MockInitCamera(MockCamera* camera, bool success) {
   EXPECT_CALL(*camera,
@@ -50,11 +50,13 @@ void MockInitCamera(MockCamera* camera, bool success) {
 
   EXPECT_CALL(*camera, InitCamera)
       .Times(1)
-      .WillOnce([camera, success](flutter::TextureRegistrar* texture_registrar,
-                                  flutter::BinaryMessenger* messenger,
-                                  bool record_audio,
-                                  ResolutionPreset resolution_preset) {
+      .WillOnce([camera, success](
+                    flutter::TextureRegistrar* texture_registrar,
+                    flutter::BinaryMessenger* messenger,
+                    const CaptureSettings& settings,
+                    std::shared_ptr<CaptureContext> capture_context) {
         assert(camera->pending_result_);
+        EXPECT_TRUE(capture_context);
         if (success) {
           camera->pending_result_->Success(EncodableValue(1));
           return true;
@@ -65,6 +67,22 @@ void MockInitCamera(MockCamera* camera, bool success) {
       });
 }
 
+// Returns media settings without optional capture settings.
+PlatformMediaSettings CreateMediaSettings() {
+  return PlatformMediaSettings(
+      /*enable_audio=*/true, PlatformPreviewTextureMode::pixelBuffer,
+      /*adaptive_preview=*/false, PlatformPreviewPixelFormat::rgb32,
+      /*zero_shutter_lag=*/false, /*preview_stats=*/false,
+      PlatformCaptureBackend::captureEngine);
+}
+
+// Returns video recording settings without optional encoder settings.
+PlatformVideoRecordingSettings CreateVideoRecordingSettings() {
+  return PlatformVideoRecordingSettings(PlatformVideoCodec::h264,
+                                        /*prefer_hardware_encoder=*/true,
+                                        /*stream_chunks=*/false);
+}
+
 TEST(CameraPlugin, AvailableCamerasHandlerSuccessIfNoCameras) {
   std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
       std::make_unique<MockTextureRegistrar>();
@@ -72,8 +90,6 @@ TEST(CameraPlugin, AvailableCamerasHandlerSuccessIfNoCameras) {
       std::make_unique<MockBinaryMessenger>();
   std::unique_ptr<MockCameraFactory> camera_factory_ =
       std::make_unique<MockCameraFactory>();
-  std::unique_ptr<MockMethodResult> result =
-      std::make_unique<MockMethodResult>();
 
   MockCameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
                           std::move(camera_factory_));
@@ -87,13 +103,56 @@ TEST(CameraPlugin, AvailableCamerasHandlerSuccessIfNoCameras) {
         return true;
       });
 
-  EXPECT_CALL(*result, ErrorInternal).Times(0);
-  EXPECT_CALL(*result, SuccessInternal).Times(1);
+  bool result_called = false;
+  plugin.GetAvailableCameras(
+      [&result_called](ErrorOr<EncodableList> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_FALSE(reply.has_error());
+        EXPECT_TRUE(reply.value().empty());
+      });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, AvailableCamerasHandlerCachesCamerasUntilChanged) {
+  std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
+      std::make_unique<MockTextureRegistrar>();
+  std::unique_ptr<MockBinaryMessenger> messenger_ =
+      std::make_unique<MockBinaryMessenger>();
+  std::unique_ptr<MockCameraFactory> camera_factory_ =
+      std::make_unique<MockCameraFactory>();
+
+  MockCameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
+                          std::move(camera_factory_));
+  plugin.EnableAvailableCamerasCache();
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("availableCameras",
-                          std::make_unique<EncodableValue>()),
-      std::move(result));
+  // Devices are enumerated again only after a change.
+  EXPECT_CALL(plugin, EnumerateVideoCaptureDeviceSources)
+      .Times(2)
+      .WillRepeatedly([](IMFActivate*** devices, UINT32* count) {
+        *count = 0U;
+        *devices = static_cast<IMFActivate**>(
+            CoTaskMemAlloc(sizeof(IMFActivate*) * (*count)));
+        return true;
+      });
+  EXPECT_CALL(*messenger_, Send).Times(1);
+
+  for (int i = 0; i < 3; i++) {
+    if (i == 2) {
+      plugin.NotifyCamerasChanged();
+    }
+
+    bool result_called = false;
+    plugin.GetAvailableCameras(
+        [&result_called](ErrorOr<EncodableList> reply) {
+          EXPECT_FALSE(result_called);
+          result_called = true;
+          EXPECT_FALSE(reply.has_error());
+        });
+
+    EXPECT_TRUE(result_called);
+  }
 }
 
 TEST(CameraPlugin, AvailableCamerasHandlerErrorIfFailsToEnumerateDevices) {
@@ -103,8 +162,6 @@ TEST(CameraPlugin, AvailableCamerasHandlerErrorIfFailsToEnumerateDevices) {
       std::make_unique<MockBinaryMessenger>();
   std::unique_ptr<MockCameraFactory> camera_factory_ =
       std::make_unique<MockCameraFactory>();
-  std::unique_ptr<MockMethodResult> result =
-      std::make_unique<MockMethodResult>();
 
   MockCameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
                           std::move(camera_factory_));
@@ -113,18 +170,64 @@ TEST(CameraPlugin, AvailableCamerasHandlerErrorIfFailsToEnumerateDevices) {
       .Times(1)
       .WillOnce([](IMFActivate*** devices, UINT32* count) { return false; });
 
-  EXPECT_CALL(*result, ErrorInternal).Times(1);
-  EXPECT_CALL(*result, SuccessInternal).Times(0);
+  bool result_called = false;
+  plugin.GetAvailableCameras(
+      [&result_called](ErrorOr<EncodableList> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_TRUE(reply.has_error());
+      });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, AvailableAudioDevicesHandlerSuccessIfNoDevices) {
+  std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
+      std::make_unique<MockTextureRegistrar>();
+  std::unique_ptr<MockBinaryMessenger> messenger_ =
+      std::make_unique<MockBinaryMessenger>();
+  std::unique_ptr<MockCameraFactory> camera_factory_ =
+      std::make_unique<MockCameraFactory>();
+
+  MockCameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
+                          std::move(camera_factory_));
+
+  EXPECT_CALL(plugin, EnumerateAudioCaptureDeviceSources)
+      .Times(1)
+      .WillOnce([](IMFActivate*** devices, UINT32* count) {
+        *count = 0U;
+        *devices = static_cast<IMFActivate**>(
+            CoTaskMemAlloc(sizeof(IMFActivate*) * (*count)));
+        return true;
+      });
+
+  ErrorOr<EncodableList> reply = plugin.GetAvailableAudioDevices();
+
+  EXPECT_FALSE(reply.has_error());
+  EXPECT_EQ(reply.value(), EncodableList());
+}
+
+TEST(CameraPlugin, AvailableAudioDevicesHandlerErrorIfEnumerationFails) {
+  std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
+      std::make_unique<MockTextureRegistrar>();
+  std::unique_ptr<MockBinaryMessenger> messenger_ =
+      std::make_unique<MockBinaryMessenger>();
+  std::unique_ptr<MockCameraFactory> camera_factory_ =
+      std::make_unique<MockCameraFactory>();
+
+  MockCameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
+                          std::move(camera_factory_));
+
+  EXPECT_CALL(plugin, EnumerateAudioCaptureDeviceSources)
+      .Times(1)
+      .WillOnce([](IMFActivate*** devices, UINT32* count) { return false; });
+
+  ErrorOr<EncodableList> reply = plugin.GetAvailableAudioDevices();
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("availableCameras",
-                          std::make_unique<EncodableValue>()),
-      std::move(result));
+  EXPECT_TRUE(reply.has_error());
 }
 
 TEST(CameraPlugin, CreateHandlerCallsInitCamera) {
-  std::unique_ptr<MockMethodResult> result =
-      std::make_unique<MockMethodResult>();
   std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
       std::make_unique<MockTextureRegistrar>();
   std::unique_ptr<MockBinaryMessenger> messenger_ =
@@ -142,26 +245,22 @@ TEST(CameraPlugin, CreateHandlerCallsInitCamera) {
 
   EXPECT_CALL(*camera_factory_, CreateCamera(MOCK_DEVICE_ID));
 
-  EXPECT_CALL(*result, ErrorInternal).Times(0);
-  EXPECT_CALL(*result, SuccessInternal(Pointee(EncodableValue(1))));
-
   CameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
                       std::move(camera_factory_));
-  EncodableMap args = {
-      {EncodableValue("cameraName"), EncodableValue(MOCK_CAMERA_NAME)},
-      {EncodableValue("resolutionPreset"), EncodableValue(nullptr)},
-      {EncodableValue("enableAudio"), EncodableValue(true)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("create",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(result));
+
+  bool result_called = false;
+  plugin.Create(MOCK_CAMERA_NAME, CreateMediaSettings(),
+                [&result_called](ErrorOr<int64_t> reply) {
+                  EXPECT_FALSE(result_called);
+                  result_called = true;
+                  EXPECT_FALSE(reply.has_error());
+                  EXPECT_EQ(reply.value(), 1);
+                });
+
+  EXPECT_TRUE(result_called);
 }
 
 TEST(CameraPlugin, CreateHandlerErrorOnInvalidDeviceId) {
-  std::unique_ptr<MockMethodResult> result =
-      std::make_unique<MockMethodResult>();
   std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
       std::make_unique<MockTextureRegistrar>();
   std::unique_ptr<MockBinaryMessenger> messenger_ =
@@ -171,25 +270,36 @@ TEST(CameraPlugin, CreateHandlerErrorOnInvalidDeviceId) {
 
   CameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
                       std::move(camera_factory_));
-  EncodableMap args = {
-      {EncodableValue("cameraName"), EncodableValue(MOCK_INVALID_CAMERA_NAME)},
-      {EncodableValue("resolutionPreset"), EncodableValue(nullptr)},
-      {EncodableValue("enableAudio"), EncodableValue(true)},
-  };
-
-  EXPECT_CALL(*result, ErrorInternal).Times(1);
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("create",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(result));
+
+  bool result_called = false;
+  plugin.Create(MOCK_INVALID_CAMERA_NAME, CreateMediaSettings(),
+                [&result_called](ErrorOr<int64_t> reply) {
+                  EXPECT_FALSE(result_called);
+                  result_called = true;
+                  EXPECT_TRUE(reply.has_error());
+                });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, PrewarmHandlerErrorOnInvalidDeviceId) {
+  std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
+      std::make_unique<MockTextureRegistrar>();
+  std::unique_ptr<MockBinaryMessenger> messenger_ =
+      std::make_unique<MockBinaryMessenger>();
+  std::unique_ptr<MockCameraFactory> camera_factory_ =
+      std::make_unique<MockCameraFactory>();
+
+  CameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
+                      std::move(camera_factory_));
+
+  std::optional<FlutterError> error =
+      plugin.Prewarm(MOCK_INVALID_CAMERA_NAME);
+
+  EXPECT_TRUE(error.has_value());
 }
 
 TEST(CameraPlugin, CreateHandlerErrorOnExistingDeviceId) {
-  std::unique_ptr<MockMethodResult> first_create_result =
-      std::make_unique<MockMethodResult>();
-  std::unique_ptr<MockMethodResult> second_create_result =
-      std::make_unique<MockMethodResult>();
   std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
       std::make_unique<MockTextureRegistrar>();
   std::unique_ptr<MockBinaryMessenger> messenger_ =
@@ -207,37 +317,32 @@ TEST(CameraPlugin, CreateHandlerErrorOnExistingDeviceId) {
 
   EXPECT_CALL(*camera_factory_, CreateCamera(MOCK_DEVICE_ID));
 
-  EXPECT_CALL(*first_create_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*first_create_result,
-              SuccessInternal(Pointee(EncodableValue(1))));
-
   CameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
                       std::move(camera_factory_));
-  EncodableMap args = {
-      {EncodableValue("cameraName"), EncodableValue(MOCK_CAMERA_NAME)},
-      {EncodableValue("resolutionPreset"), EncodableValue(nullptr)},
-      {EncodableValue("enableAudio"), EncodableValue(true)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("create",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(first_create_result));
-
-  EXPECT_CALL(*second_create_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*second_create_result, SuccessInternal).Times(0);
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("create",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(second_create_result));
+
+  bool first_result_called = false;
+  plugin.Create(MOCK_CAMERA_NAME, CreateMediaSettings(),
+                [&first_result_called](ErrorOr<int64_t> reply) {
+                  EXPECT_FALSE(first_result_called);
+                  first_result_called = true;
+                  EXPECT_FALSE(reply.has_error());
+                  EXPECT_EQ(reply.value(), 1);
+                });
+
+  EXPECT_TRUE(first_result_called);
+
+  bool second_result_called = false;
+  plugin.Create(MOCK_CAMERA_NAME, CreateMediaSettings(),
+                [&second_result_called](ErrorOr<int64_t> reply) {
+                  EXPECT_FALSE(second_result_called);
+                  second_result_called = true;
+                  EXPECT_TRUE(reply.has_error());
+                });
+
+  EXPECT_TRUE(second_result_called);
 }
 
 TEST(CameraPlugin, CreateHandlerAllowsRetry) {
-  std::unique_ptr<MockMethodResult> first_create_result =
-      std::make_unique<MockMethodResult>();
-  std::unique_ptr<MockMethodResult> second_create_result =
-      std::make_unique<MockMethodResult>();
   std::unique_ptr<MockTextureRegistrar> texture_registrar_ =
       std::make_unique<MockTextureRegistrar>();
   std::unique_ptr<MockBinaryMessenger> messenger_ =
@@ -265,38 +370,34 @@ TEST(CameraPlugin, CreateHandlerAllowsRetry) {
         return second_camera;
       });
 
-  EXPECT_CALL(*first_create_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*first_create_result, SuccessInternal).Times(0);
-
   CameraPlugin plugin(texture_registrar_.get(), messenger_.get(),
                       std::move(camera_factory_));
-  EncodableMap args = {
-      {EncodableValue("cameraName"), EncodableValue(MOCK_CAMERA_NAME)},
-      {EncodableValue("resolutionPreset"), EncodableValue(nullptr)},
-      {EncodableValue("enableAudio"), EncodableValue(true)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("create",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(first_create_result));
-
-  EXPECT_CALL(*second_create_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*second_create_result,
-              SuccessInternal(Pointee(EncodableValue(1))));
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("create",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(second_create_result));
+
+  bool first_result_called = false;
+  plugin.Create(MOCK_CAMERA_NAME, CreateMediaSettings(),
+                [&first_result_called](ErrorOr<int64_t> reply) {
+                  EXPECT_FALSE(first_result_called);
+                  first_result_called = true;
+                  EXPECT_TRUE(reply.has_error());
+                });
+
+  EXPECT_TRUE(first_result_called);
+
+  bool second_result_called = false;
+  plugin.Create(MOCK_CAMERA_NAME, CreateMediaSettings(),
+                [&second_result_called](ErrorOr<int64_t> reply) {
+                  EXPECT_FALSE(second_result_called);
+                  second_result_called = true;
+                  EXPECT_FALSE(reply.has_error());
+                  EXPECT_EQ(reply.value(), 1);
+                });
+
+  EXPECT_TRUE(second_result_called);
 }
 
 TEST(CameraPlugin, InitializeHandlerCallStartPreview) {
   int64_t mock_camera_id = 1234;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -333,7 +434,8 @@ TEST(CameraPlugin, InitializeHandlerCallStartPreview) {
       .Times(1)
       .WillOnce([cam = camera.get()]() {
         assert(cam->pending_result_);
-        return cam->pending_result_->Success();
+        return cam->pending_result_->Success(EncodableValue(
+            flutter::CustomEncodableValue(PlatformSize(1920, 1080))));
       });
 
   camera->camera_id_ = mock_camera_id;
@@ -346,26 +448,23 @@ TEST(CameraPlugin, InitializeHandlerCallStartPreview) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(1);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(mock_camera_id)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("initialize",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  bool result_called = false;
+  plugin.Initialize(mock_camera_id,
+                    [&result_called](ErrorOr<PlatformSize> reply) {
+                      EXPECT_FALSE(result_called);
+                      result_called = true;
+                      EXPECT_FALSE(reply.has_error());
+                      EXPECT_EQ(reply.value().width(), 1920);
+                      EXPECT_EQ(reply.value().height(), 1080);
+                    });
+
+  EXPECT_TRUE(result_called);
 }
 
 TEST(CameraPlugin, InitializeHandlerErrorOnInvalidCameraId) {
   int64_t mock_camera_id = 1234;
   int64_t missing_camera_id = 5678;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -392,25 +491,20 @@ TEST(CameraPlugin, InitializeHandlerErrorOnInvalidCameraId) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(0);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(missing_camera_id)},
-  };
+  bool result_called = false;
+  plugin.Initialize(missing_camera_id,
+                    [&result_called](ErrorOr<PlatformSize> reply) {
+                      EXPECT_FALSE(result_called);
+                      result_called = true;
+                      EXPECT_TRUE(reply.has_error());
+                    });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("initialize",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
 TEST(CameraPlugin, TakePictureHandlerCallsTakePictureWithPath) {
   int64_t mock_camera_id = 1234;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -447,7 +541,7 @@ TEST(CameraPlugin, TakePictureHandlerCallsTakePictureWithPath) {
       .Times(1)
       .WillOnce([cam = camera.get()](const std::string& file_path) {
         assert(cam->pending_result_);
-        return cam->pending_result_->Success();
+        return cam->pending_result_->Success(EncodableValue(file_path));
       });
 
   camera->camera_id_ = mock_camera_id;
@@ -460,26 +554,22 @@ TEST(CameraPlugin, TakePictureHandlerCallsTakePictureWithPath) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(1);
+  bool result_called = false;
+  plugin.TakePicture(mock_camera_id,
+                     [&result_called](ErrorOr<std::string> reply) {
+                       EXPECT_FALSE(result_called);
+                       result_called = true;
+                       EXPECT_FALSE(reply.has_error());
+                       EXPECT_THAT(reply.value(), EndsWith(".jpeg"));
+                     });
 
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(mock_camera_id)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("takePicture",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
 TEST(CameraPlugin, TakePictureHandlerErrorOnInvalidCameraId) {
   int64_t mock_camera_id = 1234;
   int64_t missing_camera_id = 5678;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -506,25 +596,20 @@ TEST(CameraPlugin, TakePictureHandlerErrorOnInvalidCameraId) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(0);
+  bool result_called = false;
+  plugin.TakePicture(missing_camera_id,
+                     [&result_called](ErrorOr<std::string> reply) {
+                       EXPECT_FALSE(result_called);
+                       result_called = true;
+                       EXPECT_TRUE(reply.has_error());
+                     });
 
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(missing_camera_id)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("takePicture",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin, StartVideoRecordingHandlerCallsStartRecordWithPath) {
+TEST(CameraPlugin, TakePictureBurstHandlerCallsTakePictureBurstWithPaths) {
   int64_t mock_camera_id = 1234;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -537,12 +622,10 @@ TEST(CameraPlugin, StartVideoRecordingHandlerCallsStartRecordWithPath) {
         return cam->camera_id_ == camera_id;
       });
 
-  EXPECT_CALL(*camera,
-              HasPendingResultByType(Eq(PendingResultType::kStartRecord)))
-      .Times(1)
-      .WillOnce(Return(false));
+  EXPECT_CALL(*camera, HasPendingResultByType).WillRepeatedly(Return(false));
 
-  EXPECT_CALL(*camera, AddPendingResult(Eq(PendingResultType::kStartRecord), _))
+  EXPECT_CALL(*camera,
+              AddPendingResult(Eq(PendingResultType::kTakePictureBurst), _))
       .Times(1)
       .WillOnce([cam = camera.get()](PendingResultType type,
                                      std::unique_ptr<MethodResult<>> result) {
@@ -557,12 +640,16 @@ TEST(CameraPlugin, StartVideoRecordingHandlerCallsStartRecordWithPath) {
         return cam->capture_controller_.get();
       });
 
-  EXPECT_CALL(*capture_controller, StartRecord(EndsWith(".mp4"), -1))
+  EXPECT_CALL(*capture_controller, TakePictureBurst)
       .Times(1)
-      .WillOnce([cam = camera.get()](const std::string& file_path,
-                                     int64_t max_video_duration_ms) {
+      .WillOnce([cam = camera.get()](
+                    const std::vector<std::string>& file_paths) {
+        EXPECT_EQ(file_paths.size(), 3u);
+        EXPECT_THAT(file_paths[0], EndsWith("_1.jpeg"));
+        EXPECT_THAT(file_paths[2], EndsWith("_3.jpeg"));
         assert(cam->pending_result_);
-        return cam->pending_result_->Success();
+        return cam->pending_result_->Success(EncodableValue(
+            EncodableList(file_paths.begin(), file_paths.end())));
       });
 
   camera->camera_id_ = mock_camera_id;
@@ -575,26 +662,20 @@ TEST(CameraPlugin, StartVideoRecordingHandlerCallsStartRecordWithPath) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(1);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(mock_camera_id)},
-  };
+  bool result_called = false;
+  plugin.TakePictureBurst(mock_camera_id, 3,
+                          [&result_called](ErrorOr<EncodableList> reply) {
+                            EXPECT_FALSE(result_called);
+                            result_called = true;
+                            EXPECT_FALSE(reply.has_error());
+                            EXPECT_EQ(reply.value().size(), 3u);
+                          });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("startVideoRecording",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin,
-     StartVideoRecordingHandlerCallsStartRecordWithPathAndCaptureDuration) {
+TEST(CameraPlugin, TakePictureDataHandlerCallsTakePictureDataWithSettings) {
   int64_t mock_camera_id = 1234;
-  int32_t mock_video_duration = 100000;
-
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
 
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
@@ -608,12 +689,10 @@ TEST(CameraPlugin,
         return cam->camera_id_ == camera_id;
       });
 
-  EXPECT_CALL(*camera,
-              HasPendingResultByType(Eq(PendingResultType::kStartRecord)))
-      .Times(1)
-      .WillOnce(Return(false));
+  EXPECT_CALL(*camera, HasPendingResultByType).WillRepeatedly(Return(false));
 
-  EXPECT_CALL(*camera, AddPendingResult(Eq(PendingResultType::kStartRecord), _))
+  EXPECT_CALL(*camera,
+              AddPendingResult(Eq(PendingResultType::kTakePictureData), _))
       .Times(1)
       .WillOnce([cam = camera.get()](PendingResultType type,
                                      std::unique_ptr<MethodResult<>> result) {
@@ -628,13 +707,15 @@ TEST(CameraPlugin,
         return cam->capture_controller_.get();
       });
 
-  EXPECT_CALL(*capture_controller,
-              StartRecord(EndsWith(".mp4"), Eq(mock_video_duration)))
+  EXPECT_CALL(*capture_controller, TakePictureData)
       .Times(1)
-      .WillOnce([cam = camera.get()](const std::string& file_path,
-                                     int64_t max_video_duration_ms) {
+      .WillOnce([cam = camera.get()](const PhotoSettings& settings) {
+        EXPECT_EQ(settings.format, PhotoFormat::kPng);
+        // Quality is clamped to the supported range.
+        EXPECT_EQ(settings.quality, 100u);
         assert(cam->pending_result_);
-        return cam->pending_result_->Success();
+        return cam->pending_result_->Success(
+            EncodableValue(std::vector<uint8_t>({1, 2, 3})));
       });
 
   camera->camera_id_ = mock_camera_id;
@@ -647,26 +728,21 @@ TEST(CameraPlugin,
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(1);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(mock_camera_id)},
-      {EncodableValue("maxVideoDuration"), EncodableValue(mock_video_duration)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("startVideoRecording",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  int64_t quality = 150;
+  bool result_called = false;
+  plugin.TakePictureData(mock_camera_id, PlatformPictureFormat::png, &quality,
+                         [&result_called](ErrorOr<std::vector<uint8_t>> reply) {
+                           EXPECT_FALSE(result_called);
+                           result_called = true;
+                           EXPECT_FALSE(reply.has_error());
+                           EXPECT_EQ(reply.value().size(), 3u);
+                         });
+
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin, StartVideoRecordingHandlerErrorOnInvalidCameraId) {
+TEST(CameraPlugin, TakePictureBurstHandlerErrorOnInvalidPhotoCount) {
   int64_t mock_camera_id = 1234;
-  int64_t missing_camera_id = 5678;
-
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
 
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
@@ -674,18 +750,11 @@ TEST(CameraPlugin, StartVideoRecordingHandlerErrorOnInvalidCameraId) {
   std::unique_ptr<MockCaptureController> capture_controller =
       std::make_unique<MockCaptureController>();
 
-  EXPECT_CALL(*camera, HasCameraId)
-      .Times(1)
-      .WillOnce([cam = camera.get()](int64_t camera_id) {
-        return cam->camera_id_ == camera_id;
-      });
-
-  EXPECT_CALL(*camera, HasPendingResultByType).Times(0);
   EXPECT_CALL(*camera, AddPendingResult).Times(0);
-  EXPECT_CALL(*camera, GetCaptureController).Times(0);
-  EXPECT_CALL(*capture_controller, StartRecord(_, -1)).Times(0);
+  EXPECT_CALL(*capture_controller, TakePictureBurst).Times(0);
 
   camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
 
   MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
                           std::make_unique<MockBinaryMessenger>().get(),
@@ -694,25 +763,24 @@ TEST(CameraPlugin, StartVideoRecordingHandlerErrorOnInvalidCameraId) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(0);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(missing_camera_id)},
-  };
-
-  plugin.HandleMethodCall(
-      flutter::MethodCall("startVideoRecording",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  for (int64_t photo_count : {0, 31}) {
+    bool result_called = false;
+    plugin.TakePictureBurst(
+        mock_camera_id, photo_count,
+        [&result_called](ErrorOr<EncodableList> reply) {
+          EXPECT_FALSE(result_called);
+          result_called = true;
+          EXPECT_TRUE(reply.has_error());
+          EXPECT_EQ(reply.error().code(), "argument_error");
+        });
+
+    EXPECT_TRUE(result_called);
+  }
 }
 
-TEST(CameraPlugin, StopVideoRecordingHandlerCallsStopRecord) {
+TEST(CameraPlugin, StartVideoRecordingHandlerCallsStartRecordWithPath) {
   int64_t mock_camera_id = 1234;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -726,11 +794,11 @@ TEST(CameraPlugin, StopVideoRecordingHandlerCallsStopRecord) {
       });
 
   EXPECT_CALL(*camera,
-              HasPendingResultByType(Eq(PendingResultType::kStopRecord)))
+              HasPendingResultByType(Eq(PendingResultType::kStartRecord)))
       .Times(1)
       .WillOnce(Return(false));
 
-  EXPECT_CALL(*camera, AddPendingResult(Eq(PendingResultType::kStopRecord), _))
+  EXPECT_CALL(*camera, AddPendingResult(Eq(PendingResultType::kStartRecord), _))
       .Times(1)
       .WillOnce([cam = camera.get()](PendingResultType type,
                                      std::unique_ptr<MethodResult<>> result) {
@@ -745,9 +813,11 @@ TEST(CameraPlugin, StopVideoRecordingHandlerCallsStopRecord) {
         return cam->capture_controller_.get();
       });
 
-  EXPECT_CALL(*capture_controller, StopRecord)
+  EXPECT_CALL(*capture_controller, StartRecord(EndsWith(".mp4"), -1, _))
       .Times(1)
-      .WillOnce([cam = camera.get()]() {
+      .WillOnce([cam = camera.get()](const std::string& file_path,
+                                     int64_t max_video_duration_ms,
+                                     const VideoRecordSettings& settings) {
         assert(cam->pending_result_);
         return cam->pending_result_->Success();
       });
@@ -762,25 +832,22 @@ TEST(CameraPlugin, StopVideoRecordingHandlerCallsStopRecord) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(1);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(mock_camera_id)},
-  };
+  bool result_called = false;
+  plugin.StartVideoRecording(
+      mock_camera_id, nullptr, CreateVideoRecordingSettings(),
+      [&result_called](std::optional<FlutterError> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_FALSE(reply.has_value());
+      });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("stopVideoRecording",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin, StopVideoRecordingHandlerErrorOnInvalidCameraId) {
+TEST(CameraPlugin,
+     StartVideoRecordingHandlerCallsStartRecordWithPathAndCaptureDuration) {
   int64_t mock_camera_id = 1234;
-  int64_t missing_camera_id = 5678;
-
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
+  int64_t mock_video_duration = 100000;
 
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
@@ -788,18 +855,44 @@ TEST(CameraPlugin, StopVideoRecordingHandlerErrorOnInvalidCameraId) {
   std::unique_ptr<MockCaptureController> capture_controller =
       std::make_unique<MockCaptureController>();
 
-  EXPECT_CALL(*camera, HasCameraId)
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
       .Times(1)
       .WillOnce([cam = camera.get()](int64_t camera_id) {
         return cam->camera_id_ == camera_id;
       });
 
-  EXPECT_CALL(*camera, HasPendingResultByType).Times(0);
-  EXPECT_CALL(*camera, AddPendingResult).Times(0);
-  EXPECT_CALL(*camera, GetCaptureController).Times(0);
-  EXPECT_CALL(*capture_controller, StopRecord).Times(0);
+  EXPECT_CALL(*camera,
+              HasPendingResultByType(Eq(PendingResultType::kStartRecord)))
+      .Times(1)
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*camera, AddPendingResult(Eq(PendingResultType::kStartRecord), _))
+      .Times(1)
+      .WillOnce([cam = camera.get()](PendingResultType type,
+                                     std::unique_ptr<MethodResult<>> result) {
+        cam->pending_result_ = std::move(result);
+        return true;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->capture_controller_.get();
+      });
+
+  EXPECT_CALL(*capture_controller,
+              StartRecord(EndsWith(".mp4"), Eq(mock_video_duration), _))
+      .Times(1)
+      .WillOnce([cam = camera.get()](const std::string& file_path,
+                                     int64_t max_video_duration_ms,
+                                     const VideoRecordSettings& settings) {
+        assert(cam->pending_result_);
+        return cam->pending_result_->Success();
+      });
 
   camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
 
   MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
                           std::make_unique<MockBinaryMessenger>().get(),
@@ -808,25 +901,21 @@ TEST(CameraPlugin, StopVideoRecordingHandlerErrorOnInvalidCameraId) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(0);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(missing_camera_id)},
-  };
+  bool result_called = false;
+  plugin.StartVideoRecording(
+      mock_camera_id, &mock_video_duration, CreateVideoRecordingSettings(),
+      [&result_called](std::optional<FlutterError> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_FALSE(reply.has_value());
+      });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("stopVideoRecording",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin, ResumePreviewHandlerCallsResumePreview) {
+TEST(CameraPlugin, StartVideoRecordingHandlerParsesEncoderSettings) {
   int64_t mock_camera_id = 1234;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -840,12 +929,11 @@ TEST(CameraPlugin, ResumePreviewHandlerCallsResumePreview) {
       });
 
   EXPECT_CALL(*camera,
-              HasPendingResultByType(Eq(PendingResultType::kResumePreview)))
+              HasPendingResultByType(Eq(PendingResultType::kStartRecord)))
       .Times(1)
       .WillOnce(Return(false));
 
-  EXPECT_CALL(*camera,
-              AddPendingResult(Eq(PendingResultType::kResumePreview), _))
+  EXPECT_CALL(*camera, AddPendingResult(Eq(PendingResultType::kStartRecord), _))
       .Times(1)
       .WillOnce([cam = camera.get()](PendingResultType type,
                                      std::unique_ptr<MethodResult<>> result) {
@@ -860,9 +948,23 @@ TEST(CameraPlugin, ResumePreviewHandlerCallsResumePreview) {
         return cam->capture_controller_.get();
       });
 
-  EXPECT_CALL(*capture_controller, ResumePreview)
+  EXPECT_CALL(*capture_controller, StartRecord(EndsWith(".mp4"), -1, _))
       .Times(1)
-      .WillOnce([cam = camera.get()]() {
+      .WillOnce([cam = camera.get()](const std::string& file_path,
+                                     int64_t max_video_duration_ms,
+                                     const VideoRecordSettings& settings) {
+        EXPECT_EQ(settings.codec, VideoCodec::kHEVC);
+        EXPECT_TRUE(settings.prefer_hardware_encoder);
+        EXPECT_EQ(settings.bitrate, 4000000u);
+        EXPECT_EQ(settings.rate_control_mode, VideoRateControlMode::kQuality);
+        EXPECT_EQ(settings.quality, 100u);
+        EXPECT_EQ(settings.keyframe_interval, 60u);
+        EXPECT_TRUE(settings.stream_chunks);
+        EXPECT_EQ(settings.audio_sample_rate, 48000u);
+        EXPECT_EQ(settings.audio_channels, 1u);
+        EXPECT_EQ(settings.audio_bitrate, 128000u);
+        EXPECT_EQ(settings.proxy_height, 360u);
+        EXPECT_EQ(settings.proxy_bitrate, 800000u);
         assert(cam->pending_result_);
         return cam->pending_result_->Success();
       });
@@ -877,26 +979,36 @@ TEST(CameraPlugin, ResumePreviewHandlerCallsResumePreview) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(1);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(mock_camera_id)},
-  };
+  PlatformVideoRecordingSettings settings(PlatformVideoCodec::hevc,
+                                  /*prefer_hardware_encoder=*/true,
+                                  /*stream_chunks=*/true);
+  settings.set_bitrate(4000000);
+  settings.set_rate_control_mode(PlatformRateControlMode::quality);
+  // Quality is clamped to the supported range.
+  settings.set_quality(150);
+  settings.set_keyframe_interval(60);
+  settings.set_audio_sample_rate(48000);
+  settings.set_audio_channels(1);
+  settings.set_audio_bitrate(128000);
+  settings.set_proxy_height(360);
+  settings.set_proxy_bitrate(800000);
+
+  bool result_called = false;
+  plugin.StartVideoRecording(
+      mock_camera_id, nullptr, settings,
+      [&result_called](std::optional<FlutterError> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_FALSE(reply.has_value());
+      });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("resumePreview",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin, ResumePreviewHandlerErrorOnInvalidCameraId) {
+TEST(CameraPlugin, StartVideoRecordingHandlerErrorOnInvalidCameraId) {
   int64_t mock_camera_id = 1234;
   int64_t missing_camera_id = 5678;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -912,7 +1024,7 @@ TEST(CameraPlugin, ResumePreviewHandlerErrorOnInvalidCameraId) {
   EXPECT_CALL(*camera, HasPendingResultByType).Times(0);
   EXPECT_CALL(*camera, AddPendingResult).Times(0);
   EXPECT_CALL(*camera, GetCaptureController).Times(0);
-  EXPECT_CALL(*capture_controller, ResumePreview).Times(0);
+  EXPECT_CALL(*capture_controller, StartRecord(_, -1, _)).Times(0);
 
   camera->camera_id_ = mock_camera_id;
 
@@ -923,25 +1035,21 @@ TEST(CameraPlugin, ResumePreviewHandlerErrorOnInvalidCameraId) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(0);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(missing_camera_id)},
-  };
+  bool result_called = false;
+  plugin.StartVideoRecording(
+      missing_camera_id, nullptr, CreateVideoRecordingSettings(),
+      [&result_called](std::optional<FlutterError> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_TRUE(reply.has_value());
+      });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("resumePreview",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin, PausePreviewHandlerCallsPausePreview) {
+TEST(CameraPlugin, StopVideoRecordingHandlerCallsStopRecord) {
   int64_t mock_camera_id = 1234;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -955,12 +1063,11 @@ TEST(CameraPlugin, PausePreviewHandlerCallsPausePreview) {
       });
 
   EXPECT_CALL(*camera,
-              HasPendingResultByType(Eq(PendingResultType::kPausePreview)))
+              HasPendingResultByType(Eq(PendingResultType::kStopRecord)))
       .Times(1)
       .WillOnce(Return(false));
 
-  EXPECT_CALL(*camera,
-              AddPendingResult(Eq(PendingResultType::kPausePreview), _))
+  EXPECT_CALL(*camera, AddPendingResult(Eq(PendingResultType::kStopRecord), _))
       .Times(1)
       .WillOnce([cam = camera.get()](PendingResultType type,
                                      std::unique_ptr<MethodResult<>> result) {
@@ -975,11 +1082,12 @@ TEST(CameraPlugin, PausePreviewHandlerCallsPausePreview) {
         return cam->capture_controller_.get();
       });
 
-  EXPECT_CALL(*capture_controller, PausePreview)
+  EXPECT_CALL(*capture_controller, StopRecord)
       .Times(1)
       .WillOnce([cam = camera.get()]() {
         assert(cam->pending_result_);
-        return cam->pending_result_->Success();
+        return cam->pending_result_->Success(
+            EncodableValue(std::string("video.mp4")));
       });
 
   camera->camera_id_ = mock_camera_id;
@@ -992,26 +1100,22 @@ TEST(CameraPlugin, PausePreviewHandlerCallsPausePreview) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(0);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(1);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(mock_camera_id)},
-  };
+  bool result_called = false;
+  plugin.StopVideoRecording(mock_camera_id,
+                            [&result_called](ErrorOr<std::string> reply) {
+                              EXPECT_FALSE(result_called);
+                              result_called = true;
+                              EXPECT_FALSE(reply.has_error());
+                              EXPECT_EQ(reply.value(), "video.mp4");
+                            });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("pausePreview",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-TEST(CameraPlugin, PausePreviewHandlerErrorOnInvalidCameraId) {
+TEST(CameraPlugin, StopVideoRecordingHandlerErrorOnInvalidCameraId) {
   int64_t mock_camera_id = 1234;
   int64_t missing_camera_id = 5678;
 
-  std::unique_ptr<MockMethodResult> initialize_result =
-      std::make_unique<MockMethodResult>();
-
   std::unique_ptr<MockCamera> camera =
       std::make_unique<MockCamera>(MOCK_DEVICE_ID);
 
@@ -1027,7 +1131,7 @@ TEST(CameraPlugin, PausePreviewHandlerErrorOnInvalidCameraId) {
   EXPECT_CALL(*camera, HasPendingResultByType).Times(0);
   EXPECT_CALL(*camera, AddPendingResult).Times(0);
   EXPECT_CALL(*camera, GetCaptureController).Times(0);
-  EXPECT_CALL(*capture_controller, PausePreview).Times(0);
+  EXPECT_CALL(*capture_controller, StopRecord).Times(0);
 
   camera->camera_id_ = mock_camera_id;
 
@@ -1038,18 +1142,1267 @@ TEST(CameraPlugin, PausePreviewHandlerErrorOnInvalidCameraId) {
   // Add mocked camera to plugins camera list.
   plugin.AddCamera(std::move(camera));
 
-  EXPECT_CALL(*initialize_result, ErrorInternal).Times(1);
-  EXPECT_CALL(*initialize_result, SuccessInternal).Times(0);
-
-  EncodableMap args = {
-      {EncodableValue("cameraId"), EncodableValue(missing_camera_id)},
-  };
+  bool result_called = false;
+  plugin.StopVideoRecording(missing_camera_id,
+                            [&result_called](ErrorOr<std::string> reply) {
+                              EXPECT_FALSE(result_called);
+                              result_called = true;
+                              EXPECT_TRUE(reply.has_error());
+                            });
 
-  plugin.HandleMethodCall(
-      flutter::MethodCall("pausePreview",
-                          std::make_unique<EncodableValue>(EncodableMap(args))),
-      std::move(initialize_result));
+  EXPECT_TRUE(result_called);
 }
 
-}  // namespace test
-}  // namespace camera_windows
+TEST(CameraPlugin, ResumePreviewHandlerCallsResumePreview) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera,
+              HasPendingResultByType(Eq(PendingResultType::kResumePreview)))
+      .Times(1)
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*camera,
+              AddPendingResult(Eq(PendingResultType::kResumePreview), _))
+      .Times(1)
+      .WillOnce([cam = camera.get()](PendingResultType type,
+                                     std::unique_ptr<MethodResult<>> result) {
+        cam->pending_result_ = std::move(result);
+        return true;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->capture_controller_.get();
+      });
+
+  EXPECT_CALL(*capture_controller, ResumePreview)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->pending_result_->Success();
+      });
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  bool result_called = false;
+  plugin.ResumePreview(mock_camera_id,
+                       [&result_called](std::optional<FlutterError> reply) {
+                         EXPECT_FALSE(result_called);
+                         result_called = true;
+                         EXPECT_FALSE(reply.has_value());
+                       });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, ResumePreviewHandlerErrorOnInvalidCameraId) {
+  int64_t mock_camera_id = 1234;
+  int64_t missing_camera_id = 5678;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId)
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, HasPendingResultByType).Times(0);
+  EXPECT_CALL(*camera, AddPendingResult).Times(0);
+  EXPECT_CALL(*camera, GetCaptureController).Times(0);
+  EXPECT_CALL(*capture_controller, ResumePreview).Times(0);
+
+  camera->camera_id_ = mock_camera_id;
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  bool result_called = false;
+  plugin.ResumePreview(missing_camera_id,
+                       [&result_called](std::optional<FlutterError> reply) {
+                         EXPECT_FALSE(result_called);
+                         result_called = true;
+                         EXPECT_TRUE(reply.has_value());
+                       });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, PauseVideoRecordingHandlerCallsPauseRecord) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera,
+              HasPendingResultByType(Eq(PendingResultType::kPauseRecord)))
+      .Times(1)
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*camera,
+              AddPendingResult(Eq(PendingResultType::kPauseRecord), _))
+      .Times(1)
+      .WillOnce([cam = camera.get()](PendingResultType type,
+                                     std::unique_ptr<MethodResult<>> result) {
+        cam->pending_result_ = std::move(result);
+        return true;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->capture_controller_.get();
+      });
+
+  EXPECT_CALL(*capture_controller, PauseRecord)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->pending_result_->Success();
+      });
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  bool result_called = false;
+  plugin.PauseVideoRecording(
+      mock_camera_id,
+      [&result_called](std::optional<FlutterError> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_FALSE(reply.has_value());
+      });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, ResumeVideoRecordingHandlerCallsResumeRecord) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera,
+              HasPendingResultByType(Eq(PendingResultType::kResumeRecord)))
+      .Times(1)
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*camera,
+              AddPendingResult(Eq(PendingResultType::kResumeRecord), _))
+      .Times(1)
+      .WillOnce([cam = camera.get()](PendingResultType type,
+                                     std::unique_ptr<MethodResult<>> result) {
+        cam->pending_result_ = std::move(result);
+        return true;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->capture_controller_.get();
+      });
+
+  EXPECT_CALL(*capture_controller, ResumeRecord)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->pending_result_->Success();
+      });
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  bool result_called = false;
+  plugin.ResumeVideoRecording(
+      mock_camera_id,
+      [&result_called](std::optional<FlutterError> reply) {
+        EXPECT_FALSE(result_called);
+        result_called = true;
+        EXPECT_FALSE(reply.has_value());
+      });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, PausePreviewHandlerCallsPausePreview) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera,
+              HasPendingResultByType(Eq(PendingResultType::kPausePreview)))
+      .Times(1)
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*camera,
+              AddPendingResult(Eq(PendingResultType::kPausePreview), _))
+      .Times(1)
+      .WillOnce([cam = camera.get()](PendingResultType type,
+                                     std::unique_ptr<MethodResult<>> result) {
+        cam->pending_result_ = std::move(result);
+        return true;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->capture_controller_.get();
+      });
+
+  EXPECT_CALL(*capture_controller, PausePreview)
+      .Times(1)
+      .WillOnce([cam = camera.get()]() {
+        assert(cam->pending_result_);
+        return cam->pending_result_->Success();
+      });
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  bool result_called = false;
+  plugin.PausePreview(mock_camera_id,
+                      [&result_called](std::optional<FlutterError> reply) {
+                        EXPECT_FALSE(result_called);
+                        result_called = true;
+                        EXPECT_FALSE(reply.has_value());
+                      });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, PausePreviewHandlerErrorOnInvalidCameraId) {
+  int64_t mock_camera_id = 1234;
+  int64_t missing_camera_id = 5678;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId)
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, HasPendingResultByType).Times(0);
+  EXPECT_CALL(*camera, AddPendingResult).Times(0);
+  EXPECT_CALL(*camera, GetCaptureController).Times(0);
+  EXPECT_CALL(*capture_controller, PausePreview).Times(0);
+
+  camera->camera_id_ = mock_camera_id;
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  bool result_called = false;
+  plugin.PausePreview(missing_camera_id,
+                      [&result_called](std::optional<FlutterError> reply) {
+                        EXPECT_FALSE(result_called);
+                        result_called = true;
+                        EXPECT_TRUE(reply.has_value());
+                      });
+
+  EXPECT_TRUE(result_called);
+}
+
+TEST(CameraPlugin, StartImageStreamHandlerCallsStartImageStream) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller,
+              StartImageStream(Eq(ImageStreamFormat::kNV12)))
+      .Times(1)
+      .WillOnce(Return(true));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.StartImageStream(mock_camera_id, PlatformImageFormatGroup::yuv420);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, StartImageStreamHandlerErrorOnInvalidCameraId) {
+  int64_t mock_camera_id = 1234;
+  int64_t missing_camera_id = 5678;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  EXPECT_CALL(*camera, HasCameraId)
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController).Times(0);
+
+  camera->camera_id_ = mock_camera_id;
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error = plugin.StartImageStream(
+      missing_camera_id, PlatformImageFormatGroup::bgra8888);
+
+  EXPECT_TRUE(error.has_value());
+}
+
+TEST(CameraPlugin, GetCaptureFormatsHandlerReturnsFormats) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetCaptureFormats)
+      .Times(1)
+      .WillOnce(Return(std::vector<CaptureFormat>({{1280, 720, 30.f}})));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  ErrorOr<EncodableList> reply = plugin.GetCaptureFormats(mock_camera_id);
+
+  EXPECT_FALSE(reply.has_error());
+  ASSERT_EQ(reply.value().size(), 1u);
+  auto format = std::any_cast<PlatformCaptureFormat>(
+      std::get<flutter::CustomEncodableValue>(reply.value()[0]));
+  EXPECT_EQ(format.width(), 1280);
+  EXPECT_EQ(format.height(), 720);
+  EXPECT_EQ(format.frame_rate(), 30.0);
+}
+
+TEST(CameraPlugin, GetPreviewStatsHandlerReturnsStats) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  PreviewStatsSnapshot stats;
+  stats.received_frame_count = 30;
+  stats.rendered_frame_count = 28;
+  stats.dropped_frame_count = 2;
+  stats.capture_frame_rate = 30.0;
+  stats.render_frame_rate = 29.0;
+  stats.latency_p50_us = 4000;
+  stats.latency_p95_us = 9000;
+  stats.latency_p99_us = 12000;
+  stats.conversion_p50_us = 1500;
+  stats.conversion_p95_us = 2500;
+  stats.conversion_p99_us = 3000;
+  EXPECT_CALL(*capture_controller, GetPreviewStats)
+      .Times(1)
+      .WillOnce(Return(std::optional<PreviewStatsSnapshot>(stats)));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  ErrorOr<PlatformPreviewStats> reply = plugin.GetPreviewStats(mock_camera_id);
+
+  ASSERT_FALSE(reply.has_error());
+  const PlatformPreviewStats& stats = reply.value();
+  EXPECT_EQ(stats.received_frames(), 30);
+  EXPECT_EQ(stats.rendered_frames(), 28);
+  EXPECT_EQ(stats.dropped_frames(), 2);
+  EXPECT_EQ(stats.capture_frame_rate(), 30.0);
+  EXPECT_EQ(stats.render_frame_rate(), 29.0);
+  EXPECT_EQ(stats.latency_p50(), 4000);
+  EXPECT_EQ(stats.latency_p95(), 9000);
+  EXPECT_EQ(stats.latency_p99(), 12000);
+  EXPECT_EQ(stats.conversion_time_p50(), 1500);
+  EXPECT_EQ(stats.conversion_time_p95(), 2500);
+  EXPECT_EQ(stats.conversion_time_p99(), 3000);
+}
+
+TEST(CameraPlugin, GetPreviewStatsHandlerErrorIfNotEnabled) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetPreviewStats)
+      .Times(1)
+      .WillOnce(Return(std::nullopt));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  ErrorOr<PlatformPreviewStats> reply = plugin.GetPreviewStats(mock_camera_id);
+
+  EXPECT_TRUE(reply.has_error());
+  EXPECT_EQ(reply.error().code(), "camera_error");
+}
+
+TEST(CameraPlugin, GetRecordingStatsHandlerReturnsStats) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  RecordSampleStats stats;
+  stats.video_frame_count = 300;
+  stats.dropped_video_frame_count = 3;
+  stats.audio_sample_count = 470;
+  stats.video_end_time = 100000000;
+  stats.audio_end_time = 100200000;
+  EXPECT_CALL(*capture_controller, GetRecordingStats)
+      .Times(1)
+      .WillOnce(Return(std::optional<RecordSampleStats>(stats)));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  ErrorOr<PlatformRecordingStats> reply =
+      plugin.GetRecordingStats(mock_camera_id);
+
+  ASSERT_FALSE(reply.has_error());
+  const PlatformRecordingStats& stats = reply.value();
+  EXPECT_EQ(stats.encoded_frames(), 300);
+  EXPECT_EQ(stats.dropped_frames(), 3);
+  EXPECT_EQ(stats.duration(), 10000000);
+  EXPECT_EQ(stats.av_drift(), 20000);
+}
+
+TEST(CameraPlugin, GetRecordingStatsHandlerErrorIfNotRecorded) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetRecordingStats)
+      .Times(1)
+      .WillOnce(Return(std::nullopt));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  ErrorOr<PlatformRecordingStats> reply =
+      plugin.GetRecordingStats(mock_camera_id);
+
+  EXPECT_TRUE(reply.has_error());
+  EXPECT_EQ(reply.error().code(), "camera_error");
+}
+
+TEST(CameraPlugin, SetZoomLevelHandlerCallsSetZoomLevel) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, SetZoomLevel(Eq(2.0)))
+      .Times(1)
+      .WillOnce(Return(true));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error = plugin.SetZoomLevel(mock_camera_id, 2.0);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetCropRectHandlerPassesCropRect) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  PreviewCropRect expected_rect;
+  expected_rect.left = 0.25;
+  expected_rect.top = 0.125;
+  expected_rect.width = 0.5;
+  expected_rect.height = 0.75;
+  EXPECT_CALL(*capture_controller, SetPreviewCropRect(Eq(expected_rect)))
+      .Times(1)
+      .WillOnce(Return(true));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetCropRect(mock_camera_id, 0.25, 0.125, 0.5, 0.75);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetCropRectHandlerErrorIfRectIsInvalid) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, SetPreviewCropRect)
+      .Times(1)
+      .WillOnce(Return(false));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetCropRect(mock_camera_id, 0.75, 0.0, 0.5, 1.0);
+
+  EXPECT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), "argument_error");
+}
+
+TEST(CameraPlugin, SetPreviewRotationHandlerPassesRotation) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller,
+              SetPreviewRotation(Eq(PreviewRotation::kRotate270)))
+      .Times(1)
+      .WillOnce(Return(true));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetPreviewRotation(mock_camera_id, 270);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetPreviewRotationHandlerErrorIfNotSupported) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, SetPreviewRotation)
+      .Times(1)
+      .WillOnce(Return(false));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetPreviewRotation(mock_camera_id, 90);
+
+  EXPECT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), "camera_error");
+}
+
+TEST(CameraPlugin, SetPreviewRotationHandlerErrorIfRotationIsInvalid) {
+  int64_t mock_camera_id = 1234;
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  std::optional<FlutterError> error =
+      plugin.SetPreviewRotation(mock_camera_id, 45);
+
+  EXPECT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), "argument_error");
+}
+
+TEST(CameraPlugin, SetPreviewFrameRateHandlerPassesFrameRate) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller,
+              SetPreviewTargetFrameRate(Eq(std::optional<double>(5.0))))
+      .Times(1);
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  double frames_per_second = 5.0;
+  std::optional<FlutterError> error =
+      plugin.SetPreviewFrameRate(mock_camera_id, &frames_per_second);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetPreviewFrameRateHandlerRemovesLimitWithoutFrameRate) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller,
+              SetPreviewTargetFrameRate(Eq(std::optional<double>())))
+      .Times(1);
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetPreviewFrameRate(mock_camera_id, nullptr);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetExposureModeHandlerLocksExposure) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  MockCameraControls camera_controls;
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetCameraControls)
+      .Times(1)
+      .WillOnce(Return(&camera_controls));
+
+  EXPECT_CALL(camera_controls, SetExposureMode(Eq(CameraControlMode::kLocked)))
+      .Times(1)
+      .WillOnce(Return(S_OK));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetExposureMode(mock_camera_id, /*locked=*/true);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetExposureOffsetHandlerReturnsAppliedOffset) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  MockCameraControls camera_controls;
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetCameraControls)
+      .Times(1)
+      .WillOnce(Return(&camera_controls));
+
+  EXPECT_CALL(camera_controls, SetExposureOffset(Eq(0.6), _))
+      .Times(1)
+      .WillOnce(DoAll(SetArgPointee<1>(0.5), Return(S_OK)));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  ErrorOr<double> reply = plugin.SetExposureOffset(mock_camera_id, 0.6);
+
+  EXPECT_FALSE(reply.has_error());
+  EXPECT_EQ(reply.value(), 0.5);
+}
+
+TEST(CameraPlugin, SetFrameRateLockHandlerErrorIfNotSupported) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  MockCameraControls camera_controls;
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetCameraControls)
+      .Times(1)
+      .WillOnce(Return(&camera_controls));
+
+  EXPECT_CALL(camera_controls, SetFrameRateLock(Eq(true)))
+      .Times(1)
+      .WillOnce(Return(E_NOTIMPL));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetFrameRateLock(mock_camera_id, /*locked=*/true);
+
+  EXPECT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), "camera_error");
+}
+
+TEST(CameraPlugin, SetFlashModeHandlerSetsTorch) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  MockCameraControls camera_controls;
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetCameraControls)
+      .Times(1)
+      .WillOnce(Return(&camera_controls));
+
+  EXPECT_CALL(camera_controls, SetFlashMode(Eq(CameraFlashMode::kTorch)))
+      .Times(1)
+      .WillOnce(Return(S_OK));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetFlashMode(mock_camera_id, PlatformFlashMode::torch);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetFlashModeHandlerErrorIfCameraIsNotCreated) {
+  int64_t mock_camera_id = 1234;
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  std::optional<FlutterError> error =
+      plugin.SetFlashMode(mock_camera_id, PlatformFlashMode::torch);
+
+  EXPECT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), "camera_error");
+}
+
+TEST(CameraPlugin, SetPhotoCapturePriorityHandlerErrorIfNotSupported) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  MockCameraControls camera_controls;
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller, GetCameraControls)
+      .Times(1)
+      .WillOnce(Return(&camera_controls));
+
+  EXPECT_CALL(camera_controls,
+              SetPhotoCapturePriority(Eq(PhotoCapturePriority::kSpeed)))
+      .Times(1)
+      .WillOnce(Return(E_NOTIMPL));
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error = plugin.SetPhotoCapturePriority(
+      mock_camera_id, PlatformPhotoCapturePriority::speed);
+
+  EXPECT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), "camera_error");
+}
+
+TEST(CameraPlugin, SetPictureRotationHandlerSetsRotation) {
+  int64_t mock_camera_id = 1234;
+
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<MockCaptureController> capture_controller =
+      std::make_unique<MockCaptureController>();
+
+  EXPECT_CALL(*camera, HasCameraId(Eq(mock_camera_id)))
+      .Times(1)
+      .WillOnce([cam = camera.get()](int64_t camera_id) {
+        return cam->camera_id_ == camera_id;
+      });
+
+  EXPECT_CALL(*camera, GetCaptureController)
+      .Times(1)
+      .WillOnce(
+          [cam = camera.get()]() { return cam->capture_controller_.get(); });
+
+  EXPECT_CALL(*capture_controller,
+              SetPictureRotation(Eq(PhotoRotation::kRotate90)))
+      .Times(1);
+
+  camera->camera_id_ = mock_camera_id;
+  camera->capture_controller_ = std::move(capture_controller);
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  // Add mocked camera to plugins camera list.
+  plugin.AddCamera(std::move(camera));
+
+  std::optional<FlutterError> error =
+      plugin.SetPictureRotation(mock_camera_id, 90);
+
+  EXPECT_FALSE(error.has_value());
+}
+
+TEST(CameraPlugin, SetPictureRotationHandlerErrorIfRotationIsInvalid) {
+  int64_t mock_camera_id = 1234;
+
+  MockCameraPlugin plugin(std::make_unique<MockTextureRegistrar>().get(),
+                          std::make_unique<MockBinaryMessenger>().get(),
+                          std::make_unique<MockCameraFactory>());
+
+  std::optional<FlutterError> error =
+      plugin.SetPictureRotation(mock_camera_id, 45);
+
+  EXPECT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), "argument_error");
+}
@@ -12,13 +12,16 @@
 #include <gtest/gtest.h>
 #include <windows.h>
 
+#include <any>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "mocks.h"
 
 namespace camera_windows {
+using flutter::EncodableList;
 using ::testing::_;
 using ::testing::Eq;
 using ::testing::NiceMock;
@@ -52,8 +55,8 @@ TEST(Camera, InitCameraCreatesCaptureController) {
   bool result =
       camera->InitCamera(std::move(capture_controller_factory),
                          std::make_unique<MockTextureRegistrar>().get(),
-                         std::make_unique<MockBinaryMessenger>().get(), false,
-                         ResolutionPreset::kAuto);
+                         std::make_unique<MockBinaryMessenger>().get(),
+                         CaptureSettings(), nullptr);
   EXPECT_TRUE(result);
   EXPECT_TRUE(camera->GetCaptureController() != nullptr);
 }
@@ -83,8 +86,8 @@ TEST(Camera, InitCameraReportsFailure) {
   bool result =
       camera->InitCamera(std::move(capture_controller_factory),
                          std::make_unique<MockTextureRegistrar>().get(),
-                         std::make_unique<MockBinaryMessenger>().get(), false,
-                         ResolutionPreset::kAuto);
+                         std::make_unique<MockBinaryMessenger>().get(),
+                         CaptureSettings(), nullptr);
   EXPECT_FALSE(result);
   EXPECT_TRUE(camera->GetCaptureController() != nullptr);
 }
@@ -121,10 +124,7 @@ TEST(Camera, OnCreateCaptureEngineSucceededReturnsCameraId) {
   const int64_t texture_id = 12345;
 
   EXPECT_CALL(*result, ErrorInternal).Times(0);
-  EXPECT_CALL(
-      *result,
-      SuccessInternal(Pointee(EncodableValue(EncodableMap(
-          {{EncodableValue("cameraId"), EncodableValue(texture_id)}})))));
+  EXPECT_CALL(*result, SuccessInternal(Pointee(EncodableValue(texture_id))));
 
   camera->AddPendingResult(PendingResultType::kCreateCamera, std::move(result));
 
@@ -174,12 +174,14 @@ TEST(Camera, OnStartPreviewSucceededReturnsFrameSize) {
   const int32_t height = 456;
 
   EXPECT_CALL(*result, ErrorInternal).Times(0);
-  EXPECT_CALL(
-      *result,
-      SuccessInternal(Pointee(EncodableValue(EncodableMap({
-          {EncodableValue("previewWidth"), EncodableValue((float)width)},
-          {EncodableValue("previewHeight"), EncodableValue((float)height)},
-      })))));
+  EXPECT_CALL(*result, SuccessInternal)
+      .Times(1)
+      .WillOnce([width, height](const EncodableValue* value) {
+        const auto& size = std::any_cast<PlatformSize>(
+            std::get<flutter::CustomEncodableValue>(*value));
+        EXPECT_EQ(size.width(), width);
+        EXPECT_EQ(size.height(), height);
+      });
 
   camera->AddPendingResult(PendingResultType::kInitialize, std::move(result));
 
@@ -266,6 +268,66 @@ TEST(Camera, PausePreviewReportsAccessDenied) {
   camera->OnPausePreviewFailed(CameraResult::kAccessDenied, error_text);
 }
 
+TEST(Camera, OnPauseRecordSucceededReturnsSuccess) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  EXPECT_CALL(*result, ErrorInternal).Times(0);
+  EXPECT_CALL(*result, SuccessInternal(nullptr));
+
+  camera->AddPendingResult(PendingResultType::kPauseRecord, std::move(result));
+
+  camera->OnPauseRecordSucceeded();
+}
+
+TEST(Camera, PauseRecordReportsError) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  const std::string error_text = "error_text";
+
+  EXPECT_CALL(*result, SuccessInternal).Times(0);
+  EXPECT_CALL(*result, ErrorInternal(Eq("camera_error"), Eq(error_text), _));
+
+  camera->AddPendingResult(PendingResultType::kPauseRecord, std::move(result));
+
+  camera->OnPauseRecordFailed(CameraResult::kError, error_text);
+}
+
+TEST(Camera, OnResumeRecordSucceededReturnsSuccess) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  EXPECT_CALL(*result, ErrorInternal).Times(0);
+  EXPECT_CALL(*result, SuccessInternal(nullptr));
+
+  camera->AddPendingResult(PendingResultType::kResumeRecord, std::move(result));
+
+  camera->OnResumeRecordSucceeded();
+}
+
+TEST(Camera, ResumeRecordReportsError) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  const std::string error_text = "error_text";
+
+  EXPECT_CALL(*result, SuccessInternal).Times(0);
+  EXPECT_CALL(*result, ErrorInternal(Eq("camera_error"), Eq(error_text), _));
+
+  camera->AddPendingResult(PendingResultType::kResumeRecord, std::move(result));
+
+  camera->OnResumeRecordFailed(CameraResult::kError, error_text);
+}
+
 TEST(Camera, OnResumePreviewSucceededReturnsSuccess) {
   std::unique_ptr<CameraImpl> camera =
       std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
@@ -461,7 +523,79 @@ TEST(Camera, TakePictureReportsAccessDenied) {
   camera->OnTakePictureFailed(CameraResult::kAccessDenied, error_text);
 }
 
-TEST(Camera, OnVideoRecordSucceededInvokesCameraChannelEvent) {
+TEST(Camera, OnTakePictureBurstSucceededReturnsPaths) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  const std::vector<std::string> file_paths = {"C:\\temp\\filename_1.jpeg",
+                                               "C:\\temp\\filename_2.jpeg"};
+
+  EXPECT_CALL(*result, ErrorInternal).Times(0);
+  EXPECT_CALL(*result, SuccessInternal(Pointee(EncodableValue(EncodableList(
+                           {EncodableValue(file_paths[0]),
+                            EncodableValue(file_paths[1])})))));
+
+  camera->AddPendingResult(PendingResultType::kTakePictureBurst,
+                           std::move(result));
+
+  camera->OnTakePictureBurstSucceeded(file_paths);
+}
+
+TEST(Camera, TakePictureBurstReportsError) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  const std::string error_text = "error_text";
+
+  EXPECT_CALL(*result, SuccessInternal).Times(0);
+  EXPECT_CALL(*result, ErrorInternal(Eq("camera_error"), Eq(error_text), _));
+
+  camera->AddPendingResult(PendingResultType::kTakePictureBurst,
+                           std::move(result));
+
+  camera->OnTakePictureBurstFailed(CameraResult::kError, error_text);
+}
+
+TEST(Camera, OnTakePictureDataSucceededReturnsBytes) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  std::vector<uint8_t> data = {0xFF, 0xD8, 0xFF, 0xD9};
+
+  EXPECT_CALL(*result, ErrorInternal).Times(0);
+  EXPECT_CALL(*result, SuccessInternal(Pointee(EncodableValue(
+                           std::vector<uint8_t>({0xFF, 0xD8, 0xFF, 0xD9})))));
+
+  camera->AddPendingResult(PendingResultType::kTakePictureData,
+                           std::move(result));
+
+  camera->OnTakePictureDataSucceeded(data);
+}
+
+TEST(Camera, TakePictureDataReportsError) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockMethodResult> result =
+      std::make_unique<MockMethodResult>();
+
+  const std::string error_text = "error_text";
+
+  EXPECT_CALL(*result, SuccessInternal).Times(0);
+  EXPECT_CALL(*result, ErrorInternal(Eq("camera_error"), Eq(error_text), _));
+
+  camera->AddPendingResult(PendingResultType::kTakePictureData,
+                           std::move(result));
+
+  camera->OnTakePictureDataFailed(CameraResult::kError, error_text);
+}
+
+TEST(Camera, OnVideoRecordSucceededSendsVideoRecordedEvent) {
   std::unique_ptr<CameraImpl> camera =
       std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
   std::unique_ptr<MockCaptureControllerFactory> capture_controller_factory =
@@ -472,9 +606,6 @@ TEST(Camera, OnVideoRecordSucceededInvokesCameraChannelEvent) {
 
   const std::string file_path = "C:\\temp\\filename.mp4";
   const int64_t camera_id = 12345;
-  std::string camera_channel =
-      std::string("plugins.flutter.io/camera_windows/camera") +
-      std::to_string(camera_id);
   const int64_t video_duration = 1000000;
 
   EXPECT_CALL(*capture_controller_factory, CreateCaptureController)
@@ -482,22 +613,82 @@ TEST(Camera, OnVideoRecordSucceededInvokesCameraChannelEvent) {
       .WillOnce(
           []() { return std::make_unique<NiceMock<MockCaptureController>>(); });
 
-  // TODO: test binary content.
-  // First time is video record success message,
-  // and second is camera closing message.
-  EXPECT_CALL(*binary_messenger, Send(Eq(camera_channel), _, _, _)).Times(2);
+  std::unique_ptr<EncodableValue> message;
+  EXPECT_CALL(*binary_messenger,
+              Send(Eq("dev.flutter.pigeon.CameraEventApi.videoRecorded"), _,
+                   _, _))
+      .Times(1)
+      .WillOnce([&message](const std::string&, const uint8_t* data,
+                           size_t size, flutter::BinaryReply) {
+        message = CameraEventApi::GetCodec().DecodeMessage(data, size);
+      });
+  // Sent when the camera is disposed.
+  EXPECT_CALL(*binary_messenger,
+              Send(Eq("dev.flutter.pigeon.CameraEventApi.cameraClosing"), _,
+                   _, _))
+      .Times(1);
 
   // Init camera with mock capture controller factory
   camera->InitCamera(std::move(capture_controller_factory),
                      std::make_unique<MockTextureRegistrar>().get(),
-                     binary_messenger.get(), false, ResolutionPreset::kAuto);
+                     binary_messenger.get(), CaptureSettings(), nullptr);
 
   // Pass camera id for camera
   camera->OnCreateCaptureEngineSucceeded(camera_id);
 
   camera->OnVideoRecordSucceeded(file_path, video_duration);
 
-  // Dispose camera before message channel.
+  ASSERT_TRUE(message);
+  EXPECT_EQ(*message, EncodableValue(EncodableList{
+                          EncodableValue(camera_id), EncodableValue(file_path),
+                          EncodableValue(video_duration)}));
+
+  // Dispose camera before the binary messenger.
+  camera = nullptr;
+}
+
+TEST(Camera, OnCaptureErrorSendsErrorEvent) {
+  std::unique_ptr<CameraImpl> camera =
+      std::make_unique<CameraImpl>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockCaptureControllerFactory> capture_controller_factory =
+      std::make_unique<MockCaptureControllerFactory>();
+
+  std::unique_ptr<MockBinaryMessenger> binary_messenger =
+      std::make_unique<MockBinaryMessenger>();
+
+  const std::string error_text = "Test error text";
+  const int64_t camera_id = 12345;
+
+  EXPECT_CALL(*capture_controller_factory, CreateCaptureController)
+      .Times(1)
+      .WillOnce(
+          []() { return std::make_unique<NiceMock<MockCaptureController>>(); });
+
+  std::unique_ptr<EncodableValue> message;
+  EXPECT_CALL(*binary_messenger,
+              Send(Eq("dev.flutter.pigeon.CameraEventApi.error"), _, _, _))
+      .Times(1)
+      .WillOnce([&message](const std::string&, const uint8_t* data,
+                           size_t size, flutter::BinaryReply) {
+        message = CameraEventApi::GetCodec().DecodeMessage(data, size);
+      });
+  EXPECT_CALL(*binary_messenger,
+              Send(Eq("dev.flutter.pigeon.CameraEventApi.cameraClosing"), _,
+                   _, _))
+      .Times(1);
+
+  camera->InitCamera(std::move(capture_controller_factory),
+                     std::make_unique<MockTextureRegistrar>().get(),
+                     binary_messenger.get(), CaptureSettings(), nullptr);
+  camera->OnCreateCaptureEngineSucceeded(camera_id);
+
+  camera->OnCaptureError(CameraResult::kError, error_text);
+
+  ASSERT_TRUE(message);
+  EXPECT_EQ(*message,
+            EncodableValue(EncodableList{EncodableValue(camera_id),
+                                         EncodableValue(error_text)}));
+
   camera = nullptr;
 }
 
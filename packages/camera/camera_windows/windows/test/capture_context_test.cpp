@@ -0,0 +1,52 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "capture_context.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "mocks.h"
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(CaptureContext, InitializeCreatesSharedDevice) {
+  auto capture_context = std::make_unique<CaptureContext>();
+
+  ASSERT_TRUE(SUCCEEDED(capture_context->Initialize()));
+  EXPECT_TRUE(capture_context->GetD3DDevice());
+  EXPECT_TRUE(capture_context->GetDXGIDeviceManager());
+}
+
+TEST(CaptureContext, TakePrewarmedDeviceFailsForUnknownDevice) {
+  auto capture_context = std::make_unique<CaptureContext>();
+  ASSERT_TRUE(SUCCEEDED(capture_context->Initialize()));
+
+  ComPtr<IMFCaptureEngine> capture_engine;
+  ComPtr<IMFMediaSource> video_source;
+  EXPECT_FALSE(capture_context->TakePrewarmedDevice(
+      MOCK_DEVICE_ID, &capture_engine, &video_source));
+  EXPECT_FALSE(capture_engine);
+  EXPECT_FALSE(video_source);
+}
+
+TEST(CaptureContext, TakePrewarmedDeviceWaitsForFailedPrewarm) {
+  auto capture_context = std::make_unique<CaptureContext>();
+  ASSERT_TRUE(SUCCEEDED(capture_context->Initialize()));
+
+  // The mock device does not exist, so creating its video source fails.
+  capture_context->PrewarmDevice(MOCK_DEVICE_ID);
+
+  ComPtr<IMFCaptureEngine> capture_engine;
+  ComPtr<IMFMediaSource> video_source;
+  EXPECT_FALSE(capture_context->TakePrewarmedDevice(
+      MOCK_DEVICE_ID, &capture_engine, &video_source));
+  EXPECT_FALSE(video_source);
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -13,14 +13,19 @@
 #include <windows.h>
 #include <wrl/client.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "media_type_cache.h"
 #include "mocks.h"
 #include "string_utils.h"
 
 namespace camera_windows {
+using windows_plugin_utils::Utf16FromUtf8;
+using windows_plugin_utils::Utf8FromUtf16;
 
 namespace test {
 
@@ -29,6 +34,12 @@ using ::testing::_;
 using ::testing::Eq;
 using ::testing::Return;
 
+std::shared_ptr<CaptureContext> CreateCaptureContext() {
+  auto capture_context = std::make_shared<CaptureContext>();
+  EXPECT_TRUE(SUCCEEDED(capture_context->Initialize()));
+  return capture_context;
+}
+
 void MockInitCaptureController(CaptureControllerImpl* capture_controller,
                                MockTextureRegistrar* texture_registrar,
                                MockCaptureEngine* engine, MockCamera* camera,
@@ -60,7 +71,8 @@ void MockInitCaptureController(CaptureControllerImpl* capture_controller,
   EXPECT_CALL(*engine, Initialize).Times(1);
 
   bool result = capture_controller->InitCaptureDevice(
-      texture_registrar, MOCK_DEVICE_ID, true, ResolutionPreset::kAuto);
+      texture_registrar, MOCK_DEVICE_ID, {true, ResolutionPreset::kAuto},
+      CreateCaptureContext());
 
   EXPECT_TRUE(result);
 
@@ -74,6 +86,9 @@ void MockAvailableMediaTypes(MockCaptureEngine* engine,
                              MockCaptureSource* capture_source,
                              uint32_t mock_preview_width,
                              uint32_t mock_preview_height) {
+  // Media types of the mock device differ between tests.
+  MediaTypeCache::GetInstance().Clear();
+
   EXPECT_CALL(*engine, GetSource)
       .Times(1)
       .WillOnce(
@@ -209,9 +224,12 @@ void MockRecordStart(CaptureControllerImpl* capture_controller,
 
   EXPECT_CALL(*record_sink, RemoveAllStreams).Times(1).WillOnce(Return(S_OK));
   EXPECT_CALL(*record_sink, AddStream).Times(2).WillRepeatedly(Return(S_OK));
-  EXPECT_CALL(*record_sink, SetOutputFileName).Times(1).WillOnce(Return(S_OK));
+  EXPECT_CALL(*record_sink, SetSampleCallback)
+      .Times(2)
+      .WillRepeatedly(Return(S_OK));
 
-  capture_controller->StartRecord(mock_path_to_video, -1);
+  capture_controller->StartRecord(mock_path_to_video, -1,
+                                  VideoRecordSettings());
 
   EXPECT_CALL(*camera, OnStartRecordSucceeded()).Times(1);
   engine->CreateFakeEvent(S_OK, MF_CAPTURE_ENGINE_RECORD_STARTED);
@@ -258,7 +276,8 @@ TEST(CaptureController, InitCaptureEngineCanOnlyBeCalledOnce) {
   EXPECT_CALL(*camera, OnCreateCaptureEngineFailed).Times(1);
 
   bool result = capture_controller->InitCaptureDevice(
-      texture_registrar.get(), MOCK_DEVICE_ID, true, ResolutionPreset::kAuto);
+      texture_registrar.get(), MOCK_DEVICE_ID, {true, ResolutionPreset::kAuto},
+      CreateCaptureContext());
 
   EXPECT_FALSE(result);
 
@@ -299,7 +318,8 @@ TEST(CaptureController, InitCaptureEngineReportsFailure) {
       .Times(1);
 
   bool result = capture_controller->InitCaptureDevice(
-      texture_registrar.get(), MOCK_DEVICE_ID, true, ResolutionPreset::kAuto);
+      texture_registrar.get(), MOCK_DEVICE_ID, {true, ResolutionPreset::kAuto},
+      CreateCaptureContext());
 
   EXPECT_FALSE(result);
   EXPECT_FALSE(engine->initialized_);
@@ -343,7 +363,8 @@ TEST(CaptureController, InitCaptureEngineReportsAccessDenied) {
       .Times(1);
 
   bool result = capture_controller->InitCaptureDevice(
-      texture_registrar.get(), MOCK_DEVICE_ID, true, ResolutionPreset::kAuto);
+      texture_registrar.get(), MOCK_DEVICE_ID, {true, ResolutionPreset::kAuto},
+      CreateCaptureContext());
 
   EXPECT_FALSE(result);
   EXPECT_FALSE(engine->initialized_);
@@ -354,6 +375,68 @@ TEST(CaptureController, InitCaptureEngineReportsAccessDenied) {
   engine = nullptr;
 }
 
+TEST(CaptureController, InitCaptureEngineSharesCaptureContext) {
+  std::shared_ptr<CaptureContext> capture_context = CreateCaptureContext();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+  ComPtr<MockMediaSource> video_source = new MockMediaSource();
+
+  std::vector<ComPtr<MockCaptureEngine>> engines;
+  std::vector<std::unique_ptr<CaptureControllerImpl>> capture_controllers;
+  for (int i = 0; i < 2; i++) {
+    ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+    auto capture_controller =
+        std::make_unique<CaptureControllerImpl>(camera.get());
+    capture_controller->SetCaptureEngine(
+        reinterpret_cast<IMFCaptureEngine*>(engine.Get()));
+    capture_controller->SetVideoSource(
+        reinterpret_cast<IMFMediaSource*>(video_source.Get()));
+
+    EXPECT_CALL(*engine.Get(), Initialize).Times(1);
+    EXPECT_TRUE(capture_controller->InitCaptureDevice(
+        texture_registrar.get(), MOCK_DEVICE_ID,
+        {false, ResolutionPreset::kAuto}, capture_context));
+
+    engines.push_back(std::move(engine));
+    capture_controllers.push_back(std::move(capture_controller));
+  }
+
+  // Both controllers keep the context alive until they are reset.
+  EXPECT_EQ(capture_context.use_count(), 3);
+  capture_controllers.clear();
+  EXPECT_EQ(capture_context.use_count(), 1);
+
+  camera = nullptr;
+  texture_registrar = nullptr;
+  engines.clear();
+}
+
+TEST(CaptureController, InitCaptureEngineRequiresCaptureContext) {
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  EXPECT_CALL(*camera,
+              OnCreateCaptureEngineFailed(Eq(CameraResult::kError),
+                                          Eq("Failed to create camera")))
+      .Times(1);
+
+  bool result = capture_controller->InitCaptureDevice(
+      texture_registrar.get(), MOCK_DEVICE_ID, {true, ResolutionPreset::kAuto},
+      nullptr);
+
+  EXPECT_FALSE(result);
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+}
+
 TEST(CaptureController, ReportsInitializedErrorEvent) {
   ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
   std::unique_ptr<MockCamera> camera =
@@ -731,7 +814,7 @@ TEST(CaptureController, ReportsStartRecordError) {
                                   Eq("Failed to start video recording")))
       .Times(1);
 
-  capture_controller->StartRecord("mock_path", -1);
+  capture_controller->StartRecord("mock_path", -1, VideoRecordSettings());
 
   capture_controller = nullptr;
   texture_registrar = nullptr;
@@ -772,7 +855,7 @@ TEST(CaptureController, ReportsStartRecordAccessDenied) {
                                   Eq("Failed to start video recording")))
       .Times(1);
 
-  capture_controller->StartRecord("mock_path", -1);
+  capture_controller->StartRecord("mock_path", -1, VideoRecordSettings());
 
   capture_controller = nullptr;
   texture_registrar = nullptr;
@@ -821,11 +904,12 @@ TEST(CaptureController, ReportsStartRecordErrorEvent) {
   EXPECT_CALL(*record_sink.Get(), AddStream)
       .Times(2)
       .WillRepeatedly(Return(S_OK));
-  EXPECT_CALL(*record_sink.Get(), SetOutputFileName)
-      .Times(1)
-      .WillOnce(Return(S_OK));
+  EXPECT_CALL(*record_sink.Get(), SetSampleCallback)
+      .Times(2)
+      .WillRepeatedly(Return(S_OK));
 
-  capture_controller->StartRecord(mock_path_to_video, -1);
+  capture_controller->StartRecord(mock_path_to_video, -1,
+                                  VideoRecordSettings());
 
   // Send a start record failed event
   EXPECT_CALL(*camera, OnStartRecordSucceeded).Times(0);
@@ -886,12 +970,13 @@ TEST(CaptureController, ReportsStartRecordAccessDeniedEvent) {
   EXPECT_CALL(*record_sink.Get(), AddStream)
       .Times(2)
       .WillRepeatedly(Return(S_OK));
-  EXPECT_CALL(*record_sink.Get(), SetOutputFileName)
-      .Times(1)
-      .WillOnce(Return(S_OK));
+  EXPECT_CALL(*record_sink.Get(), SetSampleCallback)
+      .Times(2)
+      .WillRepeatedly(Return(S_OK));
 
   // Send a start record failed event
-  capture_controller->StartRecord(mock_path_to_video, -1);
+  capture_controller->StartRecord(mock_path_to_video, -1,
+                                  VideoRecordSettings());
 
   EXPECT_CALL(*camera, OnStartRecordSucceeded).Times(0);
   EXPECT_CALL(*camera, OnStartRecordFailed(Eq(CameraResult::kAccessDenied),
@@ -1125,6 +1210,133 @@ TEST(CaptureController, ReportsStopRecordAccessDeniedEvent) {
   record_sink = nullptr;
 }
 
+TEST(CaptureController, PauseResumeRecordSuccess) {
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  int64_t mock_texture_id = 1234;
+
+  // Initialize capture controller to be able to start preview
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  // Prepare fake media types
+  MockAvailableMediaTypes(engine.Get(), capture_source.Get(), 1, 1);
+
+  // Start record
+  ComPtr<MockCaptureRecordSink> record_sink = new MockCaptureRecordSink();
+  std::string mock_path_to_video = "mock_path_to_video";
+  MockRecordStart(capture_controller.get(), engine.Get(), record_sink.Get(),
+                  camera.get(), mock_path_to_video);
+
+  // Pausing keeps the capture engine recording.
+  EXPECT_CALL(*engine.Get(), StopRecord).Times(0);
+  EXPECT_CALL(*camera, OnPauseRecordSucceeded()).Times(1);
+  capture_controller->PauseRecord();
+
+  // The recording resumes even if the encoder does not support requesting
+  // a keyframe.
+  EXPECT_CALL(*record_sink.Get(), GetService)
+      .Times(1)
+      .WillOnce(Return(E_NOTIMPL));
+  EXPECT_CALL(*engine.Get(), StartRecord).Times(0);
+  EXPECT_CALL(*camera, OnResumeRecordSucceeded()).Times(1);
+  capture_controller->ResumeRecord();
+
+  // A paused recording can be stopped.
+  EXPECT_CALL(*camera, OnPauseRecordSucceeded()).Times(1);
+  capture_controller->PauseRecord();
+
+  EXPECT_CALL(*(engine.Get()), StopRecord(true, false))
+      .Times(1)
+      .WillOnce(Return(S_OK));
+  capture_controller->StopRecord();
+
+  EXPECT_CALL(*camera, OnStopRecordSucceeded(Eq(mock_path_to_video))).Times(1);
+  EXPECT_CALL(*camera, OnStopRecordFailed).Times(0);
+
+  engine->CreateFakeEvent(S_OK, MF_CAPTURE_ENGINE_RECORD_STOPPED);
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+  record_sink = nullptr;
+}
+
+TEST(CaptureController, PauseRecordFailsIfNotRecording) {
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+  int64_t mock_texture_id = 1234;
+
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  EXPECT_CALL(*camera, OnPauseRecordSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnPauseRecordFailed(Eq(CameraResult::kError),
+                                           Eq("Recording not running")))
+      .Times(1);
+
+  capture_controller->PauseRecord();
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+}
+
+TEST(CaptureController, ResumeRecordFailsIfNotPaused) {
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  int64_t mock_texture_id = 1234;
+
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+  MockAvailableMediaTypes(engine.Get(), capture_source.Get(), 1, 1);
+
+  ComPtr<MockCaptureRecordSink> record_sink = new MockCaptureRecordSink();
+  MockRecordStart(capture_controller.get(), engine.Get(), record_sink.Get(),
+                  camera.get(), "mock_path_to_video");
+
+  EXPECT_CALL(*camera, OnResumeRecordSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnResumeRecordFailed(Eq(CameraResult::kError),
+                                            Eq("Recording not paused")))
+      .Times(1);
+
+  capture_controller->ResumeRecord();
+
+  // Called by destructor
+  EXPECT_CALL(*(engine.Get()), StopRecord(true, false))
+      .Times(1)
+      .WillOnce(Return(S_OK));
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+  record_sink = nullptr;
+}
+
 TEST(CaptureController, TakePictureSuccess) {
   ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
   std::unique_ptr<MockCamera> camera =
@@ -1343,6 +1555,257 @@ TEST(CaptureController, ReportsPhotoTakenAccessDeniedEvent) {
   photo_sink = nullptr;
 }
 
+void MockPhotoSampleSink(MockCaptureEngine* engine,
+                         MockCapturePhotoSink* photo_sink) {
+  EXPECT_CALL(*engine, GetSink(MF_CAPTURE_ENGINE_SINK_TYPE_PHOTO, _))
+      .Times(1)
+      .WillOnce([src_sink = photo_sink](MF_CAPTURE_ENGINE_SINK_TYPE sink_type,
+                                        IMFCaptureSink** target_sink) {
+        *target_sink = src_sink;
+        src_sink->AddRef();
+        return S_OK;
+      });
+  EXPECT_CALL(*photo_sink, RemoveAllStreams).Times(1).WillOnce(Return(S_OK));
+  EXPECT_CALL(*photo_sink, AddStream).Times(1).WillOnce(Return(S_OK));
+  EXPECT_CALL(*photo_sink, SetOutputFileName).Times(0);
+  EXPECT_CALL(*photo_sink, SetSampleCallback)
+      .Times(1)
+      .WillOnce([sink = photo_sink](
+                    IMFCaptureEngineOnSampleCallback* pCallback) -> HRESULT {
+        sink->sample_callback_ = pCallback;
+        return S_OK;
+      });
+}
+
+std::string GetTempPhotoPath(const std::string& name) {
+  wchar_t temp_path[MAX_PATH];
+  DWORD length = GetTempPathW(MAX_PATH, temp_path);
+  EXPECT_GT(length, 0u);
+  return Utf8FromUtf16(std::wstring_view(temp_path, length)) + name;
+}
+
+std::vector<uint8_t> ReadPhotoFile(const std::string& path) {
+  std::vector<uint8_t> bytes;
+  FILE* file = nullptr;
+  if (_wfopen_s(&file, Utf16FromUtf8(path).c_str(), L"rb") == 0 && file) {
+    uint8_t byte;
+    while (fread(&byte, 1, 1, file) == 1) {
+      bytes.push_back(byte);
+    }
+    fclose(file);
+  }
+  return bytes;
+}
+
+TEST(CaptureController, TakePictureBurstWritesEachPhoto) {
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  int64_t mock_texture_id = 1234;
+
+  // Initialize capture controller to be able to take picture
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  // Prepare fake media types
+  MockAvailableMediaTypes(engine.Get(), capture_source.Get(), 1, 1);
+
+  ComPtr<MockCapturePhotoSink> photo_sink = new MockCapturePhotoSink();
+
+  // Initialize photo sink once for the whole burst
+  MockPhotoSampleSink(engine.Get(), photo_sink.Get());
+
+  std::vector<std::string> paths = {
+      GetTempPhotoPath("camera_windows_burst_1.jpeg"),
+      GetTempPhotoPath("camera_windows_burst_2.jpeg")};
+  const std::vector<uint8_t> first_photo = {0xFF, 0xD8, 0x01};
+  const std::vector<uint8_t> second_photo = {0xFF, 0xD8, 0x02, 0x03};
+
+  // Request burst, each photo is requested after the previous one is taken
+  EXPECT_CALL(*(engine.Get()), TakePhoto()).Times(2).WillRepeatedly(
+      Return(S_OK));
+  capture_controller->TakePictureBurst(paths);
+
+  photo_sink->SendFakeSample(first_photo.data(),
+                             static_cast<uint32_t>(first_photo.size()));
+  EXPECT_CALL(*camera, OnTakePictureBurstSucceeded).Times(0);
+  engine->CreateFakeEvent(S_OK, MF_CAPTURE_ENGINE_PHOTO_TAKEN);
+
+  photo_sink->SendFakeSample(second_photo.data(),
+                             static_cast<uint32_t>(second_photo.size()));
+  EXPECT_CALL(*camera, OnTakePictureBurstSucceeded(Eq(paths))).Times(1);
+  EXPECT_CALL(*camera, OnTakePictureBurstFailed).Times(0);
+  engine->CreateFakeEvent(S_OK, MF_CAPTURE_ENGINE_PHOTO_TAKEN);
+
+  EXPECT_EQ(ReadPhotoFile(paths[0]), first_photo);
+  EXPECT_EQ(ReadPhotoFile(paths[1]), second_photo);
+  for (const std::string& path : paths) {
+    DeleteFileW(Utf16FromUtf8(path).c_str());
+  }
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+  photo_sink = nullptr;
+}
+
+TEST(CaptureController, ReportsTakePictureBurstErrorIfPhotoNotWritten) {
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  int64_t mock_texture_id = 1234;
+
+  // Initialize capture controller to be able to take picture
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  // Prepare fake media types
+  MockAvailableMediaTypes(engine.Get(), capture_source.Get(), 1, 1);
+
+  ComPtr<MockCapturePhotoSink> photo_sink = new MockCapturePhotoSink();
+
+  // Initialize photo sink once for the whole burst
+  MockPhotoSampleSink(engine.Get(), photo_sink.Get());
+
+  EXPECT_CALL(*(engine.Get()), TakePhoto()).Times(1).WillOnce(Return(S_OK));
+  capture_controller->TakePictureBurst(
+      {GetTempPhotoPath("camera_windows_burst_1.jpeg"),
+       GetTempPhotoPath("camera_windows_burst_2.jpeg")});
+
+  // Photo taken event without a sample
+  EXPECT_CALL(*camera, OnTakePictureBurstSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnTakePictureBurstFailed(Eq(CameraResult::kError),
+                                                Eq("Failed to take photo")))
+      .Times(1);
+  engine->CreateFakeEvent(S_OK, MF_CAPTURE_ENGINE_PHOTO_TAKEN);
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+  photo_sink = nullptr;
+}
+
+TEST(CaptureController, TakePictureDataEncodesPhotoInMemory) {
+  ASSERT_TRUE(SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED)));
+
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  int64_t mock_texture_id = 1234;
+
+  // Initialize capture controller to be able to take picture
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  // Prepare fake media types
+  MockAvailableMediaTypes(engine.Get(), capture_source.Get(), 1, 1);
+
+  ComPtr<MockCapturePhotoSink> photo_sink = new MockCapturePhotoSink();
+
+  // Initialize photo sink with a sample callback
+  MockPhotoSampleSink(engine.Get(), photo_sink.Get());
+
+  EXPECT_CALL(*(engine.Get()), TakePhoto()).Times(1).WillOnce(Return(S_OK));
+  PhotoSettings settings;
+  settings.format = PhotoFormat::kPng;
+  capture_controller->TakePictureData(settings);
+
+  // A 1x1 red 24 bit bitmap, as captured by the photo sink.
+  const std::vector<uint8_t> bitmap = {
+      'B', 'M', 58, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,  // File header
+      40,  0,   0,  0, 1, 0, 0, 0, 1, 0, 0,  0, 1, 0, 24, 0, 0, 0,
+      0,   0,   4,  0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0,
+      0,   0,   0,  0,                               // Info header
+      0,   0,   0xFF, 0};                            // Pixel row
+  photo_sink->SendFakeSample(bitmap.data(),
+                             static_cast<uint32_t>(bitmap.size()));
+
+  // PNG files start with a fixed signature.
+  const std::vector<uint8_t> png_signature = {0x89, 'P', 'N', 'G'};
+  EXPECT_CALL(*camera, OnTakePictureDataFailed).Times(0);
+  EXPECT_CALL(*camera, OnTakePictureDataSucceeded)
+      .Times(1)
+      .WillOnce([png_signature](std::vector<uint8_t>& data) {
+        ASSERT_GT(data.size(), png_signature.size());
+        EXPECT_TRUE(std::equal(png_signature.begin(), png_signature.end(),
+                               data.begin()));
+      });
+  engine->CreateFakeEvent(S_OK, MF_CAPTURE_ENGINE_PHOTO_TAKEN);
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+  photo_sink = nullptr;
+
+  CoUninitialize();
+}
+
+TEST(CaptureController, ReportsTakePictureDataErrorEvent) {
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  int64_t mock_texture_id = 1234;
+
+  // Initialize capture controller to be able to take picture
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  // Prepare fake media types
+  MockAvailableMediaTypes(engine.Get(), capture_source.Get(), 1, 1);
+
+  ComPtr<MockCapturePhotoSink> photo_sink = new MockCapturePhotoSink();
+
+  // Initialize photo sink with a sample callback
+  MockPhotoSampleSink(engine.Get(), photo_sink.Get());
+
+  EXPECT_CALL(*(engine.Get()), TakePhoto()).Times(1).WillOnce(Return(S_OK));
+  capture_controller->TakePictureData(PhotoSettings());
+
+  // Send take picture failed event
+  EXPECT_CALL(*camera, OnTakePictureDataSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnTakePictureDataFailed(Eq(CameraResult::kError),
+                                               Eq("Unspecified error")))
+      .Times(1);
+  engine->CreateFakeEvent(E_FAIL, MF_CAPTURE_ENGINE_PHOTO_TAKEN);
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+  photo_sink = nullptr;
+}
+
 TEST(CaptureController, PauseResumePreviewSuccess) {
   ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
   std::unique_ptr<MockCamera> camera =
@@ -1380,6 +1843,51 @@ TEST(CaptureController, PauseResumePreviewSuccess) {
   camera = nullptr;
 }
 
+TEST(CaptureController, SkipsPreviewSamplesWhileWindowHidden) {
+  ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<CaptureControllerImpl> capture_controller =
+      std::make_unique<CaptureControllerImpl>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  int64_t mock_texture_id = 1234;
+
+  // Initialize capture controller to be able to start preview
+  MockInitCaptureController(capture_controller.get(), texture_registrar.get(),
+                            engine.Get(), camera.get(), mock_texture_id);
+
+  ComPtr<MockCapturePreviewSink> preview_sink = new MockCapturePreviewSink();
+
+  std::unique_ptr<uint8_t[]> mock_source_buffer =
+      std::make_unique<uint8_t[]>(0);
+
+  MockStartPreview(capture_controller.get(), preview_sink.Get(),
+                   texture_registrar.get(), engine.Get(), camera.get(),
+                   std::move(mock_source_buffer), 0, 1, 1, mock_texture_id);
+
+  capture_controller->UpdateCaptureTime(1000000);
+  EXPECT_TRUE(capture_controller->IsReadyForSample());
+
+  capture_controller->SetPreviewWindowHidden(true);
+  capture_controller->UpdateCaptureTime(1033333);
+  EXPECT_FALSE(capture_controller->IsReadyForSample());
+
+  capture_controller->SetPreviewWindowHidden(false);
+  capture_controller->UpdateCaptureTime(1066666);
+  EXPECT_TRUE(capture_controller->IsReadyForSample());
+
+  capture_controller->SetPreviewTargetFrameRate(0.0);
+  capture_controller->UpdateCaptureTime(1100000);
+  EXPECT_FALSE(capture_controller->IsReadyForSample());
+
+  capture_controller = nullptr;
+  texture_registrar = nullptr;
+  engine = nullptr;
+  camera = nullptr;
+}
+
 TEST(CaptureController, PausePreviewFailsIfPreviewNotStarted) {
   ComPtr<MockCaptureEngine> engine = new MockCaptureEngine();
   std::unique_ptr<MockCamera> camera =
@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "capture_engine_listener.h"
+
+#include <gtest/gtest.h>
+#include <wrl/client.h>
+
+#include <vector>
+
+#include "mocks.h"
+
+namespace camera_windows {
+using Microsoft::WRL::ComPtr;
+
+namespace test {
+
+namespace {
+
+// Records the frames delivered to |UpdateBuffer|.
+class FrameRecordingObserver : public CaptureEngineObserver {
+ public:
+  bool IsReadyForSample() const override { return true; }
+  void OnEvent(IMFMediaEvent*) override {}
+  void OnSynchronizedEvent(IMFMediaEvent*) override {}
+  bool UpdateBuffer(const uint8_t* data, uint32_t data_length,
+                    int32_t) override {
+    frames_.emplace_back(data, data + data_length);
+    return true;
+  }
+  bool UpdateTexture(ID3D11Texture2D*, UINT) override { return false; }
+  void UpdateCaptureTime(uint64_t) override {}
+
+  std::vector<std::vector<uint8_t>> frames_;
+};
+
+// Returns a frame of |size| bytes with increasing byte values.
+std::vector<uint8_t> CreateFrame(uint32_t size) {
+  std::vector<uint8_t> frame(size);
+  for (uint32_t i = 0; i < size; i++) {
+    frame[i] = static_cast<uint8_t>(i);
+  }
+  return frame;
+}
+
+}  // namespace
+
+TEST(CaptureEngineListener, DeliversMultipleBufferSamplesContiguously) {
+  FrameRecordingObserver observer;
+  ComPtr<CaptureEngineListener> listener =
+      new CaptureEngineListener(&observer);
+  ComPtr<MockCapturePreviewSink> preview_sink = new MockCapturePreviewSink();
+  preview_sink->sample_callback_ = listener.Get();
+
+  std::vector<uint8_t> frame = CreateFrame(1000);
+  preview_sink->SendFakeMultipleBufferSample(
+      frame.data(), static_cast<uint32_t>(frame.size()), 3);
+
+  ASSERT_EQ(observer.frames_.size(), 1u);
+  EXPECT_EQ(observer.frames_[0], frame);
+
+  preview_sink->sample_callback_ = nullptr;
+}
+
+TEST(CaptureEngineListener, ReusesFrameBufferForMultipleBufferSamples) {
+  FrameRecordingObserver observer;
+  ComPtr<CaptureEngineListener> listener =
+      new CaptureEngineListener(&observer);
+  ComPtr<MockCapturePreviewSink> preview_sink = new MockCapturePreviewSink();
+  preview_sink->sample_callback_ = listener.Get();
+
+  std::vector<uint8_t> frame = CreateFrame(1000);
+  for (int i = 0; i < 3; i++) {
+    preview_sink->SendFakeMultipleBufferSample(
+        frame.data(), static_cast<uint32_t>(frame.size()), 2);
+  }
+
+  EXPECT_EQ(observer.frames_.size(), 3u);
+  EXPECT_EQ(listener->GetFrameBufferPool().GetAllocationCount(), 1u);
+
+  preview_sink->sample_callback_ = nullptr;
+}
+
+TEST(CaptureEngineListener, ReadsSingleBufferSamplesInPlace) {
+  FrameRecordingObserver observer;
+  ComPtr<CaptureEngineListener> listener =
+      new CaptureEngineListener(&observer);
+  ComPtr<MockCapturePreviewSink> preview_sink = new MockCapturePreviewSink();
+  preview_sink->sample_callback_ = listener.Get();
+
+  std::vector<uint8_t> frame = CreateFrame(1000);
+  preview_sink->SendFakeSample(frame.data(),
+                               static_cast<uint32_t>(frame.size()));
+
+  ASSERT_EQ(observer.frames_.size(), 1u);
+  EXPECT_EQ(observer.frames_[0], frame);
+  EXPECT_EQ(listener->GetFrameBufferPool().GetAllocationCount(), 0u);
+
+  preview_sink->sample_callback_ = nullptr;
+}
+
+}  // namespace test
+}  // namespace camera_windows
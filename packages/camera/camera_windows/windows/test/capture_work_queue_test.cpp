@@ -0,0 +1,66 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "capture_work_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(CaptureWorkQueue, RunsTasksInOrderOnQueueThread) {
+  CaptureWorkQueue queue;
+  std::vector<int> order;
+  std::thread::id task_thread_id;
+  bool on_queue_thread = false;
+  std::promise<void> done;
+
+  for (int i = 0; i < 3; i++) {
+    queue.Post([&order, i]() { order.push_back(i); });
+  }
+  queue.Post([&]() {
+    task_thread_id = std::this_thread::get_id();
+    on_queue_thread = queue.IsCurrentThread();
+    done.set_value();
+  });
+  done.get_future().wait();
+
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+  EXPECT_NE(task_thread_id, std::this_thread::get_id());
+  EXPECT_TRUE(on_queue_thread);
+  EXPECT_FALSE(queue.IsCurrentThread());
+}
+
+TEST(CaptureWorkQueue, DestructorDiscardsTasksNotStarted) {
+  auto queue = std::make_unique<CaptureWorkQueue>();
+  std::promise<void> started;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  bool second_task_run = false;
+
+  queue->Post([&started, released]() {
+    started.set_value();
+    released.wait();
+  });
+  queue->Post([&second_task_run]() { second_task_run = true; });
+  started.get_future().wait();
+
+  std::thread destroyer([&queue]() { queue = nullptr; });
+  // Give the destructor time to stop the queue before the task returns.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  release.set_value();
+  destroyer.join();
+
+  EXPECT_FALSE(second_task_run);
+}
+
+}  // namespace test
+}  // namespace camera_windows
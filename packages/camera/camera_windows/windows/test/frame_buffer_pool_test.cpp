@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "frame_buffer_pool.h"
+
+#include <gtest/gtest.h>
+#include <windows.h>
+
+#include <cstdint>
+#include <utility>
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(FrameBufferPool, AllocatesPageAlignedBuffers) {
+  FrameBufferPool pool;
+  SYSTEM_INFO system_info;
+  GetSystemInfo(&system_info);
+
+  FrameBuffer buffer = pool.Acquire(1000);
+
+  ASSERT_TRUE(buffer.data());
+  EXPECT_GE(buffer.capacity(), 1000u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.data()) %
+                system_info.dwPageSize,
+            0u);
+  EXPECT_EQ(pool.GetAllocationCount(), 1u);
+}
+
+TEST(FrameBufferPool, ReusesReleasedBuffers) {
+  FrameBufferPool pool;
+
+  uint8_t* first_data = nullptr;
+  {
+    FrameBuffer buffer = pool.Acquire(4096 * 3);
+    first_data = buffer.data();
+  }
+  FrameBuffer buffer = pool.Acquire(4096 * 2);
+
+  EXPECT_EQ(buffer.data(), first_data);
+  EXPECT_EQ(pool.GetAllocationCount(), 1u);
+}
+
+TEST(FrameBufferPool, AllocatesIfReleasedBuffersAreTooSmall) {
+  FrameBufferPool pool;
+
+  pool.Acquire(4096).Reset();
+  FrameBuffer buffer = pool.Acquire(4096 * 4);
+
+  EXPECT_GE(buffer.capacity(), 4096u * 4);
+  EXPECT_EQ(pool.GetAllocationCount(), 2u);
+}
+
+TEST(FrameBufferPool, MovedBufferIsReleasedOnce) {
+  FrameBufferPool pool(1);
+
+  FrameBuffer first = pool.Acquire(100);
+  FrameBuffer second = std::move(first);
+  EXPECT_FALSE(first.data());
+  first.Reset();
+  second.Reset();
+
+  // Only one buffer was returned to the pool, so a second one is allocated.
+  FrameBuffer third = pool.Acquire(100);
+  FrameBuffer fourth = pool.Acquire(100);
+  EXPECT_NE(third.data(), fourth.data());
+  EXPECT_EQ(pool.GetAllocationCount(), 2u);
+}
+
+TEST(FrameBufferPool, ReturnsEmptyBufferForZeroSize) {
+  FrameBufferPool pool;
+
+  FrameBuffer buffer = pool.Acquire(0);
+
+  EXPECT_FALSE(buffer.data());
+  EXPECT_EQ(buffer.capacity(), 0u);
+  EXPECT_EQ(pool.GetAllocationCount(), 0u);
+}
+
+}  // namespace test
+}  // namespace camera_windows
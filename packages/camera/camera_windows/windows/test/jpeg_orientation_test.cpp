@@ -0,0 +1,140 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "jpeg_orientation.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace camera_windows {
+
+namespace test {
+
+namespace {
+
+// The segments of a JPEG image without any image data.
+const std::vector<uint8_t> kStartOfImage = {0xFF, 0xD8};
+const std::vector<uint8_t> kJfifSegment = {0xFF, 0xE0, 0x00, 0x10, 'J', 'F',
+                                           'I',  'F',  0x00, 0x01, 0x01, 0x00,
+                                           0x00, 0x01, 0x00, 0x01, 0x00, 0x00};
+const std::vector<uint8_t> kScanSegment = {0xFF, 0xDA, 0x00, 0x02,
+                                           0x12, 0x34, 0xFF, 0xD9};
+
+std::vector<uint8_t> Concat(
+    std::initializer_list<std::vector<uint8_t>> segments) {
+  std::vector<uint8_t> result;
+  for (const std::vector<uint8_t>& segment : segments) {
+    result.insert(result.end(), segment.begin(), segment.end());
+  }
+  return result;
+}
+
+// Returns an EXIF segment whose IFD has a |tag| short of |value|, preceded
+// by an unrelated entry.
+std::vector<uint8_t> ExifSegment(bool big_endian, uint16_t tag,
+                                 uint16_t value) {
+  auto u16 = [big_endian](uint16_t v) -> std::vector<uint8_t> {
+    uint8_t high = static_cast<uint8_t>(v >> 8);
+    uint8_t low = static_cast<uint8_t>(v & 0xFF);
+    return big_endian ? std::vector<uint8_t>{high, low}
+                      : std::vector<uint8_t>{low, high};
+  };
+  auto u32 = [&u16, big_endian](uint32_t v) {
+    std::vector<uint8_t> high = u16(static_cast<uint16_t>(v >> 16));
+    std::vector<uint8_t> low = u16(static_cast<uint16_t>(v & 0xFFFF));
+    return big_endian ? Concat({high, low}) : Concat({low, high});
+  };
+
+  std::vector<uint8_t> tiff = Concat({
+      big_endian ? std::vector<uint8_t>{'M', 'M'}
+                 : std::vector<uint8_t>{'I', 'I'},
+      u16(0x2A), u32(8), u16(2),
+      // ImageWidth long.
+      u16(0x0100), u16(4), u32(1), u32(640),
+      // The tested tag.
+      u16(tag), u16(3), u32(1), u16(value), u16(0),
+      // No next IFD.
+      u32(0),
+  });
+  std::vector<uint8_t> payload =
+      Concat({{'E', 'x', 'i', 'f', 0x00, 0x00}, tiff});
+  uint16_t length = static_cast<uint16_t>(payload.size() + 2);
+  return Concat({{0xFF, 0xE1, static_cast<uint8_t>(length >> 8),
+                  static_cast<uint8_t>(length & 0xFF)},
+                 payload});
+}
+
+}  // namespace
+
+TEST(JpegOrientation, InsertsExifSegmentAfterJfifSegment) {
+  std::vector<uint8_t> jpeg =
+      Concat({kStartOfImage, kJfifSegment, kScanSegment});
+
+  ASSERT_TRUE(SetJpegExifOrientation(kExifOrientationRotate90, &jpeg));
+
+  std::vector<uint8_t> expected_exif = {
+      0xFF, 0xE1, 0x00, 0x22, 'E',  'x',  'i',  'f',  0x00,
+      0x00, 'M',  'M',  0x00, 0x2A, 0x00, 0x00, 0x00, 0x08,
+      0x00, 0x01, 0x01, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+  EXPECT_EQ(jpeg, Concat({kStartOfImage, kJfifSegment, expected_exif,
+                          kScanSegment}));
+}
+
+TEST(JpegOrientation, InsertsExifSegmentAfterStartOfImage) {
+  std::vector<uint8_t> jpeg = Concat({kStartOfImage, kScanSegment});
+
+  ASSERT_TRUE(SetJpegExifOrientation(kExifOrientationRotate180, &jpeg));
+
+  ASSERT_EQ(jpeg.size(), kStartOfImage.size() + 36 + kScanSegment.size());
+  EXPECT_EQ(jpeg[2], 0xFF);
+  EXPECT_EQ(jpeg[3], 0xE1);
+  EXPECT_EQ(jpeg[2 + 29], 0x03);
+  EXPECT_EQ(std::vector<uint8_t>(jpeg.end() - kScanSegment.size(), jpeg.end()),
+            kScanSegment);
+}
+
+TEST(JpegOrientation, OverwritesBigEndianOrientation) {
+  std::vector<uint8_t> jpeg =
+      Concat({kStartOfImage, ExifSegment(true, 0x0112, 1), kScanSegment});
+
+  ASSERT_TRUE(SetJpegExifOrientation(kExifOrientationRotate270, &jpeg));
+
+  EXPECT_EQ(jpeg, Concat({kStartOfImage, ExifSegment(true, 0x0112, 8),
+                          kScanSegment}));
+}
+
+TEST(JpegOrientation, OverwritesLittleEndianOrientation) {
+  std::vector<uint8_t> jpeg = Concat(
+      {kStartOfImage, kJfifSegment, ExifSegment(false, 0x0112, 1),
+       kScanSegment});
+
+  ASSERT_TRUE(SetJpegExifOrientation(kExifOrientationRotate90, &jpeg));
+
+  EXPECT_EQ(jpeg,
+            Concat({kStartOfImage, kJfifSegment,
+                    ExifSegment(false, 0x0112, 6), kScanSegment}));
+}
+
+TEST(JpegOrientation, FailsForExifWithoutOrientation) {
+  std::vector<uint8_t> jpeg =
+      Concat({kStartOfImage, ExifSegment(true, 0x0131, 1), kScanSegment});
+  const std::vector<uint8_t> original = jpeg;
+
+  EXPECT_FALSE(SetJpegExifOrientation(kExifOrientationRotate90, &jpeg));
+  EXPECT_EQ(jpeg, original);
+}
+
+TEST(JpegOrientation, FailsForInvalidImages) {
+  std::vector<uint8_t> not_jpeg = {0x89, 'P', 'N', 'G'};
+  EXPECT_FALSE(SetJpegExifOrientation(kExifOrientationRotate90, &not_jpeg));
+
+  std::vector<uint8_t> truncated = Concat({kStartOfImage, kJfifSegment});
+  truncated.resize(truncated.size() - 4);
+  EXPECT_FALSE(SetJpegExifOrientation(kExifOrientationRotate90, &truncated));
+}
+
+}  // namespace test
+}  // namespace camera_windows
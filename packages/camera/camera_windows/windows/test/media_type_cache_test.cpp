@@ -0,0 +1,182 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "media_type_cache.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <windows.h>
+#include <wrl/client.h>
+
+#include <memory>
+
+#include "mocks.h"
+
+namespace camera_windows {
+
+namespace test {
+
+using Microsoft::WRL::ComPtr;
+using ::testing::_;
+using ::testing::Eq;
+
+namespace {
+
+constexpr DWORD kStreamIndex =
+    (DWORD)MF_CAPTURE_ENGINE_PREFERRED_SOURCE_STREAM_FOR_VIDEO_RECORD;
+
+// Makes |capture_source| expose two media types on |kStreamIndex|.
+void MockMediaTypes(MockCaptureSource* capture_source, int times) {
+  EXPECT_CALL(*capture_source,
+              GetAvailableDeviceMediaType(Eq(kStreamIndex), _, _))
+      .Times(times)
+      .WillRepeatedly([](DWORD stream_index, DWORD media_type_index,
+                         IMFMediaType** media_type) {
+        if (media_type_index > 1) return MF_E_NO_MORE_TYPES;
+        int scale = static_cast<int>(media_type_index) + 1;
+        *media_type = new FakeMediaType(MFMediaType_Video, MFVideoFormat_RGB32,
+                                        640 * scale, 480 * scale);
+        (*media_type)->AddRef();
+        return S_OK;
+      });
+}
+
+DeviceMediaType CreateDeviceMediaType(GUID subtype, uint32_t width,
+                                      uint32_t height, float frame_rate) {
+  DeviceMediaType media_type;
+  media_type.subtype = subtype;
+  media_type.width = width;
+  media_type.height = height;
+  media_type.frame_rate = frame_rate;
+  return media_type;
+}
+
+}  // namespace
+
+TEST(MediaTypeCache, EnumeratesDeviceStreamOnlyOnce) {
+  MediaTypeCache cache;
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  // Two media types and the end of the list are enumerated once.
+  MockMediaTypes(capture_source.Get(), 3);
+
+  std::shared_ptr<const MediaTypeCache::MediaTypeList> media_types =
+      cache.GetMediaTypes(MOCK_DEVICE_ID, kStreamIndex, capture_source.Get());
+  ASSERT_EQ(media_types->size(), 2u);
+  EXPECT_EQ((*media_types)[0].width, 640u);
+  EXPECT_EQ((*media_types)[0].height, 480u);
+  EXPECT_EQ((*media_types)[0].frame_rate, 30.f);
+  EXPECT_EQ((*media_types)[1].width, 1280u);
+  EXPECT_EQ((*media_types)[1].height, 960u);
+
+  // Another capture source of the same device reuses the cached list.
+  ComPtr<MockCaptureSource> other_capture_source = new MockCaptureSource();
+  EXPECT_CALL(*other_capture_source, GetAvailableDeviceMediaType).Times(0);
+  EXPECT_EQ(cache.GetMediaTypes(MOCK_DEVICE_ID, kStreamIndex,
+                                other_capture_source.Get()),
+            media_types);
+}
+
+TEST(MediaTypeCache, EnumeratesAgainAfterClear) {
+  MediaTypeCache cache;
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  MockMediaTypes(capture_source.Get(), 6);
+
+  EXPECT_EQ(
+      cache.GetMediaTypes(MOCK_DEVICE_ID, kStreamIndex, capture_source.Get())
+          ->size(),
+      2u);
+  cache.Clear();
+  EXPECT_EQ(
+      cache.GetMediaTypes(MOCK_DEVICE_ID, kStreamIndex, capture_source.Get())
+          ->size(),
+      2u);
+}
+
+TEST(MediaTypeCache, DoesNotCacheEmptyEnumeration) {
+  MediaTypeCache cache;
+  ComPtr<MockCaptureSource> capture_source = new MockCaptureSource();
+
+  EXPECT_CALL(*capture_source, GetAvailableDeviceMediaType)
+      .Times(2)
+      .WillRepeatedly(
+          [](DWORD stream_index, DWORD media_type_index,
+             IMFMediaType** media_type) { return MF_E_NO_MORE_TYPES; });
+
+  EXPECT_TRUE(
+      cache.GetMediaTypes(MOCK_DEVICE_ID, kStreamIndex, capture_source.Get())
+          ->empty());
+  EXPECT_TRUE(
+      cache.GetMediaTypes(MOCK_DEVICE_ID, kStreamIndex, capture_source.Get())
+          ->empty());
+}
+
+TEST(MediaTypeCache, BestMediaTypeHasMostPixels) {
+  // A wider but shorter type does not win over a larger one.
+  MediaTypeCache::MediaTypeList media_types = {
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1280, 720, 30.f),
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1440, 480, 30.f),
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1920, 1080, 30.f),
+      CreateDeviceMediaType(MFVideoFormat_NV12, 2560, 360, 30.f),
+  };
+
+  const DeviceMediaType* best =
+      FindBestDeviceMediaType(media_types, 0xffffffff, 0.f);
+  ASSERT_TRUE(best);
+  EXPECT_EQ(best, &media_types[2]);
+
+  // Types taller than the maximum height are skipped.
+  best = FindBestDeviceMediaType(media_types, 720, 0.f);
+  ASSERT_TRUE(best);
+  EXPECT_EQ(best, &media_types[0]);
+}
+
+TEST(MediaTypeCache, BestMediaTypeAvoidsDecoding) {
+  MediaTypeCache::MediaTypeList media_types = {
+      CreateDeviceMediaType(MFVideoFormat_MJPG, 1280, 720, 30.f),
+      CreateDeviceMediaType(MFVideoFormat_YUY2, 1280, 720, 30.f),
+      CreateDeviceMediaType(MFVideoFormat_MJPG, 1280, 720, 30.f),
+  };
+
+  const DeviceMediaType* best =
+      FindBestDeviceMediaType(media_types, 0xffffffff, 0.f);
+  ASSERT_TRUE(best);
+  EXPECT_EQ(best, &media_types[1]);
+}
+
+TEST(MediaTypeCache, BestMediaTypeMatchesTargetFrameRate) {
+  MediaTypeCache::MediaTypeList media_types = {
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1280, 720, 60.f),
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1280, 720, 29.97f),
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1280, 720, 10.f),
+  };
+
+  // Without a target, the highest frame rate is preferred.
+  const DeviceMediaType* best =
+      FindBestDeviceMediaType(media_types, 0xffffffff, 0.f);
+  ASSERT_TRUE(best);
+  EXPECT_EQ(best, &media_types[0]);
+
+  best = FindBestDeviceMediaType(media_types, 0xffffffff, 30.f);
+  ASSERT_TRUE(best);
+  EXPECT_EQ(best, &media_types[1]);
+
+  // Slow types are only accepted if requested.
+  best = FindBestDeviceMediaType(media_types, 0xffffffff, 10.f);
+  ASSERT_TRUE(best);
+  EXPECT_EQ(best, &media_types[2]);
+}
+
+TEST(MediaTypeCache, NoBestMediaTypeIfNoneFits) {
+  MediaTypeCache::MediaTypeList media_types = {
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1280, 720, 5.f),
+      CreateDeviceMediaType(MFVideoFormat_NV12, 1920, 1080, 30.f),
+  };
+
+  EXPECT_FALSE(FindBestDeviceMediaType(media_types, 720, 0.f));
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -12,6 +12,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <mfcaptureengine.h>
+#include <mfreadwrite.h>
 
 #include "camera.h"
 #include "camera_plugin.h"
@@ -178,11 +179,29 @@ class MockCamera : public Camera {
   MOCK_METHOD(void, OnStopRecordFailed,
               (CameraResult result, const std::string& error), (override));
 
+  MOCK_METHOD(void, OnPauseRecordSucceeded, (), (override));
+  MOCK_METHOD(void, OnPauseRecordFailed,
+              (CameraResult result, const std::string& error), (override));
+
+  MOCK_METHOD(void, OnResumeRecordSucceeded, (), (override));
+  MOCK_METHOD(void, OnResumeRecordFailed,
+              (CameraResult result, const std::string& error), (override));
+
   MOCK_METHOD(void, OnTakePictureSucceeded, (const std::string& file_path),
               (override));
   MOCK_METHOD(void, OnTakePictureFailed,
               (CameraResult result, const std::string& error), (override));
 
+  MOCK_METHOD(void, OnTakePictureDataSucceeded, (std::vector<uint8_t> & data),
+              (override));
+  MOCK_METHOD(void, OnTakePictureDataFailed,
+              (CameraResult result, const std::string& error), (override));
+
+  MOCK_METHOD(void, OnTakePictureBurstSucceeded,
+              (const std::vector<std::string>& file_paths), (override));
+  MOCK_METHOD(void, OnTakePictureBurstFailed,
+              (CameraResult result, const std::string& error), (override));
+
   MOCK_METHOD(void, OnVideoRecordSucceeded,
               (const std::string& file_path, int64_t video_duration),
               (override));
@@ -190,6 +209,10 @@ class MockCamera : public Camera {
               (CameraResult result, const std::string& error), (override));
   MOCK_METHOD(void, OnCaptureError,
               (CameraResult result, const std::string& error), (override));
+  MOCK_METHOD(bool, OnImageStreamFrameAvailable, (ImageStreamFrame & frame),
+              (override));
+  MOCK_METHOD(void, OnVideoRecordChunkAvailable,
+              (uint64_t offset, std::vector<uint8_t>& data), (override));
 
   MOCK_METHOD(bool, HasDeviceId, (std::string & device_id), (const override));
   MOCK_METHOD(bool, HasCameraId, (int64_t camera_id), (const override));
@@ -205,8 +228,9 @@ class MockCamera : public Camera {
 
   MOCK_METHOD(bool, InitCamera,
               (flutter::TextureRegistrar * texture_registrar,
-               flutter::BinaryMessenger* messenger, bool record_audio,
-               ResolutionPreset resolution_preset),
+               flutter::BinaryMessenger* messenger,
+               const CaptureSettings& settings,
+               std::shared_ptr<CaptureContext> capture_context),
               (override));
 
   std::unique_ptr<CaptureController> capture_controller_;
@@ -229,32 +253,75 @@ class MockCaptureControllerFactory : public CaptureControllerFactory {
               (CaptureControllerListener * listener), (override));
 };
 
+class MockCameraControls : public CameraControls {
+ public:
+  ~MockCameraControls() = default;
+
+  MOCK_METHOD(HRESULT, SetExposureMode, (CameraControlMode mode), (override));
+  MOCK_METHOD(HRESULT, SetFocusMode, (CameraControlMode mode), (override));
+  MOCK_METHOD(HRESULT, SetWhiteBalanceMode, (CameraControlMode mode),
+              (override));
+  MOCK_METHOD(ExposureOffsetRange, GetExposureOffsetRange, (), (override));
+  MOCK_METHOD(HRESULT, SetExposureOffset,
+              (double offset, double* applied_offset), (override));
+  MOCK_METHOD(HRESULT, SetFrameRateLock, (bool locked), (override));
+  MOCK_METHOD(HRESULT, SetFlashMode, (CameraFlashMode mode), (override));
+  MOCK_METHOD(HRESULT, SetPhotoCapturePriority,
+              (PhotoCapturePriority priority), (override));
+};
+
 class MockCaptureController : public CaptureController {
  public:
   ~MockCaptureController() = default;
 
   MOCK_METHOD(bool, InitCaptureDevice,
               (flutter::TextureRegistrar * texture_registrar,
-               const std::string& device_id, bool record_audio,
-               ResolutionPreset resolution_preset),
+               const std::string& device_id, const CaptureSettings& settings,
+               std::shared_ptr<CaptureContext> capture_context),
               (override));
 
   MOCK_METHOD(uint32_t, GetPreviewWidth, (), (const override));
   MOCK_METHOD(uint32_t, GetPreviewHeight, (), (const override));
+  MOCK_METHOD(std::optional<PreviewStatsSnapshot>, GetPreviewStats, (),
+              (const override));
+  MOCK_METHOD(std::optional<RecordSampleStats>, GetRecordingStats, (),
+              (const override));
+  MOCK_METHOD(std::vector<CaptureFormat>, GetCaptureFormats, (),
+              (const override));
 
   // Actions
+  MOCK_METHOD(bool, SetZoomLevel, (double zoom_level), (override));
+  MOCK_METHOD(bool, SetPreviewRotation, (PreviewRotation rotation),
+              (override));
+  MOCK_METHOD(bool, SetPreviewCropRect, (const PreviewCropRect& crop_rect),
+              (override));
+  MOCK_METHOD(void, SetPreviewTargetFrameRate,
+              (std::optional<double> frames_per_second), (override));
+  MOCK_METHOD(void, SetPreviewWindowHidden, (bool hidden), (override));
+  MOCK_METHOD(CameraControls*, GetCameraControls, (), (override));
   MOCK_METHOD(void, StartPreview, (), (override));
   MOCK_METHOD(void, ResumePreview, (), (override));
   MOCK_METHOD(void, PausePreview, (), (override));
   MOCK_METHOD(void, StartRecord,
-              (const std::string& file_path, int64_t max_video_duration_ms),
+              (const std::string& file_path, int64_t max_video_duration_ms,
+               const VideoRecordSettings& settings),
               (override));
   MOCK_METHOD(void, StopRecord, (), (override));
+  MOCK_METHOD(void, PauseRecord, (), (override));
+  MOCK_METHOD(void, ResumeRecord, (), (override));
+  MOCK_METHOD(void, SetPictureRotation, (PhotoRotation rotation), (override));
   MOCK_METHOD(void, TakePicture, (const std::string& file_path), (override));
+  MOCK_METHOD(void, TakePictureData, (const PhotoSettings& settings),
+              (override));
+  MOCK_METHOD(void, TakePictureBurst,
+              (const std::vector<std::string>& file_paths), (override));
+  MOCK_METHOD(bool, StartImageStream, (ImageStreamFormat format), (override));
+  MOCK_METHOD(void, StopImageStream, (), (override));
+  MOCK_METHOD(void, OnImageStreamFrameReceived, (), (override));
 };
 
 // MockCameraPlugin extends CameraPlugin behaviour a bit to allow adding cameras
-// without creating them first with create message handler and mocking static
+// without creating them first with the Create API method and mocking static
 // system calls
 class MockCameraPlugin : public CameraPlugin {
  public:
@@ -277,12 +344,21 @@ class MockCameraPlugin : public CameraPlugin {
 
   MOCK_METHOD(bool, EnumerateVideoCaptureDeviceSources,
               (IMFActivate * **devices, UINT32* count), (override));
+  MOCK_METHOD(bool, EnumerateAudioCaptureDeviceSources,
+              (IMFActivate * **devices, UINT32* count), (override));
 
   // Helper to add camera without creating it via CameraFactory for testing
   // purposes
   void AddCamera(std::unique_ptr<Camera> camera) {
     cameras_.push_back(std::move(camera));
   }
+
+  // Helper to cache available cameras without observing device changes for
+  // testing purposes
+  void EnableAvailableCamerasCache() { cache_available_cameras_ = true; }
+
+  // Helper to simulate a camera being connected or disconnected
+  void NotifyCamerasChanged() { OnAvailableCamerasChanged(); }
 };
 
 class MockCaptureSource : public IMFCaptureSource {
@@ -547,6 +623,46 @@ class MockCapturePreviewSink : public IMFCapturePreviewSink {
     }
   }
 
+  // Sends a sample whose data is split evenly across |buffer_count| memory
+  // buffers, like samples of some camera drivers.
+  void SendFakeMultipleBufferSample(const uint8_t* src_buffer, uint32_t size,
+                                    uint32_t buffer_count) {
+    assert(sample_callback_);
+    assert(buffer_count > 0);
+    ComPtr<IMFSample> sample;
+    HRESULT hr = MFCreateSample(&sample);
+
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < buffer_count && SUCCEEDED(hr); i++) {
+      const uint32_t length =
+          i + 1 == buffer_count ? size - offset : size / buffer_count;
+      ComPtr<IMFMediaBuffer> buffer;
+      hr = MFCreateMemoryBuffer(length, &buffer);
+
+      if (SUCCEEDED(hr)) {
+        uint8_t* target_data;
+        if (SUCCEEDED(buffer->Lock(&target_data, nullptr, nullptr))) {
+          std::copy(src_buffer + offset, src_buffer + offset + length,
+                    target_data);
+        }
+        hr = buffer->Unlock();
+      }
+
+      if (SUCCEEDED(hr)) {
+        hr = buffer->SetCurrentLength(length);
+      }
+
+      if (SUCCEEDED(hr)) {
+        hr = sample->AddBuffer(buffer.Get());
+      }
+      offset += length;
+    }
+
+    if (SUCCEEDED(hr)) {
+      sample_callback_->OnSample(sample.Get());
+    }
+  }
+
   ComPtr<IMFCaptureEngineOnSampleCallback> sample_callback_;
 
  private:
@@ -686,6 +802,39 @@ class MockCapturePhotoSink : public IMFCapturePhotoSink {
     return E_NOINTERFACE;
   }
 
+  void SendFakeSample(const uint8_t* src_buffer, uint32_t size) {
+    assert(sample_callback_);
+    ComPtr<IMFSample> sample;
+    ComPtr<IMFMediaBuffer> buffer;
+    HRESULT hr = MFCreateSample(&sample);
+
+    if (SUCCEEDED(hr)) {
+      hr = MFCreateMemoryBuffer(size, &buffer);
+    }
+
+    if (SUCCEEDED(hr)) {
+      uint8_t* target_data;
+      if (SUCCEEDED(buffer->Lock(&target_data, nullptr, nullptr))) {
+        std::copy(src_buffer, src_buffer + size, target_data);
+      }
+      hr = buffer->Unlock();
+    }
+
+    if (SUCCEEDED(hr)) {
+      hr = buffer->SetCurrentLength(size);
+    }
+
+    if (SUCCEEDED(hr)) {
+      hr = sample->AddBuffer(buffer.Get());
+    }
+
+    if (SUCCEEDED(hr)) {
+      sample_callback_->OnSample(sample.Get());
+    }
+  }
+
+  ComPtr<IMFCaptureEngineOnSampleCallback> sample_callback_;
+
  private:
   ~MockCapturePhotoSink() = default;
   volatile ULONG ref_ = 0;
@@ -1025,6 +1174,84 @@ class MockCaptureEngine : public IMFCaptureEngine {
   bool initialized_ = false;
 };
 
+class MockSourceReader : public IMFSourceReader {
+ public:
+  MockSourceReader() {
+    // Keeps the media type set last, as the source reader returns it as its
+    // output media type.
+    ON_CALL(*this, SetCurrentMediaType)
+        .WillByDefault([this](DWORD stream_index, DWORD* reserved,
+                              IMFMediaType* media_type) -> HRESULT {
+          current_media_type_ = media_type;
+          return S_OK;
+        });
+    ON_CALL(*this, GetCurrentMediaType)
+        .WillByDefault(
+            [this](DWORD stream_index, IMFMediaType** media_type) -> HRESULT {
+              if (!current_media_type_) {
+                return MF_E_NOT_INITIALIZED;
+              }
+              return current_media_type_.CopyTo(media_type);
+            });
+  }
+
+  virtual ~MockSourceReader() = default;
+
+  MOCK_METHOD(HRESULT, GetStreamSelection,
+              (DWORD dwStreamIndex, BOOL* pfSelected));
+  MOCK_METHOD(HRESULT, SetStreamSelection,
+              (DWORD dwStreamIndex, BOOL fSelected));
+  MOCK_METHOD(HRESULT, GetNativeMediaType,
+              (DWORD dwStreamIndex, DWORD dwMediaTypeIndex,
+               IMFMediaType** ppMediaType));
+  MOCK_METHOD(HRESULT, GetCurrentMediaType,
+              (DWORD dwStreamIndex, IMFMediaType** ppMediaType));
+  MOCK_METHOD(HRESULT, SetCurrentMediaType,
+              (DWORD dwStreamIndex, DWORD* pdwReserved,
+               IMFMediaType* pMediaType));
+  MOCK_METHOD(HRESULT, SetCurrentPosition,
+              (REFGUID guidTimeFormat, REFPROPVARIANT varPosition));
+  MOCK_METHOD(HRESULT, ReadSample,
+              (DWORD dwStreamIndex, DWORD dwControlFlags,
+               DWORD* pdwActualStreamIndex, DWORD* pdwStreamFlags,
+               LONGLONG* pllTimestamp, IMFSample** ppSample));
+  MOCK_METHOD(HRESULT, Flush, (DWORD dwStreamIndex));
+  MOCK_METHOD(HRESULT, GetServiceForStream,
+              (DWORD dwStreamIndex, REFGUID guidService, REFIID riid,
+               LPVOID* ppvObject));
+  MOCK_METHOD(HRESULT, GetPresentationAttribute,
+              (DWORD dwStreamIndex, REFGUID guidAttribute,
+               PROPVARIANT* pvarAttribute));
+
+  // IUnknown
+  STDMETHODIMP_(ULONG) AddRef() { return InterlockedIncrement(&ref_); }
+
+  // IUnknown
+  STDMETHODIMP_(ULONG) Release() {
+    LONG ref = InterlockedDecrement(&ref_);
+    if (ref == 0) {
+      delete this;
+    }
+    return ref;
+  }
+
+  // IUnknown
+  STDMETHODIMP_(HRESULT) QueryInterface(const IID& riid, void** ppv) {
+    *ppv = nullptr;
+
+    if (riid == IID_IMFSourceReader) {
+      *ppv = static_cast<IMFSourceReader*>(this);
+      ((IUnknown*)*ppv)->AddRef();
+      return S_OK;
+    }
+
+    return E_NOINTERFACE;
+  }
+
+  ComPtr<IMFMediaType> current_media_type_;
+  volatile ULONG ref_ = 0;
+};
+
 #define MOCK_DEVICE_ID "mock_device_id"
 #define MOCK_CAMERA_NAME "mock_camera_name <" MOCK_DEVICE_ID ">"
 #define MOCK_INVALID_CAMERA_NAME "invalid_camera_name"
@@ -0,0 +1,288 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "pixel_conversion.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace camera_windows {
+
+namespace test {
+
+namespace {
+
+// Builds a source frame where every byte has a distinct, position-dependent
+// value so that swapped or misplaced channels are detected.
+std::vector<uint8_t> CreateSourceFrame(uint32_t width, uint32_t height) {
+  std::vector<uint8_t> frame(static_cast<size_t>(width) * height * 4);
+  for (size_t i = 0; i < frame.size(); i++) {
+    frame[i] = static_cast<uint8_t>((i * 7) + (i / 251));
+  }
+  return frame;
+}
+
+void ExpectPathMatchesScalar(PixelConversionPath path) {
+  if (!IsPixelConversionPathSupported(path)) {
+    GTEST_SKIP() << "Conversion path not supported by this CPU.";
+  }
+
+  // Widths cover full SIMD blocks and every possible remainder.
+  for (uint32_t width = 1; width <= 33; width++) {
+    const uint32_t height = 3;
+    std::vector<uint8_t> source = CreateSourceFrame(width, height);
+
+    for (bool mirror : {false, true}) {
+      std::vector<uint8_t> expected(source.size());
+      std::vector<uint8_t> actual(source.size());
+      ConvertRGB32ToRGBA(PixelConversionPath::kScalar, source.data(),
+                         expected.data(), width, height, mirror);
+      ConvertRGB32ToRGBA(path, source.data(), actual.data(), width, height,
+                         mirror);
+
+      EXPECT_EQ(actual, expected)
+          << "width: " << width << ", mirror: " << mirror;
+    }
+  }
+}
+
+// Returns a copy of the tightly packed RGBA |frame|, rotated clockwise by
+// |rotation|.
+std::vector<uint8_t> RotateFrame(const std::vector<uint8_t>& frame,
+                                 uint32_t width, uint32_t height,
+                                 PreviewRotation rotation) {
+  const bool quarter_turn = IsQuarterTurn(rotation);
+  const uint32_t rotated_width = quarter_turn ? height : width;
+  const uint32_t rotated_height = quarter_turn ? width : height;
+  std::vector<uint8_t> rotated(frame.size());
+  for (uint32_t y = 0; y < rotated_height; y++) {
+    for (uint32_t x = 0; x < rotated_width; x++) {
+      uint32_t source_x = x;
+      uint32_t source_y = y;
+      switch (rotation) {
+        case PreviewRotation::kRotate90:
+          source_x = y;
+          source_y = height - 1 - x;
+          break;
+        case PreviewRotation::kRotate180:
+          source_x = width - 1 - x;
+          source_y = height - 1 - y;
+          break;
+        case PreviewRotation::kRotate270:
+          source_x = width - 1 - y;
+          source_y = x;
+          break;
+        case PreviewRotation::kNone:
+          break;
+      }
+      for (size_t channel = 0; channel < 4; channel++) {
+        rotated[(y * rotated_width + x) * 4 + channel] =
+            frame[(source_y * width + source_x) * 4 + channel];
+      }
+    }
+  }
+  return rotated;
+}
+
+// Returns the tightly packed rows of a frame written with |dst_stride|.
+std::vector<uint8_t> RemoveRowPadding(const std::vector<uint8_t>& padded,
+                                      size_t row_size, size_t dst_stride,
+                                      size_t row_count) {
+  std::vector<uint8_t> rows;
+  for (size_t row = 0; row < row_count; row++) {
+    rows.insert(rows.end(), padded.begin() + row * dst_stride,
+                padded.begin() + row * dst_stride + row_size);
+  }
+  return rows;
+}
+
+}  // namespace
+
+TEST(PixelConversion, ScalarSwapsChannelsAndSetsAlpha) {
+  // Two pixels in MFVideoFormat_RGB32 order: b, g, r, x.
+  std::vector<uint8_t> source = {0x33, 0x22, 0x11, 0x00,
+                                 0x66, 0x55, 0x44, 0x00};
+  std::vector<uint8_t> dest(source.size());
+
+  ConvertRGB32ToRGBA(PixelConversionPath::kScalar, source.data(), dest.data(),
+                     2, 1, false);
+
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x11, 0x22, 0x33, 0xFF, 0x44, 0x55, 0x66, 0xFF}));
+}
+
+TEST(PixelConversion, ScalarMirrorsRows) {
+  std::vector<uint8_t> source = {0x33, 0x22, 0x11, 0x00,
+                                 0x66, 0x55, 0x44, 0x00};
+  std::vector<uint8_t> dest(source.size());
+
+  ConvertRGB32ToRGBA(PixelConversionPath::kScalar, source.data(), dest.data(),
+                     2, 1, true);
+
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x44, 0x55, 0x66, 0xFF, 0x11, 0x22, 0x33, 0xFF}));
+}
+
+TEST(PixelConversion, HandlesPaddedAndBottomUpRows) {
+  // Two rows of one pixel each, with four bytes of padding after each row.
+  std::vector<uint8_t> source = {0x33, 0x22, 0x11, 0x00, 0xEE, 0xEE,
+                                 0xEE, 0xEE, 0x66, 0x55, 0x44, 0x00,
+                                 0xEE, 0xEE, 0xEE, 0xEE};
+  std::vector<uint8_t> dest(8);
+
+  ConvertRGB32ToRGBA(source.data(), 8, dest.data(), 1, 2, false);
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x11, 0x22, 0x33, 0xFF, 0x44, 0x55, 0x66, 0xFF}));
+
+  // A negative stride starts at the last row in memory.
+  ConvertRGB32ToRGBA(source.data() + 8, -8, dest.data(), 1, 2, false);
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x44, 0x55, 0x66, 0xFF, 0x11, 0x22, 0x33, 0xFF}));
+}
+
+TEST(PixelConversion, ConvertsToNV12) {
+  // 3x1 red frame, so the last chroma sample repeats the edge pixel.
+  std::vector<uint8_t> source = {0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+                                 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00};
+  std::vector<uint8_t> y_plane(3);
+  std::vector<uint8_t> uv_plane(GetNV12UVPlaneRowSize(3) *
+                                GetNV12UVPlaneHeight(1));
+
+  ConvertRGB32ToNV12(source.data(), 12, y_plane.data(), uv_plane.data(), 3, 1);
+
+  EXPECT_EQ(y_plane, std::vector<uint8_t>({82, 82, 82}));
+  EXPECT_EQ(uv_plane, std::vector<uint8_t>({90, 240, 90, 240}));
+}
+
+TEST(PixelConversion, ConvertsFromNV12) {
+  // 1x2 red frame with padded luma rows, sharing a single chroma sample pair.
+  std::vector<uint8_t> y_plane = {82, 0xEE, 82, 0xEE};
+  std::vector<uint8_t> uv_plane = {90, 240};
+  std::vector<uint8_t> dest(8);
+
+  ConvertNV12ToRGBA(y_plane.data(), 2, uv_plane.data(), 2, dest.data(), 1, 2,
+                    false);
+  EXPECT_EQ(dest, std::vector<uint8_t>({255, 1, 0, 255, 255, 1, 0, 255}));
+
+  ConvertNV12ToBGRA(y_plane.data(), 2, uv_plane.data(), 2, dest.data(), 1, 2);
+  EXPECT_EQ(dest, std::vector<uint8_t>({0, 1, 255, 255, 0, 1, 255, 255}));
+}
+
+TEST(PixelConversion, ConvertsFromNV12Mirrored) {
+  // 2x1 frame of black and white with neutral chroma.
+  std::vector<uint8_t> y_plane = {16, 235};
+  std::vector<uint8_t> uv_plane = {128, 128};
+  std::vector<uint8_t> dest(8);
+
+  ConvertNV12ToRGBA(y_plane.data(), 2, uv_plane.data(), 2, dest.data(), 2, 1,
+                    false);
+  EXPECT_EQ(dest, std::vector<uint8_t>({0, 0, 0, 255, 255, 255, 255, 255}));
+
+  ConvertNV12ToRGBA(y_plane.data(), 2, uv_plane.data(), 2, dest.data(), 2, 1,
+                    true);
+  EXPECT_EQ(dest, std::vector<uint8_t>({255, 255, 255, 255, 0, 0, 0, 255}));
+}
+
+TEST(PixelConversion, RotatesSmallFrames) {
+  // Two pixels in MFVideoFormat_RGB32 order: b, g, r, x.
+  std::vector<uint8_t> source = {0x33, 0x22, 0x11, 0x00,
+                                 0x66, 0x55, 0x44, 0x00};
+  const std::vector<uint8_t> first = {0x11, 0x22, 0x33, 0xFF};
+  const std::vector<uint8_t> second = {0x44, 0x55, 0x66, 0xFF};
+  std::vector<uint8_t> dest(8);
+
+  // A 2x1 frame turned clockwise becomes a 1x2 frame starting with its left
+  // pixel.
+  ConvertRGB32ToRGBA(source.data(), 8, dest.data(), 4, 2, 1, false,
+                     PreviewRotation::kRotate90);
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x11, 0x22, 0x33, 0xFF, 0x44, 0x55, 0x66, 0xFF}));
+
+  ConvertRGB32ToRGBA(source.data(), 8, dest.data(), 4, 2, 1, false,
+                     PreviewRotation::kRotate270);
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x44, 0x55, 0x66, 0xFF, 0x11, 0x22, 0x33, 0xFF}));
+
+  // The frame is mirrored before it is rotated.
+  ConvertRGB32ToRGBA(source.data(), 8, dest.data(), 4, 2, 1, true,
+                     PreviewRotation::kRotate90);
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x44, 0x55, 0x66, 0xFF, 0x11, 0x22, 0x33, 0xFF}));
+
+  ConvertRGB32ToRGBA(source.data(), 8, dest.data(), 8, 2, 1, true,
+                     PreviewRotation::kRotate180);
+  EXPECT_EQ(dest, std::vector<uint8_t>(
+                      {0x11, 0x22, 0x33, 0xFF, 0x44, 0x55, 0x66, 0xFF}));
+}
+
+TEST(PixelConversion, RotatedConversionMatchesRotatedFrame) {
+  // Sizes cover partial rotation tiles and SIMD remainders.
+  for (uint32_t width : {1u, 6u, 17u}) {
+    for (uint32_t height : {2u, 9u, 20u}) {
+      std::vector<uint8_t> source = CreateSourceFrame(width, height);
+      // NV12 planes of the same size, with a distinct value per sample.
+      std::vector<uint8_t> y_plane(source.begin(),
+                                   source.begin() + width * height);
+      const uint32_t uv_row_size = GetNV12UVPlaneRowSize(width);
+      std::vector<uint8_t> uv_plane(
+          source.end() - uv_row_size * GetNV12UVPlaneHeight(height),
+          source.end());
+
+      for (bool mirror : {false, true}) {
+        std::vector<uint8_t> rgb32(source.size());
+        std::vector<uint8_t> nv12(source.size());
+        ConvertRGB32ToRGBA(PixelConversionPath::kScalar, source.data(),
+                           rgb32.data(), width, height, mirror);
+        ConvertNV12ToRGBA(y_plane.data(), width, uv_plane.data(),
+                          uv_row_size, nv12.data(), width, height, mirror);
+
+        for (PreviewRotation rotation :
+             {PreviewRotation::kNone, PreviewRotation::kRotate90,
+              PreviewRotation::kRotate180, PreviewRotation::kRotate270}) {
+          SCOPED_TRACE(testing::Message()
+                       << width << "x" << height << ", mirror: " << mirror
+                       << ", rotation: " << static_cast<int>(rotation));
+          const bool quarter_turn = IsQuarterTurn(rotation);
+          const size_t row_size = (quarter_turn ? height : width) * 4;
+          const size_t row_count = quarter_turn ? width : height;
+          // Destination rows are padded by a pixel.
+          const size_t dst_stride = row_size + 4;
+          std::vector<uint8_t> actual(dst_stride * row_count);
+
+          ConvertRGB32ToRGBA(source.data(), width * 4, actual.data(),
+                             static_cast<int32_t>(dst_stride), width, height,
+                             mirror, rotation);
+          EXPECT_EQ(
+              RemoveRowPadding(actual, row_size, dst_stride, row_count),
+              RotateFrame(rgb32, width, height, rotation));
+
+          ConvertNV12ToRGBA(y_plane.data(), width, uv_plane.data(),
+                            uv_row_size, actual.data(),
+                            static_cast<int32_t>(dst_stride), width, height,
+                            mirror, rotation);
+          EXPECT_EQ(
+              RemoveRowPadding(actual, row_size, dst_stride, row_count),
+              RotateFrame(nv12, width, height, rotation));
+        }
+      }
+    }
+  }
+}
+
+TEST(PixelConversion, SSSE3MatchesScalar) {
+  ExpectPathMatchesScalar(PixelConversionPath::kSSSE3);
+}
+
+TEST(PixelConversion, AVX2MatchesScalar) {
+  ExpectPathMatchesScalar(PixelConversionPath::kAVX2);
+}
+
+TEST(PixelConversion, PreferredPathIsSupported) {
+  EXPECT_TRUE(
+      IsPixelConversionPathSupported(GetPreferredPixelConversionPath()));
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,108 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "platform_thread_dispatcher.h"
+
+#include <gtest/gtest.h>
+#include <windows.h>
+
+#include <thread>
+#include <vector>
+
+namespace camera_windows {
+
+namespace test {
+
+namespace {
+
+// Message posted by the dispatcher in the tests.
+constexpr UINT kTasksMessage = WM_APP + 1;
+
+// Returns the number of |kTasksMessage| messages queued for |window|, and
+// removes them from the message queue.
+int TakeTasksMessages(HWND window) {
+  int count = 0;
+  MSG msg;
+  while (PeekMessage(&msg, window, kTasksMessage, kTasksMessage, PM_REMOVE)) {
+    count++;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(PlatformThreadDispatcher, RunsTasksImmediatelyWithoutWindow) {
+  PlatformThreadDispatcher dispatcher;
+  bool run = false;
+
+  std::thread thread(
+      [&]() { dispatcher.Post(nullptr, [&run]() { run = true; }); });
+  thread.join();
+
+  EXPECT_TRUE(run);
+}
+
+TEST(PlatformThreadDispatcher, QueuesTasksPostedFromOtherThreads) {
+  HWND window = CreateWindowEx(0, L"STATIC", L"", 0, 0, 0, 0, 0, HWND_MESSAGE,
+                               nullptr, nullptr, nullptr);
+  ASSERT_TRUE(window);
+
+  PlatformThreadDispatcher dispatcher;
+  dispatcher.SetWindow(window, kTasksMessage);
+  std::vector<int> order;
+
+  std::thread thread([&]() {
+    for (int i = 0; i < 3; i++) {
+      dispatcher.Post(nullptr, [&order, i]() { order.push_back(i); });
+    }
+  });
+  thread.join();
+
+  EXPECT_TRUE(order.empty());
+  // A single message is posted for the batch.
+  EXPECT_EQ(TakeTasksMessages(window), 1);
+
+  dispatcher.RunPendingTasks();
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+
+  // Tasks posted on the platform thread run immediately once the queue is
+  // empty.
+  dispatcher.Post(nullptr, [&order]() { order.push_back(3); });
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3}));
+  EXPECT_EQ(TakeTasksMessages(window), 0);
+
+  dispatcher.SetWindow(nullptr, 0);
+  DestroyWindow(window);
+}
+
+TEST(PlatformThreadDispatcher, CancelDiscardsTasksOfOwner) {
+  HWND window = CreateWindowEx(0, L"STATIC", L"", 0, 0, 0, 0, 0, HWND_MESSAGE,
+                               nullptr, nullptr, nullptr);
+  ASSERT_TRUE(window);
+
+  PlatformThreadDispatcher dispatcher;
+  dispatcher.SetWindow(window, kTasksMessage);
+  int owner_a = 0;
+  int owner_b = 0;
+  std::vector<int> order;
+
+  std::thread thread([&]() {
+    dispatcher.Post(&owner_a, [&order]() { order.push_back(0); });
+    dispatcher.Post(&owner_b, [&order]() { order.push_back(1); });
+    dispatcher.Post(&owner_a, [&order]() { order.push_back(2); });
+  });
+  thread.join();
+
+  dispatcher.Cancel(&owner_a);
+  dispatcher.RunPendingTasks();
+
+  EXPECT_EQ(order, std::vector<int>({1}));
+
+  TakeTasksMessages(window);
+  dispatcher.SetWindow(nullptr, 0);
+  DestroyWindow(window);
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,113 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_crop.h"
+
+#include <gtest/gtest.h>
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(PreviewCrop, ReturnsFullFrameWithoutCrop) {
+  PixelRect rect =
+      GetPreviewSourceRect(641, 481, PreviewCropRect(), 1.0, false);
+
+  EXPECT_EQ(rect.x, 0u);
+  EXPECT_EQ(rect.y, 0u);
+  EXPECT_EQ(rect.width, 641u);
+  EXPECT_EQ(rect.height, 481u);
+}
+
+TEST(PreviewCrop, ZoomNarrowsCropAroundItsCenter) {
+  PixelRect rect =
+      GetPreviewSourceRect(3840, 2160, PreviewCropRect(), 2.0, false);
+
+  EXPECT_EQ(rect.x, 960u);
+  EXPECT_EQ(rect.y, 540u);
+  EXPECT_EQ(rect.width, 1920u);
+  EXPECT_EQ(rect.height, 1080u);
+}
+
+TEST(PreviewCrop, MirrorsCropRect) {
+  PreviewCropRect crop;
+  crop.left = 0.1;
+  crop.width = 0.4;
+
+  PixelRect rect = GetPreviewSourceRect(1000, 500, crop, 1.0, true);
+
+  EXPECT_EQ(rect.x, 500u);
+  EXPECT_EQ(rect.width, 400u);
+  EXPECT_EQ(rect.height, 500u);
+}
+
+TEST(PreviewCrop, RotatesCropRectBackToFrame) {
+  // Top left quarter of the displayed preview.
+  PreviewCropRect crop;
+  crop.width = 0.5;
+  crop.height = 0.5;
+
+  // Turned clockwise, the top left of the preview is the bottom left of the
+  // frame.
+  PixelRect rect = GetPreviewSourceRect(1000, 500, crop, 1.0, false,
+                                        PreviewRotation::kRotate90);
+  EXPECT_EQ(rect.x, 0u);
+  EXPECT_EQ(rect.y, 250u);
+  EXPECT_EQ(rect.width, 500u);
+  EXPECT_EQ(rect.height, 250u);
+
+  rect = GetPreviewSourceRect(1000, 500, crop, 1.0, false,
+                              PreviewRotation::kRotate180);
+  EXPECT_EQ(rect.x, 500u);
+  EXPECT_EQ(rect.y, 250u);
+
+  rect = GetPreviewSourceRect(1000, 500, crop, 1.0, false,
+                              PreviewRotation::kRotate270);
+  EXPECT_EQ(rect.x, 500u);
+  EXPECT_EQ(rect.y, 0u);
+
+  // Mirroring applies to the frame, before it is rotated.
+  rect = GetPreviewSourceRect(1000, 500, crop, 1.0, true,
+                              PreviewRotation::kRotate90);
+  EXPECT_EQ(rect.x, 500u);
+  EXPECT_EQ(rect.y, 250u);
+}
+
+TEST(PreviewCrop, KeepsRegionEvenAndInsideFrame) {
+  PreviewCropRect crop;
+  crop.left = 0.5;
+  crop.top = 0.5;
+  crop.width = 0.5;
+  crop.height = 0.5;
+
+  PixelRect rect = GetPreviewSourceRect(7, 7, crop, 1.0, false);
+
+  EXPECT_EQ(rect.x % 2, 0u);
+  EXPECT_EQ(rect.y % 2, 0u);
+  EXPECT_EQ(rect.width % 2, 0u);
+  EXPECT_EQ(rect.height % 2, 0u);
+  EXPECT_LE(rect.x + rect.width, 7u);
+  EXPECT_LE(rect.y + rect.height, 7u);
+}
+
+TEST(PreviewCrop, ValidatesCropRectAndZoomLevel) {
+  PreviewCropRect crop;
+  EXPECT_TRUE(IsValidPreviewCropRect(crop));
+
+  crop.left = 0.75;
+  crop.width = 0.5;
+  EXPECT_FALSE(IsValidPreviewCropRect(crop));
+
+  crop.left = 0.0;
+  crop.width = 0.0;
+  EXPECT_FALSE(IsValidPreviewCropRect(crop));
+
+  EXPECT_TRUE(IsValidPreviewZoomLevel(kMinPreviewZoomLevel));
+  EXPECT_TRUE(IsValidPreviewZoomLevel(kMaxPreviewZoomLevel));
+  EXPECT_FALSE(IsValidPreviewZoomLevel(0.5));
+  EXPECT_FALSE(IsValidPreviewZoomLevel(kMaxPreviewZoomLevel + 1.0));
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,146 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_frame_throttle.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace camera_windows {
+
+namespace test {
+
+namespace {
+
+// Returns the number of frames delivered out of |frame_count| frames
+// captured at |camera_frame_rate|.
+int CountDeliveredFrames(PreviewFrameThrottle& throttle,
+                         double camera_frame_rate, int frame_count) {
+  int delivered = 0;
+  for (int i = 0; i < frame_count; i++) {
+    const auto capture_time_us =
+        static_cast<uint64_t>(i * 1e6 / camera_frame_rate);
+    if (throttle.ShouldDeliverFrame(capture_time_us)) {
+      delivered++;
+    }
+  }
+  return delivered;
+}
+
+}  // namespace
+
+TEST(PreviewFrameThrottle, DeliversAllFramesByDefault) {
+  PreviewFrameThrottle throttle;
+
+  EXPECT_FALSE(throttle.IsPaused());
+  EXPECT_EQ(CountDeliveredFrames(throttle, 30.0, 90), 90);
+}
+
+TEST(PreviewFrameThrottle, LimitsFramesToTargetFrameRate) {
+  PreviewFrameThrottle throttle;
+  throttle.SetTargetFrameRate(15.0);
+
+  EXPECT_EQ(CountDeliveredFrames(throttle, 30.0, 90), 45);
+}
+
+TEST(PreviewFrameThrottle, KeepsAverageRateForUnevenRatios) {
+  PreviewFrameThrottle throttle;
+  throttle.SetTargetFrameRate(20.0);
+
+  EXPECT_EQ(CountDeliveredFrames(throttle, 30.0, 90), 60);
+}
+
+TEST(PreviewFrameThrottle, DeliversJitteredFramesAtTargetFrameRate) {
+  PreviewFrameThrottle throttle;
+  throttle.SetTargetFrameRate(15.0);
+
+  int delivered = 0;
+  for (int i = 0; i < 90; i++) {
+    // Capture times alternate 2 ms around a 30 fps schedule.
+    const uint64_t capture_time_us = i * 33333 + (i % 2 ? 0 : 2000);
+    if (throttle.ShouldDeliverFrame(capture_time_us)) {
+      delivered++;
+    }
+  }
+  EXPECT_EQ(delivered, 45);
+}
+
+TEST(PreviewFrameThrottle, LimitsFramesToMaxFrameRate) {
+  PreviewFrameThrottle throttle;
+  throttle.SetMaxFrameRate(30.0);
+
+  EXPECT_EQ(CountDeliveredFrames(throttle, 60.0, 180), 90);
+}
+
+TEST(PreviewFrameThrottle, UsesLowerOfTargetAndMaxFrameRates) {
+  PreviewFrameThrottle throttle;
+  throttle.SetMaxFrameRate(30.0);
+  throttle.SetTargetFrameRate(60.0);
+
+  EXPECT_EQ(CountDeliveredFrames(throttle, 60.0, 180), 90);
+
+  throttle.SetTargetFrameRate(15.0);
+
+  EXPECT_EQ(CountDeliveredFrames(throttle, 60.0, 180), 45);
+}
+
+TEST(PreviewFrameThrottle, IgnoresMaxFrameRateOfZero) {
+  PreviewFrameThrottle throttle;
+  throttle.SetMaxFrameRate(0.0);
+
+  EXPECT_FALSE(throttle.IsPaused());
+  EXPECT_EQ(CountDeliveredFrames(throttle, 30.0, 90), 90);
+}
+
+TEST(PreviewFrameThrottle, DeliversAllFramesBelowTargetFrameRate) {
+  PreviewFrameThrottle throttle;
+  throttle.SetTargetFrameRate(60.0);
+
+  EXPECT_EQ(CountDeliveredFrames(throttle, 30.0, 90), 90);
+}
+
+TEST(PreviewFrameThrottle, PausesAtZeroFrameRate) {
+  PreviewFrameThrottle throttle;
+  throttle.SetTargetFrameRate(0.0);
+
+  EXPECT_TRUE(throttle.IsPaused());
+  EXPECT_EQ(CountDeliveredFrames(throttle, 30.0, 90), 0);
+}
+
+TEST(PreviewFrameThrottle, PausesWhileHidden) {
+  PreviewFrameThrottle throttle;
+  throttle.SetHidden(true);
+
+  EXPECT_TRUE(throttle.IsPaused());
+  EXPECT_FALSE(throttle.ShouldDeliverFrame(0));
+
+  throttle.SetHidden(false);
+
+  EXPECT_FALSE(throttle.IsPaused());
+  EXPECT_TRUE(throttle.ShouldDeliverFrame(33333));
+}
+
+TEST(PreviewFrameThrottle, DeliversNextFrameAfterFrameRateChange) {
+  PreviewFrameThrottle throttle;
+  throttle.SetTargetFrameRate(1.0);
+  EXPECT_TRUE(throttle.ShouldDeliverFrame(0));
+  EXPECT_FALSE(throttle.ShouldDeliverFrame(33333));
+
+  throttle.SetTargetFrameRate(std::nullopt);
+
+  EXPECT_TRUE(throttle.ShouldDeliverFrame(66666));
+}
+
+TEST(PreviewFrameThrottle, RestartsScheduleWhenCaptureTimeGoesBack) {
+  PreviewFrameThrottle throttle;
+  throttle.SetTargetFrameRate(10.0);
+  EXPECT_TRUE(throttle.ShouldDeliverFrame(10000000));
+
+  EXPECT_TRUE(throttle.ShouldDeliverFrame(0));
+  EXPECT_FALSE(throttle.ShouldDeliverFrame(33333));
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,111 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_stats.h"
+
+#include <gtest/gtest.h>
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(PreviewStats, SnapshotIsEmptyWithoutFrames) {
+  PreviewStats stats;
+  PreviewStatsSnapshot snapshot = stats.GetSnapshot();
+
+  EXPECT_EQ(snapshot.received_frame_count, 0u);
+  EXPECT_EQ(snapshot.rendered_frame_count, 0u);
+  EXPECT_EQ(snapshot.dropped_frame_count, 0u);
+  EXPECT_EQ(snapshot.capture_frame_rate, 0.0);
+  EXPECT_EQ(snapshot.latency_p50_us, 0u);
+}
+
+TEST(PreviewStats, KeepsFrameIdOfSampleDeliveredTwice) {
+  PreviewStats stats;
+
+  uint64_t frame_id = stats.OnFrameReceived(1000, 10);
+  EXPECT_EQ(stats.OnFrameReceived(1000, 20), frame_id);
+  EXPECT_EQ(stats.OnFrameReceived(2000, 30), frame_id + 1);
+  EXPECT_EQ(stats.GetLastReceivedFrameId(), frame_id + 1);
+}
+
+TEST(PreviewStats, AggregatesLatencyAndFrameRate) {
+  PreviewStats stats;
+
+  // 100 frames at 50 fps, released 1 to 100 ms after they are received.
+  for (uint64_t i = 0; i < 100; i++) {
+    const uint64_t received_time = 1000000 + i * 20000;
+    uint64_t frame_id = stats.OnFrameReceived(i * 20000, received_time);
+    stats.OnFrameRendered(frame_id, received_time + 500);
+    stats.OnFrameReleased(frame_id, received_time + (i + 1) * 1000);
+  }
+
+  PreviewStatsSnapshot snapshot = stats.GetSnapshot();
+  EXPECT_EQ(snapshot.received_frame_count, 100u);
+  EXPECT_EQ(snapshot.rendered_frame_count, 100u);
+  EXPECT_EQ(snapshot.dropped_frame_count, 0u);
+  EXPECT_DOUBLE_EQ(snapshot.capture_frame_rate, 50.0);
+  EXPECT_DOUBLE_EQ(snapshot.render_frame_rate, 50.0);
+  EXPECT_EQ(snapshot.latency_p50_us, 50000u);
+  EXPECT_EQ(snapshot.latency_p95_us, 95000u);
+  EXPECT_EQ(snapshot.latency_p99_us, 99000u);
+}
+
+TEST(PreviewStats, AggregatesConversionTimes) {
+  PreviewStats stats;
+
+  // The oldest conversions fall out of the window.
+  for (uint64_t i = 0; i < PreviewStats::kFrameWindowSize; i++) {
+    stats.OnFrameConverted(1000000);
+  }
+  for (uint64_t i = 1; i <= PreviewStats::kFrameWindowSize; i++) {
+    stats.OnFrameConverted(i * 10);
+  }
+
+  PreviewStatsSnapshot snapshot = stats.GetSnapshot();
+  EXPECT_EQ(snapshot.conversion_p50_us, 1200u);
+  EXPECT_EQ(snapshot.conversion_p95_us, 2280u);
+  EXPECT_EQ(snapshot.conversion_p99_us, 2380u);
+}
+
+TEST(PreviewStats, CountsFramesNeverRenderedAsDropped) {
+  PreviewStats stats;
+
+  for (uint64_t i = 1; i <= 3; i++) {
+    stats.OnFrameReceived(i * 1000, i * 1000);
+  }
+  stats.OnFrameRendered(3, 4000);
+  stats.OnFrameReleased(3, 5000);
+
+  // Rendering the same frame again is not counted.
+  stats.OnFrameRendered(3, 6000);
+  stats.OnFrameReleased(3, 7000);
+
+  PreviewStatsSnapshot snapshot = stats.GetSnapshot();
+  EXPECT_EQ(snapshot.received_frame_count, 3u);
+  EXPECT_EQ(snapshot.rendered_frame_count, 1u);
+  EXPECT_EQ(snapshot.dropped_frame_count, 2u);
+  EXPECT_EQ(snapshot.latency_p50_us, 2000u);
+  EXPECT_EQ(snapshot.latency_p99_us, 2000u);
+}
+
+TEST(PreviewStats, IgnoresFramesOutsideWindow) {
+  PreviewStats stats;
+
+  uint64_t first_frame_id = stats.OnFrameReceived(0, 1);
+  for (uint64_t i = 1; i <= PreviewStats::kFrameWindowSize; i++) {
+    stats.OnFrameReceived(i * 1000, i * 1000);
+  }
+
+  // The record of the first frame has been overwritten.
+  stats.OnFrameRendered(first_frame_id, 500000);
+  stats.OnFrameReleased(first_frame_id, 600000);
+
+  PreviewStatsSnapshot snapshot = stats.GetSnapshot();
+  EXPECT_EQ(snapshot.rendered_frame_count, 1u);
+  EXPECT_EQ(snapshot.latency_p50_us, 0u);
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "record_chunk_stream.h"
+
+#include <gtest/gtest.h>
+#include <mfapi.h>
+#include <mfidl.h>
+#include <wrl/client.h>
+
+#include <utility>
+#include <vector>
+
+namespace camera_windows {
+
+namespace test {
+
+using Microsoft::WRL::ComPtr;
+
+namespace {
+
+struct Chunk {
+  uint64_t offset;
+  std::vector<uint8_t> bytes;
+};
+
+}  // namespace
+
+TEST(RecordChunkStream, PassesWrittenChunksWithOffsets) {
+  ASSERT_TRUE(SUCCEEDED(MFStartup(MF_VERSION)));
+
+  ComPtr<IMFByteStream> file;
+  ASSERT_TRUE(SUCCEEDED(MFCreateTempFile(MF_ACCESSMODE_READWRITE,
+                                         MF_OPENMODE_DELETE_IF_EXIST,
+                                         MF_FILEFLAGS_NONE, &file)));
+
+  std::vector<Chunk> chunks;
+  ComPtr<RecordChunkStream> stream = new RecordChunkStream(
+      file.Get(), [&chunks](uint64_t offset, const uint8_t* data,
+                            uint32_t size) {
+        chunks.push_back({offset, std::vector<uint8_t>(data, data + size)});
+      });
+
+  const uint8_t header[] = {1, 2, 3};
+  const uint8_t fragment[] = {4, 5};
+  const uint8_t rewrite[] = {9};
+  ULONG written = 0;
+  EXPECT_TRUE(SUCCEEDED(stream->Write(header, 3, &written)));
+  EXPECT_TRUE(SUCCEEDED(stream->Write(fragment, 2, &written)));
+
+  // Rewritten data is passed at its offset.
+  QWORD position = 0;
+  EXPECT_TRUE(SUCCEEDED(stream->Seek(msoBegin, 1, 0, &position)));
+  EXPECT_TRUE(SUCCEEDED(stream->Write(rewrite, 1, &written)));
+
+  ASSERT_EQ(chunks.size(), 3u);
+  EXPECT_EQ(chunks[0].offset, 0u);
+  EXPECT_EQ(chunks[0].bytes, std::vector<uint8_t>({1, 2, 3}));
+  EXPECT_EQ(chunks[1].offset, 3u);
+  EXPECT_EQ(chunks[1].bytes, std::vector<uint8_t>({4, 5}));
+  EXPECT_EQ(chunks[2].offset, 1u);
+  EXPECT_EQ(chunks[2].bytes, std::vector<uint8_t>({9}));
+
+  // The data is written to the wrapped stream.
+  QWORD length = 0;
+  EXPECT_TRUE(SUCCEEDED(file->GetLength(&length)));
+  EXPECT_EQ(length, 5u);
+
+  // Detached streams keep writing without passing chunks.
+  stream->Detach();
+  EXPECT_TRUE(SUCCEEDED(stream->Write(fragment, 2, &written)));
+  EXPECT_EQ(chunks.size(), 3u);
+
+  stream = nullptr;
+  file->Close();
+  file = nullptr;
+  MFShutdown();
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,46 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "record_handler.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(RecordHandler, ProxyFilePathAppendsSuffixToFileName) {
+  EXPECT_EQ(GetProxyFilePath("C:\\Videos\\VideoCapture_1.mp4"),
+            "C:\\Videos\\VideoCapture_1_proxy.mp4");
+  EXPECT_EQ(GetProxyFilePath("C:\\Videos.old\\VideoCapture"),
+            "C:\\Videos.old\\VideoCapture_proxy");
+}
+
+TEST(RecordHandler, ProxyFrameSizeKeepsAspectRatio) {
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  GetProxyFrameSize(1920, 1080, 360, &width, &height);
+  EXPECT_EQ(width, 640u);
+  EXPECT_EQ(height, 360u);
+
+  // 853.3 pixels wide, rounded down to an even width.
+  GetProxyFrameSize(1280, 720, 480, &width, &height);
+  EXPECT_EQ(width, 852u);
+  EXPECT_EQ(height, 480u);
+}
+
+TEST(RecordHandler, ProxyFrameSizeIsNotLargerThanRecording) {
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  GetProxyFrameSize(640, 480, 720, &width, &height);
+  EXPECT_EQ(width, 640u);
+  EXPECT_EQ(height, 480u);
+}
+
+}  // namespace test
+}  // namespace camera_windows
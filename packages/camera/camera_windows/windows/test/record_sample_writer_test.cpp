@@ -0,0 +1,149 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "record_sample_writer.h"
+
+#include <gtest/gtest.h>
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(RecordTimeline, StartsAtFirstVideoKeyFrame) {
+  RecordTimeline timeline;
+  int64_t output_time = -1;
+
+  EXPECT_FALSE(timeline.MapSampleTime(false, true, 1000, 100, &output_time));
+  EXPECT_FALSE(timeline.MapSampleTime(true, false, 1000, 100, &output_time));
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 5000, 100, &output_time));
+  EXPECT_EQ(output_time, 0);
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 5100, 100, &output_time));
+  EXPECT_EQ(output_time, 100);
+  ASSERT_TRUE(timeline.MapSampleTime(false, true, 5050, 20, &output_time));
+  EXPECT_EQ(output_time, 50);
+
+  // Audio captured before the first keyframe is dropped.
+  EXPECT_FALSE(timeline.MapSampleTime(false, true, 4990, 20, &output_time));
+}
+
+TEST(RecordTimeline, LeavesOutPausedTime) {
+  RecordTimeline timeline;
+  int64_t output_time = -1;
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 1000, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 1100, 100, &output_time));
+
+  timeline.Pause();
+  EXPECT_TRUE(timeline.IsPaused());
+  EXPECT_FALSE(timeline.MapSampleTime(true, true, 1200, 100, &output_time));
+
+  timeline.Resume();
+  EXPECT_FALSE(timeline.IsPaused());
+
+  // The resumed segment waits for a keyframe and continues where the
+  // previous segment ended.
+  EXPECT_FALSE(timeline.MapSampleTime(true, false, 9000, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 9100, 100, &output_time));
+  EXPECT_EQ(output_time, 200);
+  ASSERT_TRUE(timeline.MapSampleTime(false, true, 9150, 20, &output_time));
+  EXPECT_EQ(output_time, 250);
+  EXPECT_FALSE(timeline.MapSampleTime(false, true, 9050, 20, &output_time));
+}
+
+TEST(RecordTimeline, ResumesAfterLastAudioSample) {
+  RecordTimeline timeline;
+  int64_t output_time = -1;
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 0, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(false, true, 50, 100, &output_time));
+
+  timeline.Pause();
+  timeline.Resume();
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 1000, 100, &output_time));
+  EXPECT_EQ(output_time, 150);
+}
+
+TEST(RecordTimeline, ResumeWithoutPauseKeepsTimeline) {
+  RecordTimeline timeline;
+  int64_t output_time = -1;
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 1000, 100, &output_time));
+  timeline.Resume();
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 1100, 100, &output_time));
+  EXPECT_EQ(output_time, 100);
+}
+
+TEST(RecordTimeline, DropsSamplesAfterMaxDuration) {
+  RecordTimeline timeline;
+  timeline.SetMaxDuration(250);
+  int64_t output_time = -1;
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 1000, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 1100, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 1200, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(false, true, 1240, 20, &output_time));
+  EXPECT_FALSE(timeline.HasReachedMaxDuration());
+
+  EXPECT_FALSE(timeline.MapSampleTime(false, true, 1260, 20, &output_time));
+  EXPECT_FALSE(timeline.HasReachedMaxDuration());
+  EXPECT_FALSE(timeline.MapSampleTime(true, false, 1300, 100, &output_time));
+  EXPECT_TRUE(timeline.HasReachedMaxDuration());
+
+  EXPECT_EQ(timeline.stats().video_frame_count, 3u);
+  EXPECT_EQ(timeline.stats().video_end_time, 300);
+}
+
+TEST(RecordTimeline, CountsDroppedVideoFrames) {
+  RecordTimeline timeline;
+  int64_t output_time = -1;
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 0, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 100, 100, &output_time));
+  // Two frames are missing.
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 400, 100, &output_time));
+  // Jitter of less than half a frame is not a dropped frame.
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 540, 100, &output_time));
+
+  EXPECT_EQ(timeline.stats().video_frame_count, 4u);
+  EXPECT_EQ(timeline.stats().dropped_video_frame_count, 2u);
+}
+
+TEST(RecordTimeline, PausedTimeIsNotCountedAsDroppedFrames) {
+  RecordTimeline timeline;
+  int64_t output_time = -1;
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 0, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(false, true, 50, 100, &output_time));
+
+  timeline.Pause();
+  timeline.Resume();
+
+  // The resumed segment starts after the last audio sample, later than the
+  // end of the last video frame.
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 1000, 100, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 1100, 100, &output_time));
+
+  EXPECT_EQ(timeline.stats().video_frame_count, 3u);
+  EXPECT_EQ(timeline.stats().dropped_video_frame_count, 0u);
+}
+
+TEST(RecordTimeline, ReportsAudioVideoDrift) {
+  RecordTimeline timeline;
+  int64_t output_time = -1;
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, true, 0, 100, &output_time));
+  EXPECT_EQ(timeline.stats().GetAudioVideoDrift(), 0);
+
+  ASSERT_TRUE(timeline.MapSampleTime(false, true, 0, 60, &output_time));
+  ASSERT_TRUE(timeline.MapSampleTime(false, true, 60, 60, &output_time));
+  EXPECT_EQ(timeline.stats().GetAudioVideoDrift(), 20);
+
+  ASSERT_TRUE(timeline.MapSampleTime(true, false, 100, 100, &output_time));
+  EXPECT_EQ(timeline.stats().GetAudioVideoDrift(), -80);
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,467 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "source_reader_capture_controller.h"
+
+#include <flutter/texture_registrar.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <windows.h>
+#include <wrl/client.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "media_type_cache.h"
+#include "mocks.h"
+
+namespace camera_windows {
+
+namespace test {
+
+using Microsoft::WRL::ComPtr;
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Return;
+
+namespace {
+
+constexpr int64_t kMockTextureId = 1234;
+
+std::shared_ptr<CaptureContext> CreateSourceReaderCaptureContext() {
+  auto capture_context = std::make_shared<CaptureContext>();
+  EXPECT_TRUE(SUCCEEDED(capture_context->Initialize()));
+  return capture_context;
+}
+
+// Creates a sample holding |size| bytes of |data|, as read by the source
+// reader.
+ComPtr<IMFSample> CreateFakeSample(const uint8_t* data, uint32_t size,
+                                   LONGLONG sample_time) {
+  ComPtr<IMFSample> sample;
+  ComPtr<IMFMediaBuffer> buffer;
+  HRESULT hr = MFCreateSample(&sample);
+
+  if (SUCCEEDED(hr)) {
+    hr = MFCreateMemoryBuffer(size, &buffer);
+  }
+
+  if (SUCCEEDED(hr)) {
+    uint8_t* target_data;
+    if (SUCCEEDED(buffer->Lock(&target_data, nullptr, nullptr))) {
+      std::copy(data, data + size, target_data);
+    }
+    hr = buffer->Unlock();
+  }
+
+  if (SUCCEEDED(hr)) {
+    hr = buffer->SetCurrentLength(size);
+  }
+
+  if (SUCCEEDED(hr)) {
+    hr = sample->AddBuffer(buffer.Get());
+  }
+
+  if (SUCCEEDED(hr)) {
+    hr = sample->SetSampleTime(sample_time);
+  }
+
+  EXPECT_TRUE(SUCCEEDED(hr));
+  return sample;
+}
+
+// Makes |source_reader| report a single native media type of the given size.
+void MockNativeMediaType(MockSourceReader* source_reader, uint32_t width,
+                         uint32_t height) {
+  // Media types of the mock device differ between tests.
+  MediaTypeCache::GetInstance().Clear();
+
+  EXPECT_CALL(*source_reader,
+              GetNativeMediaType(
+                  Eq((DWORD)MF_SOURCE_READER_FIRST_VIDEO_STREAM), _, _))
+      .WillRepeatedly([width, height](DWORD stream_index,
+                                      DWORD media_type_index,
+                                      IMFMediaType** media_type) {
+        // We give only one media type to loop through
+        if (media_type_index != 0) return MF_E_NO_MORE_TYPES;
+        *media_type = new FakeMediaType(MFMediaType_Video, MFVideoFormat_RGB32,
+                                        width, height);
+        (*media_type)->AddRef();
+        return S_OK;
+      });
+}
+
+void MockInitSourceReaderCaptureController(
+    SourceReaderCaptureController* capture_controller,
+    MockTextureRegistrar* texture_registrar, MockSourceReader* source_reader,
+    MockCamera* camera, const CaptureSettings& settings) {
+  ComPtr<MockMediaSource> video_source = new MockMediaSource();
+
+  capture_controller->SetSourceReader(source_reader);
+  capture_controller->SetVideoSource(
+      reinterpret_cast<IMFMediaSource*>(video_source.Get()));
+
+  EXPECT_CALL(*texture_registrar, RegisterTexture)
+      .Times(1)
+      .WillOnce([reg = texture_registrar](
+                    flutter::TextureVariant* texture) -> int64_t {
+        EXPECT_TRUE(texture);
+        reg->texture_ = texture;
+        reg->texture_id_ = kMockTextureId;
+        return reg->texture_id_;
+      });
+  EXPECT_CALL(*texture_registrar, UnregisterTexture(Eq(kMockTextureId)))
+      .Times(1);
+  EXPECT_CALL(*camera, OnCreateCaptureEngineFailed).Times(0);
+  EXPECT_CALL(*camera, OnCreateCaptureEngineSucceeded(Eq(kMockTextureId)))
+      .Times(1);
+
+  EXPECT_TRUE(capture_controller->InitCaptureDevice(
+      texture_registrar, MOCK_DEVICE_ID, settings,
+      CreateSourceReaderCaptureContext()));
+}
+
+}  // namespace
+
+TEST(SourceReaderCaptureController, InitCaptureDeviceSetsMediaTypes) {
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  MockNativeMediaType(source_reader.Get(), 640, 480);
+
+  // The native media type selects the camera format, and the output media
+  // type converts its frames for the preview.
+  EXPECT_CALL(*source_reader, SetCurrentMediaType).Times(2);
+
+  CaptureSettings settings;
+  settings.resolution_preset = ResolutionPreset::kAuto;
+  settings.preview_pixel_format = PreviewPixelFormat::kNV12;
+  MockInitSourceReaderCaptureController(
+      capture_controller.get(), texture_registrar.get(), source_reader.Get(),
+      camera.get(), settings);
+
+  EXPECT_EQ(capture_controller->GetPreviewWidth(), 640u);
+  EXPECT_EQ(capture_controller->GetPreviewHeight(), 480u);
+  ASSERT_EQ(capture_controller->GetCaptureFormats().size(), 1u);
+
+  ASSERT_TRUE(source_reader->current_media_type_);
+  GUID subtype;
+  EXPECT_TRUE(SUCCEEDED(
+      source_reader->current_media_type_->GetGUID(MF_MT_SUBTYPE, &subtype)));
+  EXPECT_EQ(subtype, MFVideoFormat_NV12);
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+}
+
+TEST(SourceReaderCaptureController, InitCaptureDeviceReportsMissingFormats) {
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  ComPtr<MockMediaSource> video_source = new MockMediaSource();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  MediaTypeCache::GetInstance().Clear();
+  EXPECT_CALL(*source_reader, GetNativeMediaType)
+      .WillRepeatedly(Return(MF_E_NO_MORE_TYPES));
+
+  capture_controller->SetSourceReader(source_reader.Get());
+  capture_controller->SetVideoSource(
+      reinterpret_cast<IMFMediaSource*>(video_source.Get()));
+
+  EXPECT_CALL(*texture_registrar, RegisterTexture).Times(0);
+  EXPECT_CALL(*camera, OnCreateCaptureEngineSucceeded).Times(0);
+  EXPECT_CALL(*camera,
+              OnCreateCaptureEngineFailed(Eq(CameraResult::kError),
+                                          Eq("Failed to create camera")))
+      .Times(1);
+
+  EXPECT_FALSE(capture_controller->InitCaptureDevice(
+      texture_registrar.get(), MOCK_DEVICE_ID, CaptureSettings(),
+      CreateSourceReaderCaptureContext()));
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+}
+
+TEST(SourceReaderCaptureController, InitCaptureDeviceFailsIfAudioIsRequested) {
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  capture_controller->SetSourceReader(source_reader.Get());
+
+  EXPECT_CALL(*source_reader, SetCurrentMediaType).Times(0);
+  EXPECT_CALL(*texture_registrar, RegisterTexture).Times(0);
+  EXPECT_CALL(*camera, OnCreateCaptureEngineSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnCreateCaptureEngineFailed(
+                           Eq(CameraResult::kError),
+                           Eq("Audio recording is not supported by the "
+                              "source reader backend")))
+      .Times(1);
+
+  CaptureSettings settings;
+  settings.record_audio = true;
+  EXPECT_FALSE(capture_controller->InitCaptureDevice(
+      texture_registrar.get(), MOCK_DEVICE_ID, settings,
+      CreateSourceReaderCaptureContext()));
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+}
+
+TEST(SourceReaderCaptureController, StartPreviewSucceedsAfterFirstSample) {
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  // Two pixels should be enough for mock texture data.
+  const uint32_t mock_preview_width = 2;
+  const uint32_t mock_preview_height = 1;
+  MockNativeMediaType(source_reader.Get(), mock_preview_width,
+                      mock_preview_height);
+
+  CaptureSettings settings;
+  settings.resolution_preset = ResolutionPreset::kAuto;
+  MockInitSourceReaderCaptureController(
+      capture_controller.get(), texture_registrar.get(), source_reader.Get(),
+      camera.get(), settings);
+
+  // One read is requested by the preview, and the next after each sample.
+  EXPECT_CALL(*source_reader,
+              ReadSample(Eq((DWORD)MF_SOURCE_READER_FIRST_VIDEO_STREAM), 0, _,
+                         _, _, _))
+      .Times(2)
+      .WillRepeatedly(Return(S_OK));
+  EXPECT_CALL(*camera, OnStartPreviewSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnStartPreviewFailed).Times(0);
+
+  capture_controller->StartPreview();
+
+  EXPECT_CALL(*camera,
+              OnStartPreviewSucceeded(mock_preview_width, mock_preview_height))
+      .Times(1);
+  EXPECT_CALL(*texture_registrar, MarkTextureFrameAvailable(kMockTextureId))
+      .Times(1);
+
+  const uint8_t mock_red_pixel = 0x11;
+  const uint8_t mock_green_pixel = 0x22;
+  const uint8_t mock_blue_pixel = 0x33;
+  std::vector<uint8_t> mock_source_buffer;
+  for (uint32_t i = 0; i < mock_preview_width * mock_preview_height; i++) {
+    mock_source_buffer.insert(mock_source_buffer.end(),
+                              {mock_blue_pixel, mock_green_pixel,
+                               mock_red_pixel, 0xFF});
+  }
+  ComPtr<IMFSample> sample = CreateFakeSample(
+      mock_source_buffer.data(),
+      static_cast<uint32_t>(mock_source_buffer.size()), 0);
+  capture_controller->OnReadSample(S_OK, 0, sample.Get());
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+  auto converted_buffer =
+      pixel_buffer_texture->CopyPixelBuffer((size_t)100, (size_t)100);
+  ASSERT_TRUE(converted_buffer);
+  EXPECT_EQ(converted_buffer->width, mock_preview_width);
+  EXPECT_EQ(converted_buffer->height, mock_preview_height);
+
+  const FlutterDesktopPixel* converted_buffer_data =
+      reinterpret_cast<const FlutterDesktopPixel*>(converted_buffer->buffer);
+  EXPECT_EQ(converted_buffer_data[0].r, mock_red_pixel);
+  EXPECT_EQ(converted_buffer_data[0].g, mock_green_pixel);
+  EXPECT_EQ(converted_buffer_data[0].b, mock_blue_pixel);
+
+  // Call release callback to get mutex lock unlocked.
+  converted_buffer->release_callback(converted_buffer->release_context);
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+}
+
+TEST(SourceReaderCaptureController, ReportsReadSampleError) {
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  MockNativeMediaType(source_reader.Get(), 2, 1);
+  MockInitSourceReaderCaptureController(
+      capture_controller.get(), texture_registrar.get(), source_reader.Get(),
+      camera.get(), CaptureSettings());
+
+  EXPECT_CALL(*source_reader, ReadSample).Times(1).WillOnce(Return(S_OK));
+  capture_controller->StartPreview();
+
+  // No further sample is read after an error.
+  EXPECT_CALL(*camera, OnStartPreviewSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnCaptureError(Eq(CameraResult::kAccessDenied), _))
+      .Times(1);
+  capture_controller->OnReadSample(E_ACCESSDENIED, 0, nullptr);
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+}
+
+TEST(SourceReaderCaptureController, TakePictureDataEncodesNextFrame) {
+  ASSERT_TRUE(SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED)));
+
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  MockNativeMediaType(source_reader.Get(), 1, 1);
+  MockInitSourceReaderCaptureController(
+      capture_controller.get(), texture_registrar.get(), source_reader.Get(),
+      camera.get(), CaptureSettings());
+
+  // The picture reads a sample even though the preview is not started.
+  EXPECT_CALL(*source_reader, ReadSample).Times(1).WillOnce(Return(S_OK));
+
+  PhotoSettings settings;
+  settings.format = PhotoFormat::kPng;
+  capture_controller->TakePictureData(settings);
+
+  // PNG files start with a fixed signature.
+  const std::vector<uint8_t> png_signature = {0x89, 'P', 'N', 'G'};
+  EXPECT_CALL(*camera, OnTakePictureDataFailed).Times(0);
+  EXPECT_CALL(*camera, OnTakePictureDataSucceeded)
+      .Times(1)
+      .WillOnce([png_signature](std::vector<uint8_t>& data) {
+        ASSERT_GT(data.size(), png_signature.size());
+        EXPECT_TRUE(std::equal(png_signature.begin(), png_signature.end(),
+                               data.begin()));
+      });
+
+  // A red RGB32 pixel.
+  const std::vector<uint8_t> pixel = {0, 0, 0xFF, 0xFF};
+  ComPtr<IMFSample> sample = CreateFakeSample(
+      pixel.data(), static_cast<uint32_t>(pixel.size()), 0);
+  capture_controller->OnReadSample(S_OK, 0, sample.Get());
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+
+  CoUninitialize();
+}
+
+TEST(SourceReaderCaptureController, TakePictureBurstIsNotSupported) {
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  MockNativeMediaType(source_reader.Get(), 2, 1);
+  MockInitSourceReaderCaptureController(
+      capture_controller.get(), texture_registrar.get(), source_reader.Get(),
+      camera.get(), CaptureSettings());
+
+  EXPECT_CALL(*source_reader, ReadSample).Times(0);
+  EXPECT_CALL(*camera, OnTakePictureBurstSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnTakePictureBurstFailed(Eq(CameraResult::kError), _))
+      .Times(1);
+
+  capture_controller->TakePictureBurst({"burst_1.jpeg", "burst_2.jpeg"});
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+}
+
+TEST(SourceReaderCaptureController, PauseRecordFailsIfNotRecording) {
+  ComPtr<MockSourceReader> source_reader = new MockSourceReader();
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+  std::unique_ptr<SourceReaderCaptureController> capture_controller =
+      std::make_unique<SourceReaderCaptureController>(camera.get());
+  std::unique_ptr<MockTextureRegistrar> texture_registrar =
+      std::make_unique<MockTextureRegistrar>();
+
+  MockNativeMediaType(source_reader.Get(), 2, 1);
+  MockInitSourceReaderCaptureController(
+      capture_controller.get(), texture_registrar.get(), source_reader.Get(),
+      camera.get(), CaptureSettings());
+
+  EXPECT_CALL(*camera, OnPauseRecordSucceeded).Times(0);
+  EXPECT_CALL(*camera, OnPauseRecordFailed(Eq(CameraResult::kError),
+                                           Eq("Recording not running")))
+      .Times(1);
+  capture_controller->PauseRecord();
+
+  EXPECT_CALL(*camera, OnStopRecordFailed(Eq(CameraResult::kError),
+                                          Eq("Recording cannot be stopped.")))
+      .Times(1);
+  capture_controller->StopRecord();
+  EXPECT_FALSE(capture_controller->GetRecordingStats().has_value());
+
+  capture_controller = nullptr;
+  camera = nullptr;
+  texture_registrar = nullptr;
+  source_reader = nullptr;
+}
+
+TEST(SourceReaderCaptureController, CreatedByFactoryForSourceReaderBackend) {
+  std::unique_ptr<MockCamera> camera =
+      std::make_unique<MockCamera>(MOCK_DEVICE_ID);
+
+  std::unique_ptr<CaptureController> source_reader_controller =
+      CaptureControllerFactoryImpl(CaptureBackend::kSourceReader)
+          .CreateCaptureController(camera.get());
+  EXPECT_TRUE(dynamic_cast<SourceReaderCaptureController*>(
+      source_reader_controller.get()));
+
+  std::unique_ptr<CaptureController> capture_engine_controller =
+      CaptureControllerFactoryImpl().CreateCaptureController(camera.get());
+  EXPECT_TRUE(
+      dynamic_cast<CaptureControllerImpl*>(capture_engine_controller.get()));
+
+  source_reader_controller = nullptr;
+  capture_engine_controller = nullptr;
+  camera = nullptr;
+}
+
+}  // namespace test
+}  // namespace camera_windows
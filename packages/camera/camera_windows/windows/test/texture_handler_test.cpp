@@ -0,0 +1,516 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "texture_handler.h"
+
+#include <flutter/texture_registrar.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "capture_context.h"
+#include "mocks.h"
+
+namespace camera_windows {
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace test {
+
+namespace {
+
+// Builds a 2x1 MFVideoFormat_RGB32 frame filled with the given red value.
+std::vector<uint8_t> CreateFrame(uint8_t red) {
+  return std::vector<uint8_t>({0x33, 0x22, red, 0x00, 0x33, 0x22, red, 0x00});
+}
+
+// Builds a MFVideoFormat_RGB32 frame whose red and green values are the
+// column and row of each pixel.
+std::vector<uint8_t> CreateCoordinateFrame(uint8_t width, uint8_t height) {
+  std::vector<uint8_t> frame;
+  for (uint8_t y = 0; y < height; y++) {
+    for (uint8_t x = 0; x < width; x++) {
+      frame.insert(frame.end(), {0x00, y, x, 0x00});
+    }
+  }
+  return frame;
+}
+
+}  // namespace
+
+TEST(TextureHandler, DropsFramesNotConsumedByFlutter) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(2, 1);
+
+  // Three frames arrive before Flutter reads the texture, so the first two
+  // are replaced without blocking the capture thread.
+  for (uint8_t red = 1; red <= 3; red++) {
+    std::vector<uint8_t> frame = CreateFrame(red);
+    EXPECT_TRUE(texture_handler->UpdateBuffer(
+        frame.data(), static_cast<uint32_t>(frame.size()), 0));
+  }
+  EXPECT_EQ(texture_handler->GetDroppedFrameCount(), 2u);
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(2, 1);
+  ASSERT_TRUE(pixel_buffer);
+  EXPECT_EQ(pixel_buffer->width, 2u);
+  EXPECT_EQ(pixel_buffer->height, 1u);
+
+  // Latest frame is presented.
+  const FlutterDesktopPixel* pixels =
+      reinterpret_cast<const FlutterDesktopPixel*>(pixel_buffer->buffer);
+  EXPECT_EQ(pixels[0].r, 0x03);
+  EXPECT_EQ(pixels[1].r, 0x03);
+
+  // New frames can be written while Flutter still holds the pixel buffer.
+  std::vector<uint8_t> frame = CreateFrame(0x04);
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+  EXPECT_EQ(pixels[0].r, 0x03);
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+  EXPECT_EQ(texture_handler->GetDroppedFrameCount(), 2u);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, RejectsBuffersSmallerThanFrame) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(2, 1);
+
+  std::vector<uint8_t> frame = CreateFrame(0x01);
+  EXPECT_FALSE(texture_handler->UpdateBuffer(frame.data(), 4, 0));
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, ConvertsNV12Frames) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  texture_handler->SetPixelFormat(PreviewPixelFormat::kNV12);
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(2, 2);
+
+  // Black and white columns, followed by a neutral chroma row.
+  std::vector<uint8_t> frame = {16, 235, 16, 235, 128, 128};
+  EXPECT_FALSE(texture_handler->UpdateBuffer(frame.data(), 5, 0));
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(2, 2);
+  ASSERT_TRUE(pixel_buffer);
+
+  // The preview is mirrored by default.
+  const FlutterDesktopPixel* pixels =
+      reinterpret_cast<const FlutterDesktopPixel*>(pixel_buffer->buffer);
+  EXPECT_EQ(pixels[0].r, 255);
+  EXPECT_EQ(pixels[0].a, 255);
+  EXPECT_EQ(pixels[1].g, 0);
+  EXPECT_EQ(pixels[3].b, 0);
+  EXPECT_EQ(pixels[3].a, 255);
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, ConvertsLargeFramesInTwoHalves) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  constexpr uint32_t kWidth = 1920;
+  constexpr uint32_t kHeight = 1080;
+  static_assert(kWidth * kHeight >=
+                    TextureHandler::kParallelConversionMinPixels,
+                "Frame must be converted in two halves");
+  texture_handler->SetMirrorPreviewState(false);
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(kWidth, kHeight);
+
+  // The red value of each pixel is its row, modulo 256, and the green value
+  // its row divided by 256.
+  std::vector<uint8_t> frame;
+  frame.reserve(kWidth * kHeight * 4);
+  for (uint32_t y = 0; y < kHeight; y++) {
+    for (uint32_t x = 0; x < kWidth; x++) {
+      frame.insert(frame.end(), {0x00, static_cast<uint8_t>(y >> 8),
+                                 static_cast<uint8_t>(y & 0xFF), 0x00});
+    }
+  }
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(kWidth, kHeight);
+  ASSERT_TRUE(pixel_buffer);
+  EXPECT_EQ(pixel_buffer->width, kWidth);
+  EXPECT_EQ(pixel_buffer->height, kHeight);
+
+  const FlutterDesktopPixel* pixels =
+      reinterpret_cast<const FlutterDesktopPixel*>(pixel_buffer->buffer);
+  for (uint32_t y = 0; y < kHeight; y++) {
+    const FlutterDesktopPixel& first = pixels[y * kWidth];
+    const FlutterDesktopPixel& last = pixels[y * kWidth + kWidth - 1];
+    ASSERT_EQ(static_cast<uint32_t>(first.r | (first.g << 8)), y);
+    ASSERT_EQ(static_cast<uint32_t>(last.r | (last.g << 8)), y);
+    ASSERT_EQ(last.a, 255);
+  }
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, RecordsPreviewStatsOfRenderedFrames) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::shared_ptr<PreviewStats> preview_stats =
+      std::make_shared<PreviewStats>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  texture_handler->SetPreviewStats(preview_stats);
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(2, 1);
+
+  // Two frames arrive before Flutter reads the texture.
+  for (uint8_t red = 1; red <= 2; red++) {
+    preview_stats->OnFrameReceived(red * 1000u, PreviewStats::GetTimeUs());
+    std::vector<uint8_t> frame = CreateFrame(red);
+    EXPECT_TRUE(texture_handler->UpdateBuffer(
+        frame.data(), static_cast<uint32_t>(frame.size()), 0));
+  }
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(2, 1);
+  ASSERT_TRUE(pixel_buffer);
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+
+  PreviewStatsSnapshot snapshot = preview_stats->GetSnapshot();
+  EXPECT_EQ(snapshot.received_frame_count, 2u);
+  EXPECT_EQ(snapshot.rendered_frame_count, 1u);
+  EXPECT_EQ(snapshot.dropped_frame_count, 1u);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, ConvertsOnlyZoomedRegion) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  texture_handler->SetMirrorPreviewState(false);
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(8, 8);
+  texture_handler->SetCrop(PreviewCropRect(), 2.0);
+
+  std::vector<uint8_t> frame = CreateCoordinateFrame(8, 8);
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+  EXPECT_EQ(texture_handler->GetVisibleWidth(), 4u);
+  EXPECT_EQ(texture_handler->GetVisibleHeight(), 4u);
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(4, 4);
+  ASSERT_TRUE(pixel_buffer);
+  EXPECT_EQ(pixel_buffer->width, 4u);
+  EXPECT_EQ(pixel_buffer->height, 4u);
+
+  // The center of the frame is shown.
+  const FlutterDesktopPixel* pixels =
+      reinterpret_cast<const FlutterDesktopPixel*>(pixel_buffer->buffer);
+  EXPECT_EQ(pixels[0].r, 2);
+  EXPECT_EQ(pixels[0].g, 2);
+  EXPECT_EQ(pixels[15].r, 5);
+  EXPECT_EQ(pixels[15].g, 5);
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, CropsMirroredPreviewInDisplayOrientation) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(8, 2);
+
+  // Left half of the mirrored preview.
+  PreviewCropRect crop_rect;
+  crop_rect.width = 0.5;
+  texture_handler->SetCrop(crop_rect, 1.0);
+
+  std::vector<uint8_t> frame = CreateCoordinateFrame(8, 2);
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(4, 2);
+  ASSERT_TRUE(pixel_buffer);
+  EXPECT_EQ(pixel_buffer->width, 4u);
+  EXPECT_EQ(pixel_buffer->height, 2u);
+
+  // The right half of the source frame is shown, mirrored.
+  const FlutterDesktopPixel* pixels =
+      reinterpret_cast<const FlutterDesktopPixel*>(pixel_buffer->buffer);
+  EXPECT_EQ(pixels[0].r, 7);
+  EXPECT_EQ(pixels[3].r, 4);
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, RotatesPreview) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  texture_handler->SetMirrorPreviewState(false);
+  EXPECT_TRUE(texture_handler->SetRotation(PreviewRotation::kRotate90));
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(4, 2);
+
+  std::vector<uint8_t> frame = CreateCoordinateFrame(4, 2);
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(2, 4);
+  ASSERT_TRUE(pixel_buffer);
+  EXPECT_EQ(pixel_buffer->width, 2u);
+  EXPECT_EQ(pixel_buffer->height, 4u);
+
+  // The bottom left pixel of the frame is shown at the top left.
+  const FlutterDesktopPixel* pixels =
+      reinterpret_cast<const FlutterDesktopPixel*>(pixel_buffer->buffer);
+  EXPECT_EQ(pixels[0].r, 0);
+  EXPECT_EQ(pixels[0].g, 1);
+  EXPECT_EQ(pixels[1].r, 0);
+  EXPECT_EQ(pixels[1].g, 0);
+  EXPECT_EQ(pixels[7].r, 3);
+  EXPECT_EQ(pixels[7].g, 0);
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, RotatesLargeFramesConvertedInTwoHalves) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  constexpr uint32_t kWidth = 1920;
+  constexpr uint32_t kHeight = 1080;
+  static_assert(kWidth * kHeight >=
+                    TextureHandler::kParallelConversionMinPixels,
+                "Frame must be converted in two halves");
+
+  texture_handler->SetMirrorPreviewState(false);
+  EXPECT_TRUE(texture_handler->SetRotation(PreviewRotation::kRotate90));
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(kWidth, kHeight);
+
+  // The red value of each pixel is its row, modulo 256, and the green value
+  // its row divided by 256.
+  std::vector<uint8_t> frame;
+  frame.reserve(kWidth * kHeight * 4);
+  for (uint32_t y = 0; y < kHeight; y++) {
+    for (uint32_t x = 0; x < kWidth; x++) {
+      frame.insert(frame.end(), {0x00, static_cast<uint8_t>(y >> 8),
+                                 static_cast<uint8_t>(y & 0xFF), 0x00});
+    }
+  }
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(kHeight, kWidth);
+  ASSERT_TRUE(pixel_buffer);
+  EXPECT_EQ(pixel_buffer->width, kHeight);
+  EXPECT_EQ(pixel_buffer->height, kWidth);
+
+  // Source rows become columns, with the last row on the left.
+  const FlutterDesktopPixel* pixels =
+      reinterpret_cast<const FlutterDesktopPixel*>(pixel_buffer->buffer);
+  for (uint32_t y : {0u, kWidth - 1}) {
+    for (uint32_t x = 0; x < kHeight; x++) {
+      const FlutterDesktopPixel& pixel = pixels[y * kHeight + x];
+      ASSERT_EQ(static_cast<uint32_t>(pixel.r | (pixel.g << 8)),
+                kHeight - 1 - x);
+    }
+  }
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, UnregisterAndDestroyDoesNotWaitForFlutter) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::shared_ptr<PreviewStats> preview_stats =
+      std::make_shared<PreviewStats>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+  TextureHandler* unregistered_handler = texture_handler.get();
+
+  texture_handler->SetPreviewStats(preview_stats);
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  texture_handler->UpdateTextureSize(2, 1);
+
+  std::vector<uint8_t> frame = CreateFrame(1);
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+
+  auto pixel_buffer_texture =
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_);
+  ASSERT_TRUE(pixel_buffer_texture);
+
+  // Flutter is still reading the current frame when the texture is
+  // unregistered, and reports the unregistration later.
+  const FlutterDesktopPixelBuffer* pixel_buffer =
+      pixel_buffer_texture->CopyPixelBuffer(2, 1);
+  ASSERT_TRUE(pixel_buffer);
+
+  std::function<void()> unregistered_callback;
+  EXPECT_CALL(*texture_registrar, UnregisterTexture(1000, _))
+      .WillOnce([&unregistered_callback](int64_t,
+                                         std::function<void()> callback) {
+        unregistered_callback = std::move(callback);
+      });
+  TextureHandler::UnregisterAndDestroy(std::move(texture_handler));
+  ASSERT_TRUE(unregistered_callback);
+
+  // The handler stays alive but no longer updates or renders the texture.
+  EXPECT_FALSE(unregistered_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+  EXPECT_EQ(pixel_buffer_texture->CopyPixelBuffer(2, 1), nullptr);
+  EXPECT_EQ(preview_stats.use_count(), 2);
+
+  pixel_buffer->release_callback(pixel_buffer->release_context);
+  unregistered_callback();
+  EXPECT_EQ(preview_stats.use_count(), 1);
+
+  texture_registrar = nullptr;
+}
+
+
+TEST(TextureHandler, EnableGpuSurfaceWithoutDeviceKeepsPixelBuffer) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+
+  EXPECT_FALSE(texture_handler->EnableGpuSurface(nullptr));
+  EXPECT_FALSE(texture_handler->IsGpuSurfaceEnabled());
+
+  EXPECT_GT(texture_handler->RegisterTexture(), 0);
+  EXPECT_TRUE(
+      std::get_if<flutter::PixelBufferTexture>(texture_registrar->texture_));
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+TEST(TextureHandler, EnableGpuSurfaceFailsAfterRegistration) {
+  std::unique_ptr<NiceMock<MockTextureRegistrar>> texture_registrar =
+      std::make_unique<NiceMock<MockTextureRegistrar>>();
+  std::unique_ptr<TextureHandler> texture_handler =
+      std::make_unique<TextureHandler>(texture_registrar.get());
+  CaptureContext capture_context;
+  ASSERT_TRUE(SUCCEEDED(capture_context.Initialize()));
+
+  const int64_t texture_id = texture_handler->RegisterTexture();
+  EXPECT_GT(texture_id, 0);
+  flutter::TextureVariant* texture = texture_registrar->texture_;
+
+  // The registered pixel buffer texture cannot be switched to a GPU surface.
+  EXPECT_CALL(*texture_registrar, RegisterTexture).Times(0);
+  EXPECT_FALSE(
+      texture_handler->EnableGpuSurface(capture_context.GetD3DDevice()));
+  EXPECT_FALSE(texture_handler->IsGpuSurfaceEnabled());
+  EXPECT_EQ(texture_registrar->texture_, texture);
+  EXPECT_EQ(texture_registrar->texture_id_, texture_id);
+  EXPECT_TRUE(std::get_if<flutter::PixelBufferTexture>(texture));
+
+  texture_handler->UpdateTextureSize(2, 1);
+  std::vector<uint8_t> frame = CreateFrame(1);
+  EXPECT_TRUE(texture_handler->UpdateBuffer(
+      frame.data(), static_cast<uint32_t>(frame.size()), 0));
+
+  texture_handler = nullptr;
+  texture_registrar = nullptr;
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -0,0 +1,38 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tracing.h"
+
+#include <gtest/gtest.h>
+
+namespace camera_windows {
+namespace test {
+
+TEST(Tracing, RegistrationsAreCounted) {
+  // Registering a provider that is already registered fails, so nested
+  // registrations must only register it once.
+  RegisterTraceProvider();
+  RegisterTraceProvider();
+  UnregisterTraceProvider();
+  UnregisterTraceProvider();
+
+  // The provider can be registered again once every registration is balanced.
+  RegisterTraceProvider();
+  UnregisterTraceProvider();
+}
+
+TEST(Tracing, ActivitiesCanBeTracedWithoutProvider) {
+  CAMERA_TRACE_SCOPE("Test");
+}
+
+TEST(Tracing, ActivitiesCanBeTracedWithoutSession) {
+  RegisterTraceProvider();
+  {
+    CAMERA_TRACE_SCOPE_WITH_DETAIL("Test", "detail");
+  }
+  UnregisterTraceProvider();
+}
+
+}  // namespace test
+}  // namespace camera_windows
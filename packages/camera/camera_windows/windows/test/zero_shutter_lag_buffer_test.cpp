@@ -0,0 +1,108 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "zero_shutter_lag_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace camera_windows {
+
+namespace test {
+
+TEST(ZeroShutterLagBuffer, GetClosestFrameFailsWhenEmpty) {
+  ZeroShutterLagBuffer buffer(2);
+  BufferedFrame frame;
+
+  EXPECT_FALSE(buffer.GetClosestFrame(0, &frame));
+}
+
+TEST(ZeroShutterLagBuffer, ReturnsFrameClosestToShutterTime) {
+  ZeroShutterLagBuffer buffer(3);
+  for (uint8_t i = 0; i < 3; i++) {
+    std::vector<uint8_t> pixel = {i, i, i, 0};
+    EXPECT_TRUE(buffer.AddFrame(pixel.data(), 4, 0, 1, 1,
+                                PreviewPixelFormat::kRGB32, i * 1000u));
+  }
+
+  BufferedFrame frame;
+  ASSERT_TRUE(buffer.GetClosestFrame(1400, &frame));
+  EXPECT_EQ(frame.timestamp_us, 1000u);
+  EXPECT_EQ(frame.bytes, std::vector<uint8_t>({1, 1, 1, 0}));
+
+  ASSERT_TRUE(buffer.GetClosestFrame(10000, &frame));
+  EXPECT_EQ(frame.timestamp_us, 2000u);
+}
+
+TEST(ZeroShutterLagBuffer, OverwritesOldestFrame) {
+  ZeroShutterLagBuffer buffer(2);
+  std::vector<uint8_t> pixel = {0, 0, 0, 0};
+  for (uint64_t timestamp : {1000u, 2000u, 3000u}) {
+    EXPECT_TRUE(buffer.AddFrame(pixel.data(), 4, 0, 1, 1,
+                                PreviewPixelFormat::kRGB32, timestamp));
+  }
+
+  BufferedFrame frame;
+  ASSERT_TRUE(buffer.GetClosestFrame(0, &frame));
+  EXPECT_EQ(frame.timestamp_us, 2000u);
+
+  buffer.Clear();
+  EXPECT_FALSE(buffer.GetClosestFrame(0, &frame));
+}
+
+TEST(ZeroShutterLagBuffer, PacksPaddedAndBottomUpRows) {
+  ZeroShutterLagBuffer buffer(1);
+  // Two rows of one pixel each, with four bytes of padding after each row.
+  std::vector<uint8_t> source = {0x01, 0x02, 0x03, 0x00, 0xEE, 0xEE,
+                                 0xEE, 0xEE, 0x04, 0x05, 0x06, 0x00,
+                                 0xEE, 0xEE, 0xEE, 0xEE};
+
+  BufferedFrame frame;
+  ASSERT_TRUE(buffer.AddFrame(source.data(), 16, 8, 1, 2,
+                              PreviewPixelFormat::kRGB32, 0));
+  ASSERT_TRUE(buffer.GetClosestFrame(0, &frame));
+  EXPECT_EQ(frame.bytes, std::vector<uint8_t>(
+                             {0x01, 0x02, 0x03, 0x00, 0x04, 0x05, 0x06, 0x00}));
+
+  // A negative stride starts at the last row in memory.
+  ASSERT_TRUE(buffer.AddFrame(source.data() + 8, 12, -8, 1, 2,
+                              PreviewPixelFormat::kRGB32, 0));
+  ASSERT_TRUE(buffer.GetClosestFrame(0, &frame));
+  EXPECT_EQ(frame.bytes, std::vector<uint8_t>(
+                             {0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x00}));
+}
+
+TEST(ZeroShutterLagBuffer, KeepsNV12ChromaPlane) {
+  ZeroShutterLagBuffer buffer(1);
+  // 2x2 frame with two bytes of padding after each row.
+  std::vector<uint8_t> source = {16, 32, 0xEE, 0xEE, 48,  64,
+                                 0xEE, 0xEE, 128, 96, 0xEE, 0xEE};
+
+  ASSERT_TRUE(buffer.AddFrame(source.data(),
+                              static_cast<uint32_t>(source.size()), 4, 2, 2,
+                              PreviewPixelFormat::kNV12, 0));
+
+  BufferedFrame frame;
+  ASSERT_TRUE(buffer.GetClosestFrame(0, &frame));
+  EXPECT_EQ(frame.format, PreviewPixelFormat::kNV12);
+  EXPECT_EQ(frame.bytes, std::vector<uint8_t>({16, 32, 48, 64, 128, 96}));
+}
+
+TEST(ZeroShutterLagBuffer, RejectsShortFrames) {
+  ZeroShutterLagBuffer buffer(1);
+  std::vector<uint8_t> source(7);
+
+  EXPECT_FALSE(buffer.AddFrame(source.data(), 7, 0, 1, 2,
+                               PreviewPixelFormat::kRGB32, 0));
+  // NV12 frames must be top-down.
+  EXPECT_FALSE(buffer.AddFrame(source.data() + 2, 5, -2, 2, 2,
+                               PreviewPixelFormat::kNV12, 0));
+
+  BufferedFrame frame;
+  EXPECT_FALSE(buffer.GetClosestFrame(0, &frame));
+}
+
+}  // namespace test
+}  // namespace camera_windows
@@ -5,12 +5,19 @@
 #include "texture_handler.h"
 
 #include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <future>
+
+#include "pixel_conversion.h"
+#include "tracing.h"
 
 namespace camera_windows {
 
 TextureHandler::~TextureHandler() {
   // Texture might still be processed while destructor is called.
-  // Lock mutex for safe destruction
+  // Lock mutexes for safe destruction
+  const std::lock_guard<std::mutex> capture_lock(capture_mutex_);
   const std::lock_guard<std::mutex> lock(buffer_mutex_);
   if (texture_registrar_ && texture_id_ > 0) {
     texture_registrar_->UnregisterTexture(texture_id_);
@@ -20,40 +27,291 @@ TextureHandler::~TextureHandler() {
   texture_registrar_ = nullptr;
 }
 
+// static
+void TextureHandler::UnregisterAndDestroy(
+    std::unique_ptr<TextureHandler> handler) {
+  if (!handler) {
+    return;
+  }
+
+  // Only flags the texture, as taking |buffer_mutex_| here would wait for
+  // Flutter to release the frame it reads.
+  handler->unregistering_.store(true, std::memory_order_release);
+  flutter::TextureRegistrar* texture_registrar = handler->texture_registrar_;
+  const int64_t texture_id = handler->texture_id_;
+  if (!texture_registrar || texture_id <= 0) {
+    return;
+  }
+
+  // The texture and its buffers stay alive until Flutter no longer uses
+  // them.
+  TextureHandler* unregistered_handler = handler.release();
+  texture_registrar->UnregisterTexture(texture_id, [unregistered_handler]() {
+    unregistered_handler->texture_registrar_ = nullptr;
+    delete unregistered_handler;
+  });
+}
+
 int64_t TextureHandler::RegisterTexture() {
   if (!texture_registrar_) {
     return -1;
   }
 
-  // Create flutter desktop pixelbuffer texture;
-  texture_ =
-      std::make_unique<flutter::TextureVariant>(flutter::PixelBufferTexture(
-          [this](size_t width,
-                 size_t height) -> const FlutterDesktopPixelBuffer* {
-            return this->ConvertPixelBufferForFlutter(width, height);
-          }));
+  if (gpu_surface_renderer_) {
+    // Create flutter desktop GPU surface texture backed by a DXGI shared
+    // handle.
+    texture_ =
+        std::make_unique<flutter::TextureVariant>(flutter::GpuSurfaceTexture(
+            kFlutterDesktopGpuSurfaceTypeDxgiSharedHandle,
+            [this](size_t width, size_t height)
+                -> const FlutterDesktopGpuSurfaceDescriptor* {
+              return this->GetGpuSurfaceDescriptor(width, height);
+            }));
+  } else {
+    // Create flutter desktop pixelbuffer texture;
+    texture_ =
+        std::make_unique<flutter::TextureVariant>(flutter::PixelBufferTexture(
+            [this](size_t width,
+                   size_t height) -> const FlutterDesktopPixelBuffer* {
+              return this->ConvertPixelBufferForFlutter(width, height);
+            }));
+  }
 
   texture_id_ = texture_registrar_->RegisterTexture(texture_.get());
   return texture_id_;
 }
 
-bool TextureHandler::UpdateBuffer(uint8_t* data, uint32_t data_length) {
+bool TextureHandler::EnableGpuSurface(ID3D11Device* device) {
+  // The texture type cannot change once Flutter has the texture.
+  if (!device || TextureRegistered()) {
+    return false;
+  }
+
+  auto renderer = std::make_unique<GpuSurfaceRenderer>(device);
+  if (FAILED(renderer->Initialize())) {
+    return false;
+  }
+
+  // Mirroring is required for the default preview, so the pixel buffer path
+  // is kept if the video processor cannot mirror.
+  if (mirror_preview_ && !renderer->SupportsMirroring()) {
+    return false;
+  }
+  if (rotation_ != PreviewRotation::kNone && !renderer->SupportsRotation()) {
+    return false;
+  }
+
+  gpu_surface_renderer_ = std::move(renderer);
+  return true;
+}
+
+void TextureHandler::SetCrop(const PreviewCropRect& crop, double zoom_level) {
+  const std::lock_guard<std::mutex> capture_lock(capture_mutex_);
+  crop_ = crop;
+  zoom_level_ = zoom_level;
+}
+
+bool TextureHandler::SetRotation(PreviewRotation rotation) {
+  const std::lock_guard<std::mutex> capture_lock(capture_mutex_);
+  if (rotation != PreviewRotation::kNone && gpu_surface_renderer_ &&
+      !gpu_surface_renderer_->SupportsRotation()) {
+    return false;
+  }
+  rotation_ = rotation;
+  return true;
+}
+
+PixelRect TextureHandler::UpdateVisibleRect() {
+  PixelRect rect =
+      GetPreviewSourceRect(preview_frame_width_, preview_frame_height_, crop_,
+                           zoom_level_, mirror_preview_, rotation_);
+  visible_width_ = rect.width;
+  visible_height_ = rect.height;
+  return rect;
+}
+
+bool TextureHandler::UpdateTexture(ID3D11Texture2D* texture,
+                                   UINT subresource_index) {
+  if (!texture) {
+    return false;
+  }
+
   // Scoped lock guard.
   {
+    const std::lock_guard<std::mutex> capture_lock(capture_mutex_);
     const std::lock_guard<std::mutex> lock(buffer_mutex_);
+    if (!TextureRegistered() || !gpu_surface_renderer_) {
+      return false;
+    }
+
+    if (FAILED(gpu_surface_renderer_->RenderTexture(
+            texture, subresource_index, preview_frame_width_,
+            preview_frame_height_, UpdateVisibleRect(), mirror_preview_,
+            rotation_))) {
+      return false;
+    }
+    gpu_surface_frame_id_ = GetCurrentFrameId();
+  }
+  OnBufferUpdated();
+  return true;
+}
+
+bool TextureHandler::UpdateBuffer(const uint8_t* data, uint32_t data_length,
+                                  int32_t stride) {
+  CAMERA_TRACE_SCOPE("ConvertSample");
+  // Scoped lock guard.
+  {
+    const std::lock_guard<std::mutex> capture_lock(capture_mutex_);
     if (!TextureRegistered()) {
       return false;
     }
 
-    if (source_buffer_.size() != data_length) {
-      // Update source buffer size.
-      source_buffer_.resize(data_length);
+    const bool is_nv12 = pixel_format_ == PreviewPixelFormat::kNV12;
+    const PixelRect visible_rect = UpdateVisibleRect();
+    const uint32_t data_size =
+        visible_rect.width * bytes_per_pixel_ * visible_rect.height;
+
+    // NV12 rows hold one byte per luma sample, or one byte per chroma sample
+    // pair. The chroma plane has half the rows of the luma plane, with the
+    // same pitch.
+    const uint32_t row_size = is_nv12
+                                  ? GetNV12UVPlaneRowSize(preview_frame_width_)
+                                  : preview_frame_width_ * bytes_per_pixel_;
+    if (stride == 0) {
+      stride = static_cast<int32_t>(row_size);
+    }
+    if (is_nv12 && stride < 0) {
+      return false;
+    }
+    const uint32_t row_pitch = static_cast<uint32_t>(std::abs(stride));
+    uint32_t row_count = preview_frame_height_;
+    if (is_nv12) {
+      row_count += GetNV12UVPlaneHeight(preview_frame_height_);
+    }
+    if (data_size == 0 || !data || row_pitch < row_size ||
+        data_length < row_pitch * (row_count - 1) + row_size) {
+      return false;
+    }
+    // The clock is only read when the conversion time is recorded.
+    const uint64_t conversion_start_us =
+        preview_stats_ ? PreviewStats::GetTimeUs() : 0;
+
+    if (gpu_surface_renderer_) {
+      // Frame is only available in system memory, upload it to the GPU
+      // surface.
+      const std::lock_guard<std::mutex> lock(buffer_mutex_);
+      if (FAILED(gpu_surface_renderer_->RenderBuffer(
+              data, stride, preview_frame_width_, preview_frame_height_,
+              visible_rect, mirror_preview_, rotation_, pixel_format_))) {
+        return false;
+      }
+      gpu_surface_frame_id_ = GetCurrentFrameId();
+    } else {
+      PixelBufferFrame& frame = frames_[back_frame_];
+      if (frame.data.size() != data_size) {
+        frame.data.resize(data_size);
+      }
+
+      // Converts directly from the locked sample buffer, so the conversion
+      // must be complete before returning.
+      uint8_t* dst = frame.data.data();
+      if (visible_rect.width * visible_rect.height <
+          kParallelConversionMinPixels) {
+        ConvertVisibleRows(data, stride, visible_rect, 0, visible_rect.height,
+                           dst);
+      } else {
+        if (!conversion_queue_) {
+          conversion_queue_ = std::make_unique<CaptureWorkQueue>();
+        }
+
+        // The split row is even, so NV12 chroma rows are not shared between
+        // the halves.
+        const uint32_t split_row = (visible_rect.height / 2) & ~1u;
+        std::promise<void> top_half_converted;
+        conversion_queue_->Post([this, data, stride, &visible_rect, split_row,
+                                 dst, &top_half_converted]() {
+          ConvertVisibleRows(data, stride, visible_rect, 0, split_row, dst);
+          top_half_converted.set_value();
+        });
+        ConvertVisibleRows(data, stride, visible_rect, split_row,
+                           visible_rect.height - split_row, dst);
+        top_half_converted.get_future().wait();
+      }
+      const bool quarter_turn = IsQuarterTurn(rotation_);
+      frame.width = quarter_turn ? visible_rect.height : visible_rect.width;
+      frame.height = quarter_turn ? visible_rect.width : visible_rect.height;
+      frame.frame_id = GetCurrentFrameId();
+
+      // Publishes the frame and takes over the previously ready one. If that
+      // was never consumed, it is dropped.
+      const uint32_t previous = ready_frame_.exchange(
+          back_frame_ | kFreshFrameFlag, std::memory_order_acq_rel);
+      if (previous & kFreshFrameFlag) {
+        dropped_frame_count_.fetch_add(1, std::memory_order_relaxed);
+      }
+      back_frame_ = previous & kFrameIndexMask;
+    }
+    if (preview_stats_) {
+      preview_stats_->OnFrameConverted(PreviewStats::GetTimeUs() -
+                                       conversion_start_us);
     }
-    std::copy(data, data + data_length, source_buffer_.data());
   }
   OnBufferUpdated();
   return true;
-};
+}
+
+void TextureHandler::ConvertVisibleRows(const uint8_t* data, int32_t stride,
+                                        const PixelRect& visible_rect,
+                                        uint32_t first_row, uint32_t row_count,
+                                        uint8_t* dst) const {
+  assert(first_row % 2 == 0);
+
+  // Mirroring and rotation are done in software, while the frame is
+  // converted. IMFCapturePreviewSink also has the SetMirrorState setting,
+  // but if enabled, samples will not be processed.
+  //
+  // Only the visible region is converted, starting from its top left
+  // pixel. Its offsets are even, so NV12 chroma pairs stay aligned.
+  const uint32_t row = visible_rect.y + first_row;
+  const uint8_t* row_data = data + static_cast<ptrdiff_t>(row) * stride;
+
+  // The converted rows are a band of the rotated frame: rows for unrotated
+  // frames, from the bottom for half turns, and columns for quarter turns.
+  const uint32_t last_rows = visible_rect.height - first_row - row_count;
+  const size_t dst_width = IsQuarterTurn(rotation_) ? visible_rect.height
+                                                    : visible_rect.width;
+  const size_t dst_stride = dst_width * bytes_per_pixel_;
+  uint8_t* band_dst = dst;
+  switch (rotation_) {
+    case PreviewRotation::kNone:
+      band_dst += first_row * dst_stride;
+      break;
+    case PreviewRotation::kRotate180:
+      band_dst += last_rows * dst_stride;
+      break;
+    case PreviewRotation::kRotate90:
+      band_dst += last_rows * bytes_per_pixel_;
+      break;
+    case PreviewRotation::kRotate270:
+      band_dst += first_row * bytes_per_pixel_;
+      break;
+  }
+
+  if (pixel_format_ == PreviewPixelFormat::kNV12) {
+    const size_t row_pitch = static_cast<size_t>(stride);
+    const uint8_t* uv_plane = data + row_pitch * preview_frame_height_ +
+                              (row / 2) * row_pitch + visible_rect.x;
+    ConvertNV12ToRGBA(row_data + visible_rect.x, stride, uv_plane, stride,
+                      band_dst, static_cast<int32_t>(dst_stride),
+                      visible_rect.width, row_count, mirror_preview_,
+                      rotation_);
+  } else {
+    ConvertRGB32ToRGBA(row_data + visible_rect.x * bytes_per_pixel_, stride,
+                       band_dst, static_cast<int32_t>(dst_stride),
+                       visible_rect.width, row_count, mirror_preview_,
+                       rotation_);
+  }
+}
 
 // Marks texture frame available after buffer is updated.
 void TextureHandler::OnBufferUpdated() {
@@ -64,14 +322,16 @@ void TextureHandler::OnBufferUpdated() {
 
 const FlutterDesktopPixelBuffer* TextureHandler::ConvertPixelBufferForFlutter(
     size_t target_width, size_t target_height) {
-  // TODO: optimize image processing size by adjusting capture size
-  // dynamically to match target_width and target_height.
-  // If target size changes, create new media type for preview and set new
-  // target framesize to MF_MT_FRAME_SIZE attribute.
-  // Size should be kept inside requested resolution preset.
-  // Update output media type with IMFCaptureSink2::SetOutputMediaType method
-  // call and implement IMFCaptureEngineOnSampleCallback2::OnSynchronizedEvent
-  // to detect size changes.
+  CAMERA_TRACE_SCOPE("CopyPixelBuffer");
+  // Target size is used to adjust the capture size in adaptive preview mode.
+  requested_width_.store(static_cast<uint32_t>(target_width),
+                         std::memory_order_relaxed);
+  requested_height_.store(static_cast<uint32_t>(target_height),
+                          std::memory_order_relaxed);
+
+  if (unregistering_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
 
   // Lock buffer mutex to protect texture processing
   std::unique_lock<std::mutex> buffer_lock(buffer_mutex_);
@@ -79,66 +339,101 @@ const FlutterDesktopPixelBuffer* TextureHandler::ConvertPixelBufferForFlutter(
     return nullptr;
   }
 
-  const uint32_t bytes_per_pixel = 4;
-  const uint32_t pixels_total = preview_frame_width_ * preview_frame_height_;
-  const uint32_t data_size = pixels_total * bytes_per_pixel;
-  if (data_size > 0 && source_buffer_.size() == data_size) {
-    if (dest_buffer_.size() != data_size) {
-      dest_buffer_.resize(data_size);
-    }
-
-    // Map buffers to structs for easier conversion.
-    MFVideoFormatRGB32Pixel* src =
-        reinterpret_cast<MFVideoFormatRGB32Pixel*>(source_buffer_.data());
-    FlutterDesktopPixel* dst =
-        reinterpret_cast<FlutterDesktopPixel*>(dest_buffer_.data());
-
-    for (uint32_t y = 0; y < preview_frame_height_; y++) {
-      for (uint32_t x = 0; x < preview_frame_width_; x++) {
-        uint32_t sp = (y * preview_frame_width_) + x;
-        if (mirror_preview_) {
-          // Software mirror mode.
-          // IMFCapturePreviewSink also has the SetMirrorState setting,
-          // but if enabled, samples will not be processed.
-
-          // Calculates mirrored pixel position.
-          uint32_t tp =
-              (y * preview_frame_width_) + ((preview_frame_width_ - 1) - x);
-          dst[tp].r = src[sp].r;
-          dst[tp].g = src[sp].g;
-          dst[tp].b = src[sp].b;
-          dst[tp].a = 255;
-        } else {
-          dst[sp].r = src[sp].r;
-          dst[sp].g = src[sp].g;
-          dst[sp].b = src[sp].b;
-          dst[sp].a = 255;
-        }
-      }
-    }
+  // Takes the latest frame if the capture thread has published a new one.
+  if (ready_frame_.load(std::memory_order_acquire) & kFreshFrameFlag) {
+    front_frame_ =
+        ready_frame_.exchange(front_frame_, std::memory_order_acq_rel) &
+        kFrameIndexMask;
+  }
 
+  const PixelBufferFrame& frame = frames_[front_frame_];
+  if (!frame.data.empty()) {
     if (!flutter_desktop_pixel_buffer_) {
       flutter_desktop_pixel_buffer_ =
           std::make_unique<FlutterDesktopPixelBuffer>();
 
       // Unlocks mutex after texture is processed.
       flutter_desktop_pixel_buffer_->release_callback =
-          [](void* release_context) {
-            auto mutex = reinterpret_cast<std::mutex*>(release_context);
-            mutex->unlock();
-          };
+          &TextureHandler::ReleaseTexture;
     }
 
-    flutter_desktop_pixel_buffer_->buffer = dest_buffer_.data();
-    flutter_desktop_pixel_buffer_->width = preview_frame_width_;
-    flutter_desktop_pixel_buffer_->height = preview_frame_height_;
+    flutter_desktop_pixel_buffer_->buffer = frame.data.data();
+    flutter_desktop_pixel_buffer_->width = frame.width;
+    flutter_desktop_pixel_buffer_->height = frame.height;
+
+    rendered_frame_id_ = frame.frame_id;
+    if (preview_stats_ && rendered_frame_id_ > 0) {
+      preview_stats_->OnFrameRendered(rendered_frame_id_,
+                                      PreviewStats::GetTimeUs());
+    }
 
-    // Releases unique_lock and set mutex pointer for release context.
-    flutter_desktop_pixel_buffer_->release_context = buffer_lock.release();
+    // Releases unique_lock, the release callback unlocks the mutex.
+    buffer_lock.release();
+    flutter_desktop_pixel_buffer_->release_context = this;
 
     return flutter_desktop_pixel_buffer_.get();
   }
   return nullptr;
 }
 
+const FlutterDesktopGpuSurfaceDescriptor*
+TextureHandler::GetGpuSurfaceDescriptor(size_t target_width,
+                                        size_t target_height) {
+  // Target size is used to adjust the capture size in adaptive preview mode.
+  requested_width_.store(static_cast<uint32_t>(target_width),
+                         std::memory_order_relaxed);
+  requested_height_.store(static_cast<uint32_t>(target_height),
+                          std::memory_order_relaxed);
+
+  if (unregistering_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+
+  // Lock buffer mutex to keep the surface unchanged while it is used.
+  std::unique_lock<std::mutex> buffer_lock(buffer_mutex_);
+  if (!TextureRegistered() || !gpu_surface_renderer_ ||
+      !gpu_surface_renderer_->GetSharedHandle()) {
+    return nullptr;
+  }
+
+  if (!gpu_surface_descriptor_) {
+    gpu_surface_descriptor_ =
+        std::make_unique<FlutterDesktopGpuSurfaceDescriptor>();
+    gpu_surface_descriptor_->struct_size =
+        sizeof(FlutterDesktopGpuSurfaceDescriptor);
+    gpu_surface_descriptor_->format = kFlutterDesktopPixelFormatBGRA8888;
+
+    // Unlocks mutex after the surface is processed.
+    gpu_surface_descriptor_->release_callback = &TextureHandler::ReleaseTexture;
+  }
+
+  gpu_surface_descriptor_->handle = gpu_surface_renderer_->GetSharedHandle();
+  gpu_surface_descriptor_->width = gpu_surface_descriptor_->visible_width =
+      gpu_surface_renderer_->GetWidth();
+  gpu_surface_descriptor_->height = gpu_surface_descriptor_->visible_height =
+      gpu_surface_renderer_->GetHeight();
+
+  rendered_frame_id_ = gpu_surface_frame_id_;
+  if (preview_stats_ && rendered_frame_id_ > 0) {
+    preview_stats_->OnFrameRendered(rendered_frame_id_,
+                                    PreviewStats::GetTimeUs());
+  }
+
+  // Releases unique_lock, the release callback unlocks the mutex.
+  buffer_lock.release();
+  gpu_surface_descriptor_->release_context = this;
+
+  return gpu_surface_descriptor_.get();
+}
+
+// static
+void TextureHandler::ReleaseTexture(void* release_context) {
+  auto handler = reinterpret_cast<TextureHandler*>(release_context);
+  if (handler->preview_stats_ && handler->rendered_frame_id_ > 0) {
+    handler->preview_stats_->OnFrameReleased(handler->rendered_frame_id_,
+                                             PreviewStats::GetTimeUs());
+  }
+  handler->buffer_mutex_.unlock();
+}
+
 }  // namespace camera_windows
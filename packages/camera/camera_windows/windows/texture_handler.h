@@ -5,11 +5,21 @@
 #ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_TEXTURE_HANDLER_H_
 #define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_TEXTURE_HANDLER_H_
 
+#include <d3d11.h>
 #include <flutter/texture_registrar.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
+
+#include "capture_work_queue.h"
+#include "gpu_surface_renderer.h"
+#include "pixel_conversion.h"
+#include "preview_crop.h"
+#include "preview_stats.h"
 
 namespace camera_windows {
 
@@ -33,6 +43,11 @@ struct MFVideoFormatRGB32Pixel {
 // conversion of texture formats.
 class TextureHandler {
  public:
+  // Frames with at least this many visible pixels are converted in two
+  // halves, one of them on a conversion thread, to shorten the time the
+  // capture thread spends on each frame.
+  static constexpr uint32_t kParallelConversionMinPixels = 1920 * 1080;
+
   TextureHandler(flutter::TextureRegistrar* texture_registrar)
       : texture_registrar_(texture_registrar) {}
   virtual ~TextureHandler();
@@ -41,8 +56,43 @@ class TextureHandler {
   TextureHandler(TextureHandler const&) = delete;
   TextureHandler& operator=(TextureHandler const&) = delete;
 
-  // Updates source data buffer with given data.
-  bool UpdateBuffer(uint8_t* data, uint32_t data_length);
+  // Unregisters the texture of |handler| without waiting for Flutter to
+  // release the frame it is reading, and destroys |handler| once the texture
+  // is unregistered.
+  //
+  // The texture stops being updated and rendered immediately. Destroying a
+  // registered handler directly instead blocks until the raster thread has
+  // released its frame.
+  static void UnregisterAndDestroy(std::unique_ptr<TextureHandler> handler);
+
+  // Converts the given frame of the current pixel format into the texture
+  // buffer. Flutter reads the converted frame without converting it again.
+  //
+  // data:        First byte of the top row of the frame. For NV12 frames, the
+  //              chroma plane directly follows the luma plane.
+  // data_length: Number of bytes readable from |data| in the direction of
+  //              |stride|.
+  // stride:      Distance in bytes between the starts of two rows, negative
+  //              for bottom-up RGB32 frames, or 0 if the rows are tightly
+  //              packed.
+  bool UpdateBuffer(const uint8_t* data, uint32_t data_length,
+                    int32_t stride);
+
+  // Updates the GPU surface from a captured D3D11 texture.
+  //
+  // Returns false if the GPU surface is not in use or the texture cannot be
+  // rendered, in which case the frame should be delivered via |UpdateBuffer|.
+  bool UpdateTexture(ID3D11Texture2D* texture, UINT subresource_index);
+
+  // Switches the texture to a GPU surface rendered with the given device.
+  //
+  // Must be called before |RegisterTexture|. Returns false if the device
+  // cannot render shared surfaces or the texture is already registered, in
+  // which case the pixel buffer texture is used.
+  bool EnableGpuSurface(ID3D11Device* device);
+
+  // Returns true if the texture is a GPU surface.
+  bool IsGpuSurfaceEnabled() const { return gpu_surface_renderer_ != nullptr; }
 
   // Registers texture and updates given texture_id pointer value.
   int64_t RegisterTexture();
@@ -53,37 +103,174 @@ class TextureHandler {
     preview_frame_height_ = height;
   }
 
+  // Sets the pixel format of the frames passed to |UpdateBuffer|.
+  void SetPixelFormat(PreviewPixelFormat pixel_format) {
+    pixel_format_ = pixel_format;
+  }
+
   // Sets software mirror state.
   void SetMirrorPreviewState(bool mirror) { mirror_preview_ = mirror; }
 
+  // Sets the clockwise rotation of the texture, applied after mirroring.
+  // Frames are rotated as they are converted or rendered, and quarter turns
+  // swap the width and height of the texture.
+  //
+  // Can be called from any thread; the change applies from the next frame.
+  // Returns false if the GPU surface is in use and cannot rotate frames.
+  bool SetRotation(PreviewRotation rotation);
+
+  // Sets the region of the frames shown in the texture. Only the region is
+  // converted, and the texture has the size of the region.
+  //
+  // Can be called from any thread; the change applies from the next frame.
+  void SetCrop(const PreviewCropRect& crop, double zoom_level);
+
+  // Returns the size of the region of the last updated frame shown in the
+  // texture, before it is rotated. Called on the capture thread.
+  uint32_t GetVisibleWidth() const { return visible_width_; }
+  uint32_t GetVisibleHeight() const { return visible_height_; }
+
+  // Sets the stats that record when Flutter reads and releases each frame.
+  // The frames are identified by |PreviewStats::GetLastReceivedFrameId| when
+  // they are updated.
+  //
+  // Must be called before |RegisterTexture|. The stats are shared, as the
+  // texture handler may outlive their owner until its texture is
+  // unregistered.
+  void SetPreviewStats(std::shared_ptr<PreviewStats> preview_stats) {
+    preview_stats_ = std::move(preview_stats);
+  }
+
+  // Returns the width Flutter last requested the texture at, or 0 if the
+  // texture has not been rendered yet.
+  uint32_t GetRequestedWidth() const {
+    return requested_width_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the height Flutter last requested the texture at, or 0 if the
+  // texture has not been rendered yet.
+  uint32_t GetRequestedHeight() const {
+    return requested_height_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the number of converted frames that were replaced by a newer frame
+  // before Flutter consumed them.
+  uint64_t GetDroppedFrameCount() const {
+    return dropped_frame_count_.load(std::memory_order_relaxed);
+  }
+
  private:
   // Informs flutter texture registrar of updated texture.
   void OnBufferUpdated();
 
-  // Converts local pixel buffer to flutter pixel buffer.
+  // Converts |row_count| rows of the visible region of a frame passed to
+  // |UpdateBuffer|, starting at its row |first_row|, into the pixels of |dst|
+  // they are rotated to. |first_row| must be even. Called with
+  // |capture_mutex_| held.
+  void ConvertVisibleRows(const uint8_t* data, int32_t stride,
+                          const PixelRect& visible_rect, uint32_t first_row,
+                          uint32_t row_count, uint8_t* dst) const;
+
+  // Returns the converted pixel buffer for flutter.
   const FlutterDesktopPixelBuffer* ConvertPixelBufferForFlutter(size_t width,
                                                                 size_t height);
 
+  // Returns the descriptor of the rendered GPU surface.
+  const FlutterDesktopGpuSurfaceDescriptor* GetGpuSurfaceDescriptor(
+      size_t width, size_t height);
+
+  // Records the release of the texture read by Flutter and unlocks
+  // |buffer_mutex_|. Used as the release callback of the texture.
+  static void ReleaseTexture(void* release_context);
+
+  // Returns the id of the latest received frame, or 0 if preview stats are
+  // disabled.
+  uint64_t GetCurrentFrameId() const {
+    return preview_stats_ ? preview_stats_->GetLastReceivedFrameId() : 0;
+  }
+
+  // Returns the region of the current frame size shown in the texture, and
+  // records its size. Called with |capture_mutex_| held.
+  PixelRect UpdateVisibleRect();
+
   // Checks if texture registrar, texture id and texture are available.
   bool TextureRegistered() {
-    return texture_registrar_ && texture_ && texture_id_ > -1;
+    return texture_registrar_ && texture_ && texture_id_ > -1 &&
+           !unregistering_.load(std::memory_order_acquire);
   }
 
+  // A converted frame in flutter desktop pixel format.
+  struct PixelBufferFrame {
+    std::vector<uint8_t> data;
+    uint32_t width = 0;
+    uint32_t height = 0;
+
+    // Id of the frame in |preview_stats_|, or 0 if stats are disabled.
+    uint64_t frame_id = 0;
+  };
+
+  // Bits of |ready_frame_| holding the frame index.
+  static constexpr uint32_t kFrameIndexMask = 0x3;
+  // Bit of |ready_frame_| set until the consumer takes the frame.
+  static constexpr uint32_t kFreshFrameFlag = 0x4;
+
   bool mirror_preview_ = true;
+  PreviewPixelFormat pixel_format_ = PreviewPixelFormat::kRGB32;
   int64_t texture_id_ = -1;
   uint32_t bytes_per_pixel_ = 4;
-  uint32_t source_buffer_size_ = 0;
   uint32_t preview_frame_width_ = 0;
   uint32_t preview_frame_height_ = 0;
 
-  std::vector<uint8_t> source_buffer_;
-  std::vector<uint8_t> dest_buffer_;
+  // Crop and rotation of the frames. Guarded by |capture_mutex_|.
+  PreviewCropRect crop_;
+  double zoom_level_ = kMinPreviewZoomLevel;
+  PreviewRotation rotation_ = PreviewRotation::kNone;
+
+  // Size of the region of the last updated frame. Capture thread only.
+  uint32_t visible_width_ = 0;
+  uint32_t visible_height_ = 0;
+
+  // Converted frames are handed from the capture thread to the raster thread
+  // through a lock-free triple buffer. The capture thread only writes to
+  // |back_frame_| and the raster thread only reads |front_frame_|. Completed
+  // frames are swapped through |ready_frame_|, so a frame that has not been
+  // consumed yet is replaced instead of waited on.
+  std::array<PixelBufferFrame, 3> frames_;
+  uint32_t back_frame_ = 0;
+  uint32_t front_frame_ = 1;
+  std::atomic<uint32_t> ready_frame_{2};
+  std::atomic<uint64_t> dropped_frame_count_{0};
+  // Converts the top half of large frames while the capture thread converts
+  // the bottom half. Created with the first large frame. Capture thread only.
+  std::unique_ptr<CaptureWorkQueue> conversion_queue_;
+  std::atomic<uint32_t> requested_width_{0};
+  std::atomic<uint32_t> requested_height_{0};
+
   std::unique_ptr<flutter::TextureVariant> texture_;
   std::unique_ptr<FlutterDesktopPixelBuffer> flutter_desktop_pixel_buffer_ =
       nullptr;
+  std::unique_ptr<GpuSurfaceRenderer> gpu_surface_renderer_;
+  std::shared_ptr<PreviewStats> preview_stats_;
+
+  // Ids of the frame shown on the GPU surface and of the frame last read by
+  // Flutter. Guarded by |buffer_mutex_|.
+  uint64_t gpu_surface_frame_id_ = 0;
+  uint64_t rendered_frame_id_ = 0;
+  std::unique_ptr<FlutterDesktopGpuSurfaceDescriptor>
+      gpu_surface_descriptor_ = nullptr;
   flutter::TextureRegistrar* texture_registrar_ = nullptr;
 
+  // Set by |UnregisterAndDestroy|, after which the texture is no longer
+  // updated or rendered.
+  std::atomic<bool> unregistering_{false};
+
+  // Held by the raster thread while Flutter reads the texture, and by the
+  // capture thread while it renders the GPU surface.
   std::mutex buffer_mutex_;
+
+  // Serializes capture thread updates with destruction. Never held by the
+  // raster thread.
+  std::mutex capture_mutex_;
 };
 
 }  // namespace camera_windows
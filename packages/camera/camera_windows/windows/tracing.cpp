@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tracing.h"
+
+namespace camera_windows {
+
+// The provider id is derived from the provider name, so that tracing tools
+// can enable it as "*Flutter.Camera.Windows".
+TRACELOGGING_DEFINE_PROVIDER(
+    g_camera_trace_provider, "Flutter.Camera.Windows",
+    // {ef4d3c67-380f-5d1f-5fee-c69d5439f132}
+    (0xef4d3c67, 0x380f, 0x5d1f, 0x5f, 0xee, 0xc6, 0x9d, 0x54, 0x39, 0xf1,
+     0x32));
+
+namespace {
+
+windows_plugin_utils::TraceProviderRegistration& GetRegistration() {
+  static windows_plugin_utils::TraceProviderRegistration registration(
+      g_camera_trace_provider);
+  return registration;
+}
+
+}  // namespace
+
+void RegisterTraceProvider() { GetRegistration().Register(); }
+
+void UnregisterTraceProvider() { GetRegistration().Unregister(); }
+
+}  // namespace camera_windows
@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "zero_shutter_lag_buffer.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+namespace camera_windows {
+
+ZeroShutterLagBuffer::ZeroShutterLagBuffer(size_t capacity)
+    : frames_(capacity) {
+  assert(capacity > 0);
+}
+
+bool ZeroShutterLagBuffer::AddFrame(const uint8_t* data, uint32_t data_length,
+                                    int32_t stride, uint32_t width,
+                                    uint32_t height, PreviewPixelFormat format,
+                                    uint64_t timestamp_us) {
+  const bool is_nv12 = format == PreviewPixelFormat::kNV12;
+
+  // NV12 chroma rows have the same size as the luma rows, rounded up.
+  const uint32_t row_size = is_nv12 ? GetNV12UVPlaneRowSize(width) : width * 4;
+  const uint32_t row_count =
+      is_nv12 ? height + GetNV12UVPlaneHeight(height) : height;
+  if (stride == 0) {
+    stride = static_cast<int32_t>(row_size);
+  }
+  const uint32_t row_pitch = static_cast<uint32_t>(std::abs(stride));
+  if (!data || width == 0 || height == 0 || row_pitch < row_size ||
+      (is_nv12 && stride < 0) ||
+      data_length < row_pitch * (row_count - 1) + row_size) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  BufferedFrame& frame = frames_[next_frame_];
+
+  // Reuses the allocation of the overwritten frame.
+  frame.bytes.resize(static_cast<size_t>(row_size) * row_count);
+  for (uint32_t y = 0; y < row_count; y++) {
+    std::memcpy(frame.bytes.data() + static_cast<size_t>(y) * row_size,
+                data + static_cast<ptrdiff_t>(y) * stride, row_size);
+  }
+  frame.format = format;
+  frame.width = width;
+  frame.height = height;
+  frame.timestamp_us = timestamp_us;
+
+  next_frame_ = (next_frame_ + 1) % frames_.size();
+  if (frame_count_ < frames_.size()) {
+    frame_count_++;
+  }
+  return true;
+}
+
+bool ZeroShutterLagBuffer::GetClosestFrame(uint64_t shutter_time_us,
+                                           BufferedFrame* frame) const {
+  assert(frame);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const BufferedFrame* closest = nullptr;
+  uint64_t closest_distance = 0;
+  for (size_t i = 0; i < frame_count_; i++) {
+    const BufferedFrame& candidate = frames_[i];
+    const uint64_t distance = candidate.timestamp_us > shutter_time_us
+                                  ? candidate.timestamp_us - shutter_time_us
+                                  : shutter_time_us - candidate.timestamp_us;
+    if (!closest || distance < closest_distance) {
+      closest = &candidate;
+      closest_distance = distance;
+    }
+  }
+
+  if (!closest) {
+    return false;
+  }
+  *frame = *closest;
+  return true;
+}
+
+void ZeroShutterLagBuffer::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  next_frame_ = 0;
+  frame_count_ = 0;
+}
+
+}  // namespace camera_windows
@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_ZERO_SHUTTER_LAG_BUFFER_H_
+#define PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_ZERO_SHUTTER_LAG_BUFFER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "pixel_conversion.h"
+
+namespace camera_windows {
+
+// A preview frame kept by a |ZeroShutterLagBuffer|.
+struct BufferedFrame {
+  // Tightly packed, top-down frame data. NV12 frames hold the chroma plane
+  // directly after the luma plane, and both planes use rows of
+  // |GetNV12UVPlaneRowSize| bytes.
+  std::vector<uint8_t> bytes;
+  PreviewPixelFormat format = PreviewPixelFormat::kRGB32;
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  // Presentation time of the frame in microseconds.
+  uint64_t timestamp_us = 0;
+};
+
+// Keeps copies of the most recent preview frames, so that a photo can be
+// taken from a frame captured before the shutter was pressed.
+//
+// Frames are added from the sample thread and read from the platform thread.
+class ZeroShutterLagBuffer {
+ public:
+  // capacity: Number of frames kept. Older frames are overwritten.
+  explicit ZeroShutterLagBuffer(size_t capacity);
+  virtual ~ZeroShutterLagBuffer() = default;
+
+  // Prevent copying.
+  ZeroShutterLagBuffer(ZeroShutterLagBuffer const&) = delete;
+  ZeroShutterLagBuffer& operator=(ZeroShutterLagBuffer const&) = delete;
+
+  // Copies a preview frame into the buffer, replacing the oldest frame if
+  // the buffer is full.
+  //
+  // Returns false if |data_length| is too small for the frame.
+  //
+  // data:         First byte of the top row of the frame.
+  // data_length:  Number of bytes readable from |data|.
+  // stride:       Distance in bytes between the starts of two rows, negative
+  //               for bottom-up frames, or 0 if the rows are tightly packed.
+  //               Must not be negative for NV12 frames.
+  // timestamp_us: Presentation time of the frame in microseconds.
+  bool AddFrame(const uint8_t* data, uint32_t data_length, int32_t stride,
+                uint32_t width, uint32_t height, PreviewPixelFormat format,
+                uint64_t timestamp_us);
+
+  // Copies the frame with the timestamp closest to |shutter_time_us| to
+  // |frame|.
+  //
+  // Returns false if the buffer is empty.
+  bool GetClosestFrame(uint64_t shutter_time_us, BufferedFrame* frame) const;
+
+  // Removes all frames, for example after the preview size changed.
+  void Clear();
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<BufferedFrame> frames_;
+  size_t next_frame_ = 0;
+  size_t frame_count_ = 0;
+};
+
+}  // namespace camera_windows
+
+#endif  // PACKAGES_CAMERA_CAMERA_WINDOWS_WINDOWS_ZERO_SHUTTER_LAG_BUFFER_H_
@@ -23,7 +23,9 @@
   plugin.documentPickerViewControllerOverride = picker;
   plugin.presentingViewControllerOverride = mockPresentingVC;
 
-  [plugin openFileSelectorWithConfig:[FFSFileSelectorConfig makeWithUtis:@[] allowMultiSelection:NO]
+  [plugin openFileSelectorWithConfig:[FFSFileSelectorConfig makeWithUtis:@[]
+                                                     allowMultiSelection:NO
+                                                             openInPlace:NO]
                           completion:^(NSArray<NSString *> *paths, FlutterError *error){
                           }];
 
@@ -33,6 +35,25 @@
                                                    completion:[OCMArg any]]);
 }
 
+- (void)testPickerOpensFilesInPlace {
+  FFSFileSelectorPlugin *plugin = [[FFSFileSelectorPlugin alloc] init];
+  id mockPresentingVC = OCMClassMock([UIViewController class]);
+  plugin.presentingViewControllerOverride = mockPresentingVC;
+
+  [plugin openFileSelectorWithConfig:[FFSFileSelectorConfig makeWithUtis:@[ @"public.data" ]
+                                                     allowMultiSelection:NO
+                                                             openInPlace:YES]
+                          completion:^(NSArray<NSString *> *paths, FlutterError *error){
+                          }];
+
+  OCMVerify(times(1), [mockPresentingVC
+                          presentViewController:[OCMArg checkWithBlock:^BOOL(id picker) {
+                            return [picker documentPickerMode] == UIDocumentPickerModeOpen;
+                          }]
+                                       animated:[OCMArg any]
+                                     completion:[OCMArg any]]);
+}
+
 - (void)testReturnsPickedFiles {
   FFSFileSelectorPlugin *plugin = [[FFSFileSelectorPlugin alloc] init];
   XCTestExpectation *completionWasCalled = [self expectationWithDescription:@"completion"];
@@ -41,7 +62,8 @@
                                                              inMode:UIDocumentPickerModeImport];
   plugin.documentPickerViewControllerOverride = picker;
   [plugin openFileSelectorWithConfig:[FFSFileSelectorConfig makeWithUtis:@[]
-                                                     allowMultiSelection:YES]
+                                                     allowMultiSelection:YES
+                                                             openInPlace:NO]
                           completion:^(NSArray<NSString *> *paths, FlutterError *error) {
                             NSArray *expectedPaths = @[ @"/file1.txt", @"/file2.txt" ];
                             XCTAssertEqualObjects(paths, expectedPaths);
@@ -62,7 +84,9 @@
   plugin.documentPickerViewControllerOverride = picker;
 
   XCTestExpectation *completionWasCalled = [self expectationWithDescription:@"completion"];
-  [plugin openFileSelectorWithConfig:[FFSFileSelectorConfig makeWithUtis:@[] allowMultiSelection:NO]
+  [plugin openFileSelectorWithConfig:[FFSFileSelectorConfig makeWithUtis:@[]
+                                                     allowMultiSelection:NO
+                                                             openInPlace:NO]
                           completion:^(NSArray<NSString *> *paths, FlutterError *error) {
                             XCTAssertEqual(paths.count, 0);
                             [completionWasCalled fulfill];
@@ -71,4 +95,58 @@
   [self waitForExpectationsWithTimeout:1.0 handler:nil];
 }
 
+- (void)testCopyFileCopiesContentsAndReportsProgress {
+  FFSFileSelectorPlugin *plugin = [[FFSFileSelectorPlugin alloc] init];
+  id mockFlutterApi = OCMClassMock([FFSFileSelectorFlutterApi class]);
+  plugin.flutterApi = mockFlutterApi;
+  NSMutableArray<NSNumber *> *fractions = [NSMutableArray array];
+  OCMStub([mockFlutterApi copyProgressForPath:[OCMArg any]
+                            fractionCompleted:0
+                                   completion:[OCMArg any]])
+      .ignoringNonObjectArgs()
+      .andDo(^(NSInvocation *invocation) {
+        double fraction;
+        [invocation getArgument:&fraction atIndex:3];
+        [fractions addObject:@(fraction)];
+      });
+
+  // Larger than a copy chunk, so that intermediate progress is reported.
+  NSMutableData *contents = [NSMutableData dataWithLength:3 * 1024 * 1024 + 1];
+  ((uint8_t *)contents.mutableBytes)[contents.length - 1] = 0x42;
+  NSString *fileName = [NSString stringWithFormat:@"%@.bin", [NSUUID UUID].UUIDString];
+  NSString *sourcePath = [NSTemporaryDirectory() stringByAppendingPathComponent:fileName];
+  XCTAssertTrue([contents writeToFile:sourcePath atomically:YES]);
+
+  XCTestExpectation *completionWasCalled = [self expectationWithDescription:@"completion"];
+  [plugin copyFileAtPath:sourcePath
+              completion:^(NSString *copyPath, FlutterError *error) {
+                XCTAssertNil(error);
+                XCTAssertNotEqualObjects(copyPath, sourcePath);
+                XCTAssertEqualObjects(copyPath.lastPathComponent, sourcePath.lastPathComponent);
+                XCTAssertEqualObjects([NSData dataWithContentsOfFile:copyPath], contents);
+                [completionWasCalled fulfill];
+              }];
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+
+  XCTAssertGreaterThan(fractions.count, 1);
+  XCTAssertLessThan(fractions.firstObject.doubleValue, 1.0);
+  XCTAssertEqual(fractions.lastObject.doubleValue, 1.0);
+  OCMVerify([mockFlutterApi copyProgressForPath:sourcePath
+                              fractionCompleted:1.0
+                                     completion:[OCMArg any]]);
+}
+
+- (void)testCopyFileFailsForMissingFile {
+  FFSFileSelectorPlugin *plugin = [[FFSFileSelectorPlugin alloc] init];
+
+  XCTestExpectation *completionWasCalled = [self expectationWithDescription:@"completion"];
+  [plugin copyFileAtPath:@"/does/not/exist.txt"
+              completion:^(NSString *copyPath, FlutterError *error) {
+                XCTAssertNil(copyPath);
+                XCTAssertEqualObjects(error.code, @"copy_failed");
+                [completionWasCalled fulfill];
+              }];
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+}
+
 @end
@@ -8,8 +8,28 @@
 
 #import <objc/runtime.h>
 
+/// The size of the chunks that files are copied in.
+static const NSUInteger kCopyChunkSize = 1024 * 1024;
+
+/// The change of the copied fraction of a file after which progress is reported again.
+static const double kCopyProgressStep = 0.01;
+
+@interface FFSFileSelectorPlugin ()
+/// The security-scoped URLs of the files opened in place, by path. Access to them is kept so that
+/// the files can still be read from Dart.
+@property(nonatomic) NSMutableDictionary<NSString *, NSURL *> *securityScopedURLs;
+@end
+
 @implementation FFSFileSelectorPlugin
 
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _securityScopedURLs = [NSMutableDictionary dictionary];
+  }
+  return self;
+}
+
 #pragma mark - FFSFileSelectorApi
 
 - (void)openFileSelectorWithConfig:(FFSFileSelectorConfig *)config
@@ -19,7 +39,8 @@
       self.documentPickerViewControllerOverride
           ?: [[UIDocumentPickerViewController alloc]
                  initWithDocumentTypes:config.utis
-                                inMode:UIDocumentPickerModeImport];
+                                inMode:(config.openInPlace ? UIDocumentPickerModeOpen
+                                                           : UIDocumentPickerModeImport)];
   documentPicker.delegate = self;
   documentPicker.allowsMultipleSelection = config.allowMultiSelection;
 
@@ -37,10 +58,65 @@
   }
 }
 
+- (void)copyFileAtPath:(NSString *)path
+            completion:(void (^)(NSString *_Nullable, FlutterError *_Nullable))completion {
+  NSURL *sourceURL = self.securityScopedURLs[path] ?: [NSURL fileURLWithPath:path];
+  NSURL *destinationDirectory = [[NSURL fileURLWithPath:NSTemporaryDirectory()]
+      URLByAppendingPathComponent:[NSUUID UUID].UUIDString
+                      isDirectory:YES];
+  NSURL *destinationURL = [destinationDirectory URLByAppendingPathComponent:path.lastPathComponent];
+  FFSFileSelectorFlutterApi *flutterApi = self.flutterApi;
+  void (^progressHandler)(double) = ^(double fractionCompleted) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [flutterApi copyProgressForPath:path
+                    fractionCompleted:fractionCompleted
+                           completion:^(FlutterError *_Nullable error){
+                           }];
+    });
+  };
+
+  // A coordinated read waits for the file to be available, which includes downloading it if it is
+  // in iCloud Drive, so the copy is done in the background.
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+    __block NSError *copyError;
+    NSError *coordinationError;
+    NSFileCoordinator *coordinator = [[NSFileCoordinator alloc] initWithFilePresenter:nil];
+    [coordinator coordinateReadingItemAtURL:sourceURL
+                                    options:NSFileCoordinatorReadingWithoutChanges
+                                      error:&coordinationError
+                                 byAccessor:^(NSURL *readURL) {
+                                   NSError *error;
+                                   if (![[NSFileManager defaultManager]
+                                                 createDirectoryAtURL:destinationDirectory
+                                           withIntermediateDirectories:YES
+                                                           attributes:nil
+                                                                error:&error] ||
+                                       ![FFSFileSelectorPlugin copyFileAtURL:readURL
+                                                                       toURL:destinationURL
+                                                             progressHandler:progressHandler
+                                                                       error:&error]) {
+                                     copyError = error;
+                                   }
+                                 }];
+    NSError *failure = coordinationError ?: copyError;
+    dispatch_async(dispatch_get_main_queue(), ^{
+      if (failure) {
+        completion(nil, [FlutterError errorWithCode:@"copy_failed"
+                                            message:failure.localizedDescription
+                                            details:failure.domain]);
+      } else {
+        completion(destinationURL.path, nil);
+      }
+    });
+  });
+}
+
 #pragma mark - FlutterPlugin
 
 + (void)registerWithRegistrar:(NSObject<FlutterPluginRegistrar> *)registrar {
   FFSFileSelectorPlugin *plugin = [[FFSFileSelectorPlugin alloc] init];
+  plugin.flutterApi =
+      [[FFSFileSelectorFlutterApi alloc] initWithBinaryMessenger:registrar.messenger];
   SetUpFFSFileSelectorApi(registrar.messenger, plugin);
 }
 
@@ -50,6 +126,11 @@
     didPickDocumentsAtURLs:(NSArray<NSURL *> *)urls {
   NSMutableArray *paths = [NSMutableArray arrayWithCapacity:urls.count];
   for (NSURL *url in urls) {
+    // Files opened in place can only be read while their security-scoped resource is accessed.
+    if (controller.documentPickerMode == UIDocumentPickerModeOpen &&
+        self.securityScopedURLs[url.path] == nil && [url startAccessingSecurityScopedResource]) {
+      self.securityScopedURLs[url.path] = url;
+    }
     [paths addObject:url.path];
   };
   [self sendBackResults:paths error:nil forPicker:controller];
@@ -61,6 +142,71 @@
 
 #pragma mark - Helper Methods
 
+/**
+ * Copies the file at |sourceURL| to |destinationURL| in chunks, calling |progressHandler| with the
+ * fraction of the file that has been copied as the copy progresses.
+ */
++ (BOOL)copyFileAtURL:(NSURL *)sourceURL
+              toURL:(NSURL *)destinationURL
+    progressHandler:(void (^)(double))progressHandler
+              error:(NSError **)error {
+  NSNumber *fileSize;
+  [sourceURL getResourceValue:&fileSize forKey:NSURLFileSizeKey error:nil];
+  NSInputStream *input = [NSInputStream inputStreamWithURL:sourceURL];
+  NSOutputStream *output = [NSOutputStream outputStreamWithURL:destinationURL append:NO];
+  [input open];
+  [output open];
+
+  NSMutableData *buffer = [NSMutableData dataWithLength:kCopyChunkSize];
+  uint8_t *bytes = buffer.mutableBytes;
+  unsigned long long copiedSize = 0;
+  double reportedFraction = 0;
+  NSError *streamError;
+  while (streamError == nil) {
+    NSInteger readSize = [input read:bytes maxLength:kCopyChunkSize];
+    if (readSize < 0) {
+      streamError = input.streamError ?: [NSError errorWithDomain:NSCocoaErrorDomain
+                                                             code:NSFileReadUnknownError
+                                                         userInfo:nil];
+      break;
+    }
+    if (readSize == 0) {
+      break;
+    }
+    for (NSInteger writtenSize = 0; writtenSize < readSize;) {
+      NSInteger result = [output write:bytes + writtenSize maxLength:readSize - writtenSize];
+      if (result <= 0) {
+        streamError = output.streamError ?: [NSError errorWithDomain:NSCocoaErrorDomain
+                                                                code:NSFileWriteUnknownError
+                                                            userInfo:nil];
+        break;
+      }
+      writtenSize += result;
+    }
+    copiedSize += readSize;
+    if (fileSize.unsignedLongLongValue > 0) {
+      double fraction = MIN(1.0, (double)copiedSize / fileSize.unsignedLongLongValue);
+      if (fraction - reportedFraction >= kCopyProgressStep) {
+        reportedFraction = fraction;
+        progressHandler(fraction);
+      }
+    }
+  }
+  [input close];
+  [output close];
+
+  if (streamError) {
+    if (error) {
+      *error = streamError;
+    }
+    return NO;
+  }
+  if (reportedFraction < 1.0) {
+    progressHandler(1.0);
+  }
+  return YES;
+}
+
 - (void)sendBackResults:(NSArray<NSString *> *)results
                   error:(FlutterError *)error
               forPicker:(UIDocumentPickerViewController *)picker {
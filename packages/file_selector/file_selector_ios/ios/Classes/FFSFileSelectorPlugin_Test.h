@@ -19,4 +19,9 @@
  */
 @property(nonatomic) UIDocumentPickerViewController *_Nullable documentPickerViewControllerOverride;
 
+/**
+ * The API used to report the progress of file copies.
+ */
+@property(nonatomic) FFSFileSelectorFlutterApi *_Nullable flutterApi;
+
 @end
@@ -19,9 +19,13 @@ NS_ASSUME_NONNULL_BEGIN
 /// `init` unavailable to enforce nonnull fields, see the `make` class method.
 - (instancetype)init NS_UNAVAILABLE;
 + (instancetype)makeWithUtis:(NSArray<NSString *> *)utis
-         allowMultiSelection:(BOOL)allowMultiSelection;
+         allowMultiSelection:(BOOL)allowMultiSelection
+                 openInPlace:(BOOL)openInPlace;
 @property(nonatomic, copy) NSArray<NSString *> *utis;
 @property(nonatomic, assign) BOOL allowMultiSelection;
+/// Whether picked files are opened in place, instead of being copied into
+/// the app's Inbox before they are returned.
+@property(nonatomic, assign) BOOL openInPlace;
 @end
 
 /// The codec used by FFSFileSelectorApi.
@@ -31,9 +35,27 @@ NSObject<FlutterMessageCodec> *FFSFileSelectorApiGetCodec(void);
 - (void)openFileSelectorWithConfig:(FFSFileSelectorConfig *)config
                         completion:(void (^)(NSArray<NSString *> *_Nullable,
                                              FlutterError *_Nullable))completion;
+/// Copies the file at [path] into the app's temporary directory, and returns
+/// the path of the copy.
+///
+/// The progress of the copy is sent to [FileSelectorFlutterApi.copyProgress].
+- (void)copyFileAtPath:(NSString *)path
+            completion:(void (^)(NSString *_Nullable, FlutterError *_Nullable))completion;
 @end
 
 extern void SetUpFFSFileSelectorApi(id<FlutterBinaryMessenger> binaryMessenger,
                                     NSObject<FFSFileSelectorApi> *_Nullable api);
 
+/// The codec used by FFSFileSelectorFlutterApi.
+NSObject<FlutterMessageCodec> *FFSFileSelectorFlutterApiGetCodec(void);
+
+/// Receives the progress of copies started by [FileSelectorApi.copyFile].
+@interface FFSFileSelectorFlutterApi : NSObject
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger;
+/// Called when the copy of the file at [path] has made progress.
+- (void)copyProgressForPath:(NSString *)path
+          fractionCompleted:(double)fractionCompleted
+                 completion:(void (^)(FlutterError *_Nullable))completion;
+@end
+
 NS_ASSUME_NONNULL_END
@@ -37,16 +37,19 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 
 @implementation FFSFileSelectorConfig
 + (instancetype)makeWithUtis:(NSArray<NSString *> *)utis
-         allowMultiSelection:(BOOL)allowMultiSelection {
+         allowMultiSelection:(BOOL)allowMultiSelection
+                 openInPlace:(BOOL)openInPlace {
   FFSFileSelectorConfig *pigeonResult = [[FFSFileSelectorConfig alloc] init];
   pigeonResult.utis = utis;
   pigeonResult.allowMultiSelection = allowMultiSelection;
+  pigeonResult.openInPlace = openInPlace;
   return pigeonResult;
 }
 + (FFSFileSelectorConfig *)fromList:(NSArray *)list {
   FFSFileSelectorConfig *pigeonResult = [[FFSFileSelectorConfig alloc] init];
   pigeonResult.utis = GetNullableObjectAtIndex(list, 0);
   pigeonResult.allowMultiSelection = [GetNullableObjectAtIndex(list, 1) boolValue];
+  pigeonResult.openInPlace = [GetNullableObjectAtIndex(list, 2) boolValue];
   return pigeonResult;
 }
 + (nullable FFSFileSelectorConfig *)nullableFromList:(NSArray *)list {
@@ -56,6 +59,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   return @[
     self.utis ?: [NSNull null],
     @(self.allowMultiSelection),
+    @(self.openInPlace),
   ];
 }
 @end
@@ -133,4 +137,76 @@ void SetUpFFSFileSelectorApi(id<FlutterBinaryMessenger> binaryMessenger,
       [channel setMessageHandler:nil];
     }
   }
+  /// Copies the file at [path] into the app's temporary directory, and returns
+  /// the path of the copy.
+  ///
+  /// The progress of the copy is sent to [FileSelectorFlutterApi.copyProgress].
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.file_selector_ios.FileSelectorApi.copyFile"
+        binaryMessenger:binaryMessenger
+                  codec:FFSFileSelectorApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(copyFileAtPath:completion:)],
+                @"FFSFileSelectorApi api (%@) doesn't respond to "
+                @"@selector(copyFileAtPath:completion:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSString *arg_path = GetNullableObjectAtIndex(args, 0);
+        [api copyFileAtPath:arg_path
+                 completion:^(NSString *_Nullable output, FlutterError *_Nullable error) {
+                   callback(wrapResult(output, error));
+                 }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+}
+NSObject<FlutterMessageCodec> *FFSFileSelectorFlutterApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  return sSharedObject;
+}
+
+@interface FFSFileSelectorFlutterApi ()
+@property(nonatomic, strong) NSObject<FlutterBinaryMessenger> *binaryMessenger;
+@end
+
+@implementation FFSFileSelectorFlutterApi
+
+- (instancetype)initWithBinaryMessenger:(NSObject<FlutterBinaryMessenger> *)binaryMessenger {
+  self = [super init];
+  if (self) {
+    _binaryMessenger = binaryMessenger;
+  }
+  return self;
+}
+- (void)copyProgressForPath:(NSString *)arg_path
+          fractionCompleted:(double)arg_fractionCompleted
+                 completion:(void (^)(FlutterError *_Nullable))completion {
+  FlutterBasicMessageChannel *channel = [FlutterBasicMessageChannel
+      messageChannelWithName:
+          @"dev.flutter.pigeon.file_selector_ios.FileSelectorFlutterApi.copyProgress"
+             binaryMessenger:self.binaryMessenger
+                       codec:FFSFileSelectorFlutterApiGetCodec()];
+  [channel
+      sendMessage:@[ arg_path ?: [NSNull null], @(arg_fractionCompleted) ]
+            reply:^(NSArray<id> *reply) {
+              if (reply != nil) {
+                if (reply.count > 1) {
+                  completion([FlutterError errorWithCode:reply[0]
+                                                 message:reply[1]
+                                                 details:reply[2]]);
+                } else {
+                  completion(nil);
+                }
+              } else {
+                completion([FlutterError errorWithCode:@"channel-error"
+                                               message:@"Unable to establish connection on channel."
+                                               details:@""]);
+              }
+            }];
 }
+@end
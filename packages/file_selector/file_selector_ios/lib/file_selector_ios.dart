@@ -6,10 +6,33 @@ import 'package:file_selector_platform_interface/file_selector_platform_interfac
 
 import 'src/messages.g.dart';
 
+// Forwards the progress of each copy to the callback of that copy.
+class _CopyProgressListener implements FileSelectorFlutterApi {
+  final Map<String, void Function(double fractionCompleted)> callbacks =
+      <String, void Function(double fractionCompleted)>{};
+
+  @override
+  void copyProgress(String path, double fractionCompleted) {
+    callbacks[path]?.call(fractionCompleted);
+  }
+}
+
 /// An implementation of [FileSelectorPlatform] for iOS.
 class FileSelectorIOS extends FileSelectorPlatform {
+  /// Creates a new plugin implementation instance.
+  ///
+  /// If [openInPlace] is true, picked files are opened where they are, for
+  /// example in iCloud Drive, instead of being copied into the app before they
+  /// are returned. Use [copyFile] to get a copy of such a file that outlives
+  /// the app session.
+  FileSelectorIOS({bool openInPlace = false}) : _openInPlace = openInPlace;
+
   final FileSelectorApi _hostApi = FileSelectorApi();
 
+  final bool _openInPlace;
+
+  final _CopyProgressListener _copyProgressListener = _CopyProgressListener();
+
   /// Registers the iOS implementation.
   static void registerWith() {
     FileSelectorPlatform.instance = FileSelectorIOS();
@@ -23,7 +46,8 @@ class FileSelectorIOS extends FileSelectorPlatform {
   }) async {
     final List<String> path = (await _hostApi.openFile(FileSelectorConfig(
             utis: _allowedUtiListFromTypeGroups(acceptedTypeGroups),
-            allowMultiSelection: false)))
+            allowMultiSelection: false,
+            openInPlace: _openInPlace)))
         .cast<String>();
     return path.isEmpty ? null : XFile(path.first);
   }
@@ -36,11 +60,39 @@ class FileSelectorIOS extends FileSelectorPlatform {
   }) async {
     final List<String> pathList = (await _hostApi.openFile(FileSelectorConfig(
             utis: _allowedUtiListFromTypeGroups(acceptedTypeGroups),
-            allowMultiSelection: true)))
+            allowMultiSelection: true,
+            openInPlace: _openInPlace)))
         .cast<String>();
     return pathList.map((String path) => XFile(path)).toList();
   }
 
+  /// Copies [file] into the app's temporary directory in the background, and
+  /// returns the copy.
+  ///
+  /// [onProgress] is called with the fraction of the file that has been
+  /// copied so far. Files that are stored in iCloud Drive are downloaded first.
+  Future<XFile> copyFile(
+    XFile file, {
+    void Function(double fractionCompleted)? onProgress,
+  }) async {
+    if (onProgress != null) {
+      if (_copyProgressListener.callbacks.isEmpty) {
+        FileSelectorFlutterApi.setup(_copyProgressListener);
+      }
+      _copyProgressListener.callbacks[file.path] = onProgress;
+    }
+    try {
+      return XFile(await _hostApi.copyFile(file.path));
+    } finally {
+      if (onProgress != null) {
+        _copyProgressListener.callbacks.remove(file.path);
+        if (_copyProgressListener.callbacks.isEmpty) {
+          FileSelectorFlutterApi.setup(null);
+        }
+      }
+    }
+  }
+
   // Converts the type group list into a list of all allowed UTIs, since
   // iOS doesn't support filter groups.
   List<String> _allowedUtiListFromTypeGroups(List<XTypeGroup>? typeGroups) {
@@ -26,16 +26,22 @@ class FileSelectorConfig {
   FileSelectorConfig({
     required this.utis,
     required this.allowMultiSelection,
+    required this.openInPlace,
   });
 
   List<String?> utis;
 
   bool allowMultiSelection;
 
+  /// Whether picked files are opened in place, instead of being copied into
+  /// the app's Inbox before they are returned.
+  bool openInPlace;
+
   Object encode() {
     return <Object?>[
       utis,
       allowMultiSelection,
+      openInPlace,
     ];
   }
 
@@ -44,6 +50,7 @@ class FileSelectorConfig {
     return FileSelectorConfig(
       utis: (result[0] as List<Object?>?)!.cast<String?>(),
       allowMultiSelection: result[1]! as bool,
+      openInPlace: result[2]! as bool,
     );
   }
 }
@@ -107,4 +114,77 @@ class FileSelectorApi {
       return (replyList[0] as List<Object?>?)!.cast<String?>();
     }
   }
+
+  /// Copies the file at [path] into the app's temporary directory, and returns
+  /// the path of the copy.
+  ///
+  /// The progress of the copy is sent to [FileSelectorFlutterApi.copyProgress].
+  Future<String> copyFile(String arg_path) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.file_selector_ios.FileSelectorApi.copyFile', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_path]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as String?)!;
+    }
+  }
+}
+
+/// Receives the progress of copies started by [FileSelectorApi.copyFile].
+abstract class FileSelectorFlutterApi {
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  /// Called when the copy of the file at [path] has made progress.
+  void copyProgress(String path, double fractionCompleted);
+
+  static void setup(FileSelectorFlutterApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.file_selector_ios.FileSelectorFlutterApi.copyProgress',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.file_selector_ios.FileSelectorFlutterApi.copyProgress was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final String? arg_path = (args[0] as String?);
+          assert(arg_path != null,
+              'Argument for dev.flutter.pigeon.file_selector_ios.FileSelectorFlutterApi.copyProgress was null, expected non-null String.');
+          final double? arg_fractionCompleted = (args[1] as double?);
+          assert(arg_fractionCompleted != null,
+              'Argument for dev.flutter.pigeon.file_selector_ios.FileSelectorFlutterApi.copyProgress was null, expected non-null double.');
+          try {
+            api.copyProgress(arg_path!, arg_fractionCompleted!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
 }
@@ -16,9 +16,15 @@ import 'package:pigeon/pigeon.dart';
 ))
 class FileSelectorConfig {
   FileSelectorConfig(
-      {this.utis = const <String?>[], this.allowMultiSelection = false});
+      {this.utis = const <String?>[],
+      this.allowMultiSelection = false,
+      this.openInPlace = false});
   List<String?> utis;
   bool allowMultiSelection;
+
+  /// Whether picked files are opened in place, instead of being copied into
+  /// the app's Inbox before they are returned.
+  bool openInPlace;
 }
 
 @HostApi(dartHostTestHandler: 'TestFileSelectorApi')
@@ -26,4 +32,20 @@ abstract class FileSelectorApi {
   @async
   @ObjCSelector('openFileSelectorWithConfig:')
   List<String> openFile(FileSelectorConfig config);
+
+  /// Copies the file at [path] into the app's temporary directory, and returns
+  /// the path of the copy.
+  ///
+  /// The progress of the copy is sent to [FileSelectorFlutterApi.copyProgress].
+  @async
+  @ObjCSelector('copyFileAtPath:')
+  String copyFile(String path);
+}
+
+/// Receives the progress of copies started by [FileSelectorApi.copyFile].
+@FlutterApi()
+abstract class FileSelectorFlutterApi {
+  /// Called when the copy of the file at [path] has made progress.
+  @ObjCSelector('copyProgressForPath:fractionCompleted:')
+  void copyProgress(String path, double fractionCompleted);
 }
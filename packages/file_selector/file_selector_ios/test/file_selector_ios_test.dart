@@ -13,6 +13,17 @@ import 'package:mockito/mockito.dart';
 import 'file_selector_ios_test.mocks.dart';
 import 'test_api.g.dart';
 
+// Sends a message that the host sends when a copy has made progress.
+Future<void> _sendCopyProgress(String path, double fractionCompleted) async {
+  await TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+      .handlePlatformMessage(
+    'dev.flutter.pigeon.file_selector_ios.FileSelectorFlutterApi.copyProgress',
+    FileSelectorFlutterApi.codec
+        .encodeMessage(<Object?>[path, fractionCompleted]),
+    (_) {},
+  );
+}
+
 @GenerateMocks(<Type>[TestFileSelectorApi])
 void main() {
   TestWidgetsFlutterBinding.ensureInitialized();
@@ -60,7 +71,18 @@ void main() {
       expect(listEquals(config.utis, <String>['public.text', 'public.image']),
           isTrue);
       expect(config.allowMultiSelection, isFalse);
+      expect(config.openInPlace, isFalse);
     });
+
+    test('passes openInPlace', () async {
+      await FileSelectorIOS(openInPlace: true).openFile();
+
+      final VerificationResult result = verify(mockApi.openFile(captureAny));
+      final FileSelectorConfig config =
+          result.captured[0] as FileSelectorConfig;
+      expect(config.openInPlace, isTrue);
+    });
+
     test('throws for a type group that does not support iOS', () async {
       const XTypeGroup group = XTypeGroup(
         label: 'images',
@@ -158,4 +180,31 @@ void main() {
       expect(listEquals(config.utis, <String>['public.data']), isTrue);
     });
   });
+
+  group('copyFile', () {
+    test('returns the copy', () async {
+      when(mockApi.copyFile('/picked/foo.mov'))
+          .thenAnswer((_) async => '/tmp/foo.mov');
+
+      final XFile copy = await plugin.copyFile(XFile('/picked/foo.mov'));
+
+      expect(copy.path, '/tmp/foo.mov');
+    });
+
+    test('reports the progress of the copy', () async {
+      final List<double> progress = <double>[];
+      when(mockApi.copyFile('/picked/foo.mov')).thenAnswer((_) async {
+        await _sendCopyProgress('/picked/bar.mov', 0.25);
+        await _sendCopyProgress('/picked/foo.mov', 0.5);
+        await _sendCopyProgress('/picked/foo.mov', 1.0);
+        return '/tmp/foo.mov';
+      });
+
+      await plugin.copyFile(XFile('/picked/foo.mov'),
+          onProgress: (double fractionCompleted) =>
+              progress.add(fractionCompleted));
+
+      expect(progress, <double>[0.5, 1.0]);
+    });
+  });
 }
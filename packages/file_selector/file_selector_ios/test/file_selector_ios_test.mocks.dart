@@ -39,4 +39,12 @@ class MockTestFileSelectorApi extends _i1.Mock
         ),
         returnValue: _i3.Future<List<String?>>.value(<String?>[]),
       ) as _i3.Future<List<String?>>);
+  @override
+  _i3.Future<String> copyFile(String? path) => (super.noSuchMethod(
+        Invocation.method(
+          #copyFile,
+          [path],
+        ),
+        returnValue: _i3.Future<String>.value(''),
+      ) as _i3.Future<String>);
 }
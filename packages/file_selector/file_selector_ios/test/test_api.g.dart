@@ -43,6 +43,12 @@ abstract class TestFileSelectorApi {
 
   Future<List<String?>> openFile(FileSelectorConfig config);
 
+  /// Copies the file at [path] into the app's temporary directory, and returns
+  /// the path of the copy.
+  ///
+  /// The progress of the copy is sent to [FileSelectorFlutterApi.copyProgress].
+  Future<String> copyFile(String path);
+
   static void setup(TestFileSelectorApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
@@ -76,5 +82,35 @@ abstract class TestFileSelectorApi {
         });
       }
     }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.file_selector_ios.FileSelectorApi.copyFile',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.file_selector_ios.FileSelectorApi.copyFile was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final String? arg_path = (args[0] as String?);
+          assert(arg_path != null,
+              'Argument for dev.flutter.pigeon.file_selector_ios.FileSelectorApi.copyFile was null, expected non-null String.');
+          try {
+            final String output = await api.copyFile(arg_path!);
+            return <Object?>[output];
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
   }
 }
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:async';
+
 import 'package:file_selector_platform_interface/file_selector_platform_interface.dart';
 import 'package:flutter/foundation.dart' show visibleForTesting;
 import 'package:flutter/services.dart';
@@ -9,6 +11,11 @@ import 'package:flutter/services.dart';
 const MethodChannel _channel =
     MethodChannel('plugins.flutter.dev/file_selector_linux');
 
+/// The channel that the native side streams selected paths on when
+/// [_streamResultsKey] is set.
+const EventChannel _resultsChannel =
+    EventChannel('plugins.flutter.dev/file_selector_linux/results');
+
 const String _typeGroupLabelKey = 'label';
 const String _typeGroupExtensionsKey = 'extensions';
 const String _typeGroupMimeTypesKey = 'mimeTypes';
@@ -19,10 +26,19 @@ const String _getDirectoryPathMethod = 'getDirectoryPath';
 
 const String _acceptedTypeGroupsKey = 'acceptedTypeGroups';
 const String _confirmButtonTextKey = 'confirmButtonText';
+const String _includeMetadataKey = 'includeMetadata';
 const String _initialDirectoryKey = 'initialDirectory';
 const String _multipleKey = 'multiple';
+const String _streamResultsKey = 'streamResults';
 const String _suggestedNameKey = 'suggestedName';
 
+const String _resultPathsKey = 'paths';
+const String _resultMetadataKey = 'metadata';
+
+const String _metadataSizeKey = 'size';
+const String _metadataLastModifiedKey = 'lastModified';
+const String _metadataMimeTypeKey = 'mimeType';
+
 /// An implementation of [FileSelectorPlatform] for Linux.
 class FileSelectorLinux extends FileSelectorPlatform {
   /// The MethodChannel that is being used by this implementation of the plugin.
@@ -42,7 +58,7 @@ class FileSelectorLinux extends FileSelectorPlatform {
   }) async {
     final List<Map<String, Object>> serializedTypeGroups =
         _serializeTypeGroups(acceptedTypeGroups);
-    final List<String>? path = await _channel.invokeListMethod<String>(
+    final Object? result = await _channel.invokeMethod<Object>(
       _openFileMethod,
       <String, dynamic>{
         if (serializedTypeGroups.isNotEmpty)
@@ -50,9 +66,11 @@ class FileSelectorLinux extends FileSelectorPlatform {
         'initialDirectory': initialDirectory,
         _confirmButtonTextKey: confirmButtonText,
         _multipleKey: false,
+        _includeMetadataKey: true,
       },
     );
-    return path == null ? null : XFile(path.first);
+    final List<XFile> files = _xFilesFromResult(result);
+    return files.isEmpty ? null : files.first;
   }
 
   @override
@@ -63,7 +81,7 @@ class FileSelectorLinux extends FileSelectorPlatform {
   }) async {
     final List<Map<String, Object>> serializedTypeGroups =
         _serializeTypeGroups(acceptedTypeGroups);
-    final List<String>? pathList = await _channel.invokeListMethod<String>(
+    final Object? result = await _channel.invokeMethod<Object>(
       _openFileMethod,
       <String, dynamic>{
         if (serializedTypeGroups.isNotEmpty)
@@ -71,9 +89,63 @@ class FileSelectorLinux extends FileSelectorPlatform {
         _initialDirectoryKey: initialDirectory,
         _confirmButtonTextKey: confirmButtonText,
         _multipleKey: true,
+        _includeMetadataKey: true,
+      },
+    );
+    return _xFilesFromResult(result);
+  }
+
+  /// Shows a dialog for selecting multiple files, and returns the selected
+  /// files in chunks as they are read from the dialog.
+  ///
+  /// This behaves like [openFiles], but avoids building a single large result
+  /// when a very large number of files is selected. The stream is closed once
+  /// the dialog has finished reporting results, and is empty if the dialog was
+  /// cancelled.
+  Stream<List<XFile>> openFilesInChunks({
+    List<XTypeGroup>? acceptedTypeGroups,
+    String? initialDirectory,
+    String? confirmButtonText,
+  }) {
+    final List<Map<String, Object>> serializedTypeGroups =
+        _serializeTypeGroups(acceptedTypeGroups);
+    late final StreamController<List<XFile>> controller;
+    StreamSubscription<dynamic>? chunkSubscription;
+    controller = StreamController<List<XFile>>(
+      onListen: () {
+        // The listen request is sent before the dialog request, so the native
+        // side knows to stream by the time the dialog is dismissed.
+        chunkSubscription = _resultsChannel.receiveBroadcastStream().listen(
+            (dynamic paths) =>
+                controller.add(_xFilesFromPaths(paths as List<Object?>)),
+            onError: controller.addError);
+        _channel.invokeListMethod<String>(
+          _openFileMethod,
+          <String, dynamic>{
+            if (serializedTypeGroups.isNotEmpty)
+              _acceptedTypeGroupsKey: serializedTypeGroups,
+            _initialDirectoryKey: initialDirectory,
+            _confirmButtonTextKey: confirmButtonText,
+            _multipleKey: true,
+            _streamResultsKey: true,
+          },
+        ).then((List<String>? paths) {
+          // Paths are returned directly if streaming wasn't possible.
+          if (paths != null && paths.isNotEmpty) {
+            controller.add(_xFilesFromPaths(paths));
+          }
+        }, onError: controller.addError).whenComplete(() async {
+          await chunkSubscription?.cancel();
+          chunkSubscription = null;
+          await controller.close();
+        });
+      },
+      onCancel: () async {
+        await chunkSubscription?.cancel();
+        chunkSubscription = null;
       },
     );
-    return pathList?.map((String path) => XFile(path)).toList() ?? <XFile>[];
+    return controller.stream;
   }
 
   @override
@@ -143,6 +215,43 @@ class FileSelectorLinux extends FileSelectorPlatform {
   }
 }
 
+List<XFile> _xFilesFromPaths(List<Object?> paths) {
+  return paths.map((Object? path) => XFile(path! as String)).toList();
+}
+
+/// Returns XFiles for an open dialog [result], which is either a list of
+/// paths, or a map of paths and their metadata if metadata was requested.
+///
+/// Files are pre-populated with any metadata so that reading it doesn't
+/// require filesystem access.
+List<XFile> _xFilesFromResult(Object? result) {
+  if (result == null) {
+    return <XFile>[];
+  }
+  if (result is List<Object?>) {
+    return _xFilesFromPaths(result);
+  }
+  final Map<Object?, Object?> map = result as Map<Object?, Object?>;
+  final List<Object?> paths = map[_resultPathsKey]! as List<Object?>;
+  final List<Object?>? metadata = map[_resultMetadataKey] as List<Object?>?;
+  if (metadata == null || metadata.length != paths.length) {
+    return _xFilesFromPaths(paths);
+  }
+  return List<XFile>.generate(paths.length, (int i) {
+    final Map<Object?, Object?>? fileMetadata =
+        metadata[i] as Map<Object?, Object?>?;
+    final int? lastModified = fileMetadata?[_metadataLastModifiedKey] as int?;
+    return XFile(
+      paths[i]! as String,
+      mimeType: fileMetadata?[_metadataMimeTypeKey] as String?,
+      length: fileMetadata?[_metadataSizeKey] as int?,
+      lastModified: lastModified == null
+          ? null
+          : DateTime.fromMillisecondsSinceEpoch(lastModified),
+    );
+  });
+}
+
 List<Map<String, Object>> _serializeTypeGroups(List<XTypeGroup>? groups) {
   return (groups ?? <XTypeGroup>[]).map(_serializeTypeGroup).toList();
 }
@@ -11,6 +11,8 @@
 
 // From file_selector_linux.dart
 const char kChannelName[] = "plugins.flutter.dev/file_selector_linux";
+const char kResultsChannelName[] =
+    "plugins.flutter.dev/file_selector_linux/results";
 
 const char kOpenFileMethod[] = "openFile";
 const char kGetSavePathMethod[] = "getSavePath";
@@ -18,18 +20,47 @@ const char kGetDirectoryPathMethod[] = "getDirectoryPath";
 
 const char kAcceptedTypeGroupsKey[] = "acceptedTypeGroups";
 const char kConfirmButtonTextKey[] = "confirmButtonText";
+const char kIncludeMetadataKey[] = "includeMetadata";
 const char kInitialDirectoryKey[] = "initialDirectory";
 const char kMultipleKey[] = "multiple";
+const char kStreamResultsKey[] = "streamResults";
 const char kSuggestedNameKey[] = "suggestedName";
 
 const char kTypeGroupLabelKey[] = "label";
 const char kTypeGroupExtensionsKey[] = "extensions";
 const char kTypeGroupMimeTypesKey[] = "mimeTypes";
 
+const char kResultPathsKey[] = "paths";
+const char kResultMetadataKey[] = "metadata";
+
+const char kMetadataSizeKey[] = "size";
+const char kMetadataLastModifiedKey[] = "lastModified";
+const char kMetadataMimeTypeKey[] = "mimeType";
+
+// The attributes queried for each selected file when metadata is requested.
+// The fast content type is based on the file name, so it doesn't require
+// reading the file.
+const char kMetadataAttributes[] = G_FILE_ATTRIBUTE_STANDARD_SIZE
+    "," G_FILE_ATTRIBUTE_TIME_MODIFIED "," G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC
+    "," G_FILE_ATTRIBUTE_STANDARD_FAST_CONTENT_TYPE;
+
+// The xdg-desktop-portal file chooser, used when running in a sandbox.
+const char kPortalBusName[] = "org.freedesktop.portal.Desktop";
+const char kPortalObjectPath[] = "/org/freedesktop/portal/desktop";
+const char kPortalFileChooserInterface[] = "org.freedesktop.portal.FileChooser";
+const char kPortalRequestInterface[] = "org.freedesktop.portal.Request";
+
 // Errors
 const char kBadArgumentsError[] = "Bad Arguments";
 const char kNoScreenError[] = "No Screen";
 
+// The maximum number of paths sent in a single streamed chunk.
+const size_t kResultChunkSize = 64;
+
+// The maximum number of file metadata queries in flight at once, to avoid
+// flooding the backend (e.g. a GVFS network mount) with requests.
+const size_t kMaxMetadataQueries = 16;
+
 struct _FlFileSelectorPlugin {
   GObject parent_instance;
 
@@ -37,10 +68,53 @@ struct _FlFileSelectorPlugin {
 
   // Connection to Flutter engine.
   FlMethodChannel* channel;
+
+  // Channel that selected paths are streamed on, when requested.
+  FlEventChannel* results_channel;
+
+  // TRUE if Flutter is listening on results_channel.
+  gboolean results_listening;
 };
 
 G_DEFINE_TYPE(FlFileSelectorPlugin, fl_file_selector_plugin, G_TYPE_OBJECT)
 
+// A dialog that is being shown, and the method call waiting for its result.
+typedef struct {
+  FlFileSelectorPlugin* self;
+  FlMethodCall* method_call;
+  // TRUE if the result is a list of paths rather than a single path.
+  gboolean return_list;
+  // TRUE if paths should be sent on the results channel rather than returned.
+  gboolean stream_results;
+  // TRUE if the metadata of each selected file should be returned with the
+  // paths.
+  gboolean include_metadata;
+
+  // The dialog, when shown with GTK.
+  GtkFileChooserNative* dialog;
+
+  // The session bus connection and the subscription to the request's
+  // Response signal, when shown with the portal.
+  GDBusConnection* connection;
+  guint portal_subscription;
+  gchar* portal_request_path;
+} DialogRequest;
+
+static void dialog_request_free(DialogRequest* request) {
+  if (request->portal_subscription != 0) {
+    g_dbus_connection_signal_unsubscribe(request->connection,
+                                         request->portal_subscription);
+  }
+  g_object_unref(request->self);
+  g_object_unref(request->method_call);
+  g_clear_object(&request->dialog);
+  g_clear_object(&request->connection);
+  g_free(request->portal_request_path);
+  g_free(request);
+}
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC(DialogRequest, dialog_request_free)
+
 // Converts a type group received from Flutter into a GTK file filter.
 static GtkFileFilter* type_group_to_filter(FlValue* value) {
   g_autoptr(GtkFileFilter) filter = gtk_file_filter_new();
@@ -138,49 +212,506 @@ GtkFileChooserNative* create_dialog_for_method(GtkWindow* window,
   return nullptr;
 }
 
-// Shows the requested dialog type.
-static FlMethodResponse* show_dialog(FlFileSelectorPlugin* self,
-                                     const gchar* method, FlValue* properties,
-                                     bool return_list) {
-  if (fl_value_get_type(properties) != FL_VALUE_TYPE_MAP) {
-    return FL_METHOD_RESPONSE(fl_method_error_response_new(
-        kBadArgumentsError, "Argument map missing or malformed", nullptr));
+FlValue* split_into_chunks(FlValue* paths, size_t chunk_size) {
+  FlValue* chunks = fl_value_new_list();
+  FlValue* chunk = nullptr;
+  for (size_t i = 0; i < fl_value_get_length(paths); i++) {
+    if (chunk == nullptr) {
+      chunk = fl_value_new_list();
+    }
+    fl_value_append(chunk, fl_value_get_list_value(paths, i));
+    if (fl_value_get_length(chunk) == chunk_size) {
+      fl_value_append_take(chunks, chunk);
+      chunk = nullptr;
+    }
+  }
+  if (chunk != nullptr) {
+    fl_value_append_take(chunks, chunk);
+  }
+  return chunks;
+}
+
+FlValue* file_metadata_from_info(GFileInfo* info) {
+  FlValue* metadata = fl_value_new_map();
+  if (g_file_info_has_attribute(info, G_FILE_ATTRIBUTE_STANDARD_SIZE)) {
+    fl_value_set_string_take(metadata, kMetadataSizeKey,
+                             fl_value_new_int(g_file_info_get_size(info)));
+  }
+  if (g_file_info_has_attribute(info, G_FILE_ATTRIBUTE_TIME_MODIFIED)) {
+    const gint64 seconds = g_file_info_get_attribute_uint64(
+        info, G_FILE_ATTRIBUTE_TIME_MODIFIED);
+    const gint64 microseconds = g_file_info_get_attribute_uint32(
+        info, G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC);
+    fl_value_set_string_take(
+        metadata, kMetadataLastModifiedKey,
+        fl_value_new_int(seconds * 1000 + microseconds / 1000));
+  }
+  const gchar* content_type = g_file_info_get_attribute_string(
+      info, G_FILE_ATTRIBUTE_STANDARD_FAST_CONTENT_TYPE);
+  if (content_type != nullptr) {
+    g_autofree gchar* mime_type = g_content_type_get_mime_type(content_type);
+    if (mime_type != nullptr) {
+      fl_value_set_string_take(metadata, kMetadataMimeTypeKey,
+                               fl_value_new_string(mime_type));
+    }
+  }
+  return metadata;
+}
+
+// The state of a query_file_metadata call.
+typedef struct {
+  FlValue* paths;
+  // The metadata map for each path, or a null value if it hasn't been queried
+  // or the query failed.
+  GPtrArray* metadata;
+  // The index of the next path to query.
+  size_t next_index;
+  // The number of queries that have been started but not finished.
+  size_t pending;
+  FileMetadataCallback callback;
+  gpointer user_data;
+} MetadataQuery;
+
+// A single file's query within a MetadataQuery.
+typedef struct {
+  MetadataQuery* query;
+  size_t index;
+} MetadataQueryItem;
+
+static void metadata_query_free(MetadataQuery* query) {
+  fl_value_unref(query->paths);
+  g_ptr_array_unref(query->metadata);
+  g_free(query);
+}
+
+static void query_next_file_metadata(MetadataQuery* query);
+
+// Called when the metadata query for a single file finishes.
+static void file_info_cb(GObject* source, GAsyncResult* result,
+                         gpointer user_data) {
+  g_autofree MetadataQueryItem* item =
+      static_cast<MetadataQueryItem*>(user_data);
+  MetadataQuery* query = item->query;
+
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(GFileInfo) info =
+      g_file_query_info_finish(G_FILE(source), result, &error);
+  if (info != nullptr) {
+    fl_value_unref(
+        static_cast<FlValue*>(g_ptr_array_index(query->metadata, item->index)));
+    g_ptr_array_index(query->metadata, item->index) =
+        file_metadata_from_info(info);
+  } else {
+    g_debug("Unable to query file metadata: %s", error->message);
+  }
+
+  query->pending--;
+  if (query->next_index < fl_value_get_length(query->paths)) {
+    query_next_file_metadata(query);
+  } else if (query->pending == 0) {
+    g_autoptr(FlValue) metadata = fl_value_new_list();
+    for (guint i = 0; i < query->metadata->len; i++) {
+      fl_value_append(metadata, static_cast<FlValue*>(
+                                    g_ptr_array_index(query->metadata, i)));
+    }
+    query->callback(query->paths, metadata, query->user_data);
+    metadata_query_free(query);
+  }
+}
+
+// Starts the query for the next path in |query|.
+static void query_next_file_metadata(MetadataQuery* query) {
+  MetadataQueryItem* item = g_new(MetadataQueryItem, 1);
+  item->query = query;
+  item->index = query->next_index++;
+  query->pending++;
+  FlValue* path = fl_value_get_list_value(query->paths, item->index);
+  g_autoptr(GFile) file = g_file_new_for_path(fl_value_get_string(path));
+  g_file_query_info_async(file, kMetadataAttributes, G_FILE_QUERY_INFO_NONE,
+                          G_PRIORITY_DEFAULT, nullptr, file_info_cb, item);
+}
+
+void query_file_metadata(FlValue* paths, FileMetadataCallback callback,
+                         gpointer user_data) {
+  const size_t count = fl_value_get_length(paths);
+  if (count == 0) {
+    g_autoptr(FlValue) metadata = fl_value_new_list();
+    callback(paths, metadata, user_data);
+    return;
+  }
+
+  MetadataQuery* query = g_new0(MetadataQuery, 1);
+  query->paths = fl_value_ref(paths);
+  query->metadata = g_ptr_array_new_full(
+      count, reinterpret_cast<GDestroyNotify>(fl_value_unref));
+  for (size_t i = 0; i < count; i++) {
+    g_ptr_array_add(query->metadata, fl_value_new_null());
+  }
+  query->callback = callback;
+  query->user_data = user_data;
+  // Queries run in parallel, since each can involve a network round trip.
+  for (size_t i = 0; i < count && i < kMaxMetadataQueries; i++) {
+    query_next_file_metadata(query);
+  }
+}
+
+GVariant* portal_options_for_method(const gchar* method, FlValue* properties,
+                                    const gchar* handle_token) {
+  GVariantBuilder builder;
+  g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
+  g_variant_builder_add(&builder, "{sv}", "handle_token",
+                        g_variant_new_string(handle_token));
+  g_variant_builder_add(&builder, "{sv}", "modal", g_variant_new_boolean(TRUE));
+
+  if (strcmp(method, kGetDirectoryPathMethod) == 0) {
+    g_variant_builder_add(&builder, "{sv}", "directory",
+                          g_variant_new_boolean(TRUE));
+  }
+
+  FlValue* value = fl_value_lookup_string(properties, kMultipleKey);
+  if (value != nullptr && fl_value_get_type(value) == FL_VALUE_TYPE_BOOL) {
+    g_variant_builder_add(&builder, "{sv}", "multiple",
+                          g_variant_new_boolean(fl_value_get_bool(value)));
+  }
+
+  value = fl_value_lookup_string(properties, kConfirmButtonTextKey);
+  if (value != nullptr && fl_value_get_type(value) == FL_VALUE_TYPE_STRING) {
+    g_variant_builder_add(&builder, "{sv}", "accept_label",
+                          g_variant_new_string(fl_value_get_string(value)));
+  }
+
+  value = fl_value_lookup_string(properties, kInitialDirectoryKey);
+  if (value != nullptr && fl_value_get_type(value) == FL_VALUE_TYPE_STRING) {
+    // The portal expects a NUL-terminated byte string, since paths aren't
+    // necessarily UTF-8.
+    g_variant_builder_add(&builder, "{sv}", "current_folder",
+                          g_variant_new_bytestring(fl_value_get_string(value)));
+  }
+
+  value = fl_value_lookup_string(properties, kSuggestedNameKey);
+  if (value != nullptr && fl_value_get_type(value) == FL_VALUE_TYPE_STRING) {
+    g_variant_builder_add(&builder, "{sv}", "current_name",
+                          g_variant_new_string(fl_value_get_string(value)));
+  }
+
+  value = fl_value_lookup_string(properties, kAcceptedTypeGroupsKey);
+  if (value != nullptr && fl_value_get_type(value) == FL_VALUE_TYPE_LIST &&
+      fl_value_get_length(value) > 0) {
+    // Filters are a(sa(us)): a name, and a list of patterns, each of which is
+    // either a glob (0) or a MIME type (1).
+    GVariantBuilder filters;
+    g_variant_builder_init(&filters, G_VARIANT_TYPE("a(sa(us))"));
+    for (size_t i = 0; i < fl_value_get_length(value); i++) {
+      FlValue* type_group = fl_value_get_list_value(value, i);
+      FlValue* label = fl_value_lookup_string(type_group, kTypeGroupLabelKey);
+      GVariantBuilder patterns;
+      g_variant_builder_init(&patterns, G_VARIANT_TYPE("a(us)"));
+      FlValue* extensions =
+          fl_value_lookup_string(type_group, kTypeGroupExtensionsKey);
+      if (extensions != nullptr &&
+          fl_value_get_type(extensions) == FL_VALUE_TYPE_LIST) {
+        for (size_t j = 0; j < fl_value_get_length(extensions); j++) {
+          g_variant_builder_add(
+              &patterns, "(us)", 0,
+              fl_value_get_string(fl_value_get_list_value(extensions, j)));
+        }
+      }
+      FlValue* mime_types =
+          fl_value_lookup_string(type_group, kTypeGroupMimeTypesKey);
+      if (mime_types != nullptr &&
+          fl_value_get_type(mime_types) == FL_VALUE_TYPE_LIST) {
+        for (size_t j = 0; j < fl_value_get_length(mime_types); j++) {
+          g_variant_builder_add(
+              &patterns, "(us)", 1,
+              fl_value_get_string(fl_value_get_list_value(mime_types, j)));
+        }
+      }
+      g_variant_builder_add(
+          &filters, "(sa(us))",
+          label != nullptr && fl_value_get_type(label) == FL_VALUE_TYPE_STRING
+              ? fl_value_get_string(label)
+              : "",
+          &patterns);
+    }
+    g_variant_builder_add(&builder, "{sv}", "filters",
+                          g_variant_builder_end(&filters));
+  }
+
+  return g_variant_builder_end(&builder);
+}
+
+// Returns TRUE if dialogs should be shown by calling the file chooser portal
+// directly.
+//
+// In a sandbox GtkFileChooserNative uses the portal anyway, so this avoids the
+// cost of setting up a GTK dialog that is never shown. GTK_USE_PORTAL is the
+// same override that GTK itself honors.
+static gboolean use_portal() {
+  return g_file_test("/.flatpak-info", G_FILE_TEST_EXISTS) ||
+         g_getenv("SNAP") != nullptr ||
+         g_strcmp0(g_getenv("GTK_USE_PORTAL"), "1") == 0;
+}
+
+// Sends |response| to |method_call|.
+static void respond(FlMethodCall* method_call, FlMethodResponse* response) {
+  g_autoptr(GError) error = nullptr;
+  if (!fl_method_call_respond(method_call, response, &error))
+    g_warning("Failed to send method call response: %s", error->message);
+}
+
+// Called when the metadata for a dialog's selected paths has been queried,
+// with the method call waiting for them as |user_data|.
+static void dialog_metadata_cb(FlValue* paths, FlValue* metadata,
+                               gpointer user_data) {
+  g_autoptr(FlMethodCall) method_call = FL_METHOD_CALL(user_data);
+  g_autoptr(FlValue) result = fl_value_new_map();
+  fl_value_set_string(result, kResultPathsKey, paths);
+  fl_value_set_string(result, kResultMetadataKey, metadata);
+  g_autoptr(FlMethodResponse) response =
+      FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  respond(method_call, response);
+}
+
+// Responds to |request| with |paths|, the list of selected paths, or nullptr
+// if the dialog was cancelled.
+static void respond_with_paths(DialogRequest* request, FlValue* paths) {
+  FlFileSelectorPlugin* self = request->self;
+  g_autoptr(FlValue) result = nullptr;
+  if (paths != nullptr && fl_value_get_length(paths) > 0) {
+    if (!request->return_list) {
+      result = fl_value_ref(fl_value_get_list_value(paths, 0));
+    } else if (request->stream_results && self->results_listening) {
+      // If nothing is listening, this falls back to returning the paths
+      // directly.
+      g_autoptr(FlValue) chunks = split_into_chunks(paths, kResultChunkSize);
+      for (size_t i = 0; i < fl_value_get_length(chunks); i++) {
+        g_autoptr(GError) error = nullptr;
+        if (!fl_event_channel_send(self->results_channel,
+                                   fl_value_get_list_value(chunks, i), nullptr,
+                                   &error)) {
+          g_warning("Failed to send results chunk: %s", error->message);
+        }
+      }
+      result = fl_value_new_list();
+    } else if (request->include_metadata) {
+      // The method call is responded to once the queries have finished.
+      query_file_metadata(paths, dialog_metadata_cb,
+                          g_object_ref(request->method_call));
+      return;
+    } else {
+      result = fl_value_ref(paths);
+    }
+  }
+
+  g_autoptr(FlMethodResponse) method_response =
+      FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  respond(request->method_call, method_response);
+}
+
+// Called when a dialog shown by show_gtk_dialog is dismissed.
+static void dialog_response_cb(GtkNativeDialog* dialog, gint response,
+                               gpointer user_data) {
+  g_autoptr(DialogRequest) request = static_cast<DialogRequest*>(user_data);
+  g_signal_handlers_disconnect_by_data(dialog, request);
+
+  g_autoptr(FlValue) paths = nullptr;
+  if (response == GTK_RESPONSE_ACCEPT) {
+    paths = fl_value_new_list();
+    g_autoptr(GSList) filenames =
+        gtk_file_chooser_get_filenames(GTK_FILE_CHOOSER(dialog));
+    for (GSList* link = filenames; link != nullptr; link = link->next) {
+      g_autofree gchar* filename = static_cast<gchar*>(link->data);
+      fl_value_append_take(paths, fl_value_new_string(filename));
+    }
   }
+  respond_with_paths(request, paths);
+}
 
-  FlView* view = fl_plugin_registrar_get_view(self->registrar);
+// Shows a GTK dialog for |request|.
+//
+// On success, the dialog takes ownership of |request| and responds once it's
+// dismissed, and this returns nullptr. Otherwise this returns an error
+// response, and the caller keeps ownership of |request|.
+static FlMethodResponse* show_gtk_dialog(DialogRequest* request) {
+  const gchar* method = fl_method_call_get_name(request->method_call);
+  FlValue* properties = fl_method_call_get_args(request->method_call);
+
+  FlView* view = fl_plugin_registrar_get_view(request->self->registrar);
   if (view == nullptr) {
     return FL_METHOD_RESPONSE(
         fl_method_error_response_new(kNoScreenError, nullptr, nullptr));
   }
   GtkWindow* window = GTK_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(view)));
 
-  g_autoptr(GtkFileChooserNative) dialog =
-      create_dialog_for_method(window, method, properties);
-
-  if (dialog == nullptr) {
+  request->dialog = create_dialog_for_method(window, method, properties);
+  if (request->dialog == nullptr) {
     return FL_METHOD_RESPONSE(fl_method_error_response_new(
         kBadArgumentsError, "Unable to create dialog from arguments", nullptr));
   }
 
-  gint response = gtk_native_dialog_run(GTK_NATIVE_DIALOG(dialog));
-  g_autoptr(FlValue) result = nullptr;
-  if (response == GTK_RESPONSE_ACCEPT) {
-    if (return_list) {
-      result = fl_value_new_list();
-      g_autoptr(GSList) filenames =
-          gtk_file_chooser_get_filenames(GTK_FILE_CHOOSER(dialog));
-      for (GSList* link = filenames; link != nullptr; link = link->next) {
-        g_autofree gchar* filename = static_cast<gchar*>(link->data);
-        fl_value_append_take(result, fl_value_new_string(filename));
+  // Use the response signal rather than gtk_native_dialog_run, which would
+  // block this callback in a nested main loop until the dialog is dismissed.
+  g_signal_connect(request->dialog, "response",
+                   G_CALLBACK(dialog_response_cb), request);
+  gtk_native_dialog_set_modal(GTK_NATIVE_DIALOG(request->dialog), TRUE);
+  gtk_native_dialog_show(GTK_NATIVE_DIALOG(request->dialog));
+
+  return nullptr;
+}
+
+// Called when the portal request for |user_data| ends.
+static void portal_response_cb(GDBusConnection* connection,
+                               const gchar* sender_name,
+                               const gchar* object_path,
+                               const gchar* interface_name,
+                               const gchar* signal_name, GVariant* parameters,
+                               gpointer user_data) {
+  g_autoptr(DialogRequest) request = static_cast<DialogRequest*>(user_data);
+
+  guint32 response;
+  g_autoptr(GVariant) results = nullptr;
+  g_variant_get(parameters, "(u@a{sv})", &response, &results);
+
+  // 0 is success; 1 is cancellation, and 2 is any other ending.
+  g_autoptr(FlValue) paths = nullptr;
+  g_autofree const gchar** uris = nullptr;
+  if (response == 0 && g_variant_lookup(results, "uris", "^a&s", &uris)) {
+    paths = fl_value_new_list();
+    for (size_t i = 0; uris[i] != nullptr; i++) {
+      // In a sandbox these are document portal paths, which the app can
+      // access directly without further portal calls.
+      g_autofree gchar* path = g_filename_from_uri(uris[i], nullptr, nullptr);
+      if (path != nullptr) {
+        fl_value_append_take(paths, fl_value_new_string(path));
       }
-    } else {
-      g_autofree gchar* filename =
-          gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
-      result = fl_value_new_string(filename);
     }
   }
+  respond_with_paths(request, paths);
+}
+
+// Called when the portal has accepted or rejected the request for
+// |user_data|.
+static void portal_call_cb(GObject* source, GAsyncResult* result,
+                           gpointer user_data) {
+  DialogRequest* request = static_cast<DialogRequest*>(user_data);
 
-  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(GVariant) reply = g_dbus_connection_call_finish(
+      G_DBUS_CONNECTION(source), result, &error);
+  if (reply == nullptr) {
+    // Fall back to GTK, which has its own handling for missing portals.
+    g_debug("File chooser portal unavailable: %s", error->message);
+    g_dbus_connection_signal_unsubscribe(request->connection,
+                                         request->portal_subscription);
+    request->portal_subscription = 0;
+    g_autoptr(FlMethodResponse) response = show_gtk_dialog(request);
+    if (response != nullptr) {
+      respond(request->method_call, response);
+      dialog_request_free(request);
+    }
+    return;
+  }
+
+  // Older portals don't use the handle_token to construct the request path,
+  // in which case the subscription needs to be moved to the real path.
+  const gchar* handle;
+  g_variant_get(reply, "(&o)", &handle);
+  if (g_strcmp0(handle, request->portal_request_path) != 0) {
+    g_dbus_connection_signal_unsubscribe(request->connection,
+                                         request->portal_subscription);
+    request->portal_subscription = g_dbus_connection_signal_subscribe(
+        request->connection, kPortalBusName, kPortalRequestInterface,
+        "Response", handle, nullptr, G_DBUS_SIGNAL_FLAGS_NONE,
+        portal_response_cb, request, nullptr);
+  }
+}
+
+// Shows a dialog for |request| using the file chooser portal, taking
+// ownership of |request|.
+static void show_portal_dialog(DialogRequest* request) {
+  const gchar* method = fl_method_call_get_name(request->method_call);
+  FlValue* properties = fl_method_call_get_args(request->method_call);
+
+  g_autoptr(GError) error = nullptr;
+  request->connection = g_bus_get_sync(G_BUS_TYPE_SESSION, nullptr, &error);
+  if (request->connection == nullptr) {
+    g_debug("Unable to connect to session bus: %s", error->message);
+    g_autoptr(FlMethodResponse) response = show_gtk_dialog(request);
+    if (response != nullptr) {
+      respond(request->method_call, response);
+      dialog_request_free(request);
+    }
+    return;
+  }
+
+  // Subscribe to the response before making the call, using the request path
+  // the portal will use for the token, so that the response can't be missed.
+  g_autofree gchar* token =
+      g_strdup_printf("file_selector_linux%u", g_random_int());
+  g_autofree gchar* sender =
+      g_strdup(g_dbus_connection_get_unique_name(request->connection) + 1);
+  g_strdelimit(sender, ".", '_');
+  request->portal_request_path = g_strdup_printf(
+      "/org/freedesktop/portal/desktop/request/%s/%s", sender, token);
+  request->portal_subscription = g_dbus_connection_signal_subscribe(
+      request->connection, kPortalBusName, kPortalRequestInterface, "Response",
+      request->portal_request_path, nullptr, G_DBUS_SIGNAL_FLAGS_NONE,
+      portal_response_cb, request, nullptr);
+
+  const gchar* portal_method = "OpenFile";
+  const gchar* title = "Open File";
+  if (strcmp(method, kGetSavePathMethod) == 0) {
+    portal_method = "SaveFile";
+    title = "Save File";
+  } else if (strcmp(method, kGetDirectoryPathMethod) == 0) {
+    title = "Choose Directory";
+  }
+  GVariant* options = portal_options_for_method(method, properties, token);
+  g_dbus_connection_call(
+      request->connection, kPortalBusName, kPortalObjectPath,
+      kPortalFileChooserInterface, portal_method,
+      g_variant_new("(ss@a{sv})", "", title, options), G_VARIANT_TYPE("(o)"),
+      G_DBUS_CALL_FLAGS_NONE, -1, nullptr, portal_call_cb, request);
+}
+
+// Shows the requested dialog type.
+//
+// The dialog is shown without blocking, and the method call is responded to
+// once it's dismissed. Returns an error response if the dialog can't be
+// shown, or nullptr if it was.
+static FlMethodResponse* show_dialog(FlFileSelectorPlugin* self,
+                                     FlMethodCall* method_call,
+                                     const gchar* method, FlValue* properties,
+                                     bool return_list) {
+  if (fl_value_get_type(properties) != FL_VALUE_TYPE_MAP) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        kBadArgumentsError, "Argument map missing or malformed", nullptr));
+  }
+
+  g_autoptr(DialogRequest) request = g_new0(DialogRequest, 1);
+  request->self = FL_FILE_SELECTOR_PLUGIN(g_object_ref(self));
+  request->method_call = FL_METHOD_CALL(g_object_ref(method_call));
+  request->return_list = return_list;
+  FlValue* value = fl_value_lookup_string(properties, kStreamResultsKey);
+  request->stream_results = value != nullptr &&
+                            fl_value_get_type(value) == FL_VALUE_TYPE_BOOL &&
+                            fl_value_get_bool(value);
+  value = fl_value_lookup_string(properties, kIncludeMetadataKey);
+  request->include_metadata = value != nullptr &&
+                              fl_value_get_type(value) == FL_VALUE_TYPE_BOOL &&
+                              fl_value_get_bool(value);
+
+  if (use_portal()) {
+    show_portal_dialog(static_cast<DialogRequest*>(g_steal_pointer(&request)));
+    return nullptr;
+  }
+
+  FlMethodResponse* response = show_gtk_dialog(request);
+  if (response == nullptr) {
+    // The dialog now owns the request.
+    g_steal_pointer(&request);
+  }
+  return response;
 }
 
 // Called when a method call is received from Flutter.
@@ -194,23 +725,45 @@ static void method_call_cb(FlMethodChannel* channel, FlMethodCall* method_call,
   g_autoptr(FlMethodResponse) response = nullptr;
   if (strcmp(method, kOpenFileMethod) == 0 ||
       strcmp(method, kGetDirectoryPathMethod) == 0) {
-    response = show_dialog(self, method, args, true);
+    response = show_dialog(self, method_call, method, args, true);
   } else if (strcmp(method, kGetSavePathMethod) == 0) {
-    response = show_dialog(self, method, args, false);
+    response = show_dialog(self, method_call, method, args, false);
   } else {
     response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
   }
 
+  // A dialog is being shown, and will respond when it's dismissed.
+  if (response == nullptr) {
+    return;
+  }
+
   g_autoptr(GError) error = nullptr;
   if (!fl_method_call_respond(method_call, response, &error))
     g_warning("Failed to send method call response: %s", error->message);
 }
 
+// Called when Flutter starts listening for streamed results.
+static FlMethodErrorResponse* results_listen_cb(FlEventChannel* channel,
+                                                FlValue* args,
+                                                gpointer user_data) {
+  FL_FILE_SELECTOR_PLUGIN(user_data)->results_listening = TRUE;
+  return nullptr;
+}
+
+// Called when Flutter stops listening for streamed results.
+static FlMethodErrorResponse* results_cancel_cb(FlEventChannel* channel,
+                                                FlValue* args,
+                                                gpointer user_data) {
+  FL_FILE_SELECTOR_PLUGIN(user_data)->results_listening = FALSE;
+  return nullptr;
+}
+
 static void fl_file_selector_plugin_dispose(GObject* object) {
   FlFileSelectorPlugin* self = FL_FILE_SELECTOR_PLUGIN(object);
 
   g_clear_object(&self->registrar);
   g_clear_object(&self->channel);
+  g_clear_object(&self->results_channel);
 
   G_OBJECT_CLASS(fl_file_selector_plugin_parent_class)->dispose(object);
 }
@@ -236,6 +789,13 @@ FlFileSelectorPlugin* fl_file_selector_plugin_new(
   fl_method_channel_set_method_call_handler(self->channel, method_call_cb,
                                             g_object_ref(self), g_object_unref);
 
+  self->results_channel =
+      fl_event_channel_new(fl_plugin_registrar_get_messenger(registrar),
+                           kResultsChannelName, FL_METHOD_CODEC(codec));
+  fl_event_channel_set_stream_handlers(self->results_channel,
+                                       results_listen_cb, results_cancel_cb,
+                                       g_object_ref(self), g_object_unref);
+
   return self;
 }
 
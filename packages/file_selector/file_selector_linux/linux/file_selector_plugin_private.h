@@ -10,3 +10,28 @@
 GtkFileChooserNative* create_dialog_for_method(GtkWindow* window,
                                                const gchar* method,
                                                FlValue* properties);
+
+// Returns the xdg-desktop-portal FileChooser options for the given method call,
+// using |handle_token| as the request's handle token.
+GVariant* portal_options_for_method(const gchar* method, FlValue* properties,
+                                    const gchar* handle_token);
+
+// Splits |paths|, a list of path strings, into a list of lists of at most
+// |chunk_size| paths each, for streaming.
+FlValue* split_into_chunks(FlValue* paths, size_t chunk_size);
+
+// Returns the metadata map sent to Flutter for a file with |info|, which
+// should contain the attributes requested by query_file_metadata.
+FlValue* file_metadata_from_info(GFileInfo* info);
+
+// Called with |paths|, the list of paths passed to query_file_metadata, and
+// |metadata|, a list containing the metadata map for each path or null if it
+// couldn't be queried.
+typedef void (*FileMetadataCallback)(FlValue* paths, FlValue* metadata,
+                                     gpointer user_data);
+
+// Queries the size, modification time and MIME type of each path in |paths|
+// in parallel without blocking, and calls |callback| once all the queries
+// have finished.
+void query_file_metadata(FlValue* paths, FileMetadataCallback callback,
+                         gpointer user_data);
@@ -5,6 +5,7 @@
 #include "include/file_selector_linux/file_selector_plugin.h"
 
 #include <flutter_linux/flutter_linux.h>
+#include <glib/gstdio.h>
 #include <gtest/gtest.h>
 #include <gtk/gtk.h>
 
@@ -183,3 +184,172 @@ TEST(FileSelectorPlugin, TestGetMultipleDirectories) {
   EXPECT_EQ(gtk_file_chooser_get_select_multiple(GTK_FILE_CHOOSER(dialog)),
             true);
 }
+
+TEST(FileSelectorPlugin, TestSplitIntoChunks) {
+  g_autoptr(FlValue) paths = fl_value_new_list();
+  fl_value_append_take(paths, fl_value_new_string("/a"));
+  fl_value_append_take(paths, fl_value_new_string("/b"));
+  fl_value_append_take(paths, fl_value_new_string("/c"));
+
+  g_autoptr(FlValue) chunks = split_into_chunks(paths, 2);
+
+  ASSERT_EQ(fl_value_get_length(chunks), 2u);
+  FlValue* first = fl_value_get_list_value(chunks, 0);
+  ASSERT_EQ(fl_value_get_length(first), 2u);
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(first, 0)), "/a");
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(first, 1)), "/b");
+  FlValue* second = fl_value_get_list_value(chunks, 1);
+  ASSERT_EQ(fl_value_get_length(second), 1u);
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(second, 0)), "/c");
+}
+
+TEST(FileSelectorPlugin, TestSplitIntoChunksEmpty) {
+  g_autoptr(FlValue) paths = fl_value_new_list();
+
+  g_autoptr(FlValue) chunks = split_into_chunks(paths, 2);
+
+  EXPECT_EQ(fl_value_get_length(chunks), 0u);
+}
+
+TEST(FileSelectorPlugin, TestPortalOptionsForOpen) {
+  g_autoptr(FlValue) type_groups = fl_value_new_list();
+  {
+    g_autoptr(FlValue) extensions = fl_value_new_list();
+    fl_value_append_take(extensions, fl_value_new_string("*.txt"));
+    g_autoptr(FlValue) mime_types = fl_value_new_list();
+    fl_value_append_take(mime_types, fl_value_new_string("text/plain"));
+    g_autoptr(FlValue) text_group = fl_value_new_map();
+    fl_value_set_string_take(text_group, "label", fl_value_new_string("Text"));
+    fl_value_set_string(text_group, "extensions", extensions);
+    fl_value_set_string(text_group, "mimeTypes", mime_types);
+    fl_value_append(type_groups, text_group);
+  }
+  g_autoptr(FlValue) args = fl_value_new_map();
+  fl_value_set_string(args, "acceptedTypeGroups", type_groups);
+  fl_value_set_string_take(args, "multiple", fl_value_new_bool(true));
+  fl_value_set_string_take(args, "confirmButtonText",
+                           fl_value_new_string("Pick"));
+
+  g_autoptr(GVariant) options = g_variant_ref_sink(
+      portal_options_for_method("openFile", args, "token"));
+
+  const gchar* token = nullptr;
+  ASSERT_TRUE(g_variant_lookup(options, "handle_token", "&s", &token));
+  EXPECT_STREQ(token, "token");
+  gboolean multiple = FALSE;
+  ASSERT_TRUE(g_variant_lookup(options, "multiple", "b", &multiple));
+  EXPECT_TRUE(multiple);
+  const gchar* accept_label = nullptr;
+  ASSERT_TRUE(g_variant_lookup(options, "accept_label", "&s", &accept_label));
+  EXPECT_STREQ(accept_label, "Pick");
+  EXPECT_FALSE(g_variant_lookup(options, "directory", "b", nullptr));
+
+  g_autoptr(GVariant) filters = g_variant_lookup_value(
+      options, "filters", G_VARIANT_TYPE("a(sa(us))"));
+  ASSERT_NE(filters, nullptr);
+  g_autofree gchar* printed = g_variant_print(filters, FALSE);
+  EXPECT_STREQ(printed, "[('Text', [(0, '*.txt'), (1, 'text/plain')])]");
+}
+
+TEST(FileSelectorPlugin, TestPortalOptionsForDirectory) {
+  g_autoptr(FlValue) args = fl_value_new_map();
+
+  g_autoptr(GVariant) options = g_variant_ref_sink(
+      portal_options_for_method("getDirectoryPath", args, "token"));
+
+  gboolean directory = FALSE;
+  ASSERT_TRUE(g_variant_lookup(options, "directory", "b", &directory));
+  EXPECT_TRUE(directory);
+  EXPECT_EQ(g_variant_lookup_value(options, "filters", nullptr), nullptr);
+}
+
+TEST(FileSelectorPlugin, TestFileMetadataFromInfo) {
+  g_autoptr(GFileInfo) info = g_file_info_new();
+  g_file_info_set_size(info, 42);
+  g_file_info_set_attribute_uint64(info, G_FILE_ATTRIBUTE_TIME_MODIFIED, 1000);
+  g_file_info_set_attribute_uint32(info, G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC,
+                                   250000);
+  g_file_info_set_attribute_string(
+      info, G_FILE_ATTRIBUTE_STANDARD_FAST_CONTENT_TYPE, "text/plain");
+
+  g_autoptr(FlValue) metadata = file_metadata_from_info(info);
+
+  ASSERT_EQ(fl_value_get_type(metadata), FL_VALUE_TYPE_MAP);
+  EXPECT_EQ(fl_value_get_int(fl_value_lookup_string(metadata, "size")), 42);
+  EXPECT_EQ(
+      fl_value_get_int(fl_value_lookup_string(metadata, "lastModified")),
+      1000250);
+  EXPECT_STREQ(
+      fl_value_get_string(fl_value_lookup_string(metadata, "mimeType")),
+      "text/plain");
+}
+
+TEST(FileSelectorPlugin, TestFileMetadataFromEmptyInfo) {
+  g_autoptr(GFileInfo) info = g_file_info_new();
+
+  g_autoptr(FlValue) metadata = file_metadata_from_info(info);
+
+  ASSERT_EQ(fl_value_get_type(metadata), FL_VALUE_TYPE_MAP);
+  EXPECT_EQ(fl_value_get_length(metadata), 0u);
+}
+
+// The result of a query_file_metadata call.
+typedef struct {
+  gboolean finished;
+  FlValue* metadata;
+} MetadataQueryResult;
+
+static void metadata_query_result_cb(FlValue* paths, FlValue* metadata,
+                                     gpointer user_data) {
+  MetadataQueryResult* result = static_cast<MetadataQueryResult*>(user_data);
+  result->finished = TRUE;
+  result->metadata = fl_value_ref(metadata);
+}
+
+TEST(FileSelectorPlugin, TestQueryFileMetadata) {
+  g_autofree gchar* directory =
+      g_dir_make_tmp("file_selector_linux_XXXXXX", nullptr);
+  ASSERT_NE(directory, nullptr);
+  g_autofree gchar* file_path = g_build_filename(directory, "a.txt", nullptr);
+  ASSERT_TRUE(g_file_set_contents(file_path, "hello", -1, nullptr));
+  g_autofree gchar* missing_path =
+      g_build_filename(directory, "missing.txt", nullptr);
+
+  g_autoptr(FlValue) paths = fl_value_new_list();
+  fl_value_append_take(paths, fl_value_new_string(file_path));
+  fl_value_append_take(paths, fl_value_new_string(missing_path));
+  MetadataQueryResult result = {};
+  query_file_metadata(paths, metadata_query_result_cb, &result);
+  while (!result.finished) {
+    g_main_context_iteration(nullptr, TRUE);
+  }
+  g_autoptr(FlValue) metadata = result.metadata;
+
+  ASSERT_EQ(fl_value_get_length(metadata), 2u);
+  FlValue* file_metadata = fl_value_get_list_value(metadata, 0);
+  ASSERT_EQ(fl_value_get_type(file_metadata), FL_VALUE_TYPE_MAP);
+  EXPECT_EQ(fl_value_get_int(fl_value_lookup_string(file_metadata, "size")),
+            5);
+  EXPECT_GT(
+      fl_value_get_int(fl_value_lookup_string(file_metadata, "lastModified")),
+      0);
+  EXPECT_STREQ(
+      fl_value_get_string(fl_value_lookup_string(file_metadata, "mimeType")),
+      "text/plain");
+  EXPECT_EQ(fl_value_get_type(fl_value_get_list_value(metadata, 1)),
+            FL_VALUE_TYPE_NULL);
+
+  g_remove(file_path);
+  g_rmdir(directory);
+}
+
+TEST(FileSelectorPlugin, TestQueryFileMetadataEmpty) {
+  g_autoptr(FlValue) paths = fl_value_new_list();
+  MetadataQueryResult result = {};
+
+  query_file_metadata(paths, metadata_query_result_cb, &result);
+
+  ASSERT_TRUE(result.finished);
+  g_autoptr(FlValue) metadata = result.metadata;
+  EXPECT_EQ(fl_value_get_length(metadata), 0u);
+}
@@ -67,6 +67,7 @@ void main() {
           'initialDirectory': null,
           'confirmButtonText': null,
           'multiple': false,
+          'includeMetadata': true,
         },
       );
     });
@@ -81,6 +82,7 @@ void main() {
           'initialDirectory': '/example/directory',
           'confirmButtonText': null,
           'multiple': false,
+          'includeMetadata': true,
         },
       );
     });
@@ -95,6 +97,7 @@ void main() {
           'initialDirectory': null,
           'confirmButtonText': 'Open File',
           'multiple': false,
+          'includeMetadata': true,
         },
       );
     });
@@ -130,6 +133,7 @@ void main() {
           'initialDirectory': null,
           'confirmButtonText': null,
           'multiple': false,
+          'includeMetadata': true,
         },
       );
     });
@@ -170,6 +174,7 @@ void main() {
           'initialDirectory': null,
           'confirmButtonText': null,
           'multiple': true,
+          'includeMetadata': true,
         },
       );
     });
@@ -184,6 +189,7 @@ void main() {
           'initialDirectory': '/example/directory',
           'confirmButtonText': null,
           'multiple': true,
+          'includeMetadata': true,
         },
       );
     });
@@ -198,6 +204,7 @@ void main() {
           'initialDirectory': null,
           'confirmButtonText': 'Open File',
           'multiple': true,
+          'includeMetadata': true,
         },
       );
     });
@@ -233,11 +240,153 @@ void main() {
           'initialDirectory': null,
           'confirmButtonText': null,
           'multiple': true,
+          'includeMetadata': true,
         },
       );
     });
   });
 
+  group('metadata', () {
+    test('openFile uses returned metadata', () async {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMethodCallHandler(plugin.channel,
+              (MethodCall methodCall) async {
+        return <String, Object?>{
+          'paths': <String>['/foo'],
+          'metadata': <Object?>[
+            <String, Object>{
+              'size': 42,
+              'lastModified': 1000,
+              'mimeType': 'text/plain',
+            },
+          ],
+        };
+      });
+
+      final XFile? file = await plugin.openFile();
+
+      expect(file!.path, '/foo');
+      expect(await file.length(), 42);
+      expect(await file.lastModified(),
+          DateTime.fromMillisecondsSinceEpoch(1000));
+      expect(file.mimeType, 'text/plain');
+    });
+
+    test('openFiles handles missing metadata', () async {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMethodCallHandler(plugin.channel,
+              (MethodCall methodCall) async {
+        return <String, Object?>{
+          'paths': <String>['/foo', '/bar'],
+          'metadata': <Object?>[
+            <String, Object>{'size': 42},
+            null,
+          ],
+        };
+      });
+
+      final List<XFile> files = await plugin.openFiles();
+
+      expect(files.map((XFile file) => file.path), <String>['/foo', '/bar']);
+      expect(await files[0].length(), 42);
+      expect(files[0].mimeType, null);
+      expect(files[1].mimeType, null);
+    });
+
+    test('openFiles accepts plain path lists', () async {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMethodCallHandler(plugin.channel,
+              (MethodCall methodCall) async {
+        return <String>['/foo', '/bar'];
+      });
+
+      final List<XFile> files = await plugin.openFiles();
+
+      expect(files.map((XFile file) => file.path), <String>['/foo', '/bar']);
+    });
+
+    test('openFile returns null when cancelled', () async {
+      expect(await plugin.openFile(), isNull);
+    });
+  });
+
+  group('openFilesInChunks', () {
+    const String resultsChannelName =
+        'plugins.flutter.dev/file_selector_linux/results';
+    const StandardMethodCodec codec = StandardMethodCodec();
+
+    setUp(() {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMethodCallHandler(const MethodChannel(resultsChannelName),
+              (MethodCall call) async => null);
+    });
+
+    tearDown(() {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMethodCallHandler(
+              const MethodChannel(resultsChannelName), null);
+    });
+
+    Future<void> sendChunk(List<String> paths) {
+      return _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .handlePlatformMessage(resultsChannelName,
+              codec.encodeSuccessEnvelope(paths), (ByteData? _) {});
+    }
+
+    test('requests streamed results and emits chunks', () async {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMethodCallHandler(plugin.channel,
+              (MethodCall methodCall) async {
+        log.add(methodCall);
+        await sendChunk(<String>['/foo', '/bar']);
+        await sendChunk(<String>['/baz']);
+        return <String>[];
+      });
+
+      final List<List<XFile>> chunks =
+          await plugin.openFilesInChunks().toList();
+
+      expect(chunks.length, 2);
+      expect(
+          chunks[0].map((XFile file) => file.path), <String>['/foo', '/bar']);
+      expect(chunks[1].map((XFile file) => file.path), <String>['/baz']);
+      expectMethodCall(
+        log,
+        'openFile',
+        arguments: <String, dynamic>{
+          'initialDirectory': null,
+          'confirmButtonText': null,
+          'multiple': true,
+          'streamResults': true,
+        },
+      );
+    });
+
+    test('emits directly returned paths as a chunk', () async {
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMethodCallHandler(plugin.channel,
+              (MethodCall methodCall) async => <String>['/foo']);
+
+      final List<List<XFile>> chunks =
+          await plugin.openFilesInChunks().toList();
+
+      expect(chunks.length, 1);
+      expect(chunks[0].map((XFile file) => file.path), <String>['/foo']);
+    });
+
+    test('is empty when cancelled', () async {
+      expect(await plugin.openFilesInChunks().toList(), isEmpty);
+    });
+  });
+
   group('getSaveLocation', () {
     test('passes the accepted type groups correctly', () async {
       const XTypeGroup group = XTypeGroup(
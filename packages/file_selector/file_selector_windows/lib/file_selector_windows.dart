@@ -2,14 +2,45 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+import 'dart:async';
+
 import 'package:file_selector_platform_interface/file_selector_platform_interface.dart';
+import 'package:flutter/services.dart';
 
+import 'src/cloud_file_download_progress.dart';
+import 'src/folder_entry.dart';
 import 'src/messages.g.dart';
 
+export 'src/cloud_file_download_progress.dart';
+export 'src/folder_entry.dart';
+export 'src/messages.g.dart' show Thumbnail;
+
+/// The channel that the native side streams selected paths on when
+/// [SelectionOptions.streamResults] is set.
+const EventChannel _resultsChannel =
+    EventChannel('plugins.flutter.io/file_selector_windows/results');
+
+/// The channel that the native side sends cloud file download progress on.
+const EventChannel _hydrationChannel =
+    EventChannel('plugins.flutter.io/file_selector_windows/hydration');
+
+/// The channel that the native side sends the files found by folder
+/// enumerations on.
+const EventChannel _enumerationChannel =
+    EventChannel('plugins.flutter.io/file_selector_windows/enumeration');
+
+/// Whether each file returned from a dialog with metadata is a cloud file
+/// placeholder whose data isn't all stored locally.
+final Expando<bool> _cloudPlaceholders = Expando<bool>();
+
 /// An implementation of [FileSelectorPlatform] for Windows.
 class FileSelectorWindows extends FileSelectorPlatform {
   final FileSelectorApi _hostApi = FileSelectorApi();
 
+  /// The ID to give the next folder enumeration, to tell its results apart
+  /// from those of other enumerations running at the same time.
+  int _nextEnumerationId = 0;
+
   /// Registers the Windows implementation.
   static void registerWith() {
     FileSelectorPlatform.instance = FileSelectorWindows();
@@ -26,10 +57,11 @@ class FileSelectorWindows extends FileSelectorPlatform {
           allowMultiple: false,
           selectFolders: false,
           allowedTypes: _typeGroupsFromXTypeGroups(acceptedTypeGroups),
+          includeMetadata: true,
         ),
         initialDirectory,
         confirmButtonText);
-    return result.paths.isEmpty ? null : XFile(result.paths.first!);
+    return result.paths.isEmpty ? null : _xFilesFromResult(result).first;
   }
 
   @override
@@ -43,10 +75,213 @@ class FileSelectorWindows extends FileSelectorPlatform {
           allowMultiple: true,
           selectFolders: false,
           allowedTypes: _typeGroupsFromXTypeGroups(acceptedTypeGroups),
+          includeMetadata: true,
         ),
         initialDirectory,
         confirmButtonText);
-    return result.paths.map((String? path) => XFile(path!)).toList();
+    return _xFilesFromResult(result);
+  }
+
+  /// Shows a dialog for selecting multiple files, and returns the selected
+  /// files in chunks as they are read from the dialog.
+  ///
+  /// This behaves like [openFiles], but avoids building a single large result
+  /// when a very large number of files is selected. The stream is closed once
+  /// the dialog has finished reporting results, and is empty if the dialog was
+  /// cancelled.
+  Stream<List<XFile>> openFilesInChunks({
+    List<XTypeGroup>? acceptedTypeGroups,
+    String? initialDirectory,
+    String? confirmButtonText,
+  }) {
+    final List<TypeGroup> allowedTypes =
+        _typeGroupsFromXTypeGroups(acceptedTypeGroups);
+    late final StreamController<List<XFile>> controller;
+    StreamSubscription<dynamic>? chunkSubscription;
+    controller = StreamController<List<XFile>>(
+      onListen: () {
+        // The listen request is sent before the dialog request, so the native
+        // side has a handler for the chunks by the time the dialog is shown.
+        chunkSubscription = _resultsChannel.receiveBroadcastStream().listen(
+            (dynamic paths) => controller.add(_xFilesFromPaths(
+                (paths as List<Object?>).cast<String?>())),
+            onError: controller.addError);
+        _hostApi
+            .showOpenDialog(
+                SelectionOptions(
+                  allowMultiple: true,
+                  selectFolders: false,
+                  allowedTypes: allowedTypes,
+                  streamResults: true,
+                ),
+                initialDirectory,
+                confirmButtonText)
+            .then((FileDialogResult result) {
+          // Paths are returned directly if streaming wasn't possible.
+          if (result.paths.isNotEmpty) {
+            controller.add(_xFilesFromPaths(result.paths));
+          }
+        }, onError: controller.addError).whenComplete(() async {
+          await chunkSubscription?.cancel();
+          chunkSubscription = null;
+          await controller.close();
+        });
+      },
+      onCancel: () async {
+        await chunkSubscription?.cancel();
+        chunkSubscription = null;
+      },
+    );
+    return controller.stream;
+  }
+
+  /// Registers a reusable configuration for [openFilesWithConfiguration],
+  /// returning its ID.
+  ///
+  /// This is useful for dialogs that are shown repeatedly with the same
+  /// filters, since the native side processes the filters once and has a
+  /// configured dialog ready before each show. Call
+  /// [unregisterOpenDialogConfiguration] when the configuration is no longer
+  /// needed.
+  Future<int> registerOpenDialogConfiguration({
+    List<XTypeGroup>? acceptedTypeGroups,
+    bool allowMultiple = true,
+    String? confirmButtonText,
+  }) {
+    return _hostApi.registerOpenDialogConfiguration(
+        SelectionOptions(
+          allowMultiple: allowMultiple,
+          selectFolders: false,
+          allowedTypes: _typeGroupsFromXTypeGroups(acceptedTypeGroups),
+          includeMetadata: true,
+        ),
+        confirmButtonText);
+  }
+
+  /// Releases a configuration returned by [registerOpenDialogConfiguration].
+  Future<void> unregisterOpenDialogConfiguration(int configurationId) {
+    return _hostApi.unregisterDialogConfiguration(configurationId);
+  }
+
+  /// Shows an open dialog using a configuration returned by
+  /// [registerOpenDialogConfiguration], and returns the selected files.
+  Future<List<XFile>> openFilesWithConfiguration(
+    int configurationId, {
+    String? initialDirectory,
+  }) async {
+    final FileDialogResult result = await _hostApi.showConfiguredOpenDialog(
+        configurationId, initialDirectory);
+    return _xFilesFromResult(result);
+  }
+
+  /// Returns thumbnails for each of [paths], scaled to fit within [size]
+  /// pixels in each dimension.
+  ///
+  /// Thumbnails come from the system thumbnail cache where possible, which is
+  /// much cheaper than decoding full-size images. Files without a thumbnail
+  /// use their icon instead. The entry for any path that can't be loaded is
+  /// null.
+  Future<List<Thumbnail?>> getThumbnails(List<String> paths,
+      {int size = 128}) {
+    return _hostApi.getThumbnails(paths, size);
+  }
+
+  /// Returns whether [file] is a cloud file placeholder, such as an
+  /// online-only OneDrive file, whose data isn't all stored locally.
+  ///
+  /// Reading such a file blocks until its cloud sync provider has downloaded
+  /// it, which can take a long time; [downloadCloudFiles] can be used to
+  /// download it in the background first.
+  ///
+  /// Returns null if [file] wasn't returned by [openFile], [openFiles], or
+  /// [openFilesWithConfiguration], or its state couldn't be determined.
+  bool? isCloudPlaceholder(XFile file) => _cloudPlaceholders[file];
+
+  /// Downloads the data of each of [paths] that is a cloud file placeholder,
+  /// in parallel on background threads.
+  ///
+  /// If [onProgress] is provided, it is called as each chunk of a file is
+  /// downloaded. Returns, for each path, whether all of its data is now
+  /// stored locally.
+  Future<List<bool>> downloadCloudFiles(
+    List<String> paths, {
+    void Function(CloudFileDownloadProgress progress)? onProgress,
+  }) async {
+    StreamSubscription<dynamic>? progressSubscription;
+    if (onProgress != null) {
+      final Set<String> requestedPaths = paths.toSet();
+      // Listening before the request is sent ensures that the native side
+      // has a handler for progress by the time the downloads start.
+      progressSubscription =
+          _hydrationChannel.receiveBroadcastStream().listen((dynamic event) {
+        final List<Object?> values = event as List<Object?>;
+        final String path = values[0]! as String;
+        // Other downloads may be in progress at the same time.
+        if (requestedPaths.contains(path)) {
+          onProgress(CloudFileDownloadProgress(
+            path: path,
+            downloadedBytes: values[1]! as int,
+            totalBytes: values[2]! as int,
+          ));
+        }
+      });
+    }
+    try {
+      final List<bool?> hydrated = await _hostApi.hydrateCloudFiles(paths);
+      return hydrated.map((bool? value) => value ?? false).toList();
+    } finally {
+      await progressSubscription?.cancel();
+    }
+  }
+
+  /// Lists the files in the folder at [path], and in all of its subfolders
+  /// unless [recursive] is false, in batches as they are found.
+  ///
+  /// This is much faster than walking a large folder, such as one returned by
+  /// [getDirectoryPath], with `Directory.list`, since the folder is read on a
+  /// background thread and entries are sent in large batches. If [extensions]
+  /// is not empty, only files with one of those extensions are listed. Links
+  /// to other folders, such as junctions, aren't followed.
+  ///
+  /// The stream is closed once the whole folder has been listed, and reports
+  /// an error if [path] can't be listed. Subfolders that can't be listed are
+  /// skipped.
+  Stream<List<FolderEntry>> enumerateFolder(
+    String path, {
+    List<String> extensions = const <String>[],
+    bool recursive = true,
+  }) {
+    final int enumerationId = _nextEnumerationId++;
+    late final StreamController<List<FolderEntry>> controller;
+    StreamSubscription<dynamic>? entrySubscription;
+    controller = StreamController<List<FolderEntry>>(
+      onListen: () {
+        // The listen request is sent before the enumeration request, so the
+        // native side has a handler for the entries by the time it starts.
+        entrySubscription =
+            _enumerationChannel.receiveBroadcastStream().listen(
+                (dynamic event) {
+          final List<Object?> values = event as List<Object?>;
+          // Other enumerations may be running at the same time.
+          if (values[0] == enumerationId) {
+            controller.add(_folderEntriesFromEvent(values));
+          }
+        }, onError: controller.addError);
+        _hostApi
+            .enumerateFolder(enumerationId, path, extensions, recursive)
+            .then((int _) {}, onError: controller.addError)
+            .whenComplete(() async {
+          await entrySubscription?.cancel();
+          entrySubscription = null;
+          await controller.close();
+        });
+      },
+      onCancel: () async {
+        await entrySubscription?.cancel();
+        entrySubscription = null;
+      },
+    );
+    return controller.stream;
   }
 
   @override
@@ -121,6 +356,49 @@ class FileSelectorWindows extends FileSelectorPlatform {
   }
 }
 
+/// Returns the files in an event from the enumeration channel, which holds
+/// parallel lists of their paths, sizes, and last write times.
+List<FolderEntry> _folderEntriesFromEvent(List<Object?> event) {
+  final List<Object?> paths = event[1]! as List<Object?>;
+  final List<Object?> sizes = event[2]! as List<Object?>;
+  final List<Object?> lastWriteTimes = event[3]! as List<Object?>;
+  return List<FolderEntry>.generate(
+      paths.length,
+      (int i) => FolderEntry(
+            path: paths[i]! as String,
+            size: sizes[i]! as int,
+            lastModified: DateTime.fromMillisecondsSinceEpoch(
+                lastWriteTimes[i]! as int),
+          ));
+}
+
+List<XFile> _xFilesFromPaths(List<String?> paths) {
+  return paths.map((String? path) => XFile(path!)).toList();
+}
+
+/// Returns XFiles for the paths in [result], pre-populated with any metadata
+/// it contains so that reading it doesn't require filesystem access.
+List<XFile> _xFilesFromResult(FileDialogResult result) {
+  final List<FileMetadata?>? metadata = result.metadata;
+  if (metadata == null || metadata.length != result.paths.length) {
+    return _xFilesFromPaths(result.paths);
+  }
+  return List<XFile>.generate(result.paths.length, (int i) {
+    final FileMetadata? fileMetadata = metadata[i];
+    final int? lastWriteTime = fileMetadata?.lastWriteTime;
+    final XFile file = XFile(
+      result.paths[i]!,
+      mimeType: fileMetadata?.contentType,
+      length: fileMetadata?.size,
+      lastModified: lastWriteTime == null
+          ? null
+          : DateTime.fromMillisecondsSinceEpoch(lastWriteTime),
+    );
+    _cloudPlaceholders[file] = fileMetadata?.isCloudPlaceholder;
+    return file;
+  });
+}
+
 List<TypeGroup> _typeGroupsFromXTypeGroups(List<XTypeGroup>? xtypes) {
   return (xtypes ?? <XTypeGroup>[]).map((XTypeGroup xtype) {
     if (!xtype.allowsAny && (xtype.extensions?.isEmpty ?? true)) {
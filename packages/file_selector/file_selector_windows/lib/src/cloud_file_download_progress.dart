@@ -0,0 +1,41 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// The progress of a cloud file download started by
+/// `FileSelectorWindows.downloadCloudFiles`.
+@immutable
+class CloudFileDownloadProgress {
+  /// Creates a progress report for the file at [path].
+  const CloudFileDownloadProgress({
+    required this.path,
+    required this.downloadedBytes,
+    required this.totalBytes,
+  });
+
+  /// The path of the file being downloaded.
+  final String path;
+
+  /// The number of bytes of the file that are now stored locally.
+  final int downloadedBytes;
+
+  /// The size of the file, in bytes.
+  final int totalBytes;
+
+  @override
+  bool operator ==(Object other) {
+    return other is CloudFileDownloadProgress &&
+        other.path == path &&
+        other.downloadedBytes == downloadedBytes &&
+        other.totalBytes == totalBytes;
+  }
+
+  @override
+  int get hashCode => Object.hash(path, downloadedBytes, totalBytes);
+
+  @override
+  String toString() =>
+      'CloudFileDownloadProgress($path, $downloadedBytes/$totalBytes)';
+}
@@ -0,0 +1,39 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// A file found by `FileSelectorWindows.enumerateFolder`.
+@immutable
+class FolderEntry {
+  /// Creates an entry for the file at [path].
+  const FolderEntry({
+    required this.path,
+    required this.size,
+    required this.lastModified,
+  });
+
+  /// The path of the file.
+  final String path;
+
+  /// The size of the file, in bytes.
+  final int size;
+
+  /// The time the file was last written.
+  final DateTime lastModified;
+
+  @override
+  bool operator ==(Object other) {
+    return other is FolderEntry &&
+        other.path == path &&
+        other.size == size &&
+        other.lastModified == lastModified;
+  }
+
+  @override
+  int get hashCode => Object.hash(path, size, lastModified);
+
+  @override
+  String toString() => 'FolderEntry($path, $size bytes, $lastModified)';
+}
@@ -42,6 +42,8 @@ class SelectionOptions {
     required this.allowMultiple,
     required this.selectFolders,
     required this.allowedTypes,
+    this.streamResults,
+    this.includeMetadata,
   });
 
   bool allowMultiple;
@@ -50,11 +52,22 @@ class SelectionOptions {
 
   List<TypeGroup?> allowedTypes;
 
+  /// Whether the selected paths should be sent in chunks on the results event
+  /// channel while they are read, instead of in [FileDialogResult.paths].
+  ///
+  /// Ignored if nothing is listening to the results channel.
+  bool? streamResults;
+
+  /// Whether to return [FileDialogResult.metadata] for the selected files.
+  bool? includeMetadata;
+
   Object encode() {
     return <Object?>[
       allowMultiple,
       selectFolders,
       allowedTypes,
+      streamResults,
+      includeMetadata,
     ];
   }
 
@@ -64,6 +77,65 @@ class SelectionOptions {
       allowMultiple: result[0]! as bool,
       selectFolders: result[1]! as bool,
       allowedTypes: (result[2] as List<Object?>?)!.cast<TypeGroup?>(),
+      streamResults: result[3] as bool?,
+      includeMetadata: result[4] as bool?,
+    );
+  }
+}
+
+/// Metadata for a selected file, as reported by the shell.
+///
+/// Any value that the shell could not provide is null.
+class FileMetadata {
+  FileMetadata({
+    this.size,
+    this.lastWriteTime,
+    this.attributes,
+    this.contentType,
+    this.placeholderStatus,
+    this.isCloudPlaceholder,
+  });
+
+  /// The size of the file, in bytes.
+  int? size;
+
+  /// The time the file was last written, in milliseconds since the Unix epoch.
+  int? lastWriteTime;
+
+  /// The Win32 FILE_ATTRIBUTE_* flags for the file.
+  int? attributes;
+
+  /// The MIME type of the file, based on its extension.
+  String? contentType;
+
+  /// The PLACEHOLDER_STATES flags for the file, if it is managed by a cloud
+  /// sync provider such as OneDrive.
+  int? placeholderStatus;
+
+  /// Whether the file's data isn't all stored locally, so that reading it
+  /// will first download it from its cloud sync provider.
+  bool? isCloudPlaceholder;
+
+  Object encode() {
+    return <Object?>[
+      size,
+      lastWriteTime,
+      attributes,
+      contentType,
+      placeholderStatus,
+      isCloudPlaceholder,
+    ];
+  }
+
+  static FileMetadata decode(Object result) {
+    result as List<Object?>;
+    return FileMetadata(
+      size: result[0] as int?,
+      lastWriteTime: result[1] as int?,
+      attributes: result[2] as int?,
+      contentType: result[3] as String?,
+      placeholderStatus: result[4] as int?,
+      isCloudPlaceholder: result[5] as bool?,
     );
   }
 }
@@ -73,6 +145,7 @@ class FileDialogResult {
   FileDialogResult({
     required this.paths,
     this.typeGroupIndex,
+    this.metadata,
   });
 
   /// The selected paths.
@@ -86,10 +159,17 @@ class FileDialogResult {
   /// Null if no type groups were provided, or the dialog was canceled.
   int? typeGroupIndex;
 
+  /// Metadata for each entry in [paths], in the same order.
+  ///
+  /// Only set if [SelectionOptions.includeMetadata] was requested, and the
+  /// results were not streamed.
+  List<FileMetadata?>? metadata;
+
   Object encode() {
     return <Object?>[
       paths,
       typeGroupIndex,
+      metadata,
     ];
   }
 
@@ -98,6 +178,42 @@ class FileDialogResult {
     return FileDialogResult(
       paths: (result[0] as List<Object?>?)!.cast<String?>(),
       typeGroupIndex: result[1] as int?,
+      metadata: (result[2] as List<Object?>?)?.cast<FileMetadata?>(),
+    );
+  }
+}
+
+/// A thumbnail image for a file.
+class Thumbnail {
+  Thumbnail({
+    required this.width,
+    required this.height,
+    required this.bgraPixels,
+  });
+
+  /// The width of the image, in pixels.
+  int width;
+
+  /// The height of the image, in pixels.
+  int height;
+
+  /// The image data, as top-down rows of 32-bit premultiplied BGRA pixels.
+  Uint8List bgraPixels;
+
+  Object encode() {
+    return <Object?>[
+      width,
+      height,
+      bgraPixels,
+    ];
+  }
+
+  static Thumbnail decode(Object result) {
+    result as List<Object?>;
+    return Thumbnail(
+      width: result[0]! as int,
+      height: result[1]! as int,
+      bgraPixels: result[2]! as Uint8List,
     );
   }
 }
@@ -109,12 +225,18 @@ class _FileSelectorApiCodec extends StandardMessageCodec {
     if (value is FileDialogResult) {
       buffer.putUint8(128);
       writeValue(buffer, value.encode());
-    } else if (value is SelectionOptions) {
+    } else if (value is FileMetadata) {
       buffer.putUint8(129);
       writeValue(buffer, value.encode());
-    } else if (value is TypeGroup) {
+    } else if (value is SelectionOptions) {
       buffer.putUint8(130);
       writeValue(buffer, value.encode());
+    } else if (value is Thumbnail) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    } else if (value is TypeGroup) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -126,8 +248,12 @@ class _FileSelectorApiCodec extends StandardMessageCodec {
       case 128:
         return FileDialogResult.decode(readValue(buffer)!);
       case 129:
-        return SelectionOptions.decode(readValue(buffer)!);
+        return FileMetadata.decode(readValue(buffer)!);
       case 130:
+        return SelectionOptions.decode(readValue(buffer)!);
+      case 131:
+        return Thumbnail.decode(readValue(buffer)!);
+      case 132:
         return TypeGroup.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
@@ -208,4 +334,197 @@ class FileSelectorApi {
       return (replyList[0] as FileDialogResult?)!;
     }
   }
+
+  /// Returns thumbnails no larger than [size] pixels in either dimension for
+  /// each of [paths], using the system thumbnail cache.
+  ///
+  /// The entry for any path whose thumbnail can't be loaded is null.
+  Future<List<Thumbnail?>> getThumbnails(
+      List<String?> arg_paths, int arg_size) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.FileSelectorApi.getThumbnails', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_paths, arg_size]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as List<Object?>?)!.cast<Thumbnail?>();
+    }
+  }
+
+  /// Registers a reusable open dialog configuration, returning an ID to pass
+  /// to [showConfiguredOpenDialog].
+  ///
+  /// The filters and options are processed once, and a configured native
+  /// dialog is prepared ahead of each show.
+  Future<int> registerOpenDialogConfiguration(
+      SelectionOptions arg_options, String? arg_confirmButtonText) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.FileSelectorApi.registerOpenDialogConfiguration',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_options, arg_confirmButtonText]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as int?)!;
+    }
+  }
+
+  /// Releases a configuration returned by [registerOpenDialogConfiguration].
+  Future<void> unregisterDialogConfiguration(int arg_configurationId) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.FileSelectorApi.unregisterDialogConfiguration',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_configurationId]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Shows an open dialog using a configuration returned by
+  /// [registerOpenDialogConfiguration].
+  Future<FileDialogResult> showConfiguredOpenDialog(
+      int arg_configurationId, String? arg_initialDirectory) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.FileSelectorApi.showConfiguredOpenDialog', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_configurationId, arg_initialDirectory])
+            as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as FileDialogResult?)!;
+    }
+  }
+
+  /// Downloads the data of each of [paths] that is a cloud file placeholder,
+  /// in parallel on background threads.
+  ///
+  /// Progress is sent on the hydration event channel while anything is
+  /// listening to it. Returns, for each path, whether all of its data is now
+  /// stored locally.
+  Future<List<bool?>> hydrateCloudFiles(List<String?> arg_paths) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.FileSelectorApi.hydrateCloudFiles', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_paths]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as List<Object?>?)!.cast<bool?>();
+    }
+  }
+
+  /// Lists the files in the folder at [path] on a background thread, and in
+  /// its subfolders if [recursive] is set.
+  ///
+  /// Only files with one of [extensions] are listed, unless it is empty.
+  /// Entries are sent in batches on the enumeration event channel, tagged
+  /// with [enumerationId], while anything is listening to it. Returns the
+  /// number of files found.
+  Future<int> enumerateFolder(int arg_enumerationId, String arg_path,
+      List<String?> arg_extensions, bool arg_recursive) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.FileSelectorApi.enumerateFolder', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(<Object?>[
+      arg_enumerationId,
+      arg_path,
+      arg_extensions,
+      arg_recursive
+    ]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as int?)!;
+    }
+  }
 }
@@ -27,6 +27,8 @@ class SelectionOptions {
     this.allowMultiple = false,
     this.selectFolders = false,
     this.allowedTypes = const <TypeGroup?>[],
+    this.streamResults,
+    this.includeMetadata,
   });
   bool allowMultiple;
   bool selectFolders;
@@ -35,11 +37,54 @@ class SelectionOptions {
   // https://github.com/flutter/flutter/issues/97848
   // The C++ code treats the values as non-nullable.
   List<TypeGroup?> allowedTypes;
+
+  /// Whether the selected paths should be sent in chunks on the results event
+  /// channel while they are read, instead of in [FileDialogResult.paths].
+  ///
+  /// Ignored if nothing is listening to the results channel.
+  bool? streamResults;
+
+  /// Whether to return [FileDialogResult.metadata] for the selected files.
+  bool? includeMetadata;
+}
+
+/// Metadata for a selected file, as reported by the shell.
+///
+/// Any value that the shell could not provide is null.
+class FileMetadata {
+  FileMetadata({
+    this.size,
+    this.lastWriteTime,
+    this.attributes,
+    this.contentType,
+    this.placeholderStatus,
+    this.isCloudPlaceholder,
+  });
+
+  /// The size of the file, in bytes.
+  int? size;
+
+  /// The time the file was last written, in milliseconds since the Unix epoch.
+  int? lastWriteTime;
+
+  /// The Win32 FILE_ATTRIBUTE_* flags for the file.
+  int? attributes;
+
+  /// The MIME type of the file, based on its extension.
+  String? contentType;
+
+  /// The PLACEHOLDER_STATES flags for the file, if it is managed by a cloud
+  /// sync provider such as OneDrive.
+  int? placeholderStatus;
+
+  /// Whether the file's data isn't all stored locally, so that reading it
+  /// will first download it from its cloud sync provider.
+  bool? isCloudPlaceholder;
 }
 
 /// The result from an open or save dialog.
 class FileDialogResult {
-  FileDialogResult({required this.paths, this.typeGroupIndex});
+  FileDialogResult({required this.paths, this.typeGroupIndex, this.metadata});
 
   /// The selected paths.
   ///
@@ -54,19 +99,100 @@ class FileDialogResult {
   ///
   /// Null if no type groups were provided, or the dialog was canceled.
   int? typeGroupIndex;
+
+  /// Metadata for each entry in [paths], in the same order.
+  ///
+  /// Only set if [SelectionOptions.includeMetadata] was requested, and the
+  /// results were not streamed.
+  // TODO(stuartmorgan): Make the generic type non-nullable once supported.
+  // https://github.com/flutter/flutter/issues/97848
+  // The Dart code treats the values as non-nullable.
+  List<FileMetadata?>? metadata;
+}
+
+/// A thumbnail image for a file.
+class Thumbnail {
+  Thumbnail({
+    required this.width,
+    required this.height,
+    required this.bgraPixels,
+  });
+
+  /// The width of the image, in pixels.
+  int width;
+
+  /// The height of the image, in pixels.
+  int height;
+
+  /// The image data, as top-down rows of 32-bit premultiplied BGRA pixels.
+  Uint8List bgraPixels;
 }
 
 @HostApi(dartHostTestHandler: 'TestFileSelectorApi')
 abstract class FileSelectorApi {
+  @async
   FileDialogResult showOpenDialog(
     SelectionOptions options,
     String? initialDirectory,
     String? confirmButtonText,
   );
+  @async
   FileDialogResult showSaveDialog(
     SelectionOptions options,
     String? initialDirectory,
     String? suggestedName,
     String? confirmButtonText,
   );
+
+  /// Returns thumbnails no larger than [size] pixels in either dimension for
+  /// each of [paths], using the system thumbnail cache.
+  ///
+  /// The entry for any path whose thumbnail can't be loaded is null.
+  @async
+  List<Thumbnail?> getThumbnails(List<String?> paths, int size);
+
+  /// Registers a reusable open dialog configuration, returning an ID to pass
+  /// to [showConfiguredOpenDialog].
+  ///
+  /// The filters and options are processed once, and a configured native
+  /// dialog is prepared ahead of each show.
+  int registerOpenDialogConfiguration(
+    SelectionOptions options,
+    String? confirmButtonText,
+  );
+
+  /// Releases a configuration returned by [registerOpenDialogConfiguration].
+  void unregisterDialogConfiguration(int configurationId);
+
+  /// Shows an open dialog using a configuration returned by
+  /// [registerOpenDialogConfiguration].
+  @async
+  FileDialogResult showConfiguredOpenDialog(
+    int configurationId,
+    String? initialDirectory,
+  );
+
+  /// Downloads the data of each of [paths] that is a cloud file placeholder,
+  /// in parallel on background threads.
+  ///
+  /// Progress is sent on the hydration event channel while anything is
+  /// listening to it. Returns, for each path, whether all of its data is now
+  /// stored locally.
+  @async
+  List<bool?> hydrateCloudFiles(List<String?> paths);
+
+  /// Lists the files in the folder at [path] on a background thread, and in
+  /// its subfolders if [recursive] is set.
+  ///
+  /// Only files with one of [extensions] are listed, unless it is empty.
+  /// Entries are sent in batches on the enumeration event channel, tagged
+  /// with [enumerationId], while anything is listening to it. Returns the
+  /// number of files found.
+  @async
+  int enumerateFolder(
+    int enumerationId,
+    String path,
+    List<String?> extensions,
+    bool recursive,
+  );
 }
@@ -6,6 +6,7 @@ import 'package:file_selector_platform_interface/file_selector_platform_interfac
 import 'package:file_selector_windows/file_selector_windows.dart';
 import 'package:file_selector_windows/src/messages.g.dart';
 import 'package:flutter/foundation.dart';
+import 'package:flutter/services.dart';
 import 'package:flutter_test/flutter_test.dart';
 import 'package:mockito/annotations.dart';
 import 'package:mockito/mockito.dart';
@@ -33,7 +34,7 @@ void main() {
   group('openFile', () {
     setUp(() {
       when(mockApi.showOpenDialog(any, any, any))
-          .thenReturn(FileDialogResult(paths: <String?>['foo']));
+          .thenAnswer((_) async => FileDialogResult(paths: <String?>['foo']));
     });
 
     test('simple call works', () async {
@@ -109,7 +110,8 @@ void main() {
   group('openFiles', () {
     setUp(() {
       when(mockApi.showOpenDialog(any, any, any))
-          .thenReturn(FileDialogResult(paths: <String?>['foo', 'bar']));
+          .thenAnswer((_) async =>
+              FileDialogResult(paths: <String?>['foo', 'bar']));
     });
 
     test('simple call works', () async {
@@ -122,6 +124,47 @@ void main() {
       final SelectionOptions options = result.captured[0] as SelectionOptions;
       expect(options.allowMultiple, true);
       expect(options.selectFolders, false);
+      expect(options.includeMetadata, true);
+    });
+
+    test('uses returned metadata', () async {
+      when(mockApi.showOpenDialog(any, any, any)).thenAnswer((_) async =>
+          FileDialogResult(
+              paths: <String?>['foo', 'bar'],
+              metadata: <FileMetadata?>[
+                FileMetadata(
+                    size: 42,
+                    lastWriteTime: 1000,
+                    contentType: 'text/plain'),
+                FileMetadata(),
+              ]));
+
+      final List<XFile> files = await plugin.openFiles();
+
+      expect(await files[0].length(), 42);
+      expect(await files[0].lastModified(),
+          DateTime.fromMillisecondsSinceEpoch(1000));
+      expect(files[0].mimeType, 'text/plain');
+      expect(files[1].path, 'bar');
+      expect(files[1].mimeType, null);
+    });
+
+    test('reports cloud placeholders from returned metadata', () async {
+      when(mockApi.showOpenDialog(any, any, any)).thenAnswer((_) async =>
+          FileDialogResult(
+              paths: <String?>['foo', 'bar', 'baz'],
+              metadata: <FileMetadata?>[
+                FileMetadata(isCloudPlaceholder: true),
+                FileMetadata(isCloudPlaceholder: false),
+                FileMetadata(),
+              ]));
+
+      final List<XFile> files = await plugin.openFiles();
+
+      expect(plugin.isCloudPlaceholder(files[0]), true);
+      expect(plugin.isCloudPlaceholder(files[1]), false);
+      expect(plugin.isCloudPlaceholder(files[2]), null);
+      expect(plugin.isCloudPlaceholder(XFile('foo')), null);
     });
 
     test('passes the accepted type groups correctly', () async {
@@ -183,10 +226,297 @@ void main() {
     });
   });
 
+  group('openFilesInChunks', () {
+    const String resultsChannelName =
+        'plugins.flutter.io/file_selector_windows/results';
+    const StandardMethodCodec codec = StandardMethodCodec();
+
+    setUp(() {
+      TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .setMockMethodCallHandler(const MethodChannel(resultsChannelName),
+              (MethodCall call) async => null);
+    });
+
+    tearDown(() {
+      TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .setMockMethodCallHandler(
+              const MethodChannel(resultsChannelName), null);
+    });
+
+    Future<void> sendChunk(List<String> paths) {
+      return TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .handlePlatformMessage(resultsChannelName,
+              codec.encodeSuccessEnvelope(paths), (ByteData? _) {});
+    }
+
+    test('emits streamed chunks', () async {
+      when(mockApi.showOpenDialog(any, any, any)).thenAnswer((_) async {
+        await sendChunk(<String>['foo', 'bar']);
+        await sendChunk(<String>['baz']);
+        return FileDialogResult(paths: <String?>[]);
+      });
+
+      final List<List<XFile>> chunks =
+          await plugin.openFilesInChunks().toList();
+
+      expect(chunks.length, 2);
+      expect(chunks[0].map((XFile file) => file.path), <String>['foo', 'bar']);
+      expect(chunks[1].map((XFile file) => file.path), <String>['baz']);
+      final VerificationResult result =
+          verify(mockApi.showOpenDialog(captureAny, null, null));
+      final SelectionOptions options = result.captured[0] as SelectionOptions;
+      expect(options.allowMultiple, true);
+      expect(options.selectFolders, false);
+      expect(options.streamResults, true);
+    });
+
+    test('emits directly returned paths as a chunk', () async {
+      when(mockApi.showOpenDialog(any, any, any))
+          .thenAnswer((_) async =>
+              FileDialogResult(paths: <String?>['foo', 'bar']));
+
+      final List<List<XFile>> chunks =
+          await plugin.openFilesInChunks().toList();
+
+      expect(chunks.length, 1);
+      expect(chunks[0].map((XFile file) => file.path), <String>['foo', 'bar']);
+    });
+
+    test('is empty when cancelled', () async {
+      when(mockApi.showOpenDialog(any, any, any))
+          .thenAnswer((_) async => FileDialogResult(paths: <String?>[]));
+
+      expect(await plugin.openFilesInChunks().toList(), isEmpty);
+    });
+
+    test('passes initialDirectory and confirmButtonText correctly', () async {
+      when(mockApi.showOpenDialog(any, any, any))
+          .thenAnswer((_) async => FileDialogResult(paths: <String?>[]));
+
+      await plugin
+          .openFilesInChunks(
+              initialDirectory: '/example/directory',
+              confirmButtonText: 'Open File')
+          .toList();
+
+      verify(mockApi.showOpenDialog(any, '/example/directory', 'Open File'));
+    });
+  });
+
+  group('downloadCloudFiles', () {
+    const String hydrationChannelName =
+        'plugins.flutter.io/file_selector_windows/hydration';
+    const StandardMethodCodec codec = StandardMethodCodec();
+
+    setUp(() {
+      TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .setMockMethodCallHandler(const MethodChannel(hydrationChannelName),
+              (MethodCall call) async => null);
+    });
+
+    tearDown(() {
+      TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .setMockMethodCallHandler(
+              const MethodChannel(hydrationChannelName), null);
+    });
+
+    Future<void> sendProgress(String path, int downloaded, int total) {
+      return TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .handlePlatformMessage(
+              hydrationChannelName,
+              codec.encodeSuccessEnvelope(<Object>[path, downloaded, total]),
+              (ByteData? _) {});
+    }
+
+    test('passes paths and returns results', () async {
+      when(mockApi.hydrateCloudFiles(any))
+          .thenAnswer((_) async => <bool?>[true, false, null]);
+
+      final List<bool> results =
+          await plugin.downloadCloudFiles(<String>['foo', 'bar', 'baz']);
+
+      expect(results, <bool>[true, false, false]);
+      verify(mockApi.hydrateCloudFiles(<String>['foo', 'bar', 'baz']));
+    });
+
+    test('reports progress for the requested paths', () async {
+      when(mockApi.hydrateCloudFiles(any)).thenAnswer((_) async {
+        await sendProgress('foo', 10, 20);
+        await sendProgress('other', 1, 2);
+        await sendProgress('foo', 20, 20);
+        return <bool?>[true];
+      });
+      final List<CloudFileDownloadProgress> progress =
+          <CloudFileDownloadProgress>[];
+
+      await plugin.downloadCloudFiles(<String>['foo'],
+          onProgress: progress.add);
+
+      expect(progress, const <CloudFileDownloadProgress>[
+        CloudFileDownloadProgress(
+            path: 'foo', downloadedBytes: 10, totalBytes: 20),
+        CloudFileDownloadProgress(
+            path: 'foo', downloadedBytes: 20, totalBytes: 20),
+      ]);
+    });
+  });
+
+  group('enumerateFolder', () {
+    const String enumerationChannelName =
+        'plugins.flutter.io/file_selector_windows/enumeration';
+    const StandardMethodCodec codec = StandardMethodCodec();
+
+    setUp(() {
+      TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .setMockMethodCallHandler(const MethodChannel(enumerationChannelName),
+              (MethodCall call) async => null);
+    });
+
+    tearDown(() {
+      TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .setMockMethodCallHandler(
+              const MethodChannel(enumerationChannelName), null);
+    });
+
+    Future<void> sendEntries(int enumerationId, List<String> paths,
+        List<int> sizes, List<int> lastWriteTimes) {
+      return TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+          .handlePlatformMessage(
+              enumerationChannelName,
+              codec.encodeSuccessEnvelope(
+                  <Object>[enumerationId, paths, sizes, lastWriteTimes]),
+              (ByteData? _) {});
+    }
+
+    test('emits the batches for its enumeration', () async {
+      when(mockApi.enumerateFolder(any, any, any, any))
+          .thenAnswer((Invocation invocation) async {
+        final int enumerationId = invocation.positionalArguments[0] as int;
+        await sendEntries(enumerationId, <String>[r'C:\a\1.jpg', r'C:\a\2.jpg'],
+            <int>[10, 20], <int>[1000, 2000]);
+        await sendEntries(enumerationId + 1, <String>[r'C:\b\1.jpg'],
+            <int>[30], <int>[3000]);
+        await sendEntries(
+            enumerationId, <String>[r'C:\a\b\3.jpg'], <int>[40], <int>[4000]);
+        return 3;
+      });
+
+      final List<List<FolderEntry>> batches =
+          await plugin.enumerateFolder(r'C:\a').toList();
+
+      expect(batches, <List<FolderEntry>>[
+        <FolderEntry>[
+          FolderEntry(
+              path: r'C:\a\1.jpg',
+              size: 10,
+              lastModified: DateTime.fromMillisecondsSinceEpoch(1000)),
+          FolderEntry(
+              path: r'C:\a\2.jpg',
+              size: 20,
+              lastModified: DateTime.fromMillisecondsSinceEpoch(2000)),
+        ],
+        <FolderEntry>[
+          FolderEntry(
+              path: r'C:\a\b\3.jpg',
+              size: 40,
+              lastModified: DateTime.fromMillisecondsSinceEpoch(4000)),
+        ],
+      ]);
+    });
+
+    test('passes extensions and recursive correctly', () async {
+      when(mockApi.enumerateFolder(any, any, any, any))
+          .thenAnswer((_) async => 0);
+
+      await plugin
+          .enumerateFolder(r'C:\a',
+              extensions: <String>['jpg', 'png'], recursive: false)
+          .toList();
+
+      verify(mockApi.enumerateFolder(
+          any, r'C:\a', <String>['jpg', 'png'], false));
+    });
+
+    test('reports errors', () async {
+      when(mockApi.enumerateFolder(any, any, any, any))
+          .thenAnswer((_) async => throw PlatformException(code: 'error'));
+
+      expect(plugin.enumerateFolder(r'C:\missing').toList(),
+          throwsA(isA<PlatformException>()));
+    });
+  });
+
+  group('dialog configurations', () {
+    test('register passes the options', () async {
+      when(mockApi.registerOpenDialogConfiguration(any, any)).thenReturn(3);
+      const XTypeGroup group = XTypeGroup(
+        label: 'text',
+        extensions: <String>['txt'],
+      );
+
+      final int id = await plugin.registerOpenDialogConfiguration(
+          acceptedTypeGroups: <XTypeGroup>[group],
+          confirmButtonText: 'Open File');
+
+      expect(id, 3);
+      final VerificationResult result = verify(
+          mockApi.registerOpenDialogConfiguration(captureAny, 'Open File'));
+      final SelectionOptions options = result.captured[0] as SelectionOptions;
+      expect(options.allowMultiple, true);
+      expect(options.selectFolders, false);
+      expect(_typeGroupListsMatch(options.allowedTypes, <TypeGroup>[
+        TypeGroup(label: 'text', extensions: <String>['txt']),
+      ]), true);
+    });
+
+    test('open returns the selected files', () async {
+      when(mockApi.showConfiguredOpenDialog(any, any)).thenAnswer(
+          (_) async => FileDialogResult(paths: <String?>['foo', 'bar']));
+
+      final List<XFile> files = await plugin.openFilesWithConfiguration(3,
+          initialDirectory: '/example/directory');
+
+      expect(files.map((XFile file) => file.path), <String>['foo', 'bar']);
+      verify(mockApi.showConfiguredOpenDialog(3, '/example/directory'));
+    });
+
+    test('unregister passes the ID', () async {
+      await plugin.unregisterOpenDialogConfiguration(3);
+
+      verify(mockApi.unregisterDialogConfiguration(3));
+    });
+  });
+
+  group('getThumbnails', () {
+    test('passes arguments and returns results', () async {
+      final Thumbnail thumbnail = Thumbnail(
+          width: 1,
+          height: 1,
+          bgraPixels: Uint8List.fromList(<int>[1, 2, 3, 4]));
+      when(mockApi.getThumbnails(any, any))
+          .thenAnswer((_) async => <Thumbnail?>[thumbnail, null]);
+
+      final List<Thumbnail?> thumbnails =
+          await plugin.getThumbnails(<String>['foo', 'bar'], size: 64);
+
+      expect(thumbnails, <Thumbnail?>[thumbnail, null]);
+      verify(mockApi.getThumbnails(<String>['foo', 'bar'], 64));
+    });
+
+    test('uses a default size', () async {
+      when(mockApi.getThumbnails(any, any))
+          .thenAnswer((_) async => <Thumbnail?>[]);
+
+      await plugin.getThumbnails(<String>['foo']);
+
+      verify(mockApi.getThumbnails(<String>['foo'], 128));
+    });
+  });
+
   group('getDirectoryPath', () {
     setUp(() {
       when(mockApi.showOpenDialog(any, any, any))
-          .thenReturn(FileDialogResult(paths: <String?>['foo']));
+          .thenAnswer((_) async => FileDialogResult(paths: <String?>['foo']));
     });
 
     test('simple call works', () async {
@@ -216,7 +546,8 @@ void main() {
   group('getDirectoryPaths', () {
     setUp(() {
       when(mockApi.showOpenDialog(any, any, any))
-          .thenReturn(FileDialogResult(paths: <String?>['foo', 'bar']));
+          .thenAnswer((_) async =>
+              FileDialogResult(paths: <String?>['foo', 'bar']));
     });
 
     test('simple call works', () async {
@@ -247,7 +578,7 @@ void main() {
   group('getSaveLocation', () {
     setUp(() {
       when(mockApi.showSaveDialog(any, any, any, any))
-          .thenReturn(FileDialogResult(paths: <String?>['foo']));
+          .thenAnswer((_) async => FileDialogResult(paths: <String?>['foo']));
     });
 
     test('simple call works', () async {
@@ -290,7 +621,7 @@ void main() {
     });
 
     test('returns the selected type group correctly', () async {
-      when(mockApi.showSaveDialog(any, any, any, any)).thenReturn(
+      when(mockApi.showSaveDialog(any, any, any, any)).thenAnswer((_) async =>
           FileDialogResult(paths: <String?>['foo'], typeGroupIndex: 1));
       const XTypeGroup group = XTypeGroup(
         label: 'text',
@@ -359,7 +690,7 @@ void main() {
   group('getSavePath (deprecated)', () {
     setUp(() {
       when(mockApi.showSaveDialog(any, any, any, any))
-          .thenReturn(FileDialogResult(paths: <String?>['foo']));
+          .thenAnswer((_) async => FileDialogResult(paths: <String?>['foo']));
     });
 
     test('simple call works', () async {
@@ -5,6 +5,8 @@
 // @dart=2.19
 
 // ignore_for_file: no_leading_underscores_for_library_prefixes
+import 'dart:async' as _i4;
+
 import 'package:file_selector_windows/src/messages.g.dart' as _i2;
 import 'package:mockito/mockito.dart' as _i1;
 
@@ -42,7 +44,7 @@ class MockTestFileSelectorApi extends _i1.Mock
   }
 
   @override
-  _i2.FileDialogResult showOpenDialog(
+  _i4.Future<_i2.FileDialogResult> showOpenDialog(
     _i2.SelectionOptions? options,
     String? initialDirectory,
     String? confirmButtonText,
@@ -56,7 +58,8 @@ class MockTestFileSelectorApi extends _i1.Mock
             confirmButtonText,
           ],
         ),
-        returnValue: _FakeFileDialogResult_0(
+        returnValue:
+            _i4.Future<_i2.FileDialogResult>.value(_FakeFileDialogResult_0(
           this,
           Invocation.method(
             #showOpenDialog,
@@ -66,10 +69,10 @@ class MockTestFileSelectorApi extends _i1.Mock
               confirmButtonText,
             ],
           ),
-        ),
-      ) as _i2.FileDialogResult);
+        )),
+      ) as _i4.Future<_i2.FileDialogResult>);
   @override
-  _i2.FileDialogResult showSaveDialog(
+  _i4.Future<_i2.FileDialogResult> showSaveDialog(
     _i2.SelectionOptions? options,
     String? initialDirectory,
     String? suggestedName,
@@ -85,7 +88,8 @@ class MockTestFileSelectorApi extends _i1.Mock
             confirmButtonText,
           ],
         ),
-        returnValue: _FakeFileDialogResult_0(
+        returnValue:
+            _i4.Future<_i2.FileDialogResult>.value(_FakeFileDialogResult_0(
           this,
           Invocation.method(
             #showSaveDialog,
@@ -96,6 +100,98 @@ class MockTestFileSelectorApi extends _i1.Mock
               confirmButtonText,
             ],
           ),
+        )),
+      ) as _i4.Future<_i2.FileDialogResult>);
+  @override
+  _i4.Future<List<_i2.Thumbnail?>> getThumbnails(
+    List<String?>? paths,
+    int? size,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #getThumbnails,
+          [
+            paths,
+            size,
+          ],
+        ),
+        returnValue: _i4.Future<List<_i2.Thumbnail?>>.value(<_i2.Thumbnail?>[]),
+      ) as _i4.Future<List<_i2.Thumbnail?>>);
+  @override
+  int registerOpenDialogConfiguration(
+    _i2.SelectionOptions? options,
+    String? confirmButtonText,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #registerOpenDialogConfiguration,
+          [
+            options,
+            confirmButtonText,
+          ],
+        ),
+        returnValue: 0,
+      ) as int);
+  @override
+  void unregisterDialogConfiguration(int? configurationId) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #unregisterDialogConfiguration,
+          [configurationId],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  _i4.Future<_i2.FileDialogResult> showConfiguredOpenDialog(
+    int? configurationId,
+    String? initialDirectory,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #showConfiguredOpenDialog,
+          [
+            configurationId,
+            initialDirectory,
+          ],
+        ),
+        returnValue:
+            _i4.Future<_i2.FileDialogResult>.value(_FakeFileDialogResult_0(
+          this,
+          Invocation.method(
+            #showConfiguredOpenDialog,
+            [
+              configurationId,
+              initialDirectory,
+            ],
+          ),
+        )),
+      ) as _i4.Future<_i2.FileDialogResult>);
+  @override
+  _i4.Future<List<bool?>> hydrateCloudFiles(List<String?>? paths) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #hydrateCloudFiles,
+          [paths],
+        ),
+        returnValue: _i4.Future<List<bool?>>.value(<bool?>[]),
+      ) as _i4.Future<List<bool?>>);
+  @override
+  _i4.Future<int> enumerateFolder(
+    int? enumerationId,
+    String? path,
+    List<String?>? extensions,
+    bool? recursive,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #enumerateFolder,
+          [
+            enumerationId,
+            path,
+            extensions,
+            recursive,
+          ],
         ),
-      ) as _i2.FileDialogResult);
+        returnValue: _i4.Future<int>.value(0),
+      ) as _i4.Future<int>);
 }
@@ -20,12 +20,18 @@ class _TestFileSelectorApiCodec extends StandardMessageCodec {
     if (value is FileDialogResult) {
       buffer.putUint8(128);
       writeValue(buffer, value.encode());
-    } else if (value is SelectionOptions) {
+    } else if (value is FileMetadata) {
       buffer.putUint8(129);
       writeValue(buffer, value.encode());
-    } else if (value is TypeGroup) {
+    } else if (value is SelectionOptions) {
       buffer.putUint8(130);
       writeValue(buffer, value.encode());
+    } else if (value is Thumbnail) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    } else if (value is TypeGroup) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -37,8 +43,12 @@ class _TestFileSelectorApiCodec extends StandardMessageCodec {
       case 128:
         return FileDialogResult.decode(readValue(buffer)!);
       case 129:
-        return SelectionOptions.decode(readValue(buffer)!);
+        return FileMetadata.decode(readValue(buffer)!);
       case 130:
+        return SelectionOptions.decode(readValue(buffer)!);
+      case 131:
+        return Thumbnail.decode(readValue(buffer)!);
+      case 132:
         return TypeGroup.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
@@ -51,15 +61,55 @@ abstract class TestFileSelectorApi {
       TestDefaultBinaryMessengerBinding.instance;
   static const MessageCodec<Object?> codec = _TestFileSelectorApiCodec();
 
-  FileDialogResult showOpenDialog(SelectionOptions options,
+  Future<FileDialogResult> showOpenDialog(SelectionOptions options,
       String? initialDirectory, String? confirmButtonText);
 
-  FileDialogResult showSaveDialog(
+  Future<FileDialogResult> showSaveDialog(
       SelectionOptions options,
       String? initialDirectory,
       String? suggestedName,
       String? confirmButtonText);
 
+  /// Returns thumbnails no larger than [size] pixels in either dimension for
+  /// each of [paths], using the system thumbnail cache.
+  ///
+  /// The entry for any path whose thumbnail can't be loaded is null.
+  Future<List<Thumbnail?>> getThumbnails(List<String?> paths, int size);
+
+  /// Registers a reusable open dialog configuration, returning an ID to pass
+  /// to [showConfiguredOpenDialog].
+  ///
+  /// The filters and options are processed once, and a configured native
+  /// dialog is prepared ahead of each show.
+  int registerOpenDialogConfiguration(
+      SelectionOptions options, String? confirmButtonText);
+
+  /// Releases a configuration returned by [registerOpenDialogConfiguration].
+  void unregisterDialogConfiguration(int configurationId);
+
+  /// Shows an open dialog using a configuration returned by
+  /// [registerOpenDialogConfiguration].
+  Future<FileDialogResult> showConfiguredOpenDialog(
+      int configurationId, String? initialDirectory);
+
+  /// Downloads the data of each of [paths] that is a cloud file placeholder,
+  /// in parallel on background threads.
+  ///
+  /// Progress is sent on the hydration event channel while anything is
+  /// listening to it. Returns, for each path, whether all of its data is now
+  /// stored locally.
+  Future<List<bool?>> hydrateCloudFiles(List<String?> paths);
+
+  /// Lists the files in the folder at [path] on a background thread, and in
+  /// its subfolders if [recursive] is set.
+  ///
+  /// Only files with one of [extensions] are listed, unless it is empty.
+  /// Entries are sent in batches on the enumeration event channel, tagged
+  /// with [enumerationId], while anything is listening to it. Returns the
+  /// number of files found.
+  Future<int> enumerateFolder(
+      int enumerationId, String path, List<String?> extensions, bool recursive);
+
   static void setup(TestFileSelectorApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
@@ -81,7 +131,7 @@ abstract class TestFileSelectorApi {
               'Argument for dev.flutter.pigeon.FileSelectorApi.showOpenDialog was null, expected non-null SelectionOptions.');
           final String? arg_initialDirectory = (args[1] as String?);
           final String? arg_confirmButtonText = (args[2] as String?);
-          final FileDialogResult output = api.showOpenDialog(
+          final FileDialogResult output = await api.showOpenDialog(
               arg_options!, arg_initialDirectory, arg_confirmButtonText);
           return <Object?>[output];
         });
@@ -107,8 +157,164 @@ abstract class TestFileSelectorApi {
           final String? arg_initialDirectory = (args[1] as String?);
           final String? arg_suggestedName = (args[2] as String?);
           final String? arg_confirmButtonText = (args[3] as String?);
-          final FileDialogResult output = api.showSaveDialog(arg_options!,
-              arg_initialDirectory, arg_suggestedName, arg_confirmButtonText);
+          final FileDialogResult output = await api.showSaveDialog(
+              arg_options!,
+              arg_initialDirectory,
+              arg_suggestedName,
+              arg_confirmButtonText);
+          return <Object?>[output];
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.FileSelectorApi.getThumbnails', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.getThumbnails was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final List<String?>? arg_paths =
+              (args[0] as List<Object?>?)?.cast<String?>();
+          assert(arg_paths != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.getThumbnails was null, expected non-null List<String?>.');
+          final int? arg_size = (args[1] as int?);
+          assert(arg_size != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.getThumbnails was null, expected non-null int.');
+          final List<Thumbnail?> output =
+              await api.getThumbnails(arg_paths!, arg_size!);
+          return <Object?>[output];
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.FileSelectorApi.registerOpenDialogConfiguration', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.registerOpenDialogConfiguration was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final SelectionOptions? arg_options = (args[0] as SelectionOptions?);
+          assert(arg_options != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.registerOpenDialogConfiguration was null, expected non-null SelectionOptions.');
+          final String? arg_confirmButtonText = (args[1] as String?);
+          final int output = api.registerOpenDialogConfiguration(
+              arg_options!, arg_confirmButtonText);
+          return <Object?>[output];
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.FileSelectorApi.unregisterDialogConfiguration', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.unregisterDialogConfiguration was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_configurationId = (args[0] as int?);
+          assert(arg_configurationId != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.unregisterDialogConfiguration was null, expected non-null int.');
+          api.unregisterDialogConfiguration(arg_configurationId!);
+          return <Object?>[];
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.FileSelectorApi.showConfiguredOpenDialog', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.showConfiguredOpenDialog was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_configurationId = (args[0] as int?);
+          assert(arg_configurationId != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.showConfiguredOpenDialog was null, expected non-null int.');
+          final String? arg_initialDirectory = (args[1] as String?);
+          final FileDialogResult output = await api.showConfiguredOpenDialog(
+              arg_configurationId!, arg_initialDirectory);
+          return <Object?>[output];
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.FileSelectorApi.hydrateCloudFiles', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.hydrateCloudFiles was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final List<String?>? arg_paths =
+              (args[0] as List<Object?>?)?.cast<String?>();
+          assert(arg_paths != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.hydrateCloudFiles was null, expected non-null List<String?>.');
+          final List<bool?> output = await api.hydrateCloudFiles(arg_paths!);
+          return <Object?>[output];
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.FileSelectorApi.enumerateFolder', codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.enumerateFolder was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_enumerationId = (args[0] as int?);
+          assert(arg_enumerationId != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.enumerateFolder was null, expected non-null int.');
+          final String? arg_path = (args[1] as String?);
+          assert(arg_path != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.enumerateFolder was null, expected non-null String.');
+          final List<String?>? arg_extensions =
+              (args[2] as List<Object?>?)?.cast<String?>();
+          assert(arg_extensions != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.enumerateFolder was null, expected non-null List<String?>.');
+          final bool? arg_recursive = (args[3] as bool?);
+          assert(arg_recursive != null,
+              'Argument for dev.flutter.pigeon.FileSelectorApi.enumerateFolder was null, expected non-null bool.');
+          final int output = await api.enumerateFolder(arg_enumerationId!,
+              arg_path!, arg_extensions!, arg_recursive!);
           return <Object?>[output];
         });
       }
@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#ifndef PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_DIALOG_THREAD_H_
+#define PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_DIALOG_THREAD_H_
+
+#include <windows.h>
+
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "task_runner.h"
+
+namespace file_selector_windows {
+
+// A TaskRunner backed by a dedicated single-threaded apartment thread, so that
+// modal file dialogs can run without blocking the platform thread.
+//
+// The thread pumps window messages while idle, as required for an STA thread.
+class DialogThread : public TaskRunner {
+ public:
+  DialogThread();
+
+  // Stops the thread after any already-posted tasks have run. This blocks
+  // until the thread exits, so will wait for an open dialog to be closed.
+  virtual ~DialogThread();
+
+  // Disallow copy and assign.
+  DialogThread(const DialogThread&) = delete;
+  DialogThread& operator=(const DialogThread&) = delete;
+
+  // TaskRunner:
+  void PostTask(std::function<void()> task) override;
+
+ private:
+  // The thread's main loop.
+  void Run();
+
+  // Runs all currently queued tasks. Returns false if the thread should exit.
+  bool RunQueuedTasks();
+
+  // Guards |tasks_| and |stopping_|.
+  std::mutex mutex_;
+  std::queue<std::function<void()>> tasks_;
+  bool stopping_ = false;
+
+  // An auto-reset event signaled when tasks are posted or the thread should
+  // stop.
+  HANDLE wake_event_;
+
+  std::thread thread_;
+};
+
+}  // namespace file_selector_windows
+
+#endif  // PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_DIALOG_THREAD_H_
@@ -3,29 +3,48 @@
 // found in the LICENSE file.
 #include "file_selector_plugin.h"
 
+#include <cfapi.h>
 #include <comdef.h>
 #include <comip.h>
+#include <flutter/event_channel.h>
+#include <flutter/event_stream_handler_functions.h>
 #include <flutter/flutter_view.h>
 #include <flutter/method_channel.h>
 #include <flutter/plugin_registrar_windows.h>
 #include <flutter/standard_method_codec.h>
+#include <initguid.h>
+#include <propkey.h>
 #include <shobjidl.h>
 #include <windows.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "dialog_thread.h"
 #include "file_dialog_controller.h"
 #include "string_utils.h"
+#include "task_runner.h"
+#include "thread_pool_task_runner.h"
+#include "tracing.h"
 
 _COM_SMARTPTR_TYPEDEF(IEnumShellItems, IID_IEnumShellItems);
 _COM_SMARTPTR_TYPEDEF(IFileDialog, IID_IFileDialog);
 _COM_SMARTPTR_TYPEDEF(IShellItem, IID_IShellItem);
+_COM_SMARTPTR_TYPEDEF(IShellItem2, IID_IShellItem2);
 _COM_SMARTPTR_TYPEDEF(IShellItemArray, IID_IShellItemArray);
+_COM_SMARTPTR_TYPEDEF(IShellItemImageFactory, IID_IShellItemImageFactory);
 
 namespace file_selector_windows {
+using windows_plugin_utils::Utf16FromUtf8;
+using windows_plugin_utils::Utf8FromUtf16;
 
 namespace {
 
@@ -36,6 +55,33 @@ using flutter::EncodableValue;
 // The kind of file dialog to show.
 enum class DialogMode { open, save };
 
+// The channel that selected paths are streamed on when requested.
+constexpr char kResultsChannelName[] =
+    "plugins.flutter.io/file_selector_windows/results";
+
+// The number of shell items to request from the result enumerator at a time.
+// This is also the maximum size of a streamed chunk of paths.
+constexpr ULONG kEnumerationBatchSize = 64;
+
+// The channel that cloud file download progress is sent on.
+constexpr char kHydrationChannelName[] =
+    "plugins.flutter.io/file_selector_windows/hydration";
+
+// The FILE_ATTRIBUTE_* flags of files whose data isn't all stored locally.
+constexpr DWORD kRemoteDataAttributes = FILE_ATTRIBUTE_RECALL_ON_DATA_ACCESS |
+                                        FILE_ATTRIBUTE_RECALL_ON_OPEN |
+                                        FILE_ATTRIBUTE_OFFLINE;
+
+// The number of bytes of a cloud file to download between progress reports.
+constexpr int64_t kHydrationChunkSize = 8 * 1024 * 1024;
+
+// The channel that files found by folder enumerations are sent on.
+constexpr char kEnumerationChannelName[] =
+    "plugins.flutter.io/file_selector_windows/enumeration";
+
+// The maximum number of files in each batch sent by a folder enumeration.
+constexpr size_t kFolderEntryBatchSize = 1024;
+
 // Returns the path for |shell_item| as a UTF-8 string, or an
 // empty string on failure.
 std::string GetPathForShellItem(IShellItem* shell_item) {
@@ -51,6 +97,276 @@ std::string GetPathForShellItem(IShellItem* shell_item) {
   return path;
 }
 
+// Converts |file_time| to milliseconds since the Unix epoch.
+int64_t UnixTimeMillisecondsFromFileTime(const FILETIME& file_time) {
+  // The number of 100ns FILETIME intervals between 1601-01-01 and 1970-01-01.
+  constexpr int64_t kUnixEpochOffset = 116444736000000000LL;
+  ULARGE_INTEGER intervals;
+  intervals.LowPart = file_time.dwLowDateTime;
+  intervals.HighPart = file_time.dwHighDateTime;
+  return (static_cast<int64_t>(intervals.QuadPart) - kUnixEpochOffset) / 10000;
+}
+
+// Returns the shell's metadata for |shell_item|. Any property that isn't
+// available is left unset.
+FileMetadata GetMetadataForShellItem(IShellItem* shell_item) {
+  FileMetadata metadata;
+  IShellItem2Ptr item;
+  if (shell_item == nullptr ||
+      !SUCCEEDED(shell_item->QueryInterface(IID_PPV_ARGS(&item)))) {
+    return metadata;
+  }
+  ULONGLONG size;
+  if (SUCCEEDED(item->GetUInt64(PKEY_Size, &size))) {
+    metadata.set_size(static_cast<int64_t>(size));
+  }
+  FILETIME last_write_time;
+  if (SUCCEEDED(item->GetFileTime(PKEY_DateModified, &last_write_time))) {
+    metadata.set_last_write_time(
+        UnixTimeMillisecondsFromFileTime(last_write_time));
+  }
+  ULONG attributes;
+  if (SUCCEEDED(item->GetUInt32(PKEY_FileAttributes, &attributes))) {
+    metadata.set_attributes(static_cast<int64_t>(attributes));
+    metadata.set_is_cloud_placeholder((attributes & kRemoteDataAttributes) !=
+                                      0);
+  }
+  // Only set for files in a folder managed by a cloud sync provider.
+  ULONG placeholder_status;
+  if (SUCCEEDED(
+          item->GetUInt32(PKEY_FilePlaceholderStatus, &placeholder_status))) {
+    metadata.set_placeholder_status(static_cast<int64_t>(placeholder_status));
+  }
+  wchar_t* content_type = nullptr;
+  if (SUCCEEDED(item->GetString(PKEY_ContentType, &content_type))) {
+    metadata.set_content_type(Utf8FromUtf16(content_type));
+    ::CoTaskMemFree(content_type);
+  }
+  return metadata;
+}
+
+// Returns a thumbnail for the file at |path| that is at most |size| pixels in
+// each dimension, or nullopt if one can't be created.
+std::optional<Thumbnail> GetThumbnailForPath(const std::string& path,
+                                             int size) {
+  std::wstring wide_path = Utf16FromUtf8(path);
+  IShellItemImageFactoryPtr image_factory;
+  if (!SUCCEEDED(SHCreateItemFromParsingName(
+          wide_path.c_str(), nullptr, IID_PPV_ARGS(&image_factory)))) {
+    return std::nullopt;
+  }
+  HBITMAP bitmap = nullptr;
+  // GetImage uses the system thumbnail cache, falling back to the file's icon
+  // if there is no thumbnail handler for its type.
+  if (!SUCCEEDED(image_factory->GetImage({size, size}, SIIGBF_RESIZETOFIT,
+                                         &bitmap))) {
+    return std::nullopt;
+  }
+  BITMAP bitmap_info;
+  if (::GetObject(bitmap, sizeof(bitmap_info), &bitmap_info) == 0) {
+    ::DeleteObject(bitmap);
+    return std::nullopt;
+  }
+  const LONG width = bitmap_info.bmWidth;
+  const LONG height = bitmap_info.bmHeight;
+  // Request top-down 32-bit rows, regardless of the bitmap's own layout.
+  BITMAPINFO pixel_format = {};
+  pixel_format.bmiHeader.biSize = sizeof(pixel_format.bmiHeader);
+  pixel_format.bmiHeader.biWidth = width;
+  pixel_format.bmiHeader.biHeight = -height;
+  pixel_format.bmiHeader.biPlanes = 1;
+  pixel_format.bmiHeader.biBitCount = 32;
+  pixel_format.bmiHeader.biCompression = BI_RGB;
+  std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+  HDC screen_dc = ::GetDC(nullptr);
+  int rows_copied = ::GetDIBits(screen_dc, bitmap, 0, height, pixels.data(),
+                                &pixel_format, DIB_RGB_COLORS);
+  ::ReleaseDC(nullptr, screen_dc);
+  ::DeleteObject(bitmap);
+  if (rows_copied != height) {
+    return std::nullopt;
+  }
+  return Thumbnail(width, height, pixels);
+}
+
+using CfHydratePlaceholderFunction = HRESULT(WINAPI*)(HANDLE, LARGE_INTEGER,
+                                                      LARGE_INTEGER,
+                                                      CF_HYDRATE_FLAGS,
+                                                      LPOVERLAPPED);
+
+// Returns CfHydratePlaceholder, or nullptr if the cloud files API isn't
+// available. It is loaded dynamically since cldapi.dll only exists on
+// Windows 10 version 1709 and later.
+CfHydratePlaceholderFunction GetCfHydratePlaceholder() {
+  static const CfHydratePlaceholderFunction function = [] {
+    HMODULE module = ::LoadLibraryExW(L"cldapi.dll", nullptr,
+                                      LOAD_LIBRARY_SEARCH_SYSTEM32);
+    return module ? reinterpret_cast<CfHydratePlaceholderFunction>(
+                        ::GetProcAddress(module, "CfHydratePlaceholder"))
+                  : nullptr;
+  }();
+  return function;
+}
+
+// Downloads any data of the file at |path| that isn't stored locally, calling
+// |progress| with the number of bytes stored locally and the size of the file
+// after each chunk.
+//
+// Returns whether all of the file's data is now stored locally.
+bool HydrateCloudFile(
+    const std::string& path,
+    const std::function<void(int64_t hydrated_bytes, int64_t total_bytes)>&
+        progress) {
+  std::wstring wide_path = Utf16FromUtf8(path);
+  const DWORD attributes = ::GetFileAttributesW(wide_path.c_str());
+  if (attributes == INVALID_FILE_ATTRIBUTES) {
+    return false;
+  }
+  if ((attributes & kRemoteDataAttributes) == 0 ||
+      (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+    return true;
+  }
+  HANDLE file = ::CreateFileW(
+      wide_path.c_str(), GENERIC_READ,
+      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+      OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER size;
+  bool hydrated = ::GetFileSizeEx(file, &size) != 0;
+  // CfHydratePlaceholder has no progress callback, so the file is hydrated a
+  // chunk at a time. Files that aren't cloud placeholders, such as those
+  // managed by other remote storage, are downloaded by reading them instead.
+  CfHydratePlaceholderFunction hydrate_placeholder = GetCfHydratePlaceholder();
+  std::vector<char> buffer;
+  for (int64_t offset = 0; hydrated && offset < size.QuadPart;) {
+    const int64_t length =
+        std::min<int64_t>(kHydrationChunkSize, size.QuadPart - offset);
+    if (hydrate_placeholder) {
+      LARGE_INTEGER chunk_offset;
+      chunk_offset.QuadPart = offset;
+      LARGE_INTEGER chunk_length;
+      chunk_length.QuadPart = length;
+      const HRESULT hydrate_result = hydrate_placeholder(
+          file, chunk_offset, chunk_length, CF_HYDRATE_FLAG_NONE, nullptr);
+      if (hydrate_result == HRESULT_FROM_WIN32(ERROR_NOT_A_CLOUD_FILE)) {
+        hydrate_placeholder = nullptr;
+      } else {
+        hydrated = SUCCEEDED(hydrate_result);
+      }
+    }
+    if (!hydrate_placeholder) {
+      buffer.resize(static_cast<size_t>(length));
+      LARGE_INTEGER position;
+      position.QuadPart = offset;
+      DWORD bytes_read = 0;
+      hydrated = ::SetFilePointerEx(file, position, nullptr, FILE_BEGIN) &&
+                 ::ReadFile(file, buffer.data(), static_cast<DWORD>(length),
+                            &bytes_read, nullptr) &&
+                 bytes_read == length;
+    }
+    offset += length;
+    if (hydrated) {
+      progress(offset, size.QuadPart);
+    }
+  }
+  ::CloseHandle(file);
+  return hydrated;
+}
+
+// Returns whether |file_name| ends with one of |extensions|, which must each
+// include their leading '.', ignoring case. Every name matches if
+// |extensions| is empty.
+bool HasExtension(const std::wstring& file_name,
+                  const std::vector<std::wstring>& extensions) {
+  if (extensions.empty()) {
+    return true;
+  }
+  for (const std::wstring& extension : extensions) {
+    if (file_name.size() > extension.size() &&
+        ::CompareStringOrdinal(
+            file_name.c_str() + file_name.size() - extension.size(),
+            static_cast<int>(extension.size()), extension.c_str(),
+            static_cast<int>(extension.size()), TRUE) == CSTR_EQUAL) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Lists the files with one of |extensions| in the folder at |path|, and in
+// its subfolders if |recursive| is set, calling |on_batch| with up to
+// kFolderEntryBatchSize files at a time. Subfolders that are reparse points,
+// such as junctions, aren't entered, to avoid cycles.
+//
+// Returns the number of files found, or the error from opening |path| if it
+// can't be listed. Subfolders that can't be listed are skipped.
+ErrorOr<int64_t> EnumerateFolderFiles(
+    const std::string& path, const std::vector<std::wstring>& extensions,
+    bool recursive,
+    const std::function<void(FolderEntryBatch&& entries)>& on_batch) {
+  int64_t file_count = 0;
+  FolderEntryBatch batch;
+  std::vector<std::wstring> pending_folders = {Utf16FromUtf8(path)};
+  bool is_root = true;
+  while (!pending_folders.empty()) {
+    std::wstring folder = std::move(pending_folders.back());
+    pending_folders.pop_back();
+    if (!folder.empty() && folder.back() != L'\\' && folder.back() != L'/') {
+      folder += L'\\';
+    }
+    // FindExInfoBasic skips looking up short names, and the large fetch flag
+    // reads each directory in fewer, larger kernel calls.
+    WIN32_FIND_DATAW find_data;
+    HANDLE find = ::FindFirstFileExW(
+        (folder + L'*').c_str(), FindExInfoBasic, &find_data,
+        FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+    if (find == INVALID_HANDLE_VALUE) {
+      const DWORD error = ::GetLastError();
+      // An empty drive root has no entries at all, not even '.' and '..'.
+      if (is_root && error != ERROR_FILE_NOT_FOUND) {
+        return FlutterError("System error", "Could not enumerate folder",
+                            EncodableValue(static_cast<int64_t>(error)));
+      }
+      is_root = false;
+      continue;
+    }
+    is_root = false;
+    do {
+      const std::wstring name = find_data.cFileName;
+      if ((find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+        if (recursive && name != L"." && name != L".." &&
+            (find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) == 0) {
+          pending_folders.push_back(folder + name);
+        }
+        continue;
+      }
+      if (!HasExtension(name, extensions)) {
+        continue;
+      }
+      ULARGE_INTEGER size;
+      size.LowPart = find_data.nFileSizeLow;
+      size.HighPart = find_data.nFileSizeHigh;
+      batch.paths.push_back(EncodableValue(Utf8FromUtf16(folder + name)));
+      batch.sizes.push_back(
+          EncodableValue(static_cast<int64_t>(size.QuadPart)));
+      batch.last_write_times.push_back(EncodableValue(
+          UnixTimeMillisecondsFromFileTime(find_data.ftLastWriteTime)));
+      ++file_count;
+      if (batch.paths.size() == kFolderEntryBatchSize) {
+        on_batch(std::move(batch));
+        batch = FolderEntryBatch();
+      }
+    } while (::FindNextFileW(find, &find_data));
+    ::FindClose(find);
+  }
+  if (!batch.paths.empty()) {
+    on_batch(std::move(batch));
+  }
+  return file_count;
+}
+
 // Implementation of FileDialogControllerFactory that makes standard
 // FileDialogController instances.
 class DefaultFileDialogControllerFactory : public FileDialogControllerFactory {
@@ -71,6 +387,57 @@ class DefaultFileDialogControllerFactory : public FileDialogControllerFactory {
   }
 };
 
+// A list of file type filters in the form IFileDialog expects.
+//
+// Since the filter specs point into strings owned by this object, it can't be
+// copied or moved; construct it in place wherever it needs to live.
+class FileTypeFilters {
+ public:
+  // Creates filters for |type_groups|, a list of TypeGroup values.
+  explicit FileTypeFilters(const EncodableList& type_groups) {
+    const std::wstring spec_delimiter = L";";
+    const std::wstring file_wildcard = L"*.";
+    names_.reserve(type_groups.size());
+    extensions_.reserve(type_groups.size());
+    for (const EncodableValue& filter_info_value : type_groups) {
+      const auto& type_group = std::any_cast<TypeGroup>(
+          std::get<CustomEncodableValue>(filter_info_value));
+      names_.push_back(Utf16FromUtf8(type_group.label()));
+      extensions_.push_back(L"");
+      std::wstring& spec = extensions_.back();
+      if (type_group.extensions().empty()) {
+        spec += L"*.*";
+      } else {
+        for (const EncodableValue& extension : type_group.extensions()) {
+          if (!spec.empty()) {
+            spec += spec_delimiter;
+          }
+          spec +=
+              file_wildcard + Utf16FromUtf8(std::get<std::string>(extension));
+        }
+      }
+    }
+    // Only take pointers into the strings once the vectors are complete, since
+    // growing them can move short strings' inline buffers.
+    specs_.reserve(names_.size());
+    for (size_t i = 0; i < names_.size(); ++i) {
+      specs_.push_back({names_[i].c_str(), extensions_[i].c_str()});
+    }
+  }
+
+  // Disallow copy, move, and assign.
+  FileTypeFilters(const FileTypeFilters&) = delete;
+  FileTypeFilters& operator=(const FileTypeFilters&) = delete;
+
+  UINT count() const { return static_cast<UINT>(specs_.size()); }
+  COMDLG_FILTERSPEC* specs() { return specs_.data(); }
+
+ private:
+  std::vector<std::wstring> names_;
+  std::vector<std::wstring> extensions_;
+  std::vector<COMDLG_FILTERSPEC> specs_;
+};
+
 // Wraps an IFileDialog, managing object lifetime as a scoped object and
 // providing a simplified API for interacting with it as needed for the plugin.
 class DialogWrapper {
@@ -124,42 +491,21 @@ class DialogWrapper {
   }
 
   // Sets the filters for allowed file types to select.
-  void SetFileTypeFilters(const EncodableList& filters) {
-    const std::wstring spec_delimiter = L";";
-    const std::wstring file_wildcard = L"*.";
-    std::vector<COMDLG_FILTERSPEC> filter_specs;
-    // Temporary ownership of the constructed strings whose data is used in
-    // filter_specs, so that they live until the call to SetFileTypes is done.
-    std::vector<std::wstring> filter_names;
-    std::vector<std::wstring> filter_extensions;
-    filter_extensions.reserve(filters.size());
-    filter_names.reserve(filters.size());
-
-    for (const EncodableValue& filter_info_value : filters) {
-      const auto& type_group = std::any_cast<TypeGroup>(
-          std::get<CustomEncodableValue>(filter_info_value));
-      filter_names.push_back(Utf16FromUtf8(type_group.label()));
-      filter_extensions.push_back(L"");
-      std::wstring& spec = filter_extensions.back();
-      if (type_group.extensions().empty()) {
-        spec += L"*.*";
-      } else {
-        for (const EncodableValue& extension : type_group.extensions()) {
-          if (!spec.empty()) {
-            spec += spec_delimiter;
-          }
-          spec +=
-              file_wildcard + Utf16FromUtf8(std::get<std::string>(extension));
-        }
-      }
-      filter_specs.push_back({filter_names.back().c_str(), spec.c_str()});
-    }
-    last_result_ = dialog_controller_->SetFileTypes(
-        static_cast<UINT>(filter_specs.size()), filter_specs.data());
+  void SetFileTypeFilters(FileTypeFilters& filters) {
+    last_result_ = dialog_controller_->SetFileTypes(filters.count(),
+                                                    filters.specs());
   }
 
   // Displays the dialog, and returns the result, or nullopt on error.
-  std::optional<FileDialogResult> Show(HWND parent_window) {
+  //
+  // If |chunk_handler| is non-null, selected paths are passed to it in batches
+  // as they are read, rather than being included in the returned result.
+  // Otherwise, if |include_metadata| is true, the result includes metadata for
+  // each selected item.
+  std::optional<FileDialogResult> Show(
+      HWND parent_window, bool include_metadata,
+      const ResultChunkHandler* chunk_handler) {
+    FILE_SELECTOR_TRACE_SCOPE("DialogWrapper::Show");
     assert(dialog_controller_);
     last_result_ = dialog_controller_->Show(parent_window);
     if (!SUCCEEDED(last_result_)) {
@@ -167,6 +513,7 @@ class DialogWrapper {
     }
 
     EncodableList files;
+    std::optional<EncodableList> metadata;
     if (is_open_dialog_) {
       IShellItemArrayPtr shell_items;
       last_result_ = dialog_controller_->GetResults(&shell_items);
@@ -178,10 +525,41 @@ class DialogWrapper {
       if (!SUCCEEDED(last_result_)) {
         return std::nullopt;
       }
-      IShellItemPtr shell_item;
-      while (item_enumerator->Next(1, &shell_item, nullptr) == S_OK) {
-        files.push_back(EncodableValue(GetPathForShellItem(shell_item)));
+      if (include_metadata && !chunk_handler) {
+        metadata = EncodableList();
       }
+      DWORD item_count = 0;
+      if (!chunk_handler && SUCCEEDED(shell_items->GetCount(&item_count))) {
+        files.reserve(item_count);
+        if (metadata) {
+          metadata->reserve(item_count);
+        }
+      }
+      IShellItem* batch[kEnumerationBatchSize];
+      HRESULT next_result;
+      do {
+        ULONG fetched = 0;
+        next_result =
+            item_enumerator->Next(kEnumerationBatchSize, batch, &fetched);
+        if (FAILED(next_result)) {
+          break;
+        }
+        EncodableList chunk;
+        EncodableList& paths = chunk_handler ? chunk : files;
+        paths.reserve(paths.size() + fetched);
+        for (ULONG i = 0; i < fetched; ++i) {
+          // Take ownership of the reference returned by Next.
+          IShellItemPtr shell_item(batch[i], false);
+          paths.push_back(EncodableValue(GetPathForShellItem(shell_item)));
+          if (metadata) {
+            metadata->push_back(
+                CustomEncodableValue(GetMetadataForShellItem(shell_item)));
+          }
+        }
+        if (chunk_handler && !chunk.empty()) {
+          (*chunk_handler)(chunk);
+        }
+      } while (next_result == S_OK);
     } else {
       IShellItemPtr shell_item;
       last_result_ = dialog_controller_->GetResult(&shell_item);
@@ -190,7 +568,8 @@ class DialogWrapper {
       }
       files.push_back(EncodableValue(GetPathForShellItem(shell_item)));
     }
-    FileDialogResult result(files, nullptr);
+    FileDialogResult result(files, nullptr,
+                            metadata ? &metadata.value() : nullptr);
     UINT file_type_index;
     if (SUCCEEDED(dialog_controller_->GetFileTypeIndex(&file_type_index)) &&
         file_type_index > 0) {
@@ -212,19 +591,10 @@ class DialogWrapper {
   HRESULT last_result_;
 };
 
-ErrorOr<FileDialogResult> ShowDialog(
-    const FileDialogControllerFactory& dialog_factory, HWND parent_window,
-    DialogMode mode, const SelectionOptions& options,
-    const std::string* initial_directory, const std::string* suggested_name,
-    const std::string* confirm_label) {
-  IID dialog_type =
-      mode == DialogMode::save ? CLSID_FileSaveDialog : CLSID_FileOpenDialog;
-  DialogWrapper dialog(dialog_factory, dialog_type);
-  if (!SUCCEEDED(dialog.last_result())) {
-    return FlutterError("System error", "Could not create dialog",
-                        EncodableValue(dialog.last_result()));
-  }
-
+// Applies the settings that don't vary between shows of a dialog.
+void ConfigureDialog(DialogWrapper& dialog, const SelectionOptions& options,
+                     const std::string* confirm_label,
+                     FileTypeFilters* filters) {
   FILEOPENDIALOGOPTIONS dialog_options = 0;
   if (options.select_folders()) {
     dialog_options |= FOS_PICKFOLDERS;
@@ -236,72 +606,629 @@ ErrorOr<FileDialogResult> ShowDialog(
     dialog.AddOptions(dialog_options);
   }
 
-  if (initial_directory) {
-    dialog.SetFolder(*initial_directory);
-  }
-  if (suggested_name) {
-    dialog.SetFileName(*suggested_name);
-  }
   if (confirm_label) {
     dialog.SetOkButtonLabel(*confirm_label);
   }
 
-  if (!options.allowed_types().empty()) {
-    dialog.SetFileTypeFilters(options.allowed_types());
+  if (filters && filters->count() > 0) {
+    dialog.SetFileTypeFilters(*filters);
   }
+}
 
-  std::optional<FileDialogResult> result = dialog.Show(parent_window);
+// Shows |dialog|, which has already been configured, and returns the result.
+ErrorOr<FileDialogResult> ShowConfiguredDialog(
+    DialogWrapper& dialog, HWND parent_window, const SelectionOptions& options,
+    const ResultChunkHandler* chunk_handler) {
+  const bool* include_metadata = options.include_metadata();
+  std::optional<FileDialogResult> result =
+      dialog.Show(parent_window, include_metadata && *include_metadata,
+                  chunk_handler);
   if (!result) {
     if (dialog.last_result() != HRESULT_FROM_WIN32(ERROR_CANCELLED)) {
       return FlutterError("System error", "Could not show dialog",
                           EncodableValue(dialog.last_result()));
     } else {
-      return FileDialogResult(EncodableList(), nullptr);
+      return FileDialogResult(EncodableList());
     }
   }
   return std::move(result.value());
 }
 
+ErrorOr<FileDialogResult> ShowDialog(
+    const FileDialogControllerFactory& dialog_factory, HWND parent_window,
+    DialogMode mode, const SelectionOptions& options,
+    const std::string* initial_directory, const std::string* suggested_name,
+    const std::string* confirm_label,
+    const ResultChunkHandler* chunk_handler) {
+  IID dialog_type =
+      mode == DialogMode::save ? CLSID_FileSaveDialog : CLSID_FileOpenDialog;
+  DialogWrapper dialog(dialog_factory, dialog_type);
+  if (!SUCCEEDED(dialog.last_result())) {
+    return FlutterError("System error", "Could not create dialog",
+                        EncodableValue(dialog.last_result()));
+  }
+
+  std::optional<FileTypeFilters> filters;
+  if (!options.allowed_types().empty()) {
+    filters.emplace(options.allowed_types());
+  }
+  ConfigureDialog(dialog, options, confirm_label,
+                  filters ? &filters.value() : nullptr);
+  if (initial_directory) {
+    dialog.SetFolder(*initial_directory);
+  }
+  if (suggested_name) {
+    dialog.SetFileName(*suggested_name);
+  }
+
+  return ShowConfiguredDialog(dialog, parent_window, options, chunk_handler);
+}
+
+// Creates an open dialog with the settings that don't vary between shows
+// already applied.
+//
+// Returns nullptr if the dialog can't be created, in which case
+// |create_result| is set to the failure.
+std::unique_ptr<DialogWrapper> CreateConfiguredOpenDialog(
+    const FileDialogControllerFactory& dialog_factory,
+    const SelectionOptions& options, const std::string* confirm_label,
+    FileTypeFilters& filters, HRESULT* create_result) {
+  auto dialog =
+      std::make_unique<DialogWrapper>(dialog_factory, CLSID_FileOpenDialog);
+  *create_result = dialog->last_result();
+  if (!SUCCEEDED(*create_result)) {
+    return nullptr;
+  }
+  ConfigureDialog(*dialog, options, confirm_label, &filters);
+  return dialog;
+}
+
+// Shows a dialog using |dialog_runner|, and then calls |result| with the
+// outcome using |platform_runner|.
+//
+// The string arguments are copied, so only need to be valid for the duration
+// of the call.
+void ShowDialogAsync(
+    const FileDialogControllerFactory& dialog_factory, HWND parent_window,
+    DialogMode mode, const SelectionOptions& options,
+    const std::string* initial_directory, const std::string* suggested_name,
+    const std::string* confirm_label, ResultChunkHandler chunk_handler,
+    TaskRunner* dialog_runner, TaskRunner* platform_runner,
+    std::function<void(ErrorOr<FileDialogResult> reply)> result) {
+  auto copy_string = [](const std::string* value) {
+    return value ? std::optional<std::string>(*value) : std::nullopt;
+  };
+  dialog_runner->PostTask(
+      [&dialog_factory, parent_window, mode, options,
+       initial_directory = copy_string(initial_directory),
+       suggested_name = copy_string(suggested_name),
+       confirm_label = copy_string(confirm_label),
+       chunk_handler = std::move(chunk_handler), platform_runner,
+       result = std::move(result)]() {
+        ErrorOr<FileDialogResult> dialog_result = ShowDialog(
+            dialog_factory, parent_window, mode, options,
+            initial_directory ? &initial_directory.value() : nullptr,
+            suggested_name ? &suggested_name.value() : nullptr,
+            confirm_label ? &confirm_label.value() : nullptr,
+            chunk_handler ? &chunk_handler : nullptr);
+        platform_runner->PostTask([result, dialog_result]() {
+          result(std::move(dialog_result));
+        });
+      });
+}
+
 // Returns the top-level window that owns |view|.
 HWND GetRootWindow(flutter::FlutterView* view) {
   return ::GetAncestor(view->GetNativeWindow(), GA_ROOT);
 }
 
+// Returns the window that dialogs are owned by: the app's active window,
+// which in an app with several windows may not be the one that hosts |view|,
+// or else the top-level window of |view|.
+//
+// Must be called on the platform thread, which owns the app's windows.
+HWND GetOwnerWindow(flutter::FlutterView* view) {
+  HWND active_window = ::GetActiveWindow();
+  if (active_window) {
+    return active_window;
+  }
+  return view ? GetRootWindow(view) : nullptr;
+}
+
+// A TaskRunner that runs tasks on the platform thread, by posting them as
+// messages to the Flutter view's top-level window.
+class PlatformThreadTaskRunner : public TaskRunner {
+ public:
+  explicit PlatformThreadTaskRunner(flutter::PluginRegistrarWindows* registrar)
+      : registrar_(registrar),
+        task_message_(::RegisterWindowMessage(
+            L"FileSelectorWindowsPlatformThreadTask")) {
+    window_proc_id_ = registrar_->RegisterTopLevelWindowProcDelegate(
+        [this](HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam) {
+          return HandleWindowProc(hwnd, message, wparam, lparam);
+        });
+  }
+
+  virtual ~PlatformThreadTaskRunner() {
+    registrar_->UnregisterTopLevelWindowProcDelegate(window_proc_id_);
+  }
+
+  // Disallow copy and assign.
+  PlatformThreadTaskRunner(const PlatformThreadTaskRunner&) = delete;
+  PlatformThreadTaskRunner& operator=(const PlatformThreadTaskRunner&) =
+      delete;
+
+  void PostTask(std::function<void()> task) override {
+    // Ownership is passed through the message, and reclaimed in
+    // HandleWindowProc.
+    auto* task_pointer = new std::function<void()>(std::move(task));
+    if (!::PostMessage(GetRootWindow(registrar_->GetView()), task_message_, 0,
+                       reinterpret_cast<LPARAM>(task_pointer))) {
+      delete task_pointer;
+    }
+  }
+
+ private:
+  std::optional<LRESULT> HandleWindowProc(HWND hwnd, UINT message,
+                                          WPARAM wparam, LPARAM lparam) {
+    if (message != task_message_) {
+      return std::nullopt;
+    }
+    std::unique_ptr<std::function<void()>> task(
+        reinterpret_cast<std::function<void()>*>(lparam));
+    (*task)();
+    return 0;
+  }
+
+  flutter::PluginRegistrarWindows* registrar_;
+  UINT task_message_;
+  int window_proc_id_ = -1;
+};
+
 }  // namespace
 
+// A registered open dialog configuration.
+//
+// IFileDialog instances can only be shown once, so rather than reusing a
+// dialog, the next one to show is created and configured ahead of time, once
+// the previous one has been dismissed.
+struct FileSelectorPlugin::DialogConfiguration {
+  DialogConfiguration(const SelectionOptions& options,
+                      const std::string* confirm_label)
+      : options(options),
+        confirm_label(confirm_label ? std::optional<std::string>(*confirm_label)
+                                    : std::nullopt),
+        filters(options.allowed_types()) {}
+
+  // Disallow copy and assign.
+  DialogConfiguration(const DialogConfiguration&) = delete;
+  DialogConfiguration& operator=(const DialogConfiguration&) = delete;
+
+  const std::string* confirm_label_pointer() const {
+    return confirm_label ? &confirm_label.value() : nullptr;
+  }
+
+  const SelectionOptions options;
+  const std::optional<std::string> confirm_label;
+  FileTypeFilters filters;
+
+  // The dialog to use for the next show, if one has been prepared. This must
+  // only be accessed on the dialog thread, since that is where the COM object
+  // lives.
+  std::unique_ptr<DialogWrapper> prepared_dialog;
+};
+
 // static
 void FileSelectorPlugin::RegisterWithRegistrar(
     flutter::PluginRegistrarWindows* registrar) {
   std::unique_ptr<FileSelectorPlugin> plugin =
       std::make_unique<FileSelectorPlugin>(
-          [registrar] { return GetRootWindow(registrar->GetView()); },
-          std::make_unique<DefaultFileDialogControllerFactory>());
+          [registrar] { return GetOwnerWindow(registrar->GetView()); },
+          std::make_unique<DefaultFileDialogControllerFactory>(),
+          std::make_unique<DialogThread>(),
+          std::make_unique<ThreadPoolTaskRunner>(),
+          std::make_unique<PlatformThreadTaskRunner>(registrar));
 
   FileSelectorApi::SetUp(registrar->messenger(), plugin.get());
+
+  plugin->results_channel_ =
+      std::make_unique<flutter::EventChannel<EncodableValue>>(
+          registrar->messenger(), kResultsChannelName,
+          &flutter::StandardMethodCodec::GetInstance());
+  FileSelectorPlugin* plugin_pointer = plugin.get();
+  plugin->results_channel_->SetStreamHandler(
+      std::make_unique<flutter::StreamHandlerFunctions<EncodableValue>>(
+          [plugin_pointer](
+              const EncodableValue* arguments,
+              std::unique_ptr<flutter::EventSink<EncodableValue>>&& events)
+              -> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+            std::shared_ptr<flutter::EventSink<EncodableValue>> sink =
+                std::move(events);
+            plugin_pointer->SetResultChunkHandler(
+                [sink](const EncodableList& paths) {
+                  sink->Success(EncodableValue(paths));
+                });
+            return nullptr;
+          },
+          [plugin_pointer](const EncodableValue* arguments)
+              -> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+            plugin_pointer->SetResultChunkHandler(nullptr);
+            return nullptr;
+          }));
+
+  plugin->hydration_channel_ =
+      std::make_unique<flutter::EventChannel<EncodableValue>>(
+          registrar->messenger(), kHydrationChannelName,
+          &flutter::StandardMethodCodec::GetInstance());
+  plugin->hydration_channel_->SetStreamHandler(
+      std::make_unique<flutter::StreamHandlerFunctions<EncodableValue>>(
+          [plugin_pointer](
+              const EncodableValue* arguments,
+              std::unique_ptr<flutter::EventSink<EncodableValue>>&& events)
+              -> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+            std::shared_ptr<flutter::EventSink<EncodableValue>> sink =
+                std::move(events);
+            plugin_pointer->SetHydrationProgressHandler(
+                [sink](const std::string& path, int64_t hydrated_bytes,
+                       int64_t total_bytes) {
+                  sink->Success(EncodableValue(EncodableList{
+                      EncodableValue(path), EncodableValue(hydrated_bytes),
+                      EncodableValue(total_bytes)}));
+                });
+            return nullptr;
+          },
+          [plugin_pointer](const EncodableValue* arguments)
+              -> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+            plugin_pointer->SetHydrationProgressHandler(nullptr);
+            return nullptr;
+          }));
+
+  plugin->enumeration_channel_ =
+      std::make_unique<flutter::EventChannel<EncodableValue>>(
+          registrar->messenger(), kEnumerationChannelName,
+          &flutter::StandardMethodCodec::GetInstance());
+  plugin->enumeration_channel_->SetStreamHandler(
+      std::make_unique<flutter::StreamHandlerFunctions<EncodableValue>>(
+          [plugin_pointer](
+              const EncodableValue* arguments,
+              std::unique_ptr<flutter::EventSink<EncodableValue>>&& events)
+              -> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+            std::shared_ptr<flutter::EventSink<EncodableValue>> sink =
+                std::move(events);
+            plugin_pointer->SetFolderEntriesHandler(
+                [sink](int64_t enumeration_id,
+                       const FolderEntryBatch& entries) {
+                  sink->Success(EncodableValue(EncodableList{
+                      EncodableValue(enumeration_id),
+                      EncodableValue(entries.paths),
+                      EncodableValue(entries.sizes),
+                      EncodableValue(entries.last_write_times)}));
+                });
+            return nullptr;
+          },
+          [plugin_pointer](const EncodableValue* arguments)
+              -> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+            plugin_pointer->SetFolderEntriesHandler(nullptr);
+            return nullptr;
+          }));
+
   registrar->AddPlugin(std::move(plugin));
 }
 
 FileSelectorPlugin::FileSelectorPlugin(
     FlutterRootWindowProvider window_provider,
-    std::unique_ptr<FileDialogControllerFactory> dialog_controller_factory)
+    std::unique_ptr<FileDialogControllerFactory> dialog_controller_factory,
+    std::unique_ptr<TaskRunner> dialog_task_runner,
+    std::unique_ptr<TaskRunner> background_task_runner,
+    std::unique_ptr<TaskRunner> platform_task_runner)
     : get_root_window_(std::move(window_provider)),
-      controller_factory_(std::move(dialog_controller_factory)) {}
+      controller_factory_(std::move(dialog_controller_factory)),
+      platform_task_runner_(std::move(platform_task_runner)),
+      background_task_runner_(std::move(background_task_runner)),
+      dialog_task_runner_(std::move(dialog_task_runner)) {
+  RegisterTraceProvider();
+}
+
+FileSelectorPlugin::~FileSelectorPlugin() {
+  // Prepared dialogs must be released on the thread that created them. The
+  // dialog runner finishes its queued tasks when it is destroyed.
+  for (const auto& entry : dialog_configurations_) {
+    ReleasePreparedDialog(entry.second);
+  }
+  UnregisterTraceProvider();
+}
 
-FileSelectorPlugin::~FileSelectorPlugin() = default;
+void FileSelectorPlugin::SetResultChunkHandler(ResultChunkHandler handler) {
+  result_chunk_handler_ = std::move(handler);
+}
+
+void FileSelectorPlugin::SetHydrationProgressHandler(
+    HydrationProgressHandler handler) {
+  hydration_progress_handler_ = std::move(handler);
+}
 
-ErrorOr<FileDialogResult> FileSelectorPlugin::ShowOpenDialog(
+void FileSelectorPlugin::SetFolderEntriesHandler(FolderEntriesHandler handler) {
+  folder_entries_handler_ = std::move(handler);
+}
+
+void FileSelectorPlugin::ShowOpenDialog(
     const SelectionOptions& options, const std::string* initialDirectory,
-    const std::string* confirmButtonText) {
-  return ShowDialog(*controller_factory_, get_root_window_(), DialogMode::open,
-                    options, initialDirectory, nullptr, confirmButtonText);
+    const std::string* confirmButtonText,
+    std::function<void(ErrorOr<FileDialogResult> reply)> result) {
+  FILE_SELECTOR_TRACE_SCOPE("ShowOpenDialog");
+  ShowDialogAsync(*controller_factory_, get_root_window_(), DialogMode::open,
+                  options, initialDirectory, nullptr, confirmButtonText,
+                  CreateChunkHandler(options), dialog_task_runner_.get(),
+                  platform_task_runner_.get(), std::move(result));
 }
 
-ErrorOr<FileDialogResult> FileSelectorPlugin::ShowSaveDialog(
+void FileSelectorPlugin::ShowSaveDialog(
     const SelectionOptions& options, const std::string* initialDirectory,
-    const std::string* suggestedName, const std::string* confirmButtonText) {
-  return ShowDialog(*controller_factory_, get_root_window_(), DialogMode::save,
-                    options, initialDirectory, suggestedName,
-                    confirmButtonText);
+    const std::string* suggestedName, const std::string* confirmButtonText,
+    std::function<void(ErrorOr<FileDialogResult> reply)> result) {
+  FILE_SELECTOR_TRACE_SCOPE("ShowSaveDialog");
+  ShowDialogAsync(*controller_factory_, get_root_window_(), DialogMode::save,
+                  options, initialDirectory, suggestedName, confirmButtonText,
+                  nullptr, dialog_task_runner_.get(),
+                  platform_task_runner_.get(), std::move(result));
+}
+
+void FileSelectorPlugin::GetThumbnails(
+    const EncodableList& paths, int64_t size,
+    std::function<void(ErrorOr<EncodableList> reply)> result) {
+  FILE_SELECTOR_TRACE_SCOPE("GetThumbnails");
+  if (size <= 0) {
+    result(FlutterError("Invalid argument", "size must be positive",
+                        EncodableValue(size)));
+    return;
+  }
+  if (paths.empty()) {
+    result(EncodableList());
+    return;
+  }
+
+  // The state shared by the extraction tasks for a single request. Each task
+  // fills in its own entry, and the last one to finish sends the result.
+  struct ThumbnailRequest {
+    explicit ThumbnailRequest(size_t count)
+        : thumbnails(count), remaining(count) {}
+
+    EncodableList thumbnails;
+    std::atomic<size_t> remaining;
+    std::function<void(ErrorOr<EncodableList> reply)> result;
+  };
+  auto request = std::make_shared<ThumbnailRequest>(paths.size());
+  request->result = std::move(result);
+  TaskRunner* platform_runner = platform_task_runner_.get();
+  for (size_t i = 0; i < paths.size(); ++i) {
+    const auto* path = std::get_if<std::string>(&paths[i]);
+    background_task_runner_->PostTask(
+        [request, i, path = path ? *path : std::string(),
+         size = static_cast<int>(size), platform_runner]() {
+          FILE_SELECTOR_TRACE_SCOPE("GetThumbnailForPath");
+          std::optional<Thumbnail> thumbnail;
+          if (!path.empty()) {
+            thumbnail = GetThumbnailForPath(path, size);
+          }
+          if (thumbnail) {
+            request->thumbnails[i] =
+                CustomEncodableValue(std::move(thumbnail.value()));
+          }
+          if (--request->remaining == 0) {
+            platform_runner->PostTask([request]() {
+              request->result(std::move(request->thumbnails));
+            });
+          }
+        });
+  }
+}
+
+void FileSelectorPlugin::HydrateCloudFiles(
+    const EncodableList& paths,
+    std::function<void(ErrorOr<EncodableList> reply)> result) {
+  FILE_SELECTOR_TRACE_SCOPE("HydrateCloudFiles");
+  if (paths.empty()) {
+    result(EncodableList());
+    return;
+  }
+
+  // The state shared by the download tasks for a single request. Each task
+  // fills in its own entry, and the last one to finish sends the result.
+  struct HydrationRequest {
+    explicit HydrationRequest(size_t count)
+        : hydrated(count), remaining(count) {}
+
+    EncodableList hydrated;
+    std::atomic<size_t> remaining;
+    std::function<void(ErrorOr<EncodableList> reply)> result;
+  };
+  auto request = std::make_shared<HydrationRequest>(paths.size());
+  request->result = std::move(result);
+  TaskRunner* platform_runner = platform_task_runner_.get();
+  for (size_t i = 0; i < paths.size(); ++i) {
+    const auto* path = std::get_if<std::string>(&paths[i]);
+    background_task_runner_->PostTask(
+        [request, i, path = path ? *path : std::string(),
+         progress_handler = hydration_progress_handler_, platform_runner]() {
+          FILE_SELECTOR_TRACE_SCOPE("HydrateCloudFile");
+          if (!path.empty()) {
+            // Progress is sent from the platform thread, like the result.
+            request->hydrated[i] = EncodableValue(HydrateCloudFile(
+                path, [&path, &progress_handler, platform_runner](
+                          int64_t hydrated_bytes, int64_t total_bytes) {
+                  if (progress_handler) {
+                    platform_runner->PostTask([progress_handler, path,
+                                               hydrated_bytes, total_bytes]() {
+                      progress_handler(path, hydrated_bytes, total_bytes);
+                    });
+                  }
+                }));
+          }
+          if (--request->remaining == 0) {
+            platform_runner->PostTask([request]() {
+              request->result(std::move(request->hydrated));
+            });
+          }
+        });
+  }
+}
+
+void FileSelectorPlugin::EnumerateFolder(
+    int64_t enumeration_id, const std::string& path,
+    const EncodableList& extensions, bool recursive,
+    std::function<void(ErrorOr<int64_t> reply)> result) {
+  FILE_SELECTOR_TRACE_SCOPE("EnumerateFolder");
+  if (path.empty()) {
+    result(FlutterError("Invalid argument", "path must not be empty"));
+    return;
+  }
+  std::vector<std::wstring> wide_extensions;
+  wide_extensions.reserve(extensions.size());
+  for (const EncodableValue& extension_value : extensions) {
+    const auto* extension = std::get_if<std::string>(&extension_value);
+    if (!extension || extension->empty()) {
+      continue;
+    }
+    std::wstring wide_extension = Utf16FromUtf8(*extension);
+    if (wide_extension.front() != L'.') {
+      wide_extension.insert(wide_extension.begin(), L'.');
+    }
+    wide_extensions.push_back(std::move(wide_extension));
+  }
+  background_task_runner_->PostTask(
+      [enumeration_id, path, extensions = std::move(wide_extensions),
+       recursive, entries_handler = folder_entries_handler_,
+       platform_runner = platform_task_runner_.get(),
+       result = std::move(result)]() {
+        FILE_SELECTOR_TRACE_SCOPE("EnumerateFolderFiles");
+        // Batches are sent from the platform thread, ahead of the result.
+        ErrorOr<int64_t> file_count = EnumerateFolderFiles(
+            path, extensions, recursive,
+            [enumeration_id, &entries_handler,
+             platform_runner](FolderEntryBatch&& entries) {
+              if (entries_handler) {
+                platform_runner->PostTask(
+                    [enumeration_id, entries_handler,
+                     entries = std::move(entries)]() {
+                      entries_handler(enumeration_id, entries);
+                    });
+              }
+            });
+        platform_runner->PostTask(
+            [result, file_count = std::move(file_count)]() mutable {
+              result(std::move(file_count));
+            });
+      });
+}
+
+ErrorOr<int64_t> FileSelectorPlugin::RegisterOpenDialogConfiguration(
+    const SelectionOptions& options, const std::string* confirm_button_text) {
+  FILE_SELECTOR_TRACE_SCOPE("RegisterOpenDialogConfiguration");
+  const int64_t configuration_id = next_dialog_configuration_id_++;
+  auto configuration =
+      std::make_shared<DialogConfiguration>(options, confirm_button_text);
+  dialog_configurations_[configuration_id] = configuration;
+  // Prepare the first dialog now, so that it's ready when it's needed.
+  dialog_task_runner_->PostTask(
+      [&dialog_factory = *controller_factory_, configuration]() {
+        HRESULT create_result;
+        configuration->prepared_dialog = CreateConfiguredOpenDialog(
+            dialog_factory, configuration->options,
+            configuration->confirm_label_pointer(), configuration->filters,
+            &create_result);
+      });
+  return configuration_id;
+}
+
+std::optional<FlutterError> FileSelectorPlugin::UnregisterDialogConfiguration(
+    int64_t configuration_id) {
+  auto it = dialog_configurations_.find(configuration_id);
+  if (it == dialog_configurations_.end()) {
+    return FlutterError("Invalid argument", "Unknown dialog configuration",
+                        EncodableValue(configuration_id));
+  }
+  ReleasePreparedDialog(it->second);
+  dialog_configurations_.erase(it);
+  return std::nullopt;
+}
+
+void FileSelectorPlugin::ShowConfiguredOpenDialog(
+    int64_t configuration_id, const std::string* initial_directory,
+    std::function<void(ErrorOr<FileDialogResult> reply)> result) {
+  FILE_SELECTOR_TRACE_SCOPE("ShowConfiguredOpenDialog");
+  auto it = dialog_configurations_.find(configuration_id);
+  if (it == dialog_configurations_.end()) {
+    result(FlutterError("Invalid argument", "Unknown dialog configuration",
+                        EncodableValue(configuration_id)));
+    return;
+  }
+  std::shared_ptr<DialogConfiguration> configuration = it->second;
+  std::optional<std::string> directory =
+      initial_directory ? std::optional<std::string>(*initial_directory)
+                        : std::nullopt;
+  dialog_task_runner_->PostTask(
+      [&dialog_factory = *controller_factory_,
+       parent_window = get_root_window_(), configuration,
+       initial_directory = std::move(directory),
+       chunk_handler = CreateChunkHandler(configuration->options),
+       platform_runner = platform_task_runner_.get(),
+       result = std::move(result)]() {
+        HRESULT create_result = S_OK;
+        std::unique_ptr<DialogWrapper> dialog =
+            std::move(configuration->prepared_dialog);
+        if (!dialog) {
+          // Preparation failed, or a previous show hasn't finished; try again
+          // so that the error (if any) can be reported.
+          dialog = CreateConfiguredOpenDialog(
+              dialog_factory, configuration->options,
+              configuration->confirm_label_pointer(), configuration->filters,
+              &create_result);
+        }
+        std::optional<ErrorOr<FileDialogResult>> dialog_result;
+        if (!dialog) {
+          dialog_result = FlutterError("System error", "Could not create dialog",
+                                       EncodableValue(create_result));
+        } else {
+          if (initial_directory) {
+            dialog->SetFolder(*initial_directory);
+          }
+          dialog_result = ShowConfiguredDialog(
+              *dialog, parent_window, configuration->options,
+              chunk_handler ? &chunk_handler : nullptr);
+        }
+        platform_runner->PostTask(
+            [result, dialog_result = std::move(dialog_result.value())]() {
+              result(std::move(dialog_result));
+            });
+
+        // Get the next dialog ready while the app handles the result. If the
+        // configuration has been unregistered in the meantime, the release
+        // task queued behind this one will discard it.
+        configuration->prepared_dialog = CreateConfiguredOpenDialog(
+            dialog_factory, configuration->options,
+            configuration->confirm_label_pointer(), configuration->filters,
+            &create_result);
+      });
+}
+
+ResultChunkHandler FileSelectorPlugin::CreateChunkHandler(
+    const SelectionOptions& options) const {
+  const bool* stream_results = options.stream_results();
+  if (!stream_results || !*stream_results || !result_chunk_handler_) {
+    return nullptr;
+  }
+  // Chunks are read on the dialog thread, but must be sent from the platform
+  // thread.
+  return [platform_runner = platform_task_runner_.get(),
+          handler = result_chunk_handler_](const EncodableList& paths) {
+    platform_runner->PostTask([handler, paths]() { handler(paths); });
+  };
+}
+
+void FileSelectorPlugin::ReleasePreparedDialog(
+    std::shared_ptr<DialogConfiguration> configuration) {
+  dialog_task_runner_->PostTask(
+      [configuration]() { configuration->prepared_dialog.reset(); });
 }
 
 }  // namespace file_selector_windows
@@ -4,13 +4,21 @@
 #ifndef PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_FILE_SELECTOR_PLUGIN_H_
 #define PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_FILE_SELECTOR_PLUGIN_H_
 
+#include <flutter/encodable_value.h>
+#include <flutter/event_channel.h>
 #include <flutter/method_channel.h>
 #include <flutter/plugin_registrar_windows.h>
 
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
 
 #include "file_dialog_controller.h"
 #include "messages.g.h"
+#include "task_runner.h"
 
 namespace file_selector_windows {
 
@@ -19,33 +27,158 @@ namespace file_selector_windows {
 // around https://github.com/flutter/flutter/issues/90694.
 using FlutterRootWindowProvider = std::function<HWND()>;
 
+// Receives a batch of selected paths when results are being streamed.
+using ResultChunkHandler =
+    std::function<void(const flutter::EncodableList& paths)>;
+
+// Receives the progress of a cloud file download, as the number of bytes of
+// the file at |path| that are stored locally out of its |total_bytes|.
+using HydrationProgressHandler = std::function<void(
+    const std::string& path, int64_t hydrated_bytes, int64_t total_bytes)>;
+
+// A batch of files found by a folder enumeration, as parallel lists.
+struct FolderEntryBatch {
+  // The path of each file.
+  flutter::EncodableList paths;
+
+  // The size of each file, in bytes.
+  flutter::EncodableList sizes;
+
+  // The time each file was last written, in milliseconds since the Unix
+  // epoch.
+  flutter::EncodableList last_write_times;
+};
+
+// Receives a batch of the files found by the folder enumeration with
+// |enumeration_id|.
+using FolderEntriesHandler = std::function<void(
+    int64_t enumeration_id, const FolderEntryBatch& entries)>;
+
 class FileSelectorPlugin : public flutter::Plugin, public FileSelectorApi {
  public:
   static void RegisterWithRegistrar(flutter::PluginRegistrarWindows* registrar);
 
   // Creates a new plugin instance for the given registar, using the given
   // factory to create native dialog controllers.
+  //
+  // Dialogs are created and shown using |dialog_task_runner|, and thumbnails
+  // are extracted, cloud files downloaded, and folders enumerated using
+  // |background_task_runner|.
+  // Results are delivered using |platform_task_runner|, which must run tasks
+  // on the thread that platform channel messages are handled on.
   FileSelectorPlugin(
       FlutterRootWindowProvider window_provider,
-      std::unique_ptr<FileDialogControllerFactory> dialog_controller_factory);
+      std::unique_ptr<FileDialogControllerFactory> dialog_controller_factory,
+      std::unique_ptr<TaskRunner> dialog_task_runner,
+      std::unique_ptr<TaskRunner> background_task_runner,
+      std::unique_ptr<TaskRunner> platform_task_runner);
 
   virtual ~FileSelectorPlugin();
 
+  // Sets the handler that receives selected paths in chunks for dialogs whose
+  // options request streamed results. Passing nullptr disables streaming, in
+  // which case all paths are returned in the dialog result.
+  void SetResultChunkHandler(ResultChunkHandler handler);
+
+  // Sets the handler that receives the progress of cloud file downloads.
+  // Passing nullptr stops progress reporting.
+  void SetHydrationProgressHandler(HydrationProgressHandler handler);
+
+  // Sets the handler that receives the files found by folder enumerations.
+  // Passing nullptr stops the files from being reported, in which case they
+  // are only counted.
+  void SetFolderEntriesHandler(FolderEntriesHandler handler);
+
   // FileSelectorApi
-  ErrorOr<FileDialogResult> ShowOpenDialog(
+  void ShowOpenDialog(
       const SelectionOptions& options, const std::string* initial_directory,
-      const std::string* confirm_button_text) override;
-  ErrorOr<FileDialogResult> ShowSaveDialog(
+      const std::string* confirm_button_text,
+      std::function<void(ErrorOr<FileDialogResult> reply)> result) override;
+  void ShowSaveDialog(
       const SelectionOptions& options, const std::string* initialDirectory,
-      const std::string* suggestedName,
-      const std::string* confirmButtonText) override;
+      const std::string* suggestedName, const std::string* confirmButtonText,
+      std::function<void(ErrorOr<FileDialogResult> reply)> result) override;
+  void GetThumbnails(const flutter::EncodableList& paths, int64_t size,
+                     std::function<void(ErrorOr<flutter::EncodableList> reply)>
+                         result) override;
+  ErrorOr<int64_t> RegisterOpenDialogConfiguration(
+      const SelectionOptions& options,
+      const std::string* confirm_button_text) override;
+  std::optional<FlutterError> UnregisterDialogConfiguration(
+      int64_t configuration_id) override;
+  void ShowConfiguredOpenDialog(
+      int64_t configuration_id, const std::string* initial_directory,
+      std::function<void(ErrorOr<FileDialogResult> reply)> result) override;
+  void HydrateCloudFiles(
+      const flutter::EncodableList& paths,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void EnumerateFolder(
+      int64_t enumeration_id, const std::string& path,
+      const flutter::EncodableList& extensions, bool recursive,
+      std::function<void(ErrorOr<int64_t> reply)> result) override;
 
  private:
+  struct DialogConfiguration;
+
+  // Returns a handler that forwards streamed results for a dialog with
+  // |options| to the result chunk handler, or nullptr if the dialog's results
+  // shouldn't be streamed.
+  ResultChunkHandler CreateChunkHandler(const SelectionOptions& options) const;
+
+  // Queues the release of |configuration|'s prepared dialog, if any, on the
+  // dialog thread.
+  void ReleasePreparedDialog(std::shared_ptr<DialogConfiguration> configuration);
+
   // The provider for the root window to attach the dialog to.
   FlutterRootWindowProvider get_root_window_;
 
   // The factory for creating dialog controller instances.
   std::unique_ptr<FileDialogControllerFactory> controller_factory_;
+
+  // The handler for streamed results, if anything is listening for them.
+  ResultChunkHandler result_chunk_handler_;
+
+  // The channel that streamed results are sent on, when registered with an
+  // engine.
+  std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>>
+      results_channel_;
+
+  // The handler for cloud file download progress, if anything is listening
+  // for it.
+  HydrationProgressHandler hydration_progress_handler_;
+
+  // The channel that cloud file download progress is sent on, when
+  // registered with an engine.
+  std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>>
+      hydration_channel_;
+
+  // The handler for files found by folder enumerations, if anything is
+  // listening for them.
+  FolderEntriesHandler folder_entries_handler_;
+
+  // The channel that files found by folder enumerations are sent on, when
+  // registered with an engine.
+  std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>>
+      enumeration_channel_;
+
+  // Registered open dialog configurations, by ID.
+  std::map<int64_t, std::shared_ptr<DialogConfiguration>>
+      dialog_configurations_;
+
+  // The ID to give the next registered dialog configuration.
+  int64_t next_dialog_configuration_id_ = 1;
+
+  // The runner for delivering results back to the platform thread.
+  std::unique_ptr<TaskRunner> platform_task_runner_;
+
+  // The runner that thumbnails are extracted, cloud files downloaded, and
+  // folders enumerated on.
+  std::unique_ptr<TaskRunner> background_task_runner_;
+
+  // The runner that dialogs are shown on. This is declared last so that it is
+  // destroyed first, since its tasks use the other members.
+  std::unique_ptr<TaskRunner> dialog_task_runner_;
 };
 
 }  // namespace file_selector_windows
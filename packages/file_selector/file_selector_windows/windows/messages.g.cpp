@@ -61,6 +61,19 @@ SelectionOptions::SelectionOptions(bool allow_multiple, bool select_folders,
       select_folders_(select_folders),
       allowed_types_(allowed_types) {}
 
+SelectionOptions::SelectionOptions(bool allow_multiple, bool select_folders,
+                                   const EncodableList& allowed_types,
+                                   const bool* stream_results,
+                                   const bool* include_metadata)
+    : allow_multiple_(allow_multiple),
+      select_folders_(select_folders),
+      allowed_types_(allowed_types),
+      stream_results_(stream_results ? std::optional<bool>(*stream_results)
+                                     : std::nullopt),
+      include_metadata_(include_metadata
+                            ? std::optional<bool>(*include_metadata)
+                            : std::nullopt) {}
+
 bool SelectionOptions::allow_multiple() const { return allow_multiple_; }
 
 void SelectionOptions::set_allow_multiple(bool value_arg) {
@@ -81,12 +94,41 @@ void SelectionOptions::set_allowed_types(const EncodableList& value_arg) {
   allowed_types_ = value_arg;
 }
 
+const bool* SelectionOptions::stream_results() const {
+  return stream_results_ ? &(*stream_results_) : nullptr;
+}
+
+void SelectionOptions::set_stream_results(const bool* value_arg) {
+  stream_results_ = value_arg ? std::optional<bool>(*value_arg) : std::nullopt;
+}
+
+void SelectionOptions::set_stream_results(bool value_arg) {
+  stream_results_ = value_arg;
+}
+
+const bool* SelectionOptions::include_metadata() const {
+  return include_metadata_ ? &(*include_metadata_) : nullptr;
+}
+
+void SelectionOptions::set_include_metadata(const bool* value_arg) {
+  include_metadata_ =
+      value_arg ? std::optional<bool>(*value_arg) : std::nullopt;
+}
+
+void SelectionOptions::set_include_metadata(bool value_arg) {
+  include_metadata_ = value_arg;
+}
+
 EncodableList SelectionOptions::ToEncodableList() const {
   EncodableList list;
-  list.reserve(3);
+  list.reserve(5);
   list.push_back(EncodableValue(allow_multiple_));
   list.push_back(EncodableValue(select_folders_));
   list.push_back(EncodableValue(allowed_types_));
+  list.push_back(stream_results_ ? EncodableValue(*stream_results_)
+                                 : EncodableValue());
+  list.push_back(include_metadata_ ? EncodableValue(*include_metadata_)
+                                   : EncodableValue());
   return list;
 }
 
@@ -94,6 +136,159 @@ SelectionOptions SelectionOptions::FromEncodableList(
     const EncodableList& list) {
   SelectionOptions decoded(std::get<bool>(list[0]), std::get<bool>(list[1]),
                            std::get<EncodableList>(list[2]));
+  auto& encodable_stream_results = list[3];
+  if (!encodable_stream_results.IsNull()) {
+    decoded.set_stream_results(std::get<bool>(encodable_stream_results));
+  }
+  auto& encodable_include_metadata = list[4];
+  if (!encodable_include_metadata.IsNull()) {
+    decoded.set_include_metadata(std::get<bool>(encodable_include_metadata));
+  }
+  return decoded;
+}
+
+// FileMetadata
+
+FileMetadata::FileMetadata() {}
+
+FileMetadata::FileMetadata(const int64_t* size, const int64_t* last_write_time,
+                           const int64_t* attributes,
+                           const std::string* content_type,
+                           const int64_t* placeholder_status,
+                           const bool* is_cloud_placeholder)
+    : size_(size ? std::optional<int64_t>(*size) : std::nullopt),
+      last_write_time_(last_write_time
+                           ? std::optional<int64_t>(*last_write_time)
+                           : std::nullopt),
+      attributes_(attributes ? std::optional<int64_t>(*attributes)
+                             : std::nullopt),
+      content_type_(content_type ? std::optional<std::string>(*content_type)
+                                 : std::nullopt),
+      placeholder_status_(placeholder_status
+                              ? std::optional<int64_t>(*placeholder_status)
+                              : std::nullopt),
+      is_cloud_placeholder_(is_cloud_placeholder
+                                ? std::optional<bool>(*is_cloud_placeholder)
+                                : std::nullopt) {}
+
+const int64_t* FileMetadata::size() const {
+  return size_ ? &(*size_) : nullptr;
+}
+
+void FileMetadata::set_size(const int64_t* value_arg) {
+  size_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void FileMetadata::set_size(int64_t value_arg) { size_ = value_arg; }
+
+const int64_t* FileMetadata::last_write_time() const {
+  return last_write_time_ ? &(*last_write_time_) : nullptr;
+}
+
+void FileMetadata::set_last_write_time(const int64_t* value_arg) {
+  last_write_time_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void FileMetadata::set_last_write_time(int64_t value_arg) {
+  last_write_time_ = value_arg;
+}
+
+const int64_t* FileMetadata::attributes() const {
+  return attributes_ ? &(*attributes_) : nullptr;
+}
+
+void FileMetadata::set_attributes(const int64_t* value_arg) {
+  attributes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void FileMetadata::set_attributes(int64_t value_arg) {
+  attributes_ = value_arg;
+}
+
+const std::string* FileMetadata::content_type() const {
+  return content_type_ ? &(*content_type_) : nullptr;
+}
+
+void FileMetadata::set_content_type(const std::string_view* value_arg) {
+  content_type_ =
+      value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void FileMetadata::set_content_type(std::string_view value_arg) {
+  content_type_ = value_arg;
+}
+
+const int64_t* FileMetadata::placeholder_status() const {
+  return placeholder_status_ ? &(*placeholder_status_) : nullptr;
+}
+
+void FileMetadata::set_placeholder_status(const int64_t* value_arg) {
+  placeholder_status_ =
+      value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void FileMetadata::set_placeholder_status(int64_t value_arg) {
+  placeholder_status_ = value_arg;
+}
+
+const bool* FileMetadata::is_cloud_placeholder() const {
+  return is_cloud_placeholder_ ? &(*is_cloud_placeholder_) : nullptr;
+}
+
+void FileMetadata::set_is_cloud_placeholder(const bool* value_arg) {
+  is_cloud_placeholder_ =
+      value_arg ? std::optional<bool>(*value_arg) : std::nullopt;
+}
+
+void FileMetadata::set_is_cloud_placeholder(bool value_arg) {
+  is_cloud_placeholder_ = value_arg;
+}
+
+EncodableList FileMetadata::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(6);
+  list.push_back(size_ ? EncodableValue(*size_) : EncodableValue());
+  list.push_back(last_write_time_ ? EncodableValue(*last_write_time_)
+                                  : EncodableValue());
+  list.push_back(attributes_ ? EncodableValue(*attributes_)
+                             : EncodableValue());
+  list.push_back(content_type_ ? EncodableValue(*content_type_)
+                               : EncodableValue());
+  list.push_back(placeholder_status_ ? EncodableValue(*placeholder_status_)
+                                     : EncodableValue());
+  list.push_back(is_cloud_placeholder_ ? EncodableValue(*is_cloud_placeholder_)
+                                       : EncodableValue());
+  return list;
+}
+
+FileMetadata FileMetadata::FromEncodableList(const EncodableList& list) {
+  FileMetadata decoded;
+  auto& encodable_size = list[0];
+  if (!encodable_size.IsNull()) {
+    decoded.set_size(encodable_size.LongValue());
+  }
+  auto& encodable_last_write_time = list[1];
+  if (!encodable_last_write_time.IsNull()) {
+    decoded.set_last_write_time(encodable_last_write_time.LongValue());
+  }
+  auto& encodable_attributes = list[2];
+  if (!encodable_attributes.IsNull()) {
+    decoded.set_attributes(encodable_attributes.LongValue());
+  }
+  auto& encodable_content_type = list[3];
+  if (!encodable_content_type.IsNull()) {
+    decoded.set_content_type(std::get<std::string>(encodable_content_type));
+  }
+  auto& encodable_placeholder_status = list[4];
+  if (!encodable_placeholder_status.IsNull()) {
+    decoded.set_placeholder_status(encodable_placeholder_status.LongValue());
+  }
+  auto& encodable_is_cloud_placeholder = list[5];
+  if (!encodable_is_cloud_placeholder.IsNull()) {
+    decoded.set_is_cloud_placeholder(
+        std::get<bool>(encodable_is_cloud_placeholder));
+  }
   return decoded;
 }
 
@@ -103,11 +298,14 @@ FileDialogResult::FileDialogResult(const EncodableList& paths)
     : paths_(paths) {}
 
 FileDialogResult::FileDialogResult(const EncodableList& paths,
-                                   const int64_t* type_group_index)
+                                   const int64_t* type_group_index,
+                                   const EncodableList* metadata)
     : paths_(paths),
       type_group_index_(type_group_index
                             ? std::optional<int64_t>(*type_group_index)
-                            : std::nullopt) {}
+                            : std::nullopt),
+      metadata_(metadata ? std::optional<EncodableList>(*metadata)
+                         : std::nullopt) {}
 
 const EncodableList& FileDialogResult::paths() const { return paths_; }
 
@@ -128,12 +326,26 @@ void FileDialogResult::set_type_group_index(int64_t value_arg) {
   type_group_index_ = value_arg;
 }
 
+const EncodableList* FileDialogResult::metadata() const {
+  return metadata_ ? &(*metadata_) : nullptr;
+}
+
+void FileDialogResult::set_metadata(const EncodableList* value_arg) {
+  metadata_ =
+      value_arg ? std::optional<EncodableList>(*value_arg) : std::nullopt;
+}
+
+void FileDialogResult::set_metadata(const EncodableList& value_arg) {
+  metadata_ = value_arg;
+}
+
 EncodableList FileDialogResult::ToEncodableList() const {
   EncodableList list;
-  list.reserve(2);
+  list.reserve(3);
   list.push_back(EncodableValue(paths_));
   list.push_back(type_group_index_ ? EncodableValue(*type_group_index_)
                                    : EncodableValue());
+  list.push_back(metadata_ ? EncodableValue(*metadata_) : EncodableValue());
   return list;
 }
 
@@ -144,6 +356,47 @@ FileDialogResult FileDialogResult::FromEncodableList(
   if (!encodable_type_group_index.IsNull()) {
     decoded.set_type_group_index(encodable_type_group_index.LongValue());
   }
+  auto& encodable_metadata = list[2];
+  if (!encodable_metadata.IsNull()) {
+    decoded.set_metadata(std::get<EncodableList>(encodable_metadata));
+  }
+  return decoded;
+}
+
+// Thumbnail
+
+Thumbnail::Thumbnail(int64_t width, int64_t height,
+                     const std::vector<uint8_t>& bgra_pixels)
+    : width_(width), height_(height), bgra_pixels_(bgra_pixels) {}
+
+int64_t Thumbnail::width() const { return width_; }
+
+void Thumbnail::set_width(int64_t value_arg) { width_ = value_arg; }
+
+int64_t Thumbnail::height() const { return height_; }
+
+void Thumbnail::set_height(int64_t value_arg) { height_ = value_arg; }
+
+const std::vector<uint8_t>& Thumbnail::bgra_pixels() const {
+  return bgra_pixels_;
+}
+
+void Thumbnail::set_bgra_pixels(const std::vector<uint8_t>& value_arg) {
+  bgra_pixels_ = value_arg;
+}
+
+EncodableList Thumbnail::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(3);
+  list.push_back(EncodableValue(width_));
+  list.push_back(EncodableValue(height_));
+  list.push_back(EncodableValue(bgra_pixels_));
+  return list;
+}
+
+Thumbnail Thumbnail::FromEncodableList(const EncodableList& list) {
+  Thumbnail decoded(list[0].LongValue(), list[1].LongValue(),
+                    std::get<std::vector<uint8_t>>(list[2]));
   return decoded;
 }
 
@@ -156,9 +409,15 @@ EncodableValue FileSelectorApiCodecSerializer::ReadValueOfType(
       return CustomEncodableValue(FileDialogResult::FromEncodableList(
           std::get<EncodableList>(ReadValue(stream))));
     case 129:
-      return CustomEncodableValue(SelectionOptions::FromEncodableList(
+      return CustomEncodableValue(FileMetadata::FromEncodableList(
           std::get<EncodableList>(ReadValue(stream))));
     case 130:
+      return CustomEncodableValue(SelectionOptions::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 131:
+      return CustomEncodableValue(Thumbnail::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 132:
       return CustomEncodableValue(TypeGroup::FromEncodableList(
           std::get<EncodableList>(ReadValue(stream))));
     default:
@@ -178,16 +437,31 @@ void FileSelectorApiCodecSerializer::WriteValue(
           stream);
       return;
     }
-    if (custom_value->type() == typeid(SelectionOptions)) {
+    if (custom_value->type() == typeid(FileMetadata)) {
       stream->WriteByte(129);
+      WriteValue(
+          EncodableValue(
+              std::any_cast<FileMetadata>(*custom_value).ToEncodableList()),
+          stream);
+      return;
+    }
+    if (custom_value->type() == typeid(SelectionOptions)) {
+      stream->WriteByte(130);
       WriteValue(
           EncodableValue(
               std::any_cast<SelectionOptions>(*custom_value).ToEncodableList()),
           stream);
       return;
     }
+    if (custom_value->type() == typeid(Thumbnail)) {
+      stream->WriteByte(131);
+      WriteValue(EncodableValue(
+                     std::any_cast<Thumbnail>(*custom_value).ToEncodableList()),
+                 stream);
+      return;
+    }
     if (custom_value->type() == typeid(TypeGroup)) {
-      stream->WriteByte(130);
+      stream->WriteByte(132);
       WriteValue(EncodableValue(
                      std::any_cast<TypeGroup>(*custom_value).ToEncodableList()),
                  stream);
@@ -230,16 +504,18 @@ void FileSelectorApi::SetUp(flutter::BinaryMessenger* binary_messenger,
               const auto& encodable_confirm_button_text_arg = args.at(2);
               const auto* confirm_button_text_arg =
                   std::get_if<std::string>(&encodable_confirm_button_text_arg);
-              ErrorOr<FileDialogResult> output = api->ShowOpenDialog(
-                  options_arg, initial_directory_arg, confirm_button_text_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(
-                  CustomEncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
+              api->ShowOpenDialog(
+                  options_arg, initial_directory_arg, confirm_button_text_arg,
+                  [reply](ErrorOr<FileDialogResult>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        CustomEncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
             } catch (const std::exception& exception) {
               reply(WrapError(exception.what()));
             }
@@ -274,16 +550,134 @@ void FileSelectorApi::SetUp(flutter::BinaryMessenger* binary_messenger,
               const auto& encodable_confirm_button_text_arg = args.at(3);
               const auto* confirm_button_text_arg =
                   std::get_if<std::string>(&encodable_confirm_button_text_arg);
-              ErrorOr<FileDialogResult> output = api->ShowSaveDialog(
+              api->ShowSaveDialog(
                   options_arg, initial_directory_arg, suggested_name_arg,
-                  confirm_button_text_arg);
+                  confirm_button_text_arg,
+                  [reply](ErrorOr<FileDialogResult>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        CustomEncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.FileSelectorApi.getThumbnails",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_paths_arg = args.at(0);
+              if (encodable_paths_arg.IsNull()) {
+                reply(WrapError("paths_arg unexpectedly null."));
+                return;
+              }
+              const auto& paths_arg =
+                  std::get<EncodableList>(encodable_paths_arg);
+              const auto& encodable_size_arg = args.at(1);
+              if (encodable_size_arg.IsNull()) {
+                reply(WrapError("size_arg unexpectedly null."));
+                return;
+              }
+              const int64_t size_arg = encodable_size_arg.LongValue();
+              api->GetThumbnails(
+                  paths_arg, size_arg,
+                  [reply](ErrorOr<EncodableList>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.FileSelectorApi.registerOpenDialogConfiguration",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_options_arg = args.at(0);
+              if (encodable_options_arg.IsNull()) {
+                reply(WrapError("options_arg unexpectedly null."));
+                return;
+              }
+              const auto& options_arg = std::any_cast<const SelectionOptions&>(
+                  std::get<CustomEncodableValue>(encodable_options_arg));
+              const auto& encodable_confirm_button_text_arg = args.at(1);
+              const auto* confirm_button_text_arg =
+                  std::get_if<std::string>(&encodable_confirm_button_text_arg);
+              ErrorOr<int64_t> output = api->RegisterOpenDialogConfiguration(
+                  options_arg, confirm_button_text_arg);
               if (output.has_error()) {
                 reply(WrapError(output.error()));
                 return;
               }
               EncodableList wrapped;
-              wrapped.push_back(
-                  CustomEncodableValue(std::move(output).TakeValue()));
+              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.FileSelectorApi.unregisterDialogConfiguration",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_configuration_id_arg = args.at(0);
+              if (encodable_configuration_id_arg.IsNull()) {
+                reply(WrapError("configuration_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t configuration_id_arg =
+                  encodable_configuration_id_arg.LongValue();
+              std::optional<FlutterError> output =
+                  api->UnregisterDialogConfiguration(configuration_id_arg);
+              if (output.has_value()) {
+                reply(WrapError(output.value()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue());
               reply(EncodableValue(std::move(wrapped)));
             } catch (const std::exception& exception) {
               reply(WrapError(exception.what()));
@@ -293,6 +687,140 @@ void FileSelectorApi::SetUp(flutter::BinaryMessenger* binary_messenger,
       channel->SetMessageHandler(nullptr);
     }
   }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.FileSelectorApi.showConfiguredOpenDialog",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_configuration_id_arg = args.at(0);
+              if (encodable_configuration_id_arg.IsNull()) {
+                reply(WrapError("configuration_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t configuration_id_arg =
+                  encodable_configuration_id_arg.LongValue();
+              const auto& encodable_initial_directory_arg = args.at(1);
+              const auto* initial_directory_arg =
+                  std::get_if<std::string>(&encodable_initial_directory_arg);
+              api->ShowConfiguredOpenDialog(
+                  configuration_id_arg, initial_directory_arg,
+                  [reply](ErrorOr<FileDialogResult>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        CustomEncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.FileSelectorApi.hydrateCloudFiles", &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_paths_arg = args.at(0);
+              if (encodable_paths_arg.IsNull()) {
+                reply(WrapError("paths_arg unexpectedly null."));
+                return;
+              }
+              const auto& paths_arg =
+                  std::get<EncodableList>(encodable_paths_arg);
+              api->HydrateCloudFiles(
+                  paths_arg, [reply](ErrorOr<EncodableList>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.FileSelectorApi.enumerateFolder",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_enumeration_id_arg = args.at(0);
+              if (encodable_enumeration_id_arg.IsNull()) {
+                reply(WrapError("enumeration_id_arg unexpectedly null."));
+                return;
+              }
+              const int64_t enumeration_id_arg =
+                  encodable_enumeration_id_arg.LongValue();
+              const auto& encodable_path_arg = args.at(1);
+              if (encodable_path_arg.IsNull()) {
+                reply(WrapError("path_arg unexpectedly null."));
+                return;
+              }
+              const auto& path_arg = std::get<std::string>(encodable_path_arg);
+              const auto& encodable_extensions_arg = args.at(2);
+              if (encodable_extensions_arg.IsNull()) {
+                reply(WrapError("extensions_arg unexpectedly null."));
+                return;
+              }
+              const auto& extensions_arg =
+                  std::get<EncodableList>(encodable_extensions_arg);
+              const auto& encodable_recursive_arg = args.at(3);
+              if (encodable_recursive_arg.IsNull()) {
+                reply(WrapError("recursive_arg unexpectedly null."));
+                return;
+              }
+              const auto& recursive_arg =
+                  std::get<bool>(encodable_recursive_arg);
+              api->EnumerateFolder(
+                  enumeration_id_arg, path_arg, extensions_arg, recursive_arg,
+                  [reply](ErrorOr<int64_t>&& output) {
+                    if (output.has_error()) {
+                      reply(WrapError(output.error()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(
+                        EncodableValue(std::move(output).TakeValue()));
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
 }
 
 EncodableValue FileSelectorApi::WrapError(std::string_view error_message) {
@@ -83,10 +83,16 @@ class TypeGroup {
 // Generated class from Pigeon that represents data sent in messages.
 class SelectionOptions {
  public:
-  // Constructs an object setting all fields.
+  // Constructs an object setting all non-nullable fields.
   explicit SelectionOptions(bool allow_multiple, bool select_folders,
                             const flutter::EncodableList& allowed_types);
 
+  // Constructs an object setting all fields.
+  explicit SelectionOptions(bool allow_multiple, bool select_folders,
+                            const flutter::EncodableList& allowed_types,
+                            const bool* stream_results,
+                            const bool* include_metadata);
+
   bool allow_multiple() const;
   void set_allow_multiple(bool value_arg);
 
@@ -96,6 +102,19 @@ class SelectionOptions {
   const flutter::EncodableList& allowed_types() const;
   void set_allowed_types(const flutter::EncodableList& value_arg);
 
+  // Whether the selected paths should be sent in chunks on the results event
+  // channel while they are read, instead of in [FileDialogResult.paths].
+  //
+  // Ignored if nothing is listening to the results channel.
+  const bool* stream_results() const;
+  void set_stream_results(const bool* value_arg);
+  void set_stream_results(bool value_arg);
+
+  // Whether to return [FileDialogResult.metadata] for the selected files.
+  const bool* include_metadata() const;
+  void set_include_metadata(const bool* value_arg);
+  void set_include_metadata(bool value_arg);
+
  private:
   static SelectionOptions FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
@@ -104,6 +123,70 @@ class SelectionOptions {
   bool allow_multiple_;
   bool select_folders_;
   flutter::EncodableList allowed_types_;
+  std::optional<bool> stream_results_;
+  std::optional<bool> include_metadata_;
+};
+
+// Metadata for a selected file, as reported by the shell.
+//
+// Any value that the shell could not provide is null.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class FileMetadata {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  FileMetadata();
+
+  // Constructs an object setting all fields.
+  explicit FileMetadata(const int64_t* size, const int64_t* last_write_time,
+                        const int64_t* attributes,
+                        const std::string* content_type,
+                        const int64_t* placeholder_status,
+                        const bool* is_cloud_placeholder);
+
+  // The size of the file, in bytes.
+  const int64_t* size() const;
+  void set_size(const int64_t* value_arg);
+  void set_size(int64_t value_arg);
+
+  // The time the file was last written, in milliseconds since the Unix epoch.
+  const int64_t* last_write_time() const;
+  void set_last_write_time(const int64_t* value_arg);
+  void set_last_write_time(int64_t value_arg);
+
+  // The Win32 FILE_ATTRIBUTE_* flags for the file.
+  const int64_t* attributes() const;
+  void set_attributes(const int64_t* value_arg);
+  void set_attributes(int64_t value_arg);
+
+  // The MIME type of the file, based on its extension.
+  const std::string* content_type() const;
+  void set_content_type(const std::string_view* value_arg);
+  void set_content_type(std::string_view value_arg);
+
+  // The PLACEHOLDER_STATES flags for the file, if it is managed by a cloud
+  // sync provider such as OneDrive.
+  const int64_t* placeholder_status() const;
+  void set_placeholder_status(const int64_t* value_arg);
+  void set_placeholder_status(int64_t value_arg);
+
+  // Whether the file's data isn't all stored locally, so that reading it
+  // will first download it from its cloud sync provider.
+  const bool* is_cloud_placeholder() const;
+  void set_is_cloud_placeholder(const bool* value_arg);
+  void set_is_cloud_placeholder(bool value_arg);
+
+ private:
+  static FileMetadata FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class FileSelectorApi;
+  friend class FileSelectorApiCodecSerializer;
+  std::optional<int64_t> size_;
+  std::optional<int64_t> last_write_time_;
+  std::optional<int64_t> attributes_;
+  std::optional<std::string> content_type_;
+  std::optional<int64_t> placeholder_status_;
+  std::optional<bool> is_cloud_placeholder_;
 };
 
 // The result from an open or save dialog.
@@ -116,7 +199,8 @@ class FileDialogResult {
 
   // Constructs an object setting all fields.
   explicit FileDialogResult(const flutter::EncodableList& paths,
-                            const int64_t* type_group_index);
+                            const int64_t* type_group_index,
+                            const flutter::EncodableList* metadata);
 
   // The selected paths.
   //
@@ -132,6 +216,14 @@ class FileDialogResult {
   void set_type_group_index(const int64_t* value_arg);
   void set_type_group_index(int64_t value_arg);
 
+  // Metadata for each entry in [paths], in the same order.
+  //
+  // Only set if [SelectionOptions.includeMetadata] was requested, and the
+  // results were not streamed.
+  const flutter::EncodableList* metadata() const;
+  void set_metadata(const flutter::EncodableList* value_arg);
+  void set_metadata(const flutter::EncodableList& value_arg);
+
  private:
   static FileDialogResult FromEncodableList(const flutter::EncodableList& list);
   flutter::EncodableList ToEncodableList() const;
@@ -139,6 +231,38 @@ class FileDialogResult {
   friend class FileSelectorApiCodecSerializer;
   flutter::EncodableList paths_;
   std::optional<int64_t> type_group_index_;
+  std::optional<flutter::EncodableList> metadata_;
+};
+
+// A thumbnail image for a file.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class Thumbnail {
+ public:
+  // Constructs an object setting all fields.
+  explicit Thumbnail(int64_t width, int64_t height,
+                     const std::vector<uint8_t>& bgra_pixels);
+
+  // The width of the image, in pixels.
+  int64_t width() const;
+  void set_width(int64_t value_arg);
+
+  // The height of the image, in pixels.
+  int64_t height() const;
+  void set_height(int64_t value_arg);
+
+  // The image data, as top-down rows of 32-bit premultiplied BGRA pixels.
+  const std::vector<uint8_t>& bgra_pixels() const;
+  void set_bgra_pixels(const std::vector<uint8_t>& value_arg);
+
+ private:
+  static Thumbnail FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class FileSelectorApi;
+  friend class FileSelectorApiCodecSerializer;
+  int64_t width_;
+  int64_t height_;
+  std::vector<uint8_t> bgra_pixels_;
 };
 
 class FileSelectorApiCodecSerializer : public flutter::StandardCodecSerializer {
@@ -164,13 +288,58 @@ class FileSelectorApi {
   FileSelectorApi(const FileSelectorApi&) = delete;
   FileSelectorApi& operator=(const FileSelectorApi&) = delete;
   virtual ~FileSelectorApi() {}
-  virtual ErrorOr<FileDialogResult> ShowOpenDialog(
+  virtual void ShowOpenDialog(
       const SelectionOptions& options, const std::string* initial_directory,
-      const std::string* confirm_button_text) = 0;
-  virtual ErrorOr<FileDialogResult> ShowSaveDialog(
+      const std::string* confirm_button_text,
+      std::function<void(ErrorOr<FileDialogResult> reply)> result) = 0;
+  virtual void ShowSaveDialog(
       const SelectionOptions& options, const std::string* initial_directory,
       const std::string* suggested_name,
+      const std::string* confirm_button_text,
+      std::function<void(ErrorOr<FileDialogResult> reply)> result) = 0;
+  // Returns thumbnails no larger than [size] pixels in either dimension for
+  // each of [paths], using the system thumbnail cache.
+  //
+  // The entry for any path whose thumbnail can't be loaded is null.
+  virtual void GetThumbnails(
+      const flutter::EncodableList& paths, int64_t size,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Registers a reusable open dialog configuration, returning an ID to pass
+  // to [showConfiguredOpenDialog].
+  //
+  // The filters and options are processed once, and a configured native
+  // dialog is prepared ahead of each show.
+  virtual ErrorOr<int64_t> RegisterOpenDialogConfiguration(
+      const SelectionOptions& options,
       const std::string* confirm_button_text) = 0;
+  // Releases a configuration returned by [registerOpenDialogConfiguration].
+  virtual std::optional<FlutterError> UnregisterDialogConfiguration(
+      int64_t configuration_id) = 0;
+  // Shows an open dialog using a configuration returned by
+  // [registerOpenDialogConfiguration].
+  virtual void ShowConfiguredOpenDialog(
+      int64_t configuration_id, const std::string* initial_directory,
+      std::function<void(ErrorOr<FileDialogResult> reply)> result) = 0;
+  // Downloads the data of each of [paths] that is a cloud file placeholder,
+  // in parallel on background threads.
+  //
+  // Progress is sent on the hydration event channel while anything is
+  // listening to it. Returns, for each path, whether all of its data is now
+  // stored locally.
+  virtual void HydrateCloudFiles(
+      const flutter::EncodableList& paths,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Lists the files in the folder at [path] on a background thread, and in
+  // its subfolders if [recursive] is set.
+  //
+  // Only files with one of [extensions] are listed, unless it is empty.
+  // Entries are sent in batches on the enumeration event channel, tagged
+  // with [enumerationId], while anything is listening to it. Returns the
+  // number of files found.
+  virtual void EnumerateFolder(
+      int64_t enumeration_id, const std::string& path,
+      const flutter::EncodableList& extensions, bool recursive,
+      std::function<void(ErrorOr<int64_t> reply)> result) = 0;
 
   // The codec used by FileSelectorApi.
   static const flutter::StandardMessageCodec& GetCodec();
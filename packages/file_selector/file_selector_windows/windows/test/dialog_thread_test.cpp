@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#include "dialog_thread.h"
+
+#include <gtest/gtest.h>
+#include <objbase.h>
+#include <windows.h>
+
+#include <thread>
+#include <vector>
+
+namespace file_selector_windows {
+namespace test {
+
+TEST(DialogThread, RunsTasksInOrderOnAnotherThread) {
+  std::vector<int> order;
+  std::vector<std::thread::id> thread_ids;
+  {
+    DialogThread thread;
+    for (int i = 0; i < 3; ++i) {
+      thread.PostTask([&order, &thread_ids, i]() {
+        order.push_back(i);
+        thread_ids.push_back(std::this_thread::get_id());
+      });
+    }
+    // Destroying the thread waits for the posted tasks.
+  }
+
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2}));
+  ASSERT_EQ(thread_ids.size(), 3);
+  EXPECT_NE(thread_ids[0], std::this_thread::get_id());
+  EXPECT_EQ(thread_ids[1], thread_ids[0]);
+  EXPECT_EQ(thread_ids[2], thread_ids[0]);
+}
+
+TEST(DialogThread, RunsTasksInSingleThreadedApartment) {
+  APTTYPE apartment_type = APTTYPE_MTA;
+  APTTYPEQUALIFIER qualifier;
+  HRESULT result = E_FAIL;
+  {
+    DialogThread thread;
+    thread.PostTask([&apartment_type, &qualifier, &result]() {
+      result = ::CoGetApartmentType(&apartment_type, &qualifier);
+    });
+  }
+
+  ASSERT_TRUE(SUCCEEDED(result));
+  EXPECT_EQ(apartment_type, APTTYPE_STA);
+}
+
+}  // namespace test
+}  // namespace file_selector_windows
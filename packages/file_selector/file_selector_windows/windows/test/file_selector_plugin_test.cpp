@@ -13,8 +13,10 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include "file_dialog_controller.h"
 #include "string_utils.h"
@@ -22,6 +24,8 @@
 #include "test/test_utils.h"
 
 namespace file_selector_windows {
+using windows_plugin_utils::Utf8FromUtf16;
+
 namespace test {
 
 namespace {
@@ -30,6 +34,100 @@ using flutter::CustomEncodableValue;
 using flutter::EncodableList;
 using flutter::EncodableValue;
 
+// Calls ShowOpenDialog on |plugin|, returning the result.
+//
+// This relies on |plugin| using InlineTaskRunners, so that the result is
+// delivered before ShowOpenDialog returns.
+ErrorOr<FileDialogResult> ShowOpenDialogSync(
+    FileSelectorPlugin& plugin, const SelectionOptions& options,
+    const std::string* initial_directory,
+    const std::string* confirm_button_text) {
+  std::optional<ErrorOr<FileDialogResult>> reply;
+  plugin.ShowOpenDialog(options, initial_directory, confirm_button_text,
+                        [&reply](ErrorOr<FileDialogResult> result) {
+                          reply.emplace(std::move(result));
+                        });
+  EXPECT_TRUE(reply.has_value());
+  return std::move(reply.value());
+}
+
+// Calls ShowSaveDialog on |plugin|, returning the result.
+//
+// This relies on |plugin| using InlineTaskRunners, so that the result is
+// delivered before ShowSaveDialog returns.
+ErrorOr<FileDialogResult> ShowSaveDialogSync(
+    FileSelectorPlugin& plugin, const SelectionOptions& options,
+    const std::string* initial_directory, const std::string* suggested_name,
+    const std::string* confirm_button_text) {
+  std::optional<ErrorOr<FileDialogResult>> reply;
+  plugin.ShowSaveDialog(options, initial_directory, suggested_name,
+                        confirm_button_text,
+                        [&reply](ErrorOr<FileDialogResult> result) {
+                          reply.emplace(std::move(result));
+                        });
+  EXPECT_TRUE(reply.has_value());
+  return std::move(reply.value());
+}
+
+// Calls ShowConfiguredOpenDialog on |plugin|, returning the result.
+//
+// This relies on |plugin| using InlineTaskRunners, so that the result is
+// delivered before ShowConfiguredOpenDialog returns.
+ErrorOr<FileDialogResult> ShowConfiguredOpenDialogSync(
+    FileSelectorPlugin& plugin, int64_t configuration_id,
+    const std::string* initial_directory) {
+  std::optional<ErrorOr<FileDialogResult>> reply;
+  plugin.ShowConfiguredOpenDialog(configuration_id, initial_directory,
+                                  [&reply](ErrorOr<FileDialogResult> result) {
+                                    reply.emplace(std::move(result));
+                                  });
+  EXPECT_TRUE(reply.has_value());
+  return std::move(reply.value());
+}
+
+// Calls GetThumbnails on |plugin|, returning the result.
+//
+// This relies on |plugin| using InlineTaskRunners, so that the result is
+// delivered before GetThumbnails returns.
+ErrorOr<EncodableList> GetThumbnailsSync(FileSelectorPlugin& plugin,
+                                         const EncodableList& paths,
+                                         int64_t size) {
+  std::optional<ErrorOr<EncodableList>> reply;
+  plugin.GetThumbnails(paths, size, [&reply](ErrorOr<EncodableList> result) {
+    reply.emplace(std::move(result));
+  });
+  EXPECT_TRUE(reply.has_value());
+  return std::move(reply.value());
+}
+
+// Calls HydrateCloudFiles on |plugin| and returns its reply, which must be
+// delivered before it returns.
+ErrorOr<EncodableList> HydrateCloudFilesSync(FileSelectorPlugin& plugin,
+                                             const EncodableList& paths) {
+  std::optional<ErrorOr<EncodableList>> reply;
+  plugin.HydrateCloudFiles(paths, [&reply](ErrorOr<EncodableList> result) {
+    reply.emplace(std::move(result));
+  });
+  EXPECT_TRUE(reply.has_value());
+  return std::move(reply.value());
+}
+
+// Calls EnumerateFolder on |plugin| and returns its reply, which must be
+// delivered before it returns.
+ErrorOr<int64_t> EnumerateFolderSync(FileSelectorPlugin& plugin,
+                                     int64_t enumeration_id,
+                                     const std::wstring& path,
+                                     const EncodableList& extensions,
+                                     bool recursive) {
+  std::optional<ErrorOr<int64_t>> reply;
+  plugin.EnumerateFolder(enumeration_id, Utf8FromUtf16(path), extensions,
+                         recursive, [&reply](ErrorOr<int64_t> result) {
+                           reply.emplace(std::move(result));
+                         });
+  EXPECT_TRUE(reply.has_value());
+  return std::move(reply.value());
+}
+
 }  // namespace
 
 TEST(FileSelectorPlugin, TestOpenSimple) {
@@ -57,8 +155,12 @@ TEST(FileSelectorPlugin, TestOpenSimple) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowOpenDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ false, EncodableList()),
       nullptr, nullptr);
@@ -97,11 +199,15 @@ TEST(FileSelectorPlugin, TestOpenWithArguments) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
   // This directory must exist.
   std::string initial_directory("C:\\Program Files");
   std::string confirm_button("Open it!");
-  ErrorOr<FileDialogResult> result = plugin.ShowOpenDialog(
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ false, EncodableList()),
       &initial_directory, &confirm_button);
@@ -145,8 +251,12 @@ TEST(FileSelectorPlugin, TestOpenMultiple) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowOpenDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ true,
                        /* select folders = */ false, EncodableList()),
       nullptr, nullptr);
@@ -160,6 +270,152 @@ TEST(FileSelectorPlugin, TestOpenMultiple) {
   EXPECT_EQ(std::get<std::string>(paths[1]),
             Utf8FromUtf16(fake_selected_file_2.path()));
   EXPECT_EQ(result.value().type_group_index(), nullptr);
+  EXPECT_EQ(result.value().metadata(), nullptr);
+}
+
+TEST(FileSelectorPlugin, TestOpenMultipleStreamed) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  ScopedTestFileIdList fake_selected_file_1;
+  ScopedTestFileIdList fake_selected_file_2;
+  LPCITEMIDLIST fake_selected_files[] = {
+      fake_selected_file_1.file(),
+      fake_selected_file_2.file(),
+  };
+  IShellItemArrayPtr fake_result_array;
+  ::SHCreateShellItemArrayFromIDLists(2, fake_selected_files,
+                                      &fake_result_array);
+
+  bool shown = false;
+  MockShow show_validator = [&shown, fake_result_array](
+                                const TestFileDialogController& dialog,
+                                HWND parent) {
+    shown = true;
+    return MockShowResult(fake_result_array);
+  };
+
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  EncodableList streamed_paths;
+  int chunk_count = 0;
+  plugin.SetResultChunkHandler(
+      [&streamed_paths, &chunk_count](const EncodableList& paths) {
+        ++chunk_count;
+        streamed_paths.insert(streamed_paths.end(), paths.begin(),
+                              paths.end());
+      });
+  bool stream_results = true;
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
+      SelectionOptions(/* allow multiple = */ true,
+                       /* select folders = */ false, EncodableList(),
+                       &stream_results, nullptr),
+      nullptr, nullptr);
+
+  EXPECT_TRUE(shown);
+  ASSERT_FALSE(result.has_error());
+  // All paths should have been delivered through the handler, in one chunk
+  // since the selection is smaller than the enumeration batch size.
+  EXPECT_TRUE(result.value().paths().empty());
+  EXPECT_EQ(chunk_count, 1);
+  ASSERT_EQ(streamed_paths.size(), 2);
+  EXPECT_EQ(std::get<std::string>(streamed_paths[0]),
+            Utf8FromUtf16(fake_selected_file_1.path()));
+  EXPECT_EQ(std::get<std::string>(streamed_paths[1]),
+            Utf8FromUtf16(fake_selected_file_2.path()));
+}
+
+TEST(FileSelectorPlugin, TestOpenMultipleStreamRequestedWithoutListener) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  ScopedTestFileIdList fake_selected_file_1;
+  ScopedTestFileIdList fake_selected_file_2;
+  LPCITEMIDLIST fake_selected_files[] = {
+      fake_selected_file_1.file(),
+      fake_selected_file_2.file(),
+  };
+  IShellItemArrayPtr fake_result_array;
+  ::SHCreateShellItemArrayFromIDLists(2, fake_selected_files,
+                                      &fake_result_array);
+
+  MockShow show_validator = [fake_result_array](
+                                const TestFileDialogController& dialog,
+                                HWND parent) {
+    return MockShowResult(fake_result_array);
+  };
+
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  bool stream_results = true;
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
+      SelectionOptions(/* allow multiple = */ true,
+                       /* select folders = */ false, EncodableList(),
+                       &stream_results, nullptr),
+      nullptr, nullptr);
+
+  // With no handler set, the paths should fall back to the result.
+  ASSERT_FALSE(result.has_error());
+  EXPECT_EQ(result.value().paths().size(), 2);
+}
+
+TEST(FileSelectorPlugin, TestOpenMultipleWithMetadata) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  ScopedTestFileIdList fake_selected_file_1;
+  ScopedTestFileIdList fake_selected_file_2;
+  LPCITEMIDLIST fake_selected_files[] = {
+      fake_selected_file_1.file(),
+      fake_selected_file_2.file(),
+  };
+  IShellItemArrayPtr fake_result_array;
+  ::SHCreateShellItemArrayFromIDLists(2, fake_selected_files,
+                                      &fake_result_array);
+
+  MockShow show_validator = [fake_result_array](
+                                const TestFileDialogController& dialog,
+                                HWND parent) {
+    return MockShowResult(fake_result_array);
+  };
+
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  bool include_metadata = true;
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
+      SelectionOptions(/* allow multiple = */ true,
+                       /* select folders = */ false, EncodableList(), nullptr,
+                       &include_metadata),
+      nullptr, nullptr);
+
+  ASSERT_FALSE(result.has_error());
+  EXPECT_EQ(result.value().paths().size(), 2);
+  const EncodableList* metadata = result.value().metadata();
+  ASSERT_NE(metadata, nullptr);
+  ASSERT_EQ(metadata->size(), 2);
+  for (const EncodableValue& value : *metadata) {
+    const auto& file_metadata = std::any_cast<FileMetadata>(
+        std::get<CustomEncodableValue>(value));
+    // The test files are created empty.
+    ASSERT_NE(file_metadata.size(), nullptr);
+    EXPECT_EQ(*file_metadata.size(), 0);
+    ASSERT_NE(file_metadata.last_write_time(), nullptr);
+    EXPECT_GT(*file_metadata.last_write_time(), 0);
+    ASSERT_NE(file_metadata.attributes(), nullptr);
+    EXPECT_EQ(*file_metadata.attributes() & FILE_ATTRIBUTE_DIRECTORY, 0);
+    // The test files are stored locally.
+    ASSERT_NE(file_metadata.is_cloud_placeholder(), nullptr);
+    EXPECT_FALSE(*file_metadata.is_cloud_placeholder());
+  }
 }
 
 TEST(FileSelectorPlugin, TestOpenWithFilter) {
@@ -207,16 +463,20 @@ TEST(FileSelectorPlugin, TestOpenWithFilter) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result =
-      plugin.ShowOpenDialog(SelectionOptions(/* allow multiple = */ false,
-                                             /* select folders = */ false,
-                                             EncodableList({
-                                                 text_group,
-                                                 image_group,
-                                                 any_group,
-                                             })),
-                            nullptr, nullptr);
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
+      SelectionOptions(/* allow multiple = */ false,
+                       /* select folders = */ false,
+                       EncodableList({
+                           text_group,
+                           image_group,
+                           any_group,
+                       })),
+      nullptr, nullptr);
 
   EXPECT_TRUE(shown);
   ASSERT_FALSE(result.has_error());
@@ -243,8 +503,12 @@ TEST(FileSelectorPlugin, TestOpenCancel) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowOpenDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ false, EncodableList()),
       nullptr, nullptr);
@@ -256,6 +520,85 @@ TEST(FileSelectorPlugin, TestOpenCancel) {
   EXPECT_EQ(result.value().type_group_index(), nullptr);
 }
 
+TEST(FileSelectorPlugin, TestOpenWithConfiguration) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  ScopedTestShellItem fake_selected_file;
+  IShellItemArrayPtr fake_result_array;
+  ::SHCreateShellItemArrayFromShellItem(fake_selected_file.file(),
+                                        IID_PPV_ARGS(&fake_result_array));
+
+  const EncodableValue text_group =
+      CustomEncodableValue(TypeGroup("Text", EncodableList({
+                                                 EncodableValue("txt"),
+                                                 EncodableValue("json"),
+                                             })));
+
+  int show_count = 0;
+  MockShow show_validator = [&show_count, fake_result_array, fake_window](
+                                const TestFileDialogController& dialog,
+                                HWND parent) {
+    ++show_count;
+    EXPECT_EQ(parent, fake_window);
+
+    // Each show should get a fully configured dialog.
+    const std::vector<DialogFilter>& filters = dialog.GetFileTypes();
+    EXPECT_EQ(filters.size(), 1U);
+    if (filters.size() == 1U) {
+      EXPECT_EQ(filters[0].name, L"Text");
+      EXPECT_EQ(filters[0].spec, L"*.txt;*.json");
+    }
+    EXPECT_EQ(dialog.GetOkButtonLabel(), L"Open it!");
+    EXPECT_EQ(dialog.GetSetFolderPath(), L"C:\\Program Files");
+
+    return MockShowResult(fake_result_array);
+  };
+
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  std::string confirm_button("Open it!");
+  ErrorOr<int64_t> configuration_id = plugin.RegisterOpenDialogConfiguration(
+      SelectionOptions(/* allow multiple = */ true,
+                       /* select folders = */ false,
+                       EncodableList({text_group})),
+      &confirm_button);
+  ASSERT_FALSE(configuration_id.has_error());
+
+  // This directory must exist.
+  std::string initial_directory("C:\\Program Files");
+  for (int i = 0; i < 2; ++i) {
+    ErrorOr<FileDialogResult> result = ShowConfiguredOpenDialogSync(
+        plugin, configuration_id.value(), &initial_directory);
+    ASSERT_FALSE(result.has_error());
+    const EncodableList& paths = result.value().paths();
+    ASSERT_EQ(paths.size(), 1);
+    EXPECT_EQ(std::get<std::string>(paths[0]),
+              Utf8FromUtf16(fake_selected_file.path()));
+  }
+  EXPECT_EQ(show_count, 2);
+
+  EXPECT_FALSE(plugin.UnregisterDialogConfiguration(configuration_id.value())
+                   .has_value());
+}
+
+TEST(FileSelectorPlugin, TestOpenWithUnknownConfiguration) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+
+  ErrorOr<FileDialogResult> result =
+      ShowConfiguredOpenDialogSync(plugin, 42, nullptr);
+  EXPECT_TRUE(result.has_error());
+  EXPECT_TRUE(plugin.UnregisterDialogConfiguration(42).has_value());
+}
+
 TEST(FileSelectorPlugin, TestSaveSimple) {
   const HWND fake_window = reinterpret_cast<HWND>(1337);
   ScopedTestShellItem fake_selected_file;
@@ -278,8 +621,12 @@ TEST(FileSelectorPlugin, TestSaveSimple) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowSaveDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowSaveDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ false, EncodableList()),
       nullptr, nullptr, nullptr);
@@ -317,12 +664,16 @@ TEST(FileSelectorPlugin, TestSaveWithArguments) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
   // This directory must exist.
   std::string initial_directory("C:\\Program Files");
   std::string suggested_name("a name");
   std::string confirm_button("Save it!");
-  ErrorOr<FileDialogResult> result = plugin.ShowSaveDialog(
+  ErrorOr<FileDialogResult> result = ShowSaveDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ false, EncodableList()),
       &initial_directory, &suggested_name, &confirm_button);
@@ -374,15 +725,19 @@ TEST(FileSelectorPlugin, TestSaveWithFilter) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result =
-      plugin.ShowSaveDialog(SelectionOptions(/* allow multiple = */ false,
-                                             /* select folders = */ false,
-                                             EncodableList({
-                                                 text_group,
-                                                 image_group,
-                                             })),
-                            nullptr, nullptr, nullptr);
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowSaveDialogSync(
+      plugin,
+      SelectionOptions(/* allow multiple = */ false,
+                       /* select folders = */ false,
+                       EncodableList({
+                           text_group,
+                           image_group,
+                       })),
+      nullptr, nullptr, nullptr);
 
   EXPECT_TRUE(shown);
   ASSERT_FALSE(result.has_error());
@@ -409,8 +764,12 @@ TEST(FileSelectorPlugin, TestSaveCancel) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowSaveDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowSaveDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ false, EncodableList()),
       nullptr, nullptr, nullptr);
@@ -450,8 +809,12 @@ TEST(FileSelectorPlugin, TestGetDirectorySimple) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowOpenDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ true, EncodableList()),
       nullptr, nullptr);
@@ -497,8 +860,12 @@ TEST(FileSelectorPlugin, TestGetDirectoryMultiple) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowOpenDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ true, /* select folders = */ true,
                        EncodableList()),
       nullptr, nullptr);
@@ -527,8 +894,12 @@ TEST(FileSelectorPlugin, TestGetDirectoryCancel) {
 
   FileSelectorPlugin plugin(
       [fake_window] { return fake_window; },
-      std::make_unique<TestFileDialogControllerFactory>(show_validator));
-  ErrorOr<FileDialogResult> result = plugin.ShowOpenDialog(
+      std::make_unique<TestFileDialogControllerFactory>(show_validator),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<FileDialogResult> result = ShowOpenDialogSync(
+      plugin,
       SelectionOptions(/* allow multiple = */ false,
                        /* select folders = */ true, EncodableList()),
       nullptr, nullptr);
@@ -540,5 +911,175 @@ TEST(FileSelectorPlugin, TestGetDirectoryCancel) {
   EXPECT_EQ(result.value().type_group_index(), nullptr);
 }
 
+TEST(FileSelectorPlugin, TestGetThumbnails) {
+  ScopedTestShellItem file;
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  const int64_t size = 32;
+  ErrorOr<EncodableList> result = GetThumbnailsSync(
+      plugin,
+      EncodableList({
+          EncodableValue(Utf8FromUtf16(file.path())),
+          EncodableValue("C:\\this\\path\\does\\not\\exist.png"),
+      }),
+      size);
+
+  ASSERT_FALSE(result.has_error());
+  const EncodableList& thumbnails = result.value();
+  ASSERT_EQ(thumbnails.size(), 2);
+  // Files without a thumbnail handler still get their icon.
+  const auto& thumbnail = std::any_cast<Thumbnail>(
+      std::get<CustomEncodableValue>(thumbnails[0]));
+  EXPECT_GT(thumbnail.width(), 0);
+  EXPECT_LE(thumbnail.width(), size);
+  EXPECT_GT(thumbnail.height(), 0);
+  EXPECT_LE(thumbnail.height(), size);
+  EXPECT_EQ(thumbnail.bgra_pixels().size(),
+            static_cast<size_t>(thumbnail.width() * thumbnail.height() * 4));
+  EXPECT_TRUE(thumbnails[1].IsNull());
+}
+
+TEST(FileSelectorPlugin, TestGetThumbnailsInvalidSize) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  ErrorOr<EncodableList> result =
+      GetThumbnailsSync(plugin, EncodableList({EncodableValue("a.png")}), 0);
+
+  EXPECT_TRUE(result.has_error());
+}
+
+TEST(FileSelectorPlugin, TestHydrateCloudFiles) {
+  ScopedTestShellItem file;
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  bool progress_reported = false;
+  plugin.SetHydrationProgressHandler(
+      [&progress_reported](const std::string& path, int64_t hydrated_bytes,
+                           int64_t total_bytes) { progress_reported = true; });
+
+  ErrorOr<EncodableList> result = HydrateCloudFilesSync(
+      plugin, EncodableList({
+                  EncodableValue(Utf8FromUtf16(file.path())),
+                  EncodableValue("C:\\this\\path\\does\\not\\exist.txt"),
+              }));
+
+  ASSERT_FALSE(result.has_error());
+  EXPECT_EQ(result.value(), EncodableList({
+                                EncodableValue(true),
+                                EncodableValue(false),
+                            }));
+  // Local files don't need to be downloaded.
+  EXPECT_FALSE(progress_reported);
+}
+
+TEST(FileSelectorPlugin, TestHydrateCloudFilesEmpty) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+
+  ErrorOr<EncodableList> result = HydrateCloudFilesSync(plugin, {});
+
+  ASSERT_FALSE(result.has_error());
+  EXPECT_TRUE(result.value().empty());
+}
+
+TEST(FileSelectorPlugin, TestEnumerateFolder) {
+  ScopedTestFolder folder;
+  const std::wstring top_level_image = folder.AddFile(L"a.JPG");
+  folder.AddFile(L"b.txt");
+  const std::wstring nested_image = folder.AddFile(L"nested\\c.png");
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  std::vector<std::string> paths;
+  plugin.SetFolderEntriesHandler(
+      [&paths](int64_t enumeration_id, const FolderEntryBatch& entries) {
+        EXPECT_EQ(enumeration_id, 7);
+        ASSERT_EQ(entries.sizes.size(), entries.paths.size());
+        ASSERT_EQ(entries.last_write_times.size(), entries.paths.size());
+        for (size_t i = 0; i < entries.paths.size(); ++i) {
+          paths.push_back(std::get<std::string>(entries.paths[i]));
+          EXPECT_EQ(entries.sizes[i].LongValue(), 0);
+          EXPECT_GT(entries.last_write_times[i].LongValue(), 0);
+        }
+      });
+
+  ErrorOr<int64_t> result = EnumerateFolderSync(
+      plugin, 7, folder.path(),
+      EncodableList({EncodableValue("jpg"), EncodableValue(".png")}), true);
+
+  ASSERT_FALSE(result.has_error());
+  EXPECT_EQ(result.value(), 2);
+  EXPECT_THAT(paths, ::testing::UnorderedElementsAre(
+                         Utf8FromUtf16(top_level_image),
+                         Utf8FromUtf16(nested_image)));
+}
+
+TEST(FileSelectorPlugin, TestEnumerateFolderNonRecursive) {
+  ScopedTestFolder folder;
+  const std::wstring top_level_file = folder.AddFile(L"a.txt");
+  folder.AddFile(L"nested\\b.txt");
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+  std::vector<std::string> paths;
+  plugin.SetFolderEntriesHandler(
+      [&paths](int64_t enumeration_id, const FolderEntryBatch& entries) {
+        for (const EncodableValue& path : entries.paths) {
+          paths.push_back(std::get<std::string>(path));
+        }
+      });
+
+  ErrorOr<int64_t> result =
+      EnumerateFolderSync(plugin, 1, folder.path(), EncodableList(), false);
+
+  ASSERT_FALSE(result.has_error());
+  EXPECT_EQ(result.value(), 1);
+  EXPECT_THAT(paths, ::testing::ElementsAre(Utf8FromUtf16(top_level_file)));
+}
+
+TEST(FileSelectorPlugin, TestEnumerateFolderMissing) {
+  const HWND fake_window = reinterpret_cast<HWND>(1337);
+  FileSelectorPlugin plugin(
+      [fake_window] { return fake_window; },
+      std::make_unique<TestFileDialogControllerFactory>(nullptr),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>(),
+      std::make_unique<InlineTaskRunner>());
+
+  ErrorOr<int64_t> result =
+      EnumerateFolderSync(plugin, 1, L"C:\\this\\path\\does\\not\\exist",
+                          EncodableList(), true);
+
+  EXPECT_TRUE(result.has_error());
+}
+
 }  // namespace test
 }  // namespace file_selector_windows
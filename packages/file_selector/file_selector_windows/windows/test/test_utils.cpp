@@ -6,6 +6,7 @@
 #include <shobjidl.h>
 #include <windows.h>
 
+#include <filesystem>
 #include <string>
 
 namespace file_selector_windows {
@@ -41,5 +42,28 @@ ScopedTestFileIdList::ScopedTestFileIdList() {
 
 ScopedTestFileIdList::~ScopedTestFileIdList() { ::DeleteFile(path_.c_str()); }
 
+ScopedTestFolder::ScopedTestFolder() {
+  // Reuse a unique temp file name for the folder.
+  path_ = CreateTempFile();
+  ::DeleteFile(path_.c_str());
+  ::CreateDirectory(path_.c_str(), nullptr);
+}
+
+ScopedTestFolder::~ScopedTestFolder() {
+  std::error_code error;
+  std::filesystem::remove_all(path_, error);
+}
+
+std::wstring ScopedTestFolder::AddFile(const std::wstring& relative_path) {
+  const std::filesystem::path file_path =
+      std::filesystem::path(path_) / relative_path;
+  std::error_code error;
+  std::filesystem::create_directories(file_path.parent_path(), error);
+  HANDLE file = ::CreateFile(file_path.c_str(), GENERIC_WRITE, 0, nullptr,
+                             CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+  ::CloseHandle(file);
+  return file_path.wstring();
+}
+
 }  // namespace test
 }  // namespace file_selector_windows
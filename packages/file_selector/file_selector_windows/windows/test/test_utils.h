@@ -10,12 +10,14 @@
 #include <shobjidl.h>
 #include <windows.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <variant>
 
 #include "file_dialog_controller.h"
+#include "task_runner.h"
 
 _COM_SMARTPTR_TYPEDEF(IShellItem, IID_IShellItem);
 _COM_SMARTPTR_TYPEDEF(IShellItemArray, IID_IShellItemArray);
@@ -85,6 +87,41 @@ class ScopedTestFileIdList {
   std::wstring path_;
 };
 
+// Creates a temp folder, which will be deleted along with its contents when
+// the instance goes out of scope.
+class ScopedTestFolder {
+ public:
+  ScopedTestFolder();
+  ~ScopedTestFolder();
+
+  // Disallow copy and assign.
+  ScopedTestFolder(const ScopedTestFolder&) = delete;
+  ScopedTestFolder& operator=(const ScopedTestFolder&) = delete;
+
+  // Creates an empty file at |relative_path| within the folder, creating any
+  // missing parent folders, and returns its full path.
+  std::wstring AddFile(const std::wstring& relative_path);
+
+  // Returns the folder's path.
+  const std::wstring& path() { return path_; }
+
+ private:
+  std::wstring path_;
+};
+
+// A TaskRunner that runs tasks immediately on the calling thread.
+class InlineTaskRunner : public TaskRunner {
+ public:
+  InlineTaskRunner() {}
+  virtual ~InlineTaskRunner() {}
+
+  // Disallow copy and assign.
+  InlineTaskRunner(const InlineTaskRunner&) = delete;
+  InlineTaskRunner& operator=(const InlineTaskRunner&) = delete;
+
+  void PostTask(std::function<void()> task) override { task(); }
+};
+
 }  // namespace test
 }  // namespace file_selector_windows
 
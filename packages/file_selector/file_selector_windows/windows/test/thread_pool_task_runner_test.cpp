@@ -0,0 +1,39 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#include "thread_pool_task_runner.h"
+
+#include <gtest/gtest.h>
+#include <objbase.h>
+#include <windows.h>
+
+#include <atomic>
+
+namespace file_selector_windows {
+namespace test {
+
+TEST(ThreadPoolTaskRunner, RunsAllTasksBeforeDestruction) {
+  std::atomic<int> completed = 0;
+  std::atomic<int> sta_count = 0;
+  {
+    ThreadPoolTaskRunner runner;
+    for (int i = 0; i < 16; ++i) {
+      runner.PostTask([&completed, &sta_count]() {
+        APTTYPE apartment_type;
+        APTTYPEQUALIFIER qualifier;
+        if (SUCCEEDED(::CoGetApartmentType(&apartment_type, &qualifier)) &&
+            apartment_type == APTTYPE_STA) {
+          ++sta_count;
+        }
+        ++completed;
+      });
+    }
+    // Destroying the runner waits for the posted tasks.
+  }
+
+  EXPECT_EQ(completed, 16);
+  EXPECT_EQ(sta_count, 16);
+}
+
+}  // namespace test
+}  // namespace file_selector_windows
@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#include "thread_pool_task_runner.h"
+
+#include <objbase.h>
+#include <windows.h>
+
+#include <memory>
+#include <utility>
+
+namespace file_selector_windows {
+
+ThreadPoolTaskRunner::ThreadPoolTaskRunner() {}
+
+ThreadPoolTaskRunner::~ThreadPoolTaskRunner() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  all_tasks_finished_.wait(lock, [this] { return pending_task_count_ == 0; });
+}
+
+void ThreadPoolTaskRunner::PostTask(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++pending_task_count_;
+  }
+  auto pending_task =
+      std::make_unique<PendingTask>(PendingTask{this, std::move(task)});
+  if (::TrySubmitThreadpoolCallback(&ThreadPoolTaskRunner::RunTask,
+                                    pending_task.get(), nullptr)) {
+    // Ownership is reclaimed in RunTask.
+    pending_task.release();
+  } else {
+    // Submission only fails if the system is out of resources; run the task
+    // on the calling thread rather than dropping it.
+    RunTask(nullptr, pending_task.release());
+  }
+}
+
+// static
+void CALLBACK ThreadPoolTaskRunner::RunTask(PTP_CALLBACK_INSTANCE instance,
+                                            void* context) {
+  std::unique_ptr<PendingTask> pending_task(
+      static_cast<PendingTask*>(context));
+  HRESULT com_result = ::CoInitializeEx(
+      nullptr, COINIT_APARTMENTTHREADED | COINIT_DISABLE_OLE1DDE);
+  pending_task->task();
+  if (SUCCEEDED(com_result)) {
+    ::CoUninitialize();
+  }
+  pending_task->runner->TaskFinished();
+}
+
+void ThreadPoolTaskRunner::TaskFinished() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (--pending_task_count_ == 0) {
+    all_tasks_finished_.notify_all();
+  }
+}
+
+}  // namespace file_selector_windows
@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#ifndef PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_THREAD_POOL_TASK_RUNNER_H_
+#define PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_THREAD_POOL_TASK_RUNNER_H_
+
+#include <windows.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+#include "task_runner.h"
+
+namespace file_selector_windows {
+
+// A TaskRunner that runs tasks concurrently on the process's default thread
+// pool. Each task runs with COM initialized in a single-threaded apartment,
+// as required by most shell extensions.
+//
+// Unlike other TaskRunners, tasks are not guaranteed to run in order.
+class ThreadPoolTaskRunner : public TaskRunner {
+ public:
+  ThreadPoolTaskRunner();
+
+  // Blocks until all posted tasks have finished.
+  virtual ~ThreadPoolTaskRunner();
+
+  // Disallow copy and assign.
+  ThreadPoolTaskRunner(const ThreadPoolTaskRunner&) = delete;
+  ThreadPoolTaskRunner& operator=(const ThreadPoolTaskRunner&) = delete;
+
+  // TaskRunner:
+  void PostTask(std::function<void()> task) override;
+
+ private:
+  // A posted task, along with the runner that posted it.
+  struct PendingTask {
+    ThreadPoolTaskRunner* runner;
+    std::function<void()> task;
+  };
+
+  // The thread pool entry point. |context| is an owned PendingTask.
+  static void CALLBACK RunTask(PTP_CALLBACK_INSTANCE instance, void* context);
+
+  // Records that a posted task has finished.
+  void TaskFinished();
+
+  // Guards |pending_task_count_|.
+  std::mutex mutex_;
+  std::condition_variable all_tasks_finished_;
+  size_t pending_task_count_ = 0;
+};
+
+}  // namespace file_selector_windows
+
+#endif  // PACKAGES_FILE_SELECTOR_FILE_SELECTOR_WINDOWS_WINDOWS_THREAD_POOL_TASK_RUNNER_H_
@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tracing.h"
+
+namespace file_selector_windows {
+
+// The provider id is derived from the provider name, so that tracing tools
+// can enable it as "*Flutter.FileSelector.Windows".
+TRACELOGGING_DEFINE_PROVIDER(
+    g_file_selector_trace_provider, "Flutter.FileSelector.Windows",
+    // {faaf2842-1739-5abb-9bca-a7a6564f3f1c}
+    (0xfaaf2842, 0x1739, 0x5abb, 0x9b, 0xca, 0xa7, 0xa6, 0x56, 0x4f, 0x3f,
+     0x1c));
+
+namespace {
+
+windows_plugin_utils::TraceProviderRegistration& GetRegistration() {
+  static windows_plugin_utils::TraceProviderRegistration registration(
+      g_file_selector_trace_provider);
+  return registration;
+}
+
+}  // namespace
+
+void RegisterTraceProvider() { GetRegistration().Register(); }
+
+void UnregisterTraceProvider() { GetRegistration().Unregister(); }
+
+}  // namespace file_selector_windows
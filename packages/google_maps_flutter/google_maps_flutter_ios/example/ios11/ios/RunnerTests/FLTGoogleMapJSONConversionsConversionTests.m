@@ -76,6 +76,39 @@
   XCTAssertEqual(holes[1][1].coordinate.longitude, 8);
 }
 
+- (void)testPathFromPackedLatLongs {
+  double coordinates[] = {1, 2, 3, 4};
+  FlutterStandardTypedData *latlongs = [FlutterStandardTypedData
+      typedDataWithFloat64:[NSData dataWithBytes:coordinates length:sizeof(coordinates)]];
+  GMSMutablePath *path = [FLTGoogleMapJSONConversions pathFromLatLongs:latlongs];
+  XCTAssertEqual(path.count, 2);
+  XCTAssertEqual([path coordinateAtIndex:0].latitude, 1);
+  XCTAssertEqual([path coordinateAtIndex:0].longitude, 2);
+  XCTAssertEqual([path coordinateAtIndex:1].latitude, 3);
+  XCTAssertEqual([path coordinateAtIndex:1].longitude, 4);
+}
+
+- (void)testPathFromLatLongArrays {
+  NSArray<NSArray *> *latlongs = @[ @[ @1, @2 ], @[ @(3), @(4) ] ];
+  GMSMutablePath *path = [FLTGoogleMapJSONConversions pathFromLatLongs:latlongs];
+  XCTAssertEqual(path.count, 2);
+  XCTAssertEqual([path coordinateAtIndex:1].latitude, 3);
+  XCTAssertEqual([path coordinateAtIndex:1].longitude, 4);
+}
+
+- (void)testPathsFromLatLongsArray {
+  double coordinates[] = {5, 6, 7, 8};
+  FlutterStandardTypedData *packed = [FlutterStandardTypedData
+      typedDataWithFloat64:[NSData dataWithBytes:coordinates length:sizeof(coordinates)]];
+  NSArray<GMSMutablePath *> *paths =
+      [FLTGoogleMapJSONConversions pathsFromLatLongsArray:@[ @[ @[ @1, @2 ] ], packed ]];
+  XCTAssertEqual(paths.count, 2);
+  XCTAssertEqual(paths[0].count, 1);
+  XCTAssertEqual([paths[0] coordinateAtIndex:0].longitude, 2);
+  XCTAssertEqual(paths[1].count, 2);
+  XCTAssertEqual([paths[1] coordinateAtIndex:1].latitude, 7);
+}
+
 - (void)testDictionaryFromPosition {
   id mockPosition = OCMClassMock([GMSCameraPosition class]);
   NSValue *locationValue = [NSValue valueWithMKCoordinate:CLLocationCoordinate2DMake(1, 2)];
@@ -56,4 +56,563 @@
   XCTAssertEqual(factory1.sharedMapServices, factory2.sharedMapServices);
 }
 
+- (void)testTileCacheEvictsLeastRecentlyUsedTilesFromMemory {
+  NSData *data = [self tileDataWithSize:1];
+  UIImage *image = FLTDecodeTileImage(data, 0);
+  NSUInteger imageCost = CGImageGetBytesPerRow(image.CGImage) * CGImageGetHeight(image.CGImage);
+  FLTTileCache *cache = [[FLTTileCache alloc] initWithTileOverlayIdentifier:@"overlay"
+                                                             memoryCapacity:imageCost * 2
+                                                               diskCapacity:0
+                                                               directoryURL:[self cacheDirectory]];
+  [cache setTileImage:image data:data forX:0 y:0 zoom:1];
+  [cache setTileImage:image data:data forX:1 y:0 zoom:1];
+  XCTAssertNotNil([cache memoryCachedTileImageForX:0 y:0 zoom:1]);
+
+  // The tile at (1, 0) is now the least recently used one.
+  [cache setTileImage:image data:data forX:0 y:1 zoom:1];
+  XCTAssertNotNil([cache memoryCachedTileImageForX:0 y:0 zoom:1]);
+  XCTAssertNil([cache memoryCachedTileImageForX:1 y:0 zoom:1]);
+  XCTAssertNotNil([cache memoryCachedTileImageForX:0 y:1 zoom:1]);
+}
+
+- (void)testTileCacheReadsTilesFromDisk {
+  NSData *data = [self tileDataWithSize:1];
+  FLTTileCache *cache = [[FLTTileCache alloc] initWithTileOverlayIdentifier:@"overlay"
+                                                             memoryCapacity:0
+                                                               diskCapacity:data.length * 4
+                                                               directoryURL:[self cacheDirectory]];
+  [cache setTileImage:FLTDecodeTileImage(data, 0) data:data forX:2 y:3 zoom:4];
+  XCTAssertNil([cache memoryCachedTileImageForX:2 y:3 zoom:4]);
+  XCTAssertNotNil([cache tileImageForX:2 y:3 zoom:4]);
+  XCTAssertNil([cache tileImageForX:3 y:2 zoom:4]);
+
+  [cache removeAllTiles];
+  XCTAssertNil([cache tileImageForX:2 y:3 zoom:4]);
+}
+
+- (void)testDecodeTileImageScalesDownLargeTiles {
+  UIImage *image = FLTDecodeTileImage([self tileDataWithSize:512], 256);
+  XCTAssertEqual(CGImageGetWidth(image.CGImage), 256);
+  XCTAssertEqual(CGImageGetHeight(image.CGImage), 256);
+
+  image = FLTDecodeTileImage([self tileDataWithSize:128], 256);
+  XCTAssertEqual(CGImageGetWidth(image.CGImage), 128);
+
+  XCTAssertNil(FLTDecodeTileImage([@"not an image" dataUsingEncoding:NSUTF8StringEncoding], 0));
+}
+
+- (void)testMarkersWithTheSameIconShareItsImage {
+  FLTMarkersController *controller = [self markersController];
+  NSData *iconData = [self tileDataWithSize:8];
+  NSMutableArray *markers = [[NSMutableArray alloc] init];
+  for (NSString *identifier in @[ @"a", @"b" ]) {
+    // Each message wraps the bytes in new typed data, as the standard codec does.
+    FlutterStandardTypedData *bytes = [FlutterStandardTypedData typedDataWithBytes:iconData];
+    [markers addObject:@{
+      @"markerId" : identifier,
+      @"position" : @[ @1, @2 ],
+      @"icon" : @[ @"fromBytes", bytes ],
+    }];
+  }
+  [controller addMarkers:markers];
+  [self waitForIconsOfMarkersController:controller];
+
+  GMSMarker *markerA = [controller.markerIdentifierToController[@"a"] marker];
+  GMSMarker *markerB = [controller.markerIdentifierToController[@"b"] marker];
+  XCTAssertNotNil(markerA.icon);
+  XCTAssertEqual(markerA.icon, markerB.icon);
+}
+
+- (void)testAddMarkersDecodesIconsOffTheMainThread {
+  FLTMarkersController *controller = [self markersController];
+  FlutterStandardTypedData *bytes =
+      [FlutterStandardTypedData typedDataWithBytes:[self tileDataWithSize:8]];
+  [controller addMarkers:@[ @{
+                @"markerId" : @"a",
+                @"position" : @[ @1, @2 ],
+                @"icon" : @[ @"fromBytes", bytes ],
+              } ]];
+
+  GMSMarker *marker = [controller.markerIdentifierToController[@"a"] marker];
+  XCTAssertNil(marker.icon);
+
+  [self waitForIconsOfMarkersController:controller];
+  XCTAssertNotNil(marker.icon);
+  XCTAssertEqual(CGImageGetWidth(marker.icon.CGImage), 8);
+}
+
+- (void)testDecodedIconIsNotAppliedAfterTheIconChanged {
+  FLTMarkersController *controller = [self markersController];
+  FlutterStandardTypedData *bytes =
+      [FlutterStandardTypedData typedDataWithBytes:[self tileDataWithSize:8]];
+  [controller addMarkers:@[ @{
+                @"markerId" : @"a",
+                @"position" : @[ @1, @2 ],
+                @"icon" : @[ @"fromBytes", bytes ],
+              } ]];
+  [controller changeMarkers:@[ @{@"markerId" : @"a", @"icon" : @[ @"defaultMarker" ]} ]];
+  GMSMarker *marker = [controller.markerIdentifierToController[@"a"] marker];
+  UIImage *defaultIcon = marker.icon;
+  XCTAssertNotNil(defaultIcon);
+
+  [self waitForIconsOfMarkersController:controller];
+  XCTAssertEqual(marker.icon, defaultIcon);
+}
+
+- (void)testChangeMarkersAppliesOnlyChangedOptions {
+  FLTMarkersController *controller = [self markersController];
+  NSDictionary *marker = @{
+    @"markerId" : @"a",
+    @"position" : @[ @1, @2 ],
+    @"alpha" : @1,
+    @"icon" : @[ @"defaultMarker" ],
+  };
+  [controller addMarkers:@[ marker ]];
+  GMSMarker *gmsMarker = [controller.markerIdentifierToController[@"a"] marker];
+  UIImage *icon = [UIImage imageWithData:[self tileDataWithSize:8]];
+  gmsMarker.icon = icon;
+
+  NSMutableDictionary *changedMarker = [marker mutableCopy];
+  changedMarker[@"alpha"] = @0.5;
+  [controller changeMarkers:@[ changedMarker ]];
+
+  XCTAssertEqualWithAccuracy(gmsMarker.opacity, 0.5, 1e-6);
+  // The icon didn't change, so it isn't set again.
+  XCTAssertEqual(gmsMarker.icon, icon);
+}
+
+- (void)testUpdateMarkerPositions {
+  FLTMarkersController *controller = [self markersController];
+  [controller addMarkers:@[
+    @{@"markerId" : @"a", @"position" : @[ @0, @0 ]},
+    @{@"markerId" : @"b", @"position" : @[ @0, @0 ]},
+  ]];
+  double coordinates[] = {1, 2, 3, 4};
+  NSData *data = [NSData dataWithBytes:coordinates length:sizeof(coordinates)];
+  [controller updateMarkerPositions:@[ @"a", @"b", @"unknown" ]
+                          positions:[FlutterStandardTypedData typedDataWithFloat64:data]];
+
+  GMSMarker *markerA = [controller.markerIdentifierToController[@"a"] marker];
+  GMSMarker *markerB = [controller.markerIdentifierToController[@"b"] marker];
+  XCTAssertEqual(markerA.position.latitude, 1);
+  XCTAssertEqual(markerA.position.longitude, 2);
+  XCTAssertEqual(markerB.position.latitude, 3);
+  XCTAssertEqual(markerB.position.longitude, 4);
+
+  // A later update back to the original position is applied, rather than seen as unchanged.
+  [controller changeMarkers:@[ @{@"markerId" : @"a", @"position" : @[ @0, @0 ]} ]];
+  XCTAssertEqual(markerA.position.latitude, 0);
+}
+
+- (void)testMarkerClustererGroupsMarkersInTheSameCell {
+  FLTMarkerClusterer *clusterer = [[FLTMarkerClusterer alloc] initWithZoom:10.5 gridSize:100];
+  [clusterer addMarkerWithIdentifier:@"a" position:CLLocationCoordinate2DMake(1.05, 1.05)];
+  [clusterer addMarkerWithIdentifier:@"b" position:CLLocationCoordinate2DMake(1.051, 1.053)];
+  [clusterer addMarkerWithIdentifier:@"c" position:CLLocationCoordinate2DMake(10, 10)];
+
+  NSArray<FLTMarkerCluster *> *clusters = [clusterer clustersWithMinimumSize:2];
+  XCTAssertEqual(clusters.count, 1);
+  FLTMarkerCluster *cluster = clusters.firstObject;
+  XCTAssertEqualObjects([NSSet setWithArray:cluster.markerIdentifiers],
+                        ([NSSet setWithObjects:@"a", @"b", nil]));
+  XCTAssertEqualWithAccuracy(cluster.position.latitude, 1.0505, 1e-9);
+  XCTAssertEqualWithAccuracy(cluster.position.longitude, 1.0515, 1e-9);
+  XCTAssertEqualWithAccuracy(cluster.bounds.northEast.longitude, 1.053, 1e-9);
+
+  XCTAssertEqual([clusterer clustersWithMinimumSize:3].count, 0);
+}
+
+- (void)testClusteringHidesClusteredMarkers {
+  FLTMarkersController *controller = [self markersController];
+  [controller addMarkers:@[
+    @{@"markerId" : @"a", @"position" : @[ @1, @1 ], @"visible" : @YES},
+    @{@"markerId" : @"b", @"position" : @[ @1.001, @1.001 ], @"visible" : @YES},
+    @{@"markerId" : @"c", @"position" : @[ @1.002, @1.002 ], @"visible" : @YES},
+  ]];
+  FLTGoogleMapMarkerController *markerA = controller.markerIdentifierToController[@"a"];
+  FLTGoogleMapMarkerController *markerC = controller.markerIdentifierToController[@"c"];
+  XCTAssertNotNil(markerA.marker.map);
+
+  [controller setClusteringOptions:@{
+    @"markerIds" : @[ @"a", @"b" ],
+    @"gridSize" : @100,
+    @"minimumClusterSize" : @2,
+    @"color" : @0xFF1E88E5,
+  }];
+  XCTAssertTrue(markerA.clustered);
+  XCTAssertNil(markerA.marker.map);
+  // Markers that aren't clustered stay on the map.
+  XCTAssertFalse(markerC.clustered);
+  XCTAssertNotNil(markerC.marker.map);
+
+  [controller setClusteringOptions:nil];
+  XCTAssertFalse(markerA.clustered);
+  XCTAssertNotNil(markerA.marker.map);
+}
+
+- (void)testEventCoalescerDeliversValuesRightAwayByDefault {
+  NSMutableArray *values = [[NSMutableArray alloc] init];
+  FLTEventCoalescer *coalescer = [[FLTEventCoalescer alloc] initWithHandler:^(id value) {
+    [values addObject:value];
+  }];
+  [coalescer addValue:@1];
+  [coalescer addValue:@2];
+  XCTAssertEqualObjects(values, (@[ @1, @2 ]));
+}
+
+- (void)testEventCoalescerDeliversOnlyTheLatestValueWithinTheInterval {
+  NSMutableArray *values = [[NSMutableArray alloc] init];
+  FLTEventCoalescer *coalescer = [[FLTEventCoalescer alloc] initWithHandler:^(id value) {
+    [values addObject:value];
+  }];
+  coalescer.minimumInterval = 100;
+  [coalescer addValue:@1];
+  [coalescer addValue:@2];
+  [coalescer addValue:@3];
+  XCTAssertEqualObjects(values, (@[ @1 ]));
+
+  [coalescer flush];
+  XCTAssertEqualObjects(values, (@[ @1, @3 ]));
+  // Nothing is left to deliver.
+  [coalescer flush];
+  XCTAssertEqualObjects(values, (@[ @1, @3 ]));
+}
+
+- (void)testEventCoalescerDeliversAtTheNextFrameWhenSynchronizedWithDisplay {
+  XCTestExpectation *delivered = [self expectationWithDescription:@"delivered"];
+  NSMutableArray *values = [[NSMutableArray alloc] init];
+  FLTEventCoalescer *coalescer = [[FLTEventCoalescer alloc] initWithHandler:^(id value) {
+    [values addObject:value];
+    [delivered fulfill];
+  }];
+  coalescer.synchronizesWithDisplay = YES;
+  [coalescer addValue:@1];
+  [coalescer addValue:@2];
+  XCTAssertEqual(values.count, 0);
+
+  [self waitForExpectationsWithTimeout:1 handler:nil];
+  XCTAssertEqualObjects(values, (@[ @2 ]));
+}
+
+- (void)testSimplifyPathKeepsOnlyPointsOutsideTheTolerance {
+  GMSMutablePath *path = [GMSMutablePath path];
+  for (NSInteger i = 0; i <= 100; i++) {
+    // A line along the equator, off by about a centimeter at every other point.
+    [path addLatitude:(i % 2 ? 1e-7 : 0) longitude:i * 0.01];
+  }
+
+  GMSPath *simplifiedPath = FLTSimplifyPath(path, FLTPathSimplificationToleranceForZoom(10));
+  XCTAssertEqual(simplifiedPath.count, 2);
+  XCTAssertEqual([simplifiedPath coordinateAtIndex:0].longitude, 0);
+  XCTAssertEqualWithAccuracy([simplifiedPath coordinateAtIndex:1].longitude, 1, 1e-9);
+
+  XCTAssertGreaterThan(FLTSimplifyPath(path, 0).count, 2);
+}
+
+- (void)testHeatmapRendererDrawsOnlyTilesNearPoints {
+  // A point where four tiles meet at zoom level 1, and one next to the antimeridian.
+  double points[] = {0, 0, 1, 60, 179.99, 1};
+  FLTHeatmapRenderer *renderer =
+      [[FLTHeatmapRenderer alloc] initWithData:[NSData dataWithBytes:points length:sizeof(points)]
+                                        radius:10
+                                        colors:@[ @0xFF00FF00, @0xFFFF0000 ]
+                                   startPoints:@[ @0.2, @1 ]
+                                  colorMapSize:256
+                                  maxIntensity:0
+                                      tileSize:256];
+
+  UIImage *tile = [renderer tileForX:0 y:0 zoom:1];
+  XCTAssertNotNil(tile);
+  XCTAssertEqual(tile.size.width * tile.scale, 256);
+  XCTAssertNotNil([renderer tileForX:1 y:0 zoom:1]);
+  XCTAssertNotNil([renderer tileForX:0 y:1 zoom:1]);
+  XCTAssertNotNil([renderer tileForX:1 y:1 zoom:1]);
+  XCTAssertNil([renderer tileForX:0 y:3 zoom:2]);
+  // The point next to the antimeridian blurs into the first tile of its row.
+  XCTAssertNotNil([renderer tileForX:0 y:4 zoom:4]);
+}
+
+- (void)testHeatmapRendererMaxIntensity {
+  double points[] = {10, 10, 2, 10, 10, 3, -10, -10, 4};
+  NSData *data = [NSData dataWithBytes:points length:sizeof(points)];
+  FLTHeatmapRenderer *renderer = [[FLTHeatmapRenderer alloc] initWithData:data
+                                                                   radius:10
+                                                                   colors:@[ @0xFFFF0000 ]
+                                                              startPoints:@[ @1 ]
+                                                             colorMapSize:256
+                                                             maxIntensity:0
+                                                                 tileSize:256];
+  XCTAssertEqual([renderer maxIntensityForZoom:8], 5);
+
+  FLTHeatmapRenderer *fixedRenderer = [[FLTHeatmapRenderer alloc] initWithData:data
+                                                                        radius:10
+                                                                        colors:@[ @0xFFFF0000 ]
+                                                                   startPoints:@[ @1 ]
+                                                                  colorMapSize:256
+                                                                  maxIntensity:7
+                                                                      tileSize:256];
+  XCTAssertEqual([fixedRenderer maxIntensityForZoom:8], 7);
+}
+
+- (void)testViewportCullingOnlyCreatesMarkersInTheCullingRegion {
+  FLTMarkersController *controller = [self markersController];
+  [controller setViewportCullingOptions:@{@"margin" : @0.5}];
+  GMSCoordinateBounds *visibleBounds =
+      [[GMSCoordinateBounds alloc] initWithCoordinate:CLLocationCoordinate2DMake(0, 0)
+                                           coordinate:CLLocationCoordinate2DMake(10, 10)];
+  [controller cullMarkersWithVisibleBounds:visibleBounds];
+  [controller addMarkers:@[
+    @{@"markerId" : @"inside", @"position" : @[ @5, @5 ], @"visible" : @YES, @"alpha" : @0.5},
+    @{@"markerId" : @"margin", @"position" : @[ @5, @14 ], @"visible" : @YES},
+    @{@"markerId" : @"outside", @"position" : @[ @5, @20 ], @"visible" : @YES},
+  ]];
+  FLTGoogleMapMarkerController *inside = controller.markerIdentifierToController[@"inside"];
+  FLTGoogleMapMarkerController *outside = controller.markerIdentifierToController[@"outside"];
+  XCTAssertNotNil(inside.marker.map);
+  XCTAssertNotNil([controller.markerIdentifierToController[@"margin"] marker]);
+  XCTAssertNil(outside.marker);
+  XCTAssertEqual(outside.position.longitude, 20);
+
+  // Markers that are shown reuse the markers of culled markers, with their own options.
+  NSArray<GMSMarker *> *culledMarkers =
+      @[ inside.marker, [controller.markerIdentifierToController[@"margin"] marker] ];
+  GMSCoordinateBounds *emptyBounds =
+      [[GMSCoordinateBounds alloc] initWithCoordinate:CLLocationCoordinate2DMake(50, 50)
+                                           coordinate:CLLocationCoordinate2DMake(60, 60)];
+  [controller cullMarkersWithVisibleBounds:emptyBounds];
+  XCTAssertNil(inside.marker);
+  GMSCoordinateBounds *outsideBounds =
+      [[GMSCoordinateBounds alloc] initWithCoordinate:CLLocationCoordinate2DMake(0, 20)
+                                           coordinate:CLLocationCoordinate2DMake(10, 30)];
+  [controller cullMarkersWithVisibleBounds:outsideBounds];
+  XCTAssertNotEqual([culledMarkers indexOfObjectIdenticalTo:outside.marker], NSNotFound);
+  XCTAssertEqualObjects(outside.marker.userData, @[ @"outside" ]);
+  XCTAssertEqual(outside.marker.position.longitude, 20);
+  XCTAssertEqualWithAccuracy(outside.marker.opacity, 1, 1e-6);
+
+  [controller setViewportCullingOptions:nil];
+  XCTAssertNotNil(inside.marker.map);
+  XCTAssertEqualWithAccuracy(inside.marker.opacity, 0.5, 1e-6);
+}
+
+- (void)testMapSnapshotCacheKeyDependsOnTheSnapshotOptions {
+  NSDictionary *options = @{
+    @"cameraPosition" : @{@"target" : @[ @1, @2 ], @"zoom" : @12, @"bearing" : @0, @"tilt" : @0},
+    @"width" : @120,
+    @"height" : @80,
+    @"mapType" : @1,
+  };
+  NSString *key = [FLTMapSnapshotter cacheKeyForOptions:options scale:2];
+  XCTAssertEqualObjects([FLTMapSnapshotter cacheKeyForOptions:[options copy] scale:2], key);
+  XCTAssertNotEqualObjects([FLTMapSnapshotter cacheKeyForOptions:options scale:3], key);
+
+  NSMutableDictionary *largerOptions = [options mutableCopy];
+  largerOptions[@"width"] = @121;
+  XCTAssertNotEqualObjects([FLTMapSnapshotter cacheKeyForOptions:largerOptions scale:2], key);
+  NSMutableDictionary *styledOptions = [options mutableCopy];
+  styledOptions[@"style"] = @"[]";
+  XCTAssertNotEqualObjects([FLTMapSnapshotter cacheKeyForOptions:styledOptions scale:2], key);
+  NSMutableDictionary *movedOptions = [options mutableCopy];
+  movedOptions[@"cameraPosition"] =
+      @{@"target" : @[ @1, @2.0001 ], @"zoom" : @12, @"bearing" : @0, @"tilt" : @0};
+  XCTAssertNotEqualObjects([FLTMapSnapshotter cacheKeyForOptions:movedOptions scale:2], key);
+}
+
+- (void)testFactoryUsesPrewarmedMapViewForTheNextMap {
+  id registrar = OCMProtocolMock(@protocol(FlutterPluginRegistrar));
+  FLTGoogleMapFactory *factory = [[FLTGoogleMapFactory alloc] initWithRegistrar:registrar];
+  [factory warmUpWithMapStyle:@"[]" prewarmMapView:YES];
+  CGRect frame = CGRectMake(0, 0, 100, 100);
+  NSDictionary *args = @{
+    @"initialCameraPosition" :
+        @{@"target" : @[ @1, @2 ], @"zoom" : @3, @"bearing" : @0, @"tilt" : @0},
+  };
+
+  FLTGoogleMapController *firstController =
+      (FLTGoogleMapController *)[factory createWithFrame:frame viewIdentifier:1 arguments:args];
+  GMSMapView *firstMapView = (GMSMapView *)firstController.view;
+  XCTAssertNotNil(firstMapView.mapStyle);
+  XCTAssertEqualWithAccuracy(firstMapView.camera.target.latitude, 1, 1e-6);
+  XCTAssertEqualWithAccuracy(firstMapView.camera.zoom, 3, 1e-6);
+
+  // Only the first map gets the prewarmed map view.
+  FLTGoogleMapController *secondController =
+      (FLTGoogleMapController *)[factory createWithFrame:frame viewIdentifier:2 arguments:args];
+  GMSMapView *secondMapView = (GMSMapView *)secondController.view;
+  XCTAssertNotEqual(secondMapView, firstMapView);
+  XCTAssertNil(secondMapView.mapStyle);
+
+  // Stop the controllers from observing the frames of their map views.
+  firstMapView.frame = frame;
+  secondMapView.frame = frame;
+}
+
+- (void)testMapStyleCacheParsesEachStyleOnce {
+  FLTMapStyleCache *cache = [[FLTMapStyleCache alloc] init];
+  NSString *json = @"[{\"featureType\":\"water\",\"stylers\":[{\"color\":\"#000000\"}]}]";
+
+  GMSMapStyle *style = [cache styleWithJSONString:json error:nil];
+  XCTAssertNotNil(style);
+  XCTAssertEqual([cache styleWithJSONString:[json mutableCopy] error:nil], style);
+  XCTAssertNotEqual([cache styleWithJSONString:@"[]" error:nil], style);
+
+  NSError *error;
+  XCTAssertNil([cache styleWithJSONString:@"{" error:&error]);
+  XCTAssertNotNil(error);
+}
+
+- (void)testMapStyleCacheEvictsLeastRecentlyUsedStyles {
+  FLTMapStyleCache *cache = [[FLTMapStyleCache alloc] init];
+  cache.countLimit = 2;
+  NSString *firstJSON = @"[]";
+  NSString *secondJSON = @"[ ]";
+  GMSMapStyle *first = [cache styleWithJSONString:firstJSON error:nil];
+  GMSMapStyle *second = [cache styleWithJSONString:secondJSON error:nil];
+  // Using the first style makes the second one the least recently used.
+  XCTAssertEqual([cache styleWithJSONString:firstJSON error:nil], first);
+  [cache styleWithJSONString:@"[  ]" error:nil];
+
+  XCTAssertEqual([cache styleWithJSONString:firstJSON error:nil], first);
+  XCTAssertNotEqual([cache styleWithJSONString:secondJSON error:nil], second);
+}
+
+- (void)testMapStyleCacheRegistersNamedStyles {
+  FLTMapStyleCache *cache = [[FLTMapStyleCache alloc] init];
+  XCTAssertTrue([cache registerStyleWithJSONString:@"[]" name:@"plain" error:nil]);
+  GMSMapStyle *style = [cache styleNamed:@"plain"];
+  XCTAssertNotNil(style);
+
+  // An invalid style keeps the registered one.
+  XCTAssertFalse([cache registerStyleWithJSONString:@"{" name:@"plain" error:nil]);
+  XCTAssertEqual([cache styleNamed:@"plain"], style);
+
+  [cache unregisterStyleNamed:@"plain"];
+  XCTAssertNil([cache styleNamed:@"plain"]);
+}
+
+- (void)testGeoJSONParserConvertsFeatures {
+  NSString *json = @"{\"type\": \"FeatureCollection\", \"features\": ["
+                    "{\"type\": \"Feature\", \"properties\": {\"name\": \"a\"},"
+                    " \"geometry\": {\"type\": \"Polygon\", \"coordinates\": ["
+                    "[[0, 0], [10, 0], [10, 20], [0, 0]], [[1, 1], [2, 1], [2, 2], [1, 1]]]}},"
+                    "{\"type\": \"Feature\", \"properties\": null, \"geometry\": {"
+                    "\"type\": \"GeometryCollection\", \"geometries\": ["
+                    "{\"type\": \"MultiLineString\", \"coordinates\": [[[1, 2], [3, 4]]]},"
+                    "{\"type\": \"Point\", \"coordinates\": [5, 6]}]}},"
+                    "{\"type\": \"Feature\", \"properties\": {}, \"geometry\": null}]}";
+  NSError *error;
+  NSArray<FLTGeoJSONFeature *> *features =
+      [FLTGeoJSONParser featuresFromData:[json dataUsingEncoding:NSUTF8StringEncoding]
+                                   error:&error];
+
+  XCTAssertNil(error);
+  XCTAssertEqual(features.count, 3);
+  XCTAssertEqualObjects(features[0].properties[@"name"], @"a");
+  XCTAssertEqual(features[0].polygons.count, 1);
+  NSArray<GMSPath *> *rings = features[0].polygons.firstObject;
+  XCTAssertEqual(rings.count, 2);
+  // GeoJSON positions hold the longitude before the latitude.
+  XCTAssertEqual([rings[0] coordinateAtIndex:2].latitude, 20);
+  XCTAssertEqual([rings[0] coordinateAtIndex:2].longitude, 10);
+  XCTAssertEqualObjects(features[1].properties, @{});
+  XCTAssertEqual(features[1].lineStrings.count, 1);
+  XCTAssertEqual(features[1].points.count, 1);
+  XCTAssertEqual(features[1].points.firstObject.coordinate.latitude, 6);
+  XCTAssertEqual(features[2].polygons.count + features[2].lineStrings.count, 0);
+}
+
+- (void)testGeoJSONParserRejectsInvalidDocuments {
+  for (NSString *json in @[
+         @"{", @"[]", @"{\"type\": \"Circle\"}",
+         @"{\"type\": \"LineString\", \"coordinates\": [[1, 2], [3]]}",
+         @"{\"type\": \"Feature\", \"geometry\": {\"type\": \"Polygon\"}}"
+       ]) {
+    NSError *error;
+    XCTAssertNil([FLTGeoJSONParser featuresFromData:[json dataUsingEncoding:NSUTF8StringEncoding]
+                                              error:&error],
+                 @"%@", json);
+    XCTAssertNotNil(error);
+  }
+}
+
+- (void)testGeoJSONLayersKeepTheirFeaturesWhenADocumentIsInvalid {
+  GMSMapView *mapView = [[GMSMapView alloc]
+      initWithFrame:CGRectMake(0, 0, 100, 100)
+             camera:[[GMSCameraPosition alloc] initWithLatitude:0 longitude:0 zoom:0]];
+  FLTGeoJSONLayersController *controller = [[FLTGeoJSONLayersController alloc]
+      initWithMapView:mapView
+            registrar:OCMProtocolMock(@protocol(FlutterPluginRegistrar))];
+  NSData *document = [@"{\"type\": \"Point\", \"coordinates\": [1, 2]}"
+      dataUsingEncoding:NSUTF8StringEncoding];
+
+  XCTestExpectation *added = [self expectationWithDescription:@"added"];
+  [controller addLayerWithOptions:@{
+    @"layerId" : @"a",
+    @"data" : [FlutterStandardTypedData typedDataWithBytes:document],
+    @"style" : @{@"style" : @{@"visible" : @YES}, @"rules" : @[]},
+  }
+                       completion:^(NSError *error) {
+                         XCTAssertNil(error);
+                         [added fulfill];
+                       }];
+  [self waitForExpectations:@[ added ] timeout:10];
+  XCTAssertTrue([controller hasLayerWithIdentifier:@"a"]);
+
+  XCTestExpectation *failed = [self expectationWithDescription:@"failed"];
+  [controller addLayerWithOptions:@{@"layerId" : @"a", @"path" : @"/missing.geojson"}
+                       completion:^(NSError *error) {
+                         XCTAssertNotNil(error);
+                         [failed fulfill];
+                       }];
+  [self waitForExpectations:@[ failed ] timeout:10];
+  XCTAssertTrue([controller hasLayerWithIdentifier:@"a"]);
+
+  [controller removeLayerWithIdentifier:@"a"];
+  XCTAssertFalse([controller hasLayerWithIdentifier:@"a"]);
+}
+
+// Returns a markers controller for a new map view.
+- (FLTMarkersController *)markersController {
+  GMSMapView *mapView = [[GMSMapView alloc]
+      initWithFrame:CGRectMake(0, 0, 100, 100)
+             camera:[[GMSCameraPosition alloc] initWithLatitude:0 longitude:0 zoom:0]];
+  return [[FLTMarkersController alloc]
+      initWithMethodChannel:OCMClassMock([FlutterMethodChannel class])
+                    mapView:mapView
+                  registrar:OCMProtocolMock(@protocol(FlutterPluginRegistrar))];
+}
+
+// Waits until the markers controller has set the icons it decodes in the background.
+- (void)waitForIconsOfMarkersController:(FLTMarkersController *)controller {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"icons"];
+  // Icons are decoded after the main queue's current work, and set back on the main queue.
+  dispatch_async(dispatch_get_main_queue(), ^{
+    dispatch_async(controller.iconQueue, ^{
+      dispatch_async(dispatch_get_main_queue(), ^{
+        [expectation fulfill];
+      });
+    });
+  });
+  [self waitForExpectations:@[ expectation ] timeout:10];
+}
+
+// Returns an encoded square image with the given size in pixels.
+- (NSData *)tileDataWithSize:(CGFloat)size {
+  UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat defaultFormat];
+  format.scale = 1;
+  UIGraphicsImageRenderer *renderer =
+      [[UIGraphicsImageRenderer alloc] initWithSize:CGSizeMake(size, size) format:format];
+  return [renderer PNGDataWithActions:^(UIGraphicsImageRendererContext *context) {
+    [UIColor.redColor setFill];
+    [context fillRect:CGRectMake(0, 0, size, size)];
+  }];
+}
+
+// Returns a new, empty directory for a tile cache.
+- (NSURL *)cacheDirectory {
+  return [NSFileManager.defaultManager.temporaryDirectory
+      URLByAppendingPathComponent:[NSUUID UUID].UUIDString
+                      isDirectory:YES];
+}
+
 @end
@@ -0,0 +1,35 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Delivers a stream of values to a handler at a limited rate, dropping all but the latest value
+/// added since the last delivery.
+///
+/// All methods must be called on the main thread, and the handler is called on it.
+@interface FLTEventCoalescer : NSObject
+
+/// Creates a coalescer that delivers values to @c handler.
+- (instancetype)initWithHandler:(void (^)(id value))handler NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The minimum time between deliveries. Defaults to 0, which delivers every value right away.
+@property(nonatomic, assign) NSTimeInterval minimumInterval;
+
+/// Whether values are delivered when the display refreshes, at most once per frame, rather than
+/// as soon as the minimum interval allows.
+@property(nonatomic, assign) BOOL synchronizesWithDisplay;
+
+/// Adds a value to deliver, replacing any value that hasn't been delivered yet.
+- (void)addValue:(id)value;
+
+/// Delivers the value that hasn't been delivered yet, if any, right away.
+- (void)flush;
+
+@end
+
+NS_ASSUME_NONNULL_END
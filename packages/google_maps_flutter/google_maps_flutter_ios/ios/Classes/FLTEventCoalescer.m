@@ -0,0 +1,111 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTEventCoalescer.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+// The target of a coalescer's display link, which holds the coalescer weakly so that the display
+// link doesn't keep it alive.
+@interface FLTEventCoalescerDisplayLinkTarget : NSObject
+@property(weak, nonatomic) FLTEventCoalescer *coalescer;
+@end
+
+@interface FLTEventCoalescer ()
+@property(copy, nonatomic) void (^handler)(id value);
+// The value added since the last delivery, if any.
+@property(strong, nonatomic, nullable) id pendingValue;
+@property(assign, nonatomic) CFTimeInterval lastDeliveryTime;
+// Whether a delivery of the pending value has been scheduled after the minimum interval.
+@property(assign, nonatomic) BOOL deliveryScheduled;
+@property(strong, nonatomic, nullable) CADisplayLink *displayLink;
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink;
+@end
+
+@implementation FLTEventCoalescerDisplayLinkTarget
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink {
+  [self.coalescer displayLinkDidFire:displayLink];
+}
+
+@end
+
+@implementation FLTEventCoalescer
+
+- (instancetype)initWithHandler:(void (^)(id value))handler {
+  self = [super init];
+  if (self) {
+    _handler = [handler copy];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [_displayLink invalidate];
+}
+
+- (void)setSynchronizesWithDisplay:(BOOL)synchronizesWithDisplay {
+  if (synchronizesWithDisplay == _synchronizesWithDisplay) {
+    return;
+  }
+  _synchronizesWithDisplay = synchronizesWithDisplay;
+  if (synchronizesWithDisplay) {
+    FLTEventCoalescerDisplayLinkTarget *target = [[FLTEventCoalescerDisplayLinkTarget alloc] init];
+    target.coalescer = self;
+    self.displayLink = [CADisplayLink displayLinkWithTarget:target
+                                                   selector:@selector(displayLinkDidFire:)];
+    self.displayLink.paused = self.pendingValue == nil;
+    [self.displayLink addToRunLoop:NSRunLoop.mainRunLoop forMode:NSRunLoopCommonModes];
+  } else {
+    [self.displayLink invalidate];
+    self.displayLink = nil;
+    [self flush];
+  }
+}
+
+- (void)addValue:(id)value {
+  self.pendingValue = value;
+  if (self.synchronizesWithDisplay) {
+    self.displayLink.paused = NO;
+    return;
+  }
+  NSTimeInterval wait = self.lastDeliveryTime + self.minimumInterval - CACurrentMediaTime();
+  if (wait <= 0) {
+    [self flush];
+    return;
+  }
+  if (self.deliveryScheduled) {
+    return;
+  }
+  self.deliveryScheduled = YES;
+  __weak __typeof__(self) weakSelf = self;
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(wait * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   weakSelf.deliveryScheduled = NO;
+                   [weakSelf flush];
+                 });
+}
+
+- (void)flush {
+  id value = self.pendingValue;
+  if (!value) {
+    return;
+  }
+  self.pendingValue = nil;
+  self.lastDeliveryTime = CACurrentMediaTime();
+  self.handler(value);
+}
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink {
+  if (!self.pendingValue) {
+    // Stop waking up for every frame until there is something to deliver again.
+    displayLink.paused = YES;
+    return;
+  }
+  if (CACurrentMediaTime() - self.lastDeliveryTime >= self.minimumInterval) {
+    [self flush];
+  }
+}
+
+@end
@@ -0,0 +1,45 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Foundation/Foundation.h>
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The domain of the errors of invalid GeoJSON documents.
+extern NSErrorDomain const FLTGeoJSONParserErrorDomain;
+
+/// A feature of a GeoJSON document, with its geometry converted to paths.
+@interface FLTGeoJSONFeature : NSObject
+
+/// The properties of the feature, which are empty if it has none.
+@property(copy, nonatomic, readonly) NSDictionary<NSString *, id> *properties;
+
+/// The polygons of the feature, each as its exterior ring followed by its holes.
+@property(copy, nonatomic, readonly) NSArray<NSArray<GMSPath *> *> *polygons;
+
+/// The line strings of the feature.
+@property(copy, nonatomic, readonly) NSArray<GMSPath *> *lineStrings;
+
+/// The points of the feature.
+@property(copy, nonatomic, readonly) NSArray<CLLocation *> *points;
+
+@end
+
+/// Converts GeoJSON documents into features, without going through Dart.
+///
+/// Feature collections, features and bare geometries of all types are supported. Features whose
+/// geometry is null or of an unknown type are kept, without any geometry, so that the features of
+/// a document keep their indices. This can be used on any queue.
+@interface FLTGeoJSONParser : NSObject
+
+/// Returns the features of the GeoJSON document in @c data.
+///
+/// Returns nil and sets @c error if @c data isn't a valid GeoJSON document.
++ (nullable NSArray<FLTGeoJSONFeature *> *)featuresFromData:(NSData *)data
+                                                      error:(NSError *_Nullable *_Nullable)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,237 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTGeoJSONParser.h"
+
+NSErrorDomain const FLTGeoJSONParserErrorDomain = @"FLTGeoJSONParserErrorDomain";
+
+@interface FLTGeoJSONFeature ()
+
+@property(copy, nonatomic, readwrite) NSDictionary<NSString *, id> *properties;
+@property(strong, nonatomic) NSMutableArray<NSArray<GMSPath *> *> *mutablePolygons;
+@property(strong, nonatomic) NSMutableArray<GMSPath *> *mutableLineStrings;
+@property(strong, nonatomic) NSMutableArray<CLLocation *> *mutablePoints;
+
+@end
+
+@implementation FLTGeoJSONFeature
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _properties = @{};
+    _mutablePolygons = [[NSMutableArray alloc] init];
+    _mutableLineStrings = [[NSMutableArray alloc] init];
+    _mutablePoints = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
+- (NSArray<NSArray<GMSPath *> *> *)polygons {
+  return [self.mutablePolygons copy];
+}
+
+- (NSArray<GMSPath *> *)lineStrings {
+  return [self.mutableLineStrings copy];
+}
+
+- (NSArray<CLLocation *> *)points {
+  return [self.mutablePoints copy];
+}
+
+@end
+
+// Returns the coordinate of a GeoJSON position, which holds the longitude before the latitude, or
+// NO if it isn't a valid position.
+static BOOL FLTGeoJSONCoordinate(id position, CLLocationCoordinate2D *coordinate) {
+  if (![position isKindOfClass:[NSArray class]] || [position count] < 2) {
+    return NO;
+  }
+  id longitude = position[0];
+  id latitude = position[1];
+  if (![longitude isKindOfClass:[NSNumber class]] || ![latitude isKindOfClass:[NSNumber class]]) {
+    return NO;
+  }
+  *coordinate = CLLocationCoordinate2DMake([latitude doubleValue], [longitude doubleValue]);
+  return YES;
+}
+
+// Returns the path through the given GeoJSON positions, or nil if they aren't valid.
+static GMSPath *_Nullable FLTGeoJSONPath(id positions) {
+  if (![positions isKindOfClass:[NSArray class]]) {
+    return nil;
+  }
+  GMSMutablePath *path = [[GMSMutablePath alloc] init];
+  for (id position in positions) {
+    CLLocationCoordinate2D coordinate;
+    if (!FLTGeoJSONCoordinate(position, &coordinate)) {
+      return nil;
+    }
+    [path addCoordinate:coordinate];
+  }
+  return path;
+}
+
+// Returns the rings of the given GeoJSON polygon coordinates, or nil if they aren't valid.
+static NSArray<GMSPath *> *_Nullable FLTGeoJSONRings(id rings) {
+  if (![rings isKindOfClass:[NSArray class]] || [rings count] == 0) {
+    return nil;
+  }
+  NSMutableArray<GMSPath *> *paths = [[NSMutableArray alloc] initWithCapacity:[rings count]];
+  for (id ring in rings) {
+    GMSPath *path = FLTGeoJSONPath(ring);
+    if (!path) {
+      return nil;
+    }
+    [paths addObject:path];
+  }
+  return paths;
+}
+
+// Returns whether the given GeoJSON type is the type of a geometry.
+static BOOL FLTIsGeoJSONGeometryType(id type) {
+  static NSSet<NSString *> *geometryTypes;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    geometryTypes =
+        [NSSet setWithObjects:@"Point", @"MultiPoint", @"LineString", @"MultiLineString",
+                              @"Polygon", @"MultiPolygon", @"GeometryCollection", nil];
+  });
+  return [type isKindOfClass:[NSString class]] && [geometryTypes containsObject:type];
+}
+
+// Adds the given GeoJSON geometry to the feature. Geometries of unknown types, which may have been
+// added by a later version of the format, are ignored. Returns NO if the geometry isn't valid.
+static BOOL FLTAddGeoJSONGeometry(id geometry, FLTGeoJSONFeature *feature, NSUInteger depth) {
+  // Geometry collections are not supposed to be nested, and deep nesting would exhaust the stack.
+  if (![geometry isKindOfClass:[NSDictionary class]] || depth > 8) {
+    return NO;
+  }
+  NSString *type = geometry[@"type"];
+  if (!FLTIsGeoJSONGeometryType(type)) {
+    return [type isKindOfClass:[NSString class]];
+  }
+  id coordinates = geometry[@"coordinates"];
+  if ([type isEqual:@"Point"]) {
+    CLLocationCoordinate2D coordinate;
+    if (!FLTGeoJSONCoordinate(coordinates, &coordinate)) {
+      return NO;
+    }
+    [feature.mutablePoints addObject:[[CLLocation alloc] initWithLatitude:coordinate.latitude
+                                                                longitude:coordinate.longitude]];
+  } else if ([type isEqual:@"MultiPoint"]) {
+    GMSPath *points = FLTGeoJSONPath(coordinates);
+    if (!points) {
+      return NO;
+    }
+    for (NSUInteger i = 0; i < points.count; i++) {
+      CLLocationCoordinate2D coordinate = [points coordinateAtIndex:i];
+      [feature.mutablePoints addObject:[[CLLocation alloc] initWithLatitude:coordinate.latitude
+                                                                  longitude:coordinate.longitude]];
+    }
+  } else if ([type isEqual:@"LineString"]) {
+    GMSPath *path = FLTGeoJSONPath(coordinates);
+    if (!path) {
+      return NO;
+    }
+    [feature.mutableLineStrings addObject:path];
+  } else if ([type isEqual:@"MultiLineString"]) {
+    NSArray<GMSPath *> *paths = FLTGeoJSONRings(coordinates);
+    if (!paths) {
+      return NO;
+    }
+    [feature.mutableLineStrings addObjectsFromArray:paths];
+  } else if ([type isEqual:@"Polygon"]) {
+    NSArray<GMSPath *> *rings = FLTGeoJSONRings(coordinates);
+    if (!rings) {
+      return NO;
+    }
+    [feature.mutablePolygons addObject:rings];
+  } else if ([type isEqual:@"MultiPolygon"]) {
+    if (![coordinates isKindOfClass:[NSArray class]]) {
+      return NO;
+    }
+    for (id polygon in coordinates) {
+      NSArray<GMSPath *> *rings = FLTGeoJSONRings(polygon);
+      if (!rings) {
+        return NO;
+      }
+      [feature.mutablePolygons addObject:rings];
+    }
+  } else if ([type isEqual:@"GeometryCollection"]) {
+    id geometries = geometry[@"geometries"];
+    if (![geometries isKindOfClass:[NSArray class]]) {
+      return NO;
+    }
+    for (id member in geometries) {
+      if (!FLTAddGeoJSONGeometry(member, feature, depth + 1)) {
+        return NO;
+      }
+    }
+  }
+  return YES;
+}
+
+// Returns the feature of the given GeoJSON feature object, or nil if it isn't valid.
+static FLTGeoJSONFeature *_Nullable FLTGeoJSONFeatureFromObject(id object) {
+  if (![object isKindOfClass:[NSDictionary class]] || ![object[@"type"] isEqual:@"Feature"]) {
+    return nil;
+  }
+  FLTGeoJSONFeature *feature = [[FLTGeoJSONFeature alloc] init];
+  id properties = object[@"properties"];
+  if ([properties isKindOfClass:[NSDictionary class]]) {
+    feature.properties = properties;
+  }
+  // Features without a geometry have a null one.
+  id geometry = object[@"geometry"];
+  if (geometry && geometry != (id)[NSNull null] && !FLTAddGeoJSONGeometry(geometry, feature, 0)) {
+    return nil;
+  }
+  return feature;
+}
+
+@implementation FLTGeoJSONParser
+
++ (nullable NSArray<FLTGeoJSONFeature *> *)featuresFromData:(NSData *)data
+                                                      error:(NSError *_Nullable *_Nullable)error {
+  id document = [NSJSONSerialization JSONObjectWithData:data options:0 error:error];
+  if (!document) {
+    return nil;
+  }
+  NSString *type = [document isKindOfClass:[NSDictionary class]] ? document[@"type"] : nil;
+  NSMutableArray<FLTGeoJSONFeature *> *features = [[NSMutableArray alloc] init];
+  if ([type isEqual:@"FeatureCollection"]) {
+    id members = document[@"features"];
+    if ([members isKindOfClass:[NSArray class]]) {
+      for (id member in members) {
+        FLTGeoJSONFeature *feature = FLTGeoJSONFeatureFromObject(member);
+        if (!feature) {
+          features = nil;
+          break;
+        }
+        [features addObject:feature];
+      }
+    } else {
+      features = nil;
+    }
+  } else if ([type isEqual:@"Feature"]) {
+    FLTGeoJSONFeature *feature = FLTGeoJSONFeatureFromObject(document);
+    features = feature ? [NSMutableArray arrayWithObject:feature] : nil;
+  } else {
+    FLTGeoJSONFeature *feature = [[FLTGeoJSONFeature alloc] init];
+    if (!FLTIsGeoJSONGeometryType(type) || !FLTAddGeoJSONGeometry(document, feature, 0)) {
+      features = nil;
+    } else {
+      [features addObject:feature];
+    }
+  }
+  if (!features && error) {
+    *error = [NSError errorWithDomain:FLTGeoJSONParserErrorDomain
+                                 code:0
+                             userInfo:@{NSLocalizedDescriptionKey : @"Invalid GeoJSON document"}];
+  }
+  return features;
+}
+
+@end
@@ -15,6 +15,11 @@ NS_ASSUME_NONNULL_BEGIN
 + (UIColor *)colorFromRGBA:(NSNumber *)data;
 + (NSArray<CLLocation *> *)pointsFromLatLongs:(NSArray *)data;
 + (NSArray<NSArray<CLLocation *> *> *)holesFromPointsArray:(NSArray *)data;
+/// Returns a path through the given points, which are either packed Float64 typed data holding
+/// the latitude and longitude of each point in turn, or an array of [latitude, longitude] arrays.
++ (GMSMutablePath *)pathFromLatLongs:(id)data;
+/// Returns a path for each element of @c data, as converted by @c pathFromLatLongs:.
++ (NSArray<GMSMutablePath *> *)pathsFromLatLongsArray:(NSArray *)data;
 + (nullable NSDictionary<NSString *, id> *)dictionaryFromPosition:
     (nullable GMSCameraPosition *)position;
 + (NSDictionary<NSString *, NSNumber *> *)dictionaryFromPoint:(CGPoint)point;
@@ -49,6 +49,31 @@
   return holes;
 }
 
++ (GMSMutablePath *)pathFromLatLongs:(id)data {
+  GMSMutablePath *path = [GMSMutablePath path];
+  if ([data isKindOfClass:[FlutterStandardTypedData class]]) {
+    FlutterStandardTypedData *typedData = data;
+    const double *coordinates = typedData.data.bytes;
+    NSUInteger count = typedData.elementCount / 2;
+    for (NSUInteger i = 0; i < count; i++) {
+      [path addLatitude:coordinates[2 * i] longitude:coordinates[2 * i + 1]];
+    }
+  } else {
+    for (NSArray *latlong in data) {
+      [path addLatitude:[latlong[0] doubleValue] longitude:[latlong[1] doubleValue]];
+    }
+  }
+  return path;
+}
+
++ (NSArray<GMSMutablePath *> *)pathsFromLatLongsArray:(NSArray *)data {
+  NSMutableArray<GMSMutablePath *> *paths = [[NSMutableArray alloc] initWithCapacity:data.count];
+  for (id latlongs in data) {
+    [paths addObject:[FLTGoogleMapJSONConversions pathFromLatLongs:latlongs]];
+  }
+  return paths;
+}
+
 + (nullable NSDictionary<NSString *, id> *)dictionaryFromPosition:(GMSCameraPosition *)position {
   if (!position) {
     return nil;
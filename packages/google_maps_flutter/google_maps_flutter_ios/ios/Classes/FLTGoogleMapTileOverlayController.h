@@ -16,10 +16,18 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSDictionary *)getTileOverlayInfo;
 @end
 
+@class FLTTileCache;
+
 @interface FLTTileProviderController : GMSTileLayer
 @property(copy, nonatomic, readonly) NSString *tileOverlayIdentifier;
+/// The cache that tiles are looked up in before they are requested, if any.
+@property(strong, atomic, nullable) FLTTileCache *tileCache;
+/// The URL that tiles are fetched from natively instead of being requested from Dart, if any,
+/// with `{x}`, `{y}` and `{z}` standing for the coordinates and zoom level of the tile.
+@property(copy, atomic, nullable) NSString *urlTemplate;
 - (instancetype)init:(FlutterMethodChannel *)methodChannel
     withTileOverlayIdentifier:(NSString *)identifier;
+- (void)interpretTileOverlayOptions:(NSDictionary *)data;
 @end
 
 @interface FLTTileOverlaysController : NSObject
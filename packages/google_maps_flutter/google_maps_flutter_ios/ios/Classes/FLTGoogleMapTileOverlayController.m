@@ -4,6 +4,7 @@
 
 #import "FLTGoogleMapTileOverlayController.h"
 #import "FLTGoogleMapJSONConversions.h"
+#import "FLTTileCache.h"
 
 @interface FLTGoogleMapTileOverlayController ()
 
@@ -28,6 +29,9 @@
 
 - (void)removeTileOverlay {
   self.layer.map = nil;
+  if ([self.layer isKindOfClass:[FLTTileProviderController class]]) {
+    [((FLTTileProviderController *)self.layer).tileCache removeAllMemoryCachedTiles];
+  }
 }
 
 - (void)clearTileCache {
@@ -94,6 +98,10 @@
   if (tileSize != nil && tileSize != (id)[NSNull null]) {
     [self setTileSize:tileSize.integerValue];
   }
+
+  if ([self.layer isKindOfClass:[FLTTileProviderController class]]) {
+    [(FLTTileProviderController *)self.layer interpretTileOverlayOptions:data];
+  }
 }
 
 @end
@@ -116,43 +124,172 @@
   return self;
 }
 
+- (void)interpretTileOverlayOptions:(NSDictionary *)data {
+  id urlTemplate = data[@"urlTemplate"];
+  self.urlTemplate = [urlTemplate isKindOfClass:[NSString class]] ? urlTemplate : nil;
+
+  NSDictionary *cacheData = data[@"tileCache"];
+  if (![cacheData isKindOfClass:[NSDictionary class]]) {
+    self.tileCache = nil;
+    return;
+  }
+  NSUInteger memoryCapacity = [cacheData[@"memoryCapacity"] unsignedIntegerValue];
+  NSUInteger diskCapacity = [cacheData[@"diskCapacity"] unsignedIntegerValue];
+  FLTTileCache *tileCache = self.tileCache;
+  if (tileCache.memoryCapacity != memoryCapacity || tileCache.diskCapacity != diskCapacity) {
+    tileCache = [[FLTTileCache alloc] initWithTileOverlayIdentifier:self.tileOverlayIdentifier
+                                                     memoryCapacity:memoryCapacity
+                                                       diskCapacity:diskCapacity];
+    self.tileCache = tileCache;
+  }
+  tileCache.tilePixelSize = self.tileSize;
+}
+
 #pragma mark - GMSTileLayer method
 
 - (void)requestTileForX:(NSUInteger)x
                       y:(NSUInteger)y
                    zoom:(NSUInteger)zoom
                receiver:(id<GMSTileReceiver>)receiver {
-  [self.methodChannel
-      invokeMethod:@"tileOverlay#getTile"
-         arguments:@{
-           @"tileOverlayId" : self.tileOverlayIdentifier,
-           @"x" : @(x),
-           @"y" : @(y),
-           @"zoom" : @(zoom)
-         }
-            result:^(id _Nullable result) {
-              UIImage *tileImage;
-              if ([result isKindOfClass:[NSDictionary class]]) {
-                FlutterStandardTypedData *typedData = (FlutterStandardTypedData *)result[@"data"];
-                if (typedData == nil) {
-                  tileImage = kGMSTileLayerNoTile;
+  FLTTileCache *tileCache = self.tileCache;
+  UIImage *memoryCachedImage = [tileCache memoryCachedTileImageForX:x y:y zoom:zoom];
+  if (memoryCachedImage) {
+    [receiver receiveTileWithX:x y:y zoom:zoom image:memoryCachedImage];
+    return;
+  }
+
+  NSString *urlTemplate = self.urlTemplate;
+  NSInteger tileSize = self.tileSize;
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+    UIImage *cachedImage = [tileCache tileImageForX:x y:y zoom:zoom];
+    if (cachedImage) {
+      [receiver receiveTileWithX:x y:y zoom:zoom image:cachedImage];
+      return;
+    }
+    // Receives the encoded tile, or nil if there is no tile. If the tile couldn't be fetched for
+    // now, the receiver is given a nil image so that the map requests it again later.
+    void (^completion)(NSData *_Nullable, BOOL) = ^(NSData *_Nullable data, BOOL failed) {
+      UIImage *tileImage = kGMSTileLayerNoTile;
+      if (failed) {
+        tileImage = nil;
+      } else if (data) {
+        // Decode the tile here, off the main thread where Dart's replies arrive, rather than
+        // leaving it to the map's render path. Larger tiles than the map displays are scaled down.
+        tileImage = FLTDecodeTileImage(data, tileSize);
+        if (tileImage) {
+          [tileCache setTileImage:tileImage data:data forX:x y:y zoom:zoom];
+        }
+      }
+      [receiver receiveTileWithX:x y:y zoom:zoom image:tileImage];
+    };
+    if (urlTemplate) {
+      [self fetchTileForX:x y:y zoom:zoom urlTemplate:urlTemplate completion:completion];
+    } else {
+      [self requestTileFromDartForX:x y:y zoom:zoom completion:completion];
+    }
+  });
+}
+
+#pragma mark - Tile sources
+
+// The session that all tile overlays fetch tiles from URL templates with. Tiles are cached by
+// FLTTileCache rather than NSURLCache, which would store them a second time.
++ (NSURLSession *)tileSession {
+  static NSURLSession *session;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    NSURLSessionConfiguration *configuration =
+        [NSURLSessionConfiguration defaultSessionConfiguration];
+    configuration.URLCache = nil;
+    configuration.HTTPMaximumConnectionsPerHost = 6;
+    session = [NSURLSession sessionWithConfiguration:configuration];
+  });
+  return session;
+}
+
+- (void)fetchTileForX:(NSUInteger)x
+                    y:(NSUInteger)y
+                 zoom:(NSUInteger)zoom
+          urlTemplate:(NSString *)urlTemplate
+           completion:(void (^)(NSData *_Nullable, BOOL))completion {
+  NSString *urlString = urlTemplate;
+  urlString = [urlString stringByReplacingOccurrencesOfString:@"{x}"
+                                                   withString:@(x).stringValue];
+  urlString = [urlString stringByReplacingOccurrencesOfString:@"{y}"
+                                                   withString:@(y).stringValue];
+  urlString = [urlString stringByReplacingOccurrencesOfString:@"{z}"
+                                                   withString:@(zoom).stringValue];
+  NSURL *url = [NSURL URLWithString:urlString];
+  if (!url) {
+    NSLog(@"Can't get tile: invalid URL %@", urlString);
+    completion(nil, NO);
+    return;
+  }
+  NSURLSessionDataTask *task = [[FLTTileProviderController tileSession]
+        dataTaskWithURL:url
+      completionHandler:^(NSData *_Nullable data, NSURLResponse *_Nullable response,
+                          NSError *_Nullable error) {
+        if (error) {
+          NSLog(@"Can't get tile: %@", error.localizedDescription);
+          completion(nil, YES);
+          return;
+        }
+        NSInteger statusCode = [response isKindOfClass:[NSHTTPURLResponse class]]
+                                   ? ((NSHTTPURLResponse *)response).statusCode
+                                   : 200;
+        if (statusCode == 200) {
+          completion(data, NO);
+        } else {
+          // Tile servers respond with 404 for tiles that don't exist, but server errors may not
+          // last.
+          completion(nil, statusCode >= 500);
+        }
+      }];
+  [task resume];
+}
+
+- (void)requestTileFromDartForX:(NSUInteger)x
+                              y:(NSUInteger)y
+                           zoom:(NSUInteger)zoom
+                     completion:(void (^)(NSData *_Nullable, BOOL))completion {
+  // Method channels must be used on the main thread.
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [self.methodChannel
+        invokeMethod:@"tileOverlay#getTile"
+           arguments:@{
+             @"tileOverlayId" : self.tileOverlayIdentifier,
+             @"x" : @(x),
+             @"y" : @(y),
+             @"zoom" : @(zoom)
+           }
+              result:^(id _Nullable result) {
+                NSData *data;
+                if ([result isKindOfClass:[NSDictionary class]]) {
+                  FlutterStandardTypedData *typedData = (FlutterStandardTypedData *)result[@"data"];
+                  data = [typedData isKindOfClass:[FlutterStandardTypedData class]] ? typedData.data
+                                                                                     : nil;
                 } else {
-                  tileImage = [UIImage imageWithData:typedData.data];
-                }
-              } else {
-                if ([result isKindOfClass:[FlutterError class]]) {
-                  FlutterError *error = (FlutterError *)result;
-                  NSLog(@"Can't get tile: errorCode = %@, errorMessage = %@, details = %@",
-                        [error code], [error message], [error details]);
-                }
-                if ([result isKindOfClass:[FlutterMethodNotImplemented class]]) {
-                  NSLog(@"Can't get tile: notImplemented");
+                  if ([result isKindOfClass:[FlutterError class]]) {
+                    FlutterError *error = (FlutterError *)result;
+                    NSLog(@"Can't get tile: errorCode = %@, errorMessage = %@, details = %@",
+                          [error code], [error message], [error details]);
+                  }
+                  if ([result isKindOfClass:[FlutterMethodNotImplemented class]]) {
+                    NSLog(@"Can't get tile: notImplemented");
+                  }
                 }
-                tileImage = kGMSTileLayerNoTile;
-              }
+                dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+                  completion(data, NO);
+                });
+              }];
+  });
+}
+
+#pragma mark - GMSTileLayer
 
-              [receiver receiveTileWithX:x y:y zoom:zoom image:tileImage];
-            }];
+- (void)clearTileCache {
+  [self.tileCache removeAllTiles];
+  [super clearTileCache];
 }
 
 @end
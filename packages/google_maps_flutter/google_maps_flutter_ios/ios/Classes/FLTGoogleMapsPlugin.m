@@ -3,9 +3,17 @@
 // found in the LICENSE file.
 
 #import "FLTGoogleMapsPlugin.h"
+#import "FLTMapSnapshotter.h"
+#import "FLTMapStyleCache.h"
 
 #pragma mark - GoogleMaps plugin implementation
 
+@interface FLTGoogleMapsPlugin ()
+@property(strong, nonatomic) FLTGoogleMapFactory *mapFactory;
+// Renders the snapshots requested through the plugin channel, created for the first snapshot.
+@property(strong, nonatomic, nullable) FLTMapSnapshotter *snapshotter;
+@end
+
 @implementation FLTGoogleMapsPlugin
 
 + (void)registerWithRegistrar:(NSObject<FlutterPluginRegistrar> *)registrar {
@@ -14,6 +22,51 @@
                                 withId:@"plugins.flutter.dev/google_maps_ios"
       gestureRecognizersBlockingPolicy:
           FlutterPlatformViewGestureRecognizersBlockingPolicyWaitUntilTouchesEnded];
+  FlutterMethodChannel *channel =
+      [FlutterMethodChannel methodChannelWithName:@"plugins.flutter.dev/google_maps_ios"
+                                  binaryMessenger:registrar.messenger];
+  FLTGoogleMapsPlugin *instance = [[FLTGoogleMapsPlugin alloc] init];
+  instance.mapFactory = googleMapFactory;
+  [registrar addMethodCallDelegate:instance channel:channel];
+}
+
+- (void)handleMethodCall:(FlutterMethodCall *)call result:(FlutterResult)result {
+  if ([call.method isEqualToString:@"maps#warmUp"]) {
+    NSString *style = call.arguments[@"style"];
+    [self.mapFactory
+        warmUpWithMapStyle:[style isKindOfClass:[NSString class]] ? style : nil
+            prewarmMapView:[call.arguments[@"prewarmMapView"] boolValue]];
+    result(nil);
+  } else if ([call.method isEqualToString:@"mapStyles#register"]) {
+    NSError *error;
+    if ([FLTMapStyleCache.sharedCache registerStyleWithJSONString:call.arguments[@"style"]
+                                                             name:call.arguments[@"name"]
+                                                            error:&error]) {
+      result(nil);
+    } else {
+      result(error.localizedDescription ?: @"Invalid map style");
+    }
+  } else if ([call.method isEqualToString:@"mapStyles#unregister"]) {
+    [FLTMapStyleCache.sharedCache unregisterStyleNamed:call.arguments];
+    result(nil);
+  } else if ([call.method isEqualToString:@"snapshot#render"]) {
+    if (!self.snapshotter) {
+      self.snapshotter = [[FLTMapSnapshotter alloc] init];
+    }
+    [self.snapshotter
+        snapshotWithOptions:call.arguments
+                 completion:^(NSData *pngData, NSString *errorMessage) {
+                   if (pngData) {
+                     result([FlutterStandardTypedData typedDataWithBytes:pngData]);
+                   } else {
+                     result([FlutterError errorWithCode:@"Snapshot failed"
+                                                message:errorMessage
+                                                details:nil]);
+                   }
+                 }];
+  } else {
+    result(FlutterMethodNotImplemented);
+  }
 }
 
 @end
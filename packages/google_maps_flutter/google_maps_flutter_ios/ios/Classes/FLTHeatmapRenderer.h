@@ -0,0 +1,45 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Renders the tiles of a heatmap of weighted points.
+///
+/// A renderer is immutable once it is created, and can render tiles on any thread. The points are
+/// projected and sorted the first time a tile is rendered, so creating a renderer is cheap.
+@interface FLTHeatmapRenderer : NSObject
+
+/// The width and height of the rendered tiles, in pixels.
+@property(nonatomic, readonly) NSUInteger tileSize;
+
+/// Initializes a renderer.
+///
+/// @param data The latitude, longitude and weight of each point in turn, as doubles.
+/// @param radius The radius, in pixels, over which each point is blurred.
+/// @param colors The ARGB colors of the gradient that intensities are drawn with.
+/// @param startPoints The intensity, from 0 to 1, at which each of @c colors starts.
+/// @param colorMapSize The number of colors the gradient is sampled into.
+/// @param maxIntensity The intensity drawn with the last color, or 0 to use the highest intensity
+///        of the points at each zoom level.
+/// @param tileSize The width and height of the rendered tiles, in pixels.
+- (instancetype)initWithData:(NSData *)data
+                      radius:(NSUInteger)radius
+                      colors:(NSArray<NSNumber *> *)colors
+                 startPoints:(NSArray<NSNumber *> *)startPoints
+                colorMapSize:(NSUInteger)colorMapSize
+                maxIntensity:(double)maxIntensity
+                    tileSize:(NSUInteger)tileSize NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Returns the tile at the given coordinates, or nil if no point is drawn on it.
+- (nullable UIImage *)tileForX:(NSUInteger)x y:(NSUInteger)y zoom:(NSUInteger)zoom;
+
+/// Returns the intensity that is drawn with the last color at the given zoom level.
+- (double)maxIntensityForZoom:(NSUInteger)zoom;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,322 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTHeatmapRenderer.h"
+
+// The zoom levels that the highest intensity is computed between when it isn't given. Below them
+// all points blur into a few cells, and above them every point stands alone.
+static const NSUInteger kFLTHeatmapMinIntensityZoom = 5;
+static const NSUInteger kFLTHeatmapMaxIntensityZoom = 11;
+
+// A point projected to Web Mercator, as a fraction of the width of the world.
+typedef struct {
+  double x;
+  double y;
+  double weight;
+} FLTHeatmapPoint;
+
+// A point bucketed into a cell of the world, for computing the highest intensity.
+typedef struct {
+  uint64_t cell;
+  double weight;
+} FLTHeatmapCellWeight;
+
+static int FLTCompareHeatmapPoints(const void *a, const void *b) {
+  double ax = ((const FLTHeatmapPoint *)a)->x;
+  double bx = ((const FLTHeatmapPoint *)b)->x;
+  return (ax > bx) - (ax < bx);
+}
+
+static int FLTCompareHeatmapCellWeights(const void *a, const void *b) {
+  uint64_t aCell = ((const FLTHeatmapCellWeight *)a)->cell;
+  uint64_t bCell = ((const FLTHeatmapCellWeight *)b)->cell;
+  return (aCell > bCell) - (aCell < bCell);
+}
+
+// Returns the index of the first of the sorted points whose x is at least minX.
+static NSUInteger FLTHeatmapLowerBound(const FLTHeatmapPoint *points, NSUInteger count,
+                                       double minX) {
+  NSUInteger low = 0;
+  NSUInteger high = count;
+  while (low < high) {
+    NSUInteger middle = low + (high - low) / 2;
+    if (points[middle].x < minX) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+// Returns a Gaussian kernel with a standard deviation of a third of the radius, so that it fades
+// out at the radius. Its center is 1, so that a lone point has an intensity of its weight.
+static double *FLTHeatmapKernel(NSUInteger radius) {
+  double *kernel = malloc((2 * radius + 1) * sizeof(double));
+  double sigma = radius / 3.0;
+  for (NSUInteger i = 0; i <= 2 * radius; i++) {
+    double distance = (double)i - radius;
+    kernel[i] = exp(-distance * distance / (2 * sigma * sigma));
+  }
+  return kernel;
+}
+
+// Samples the gradient into premultiplied RGBA colors. Intensities below the first start point fade
+// in from transparent, and the intensities between start points blend between their colors.
+static uint8_t *FLTHeatmapColorMap(NSArray<NSNumber *> *colors, NSArray<NSNumber *> *startPoints,
+                                   NSUInteger size) {
+  uint8_t *colorMap = calloc(size * 4, sizeof(uint8_t));
+  NSUInteger stops = MIN(colors.count, startPoints.count);
+  if (stops == 0) {
+    return colorMap;
+  }
+  for (NSUInteger i = 0; i < size; i++) {
+    double intensity = (double)i / (size - 1);
+    double argb[4];
+    NSUInteger stop = 0;
+    while (stop + 1 < stops && intensity >= startPoints[stop + 1].doubleValue) {
+      stop++;
+    }
+    unsigned long from = colors[stop].unsignedLongValue;
+    double start = startPoints[stop].doubleValue;
+    if (intensity < start) {
+      // Fade the first color in, up to its start point.
+      double fraction = start > 0 ? intensity / start : 1;
+      for (int shift = 24, channel = 0; channel < 4; shift -= 8, channel++) {
+        argb[channel] = (from >> shift) & 0xFF;
+      }
+      argb[0] *= fraction;
+    } else if (stop + 1 < stops) {
+      unsigned long to = colors[stop + 1].unsignedLongValue;
+      double end = startPoints[stop + 1].doubleValue;
+      double fraction = end > start ? (intensity - start) / (end - start) : 1;
+      for (int shift = 24, channel = 0; channel < 4; shift -= 8, channel++) {
+        double fromValue = (from >> shift) & 0xFF;
+        double toValue = (to >> shift) & 0xFF;
+        argb[channel] = fromValue + (toValue - fromValue) * fraction;
+      }
+    } else {
+      for (int shift = 24, channel = 0; channel < 4; shift -= 8, channel++) {
+        argb[channel] = (from >> shift) & 0xFF;
+      }
+    }
+    double alpha = argb[0] / 255;
+    colorMap[4 * i] = (uint8_t)lround(argb[1] * alpha);
+    colorMap[4 * i + 1] = (uint8_t)lround(argb[2] * alpha);
+    colorMap[4 * i + 2] = (uint8_t)lround(argb[3] * alpha);
+    colorMap[4 * i + 3] = (uint8_t)lround(argb[0]);
+  }
+  return colorMap;
+}
+
+@interface FLTHeatmapRenderer ()
+@property(nonatomic, readonly) NSData *data;
+@property(nonatomic, readonly) NSUInteger radius;
+@property(nonatomic, readonly) double maxIntensity;
+// The highest intensity at each zoom level, computed as tiles are rendered.
+@property(nonatomic, readonly) NSMutableDictionary<NSNumber *, NSNumber *> *maxIntensities;
+@end
+
+@implementation FLTHeatmapRenderer {
+  // The points sorted by x, once they have been prepared.
+  FLTHeatmapPoint *_points;
+  NSUInteger _pointCount;
+  // The weight of a point at each distance from it, from -radius to radius.
+  double *_kernel;
+  // The premultiplied RGBA bytes of each color that intensities are drawn with.
+  uint8_t *_colorMap;
+  NSUInteger _colorMapSize;
+}
+
+- (instancetype)initWithData:(NSData *)data
+                      radius:(NSUInteger)radius
+                      colors:(NSArray<NSNumber *> *)colors
+                 startPoints:(NSArray<NSNumber *> *)startPoints
+                colorMapSize:(NSUInteger)colorMapSize
+                maxIntensity:(double)maxIntensity
+                    tileSize:(NSUInteger)tileSize {
+  self = [super init];
+  if (self) {
+    _data = [data copy];
+    _radius = MAX(radius, 1);
+    _maxIntensity = maxIntensity;
+    _tileSize = tileSize;
+    _maxIntensities = [NSMutableDictionary dictionary];
+    _kernel = FLTHeatmapKernel(_radius);
+    _colorMapSize = MAX(colorMapSize, 2);
+    _colorMap = FLTHeatmapColorMap(colors, startPoints, _colorMapSize);
+  }
+  return self;
+}
+
+- (void)dealloc {
+  free(_points);
+  free(_kernel);
+  free(_colorMap);
+}
+
+// Projects the points and sorts them by x, so that the points of a tile can be found with a
+// binary search.
+- (void)preparePoints {
+  @synchronized(self) {
+    if (_points || self.data.length == 0) {
+      return;
+    }
+    NSUInteger count = self.data.length / (3 * sizeof(double));
+    const double *values = self.data.bytes;
+    FLTHeatmapPoint *points = malloc(MAX(count, 1) * sizeof(FLTHeatmapPoint));
+    for (NSUInteger i = 0; i < count; i++) {
+      double latitude = MAX(MIN(values[3 * i], 85.05112878), -85.05112878) * M_PI / 180;
+      double x = fmod((values[3 * i + 1] + 180) / 360, 1);
+      points[i].x = x < 0 ? x + 1 : x;
+      points[i].y = (1 - log(tan(latitude) + 1 / cos(latitude)) / M_PI) / 2;
+      points[i].weight = values[3 * i + 2];
+    }
+    qsort(points, count, sizeof(FLTHeatmapPoint), FLTCompareHeatmapPoints);
+    _pointCount = count;
+    _points = points;
+  }
+}
+
+- (double)maxIntensityForZoom:(NSUInteger)zoom {
+  if (self.maxIntensity > 0) {
+    return self.maxIntensity;
+  }
+  zoom = MAX(MIN(zoom, kFLTHeatmapMaxIntensityZoom), kFLTHeatmapMinIntensityZoom);
+  [self preparePoints];
+  @synchronized(self) {
+    NSNumber *cached = self.maxIntensities[@(zoom)];
+    if (cached) {
+      return cached.doubleValue;
+    }
+    // Sum the weights of the points in each radius-sized cell, as an estimate of the highest
+    // intensity that doesn't require rendering the whole world.
+    double cellsPerWorld = self.tileSize * pow(2, zoom) / self.radius;
+    FLTHeatmapCellWeight *cells = malloc(MAX(_pointCount, 1) * sizeof(FLTHeatmapCellWeight));
+    for (NSUInteger i = 0; i < _pointCount; i++) {
+      uint64_t cellX = (uint64_t)(_points[i].x * cellsPerWorld);
+      uint64_t cellY = (uint64_t)(_points[i].y * cellsPerWorld);
+      cells[i].cell = cellX << 32 | cellY;
+      cells[i].weight = _points[i].weight;
+    }
+    qsort(cells, _pointCount, sizeof(FLTHeatmapCellWeight), FLTCompareHeatmapCellWeights);
+    double maxIntensity = 0;
+    double intensity = 0;
+    for (NSUInteger i = 0; i < _pointCount; i++) {
+      intensity = (i > 0 && cells[i].cell == cells[i - 1].cell) ? intensity + cells[i].weight
+                                                                : cells[i].weight;
+      maxIntensity = MAX(maxIntensity, intensity);
+    }
+    free(cells);
+    self.maxIntensities[@(zoom)] = @(maxIntensity);
+    return maxIntensity;
+  }
+}
+
+- (nullable UIImage *)tileForX:(NSUInteger)x y:(NSUInteger)y zoom:(NSUInteger)zoom {
+  [self preparePoints];
+  if (_pointCount == 0) {
+    return nil;
+  }
+  NSInteger size = self.tileSize;
+  NSInteger radius = self.radius;
+  NSInteger gridSize = size + 2 * radius;
+  double tilesPerWorld = pow(2, zoom);
+  double worldSize = size * tilesPerWorld;
+  double minX = x / tilesPerWorld;
+  double minY = y / tilesPerWorld;
+  double margin = radius / worldSize;
+
+  // Add up the weights of the points in each pixel of the tile and of the margin around it, which
+  // the points blur into the tile from. Points are also drawn a world away, so that they blur
+  // across the antimeridian.
+  double *grid = calloc(gridSize * gridSize, sizeof(double));
+  BOOL hasPoints = NO;
+  for (NSInteger offset = -1; offset <= 1; offset++) {
+    double rangeMinX = minX - margin - offset;
+    double rangeMaxX = minX + 1 / tilesPerWorld + margin - offset;
+    for (NSUInteger i = FLTHeatmapLowerBound(_points, _pointCount, rangeMinX);
+         i < _pointCount && _points[i].x < rangeMaxX; i++) {
+      NSInteger column = (NSInteger)floor((_points[i].x + offset - minX) * worldSize) + radius;
+      NSInteger row = (NSInteger)floor((_points[i].y - minY) * worldSize) + radius;
+      if (column < 0 || column >= gridSize || row < 0 || row >= gridSize) {
+        continue;
+      }
+      grid[row * gridSize + column] += _points[i].weight;
+      hasPoints = YES;
+    }
+  }
+  if (!hasPoints) {
+    free(grid);
+    return nil;
+  }
+
+  // Blur the weights with the kernel, first along rows and then along columns. Each pixel spreads
+  // its weight out rather than gathering it in, so that empty pixels can be skipped.
+  double *rows = calloc(gridSize * size, sizeof(double));
+  BOOL *rowHasValues = calloc(gridSize, sizeof(BOOL));
+  for (NSInteger row = 0; row < gridSize; row++) {
+    for (NSInteger column = 0; column < gridSize; column++) {
+      double weight = grid[row * gridSize + column];
+      if (weight == 0) {
+        continue;
+      }
+      NSInteger first = MAX(column - 2 * radius, 0);
+      NSInteger last = MIN(column, size - 1);
+      for (NSInteger target = first; target <= last; target++) {
+        rows[row * size + target] += weight * _kernel[target - column + 2 * radius];
+      }
+      rowHasValues[row] = rowHasValues[row] || first <= last;
+    }
+  }
+  free(grid);
+  double *intensities = calloc(size * size, sizeof(double));
+  for (NSInteger row = 0; row < gridSize; row++) {
+    if (!rowHasValues[row]) {
+      continue;
+    }
+    NSInteger first = MAX(row - 2 * radius, 0);
+    NSInteger last = MIN(row, size - 1);
+    for (NSInteger target = first; target <= last; target++) {
+      double weight = _kernel[target - row + 2 * radius];
+      for (NSInteger column = 0; column < size; column++) {
+        intensities[target * size + column] += rows[row * size + column] * weight;
+      }
+    }
+  }
+  free(rows);
+  free(rowHasValues);
+
+  // Draw each intensity with its color.
+  double maxIntensity = [self maxIntensityForZoom:zoom];
+  double scale = maxIntensity > 0 ? (_colorMapSize - 1) / maxIntensity : 0;
+  uint8_t *pixels = calloc(size * size * 4, sizeof(uint8_t));
+  BOOL drawn = NO;
+  for (NSInteger i = 0; i < size * size; i++) {
+    NSUInteger index = (NSUInteger)MIN(intensities[i] * scale, (double)(_colorMapSize - 1));
+    if (index == 0) {
+      continue;
+    }
+    memcpy(&pixels[4 * i], &_colorMap[4 * index], 4);
+    drawn = drawn || _colorMap[4 * index + 3] > 0;
+  }
+  free(intensities);
+  if (!drawn) {
+    free(pixels);
+    return nil;
+  }
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+  CGContextRef context =
+      CGBitmapContextCreate(pixels, size, size, 8, size * 4, colorSpace,
+                            kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big);
+  CGImageRef image = CGBitmapContextCreateImage(context);
+  UIImage *tile = [UIImage imageWithCGImage:image];
+  CGImageRelease(image);
+  CGContextRelease(context);
+  CGColorSpaceRelease(colorSpace);
+  free(pixels);
+  return tile;
+}
+
+@end
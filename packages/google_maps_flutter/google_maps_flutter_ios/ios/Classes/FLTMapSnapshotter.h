@@ -0,0 +1,37 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Flutter/Flutter.h>
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Called with the PNG data of a snapshot, or with the message of the error that prevented it.
+typedef void (^FLTMapSnapshotCompletion)(NSData *_Nullable pngData,
+                                         NSString *_Nullable errorMessage);
+
+/// Renders snapshots of maps without a platform view, one at a time, with a single offscreen map
+/// view that is reused for every snapshot.
+///
+/// Snapshots are cached by their camera position, size, scale, map type and style, and requests
+/// for a snapshot that is already being rendered share its result.
+@interface FLTMapSnapshotter : NSObject
+
+/// The maximum number of bytes of PNG data that are cached.
+@property(assign, nonatomic) NSUInteger cacheSizeLimit;
+
+/// The longest time a snapshot waits for the tiles of the map to load before it is taken anyway.
+@property(assign, nonatomic) NSTimeInterval timeout;
+
+/// Renders a snapshot of the map described by @c options, which holds the @c cameraPosition,
+/// @c width and @c height in points, @c mapType and optional @c style of the map.
+- (void)snapshotWithOptions:(NSDictionary *)options
+                 completion:(FLTMapSnapshotCompletion)completion;
+
+/// Returns the key that the snapshot described by @c options is cached with, at the given scale.
++ (NSString *)cacheKeyForOptions:(NSDictionary *)options scale:(CGFloat)scale;
+
+@end
+
+NS_ASSUME_NONNULL_END
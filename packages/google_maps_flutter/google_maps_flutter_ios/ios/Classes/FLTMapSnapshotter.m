@@ -0,0 +1,177 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTMapSnapshotter.h"
+#import "FLTGoogleMapJSONConversions.h"
+#import "FLTMapStyleCache.h"
+
+@interface FLTMapSnapshotter () <GMSMapViewDelegate>
+
+// The offscreen map view that snapshots are rendered with, created for the first snapshot.
+@property(strong, nonatomic, nullable) GMSMapView *mapView;
+@property(strong, nonatomic) NSCache<NSString *, NSData *> *cache;
+// The keys of the snapshots waiting to be rendered, in the order they were requested.
+@property(strong, nonatomic) NSMutableArray<NSString *> *pendingKeys;
+@property(strong, nonatomic) NSMutableDictionary<NSString *, NSDictionary *> *pendingOptions;
+// The completions of every requested snapshot, including the one being rendered.
+@property(strong, nonatomic)
+    NSMutableDictionary<NSString *, NSMutableArray<FLTMapSnapshotCompletion> *> *completions;
+// The key of the snapshot being rendered, if any.
+@property(copy, nonatomic, nullable) NSString *renderingKey;
+// Incremented for every snapshot, so that the timeout of a finished snapshot is ignored.
+@property(assign, nonatomic) NSUInteger renderGeneration;
+
+@end
+
+@implementation FLTMapSnapshotter
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _cache = [[NSCache alloc] init];
+    _pendingKeys = [[NSMutableArray alloc] init];
+    _pendingOptions = [[NSMutableDictionary alloc] init];
+    _completions = [[NSMutableDictionary alloc] init];
+    _timeout = 5;
+    self.cacheSizeLimit = 20 * 1024 * 1024;
+  }
+  return self;
+}
+
+- (void)setCacheSizeLimit:(NSUInteger)cacheSizeLimit {
+  _cacheSizeLimit = cacheSizeLimit;
+  self.cache.totalCostLimit = cacheSizeLimit;
+}
+
++ (NSString *)cacheKeyForOptions:(NSDictionary *)options scale:(CGFloat)scale {
+  NSDictionary *camera = options[@"cameraPosition"];
+  CLLocationCoordinate2D target =
+      [FLTGoogleMapJSONConversions locationFromLatLong:camera[@"target"]];
+  id style = options[@"style"];
+  return [NSString stringWithFormat:@"%.7f,%.7f,%.3f,%.3f,%.3f|%gx%g@%g|%d|%@", target.latitude,
+                                    target.longitude, [camera[@"zoom"] doubleValue],
+                                    [camera[@"bearing"] doubleValue], [camera[@"tilt"] doubleValue],
+                                    [options[@"width"] doubleValue],
+                                    [options[@"height"] doubleValue], scale,
+                                    [options[@"mapType"] intValue],
+                                    [style isKindOfClass:[NSString class]] ? style : @""];
+}
+
+- (void)snapshotWithOptions:(NSDictionary *)options
+                 completion:(FLTMapSnapshotCompletion)completion {
+  NSString *key = [FLTMapSnapshotter cacheKeyForOptions:options scale:UIScreen.mainScreen.scale];
+  NSData *cachedData = [self.cache objectForKey:key];
+  if (cachedData) {
+    completion(cachedData, nil);
+    return;
+  }
+  NSMutableArray<FLTMapSnapshotCompletion> *completions = self.completions[key];
+  if (completions) {
+    // The same snapshot was already requested.
+    [completions addObject:[completion copy]];
+    return;
+  }
+  self.completions[key] = [NSMutableArray arrayWithObject:[completion copy]];
+  self.pendingOptions[key] = options;
+  [self.pendingKeys addObject:key];
+  [self renderNextSnapshot];
+}
+
+- (void)renderNextSnapshot {
+  if (self.renderingKey) {
+    return;
+  }
+  if (self.pendingKeys.count == 0) {
+    // Stop drawing the map view until the next snapshot.
+    [self.mapView removeFromSuperview];
+    return;
+  }
+  NSString *key = self.pendingKeys.firstObject;
+  [self.pendingKeys removeObjectAtIndex:0];
+  NSDictionary *options = self.pendingOptions[key];
+  [self.pendingOptions removeObjectForKey:key];
+
+  // The map view only draws while it is in a window, so it is added to the key window, outside of
+  // its bounds.
+  UIWindow *window = UIApplication.sharedApplication.keyWindow;
+  if (!window) {
+    [self finishSnapshotWithKey:key data:nil errorMessage:@"No window to render the map in"];
+    return;
+  }
+  CGSize size = CGSizeMake([options[@"width"] doubleValue], [options[@"height"] doubleValue]);
+  if (size.width <= 0 || size.height <= 0) {
+    [self finishSnapshotWithKey:key data:nil errorMessage:@"The snapshot size must be positive"];
+    return;
+  }
+  CGRect frame = CGRectMake(-size.width - 1, 0, size.width, size.height);
+  GMSCameraPosition *camera =
+      [FLTGoogleMapJSONConversions cameraPostionFromDictionary:options[@"cameraPosition"]];
+  if (!self.mapView) {
+    self.mapView = [GMSMapView mapWithFrame:frame camera:camera];
+    self.mapView.userInteractionEnabled = NO;
+    self.mapView.delegate = self;
+  } else {
+    self.mapView.frame = frame;
+    self.mapView.camera = camera;
+  }
+  if (self.mapView.superview != window) {
+    [window insertSubview:self.mapView atIndex:0];
+  }
+  self.mapView.mapType = [FLTGoogleMapJSONConversions mapViewTypeFromTypeValue:options[@"mapType"]];
+  NSString *style = options[@"style"];
+  self.mapView.mapStyle = [style isKindOfClass:[NSString class]]
+                              ? [FLTMapStyleCache.sharedCache styleWithJSONString:style error:nil]
+                              : nil;
+
+  self.renderingKey = key;
+  NSUInteger generation = ++self.renderGeneration;
+  __weak __typeof__(self) weakSelf = self;
+  // The map may not report that it is ready when nothing changed since the previous snapshot, or
+  // when tiles can't be loaded.
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.timeout * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   if (weakSelf.renderGeneration == generation) {
+                     [weakSelf takeSnapshot];
+                   }
+                 });
+}
+
+- (void)mapViewSnapshotReady:(GMSMapView *)mapView {
+  if (self.renderingKey) {
+    [self takeSnapshot];
+  }
+}
+
+- (void)takeSnapshot {
+  NSString *key = self.renderingKey;
+  self.renderingKey = nil;
+  self.renderGeneration++;
+  UIGraphicsImageRendererFormat *format = [UIGraphicsImageRendererFormat defaultFormat];
+  format.scale = UIScreen.mainScreen.scale;
+  UIGraphicsImageRenderer *renderer =
+      [[UIGraphicsImageRenderer alloc] initWithSize:self.mapView.bounds.size format:format];
+  UIImage *image = [renderer imageWithActions:^(UIGraphicsImageRendererContext *context) {
+    [self.mapView.layer renderInContext:context.CGContext];
+  }];
+  NSData *data = UIImagePNGRepresentation(image);
+  if (data) {
+    [self.cache setObject:data forKey:key cost:data.length];
+  }
+  [self finishSnapshotWithKey:key
+                         data:data
+                 errorMessage:data ? nil : @"The snapshot could not be encoded"];
+}
+
+- (void)finishSnapshotWithKey:(NSString *)key
+                         data:(nullable NSData *)data
+                 errorMessage:(nullable NSString *)errorMessage {
+  NSArray<FLTMapSnapshotCompletion> *completions = self.completions[key];
+  [self.completions removeObjectForKey:key];
+  for (FLTMapSnapshotCompletion completion in completions) {
+    completion(data, errorMessage);
+  }
+  [self renderNextSnapshot];
+}
+
+@end
@@ -0,0 +1,49 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Foundation/Foundation.h>
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A cache of parsed map styles, shared by all maps and snapshots of the process.
+///
+/// Styles given as JSON are cached by the SHA-256 digest of their JSON, so applying the same style
+/// to several maps, or again after a theme change, parses it only once. The least recently used
+/// of them are evicted once the cache holds more than @c countLimit styles.
+///
+/// Styles can also be registered under a name, which keeps them until they are replaced or
+/// unregistered, so that maps can use them without their JSON being sent again. All methods are
+/// thread safe.
+@interface FLTMapStyleCache : NSObject
+
+/// The cache shared by all maps.
+@property(class, nonatomic, readonly) FLTMapStyleCache *sharedCache;
+
+/// The maximum number of styles cached by their JSON. Defaults to 16.
+@property(atomic, assign) NSUInteger countLimit;
+
+/// Returns the style of the given JSON, parsing it only if it isn't cached.
+///
+/// Returns nil and sets @c error if the JSON isn't a valid style.
+- (nullable GMSMapStyle *)styleWithJSONString:(NSString *)json
+                                        error:(NSError *_Nullable *_Nullable)error;
+
+/// Registers the style of the given JSON under @c name, replacing the style registered under that
+/// name, if any.
+///
+/// Returns NO and sets @c error if the JSON isn't a valid style, keeping the registered style.
+- (BOOL)registerStyleWithJSONString:(NSString *)json
+                               name:(NSString *)name
+                              error:(NSError *_Nullable *_Nullable)error;
+
+/// Returns the style registered under @c name, or nil if there is none.
+- (nullable GMSMapStyle *)styleNamed:(NSString *)name;
+
+/// Removes the style registered under @c name, if any.
+- (void)unregisterStyleNamed:(NSString *)name;
+
+@end
+
+NS_ASSUME_NONNULL_END
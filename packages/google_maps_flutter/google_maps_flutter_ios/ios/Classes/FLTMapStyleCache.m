@@ -0,0 +1,104 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTMapStyleCache.h"
+
+#import <CommonCrypto/CommonDigest.h>
+
+// Returns the SHA-256 digest of the UTF-8 encoding of the given JSON.
+static NSData *FLTMapStyleKey(NSString *json) {
+  NSData *data = [json dataUsingEncoding:NSUTF8StringEncoding];
+  NSMutableData *digest = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+  CC_SHA256(data.bytes, (CC_LONG)data.length, digest.mutableBytes);
+  return digest;
+}
+
+@interface FLTMapStyleCache ()
+// The styles cached by the digest of their JSON, and their keys from least to most recently used.
+// Only accessed while synchronized on self.
+@property(strong, nonatomic) NSMutableDictionary<NSData *, GMSMapStyle *> *styles;
+@property(strong, nonatomic) NSMutableOrderedSet<NSData *> *styleKeys;
+// The registered styles by name. Only accessed while synchronized on self.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, GMSMapStyle *> *namedStyles;
+@end
+
+@implementation FLTMapStyleCache
+
++ (FLTMapStyleCache *)sharedCache {
+  static FLTMapStyleCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[FLTMapStyleCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _countLimit = 16;
+    _styles = [[NSMutableDictionary alloc] init];
+    _styleKeys = [[NSMutableOrderedSet alloc] init];
+    _namedStyles = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+- (nullable GMSMapStyle *)styleWithJSONString:(NSString *)json
+                                        error:(NSError *_Nullable *_Nullable)error {
+  NSData *key = FLTMapStyleKey(json);
+  @synchronized(self) {
+    GMSMapStyle *style = self.styles[key];
+    if (style) {
+      // Mark the style as the most recently used one.
+      [self.styleKeys removeObject:key];
+      [self.styleKeys addObject:key];
+      return style;
+    }
+  }
+
+  // Parsed outside of the lock, so that a large style doesn't hold up the other maps.
+  GMSMapStyle *style = [GMSMapStyle styleWithJSONString:json error:error];
+  if (!style) {
+    return nil;
+  }
+  @synchronized(self) {
+    self.styles[key] = style;
+    [self.styleKeys removeObject:key];
+    [self.styleKeys addObject:key];
+    while (self.styleKeys.count > self.countLimit) {
+      NSData *leastRecentlyUsedKey = self.styleKeys.firstObject;
+      [self.styleKeys removeObjectAtIndex:0];
+      [self.styles removeObjectForKey:leastRecentlyUsedKey];
+    }
+  }
+  return style;
+}
+
+- (BOOL)registerStyleWithJSONString:(NSString *)json
+                               name:(NSString *)name
+                              error:(NSError *_Nullable *_Nullable)error {
+  GMSMapStyle *style = [self styleWithJSONString:json error:error];
+  if (!style) {
+    return NO;
+  }
+  @synchronized(self) {
+    self.namedStyles[name] = style;
+  }
+  return YES;
+}
+
+- (nullable GMSMapStyle *)styleNamed:(NSString *)name {
+  @synchronized(self) {
+    return self.namedStyles[name];
+  }
+}
+
+- (void)unregisterStyleNamed:(NSString *)name {
+  @synchronized(self) {
+    [self.namedStyles removeObjectForKey:name];
+  }
+}
+
+@end
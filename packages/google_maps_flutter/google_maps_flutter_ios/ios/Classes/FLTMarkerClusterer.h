@@ -0,0 +1,43 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A group of markers that is drawn as a single marker.
+@interface FLTMarkerCluster : NSObject
+
+/// The average of the positions of the markers in the cluster.
+@property(nonatomic, readonly) CLLocationCoordinate2D position;
+
+/// The bounds of the positions of the markers in the cluster.
+@property(nonatomic, readonly) GMSCoordinateBounds *bounds;
+
+/// The identifiers of the markers in the cluster.
+@property(nonatomic, readonly) NSArray<NSString *> *markerIdentifiers;
+
+@end
+
+/// Groups markers into clusters by a grid laid over the map at a given zoom level.
+///
+/// The grid is aligned with the world rather than the screen, so clusters only change with the
+/// zoom level, not while the camera pans.
+@interface FLTMarkerClusterer : NSObject
+
+/// Creates a clusterer whose grid cells are @c gridSize points wide at the given zoom level,
+/// which is rounded down to a whole level.
+- (instancetype)initWithZoom:(float)zoom gridSize:(CGFloat)gridSize NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Adds the marker with the given identifier and position to the cell it falls into.
+- (void)addMarkerWithIdentifier:(NSString *)identifier position:(CLLocationCoordinate2D)position;
+
+/// Returns a cluster for each cell with at least @c minimumClusterSize markers.
+- (NSArray<FLTMarkerCluster *> *)clustersWithMinimumSize:(NSUInteger)minimumClusterSize;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,99 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTMarkerClusterer.h"
+
+@interface FLTMarkerCluster ()
+@property(strong, nonatomic) NSMutableArray<NSString *> *identifiers;
+@property(assign, nonatomic) double latitudeSum;
+@property(assign, nonatomic) double longitudeSum;
+@property(assign, nonatomic) CLLocationCoordinate2D southWest;
+@property(assign, nonatomic) CLLocationCoordinate2D northEast;
+@end
+
+@implementation FLTMarkerCluster
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _identifiers = [[NSMutableArray alloc] init];
+    _southWest = CLLocationCoordinate2DMake(90, 180);
+    _northEast = CLLocationCoordinate2DMake(-90, -180);
+  }
+  return self;
+}
+
+- (void)addMarkerWithIdentifier:(NSString *)identifier position:(CLLocationCoordinate2D)position {
+  [self.identifiers addObject:identifier];
+  self.latitudeSum += position.latitude;
+  self.longitudeSum += position.longitude;
+  self.southWest = CLLocationCoordinate2DMake(MIN(self.southWest.latitude, position.latitude),
+                                              MIN(self.southWest.longitude, position.longitude));
+  self.northEast = CLLocationCoordinate2DMake(MAX(self.northEast.latitude, position.latitude),
+                                              MAX(self.northEast.longitude, position.longitude));
+}
+
+- (CLLocationCoordinate2D)position {
+  NSUInteger count = self.identifiers.count;
+  return CLLocationCoordinate2DMake(self.latitudeSum / count, self.longitudeSum / count);
+}
+
+- (GMSCoordinateBounds *)bounds {
+  return [[GMSCoordinateBounds alloc] initWithCoordinate:self.southWest coordinate:self.northEast];
+}
+
+- (NSArray<NSString *> *)markerIdentifiers {
+  return self.identifiers;
+}
+
+@end
+
+@interface FLTMarkerClusterer ()
+// The size of the world at the zoom level, in grid cells.
+@property(assign, nonatomic) double worldSize;
+// The clusters by the index of their cell.
+@property(strong, nonatomic) NSMutableDictionary<NSNumber *, FLTMarkerCluster *> *cells;
+@end
+
+@implementation FLTMarkerClusterer
+
+- (instancetype)initWithZoom:(float)zoom gridSize:(CGFloat)gridSize {
+  self = [super init];
+  if (self) {
+    // The world is 256 points wide at zoom level 0, and doubles in size with every level.
+    _worldSize = 256 * pow(2, floor(MAX(zoom, 0))) / MAX(gridSize, 1);
+    _cells = [[NSMutableDictionary alloc] init];
+  }
+  return self;
+}
+
+- (void)addMarkerWithIdentifier:(NSString *)identifier position:(CLLocationCoordinate2D)position {
+  // Project the position with the Web Mercator projection the map uses, clamping the latitude to
+  // the range the projection covers.
+  double latitude = MAX(MIN(position.latitude, 85.05112878), -85.05112878) * M_PI / 180;
+  double x = (position.longitude + 180) / 360;
+  double y = (1 - log(tan(latitude) + 1 / cos(latitude)) / M_PI) / 2;
+  int64_t column = (int64_t)floor(x * self.worldSize);
+  int64_t row = (int64_t)floor(y * self.worldSize);
+  NSNumber *cell = @((column << 32) | (row & 0xFFFFFFFF));
+
+  FLTMarkerCluster *cluster = self.cells[cell];
+  if (!cluster) {
+    cluster = [[FLTMarkerCluster alloc] init];
+    self.cells[cell] = cluster;
+  }
+  [cluster addMarkerWithIdentifier:identifier position:position];
+}
+
+- (NSArray<FLTMarkerCluster *> *)clustersWithMinimumSize:(NSUInteger)minimumClusterSize {
+  NSMutableArray<FLTMarkerCluster *> *clusters = [[NSMutableArray alloc] init];
+  for (FLTMarkerCluster *cluster in self.cells.objectEnumerator) {
+    if (cluster.identifiers.count >= minimumClusterSize) {
+      [clusters addObject:cluster];
+    }
+  }
+  return clusters;
+}
+
+@end
@@ -0,0 +1,20 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Returns the tolerance for @c FLTSimplifyPath that removes the points which are less than half a
+/// point away from the simplified path at the given zoom level.
+extern double FLTPathSimplificationToleranceForZoom(float zoom);
+
+/// Simplifies @c path with the Douglas-Peucker algorithm, keeping only the points that are more
+/// than @c tolerance away from the simplified path.
+///
+/// Distances are measured in the Web Mercator projection the map uses, as a fraction of the width
+/// of the world. The first and last points of the path are always kept.
+extern GMSPath *FLTSimplifyPath(GMSPath *path, double tolerance);
+
+NS_ASSUME_NONNULL_END
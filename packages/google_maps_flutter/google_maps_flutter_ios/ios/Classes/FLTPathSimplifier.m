@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTPathSimplifier.h"
+
+double FLTPathSimplificationToleranceForZoom(float zoom) {
+  // The world is 256 points wide at zoom level 0, and doubles in size with every level.
+  return 0.5 / (256 * pow(2, floor(MAX(zoom, 0))));
+}
+
+// Returns the squared distance of point p from the segment from a to b.
+static double FLTSquaredSegmentDistance(CGPoint p, CGPoint a, CGPoint b) {
+  double dx = b.x - a.x;
+  double dy = b.y - a.y;
+  double lengthSquared = dx * dx + dy * dy;
+  double t = lengthSquared > 0 ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared : 0;
+  t = MAX(0, MIN(1, t));
+  double x = a.x + t * dx - p.x;
+  double y = a.y + t * dy - p.y;
+  return x * x + y * y;
+}
+
+GMSPath *FLTSimplifyPath(GMSPath *path, double tolerance) {
+  NSUInteger count = path.count;
+  if (count < 3) {
+    return path;
+  }
+
+  // Project the points once up front, rather than for every distance that is measured.
+  CGPoint *points = malloc(count * sizeof(CGPoint));
+  BOOL *kept = calloc(count, sizeof(BOOL));
+  NSUInteger *stack = malloc(2 * count * sizeof(NSUInteger));
+  for (NSUInteger i = 0; i < count; i++) {
+    CLLocationCoordinate2D coordinate = [path coordinateAtIndex:i];
+    double latitude = MAX(MIN(coordinate.latitude, 85.05112878), -85.05112878) * M_PI / 180;
+    points[i] = CGPointMake((coordinate.longitude + 180) / 360,
+                            (1 - log(tan(latitude) + 1 / cos(latitude)) / M_PI) / 2);
+  }
+
+  // Split ranges at their farthest point until every point in them is within the tolerance, using
+  // an explicit stack so that long paths can't overflow the call stack.
+  double toleranceSquared = tolerance * tolerance;
+  kept[0] = YES;
+  kept[count - 1] = YES;
+  NSUInteger stackSize = 0;
+  stack[stackSize++] = 0;
+  stack[stackSize++] = count - 1;
+  while (stackSize > 0) {
+    NSUInteger last = stack[--stackSize];
+    NSUInteger first = stack[--stackSize];
+    double maxDistance = 0;
+    NSUInteger farthest = first;
+    for (NSUInteger i = first + 1; i < last; i++) {
+      double distance = FLTSquaredSegmentDistance(points[i], points[first], points[last]);
+      if (distance > maxDistance) {
+        maxDistance = distance;
+        farthest = i;
+      }
+    }
+    if (maxDistance > toleranceSquared) {
+      kept[farthest] = YES;
+      stack[stackSize++] = first;
+      stack[stackSize++] = farthest;
+      stack[stackSize++] = farthest;
+      stack[stackSize++] = last;
+    }
+  }
+
+  GMSMutablePath *simplifiedPath = [GMSMutablePath path];
+  for (NSUInteger i = 0; i < count; i++) {
+    if (kept[i]) {
+      [simplifiedPath addCoordinate:[path coordinateAtIndex:i]];
+    }
+  }
+  free(points);
+  free(kept);
+  free(stack);
+  return simplifiedPath;
+}
@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Decodes the encoded tile image in @c data right away, rather than when it is first drawn,
+/// scaling it down to at most @c maxPixelSize pixels on either side.
+///
+/// A @c maxPixelSize of 0 keeps the size of the image. Returns nil if the data can't be decoded.
+extern UIImage *_Nullable FLTDecodeTileImage(NSData *data, NSUInteger maxPixelSize);
+
+/// A memory and disk cache of the tiles of one tile overlay, keyed by their coordinates and zoom
+/// level.
+///
+/// Both caches evict the least recently used tiles once they exceed their capacity. The disk cache
+/// lives in the app's caches directory, so tiles survive restarts of the app. All methods are
+/// thread safe.
+@interface FLTTileCache : NSObject
+
+/// Creates a cache for the tile overlay with the given identifier, storing tiles on disk under
+/// @c directoryURL.
+///
+/// A capacity of 0 disables the corresponding cache.
+- (instancetype)initWithTileOverlayIdentifier:(NSString *)identifier
+                               memoryCapacity:(NSUInteger)memoryCapacity
+                                 diskCapacity:(NSUInteger)diskCapacity
+                                 directoryURL:(NSURL *)directoryURL NS_DESIGNATED_INITIALIZER;
+
+/// Creates a cache for the tile overlay with the given identifier, storing tiles on disk in the
+/// app's caches directory.
+- (instancetype)initWithTileOverlayIdentifier:(NSString *)identifier
+                               memoryCapacity:(NSUInteger)memoryCapacity
+                                 diskCapacity:(NSUInteger)diskCapacity;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The maximum number of bytes of decoded tiles kept in memory.
+@property(nonatomic, readonly) NSUInteger memoryCapacity;
+
+/// The maximum number of bytes of tile data kept on disk.
+@property(nonatomic, readonly) NSUInteger diskCapacity;
+
+/// The maximum size, in pixels, that tiles read from disk are decoded at, or 0 for their full size.
+@property(atomic, assign) NSUInteger tilePixelSize;
+
+/// Returns the cached image of the given tile, or nil if it isn't cached.
+///
+/// This may read from disk, so it shouldn't be called on the main thread.
+- (nullable UIImage *)tileImageForX:(NSUInteger)x y:(NSUInteger)y zoom:(NSUInteger)zoom;
+
+/// Returns the cached image of the given tile if it is in memory, or nil otherwise.
+- (nullable UIImage *)memoryCachedTileImageForX:(NSUInteger)x y:(NSUInteger)y zoom:(NSUInteger)zoom;
+
+/// Caches the image of the given tile, along with the encoded data it was decoded from.
+- (void)setTileImage:(UIImage *)image
+                data:(NSData *)data
+                forX:(NSUInteger)x
+                   y:(NSUInteger)y
+                zoom:(NSUInteger)zoom;
+
+/// Removes all tiles from memory, keeping the ones on disk.
+- (void)removeAllMemoryCachedTiles;
+
+/// Removes all tiles from memory and from disk.
+- (void)removeAllTiles;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,273 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FLTTileCache.h"
+
+#import <ImageIO/ImageIO.h>
+
+UIImage *_Nullable FLTDecodeTileImage(NSData *data, NSUInteger maxPixelSize) {
+  CGImageSourceRef source = CGImageSourceCreateWithData((__bridge CFDataRef)data, NULL);
+  if (!source) {
+    return nil;
+  }
+  NSMutableDictionary *options = [@{
+    (id)kCGImageSourceCreateThumbnailFromImageAlways : @YES,
+    (id)kCGImageSourceCreateThumbnailWithTransform : @YES,
+    // Decode now, on the calling thread, instead of when the map first draws the tile.
+    (id)kCGImageSourceShouldCacheImmediately : @YES,
+  } mutableCopy];
+  if (maxPixelSize > 0) {
+    options[(id)kCGImageSourceThumbnailMaxPixelSize] = @(maxPixelSize);
+  }
+  CGImageRef cgImage =
+      CGImageSourceCreateThumbnailAtIndex(source, 0, (__bridge CFDictionaryRef)options);
+  CFRelease(source);
+  if (!cgImage) {
+    return nil;
+  }
+  UIImage *image = [UIImage imageWithCGImage:cgImage];
+  CGImageRelease(cgImage);
+  return image;
+}
+
+/// A tile image in the memory cache.
+@interface FLTTileCacheEntry : NSObject
+@property(strong, nonatomic) UIImage *image;
+// The number of bytes the decoded image takes up.
+@property(assign, nonatomic) NSUInteger cost;
+@end
+
+@implementation FLTTileCacheEntry
+@end
+
+@interface FLTTileCache ()
+@property(strong, nonatomic) NSURL *directoryURL;
+// The tiles in memory by key, and their keys from least to most recently used. Only accessed while
+// synchronized on self.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, FLTTileCacheEntry *> *memoryEntries;
+@property(strong, nonatomic) NSMutableOrderedSet<NSString *> *memoryKeys;
+@property(assign, nonatomic) NSUInteger memoryUsage;
+// The queue that all disk access happens on.
+@property(strong, nonatomic) dispatch_queue_t diskQueue;
+// The number of bytes of tiles on disk, or NSNotFound until it is first needed. Only accessed on
+// diskQueue.
+@property(assign, nonatomic) NSUInteger diskUsage;
+@end
+
+static NSString *FLTTileKey(NSUInteger x, NSUInteger y, NSUInteger zoom) {
+  return [NSString
+      stringWithFormat:@"%lu-%lu-%lu", (unsigned long)zoom, (unsigned long)x, (unsigned long)y];
+}
+
+@implementation FLTTileCache
+
+- (instancetype)initWithTileOverlayIdentifier:(NSString *)identifier
+                               memoryCapacity:(NSUInteger)memoryCapacity
+                                 diskCapacity:(NSUInteger)diskCapacity
+                                 directoryURL:(NSURL *)directoryURL {
+  self = [super init];
+  if (self) {
+    _memoryCapacity = memoryCapacity;
+    _diskCapacity = diskCapacity;
+    NSString *directoryName = [identifier
+        stringByAddingPercentEncodingWithAllowedCharacters:NSCharacterSet.alphanumericCharacterSet];
+    _directoryURL = [directoryURL URLByAppendingPathComponent:directoryName isDirectory:YES];
+    _memoryEntries = [[NSMutableDictionary alloc] init];
+    _memoryKeys = [[NSMutableOrderedSet alloc] init];
+    _diskQueue = dispatch_queue_create("io.flutter.plugins.google_maps.tile_cache",
+                                       DISPATCH_QUEUE_SERIAL);
+    _diskUsage = NSNotFound;
+  }
+  return self;
+}
+
+- (instancetype)initWithTileOverlayIdentifier:(NSString *)identifier
+                               memoryCapacity:(NSUInteger)memoryCapacity
+                                 diskCapacity:(NSUInteger)diskCapacity {
+  NSURL *cachesURL = [NSFileManager.defaultManager URLsForDirectory:NSCachesDirectory
+                                                          inDomains:NSUserDomainMask]
+                         .firstObject;
+  return [self initWithTileOverlayIdentifier:identifier
+                              memoryCapacity:memoryCapacity
+                                diskCapacity:diskCapacity
+                                directoryURL:[cachesURL URLByAppendingPathComponent:@"map_tiles"
+                                                                         isDirectory:YES]];
+}
+
+- (nullable UIImage *)memoryCachedTileImageForX:(NSUInteger)x
+                                              y:(NSUInteger)y
+                                           zoom:(NSUInteger)zoom {
+  NSString *key = FLTTileKey(x, y, zoom);
+  @synchronized(self) {
+    FLTTileCacheEntry *entry = self.memoryEntries[key];
+    if (!entry) {
+      return nil;
+    }
+    // Mark the tile as the most recently used one.
+    [self.memoryKeys removeObject:key];
+    [self.memoryKeys addObject:key];
+    return entry.image;
+  }
+}
+
+- (nullable UIImage *)tileImageForX:(NSUInteger)x y:(NSUInteger)y zoom:(NSUInteger)zoom {
+  UIImage *image = [self memoryCachedTileImageForX:x y:y zoom:zoom];
+  if (image || self.diskCapacity == 0) {
+    return image;
+  }
+
+  NSString *key = FLTTileKey(x, y, zoom);
+  NSURL *fileURL = [self.directoryURL URLByAppendingPathComponent:key isDirectory:NO];
+  __block NSData *data;
+  dispatch_sync(self.diskQueue, ^{
+    data = [NSData dataWithContentsOfURL:fileURL];
+    if (data) {
+      // Mark the tile as the most recently used one.
+      [fileURL setResourceValue:[NSDate date] forKey:NSURLContentModificationDateKey error:nil];
+    }
+  });
+  image = data ? FLTDecodeTileImage(data, self.tilePixelSize) : nil;
+  if (image) {
+    [self addMemoryCachedImage:image forKey:key];
+  }
+  return image;
+}
+
+- (void)setTileImage:(UIImage *)image
+                data:(NSData *)data
+                forX:(NSUInteger)x
+                   y:(NSUInteger)y
+                zoom:(NSUInteger)zoom {
+  NSString *key = FLTTileKey(x, y, zoom);
+  [self addMemoryCachedImage:image forKey:key];
+  if (data.length > self.diskCapacity) {
+    return;
+  }
+  dispatch_async(self.diskQueue, ^{
+    [self writeData:data forKey:key];
+  });
+}
+
+- (void)removeAllMemoryCachedTiles {
+  @synchronized(self) {
+    [self.memoryEntries removeAllObjects];
+    [self.memoryKeys removeAllObjects];
+    self.memoryUsage = 0;
+  }
+}
+
+- (void)removeAllTiles {
+  [self removeAllMemoryCachedTiles];
+  dispatch_async(self.diskQueue, ^{
+    [NSFileManager.defaultManager removeItemAtURL:self.directoryURL error:nil];
+    self.diskUsage = 0;
+  });
+}
+
+#pragma mark - Memory cache
+
+- (void)addMemoryCachedImage:(UIImage *)image forKey:(NSString *)key {
+  CGImageRef cgImage = image.CGImage;
+  NSUInteger cost = cgImage ? CGImageGetBytesPerRow(cgImage) * CGImageGetHeight(cgImage) : 0;
+  if (cost > self.memoryCapacity) {
+    return;
+  }
+  @synchronized(self) {
+    [self removeMemoryCachedImageForKey:key];
+    FLTTileCacheEntry *entry = [[FLTTileCacheEntry alloc] init];
+    entry.image = image;
+    entry.cost = cost;
+    self.memoryEntries[key] = entry;
+    [self.memoryKeys addObject:key];
+    self.memoryUsage += cost;
+    while (self.memoryUsage > self.memoryCapacity) {
+      [self removeMemoryCachedImageForKey:self.memoryKeys.firstObject];
+    }
+  }
+}
+
+// Must be called while synchronized on self.
+- (void)removeMemoryCachedImageForKey:(NSString *)key {
+  FLTTileCacheEntry *entry = self.memoryEntries[key];
+  if (!entry) {
+    return;
+  }
+  self.memoryUsage -= entry.cost;
+  [self.memoryEntries removeObjectForKey:key];
+  [self.memoryKeys removeObject:key];
+}
+
+#pragma mark - Disk cache
+
+// Must be called on diskQueue.
+- (void)writeData:(NSData *)data forKey:(NSString *)key {
+  NSFileManager *fileManager = NSFileManager.defaultManager;
+  [fileManager createDirectoryAtURL:self.directoryURL
+        withIntermediateDirectories:YES
+                         attributes:nil
+                              error:nil];
+  NSURL *fileURL = [self.directoryURL URLByAppendingPathComponent:key isDirectory:NO];
+  NSNumber *previousSize;
+  [fileURL getResourceValue:&previousSize forKey:NSURLFileSizeKey error:nil];
+  if (![data writeToURL:fileURL atomically:YES]) {
+    return;
+  }
+
+  if (self.diskUsage == NSNotFound) {
+    // Tiles written by earlier runs of the app count towards the capacity too.
+    NSUInteger diskUsage = 0;
+    for (NSURL *url in [self diskCachedFileURLs]) {
+      NSNumber *size;
+      [url getResourceValue:&size forKey:NSURLFileSizeKey error:nil];
+      diskUsage += size.unsignedIntegerValue;
+    }
+    self.diskUsage = diskUsage;
+  } else {
+    self.diskUsage = self.diskUsage - previousSize.unsignedIntegerValue + data.length;
+  }
+
+  if (self.diskUsage > self.diskCapacity) {
+    [self trimDiskCache];
+  }
+}
+
+// Removes the least recently used tiles from disk until a quarter of the capacity is free, so that
+// the directory isn't listed again on every write once the cache is full.
+//
+// Must be called on diskQueue.
+- (void)trimDiskCache {
+  NSArray<NSURL *> *fileURLs = [[self diskCachedFileURLs]
+      sortedArrayUsingComparator:^NSComparisonResult(NSURL *url1, NSURL *url2) {
+        NSDate *date1;
+        NSDate *date2;
+        [url1 getResourceValue:&date1 forKey:NSURLContentModificationDateKey error:nil];
+        [url2 getResourceValue:&date2 forKey:NSURLContentModificationDateKey error:nil];
+        return [date1 compare:date2];
+      }];
+  NSUInteger targetUsage = self.diskCapacity / 4 * 3;
+  for (NSURL *url in fileURLs) {
+    if (self.diskUsage <= targetUsage) {
+      break;
+    }
+    NSNumber *size;
+    [url getResourceValue:&size forKey:NSURLFileSizeKey error:nil];
+    if ([NSFileManager.defaultManager removeItemAtURL:url error:nil]) {
+      self.diskUsage -= MIN(size.unsignedIntegerValue, self.diskUsage);
+    }
+  }
+}
+
+// Returns the tile files on disk, with their sizes and modification dates prefetched.
+//
+// Must be called on diskQueue.
+- (NSArray<NSURL *> *)diskCachedFileURLs {
+  NSArray<NSURL *> *urls = [NSFileManager.defaultManager
+        contentsOfDirectoryAtURL:self.directoryURL
+      includingPropertiesForKeys:@[ NSURLFileSizeKey, NSURLContentModificationDateKey ]
+                         options:NSDirectoryEnumerationSkipsHiddenFiles
+                           error:nil];
+  return urls ?: @[];
+}
+
+@end
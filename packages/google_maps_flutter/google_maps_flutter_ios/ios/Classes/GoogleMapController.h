@@ -5,6 +5,8 @@
 #import <Flutter/Flutter.h>
 #import <GoogleMaps/GoogleMaps.h>
 #import "GoogleMapCircleController.h"
+#import "GoogleMapGeoJSONLayerController.h"
+#import "GoogleMapHeatmapController.h"
 #import "GoogleMapMarkerController.h"
 #import "GoogleMapPolygonController.h"
 #import "GoogleMapPolylineController.h"
@@ -27,6 +29,9 @@ NS_ASSUME_NONNULL_BEGIN
 // Allows the engine to create new Google Map instances.
 @interface FLTGoogleMapFactory : NSObject <FlutterPlatformViewFactory>
 - (instancetype)initWithRegistrar:(NSObject<FlutterPluginRegistrar> *)registrar;
+/// Initializes the shared map services ahead of the first map, and if @c prewarmMapView is YES,
+/// creates a map view with the given style for the next map that is created.
+- (void)warmUpWithMapStyle:(nullable NSString *)mapStyle prewarmMapView:(BOOL)prewarmMapView;
 @end
 
 NS_ASSUME_NONNULL_END
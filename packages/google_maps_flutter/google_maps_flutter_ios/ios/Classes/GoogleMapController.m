@@ -3,8 +3,10 @@
 // found in the LICENSE file.
 
 #import "GoogleMapController.h"
+#import "FLTEventCoalescer.h"
 #import "FLTGoogleMapJSONConversions.h"
 #import "FLTGoogleMapTileOverlayController.h"
+#import "FLTMapStyleCache.h"
 
 #pragma mark - Conversion of JSON-like values sent via platform channels. Forward declarations.
 
@@ -12,6 +14,22 @@
 
 @property(weak, nonatomic) NSObject<FlutterPluginRegistrar> *registrar;
 @property(strong, nonatomic, readonly) id<NSObject> sharedMapServices;
+// The map view created by warmUpWithMapStyle:prewarmMapView: for the next map, if any.
+@property(strong, nonatomic, nullable) GMSMapView *prewarmedMapView;
+// The JSON of the style the prewarmed map view has.
+@property(copy, nonatomic, nullable) NSString *prewarmedMapStyle;
+
+@end
+
+@interface FLTGoogleMapController ()
+
+// The JSON of the style the map view has, which setMapStyle: doesn't parse again.
+@property(nonatomic, copy, nullable) NSString *mapStyleJSON;
+
+- (instancetype)initWithMapView:(GMSMapView *)mapView
+                 viewIdentifier:(int64_t)viewId
+                      arguments:(id _Nullable)args
+                      registrar:(NSObject<FlutterPluginRegistrar> *)registrar;
 
 @end
 
@@ -38,12 +56,45 @@
   // Retain the shared map services singleton, don't use the result for anything.
   (void)[self sharedMapServices];
 
+  // A prewarmed map view can't be used for a cloud-based map, whose identifier is set when the map
+  // view is created.
+  GMSMapView *mapView = self.prewarmedMapView;
+  if (mapView && !args[@"options"][@"cloudMapId"]) {
+    self.prewarmedMapView = nil;
+    mapView.frame = frame;
+    mapView.camera =
+        [FLTGoogleMapJSONConversions cameraPostionFromDictionary:args[@"initialCameraPosition"]];
+    FLTGoogleMapController *controller =
+        [[FLTGoogleMapController alloc] initWithMapView:mapView
+                                         viewIdentifier:viewId
+                                              arguments:args
+                                              registrar:self.registrar];
+    controller.mapStyleJSON = self.prewarmedMapStyle;
+    return controller;
+  }
+
   return [[FLTGoogleMapController alloc] initWithFrame:frame
                                         viewIdentifier:viewId
                                              arguments:args
                                              registrar:self.registrar];
 }
 
+- (void)warmUpWithMapStyle:(nullable NSString *)mapStyle prewarmMapView:(BOOL)prewarmMapView {
+  (void)[self sharedMapServices];
+  if (!prewarmMapView) {
+    return;
+  }
+  GMSCameraPosition *camera = [GMSCameraPosition cameraWithLatitude:0 longitude:0 zoom:0];
+  GMSMapView *mapView = self.prewarmedMapView ?: [GMSMapView mapWithFrame:CGRectZero camera:camera];
+  // Parse the style now rather than when the map is shown, if it is valid.
+  GMSMapStyle *style =
+      mapStyle.length > 0 ? [FLTMapStyleCache.sharedCache styleWithJSONString:mapStyle error:nil]
+                          : nil;
+  mapView.mapStyle = style;
+  self.prewarmedMapStyle = style ? mapStyle : nil;
+  self.prewarmedMapView = mapView;
+}
+
 - (id<NSObject>)sharedMapServices {
   if (_sharedMapServices == nil) {
     // Calling this prepares GMSServices on a background thread controlled
@@ -61,12 +112,16 @@
 @property(nonatomic, strong) GMSMapView *mapView;
 @property(nonatomic, strong) FlutterMethodChannel *channel;
 @property(nonatomic, assign) BOOL trackCameraPosition;
+// Limits how often camera#onMove is sent while the camera moves.
+@property(nonatomic, strong) FLTEventCoalescer *cameraMoveCoalescer;
 @property(nonatomic, weak) NSObject<FlutterPluginRegistrar> *registrar;
 @property(nonatomic, strong) FLTMarkersController *markersController;
 @property(nonatomic, strong) FLTPolygonsController *polygonsController;
 @property(nonatomic, strong) FLTPolylinesController *polylinesController;
 @property(nonatomic, strong) FLTCirclesController *circlesController;
 @property(nonatomic, strong) FLTTileOverlaysController *tileOverlaysController;
+@property(nonatomic, strong) FLTHeatmapsController *heatmapsController;
+@property(nonatomic, strong) FLTGeoJSONLayersController *geoJSONLayersController;
 
 @end
 
@@ -120,6 +175,14 @@
       }
     }];
     _mapView.delegate = weakSelf;
+    _cameraMoveCoalescer =
+        [[FLTEventCoalescer alloc] initWithHandler:^(GMSCameraPosition *position) {
+          [weakSelf.channel
+              invokeMethod:@"camera#onMove"
+                 arguments:@{
+                   @"position" : [FLTGoogleMapJSONConversions dictionaryFromPosition:position]
+                 }];
+        }];
     _mapView.paddingAdjustmentBehavior = kGMSMapViewPaddingAdjustmentBehaviorNever;
     _registrar = registrar;
     _markersController = [[FLTMarkersController alloc] initWithMethodChannel:_channel
@@ -137,6 +200,11 @@
     _tileOverlaysController = [[FLTTileOverlaysController alloc] init:_channel
                                                               mapView:_mapView
                                                             registrar:registrar];
+    _heatmapsController = [[FLTHeatmapsController alloc] init:_channel
+                                                      mapView:_mapView
+                                                    registrar:registrar];
+    _geoJSONLayersController = [[FLTGeoJSONLayersController alloc] initWithMapView:_mapView
+                                                                         registrar:registrar];
     id markersToAdd = args[@"markersToAdd"];
     if ([markersToAdd isKindOfClass:[NSArray class]]) {
       [_markersController addMarkers:markersToAdd];
@@ -205,6 +273,15 @@
     [self moveWithCameraUpdate:[FLTGoogleMapJSONConversions
                                    cameraUpdateFromChannelValue:call.arguments[@"cameraUpdate"]]];
     result(nil);
+  } else if ([call.method isEqualToString:@"camera#setMoveEventOptions"]) {
+    NSNumber *maxFrequency = call.arguments[@"maxFrequency"];
+    self.cameraMoveCoalescer.minimumInterval =
+        [maxFrequency isKindOfClass:[NSNumber class]] && maxFrequency.doubleValue > 0
+            ? 1 / maxFrequency.doubleValue
+            : 0;
+    self.cameraMoveCoalescer.synchronizesWithDisplay =
+        [call.arguments[@"synchronizeWithDisplay"] boolValue];
+    result(nil);
   } else if ([call.method isEqualToString:@"map#update"]) {
     [self interpretMapOptions:call.arguments[@"options"]];
     result([FLTGoogleMapJSONConversions dictionaryFromPosition:[self cameraPosition]]);
@@ -271,6 +348,29 @@
       [self.markersController removeMarkersWithIdentifiers:markerIdsToRemove];
     }
     result(nil);
+  } else if ([call.method isEqualToString:@"markers#updatePositions"]) {
+    id markerIds = call.arguments[@"markerIds"];
+    id positions = call.arguments[@"positions"];
+    if ([markerIds isKindOfClass:[NSArray class]] &&
+        [positions isKindOfClass:[FlutterStandardTypedData class]] &&
+        ((FlutterStandardTypedData *)positions).type == FlutterStandardDataTypeFloat64) {
+      [self.markersController updateMarkerPositions:markerIds positions:positions];
+      result(nil);
+    } else {
+      result([FlutterError errorWithCode:@"Invalid positions"
+                                 message:@"updatePositions called with invalid positions"
+                                 details:nil]);
+    }
+  } else if ([call.method isEqualToString:@"markers#updateClustering"]) {
+    id clustering = call.arguments[@"clustering"];
+    [self.markersController
+        setClusteringOptions:[clustering isKindOfClass:[NSDictionary class]] ? clustering : nil];
+    result(nil);
+  } else if ([call.method isEqualToString:@"markers#updateViewportCulling"]) {
+    id culling = call.arguments[@"culling"];
+    [self.markersController
+        setViewportCullingOptions:[culling isKindOfClass:[NSDictionary class]] ? culling : nil];
+    result(nil);
   } else if ([call.method isEqualToString:@"markers#showInfoWindow"]) {
     id markerId = call.arguments[@"markerId"];
     if ([markerId isKindOfClass:[NSString class]]) {
@@ -354,6 +454,39 @@
       [self.tileOverlaysController removeTileOverlayWithIdentifiers:tileOverlayIdsToRemove];
     }
     result(nil);
+  } else if ([call.method isEqualToString:@"heatmaps#update"]) {
+    id heatmapsToAdd = call.arguments[@"heatmapsToAdd"];
+    if ([heatmapsToAdd isKindOfClass:[NSArray class]]) {
+      [self.heatmapsController addHeatmaps:heatmapsToAdd];
+    }
+    id heatmapsToChange = call.arguments[@"heatmapsToChange"];
+    if ([heatmapsToChange isKindOfClass:[NSArray class]]) {
+      [self.heatmapsController changeHeatmaps:heatmapsToChange];
+    }
+    id heatmapIdsToRemove = call.arguments[@"heatmapIdsToRemove"];
+    if ([heatmapIdsToRemove isKindOfClass:[NSArray class]]) {
+      [self.heatmapsController removeHeatmapWithIdentifiers:heatmapIdsToRemove];
+    }
+    result(nil);
+  } else if ([call.method isEqualToString:@"geoJsonLayers#add"]) {
+    [self.geoJSONLayersController
+        addLayerWithOptions:call.arguments
+                 completion:^(NSError *_Nullable error) {
+                   if (error) {
+                     result([FlutterError errorWithCode:@"Invalid GeoJSON"
+                                                message:error.localizedDescription
+                                                details:nil]);
+                   } else {
+                     result(nil);
+                   }
+                 }];
+  } else if ([call.method isEqualToString:@"geoJsonLayers#setStyle"]) {
+    [self.geoJSONLayersController setStyle:call.arguments[@"style"]
+                     ofLayerWithIdentifier:call.arguments[@"layerId"]];
+    result(nil);
+  } else if ([call.method isEqualToString:@"geoJsonLayers#remove"]) {
+    [self.geoJSONLayersController removeLayerWithIdentifier:call.arguments];
+    result(nil);
   } else if ([call.method isEqualToString:@"tileOverlays#clearTileCache"]) {
     id rawTileOverlayId = call.arguments[@"tileOverlayId"];
     [self.tileOverlaysController clearTileCacheWithIdentifier:rawTileOverlayId];
@@ -401,6 +534,13 @@
     } else {
       result(@[ @(NO), error ]);
     }
+  } else if ([call.method isEqualToString:@"map#setStyleNamed"]) {
+    NSString *error = [self setMapStyleNamed:call.arguments];
+    if (error == nil) {
+      result(@[ @(YES) ]);
+    } else {
+      result(@[ @(NO), error ]);
+    }
   } else if ([call.method isEqualToString:@"map#getTileOverlayInfo"]) {
     NSString *rawTileOverlayId = call.arguments[@"tileOverlayId"];
     result([self.tileOverlaysController tileOverlayInfoWithIdentifier:rawTileOverlayId]);
@@ -502,18 +642,39 @@
 - (NSString *)setMapStyle:(NSString *)mapStyle {
   if (mapStyle == (id)[NSNull null] || mapStyle.length == 0) {
     self.mapView.mapStyle = nil;
+    self.mapStyleJSON = nil;
+    return nil;
+  }
+  if ([mapStyle isEqualToString:self.mapStyleJSON]) {
+    // The map view already has this style, for example from prewarming.
     return nil;
   }
   NSError *error;
-  GMSMapStyle *style = [GMSMapStyle styleWithJSONString:mapStyle error:&error];
+  // Styles are parsed once for all maps, as apps often give several maps the same style.
+  GMSMapStyle *style = [FLTMapStyleCache.sharedCache styleWithJSONString:mapStyle error:&error];
   if (!style) {
     return [error localizedDescription];
   } else {
     self.mapView.mapStyle = style;
+    self.mapStyleJSON = mapStyle;
     return nil;
   }
 }
 
+- (NSString *)setMapStyleNamed:(NSString *)name {
+  GMSMapStyle *style = [name isKindOfClass:[NSString class]]
+                           ? [FLTMapStyleCache.sharedCache styleNamed:name]
+                           : nil;
+  if (!style) {
+    return [NSString stringWithFormat:@"No map style is registered as %@", name];
+  }
+  if (self.mapView.mapStyle != style) {
+    self.mapView.mapStyle = style;
+  }
+  self.mapStyleJSON = nil;
+  return nil;
+}
+
 #pragma mark - GMSMapViewDelegate methods
 
 - (void)mapView:(GMSMapView *)mapView willMove:(BOOL)gesture {
@@ -522,18 +683,24 @@
 
 - (void)mapView:(GMSMapView *)mapView didChangeCameraPosition:(GMSCameraPosition *)position {
   if (self.trackCameraPosition) {
-    [self.channel invokeMethod:@"camera#onMove"
-                     arguments:@{
-                       @"position" : [FLTGoogleMapJSONConversions dictionaryFromPosition:position]
-                     }];
+    [self.cameraMoveCoalescer addValue:position];
   }
 }
 
 - (void)mapView:(GMSMapView *)mapView idleAtCameraPosition:(GMSCameraPosition *)position {
+  // Send the final position before the camera is reported idle.
+  [self.cameraMoveCoalescer flush];
+  [self.markersController updateViewportCulling];
+  [self.markersController updateClusters];
+  [self.polylinesController updatePathsForZoom:position.zoom];
   [self.channel invokeMethod:@"camera#onIdle" arguments:@{}];
 }
 
 - (BOOL)mapView:(GMSMapView *)mapView didTapMarker:(GMSMarker *)marker {
+  if ([marker.userData isKindOfClass:[FLTMarkerCluster class]]) {
+    [self.markersController didTapCluster:marker.userData];
+    return YES;
+  }
   NSString *markerId = marker.userData[0];
   return [self.markersController didTapMarkerWithIdentifier:markerId];
 }
@@ -0,0 +1,32 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Flutter/Flutter.h>
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Manages the GeoJSON layers of a map.
+///
+/// The documents of the layers are read and parsed natively on a background queue, and each of
+/// their features is drawn with the default style of its layer, overridden by the style of every
+/// rule whose property the feature has with the rule's value.
+@interface FLTGeoJSONLayersController : NSObject
+- (instancetype)initWithMapView:(GMSMapView *)mapView
+                      registrar:(NSObject<FlutterPluginRegistrar> *)registrar;
+/// Reads and parses the document of the layer described by @c options in the background, and
+/// then replaces the layer with the same identifier, if any, with its features.
+///
+/// @c completion is called on the main thread, with the error that kept the document from being
+/// read or parsed, if any, in which case the layers are left as they were.
+- (void)addLayerWithOptions:(NSDictionary *)options
+                 completion:(void (^)(NSError *_Nullable error))completion;
+/// Applies the given style and rules to the features of the layer with the given identifier,
+/// without parsing its document again.
+- (void)setStyle:(NSDictionary *)style ofLayerWithIdentifier:(NSString *)identifier;
+- (void)removeLayerWithIdentifier:(NSString *)identifier;
+- (BOOL)hasLayerWithIdentifier:(NSString *)identifier;
+@end
+
+NS_ASSUME_NONNULL_END
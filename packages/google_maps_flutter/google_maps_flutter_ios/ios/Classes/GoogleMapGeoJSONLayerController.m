@@ -0,0 +1,229 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "GoogleMapGeoJSONLayerController.h"
+#import "FLTGeoJSONParser.h"
+#import "FLTGoogleMapJSONConversions.h"
+
+// Returns the style of the feature in a layer with the given style: the default style of the
+// layer, overridden in turn by the style of each rule that matches the properties of the feature.
+static NSDictionary *FLTGeoJSONFeatureStyle(FLTGeoJSONFeature *feature, NSDictionary *layerStyle) {
+  NSMutableDictionary *style = [[NSMutableDictionary alloc] init];
+  NSDictionary *defaultStyle = layerStyle[@"style"];
+  if ([defaultStyle isKindOfClass:[NSDictionary class]]) {
+    [style addEntriesFromDictionary:defaultStyle];
+  }
+  NSArray *rules = layerStyle[@"rules"];
+  if (![rules isKindOfClass:[NSArray class]]) {
+    return style;
+  }
+  for (NSDictionary *rule in rules) {
+    NSString *property = rule[@"property"];
+    NSDictionary *ruleStyle = rule[@"style"];
+    if (![property isKindOfClass:[NSString class]] ||
+        ![ruleStyle isKindOfClass:[NSDictionary class]]) {
+      continue;
+    }
+    // Numbers match whatever their type, so a JSON 1 matches a Dart 1.0.
+    id value = feature.properties[property];
+    if (value && [value isEqual:rule[@"value"]]) {
+      [style addEntriesFromDictionary:ruleStyle];
+    }
+  }
+  return style;
+}
+
+// Applies the given feature style to an overlay of the feature.
+static void FLTApplyGeoJSONStyle(NSDictionary *style, GMSOverlay *overlay, GMSMapView *mapView) {
+  NSNumber *fillColor = style[@"fillColor"];
+  NSNumber *strokeColor = style[@"strokeColor"];
+  NSNumber *strokeWidth = style[@"strokeWidth"];
+  NSNumber *geodesic = style[@"geodesic"];
+  if ([overlay isKindOfClass:[GMSPolygon class]]) {
+    GMSPolygon *polygon = (GMSPolygon *)overlay;
+    if ([fillColor isKindOfClass:[NSNumber class]]) {
+      polygon.fillColor = [FLTGoogleMapJSONConversions colorFromRGBA:fillColor];
+    }
+    if ([strokeColor isKindOfClass:[NSNumber class]]) {
+      polygon.strokeColor = [FLTGoogleMapJSONConversions colorFromRGBA:strokeColor];
+    }
+    if ([strokeWidth isKindOfClass:[NSNumber class]]) {
+      polygon.strokeWidth = strokeWidth.doubleValue;
+    }
+    if ([geodesic isKindOfClass:[NSNumber class]]) {
+      polygon.geodesic = geodesic.boolValue;
+    }
+  } else if ([overlay isKindOfClass:[GMSPolyline class]]) {
+    GMSPolyline *polyline = (GMSPolyline *)overlay;
+    if ([strokeColor isKindOfClass:[NSNumber class]]) {
+      polyline.strokeColor = [FLTGoogleMapJSONConversions colorFromRGBA:strokeColor];
+    }
+    if ([strokeWidth isKindOfClass:[NSNumber class]]) {
+      polyline.strokeWidth = strokeWidth.doubleValue;
+    }
+    if ([geodesic isKindOfClass:[NSNumber class]]) {
+      polyline.geodesic = geodesic.boolValue;
+    }
+  }
+  NSNumber *zIndex = style[@"zIndex"];
+  if ([zIndex isKindOfClass:[NSNumber class]]) {
+    overlay.zIndex = zIndex.intValue;
+  }
+  NSNumber *visible = style[@"visible"];
+  BOOL isVisible = [visible isKindOfClass:[NSNumber class]] ? visible.boolValue : YES;
+  overlay.map = isVisible ? mapView : nil;
+}
+
+// The style of a GeoJSON layer, its features, and the overlays drawn for each of them, which are
+// nil while its document is being parsed.
+@interface FLTGeoJSONLayer : NSObject
+@property(copy, nonatomic) NSDictionary *style;
+@property(copy, nonatomic, nullable) NSArray<FLTGeoJSONFeature *> *features;
+@property(copy, nonatomic, nullable) NSArray<NSArray<GMSOverlay *> *> *featureOverlays;
+@end
+
+@implementation FLTGeoJSONLayer
+@end
+
+@interface FLTGeoJSONLayersController ()
+
+@property(weak, nonatomic) GMSMapView *mapView;
+@property(weak, nonatomic) NSObject<FlutterPluginRegistrar> *registrar;
+@property(strong, nonatomic) NSMutableDictionary<NSString *, FLTGeoJSONLayer *> *layers;
+// The last layer added with each identifier whose document is being parsed, so that only the last
+// one added replaces the layer, and none does once the layer is removed.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, FLTGeoJSONLayer *> *pendingLayers;
+// The serial queue that reads and parses documents.
+@property(strong, nonatomic) dispatch_queue_t parseQueue;
+
+@end
+
+@implementation FLTGeoJSONLayersController
+
+- (instancetype)initWithMapView:(GMSMapView *)mapView
+                      registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
+  self = [super init];
+  if (self) {
+    _mapView = mapView;
+    _registrar = registrar;
+    _layers = [[NSMutableDictionary alloc] init];
+    _pendingLayers = [[NSMutableDictionary alloc] init];
+    _parseQueue = dispatch_queue_create(
+        "io.flutter.plugins.google_maps.geojson",
+        dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED,
+                                                0));
+  }
+  return self;
+}
+
+- (void)addLayerWithOptions:(NSDictionary *)options
+                 completion:(void (^)(NSError *_Nullable error))completion {
+  NSString *identifier = options[@"layerId"];
+  FlutterStandardTypedData *data = options[@"data"];
+  NSString *path = options[@"path"];
+  NSString *asset = options[@"asset"];
+  // Assets are looked up with the registrar on the main thread, and read with the other files.
+  if ([asset isKindOfClass:[NSString class]]) {
+    NSString *assetKey = [self.registrar lookupKeyForAsset:asset];
+    path = [[NSBundle mainBundle] pathForResource:assetKey ofType:nil] ?: assetKey;
+  }
+  NSDictionary *layerStyle = options[@"style"];
+  if (![layerStyle isKindOfClass:[NSDictionary class]]) {
+    layerStyle = @{};
+  }
+  FLTGeoJSONLayer *layer = [[FLTGeoJSONLayer alloc] init];
+  layer.style = layerStyle;
+  self.pendingLayers[identifier] = layer;
+  __weak FLTGeoJSONLayersController *weakSelf = self;
+  dispatch_async(self.parseQueue, ^{
+    NSError *error;
+    NSArray<FLTGeoJSONFeature *> *features;
+    NSData *document = [data isKindOfClass:[FlutterStandardTypedData class]]
+                           ? data.data
+                           : [NSData dataWithContentsOfFile:path
+                                                    options:NSDataReadingMappedIfSafe
+                                                      error:&error];
+    if (document) {
+      features = [FLTGeoJSONParser featuresFromData:document error:&error];
+    }
+    dispatch_async(dispatch_get_main_queue(), ^{
+      FLTGeoJSONLayersController *strongSelf = weakSelf;
+      if (strongSelf && strongSelf.pendingLayers[identifier] == layer) {
+        [strongSelf.pendingLayers removeObjectForKey:identifier];
+        if (features) {
+          [strongSelf removeLayerWithIdentifier:identifier];
+          [strongSelf showFeatures:features inLayer:layer];
+          strongSelf.layers[identifier] = layer;
+        }
+      }
+      completion(features ? nil : error);
+    });
+  });
+}
+
+// Draws the features on the map with the style of the layer.
+- (void)showFeatures:(NSArray<FLTGeoJSONFeature *> *)features inLayer:(FLTGeoJSONLayer *)layer {
+  NSMutableArray<NSArray<GMSOverlay *> *> *featureOverlays =
+      [[NSMutableArray alloc] initWithCapacity:features.count];
+  for (FLTGeoJSONFeature *feature in features) {
+    NSMutableArray<GMSOverlay *> *overlays = [[NSMutableArray alloc] init];
+    for (NSArray<GMSPath *> *rings in feature.polygons) {
+      GMSPolygon *polygon = [GMSPolygon polygonWithPath:rings.firstObject];
+      if (rings.count > 1) {
+        polygon.holes = [rings subarrayWithRange:NSMakeRange(1, rings.count - 1)];
+      }
+      [overlays addObject:polygon];
+    }
+    for (GMSPath *path in feature.lineStrings) {
+      [overlays addObject:[GMSPolyline polylineWithPath:path]];
+    }
+    for (CLLocation *point in feature.points) {
+      [overlays addObject:[GMSMarker markerWithPosition:point.coordinate]];
+    }
+    NSDictionary *style = FLTGeoJSONFeatureStyle(feature, layer.style);
+    for (GMSOverlay *overlay in overlays) {
+      FLTApplyGeoJSONStyle(style, overlay, self.mapView);
+    }
+    [featureOverlays addObject:overlays];
+  }
+  layer.features = features;
+  layer.featureOverlays = featureOverlays;
+}
+
+- (void)setStyle:(NSDictionary *)layerStyle ofLayerWithIdentifier:(NSString *)identifier {
+  if (![layerStyle isKindOfClass:[NSDictionary class]]) {
+    return;
+  }
+  // A layer whose document is still being parsed gets the style once it is shown.
+  self.pendingLayers[identifier].style = layerStyle;
+  FLTGeoJSONLayer *layer = self.layers[identifier];
+  if (!layer) {
+    return;
+  }
+  layer.style = layerStyle;
+  [layer.features enumerateObjectsUsingBlock:^(FLTGeoJSONFeature *feature, NSUInteger index,
+                                               BOOL *stop) {
+    NSDictionary *style = FLTGeoJSONFeatureStyle(feature, layerStyle);
+    for (GMSOverlay *overlay in layer.featureOverlays[index]) {
+      FLTApplyGeoJSONStyle(style, overlay, self.mapView);
+    }
+  }];
+}
+
+- (void)removeLayerWithIdentifier:(NSString *)identifier {
+  [self.pendingLayers removeObjectForKey:identifier];
+  FLTGeoJSONLayer *layer = self.layers[identifier];
+  for (NSArray<GMSOverlay *> *overlays in layer.featureOverlays) {
+    for (GMSOverlay *overlay in overlays) {
+      overlay.map = nil;
+    }
+  }
+  [self.layers removeObjectForKey:identifier];
+}
+
+- (BOOL)hasLayerWithIdentifier:(NSString *)identifier {
+  return self.layers[identifier] != nil;
+}
+
+@end
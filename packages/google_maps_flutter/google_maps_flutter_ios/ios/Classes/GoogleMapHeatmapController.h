@@ -0,0 +1,27 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Flutter/Flutter.h>
+#import <GoogleMaps/GoogleMaps.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Defines heatmap controllable by Flutter.
+@interface FLTGoogleMapHeatmapController : NSObject
+- (instancetype)initWithMapView:(GMSMapView *)mapView options:(NSDictionary *)options;
+- (void)removeHeatmap;
+- (void)interpretHeatmapOptions:(NSDictionary *)data;
+@end
+
+@interface FLTHeatmapsController : NSObject
+- (instancetype)init:(FlutterMethodChannel *)methodChannel
+             mapView:(GMSMapView *)mapView
+           registrar:(NSObject<FlutterPluginRegistrar> *)registrar;
+- (void)addHeatmaps:(NSArray *)heatmapsToAdd;
+- (void)changeHeatmaps:(NSArray *)heatmapsToChange;
+- (void)removeHeatmapWithIdentifiers:(NSArray *)identifiers;
+- (bool)hasHeatmapWithIdentifier:(NSString *)identifier;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,191 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "GoogleMapHeatmapController.h"
+#import "FLTHeatmapRenderer.h"
+
+// The options that change the rendered tiles, rather than how the layer shows them.
+static NSArray<NSString *> *FLTHeatmapRendererOptionKeys(void) {
+  return @[ @"data", @"radius", @"gradient", @"maxIntensity" ];
+}
+
+// A tile layer that renders the tiles of a heatmap on the background thread the map requests them
+// on.
+@interface FLTHeatmapTileLayer : GMSSyncTileLayer
+@property(strong, atomic, nullable) FLTHeatmapRenderer *renderer;
+@end
+
+@implementation FLTHeatmapTileLayer
+
+- (UIImage *)tileForX:(NSUInteger)x y:(NSUInteger)y zoom:(NSUInteger)zoom {
+  return [self.renderer tileForX:x y:y zoom:zoom] ?: kGMSTileLayerNoTile;
+}
+
+@end
+
+@interface FLTGoogleMapHeatmapController ()
+
+@property(nonatomic, strong) FLTHeatmapTileLayer *tileLayer;
+@property(nonatomic, weak) GMSMapView *mapView;
+// The options the current renderer was created with.
+@property(nonatomic, copy) NSDictionary *rendererOptions;
+
+@end
+
+@implementation FLTGoogleMapHeatmapController
+
+- (instancetype)initWithMapView:(GMSMapView *)mapView options:(NSDictionary *)options {
+  self = [super init];
+  if (self) {
+    _tileLayer = [[FLTHeatmapTileLayer alloc] init];
+    // Render at no more than twice the resolution of the tiles, since the blur hides the
+    // difference and the cost of rendering grows with the square of the size.
+    _tileLayer.tileSize = 256 * MIN(MAX(UIScreen.mainScreen.scale, 1), 2);
+    _mapView = mapView;
+    _rendererOptions = @{};
+    [self interpretHeatmapOptions:options];
+  }
+  return self;
+}
+
+- (void)removeHeatmap {
+  self.tileLayer.map = nil;
+}
+
+- (void)setVisible:(BOOL)visible {
+  self.tileLayer.map = visible ? self.mapView : nil;
+}
+- (void)setZIndex:(int)zIndex {
+  self.tileLayer.zIndex = zIndex;
+}
+- (void)setOpacity:(float)opacity {
+  self.tileLayer.opacity = opacity;
+}
+
+- (void)interpretHeatmapOptions:(NSDictionary *)data {
+  NSMutableDictionary *rendererOptions = [self.rendererOptions mutableCopy];
+  for (NSString *key in FLTHeatmapRendererOptionKeys()) {
+    if (data[key]) {
+      rendererOptions[key] = data[key];
+    }
+  }
+  // Only a new renderer is created, and tiles are rendered again, when the points or how they are
+  // drawn change.
+  if (![rendererOptions isEqualToDictionary:self.rendererOptions]) {
+    self.rendererOptions = rendererOptions;
+    self.tileLayer.renderer = [self rendererWithOptions:rendererOptions];
+    [self.tileLayer clearTileCache];
+  }
+
+  NSNumber *visible = data[@"visible"];
+  if (visible && visible != (id)[NSNull null]) {
+    [self setVisible:[visible boolValue]];
+  }
+
+  NSNumber *zIndex = data[@"zIndex"];
+  if (zIndex && zIndex != (id)[NSNull null]) {
+    [self setZIndex:[zIndex intValue]];
+  }
+
+  NSNumber *opacity = data[@"opacity"];
+  if (opacity && opacity != (id)[NSNull null]) {
+    [self setOpacity:[opacity floatValue]];
+  }
+}
+
+- (FLTHeatmapRenderer *)rendererWithOptions:(NSDictionary *)options {
+  NSData *data = [NSData data];
+  FlutterStandardTypedData *typedData = options[@"data"];
+  if ([typedData isKindOfClass:[FlutterStandardTypedData class]] &&
+      typedData.type == FlutterStandardDataTypeFloat64) {
+    data = typedData.data;
+  }
+  NSUInteger tileSize = self.tileLayer.tileSize;
+  // The radius is given in points, and the tiles are rendered in pixels.
+  NSNumber *radius = options[@"radius"];
+  double radiusInPoints = [radius isKindOfClass:[NSNumber class]] ? radius.doubleValue : 20;
+  NSDictionary *gradient = options[@"gradient"];
+  if (![gradient isKindOfClass:[NSDictionary class]]) {
+    gradient = @{};
+  }
+  NSNumber *colorMapSize = gradient[@"colorMapSize"];
+  NSNumber *maxIntensity = options[@"maxIntensity"];
+  return [[FLTHeatmapRenderer alloc]
+      initWithData:data
+            radius:lround(radiusInPoints * tileSize / 256)
+            colors:gradient[@"colors"] ?: @[]
+       startPoints:gradient[@"startPoints"] ?: @[]
+      colorMapSize:[colorMapSize isKindOfClass:[NSNumber class]] ? colorMapSize.unsignedIntegerValue
+                                                                  : 256
+      maxIntensity:[maxIntensity isKindOfClass:[NSNumber class]] ? maxIntensity.doubleValue : 0
+          tileSize:tileSize];
+}
+
+@end
+
+@interface FLTHeatmapsController ()
+
+@property(strong, nonatomic) FlutterMethodChannel *methodChannel;
+@property(weak, nonatomic) GMSMapView *mapView;
+@property(strong, nonatomic) NSMutableDictionary *heatmapIdToController;
+
+@end
+
+@implementation FLTHeatmapsController
+
+- (instancetype)init:(FlutterMethodChannel *)methodChannel
+             mapView:(GMSMapView *)mapView
+           registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
+  self = [super init];
+  if (self) {
+    _methodChannel = methodChannel;
+    _mapView = mapView;
+    _heatmapIdToController = [NSMutableDictionary dictionaryWithCapacity:1];
+  }
+  return self;
+}
+
+- (void)addHeatmaps:(NSArray *)heatmapsToAdd {
+  for (NSDictionary *heatmap in heatmapsToAdd) {
+    NSString *heatmapId = [FLTHeatmapsController getHeatmapId:heatmap];
+    FLTGoogleMapHeatmapController *controller =
+        [[FLTGoogleMapHeatmapController alloc] initWithMapView:self.mapView options:heatmap];
+    self.heatmapIdToController[heatmapId] = controller;
+  }
+}
+
+- (void)changeHeatmaps:(NSArray *)heatmapsToChange {
+  for (NSDictionary *heatmap in heatmapsToChange) {
+    NSString *heatmapId = [FLTHeatmapsController getHeatmapId:heatmap];
+    FLTGoogleMapHeatmapController *controller = self.heatmapIdToController[heatmapId];
+    if (!controller) {
+      continue;
+    }
+    [controller interpretHeatmapOptions:heatmap];
+  }
+}
+
+- (void)removeHeatmapWithIdentifiers:(NSArray *)identifiers {
+  for (NSString *identifier in identifiers) {
+    FLTGoogleMapHeatmapController *controller = self.heatmapIdToController[identifier];
+    if (!controller) {
+      continue;
+    }
+    [controller removeHeatmap];
+    [self.heatmapIdToController removeObjectForKey:identifier];
+  }
+}
+
+- (bool)hasHeatmapWithIdentifier:(NSString *)identifier {
+  if (!identifier) {
+    return false;
+  }
+  return self.heatmapIdToController[identifier] != nil;
+}
+
++ (NSString *)getHeatmapId:(NSDictionary *)heatmap {
+  return heatmap[@"heatmapId"];
+}
+
+@end
@@ -4,6 +4,7 @@
 
 #import <Flutter/Flutter.h>
 #import <GoogleMaps/GoogleMaps.h>
+#import "FLTMarkerClusterer.h"
 #import "GoogleMapController.h"
 
 NS_ASSUME_NONNULL_BEGIN
@@ -11,6 +12,10 @@ NS_ASSUME_NONNULL_BEGIN
 // Defines marker controllable by Flutter.
 @interface FLTGoogleMapMarkerController : NSObject
 @property(assign, nonatomic, readonly) BOOL consumeTapEvents;
+@property(assign, nonatomic, readonly) BOOL visible;
+@property(assign, nonatomic, readonly) CLLocationCoordinate2D position;
+/// Whether the marker is drawn as part of a cluster rather than on its own.
+@property(assign, nonatomic) BOOL clustered;
 - (instancetype)initMarkerWithPosition:(CLLocationCoordinate2D)position
                             identifier:(NSString *)identifier
                                mapView:(GMSMapView *)mapView;
@@ -26,7 +31,24 @@ NS_ASSUME_NONNULL_BEGIN
                             registrar:(NSObject<FlutterPluginRegistrar> *)registrar;
 - (void)addMarkers:(NSArray *)markersToAdd;
 - (void)changeMarkers:(NSArray *)markersToChange;
+/// Moves the markers with the given identifiers to the positions in @c positions, which holds the
+/// latitude and longitude of each marker in turn as packed doubles.
+- (void)updateMarkerPositions:(NSArray<NSString *> *)identifiers
+                    positions:(FlutterStandardTypedData *)positions;
 - (void)removeMarkersWithIdentifiers:(NSArray *)identifiers;
+/// Sets the options for clustering markers, or stops clustering them if @c options is nil.
+- (void)setClusteringOptions:(nullable NSDictionary *)options;
+/// Recomputes the clusters of markers if the zoom level changed since they were last computed.
+- (void)updateClusters;
+/// Sets the options for culling markers outside the visible region, or stops culling them if
+/// @c options is nil.
+///
+/// Culled markers are kept as their options only, and get a GMSMarker, reused from markers that
+/// were culled, when they are in the visible region or its margin.
+- (void)setViewportCullingOptions:(nullable NSDictionary *)options;
+/// Culls the markers outside the current visible region and its margin, if markers are culled.
+- (void)updateViewportCulling;
+- (void)didTapCluster:(FLTMarkerCluster *)cluster;
 - (BOOL)didTapMarkerWithIdentifier:(NSString *)identifier;
 - (void)didStartDraggingMarkerWithIdentifier:(NSString *)identifier
                                     location:(CLLocationCoordinate2D)coordinate;
@@ -4,45 +4,226 @@
 
 #import "GoogleMapMarkerController.h"
 #import "FLTGoogleMapJSONConversions.h"
+#import "GoogleMapMarkerController_Test.h"
+
+// The maximum number of distinct icon images kept by a markers controller.
+static const NSUInteger kFLTMarkerIconCacheCountLimit = 100;
+
+// The maximum number of culled GMSMarkers kept for reuse by a markers controller.
+static const NSUInteger kFLTReusableMarkerCountLimit = 100;
+
+// A region of the map that markers are shown in while they are culled, which crosses the
+// antimeridian when west is greater than east.
+typedef struct {
+  CLLocationDegrees south;
+  CLLocationDegrees north;
+  CLLocationDegrees west;
+  CLLocationDegrees east;
+} FLTMarkerCullingRegion;
+
+static BOOL FLTMarkerCullingRegionContains(FLTMarkerCullingRegion region,
+                                           CLLocationCoordinate2D position) {
+  if (position.latitude < region.south || position.latitude > region.north) {
+    return NO;
+  }
+  if (region.west <= region.east) {
+    return position.longitude >= region.west && position.longitude <= region.east;
+  }
+  return position.longitude >= region.west || position.longitude <= region.east;
+}
+
+// Returns the longitude normalized to [-180, 180).
+static CLLocationDegrees FLTNormalizeLongitude(CLLocationDegrees longitude) {
+  CLLocationDegrees normalized = fmod(longitude + 180, 360);
+  return (normalized < 0 ? normalized + 360 : normalized) - 180;
+}
+
+// Restores the properties of a culled marker that options can set to their defaults, so that it can
+// be reused for another marker.
+static void FLTResetMarker(GMSMarker *marker) {
+  marker.map = nil;
+  marker.userData = nil;
+  marker.icon = nil;
+  marker.title = nil;
+  marker.snippet = nil;
+  marker.opacity = 1;
+  marker.groundAnchor = CGPointMake(0.5, 1);
+  marker.infoWindowAnchor = CGPointMake(0.5, 0);
+  marker.draggable = NO;
+  marker.flat = NO;
+  marker.rotation = 0;
+  marker.zIndex = 0;
+}
+
+// The smallest cluster sizes that are shown rounded down, from largest to smallest.
+static const NSUInteger kFLTClusterSizeBuckets[] = {1000, 500, 200, 100, 50, 20, 10};
+
+// Returns the label of clusters with the given number of markers.
+static NSString *FLTClusterLabel(NSUInteger size) {
+  for (size_t i = 0; i < sizeof(kFLTClusterSizeBuckets) / sizeof(kFLTClusterSizeBuckets[0]); i++) {
+    if (size >= kFLTClusterSizeBuckets[i]) {
+      return [NSString stringWithFormat:@"%lu+", (unsigned long)kFLTClusterSizeBuckets[i]];
+    }
+  }
+  return [NSString stringWithFormat:@"%lu", (unsigned long)size];
+}
+
+// Returns a value identifying the image described by the icon descriptor in iconData, for caching
+// and comparing icons. Byte icons are identified by their bytes, since their typed data wrappers
+// are created anew for every message.
+static id FLTMarkerIconKey(id iconData) {
+  if (![iconData isKindOfClass:[NSArray class]]) {
+    return iconData;
+  }
+  NSMutableArray *key = [NSMutableArray arrayWithCapacity:[iconData count]];
+  for (id value in iconData) {
+    [key addObject:[value isKindOfClass:[FlutterStandardTypedData class]] ? [value data] : value];
+  }
+  return key;
+}
+
+// Returns whether the image of the icon described by iconData is decoded on a background queue,
+// which is the case for valid asset and byte icons.
+static BOOL FLTMarkerIconIsDecodedInBackground(NSArray *iconData) {
+  NSString *type = iconData.firstObject;
+  if ([type isEqual:@"fromAsset"]) {
+    return iconData.count >= 2;
+  } else if ([type isEqual:@"fromAssetImage"]) {
+    return iconData.count == 3;
+  } else if ([type isEqual:@"fromBytes"]) {
+    return iconData.count == 2;
+  }
+  return NO;
+}
+
+// Returns the lookup key of the asset of an asset icon, or nil for other icons.
+static NSString *_Nullable FLTMarkerIconAssetKey(NSArray *iconData,
+                                                 NSObject<FlutterPluginRegistrar> *registrar) {
+  NSString *type = iconData.firstObject;
+  if ([type isEqual:@"fromAsset"] && iconData.count == 3) {
+    return [registrar lookupKeyForAsset:iconData[1] fromPackage:iconData[2]];
+  } else if ([type isEqual:@"fromAsset"] || [type isEqual:@"fromAssetImage"]) {
+    return [registrar lookupKeyForAsset:iconData[1]];
+  }
+  return nil;
+}
+
+// Returns the image scaled by scaleParam, if it is a number other than 1.
+static UIImage *FLTScaleMarkerIcon(UIImage *image, id scaleParam) {
+  double scale = 1.0;
+  if ([scaleParam isKindOfClass:[NSNumber class]]) {
+    scale = [scaleParam doubleValue];
+  }
+  if (fabs(scale - 1) > 1e-3) {
+    return [UIImage imageWithCGImage:[image CGImage]
+                               scale:(image.scale * scale)
+                         orientation:(image.imageOrientation)];
+  }
+  return image;
+}
+
+// Decodes the image of an icon that FLTMarkerIconIsDecodedInBackground accepts, given the lookup
+// key of its asset. Unlike UIScreen, this can be called on any queue.
+static UIImage *_Nullable FLTDecodeMarkerIcon(NSArray *iconData, NSString *_Nullable assetKey,
+                                              CGFloat screenScale) {
+  NSString *type = iconData.firstObject;
+  if ([type isEqual:@"fromAsset"]) {
+    return [UIImage imageNamed:assetKey];
+  } else if ([type isEqual:@"fromAssetImage"]) {
+    return FLTScaleMarkerIcon([UIImage imageNamed:assetKey], iconData[2]);
+  }
+  // The bytes are plain data when the icon is reapplied from the applied options.
+  id byteData = iconData[1];
+  NSData *data = [byteData isKindOfClass:[FlutterStandardTypedData class]]
+                     ? [(FlutterStandardTypedData *)byteData data]
+                     : byteData;
+  if (![data isKindOfClass:[NSData class]]) {
+    return nil;
+  }
+  return [UIImage imageWithData:data scale:screenScale];
+}
 
 @interface FLTGoogleMapMarkerController ()
 
-@property(strong, nonatomic) GMSMarker *marker;
+@property(strong, nonatomic, nullable) GMSMarker *marker;
+@property(copy, nonatomic) NSString *identifier;
 @property(weak, nonatomic) GMSMapView *mapView;
 @property(assign, nonatomic, readwrite) BOOL consumeTapEvents;
+@property(assign, nonatomic, readwrite) BOOL visible;
+// The options last applied to the marker, with the icon stored as its FLTMarkerIconKey.
+@property(copy, nonatomic) NSDictionary *appliedOptions;
+// The icon whose image is being decoded for the marker, if it wasn't cached when it was set.
+@property(copy, nonatomic, nullable) NSArray *pendingIcon;
 
 @end
 
-@implementation FLTGoogleMapMarkerController
+@implementation FLTGoogleMapMarkerController {
+  // The position of the marker while it has no GMSMarker.
+  CLLocationCoordinate2D _position;
+}
 
 - (instancetype)initMarkerWithPosition:(CLLocationCoordinate2D)position
                             identifier:(NSString *)identifier
                                mapView:(GMSMapView *)mapView {
-  self = [super init];
+  self = [self initWithIdentifier:identifier position:position mapView:mapView];
   if (self) {
     _marker = [GMSMarker markerWithPosition:position];
-    _mapView = mapView;
     _marker.userData = @[ identifier ];
   }
   return self;
 }
 
+- (instancetype)initWithIdentifier:(NSString *)identifier
+                          position:(CLLocationCoordinate2D)position
+                           mapView:(GMSMapView *)mapView {
+  self = [super init];
+  if (self) {
+    _identifier = [identifier copy];
+    _position = position;
+    _mapView = mapView;
+  }
+  return self;
+}
+
+- (void)attachMarker:(GMSMarker *)marker
+           registrar:(NSObject<FlutterPluginRegistrar> *)registrar
+           iconCache:(NSCache *)iconCache {
+  self.marker = marker;
+  marker.userData = @[ self.identifier ];
+  marker.position = _position;
+  [self interpretMarkerOptions:self.appliedOptions registrar:registrar iconCache:iconCache];
+  marker.map = (self.visible && !self.clustered) ? self.mapView : nil;
+}
+
+- (nullable GMSMarker *)detachMarker {
+  GMSMarker *marker = self.marker;
+  if (marker) {
+    // Keep where the marker was dragged to.
+    _position = marker.position;
+    marker.map = nil;
+    self.marker = nil;
+  }
+  self.pendingIcon = nil;
+  return marker;
+}
+
 - (void)showInfoWindow {
   self.mapView.selectedMarker = self.marker;
 }
 
 - (void)hideInfoWindow {
-  if (self.mapView.selectedMarker == self.marker) {
+  if (self.marker && self.mapView.selectedMarker == self.marker) {
     self.mapView.selectedMarker = nil;
   }
 }
 
 - (BOOL)isInfoWindowShown {
-  return self.mapView.selectedMarker == self.marker;
+  return self.marker && self.mapView.selectedMarker == self.marker;
 }
 
 - (void)removeMarker {
   self.marker.map = nil;
+  self.pendingIcon = nil;
 }
 
 - (void)setAlpha:(float)alpha {
@@ -74,7 +255,12 @@
   self.marker.snippet = snippet;
 }
 
+- (CLLocationCoordinate2D)position {
+  return self.marker ? self.marker.position : _position;
+}
+
 - (void)setPosition:(CLLocationCoordinate2D)position {
+  _position = position;
   self.marker.position = position;
 }
 
@@ -83,15 +269,52 @@
 }
 
 - (void)setVisible:(BOOL)visible {
-  self.marker.map = visible ? self.mapView : nil;
+  _visible = visible;
+  self.marker.map = (visible && !self.clustered) ? self.mapView : nil;
+}
+
+- (void)setClustered:(BOOL)clustered {
+  if (clustered == _clustered) {
+    return;
+  }
+  _clustered = clustered;
+  self.marker.map = (self.visible && !clustered) ? self.mapView : nil;
 }
 
 - (void)setZIndex:(int)zIndex {
   self.marker.zIndex = zIndex;
 }
 
+- (void)updatePosition:(CLLocationCoordinate2D)position {
+  [self setPosition:position];
+  NSMutableDictionary *appliedOptions =
+      [self.appliedOptions mutableCopy] ?: [[NSMutableDictionary alloc] init];
+  appliedOptions[@"position"] = [FLTGoogleMapJSONConversions arrayFromLocation:position];
+  self.appliedOptions = appliedOptions;
+}
+
+- (void)updateMarkerOptions:(NSDictionary *)data
+                  registrar:(NSObject<FlutterPluginRegistrar> *)registrar
+                  iconCache:(NSCache *)iconCache {
+  // Setting a property of a GMSMarker is costly even when the value doesn't change, and most
+  // updates only change one or two options of a marker, so only the changed ones are applied.
+  NSMutableDictionary *changedOptions = [[NSMutableDictionary alloc] init];
+  NSMutableDictionary *appliedOptions =
+      [self.appliedOptions mutableCopy] ?: [[NSMutableDictionary alloc] init];
+  [data enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+    id comparableValue = [key isEqual:@"icon"] ? FLTMarkerIconKey(value) : value;
+    if (![comparableValue isEqual:appliedOptions[key]]) {
+      changedOptions[key] = value;
+      appliedOptions[key] = comparableValue;
+    }
+  }];
+  [self interpretMarkerOptions:changedOptions registrar:registrar iconCache:iconCache];
+  self.appliedOptions = appliedOptions;
+}
+
 - (void)interpretMarkerOptions:(NSDictionary *)data
-                     registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
+                     registrar:(NSObject<FlutterPluginRegistrar> *)registrar
+                     iconCache:(NSCache *)iconCache {
   NSNumber *alpha = data[@"alpha"];
   if (alpha && alpha != (id)[NSNull null]) {
     [self setAlpha:[alpha floatValue]];
@@ -105,9 +328,18 @@
     [self setDraggable:[draggable boolValue]];
   }
   NSArray *icon = data[@"icon"];
-  if (icon && icon != (id)[NSNull null]) {
-    UIImage *image = [self extractIconFromData:icon registrar:registrar];
-    [self setIcon:image];
+  // Culled markers get their icon once they are shown again.
+  if (icon && icon != (id)[NSNull null] && self.marker) {
+    // Markers that share an icon share its image, rather than each decoding a copy of it.
+    UIImage *image = [iconCache objectForKey:FLTMarkerIconKey(icon)];
+    if (image || !FLTMarkerIconIsDecodedInBackground(icon)) {
+      self.pendingIcon = nil;
+      [self setIcon:image ?: [self extractIconFromData:icon registrar:registrar]];
+    } else {
+      // The markers controller decodes the image off the main thread, and sets it along with the
+      // icons of the other markers waiting for theirs.
+      self.pendingIcon = icon;
+    }
   }
   NSNumber *flat = data[@"flat"];
   if (flat && flat != (id)[NSNull null]) {
@@ -153,70 +385,33 @@
 
 - (UIImage *)extractIconFromData:(NSArray *)iconData
                        registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
-  UIImage *image;
   if ([iconData.firstObject isEqualToString:@"defaultMarker"]) {
     CGFloat hue = (iconData.count == 1) ? 0.0f : [iconData[1] doubleValue];
-    image = [GMSMarker markerImageWithColor:[UIColor colorWithHue:hue / 360.0
-                                                       saturation:1.0
-                                                       brightness:0.7
-                                                            alpha:1.0]];
-  } else if ([iconData.firstObject isEqualToString:@"fromAsset"]) {
-    if (iconData.count == 2) {
-      image = [UIImage imageNamed:[registrar lookupKeyForAsset:iconData[1]]];
-    } else {
-      image = [UIImage imageNamed:[registrar lookupKeyForAsset:iconData[1]
-                                                   fromPackage:iconData[2]]];
-    }
+    return [GMSMarker markerImageWithColor:[UIColor colorWithHue:hue / 360.0
+                                                      saturation:1.0
+                                                      brightness:0.7
+                                                           alpha:1.0]];
+  } else if (FLTMarkerIconIsDecodedInBackground(iconData)) {
+    return FLTDecodeMarkerIcon(iconData, FLTMarkerIconAssetKey(iconData, registrar),
+                               [[UIScreen mainScreen] scale]);
   } else if ([iconData.firstObject isEqualToString:@"fromAssetImage"]) {
-    if (iconData.count == 3) {
-      image = [UIImage imageNamed:[registrar lookupKeyForAsset:iconData[1]]];
-      id scaleParam = iconData[2];
-      image = [self scaleImage:image by:scaleParam];
-    } else {
-      NSString *error =
-          [NSString stringWithFormat:@"'fromAssetImage' should have exactly 3 arguments. Got: %lu",
-                                     (unsigned long)iconData.count];
-      NSException *exception = [NSException exceptionWithName:@"InvalidBitmapDescriptor"
-                                                       reason:error
-                                                     userInfo:nil];
-      @throw exception;
-    }
+    NSString *error =
+        [NSString stringWithFormat:@"'fromAssetImage' should have exactly 3 arguments. Got: %lu",
+                                   (unsigned long)iconData.count];
+    NSException *exception = [NSException exceptionWithName:@"InvalidBitmapDescriptor"
+                                                     reason:error
+                                                   userInfo:nil];
+    @throw exception;
   } else if ([iconData[0] isEqualToString:@"fromBytes"]) {
-    if (iconData.count == 2) {
-      @try {
-        FlutterStandardTypedData *byteData = iconData[1];
-        CGFloat screenScale = [[UIScreen mainScreen] scale];
-        image = [UIImage imageWithData:[byteData data] scale:screenScale];
-      } @catch (NSException *exception) {
-        @throw [NSException exceptionWithName:@"InvalidByteDescriptor"
-                                       reason:@"Unable to interpret bytes as a valid image."
-                                     userInfo:nil];
-      }
-    } else {
-      NSString *error = [NSString
-          stringWithFormat:@"fromBytes should have exactly one argument, the bytes. Got: %lu",
-                           (unsigned long)iconData.count];
-      NSException *exception = [NSException exceptionWithName:@"InvalidByteDescriptor"
-                                                       reason:error
-                                                     userInfo:nil];
-      @throw exception;
-    }
-  }
-
-  return image;
-}
-
-- (UIImage *)scaleImage:(UIImage *)image by:(id)scaleParam {
-  double scale = 1.0;
-  if ([scaleParam isKindOfClass:[NSNumber class]]) {
-    scale = [scaleParam doubleValue];
+    NSString *error = [NSString
+        stringWithFormat:@"fromBytes should have exactly one argument, the bytes. Got: %lu",
+                         (unsigned long)iconData.count];
+    NSException *exception = [NSException exceptionWithName:@"InvalidByteDescriptor"
+                                                     reason:error
+                                                   userInfo:nil];
+    @throw exception;
   }
-  if (fabs(scale - 1) > 1e-3) {
-    return [UIImage imageWithCGImage:[image CGImage]
-                               scale:(image.scale * scale)
-                         orientation:(image.imageOrientation)];
-  }
-  return image;
+  return nil;
 }
 
 @end
@@ -224,6 +419,29 @@
 @interface FLTMarkersController ()
 
 @property(strong, nonatomic) NSMutableDictionary *markerIdentifierToController;
+// The images of the icons of the markers, keyed by their FLTMarkerIconKey.
+@property(strong, nonatomic) NSCache *iconCache;
+// The markers whose icons are waiting to be decoded on iconQueue.
+@property(strong, nonatomic) NSMutableSet<FLTGoogleMapMarkerController *> *pendingIconMarkers;
+// The serial queue that decodes and scales the images of icons.
+@property(strong, nonatomic) dispatch_queue_t iconQueue;
+// The options for clustering markers, or nil if markers aren't clustered.
+@property(copy, nonatomic, nullable) NSDictionary *clusteringOptions;
+// The markers that are clustered, or nil if all markers are.
+@property(copy, nonatomic, nullable) NSSet<NSString *> *clusteredMarkerIdentifiers;
+// The markers drawn for the current clusters.
+@property(strong, nonatomic) NSMutableArray<GMSMarker *> *clusterMarkers;
+// The icons of cluster markers, keyed by their label.
+@property(strong, nonatomic) NSMutableDictionary<NSString *, UIImage *> *clusterIcons;
+// The zoom level the current clusters were computed for, or NSNotFound if there are none.
+@property(assign, nonatomic) NSInteger clusteredZoomLevel;
+@property(assign, nonatomic) BOOL clustersNeedUpdate;
+// The options for culling markers outside the visible region, or nil if markers aren't culled.
+@property(copy, nonatomic, nullable) NSDictionary *viewportCullingOptions;
+// The region that culled markers are shown in.
+@property(assign, nonatomic) FLTMarkerCullingRegion cullingRegion;
+// The GMSMarkers of culled markers, kept to be reused for markers that are shown.
+@property(strong, nonatomic) NSMutableArray<GMSMarker *> *reusableMarkers;
 @property(strong, nonatomic) FlutterMethodChannel *methodChannel;
 @property(weak, nonatomic) NSObject<FlutterPluginRegistrar> *registrar;
 @property(weak, nonatomic) GMSMapView *mapView;
@@ -240,6 +458,17 @@
     _methodChannel = methodChannel;
     _mapView = mapView;
     _markerIdentifierToController = [[NSMutableDictionary alloc] init];
+    _iconCache = [[NSCache alloc] init];
+    _iconCache.countLimit = kFLTMarkerIconCacheCountLimit;
+    _pendingIconMarkers = [[NSMutableSet alloc] init];
+    _iconQueue = dispatch_queue_create(
+        "io.flutter.plugins.google_maps.marker_icons",
+        dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED,
+                                                0));
+    _clusterMarkers = [[NSMutableArray alloc] init];
+    _clusterIcons = [[NSMutableDictionary alloc] init];
+    _clusteredZoomLevel = NSNotFound;
+    _reusableMarkers = [[NSMutableArray alloc] init];
     _registrar = registrar;
   }
   return self;
@@ -249,13 +478,22 @@
   for (NSDictionary *marker in markersToAdd) {
     CLLocationCoordinate2D position = [FLTMarkersController getPosition:marker];
     NSString *identifier = marker[@"markerId"];
-    FLTGoogleMapMarkerController *controller =
-        [[FLTGoogleMapMarkerController alloc] initMarkerWithPosition:position
-                                                          identifier:identifier
-                                                             mapView:self.mapView];
-    [controller interpretMarkerOptions:marker registrar:self.registrar];
+    FLTGoogleMapMarkerController *controller;
+    if (self.viewportCullingOptions) {
+      // Only the options are kept until the marker is in the culling region.
+      controller = [[FLTGoogleMapMarkerController alloc] initWithIdentifier:identifier
+                                                                    position:position
+                                                                     mapView:self.mapView];
+    } else {
+      controller = [[FLTGoogleMapMarkerController alloc] initMarkerWithPosition:position
+                                                                     identifier:identifier
+                                                                        mapView:self.mapView];
+    }
+    [controller updateMarkerOptions:marker registrar:self.registrar iconCache:self.iconCache];
+    [self cullMarker:controller];
     self.markerIdentifierToController[identifier] = controller;
   }
+  [self markersDidChange];
 }
 
 - (void)changeMarkers:(NSArray *)markersToChange {
@@ -265,8 +503,25 @@
     if (!controller) {
       continue;
     }
-    [controller interpretMarkerOptions:marker registrar:self.registrar];
+    [controller updateMarkerOptions:marker registrar:self.registrar iconCache:self.iconCache];
+    [self cullMarker:controller];
+  }
+  [self markersDidChange];
+}
+
+- (void)updateMarkerPositions:(NSArray<NSString *> *)identifiers
+                    positions:(FlutterStandardTypedData *)positions {
+  const double *coordinates = positions.data.bytes;
+  NSUInteger count = MIN(identifiers.count, positions.elementCount / 2);
+  for (NSUInteger i = 0; i < count; i++) {
+    FLTGoogleMapMarkerController *controller = self.markerIdentifierToController[identifiers[i]];
+    [controller updatePosition:CLLocationCoordinate2DMake(coordinates[2 * i],
+                                                          coordinates[2 * i + 1])];
+    if (controller) {
+      [self cullMarker:controller];
+    }
   }
+  [self markersDidChange];
 }
 
 - (void)removeMarkersWithIdentifiers:(NSArray *)identifiers {
@@ -275,9 +530,291 @@
     if (!controller) {
       continue;
     }
-    [controller removeMarker];
+    if (self.viewportCullingOptions) {
+      [self reuseMarker:[controller detachMarker]];
+    } else {
+      [controller removeMarker];
+    }
     [self.markerIdentifierToController removeObjectForKey:identifier];
   }
+  [self markersDidChange];
+}
+
+- (void)setViewportCullingOptions:(nullable NSDictionary *)options {
+  _viewportCullingOptions = [options copy];
+  if (options) {
+    [self updateViewportCulling];
+    return;
+  }
+  // Give every marker its GMSMarker back.
+  [self.reusableMarkers removeAllObjects];
+  for (FLTGoogleMapMarkerController *controller in self.markerIdentifierToController
+           .objectEnumerator) {
+    [self cullMarker:controller];
+  }
+}
+
+- (void)updateViewportCulling {
+  if (!self.viewportCullingOptions) {
+    return;
+  }
+  GMSVisibleRegion visibleRegion = self.mapView.projection.visibleRegion;
+  [self cullMarkersWithVisibleBounds:[[GMSCoordinateBounds alloc] initWithRegion:visibleRegion]];
+}
+
+- (void)cullMarkersWithVisibleBounds:(GMSCoordinateBounds *)bounds {
+  // Extend the visible bounds by the margin on every side, so that markers are already shown when
+  // the camera moves a little.
+  double margin = MAX([self.viewportCullingOptions[@"margin"] doubleValue], 0);
+  CLLocationDegrees latitudeSpan = bounds.northEast.latitude - bounds.southWest.latitude;
+  CLLocationDegrees longitudeSpan = bounds.northEast.longitude - bounds.southWest.longitude;
+  if (longitudeSpan < 0) {
+    longitudeSpan += 360;
+  }
+  FLTMarkerCullingRegion region;
+  region.south = MAX(bounds.southWest.latitude - latitudeSpan * margin, -90);
+  region.north = MIN(bounds.northEast.latitude + latitudeSpan * margin, 90);
+  if (longitudeSpan * (1 + 2 * margin) >= 360) {
+    region.west = -180;
+    region.east = 180;
+  } else {
+    region.west = FLTNormalizeLongitude(bounds.southWest.longitude - longitudeSpan * margin);
+    region.east = FLTNormalizeLongitude(bounds.northEast.longitude + longitudeSpan * margin);
+  }
+  self.cullingRegion = region;
+  for (FLTGoogleMapMarkerController *controller in self.markerIdentifierToController
+           .objectEnumerator) {
+    [self cullMarker:controller];
+  }
+}
+
+// Gives the marker a GMSMarker if it is shown, and takes it away if it is culled.
+- (void)cullMarker:(FLTGoogleMapMarkerController *)controller {
+  BOOL culled = self.viewportCullingOptions && ![controller isInfoWindowShown] &&
+                !(controller.visible && !controller.clustered &&
+                  FLTMarkerCullingRegionContains(self.cullingRegion, controller.position));
+  if (culled && controller.marker) {
+    [self reuseMarker:[controller detachMarker]];
+  } else if (!culled && !controller.marker) {
+    GMSMarker *marker = self.reusableMarkers.lastObject;
+    if (marker) {
+      [self.reusableMarkers removeLastObject];
+    } else {
+      marker = [[GMSMarker alloc] init];
+    }
+    [controller attachMarker:marker registrar:self.registrar iconCache:self.iconCache];
+  }
+  [self loadPendingIconOfMarker:controller];
+}
+
+// Decodes the icon the marker is waiting for, if any, along with the icons of the other markers
+// waiting for theirs once the current work on the main queue is done.
+- (void)loadPendingIconOfMarker:(FLTGoogleMapMarkerController *)controller {
+  if (!controller.pendingIcon) {
+    return;
+  }
+  if (self.pendingIconMarkers.count == 0) {
+    __weak FLTMarkersController *weakSelf = self;
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [weakSelf loadPendingIcons];
+    });
+  }
+  [self.pendingIconMarkers addObject:controller];
+}
+
+- (void)loadPendingIcons {
+  NSArray<FLTGoogleMapMarkerController *> *controllers = self.pendingIconMarkers.allObjects;
+  [self.pendingIconMarkers removeAllObjects];
+  NSMutableArray<NSArray *> *icons = [[NSMutableArray alloc] initWithCapacity:controllers.count];
+  // The icons to decode, and the lookup keys of their assets, which use the registrar on the main
+  // thread.
+  NSMutableDictionary<id, NSArray *> *iconsToDecode = [[NSMutableDictionary alloc] init];
+  NSMutableDictionary<id, NSString *> *assetKeys = [[NSMutableDictionary alloc] init];
+  for (FLTGoogleMapMarkerController *controller in controllers) {
+    NSArray *icon = controller.pendingIcon;
+    [icons addObject:icon ?: @[]];
+    id iconKey = FLTMarkerIconKey(icon);
+    if (!icon || iconsToDecode[iconKey]) {
+      continue;
+    }
+    iconsToDecode[iconKey] = icon;
+    assetKeys[iconKey] = FLTMarkerIconAssetKey(icon, self.registrar);
+  }
+  if (iconsToDecode.count == 0) {
+    return;
+  }
+  CGFloat screenScale = [[UIScreen mainScreen] scale];
+  NSCache *iconCache = self.iconCache;
+  __weak FLTMarkersController *weakSelf = self;
+  dispatch_async(self.iconQueue, ^{
+    NSMutableDictionary<id, UIImage *> *images = [[NSMutableDictionary alloc] init];
+    [iconsToDecode enumerateKeysAndObjectsUsingBlock:^(id iconKey, NSArray *icon, BOOL *stop) {
+      UIImage *image = [iconCache objectForKey:iconKey];
+      if (!image) {
+        image = FLTDecodeMarkerIcon(icon, assetKeys[iconKey], screenScale);
+        if (image) {
+          [iconCache setObject:image forKey:iconKey];
+        }
+      }
+      if (image) {
+        images[iconKey] = image;
+      }
+    }];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      if (!weakSelf) {
+        return;
+      }
+      // All the markers get their icons at once, rather than each as its image is ready.
+      [controllers enumerateObjectsUsingBlock:^(FLTGoogleMapMarkerController *controller,
+                                                NSUInteger index, BOOL *stop) {
+        // Markers that were removed, culled, or given another icon meanwhile are left alone.
+        if (controller.pendingIcon != icons[index]) {
+          return;
+        }
+        controller.pendingIcon = nil;
+        controller.marker.icon = images[FLTMarkerIconKey(icons[index])];
+      }];
+    });
+  });
+}
+
+// Keeps the GMSMarker of a culled or removed marker to be reused, if there is room for it.
+- (void)reuseMarker:(nullable GMSMarker *)marker {
+  if (!marker) {
+    return;
+  }
+  FLTResetMarker(marker);
+  if (self.reusableMarkers.count < kFLTReusableMarkerCountLimit) {
+    [self.reusableMarkers addObject:marker];
+  }
+}
+
+- (void)setClusteringOptions:(nullable NSDictionary *)options {
+  _clusteringOptions = [options copy];
+  NSArray *markerIds = options[@"markerIds"];
+  self.clusteredMarkerIdentifiers =
+      [markerIds isKindOfClass:[NSArray class]] ? [NSSet setWithArray:markerIds] : nil;
+  // The color of the icons may have changed.
+  [self.clusterIcons removeAllObjects];
+  self.clustersNeedUpdate = YES;
+  [self updateClusters];
+}
+
+- (void)markersDidChange {
+  if (self.clusteringOptions) {
+    self.clustersNeedUpdate = YES;
+    [self updateClusters];
+  }
+}
+
+- (void)updateClusters {
+  NSDictionary *options = self.clusteringOptions;
+  float zoom = self.mapView.camera.zoom;
+  NSNumber *maxZoom = options[@"maxZoom"];
+  BOOL aboveMaxZoom = maxZoom && maxZoom != (id)[NSNull null] && zoom > maxZoom.floatValue;
+  BOOL clusters = options && !aboveMaxZoom;
+  // Clusters only depend on the whole zoom level, so they are left alone while the camera pans.
+  NSInteger zoomLevel = clusters ? (NSInteger)floor(zoom) : NSNotFound;
+  if (zoomLevel == self.clusteredZoomLevel && !self.clustersNeedUpdate) {
+    return;
+  }
+  self.clusteredZoomLevel = zoomLevel;
+  self.clustersNeedUpdate = NO;
+
+  NSArray<FLTMarkerCluster *> *markerClusters = @[];
+  NSMutableSet<NSString *> *clusteredIdentifiers = [[NSMutableSet alloc] init];
+  if (clusters) {
+    FLTMarkerClusterer *clusterer =
+        [[FLTMarkerClusterer alloc] initWithZoom:zoom gridSize:[options[@"gridSize"] doubleValue]];
+    NSSet<NSString *> *clusteredMarkerIdentifiers = self.clusteredMarkerIdentifiers;
+    [self.markerIdentifierToController
+        enumerateKeysAndObjectsUsingBlock:^(NSString *identifier,
+                                            FLTGoogleMapMarkerController *controller, BOOL *stop) {
+          if (controller.visible && (!clusteredMarkerIdentifiers ||
+                                     [clusteredMarkerIdentifiers containsObject:identifier])) {
+            [clusterer addMarkerWithIdentifier:identifier position:controller.position];
+          }
+        }];
+    markerClusters =
+        [clusterer clustersWithMinimumSize:[options[@"minimumClusterSize"] unsignedIntegerValue]];
+    for (FLTMarkerCluster *cluster in markerClusters) {
+      [clusteredIdentifiers addObjectsFromArray:cluster.markerIdentifiers];
+    }
+  }
+  [self.markerIdentifierToController
+      enumerateKeysAndObjectsUsingBlock:^(NSString *identifier,
+                                          FLTGoogleMapMarkerController *controller, BOOL *stop) {
+        controller.clustered = [clusteredIdentifiers containsObject:identifier];
+        [self cullMarker:controller];
+      }];
+  [self showClusters:markerClusters];
+}
+
+- (void)showClusters:(NSArray<FLTMarkerCluster *> *)clusters {
+  // Reuse the markers of the previous clusters rather than creating new ones.
+  for (NSUInteger i = 0; i < clusters.count; i++) {
+    FLTMarkerCluster *cluster = clusters[i];
+    GMSMarker *marker;
+    if (i < self.clusterMarkers.count) {
+      marker = self.clusterMarkers[i];
+    } else {
+      marker = [[GMSMarker alloc] init];
+      marker.groundAnchor = CGPointMake(0.5, 0.5);
+      [self.clusterMarkers addObject:marker];
+    }
+    marker.position = cluster.position;
+    marker.icon = [self iconForClusterSize:cluster.markerIdentifiers.count];
+    marker.userData = cluster;
+    marker.map = self.mapView;
+  }
+  while (self.clusterMarkers.count > clusters.count) {
+    self.clusterMarkers.lastObject.map = nil;
+    [self.clusterMarkers removeLastObject];
+  }
+}
+
+// Returns the icon of clusters with the given number of markers.
+- (UIImage *)iconForClusterSize:(NSUInteger)size {
+  NSString *label = FLTClusterLabel(size);
+  UIImage *icon = self.clusterIcons[label];
+  if (icon) {
+    return icon;
+  }
+  UIColor *color = [FLTGoogleMapJSONConversions colorFromRGBA:self.clusteringOptions[@"color"]];
+  NSDictionary *attributes = @{
+    NSFontAttributeName : [UIFont boldSystemFontOfSize:14],
+    NSForegroundColorAttributeName : UIColor.whiteColor,
+  };
+  CGSize labelSize = [label sizeWithAttributes:attributes];
+  CGFloat diameter = ceil(MAX(labelSize.width, labelSize.height)) + 16;
+  UIGraphicsImageRenderer *renderer =
+      [[UIGraphicsImageRenderer alloc] initWithSize:CGSizeMake(diameter, diameter)];
+  icon = [renderer imageWithActions:^(UIGraphicsImageRendererContext *context) {
+    UIBezierPath *circle =
+        [UIBezierPath bezierPathWithOvalInRect:CGRectMake(1, 1, diameter - 2, diameter - 2)];
+    circle.lineWidth = 2;
+    [color setFill];
+    [circle fill];
+    [UIColor.whiteColor setStroke];
+    [circle stroke];
+    [label drawAtPoint:CGPointMake((diameter - labelSize.width) / 2,
+                                   (diameter - labelSize.height) / 2)
+        withAttributes:attributes];
+  }];
+  self.clusterIcons[label] = icon;
+  return icon;
+}
+
+- (void)didTapCluster:(FLTMarkerCluster *)cluster {
+  NSDictionary *bounds =
+      [FLTGoogleMapJSONConversions dictionaryFromCoordinateBounds:cluster.bounds];
+  [self.methodChannel
+      invokeMethod:@"cluster#onTap"
+         arguments:@{
+           @"position" : [FLTGoogleMapJSONConversions arrayFromLocation:cluster.position],
+           @"bounds" : bounds,
+           @"markerIds" : cluster.markerIdentifiers,
+         }];
 }
 
 - (BOOL)didTapMarkerWithIdentifier:(NSString *)identifier {
@@ -346,6 +883,13 @@
 - (void)showMarkerInfoWindowWithIdentifier:(NSString *)identifier result:(FlutterResult)result {
   FLTGoogleMapMarkerController *controller = self.markerIdentifierToController[identifier];
   if (controller) {
+    if (!controller.marker) {
+      // The info window of a culled marker needs its GMSMarker, which stays while it is shown.
+      [controller attachMarker:[[GMSMarker alloc] init]
+                     registrar:self.registrar
+                     iconCache:self.iconCache];
+      [self loadPendingIconOfMarker:controller];
+    }
     [controller showInfoWindow];
     result(nil);
   } else {
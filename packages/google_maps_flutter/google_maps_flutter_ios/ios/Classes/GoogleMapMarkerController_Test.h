@@ -0,0 +1,29 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "GoogleMapMarkerController.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface FLTGoogleMapMarkerController ()
+
+/// The marker this controller manages, or nil if it is culled.
+@property(strong, nonatomic, readonly, nullable) GMSMarker *marker;
+
+@end
+
+@interface FLTMarkersController ()
+
+/// The controllers of the markers on the map, keyed by marker identifier.
+@property(strong, nonatomic, readonly) NSMutableDictionary *markerIdentifierToController;
+
+/// Culls the markers outside the given visible bounds and their margin.
+- (void)cullMarkersWithVisibleBounds:(GMSCoordinateBounds *)bounds;
+
+/// The serial queue that decodes the icons of markers that weren't cached when they were set.
+@property(strong, nonatomic, readonly) dispatch_queue_t iconQueue;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -39,25 +39,10 @@
 - (void)setZIndex:(int)zIndex {
   self.polygon.zIndex = zIndex;
 }
-- (void)setPoints:(NSArray<CLLocation *> *)points {
-  GMSMutablePath *path = [GMSMutablePath path];
-
-  for (CLLocation *location in points) {
-    [path addCoordinate:location.coordinate];
-  }
+- (void)setPath:(GMSPath *)path {
   self.polygon.path = path;
 }
-- (void)setHoles:(NSArray<NSArray<CLLocation *> *> *)rawHoles {
-  NSMutableArray<GMSMutablePath *> *holes = [[NSMutableArray<GMSMutablePath *> alloc] init];
-
-  for (NSArray<CLLocation *> *points in rawHoles) {
-    GMSMutablePath *path = [GMSMutablePath path];
-    for (CLLocation *location in points) {
-      [path addCoordinate:location.coordinate];
-    }
-    [holes addObject:path];
-  }
-
+- (void)setHoles:(NSArray<GMSPath *> *)holes {
   self.polygon.holes = holes;
 }
 
@@ -88,14 +73,14 @@
     [self setZIndex:[zIndex intValue]];
   }
 
-  NSArray *points = data[@"points"];
+  id points = data[@"points"];
   if (points && points != (id)[NSNull null]) {
-    [self setPoints:[FLTGoogleMapJSONConversions pointsFromLatLongs:points]];
+    [self setPath:[FLTGoogleMapJSONConversions pathFromLatLongs:points]];
   }
 
   NSArray *holes = data[@"holes"];
   if (holes && holes != (id)[NSNull null]) {
-    [self setHoles:[FLTGoogleMapJSONConversions holesFromPointsArray:holes]];
+    [self setHoles:[FLTGoogleMapJSONConversions pathsFromLatLongsArray:holes]];
   }
 
   NSNumber *fillColor = data[@"fillColor"];
@@ -142,10 +127,9 @@
 
 - (void)addPolygons:(NSArray *)polygonsToAdd {
   for (NSDictionary *polygon in polygonsToAdd) {
-    GMSMutablePath *path = [FLTPolygonsController getPath:polygon];
     NSString *identifier = polygon[@"polygonId"];
     FLTGoogleMapPolygonController *controller =
-        [[FLTGoogleMapPolygonController alloc] initPolygonWithPath:path
+        [[FLTGoogleMapPolygonController alloc] initPolygonWithPath:[GMSMutablePath path]
                                                         identifier:identifier
                                                            mapView:self.mapView];
     [controller interpretPolygonOptions:polygon registrar:self.registrar];
@@ -193,14 +177,4 @@
   return self.polygonIdentifierToController[identifier] != nil;
 }
 
-+ (GMSMutablePath *)getPath:(NSDictionary *)polygon {
-  NSArray *pointArray = polygon[@"points"];
-  NSArray<CLLocation *> *points = [FLTGoogleMapJSONConversions pointsFromLatLongs:pointArray];
-  GMSMutablePath *path = [GMSMutablePath path];
-  for (CLLocation *location in points) {
-    [path addCoordinate:location.coordinate];
-  }
-  return path;
-}
-
 @end
@@ -20,6 +20,8 @@
 - (void)addPolylines:(NSArray *)polylinesToAdd;
 - (void)changePolylines:(NSArray *)polylinesToChange;
 - (void)removePolylineWithIdentifiers:(NSArray *)identifiers;
+/// Simplifies the paths of long polylines for the given zoom level, if it changed.
+- (void)updatePathsForZoom:(float)zoom;
 - (void)didTapPolylineWithIdentifier:(NSString *)identifier;
 - (bool)hasPolylineWithIdentifier:(NSString *)identifier;
 @end
@@ -4,11 +4,19 @@
 
 #import "GoogleMapPolylineController.h"
 #import "FLTGoogleMapJSONConversions.h"
+#import "FLTPathSimplifier.h"
+
+// The number of points above which paths are simplified for the zoom level they are shown at.
+static const NSUInteger kFLTPolylineSimplificationThreshold = 1000;
 
 @interface FLTGoogleMapPolylineController ()
 
 @property(strong, nonatomic) GMSPolyline *polyline;
 @property(weak, nonatomic) GMSMapView *mapView;
+// The path as set from Dart, before it is simplified.
+@property(strong, nonatomic) GMSPath *fullPath;
+// The zoom level the path of the polyline was simplified for, or NSNotFound if it wasn't.
+@property(assign, nonatomic) NSInteger simplifiedZoomLevel;
 
 @end
 
@@ -22,6 +30,8 @@
     _polyline = [GMSPolyline polylineWithPath:path];
     _mapView = mapView;
     _polyline.userData = @[ identifier ];
+    _fullPath = path;
+    _simplifiedZoomLevel = NSNotFound;
   }
   return self;
 }
@@ -39,13 +49,36 @@
 - (void)setZIndex:(int)zIndex {
   self.polyline.zIndex = zIndex;
 }
-- (void)setPoints:(NSArray<CLLocation *> *)points {
-  GMSMutablePath *path = [GMSMutablePath path];
+- (void)setPath:(GMSPath *)path {
+  self.fullPath = path;
+  self.simplifiedZoomLevel = NSNotFound;
+  if ([self simplifiesPath]) {
+    [self updatePathForZoom:self.mapView.camera.zoom];
+  } else {
+    self.polyline.path = path;
+  }
+}
 
-  for (CLLocation *location in points) {
-    [path addCoordinate:location.coordinate];
+- (BOOL)simplifiesPath {
+  // Geodesic segments are drawn as curves, which removing points would change.
+  return self.fullPath.count > kFLTPolylineSimplificationThreshold && !self.polyline.geodesic;
+}
+
+- (void)updatePathForZoom:(float)zoom {
+  if (![self simplifiesPath]) {
+    if (self.simplifiedZoomLevel != NSNotFound) {
+      self.simplifiedZoomLevel = NSNotFound;
+      self.polyline.path = self.fullPath;
+    }
+    return;
   }
-  self.polyline.path = path;
+  NSInteger zoomLevel = (NSInteger)floor(zoom);
+  if (zoomLevel == self.simplifiedZoomLevel) {
+    return;
+  }
+  self.simplifiedZoomLevel = zoomLevel;
+  self.polyline.path =
+      FLTSimplifyPath(self.fullPath, FLTPathSimplificationToleranceForZoom(zoom));
 }
 
 - (void)setColor:(UIColor *)color {
@@ -57,6 +90,7 @@
 
 - (void)setGeodesic:(BOOL)isGeodesic {
   self.polyline.geodesic = isGeodesic;
+  [self updatePathForZoom:self.mapView.camera.zoom];
 }
 
 - (void)interpretPolylineOptions:(NSDictionary *)data
@@ -76,9 +110,9 @@
     [self setZIndex:[zIndex intValue]];
   }
 
-  NSArray *points = data[@"points"];
+  id points = data[@"points"];
   if (points && points != (id)[NSNull null]) {
-    [self setPoints:[FLTGoogleMapJSONConversions pointsFromLatLongs:points]];
+    [self setPath:[FLTGoogleMapJSONConversions pathFromLatLongs:points]];
   }
 
   NSNumber *strokeColor = data[@"color"];
@@ -125,10 +159,9 @@
 }
 - (void)addPolylines:(NSArray *)polylinesToAdd {
   for (NSDictionary *polyline in polylinesToAdd) {
-    GMSMutablePath *path = [FLTPolylinesController getPath:polyline];
     NSString *identifier = polyline[@"polylineId"];
     FLTGoogleMapPolylineController *controller =
-        [[FLTGoogleMapPolylineController alloc] initPolylineWithPath:path
+        [[FLTGoogleMapPolylineController alloc] initPolylineWithPath:[GMSMutablePath path]
                                                           identifier:identifier
                                                              mapView:self.mapView];
     [controller interpretPolylineOptions:polyline registrar:self.registrar];
@@ -155,6 +188,12 @@
     [self.polylineIdentifierToController removeObjectForKey:identifier];
   }
 }
+- (void)updatePathsForZoom:(float)zoom {
+  for (FLTGoogleMapPolylineController *controller in self.polylineIdentifierToController
+           .objectEnumerator) {
+    [controller updatePathForZoom:zoom];
+  }
+}
 - (void)didTapPolylineWithIdentifier:(NSString *)identifier {
   if (!identifier) {
     return;
@@ -171,14 +210,5 @@
   }
   return self.polylineIdentifierToController[identifier] != nil;
 }
-+ (GMSMutablePath *)getPath:(NSDictionary *)polyline {
-  NSArray *pointArray = polyline[@"points"];
-  NSArray<CLLocation *> *points = [FLTGoogleMapJSONConversions pointsFromLatLongs:pointArray];
-  GMSMutablePath *path = [GMSMutablePath path];
-  for (CLLocation *location in points) {
-    [path addCoordinate:location.coordinate];
-  }
-  return path;
-}
 
 @end
@@ -2,4 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+export 'src/caching_tile_provider.dart';
+export 'src/camera_move_event_options.dart';
+export 'src/geo_json_layer.dart';
 export 'src/google_maps_flutter_ios.dart';
+export 'src/heatmap.dart';
+export 'src/map_snapshot_options.dart';
+export 'src/marker_clustering.dart';
+export 'src/marker_viewport_culling.dart';
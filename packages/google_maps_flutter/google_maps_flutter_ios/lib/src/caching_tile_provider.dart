@@ -0,0 +1,100 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+import 'package:google_maps_flutter_platform_interface/google_maps_flutter_platform_interface.dart';
+
+/// A [TileProvider] whose tiles are cached natively, in memory and on disk,
+/// so that revisited tiles don't have to be requested from Dart again.
+///
+/// Use it as the [TileOverlay.tileProvider] of a tile overlay. Both caches
+/// evict the least recently used tiles once they exceed their capacity. Tiles
+/// on disk are kept across app restarts until [GoogleMapsFlutterPlatform]'s
+/// `clearTileCache` is called for the overlay.
+@immutable
+class CachingTileProvider implements TileProvider {
+  /// Creates a provider that caches the tiles of [tileProvider].
+  const CachingTileProvider(
+    TileProvider this.tileProvider, {
+    this.memoryCacheCapacity = defaultMemoryCacheCapacity,
+    this.diskCacheCapacity = defaultDiskCacheCapacity,
+  }) : urlTemplate = null;
+
+  /// Creates a provider that fetches tiles from a tile server natively,
+  /// without involving Dart at all.
+  ///
+  /// In [urlTemplate], `{x}`, `{y}` and `{z}` stand for the coordinates and
+  /// zoom level of a tile, for example
+  /// `https://tile.example.com/{z}/{x}/{y}.png`. Servers are expected to
+  /// respond with an encoded image, or with a 404 status for tiles that don't
+  /// exist.
+  const CachingTileProvider.urlTemplate(
+    String this.urlTemplate, {
+    this.memoryCacheCapacity = defaultMemoryCacheCapacity,
+    this.diskCacheCapacity = defaultDiskCacheCapacity,
+  }) : tileProvider = null;
+
+  /// The default [memoryCacheCapacity], 32 MiB.
+  static const int defaultMemoryCacheCapacity = 32 * 1024 * 1024;
+
+  /// The default [diskCacheCapacity], 64 MiB.
+  static const int defaultDiskCacheCapacity = 64 * 1024 * 1024;
+
+  /// The provider whose tiles are cached, unless tiles are fetched from
+  /// [urlTemplate].
+  final TileProvider? tileProvider;
+
+  /// The URL that tiles are fetched from natively, unless they come from
+  /// [tileProvider].
+  final String? urlTemplate;
+
+  /// The maximum number of bytes of decoded tiles kept in memory, or 0 to not
+  /// keep tiles in memory.
+  ///
+  /// A decoded 256x256 tile takes up 256 KiB.
+  final int memoryCacheCapacity;
+
+  /// The maximum number of bytes of tiles kept on disk, or 0 to not keep
+  /// tiles on disk.
+  final int diskCacheCapacity;
+
+  @override
+  Future<Tile> getTile(int x, int y, int? zoom) async {
+    final TileProvider? tileProvider = this.tileProvider;
+    // Tiles from URL templates are fetched natively, so they are never
+    // requested from here.
+    if (tileProvider == null) {
+      return TileProvider.noTile;
+    }
+    return tileProvider.getTile(x, y, zoom);
+  }
+
+  /// Returns the options that the native tile overlay needs to cache and
+  /// fetch tiles.
+  Map<String, Object> toJson() {
+    return <String, Object>{
+      if (urlTemplate != null) 'urlTemplate': urlTemplate!,
+      'tileCache': <String, Object>{
+        'memoryCapacity': memoryCacheCapacity,
+        'diskCapacity': diskCacheCapacity,
+      },
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is CachingTileProvider &&
+        tileProvider == other.tileProvider &&
+        urlTemplate == other.urlTemplate &&
+        memoryCacheCapacity == other.memoryCacheCapacity &&
+        diskCacheCapacity == other.diskCacheCapacity;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+      tileProvider, urlTemplate, memoryCacheCapacity, diskCacheCapacity);
+}
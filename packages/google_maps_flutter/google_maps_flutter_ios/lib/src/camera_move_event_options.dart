@@ -0,0 +1,50 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+import 'package:google_maps_flutter_platform_interface/google_maps_flutter_platform_interface.dart';
+
+/// Options for how often a map reports [CameraMoveEvent]s while its camera
+/// moves.
+///
+/// The map can move the camera as often as the display refreshes, up to 120
+/// times per second. Limiting the events coalesces them: only the latest
+/// camera position is sent once the next event is due, and the final
+/// position is always sent before the [CameraIdleEvent].
+@immutable
+class CameraMoveEventOptions {
+  /// Creates options for camera move events.
+  const CameraMoveEventOptions({
+    this.maxFrequency,
+    this.synchronizeWithDisplay = false,
+  }) : assert(maxFrequency == null || maxFrequency > 0);
+
+  /// The maximum number of events per second, or null to not limit them.
+  final double? maxFrequency;
+
+  /// Whether events are sent when the display refreshes, at most once per
+  /// frame.
+  final bool synchronizeWithDisplay;
+
+  /// Returns the options in the format the native map expects.
+  Object toJson() {
+    return <String, Object>{
+      if (maxFrequency != null) 'maxFrequency': maxFrequency!,
+      'synchronizeWithDisplay': synchronizeWithDisplay,
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is CameraMoveEventOptions &&
+        maxFrequency == other.maxFrequency &&
+        synchronizeWithDisplay == other.synchronizeWithDisplay;
+  }
+
+  @override
+  int get hashCode => Object.hash(maxFrequency, synchronizeWithDisplay);
+}
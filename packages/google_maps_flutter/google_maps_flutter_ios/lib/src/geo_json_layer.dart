@@ -0,0 +1,167 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+import 'package:flutter/painting.dart';
+
+/// How the features of a GeoJSON layer are drawn.
+///
+/// Polygons use all the options, line strings all but [fillColor], and
+/// points, which are drawn as default markers, only [zIndex] and [visible].
+/// Options that are null are left as they are, which lets the style of a
+/// [GeoJsonStyleRule] override only some of them.
+@immutable
+class GeoJsonFeatureStyle {
+  /// Creates a feature style.
+  const GeoJsonFeatureStyle({
+    this.fillColor,
+    this.strokeColor,
+    this.strokeWidth,
+    this.geodesic,
+    this.zIndex,
+    this.visible,
+  });
+
+  /// The color polygons are filled with.
+  final Color? fillColor;
+
+  /// The color of the outlines of polygons and of line strings.
+  final Color? strokeColor;
+
+  /// The width of the outlines of polygons and of line strings, in points.
+  final int? strokeWidth;
+
+  /// Whether the edges of polygons and line strings follow the curvature of
+  /// the Earth.
+  final bool? geodesic;
+
+  /// The order the features are drawn in relative to other overlays.
+  final int? zIndex;
+
+  /// Whether the features are shown.
+  final bool? visible;
+
+  /// Returns the style in the format the native map expects.
+  Object toJson() {
+    return <String, Object>{
+      if (fillColor != null) 'fillColor': fillColor!.value,
+      if (strokeColor != null) 'strokeColor': strokeColor!.value,
+      if (strokeWidth != null) 'strokeWidth': strokeWidth!,
+      if (geodesic != null) 'geodesic': geodesic!,
+      if (zIndex != null) 'zIndex': zIndex!,
+      if (visible != null) 'visible': visible!,
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is GeoJsonFeatureStyle &&
+        fillColor == other.fillColor &&
+        strokeColor == other.strokeColor &&
+        strokeWidth == other.strokeWidth &&
+        geodesic == other.geodesic &&
+        zIndex == other.zIndex &&
+        visible == other.visible;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+      fillColor, strokeColor, strokeWidth, geodesic, zIndex, visible);
+}
+
+/// A rule that styles the features of a GeoJSON layer whose [property] has
+/// the given [value].
+@immutable
+class GeoJsonStyleRule {
+  /// Creates a style rule.
+  const GeoJsonStyleRule({
+    required this.property,
+    required this.value,
+    required this.style,
+  });
+
+  /// The name of the property of the features the rule matches.
+  final String property;
+
+  /// The value of [property] of the features the rule matches.
+  ///
+  /// Numbers match whatever their type, so `1` matches a property of `1.0`.
+  final Object value;
+
+  /// The options that override the style of the layer for matching features.
+  final GeoJsonFeatureStyle style;
+
+  /// Returns the rule in the format the native map expects.
+  Object toJson() {
+    return <String, Object>{
+      'property': property,
+      'value': value,
+      'style': style.toJson(),
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is GeoJsonStyleRule &&
+        property == other.property &&
+        value == other.value &&
+        style == other.style;
+  }
+
+  @override
+  int get hashCode => Object.hash(property, value, style);
+}
+
+/// How the features of a GeoJSON layer are styled.
+///
+/// Each feature is drawn with [style], overridden in turn by the style of
+/// each of the [rules] that matches its properties.
+@immutable
+class GeoJsonLayerStyle {
+  /// Creates a layer style.
+  const GeoJsonLayerStyle({
+    this.style = const GeoJsonFeatureStyle(
+      fillColor: Color(0x40000000),
+      strokeColor: Color(0xFF000000),
+      strokeWidth: 1,
+      geodesic: false,
+      zIndex: 0,
+      visible: true,
+    ),
+    this.rules = const <GeoJsonStyleRule>[],
+  });
+
+  /// The style of the features that no rule overrides.
+  final GeoJsonFeatureStyle style;
+
+  /// The rules that override [style] for some features.
+  final List<GeoJsonStyleRule> rules;
+
+  /// Returns the style in the format the native map expects.
+  Object toJson() {
+    return <String, Object>{
+      'style': style.toJson(),
+      'rules': rules.map((GeoJsonStyleRule rule) => rule.toJson()).toList(),
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is GeoJsonLayerStyle &&
+        style == other.style &&
+        listEquals(rules, other.rules);
+  }
+
+  @override
+  int get hashCode => Object.hash(style, Object.hashAll(rules));
+}
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 import 'dart:async';
+import 'dart:typed_data';
 
 import 'package:flutter/foundation.dart';
 import 'package:flutter/gestures.dart';
@@ -11,7 +12,13 @@ import 'package:flutter/services.dart';
 import 'package:google_maps_flutter_platform_interface/google_maps_flutter_platform_interface.dart';
 import 'package:stream_transform/stream_transform.dart';
 
+import 'caching_tile_provider.dart';
+import 'camera_move_event_options.dart';
 import 'google_map_inspector_ios.dart';
+import 'heatmap.dart';
+import 'map_snapshot_options.dart';
+import 'marker_clustering.dart';
+import 'marker_viewport_culling.dart';
 
 // TODO(stuartmorgan): Remove the dependency on platform interface toJson
 // methods. Channel serialization details should all be package-internal.
@@ -57,10 +64,18 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
     return channel;
   }
 
+  // The channel for the methods that aren't specific to a map.
+  static const MethodChannel _pluginChannel =
+      MethodChannel('plugins.flutter.dev/google_maps_ios');
+
   // Keep a collection of mapId to a map of TileOverlays.
   final Map<int, Map<TileOverlayId, TileOverlay>> _tileOverlays =
       <int, Map<TileOverlayId, TileOverlay>>{};
 
+  // Keep a collection of mapId to a map of Heatmaps.
+  final Map<int, Map<HeatmapId, Heatmap>> _heatmaps =
+      <int, Map<HeatmapId, Heatmap>>{};
+
   /// Returns the channel for [mapId], creating it if it doesn't already exist.
   @visibleForTesting
   MethodChannel ensureChannelInitialized(int mapId) {
@@ -118,6 +133,14 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
     return _events(mapId).whereType<MarkerTapEvent>();
   }
 
+  /// The clusters of markers that are tapped on the map with the given ID.
+  ///
+  /// Only maps with [MarkerClustering] set through [updateMarkerClustering]
+  /// have clusters.
+  Stream<MarkerClusterTapEvent> onMarkerClusterTap({required int mapId}) {
+    return _events(mapId).whereType<MarkerClusterTapEvent>();
+  }
+
   @override
   Stream<InfoWindowTapEvent> onInfoWindowTap({required int mapId}) {
     return _events(mapId).whereType<InfoWindowTapEvent>();
@@ -209,6 +232,24 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
           MarkerId(arguments['markerId']! as String),
         ));
         break;
+      case 'cluster#onTap':
+        final Map<String, Object?> arguments = _getArgumentDictionary(call);
+        final Map<Object?, Object?> bounds =
+            arguments['bounds']! as Map<Object?, Object?>;
+        _mapEventStreamController.add(MarkerClusterTapEvent(
+          mapId,
+          MarkerCluster(
+            position: LatLng.fromJson(arguments['position'])!,
+            bounds: LatLngBounds(
+              southwest: LatLng.fromJson(bounds['southwest'])!,
+              northeast: LatLng.fromJson(bounds['northeast'])!,
+            ),
+            markerIds: (arguments['markerIds']! as List<Object?>)
+                .map((Object? id) => MarkerId(id! as String))
+                .toList(),
+          ),
+        ));
+        break;
       case 'infoWindow#onTap':
         final Map<String, Object?> arguments = _getArgumentDictionary(call);
         _mapEventStreamController.add(InfoWindowTapEvent(
@@ -305,6 +346,64 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
     );
   }
 
+  /// Moves the markers in [positions] to their new positions.
+  ///
+  /// The positions are sent to the platform as packed doubles, which is
+  /// considerably cheaper than changing the markers through [updateMarkers]
+  /// when many markers move at once. The markers keep these positions until
+  /// they are next changed through [updateMarkers]; unknown marker IDs are
+  /// ignored.
+  Future<void> updateMarkerPositions(
+    Map<MarkerId, LatLng> positions, {
+    required int mapId,
+  }) {
+    final List<String> markerIds = <String>[];
+    final Float64List packedPositions = Float64List(positions.length * 2);
+    int index = 0;
+    positions.forEach((MarkerId markerId, LatLng position) {
+      markerIds.add(markerId.value);
+      packedPositions[index++] = position.latitude;
+      packedPositions[index++] = position.longitude;
+    });
+    return _channel(mapId).invokeMethod<void>(
+      'markers#updatePositions',
+      <String, Object>{
+        'markerIds': markerIds,
+        'positions': packedPositions,
+      },
+    );
+  }
+
+  /// Sets how the markers of the map are clustered, or stops clustering them
+  /// if [clustering] is null.
+  ///
+  /// Clusters are computed and drawn natively, and only taps on them are
+  /// reported to Dart, through [onMarkerClusterTap].
+  Future<void> updateMarkerClustering(
+    MarkerClustering? clustering, {
+    required int mapId,
+  }) {
+    return _channel(mapId).invokeMethod<void>(
+      'markers#updateClustering',
+      <String, Object?>{'clustering': clustering?.toJson()},
+    );
+  }
+
+  /// Sets how markers outside the visible region are culled, or stops culling
+  /// them if [culling] is null.
+  ///
+  /// Culling lets maps with many markers only create native markers for the
+  /// ones near the visible region.
+  Future<void> updateMarkerViewportCulling(
+    MarkerViewportCulling? culling, {
+    required int mapId,
+  }) {
+    return _channel(mapId).invokeMethod<void>(
+      'markers#updateViewportCulling',
+      <String, Object?>{'culling': culling?.toJson()},
+    );
+  }
+
   @override
   Future<void> updatePolygons(
     PolygonUpdates polygonUpdates, {
@@ -312,7 +411,14 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
   }) {
     return _channel(mapId).invokeMethod<void>(
       'polygons#update',
-      polygonUpdates.toJson(),
+      <String, Object>{
+        'polygonsToAdd': _serializePolygons(polygonUpdates.polygonsToAdd),
+        'polygonsToChange':
+            _serializePolygons(polygonUpdates.polygonsToChange),
+        'polygonIdsToRemove': polygonUpdates.polygonIdsToRemove
+            .map((PolygonId id) => id.value)
+            .toList(),
+      },
     );
   }
 
@@ -323,7 +429,14 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
   }) {
     return _channel(mapId).invokeMethod<void>(
       'polylines#update',
-      polylineUpdates.toJson(),
+      <String, Object>{
+        'polylinesToAdd': _serializePolylines(polylineUpdates.polylinesToAdd),
+        'polylinesToChange':
+            _serializePolylines(polylineUpdates.polylinesToChange),
+        'polylineIdsToRemove': polylineUpdates.polylineIdsToRemove
+            .map((PolylineId id) => id.value)
+            .toList(),
+      },
     );
   }
 
@@ -353,7 +466,170 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
     _tileOverlays[mapId] = keyTileOverlayId(newTileOverlays);
     return _channel(mapId).invokeMethod<void>(
       'tileOverlays#update',
-      updates.toJson(),
+      <String, Object>{
+        'tileOverlaysToAdd':
+            _serializeTileOverlays(updates.tileOverlaysToAdd),
+        'tileOverlaysToChange':
+            _serializeTileOverlays(updates.tileOverlaysToChange),
+        'tileOverlayIdsToRemove': updates.tileOverlayIdsToRemove
+            .map((TileOverlayId id) => id.value)
+            .toList(),
+      },
+    );
+  }
+
+  /// Prepares the native map services ahead of the first map, so that it
+  /// shows sooner.
+  ///
+  /// If [prewarmMapView] is true, a map view is also created, with [mapStyle]
+  /// already applied, and used for the next map that is created. Setting the
+  /// same style on that map then doesn't parse it again. Call this early,
+  /// for example while the app starts, when the first map is likely to be
+  /// shown soon.
+  Future<void> warmUp({String? mapStyle, bool prewarmMapView = true}) {
+    return _pluginChannel.invokeMethod<void>('maps#warmUp', <String, Object?>{
+      'style': mapStyle,
+      'prewarmMapView': prewarmMapView,
+    });
+  }
+
+  /// Parses [mapStyle] natively once and registers it under [name], so that
+  /// maps can use it with [setMapStyleNamed] without it being sent over the
+  /// platform channel and parsed again.
+  ///
+  /// Registering another style under the same name replaces it for maps that
+  /// set it afterwards. Styles set with [setMapStyle] are also parsed once and
+  /// shared by all maps, but their JSON is sent with every call.
+  ///
+  /// Throws a [MapStyleException] if [mapStyle] is not a valid style.
+  Future<void> registerMapStyle(String name, String mapStyle) async {
+    final String? error = await _pluginChannel.invokeMethod<String>(
+        'mapStyles#register', <String, Object>{
+      'name': name,
+      'style': mapStyle,
+    });
+    if (error != null) {
+      throw MapStyleException(error);
+    }
+  }
+
+  /// Removes the style registered under [name] with [registerMapStyle].
+  ///
+  /// Maps that use the style keep it until their style is set again.
+  Future<void> unregisterMapStyle(String name) {
+    return _pluginChannel.invokeMethod<void>('mapStyles#unregister', name);
+  }
+
+  /// Sets the style of the map to the one registered under [name] with
+  /// [registerMapStyle].
+  ///
+  /// Throws a [MapStyleException] if no style is registered under [name].
+  Future<void> setMapStyleNamed(
+    String name, {
+    required int mapId,
+  }) async {
+    final List<dynamic> successAndError = (await _channel(mapId)
+        .invokeMethod<List<dynamic>>('map#setStyleNamed', name))!;
+    final bool success = successAndError[0] as bool;
+    if (!success) {
+      throw MapStyleException(successAndError[1] as String);
+    }
+  }
+
+  /// Adds a layer drawing the features of a GeoJSON document to the map, or
+  /// replaces the layer with the same [layerId].
+  ///
+  /// The document is given either as its encoded [data], as the [path] of a
+  /// file, or as the key of an [asset], and is read and parsed natively on a
+  /// background thread, so large documents, such as administrative
+  /// boundaries, don't need to be parsed in Dart or sent over the platform
+  /// channel as polygons. Its features are drawn with [style].
+  ///
+  /// Throws a [PlatformException] if the document can't be read or isn't a
+  /// valid GeoJSON document, in which case the layers are left as they were.
+  Future<void> addGeoJsonLayer(
+    String layerId, {
+    Uint8List? data,
+    String? path,
+    String? asset,
+    GeoJsonLayerStyle style = const GeoJsonLayerStyle(),
+    required int mapId,
+  }) {
+    assert(<Object?>[data, path, asset].whereType<Object>().length == 1,
+        'Exactly one of data, path and asset must be given.');
+    return _channel(mapId)
+        .invokeMethod<void>('geoJsonLayers#add', <String, Object?>{
+      'layerId': layerId,
+      'data': data,
+      'path': path,
+      'asset': asset,
+      'style': style.toJson(),
+    });
+  }
+
+  /// Restyles the features of the GeoJSON layer [layerId] with [style],
+  /// without parsing its document again.
+  Future<void> setGeoJsonLayerStyle(
+    String layerId,
+    GeoJsonLayerStyle style, {
+    required int mapId,
+  }) {
+    return _channel(mapId)
+        .invokeMethod<void>('geoJsonLayers#setStyle', <String, Object>{
+      'layerId': layerId,
+      'style': style.toJson(),
+    });
+  }
+
+  /// Removes the GeoJSON layer [layerId] from the map.
+  Future<void> removeGeoJsonLayer(
+    String layerId, {
+    required int mapId,
+  }) {
+    return _channel(mapId).invokeMethod<void>('geoJsonLayers#remove', layerId);
+  }
+
+  /// Renders a snapshot of a map as PNG data, without creating a map view.
+  ///
+  /// Snapshots are rendered natively one at a time with a single offscreen
+  /// map, and cached by their options, so a list can show a map in each of
+  /// its rows as an image rather than as a platform view.
+  Future<Uint8List> renderMapSnapshot(MapSnapshotOptions options) async {
+    return (await _pluginChannel.invokeMethod<Uint8List>(
+        'snapshot#render', options.toJson()))!;
+  }
+
+  /// Updates the heatmaps of the map to [newHeatmaps].
+  ///
+  /// Only the heatmaps that were added, changed or removed since the last
+  /// update are sent to the map. Heatmaps are rendered natively in the
+  /// background, so they can show hundreds of thousands of points.
+  Future<void> updateHeatmaps(
+    Set<Heatmap> newHeatmaps, {
+    required int mapId,
+  }) {
+    final Map<HeatmapId, Heatmap>? currentHeatmaps = _heatmaps[mapId];
+    final Set<Heatmap> previousSet = currentHeatmaps != null
+        ? currentHeatmaps.values.toSet()
+        : <Heatmap>{};
+    final _HeatmapUpdates updates =
+        _HeatmapUpdates.from(previousSet, newHeatmaps);
+    _heatmaps[mapId] = <HeatmapId, Heatmap>{
+      for (final Heatmap heatmap in newHeatmaps) heatmap.heatmapId: heatmap,
+    };
+    return _channel(mapId).invokeMethod<void>(
+      'heatmaps#update',
+      <String, Object>{
+        'heatmapsToAdd': updates.heatmapsToAdd
+            .map((Heatmap heatmap) => heatmap.toJson())
+            .toList(),
+        'heatmapsToChange': updates.heatmapsToChange
+            .map((Heatmap heatmap) => heatmap.toJson())
+            .toList(),
+        'heatmapIdsToRemove': updates.heatmapIdsToRemove
+            .map((HeatmapId id) => id.value)
+            .toList(),
+      },
     );
   }
 
@@ -389,6 +665,20 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
     });
   }
 
+  /// Sets how often the map with the given ID reports [CameraMoveEvent]s
+  /// through [onCameraMove].
+  ///
+  /// By default, every change of the camera is reported.
+  Future<void> setCameraMoveEventOptions(
+    CameraMoveEventOptions options, {
+    required int mapId,
+  }) {
+    return _channel(mapId).invokeMethod<void>(
+      'camera#setMoveEventOptions',
+      options.toJson(),
+    );
+  }
+
   @override
   Future<void> setMapStyle(
     String? mapStyle, {
@@ -491,10 +781,10 @@ class GoogleMapsFlutterIOS extends GoogleMapsFlutterPlatform {
           widgetConfiguration.initialCameraPosition.toMap(),
       'options': mapOptions,
       'markersToAdd': serializeMarkerSet(mapObjects.markers),
-      'polygonsToAdd': serializePolygonSet(mapObjects.polygons),
-      'polylinesToAdd': serializePolylineSet(mapObjects.polylines),
+      'polygonsToAdd': _serializePolygons(mapObjects.polygons),
+      'polylinesToAdd': _serializePolylines(mapObjects.polylines),
       'circlesToAdd': serializeCircleSet(mapObjects.circles),
-      'tileOverlaysToAdd': serializeTileOverlaySet(mapObjects.tileOverlays),
+      'tileOverlaysToAdd': _serializeTileOverlays(mapObjects.tileOverlays),
     };
 
     return UiKitView(
@@ -634,6 +924,68 @@ Map<String, Object> _jsonForMapConfiguration(MapConfiguration config) {
   };
 }
 
+// Polylines and polygons are serialized here rather than with their toJson
+// methods so that their points can be sent as packed doubles, which the
+// native side reads without creating an object per coordinate.
+
+List<Object> _serializePolylines(Set<Polyline> polylines) {
+  return polylines.map((Polyline polyline) {
+    return <String, Object>{
+      'polylineId': polyline.polylineId.value,
+      'consumeTapEvents': polyline.consumeTapEvents,
+      'color': polyline.color.value,
+      'endCap': polyline.endCap.toJson(),
+      'geodesic': polyline.geodesic,
+      'jointType': polyline.jointType.value,
+      'startCap': polyline.startCap.toJson(),
+      'visible': polyline.visible,
+      'width': polyline.width,
+      'zIndex': polyline.zIndex,
+      'points': _packLatLngs(polyline.points),
+      'pattern': polyline.patterns
+          .map((PatternItem pattern) => pattern.toJson())
+          .toList(),
+    };
+  }).toList();
+}
+
+List<Object> _serializePolygons(Set<Polygon> polygons) {
+  return polygons.map((Polygon polygon) {
+    return <String, Object>{
+      'polygonId': polygon.polygonId.value,
+      'consumeTapEvents': polygon.consumeTapEvents,
+      'fillColor': polygon.fillColor.value,
+      'geodesic': polygon.geodesic,
+      'strokeColor': polygon.strokeColor.value,
+      'strokeWidth': polygon.strokeWidth,
+      'visible': polygon.visible,
+      'zIndex': polygon.zIndex,
+      'points': _packLatLngs(polygon.points),
+      'holes': polygon.holes.map(_packLatLngs).toList(),
+    };
+  }).toList();
+}
+
+/// Returns the latitudes and longitudes of [points], interleaved.
+Float64List _packLatLngs(List<LatLng> points) {
+  final Float64List packed = Float64List(points.length * 2);
+  for (int i = 0; i < points.length; i++) {
+    packed[2 * i] = points[i].latitude;
+    packed[2 * i + 1] = points[i].longitude;
+  }
+  return packed;
+}
+
+List<Object> _serializeTileOverlays(Set<TileOverlay> tileOverlays) {
+  return tileOverlays.map((TileOverlay tileOverlay) {
+    final TileProvider? tileProvider = tileOverlay.tileProvider;
+    return <String, Object>{
+      ...tileOverlay.toJson() as Map<String, Object>,
+      if (tileProvider is CachingTileProvider) ...tileProvider.toJson(),
+    };
+  }).toList();
+}
+
 /// Update specification for a set of [TileOverlay]s.
 // TODO(stuartmorgan): Fix the missing export of this class in the platform
 // interface, and remove this copy.
@@ -652,3 +1004,19 @@ class _TileOverlayUpdates extends MapsObjectUpdates<TileOverlay> {
   /// Set of TileOverlays to be changed in this update.
   Set<TileOverlay> get tileOverlaysToChange => objectsToChange;
 }
+
+/// Update specification for a set of [Heatmap]s.
+class _HeatmapUpdates extends MapsObjectUpdates<Heatmap> {
+  /// Computes [_HeatmapUpdates] given previous and current [Heatmap]s.
+  _HeatmapUpdates.from(super.previous, super.current)
+      : super.from(objectName: 'heatmap');
+
+  /// Set of Heatmaps to be added in this update.
+  Set<Heatmap> get heatmapsToAdd => objectsToAdd;
+
+  /// Set of HeatmapIds to be removed in this update.
+  Set<HeatmapId> get heatmapIdsToRemove => objectIdsToRemove.cast<HeatmapId>();
+
+  /// Set of Heatmaps to be changed in this update.
+  Set<Heatmap> get heatmapsToChange => objectsToChange;
+}
@@ -0,0 +1,231 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'dart:typed_data';
+
+import 'package:flutter/foundation.dart';
+import 'package:flutter/painting.dart';
+import 'package:google_maps_flutter_platform_interface/google_maps_flutter_platform_interface.dart';
+
+/// Uniquely identifies a [Heatmap] among the heatmaps of a map.
+@immutable
+class HeatmapId extends MapsObjectId<Heatmap> {
+  /// Creates an immutable identifier for a [Heatmap].
+  const HeatmapId(super.value);
+}
+
+/// A point of a [Heatmap], with the weight it contributes to the heatmap's
+/// intensity.
+@immutable
+class WeightedLatLng {
+  /// Creates a point with the given weight.
+  const WeightedLatLng(this.point, {this.weight = 1});
+
+  /// The position of the point.
+  final LatLng point;
+
+  /// The weight of the point.
+  final double weight;
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is WeightedLatLng &&
+        point == other.point &&
+        weight == other.weight;
+  }
+
+  @override
+  int get hashCode => Object.hash(point, weight);
+}
+
+/// The colors that the intensities of a [Heatmap] are drawn with.
+@immutable
+class HeatmapGradient {
+  /// Creates a gradient that blends between [colors], starting at the
+  /// intensities in [startPoints], from 0 to 1.
+  ///
+  /// The gradient is sampled into [colorMapSize] colors.
+  const HeatmapGradient(
+    this.colors,
+    this.startPoints, {
+    this.colorMapSize = 256,
+  });
+
+  /// The colors of the gradient.
+  final List<Color> colors;
+
+  /// The intensity, from 0 to 1, at which each of [colors] starts, in
+  /// increasing order.
+  final List<double> startPoints;
+
+  /// The number of colors the gradient is sampled into.
+  final int colorMapSize;
+
+  /// Returns the gradient in the format the native heatmap expects.
+  Object toJson() {
+    return <String, Object>{
+      'colors': colors.map((Color color) => color.value).toList(),
+      'startPoints': startPoints,
+      'colorMapSize': colorMapSize,
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is HeatmapGradient &&
+        listEquals(colors, other.colors) &&
+        listEquals(startPoints, other.startPoints) &&
+        colorMapSize == other.colorMapSize;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+      Object.hashAll(colors), Object.hashAll(startPoints), colorMapSize);
+}
+
+/// A layer that draws the density of a set of weighted points.
+///
+/// Heatmaps are rendered natively, tile by tile, in the background, so they
+/// can show hundreds of thousands of points. Add them to a map with
+/// `GoogleMapsFlutterIOS.updateHeatmaps`.
+@immutable
+class Heatmap implements MapsObject<Heatmap> {
+  /// Creates a heatmap of the given points.
+  Heatmap({
+    required HeatmapId heatmapId,
+    required List<WeightedLatLng> data,
+    double radius = 20,
+    double opacity = 0.7,
+    HeatmapGradient gradient = defaultGradient,
+    double? maxIntensity,
+    bool visible = true,
+    int zIndex = 0,
+  }) : this.fromPackedData(
+          heatmapId: heatmapId,
+          packedData: _packWeightedLatLngs(data),
+          radius: radius,
+          opacity: opacity,
+          gradient: gradient,
+          maxIntensity: maxIntensity,
+          visible: visible,
+          zIndex: zIndex,
+        );
+
+  /// Creates a heatmap of points that are already packed, with the latitude,
+  /// longitude and weight of each point in turn.
+  ///
+  /// This avoids creating an object per point for large data sets.
+  const Heatmap.fromPackedData({
+    required this.heatmapId,
+    required this.packedData,
+    this.radius = 20,
+    this.opacity = 0.7,
+    this.gradient = defaultGradient,
+    this.maxIntensity,
+    this.visible = true,
+    this.zIndex = 0,
+  })  : assert(radius > 0),
+        assert(opacity >= 0 && opacity <= 1);
+
+  /// The gradient heatmaps are drawn with unless another is given, from
+  /// green to red.
+  static const HeatmapGradient defaultGradient = HeatmapGradient(
+    <Color>[Color(0xFF66E100), Color(0xFFFF0000)],
+    <double>[0.2, 1],
+  );
+
+  /// Uniquely identifies the heatmap.
+  final HeatmapId heatmapId;
+
+  @override
+  HeatmapId get mapsId => heatmapId;
+
+  /// The latitude, longitude and weight of each point of the heatmap, in
+  /// turn.
+  final Float64List packedData;
+
+  /// The radius, in logical pixels, over which each point is blurred.
+  final double radius;
+
+  /// The opacity of the heatmap, from 0 to 1.
+  final double opacity;
+
+  /// The colors that intensities are drawn with.
+  final HeatmapGradient gradient;
+
+  /// The intensity that is drawn with the last color of [gradient], or null
+  /// to use the highest intensity of the points at each zoom level.
+  final double? maxIntensity;
+
+  /// Whether the heatmap is shown.
+  final bool visible;
+
+  /// The order the heatmap is drawn in, relative to other overlays.
+  final int zIndex;
+
+  @override
+  Heatmap clone() => Heatmap.fromPackedData(
+        heatmapId: heatmapId,
+        packedData: Float64List.fromList(packedData),
+        radius: radius,
+        opacity: opacity,
+        gradient: gradient,
+        maxIntensity: maxIntensity,
+        visible: visible,
+        zIndex: zIndex,
+      );
+
+  @override
+  Object toJson() {
+    return <String, Object>{
+      'heatmapId': heatmapId.value,
+      'data': packedData,
+      'radius': radius,
+      'opacity': opacity,
+      'gradient': gradient.toJson(),
+      if (maxIntensity != null) 'maxIntensity': maxIntensity!,
+      'visible': visible,
+      'zIndex': zIndex,
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (identical(this, other)) {
+      return true;
+    }
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is Heatmap &&
+        heatmapId == other.heatmapId &&
+        (identical(packedData, other.packedData) ||
+            listEquals(packedData, other.packedData)) &&
+        radius == other.radius &&
+        opacity == other.opacity &&
+        gradient == other.gradient &&
+        maxIntensity == other.maxIntensity &&
+        visible == other.visible &&
+        zIndex == other.zIndex;
+  }
+
+  @override
+  int get hashCode => heatmapId.hashCode;
+}
+
+Float64List _packWeightedLatLngs(List<WeightedLatLng> data) {
+  final Float64List packed = Float64List(data.length * 3);
+  for (int i = 0; i < data.length; i++) {
+    packed[3 * i] = data[i].point.latitude;
+    packed[3 * i + 1] = data[i].point.longitude;
+    packed[3 * i + 2] = data[i].weight;
+  }
+  return packed;
+}
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+import 'package:flutter/painting.dart';
+import 'package:google_maps_flutter_platform_interface/google_maps_flutter_platform_interface.dart';
+
+/// Describes a snapshot of a map rendered without a map widget, for example
+/// for the thumbnails of a list.
+///
+/// See `GoogleMapsFlutterIOS.renderMapSnapshot`.
+@immutable
+class MapSnapshotOptions {
+  /// Creates options for a map snapshot.
+  const MapSnapshotOptions({
+    required this.cameraPosition,
+    required this.size,
+    this.mapType = MapType.normal,
+    this.style,
+  });
+
+  /// The camera position the map is rendered from.
+  final CameraPosition cameraPosition;
+
+  /// The size of the snapshot, in logical pixels.
+  ///
+  /// Snapshots are rendered at the scale of the screen.
+  final Size size;
+
+  /// The type of map that is rendered.
+  final MapType mapType;
+
+  /// The JSON style the map is rendered with, or null for the default style.
+  final String? style;
+
+  /// Returns the options in the format the native snapshotter expects.
+  Object toJson() {
+    return <String, Object>{
+      'cameraPosition': cameraPosition.toMap(),
+      'width': size.width,
+      'height': size.height,
+      'mapType': mapType.index,
+      if (style != null) 'style': style!,
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is MapSnapshotOptions &&
+        cameraPosition == other.cameraPosition &&
+        size == other.size &&
+        mapType == other.mapType &&
+        style == other.style;
+  }
+
+  @override
+  int get hashCode => Object.hash(cameraPosition, size, mapType, style);
+}
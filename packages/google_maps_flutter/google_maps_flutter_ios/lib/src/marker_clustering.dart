@@ -0,0 +1,108 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+import 'package:flutter/painting.dart';
+import 'package:google_maps_flutter_platform_interface/google_maps_flutter_platform_interface.dart';
+
+/// Options for clustering the markers of a map natively.
+///
+/// Markers are grouped by a grid of [gridSize] logical pixels laid over the
+/// map at the current zoom level, and every cell with at least
+/// [minimumClusterSize] markers is drawn as a single cluster marker showing
+/// the number of markers in it. Clusters are recomputed natively when the zoom
+/// level or the markers change, so markers don't have to be sent again as the
+/// camera moves. Taps on clusters are reported through
+/// `GoogleMapsFlutterIOS.onMarkerClusterTap`.
+@immutable
+class MarkerClustering {
+  /// Creates clustering options.
+  const MarkerClustering({
+    this.markerIds,
+    this.gridSize = 100,
+    this.minimumClusterSize = 2,
+    this.maxZoom,
+    this.color = const Color(0xFF1E88E5),
+  })  : assert(gridSize > 0),
+        assert(minimumClusterSize > 1);
+
+  /// The markers that are clustered, or null to cluster all markers.
+  final Set<MarkerId>? markerIds;
+
+  /// The size of the cells that markers are grouped by, in logical pixels.
+  final double gridSize;
+
+  /// The smallest number of markers in a cell that are drawn as a cluster.
+  final int minimumClusterSize;
+
+  /// The zoom level above which markers are no longer clustered, or null to
+  /// cluster markers at all zoom levels.
+  final double? maxZoom;
+
+  /// The color of cluster markers.
+  final Color color;
+
+  /// Returns the options in the format the native clustering expects.
+  Object toJson() {
+    return <String, Object>{
+      if (markerIds != null)
+        'markerIds': markerIds!.map((MarkerId id) => id.value).toList(),
+      'gridSize': gridSize,
+      'minimumClusterSize': minimumClusterSize,
+      if (maxZoom != null) 'maxZoom': maxZoom!,
+      'color': color.value,
+    };
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is MarkerClustering &&
+        setEquals(markerIds, other.markerIds) &&
+        gridSize == other.gridSize &&
+        minimumClusterSize == other.minimumClusterSize &&
+        maxZoom == other.maxZoom &&
+        color == other.color;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+      markerIds == null ? null : Object.hashAllUnordered(markerIds!),
+      gridSize,
+      minimumClusterSize,
+      maxZoom,
+      color);
+}
+
+/// A group of markers that is drawn as a single marker.
+@immutable
+class MarkerCluster {
+  /// Creates a cluster of the given markers.
+  const MarkerCluster({
+    required this.position,
+    required this.bounds,
+    required this.markerIds,
+  });
+
+  /// The position of the cluster marker, the average of the positions of the
+  /// markers in the cluster.
+  final LatLng position;
+
+  /// The bounds of the positions of the markers in the cluster.
+  final LatLngBounds bounds;
+
+  /// The markers in the cluster.
+  final List<MarkerId> markerIds;
+}
+
+/// An event fired when a cluster of markers is tapped.
+class MarkerClusterTapEvent extends MapEvent<MarkerCluster> {
+  /// Build a MarkerClusterTap Event triggered from the map represented by
+  /// `mapId`.
+  ///
+  /// The `value` of this event is the [MarkerCluster] that was tapped.
+  MarkerClusterTapEvent(super.mapId, super.value);
+}
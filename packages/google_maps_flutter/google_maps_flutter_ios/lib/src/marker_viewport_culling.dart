@@ -0,0 +1,39 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:flutter/foundation.dart';
+
+/// Options for only creating native markers for the markers near the visible
+/// region of a map.
+///
+/// While markers are culled, the map keeps only the options of the markers
+/// outside the visible region and its margin, and creates native markers for
+/// the others, reusing those of markers that left it, when the camera stops
+/// moving. Memory use and the time it takes to add markers then depend on
+/// how many markers are visible rather than on how many there are.
+@immutable
+class MarkerViewportCulling {
+  /// Creates culling options.
+  const MarkerViewportCulling({this.margin = 0.5}) : assert(margin >= 0);
+
+  /// How far around the visible region markers are still shown, as a fraction
+  /// of the width and height of the visible region on each side.
+  final double margin;
+
+  /// Returns the options in the format the native map expects.
+  Object toJson() {
+    return <String, Object>{'margin': margin};
+  }
+
+  @override
+  bool operator ==(Object other) {
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is MarkerViewportCulling && margin == other.margin;
+  }
+
+  @override
+  int get hashCode => margin.hashCode;
+}
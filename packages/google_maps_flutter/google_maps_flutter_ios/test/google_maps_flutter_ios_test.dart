@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 import 'dart:async';
+import 'dart:convert';
+import 'dart:typed_data';
 
 import 'package:async/async.dart';
 import 'package:flutter/services.dart';
@@ -129,6 +131,473 @@ void main() {
         equals('drag-end-marker'));
   });
 
+  test('updateMarkerPositions sends packed positions', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+
+    await maps.updateMarkerPositions(<MarkerId, LatLng>{
+      const MarkerId('a'): const LatLng(1, 2),
+      const MarkerId('b'): const LatLng(3, 4),
+    }, mapId: mapId);
+
+    expect(log, <String>['markers#updatePositions']);
+    final Map<Object?, Object?> arguments =
+        calls.single.arguments as Map<Object?, Object?>;
+    expect(arguments['markerIds'], <String>['a', 'b']);
+    expect(arguments['positions'], isA<Float64List>());
+    expect(arguments['positions'], <double>[1, 2, 3, 4]);
+  });
+
+  test('updateMarkerClustering sends clustering options', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+
+    await maps.updateMarkerClustering(
+        const MarkerClustering(
+          markerIds: <MarkerId>{MarkerId('a')},
+          gridSize: 60,
+          maxZoom: 15,
+        ),
+        mapId: mapId);
+    await maps.updateMarkerClustering(null, mapId: mapId);
+
+    expect(log, <String>[
+      'markers#updateClustering',
+      'markers#updateClustering',
+    ]);
+    expect(calls[0].arguments, <String, Object?>{
+      'clustering': <String, Object>{
+        'markerIds': <String>['a'],
+        'gridSize': 60.0,
+        'minimumClusterSize': 2,
+        'maxZoom': 15.0,
+        'color': 0xFF1E88E5,
+      },
+    });
+    expect(calls[1].arguments, <String, Object?>{'clustering': null});
+  });
+
+  test('updateMarkerViewportCulling sends culling options', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+
+    await maps.updateMarkerViewportCulling(
+        const MarkerViewportCulling(margin: 0.25),
+        mapId: mapId);
+    await maps.updateMarkerViewportCulling(null, mapId: mapId);
+
+    expect(log, <String>[
+      'markers#updateViewportCulling',
+      'markers#updateViewportCulling',
+    ]);
+    expect(calls[0].arguments, <String, Object?>{
+      'culling': <String, Object>{'margin': 0.25},
+    });
+    expect(calls[1].arguments, <String, Object?>{'culling': null});
+  });
+
+  test('cluster taps are sent to the cluster tap stream', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    maps.ensureChannelInitialized(mapId);
+    final StreamQueue<MarkerClusterTapEvent> clusterTapStream =
+        StreamQueue<MarkerClusterTapEvent>(
+            maps.onMarkerClusterTap(mapId: mapId));
+
+    await sendPlatformMessage(mapId, 'cluster#onTap', <dynamic, dynamic>{
+      'position': <double>[1.5, 2.5],
+      'bounds': <dynamic, dynamic>{
+        'southwest': <double>[1.0, 2.0],
+        'northeast': <double>[2.0, 3.0],
+      },
+      'markerIds': <String>['a', 'b'],
+    });
+
+    final MarkerCluster cluster = (await clusterTapStream.next).value;
+    expect(cluster.position, const LatLng(1.5, 2.5));
+    expect(
+        cluster.bounds,
+        LatLngBounds(
+          southwest: const LatLng(1.0, 2.0),
+          northeast: const LatLng(2.0, 3.0),
+        ));
+    expect(cluster.markerIds, <MarkerId>[
+      const MarkerId('a'),
+      const MarkerId('b'),
+    ]);
+  });
+
+  test('setCameraMoveEventOptions sends the options', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+
+    await maps.setCameraMoveEventOptions(
+        const CameraMoveEventOptions(
+            maxFrequency: 30, synchronizeWithDisplay: true),
+        mapId: mapId);
+    await maps.setCameraMoveEventOptions(const CameraMoveEventOptions(),
+        mapId: mapId);
+
+    expect(log, <String>[
+      'camera#setMoveEventOptions',
+      'camera#setMoveEventOptions',
+    ]);
+    expect(calls[0].arguments, <String, Object>{
+      'maxFrequency': 30.0,
+      'synchronizeWithDisplay': true,
+    });
+    expect(calls[1].arguments, <String, Object>{
+      'synchronizeWithDisplay': false,
+    });
+  });
+
+  test('polylines and polygons send packed points', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+    const List<LatLng> points = <LatLng>[LatLng(1, 2), LatLng(3, 4)];
+
+    await maps.updatePolylines(
+        PolylineUpdates.from(<Polyline>{}, <Polyline>{
+          const Polyline(polylineId: PolylineId('line'), points: points),
+        }),
+        mapId: mapId);
+    await maps.updatePolygons(
+        PolygonUpdates.from(<Polygon>{}, <Polygon>{
+          const Polygon(
+            polygonId: PolygonId('shape'),
+            points: points,
+            holes: <List<LatLng>>[points],
+          ),
+        }),
+        mapId: mapId);
+
+    expect(log, <String>['polylines#update', 'polygons#update']);
+    final Map<Object?, Object?> polyline = ((calls[0].arguments
+            as Map<Object?, Object?>)['polylinesToAdd']! as List<Object?>)
+        .single! as Map<Object?, Object?>;
+    expect(polyline['polylineId'], 'line');
+    expect(polyline['points'], isA<Float64List>());
+    expect(polyline['points'], <double>[1, 2, 3, 4]);
+    final Map<Object?, Object?> polygon = ((calls[1].arguments
+            as Map<Object?, Object?>)['polygonsToAdd']! as List<Object?>)
+        .single! as Map<Object?, Object?>;
+    expect(polygon['polygonId'], 'shape');
+    expect(polygon['points'], <double>[1, 2, 3, 4]);
+    expect(polygon['holes'], <List<double>>[
+      <double>[1, 2, 3, 4]
+    ]);
+  });
+
+  test('updateHeatmaps sends only the heatmaps that changed', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+
+    final Heatmap a = Heatmap(
+      heatmapId: const HeatmapId('a'),
+      data: const <WeightedLatLng>[
+        WeightedLatLng(LatLng(1, 2)),
+        WeightedLatLng(LatLng(3, 4), weight: 5),
+      ],
+    );
+    final Heatmap b = Heatmap.fromPackedData(
+      heatmapId: const HeatmapId('b'),
+      packedData: Float64List.fromList(<double>[6, 7, 1]),
+      radius: 30,
+    );
+    await maps.updateHeatmaps(<Heatmap>{a, b}, mapId: mapId);
+    await maps.updateHeatmaps(<Heatmap>{a}, mapId: mapId);
+
+    expect(log, <String>['heatmaps#update', 'heatmaps#update']);
+    final Map<dynamic, dynamic> added =
+        calls[0].arguments as Map<dynamic, dynamic>;
+    final List<dynamic> heatmapsToAdd = added['heatmapsToAdd'] as List<dynamic>;
+    expect(heatmapsToAdd, hasLength(2));
+    final Map<dynamic, dynamic> heatmapA = heatmapsToAdd
+        .cast<Map<dynamic, dynamic>>()
+        .firstWhere((Map<dynamic, dynamic> heatmap) =>
+            heatmap['heatmapId'] == 'a');
+    expect(heatmapA['data'], isA<Float64List>());
+    expect(heatmapA['data'], <double>[1, 2, 1, 3, 4, 5]);
+    expect(heatmapA['radius'], 20.0);
+    expect(calls[1].arguments, <String, Object>{
+      'heatmapsToAdd': <Object>[],
+      'heatmapsToChange': <Object>[],
+      'heatmapIdsToRemove': <String>['b'],
+    });
+  });
+
+  test('renderMapSnapshot sends the options on the plugin channel', () async {
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final Uint8List png = Uint8List.fromList(<int>[1, 2, 3]);
+    final List<MethodCall> calls = <MethodCall>[];
+    _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+        .defaultBinaryMessenger
+        .setMockMethodCallHandler(
+      const MethodChannel('plugins.flutter.dev/google_maps_ios'),
+      (MethodCall methodCall) async {
+        calls.add(methodCall);
+        return png;
+      },
+    );
+
+    final Uint8List snapshot = await maps.renderMapSnapshot(
+      const MapSnapshotOptions(
+        cameraPosition: CameraPosition(target: LatLng(1, 2), zoom: 12),
+        size: Size(120, 80),
+        style: '[]',
+      ),
+    );
+
+    expect(snapshot, png);
+    expect(calls.single.method, 'snapshot#render');
+    final Map<dynamic, dynamic> arguments =
+        calls.single.arguments as Map<dynamic, dynamic>;
+    expect(arguments['width'], 120.0);
+    expect(arguments['height'], 80.0);
+    expect(arguments['mapType'], MapType.normal.index);
+    expect(arguments['style'], '[]');
+    expect((arguments['cameraPosition'] as Map<dynamic, dynamic>)['zoom'],
+        12.0);
+  });
+
+  test('warmUp sends the style on the plugin channel', () async {
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+        .defaultBinaryMessenger
+        .setMockMethodCallHandler(
+      const MethodChannel('plugins.flutter.dev/google_maps_ios'),
+      (MethodCall methodCall) async {
+        calls.add(methodCall);
+        return null;
+      },
+    );
+
+    await maps.warmUp(mapStyle: '[]');
+    await maps.warmUp(prewarmMapView: false);
+
+    expect(calls.map((MethodCall call) => call.method),
+        <String>['maps#warmUp', 'maps#warmUp']);
+    expect(calls[0].arguments, <String, Object?>{
+      'style': '[]',
+      'prewarmMapView': true,
+    });
+    expect(calls[1].arguments, <String, Object?>{
+      'style': null,
+      'prewarmMapView': false,
+    });
+  });
+
+  test('registered map styles are referenced by name', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> pluginCalls = <MethodCall>[];
+    _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+        .defaultBinaryMessenger
+        .setMockMethodCallHandler(
+      const MethodChannel('plugins.flutter.dev/google_maps_ios'),
+      (MethodCall methodCall) async {
+        pluginCalls.add(methodCall);
+        return null;
+      },
+    );
+    final List<MethodCall> mapCalls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      mapCalls.add(methodCall);
+      return <Object>[true];
+    });
+
+    await maps.registerMapStyle('dark', '[]');
+    await maps.setMapStyleNamed('dark', mapId: mapId);
+    await maps.unregisterMapStyle('dark');
+
+    expect(pluginCalls.map((MethodCall call) => call.method),
+        <String>['mapStyles#register', 'mapStyles#unregister']);
+    expect(pluginCalls[0].arguments,
+        <String, Object?>{'name': 'dark', 'style': '[]'});
+    expect(pluginCalls[1].arguments, 'dark');
+    expect(mapCalls.single.method, 'map#setStyleNamed');
+    expect(mapCalls.single.arguments, 'dark');
+  });
+
+  test('registering an invalid map style throws', () async {
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+        .defaultBinaryMessenger
+        .setMockMethodCallHandler(
+      const MethodChannel('plugins.flutter.dev/google_maps_ios'),
+      (MethodCall methodCall) async => 'Invalid style',
+    );
+
+    expect(() => maps.registerMapStyle('broken', '{'),
+        throwsA(isA<MapStyleException>()));
+  });
+
+  test('GeoJSON layers send their document and style', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+    final Uint8List data = Uint8List.fromList(utf8.encode('{}'));
+    const GeoJsonLayerStyle style = GeoJsonLayerStyle(
+      style: GeoJsonFeatureStyle(fillColor: Color(0x80FF0000), strokeWidth: 2),
+      rules: <GeoJsonStyleRule>[
+        GeoJsonStyleRule(
+          property: 'admin_level',
+          value: 4,
+          style: GeoJsonFeatureStyle(visible: false),
+        ),
+      ],
+    );
+
+    await maps.addGeoJsonLayer('regions',
+        data: data, style: style, mapId: mapId);
+    await maps.setGeoJsonLayerStyle('regions', const GeoJsonLayerStyle(),
+        mapId: mapId);
+    await maps.removeGeoJsonLayer('regions', mapId: mapId);
+
+    expect(calls.map((MethodCall call) => call.method), <String>[
+      'geoJsonLayers#add',
+      'geoJsonLayers#setStyle',
+      'geoJsonLayers#remove',
+    ]);
+    expect(calls[0].arguments, <String, Object?>{
+      'layerId': 'regions',
+      'data': data,
+      'path': null,
+      'asset': null,
+      'style': <String, Object>{
+        'style': <String, Object>{'fillColor': 0x80FF0000, 'strokeWidth': 2},
+        'rules': <Object>[
+          <String, Object>{
+            'property': 'admin_level',
+            'value': 4,
+            'style': <String, Object>{'visible': false},
+          },
+        ],
+      },
+    });
+    expect(
+        (calls[1].arguments as Map<dynamic, dynamic>)['style'],
+        <String, Object>{
+          'style': <String, Object>{
+            'fillColor': 0x40000000,
+            'strokeColor': 0xFF000000,
+            'strokeWidth': 1,
+            'geodesic': false,
+            'zIndex': 0,
+            'visible': true,
+          },
+          'rules': <Object>[],
+        });
+    expect(calls[2].arguments, 'regions');
+  });
+
+  test('invalid GeoJSON layers throw', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      throw PlatformException(code: 'Invalid GeoJSON');
+    });
+
+    expect(
+        () => maps.addGeoJsonLayer('broken',
+            path: '/missing.geojson', mapId: mapId),
+        throwsA(isA<PlatformException>()));
+  });
+
+  test('caching tile providers send their options', () async {
+    const int mapId = 1;
+    final GoogleMapsFlutterIOS maps = GoogleMapsFlutterIOS();
+    final List<MethodCall> calls = <MethodCall>[];
+    configureMockMap(maps, mapId: mapId,
+        handler: (MethodCall methodCall) async {
+      calls.add(methodCall);
+      return null;
+    });
+
+    await maps.updateTileOverlays(newTileOverlays: <TileOverlay>{
+      const TileOverlay(
+        tileOverlayId: TileOverlayId('url'),
+        tileProvider: CachingTileProvider.urlTemplate(
+          'https://tile.example.com/{z}/{x}/{y}.png',
+          diskCacheCapacity: 0,
+        ),
+      ),
+      const TileOverlay(tileOverlayId: TileOverlayId('plain')),
+    }, mapId: mapId);
+
+    final Map<Object?, Object?> arguments =
+        calls.single.arguments as Map<Object?, Object?>;
+    final List<Object?> tileOverlaysToAdd =
+        arguments['tileOverlaysToAdd']! as List<Object?>;
+    final Map<Object?, Object?> urlTileOverlay = tileOverlaysToAdd
+        .cast<Map<Object?, Object?>>()
+        .firstWhere((Map<Object?, Object?> json) =>
+            json['tileOverlayId'] == 'url');
+    expect(urlTileOverlay['urlTemplate'],
+        'https://tile.example.com/{z}/{x}/{y}.png');
+    expect(urlTileOverlay['tileCache'], <String, Object>{
+      'memoryCapacity': CachingTileProvider.defaultMemoryCacheCapacity,
+      'diskCapacity': 0,
+    });
+    final Map<Object?, Object?> plainTileOverlay = tileOverlaysToAdd
+        .cast<Map<Object?, Object?>>()
+        .firstWhere((Map<Object?, Object?> json) =>
+            json['tileOverlayId'] == 'plain');
+    expect(plainTileOverlay.containsKey('urlTemplate'), isFalse);
+    expect(plainTileOverlay.containsKey('tileCache'), isFalse);
+  });
+
+  test('caching tile providers get tiles from the wrapped provider', () async {
+    const Tile tile = Tile(256, 256, null);
+    final CachingTileProvider tileProvider =
+        CachingTileProvider(_FakeTileProvider(tile));
+    expect(await tileProvider.getTile(1, 2, 3), tile);
+  });
+
   testWidgets('cloudMapId is passed', (WidgetTester tester) async {
     const String cloudMapId = '000000000000000'; // Dummy map ID.
     final Completer<String> passedCloudMapIdCompleter = Completer<String>();
@@ -180,6 +649,15 @@ void main() {
   });
 }
 
+class _FakeTileProvider implements TileProvider {
+  _FakeTileProvider(this.tile);
+
+  final Tile tile;
+
+  @override
+  Future<Tile> getTile(int x, int y, int? zoom) async => tile;
+}
+
 /// This allows a value of type T or T? to be treated as a value of type T?.
 ///
 /// We use this so that APIs that have become non-nullable can still be used
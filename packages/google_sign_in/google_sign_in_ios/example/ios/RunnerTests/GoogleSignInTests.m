@@ -87,7 +87,8 @@
   FSIInitParams *params = [FSIInitParams makeWithScopes:@[]
                                            hostedDomain:nil
                                                clientId:nil
-                                         serverClientId:nil];
+                                         serverClientId:nil
+                               refreshTokensProactively:NO];
 
   FlutterError *error;
   [self.plugin initializeSignInWithParameters:params error:&error];
@@ -100,7 +101,8 @@
   FSIInitParams *params = [FSIInitParams makeWithScopes:@[]
                                            hostedDomain:@"example.com"
                                                clientId:nil
-                                         serverClientId:nil];
+                                         serverClientId:nil
+                               refreshTokensProactively:NO];
 
   FlutterError *error;
   [self.plugin initializeSignInWithParameters:params error:&error];
@@ -131,7 +133,8 @@
   FSIInitParams *params = [FSIInitParams makeWithScopes:@[]
                                            hostedDomain:nil
                                                clientId:@"mockClientId"
-                                         serverClientId:nil];
+                                         serverClientId:nil
+                               refreshTokensProactively:NO];
 
   FlutterError *error;
   [self.plugin initializeSignInWithParameters:params error:&error];
@@ -157,7 +160,8 @@
   FSIInitParams *params = [FSIInitParams makeWithScopes:@[]
                                            hostedDomain:nil
                                                clientId:nil
-                                         serverClientId:@"mockServerClientId"];
+                                         serverClientId:@"mockServerClientId"
+                               refreshTokensProactively:NO];
   FlutterError *error;
   [self.plugin initializeSignInWithParameters:params error:&error];
   XCTAssertNil(error);
@@ -183,7 +187,8 @@
   FSIInitParams *params = [FSIInitParams makeWithScopes:@[ @"scope1" ]
                                            hostedDomain:@"example.com"
                                                clientId:nil
-                                         serverClientId:nil];
+                                         serverClientId:nil
+                               refreshTokensProactively:NO];
 
   FlutterError *error;
   self.plugin = [[FLTGoogleSignInPlugin alloc] init];
@@ -259,6 +264,92 @@
   [self waitForExpectationsWithTimeout:5.0 handler:nil];
 }
 
+- (void)testSignInSilentlyUsesSignInRestoredAtLaunch {
+  id mockUser = OCMClassMock([GIDGoogleUser class]);
+  OCMStub([mockUser userID]).andReturn(@"mockID");
+  __block NSUInteger restoreCount = 0;
+  OCMStub([self.mockSignIn restorePreviousSignInWithCompletion:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        restoreCount++;
+        void (^completion)(GIDGoogleUser *, NSError *);
+        [invocation getArgument:&completion atIndex:2];
+        completion(mockUser, nil);
+      });
+
+  [self.plugin restorePreviousSignInAtLaunch];
+  XCTAssertEqual(restoreCount, 1);
+
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+  [self.plugin signInSilentlyWithCompletion:^(FSIUserData *user, FlutterError *error) {
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(user.userId, @"mockID");
+    [expectation fulfill];
+  }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+  XCTAssertEqual(restoreCount, 1);
+
+  // The restored sign in is only used once.
+  expectation = [self expectationWithDescription:@"second completion called"];
+  [self.plugin signInSilentlyWithCompletion:^(FSIUserData *user, FlutterError *error) {
+    [expectation fulfill];
+  }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+  XCTAssertEqual(restoreCount, 2);
+}
+
+- (void)testSignInSilentlyWaitsForSignInRestoredAtLaunch {
+  id mockUser = OCMClassMock([GIDGoogleUser class]);
+  OCMStub([mockUser userID]).andReturn(@"mockID");
+  __block NSUInteger restoreCount = 0;
+  __block void (^restoreCompletion)(GIDGoogleUser *, NSError *);
+  OCMStub([self.mockSignIn restorePreviousSignInWithCompletion:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        restoreCount++;
+        void (^completion)(GIDGoogleUser *, NSError *);
+        [invocation getArgument:&completion atIndex:2];
+        restoreCompletion = completion;
+      });
+
+  [self.plugin restorePreviousSignInAtLaunch];
+  __block BOOL completed = NO;
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+  [self.plugin signInSilentlyWithCompletion:^(FSIUserData *user, FlutterError *error) {
+    XCTAssertEqualObjects(user.userId, @"mockID");
+    completed = YES;
+    [expectation fulfill];
+  }];
+  XCTAssertFalse(completed);
+
+  restoreCompletion(mockUser, nil);
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+  XCTAssertEqual(restoreCount, 1);
+}
+
+- (void)testSignOutDiscardsSignInRestoredAtLaunch {
+  __block NSUInteger restoreCount = 0;
+  OCMStub([self.mockSignIn restorePreviousSignInWithCompletion:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        restoreCount++;
+        void (^completion)(GIDGoogleUser *, NSError *);
+        [invocation getArgument:&completion atIndex:2];
+        completion(nil, [NSError errorWithDomain:kGIDSignInErrorDomain
+                                            code:kGIDSignInErrorCodeHasNoAuthInKeychain
+                                        userInfo:nil]);
+      });
+
+  [self.plugin restorePreviousSignInAtLaunch];
+  FlutterError *signOutError;
+  [self.plugin signOutWithError:&signOutError];
+
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+  [self.plugin signInSilentlyWithCompletion:^(FSIUserData *user, FlutterError *error) {
+    XCTAssertEqualObjects(error.code, @"sign_in_required");
+    [expectation fulfill];
+  }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+  XCTAssertEqual(restoreCount, 2);
+}
+
 #pragma mark - Sign in
 
 - (void)testSignIn {
@@ -312,7 +403,8 @@
       initializeSignInWithParameters:[FSIInitParams makeWithScopes:@[ @"initial1", @"initial2" ]
                                                       hostedDomain:nil
                                                           clientId:nil
-                                                    serverClientId:nil]
+                                                    serverClientId:nil
+                                          refreshTokensProactively:NO]
                                error:&error];
 
   id mockUser = OCMClassMock([GIDGoogleUser class]);
@@ -513,6 +605,130 @@
   [self waitForExpectationsWithTimeout:5.0 handler:nil];
 }
 
+- (void)testGetTokensWithoutCurrentUser {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+  [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+    XCTAssertNil(token);
+    XCTAssertEqualObjects(error.code, @"sign_in_required");
+    [expectation fulfill];
+  }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+}
+
+- (void)testGetTokensReturnsCachedTokens {
+  NSUInteger refreshCount = 0;
+  id mockUser = [self mockUserWithTokensExpiringIn:3600 refreshCount:&refreshCount];
+  OCMStub([self.mockSignIn currentUser]).andReturn(mockUser);
+
+  for (int i = 0; i < 2; i++) {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+    [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+      XCTAssertNil(error);
+      XCTAssertEqualObjects(token.accessToken, @"mockAccessToken");
+      [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+  }
+  XCTAssertEqual(refreshCount, 1);
+}
+
+- (void)testGetTokensRefreshesTokensThatExpireSoon {
+  NSUInteger refreshCount = 0;
+  id mockUser = [self mockUserWithTokensExpiringIn:30 refreshCount:&refreshCount];
+  OCMStub([self.mockSignIn currentUser]).andReturn(mockUser);
+
+  for (int i = 0; i < 2; i++) {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+    [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+      [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5.0 handler:nil];
+  }
+  XCTAssertEqual(refreshCount, 2);
+}
+
+- (void)testSignOutClearsCachedTokens {
+  NSUInteger refreshCount = 0;
+  id mockUser = [self mockUserWithTokensExpiringIn:3600 refreshCount:&refreshCount];
+  OCMStub([self.mockSignIn currentUser]).andReturn(mockUser);
+
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+  [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+    [expectation fulfill];
+  }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+  FlutterError *signOutError;
+  [self.plugin signOutWithError:&signOutError];
+
+  expectation = [self expectationWithDescription:@"completion called after sign out"];
+  [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+    [expectation fulfill];
+  }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+  XCTAssertEqual(refreshCount, 2);
+}
+
+- (void)testConcurrentGetTokensShareRefresh {
+  id mockUser = OCMClassMock([GIDGoogleUser class]);
+  id mockAccessToken = OCMClassMock([GIDToken class]);
+  OCMStub([mockAccessToken tokenString]).andReturn(@"mockAccessToken");
+  OCMStub([mockUser accessToken]).andReturn(mockAccessToken);
+  OCMStub([self.mockSignIn currentUser]).andReturn(mockUser);
+
+  __block NSUInteger refreshCount = 0;
+  __block void (^refreshCompletion)(GIDGoogleUser *, NSError *);
+  OCMStub([mockUser refreshTokensIfNeededWithCompletion:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        refreshCount++;
+        void (^completion)(GIDGoogleUser *, NSError *);
+        [invocation getArgument:&completion atIndex:2];
+        refreshCompletion = completion;
+      });
+
+  XCTestExpectation *firstExpectation = [self expectationWithDescription:@"first completion"];
+  [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+    XCTAssertEqualObjects(token.accessToken, @"mockAccessToken");
+    [firstExpectation fulfill];
+  }];
+  XCTestExpectation *secondExpectation = [self expectationWithDescription:@"second completion"];
+  [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+    XCTAssertEqualObjects(token.accessToken, @"mockAccessToken");
+    [secondExpectation fulfill];
+  }];
+
+  XCTAssertEqual(refreshCount, 1);
+  refreshCompletion(mockUser, nil);
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+}
+
+- (void)testProactiveRefreshIsScheduledBeforeTokensExpire {
+  FlutterError *initError;
+  [self.plugin initializeSignInWithParameters:[FSIInitParams makeWithScopes:@[]
+                                                               hostedDomain:nil
+                                                                   clientId:nil
+                                                             serverClientId:nil
+                                                   refreshTokensProactively:YES]
+                                        error:&initError];
+  NSUInteger refreshCount = 0;
+  id mockUser = [self mockUserWithTokensExpiringIn:3600 refreshCount:&refreshCount];
+  OCMStub([self.mockSignIn currentUser]).andReturn(mockUser);
+
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completion called"];
+  [self.plugin getAccessTokenWithCompletion:^(FSITokenData *token, FlutterError *error) {
+    [expectation fulfill];
+  }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+  XCTAssertTrue(self.plugin.proactiveTokenRefreshTimer.valid);
+  XCTAssertEqualWithAccuracy(
+      [self.plugin.proactiveTokenRefreshTimer.fireDate timeIntervalSinceNow], 3600 - 55, 5);
+
+  [self.plugin signOutWithError:&initError];
+  XCTAssertNil(self.plugin.proactiveTokenRefreshTimer);
+}
+
+#pragma mark - Request scopes
 #pragma mark - Request scopes
 
 - (void)testRequestScopesResultErrorIfNotSignedIn {
@@ -634,7 +850,8 @@
   FSIInitParams *params = [FSIInitParams makeWithScopes:@[ @"initial1", @"initial2" ]
                                            hostedDomain:nil
                                                clientId:nil
-                                         serverClientId:nil];
+                                         serverClientId:nil
+                               refreshTokensProactively:NO];
   FlutterError *error;
   [self.plugin initializeSignInWithParameters:params error:&error];
   XCTAssertNil(error);
@@ -680,4 +897,33 @@
   [self waitForExpectationsWithTimeout:5.0 handler:nil];
 }
 
+#pragma mark - Helpers
+
+// Returns a mock user whose tokens expire in |expiresIn| seconds, and which increments
+// |refreshCount| each time its tokens are refreshed.
+- (id)mockUserWithTokensExpiringIn:(NSTimeInterval)expiresIn
+                      refreshCount:(NSUInteger *)refreshCount {
+  id mockUser = OCMClassMock([GIDGoogleUser class]);
+  NSDate *expirationDate = [NSDate dateWithTimeIntervalSinceNow:expiresIn];
+
+  id mockIdToken = OCMClassMock([GIDToken class]);
+  OCMStub([mockIdToken tokenString]).andReturn(@"mockIdToken");
+  OCMStub([mockIdToken expirationDate]).andReturn(expirationDate);
+  OCMStub([mockUser idToken]).andReturn(mockIdToken);
+
+  id mockAccessToken = OCMClassMock([GIDToken class]);
+  OCMStub([mockAccessToken tokenString]).andReturn(@"mockAccessToken");
+  OCMStub([mockAccessToken expirationDate]).andReturn(expirationDate);
+  OCMStub([mockUser accessToken]).andReturn(mockAccessToken);
+
+  OCMStub([mockUser refreshTokensIfNeededWithCompletion:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        (*refreshCount)++;
+        void (^completion)(GIDGoogleUser *, NSError *);
+        [invocation getArgument:&completion atIndex:2];
+        completion(mockUser, nil);
+      });
+  return mockUser;
+}
+
 @end
@@ -14,6 +14,11 @@ static NSString *const kClientIdKey = @"CLIENT_ID";
 
 static NSString *const kServerClientIdKey = @"SERVER_CLIENT_ID";
 
+// The key within the app's Info.plist that enables restoring the previous sign in when the plugin
+// is registered, before Dart asks for it.
+static NSString *const kRestorePreviousSignInAtLaunchKey =
+    @"FLTGoogleSignInRestorePreviousSignInAtLaunch";
+
 static NSDictionary<NSString *, id> *loadGoogleServiceInfo(void) {
   NSString *plistPath = [[NSBundle mainBundle] pathForResource:@"GoogleService-Info"
                                                         ofType:@"plist"];
@@ -29,6 +34,17 @@ static NSString *const kErrorReasonSignInCanceled = @"sign_in_canceled";
 static NSString *const kErrorReasonNetworkError = @"network_error";
 static NSString *const kErrorReasonSignInFailed = @"sign_in_failed";
 
+// The SDK refreshes the tokens when they expire in less time than this, so cached tokens are only
+// returned while they are valid for longer.
+static const NSTimeInterval kTokenRefreshWindow = 60;
+
+// How long before the tokens expire they are refreshed when refreshing proactively. This has to be
+// inside the SDK's refresh window, or the SDK would return the current tokens.
+static const NSTimeInterval kProactiveTokenRefreshLeadTime = 55;
+
+typedef void (^FSITokenCompletion)(FSITokenData *_Nullable, FlutterError *_Nullable);
+typedef void (^FSIUserDataCompletion)(FSIUserData *_Nullable, FlutterError *_Nullable);
+
 static FlutterError *getFlutterError(NSError *error) {
   NSString *errorCode;
   if (error.code == kGIDSignInErrorCodeHasNoAuthInKeychain) {
@@ -50,6 +66,27 @@ static FlutterError *getFlutterError(NSError *error) {
 // The contents of GoogleService-Info.plist, if it exists.
 @property(strong, nullable) NSDictionary<NSString *, id> *googleServiceProperties;
 
+// The tokens returned by the last successful refresh, the user they belong to, and the time at
+// which the first of them expires.
+@property(strong, nullable) FSITokenData *cachedTokenData;
+@property(strong, nullable) GIDGoogleUser *cachedTokenUser;
+@property(strong, nullable) NSDate *cachedTokenExpirationDate;
+
+// The completions waiting for the token refresh in flight, or nil if there is none.
+@property(strong, nullable) NSMutableArray<FSITokenCompletion> *pendingTokenCompletions;
+
+// Whether the tokens are refreshed shortly before they expire.
+@property(assign) BOOL refreshTokensProactively;
+
+// The silent sign in calls waiting for the sign in restored at launch, or nil if it is not in
+// progress or its result is no longer wanted.
+@property(strong, nullable) NSMutableArray<FSIUserDataCompletion> *pendingRestoredSignInCompletions;
+
+// The result of the sign in restored at launch, until it is returned by a silent sign in.
+@property(assign) BOOL hasRestoredSignInResult;
+@property(strong, nullable) GIDGoogleUser *restoredSignInUser;
+@property(strong, nullable) NSError *restoredSignInError;
+
 // Redeclared as not a designated initializer.
 - (instancetype)init;
 
@@ -61,6 +98,10 @@ static FlutterError *getFlutterError(NSError *error) {
   FLTGoogleSignInPlugin *instance = [[FLTGoogleSignInPlugin alloc] init];
   [registrar addApplicationDelegate:instance];
   FSIGoogleSignInApiSetup(registrar.messenger, instance);
+  if ([[NSBundle.mainBundle objectForInfoDictionaryKey:kRestorePreviousSignInAtLaunchKey]
+          boolValue]) {
+    [instance restorePreviousSignInAtLaunch];
+  }
 }
 
 - (instancetype)init {
@@ -100,6 +141,7 @@ static FlutterError *getFlutterError(NSError *error) {
                                                      serverClientIdArgument:params.serverClientId
                                                        hostedDomainArgument:params.hostedDomain];
   self.requestedScopes = [NSSet setWithArray:params.scopes];
+  self.refreshTokensProactively = params.refreshTokensProactively;
   if (configuration != nil) {
     self.configuration = configuration;
   }
@@ -107,6 +149,17 @@ static FlutterError *getFlutterError(NSError *error) {
 
 - (void)signInSilentlyWithCompletion:(nonnull void (^)(FSIUserData *_Nullable,
                                                        FlutterError *_Nullable))completion {
+  if (self.pendingRestoredSignInCompletions) {
+    [self.pendingRestoredSignInCompletions addObject:completion];
+    return;
+  }
+  if (self.hasRestoredSignInResult) {
+    GIDGoogleUser *user = self.restoredSignInUser;
+    NSError *error = self.restoredSignInError;
+    [self discardRestoredSignIn];
+    [self didSignInForUser:user withServerAuthCode:nil completion:completion error:error];
+    return;
+  }
   [self.signIn restorePreviousSignInWithCompletion:^(GIDGoogleUser *_Nullable user,
                                                      NSError *_Nullable error) {
     [self didSignInForUser:user withServerAuthCode:nil completion:completion error:error];
@@ -120,6 +173,7 @@ static FlutterError *getFlutterError(NSError *error) {
 
 - (void)signInWithCompletion:(nonnull void (^)(FSIUserData *_Nullable,
                                                FlutterError *_Nullable))completion {
+  [self discardRestoredSignIn];
   @try {
     // If the configuration settings are passed from the Dart API, use those.
     // Otherwise, use settings from the GoogleService-Info.plist if available.
@@ -160,23 +214,30 @@ static FlutterError *getFlutterError(NSError *error) {
 - (void)getAccessTokenWithCompletion:(nonnull void (^)(FSITokenData *_Nullable,
                                                        FlutterError *_Nullable))completion {
   GIDGoogleUser *currentUser = self.signIn.currentUser;
-  [currentUser refreshTokensIfNeededWithCompletion:^(GIDGoogleUser *_Nullable user,
-                                                     NSError *_Nullable error) {
-    if (error) {
-      completion(nil, getFlutterError(error));
-    } else {
-      completion([FSITokenData makeWithIdToken:user.idToken.tokenString
-                                   accessToken:user.accessToken.tokenString],
-                 nil);
-    }
-  }];
+  if (currentUser == nil) {
+    completion(nil, [FlutterError errorWithCode:kErrorReasonSignInRequired
+                                        message:@"No account to get tokens for."
+                                        details:nil]);
+    return;
+  }
+  if (currentUser == self.cachedTokenUser &&
+      [currentUser.accessToken.tokenString isEqualToString:self.cachedTokenData.accessToken] &&
+      [self.cachedTokenExpirationDate timeIntervalSinceNow] > kTokenRefreshWindow) {
+    completion(self.cachedTokenData, nil);
+    return;
+  }
+  [self refreshTokensForUser:currentUser completion:completion];
 }
 
 - (void)signOutWithError:(FlutterError *_Nullable *_Nonnull)error {
+  [self discardRestoredSignIn];
+  [self clearTokenCache];
   [self.signIn signOut];
 }
 
 - (void)disconnectWithCompletion:(nonnull void (^)(FlutterError *_Nullable))completion {
+  [self discardRestoredSignIn];
+  [self clearTokenCache];
   [self.signIn disconnectWithCompletion:^(NSError *_Nullable error) {
     // TODO(stuartmorgan): This preserves the pre-Pigeon-migration behavior, but it's unclear why
     // 'error' is being ignored here.
@@ -241,6 +302,108 @@ static FlutterError *getFlutterError(NSError *error) {
 
 #pragma mark - private methods
 
+- (void)restorePreviousSignInAtLaunch {
+  self.pendingRestoredSignInCompletions = [NSMutableArray array];
+  [self.signIn restorePreviousSignInWithCompletion:^(GIDGoogleUser *_Nullable user,
+                                                     NSError *_Nullable error) {
+    NSArray<FSIUserDataCompletion> *completions = self.pendingRestoredSignInCompletions;
+    self.pendingRestoredSignInCompletions = nil;
+    if (completions == nil) {
+      // The sign in state changed before the restored sign in was used.
+      return;
+    }
+    if (completions.count == 0) {
+      self.hasRestoredSignInResult = YES;
+      self.restoredSignInUser = user;
+      self.restoredSignInError = error;
+      return;
+    }
+    for (FSIUserDataCompletion completion in completions) {
+      [self didSignInForUser:user withServerAuthCode:nil completion:completion error:error];
+    }
+  }];
+}
+
+/// Drops the result of the sign in restored at launch, which no longer reflects the sign in state.
+/// Silent sign in calls that are already waiting for it still get it.
+- (void)discardRestoredSignIn {
+  if (self.pendingRestoredSignInCompletions.count == 0) {
+    self.pendingRestoredSignInCompletions = nil;
+  }
+  self.hasRestoredSignInResult = NO;
+  self.restoredSignInUser = nil;
+  self.restoredSignInError = nil;
+}
+
+/// Refreshes the tokens of @c user if needed. Concurrent calls share a single refresh.
+- (void)refreshTokensForUser:(GIDGoogleUser *)user completion:(FSITokenCompletion)completion {
+  if (self.pendingTokenCompletions) {
+    [self.pendingTokenCompletions addObject:completion];
+    return;
+  }
+  self.pendingTokenCompletions = [NSMutableArray arrayWithObject:completion];
+  [user refreshTokensIfNeededWithCompletion:^(GIDGoogleUser *_Nullable refreshedUser,
+                                              NSError *_Nullable error) {
+    FSITokenData *tokenData;
+    FlutterError *flutterError;
+    if (error) {
+      flutterError = getFlutterError(error);
+      [self clearTokenCache];
+    } else {
+      tokenData = [FSITokenData makeWithIdToken:refreshedUser.idToken.tokenString
+                                    accessToken:refreshedUser.accessToken.tokenString];
+      [self cacheTokenData:tokenData ofUser:user refreshedUser:refreshedUser];
+    }
+    NSArray<FSITokenCompletion> *completions = self.pendingTokenCompletions;
+    self.pendingTokenCompletions = nil;
+    for (FSITokenCompletion pendingCompletion in completions) {
+      pendingCompletion(tokenData, flutterError);
+    }
+  }];
+}
+
+/// Caches the tokens of @c refreshedUser until they expire, and schedules their proactive refresh
+/// if it is enabled.
+- (void)cacheTokenData:(FSITokenData *)tokenData
+                ofUser:(GIDGoogleUser *)user
+         refreshedUser:(GIDGoogleUser *)refreshedUser {
+  [self clearTokenCache];
+  NSDate *expirationDate = refreshedUser.accessToken.expirationDate;
+  if (expirationDate == nil) {
+    return;
+  }
+  NSDate *idTokenExpirationDate = refreshedUser.idToken.expirationDate;
+  if (idTokenExpirationDate) {
+    expirationDate = [expirationDate earlierDate:idTokenExpirationDate];
+  }
+  self.cachedTokenData = tokenData;
+  self.cachedTokenUser = user;
+  self.cachedTokenExpirationDate = expirationDate;
+
+  NSTimeInterval refreshDelay =
+      [expirationDate timeIntervalSinceNow] - kProactiveTokenRefreshLeadTime;
+  if (self.refreshTokensProactively && refreshDelay > 0) {
+    __weak typeof(self) weakSelf = self;
+    self.proactiveTokenRefreshTimer =
+        [NSTimer scheduledTimerWithTimeInterval:refreshDelay
+                                        repeats:NO
+                                          block:^(NSTimer *timer) {
+                                            [weakSelf refreshTokensForUser:user
+                                                                completion:^(FSITokenData *data,
+                                                                             FlutterError *error){
+                                                                }];
+                                          }];
+  }
+}
+
+- (void)clearTokenCache {
+  [self.proactiveTokenRefreshTimer invalidate];
+  self.proactiveTokenRefreshTimer = nil;
+  self.cachedTokenData = nil;
+  self.cachedTokenUser = nil;
+  self.cachedTokenExpirationDate = nil;
+}
+
 /// @return @c nil if GoogleService-Info.plist not found and clientId is not provided.
 - (GIDConfiguration *)configurationWithClientIdArgument:(id)clientIDArg
                                  serverClientIdArgument:(id)serverClientIDArg
@@ -276,6 +439,7 @@ static FlutterError *getFlutterError(NSError *error) {
               completion:(nonnull void (^)(FSIUserData *_Nullable,
                                            FlutterError *_Nullable))completion
                    error:(NSError *)error {
+  [self clearTokenCache];
   if (error != nil) {
     // Forward all errors and let Dart side decide how to handle.
     completion(nil, getFlutterError(error));
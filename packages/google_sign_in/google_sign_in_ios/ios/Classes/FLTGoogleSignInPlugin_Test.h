@@ -29,9 +29,19 @@ NS_ASSUME_NONNULL_BEGIN
 // sign in, sign out, and requesting additional scopes.
 @property(strong, readonly) GIDSignIn *signIn;
 
+// Timer that refreshes the cached tokens shortly before they expire, if
+// proactive refresh is enabled.
+@property(strong, nullable) NSTimer *proactiveTokenRefreshTimer;
+
 /// Inject @c GIDSignIn for testing.
 - (instancetype)initWithSignIn:(GIDSignIn *)signIn;
 
+/// Starts restoring the previous sign in, and keeps the result for the next silent sign in.
+///
+/// Called when the plugin is registered if FLTGoogleSignInRestorePreviousSignInAtLaunch is set in
+/// the app's Info.plist.
+- (void)restorePreviousSignInAtLaunch;
+
 /// Inject @c GIDSignIn and @c googleServiceProperties for testing.
 - (instancetype)initWithSignIn:(GIDSignIn *)signIn
     withGoogleServiceProperties:(nullable NSDictionary<NSString *, id> *)googleServiceProperties
@@ -26,11 +26,15 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype)makeWithScopes:(NSArray<NSString *> *)scopes
                   hostedDomain:(nullable NSString *)hostedDomain
                       clientId:(nullable NSString *)clientId
-                serverClientId:(nullable NSString *)serverClientId;
+                serverClientId:(nullable NSString *)serverClientId
+      refreshTokensProactively:(BOOL)refreshTokensProactively;
 @property(nonatomic, strong) NSArray<NSString *> *scopes;
 @property(nonatomic, copy, nullable) NSString *hostedDomain;
 @property(nonatomic, copy, nullable) NSString *clientId;
 @property(nonatomic, copy, nullable) NSString *serverClientId;
+/// Whether the access token is refreshed shortly before it expires, instead
+/// of when it is next requested.
+@property(nonatomic, assign) BOOL refreshTokensProactively;
 @end
 
 /// Pigeon version of GoogleSignInUserData.
@@ -51,12 +51,14 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (instancetype)makeWithScopes:(NSArray<NSString *> *)scopes
                   hostedDomain:(nullable NSString *)hostedDomain
                       clientId:(nullable NSString *)clientId
-                serverClientId:(nullable NSString *)serverClientId {
+                serverClientId:(nullable NSString *)serverClientId
+      refreshTokensProactively:(BOOL)refreshTokensProactively {
   FSIInitParams *pigeonResult = [[FSIInitParams alloc] init];
   pigeonResult.scopes = scopes;
   pigeonResult.hostedDomain = hostedDomain;
   pigeonResult.clientId = clientId;
   pigeonResult.serverClientId = serverClientId;
+  pigeonResult.refreshTokensProactively = refreshTokensProactively;
   return pigeonResult;
 }
 + (FSIInitParams *)fromList:(NSArray *)list {
@@ -66,6 +68,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   pigeonResult.hostedDomain = GetNullableObjectAtIndex(list, 1);
   pigeonResult.clientId = GetNullableObjectAtIndex(list, 2);
   pigeonResult.serverClientId = GetNullableObjectAtIndex(list, 3);
+  pigeonResult.refreshTokensProactively = [GetNullableObjectAtIndex(list, 4) boolValue];
   return pigeonResult;
 }
 + (nullable FSIInitParams *)nullableFromList:(NSArray *)list {
@@ -77,6 +80,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     (self.hostedDomain ?: [NSNull null]),
     (self.clientId ?: [NSNull null]),
     (self.serverClientId ?: [NSNull null]),
+    @(self.refreshTokensProactively),
   ];
 }
 @end
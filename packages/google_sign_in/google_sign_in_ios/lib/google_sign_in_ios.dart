@@ -13,12 +13,20 @@ import 'src/messages.g.dart';
 /// iOS implementation of [GoogleSignInPlatform].
 class GoogleSignInIOS extends GoogleSignInPlatform {
   /// Creates a new plugin implementation instance.
+  ///
+  /// If [refreshTokensProactively] is true, the tokens returned by [getTokens]
+  /// are refreshed shortly before they expire, so that the first call after
+  /// they expire does not have to wait for the refresh.
   GoogleSignInIOS({
     @visibleForTesting GoogleSignInApi? api,
-  }) : _api = api ?? GoogleSignInApi();
+    bool refreshTokensProactively = false,
+  })  : _api = api ?? GoogleSignInApi(),
+        _refreshTokensProactively = refreshTokensProactively;
 
   final GoogleSignInApi _api;
 
+  final bool _refreshTokensProactively;
+
   /// Registers this class as the default instance of [GoogleSignInPlatform].
   static void registerWith() {
     GoogleSignInPlatform.instance = GoogleSignInIOS();
@@ -51,6 +59,7 @@ class GoogleSignInIOS extends GoogleSignInPlatform {
       hostedDomain: params.hostedDomain,
       clientId: params.clientId,
       serverClientId: params.serverClientId,
+      refreshTokensProactively: _refreshTokensProactively,
     ));
   }
 
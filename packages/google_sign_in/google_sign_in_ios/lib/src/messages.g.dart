@@ -20,6 +20,7 @@ class InitParams {
     this.hostedDomain,
     this.clientId,
     this.serverClientId,
+    required this.refreshTokensProactively,
   });
 
   List<String?> scopes;
@@ -30,12 +31,17 @@ class InitParams {
 
   String? serverClientId;
 
+  /// Whether the access token is refreshed shortly before it expires, instead
+  /// of when it is next requested.
+  bool refreshTokensProactively;
+
   Object encode() {
     return <Object?>[
       scopes,
       hostedDomain,
       clientId,
       serverClientId,
+      refreshTokensProactively,
     ];
   }
 
@@ -46,6 +52,7 @@ class InitParams {
       hostedDomain: result[1] as String?,
       clientId: result[2] as String?,
       serverClientId: result[3] as String?,
+      refreshTokensProactively: result[4]! as bool,
     );
   }
 }
@@ -22,6 +22,7 @@ class InitParams {
     this.hostedDomain,
     this.clientId,
     this.serverClientId,
+    this.refreshTokensProactively = false,
   });
 
   // TODO(stuartmorgan): Make the generic type non-nullable once supported.
@@ -31,6 +32,10 @@ class InitParams {
   final String? hostedDomain;
   final String? clientId;
   final String? serverClientId;
+
+  /// Whether the access token is refreshed shortly before it expires, instead
+  /// of when it is next requested.
+  final bool refreshTokensProactively;
 }
 
 /// Pigeon version of GoogleSignInUserData.
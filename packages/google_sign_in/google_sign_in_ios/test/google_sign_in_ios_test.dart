@@ -153,6 +153,17 @@ void main() {
     expect(passedParams.scopes, initParams.scopes);
     expect(passedParams.clientId, initParams.clientId);
     expect(passedParams.serverClientId, initParams.serverClientId);
+    expect(passedParams.refreshTokensProactively, false);
+  });
+
+  test('initWithParams passes refreshTokensProactively', () async {
+    googleSignIn = GoogleSignInIOS(api: api, refreshTokensProactively: true);
+
+    await googleSignIn.initWithParams(const SignInInitParameters());
+
+    final VerificationResult result = verify(api.init(captureAny));
+    final InitParams passedParams = result.captured[0] as InitParams;
+    expect(passedParams.refreshTokensProactively, true);
   });
 
   test('requestScopes passes arguments', () async {
@@ -288,6 +288,35 @@
   [plugin imagePickerControllerDidCancel:controller];
 }
 
+- (void)testSavesCameraImageOffMainThread {
+  FLTImagePickerPlugin *plugin = [[FLTImagePickerPlugin alloc] init];
+  UIImagePickerController *controller = [[UIImagePickerController alloc] init];
+  UIImage *image = [UIImage imageWithData:ImagePickerTestImages.JPGTestData];
+
+  XCTestExpectation *resultExpectation = [self expectationWithDescription:@"result"];
+  __block BOOL didReturn = NO;
+  FLTImagePickerMethodCallContext *context = [[FLTImagePickerMethodCallContext alloc]
+      initWithResult:^(NSArray<NSString *> *result, FlutterError *error) {
+        XCTAssertTrue(NSThread.isMainThread);
+        // The image is saved after the delegate method returns.
+        XCTAssertTrue(didReturn);
+        XCTAssertNil(error);
+        XCTAssertEqual(result.count, 1);
+        XCTAssertTrue([NSFileManager.defaultManager fileExistsAtPath:result.firstObject]);
+        [resultExpectation fulfill];
+      }];
+  context.maxSize = [FLTMaxSize makeWithWidth:@(3) height:@(2)];
+  plugin.callContext = context;
+
+  NSDictionary *info = @{UIImagePickerControllerOriginalImage : image};
+  [plugin imagePickerController:controller didFinishPickingMediaWithInfo:info];
+  // Repeated reports of the same pick are ignored while it is saved.
+  [plugin imagePickerController:controller didFinishPickingMediaWithInfo:info];
+  didReturn = YES;
+
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
 #pragma mark - Test video duration
 
 - (void)testPickingVideoWithDuration {
@@ -489,6 +518,172 @@
   [self waitForExpectationsWithTimeout:30 handler:nil];
 }
 
+- (void)testSavesManyImagesInPickedOrder API_AVAILABLE(ios(14)) {
+  id mockPickerViewController = OCMClassMock([PHPickerViewController class]);
+
+  NSURL *pngURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"pngImage"
+                                                           withExtension:@"png"];
+  NSURL *tiffURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"tiffImage"
+                                                            withExtension:@"tiff"];
+  NSMutableArray<PHPickerResult *> *results = [NSMutableArray array];
+  for (int i = 0; i < 10; i++) {
+    NSItemProvider *itemProvider =
+        [[NSItemProvider alloc] initWithContentsOfURL:i % 2 == 0 ? pngURL : tiffURL];
+    PHPickerResult *result = OCMClassMock([PHPickerResult class]);
+    OCMStub([result itemProvider]).andReturn(itemProvider);
+    [results addObject:result];
+  }
+
+  FLTImagePickerPlugin *plugin = [[FLTImagePickerPlugin alloc] init];
+
+  XCTestExpectation *resultExpectation = [self expectationWithDescription:@"result"];
+
+  plugin.callContext = [[FLTImagePickerMethodCallContext alloc]
+      initWithResult:^(NSArray<NSString *> *result, FlutterError *error) {
+        XCTAssertNil(error);
+        XCTAssertEqual(result.count, 10);
+        for (NSUInteger i = 0; i < result.count; i++) {
+          // TIFF images are saved as JPEG.
+          XCTAssertEqualObjects(result[i].pathExtension, i % 2 == 0 ? @"png" : @"jpg");
+        }
+        [resultExpectation fulfill];
+      }];
+
+  [plugin picker:mockPickerViewController didFinishPicking:results];
+
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
+- (void)testReportsSavedImages API_AVAILABLE(ios(14)) {
+  id mockPickerViewController = OCMClassMock([PHPickerViewController class]);
+
+  NSURL *pngURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"pngImage"
+                                                           withExtension:@"png"];
+  NSItemProvider *pngItemProvider = [[NSItemProvider alloc] initWithContentsOfURL:pngURL];
+  PHPickerResult *pngResult = OCMClassMock([PHPickerResult class]);
+  OCMStub([pngResult itemProvider]).andReturn(pngItemProvider);
+
+  FLTImagePickerPlugin *plugin = [[FLTImagePickerPlugin alloc] init];
+  id mockFlutterApi = OCMClassMock([FLTImagePickerFlutterApi class]);
+  plugin.flutterApi = mockFlutterApi;
+  FlutterError *error;
+  [plugin setReportsSavedItems:YES error:&error];
+  XCTAssertNil(error);
+
+  XCTestExpectation *itemExpectation = [self expectationWithDescription:@"item"];
+  OCMStub([mockFlutterApi itemSavedAtIndex:0 path:[OCMArg isNotNil] completion:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        XCTAssertTrue(NSThread.isMainThread);
+        [itemExpectation fulfill];
+      });
+
+  XCTestExpectation *resultExpectation = [self expectationWithDescription:@"result"];
+  plugin.callContext = [[FLTImagePickerMethodCallContext alloc]
+      initWithResult:^(NSArray<NSString *> *result, FlutterError *error) {
+        XCTAssertEqual(result.count, 1);
+        [resultExpectation fulfill];
+      }];
+
+  [plugin picker:mockPickerViewController didFinishPicking:@[ pngResult ]];
+
+  [self waitForExpectations:@[ itemExpectation, resultExpectation ]
+                    timeout:30
+               enforceOrder:YES];
+}
+
+- (void)testDoesNotReportSavedImagesByDefault API_AVAILABLE(ios(14)) {
+  id mockPickerViewController = OCMClassMock([PHPickerViewController class]);
+
+  NSURL *pngURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"pngImage"
+                                                           withExtension:@"png"];
+  NSItemProvider *pngItemProvider = [[NSItemProvider alloc] initWithContentsOfURL:pngURL];
+  PHPickerResult *pngResult = OCMClassMock([PHPickerResult class]);
+  OCMStub([pngResult itemProvider]).andReturn(pngItemProvider);
+
+  FLTImagePickerPlugin *plugin = [[FLTImagePickerPlugin alloc] init];
+  id mockFlutterApi = OCMClassMock([FLTImagePickerFlutterApi class]);
+  OCMReject([mockFlutterApi itemSavedAtIndex:0 path:[OCMArg any] completion:[OCMArg any]]);
+  plugin.flutterApi = mockFlutterApi;
+
+  XCTestExpectation *resultExpectation = [self expectationWithDescription:@"result"];
+  plugin.callContext = [[FLTImagePickerMethodCallContext alloc]
+      initWithResult:^(NSArray<NSString *> *result, FlutterError *error) {
+        XCTAssertEqual(result.count, 1);
+        [resultExpectation fulfill];
+      }];
+
+  [plugin picker:mockPickerViewController didFinishPicking:@[ pngResult ]];
+
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+  OCMVerifyAll(mockFlutterApi);
+}
+
+- (void)testSetImageOutputFormat {
+  FLTImagePickerPlugin *plugin = [[FLTImagePickerPlugin alloc] init];
+  FlutterError *error;
+  XCTAssertEqual(plugin.imageOutputFormat, FLTImagePickerOutputFormatJPEG);
+
+  [plugin setImageOutputFormat:FLTOutputFormatSource error:&error];
+  XCTAssertEqual(plugin.imageOutputFormat, FLTImagePickerOutputFormatSource);
+
+  [plugin setImageOutputFormat:FLTOutputFormatHeic error:&error];
+  XCTAssertEqual(plugin.imageOutputFormat, FLTImagePickerOutputFormatHEIC);
+
+  [plugin setImageOutputFormat:FLTOutputFormatJpeg error:&error];
+  XCTAssertEqual(plugin.imageOutputFormat, FLTImagePickerOutputFormatJPEG);
+  XCTAssertNil(error);
+}
+
+- (void)testSetVideoExportPreset {
+  FLTImagePickerPlugin *plugin = [[FLTImagePickerPlugin alloc] init];
+  FlutterError *error;
+  XCTAssertNil(plugin.videoExportPreset);
+
+  [plugin setVideoExportPreset:FLTExportPresetHevcMax1920x1080 error:&error];
+  XCTAssertEqualObjects(plugin.videoExportPreset, AVAssetExportPresetHEVC1920x1080);
+
+  [plugin setVideoExportPreset:FLTExportPresetH264Max1280x720 error:&error];
+  XCTAssertEqualObjects(plugin.videoExportPreset, AVAssetExportPreset1280x720);
+
+  [plugin setVideoExportPreset:FLTExportPresetOriginal error:&error];
+  XCTAssertNil(plugin.videoExportPreset);
+  XCTAssertNil(error);
+}
+
+- (void)testSetThumbnailSize {
+  FLTImagePickerPlugin *plugin = [[FLTImagePickerPlugin alloc] init];
+  FlutterError *error;
+  XCTAssertNil(plugin.thumbnailSize);
+
+  [plugin setThumbnailSize:@256 error:&error];
+  XCTAssertEqualObjects(plugin.thumbnailSize, @256);
+
+  [plugin setThumbnailSize:nil error:&error];
+  XCTAssertNil(plugin.thumbnailSize);
+  XCTAssertNil(error);
+}
+
+- (void)testMaxConcurrentSaveOperationCount {
+  unsigned long long oneGB = 1024 * 1024 * 1024;
+  unsigned long long fourGB = 4 * oneGB;
+
+  // Limited by the processor count.
+  XCTAssertEqual([FLTImagePickerPlugin maxConcurrentSaveOperationCountWithProcessorCount:6
+                                                                          physicalMemory:fourGB
+                                                                                isScaled:YES],
+                 6);
+  // Limited by the memory budget.
+  XCTAssertEqual([FLTImagePickerPlugin maxConcurrentSaveOperationCountWithProcessorCount:6
+                                                                          physicalMemory:fourGB
+                                                                                isScaled:NO],
+                 2);
+  // Always saves at least one image.
+  XCTAssertEqual([FLTImagePickerPlugin maxConcurrentSaveOperationCountWithProcessorCount:6
+                                                                          physicalMemory:oneGB
+                                                                                isScaled:NO],
+                 1);
+}
+
 - (void)testPickImageRequestAuthorization API_AVAILABLE(ios(14)) {
   id mockPhotoLibrary = OCMClassMock([PHPhotoLibrary class]);
   OCMStub([mockPhotoLibrary authorizationStatusForAccessLevel:PHAccessLevelReadWrite])
@@ -4,6 +4,7 @@
 
 #import "ImagePickerTestImages.h"
 
+@import ImageIO;
 @import image_picker_ios;
 @import image_picker_ios.Test;
 @import XCTest;
@@ -54,22 +55,67 @@
   XCTAssertEqual(newImage.imageOrientation, UIImageOrientationUp);
 }
 
-- (void)testScaledGIFImage_ShouldBeScaled {
-  // gif image that frame size is 3 and the duration is 1 second.
-  GIFInfo *info = [FLTImagePickerImageUtil scaledGIFImage:ImagePickerTestImages.GIFTestData
-                                                 maxWidth:@3
-                                                maxHeight:@2];
+- (void)testScaledImageFromData_ShouldBeScaled {
+  UIImage *newImage = [FLTImagePickerImageUtil scaledImageFromData:ImagePickerTestImages.JPGTestData
+                                                          maxWidth:@3
+                                                         maxHeight:@2];
 
-  NSArray<UIImage *> *images = info.images;
-  NSTimeInterval duration = info.interval;
+  XCTAssertEqual(newImage.size.width, 3);
+  XCTAssertEqual(newImage.size.height, 2);
+}
 
-  XCTAssertEqual(images.count, 3);
-  XCTAssertEqual(duration, 1);
+- (void)testScaledImageFromData_ShouldBeCorrectRotation {
+  NSURL *imageURL =
+      [[NSBundle bundleForClass:[self class]] URLForResource:@"jpgImageWithRightOrientation"
+                                               withExtension:@"jpg"];
+  NSData *imageData = [NSData dataWithContentsOfURL:imageURL];
 
-  for (UIImage *newImage in images) {
-    XCTAssertEqual(newImage.size.width, 3);
-    XCTAssertEqual(newImage.size.height, 2);
+  UIImage *newImage = [FLTImagePickerImageUtil scaledImageFromData:imageData
+                                                          maxWidth:@10
+                                                         maxHeight:@10];
+  XCTAssertEqual(newImage.size.width, 10);
+  XCTAssertEqual(newImage.size.height, 7);
+  XCTAssertEqual(newImage.imageOrientation, UIImageOrientationUp);
+}
+
+- (void)testScaledImageFromData_ShouldReturnNilForInvalidData {
+  NSData *data = [@"not an image" dataUsingEncoding:NSUTF8StringEncoding];
+  XCTAssertNil([FLTImagePickerImageUtil scaledImageFromData:data maxWidth:@3 maxHeight:@2]);
+}
+
+- (void)testWriteScaledGIFImage_ShouldBeScaled {
+  NSURL *url = [NSURL
+      fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:@"scaled_test.gif"]];
+  // gif image that frame size is 3 and the duration is 1 second.
+  XCTAssertTrue([FLTImagePickerImageUtil writeScaledGIFImage:ImagePickerTestImages.GIFTestData
+                                                    maxWidth:@3
+                                                   maxHeight:@2
+                                                  properties:nil
+                                                       toURL:url]);
+
+  CGImageSourceRef imageSource = CGImageSourceCreateWithURL((__bridge CFURLRef)url, NULL);
+  XCTAssertEqual(CGImageSourceGetCount(imageSource), 3);
+  for (size_t index = 0; index < CGImageSourceGetCount(imageSource); index++) {
+    NSDictionary *properties = (NSDictionary *)CFBridgingRelease(
+        CGImageSourceCopyPropertiesAtIndex(imageSource, index, NULL));
+    XCTAssertEqualObjects(properties[(NSString *)kCGImagePropertyPixelWidth], @3);
+    XCTAssertEqualObjects(properties[(NSString *)kCGImagePropertyPixelHeight], @2);
+    NSDictionary *gifProperties = properties[(NSString *)kCGImagePropertyGIFDictionary];
+    XCTAssertEqualObjects(gifProperties[(NSString *)kCGImagePropertyGIFDelayTime], @1);
   }
+  CFRelease(imageSource);
+  [NSFileManager.defaultManager removeItemAtURL:url error:nil];
+}
+
+- (void)testWriteScaledGIFImage_ShouldFailForInvalidData {
+  NSURL *url = [NSURL
+      fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:@"invalid_test.gif"]];
+  NSData *data = [@"not an image" dataUsingEncoding:NSUTF8StringEncoding];
+  XCTAssertFalse([FLTImagePickerImageUtil writeScaledGIFImage:data
+                                                     maxWidth:@3
+                                                    maxHeight:@2
+                                                   properties:nil
+                                                        toURL:url]);
 }
 
 @end
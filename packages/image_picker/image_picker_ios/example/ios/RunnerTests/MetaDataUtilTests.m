@@ -28,6 +28,17 @@
   XCTAssertEqual(
       [FLTImagePickerMetaDataUtil getImageMIMETypeFromImageData:ImagePickerTestImages.GIFTestData],
       FLTImagePickerMIMETypeGIF);
+
+  // test heic
+  NSURL *heicURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"heicImage"
+                                                            withExtension:@"heic"];
+  XCTAssertEqual([FLTImagePickerMetaDataUtil
+                     getImageMIMETypeFromImageData:[NSData dataWithContentsOfURL:heicURL]],
+                 FLTImagePickerMIMETypeHEIC);
+
+  // test other
+  XCTAssertEqual([FLTImagePickerMetaDataUtil getImageMIMETypeFromImageData:[NSData data]],
+                 FLTImagePickerMIMETypeOther);
 }
 
 - (void)testSuffixFromType {
@@ -43,6 +54,10 @@
   XCTAssertEqualObjects(
       [FLTImagePickerMetaDataUtil imageTypeSuffixFromType:FLTImagePickerMIMETypeGIF], @".gif");
 
+  // test heic
+  XCTAssertEqualObjects(
+      [FLTImagePickerMetaDataUtil imageTypeSuffixFromType:FLTImagePickerMIMETypeHEIC], @".heic");
+
   // test other
   XCTAssertNil([FLTImagePickerMetaDataUtil imageTypeSuffixFromType:FLTImagePickerMIMETypeOther]);
 }
@@ -72,6 +87,21 @@
   }
 }
 
+- (void)testWriteChangedMetaData {
+  NSData *dataJPG = ImagePickerTestImages.JPGTestData;
+  NSMutableDictionary *metaData =
+      [[FLTImagePickerMetaDataUtil getMetaDataFromImageData:dataJPG] mutableCopy];
+  NSString *orientationKey = (__bridge NSString *)kCGImagePropertyOrientation;
+  metaData[orientationKey] = @(kCGImagePropertyOrientationRight);
+
+  NSData *newData = [FLTImagePickerMetaDataUtil imageFromImage:dataJPG withMetaData:metaData];
+
+  NSDictionary *newMetaData = [FLTImagePickerMetaDataUtil getMetaDataFromImageData:newData];
+  XCTAssertEqualObjects(newMetaData[orientationKey], @(kCGImagePropertyOrientationRight));
+  NSDictionary *exif = newMetaData[(__bridge NSString *)kCGImagePropertyExifDictionary];
+  XCTAssertEqual([exif[(__bridge NSString *)kCGImagePropertyExifPixelXDimension] integerValue], 12);
+}
+
 - (void)testUpdateMetaDataBadData {
   NSData *imageData = [NSData data];
 
@@ -95,4 +125,104 @@
                  FLTImagePickerMIMETypePNG);
 }
 
+- (void)testOutputTypeForJPEGFormat {
+  FLTImagePickerOutputFormat format = FLTImagePickerOutputFormatJPEG;
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeJPEG
+                                                              format:format],
+                 FLTImagePickerMIMETypeJPEG);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypePNG
+                                                              format:format],
+                 FLTImagePickerMIMETypePNG);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeGIF
+                                                              format:format],
+                 FLTImagePickerMIMETypeGIF);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeHEIC
+                                                              format:format],
+                 FLTImagePickerMIMETypeJPEG);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeOther
+                                                              format:format],
+                 FLTImagePickerMIMETypeJPEG);
+}
+
+- (void)testOutputTypeForSourceFormat {
+  FLTImagePickerOutputFormat format = FLTImagePickerOutputFormatSource;
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypePNG
+                                                              format:format],
+                 FLTImagePickerMIMETypePNG);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeOther
+                                                              format:format],
+                 FLTImagePickerMIMETypeJPEG);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeHEIC
+                                                              format:format],
+                 [FLTImagePickerMetaDataUtil canEncodeHEIC] ? FLTImagePickerMIMETypeHEIC
+                                                            : FLTImagePickerMIMETypeJPEG);
+}
+
+- (void)testOutputTypeForHEICFormat {
+  FLTImagePickerOutputFormat format = FLTImagePickerOutputFormatHEIC;
+  FLTImagePickerMIMEType heicType = [FLTImagePickerMetaDataUtil canEncodeHEIC]
+                                        ? FLTImagePickerMIMETypeHEIC
+                                        : FLTImagePickerMIMETypeJPEG;
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeJPEG
+                                                              format:format],
+                 heicType);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypePNG
+                                                              format:format],
+                 heicType);
+  XCTAssertEqual([FLTImagePickerMetaDataUtil outputTypeForSourceType:FLTImagePickerMIMETypeGIF
+                                                              format:format],
+                 FLTImagePickerMIMETypeGIF);
+}
+
+- (void)testImageDataFromImageKeepsMetaData {
+  NSData *dataJPG = ImagePickerTestImages.JPGTestData;
+  NSDictionary *metaData = [FLTImagePickerMetaDataUtil getMetaDataFromImageData:dataJPG];
+  UIImage *image = [UIImage imageWithData:dataJPG];
+
+  NSData *newData = [FLTImagePickerMetaDataUtil imageDataFromImage:image
+                                                          usingType:FLTImagePickerMIMETypeJPEG
+                                                            quality:@(0.5)
+                                                           metaData:metaData];
+
+  XCTAssertEqual([FLTImagePickerMetaDataUtil getImageMIMETypeFromImageData:newData],
+                 FLTImagePickerMIMETypeJPEG);
+  NSDictionary *newMetaData = [FLTImagePickerMetaDataUtil getMetaDataFromImageData:newData];
+  NSDictionary *exif =
+      [newMetaData objectForKey:(__bridge NSString *)kCGImagePropertyExifDictionary];
+  XCTAssertEqual([exif[(__bridge NSString *)kCGImagePropertyExifPixelXDimension] integerValue], 12);
+}
+
+- (void)testImageDataFromImageKeepsOrientationWithoutMetaData {
+  NSURL *imageURL =
+      [[NSBundle bundleForClass:[self class]] URLForResource:@"jpgImageWithRightOrientation"
+                                               withExtension:@"jpg"];
+  UIImage *image = [UIImage imageWithData:[NSData dataWithContentsOfURL:imageURL]];
+
+  NSData *newData = [FLTImagePickerMetaDataUtil imageDataFromImage:image
+                                                          usingType:FLTImagePickerMIMETypePNG
+                                                            quality:nil
+                                                           metaData:nil];
+
+  XCTAssertEqual([FLTImagePickerMetaDataUtil getImageMIMETypeFromImageData:newData],
+                 FLTImagePickerMIMETypePNG);
+  XCTAssertEqual([UIImage imageWithData:newData].imageOrientation, UIImageOrientationRight);
+}
+
+- (void)testImageDataFromImageAsHEIC {
+  if (![FLTImagePickerMetaDataUtil canEncodeHEIC]) {
+    return;
+  }
+  NSData *dataJPG = ImagePickerTestImages.JPGTestData;
+  NSDictionary *metaData = [FLTImagePickerMetaDataUtil getMetaDataFromImageData:dataJPG];
+  UIImage *image = [UIImage imageWithData:dataJPG];
+
+  NSData *newData = [FLTImagePickerMetaDataUtil imageDataFromImage:image
+                                                          usingType:FLTImagePickerMIMETypeHEIC
+                                                            quality:@(0.5)
+                                                           metaData:metaData];
+
+  XCTAssertEqual([FLTImagePickerMetaDataUtil getImageMIMETypeFromImageData:newData],
+                 FLTImagePickerMIMETypeHEIC);
+}
+
 @end
@@ -4,6 +4,7 @@
 
 #import "ImagePickerTestImages.h"
 
+@import AVFoundation;
 @import image_picker_ios;
 @import image_picker_ios.Test;
 @import XCTest;
@@ -143,4 +144,48 @@
   XCTAssertEqual(numberOfFrames, newNumberOfFrames);
 }
 
+- (void)testSaveImageWithOriginalImageData_ShouldSaveOriginalDataWhenNotReencoded {
+  NSData *dataJPG = ImagePickerTestImages.JPGTestData;
+  NSString *savedPath = [FLTImagePickerPhotoAssetUtil saveImageWithOriginalImageData:dataJPG
+                                                                               image:nil
+                                                                            maxWidth:nil
+                                                                           maxHeight:nil
+                                                                        imageQuality:@1];
+
+  XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, @"jpg");
+  XCTAssertEqualObjects([NSData dataWithContentsOfFile:savedPath], dataJPG);
+}
+
+- (void)testSaveImageWithOriginalImageData_ShouldDecodeImageWhenCompressed {
+  NSData *dataJPG = ImagePickerTestImages.JPGTestData;
+  NSString *savedPath = [FLTImagePickerPhotoAssetUtil saveImageWithOriginalImageData:dataJPG
+                                                                               image:nil
+                                                                            maxWidth:nil
+                                                                           maxHeight:nil
+                                                                        imageQuality:@(0.5)];
+
+  XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, @"jpg");
+  NSData *savedData = [NSData dataWithContentsOfFile:savedPath];
+  XCTAssertNotEqualObjects(savedData, dataJPG);
+  XCTAssertNotNil([UIImage imageWithData:savedData]);
+}
+
+- (void)testExportVideoFromURL_ShouldCopyFilesThatCannotBeExported {
+  NSURL *fileURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"jpgImage"
+                                                            withExtension:@"jpg"];
+
+  XCTestExpectation *exportExpectation = [self expectationWithDescription:@"Video was saved"];
+  [FLTImagePickerPhotoAssetUtil
+      exportVideoFromURL:fileURL
+              presetName:AVAssetExportPresetHEVC1920x1080
+              completion:^(NSURL *_Nullable destination) {
+                XCTAssertNotNil(destination);
+                XCTAssertEqualObjects([NSData dataWithContentsOfURL:destination],
+                                      [NSData dataWithContentsOfURL:fileURL]);
+                [exportExpectation fulfill];
+              }];
+
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
 @end
@@ -240,6 +240,212 @@
   OCMVerifyAll(photoAssetUtil);
 }
 
+- (void)testSaveJPGImageWithoutScalingCopiesFile API_AVAILABLE(ios(14)) {
+  NSURL *imageURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"jpgImage"
+                                                             withExtension:@"jpg"];
+  NSItemProvider *itemProvider = [[NSItemProvider alloc] initWithContentsOfURL:imageURL];
+  PHPickerResult *result = [self createPickerResultWithProvider:itemProvider];
+
+  XCTestExpectation *pathExpectation = [self expectationWithDescription:@"Path was created"];
+  FLTPHPickerSaveImageToPathOperation *operation = [[FLTPHPickerSaveImageToPathOperation alloc]
+           initWithResult:result
+                maxHeight:nil
+                 maxWidth:nil
+      desiredImageQuality:@1
+             fullMetadata:YES
+           savedPathBlock:^(NSString *savedPath, FlutterError *error) {
+             XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, @"jpg");
+             XCTAssertEqualObjects([NSData dataWithContentsOfFile:savedPath],
+                                   [NSData dataWithContentsOfURL:imageURL]);
+             [pathExpectation fulfill];
+           }];
+
+  [operation start];
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
+- (void)testSaveHEICImageWithoutScalingIsConverted API_AVAILABLE(ios(14)) {
+  NSURL *imageURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"heicImage"
+                                                             withExtension:@"heic"];
+  NSItemProvider *itemProvider = [[NSItemProvider alloc] initWithContentsOfURL:imageURL];
+  PHPickerResult *result = [self createPickerResultWithProvider:itemProvider];
+
+  XCTestExpectation *pathExpectation = [self expectationWithDescription:@"Path was created"];
+  FLTPHPickerSaveImageToPathOperation *operation = [[FLTPHPickerSaveImageToPathOperation alloc]
+           initWithResult:result
+                maxHeight:nil
+                 maxWidth:nil
+      desiredImageQuality:@1
+             fullMetadata:NO
+           savedPathBlock:^(NSString *savedPath, FlutterError *error) {
+             XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:savedPath]);
+             XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, @"jpg");
+             [pathExpectation fulfill];
+           }];
+
+  [operation start];
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
+- (void)testSaveHEICImageWithoutScalingInSourceFormatCopiesFile API_AVAILABLE(ios(14)) {
+  NSURL *imageURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"heicImage"
+                                                             withExtension:@"heic"];
+  NSItemProvider *itemProvider = [[NSItemProvider alloc] initWithContentsOfURL:imageURL];
+  PHPickerResult *result = [self createPickerResultWithProvider:itemProvider];
+
+  XCTestExpectation *pathExpectation = [self expectationWithDescription:@"Path was created"];
+  FLTPHPickerSaveImageToPathOperation *operation = [[FLTPHPickerSaveImageToPathOperation alloc]
+           initWithResult:result
+                maxHeight:nil
+                 maxWidth:nil
+      desiredImageQuality:@1
+             fullMetadata:NO
+           savedPathBlock:^(NSString *savedPath, FlutterError *error) {
+             if ([FLTImagePickerMetaDataUtil canEncodeHEIC]) {
+               XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, @"heic");
+               XCTAssertEqualObjects([NSData dataWithContentsOfFile:savedPath],
+                                     [NSData dataWithContentsOfURL:imageURL]);
+             } else {
+               XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, @"jpg");
+             }
+             [pathExpectation fulfill];
+           }];
+  operation.outputFormat = FLTImagePickerOutputFormatSource;
+
+  [operation start];
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
+- (void)testSaveScaledHEICImageInSourceFormat API_AVAILABLE(ios(14)) {
+  NSURL *imageURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"heicImage"
+                                                             withExtension:@"heic"];
+  NSItemProvider *itemProvider = [[NSItemProvider alloc] initWithContentsOfURL:imageURL];
+  PHPickerResult *result = [self createPickerResultWithProvider:itemProvider];
+  NSString *extension = [FLTImagePickerMetaDataUtil canEncodeHEIC] ? @"heic" : @"jpg";
+
+  XCTestExpectation *pathExpectation = [self expectationWithDescription:@"Path was created"];
+  FLTPHPickerSaveImageToPathOperation *operation = [[FLTPHPickerSaveImageToPathOperation alloc]
+           initWithResult:result
+                maxHeight:@10
+                 maxWidth:@10
+      desiredImageQuality:@(0.5)
+             fullMetadata:NO
+           savedPathBlock:^(NSString *savedPath, FlutterError *error) {
+             XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:savedPath]);
+             XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, extension);
+             [pathExpectation fulfill];
+           }];
+  operation.outputFormat = FLTImagePickerOutputFormatSource;
+
+  [operation start];
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
+- (void)testSaveThumbnailFromImageData API_AVAILABLE(ios(14)) {
+  NSURL *imageURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"jpgImage"
+                                                             withExtension:@"jpg"];
+  NSItemProvider *itemProvider = [[NSItemProvider alloc] initWithContentsOfURL:imageURL];
+  PHPickerResult *result = [self createPickerResultWithProvider:itemProvider];
+
+  XCTestExpectation *pathExpectation = [self expectationWithDescription:@"Path was created"];
+  FLTPHPickerSaveImageToPathOperation *operation = [[FLTPHPickerSaveImageToPathOperation alloc]
+           initWithResult:result
+                maxHeight:nil
+                 maxWidth:nil
+      desiredImageQuality:@1
+             fullMetadata:YES
+           savedPathBlock:^(NSString *savedPath, FlutterError *error) {
+             UIImage *thumbnail = [UIImage imageWithContentsOfFile:savedPath];
+             XCTAssertEqual(thumbnail.size.width, 3);
+             XCTAssertEqual(thumbnail.size.height, 2);
+             [pathExpectation fulfill];
+           }];
+  operation.thumbnailSize = @3;
+
+  [operation start];
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
+- (void)testSaveThumbnailFromImageManager API_AVAILABLE(ios(14)) {
+  NSURL *imageURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"jpgImage"
+                                                             withExtension:@"jpg"];
+  NSItemProvider *itemProvider = [[NSItemProvider alloc] initWithContentsOfURL:imageURL];
+  PHPickerResult *result = [self createPickerResultWithProvider:itemProvider];
+
+  PHAsset *asset = OCMClassMock([PHAsset class]);
+  id mockAssetUtil = OCMClassMock([FLTImagePickerPhotoAssetUtil class]);
+  OCMStub(ClassMethod([mockAssetUtil canReadPhotoLibrary])).andReturn(YES);
+  OCMStub(ClassMethod([mockAssetUtil getAssetFromPHPickerResult:result])).andReturn(asset);
+
+  UIImage *thumbnail = [UIImage imageWithData:ImagePickerTestImages.PNGTestData];
+  id mockImageManager = OCMClassMock([PHImageManager class]);
+  OCMStub([mockImageManager
+      requestImageForAsset:asset
+                targetSize:CGSizeMake(256, 256)
+               contentMode:PHImageContentModeAspectFit
+                   options:OCMOCK_ANY
+             resultHandler:[OCMArg invokeBlockWithArgs:thumbnail, @{}, nil]]);
+
+  XCTestExpectation *pathExpectation = [self expectationWithDescription:@"Path was created"];
+  FLTPHPickerSaveImageToPathOperation *operation = [[FLTPHPickerSaveImageToPathOperation alloc]
+           initWithResult:result
+                maxHeight:nil
+                 maxWidth:nil
+      desiredImageQuality:@1
+             fullMetadata:YES
+           savedPathBlock:^(NSString *savedPath, FlutterError *error) {
+             UIImage *savedImage = [UIImage imageWithContentsOfFile:savedPath];
+             XCTAssertEqual(savedImage.size.width, thumbnail.size.width);
+             XCTAssertEqual(savedImage.size.height, thumbnail.size.height);
+             [pathExpectation fulfill];
+           }];
+  operation.thumbnailSize = @256;
+  operation.imageManager = mockImageManager;
+
+  [operation start];
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+  [mockAssetUtil stopMocking];
+}
+
+- (void)testFailingFileLoadFallsBackToData API_AVAILABLE(ios(14)) {
+  NSURL *imageURL = [[NSBundle bundleForClass:[self class]] URLForResource:@"pngImage"
+                                                             withExtension:@"png"];
+  NSError *loadFileError = [NSError errorWithDomain:@"PHPickerDomain" code:1234 userInfo:nil];
+
+  id mockItemProvider = OCMClassMock([NSItemProvider class]);
+  OCMStub([mockItemProvider hasItemConformingToTypeIdentifier:OCMOCK_ANY]).andReturn(YES);
+  [[mockItemProvider stub]
+      loadFileRepresentationForTypeIdentifier:OCMOCK_ANY
+                            completionHandler:[OCMArg invokeBlockWithArgs:[NSNull null],
+                                                                          loadFileError, nil]];
+  [[mockItemProvider stub]
+      loadDataRepresentationForTypeIdentifier:OCMOCK_ANY
+                            completionHandler:[OCMArg
+                                                  invokeBlockWithArgs:[NSData
+                                                                          dataWithContentsOfURL:
+                                                                              imageURL],
+                                                                      [NSNull null], nil]];
+
+  id pickerResult = OCMClassMock([PHPickerResult class]);
+  OCMStub([pickerResult itemProvider]).andReturn(mockItemProvider);
+
+  XCTestExpectation *pathExpectation = [self expectationWithDescription:@"Path was created"];
+  FLTPHPickerSaveImageToPathOperation *operation = [[FLTPHPickerSaveImageToPathOperation alloc]
+           initWithResult:pickerResult
+                maxHeight:nil
+                 maxWidth:nil
+      desiredImageQuality:@1
+             fullMetadata:NO
+           savedPathBlock:^(NSString *savedPath, FlutterError *error) {
+             XCTAssertNil(error);
+             XCTAssertEqualObjects([NSURL URLWithString:savedPath].pathExtension, @"png");
+             [pathExpectation fulfill];
+           }];
+
+  [operation start];
+  [self waitForExpectationsWithTimeout:30 handler:nil];
+}
+
 /**
  * Creates a mock picker result using NSItemProvider.
  *
@@ -7,15 +7,6 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface GIFInfo : NSObject
-
-@property(strong, nonatomic, readonly) NSArray<UIImage *> *images;
-@property(assign, nonatomic, readonly) NSTimeInterval interval;
-
-- (instancetype)initWithImages:(NSArray<UIImage *> *)images interval:(NSTimeInterval)interval;
-
-@end
-
 @interface FLTImagePickerImageUtil : NSObject
 
 // Resizes the given image to fit within maxWidth (if non-nil) and maxHeight (if non-nil)
@@ -24,10 +15,29 @@ NS_ASSUME_NONNULL_BEGIN
                maxHeight:(nullable NSNumber *)maxHeight
      isMetadataAvailable:(BOOL)isMetadataAvailable;
 
-// Resize all gif animation frames.
-+ (GIFInfo *)scaledGIFImage:(NSData *)data
-                   maxWidth:(NSNumber *)maxWidth
-                  maxHeight:(NSNumber *)maxHeight;
+// Decodes the image in `data` at the size that fits within maxWidth (if non-nil) and maxHeight (if
+// non-nil), without decoding it at full size first.
+//
+// The pixels keep the orientation they are stored with and the returned image has
+// UIImageOrientationUp, the same as `scaledImage:` when metadata is available.
++ (nullable UIImage *)scaledImageFromData:(NSData *)data
+                                 maxWidth:(nullable NSNumber *)maxWidth
+                                maxHeight:(nullable NSNumber *)maxHeight;
+
+// Resizes all frames of the animated GIF in `data` to fit within maxWidth (if non-nil) and
+// maxHeight (if non-nil), and writes them to a GIF file at `url` with the destination
+// `properties`. Every frame gets the first non-zero delay of the original frames.
+//
+// Frames are decoded at their scaled size in batches of one frame per active processor, and each
+// batch is added to the file and released before the next one is decoded, instead of keeping all
+// frames until the file is written. A frame that cannot be decoded repeats the previous one.
+//
+// Returns NO if the first frame cannot be decoded or the file cannot be written.
++ (BOOL)writeScaledGIFImage:(NSData *)data
+                   maxWidth:(nullable NSNumber *)maxWidth
+                  maxHeight:(nullable NSNumber *)maxHeight
+                 properties:(nullable NSDictionary *)properties
+                      toURL:(NSURL *)url;
 
 @end
 
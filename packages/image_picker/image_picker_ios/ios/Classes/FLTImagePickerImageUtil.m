@@ -5,35 +5,12 @@
 #import "FLTImagePickerImageUtil.h"
 #import <MobileCoreServices/MobileCoreServices.h>
 
-@interface GIFInfo ()
-
-@property(strong, nonatomic, readwrite) NSArray<UIImage *> *images;
-@property(assign, nonatomic, readwrite) NSTimeInterval interval;
-
-@end
-
-@implementation GIFInfo
-
-- (instancetype)initWithImages:(NSArray<UIImage *> *)images interval:(NSTimeInterval)interval;
-{
-  self = [super init];
-  if (self) {
-    self.images = images;
-    self.interval = interval;
-  }
-  return self;
-}
-
-@end
-
-@implementation FLTImagePickerImageUtil : NSObject
-
-+ (UIImage *)scaledImage:(UIImage *)image
-                maxWidth:(NSNumber *)maxWidth
-               maxHeight:(NSNumber *)maxHeight
-     isMetadataAvailable:(BOOL)isMetadataAvailable {
-  double originalWidth = image.size.width;
-  double originalHeight = image.size.height;
+// Returns the size an image of `originalSize` is scaled to so that it fits within maxWidth (if
+// non-nil) and maxHeight (if non-nil).
+static CGSize FLTImagePickerScaledSize(CGSize originalSize, NSNumber *_Nullable maxWidth,
+                                       NSNumber *_Nullable maxHeight) {
+  double originalWidth = originalSize.width;
+  double originalHeight = originalSize.height;
 
   bool hasMaxWidth = maxWidth != nil;
   bool hasMaxHeight = maxHeight != nil;
@@ -70,6 +47,76 @@
     }
   }
 
+  return CGSizeMake(width, height);
+}
+
+// Decodes the image at `index` of `imageSource` directly at `pixelSize`, without decoding the
+// full-size image first.
+//
+// The pixels are not rotated by the orientation of the image. The decoded image is redrawn to
+// exactly `pixelSize` when ImageIO rounds its size differently.
+static CGImageRef _Nullable FLTImagePickerCreateScaledImageAtIndex(CGImageSourceRef imageSource,
+                                                                   size_t index,
+                                                                   CGSize pixelSize) {
+  NSDictionary<NSString *, id> *options = @{
+    (NSString *)kCGImageSourceCreateThumbnailFromImageAlways : @YES,
+    (NSString *)kCGImageSourceCreateThumbnailWithTransform : @NO,
+    (NSString *)kCGImageSourceShouldCacheImmediately : @YES,
+    (NSString *)kCGImageSourceThumbnailMaxPixelSize : @(MAX(pixelSize.width, pixelSize.height)),
+  };
+  CGImageRef thumbnail =
+      CGImageSourceCreateThumbnailAtIndex(imageSource, index, (__bridge CFDictionaryRef)options);
+  if (thumbnail == NULL || (CGImageGetWidth(thumbnail) == (size_t)pixelSize.width &&
+                            CGImageGetHeight(thumbnail) == (size_t)pixelSize.height)) {
+    return thumbnail;
+  }
+
+  UIGraphicsBeginImageContextWithOptions(pixelSize, NO, 1.0);
+  [[UIImage imageWithCGImage:thumbnail] drawInRect:CGRectMake(0, 0, pixelSize.width,
+                                                               pixelSize.height)];
+  CGImageRef scaledImage = CGImageRetain(UIGraphicsGetImageFromCurrentImageContext().CGImage);
+  UIGraphicsEndImageContext();
+  CGImageRelease(thumbnail);
+  return scaledImage;
+}
+
+// Decodes the frame at `index` of the GIF in `imageSource` at the size that fits within maxWidth
+// (if non-nil) and maxHeight (if non-nil).
+static CGImageRef _Nullable FLTImagePickerCreateScaledGIFFrame(CGImageSourceRef imageSource,
+                                                               size_t index,
+                                                               NSNumber *_Nullable maxWidth,
+                                                               NSNumber *_Nullable maxHeight) {
+  NSDictionary *properties = (NSDictionary *)CFBridgingRelease(
+      CGImageSourceCopyPropertiesAtIndex(imageSource, index, NULL));
+  double frameWidth = [properties[(NSString *)kCGImagePropertyPixelWidth] doubleValue];
+  double frameHeight = [properties[(NSString *)kCGImagePropertyPixelHeight] doubleValue];
+  CGSize scaledSize =
+      FLTImagePickerScaledSize(CGSizeMake(frameWidth, frameHeight), maxWidth, maxHeight);
+  return FLTImagePickerCreateScaledImageAtIndex(imageSource, index, scaledSize);
+}
+
+// Returns the delay of the frame at `index` of the GIF in `imageSource`, in seconds.
+static NSTimeInterval FLTImagePickerGIFFrameDelay(CGImageSourceRef imageSource, size_t index) {
+  NSDictionary *properties = (NSDictionary *)CFBridgingRelease(
+      CGImageSourceCopyPropertiesAtIndex(imageSource, index, NULL));
+  NSDictionary *gifProperties = properties[(NSString *)kCGImagePropertyGIFDictionary];
+  NSNumber *delay = gifProperties[(NSString *)kCGImagePropertyGIFUnclampedDelayTime];
+  if (delay == nil) {
+    delay = gifProperties[(NSString *)kCGImagePropertyGIFDelayTime];
+  }
+  return [delay doubleValue];
+}
+
+@implementation FLTImagePickerImageUtil : NSObject
+
++ (UIImage *)scaledImage:(UIImage *)image
+                maxWidth:(NSNumber *)maxWidth
+               maxHeight:(NSNumber *)maxHeight
+     isMetadataAvailable:(BOOL)isMetadataAvailable {
+  CGSize scaledSize = FLTImagePickerScaledSize(image.size, maxWidth, maxHeight);
+  double width = scaledSize.width;
+  double height = scaledSize.height;
+
   if (!isMetadataAvailable) {
     UIImage *imageToScale = [UIImage imageWithCGImage:image.CGImage
                                                 scale:1
@@ -112,50 +159,118 @@
   return scaledImage;
 }
 
-+ (GIFInfo *)scaledGIFImage:(NSData *)data
++ (nullable UIImage *)scaledImageFromData:(NSData *)data
+                                 maxWidth:(NSNumber *)maxWidth
+                                maxHeight:(NSNumber *)maxHeight {
+  CGImageSourceRef imageSource = CGImageSourceCreateWithData((__bridge CFDataRef)data, NULL);
+  if (imageSource == NULL) {
+    return nil;
+  }
+
+  // Reading the properties only parses the header of the image.
+  NSDictionary *properties =
+      (NSDictionary *)CFBridgingRelease(CGImageSourceCopyPropertiesAtIndex(imageSource, 0, NULL));
+  double pixelWidth = [properties[(NSString *)kCGImagePropertyPixelWidth] doubleValue];
+  double pixelHeight = [properties[(NSString *)kCGImagePropertyPixelHeight] doubleValue];
+  CGImagePropertyOrientation orientation =
+      [properties[(NSString *)kCGImagePropertyOrientation] unsignedIntValue];
+
+  // maxWidth and maxHeight apply to the image as it is displayed, so the size is computed with the
+  // width and height swapped for orientations that rotate the pixels by 90 degrees, and swapped
+  // back to scale the pixels. The same as `scaledImage:` with metadata, the pixels keep their
+  // original orientation, which is restored from the metadata of the original image when saved.
+  BOOL isRotated = orientation == kCGImagePropertyOrientationLeft ||
+                   orientation == kCGImagePropertyOrientationRight ||
+                   orientation == kCGImagePropertyOrientationLeftMirrored ||
+                   orientation == kCGImagePropertyOrientationRightMirrored;
+  CGSize displayedSize =
+      isRotated ? CGSizeMake(pixelHeight, pixelWidth) : CGSizeMake(pixelWidth, pixelHeight);
+  CGSize scaledSize = FLTImagePickerScaledSize(displayedSize, maxWidth, maxHeight);
+  if (isRotated) {
+    scaledSize = CGSizeMake(scaledSize.height, scaledSize.width);
+  }
+
+  CGImageRef imageRef = FLTImagePickerCreateScaledImageAtIndex(imageSource, 0, scaledSize);
+  CFRelease(imageSource);
+  if (imageRef == NULL) {
+    return nil;
+  }
+
+  UIImage *image = [UIImage imageWithCGImage:imageRef scale:1.0 orientation:UIImageOrientationUp];
+  CGImageRelease(imageRef);
+  return image;
+}
+
++ (BOOL)writeScaledGIFImage:(NSData *)data
                    maxWidth:(NSNumber *)maxWidth
-                  maxHeight:(NSNumber *)maxHeight {
+                  maxHeight:(NSNumber *)maxHeight
+                 properties:(NSDictionary *)properties
+                      toURL:(NSURL *)url {
   NSMutableDictionary<NSString *, id> *options = [NSMutableDictionary dictionary];
-  options[(NSString *)kCGImageSourceShouldCache] = @YES;
+  // Frames are decoded once, at their scaled size, so the full-size frames are not cached.
+  options[(NSString *)kCGImageSourceShouldCache] = @NO;
   options[(NSString *)kCGImageSourceTypeIdentifierHint] = (NSString *)kUTTypeGIF;
 
   CGImageSourceRef imageSource =
       CGImageSourceCreateWithData((__bridge CFDataRef)data, (__bridge CFDictionaryRef)options);
+  if (imageSource == NULL) {
+    return NO;
+  }
 
   size_t numberOfFrames = CGImageSourceGetCount(imageSource);
-  NSMutableArray<UIImage *> *images = [NSMutableArray arrayWithCapacity:numberOfFrames];
+  CGImageDestinationRef destination =
+      numberOfFrames == 0 ? NULL
+                          : CGImageDestinationCreateWithURL((__bridge CFURLRef)url, kUTTypeGIF,
+                                                            numberOfFrames, NULL);
+  if (destination == NULL) {
+    CFRelease(imageSource);
+    return NO;
+  }
+  CGImageDestinationSetProperties(destination, (__bridge CFDictionaryRef)properties);
 
+  // Reading the frame properties only parses the headers of the frames.
   NSTimeInterval interval = 0.0;
-  for (size_t index = 0; index < numberOfFrames; index++) {
-    CGImageRef imageRef =
-        CGImageSourceCreateImageAtIndex(imageSource, index, (__bridge CFDictionaryRef)options);
-
-    NSDictionary *properties = (NSDictionary *)CFBridgingRelease(
-        CGImageSourceCopyPropertiesAtIndex(imageSource, index, NULL));
-    NSDictionary *gifProperties = properties[(NSString *)kCGImagePropertyGIFDictionary];
-
-    NSNumber *delay = gifProperties[(NSString *)kCGImagePropertyGIFUnclampedDelayTime];
-    if (delay == nil) {
-      delay = gifProperties[(NSString *)kCGImagePropertyGIFDelayTime];
-    }
+  for (size_t index = 0; index < numberOfFrames && interval == 0.0; index++) {
+    interval = FLTImagePickerGIFFrameDelay(imageSource, index);
+  }
+  NSDictionary *frameProperties = @{
+    (NSString *)kCGImagePropertyGIFDictionary : @{
+      (NSString *)kCGImagePropertyGIFDelayTime : @(interval),
+    },
+  };
+
+  size_t batchSize = MAX(NSProcessInfo.processInfo.activeProcessorCount, (NSUInteger)1);
+  CGImageRef *frames = calloc(batchSize, sizeof(CGImageRef));
+  CGImageRef previousFrame = NULL;
+  for (size_t batchStart = 0; batchStart < numberOfFrames; batchStart += batchSize) {
+    size_t batchCount = MIN(batchSize, numberOfFrames - batchStart);
+    dispatch_apply(batchCount, DISPATCH_APPLY_AUTO, ^(size_t offset) {
+      @autoreleasepool {
+        frames[offset] = FLTImagePickerCreateScaledGIFFrame(imageSource, batchStart + offset,
+                                                            maxWidth, maxHeight);
+      }
+    });
 
-    if (interval == 0.0) {
-      interval = [delay doubleValue];
+    for (size_t offset = 0; offset < batchCount; offset++) {
+      if (frames[offset] != NULL) {
+        CGImageRelease(previousFrame);
+        previousFrame = frames[offset];
+        frames[offset] = NULL;
+      }
+      if (previousFrame != NULL) {
+        CGImageDestinationAddImage(destination, previousFrame,
+                                   (__bridge CFDictionaryRef)frameProperties);
+      }
     }
-
-    UIImage *image = [UIImage imageWithCGImage:imageRef scale:1.0 orientation:UIImageOrientationUp];
-    image = [self scaledImage:image maxWidth:maxWidth maxHeight:maxHeight isMetadataAvailable:YES];
-
-    [images addObject:image];
-
-    CGImageRelease(imageRef);
   }
+  CGImageRelease(previousFrame);
+  free(frames);
 
+  // Finalizing fails if a frame was not added because the first frames could not be decoded.
+  BOOL written = CGImageDestinationFinalize(destination);
+  CFRelease(destination);
   CFRelease(imageSource);
-
-  GIFInfo *info = [[GIFInfo alloc] initWithImages:images interval:interval];
-
-  return info;
+  return written;
 }
 
 @end
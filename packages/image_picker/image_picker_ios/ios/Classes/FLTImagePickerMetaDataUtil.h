@@ -11,9 +11,21 @@ typedef enum : NSUInteger {
   FLTImagePickerMIMETypePNG,
   FLTImagePickerMIMETypeJPEG,
   FLTImagePickerMIMETypeGIF,
+  FLTImagePickerMIMETypeHEIC,
   FLTImagePickerMIMETypeOther,
 } FLTImagePickerMIMEType;
 
+// The format that images which have to be re-encoded are saved in.
+typedef enum : NSUInteger {
+  // Images are saved as JPEG, unless they are PNG or GIF images.
+  FLTImagePickerOutputFormatJPEG,
+  // Images are saved in their original format if it is JPEG, PNG, GIF or HEIC, and as JPEG
+  // otherwise.
+  FLTImagePickerOutputFormatSource,
+  // Images are saved as HEIC, unless they are GIF images or HEIC encoding is not available.
+  FLTImagePickerOutputFormatHEIC,
+} FLTImagePickerOutputFormat;
+
 extern NSString *const kFLTImagePickerDefaultSuffix;
 extern const FLTImagePickerMIMEType kFLTImagePickerMIMETypeDefault;
 
@@ -43,6 +55,24 @@ extern const FLTImagePickerMIMEType kFLTImagePickerMIMETypeDefault;
                        usingType:(FLTImagePickerMIMEType)type
                          quality:(nullable NSNumber *)quality;
 
+// Whether images can be encoded as HEIC on this device.
++ (BOOL)canEncodeHEIC;
+
+// Returns the type that an image of sourceType is saved as in the given output format.
+//
+// GIF images are always saved as GIF, and HEIC falls back to JPEG if it cannot be encoded.
++ (FLTImagePickerMIMEType)outputTypeForSourceType:(FLTImagePickerMIMEType)sourceType
+                                           format:(FLTImagePickerOutputFormat)format;
+
+// Encodes image as type with ImageIO, writing the given metadata in the same pass.
+//
+// The quality applies to JPEG and HEIC only, and defaults to 1. ImageIO encodes HEIC with the
+// hardware HEVC encoder when the device has one. Returns nil if the image cannot be encoded.
++ (nullable NSData *)imageDataFromImage:(UIImage *)image
+                              usingType:(FLTImagePickerMIMEType)type
+                                quality:(nullable NSNumber *)quality
+                               metaData:(nullable NSDictionary *)metaData;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -3,18 +3,27 @@
 // found in the LICENSE file.
 
 #import "FLTImagePickerMetaDataUtil.h"
+#import <MobileCoreServices/MobileCoreServices.h>
 #import <Photos/Photos.h>
+#import <libkern/OSByteOrder.h>
 
 static const uint8_t kFirstByteJPEG = 0xFF;
 static const uint8_t kFirstBytePNG = 0x89;
 static const uint8_t kFirstByteGIF = 0x47;
 
+// HEIC files start with an ISO base media file type box, whose brands name the codec.
+static const NSUInteger kHEICHeaderLength = 12;
+static NSString *const kHEICTypeIdentifier = @"public.heic";
+
 NSString *const kFLTImagePickerDefaultSuffix = @".jpg";
 const FLTImagePickerMIMEType kFLTImagePickerMIMETypeDefault = FLTImagePickerMIMETypeJPEG;
 
 @implementation FLTImagePickerMetaDataUtil
 
 + (FLTImagePickerMIMEType)getImageMIMETypeFromImageData:(NSData *)imageData {
+  if ([self isHEICImageData:imageData]) {
+    return FLTImagePickerMIMETypeHEIC;
+  }
   uint8_t firstByte;
   [imageData getBytes:&firstByte length:1];
   switch (firstByte) {
@@ -28,6 +37,33 @@ const FLTImagePickerMIMEType kFLTImagePickerMIMETypeDefault = FLTImagePickerMIME
   return FLTImagePickerMIMETypeOther;
 }
 
++ (BOOL)isHEICImageData:(NSData *)imageData {
+  if (imageData.length < kHEICHeaderLength) {
+    return NO;
+  }
+  const uint8_t *bytes = imageData.bytes;
+  if (memcmp(bytes + 4, "ftyp", 4) != 0) {
+    return NO;
+  }
+  // The major brand is followed by a minor version and a list of compatible brands, any of which
+  // may name HEVC when the major brand is a generic HEIF one such as "mif1".
+  NSArray<NSString *> *heicBrands = @[ @"heic", @"heix", @"hevc", @"hevx" ];
+  NSUInteger boxLength = MIN((NSUInteger)OSReadBigInt32(bytes, 0), imageData.length);
+  for (NSUInteger offset = 8; offset + 4 <= boxLength; offset += 4) {
+    if (offset == 12) {
+      // Skips the minor version.
+      continue;
+    }
+    NSString *brand = [[NSString alloc] initWithBytes:bytes + offset
+                                               length:4
+                                             encoding:NSASCIIStringEncoding];
+    if ([heicBrands containsObject:brand]) {
+      return YES;
+    }
+  }
+  return NO;
+}
+
 + (NSString *)imageTypeSuffixFromType:(FLTImagePickerMIMEType)type {
   switch (type) {
     case FLTImagePickerMIMETypeJPEG:
@@ -36,6 +72,8 @@ const FLTImagePickerMIMEType kFLTImagePickerMIMETypeDefault = FLTImagePickerMIME
       return @".png";
     case FLTImagePickerMIMETypeGIF:
       return @".gif";
+    case FLTImagePickerMIMETypeHEIC:
+      return @".heic";
     default:
       return nil;
   }
@@ -65,13 +103,56 @@ const FLTImagePickerMIMEType kFLTImagePickerMIMETypeDefault = FLTImagePickerMIME
     CFRelease(source);
     return nil;
   }
-  CGImageDestinationAddImageFromSource(destination, source, 0, (__bridge CFDictionaryRef)metadata);
-  CGImageDestinationFinalize(destination);
-  CFRelease(source);
+  // Copying the image source writes the new metadata without decoding and re-encoding the pixels.
+  NSDictionary *copyOptions = [self imageSourceCopyOptionsFromProperties:metadata];
+  BOOL copied = CGImageDestinationCopyImageSource(destination, source,
+                                                  (__bridge CFDictionaryRef)copyOptions, NULL);
   CFRelease(destination);
+  if (!copied) {
+    // Some formats cannot be copied, so their image is re-encoded with the metadata instead.
+    [targetData setLength:0];
+    destination =
+        CGImageDestinationCreateWithData((__bridge CFMutableDataRef)targetData, sourceType, 1, nil);
+    if (destination == NULL) {
+      CFRelease(source);
+      return nil;
+    }
+    CGImageDestinationAddImageFromSource(destination, source, 0,
+                                         (__bridge CFDictionaryRef)metadata);
+    CGImageDestinationFinalize(destination);
+    CFRelease(destination);
+  }
+  CFRelease(source);
   return targetData;
 }
 
+// Converts image properties, as returned by CGImageSourceCopyPropertiesAtIndex, to the options of
+// CGImageDestinationCopyImageSource, which take the metadata as a CGImageMetadataRef.
++ (NSDictionary *)imageSourceCopyOptionsFromProperties:(NSDictionary *)properties {
+  CGMutableImageMetadataRef metadata = CGImageMetadataCreateMutable();
+  [properties enumerateKeysAndObjectsUsingBlock:^(NSString *dictionaryName, id dictionary,
+                                                  BOOL *stop) {
+    if (![dictionary isKindOfClass:[NSDictionary class]]) {
+      return;
+    }
+    [(NSDictionary *)dictionary
+        enumerateKeysAndObjectsUsingBlock:^(NSString *propertyName, id value, BOOL *stop) {
+          // Properties that have no XMP equivalent are skipped.
+          CGImageMetadataSetValueMatchingImageProperty(
+              metadata, (__bridge CFStringRef)dictionaryName, (__bridge CFStringRef)propertyName,
+              (__bridge CFTypeRef)value);
+        }];
+  }];
+  NSMutableDictionary *options = [NSMutableDictionary dictionary];
+  options[(__bridge NSString *)kCGImageDestinationMetadata] = CFBridgingRelease(metadata);
+  options[(__bridge NSString *)kCGImageDestinationMergeMetadata] = @YES;
+  NSNumber *orientation = properties[(__bridge NSString *)kCGImagePropertyOrientation];
+  if (orientation) {
+    options[(__bridge NSString *)kCGImageDestinationOrientation] = orientation;
+  }
+  return options;
+}
+
 + (NSData *)convertImage:(UIImage *)image
                usingType:(FLTImagePickerMIMEType)type
                  quality:(nullable NSNumber *)quality {
@@ -96,4 +177,109 @@ const FLTImagePickerMIMEType kFLTImagePickerMIMETypeDefault = FLTImagePickerMIME
   }
 }
 
++ (BOOL)canEncodeHEIC {
+  static BOOL canEncodeHEIC;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    NSArray *typeIdentifiers =
+        (NSArray *)CFBridgingRelease(CGImageDestinationCopyTypeIdentifiers());
+    canEncodeHEIC = [typeIdentifiers containsObject:kHEICTypeIdentifier];
+  });
+  return canEncodeHEIC;
+}
+
++ (FLTImagePickerMIMEType)outputTypeForSourceType:(FLTImagePickerMIMEType)sourceType
+                                           format:(FLTImagePickerOutputFormat)format {
+  if (sourceType == FLTImagePickerMIMETypeGIF) {
+    return FLTImagePickerMIMETypeGIF;
+  }
+  FLTImagePickerMIMEType type;
+  switch (format) {
+    case FLTImagePickerOutputFormatHEIC:
+      type = FLTImagePickerMIMETypeHEIC;
+      break;
+    case FLTImagePickerOutputFormatSource:
+      type = sourceType == FLTImagePickerMIMETypeOther ? kFLTImagePickerMIMETypeDefault
+                                                       : sourceType;
+      break;
+    default:
+      type = sourceType == FLTImagePickerMIMETypePNG ? FLTImagePickerMIMETypePNG
+                                                     : kFLTImagePickerMIMETypeDefault;
+      break;
+  }
+  if (type == FLTImagePickerMIMETypeHEIC && ![self canEncodeHEIC]) {
+    return kFLTImagePickerMIMETypeDefault;
+  }
+  return type;
+}
+
++ (NSData *)imageDataFromImage:(UIImage *)image
+                     usingType:(FLTImagePickerMIMEType)type
+                       quality:(nullable NSNumber *)quality
+                      metaData:(nullable NSDictionary *)metaData {
+  CFStringRef typeIdentifier;
+  BOOL isLossy = YES;
+  switch (type) {
+    case FLTImagePickerMIMETypePNG:
+      typeIdentifier = kUTTypePNG;
+      isLossy = NO;
+      break;
+    case FLTImagePickerMIMETypeHEIC:
+      typeIdentifier = (__bridge CFStringRef)kHEICTypeIdentifier;
+      break;
+    default:
+      typeIdentifier = kUTTypeJPEG;
+      break;
+  }
+  if (image.CGImage == NULL) {
+    return nil;
+  }
+
+  NSMutableDictionary *properties = [NSMutableDictionary dictionaryWithDictionary:metaData];
+  NSString *orientationKey = (__bridge NSString *)kCGImagePropertyOrientation;
+  // Like when copying metadata onto encoded data, the original orientation takes precedence.
+  if (properties[orientationKey] == nil) {
+    properties[orientationKey] = @([self propertyOrientationFromImageOrientation:image]);
+  }
+  if (isLossy) {
+    properties[(__bridge NSString *)kCGImageDestinationLossyCompressionQuality] = quality ?: @1;
+  } else if (quality) {
+    NSLog(@"image_picker: compressing is not supported for type %@. Returning the image with "
+          @"original quality",
+          [FLTImagePickerMetaDataUtil imageTypeSuffixFromType:type]);
+  }
+
+  NSMutableData *targetData = [NSMutableData data];
+  CGImageDestinationRef destination = CGImageDestinationCreateWithData(
+      (__bridge CFMutableDataRef)targetData, typeIdentifier, 1, nil);
+  if (destination == NULL) {
+    return nil;
+  }
+  CGImageDestinationAddImage(destination, image.CGImage, (__bridge CFDictionaryRef)properties);
+  BOOL success = CGImageDestinationFinalize(destination);
+  CFRelease(destination);
+  return success ? targetData : nil;
+}
+
++ (CGImagePropertyOrientation)propertyOrientationFromImageOrientation:(UIImage *)image {
+  switch (image.imageOrientation) {
+    case UIImageOrientationDown:
+      return kCGImagePropertyOrientationDown;
+    case UIImageOrientationLeft:
+      return kCGImagePropertyOrientationLeft;
+    case UIImageOrientationRight:
+      return kCGImagePropertyOrientationRight;
+    case UIImageOrientationUpMirrored:
+      return kCGImagePropertyOrientationUpMirrored;
+    case UIImageOrientationDownMirrored:
+      return kCGImagePropertyOrientationDownMirrored;
+    case UIImageOrientationLeftMirrored:
+      return kCGImagePropertyOrientationLeftMirrored;
+    case UIImageOrientationRightMirrored:
+      return kCGImagePropertyOrientationRightMirrored;
+    default:
+      return kCGImagePropertyOrientationUp;
+  }
+}
+
 @end
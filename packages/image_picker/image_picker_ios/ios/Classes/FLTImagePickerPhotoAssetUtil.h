@@ -7,6 +7,7 @@
 #import <PhotosUI/PhotosUI.h>
 
 #import "FLTImagePickerImageUtil.h"
+#import "FLTImagePickerMetaDataUtil.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -16,22 +17,57 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (nullable PHAsset *)getAssetFromPHPickerResult:(PHPickerResult *)result API_AVAILABLE(ios(14));
 
+// Whether the app is allowed to read assets from the photo library, which is needed to fetch the
+// PHAsset of a picked item.
++ (BOOL)canReadPhotoLibrary API_AVAILABLE(ios(14));
+
 // Saves video to temporary URL. Returns nil on failure;
 + (NSURL *)saveVideoFromURL:(NSURL *)videoURL;
 
+// Transcodes the video at videoURL to a temporary file with the given AVAssetExportSession preset,
+// reading the original only once. Falls back to saveVideoFromURL: if the preset cannot be applied
+// to the video. Calls completion on an arbitrary queue, with nil on failure.
++ (void)exportVideoFromURL:(NSURL *)videoURL
+                presetName:(NSString *)presetName
+                completion:(void (^)(NSURL *_Nullable destination))completion;
+
+// Copies the image file at imageURL to a temporary file with the given suffix, without reading it
+// into memory. Returns nil on failure.
++ (nullable NSString *)saveImageFromURL:(NSURL *)imageURL suffix:(NSString *)suffix;
+
 // Saves image with correct meta data and extention copied from the original asset.
-// maxWidth and maxHeight are used only for GIF images.
+// maxWidth and maxHeight scale GIF images, and mark other images as already scaled.
+//
+// If neither a maximum size nor a quality below 1 is requested and the image keeps its type, the
+// original image data is saved as is, without decoding it or copying its metadata. Otherwise image
+// is re-encoded, and decoded from originalImageData first if it is nil.
 + (NSString *)saveImageWithOriginalImageData:(NSData *)originalImageData
-                                       image:(UIImage *)image
+                                       image:(nullable UIImage *)image
                                     maxWidth:(nullable NSNumber *)maxWidth
                                    maxHeight:(nullable NSNumber *)maxHeight
                                 imageQuality:(nullable NSNumber *)imageQuality;
 
+// Saves image like saveImageWithOriginalImageData:image:maxWidth:maxHeight:imageQuality:, but
+// re-encodes it in the given output format.
++ (NSString *)saveImageWithOriginalImageData:(NSData *)originalImageData
+                                       image:(nullable UIImage *)image
+                                    maxWidth:(nullable NSNumber *)maxWidth
+                                   maxHeight:(nullable NSNumber *)maxHeight
+                                imageQuality:(nullable NSNumber *)imageQuality
+                                outputFormat:(FLTImagePickerOutputFormat)outputFormat;
+
 // Save image with correct meta data and extention copied from image picker result info.
 + (NSString *)saveImageWithPickerInfo:(nullable NSDictionary *)info
                                 image:(UIImage *)image
                          imageQuality:(nullable NSNumber *)imageQuality;
 
+// Saves image like saveImageWithPickerInfo:image:imageQuality:, but encodes it in the given
+// output format.
++ (NSString *)saveImageWithPickerInfo:(nullable NSDictionary *)info
+                                image:(UIImage *)image
+                         imageQuality:(nullable NSNumber *)imageQuality
+                         outputFormat:(FLTImagePickerOutputFormat)outputFormat;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -6,6 +6,7 @@
 #import "FLTImagePickerImageUtil.h"
 #import "FLTImagePickerMetaDataUtil.h"
 
+#import <AVFoundation/AVFoundation.h>
 #import <MobileCoreServices/MobileCoreServices.h>
 
 @implementation FLTImagePickerPhotoAssetUtil
@@ -20,6 +21,12 @@
   return fetchResult.firstObject;
 }
 
++ (BOOL)canReadPhotoLibrary API_AVAILABLE(ios(14)) {
+  PHAuthorizationStatus status =
+      [PHPhotoLibrary authorizationStatusForAccessLevel:PHAccessLevelReadWrite];
+  return status == PHAuthorizationStatusAuthorized || status == PHAuthorizationStatusLimited;
+}
+
 + (NSURL *)saveVideoFromURL:(NSURL *)videoURL {
   if (![[NSFileManager defaultManager] isReadableFileAtPath:[videoURL path]]) {
     return nil;
@@ -34,30 +41,91 @@
   return destination;
 }
 
++ (void)exportVideoFromURL:(NSURL *)videoURL
+                presetName:(NSString *)presetName
+                completion:(void (^)(NSURL *_Nullable destination))completion {
+  AVURLAsset *asset = [AVURLAsset URLAssetWithURL:videoURL options:nil];
+  AVAssetExportSession *exportSession = nil;
+  if ([[AVAssetExportSession exportPresetsCompatibleWithAsset:asset] containsObject:presetName]) {
+    exportSession = [AVAssetExportSession exportSessionWithAsset:asset presetName:presetName];
+  }
+  NSArray<AVFileType> *fileTypes = exportSession.supportedFileTypes;
+  BOOL isMPEG4 = [fileTypes containsObject:AVFileTypeMPEG4];
+  if (!isMPEG4 && ![fileTypes containsObject:AVFileTypeQuickTimeMovie]) {
+    completion([self saveVideoFromURL:videoURL]);
+    return;
+  }
+
+  exportSession.outputFileType = isMPEG4 ? AVFileTypeMPEG4 : AVFileTypeQuickTimeMovie;
+  NSString *path = [self temporaryFilePath:isMPEG4 ? @".mp4" : @".mov"];
+  exportSession.outputURL = [NSURL fileURLWithPath:path];
+  exportSession.shouldOptimizeForNetworkUse = YES;
+  [exportSession exportAsynchronouslyWithCompletionHandler:^{
+    if (exportSession.status == AVAssetExportSessionStatusCompleted) {
+      completion(exportSession.outputURL);
+    } else {
+      [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+      completion([self saveVideoFromURL:videoURL]);
+    }
+  }];
+}
+
++ (NSString *)saveImageFromURL:(NSURL *)imageURL suffix:(NSString *)suffix {
+  NSURL *destination = [NSURL fileURLWithPath:[self temporaryFilePath:suffix]];
+  NSError *error;
+  // On APFS the copy is a clone, which shares the blocks of the original file.
+  if (![[NSFileManager defaultManager] copyItemAtURL:imageURL toURL:destination error:&error]) {
+    return nil;
+  }
+  return destination.path;
+}
+
 + (NSString *)saveImageWithOriginalImageData:(NSData *)originalImageData
                                        image:(UIImage *)image
                                     maxWidth:(NSNumber *)maxWidth
                                    maxHeight:(NSNumber *)maxHeight
                                 imageQuality:(NSNumber *)imageQuality {
-  NSString *suffix = kFLTImagePickerDefaultSuffix;
-  FLTImagePickerMIMEType type = kFLTImagePickerMIMETypeDefault;
-  NSDictionary *metaData = nil;
+  return [self saveImageWithOriginalImageData:originalImageData
+                                        image:image
+                                     maxWidth:maxWidth
+                                    maxHeight:maxHeight
+                                 imageQuality:imageQuality
+                                 outputFormat:FLTImagePickerOutputFormatJPEG];
+}
+
++ (NSString *)saveImageWithOriginalImageData:(NSData *)originalImageData
+                                       image:(UIImage *)image
+                                    maxWidth:(NSNumber *)maxWidth
+                                   maxHeight:(NSNumber *)maxHeight
+                                imageQuality:(NSNumber *)imageQuality
+                                outputFormat:(FLTImagePickerOutputFormat)outputFormat {
+  FLTImagePickerMIMEType sourceType = FLTImagePickerMIMETypeOther;
   // Getting the image type from the original image data if necessary.
   if (originalImageData) {
-    type = [FLTImagePickerMetaDataUtil getImageMIMETypeFromImageData:originalImageData];
-    suffix =
-        [FLTImagePickerMetaDataUtil imageTypeSuffixFromType:type] ?: kFLTImagePickerDefaultSuffix;
-    metaData = [FLTImagePickerMetaDataUtil getMetaDataFromImageData:originalImageData];
+    sourceType = [FLTImagePickerMetaDataUtil getImageMIMETypeFromImageData:originalImageData];
+  }
+  FLTImagePickerMIMEType type = [FLTImagePickerMetaDataUtil outputTypeForSourceType:sourceType
+                                                                             format:outputFormat];
+  NSString *suffix =
+      [FLTImagePickerMetaDataUtil imageTypeSuffixFromType:type] ?: kFLTImagePickerDefaultSuffix;
+  BOOL isResized = maxWidth != nil || maxHeight != nil;
+  BOOL isCompressed = imageQuality != nil && imageQuality.doubleValue < 1;
+  if (originalImageData && type == sourceType && !isResized && !isCompressed) {
+    // The original data already holds the pixels and metadata that would be written.
+    return [self createFile:originalImageData suffix:suffix];
   }
+  NSDictionary *metaData =
+      originalImageData ? [FLTImagePickerMetaDataUtil getMetaDataFromImageData:originalImageData]
+                        : nil;
   if (type == FLTImagePickerMIMETypeGIF) {
-    GIFInfo *gifInfo = [FLTImagePickerImageUtil scaledGIFImage:originalImageData
-                                                      maxWidth:maxWidth
-                                                     maxHeight:maxHeight];
-
-    return [self saveImageWithMetaData:metaData gifInfo:gifInfo suffix:suffix];
+    return [self saveGIFImageData:originalImageData
+                         metaData:metaData
+                         maxWidth:maxWidth
+                        maxHeight:maxHeight
+                           suffix:suffix];
   } else {
     return [self saveImageWithMetaData:metaData
-                                 image:image
+                                 image:image ?: [UIImage imageWithData:originalImageData]
                                 suffix:suffix
                                   type:type
                           imageQuality:imageQuality];
@@ -67,19 +135,47 @@
 + (NSString *)saveImageWithPickerInfo:(nullable NSDictionary *)info
                                 image:(UIImage *)image
                          imageQuality:(NSNumber *)imageQuality {
+  return [self saveImageWithPickerInfo:info
+                                 image:image
+                          imageQuality:imageQuality
+                          outputFormat:FLTImagePickerOutputFormatJPEG];
+}
+
++ (NSString *)saveImageWithPickerInfo:(nullable NSDictionary *)info
+                                image:(UIImage *)image
+                         imageQuality:(NSNumber *)imageQuality
+                         outputFormat:(FLTImagePickerOutputFormat)outputFormat {
   NSDictionary *metaData = info[UIImagePickerControllerMediaMetadata];
+  FLTImagePickerMIMEType type =
+      [FLTImagePickerMetaDataUtil outputTypeForSourceType:kFLTImagePickerMIMETypeDefault
+                                                   format:outputFormat];
+  NSString *suffix =
+      [FLTImagePickerMetaDataUtil imageTypeSuffixFromType:type] ?: kFLTImagePickerDefaultSuffix;
   return [self saveImageWithMetaData:metaData
                                image:image
-                              suffix:kFLTImagePickerDefaultSuffix
-                                type:kFLTImagePickerMIMETypeDefault
+                              suffix:suffix
+                                type:type
                         imageQuality:imageQuality];
 }
 
-+ (NSString *)saveImageWithMetaData:(NSDictionary *)metaData
-                            gifInfo:(GIFInfo *)gifInfo
-                             suffix:(NSString *)suffix {
++ (NSString *)saveGIFImageData:(NSData *)data
+                      metaData:(NSDictionary *)metaData
+                      maxWidth:(NSNumber *)maxWidth
+                     maxHeight:(NSNumber *)maxHeight
+                        suffix:(NSString *)suffix {
+  NSMutableDictionary *gifMetaProperties = [NSMutableDictionary dictionaryWithDictionary:metaData];
+  NSMutableDictionary *gifProperties = [NSMutableDictionary
+      dictionaryWithDictionary:gifMetaProperties[(NSString *)kCGImagePropertyGIFDictionary]];
+  gifProperties[(NSString *)kCGImagePropertyGIFLoopCount] = @0;
+  gifMetaProperties[(NSString *)kCGImagePropertyGIFDictionary] = gifProperties;
+
   NSString *path = [self temporaryFilePath:suffix];
-  return [self saveImageWithMetaData:metaData gifInfo:gifInfo path:path];
+  BOOL written = [FLTImagePickerImageUtil writeScaledGIFImage:data
+                                                     maxWidth:maxWidth
+                                                    maxHeight:maxHeight
+                                                   properties:gifMetaProperties
+                                                        toURL:[NSURL fileURLWithPath:path]];
+  return written ? path : nil;
 }
 
 + (NSString *)saveImageWithMetaData:(NSDictionary *)metaData
@@ -87,9 +183,22 @@
                              suffix:(NSString *)suffix
                                type:(FLTImagePickerMIMEType)type
                        imageQuality:(NSNumber *)imageQuality {
-  NSData *data = [FLTImagePickerMetaDataUtil convertImage:image
-                                                usingType:type
-                                                  quality:imageQuality];
+  // Encoding and writing the metadata in a single pass avoids decoding the encoded image again.
+  NSData *data = [FLTImagePickerMetaDataUtil imageDataFromImage:image
+                                                      usingType:type
+                                                        quality:imageQuality
+                                                       metaData:metaData];
+  if (data) {
+    return [self createFile:data suffix:suffix];
+  }
+
+  // Images that ImageIO cannot encode directly, such as those backed by a CIImage, are converted
+  // by UIKit instead, which always produces JPEG or PNG data.
+  if (type == FLTImagePickerMIMETypeHEIC) {
+    type = kFLTImagePickerMIMETypeDefault;
+    suffix = kFLTImagePickerDefaultSuffix;
+  }
+  data = [FLTImagePickerMetaDataUtil convertImage:image usingType:type quality:imageQuality];
   if (metaData) {
     NSData *updatedData = [FLTImagePickerMetaDataUtil imageFromImage:data withMetaData:metaData];
     // If updating the metadata fails, just save the original.
@@ -101,41 +210,6 @@
   return [self createFile:data suffix:suffix];
 }
 
-+ (NSString *)saveImageWithMetaData:(NSDictionary *)metaData
-                            gifInfo:(GIFInfo *)gifInfo
-                               path:(NSString *)path {
-  CGImageDestinationRef destination = CGImageDestinationCreateWithURL(
-      (__bridge CFURLRef)[NSURL fileURLWithPath:path], kUTTypeGIF, gifInfo.images.count, NULL);
-
-  NSDictionary *frameProperties = @{
-    (__bridge NSString *)kCGImagePropertyGIFDictionary : @{
-      (__bridge NSString *)kCGImagePropertyGIFDelayTime : @(gifInfo.interval),
-    },
-  };
-
-  NSMutableDictionary *gifMetaProperties = [NSMutableDictionary dictionaryWithDictionary:metaData];
-  NSMutableDictionary *gifProperties =
-      (NSMutableDictionary *)gifMetaProperties[(NSString *)kCGImagePropertyGIFDictionary];
-  if (gifMetaProperties == nil) {
-    gifProperties = [NSMutableDictionary dictionary];
-  }
-
-  gifProperties[(__bridge NSString *)kCGImagePropertyGIFLoopCount] = @0;
-
-  CGImageDestinationSetProperties(destination, (__bridge CFDictionaryRef)gifMetaProperties);
-
-  for (NSInteger index = 0; index < gifInfo.images.count; index++) {
-    UIImage *image = (UIImage *)[gifInfo.images objectAtIndex:index];
-    CGImageDestinationAddImage(destination, image.CGImage,
-                               (__bridge CFDictionaryRef)frameProperties);
-  }
-
-  CGImageDestinationFinalize(destination);
-  CFRelease(destination);
-
-  return path;
-}
-
 + (NSString *)temporaryFilePath:(NSString *)suffix {
   NSString *fileExtension = [@"image_picker_%@" stringByAppendingString:suffix];
   NSString *guid = [[NSProcessInfo processInfo] globallyUniqueString];
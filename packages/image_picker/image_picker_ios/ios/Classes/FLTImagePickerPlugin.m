@@ -40,6 +40,19 @@
 @property(strong, nonatomic)
     NSMutableArray<UIImagePickerController *> *imagePickerControllerOverrides;
 
+/**
+ * The queue that images picked with UIImagePickerController are scaled, encoded and written on.
+ */
+@property(strong, nonatomic) NSOperationQueue *saveQueue;
+
+/**
+ * The call context whose picked media is being saved, if any.
+ *
+ * UIImagePickerController can report the same pick more than once while it is dismissed, so
+ * reports for this context are ignored.
+ */
+@property(weak, nonatomic) FLTImagePickerMethodCallContext *savingCallContext;
+
 @end
 
 typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPickerClassType };
@@ -48,6 +61,8 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
 
 + (void)registerWithRegistrar:(NSObject<FlutterPluginRegistrar> *)registrar {
   FLTImagePickerPlugin *instance = [[FLTImagePickerPlugin alloc] init];
+  instance.flutterApi =
+      [[FLTImagePickerFlutterApi alloc] initWithBinaryMessenger:registrar.messenger];
   SetUpFLTImagePickerApi(registrar.messenger, instance);
 }
 
@@ -61,6 +76,17 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
   return [[UIImagePickerController alloc] init];
 }
 
+- (NSOperationQueue *)saveQueue {
+  if (!_saveQueue) {
+    _saveQueue = [[NSOperationQueue alloc] init];
+    _saveQueue.name = @"Flutter Save Image Queue";
+    _saveQueue.qualityOfService = NSQualityOfServiceUserInitiated;
+    // Only one picked image is held in memory at a time.
+    _saveQueue.maxConcurrentOperationCount = 1;
+  }
+  return _saveQueue;
+}
+
 - (void)setImagePickerControllerOverrides:
     (NSArray<UIImagePickerController *> *)imagePickerControllers {
   _imagePickerControllerOverrides = [imagePickerControllers mutableCopy];
@@ -237,6 +263,58 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
   }
 }
 
+- (void)setReportsSavedItems:(BOOL)reportsSavedItems
+                       error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  _reportsSavedItems = reportsSavedItems;
+}
+
+- (void)setImageOutputFormat:(FLTOutputFormat)format
+                       error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  switch (format) {
+    case FLTOutputFormatSource:
+      _imageOutputFormat = FLTImagePickerOutputFormatSource;
+      break;
+    case FLTOutputFormatHeic:
+      _imageOutputFormat = FLTImagePickerOutputFormatHEIC;
+      break;
+    default:
+      _imageOutputFormat = FLTImagePickerOutputFormatJPEG;
+      break;
+  }
+}
+
+- (void)setVideoExportPreset:(FLTExportPreset)preset
+                       error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  switch (preset) {
+    case FLTExportPresetH264Max640x480:
+      _videoExportPreset = AVAssetExportPreset640x480;
+      break;
+    case FLTExportPresetH264Max960x540:
+      _videoExportPreset = AVAssetExportPreset960x540;
+      break;
+    case FLTExportPresetH264Max1280x720:
+      _videoExportPreset = AVAssetExportPreset1280x720;
+      break;
+    case FLTExportPresetH264Max1920x1080:
+      _videoExportPreset = AVAssetExportPreset1920x1080;
+      break;
+    case FLTExportPresetHevcMax1920x1080:
+      _videoExportPreset = AVAssetExportPresetHEVC1920x1080;
+      break;
+    case FLTExportPresetHevcMax3840x2160:
+      _videoExportPreset = AVAssetExportPresetHEVC3840x2160;
+      break;
+    default:
+      _videoExportPreset = nil;
+      break;
+  }
+}
+
+- (void)setThumbnailSize:(nullable NSNumber *)size
+                   error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  _thumbnailSize = size;
+}
+
 - (void)pickVideoWithSource:(nonnull FLTSourceSpecification *)source
                 maxDuration:(nullable NSNumber *)maxDurationSeconds
                  completion:
@@ -501,16 +579,32 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
     [self sendCallResultWithSavedPathList:nil];
     return;
   }
-  __block NSOperationQueue *saveQueue = [[NSOperationQueue alloc] init];
-  saveQueue.name = @"Flutter Save Image Queue";
-  saveQueue.qualityOfService = NSQualityOfServiceUserInitiated;
-
   FLTImagePickerMethodCallContext *currentCallContext = self.callContext;
   NSNumber *maxWidth = currentCallContext.maxSize.width;
   NSNumber *maxHeight = currentCallContext.maxSize.height;
+
+  __block NSOperationQueue *saveQueue = [[NSOperationQueue alloc] init];
+  saveQueue.name = @"Flutter Save Image Queue";
+  saveQueue.qualityOfService = NSQualityOfServiceUserInitiated;
+  // Operations with the same priority start in the order they are added, so results are saved in
+  // the order they were picked.
+  NSProcessInfo *processInfo = NSProcessInfo.processInfo;
+  BOOL isScaled = maxWidth != nil || maxHeight != nil || self.thumbnailSize != nil;
+  saveQueue.maxConcurrentOperationCount = [FLTImagePickerPlugin
+      maxConcurrentSaveOperationCountWithProcessorCount:processInfo.activeProcessorCount
+                                         physicalMemory:processInfo.physicalMemory
+                                               isScaled:isScaled];
   NSNumber *imageQuality = currentCallContext.imageQuality;
   NSNumber *desiredImageQuality = [self getDesiredImageQuality:imageQuality];
   BOOL requestFullMetadata = currentCallContext.requestFullMetadata;
+  BOOL reportsSavedItems = self.reportsSavedItems;
+  FLTImagePickerOutputFormat imageOutputFormat = self.imageOutputFormat;
+  NSString *videoExportPreset = self.videoExportPreset;
+  NSNumber *thumbnailSize = self.thumbnailSize;
+  PHImageManager *thumbnailManager;
+  if (thumbnailSize) {
+    thumbnailManager = [self cachingImageManagerForResults:results thumbnailSize:thumbnailSize];
+  }
   NSMutableArray *pathList = [[NSMutableArray alloc] initWithCapacity:results.count];
   __block FlutterError *saveError = nil;
   __weak typeof(self) weakSelf = self;
@@ -539,10 +633,25 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
                  savedPathBlock:^(NSString *savedPath, FlutterError *error) {
                    if (savedPath != nil) {
                      pathList[index] = savedPath;
+                     if (reportsSavedItems) {
+                       // Sent before sendListOperation, which is also run on the main queue.
+                       dispatch_async(dispatch_get_main_queue(), ^{
+                         [weakSelf.flutterApi itemSavedAtIndex:index
+                                                          path:savedPath
+                                                    completion:^(FlutterError *error){
+                                                    }];
+                       });
+                     }
                    } else {
                      saveError = error;
                    }
                  }];
+    saveOperation.outputFormat = imageOutputFormat;
+    saveOperation.videoExportPreset = videoExportPreset;
+    saveOperation.thumbnailSize = thumbnailSize;
+    if (thumbnailManager) {
+      saveOperation.imageManager = thumbnailManager;
+    }
     [sendListOperation addDependency:saveOperation];
     [saveQueue addOperation:saveOperation];
   }];
@@ -552,6 +661,56 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
   [NSOperationQueue.mainQueue addOperation:sendListOperation];
 }
 
+/**
+ * Returns an image manager that has started preparing the thumbnails of the assets of results, or
+ * nil if the assets cannot be read.
+ */
+- (nullable PHImageManager *)cachingImageManagerForResults:(NSArray<PHPickerResult *> *)results
+                                             thumbnailSize:(NSNumber *)thumbnailSize
+    API_AVAILABLE(ios(14)) {
+  if (![FLTImagePickerPhotoAssetUtil canReadPhotoLibrary]) {
+    return nil;
+  }
+  NSMutableArray<NSString *> *identifiers = [NSMutableArray arrayWithCapacity:results.count];
+  for (PHPickerResult *result in results) {
+    if (result.assetIdentifier) {
+      [identifiers addObject:result.assetIdentifier];
+    }
+  }
+  PHFetchResult<PHAsset *> *fetchResult = [PHAsset fetchAssetsWithLocalIdentifiers:identifiers
+                                                                           options:nil];
+  NSMutableArray<PHAsset *> *assets = [NSMutableArray arrayWithCapacity:fetchResult.count];
+  [fetchResult enumerateObjectsUsingBlock:^(PHAsset *asset, NSUInteger index, BOOL *stop) {
+    [assets addObject:asset];
+  }];
+
+  PHCachingImageManager *imageManager = [[PHCachingImageManager alloc] init];
+  PHImageRequestOptions *options = [[PHImageRequestOptions alloc] init];
+  options.deliveryMode = PHImageRequestOptionsDeliveryModeOpportunistic;
+  options.resizeMode = PHImageRequestOptionsResizeModeFast;
+  CGFloat size = thumbnailSize.doubleValue;
+  [imageManager startCachingImagesForAssets:assets
+                                 targetSize:CGSizeMake(size, size)
+                                contentMode:PHImageContentModeAspectFit
+                                    options:options];
+  return imageManager;
+}
+
++ (NSInteger)maxConcurrentSaveOperationCountWithProcessorCount:(NSUInteger)processorCount
+                                               physicalMemory:(unsigned long long)physicalMemory
+                                                     isScaled:(BOOL)isScaled {
+  // Estimates of the memory held by one save: the data of a large photo plus its decoded bitmap,
+  // which is small when the image is decoded at a scaled size.
+  static const unsigned long long kFullSizeSaveBytes = 256 * 1024 * 1024;
+  static const unsigned long long kScaledSaveBytes = 64 * 1024 * 1024;
+  // Saves are limited to this share of the physical memory.
+  static const unsigned long long kMemoryBudgetDivisor = 8;
+
+  unsigned long long saveBytes = isScaled ? kScaledSaveBytes : kFullSizeSaveBytes;
+  unsigned long long memoryLimit = physicalMemory / kMemoryBudgetDivisor / saveBytes;
+  return MAX(1, (NSInteger)MIN((unsigned long long)processorCount, memoryLimit));
+}
+
 #pragma mark - UIImagePickerControllerDelegate
 
 - (void)imagePickerController:(UIImagePickerController *)picker
@@ -562,10 +721,29 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
   // further didFinishPickingMediaWithInfo invocations. A nil check is necessary
   // to prevent below code to be unwantly executed multiple times and cause a
   // crash.
-  if (!self.callContext) {
+  if (!self.callContext || self.savingCallContext == self.callContext) {
     return;
   }
-  if (videoURL != nil) {
+  self.savingCallContext = self.callContext;
+  if (videoURL != nil && self.videoExportPreset != nil) {
+    __weak typeof(self) weakSelf = self;
+    [FLTImagePickerPhotoAssetUtil
+        exportVideoFromURL:videoURL
+                presetName:self.videoExportPreset
+                completion:^(NSURL *_Nullable destination) {
+                  dispatch_async(dispatch_get_main_queue(), ^{
+                    if (destination == nil) {
+                      [weakSelf sendCallResultWithError:
+                                    [FlutterError
+                                        errorWithCode:@"flutter_image_picker_copy_video_error"
+                                              message:@"Could not cache the video file."
+                                              details:nil]];
+                    } else {
+                      [weakSelf sendCallResultWithSavedPathList:@[ destination.path ]];
+                    }
+                  });
+                }];
+  } else if (videoURL != nil) {
     if (@available(iOS 13.0, *)) {
       NSURL *destination = [FLTImagePickerPhotoAssetUtil saveVideoFromURL:videoURL];
       if (destination == nil) {
@@ -595,20 +773,16 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
       originalAsset = [FLTImagePickerPhotoAssetUtil getAssetFromImagePickerInfo:info];
     }
 
-    if (maxWidth != nil || maxHeight != nil) {
-      image = [FLTImagePickerImageUtil scaledImage:image
-                                          maxWidth:maxWidth
-                                         maxHeight:maxHeight
-                               isMetadataAvailable:YES];
-    }
-
     if (!originalAsset) {
       // Image picked without an original asset (e.g. User took a photo directly)
-      [self saveImageWithPickerInfo:info image:image imageQuality:desiredImageQuality];
+      [self saveImageWithPickerInfo:info
+                              image:image
+                           maxWidth:maxWidth
+                          maxHeight:maxHeight
+                       imageQuality:desiredImageQuality];
     } else {
       void (^resultHandler)(NSData *imageData, NSString *dataUTI, NSDictionary *info) = ^(
           NSData *_Nullable imageData, NSString *_Nullable dataUTI, NSDictionary *_Nullable info) {
-        // maxWidth and maxHeight are used only for GIF images.
         [self saveImageWithOriginalImageData:imageData
                                        image:image
                                     maxWidth:maxWidth
@@ -654,22 +828,60 @@ typedef NS_ENUM(NSInteger, ImagePickerClassType) { UIImagePickerClassType, PHPic
                               maxWidth:(NSNumber *)maxWidth
                              maxHeight:(NSNumber *)maxHeight
                           imageQuality:(NSNumber *)imageQuality {
-  NSString *savedPath =
-      [FLTImagePickerPhotoAssetUtil saveImageWithOriginalImageData:originalImageData
-                                                             image:image
-                                                          maxWidth:maxWidth
-                                                         maxHeight:maxHeight
-                                                      imageQuality:imageQuality];
-  [self sendCallResultWithSavedPathList:@[ savedPath ]];
+  FLTImagePickerOutputFormat outputFormat = self.imageOutputFormat;
+  [self saveImageInBackground:^NSString * {
+    UIImage *scaledImage = image;
+    if (maxWidth != nil || maxHeight != nil) {
+      scaledImage = [FLTImagePickerImageUtil scaledImage:image
+                                                maxWidth:maxWidth
+                                               maxHeight:maxHeight
+                                     isMetadataAvailable:YES];
+    }
+    // maxWidth and maxHeight scale GIF images, and mark other images as already scaled.
+    return [FLTImagePickerPhotoAssetUtil saveImageWithOriginalImageData:originalImageData
+                                                                  image:scaledImage
+                                                               maxWidth:maxWidth
+                                                              maxHeight:maxHeight
+                                                           imageQuality:imageQuality
+                                                           outputFormat:outputFormat];
+  }];
 }
 
 - (void)saveImageWithPickerInfo:(NSDictionary *)info
                           image:(UIImage *)image
+                       maxWidth:(NSNumber *)maxWidth
+                      maxHeight:(NSNumber *)maxHeight
                    imageQuality:(NSNumber *)imageQuality {
-  NSString *savedPath = [FLTImagePickerPhotoAssetUtil saveImageWithPickerInfo:info
-                                                                        image:image
-                                                                 imageQuality:imageQuality];
-  [self sendCallResultWithSavedPathList:@[ savedPath ]];
+  FLTImagePickerOutputFormat outputFormat = self.imageOutputFormat;
+  [self saveImageInBackground:^NSString * {
+    UIImage *scaledImage = image;
+    if (maxWidth != nil || maxHeight != nil) {
+      scaledImage = [FLTImagePickerImageUtil scaledImage:image
+                                                maxWidth:maxWidth
+                                               maxHeight:maxHeight
+                                     isMetadataAvailable:YES];
+    }
+    return [FLTImagePickerPhotoAssetUtil saveImageWithPickerInfo:info
+                                                           image:scaledImage
+                                                    imageQuality:imageQuality
+                                                    outputFormat:outputFormat];
+  }];
+}
+
+/**
+ * Runs |saveBlock| on the save queue, so that the picked image is scaled, encoded and written
+ * while the picker is dismissed, then sends the path it returns on the main queue.
+ *
+ * @param saveBlock Saves the picked image and returns its path, or nil if it could not be saved.
+ */
+- (void)saveImageInBackground:(NSString *_Nullable (^)(void))saveBlock {
+  __weak typeof(self) weakSelf = self;
+  [self.saveQueue addOperationWithBlock:^{
+    NSString *savedPath = saveBlock();
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [weakSelf sendCallResultWithSavedPathList:@[ savedPath ?: [NSNull null] ]];
+    });
+  }];
 }
 
 - (void)sendCallResultWithSavedPathList:(nullable NSArray *)pathList {
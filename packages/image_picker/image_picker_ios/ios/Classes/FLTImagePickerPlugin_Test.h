@@ -6,6 +6,7 @@
 
 #import <image_picker_ios/FLTImagePickerPlugin.h>
 
+#import "FLTImagePickerMetaDataUtil.h"
 #import "messages.g.h"
 
 NS_ASSUME_NONNULL_BEGIN
@@ -68,6 +69,33 @@ typedef void (^FlutterResultAdapter)(NSArray<NSString *> *_Nullable, FlutterErro
  */
 @property(strong, nonatomic, nullable) FLTImagePickerMethodCallContext *callContext;
 
+/**
+ * The API used to send the items of a pick that is still in progress to Dart.
+ */
+@property(strong, nonatomic, nullable) FLTImagePickerFlutterApi *flutterApi;
+
+/**
+ * Whether each picked item is sent through `flutterApi` as soon as it has been saved.
+ */
+@property(assign, nonatomic) BOOL reportsSavedItems;
+
+/**
+ * The format that picked images are saved in when they have to be re-encoded.
+ */
+@property(assign, nonatomic) FLTImagePickerOutputFormat imageOutputFormat;
+
+/**
+ * The AVAssetExportSession preset that picked videos are transcoded with, or nil to save the
+ * original videos.
+ */
+@property(copy, nonatomic, nullable) NSString *videoExportPreset;
+
+/**
+ * The size of the thumbnails that images picked with PHPicker are saved as, or nil to save the
+ * images themselves.
+ */
+@property(strong, nonatomic, nullable) NSNumber *thumbnailSize;
+
 - (UIViewController *)viewControllerWithWindow:(nullable UIWindow *)window;
 
 /**
@@ -91,6 +119,20 @@ typedef void (^FlutterResultAdapter)(NSArray<NSString *> *_Nullable, FlutterErro
  */
 - (void)imagePickerControllerDidCancel:(UIImagePickerController *)picker;
 
+/**
+ * Returns the number of picked results that are loaded and saved at the same time.
+ *
+ * Each save holds the data of the picked file and the image decoded from it until it finishes, so
+ * the count is limited by both the number of active processors and a share of the physical memory.
+ *
+ * @param processorCount The number of active processors.
+ * @param physicalMemory The amount of physical memory in bytes.
+ * @param isScaled Whether images are decoded at a scaled size, which uses less memory per save.
+ */
++ (NSInteger)maxConcurrentSaveOperationCountWithProcessorCount:(NSUInteger)processorCount
+                                               physicalMemory:(unsigned long long)physicalMemory
+                                                     isScaled:(BOOL)isScaled;
+
 /**
  * Sets UIImagePickerController instances that will be used when a new
  * controller would normally be created. Each call to
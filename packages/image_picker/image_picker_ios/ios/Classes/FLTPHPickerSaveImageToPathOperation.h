@@ -34,6 +34,25 @@ typedef void (^FLTGetSavedPath)(NSString *_Nullable savedPath, FlutterError *_Nu
                   fullMetadata:(BOOL)fullMetadata
                 savedPathBlock:(FLTGetSavedPath)savedPathBlock API_AVAILABLE(ios(14));
 
+/// The format that the image is saved in when it has to be re-encoded.
+///
+/// Defaults to FLTImagePickerOutputFormatJPEG.
+@property(assign, nonatomic) FLTImagePickerOutputFormat outputFormat;
+
+/// The AVAssetExportSession preset that a picked video is transcoded with, or nil to save the
+/// original video.
+@property(copy, nonatomic, nullable) NSString *videoExportPreset;
+
+/// The size in pixels of the square that a picked image is scaled to fit in and saved as a
+/// thumbnail, or nil to save the image itself.
+///
+/// Thumbnails are requested from the image manager when the PHAsset of the image can be read, and
+/// decoded from the image data with ImageIO otherwise.
+@property(strong, nonatomic, nullable) NSNumber *thumbnailSize;
+
+/// The image manager that thumbnails are requested from. Defaults to the default manager.
+@property(strong, nonatomic) PHImageManager *imageManager;
+
 @end
 
 NS_ASSUME_NONNULL_END
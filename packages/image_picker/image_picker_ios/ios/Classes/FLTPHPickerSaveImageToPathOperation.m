@@ -40,6 +40,7 @@ API_AVAILABLE(ios(14))
       self.desiredImageQuality = desiredImageQuality;
       self.requestFullMetadata = fullMetadata;
       getSavedPath = savedPathBlock;
+      _imageManager = [PHImageManager defaultManager];
       executing = NO;
       finished = NO;
     } else {
@@ -93,20 +94,16 @@ API_AVAILABLE(ios(14))
     // This includes UTTypeHEIC, UTTypeHEIF, UTTypeLivePhoto, UTTypeICO, UTTypeICNS, UTTypePNG
     // UTTypeGIF, UTTypeJPEG, UTTypeWebP, UTTypeTIFF, UTTypeBMP, UTTypeSVG, UTTypeRAWImage
     if ([self.result.itemProvider hasItemConformingToTypeIdentifier:UTTypeImage.identifier]) {
-      [self.result.itemProvider
-          loadDataRepresentationForTypeIdentifier:UTTypeImage.identifier
-                                completionHandler:^(NSData *_Nullable data,
-                                                    NSError *_Nullable error) {
-                                  if (data != nil) {
-                                    [self processImage:data];
-                                  } else {
-                                    FlutterError *flutterError =
-                                        [FlutterError errorWithCode:@"invalid_image"
-                                                            message:error.localizedDescription
-                                                            details:error.domain];
-                                    [self completeOperationWithPath:nil error:flutterError];
-                                  }
-                                }];
+      if (self.thumbnailSize != nil) {
+        [self saveThumbnail];
+      } else {
+        FLTImagePickerMIMEType passthroughType = [self passthroughImageType];
+        if (passthroughType != FLTImagePickerMIMETypeOther) {
+          [self copyImageFileWithType:passthroughType];
+        } else {
+          [self loadImageData];
+        }
+      }
     } else if ([self.result.itemProvider
                    // This supports uniform types that conform to UTTypeMovie.
                    // This includes kUTTypeVideo, kUTTypeMPEG4, public.3gpp, kUTTypeMPEG,
@@ -124,11 +121,149 @@ API_AVAILABLE(ios(14))
   }
 }
 
+/**
+ * Returns the type of the picked image if it can be saved by copying its file as is, or
+ * FLTImagePickerMIMETypeOther if it has to be decoded.
+ *
+ * Files are copied only when the image is neither scaled nor compressed, and only when decoded
+ * images of its type are saved in that same type, so that the type of the saved file does not
+ * change.
+ */
+- (FLTImagePickerMIMEType)passthroughImageType API_AVAILABLE(ios(14)) {
+  if (self.maxWidth != nil || self.maxHeight != nil) {
+    return FLTImagePickerMIMETypeOther;
+  }
+  if (self.desiredImageQuality != nil && self.desiredImageQuality.doubleValue < 1) {
+    return FLTImagePickerMIMETypeOther;
+  }
+  NSItemProvider *itemProvider = self.result.itemProvider;
+  FLTImagePickerMIMEType sourceType = FLTImagePickerMIMETypeOther;
+  if ([itemProvider hasItemConformingToTypeIdentifier:UTTypeJPEG.identifier]) {
+    sourceType = FLTImagePickerMIMETypeJPEG;
+  } else if ([itemProvider hasItemConformingToTypeIdentifier:UTTypePNG.identifier]) {
+    sourceType = FLTImagePickerMIMETypePNG;
+  } else if ([itemProvider hasItemConformingToTypeIdentifier:UTTypeGIF.identifier]) {
+    sourceType = FLTImagePickerMIMETypeGIF;
+  } else if ([itemProvider hasItemConformingToTypeIdentifier:UTTypeHEIC.identifier]) {
+    sourceType = FLTImagePickerMIMETypeHEIC;
+  }
+  FLTImagePickerMIMEType outputType =
+      [FLTImagePickerMetaDataUtil outputTypeForSourceType:sourceType format:self.outputFormat];
+  return outputType == sourceType ? sourceType : FLTImagePickerMIMETypeOther;
+}
+
+/**
+ * Saves a thumbnail of the image, without loading the full image if its asset can be read.
+ */
+- (void)saveThumbnail API_AVAILABLE(ios(14)) {
+  PHAsset *asset;
+  if ([FLTImagePickerPhotoAssetUtil canReadPhotoLibrary]) {
+    asset = [FLTImagePickerPhotoAssetUtil getAssetFromPHPickerResult:self.result];
+  }
+  if (asset == nil) {
+    [self loadThumbnailData];
+    return;
+  }
+
+  PHImageRequestOptions *options = [[PHImageRequestOptions alloc] init];
+  options.deliveryMode = PHImageRequestOptionsDeliveryModeOpportunistic;
+  options.resizeMode = PHImageRequestOptionsResizeModeFast;
+  CGFloat size = self.thumbnailSize.doubleValue;
+  [self.imageManager
+      requestImageForAsset:asset
+                targetSize:CGSizeMake(size, size)
+               contentMode:PHImageContentModeAspectFit
+                   options:options
+             resultHandler:^(UIImage *_Nullable image, NSDictionary *_Nullable info) {
+               // Opportunistic delivery may first return a lower quality image, which is skipped.
+               if ([info[PHImageResultIsDegradedKey] boolValue]) {
+                 return;
+               }
+               if (image == nil) {
+                 [self loadThumbnailData];
+                 return;
+               }
+               NSString *savedPath =
+                   [FLTImagePickerPhotoAssetUtil saveImageWithPickerInfo:nil
+                                                                   image:image
+                                                            imageQuality:self.desiredImageQuality
+                                                            outputFormat:self.outputFormat];
+               [self completeOperationWithPath:savedPath error:nil];
+             }];
+}
+
+/**
+ * Saves a thumbnail of the image decoded from its data with ImageIO, which does not decode the
+ * full image.
+ */
+- (void)loadThumbnailData API_AVAILABLE(ios(14)) {
+  self.maxWidth = self.thumbnailSize;
+  self.maxHeight = self.thumbnailSize;
+  // The full metadata of the asset is not needed for a thumbnail.
+  self.requestFullMetadata = NO;
+  [self loadImageData];
+}
+
+/**
+ * Saves the image by copying the file of the item provider, without loading it into memory.
+ *
+ * Falls back to loading the data of the image if the file cannot be copied.
+ */
+- (void)copyImageFileWithType:(FLTImagePickerMIMEType)type API_AVAILABLE(ios(14)) {
+  UTType *typeIdentifier = type == FLTImagePickerMIMETypeJPEG  ? UTTypeJPEG
+                           : type == FLTImagePickerMIMETypePNG ? UTTypePNG
+                           : type == FLTImagePickerMIMETypeGIF ? UTTypeGIF
+                                                               : UTTypeHEIC;
+  NSString *suffix = [FLTImagePickerMetaDataUtil imageTypeSuffixFromType:type];
+  [self.result.itemProvider
+      loadFileRepresentationForTypeIdentifier:typeIdentifier.identifier
+                            completionHandler:^(NSURL *_Nullable imageURL,
+                                                NSError *_Nullable error) {
+                              // The file is deleted once this handler returns, so it is copied
+                              // before returning.
+                              NSString *savedPath =
+                                  imageURL ? [FLTImagePickerPhotoAssetUtil saveImageFromURL:imageURL
+                                                                                     suffix:suffix]
+                                           : nil;
+                              if (savedPath) {
+                                [self completeOperationWithPath:savedPath error:nil];
+                              } else {
+                                [self loadImageData];
+                              }
+                            }];
+}
+
+/**
+ * Loads the data of the image and processes it.
+ */
+- (void)loadImageData API_AVAILABLE(ios(14)) {
+  [self.result.itemProvider
+      loadDataRepresentationForTypeIdentifier:UTTypeImage.identifier
+                            completionHandler:^(NSData *_Nullable data, NSError *_Nullable error) {
+                              if (data != nil) {
+                                [self processImage:data];
+                              } else {
+                                FlutterError *flutterError =
+                                    [FlutterError errorWithCode:@"invalid_image"
+                                                        message:error.localizedDescription
+                                                        details:error.domain];
+                                [self completeOperationWithPath:nil error:flutterError];
+                              }
+                            }];
+}
+
 /**
  * Processes the image.
  */
 - (void)processImage:(NSData *)pickerImageData API_AVAILABLE(ios(14)) {
-  UIImage *localImage = [[UIImage alloc] initWithData:pickerImageData];
+  // Unscaled images are only decoded when saving them, if they cannot be saved as is.
+  UIImage *localImage;
+  if (self.maxWidth != nil || self.maxHeight != nil) {
+    // Decoding the image at its scaled size keeps full-size bitmaps of large photos out of memory.
+    localImage = [FLTImagePickerImageUtil scaledImageFromData:pickerImageData
+                                                     maxWidth:self.maxWidth
+                                                    maxHeight:self.maxHeight];
+  }
 
   PHAsset *originalAsset;
   // Only if requested, fetch the full "PHAsset" metadata, which requires  "Photo Library Usage"
@@ -137,22 +272,17 @@ API_AVAILABLE(ios(14))
     originalAsset = [FLTImagePickerPhotoAssetUtil getAssetFromPHPickerResult:self.result];
   }
 
-  if (self.maxWidth != nil || self.maxHeight != nil) {
-    localImage = [FLTImagePickerImageUtil scaledImage:localImage
-                                             maxWidth:self.maxWidth
-                                            maxHeight:self.maxHeight
-                                  isMetadataAvailable:YES];
-  }
   if (originalAsset) {
     void (^resultHandler)(NSData *imageData, NSString *dataUTI, NSDictionary *info) =
         ^(NSData *_Nullable imageData, NSString *_Nullable dataUTI, NSDictionary *_Nullable info) {
-          // maxWidth and maxHeight are used only for GIF images.
+          // maxWidth and maxHeight scale GIF images, and mark other images as already scaled.
           NSString *savedPath = [FLTImagePickerPhotoAssetUtil
-              saveImageWithOriginalImageData:imageData
+              saveImageWithOriginalImageData:imageData ?: pickerImageData
                                        image:localImage
                                     maxWidth:self.maxWidth
                                    maxHeight:self.maxHeight
-                                imageQuality:self.desiredImageQuality];
+                                imageQuality:self.desiredImageQuality
+                                outputFormat:self.outputFormat];
           [self completeOperationWithPath:savedPath error:nil];
         };
     if (@available(iOS 13.0, *)) {
@@ -179,13 +309,14 @@ API_AVAILABLE(ios(14))
     }
   } else {
     // Image picked without an original asset (e.g. User pick image without permission)
-    // maxWidth and maxHeight are used only for GIF images.
+    // maxWidth and maxHeight scale GIF images, and mark other images as already scaled.
     NSString *savedPath =
         [FLTImagePickerPhotoAssetUtil saveImageWithOriginalImageData:pickerImageData
                                                                image:localImage
                                                             maxWidth:self.maxWidth
                                                            maxHeight:self.maxHeight
-                                                        imageQuality:self.desiredImageQuality];
+                                                        imageQuality:self.desiredImageQuality
+                                                        outputFormat:self.outputFormat];
     [self completeOperationWithPath:savedPath error:nil];
   }
 }
@@ -208,8 +339,9 @@ API_AVAILABLE(ios(14))
                                 return;
                               }
 
-                              NSURL *destination =
-                                  [FLTImagePickerPhotoAssetUtil saveVideoFromURL:videoURL];
+                              // The file is deleted once this handler returns, so it is
+                              // saved before returning.
+                              NSURL *destination = [self saveVideoFromURL:videoURL];
                               if (destination == nil) {
                                 [self
                                     completeOperationWithPath:nil
@@ -227,4 +359,25 @@ API_AVAILABLE(ios(14))
                             }];
 }
 
+/**
+ * Saves the video at videoURL, transcoding it with videoExportPreset if one is set.
+ *
+ * Blocks until the video has been saved. Returns nil on failure.
+ */
+- (nullable NSURL *)saveVideoFromURL:(NSURL *)videoURL API_AVAILABLE(ios(14)) {
+  if (self.videoExportPreset == nil) {
+    return [FLTImagePickerPhotoAssetUtil saveVideoFromURL:videoURL];
+  }
+  __block NSURL *destination;
+  dispatch_semaphore_t exported = dispatch_semaphore_create(0);
+  [FLTImagePickerPhotoAssetUtil exportVideoFromURL:videoURL
+                                        presetName:self.videoExportPreset
+                                        completion:^(NSURL *_Nullable exportedURL) {
+                                          destination = exportedURL;
+                                          dispatch_semaphore_signal(exported);
+                                        }];
+  dispatch_semaphore_wait(exported, DISPATCH_TIME_FOREVER);
+  return destination;
+}
+
 @end
@@ -35,6 +35,34 @@ typedef NS_ENUM(NSUInteger, FLTSourceType) {
 - (instancetype)initWithValue:(FLTSourceType)value;
 @end
 
+typedef NS_ENUM(NSUInteger, FLTOutputFormat) {
+  FLTOutputFormatJpeg = 0,
+  FLTOutputFormatSource = 1,
+  FLTOutputFormatHeic = 2,
+};
+
+/// Wrapper for FLTOutputFormat to allow for nullability.
+@interface FLTOutputFormatBox : NSObject
+@property(nonatomic, assign) FLTOutputFormat value;
+- (instancetype)initWithValue:(FLTOutputFormat)value;
+@end
+
+typedef NS_ENUM(NSUInteger, FLTExportPreset) {
+  FLTExportPresetOriginal = 0,
+  FLTExportPresetH264Max640x480 = 1,
+  FLTExportPresetH264Max960x540 = 2,
+  FLTExportPresetH264Max1280x720 = 3,
+  FLTExportPresetH264Max1920x1080 = 4,
+  FLTExportPresetHevcMax1920x1080 = 5,
+  FLTExportPresetHevcMax3840x2160 = 6,
+};
+
+/// Wrapper for FLTExportPreset to allow for nullability.
+@interface FLTExportPresetBox : NSObject
+@property(nonatomic, assign) FLTExportPreset value;
+- (instancetype)initWithValue:(FLTExportPreset)value;
+@end
+
 @class FLTMaxSize;
 @class FLTMediaSelectionOptions;
 @class FLTSourceSpecification;
@@ -87,9 +115,33 @@ NSObject<FlutterMessageCodec> *FLTImagePickerApiGetCodec(void);
 - (void)pickMediaWithMediaSelectionOptions:(FLTMediaSelectionOptions *)mediaSelectionOptions
                                 completion:(void (^)(NSArray<NSString *> *_Nullable,
                                                      FlutterError *_Nullable))completion;
+/// Sets whether picked items are sent to [ImagePickerFlutterApi.itemSaved]
+/// as soon as they are saved.
+- (void)setReportsSavedItems:(BOOL)reportsSavedItems
+                       error:(FlutterError *_Nullable *_Nonnull)error;
+/// Sets the format that picked images are saved in when they are
+/// re-encoded.
+- (void)setImageOutputFormat:(FLTOutputFormat)format error:(FlutterError *_Nullable *_Nonnull)error;
+/// Sets the preset that picked videos are transcoded with.
+- (void)setVideoExportPreset:(FLTExportPreset)preset error:(FlutterError *_Nullable *_Nonnull)error;
+/// Sets the size of the thumbnails that picked images are saved as, or
+/// null to save the images themselves.
+- (void)setThumbnailSize:(nullable NSNumber *)size error:(FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void SetUpFLTImagePickerApi(id<FlutterBinaryMessenger> binaryMessenger,
                                    NSObject<FLTImagePickerApi> *_Nullable api);
 
+/// The codec used by FLTImagePickerFlutterApi.
+NSObject<FlutterMessageCodec> *FLTImagePickerFlutterApiGetCodec(void);
+
+/// Receives the items of a pick that is still in progress.
+@interface FLTImagePickerFlutterApi : NSObject
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger;
+/// Called when the picked item at [index] has been saved to [path].
+- (void)itemSavedAtIndex:(NSInteger)index
+                    path:(NSString *)path
+              completion:(void (^)(FlutterError *_Nullable))completion;
+@end
+
 NS_ASSUME_NONNULL_END
@@ -36,6 +36,26 @@
 }
 @end
 
+@implementation FLTOutputFormatBox
+- (instancetype)initWithValue:(FLTOutputFormat)value {
+  self = [super init];
+  if (self) {
+    _value = value;
+  }
+  return self;
+}
+@end
+
+@implementation FLTExportPresetBox
+- (instancetype)initWithValue:(FLTExportPreset)value {
+  self = [super init];
+  if (self) {
+    _value = value;
+  }
+  return self;
+}
+@end
+
 static NSArray *wrapResult(id result, FlutterError *error) {
   if (error) {
     return @[
@@ -313,4 +333,140 @@ void SetUpFLTImagePickerApi(id<FlutterBinaryMessenger> binaryMessenger,
       [channel setMessageHandler:nil];
     }
   }
+  /// Sets whether picked items are sent to [ImagePickerFlutterApi.itemSaved]
+  /// as soon as they are saved.
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setReportsSavedItems"
+        binaryMessenger:binaryMessenger
+                  codec:FLTImagePickerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setReportsSavedItems:error:)],
+                @"FLTImagePickerApi api (%@) doesn't respond to "
+                @"@selector(setReportsSavedItems:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        BOOL arg_reportsSavedItems = [GetNullableObjectAtIndex(args, 0) boolValue];
+        FlutterError *error;
+        [api setReportsSavedItems:arg_reportsSavedItems error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  /// Sets the format that picked images are saved in when they are
+  /// re-encoded.
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setImageOutputFormat"
+        binaryMessenger:binaryMessenger
+                  codec:FLTImagePickerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setImageOutputFormat:error:)],
+                @"FLTImagePickerApi api (%@) doesn't respond to "
+                @"@selector(setImageOutputFormat:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FLTOutputFormat arg_format = [GetNullableObjectAtIndex(args, 0) integerValue];
+        FlutterError *error;
+        [api setImageOutputFormat:arg_format error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  /// Sets the preset that picked videos are transcoded with.
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setVideoExportPreset"
+        binaryMessenger:binaryMessenger
+                  codec:FLTImagePickerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setVideoExportPreset:error:)],
+                @"FLTImagePickerApi api (%@) doesn't respond to "
+                @"@selector(setVideoExportPreset:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FLTExportPreset arg_preset = [GetNullableObjectAtIndex(args, 0) integerValue];
+        FlutterError *error;
+        [api setVideoExportPreset:arg_preset error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  /// Sets the size of the thumbnails that picked images are saved as, or
+  /// null to save the images themselves.
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setThumbnailSize"
+        binaryMessenger:binaryMessenger
+                  codec:FLTImagePickerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setThumbnailSize:error:)],
+                @"FLTImagePickerApi api (%@) doesn't respond to "
+                @"@selector(setThumbnailSize:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSNumber *arg_size = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setThumbnailSize:arg_size error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
+NSObject<FlutterMessageCodec> *FLTImagePickerFlutterApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  return sSharedObject;
+}
+
+@interface FLTImagePickerFlutterApi ()
+@property(nonatomic, strong) NSObject<FlutterBinaryMessenger> *binaryMessenger;
+@end
+
+@implementation FLTImagePickerFlutterApi
+
+- (instancetype)initWithBinaryMessenger:(NSObject<FlutterBinaryMessenger> *)binaryMessenger {
+  self = [super init];
+  if (self) {
+    _binaryMessenger = binaryMessenger;
+  }
+  return self;
+}
+- (void)itemSavedAtIndex:(NSInteger)arg_index
+                    path:(NSString *)arg_path
+              completion:(void (^)(FlutterError *_Nullable))completion {
+  FlutterBasicMessageChannel *channel = [FlutterBasicMessageChannel
+      messageChannelWithName:@"dev.flutter.pigeon.image_picker_ios.ImagePickerFlutterApi.itemSaved"
+             binaryMessenger:self.binaryMessenger
+                       codec:FLTImagePickerFlutterApiGetCodec()];
+  [channel
+      sendMessage:@[ @(arg_index), arg_path ?: [NSNull null] ]
+            reply:^(NSArray<id> *reply) {
+              if (reply != nil) {
+                if (reply.count > 1) {
+                  completion([FlutterError errorWithCode:reply[0]
+                                                 message:reply[1]
+                                                 details:reply[2]]);
+                } else {
+                  completion(nil);
+                }
+              } else {
+                completion([FlutterError errorWithCode:@"channel-error"
+                                               message:@"Unable to establish connection on channel."
+                                               details:@""]);
+              }
+            }];
+}
+@end
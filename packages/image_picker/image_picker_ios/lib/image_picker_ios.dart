@@ -41,6 +41,96 @@ SourceCamera _convertCamera(CameraDevice camera) {
   throw UnimplementedError('Unknown camera: $camera');
 }
 
+/// The format that picked images are saved in when they have to be
+/// re-encoded, because a maximum size or an image quality is requested or
+/// because their original format is not supported.
+enum ImageOutputFormat {
+  /// Saves images as JPEG, unless they are PNG or GIF images.
+  ///
+  /// This is the default.
+  jpeg,
+
+  /// Keeps the original format of JPEG, PNG, GIF and HEIC images, and saves
+  /// other images as JPEG.
+  source,
+
+  /// Saves images other than GIF images as HEIC, which is usually much smaller
+  /// than JPEG at the same quality.
+  ///
+  /// Images are saved as JPEG on devices that cannot encode HEIC.
+  heic,
+}
+
+// Converts an [ImageOutputFormat] to the corresponding Pigeon API enum value.
+OutputFormat _convertOutputFormat(ImageOutputFormat format) {
+  switch (format) {
+    case ImageOutputFormat.jpeg:
+      return OutputFormat.jpeg;
+    case ImageOutputFormat.source:
+      return OutputFormat.source;
+    case ImageOutputFormat.heic:
+      return OutputFormat.heic;
+  }
+}
+
+/// The preset that picked videos are transcoded with before they are returned.
+///
+/// Transcoding reads the original video once and writes the smaller version
+/// directly. Videos are never scaled up, and are returned as is if they cannot
+/// be transcoded with the preset.
+enum VideoExportPreset {
+  /// Returns the original videos. This is the default.
+  original,
+
+  /// Transcodes videos to H.264 at up to 640x480.
+  h264Max640x480,
+
+  /// Transcodes videos to H.264 at up to 960x540.
+  h264Max960x540,
+
+  /// Transcodes videos to H.264 at up to 1280x720.
+  h264Max1280x720,
+
+  /// Transcodes videos to H.264 at up to 1920x1080.
+  h264Max1920x1080,
+
+  /// Transcodes videos to HEVC at up to 1920x1080.
+  hevcMax1920x1080,
+
+  /// Transcodes videos to HEVC at up to 3840x2160.
+  hevcMax3840x2160,
+}
+
+// Converts a [VideoExportPreset] to the corresponding Pigeon API enum value.
+ExportPreset _convertExportPreset(VideoExportPreset preset) {
+  switch (preset) {
+    case VideoExportPreset.original:
+      return ExportPreset.original;
+    case VideoExportPreset.h264Max640x480:
+      return ExportPreset.h264Max640x480;
+    case VideoExportPreset.h264Max960x540:
+      return ExportPreset.h264Max960x540;
+    case VideoExportPreset.h264Max1280x720:
+      return ExportPreset.h264Max1280x720;
+    case VideoExportPreset.h264Max1920x1080:
+      return ExportPreset.h264Max1920x1080;
+    case VideoExportPreset.hevcMax1920x1080:
+      return ExportPreset.hevcMax1920x1080;
+    case VideoExportPreset.hevcMax3840x2160:
+      return ExportPreset.hevcMax3840x2160;
+  }
+}
+
+// Forwards the items saved during a pick to the callback of that pick.
+class _SavedItemListener implements ImagePickerFlutterApi {
+  _SavedItemListener(this.onItemSaved);
+
+  final void Function(int index, String path) onItemSaved;
+
+  @override
+  void itemSaved(int index, String path) => onItemSaved(index, path);
+}
+
 /// An implementation of [ImagePickerPlatform] for iOS.
 class ImagePickerIOS extends ImagePickerPlatform {
   final ImagePickerApi _hostApi = ImagePickerApi();
@@ -114,6 +204,57 @@ class ImagePickerIOS extends ImagePickerPlatform {
     return paths.map((String path) => XFile(path)).toList();
   }
 
+  /// Picks multiple images like [getMultiImageWithOptions], and calls
+  /// [onImageSaved] with the index and file of each picked image as soon as it
+  /// has been saved.
+  ///
+  /// Images are saved concurrently, so [onImageSaved] is not necessarily called
+  /// in index order. The returned future still completes with every image once
+  /// all of them have been saved. Images picked with `UIImagePickerController`,
+  /// which is used before iOS 14, are only returned by the future.
+  Future<List<XFile>> getMultiImageWithProgress({
+    MultiImagePickerOptions options = const MultiImagePickerOptions(),
+    required void Function(int index, XFile file) onImageSaved,
+  }) async {
+    ImagePickerFlutterApi.setup(_SavedItemListener(
+      (int index, String path) => onImageSaved(index, XFile(path)),
+    ));
+    await _hostApi.setReportsSavedItems(true);
+    try {
+      return await getMultiImageWithOptions(options: options);
+    } finally {
+      await _hostApi.setReportsSavedItems(false);
+      ImagePickerFlutterApi.setup(null);
+    }
+  }
+
+  /// Sets the format that images picked after this call are saved in when
+  /// they have to be re-encoded.
+  Future<void> setImageOutputFormat(ImageOutputFormat format) {
+    return _hostApi.setImageOutputFormat(_convertOutputFormat(format));
+  }
+
+  /// Sets the preset that videos picked after this call are transcoded with.
+  Future<void> setVideoExportPreset(VideoExportPreset preset) {
+    return _hostApi.setVideoExportPreset(_convertExportPreset(preset));
+  }
+
+  /// Sets the size in pixels of the square that images picked after this call
+  /// are scaled to fit in and saved as thumbnails, or `null` to save the
+  /// images themselves.
+  ///
+  /// When the app can read the photo library, thumbnails are requested from
+  /// the Photos framework without loading the full images. Otherwise they are
+  /// decoded at their scaled size from the image data. Thumbnails are only
+  /// created for images picked with `PHPickerViewController`, which is used on
+  /// iOS 14 and later.
+  Future<void> setThumbnailSize(double? size) {
+    if (size != null && size <= 0) {
+      throw ArgumentError.value(size, 'size', 'must be positive');
+    }
+    return _hostApi.setThumbnailSize(size);
+  }
+
   Future<List<String>> _pickMultiImageAsPath({
     MultiImagePickerOptions options = const MultiImagePickerOptions(),
   }) async {
@@ -32,6 +32,22 @@ enum SourceType {
   gallery,
 }
 
+enum OutputFormat {
+  jpeg,
+  source,
+  heic,
+}
+
+enum ExportPreset {
+  original,
+  h264Max640x480,
+  h264Max960x540,
+  h264Max1280x720,
+  h264Max1920x1080,
+  hevcMax1920x1080,
+  hevcMax3840x2160,
+}
+
 class MaxSize {
   MaxSize({
     this.width,
@@ -271,4 +287,145 @@ class ImagePickerApi {
       return (replyList[0] as List<Object?>?)!.cast<String?>();
     }
   }
+
+  /// Sets whether picked items are sent to [ImagePickerFlutterApi.itemSaved]
+  /// as soon as they are saved.
+  Future<void> setReportsSavedItems(bool arg_reportsSavedItems) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setReportsSavedItems',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_reportsSavedItems]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets the format that picked images are saved in when they are
+  /// re-encoded.
+  Future<void> setImageOutputFormat(OutputFormat arg_format) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setImageOutputFormat',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_format.index]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets the preset that picked videos are transcoded with.
+  Future<void> setVideoExportPreset(ExportPreset arg_preset) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setVideoExportPreset',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_preset.index]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Sets the size of the thumbnails that picked images are saved as, or
+  /// null to save the images themselves.
+  Future<void> setThumbnailSize(double? arg_size) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setThumbnailSize',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_size]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+}
+
+/// Receives the items of a pick that is still in progress.
+abstract class ImagePickerFlutterApi {
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  /// Called when the picked item at [index] has been saved to [path].
+  void itemSaved(int index, String path);
+
+  static void setup(ImagePickerFlutterApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.image_picker_ios.ImagePickerFlutterApi.itemSaved',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerFlutterApi.itemSaved was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_index = (args[0] as int?);
+          assert(arg_index != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerFlutterApi.itemSaved was null, expected non-null int.');
+          final String? arg_path = (args[1] as String?);
+          assert(arg_path != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerFlutterApi.itemSaved was null, expected non-null String.');
+          try {
+            api.itemSaved(arg_index!, arg_path!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
 }
@@ -40,6 +40,20 @@ enum SourceCamera { rear, front }
 // Corresponds to `ImageSource` from the platform interface package.
 enum SourceType { camera, gallery }
 
+// Corresponds to `ImageOutputFormat` from the public API of this package.
+enum OutputFormat { jpeg, source, heic }
+
+// Corresponds to `VideoExportPreset` from the public API of this package.
+enum ExportPreset {
+  original,
+  h264Max640x480,
+  h264Max960x540,
+  h264Max1280x720,
+  h264Max1920x1080,
+  hevcMax1920x1080,
+  hevcMax3840x2160,
+}
+
 class SourceSpecification {
   SourceSpecification(this.type, this.camera);
   SourceType type;
@@ -64,4 +78,31 @@ abstract class ImagePickerApi {
   @async
   @ObjCSelector('pickMediaWithMediaSelectionOptions:')
   List<String?> pickMedia(MediaSelectionOptions mediaSelectionOptions);
+
+  /// Sets whether picked items are sent to [ImagePickerFlutterApi.itemSaved]
+  /// as soon as they are saved.
+  @ObjCSelector('setReportsSavedItems:')
+  void setReportsSavedItems(bool reportsSavedItems);
+
+  /// Sets the format that picked images are saved in when they are
+  /// re-encoded.
+  @ObjCSelector('setImageOutputFormat:')
+  void setImageOutputFormat(OutputFormat format);
+
+  /// Sets the preset that picked videos are transcoded with.
+  @ObjCSelector('setVideoExportPreset:')
+  void setVideoExportPreset(ExportPreset preset);
+
+  /// Sets the size of the thumbnails that picked images are saved as, or
+  /// null to save the images themselves.
+  @ObjCSelector('setThumbnailSize:')
+  void setThumbnailSize(double? size);
+}
+
+/// Receives the items of a pick that is still in progress.
+@FlutterApi()
+abstract class ImagePickerFlutterApi {
+  /// Called when the picked item at [index] has been saved to [path].
+  @ObjCSelector('itemSavedAtIndex:path:')
+  void itemSaved(int index, String path);
 }
@@ -35,6 +35,9 @@ class _LoggedMethodCall {
 class _ApiLogger implements TestHostImagePickerApi {
   // The value to return from future calls.
   dynamic returnValue = '';
+  // Called by pickMultiImage before it returns, to send the messages the host
+  // sends while a pick is in progress.
+  Future<void> Function()? onPickMultiImage;
   final List<_LoggedMethodCall> calls = <_LoggedMethodCall>[];
 
   @override
@@ -68,6 +71,7 @@ class _ApiLogger implements TestHostImagePickerApi {
       'imageQuality': imageQuality,
       'requestFullMetadata': requestFullMetadata,
     }));
+    await onPickMultiImage?.call();
     return returnValue as List<String?>;
   }
 
@@ -94,6 +98,40 @@ class _ApiLogger implements TestHostImagePickerApi {
     }));
     return returnValue as String?;
   }
+
+  @override
+  void setReportsSavedItems(bool reportsSavedItems) {
+    calls.add(_LoggedMethodCall('setReportsSavedItems',
+        arguments: <String, dynamic>{'reportsSavedItems': reportsSavedItems}));
+  }
+
+  @override
+  void setImageOutputFormat(OutputFormat format) {
+    calls.add(_LoggedMethodCall('setImageOutputFormat',
+        arguments: <String, dynamic>{'format': format}));
+  }
+
+  @override
+  void setVideoExportPreset(ExportPreset preset) {
+    calls.add(_LoggedMethodCall('setVideoExportPreset',
+        arguments: <String, dynamic>{'preset': preset}));
+  }
+
+  @override
+  void setThumbnailSize(double? size) {
+    calls.add(_LoggedMethodCall('setThumbnailSize',
+        arguments: <String, dynamic>{'size': size}));
+  }
+}
+
+// Sends a message that the host sends when a picked item has been saved.
+Future<void> _sendItemSaved(int index, String path) async {
+  await TestDefaultBinaryMessengerBinding.instance.defaultBinaryMessenger
+      .handlePlatformMessage(
+    'dev.flutter.pigeon.image_picker_ios.ImagePickerFlutterApi.itemSaved',
+    ImagePickerFlutterApi.codec.encodeMessage(<Object?>[index, path]),
+    (_) {},
+  );
 }
 
 void main() {
@@ -890,6 +928,122 @@ void main() {
     });
   });
 
+  group('#getMultiImageWithProgress', () {
+    test('reports each image as soon as it is saved', () async {
+      log.returnValue = <String>['0', '1'];
+      log.onPickMultiImage = () async {
+        await _sendItemSaved(1, '1');
+        await _sendItemSaved(0, '0');
+      };
+
+      final List<String> savedImages = <String>[];
+      final List<XFile> files = await picker.getMultiImageWithProgress(
+        onImageSaved: (int index, XFile file) {
+          savedImages.add('$index:${file.path}');
+        },
+      );
+
+      expect(savedImages, <String>['1:1', '0:0']);
+      expect(files.map((XFile file) => file.path), <String>['0', '1']);
+      expect(
+        log.calls,
+        <_LoggedMethodCall>[
+          const _LoggedMethodCall('setReportsSavedItems',
+              arguments: <String, dynamic>{'reportsSavedItems': true}),
+          const _LoggedMethodCall('pickMultiImage',
+              arguments: <String, dynamic>{
+                'maxWidth': null,
+                'maxHeight': null,
+                'imageQuality': null,
+                'requestFullMetadata': true,
+              }),
+          const _LoggedMethodCall('setReportsSavedItems',
+              arguments: <String, dynamic>{'reportsSavedItems': false}),
+        ],
+      );
+    });
+
+    test('stops reporting images when the pick fails', () async {
+      log.returnValue = 'not a list';
+
+      await expectLater(
+        picker.getMultiImageWithProgress(
+          onImageSaved: (int index, XFile file) {},
+        ),
+        throwsA(anything),
+      );
+      expect(
+        log.calls.last,
+        const _LoggedMethodCall('setReportsSavedItems',
+            arguments: <String, dynamic>{'reportsSavedItems': false}),
+      );
+    });
+  });
+
+  group('#setImageOutputFormat', () {
+    test('passes the format', () async {
+      await picker.setImageOutputFormat(ImageOutputFormat.jpeg);
+      await picker.setImageOutputFormat(ImageOutputFormat.source);
+      await picker.setImageOutputFormat(ImageOutputFormat.heic);
+
+      expect(
+        log.calls,
+        <_LoggedMethodCall>[
+          const _LoggedMethodCall('setImageOutputFormat',
+              arguments: <String, dynamic>{'format': OutputFormat.jpeg}),
+          const _LoggedMethodCall('setImageOutputFormat',
+              arguments: <String, dynamic>{'format': OutputFormat.source}),
+          const _LoggedMethodCall('setImageOutputFormat',
+              arguments: <String, dynamic>{'format': OutputFormat.heic}),
+        ],
+      );
+    });
+  });
+
+  group('#setVideoExportPreset', () {
+    test('passes the preset', () async {
+      await picker.setVideoExportPreset(VideoExportPreset.hevcMax1920x1080);
+      await picker.setVideoExportPreset(VideoExportPreset.original);
+
+      expect(
+        log.calls,
+        <_LoggedMethodCall>[
+          const _LoggedMethodCall('setVideoExportPreset',
+              arguments: <String, dynamic>{
+                'preset': ExportPreset.hevcMax1920x1080
+              }),
+          const _LoggedMethodCall('setVideoExportPreset',
+              arguments: <String, dynamic>{'preset': ExportPreset.original}),
+        ],
+      );
+    });
+  });
+
+  group('#setThumbnailSize', () {
+    test('passes the size', () async {
+      await picker.setThumbnailSize(256);
+      await picker.setThumbnailSize(null);
+
+      expect(
+        log.calls,
+        <_LoggedMethodCall>[
+          const _LoggedMethodCall('setThumbnailSize',
+              arguments: <String, dynamic>{'size': 256.0}),
+          const _LoggedMethodCall('setThumbnailSize',
+              arguments: <String, dynamic>{'size': null}),
+        ],
+      );
+    });
+
+    test('does not accept a size that is not positive', () {
+      expect(
+        () => picker.setThumbnailSize(0),
+        throwsArgumentError,
+      );
+      expect(log.calls, isEmpty);
+    });
+  });
+
   group('#getMedia', () {
     test('calls the method correctly', () async {
       log.returnValue = <String>['0', '1'];
@@ -63,6 +63,21 @@ abstract class TestHostImagePickerApi {
   /// Selects images and videos and returns their paths.
   Future<List<String?>> pickMedia(MediaSelectionOptions mediaSelectionOptions);
 
+  /// Sets whether picked items are sent to [ImagePickerFlutterApi.itemSaved]
+  /// as soon as they are saved.
+  void setReportsSavedItems(bool reportsSavedItems);
+
+  /// Sets the format that picked images are saved in when they are
+  /// re-encoded.
+  void setImageOutputFormat(OutputFormat format);
+
+  /// Sets the preset that picked videos are transcoded with.
+  void setVideoExportPreset(ExportPreset preset);
+
+  /// Sets the size of the thumbnails that picked images are saved as, or
+  /// null to save the images themselves.
+  void setThumbnailSize(double? size);
+
   static void setup(TestHostImagePickerApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
@@ -201,5 +216,125 @@ abstract class TestHostImagePickerApi {
         });
       }
     }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setReportsSavedItems',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setReportsSavedItems was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final bool? arg_reportsSavedItems = (args[0] as bool?);
+          assert(arg_reportsSavedItems != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setReportsSavedItems was null, expected non-null bool.');
+          try {
+            api.setReportsSavedItems(arg_reportsSavedItems!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setImageOutputFormat',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setImageOutputFormat was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final OutputFormat? arg_format =
+              args[0] == null ? null : OutputFormat.values[args[0]! as int];
+          assert(arg_format != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setImageOutputFormat was null, expected non-null OutputFormat.');
+          try {
+            api.setImageOutputFormat(arg_format!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setVideoExportPreset',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setVideoExportPreset was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final ExportPreset? arg_preset =
+              args[0] == null ? null : ExportPreset.values[args[0]! as int];
+          assert(arg_preset != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setVideoExportPreset was null, expected non-null ExportPreset.');
+          try {
+            api.setVideoExportPreset(arg_preset!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setThumbnailSize',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.image_picker_ios.ImagePickerApi.setThumbnailSize was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final double? arg_size = (args[0] as double?);
+          try {
+            api.setThumbnailSize(arg_size);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
   }
 }
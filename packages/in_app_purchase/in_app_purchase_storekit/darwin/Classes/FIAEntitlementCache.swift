@@ -0,0 +1,127 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import Foundation
+import StoreKit
+
+/// Keeps the app's current entitlements, as reported by StoreKit 2's
+/// `Transaction.currentEntitlements`, so they can be returned without waiting on StoreKit.
+///
+/// Each entitlement is verified on the device by StoreKit. The cache is loaded when `start` is
+/// called and reloaded whenever a transaction arrives on `Transaction.updates`, such as a
+/// renewal, a refund or a purchase made on another device.
+@available(iOS 15.0, macOS 12.0, *)
+@objc(FIAEntitlementCache)
+public final class FIAEntitlementCache: NSObject {
+  private let lock = NSLock()
+
+  // The translated entitlements, or nil until they have been loaded once.
+  private var entitlements: [[String: Any]]?
+
+  // Incremented by each reload, so that a slow reload can't replace the result of a later one.
+  private var generation = 0
+
+  // Reloads the cache for each transaction on `Transaction.updates`.
+  private var updatesTask: Task<Void, Never>?
+
+  deinit {
+    updatesTask?.cancel()
+  }
+
+  /// Loads the entitlements, and starts reloading them when transactions are updated.
+  @objc public func start() {
+    lock.lock()
+    defer { lock.unlock() }
+    if updatesTask != nil {
+      return
+    }
+    updatesTask = Task.detached(priority: .utility) { [weak self] in
+      await self?.reload()
+      for await _ in Transaction.updates {
+        await self?.reload()
+      }
+    }
+  }
+
+  /// Calls `completion` on an arbitrary queue with the current entitlements, loading them first
+  /// if they haven't been loaded yet.
+  @objc public func currentEntitlements(completion: @escaping ([[String: Any]]) -> Void) {
+    lock.lock()
+    let cached = entitlements
+    lock.unlock()
+    if let cached = cached {
+      completion(cached)
+      return
+    }
+    Task.detached(priority: .userInitiated) { [weak self] in
+      completion(await self?.reload() ?? [])
+    }
+  }
+
+  @discardableResult
+  private func reload() async -> [[String: Any]] {
+    lock.lock()
+    generation += 1
+    let reloadGeneration = generation
+    lock.unlock()
+
+    var maps: [[String: Any]] = []
+    for await result in Transaction.currentEntitlements {
+      maps.append(FIAEntitlementCache.map(from: result))
+    }
+
+    lock.lock()
+    if reloadGeneration == generation {
+      entitlements = maps
+    }
+    lock.unlock()
+    return maps
+  }
+
+  /// Returns a map of `result`'s transaction and verification state for sending to Dart.
+  ///
+  /// Dates are in seconds since 1970, like the dates of StoreKit 1 transactions.
+  static func map(from result: VerificationResult<Transaction>) -> [String: Any] {
+    let transaction: Transaction
+    var map: [String: Any] = [:]
+    switch result {
+    case .verified(let verifiedTransaction):
+      transaction = verifiedTransaction
+      map["isVerified"] = true
+    case .unverified(let unverifiedTransaction, let error):
+      transaction = unverifiedTransaction
+      map["isVerified"] = false
+      map["verificationError"] = error.localizedDescription
+    }
+    map["productIdentifier"] = transaction.productID
+    map["transactionIdentifier"] = String(transaction.id)
+    map["originalTransactionIdentifier"] = String(transaction.originalID)
+    map["productType"] = productTypeIndex(transaction.productType)
+    map["ownershipType"] = transaction.ownershipType == .familyShared ? 1 : 0
+    map["purchaseDate"] = transaction.purchaseDate.timeIntervalSince1970
+    if let expirationDate = transaction.expirationDate {
+      map["expirationDate"] = expirationDate.timeIntervalSince1970
+    }
+    map["isUpgraded"] = transaction.isUpgraded
+    map["jwsRepresentation"] = result.jwsRepresentation
+    return map
+  }
+
+  // Returns the index of `productType` in the Dart SKEntitlementProductType enum.
+  private static func productTypeIndex(_ productType: Product.ProductType) -> Int {
+    switch productType {
+    case .consumable:
+      return 0
+    case .nonConsumable:
+      return 1
+    case .nonRenewable:
+      return 2
+    case .autoRenewable:
+      return 3
+    default:
+      // Types added in later versions of StoreKit are treated as non-consumable.
+      return 1
+    }
+  }
+}
@@ -12,6 +12,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable NSString *)retrieveReceiptWithError:(FlutterError *_Nullable *_Nullable)error;
 
+// Returns the receipt file data, memory mapped when possible, or nil if there is no receipt.
+- (nullable NSData *)retrieveReceiptBytesWithError:(FlutterError *_Nullable *_Nullable)error;
+
+// Returns a map with the receipt's "size" in bytes and the hex encoded "sha256" hash of its
+// contents, or nil if there is no receipt. Apps can compare them to those of the last uploaded
+// receipt instead of fetching and uploading an unchanged receipt.
+- (nullable NSDictionary<NSString *, id> *)retrieveReceiptInfoWithError:
+    (FlutterError *_Nullable *_Nullable)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #import "FIAPReceiptManager.h"
+#import <CommonCrypto/CommonDigest.h>
 #if TARGET_OS_OSX
 #import <FlutterMacOS/FlutterMacOS.h>
 #else
@@ -20,6 +21,11 @@
 @implementation FIAPReceiptManager
 
 - (NSString *)retrieveReceiptWithError:(FlutterError **)flutterError {
+  NSData *receipt = [self retrieveReceiptBytesWithError:flutterError];
+  return [receipt base64EncodedStringWithOptions:kNilOptions];
+}
+
+- (NSData *)retrieveReceiptBytesWithError:(FlutterError **)flutterError {
   NSURL *receiptURL = [[NSBundle mainBundle] appStoreReceiptURL];
   if (!receiptURL) {
     return nil;
@@ -35,7 +41,21 @@
     }
     return nil;
   }
-  return [receipt base64EncodedStringWithOptions:kNilOptions];
+  return receipt;
+}
+
+- (NSDictionary<NSString *, id> *)retrieveReceiptInfoWithError:(FlutterError **)flutterError {
+  NSData *receipt = [self retrieveReceiptBytesWithError:flutterError];
+  if (!receipt) {
+    return nil;
+  }
+  unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+  CC_SHA256(receipt.bytes, (CC_LONG)receipt.length, digest);
+  NSMutableString *sha256 = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+  for (int i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+    [sha256 appendFormat:@"%02x", digest[i]];
+  }
+  return @{@"size" : @(receipt.length), @"sha256" : sha256};
 }
 
 - (NSData *)getReceiptData:(NSURL *)url error:(NSError **)error {
@@ -108,6 +108,9 @@ typedef void (^UpdatedDownloads)(NSArray<SKDownload *> *downloads);
 - (void)restoreTransactions:(nullable NSString *)applicationName;
 - (void)presentCodeRedemptionSheet API_UNAVAILABLE(tvos, macos, watchos);
 - (NSArray<SKPaymentTransaction *> *)getUnfinishedTransactions;
+// Returns the unfinished transactions recorded in the transaction cache's journal, including
+// those from previous launches that StoreKit has not re-delivered yet.
+- (NSArray<NSDictionary<NSString *, id> *> *)getJournaledTransactions;
 
 // This method needs to be called before any other methods.
 - (void)startObservingPaymentQueue;
@@ -113,7 +113,8 @@
   // If the app is killed, cached transactions will be removed from memory;
   // however, the App Store will re-deliver the transactions as soon as the app
   // is started again, since the cached transactions have not been acknowledged
-  // by the client (by sending the `finishTransaction` message).
+  // by the client (by sending the `finishTransaction` message). Until then,
+  // the transaction cache's journal lists them.
   self.observingTransactions = NO;
 }
 
@@ -181,6 +182,7 @@
 // state of transactions and finish as appropriate.
 - (void)paymentQueue:(SKPaymentQueue *)queue
     updatedTransactions:(NSArray<SKPaymentTransaction *> *)transactions {
+  [_transactionCache journalTransactions:transactions];
   if (!self.observingTransactions) {
     [_transactionCache addObjects:transactions forKey:TransactionCacheKeyUpdatedTransactions];
     return;
@@ -193,6 +195,7 @@
 // Sent when transactions are removed from the queue (via finishTransaction:).
 - (void)paymentQueue:(SKPaymentQueue *)queue
     removedTransactions:(NSArray<SKPaymentTransaction *> *)transactions {
+  [_transactionCache removeJournaledTransactions:transactions];
   if (!self.observingTransactions) {
     [_transactionCache addObjects:transactions forKey:TransactionCacheKeyRemovedTransactions];
     return;
@@ -233,6 +236,10 @@
   return self.queue.transactions;
 }
 
+- (NSArray<NSDictionary<NSString *, id> *> *)getJournaledTransactions {
+  return [self.transactionCache getJournaledTransactions];
+}
+
 - (SKStorefront *)storefront {
   return self.queue.storefront;
 }
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#import <StoreKit/StoreKit.h>
+
 NS_ASSUME_NONNULL_BEGIN
 
 typedef NS_ENUM(NSUInteger, TransactionCacheKey) {
@@ -12,6 +14,19 @@ typedef NS_ENUM(NSUInteger, TransactionCacheKey) {
 
 @interface FIATransactionCache : NSObject
 
+/// Creates a transaction cache that only keeps objects in memory.
+- (instancetype)init;
+
+/// Creates a transaction cache that also keeps a journal of unfinished transactions in the file at
+/// `journalURL`, and loads the journal written by previous launches of the app.
+///
+/// The journal lets the app know about unfinished transactions as soon as it starts, before
+/// StoreKit re-delivers them to the transaction observer.
+- (instancetype)initWithJournalURL:(nullable NSURL *)journalURL NS_DESIGNATED_INITIALIZER;
+
+/// The default location of the journal, in the app's Application Support directory.
++ (nullable NSURL *)defaultJournalURL;
+
 /// Adds objects to the transaction cache.
 ///
 /// If the cache already contains an array of objects on the specified key, the supplied
@@ -24,8 +39,28 @@ typedef NS_ENUM(NSUInteger, TransactionCacheKey) {
 - (NSArray *)getObjectsForKey:(TransactionCacheKey)key;
 
 /// Removes all objects from the transaction cache.
+///
+/// The journal is not affected, since it tracks transactions until they are finished.
 - (void)clear;
 
+/// Records the state of the given transactions in the journal.
+///
+/// Transactions without a transaction identifier, such as those that are still purchasing, are
+/// not recorded.
+- (void)journalTransactions:(NSArray<SKPaymentTransaction *> *)transactions;
+
+/// Removes the given finished transactions from the journal.
+- (void)removeJournaledTransactions:(NSArray<SKPaymentTransaction *> *)transactions;
+
+/// Gets the unfinished transactions recorded in the journal, ordered by transaction date.
+///
+/// Each entry is a map with the "transactionIdentifier", the "productIdentifier" of its payment,
+/// its "transactionState" and its "transactionTimeStamp" in seconds since 1970.
+- (NSArray<NSDictionary<NSString *, id> *> *)getJournaledTransactions;
+
+/// Blocks until the journal changes made so far are written to disk.
+- (void)flushJournal;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -9,19 +9,45 @@
 /// A NSMutableDictionary storing the objects that are cached.
 @property(nonatomic, strong, nonnull) NSMutableDictionary *cache;
 
+/// The file the journal is written to, or nil if the journal is only kept in memory.
+@property(nonatomic, strong, nullable) NSURL *journalURL;
+
+/// The journal entries of unfinished transactions, keyed by transaction identifier.
+@property(nonatomic, strong, nonnull)
+    NSMutableDictionary<NSString *, NSDictionary<NSString *, id> *> *journal;
+
+/// Serial queue that writes the journal, so that StoreKit callbacks don't wait on disk writes.
+@property(nonatomic, strong, nonnull) dispatch_queue_t journalQueue;
+
 @end
 
 @implementation FIATransactionCache
 
 - (instancetype)init {
+  return [self initWithJournalURL:nil];
+}
+
+- (instancetype)initWithJournalURL:(NSURL *)journalURL {
   self = [super init];
   if (self) {
     self.cache = [[NSMutableDictionary alloc] init];
+    self.journalURL = journalURL;
+    self.journal = [[NSMutableDictionary alloc] init];
+    self.journalQueue = dispatch_queue_create("plugins.flutter.io/in_app_purchase.journal",
+                                              DISPATCH_QUEUE_SERIAL);
+    [self loadJournal];
   }
 
   return self;
 }
 
++ (NSURL *)defaultJournalURL {
+  NSURL *directory = [[NSFileManager defaultManager] URLsForDirectory:NSApplicationSupportDirectory
+                                                            inDomains:NSUserDomainMask]
+                         .firstObject;
+  return [directory URLByAppendingPathComponent:@"in_app_purchase_storekit/transaction_journal.plist"];
+}
+
 - (void)addObjects:(NSArray *)objects forKey:(TransactionCacheKey)key {
   NSArray *cachedObjects = self.cache[@(key)];
 
@@ -37,4 +63,102 @@
   [self.cache removeAllObjects];
 }
 
+#pragma mark - journal
+
+- (void)journalTransactions:(NSArray<SKPaymentTransaction *> *)transactions {
+  BOOL changed = NO;
+  for (SKPaymentTransaction *transaction in transactions) {
+    NSString *identifier = transaction.transactionIdentifier;
+    if (!identifier) {
+      continue;
+    }
+    NSDictionary<NSString *, id> *entry = @{
+      @"transactionIdentifier" : identifier,
+      @"productIdentifier" : transaction.payment.productIdentifier ?: @"",
+      @"transactionState" : @(transaction.transactionState),
+      @"transactionTimeStamp" : @(transaction.transactionDate.timeIntervalSince1970),
+    };
+    if (![self.journal[identifier] isEqualToDictionary:entry]) {
+      self.journal[identifier] = entry;
+      changed = YES;
+    }
+  }
+  if (changed) {
+    [self writeJournal];
+  }
+}
+
+- (void)removeJournaledTransactions:(NSArray<SKPaymentTransaction *> *)transactions {
+  BOOL changed = NO;
+  for (SKPaymentTransaction *transaction in transactions) {
+    NSString *identifier = transaction.transactionIdentifier;
+    if (identifier && self.journal[identifier]) {
+      [self.journal removeObjectForKey:identifier];
+      changed = YES;
+    }
+  }
+  if (changed) {
+    [self writeJournal];
+  }
+}
+
+- (NSArray<NSDictionary<NSString *, id> *> *)getJournaledTransactions {
+  return [self.journal.allValues
+      sortedArrayUsingDescriptors:@[ [NSSortDescriptor sortDescriptorWithKey:@"transactionTimeStamp"
+                                                                   ascending:YES] ]];
+}
+
+- (void)flushJournal {
+  dispatch_sync(self.journalQueue, ^{
+                });
+}
+
+// Reads the journal written by previous launches. A missing or unreadable journal is treated as
+// empty, since StoreKit re-delivers unfinished transactions anyway.
+- (void)loadJournal {
+  if (!self.journalURL) {
+    return;
+  }
+  NSData *data = [NSData dataWithContentsOfURL:self.journalURL];
+  if (!data) {
+    return;
+  }
+  id entries = [NSPropertyListSerialization propertyListWithData:data
+                                                         options:NSPropertyListImmutable
+                                                          format:nil
+                                                           error:nil];
+  if (![entries isKindOfClass:[NSArray class]]) {
+    return;
+  }
+  for (NSDictionary<NSString *, id> *entry in entries) {
+    NSString *identifier = [entry isKindOfClass:[NSDictionary class]]
+                               ? entry[@"transactionIdentifier"]
+                               : nil;
+    if ([identifier isKindOfClass:[NSString class]]) {
+      self.journal[identifier] = entry;
+    }
+  }
+}
+
+// Writes a snapshot of the journal as a binary property list on the journal queue.
+- (void)writeJournal {
+  NSURL *journalURL = self.journalURL;
+  if (!journalURL) {
+    return;
+  }
+  NSArray *entries = self.journal.allValues;
+  dispatch_async(self.journalQueue, ^{
+    NSData *data =
+        [NSPropertyListSerialization dataWithPropertyList:entries
+                                                   format:NSPropertyListBinaryFormat_v1_0
+                                                  options:0
+                                                    error:nil];
+    [[NSFileManager defaultManager] createDirectoryAtURL:[journalURL URLByDeletingLastPathComponent]
+                             withIntermediateDirectories:YES
+                                              attributes:nil
+                                                   error:nil];
+    [data writeToURL:journalURL atomically:YES];
+  });
+}
+
 @end
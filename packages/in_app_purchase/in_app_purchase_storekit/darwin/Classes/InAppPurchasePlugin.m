@@ -9,6 +9,21 @@
 #import "FIAPReceiptManager.h"
 #import "FIAPRequestHandler.h"
 #import "FIAPaymentQueueHandler.h"
+// FIAEntitlementCache is written in Swift, since StoreKit 2 has no Objective-C API.
+#if __has_include(<in_app_purchase_storekit/in_app_purchase_storekit-Swift.h>)
+#import <in_app_purchase_storekit/in_app_purchase_storekit-Swift.h>
+#else
+#import "in_app_purchase_storekit-Swift.h"
+#endif
+
+// How long a translated product stays valid in the product details cache.
+static const NSTimeInterval kProductDetailsCacheDuration = 5 * 60;
+
+// The maximum number of transactions sent to dart in a single observer callback.
+static const NSUInteger kTransactionCallbackPageSize = 100;
+
+typedef void (^FIAProductDetailsCompletion)(NSDictionary *_Nullable productMap,
+                                            FlutterError *_Nullable error);
 
 @interface InAppPurchasePlugin ()
 
@@ -20,6 +35,36 @@
 // for purchase.
 @property(strong, nonatomic, readonly) NSMutableDictionary *productsCache;
 
+// Translated product maps keyed by product identifier, returned to dart without another
+// SKProductsRequest until they are older than kProductDetailsCacheDuration.
+@property(strong, nonatomic, readonly)
+    NSMutableDictionary<NSString *, NSDictionary *> *productMapsCache;
+@property(strong, nonatomic, readonly)
+    NSMutableDictionary<NSString *, NSDate *> *productMapsCacheDates;
+
+// The storefront the product maps were fetched for. Prices are storefront specific, so the cache
+// is cleared when the storefront changes.
+@property(copy, nonatomic) NSString *productMapsCacheStorefrontIdentifier;
+
+// Completions waiting on an in-flight SKProductsRequest, keyed by product identifier. Requests
+// for identifiers that are already being fetched wait on the pending request instead of
+// starting another one.
+@property(strong, nonatomic, readonly)
+    NSMutableDictionary<NSString *, NSMutableArray<FIAProductDetailsCompletion> *>
+        *pendingProductCompletions;
+
+// Serial queue used to translate SKProducts off the main thread.
+@property(strong, nonatomic, readonly) dispatch_queue_t productTranslationQueue;
+
+// Updated transactions received during the current run loop turn. StoreKit delivers restored
+// transactions in many small batches, which are coalesced into a single callback to dart.
+@property(strong, nonatomic, readonly)
+    NSMutableArray<SKPaymentTransaction *> *pendingUpdatedTransactions;
+
+// Serial queue used to translate transactions off the main thread. Every transaction observer
+// callback goes through this queue so dart receives them in the order StoreKit sent them.
+@property(strong, nonatomic, readonly) dispatch_queue_t transactionTranslationQueue;
+
 // Callback channel to dart used for when a function from the transaction observer is triggered.
 @property(strong, nonatomic, readonly) FlutterMethodChannel *transactionObserverCallbackChannel;
 
@@ -28,6 +73,10 @@
 @property(strong, nonatomic, readonly) NSObject<FlutterPluginRegistrar> *registrar;
 
 @property(strong, nonatomic, readonly) FIAPReceiptManager *receiptManager;
+
+// The StoreKit 2 entitlements, verified on device and kept up to date with Transaction.updates.
+@property(strong, nonatomic, readonly)
+    FIAEntitlementCache *entitlementCache API_AVAILABLE(ios(15.0), macos(12.0));
 @property(strong, nonatomic, readonly)
     FIAPPaymentQueueDelegate *paymentQueueDelegate API_AVAILABLE(ios(13))
         API_UNAVAILABLE(tvos, macos, watchos);
@@ -49,6 +98,19 @@
   _receiptManager = receiptManager;
   _requestHandlers = [NSMutableSet new];
   _productsCache = [NSMutableDictionary new];
+  _productMapsCache = [NSMutableDictionary new];
+  _productMapsCacheDates = [NSMutableDictionary new];
+  _pendingProductCompletions = [NSMutableDictionary new];
+  _productTranslationQueue =
+      dispatch_queue_create("plugins.flutter.io/in_app_purchase.product_translation",
+                            DISPATCH_QUEUE_SERIAL);
+  _pendingUpdatedTransactions = [NSMutableArray new];
+  _transactionTranslationQueue =
+      dispatch_queue_create("plugins.flutter.io/in_app_purchase.transaction_translation",
+                            DISPATCH_QUEUE_SERIAL);
+  if (@available(iOS 15.0, macOS 12.0, *)) {
+    _entitlementCache = [FIAEntitlementCache new];
+  }
   return self;
 }
 
@@ -76,11 +138,17 @@
       updatedDownloads:^void(NSArray<SKDownload *> *_Nonnull downloads) {
         [weakSelf updatedDownloads:downloads];
       }
-      transactionCache:[[FIATransactionCache alloc] init]];
+      transactionCache:[[FIATransactionCache alloc]
+                           initWithJournalURL:[FIATransactionCache defaultJournalURL]]];
 
   _transactionObserverCallbackChannel =
       [FlutterMethodChannel methodChannelWithName:@"plugins.flutter.io/in_app_purchase"
                                   binaryMessenger:[registrar messenger]];
+
+  // Load the entitlements now, so that they are ready when the app checks them at launch.
+  if (@available(iOS 15.0, macOS 12.0, *)) {
+    [_entitlementCache start];
+  }
   return self;
 }
 
@@ -89,6 +157,9 @@
     [self canMakePayments:result];
   } else if ([@"-[SKPaymentQueue transactions]" isEqualToString:call.method]) {
     [self getPendingTransactions:result];
+  } else if ([@"-[InAppPurchasePlugin journaledTransactions:result:]"
+                 isEqualToString:call.method]) {
+    [self getJournaledTransactions:result];
   } else if ([@"-[SKPaymentQueue storefront]" isEqualToString:call.method]) {
     [self getStorefront:result];
   } else if ([@"-[InAppPurchasePlugin startProductRequest:result:]" isEqualToString:call.method]) {
@@ -106,8 +177,15 @@
 #endif
   } else if ([@"-[InAppPurchasePlugin retrieveReceiptData:result:]" isEqualToString:call.method]) {
     [self retrieveReceiptData:call result:result];
+  } else if ([@"-[InAppPurchasePlugin retrieveReceiptBytes:result:]" isEqualToString:call.method]) {
+    [self retrieveReceiptBytes:call result:result];
+  } else if ([@"-[InAppPurchasePlugin retrieveReceiptInfo:result:]" isEqualToString:call.method]) {
+    [self retrieveReceiptInfo:call result:result];
   } else if ([@"-[InAppPurchasePlugin refreshReceipt:result:]" isEqualToString:call.method]) {
     [self refreshReceipt:call result:result];
+  } else if ([@"-[InAppPurchasePlugin currentEntitlements:result:]"
+                 isEqualToString:call.method]) {
+    [self getCurrentEntitlements:result];
   } else if ([@"-[SKPaymentQueue startObservingTransactionQueue]" isEqualToString:call.method]) {
     [self startObservingPaymentQueue:result];
   } else if ([@"-[SKPaymentQueue stopObservingTransactionQueue]" isEqualToString:call.method]) {
@@ -141,6 +219,10 @@
   result(transactionMaps);
 }
 
+- (void)getJournaledTransactions:(FlutterResult)result {
+  result([self.paymentQueueHandler getJournaledTransactions]);
+}
+
 - (void)getStorefront:(FlutterResult)result {
   if (@available(iOS 13.0, macOS 10.15, *)) {
     SKStorefront *storefront = self.paymentQueueHandler.storefront;
@@ -165,34 +247,143 @@
     return;
   }
   NSArray *productIdentifiers = (NSArray *)call.arguments;
-  SKProductsRequest *request =
-      [self getProductRequestWithIdentifiers:[NSSet setWithArray:productIdentifiers]];
+  [self invalidateProductMapsCacheIfStorefrontChanged];
+
+  NSMutableArray<NSDictionary *> *products = [NSMutableArray new];
+  NSMutableArray<NSString *> *invalidProductIdentifiers = [NSMutableArray new];
+  NSMutableSet<NSString *> *remainingIdentifiers = [NSMutableSet new];
+  NSMutableSet<NSString *> *identifiersToFetch = [NSMutableSet new];
+  for (NSString *identifier in [NSOrderedSet orderedSetWithArray:productIdentifiers]) {
+    NSDictionary *productMap = [self cachedProductMapForIdentifier:identifier];
+    if (productMap) {
+      [products addObject:productMap];
+      continue;
+    }
+    [remainingIdentifiers addObject:identifier];
+    if (!self.pendingProductCompletions[identifier]) {
+      self.pendingProductCompletions[identifier] = [NSMutableArray new];
+      [identifiersToFetch addObject:identifier];
+    }
+  }
+
+  if (remainingIdentifiers.count == 0) {
+    result(@{@"products" : products, @"invalidProductIdentifiers" : invalidProductIdentifiers});
+    return;
+  }
+
+  __block BOOL finished = NO;
+  for (NSString *identifier in remainingIdentifiers.allObjects) {
+    [self.pendingProductCompletions[identifier]
+        addObject:^(NSDictionary *_Nullable productMap, FlutterError *_Nullable error) {
+          if (finished) {
+            return;
+          }
+          if (error) {
+            finished = YES;
+            result(error);
+            return;
+          }
+          if (productMap) {
+            [products addObject:productMap];
+          } else {
+            [invalidProductIdentifiers addObject:identifier];
+          }
+          [remainingIdentifiers removeObject:identifier];
+          if (remainingIdentifiers.count == 0) {
+            finished = YES;
+            result(@{
+              @"products" : products,
+              @"invalidProductIdentifiers" : invalidProductIdentifiers
+            });
+          }
+        }];
+  }
+
+  if (identifiersToFetch.count > 0) {
+    [self startProductRequestWithIdentifiers:identifiersToFetch];
+  }
+}
+
+- (void)startProductRequestWithIdentifiers:(NSSet<NSString *> *)identifiers {
+  SKProductsRequest *request = [self getProductRequestWithIdentifiers:identifiers];
   FIAPRequestHandler *handler = [[FIAPRequestHandler alloc] initWithRequest:request];
   [self.requestHandlers addObject:handler];
   __weak typeof(self) weakSelf = self;
   [handler startProductRequestWithCompletionHandler:^(SKProductsResponse *_Nullable response,
                                                       NSError *_Nullable error) {
-    if (error) {
-      result([FlutterError errorWithCode:@"storekit_getproductrequest_platform_error"
-                                 message:error.localizedDescription
-                                 details:error.description]);
+    if (error || !response) {
+      FlutterError *flutterError =
+          error ? [FlutterError errorWithCode:@"storekit_getproductrequest_platform_error"
+                                      message:error.localizedDescription
+                                      details:error.description]
+                : [FlutterError errorWithCode:@"storekit_platform_no_response"
+                                      message:@"Failed to get SKProductResponse in startRequest "
+                                              @"call. Error occured on iOS platform"
+                                      details:identifiers.allObjects];
+      dispatch_async(dispatch_get_main_queue(), ^{
+        [self completeProductRequestWithIdentifiers:identifiers products:nil error:flutterError];
+        [weakSelf.requestHandlers removeObject:handler];
+      });
       return;
     }
-    if (!response) {
-      result([FlutterError errorWithCode:@"storekit_platform_no_response"
-                                 message:@"Failed to get SKProductResponse in startRequest "
-                                         @"call. Error occured on iOS platform"
-                                 details:call.arguments]);
-      return;
-    }
-    for (SKProduct *product in response.products) {
-      [self.productsCache setObject:product forKey:product.productIdentifier];
-    }
-    result([FIAObjectTranslator getMapFromSKProductsResponse:response]);
-    [weakSelf.requestHandlers removeObject:handler];
+    NSArray<SKProduct *> *responseProducts = response.products;
+    dispatch_async(self.productTranslationQueue, ^{
+      NSMutableDictionary<NSString *, NSDictionary *> *productMaps = [NSMutableDictionary new];
+      for (SKProduct *product in responseProducts) {
+        productMaps[product.productIdentifier] = [FIAObjectTranslator getMapFromSKProduct:product];
+      }
+      dispatch_async(dispatch_get_main_queue(), ^{
+        for (SKProduct *product in responseProducts) {
+          [self.productsCache setObject:product forKey:product.productIdentifier];
+        }
+        NSDate *now = [NSDate date];
+        for (NSString *identifier in productMaps) {
+          self.productMapsCache[identifier] = productMaps[identifier];
+          self.productMapsCacheDates[identifier] = now;
+        }
+        [self completeProductRequestWithIdentifiers:identifiers products:productMaps error:nil];
+        [weakSelf.requestHandlers removeObject:handler];
+      });
+    });
   }];
 }
 
+- (void)completeProductRequestWithIdentifiers:(NSSet<NSString *> *)identifiers
+                                     products:(NSDictionary<NSString *, NSDictionary *> *)products
+                                        error:(FlutterError *)error {
+  for (NSString *identifier in identifiers) {
+    NSArray<FIAProductDetailsCompletion> *completions = self.pendingProductCompletions[identifier];
+    [self.pendingProductCompletions removeObjectForKey:identifier];
+    for (FIAProductDetailsCompletion completion in completions) {
+      completion(products[identifier], error);
+    }
+  }
+}
+
+- (NSDictionary *)cachedProductMapForIdentifier:(NSString *)identifier {
+  NSDate *date = self.productMapsCacheDates[identifier];
+  if (!date || -[date timeIntervalSinceNow] > kProductDetailsCacheDuration) {
+    [self.productMapsCache removeObjectForKey:identifier];
+    [self.productMapsCacheDates removeObjectForKey:identifier];
+    return nil;
+  }
+  return self.productMapsCache[identifier];
+}
+
+- (void)invalidateProductMapsCacheIfStorefrontChanged {
+  NSString *storefrontIdentifier = nil;
+  if (@available(iOS 13.0, macOS 10.15, *)) {
+    storefrontIdentifier = self.paymentQueueHandler.storefront.identifier;
+  }
+  if (storefrontIdentifier == self.productMapsCacheStorefrontIdentifier ||
+      [storefrontIdentifier isEqualToString:self.productMapsCacheStorefrontIdentifier]) {
+    return;
+  }
+  [self.productMapsCache removeAllObjects];
+  [self.productMapsCacheDates removeAllObjects];
+  self.productMapsCacheStorefrontIdentifier = storefrontIdentifier;
+}
+
 - (void)addPayment:(FlutterMethodCall *)call result:(FlutterResult)result {
   if (![call.arguments isKindOfClass:[NSDictionary class]]) {
     result([FlutterError errorWithCode:@"storekit_invalid_argument"
@@ -322,6 +513,43 @@
   result(receiptData);
 }
 
+- (void)retrieveReceiptBytes:(FlutterMethodCall *)call result:(FlutterResult)result {
+  FlutterError *error = nil;
+  NSData *receipt = [self.receiptManager retrieveReceiptBytesWithError:&error];
+  if (error) {
+    result(error);
+    return;
+  }
+  // The typed data wraps the mapped receipt, which the codec then writes into the message,
+  // instead of going through a base64 encoded copy.
+  result(receipt ? [FlutterStandardTypedData typedDataWithBytes:receipt] : nil);
+}
+
+- (void)retrieveReceiptInfo:(FlutterMethodCall *)call result:(FlutterResult)result {
+  FlutterError *error = nil;
+  NSDictionary *receiptInfo = [self.receiptManager retrieveReceiptInfoWithError:&error];
+  if (error) {
+    result(error);
+    return;
+  }
+  result(receiptInfo);
+}
+
+- (void)getCurrentEntitlements:(FlutterResult)result {
+  if (@available(iOS 15.0, macOS 12.0, *)) {
+    [self.entitlementCache currentEntitlementsWithCompletion:^(
+                               NSArray<NSDictionary<NSString *, id> *> *entitlements) {
+      dispatch_async(dispatch_get_main_queue(), ^{
+        result(entitlements);
+      });
+    }];
+    return;
+  }
+
+  NSLog(@"StoreKit 2 entitlements are not available in iOS below 15.0 or macOS below 12.0.");
+  result(nil);
+}
+
 - (void)refreshReceipt:(FlutterMethodCall *)call result:(FlutterResult)result {
   NSDictionary *arguments = call.arguments;
   SKReceiptRefreshRequest *request;
@@ -407,31 +635,67 @@
 #pragma mark - transaction observer:
 
 - (void)handleTransactionsUpdated:(NSArray<SKPaymentTransaction *> *)transactions {
-  NSMutableArray *maps = [NSMutableArray new];
-  for (SKPaymentTransaction *transaction in transactions) {
-    [maps addObject:[FIAObjectTranslator getMapFromSKPaymentTransaction:transaction]];
+  if (self.pendingUpdatedTransactions.count == 0) {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [self flushPendingUpdatedTransactions];
+    });
   }
-  [self.transactionObserverCallbackChannel invokeMethod:@"updatedTransactions" arguments:maps];
+  [self.pendingUpdatedTransactions addObjectsFromArray:transactions];
 }
 
 - (void)handleTransactionsRemoved:(NSArray<SKPaymentTransaction *> *)transactions {
-  NSMutableArray *maps = [NSMutableArray new];
-  for (SKPaymentTransaction *transaction in transactions) {
-    [maps addObject:[FIAObjectTranslator getMapFromSKPaymentTransaction:transaction]];
-  }
-  [self.transactionObserverCallbackChannel invokeMethod:@"removedTransactions" arguments:maps];
+  [self flushPendingUpdatedTransactions];
+  [self sendTransactions:transactions toMethod:@"removedTransactions"];
 }
 
 - (void)handleTransactionRestoreFailed:(NSError *)error {
-  [self.transactionObserverCallbackChannel
-      invokeMethod:@"restoreCompletedTransactionsFailed"
-         arguments:[FIAObjectTranslator getMapFromNSError:error]];
+  [self invokeTransactionObserverMethod:@"restoreCompletedTransactionsFailed"
+                              arguments:[FIAObjectTranslator getMapFromNSError:error]];
 }
 
 - (void)restoreCompletedTransactionsFinished {
-  [self.transactionObserverCallbackChannel
-      invokeMethod:@"paymentQueueRestoreCompletedTransactionsFinished"
-         arguments:nil];
+  [self invokeTransactionObserverMethod:@"paymentQueueRestoreCompletedTransactionsFinished"
+                              arguments:nil];
+}
+
+- (void)flushPendingUpdatedTransactions {
+  if (self.pendingUpdatedTransactions.count == 0) {
+    return;
+  }
+  NSArray<SKPaymentTransaction *> *transactions = [self.pendingUpdatedTransactions copy];
+  [self.pendingUpdatedTransactions removeAllObjects];
+  [self sendTransactions:transactions toMethod:@"updatedTransactions"];
+}
+
+// Translates the transactions on the transaction translation queue and sends them to dart in
+// pages of at most kTransactionCallbackPageSize transactions.
+- (void)sendTransactions:(NSArray<SKPaymentTransaction *> *)transactions
+                toMethod:(NSString *)method {
+  FlutterMethodChannel *channel = self.transactionObserverCallbackChannel;
+  dispatch_async(self.transactionTranslationQueue, ^{
+    for (NSUInteger start = 0; start < transactions.count; start += kTransactionCallbackPageSize) {
+      NSUInteger length = MIN(kTransactionCallbackPageSize, transactions.count - start);
+      NSMutableArray *maps = [NSMutableArray arrayWithCapacity:length];
+      for (SKPaymentTransaction *transaction in
+           [transactions subarrayWithRange:NSMakeRange(start, length)]) {
+        [maps addObject:[FIAObjectTranslator getMapFromSKPaymentTransaction:transaction]];
+      }
+      dispatch_async(dispatch_get_main_queue(), ^{
+        [channel invokeMethod:method arguments:maps];
+      });
+    }
+  });
+}
+
+// Sends a transaction observer callback to dart after any transactions received before it.
+- (void)invokeTransactionObserverMethod:(NSString *)method arguments:(id)arguments {
+  [self flushPendingUpdatedTransactions];
+  FlutterMethodChannel *channel = self.transactionObserverCallbackChannel;
+  dispatch_async(self.transactionTranslationQueue, ^{
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [channel invokeMethod:method arguments:arguments];
+    });
+  });
 }
 
 - (void)updatedDownloads:(NSArray<SKDownload *> *)downloads {
@@ -443,12 +707,11 @@
   // have a interception method that deciding if the payment should be processed (implemented by the
   // programmer).
   [self.productsCache setObject:product forKey:product.productIdentifier];
-  [self.transactionObserverCallbackChannel
-      invokeMethod:@"shouldAddStorePayment"
-         arguments:@{
-           @"payment" : [FIAObjectTranslator getMapFromSKPayment:payment],
-           @"product" : [FIAObjectTranslator getMapFromSKProduct:product]
-         }];
+  [self invokeTransactionObserverMethod:@"shouldAddStorePayment"
+                              arguments:@{
+                                @"payment" : [FIAObjectTranslator getMapFromSKPayment:payment],
+                                @"product" : [FIAObjectTranslator getMapFromSKProduct:product]
+                              }];
   return NO;
 }
 
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #import <XCTest/XCTest.h>
+#import "Stubs.h"
 
 @import in_app_purchase_storekit;
 
@@ -60,4 +61,74 @@
   XCTAssertNil([cache getObjectsForKey:TransactionCacheKeyRemovedTransactions]);
   XCTAssertNil([cache getObjectsForKey:TransactionCacheKeyUpdatedDownloads]);
 }
+
+// Returns a journal file URL in a fresh temporary directory.
+- (NSURL *)temporaryJournalURL {
+  NSURL *directory = [[NSURL fileURLWithPath:NSTemporaryDirectory()]
+      URLByAppendingPathComponent:[NSUUID UUID].UUIDString];
+  [self addTeardownBlock:^{
+    [[NSFileManager defaultManager] removeItemAtURL:directory error:nil];
+  }];
+  return [directory URLByAppendingPathComponent:@"journal.plist"];
+}
+
+- (void)testJournalSurvivesRelaunch {
+  NSURL *journalURL = [self temporaryJournalURL];
+  SKMutablePayment *payment = [[SKMutablePayment alloc] init];
+  payment.productIdentifier = @"product";
+  SKPaymentTransaction *purchased =
+      [[SKPaymentTransactionStub alloc] initWithState:SKPaymentTransactionStatePurchased
+                                              payment:payment];
+  SKPaymentTransaction *purchasing =
+      [[SKPaymentTransactionStub alloc] initWithState:SKPaymentTransactionStatePurchasing];
+
+  FIATransactionCache *cache = [[FIATransactionCache alloc] initWithJournalURL:journalURL];
+  [cache journalTransactions:@[ purchased, purchasing ]];
+  [cache clear];
+  [cache flushJournal];
+
+  FIATransactionCache *relaunchedCache =
+      [[FIATransactionCache alloc] initWithJournalURL:journalURL];
+  NSArray<NSDictionary *> *entries = [relaunchedCache getJournaledTransactions];
+  XCTAssertEqual(entries.count, 1);
+  XCTAssertEqualObjects(entries[0][@"transactionIdentifier"], @"fakeID");
+  XCTAssertEqualObjects(entries[0][@"productIdentifier"], @"product");
+  XCTAssertEqualObjects(entries[0][@"transactionState"], @(SKPaymentTransactionStatePurchased));
+}
+
+- (void)testRemovingFinishedTransactionsFromJournal {
+  NSURL *journalURL = [self temporaryJournalURL];
+  SKPaymentTransaction *first = [[SKPaymentTransactionStub alloc] initWithMap:@{
+    @"transactionIdentifier" : @"first",
+    @"transactionState" : @(SKPaymentTransactionStatePurchased),
+    @"transactionTimeStamp" : @1,
+  }];
+  SKPaymentTransaction *second = [[SKPaymentTransactionStub alloc] initWithMap:@{
+    @"transactionIdentifier" : @"second",
+    @"transactionState" : @(SKPaymentTransactionStateRestored),
+    @"transactionTimeStamp" : @2,
+  }];
+
+  FIATransactionCache *cache = [[FIATransactionCache alloc] initWithJournalURL:journalURL];
+  [cache journalTransactions:@[ second, first ]];
+  NSArray<NSDictionary *> *entries = [cache getJournaledTransactions];
+  XCTAssertEqualObjects(entries[0][@"transactionIdentifier"], @"first");
+  XCTAssertEqualObjects(entries[1][@"transactionIdentifier"], @"second");
+
+  [cache removeJournaledTransactions:@[ first ]];
+  [cache flushJournal];
+
+  FIATransactionCache *relaunchedCache =
+      [[FIATransactionCache alloc] initWithJournalURL:journalURL];
+  entries = [relaunchedCache getJournaledTransactions];
+  XCTAssertEqual(entries.count, 1);
+  XCTAssertEqualObjects(entries[0][@"transactionIdentifier"], @"second");
+}
+
+- (void)testJournalWithoutURLIsInMemory {
+  FIATransactionCache *cache = [[FIATransactionCache alloc] init];
+  [cache journalTransactions:@[ [[SKPaymentTransactionStub alloc]
+                                 initWithState:SKPaymentTransactionStatePurchased] ]];
+  XCTAssertEqual([cache getJournaledTransactions].count, 1);
+}
 @end
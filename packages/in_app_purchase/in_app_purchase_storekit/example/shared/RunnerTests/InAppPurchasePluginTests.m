@@ -9,6 +9,12 @@
 
 @import in_app_purchase_storekit;
 
+@interface InAppPurchasePlugin (Test)
+- (void)handleTransactionsUpdated:(NSArray<SKPaymentTransaction *> *)transactions;
+- (void)handleTransactionsRemoved:(NSArray<SKPaymentTransaction *> *)transactions;
+- (void)restoreCompletedTransactionsFinished;
+@end
+
 @interface InAppPurchasePluginTest : XCTestCase
 
 @property(strong, nonatomic) FIAPReceiptManagerStub *receiptManagerStub;
@@ -74,6 +80,97 @@
   XCTAssertTrue([resultArray.firstObject[@"productIdentifier"] isEqualToString:@"123"]);
 }
 
+- (void)testGetProductResponseMergesOverlappingRequests {
+  InAppPurchasePluginStub *plugin = (InAppPurchasePluginStub *)self.plugin;
+  XCTestExpectation *firstExpectation = [self expectationWithDescription:@"first request"];
+  XCTestExpectation *secondExpectation = [self expectationWithDescription:@"second request"];
+  __block NSDictionary *firstResult;
+  __block NSDictionary *secondResult;
+  [plugin handleMethodCall:[FlutterMethodCall
+                               methodCallWithMethodName:
+                                   @"-[InAppPurchasePlugin startProductRequest:result:]"
+                                              arguments:@[ @"123", @"456" ]]
+                    result:^(id r) {
+                      firstResult = r;
+                      [firstExpectation fulfill];
+                    }];
+  [plugin handleMethodCall:[FlutterMethodCall
+                               methodCallWithMethodName:
+                                   @"-[InAppPurchasePlugin startProductRequest:result:]"
+                                              arguments:@[ @"456", @"789" ]]
+                    result:^(id r) {
+                      secondResult = r;
+                      [secondExpectation fulfill];
+                    }];
+  [self waitForExpectations:@[ firstExpectation, secondExpectation ] timeout:5];
+
+  // "456" is already being fetched by the first request, so the second one only asks for "789".
+  XCTAssertEqual(plugin.requestedProductIdentifiers.count, 2);
+  XCTAssertEqualObjects(plugin.requestedProductIdentifiers[0],
+                        ([NSSet setWithArray:@[ @"123", @"456" ]]));
+  XCTAssertEqualObjects(plugin.requestedProductIdentifiers[1], [NSSet setWithObject:@"789"]);
+  XCTAssertEqualObjects([NSSet setWithArray:[firstResult[@"products"]
+                                                valueForKey:@"productIdentifier"]],
+                        ([NSSet setWithArray:@[ @"123", @"456" ]]));
+  XCTAssertEqualObjects([NSSet setWithArray:[secondResult[@"products"]
+                                                valueForKey:@"productIdentifier"]],
+                        ([NSSet setWithArray:@[ @"456", @"789" ]]));
+  XCTAssertEqualObjects(secondResult[@"invalidProductIdentifiers"], @[]);
+}
+
+- (void)testGetProductResponseReturnsCachedProducts {
+  InAppPurchasePluginStub *plugin = (InAppPurchasePluginStub *)self.plugin;
+  FlutterMethodCall *call = [FlutterMethodCall
+      methodCallWithMethodName:@"-[InAppPurchasePlugin startProductRequest:result:]"
+                     arguments:@[ @"123" ]];
+  XCTestExpectation *firstExpectation = [self expectationWithDescription:@"first request"];
+  [plugin handleMethodCall:call
+                    result:^(id r) {
+                      [firstExpectation fulfill];
+                    }];
+  [self waitForExpectations:@[ firstExpectation ] timeout:5];
+
+  XCTestExpectation *secondExpectation = [self expectationWithDescription:@"second request"];
+  __block NSDictionary *result;
+  [plugin handleMethodCall:call
+                    result:^(id r) {
+                      result = r;
+                      [secondExpectation fulfill];
+                    }];
+  [self waitForExpectations:@[ secondExpectation ] timeout:5];
+
+  XCTAssertEqual(plugin.requestedProductIdentifiers.count, 1);
+  NSArray *products = result[@"products"];
+  XCTAssertEqual(products.count, 1);
+  XCTAssertEqualObjects(products.firstObject[@"productIdentifier"], @"123");
+}
+
+- (void)testGetProductResponseRefetchesWhenStorefrontChanges {
+  if (@available(iOS 13, macOS 10.15, *)) {
+    InAppPurchasePluginStub *plugin = (InAppPurchasePluginStub *)self.plugin;
+    FlutterMethodCall *call = [FlutterMethodCall
+        methodCallWithMethodName:@"-[InAppPurchasePlugin startProductRequest:result:]"
+                       arguments:@[ @"123" ]];
+    for (NSString *countryCode in @[ @"USA", @"USA", @"CAN" ]) {
+      FIAPaymentQueueHandler *mockHandler = OCMClassMock(FIAPaymentQueueHandler.class);
+      OCMStub(mockHandler.storefront)
+          .andReturn([[SKStorefrontStub alloc]
+              initWithMap:@{@"countryCode" : countryCode, @"identifier" : countryCode}]);
+      plugin.paymentQueueHandler = mockHandler;
+      XCTestExpectation *expectation = [self expectationWithDescription:countryCode];
+      [plugin handleMethodCall:call
+                        result:^(id r) {
+                          [expectation fulfill];
+                        }];
+      [self waitForExpectations:@[ expectation ] timeout:5];
+    }
+    XCTAssertEqual(plugin.requestedProductIdentifiers.count, 2);
+  } else {
+    NSLog(@"Skip testGetProductResponseRefetchesWhenStorefrontChanges for iOS lower than 13.0 "
+          @"or macOS lower than 10.15.");
+  }
+}
+
 - (void)testAddPaymentShouldReturnFlutterErrorWhenArgumentsAreInvalid {
   XCTestExpectation *expectation =
       [self expectationWithDescription:
@@ -351,6 +448,79 @@
   XCTAssertEqual(errorCode, [NSNumber numberWithInteger:99]);
 }
 
+- (void)testRetrieveReceiptBytesSuccess {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"receipt bytes retrieved"];
+  FlutterMethodCall *call = [FlutterMethodCall
+      methodCallWithMethodName:@"-[InAppPurchasePlugin retrieveReceiptBytes:result:]"
+                     arguments:nil];
+  __block id result;
+  [self.plugin handleMethodCall:call
+                         result:^(id r) {
+                           result = r;
+                           [expectation fulfill];
+                         }];
+  [self waitForExpectations:@[ expectation ] timeout:5];
+  XCTAssert([result isKindOfClass:[FlutterStandardTypedData class]]);
+  FlutterStandardTypedData *typedData = result;
+  XCTAssertEqual(typedData.type, FlutterStandardDataTypeUInt8);
+  XCTAssertEqualObjects(typedData.data,
+                        [[NSData alloc] initWithBase64EncodedString:@"test" options:kNilOptions]);
+}
+
+- (void)testRetrieveReceiptInfoSuccess {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"receipt info retrieved"];
+  FlutterMethodCall *call = [FlutterMethodCall
+      methodCallWithMethodName:@"-[InAppPurchasePlugin retrieveReceiptInfo:result:]"
+                     arguments:nil];
+  __block NSDictionary *result;
+  [self.plugin handleMethodCall:call
+                         result:^(id r) {
+                           result = r;
+                           [expectation fulfill];
+                         }];
+  [self waitForExpectations:@[ expectation ] timeout:5];
+  XCTAssertEqualObjects(result[@"size"], @3);
+  XCTAssertEqualObjects(result[@"sha256"],
+                        @"6617aa88a72e6b526b88cbceda388a7b52a0e856148a12d9b8429cd2a53a3ea4");
+}
+
+- (void)testRetrieveReceiptInfoError {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"receipt info error"];
+  FlutterMethodCall *call = [FlutterMethodCall
+      methodCallWithMethodName:@"-[InAppPurchasePlugin retrieveReceiptInfo:result:]"
+                     arguments:nil];
+  __block id result;
+  self.receiptManagerStub.returnError = YES;
+  [self.plugin handleMethodCall:call
+                         result:^(id r) {
+                           result = r;
+                           [expectation fulfill];
+                         }];
+  [self waitForExpectations:@[ expectation ] timeout:5];
+  XCTAssert([result isKindOfClass:[FlutterError class]]);
+}
+
+- (void)testCurrentEntitlements {
+  XCTestExpectation *expectation = [self expectationWithDescription:@"entitlements retrieved"];
+  FlutterMethodCall *call = [FlutterMethodCall
+      methodCallWithMethodName:@"-[InAppPurchasePlugin currentEntitlements:result:]"
+                     arguments:nil];
+  __block id result;
+  [self.plugin handleMethodCall:call
+                         result:^(id r) {
+                           XCTAssertTrue([NSThread isMainThread]);
+                           result = r;
+                           [expectation fulfill];
+                         }];
+  [self waitForExpectations:@[ expectation ] timeout:5];
+  if (@available(iOS 15.0, macOS 12.0, *)) {
+    // The test host has no purchases, but StoreKit 2 is available.
+    XCTAssert([result isKindOfClass:[NSArray class]]);
+  } else {
+    XCTAssertNil(result);
+  }
+}
+
 - (void)testRefreshReceiptRequest {
   XCTestExpectation *expectation = [self expectationWithDescription:@"expect success"];
   FlutterMethodCall *call =
@@ -603,4 +773,67 @@
 }
 #endif
 
+- (NSArray<SKPaymentTransaction *> *)purchasedTransactionsWithCount:(NSUInteger)count {
+  SKPayment *payment =
+      [SKPayment paymentWithProduct:[[SKProductStub alloc] initWithProductID:@"123"]];
+  NSMutableArray *transactions = [NSMutableArray new];
+  for (NSUInteger i = 0; i < count; i++) {
+    [transactions addObject:[[SKPaymentTransactionStub alloc]
+                                initWithState:SKPaymentTransactionStatePurchased
+                                      payment:payment]];
+  }
+  return transactions;
+}
+
+- (void)testTransactionUpdatesAreCoalescedInOrder {
+  FlutterMethodChannel *mockChannel = OCMClassMock(FlutterMethodChannel.class);
+  [self.plugin setValue:mockChannel forKey:@"transactionObserverCallbackChannel"];
+  NSMutableArray<NSString *> *methods = [NSMutableArray new];
+  NSMutableArray<NSNumber *> *counts = [NSMutableArray new];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"expect callbacks"];
+  expectation.expectedFulfillmentCount = 3;
+  OCMStub([mockChannel invokeMethod:[OCMArg any] arguments:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        __unsafe_unretained NSString *method;
+        __unsafe_unretained NSArray *arguments;
+        [invocation getArgument:&method atIndex:2];
+        [invocation getArgument:&arguments atIndex:3];
+        [methods addObject:method];
+        [counts addObject:@(arguments.count)];
+        [expectation fulfill];
+      });
+
+  [self.plugin handleTransactionsUpdated:[self purchasedTransactionsWithCount:1]];
+  [self.plugin handleTransactionsUpdated:[self purchasedTransactionsWithCount:2]];
+  [self.plugin handleTransactionsRemoved:[self purchasedTransactionsWithCount:1]];
+  [self.plugin restoreCompletedTransactionsFinished];
+  [self waitForExpectations:@[ expectation ] timeout:5];
+
+  XCTAssertEqualObjects(methods, (@[
+                          @"updatedTransactions", @"removedTransactions",
+                          @"paymentQueueRestoreCompletedTransactionsFinished"
+                        ]));
+  XCTAssertEqualObjects(counts, (@[ @3, @1, @0 ]));
+}
+
+- (void)testTransactionUpdatesAreSentInPages {
+  FlutterMethodChannel *mockChannel = OCMClassMock(FlutterMethodChannel.class);
+  [self.plugin setValue:mockChannel forKey:@"transactionObserverCallbackChannel"];
+  NSMutableArray<NSNumber *> *counts = [NSMutableArray new];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"expect callbacks"];
+  expectation.expectedFulfillmentCount = 3;
+  OCMStub([mockChannel invokeMethod:@"updatedTransactions" arguments:[OCMArg any]])
+      .andDo(^(NSInvocation *invocation) {
+        __unsafe_unretained NSArray *arguments;
+        [invocation getArgument:&arguments atIndex:3];
+        [counts addObject:@(arguments.count)];
+        [expectation fulfill];
+      });
+
+  [self.plugin handleTransactionsUpdated:[self purchasedTransactionsWithCount:250]];
+  [self waitForExpectations:@[ expectation ] timeout:5];
+
+  XCTAssertEqualObjects(counts, (@[ @100, @100, @50 ]));
+}
+
 @end
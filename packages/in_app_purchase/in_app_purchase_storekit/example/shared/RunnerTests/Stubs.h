@@ -20,6 +20,7 @@ API_AVAILABLE(ios(11.2), macos(10.13.2))
 
 @interface SKProductStub : SKProduct
 - (instancetype)initWithMap:(NSDictionary *)map;
+- (instancetype)initWithProductID:(NSString *)productIdentifier;
 @end
 
 @interface SKProductRequestStub : SKProductsRequest
@@ -32,6 +33,8 @@ API_AVAILABLE(ios(11.2), macos(10.13.2))
 @end
 
 @interface InAppPurchasePluginStub : InAppPurchasePlugin
+// The identifier sets of every product request started by the plugin, in order.
+@property(strong, nonatomic, readonly) NSMutableArray<NSSet *> *requestedProductIdentifiers;
 @end
 
 @interface SKPaymentQueueStub : SKPaymentQueue
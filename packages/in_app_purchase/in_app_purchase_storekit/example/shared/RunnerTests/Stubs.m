@@ -147,7 +147,14 @@
 
 @implementation InAppPurchasePluginStub
 
+- (instancetype)initWithReceiptManager:(FIAPReceiptManager *)receiptManager {
+  self = [super initWithReceiptManager:receiptManager];
+  _requestedProductIdentifiers = [NSMutableArray new];
+  return self;
+}
+
 - (SKProductRequestStub *)getProductRequestWithIdentifiers:(NSSet *)identifiers {
+  [self.requestedProductIdentifiers addObject:identifiers];
   return [[SKProductRequestStub alloc] initWithProductIdentifiers:identifiers];
 }
 
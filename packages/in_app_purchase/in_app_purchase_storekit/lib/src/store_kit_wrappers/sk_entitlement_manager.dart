@@ -0,0 +1,181 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'dart:async';
+
+import 'package:flutter/foundation.dart';
+
+import '../channel.dart';
+
+// ignore: avoid_classes_with_only_static_members
+/// This class contains static methods to check the user's entitlements using
+/// StoreKit 2.
+class SKEntitlementManager {
+  /// Returns the transactions that currently entitle the user to a product,
+  /// from StoreKit 2's [`Transaction.currentEntitlements`](https://developer.apple.com/documentation/storekit/transaction/3851204-currententitlements).
+  ///
+  /// StoreKit verifies each transaction's signature on the device, so unlike
+  /// validating the receipt from [SKReceiptManager.retrieveReceiptData] with a
+  /// server, this needs no network access. The plugin loads the entitlements
+  /// when it is registered and reloads them as transactions are updated, so
+  /// they are usually returned without waiting on StoreKit. Features should
+  /// only be unlocked for entitlements that are
+  /// [SKEntitlementWrapper.isVerified].
+  ///
+  /// Returns null if StoreKit 2 is not available, which is the case before
+  /// iOS 15 and macOS 12.
+  static Future<List<SKEntitlementWrapper>?> currentEntitlements() async {
+    final List<Map<dynamic, dynamic>>? maps =
+        await channel.invokeListMethod<Map<dynamic, dynamic>>(
+            '-[InAppPurchasePlugin currentEntitlements:result:]');
+    return maps
+        ?.map((Map<dynamic, dynamic> map) => SKEntitlementWrapper.fromMap(map))
+        .toList();
+  }
+}
+
+/// The type of product an entitlement is for.
+enum SKEntitlementProductType {
+  /// A product that can be purchased repeatedly.
+  consumable,
+
+  /// A product that is purchased once and does not expire.
+  nonConsumable,
+
+  /// A subscription that does not renew automatically.
+  nonRenewingSubscription,
+
+  /// A subscription that renews automatically.
+  autoRenewableSubscription,
+}
+
+/// How the user obtained an entitlement.
+enum SKEntitlementOwnershipType {
+  /// The user purchased the product.
+  purchased,
+
+  /// A family member shared the product with the user through Family
+  /// Sharing.
+  familyShared,
+}
+
+/// A transaction that entitles the user to a product, as reported by
+/// StoreKit 2.
+///
+/// See [SKEntitlementManager.currentEntitlements].
+@immutable
+class SKEntitlementWrapper {
+  /// Creates a new [SKEntitlementWrapper] with the provided information.
+  const SKEntitlementWrapper({
+    required this.productIdentifier,
+    required this.transactionIdentifier,
+    required this.originalTransactionIdentifier,
+    required this.productType,
+    required this.ownershipType,
+    required this.purchaseDate,
+    this.expirationDate,
+    required this.isUpgraded,
+    required this.isVerified,
+    this.verificationError,
+    required this.jwsRepresentation,
+  });
+
+  /// Constructs an instance of this from a key-value map of data.
+  ///
+  /// The map needs to have named string keys with values matching the names
+  /// and types of all of the members on this class.
+  factory SKEntitlementWrapper.fromMap(Map<dynamic, dynamic> map) {
+    return SKEntitlementWrapper(
+      productIdentifier: map['productIdentifier'] as String,
+      transactionIdentifier: map['transactionIdentifier'] as String,
+      originalTransactionIdentifier:
+          map['originalTransactionIdentifier'] as String,
+      productType: SKEntitlementProductType.values[map['productType'] as int],
+      ownershipType:
+          SKEntitlementOwnershipType.values[map['ownershipType'] as int],
+      purchaseDate: (map['purchaseDate'] as num).toDouble(),
+      expirationDate: (map['expirationDate'] as num?)?.toDouble(),
+      isUpgraded: map['isUpgraded'] as bool,
+      isVerified: map['isVerified'] as bool,
+      verificationError: map['verificationError'] as String?,
+      jwsRepresentation: map['jwsRepresentation'] as String,
+    );
+  }
+
+  /// The identifier of the product the user is entitled to.
+  final String productIdentifier;
+
+  /// The identifier of the transaction.
+  final String transactionIdentifier;
+
+  /// The identifier of the original purchase, which is shared by the renewals
+  /// of a subscription and by restored purchases.
+  final String originalTransactionIdentifier;
+
+  /// The type of the product.
+  final SKEntitlementProductType productType;
+
+  /// How the user obtained the product.
+  final SKEntitlementOwnershipType ownershipType;
+
+  /// The date of the purchase, or of the latest renewal of a subscription, in
+  /// seconds since 1970.
+  final double purchaseDate;
+
+  /// The date a subscription expires, in seconds since 1970, or null for
+  /// products that don't expire.
+  final double? expirationDate;
+
+  /// Whether the user upgraded to a higher level subscription in the same
+  /// group as this one.
+  final bool isUpgraded;
+
+  /// Whether StoreKit verified on the device that the transaction was signed
+  /// by the App Store for this app and device.
+  final bool isVerified;
+
+  /// A description of why verification failed, or null if the transaction is
+  /// [isVerified].
+  final String? verificationError;
+
+  /// The signed transaction in JWS format, for apps that also verify it with
+  /// their own server.
+  final String jwsRepresentation;
+
+  @override
+  bool operator ==(Object other) {
+    if (identical(other, this)) {
+      return true;
+    }
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is SKEntitlementWrapper &&
+        other.productIdentifier == productIdentifier &&
+        other.transactionIdentifier == transactionIdentifier &&
+        other.originalTransactionIdentifier == originalTransactionIdentifier &&
+        other.productType == productType &&
+        other.ownershipType == ownershipType &&
+        other.purchaseDate == purchaseDate &&
+        other.expirationDate == expirationDate &&
+        other.isUpgraded == isUpgraded &&
+        other.isVerified == isVerified &&
+        other.verificationError == verificationError &&
+        other.jwsRepresentation == jwsRepresentation;
+  }
+
+  @override
+  int get hashCode => Object.hash(
+      productIdentifier,
+      transactionIdentifier,
+      originalTransactionIdentifier,
+      productType,
+      ownershipType,
+      purchaseDate,
+      expirationDate,
+      isUpgraded,
+      isVerified,
+      verificationError,
+      jwsRepresentation);
+}
@@ -12,6 +12,7 @@ import 'package:json_annotation/json_annotation.dart';
 import '../../store_kit_wrappers.dart';
 import '../channel.dart';
 import '../in_app_purchase_storekit_platform.dart';
+import 'enum_converters.dart';
 
 part 'sk_payment_queue_wrapper.g.dart';
 
@@ -59,6 +60,26 @@ class SKPaymentQueueWrapper {
         .invokeListMethod<dynamic>('-[SKPaymentQueue transactions]'))!);
   }
 
+  /// Returns the unfinished transactions the plugin has recorded on disk,
+  /// including those from previous launches of the app.
+  ///
+  /// Unlike [transactions], this does not depend on StoreKit re-delivering
+  /// unfinished transactions after launch, so an app can grant entitlements
+  /// for them immediately. Only transactions with a
+  /// [SKPaymentTransactionWrapper.transactionIdentifier] are recorded, and
+  /// they are removed once finished with [finishTransaction]. They should
+  /// still be finished once StoreKit delivers them to the
+  /// [SKTransactionObserverWrapper].
+  Future<List<SKJournaledTransactionWrapper>> journaledTransactions() async {
+    final List<Map<dynamic, dynamic>>? maps =
+        await channel.invokeListMethod<Map<dynamic, dynamic>>(
+            '-[InAppPurchasePlugin journaledTransactions:result:]');
+    return (maps ?? <Map<dynamic, dynamic>>[])
+        .map((Map<dynamic, dynamic> map) =>
+            SKJournaledTransactionWrapper.fromMap(map))
+        .toList();
+  }
+
   /// Calls [`-[SKPaymentQueue canMakePayments:]`](https://developer.apple.com/documentation/storekit/skpaymentqueue/1506139-canmakepayments?language=objc).
   static Future<bool> canMakePayments() async =>
       (await channel
@@ -326,6 +347,67 @@ class SKPaymentQueueWrapper {
   }
 }
 
+/// An unfinished transaction recorded on disk by the plugin.
+///
+/// See [SKPaymentQueueWrapper.journaledTransactions].
+@immutable
+class SKJournaledTransactionWrapper {
+  /// Creates a new [SKJournaledTransactionWrapper] with the provided
+  /// information.
+  const SKJournaledTransactionWrapper({
+    required this.transactionIdentifier,
+    required this.productIdentifier,
+    required this.transactionState,
+    required this.transactionTimeStamp,
+  });
+
+  /// Constructs an instance of this from a key-value map of data.
+  ///
+  /// The map needs to have named string keys with values matching the names
+  /// and types of all of the members on this class.
+  factory SKJournaledTransactionWrapper.fromMap(Map<dynamic, dynamic> map) {
+    return SKJournaledTransactionWrapper(
+      transactionIdentifier: map['transactionIdentifier'] as String,
+      productIdentifier: map['productIdentifier'] as String,
+      transactionState: const SKTransactionStatusConverter()
+          .fromJson(map['transactionState'] as int?),
+      transactionTimeStamp: (map['transactionTimeStamp'] as num).toDouble(),
+    );
+  }
+
+  /// The [SKPaymentTransactionWrapper.transactionIdentifier] of the
+  /// transaction.
+  final String transactionIdentifier;
+
+  /// The [SKPaymentWrapper.productIdentifier] of the transaction's payment.
+  final String productIdentifier;
+
+  /// The last state of the transaction that was recorded.
+  final SKPaymentTransactionStateWrapper transactionState;
+
+  /// The date of the transaction, in seconds since 1970.
+  final double transactionTimeStamp;
+
+  @override
+  bool operator ==(Object other) {
+    if (identical(other, this)) {
+      return true;
+    }
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is SKJournaledTransactionWrapper &&
+        other.transactionIdentifier == transactionIdentifier &&
+        other.productIdentifier == productIdentifier &&
+        other.transactionState == transactionState &&
+        other.transactionTimeStamp == transactionTimeStamp;
+  }
+
+  @override
+  int get hashCode => Object.hash(transactionIdentifier, productIdentifier,
+      transactionState, transactionTimeStamp);
+}
+
 /// Dart wrapper around StoreKit's
 /// [NSError](https://developer.apple.com/documentation/foundation/nserror?language=objc).
 @immutable
@@ -4,6 +4,8 @@
 
 import 'dart:async';
 
+import 'package:flutter/foundation.dart';
+
 import '../channel.dart';
 
 // ignore: avoid_classes_with_only_static_members
@@ -21,4 +23,61 @@ class SKReceiptManager {
             '-[InAppPurchasePlugin retrieveReceiptData:result:]')) ??
         '';
   }
+
+  /// Retrieve the raw bytes of the receipt in your application's main bundle,
+  /// or null if there is no receipt.
+  ///
+  /// This is the receipt returned by [retrieveReceiptData] without the base64
+  /// encoding, which is a third larger and has to be decoded again before the
+  /// receipt can be uploaded as binary data.
+  static Future<Uint8List?> retrieveReceiptBytes() {
+    return channel.invokeMethod<Uint8List>(
+        '-[InAppPurchasePlugin retrieveReceiptBytes:result:]');
+  }
+
+  /// Retrieve the size and hash of the receipt in your application's main
+  /// bundle, or null if there is no receipt.
+  ///
+  /// Comparing them with those of the last receipt the app uploaded lets it
+  /// skip retrieving and uploading a receipt that has not changed.
+  static Future<SKReceiptInfo?> retrieveReceiptInfo() async {
+    final Map<String, dynamic>? map = await channel.invokeMapMethod<String,
+        dynamic>('-[InAppPurchasePlugin retrieveReceiptInfo:result:]');
+    if (map == null) {
+      return null;
+    }
+    return SKReceiptInfo(
+      size: map['size'] as int,
+      sha256: map['sha256'] as String,
+    );
+  }
+}
+
+/// The size and hash of a receipt, which identify its contents.
+@immutable
+class SKReceiptInfo {
+  /// Creates a new [SKReceiptInfo] with the provided information.
+  const SKReceiptInfo({required this.size, required this.sha256});
+
+  /// The size of the receipt in bytes.
+  final int size;
+
+  /// The SHA-256 hash of the receipt, as a lowercase hex string.
+  final String sha256;
+
+  @override
+  bool operator ==(Object other) {
+    if (identical(other, this)) {
+      return true;
+    }
+    if (other.runtimeType != runtimeType) {
+      return false;
+    }
+    return other is SKReceiptInfo &&
+        other.size == size &&
+        other.sha256 == sha256;
+  }
+
+  @override
+  int get hashCode => Object.hash(size, sha256);
 }
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+export 'src/store_kit_wrappers/sk_entitlement_manager.dart';
 export 'src/store_kit_wrappers/sk_payment_queue_delegate_wrapper.dart';
 export 'src/store_kit_wrappers/sk_payment_queue_wrapper.dart';
 export 'src/store_kit_wrappers/sk_payment_transaction_wrappers.dart';
@@ -95,6 +95,60 @@ void main() {
       final String receiptData = await SKReceiptManager.retrieveReceiptData();
       expect(receiptData, 'receipt data');
     });
+
+    test('should get receipt bytes', () async {
+      final Uint8List? receiptBytes =
+          await SKReceiptManager.retrieveReceiptBytes();
+      expect(receiptBytes, <int>[1, 2, 3]);
+    });
+
+    test('should get receipt info', () async {
+      final SKReceiptInfo? receiptInfo =
+          await SKReceiptManager.retrieveReceiptInfo();
+      expect(receiptInfo, const SKReceiptInfo(size: 3, sha256: 'abc123'));
+    });
+
+    test('should get null receipt info if there is no receipt', () async {
+      fakeStoreKitPlatform.testReturnNull = true;
+      expect(await SKReceiptManager.retrieveReceiptInfo(), isNull);
+    });
+  });
+
+  group('sk_entitlement_manager', () {
+    test('should get current entitlements', () async {
+      expect(await SKEntitlementManager.currentEntitlements(),
+          const <SKEntitlementWrapper>[
+            SKEntitlementWrapper(
+              productIdentifier: 'premium',
+              transactionIdentifier: '2000000123',
+              originalTransactionIdentifier: '2000000100',
+              productType: SKEntitlementProductType.autoRenewableSubscription,
+              ownershipType: SKEntitlementOwnershipType.familyShared,
+              purchaseDate: 1231231231.00,
+              expirationDate: 1233823231.00,
+              isUpgraded: false,
+              isVerified: true,
+              jwsRepresentation: 'header.payload.signature',
+            ),
+            SKEntitlementWrapper(
+              productIdentifier: 'lifetime',
+              transactionIdentifier: '2000000124',
+              originalTransactionIdentifier: '2000000124',
+              productType: SKEntitlementProductType.nonConsumable,
+              ownershipType: SKEntitlementOwnershipType.purchased,
+              purchaseDate: 1231231231.00,
+              isUpgraded: false,
+              isVerified: false,
+              verificationError: 'invalid signature',
+              jwsRepresentation: 'header.payload.signature',
+            ),
+          ]);
+    });
+
+    test('should get null entitlements without StoreKit 2', () async {
+      fakeStoreKitPlatform.testReturnNull = true;
+      expect(await SKEntitlementManager.currentEntitlements(), isNull);
+    });
   });
 
   group('sk_payment_queue', () {
@@ -128,6 +182,19 @@ void main() {
       expect(await SKPaymentQueueWrapper().transactions(), isNotEmpty);
     });
 
+    test('journaledTransactions should return the journaled transactions',
+        () async {
+      expect(await SKPaymentQueueWrapper().journaledTransactions(),
+          <SKJournaledTransactionWrapper>[
+            const SKJournaledTransactionWrapper(
+              transactionIdentifier: '123',
+              productIdentifier: 'product',
+              transactionState: SKPaymentTransactionStateWrapper.purchased,
+              transactionTimeStamp: 1231231231.00,
+            ),
+          ]);
+    });
+
     test(
         'throws if observer is not set for payment queue before adding payment',
         () async {
@@ -257,6 +324,44 @@ class FakeStoreKitPlatform {
           throw Exception('some arbitrary error');
         }
         return Future<String>.value('receipt data');
+      case '-[InAppPurchasePlugin retrieveReceiptBytes:result:]':
+        return Future<Uint8List>.value(Uint8List.fromList(<int>[1, 2, 3]));
+      case '-[InAppPurchasePlugin retrieveReceiptInfo:result:]':
+        if (testReturnNull) {
+          return Future<dynamic>.value();
+        }
+        return Future<Map<String, dynamic>>.value(
+            <String, dynamic>{'size': 3, 'sha256': 'abc123'});
+      case '-[InAppPurchasePlugin currentEntitlements:result:]':
+        if (testReturnNull) {
+          return Future<dynamic>.value();
+        }
+        return Future<List<dynamic>>.value(<dynamic>[
+          <String, dynamic>{
+            'productIdentifier': 'premium',
+            'transactionIdentifier': '2000000123',
+            'originalTransactionIdentifier': '2000000100',
+            'productType': 3,
+            'ownershipType': 1,
+            'purchaseDate': 1231231231.00,
+            'expirationDate': 1233823231.00,
+            'isUpgraded': false,
+            'isVerified': true,
+            'jwsRepresentation': 'header.payload.signature',
+          },
+          <String, dynamic>{
+            'productIdentifier': 'lifetime',
+            'transactionIdentifier': '2000000124',
+            'originalTransactionIdentifier': '2000000124',
+            'productType': 1,
+            'ownershipType': 0,
+            'purchaseDate': 1231231231.00,
+            'isUpgraded': false,
+            'isVerified': false,
+            'verificationError': 'invalid signature',
+            'jwsRepresentation': 'header.payload.signature',
+          },
+        ]);
       // payment queue
       case '-[SKPaymentQueue canMakePayments:]':
         if (testReturnNull) {
@@ -266,6 +371,15 @@ class FakeStoreKitPlatform {
       case '-[SKPaymentQueue transactions]':
         return Future<List<dynamic>>.value(
             <dynamic>[buildTransactionMap(dummyTransaction)]);
+      case '-[InAppPurchasePlugin journaledTransactions:result:]':
+        return Future<List<dynamic>>.value(<dynamic>[
+          <String, dynamic>{
+            'transactionIdentifier': '123',
+            'productIdentifier': 'product',
+            'transactionState': 1,
+            'transactionTimeStamp': 1231231231.00,
+          },
+        ]);
       case '-[SKPaymentQueue storefront]':
         if (testReturnNull) {
           return Future<dynamic>.value();
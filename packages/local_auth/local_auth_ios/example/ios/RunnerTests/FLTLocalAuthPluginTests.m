@@ -75,7 +75,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:YES
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -113,7 +114,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:NO
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -151,7 +153,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:YES
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -193,7 +196,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:NO
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -231,7 +235,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:NO
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -269,7 +274,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:NO
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -312,7 +318,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:NO
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -350,7 +357,8 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
   [plugin authenticateWithOptions:[FLAAuthOptions makeWithBiometricOnly:NO
                                                                  sticky:NO
-                                                        useErrorDialogs:NO]
+                                                        useErrorDialogs:NO
+                                                 allowableReuseDuration:nil]
                           strings:strings
                        completion:^(FLAAuthResultDetails *_Nullable resultDetails,
                                     FlutterError *_Nullable error) {
@@ -490,6 +498,120 @@ static const NSTimeInterval kTimeout = 30.0;
   XCTAssertNil(error);
 }
 
+- (void)testBiometricCapabilityIsCachedUntilAppBecomesActive {
+  id firstAuthContext = OCMClassMock([LAContext class]);
+  id secondAuthContext = OCMClassMock([LAContext class]);
+  FLTLocalAuthPlugin *plugin = [[FLTLocalAuthPlugin alloc]
+      initWithContextFactory:[[StubAuthContextFactory alloc]
+                                 initWithContexts:@[ firstAuthContext, secondAuthContext ]]];
+
+  const LAPolicy policy = LAPolicyDeviceOwnerAuthenticationWithBiometrics;
+  OCMStub([firstAuthContext canEvaluatePolicy:policy error:[OCMArg setTo:nil]]).andReturn(YES);
+  OCMStub([firstAuthContext biometryType]).andReturn(LABiometryTypeFaceID);
+  OCMStub([secondAuthContext canEvaluatePolicy:policy error:[OCMArg setTo:nil]]).andReturn(YES);
+  OCMStub([secondAuthContext biometryType]).andReturn(LABiometryTypeTouchID);
+
+  FlutterError *error;
+  XCTAssertTrue([[plugin deviceCanSupportBiometricsWithError:&error] boolValue]);
+  NSArray<FLAAuthBiometricWrapper *> *result = [plugin getEnrolledBiometricsWithError:&error];
+  XCTAssertEqual([result count], 1);
+  XCTAssertEqual(result[0].value, FLAAuthBiometricFace);
+  OCMVerify(times(1), [firstAuthContext canEvaluatePolicy:policy error:[OCMArg anyPointer]]);
+
+  [plugin applicationDidBecomeActive:[UIApplication sharedApplication]];
+
+  result = [plugin getEnrolledBiometricsWithError:&error];
+  XCTAssertEqual([result count], 1);
+  XCTAssertEqual(result[0].value, FLAAuthBiometricFingerprint);
+  XCTAssertNil(error);
+}
+
+- (void)testAuthContextIsReusedWithinReuseDuration {
+  id mockAuthContext = OCMClassMock([LAContext class]);
+  // The factory fails if a second context is created.
+  FLTLocalAuthPlugin *plugin = [[FLTLocalAuthPlugin alloc]
+      initWithContextFactory:[[StubAuthContextFactory alloc]
+                                 initWithContexts:@[ mockAuthContext ]]];
+
+  const LAPolicy policy = LAPolicyDeviceOwnerAuthenticationWithBiometrics;
+  FLAAuthStrings *strings = [self createAuthStrings];
+  OCMStub([mockAuthContext canEvaluatePolicy:policy error:[OCMArg setTo:nil]]).andReturn(YES);
+  void (^replyCaller)(NSInvocation *) = ^(NSInvocation *invocation) {
+    void (^reply)(BOOL, NSError *);
+    [invocation getArgument:&reply atIndex:4];
+    reply(YES, nil);
+  };
+  OCMStub([mockAuthContext evaluatePolicy:policy localizedReason:strings.reason reply:[OCMArg any]])
+      .andDo(replyCaller);
+
+  FLAAuthOptions *options = [FLAAuthOptions makeWithBiometricOnly:YES
+                                                           sticky:NO
+                                                  useErrorDialogs:NO
+                                           allowableReuseDuration:@10];
+  for (int i = 0; i < 2; i++) {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
+    [plugin authenticateWithOptions:options
+                            strings:strings
+                         completion:^(FLAAuthResultDetails *_Nullable resultDetails,
+                                      FlutterError *_Nullable error) {
+                           XCTAssertEqual(resultDetails.result, FLAAuthResultSuccess);
+                           XCTAssertNil(error);
+                           [expectation fulfill];
+                         }];
+    [self waitForExpectationsWithTimeout:kTimeout handler:nil];
+  }
+  OCMVerify([mockAuthContext setTouchIDAuthenticationAllowableReuseDuration:10]);
+}
+
+- (void)testAuthContextIsNotReusedAfterFailure {
+  id firstAuthContext = OCMClassMock([LAContext class]);
+  id secondAuthContext = OCMClassMock([LAContext class]);
+  FLTLocalAuthPlugin *plugin = [[FLTLocalAuthPlugin alloc]
+      initWithContextFactory:[[StubAuthContextFactory alloc]
+                                 initWithContexts:@[ firstAuthContext, secondAuthContext ]]];
+
+  const LAPolicy policy = LAPolicyDeviceOwnerAuthenticationWithBiometrics;
+  FLAAuthStrings *strings = [self createAuthStrings];
+  OCMStub([firstAuthContext canEvaluatePolicy:policy error:[OCMArg setTo:nil]]).andReturn(YES);
+  OCMStub([secondAuthContext canEvaluatePolicy:policy error:[OCMArg setTo:nil]]).andReturn(YES);
+  void (^failingReplyCaller)(NSInvocation *) = ^(NSInvocation *invocation) {
+    void (^reply)(BOOL, NSError *);
+    [invocation getArgument:&reply atIndex:4];
+    reply(NO, [NSError errorWithDomain:@"error" code:99 userInfo:nil]);
+  };
+  OCMStub([firstAuthContext evaluatePolicy:policy
+                           localizedReason:strings.reason
+                                     reply:[OCMArg any]])
+      .andDo(failingReplyCaller);
+  void (^replyCaller)(NSInvocation *) = ^(NSInvocation *invocation) {
+    void (^reply)(BOOL, NSError *);
+    [invocation getArgument:&reply atIndex:4];
+    reply(YES, nil);
+  };
+  OCMStub([secondAuthContext evaluatePolicy:policy
+                            localizedReason:strings.reason
+                                      reply:[OCMArg any]])
+      .andDo(replyCaller);
+
+  FLAAuthOptions *options = [FLAAuthOptions makeWithBiometricOnly:YES
+                                                           sticky:NO
+                                                  useErrorDialogs:NO
+                                           allowableReuseDuration:@10];
+  NSArray<NSNumber *> *expectedResults =
+      @[ @(FLAAuthResultErrorNotAvailable), @(FLAAuthResultSuccess) ];
+  for (NSNumber *expectedResult in expectedResults) {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Result is called"];
+    [plugin authenticateWithOptions:options
+                            strings:strings
+                         completion:^(FLAAuthResultDetails *_Nullable resultDetails,
+                                      FlutterError *_Nullable error) {
+                           XCTAssertEqual(resultDetails.result, expectedResult.integerValue);
+                           [expectation fulfill];
+                         }];
+    [self waitForExpectationsWithTimeout:kTimeout handler:nil];
+  }
+}
+
 // TODO(stuartmorgan): Make this multiple tests when fixing
 // https://github.com/flutter/flutter/issues/116179
 // Currently it just always returns true.
@@ -50,9 +50,43 @@ typedef void (^FLAAuthCompletion)(FLAAuthResultDetails *_Nullable, FlutterError
 
 #pragma mark -
 
+/**
+ * A snapshot of the result of checking whether biometric authentication is possible.
+ */
+@interface FLABiometricCapability : NSObject
+@property(nonatomic, assign, readonly) BOOL canEvaluate;
+@property(nonatomic, strong, readonly, nullable) NSError *error;
+@property(nonatomic, assign, readonly) LABiometryType biometryType;
+- (instancetype)initWithContext:(nonnull LAContext *)context;
+@end
+
+@implementation FLABiometricCapability
+- (instancetype)initWithContext:(nonnull LAContext *)context {
+  self = [super init];
+  if (self) {
+    NSError *authError = nil;
+    _canEvaluate = [context canEvaluatePolicy:LAPolicyDeviceOwnerAuthenticationWithBiometrics
+                                        error:&authError];
+    _error = authError;
+    _biometryType = context.biometryType;
+  }
+  return self;
+}
+@end
+
+#pragma mark -
+
 @interface FLTLocalAuthPlugin ()
 @property(nonatomic, strong, nullable) FLAStickyAuthState *lastCallState;
 @property(nonatomic, strong) NSObject<FLAAuthContextFactory> *authContextFactory;
+/// The cached biometric capability, or nil if it needs to be checked again.
+@property(nonatomic, strong, nullable) FLABiometricCapability *biometricCapability;
+/// The context of the last successful authentication that allowed reuse.
+@property(nonatomic, strong, nullable) LAContext *reusableContext;
+/// The policy that reusableContext was evaluated with.
+@property(nonatomic, assign) LAPolicy reusableContextPolicy;
+/// The time after which reusableContext can no longer be reused.
+@property(nonatomic, strong, nullable) NSDate *reusableContextExpiration;
 @end
 
 @implementation FLTLocalAuthPlugin
@@ -81,18 +115,24 @@ typedef void (^FLAAuthCompletion)(FLAAuthResultDetails *_Nullable, FlutterError
                         strings:(nonnull FLAAuthStrings *)strings
                      completion:(nonnull void (^)(FLAAuthResultDetails *_Nullable,
                                                   FlutterError *_Nullable))completion {
-  LAContext *context = [self.authContextFactory createAuthContext];
+  LAPolicy policy = options.biometricOnly ? LAPolicyDeviceOwnerAuthenticationWithBiometrics
+                                          : LAPolicyDeviceOwnerAuthentication;
+  NSTimeInterval reuseDuration = MIN(options.allowableReuseDuration.doubleValue,
+                                     LATouchIDAuthenticationMaximumAllowableReuseDuration);
+  LAContext *context = [self authContextForPolicy:policy reuseDuration:reuseDuration];
   NSError *authError = nil;
   self.lastCallState = nil;
   context.localizedFallbackTitle = strings.localizedFallbackTitle;
 
-  LAPolicy policy = options.biometricOnly ? LAPolicyDeviceOwnerAuthenticationWithBiometrics
-                                          : LAPolicyDeviceOwnerAuthentication;
   if ([context canEvaluatePolicy:policy error:&authError]) {
     [context evaluatePolicy:policy
             localizedReason:strings.reason
                       reply:^(BOOL success, NSError *error) {
                         dispatch_async(dispatch_get_main_queue(), ^{
+                          [self updateReusableContext:context
+                                               policy:policy
+                                        reuseDuration:reuseDuration
+                                              success:success];
                           [self handleAuthReplyWithSuccess:success
                                                      error:error
                                                    options:options
@@ -101,26 +141,21 @@ typedef void (^FLAAuthCompletion)(FLAAuthResultDetails *_Nullable, FlutterError
                         });
                       }];
   } else {
+    [self updateReusableContext:context policy:policy reuseDuration:reuseDuration success:NO];
     [self handleError:authError withOptions:options strings:strings completion:completion];
   }
 }
 
 - (nullable NSNumber *)deviceCanSupportBiometricsWithError:
     (FlutterError *_Nullable __autoreleasing *_Nonnull)error {
-  LAContext *context = [self.authContextFactory createAuthContext];
-  NSError *authError = nil;
+  FLABiometricCapability *capability = [self currentBiometricCapability];
   // Check if authentication with biometrics is possible.
-  if ([context canEvaluatePolicy:LAPolicyDeviceOwnerAuthenticationWithBiometrics
-                           error:&authError]) {
-    if (authError == nil) {
-      return @YES;
-    }
+  if (capability.canEvaluate && capability.error == nil) {
+    return @YES;
   }
   // If not, check if it is because no biometrics are enrolled (but still present).
-  if (authError != nil) {
-    if (authError.code == LAErrorBiometryNotEnrolled) {
-      return @YES;
-    }
+  if (capability.error.code == LAErrorBiometryNotEnrolled) {
+    return @YES;
   }
 
   return @NO;
@@ -128,17 +163,13 @@ typedef void (^FLAAuthCompletion)(FLAAuthResultDetails *_Nullable, FlutterError
 
 - (nullable NSArray<FLAAuthBiometricWrapper *> *)getEnrolledBiometricsWithError:
     (FlutterError *_Nullable __autoreleasing *_Nonnull)error {
-  LAContext *context = [self.authContextFactory createAuthContext];
-  NSError *authError = nil;
+  FLABiometricCapability *capability = [self currentBiometricCapability];
   NSMutableArray<FLAAuthBiometricWrapper *> *biometrics = [[NSMutableArray alloc] init];
-  if ([context canEvaluatePolicy:LAPolicyDeviceOwnerAuthenticationWithBiometrics
-                           error:&authError]) {
-    if (authError == nil) {
-      if (context.biometryType == LABiometryTypeFaceID) {
-        [biometrics addObject:[FLAAuthBiometricWrapper makeWithValue:FLAAuthBiometricFace]];
-      } else if (context.biometryType == LABiometryTypeTouchID) {
-        [biometrics addObject:[FLAAuthBiometricWrapper makeWithValue:FLAAuthBiometricFingerprint]];
-      }
+  if (capability.canEvaluate && capability.error == nil) {
+    if (capability.biometryType == LABiometryTypeFaceID) {
+      [biometrics addObject:[FLAAuthBiometricWrapper makeWithValue:FLAAuthBiometricFace]];
+    } else if (capability.biometryType == LABiometryTypeTouchID) {
+      [biometrics addObject:[FLAAuthBiometricWrapper makeWithValue:FLAAuthBiometricFingerprint]];
     }
   }
   return biometrics;
@@ -153,6 +184,63 @@ typedef void (^FLAAuthCompletion)(FLAAuthResultDetails *_Nullable, FlutterError
 
 #pragma mark Private Methods
 
+/**
+ * Returns the biometric capability of the device, checking it only if there is no cached result.
+ */
+- (FLABiometricCapability *)currentBiometricCapability {
+  if (self.biometricCapability == nil) {
+    LAContext *context = [self.authContextFactory createAuthContext];
+    self.biometricCapability = [[FLABiometricCapability alloc] initWithContext:context];
+  }
+  return self.biometricCapability;
+}
+
+/**
+ * Returns the context to authenticate with: the context of a previous successful authentication
+ * with the same policy if it can still be reused, or a new context otherwise.
+ */
+- (LAContext *)authContextForPolicy:(LAPolicy)policy reuseDuration:(NSTimeInterval)reuseDuration {
+  if (self.reusableContext != nil && [self.reusableContextExpiration timeIntervalSinceNow] <= 0) {
+    [self discardReusableContext];
+  }
+  if (reuseDuration > 0 && self.reusableContext != nil && self.reusableContextPolicy == policy) {
+    return self.reusableContext;
+  }
+  LAContext *context = [self.authContextFactory createAuthContext];
+  if (reuseDuration > 0) {
+    context.touchIDAuthenticationAllowableReuseDuration = reuseDuration;
+  }
+  return context;
+}
+
+/**
+ * Keeps |context| for reuse after a successful authentication that allows it, and discards the
+ * reusable context after a failed one.
+ */
+- (void)updateReusableContext:(LAContext *)context
+                       policy:(LAPolicy)policy
+                reuseDuration:(NSTimeInterval)reuseDuration
+                      success:(BOOL)success {
+  if (!success) {
+    if (context == self.reusableContext) {
+      [self discardReusableContext];
+    }
+    return;
+  }
+  if (reuseDuration > 0 && context != self.reusableContext) {
+    [self discardReusableContext];
+    self.reusableContext = context;
+    self.reusableContextPolicy = policy;
+    self.reusableContextExpiration = [NSDate dateWithTimeIntervalSinceNow:reuseDuration];
+  }
+}
+
+- (void)discardReusableContext {
+  [self.reusableContext invalidate];
+  self.reusableContext = nil;
+  self.reusableContextExpiration = nil;
+}
+
 - (void)showAlertWithMessage:(NSString *)message
           dismissButtonTitle:(NSString *)dismissButtonTitle
      openSettingsButtonTitle:(NSString *)openSettingsButtonTitle
@@ -262,6 +350,8 @@ typedef void (^FLAAuthCompletion)(FLAAuthResultDetails *_Nullable, FlutterError
 #pragma mark - AppDelegate
 
 - (void)applicationDidBecomeActive:(UIApplication *)application {
+  // Biometrics may have been enrolled or removed in Settings while the app was inactive.
+  self.biometricCapability = nil;
   if (self.lastCallState != nil) {
     [self authenticateWithOptions:_lastCallState.options
                           strings:_lastCallState.strings
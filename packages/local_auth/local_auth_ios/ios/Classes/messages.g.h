@@ -75,10 +75,14 @@ typedef NS_ENUM(NSUInteger, FLAAuthBiometric) {
 - (instancetype)init NS_UNAVAILABLE;
 + (instancetype)makeWithBiometricOnly:(BOOL)biometricOnly
                                sticky:(BOOL)sticky
-                      useErrorDialogs:(BOOL)useErrorDialogs;
+                      useErrorDialogs:(BOOL)useErrorDialogs
+               allowableReuseDuration:(nullable NSNumber *)allowableReuseDuration;
 @property(nonatomic, assign) BOOL biometricOnly;
 @property(nonatomic, assign) BOOL sticky;
 @property(nonatomic, assign) BOOL useErrorDialogs;
+/// How long, in seconds, a successful authentication can be reused by
+/// later calls. Null or zero disables reuse.
+@property(nonatomic, strong, nullable) NSNumber *allowableReuseDuration;
 @end
 
 @interface FLAAuthResultDetails : NSObject
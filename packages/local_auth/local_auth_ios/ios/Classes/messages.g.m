@@ -119,11 +119,13 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 @implementation FLAAuthOptions
 + (instancetype)makeWithBiometricOnly:(BOOL)biometricOnly
                                sticky:(BOOL)sticky
-                      useErrorDialogs:(BOOL)useErrorDialogs {
+                      useErrorDialogs:(BOOL)useErrorDialogs
+               allowableReuseDuration:(nullable NSNumber *)allowableReuseDuration {
   FLAAuthOptions *pigeonResult = [[FLAAuthOptions alloc] init];
   pigeonResult.biometricOnly = biometricOnly;
   pigeonResult.sticky = sticky;
   pigeonResult.useErrorDialogs = useErrorDialogs;
+  pigeonResult.allowableReuseDuration = allowableReuseDuration;
   return pigeonResult;
 }
 + (FLAAuthOptions *)fromList:(NSArray *)list {
@@ -131,6 +133,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   pigeonResult.biometricOnly = [GetNullableObjectAtIndex(list, 0) boolValue];
   pigeonResult.sticky = [GetNullableObjectAtIndex(list, 1) boolValue];
   pigeonResult.useErrorDialogs = [GetNullableObjectAtIndex(list, 2) boolValue];
+  pigeonResult.allowableReuseDuration = GetNullableObjectAtIndex(list, 3);
   return pigeonResult;
 }
 + (nullable FLAAuthOptions *)nullableFromList:(NSArray *)list {
@@ -141,6 +144,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     @(self.biometricOnly),
     @(self.sticky),
     @(self.useErrorDialogs),
+    self.allowableReuseDuration ?: [NSNull null],
   ];
 }
 @end
@@ -17,9 +17,16 @@ export 'package:local_auth_platform_interface/types/biometric_type.dart';
 /// The implementation of [LocalAuthPlatform] for iOS.
 class LocalAuthIOS extends LocalAuthPlatform {
   /// Creates a new plugin implementation instance.
+  ///
+  /// If [authenticationReuseDuration] is set, a successful authentication is
+  /// reused by later calls to [authenticate] with the same `biometricOnly`
+  /// option for that long, instead of prompting the user again. iOS caps the
+  /// duration at five minutes.
   LocalAuthIOS({
     @visibleForTesting LocalAuthApi? api,
-  }) : _api = api ?? LocalAuthApi();
+    Duration? authenticationReuseDuration,
+  })  : _api = api ?? LocalAuthApi(),
+        _authenticationReuseDuration = authenticationReuseDuration;
 
   /// Registers this class as the default instance of [LocalAuthPlatform].
   static void registerWith() {
@@ -28,6 +35,8 @@ class LocalAuthIOS extends LocalAuthPlatform {
 
   final LocalAuthApi _api;
 
+  final Duration? _authenticationReuseDuration;
+
   @override
   Future<bool> authenticate({
     required String localizedReason,
@@ -35,11 +44,16 @@ class LocalAuthIOS extends LocalAuthPlatform {
     AuthenticationOptions options = const AuthenticationOptions(),
   }) async {
     assert(localizedReason.isNotEmpty);
+    final Duration? reuseDuration = _authenticationReuseDuration;
     final AuthResultDetails resultDetails = await _api.authenticate(
         AuthOptions(
             biometricOnly: options.biometricOnly,
             sticky: options.stickyAuth,
-            useErrorDialogs: options.useErrorDialogs),
+            useErrorDialogs: options.useErrorDialogs,
+            allowableReuseDuration: reuseDuration == null
+                ? null
+                : reuseDuration.inMicroseconds /
+                    Duration.microsecondsPerSecond),
         _pigeonStringsFromAuthMessages(localizedReason, authMessages));
     // TODO(stuartmorgan): Replace this with structured errors, coordinated
     // across all platform implementations, per
@@ -100,6 +100,7 @@ class AuthOptions {
     required this.biometricOnly,
     required this.sticky,
     required this.useErrorDialogs,
+    this.allowableReuseDuration,
   });
 
   bool biometricOnly;
@@ -108,11 +109,16 @@ class AuthOptions {
 
   bool useErrorDialogs;
 
+  /// How long, in seconds, a successful authentication can be reused by
+  /// later calls. Null or zero disables reuse.
+  double? allowableReuseDuration;
+
   Object encode() {
     return <Object?>[
       biometricOnly,
       sticky,
       useErrorDialogs,
+      allowableReuseDuration,
     ];
   }
 
@@ -122,6 +128,7 @@ class AuthOptions {
       biometricOnly: result[0]! as bool,
       sticky: result[1]! as bool,
       useErrorDialogs: result[2]! as bool,
+      allowableReuseDuration: result[3] as double?,
     );
   }
 }
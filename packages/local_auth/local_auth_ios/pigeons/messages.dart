@@ -58,10 +58,15 @@ class AuthOptions {
   AuthOptions(
       {required this.biometricOnly,
       required this.sticky,
-      required this.useErrorDialogs});
+      required this.useErrorDialogs,
+      this.allowableReuseDuration});
   final bool biometricOnly;
   final bool sticky;
   final bool useErrorDialogs;
+
+  /// How long, in seconds, a successful authentication can be reused by
+  /// later calls. Null or zero disables reuse.
+  final double? allowableReuseDuration;
 }
 
 class AuthResultDetails {
@@ -214,6 +214,7 @@ void main() {
         expect(options.biometricOnly, false);
         expect(options.sticky, false);
         expect(options.useErrorDialogs, true);
+        expect(options.allowableReuseDuration, null);
       });
 
       test('passes provided non-default values', () async {
@@ -236,6 +237,22 @@ void main() {
         expect(options.sticky, true);
         expect(options.useErrorDialogs, false);
       });
+
+      test('passes authentication reuse duration in seconds', () async {
+        plugin = LocalAuthIOS(
+            api: api,
+            authenticationReuseDuration: const Duration(milliseconds: 1500));
+        when(api.authenticate(any, any)).thenAnswer(
+            (_) async => AuthResultDetails(result: AuthResult.success));
+
+        await plugin.authenticate(
+            localizedReason: 'reason', authMessages: <AuthMessages>[]);
+
+        final VerificationResult result =
+            verify(api.authenticate(captureAny, any));
+        final AuthOptions options = result.captured[0] as AuthOptions;
+        expect(options.allowableReuseDuration, 1.5);
+      });
     });
 
     group('return values', () {
@@ -62,6 +62,14 @@ class LocalAuthWindows extends LocalAuthPlatform {
   @override
   Future<bool> isDeviceSupported() async => _api.isDeviceSupported();
 
+  /// Wakes up Windows Hello ahead of use, so that later calls to
+  /// [isDeviceSupported] and [authenticate] don't wait for the biometric
+  /// sensors to start.
+  ///
+  /// The plugin already does this when it is registered, so this is only
+  /// needed to refresh the state before showing UI that depends on it.
+  Future<void> prewarm() => _api.prewarm();
+
   /// Always returns false as this method is not supported on Windows.
   @override
   Future<bool> stopAuthentication() async => false;
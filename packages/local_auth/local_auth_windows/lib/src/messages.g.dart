@@ -79,4 +79,30 @@ class LocalAuthApi {
       return (replyList[0] as bool?)!;
     }
   }
+
+  /// Ensures that Windows Hello availability is cached, completing once it
+  /// is known.
+  ///
+  /// Calling this ahead of [isDeviceSupported] or [authenticate] hides the
+  /// latency of waking up the biometric sensors.
+  Future<void> prewarm() async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.LocalAuthApi.prewarm', codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(null) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
 }
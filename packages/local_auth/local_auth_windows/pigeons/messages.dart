@@ -24,4 +24,12 @@ abstract class LocalAuthApi {
   /// not successful, and an error if authorization could not be attempted.
   @async
   bool authenticate(String localizedReason);
+
+  /// Ensures that Windows Hello availability is cached, completing once it
+  /// is known.
+  ///
+  /// Calling this ahead of [isDeviceSupported] or [authenticate] hides the
+  /// latency of waking up the biometric sensors.
+  @async
+  void prewarm();
 }
@@ -101,6 +101,12 @@ void main() {
 
       expect(result, false);
     });
+
+    test('prewarm calls through to the platform', () async {
+      await plugin.prewarm();
+
+      expect(api.prewarmCount, 1);
+    });
   });
 }
 
@@ -111,6 +117,9 @@ class _FakeLocalAuthApi implements LocalAuthApi {
   /// The argument that was passed to [authenticate].
   String? passedReason;
 
+  /// The number of calls to [prewarm].
+  int prewarmCount = 0;
+
   @override
   Future<bool> authenticate(String localizedReason) async {
     passedReason = localizedReason;
@@ -121,4 +130,9 @@ class _FakeLocalAuthApi implements LocalAuthApi {
   Future<bool> isDeviceSupported() async {
     return returnValue;
   }
+
+  @override
+  Future<void> prewarm() async {
+    prewarmCount++;
+  }
 }
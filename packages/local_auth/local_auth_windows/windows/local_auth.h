@@ -19,7 +19,9 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <sstream>
+#include <vector>
 
 #include "messages.g.h"
 
@@ -64,23 +66,69 @@ class LocalAuthPlugin : public flutter::Plugin, public LocalAuthApi {
 
   virtual ~LocalAuthPlugin();
 
+  // Starts refreshing the cached availability in the background, and keeps it
+  // up to date by listening for session unlock and device change messages to
+  // the top-level window of |registrar|.
+  void WatchAvailability(flutter::PluginRegistrarWindows* registrar);
+
+  // Handles messages to the top-level window, invalidating the cached
+  // availability when it may have changed.
+  std::optional<LRESULT> HandleWindowProc(HWND hwnd, UINT message,
+                                          WPARAM wparam, LPARAM lparam);
+
   // LocalAuthApi:
   void IsDeviceSupported(
       std::function<void(ErrorOr<bool> reply)> result) override;
   void Authenticate(const std::string& localized_reason,
                     std::function<void(ErrorOr<bool> reply)> result) override;
+  void Prewarm(
+      std::function<void(std::optional<FlutterError> reply)> result) override;
 
  private:
+  using Availability = winrt::Windows::Security::Credentials::UI::
+      UserConsentVerifierAvailability;
+
   std::unique_ptr<UserConsentVerifier> user_consent_verifier_;
 
-  // Starts authentication process.
-  winrt::fire_and_forget AuthenticateCoroutine(
-      const std::string& localized_reason,
-      std::function<void(ErrorOr<bool> reply)> result);
+  // The result of the last availability check, if it hasn't been invalidated
+  // since.
+  std::optional<Availability> cached_availability_;
+
+  // Callbacks waiting for the availability check that is in progress.
+  std::vector<std::function<void(Availability)>> availability_callbacks_;
+
+  // Whether an availability check is in progress.
+  bool availability_check_pending_ = false;
+
+  // Incremented each time the cached availability is invalidated, so that a
+  // check that was in progress at the time can be discarded.
+  int availability_generation_ = 0;
 
-  // Returns whether the system supports Windows Hello.
-  winrt::fire_and_forget IsDeviceSupportedCoroutine(
-      std::function<void(ErrorOr<bool> reply)> result);
+  // The registrar and window procedure delegate set up by WatchAvailability,
+  // if it has been called.
+  flutter::PluginRegistrarWindows* registrar_ = nullptr;
+  int window_proc_id_ = -1;
+
+  // The window registered for session notifications, if any.
+  HWND session_notification_window_ = nullptr;
+
+  // Calls |callback| with the cached availability, checking it first if
+  // there is no valid cached value.
+  void GetAvailability(std::function<void(Availability)> callback);
+
+  // Discards the cached availability and starts checking it again.
+  void InvalidateAvailability();
+
+  // Starts an availability check if one isn't already in progress.
+  void RefreshAvailability();
+
+  // Checks availability until a result is obtained that hasn't been
+  // invalidated, then caches it and runs the waiting callbacks.
+  winrt::fire_and_forget CheckAvailabilityCoroutine();
+
+  // Starts authentication process, once availability has been confirmed.
+  winrt::fire_and_forget AuthenticateCoroutine(
+      std::wstring reason, std::function<void(ErrorOr<bool> reply)> result);
 };
 
 }  // namespace local_auth_windows
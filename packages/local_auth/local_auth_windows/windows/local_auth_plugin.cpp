@@ -1,10 +1,14 @@
 // Copyright 2013 The Flutter Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <dbt.h>
 #include <winstring.h>
+#include <wtsapi32.h>
 
 #include "local_auth.h"
 #include "messages.g.h"
+#include "string_utils.h"
+#include "tracing.h"
 
 namespace {
 
@@ -13,32 +17,48 @@ HWND GetRootWindow(flutter::FlutterView* view) {
   return ::GetAncestor(view->GetNativeWindow(), GA_ROOT);
 }
 
-// Converts the given UTF-8 string to UTF-16.
-std::wstring Utf16FromUtf8(const std::string& utf8_string) {
-  if (utf8_string.empty()) {
-    return std::wstring();
+// Returns the window that the verification dialog is shown for: the app's
+// active window, which in an app with several windows may not be the one
+// that hosts |view|, or else the top-level window of |view|.
+//
+// Must be called on the platform thread, which owns the app's windows.
+HWND GetOwnerWindow(flutter::FlutterView* view) {
+  HWND active_window = ::GetActiveWindow();
+  if (active_window) {
+    return active_window;
   }
-  int target_length =
-      ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, utf8_string.data(),
-                            static_cast<int>(utf8_string.length()), nullptr, 0);
-  if (target_length == 0) {
-    return std::wstring();
-  }
-  std::wstring utf16_string;
-  utf16_string.resize(target_length);
-  int converted_length =
-      ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, utf8_string.data(),
-                            static_cast<int>(utf8_string.length()),
-                            utf16_string.data(), target_length);
-  if (converted_length == 0) {
-    return std::wstring();
-  }
-  return utf16_string;
+  return view ? GetRootWindow(view) : nullptr;
 }
 
 }  // namespace
 
 namespace local_auth_windows {
+using windows_plugin_utils::Utf16FromUtf8;
+
+namespace {
+
+// Returns the error to report for an authentication attempt when Windows
+// Hello has the given availability, or nullopt if it is available.
+std::optional<FlutterError> ErrorForAvailability(
+    winrt::Windows::Security::Credentials::UI::UserConsentVerifierAvailability
+        availability) {
+  using winrt::Windows::Security::Credentials::UI::
+      UserConsentVerifierAvailability;
+  switch (availability) {
+    case UserConsentVerifierAvailability::Available:
+      return std::nullopt;
+    case UserConsentVerifierAvailability::DeviceNotPresent:
+      return FlutterError("NoHardware", "No biometric hardware found");
+    case UserConsentVerifierAvailability::NotConfiguredForUser:
+      return FlutterError("NotEnrolled",
+                          "No biometrics enrolled on this device.");
+    default:
+      return FlutterError("NotAvailable",
+                          "Required security features not enabled");
+  }
+}
+
+}  // namespace
 
 // Creates an instance of the UserConsentVerifier that
 // calls the native Windows APIs to get the user's consent.
@@ -53,10 +73,15 @@ class UserConsentVerifierImpl : public UserConsentVerifier {
   winrt::Windows::Foundation::IAsyncOperation<
       winrt::Windows::Security::Credentials::UI::UserConsentVerificationResult>
   RequestVerificationForWindowAsync(std::wstring localized_reason) override {
+    // Keep the activation factory, rather than looking it up again for every
+    // request.
+    if (!user_consent_verifier_interop_) {
+      user_consent_verifier_interop_ = winrt::get_activation_factory<
+          winrt::Windows::Security::Credentials::UI::UserConsentVerifier,
+          IUserConsentVerifierInterop>();
+    }
     winrt::impl::com_ref<IUserConsentVerifierInterop>
-        user_consent_verifier_interop = winrt::get_activation_factory<
-            winrt::Windows::Security::Credentials::UI::UserConsentVerifier,
-            IUserConsentVerifierInterop>();
+        user_consent_verifier_interop = user_consent_verifier_interop_;
 
     HWND root_window_handle = get_root_window_();
 
@@ -91,13 +116,19 @@ class UserConsentVerifierImpl : public UserConsentVerifier {
  private:
   // The provider for the root window to attach the dialog to.
   std::function<HWND()> get_root_window_;
+
+  // The activation factory used to show the verification dialog, once it has
+  // been looked up.
+  winrt::impl::com_ref<IUserConsentVerifierInterop>
+      user_consent_verifier_interop_;
 };
 
 // static
 void LocalAuthPlugin::RegisterWithRegistrar(
     flutter::PluginRegistrarWindows* registrar) {
   auto plugin = std::make_unique<LocalAuthPlugin>(
-      [registrar]() { return GetRootWindow(registrar->GetView()); });
+      [registrar]() { return GetOwnerWindow(registrar->GetView()); });
+  plugin->WatchAvailability(registrar);
   LocalAuthApi::SetUp(registrar->messenger(), plugin.get());
   registrar->AddPlugin(std::move(plugin));
 }
@@ -105,75 +136,174 @@ void LocalAuthPlugin::RegisterWithRegistrar(
 // Default constructor for LocalAuthPlugin.
 LocalAuthPlugin::LocalAuthPlugin(std::function<HWND()> window_provider)
     : user_consent_verifier_(std::make_unique<UserConsentVerifierImpl>(
-          std::move(window_provider))) {}
+          std::move(window_provider))) {
+  RegisterTraceProvider();
+}
 
 LocalAuthPlugin::LocalAuthPlugin(
     std::unique_ptr<UserConsentVerifier> user_consent_verifier)
-    : user_consent_verifier_(std::move(user_consent_verifier)) {}
+    : user_consent_verifier_(std::move(user_consent_verifier)) {
+  RegisterTraceProvider();
+}
+
+LocalAuthPlugin::~LocalAuthPlugin() {
+  if (session_notification_window_) {
+    ::WTSUnRegisterSessionNotification(session_notification_window_);
+  }
+  if (registrar_) {
+    registrar_->UnregisterTopLevelWindowProcDelegate(window_proc_id_);
+  }
+  UnregisterTraceProvider();
+}
 
-LocalAuthPlugin::~LocalAuthPlugin() {}
+void LocalAuthPlugin::WatchAvailability(
+    flutter::PluginRegistrarWindows* registrar) {
+  registrar_ = registrar;
+  window_proc_id_ = registrar->RegisterTopLevelWindowProcDelegate(
+      [this](HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam) {
+        return HandleWindowProc(hwnd, message, wparam, lparam);
+      });
+  // Device changes are broadcast to all top-level windows, but session
+  // changes are only sent to windows that ask for them.
+  flutter::FlutterView* view = registrar->GetView();
+  HWND window = view ? GetRootWindow(view) : nullptr;
+  if (window &&
+      ::WTSRegisterSessionNotification(window, NOTIFY_FOR_THIS_SESSION)) {
+    session_notification_window_ = window;
+  }
+  RefreshAvailability();
+}
+
+std::optional<LRESULT> LocalAuthPlugin::HandleWindowProc(HWND hwnd,
+                                                         UINT message,
+                                                         WPARAM wparam,
+                                                         LPARAM lparam) {
+  // Biometric devices may have been attached or removed, or enrollment may
+  // have changed while the session was locked.
+  if ((message == WM_WTSSESSION_CHANGE && wparam == WTS_SESSION_UNLOCK) ||
+      (message == WM_DEVICECHANGE && wparam == DBT_DEVNODES_CHANGED)) {
+    InvalidateAvailability();
+  }
+  return std::nullopt;
+}
 
 void LocalAuthPlugin::IsDeviceSupported(
     std::function<void(ErrorOr<bool> reply)> result) {
-  IsDeviceSupportedCoroutine(std::move(result));
+  LOCAL_AUTH_TRACE_SCOPE("IsDeviceSupported");
+  GetAvailability([result = std::move(result)](Availability availability) {
+    result(availability == Availability::Available);
+  });
 }
 
 void LocalAuthPlugin::Authenticate(
     const std::string& localized_reason,
     std::function<void(ErrorOr<bool> reply)> result) {
-  AuthenticateCoroutine(localized_reason, std::move(result));
+  LOCAL_AUTH_TRACE_SCOPE("Authenticate");
+  GetAvailability([this, reason = Utf16FromUtf8(localized_reason),
+                   result = std::move(result)](Availability availability) {
+    std::optional<FlutterError> error = ErrorForAvailability(availability);
+    if (error) {
+      result(error.value());
+      return;
+    }
+    AuthenticateCoroutine(reason, result);
+  });
 }
 
-// Starts authentication process.
-winrt::fire_and_forget LocalAuthPlugin::AuthenticateCoroutine(
-    const std::string& localized_reason,
-    std::function<void(ErrorOr<bool> reply)> result) {
-  std::wstring reason = Utf16FromUtf8(localized_reason);
+void LocalAuthPlugin::Prewarm(
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  LOCAL_AUTH_TRACE_SCOPE("Prewarm");
+  GetAvailability([result = std::move(result)](Availability availability) {
+    result(std::nullopt);
+  });
+}
 
-  winrt::Windows::Security::Credentials::UI::UserConsentVerifierAvailability
-      ucv_availability =
-          co_await user_consent_verifier_->CheckAvailabilityAsync();
+// All of the availability state is only accessed on the platform thread;
+// C++/WinRT resumes coroutines there after awaiting asynchronous operations
+// that were started there.
+void LocalAuthPlugin::GetAvailability(
+    std::function<void(Availability)> callback) {
+  if (cached_availability_) {
+    callback(cached_availability_.value());
+    return;
+  }
+  availability_callbacks_.push_back(std::move(callback));
+  RefreshAvailability();
+}
 
-  if (ucv_availability ==
-      winrt::Windows::Security::Credentials::UI::
-          UserConsentVerifierAvailability::DeviceNotPresent) {
-    result(FlutterError("NoHardware", "No biometric hardware found"));
-    co_return;
-  } else if (ucv_availability ==
-             winrt::Windows::Security::Credentials::UI::
-                 UserConsentVerifierAvailability::NotConfiguredForUser) {
-    result(
-        FlutterError("NotEnrolled", "No biometrics enrolled on this device."));
-    co_return;
-  } else if (ucv_availability !=
-             winrt::Windows::Security::Credentials::UI::
-                 UserConsentVerifierAvailability::Available) {
-    result(
-        FlutterError("NotAvailable", "Required security features not enabled"));
-    co_return;
+void LocalAuthPlugin::InvalidateAvailability() {
+  cached_availability_.reset();
+  ++availability_generation_;
+  RefreshAvailability();
+}
+
+void LocalAuthPlugin::RefreshAvailability() {
+  if (availability_check_pending_ || cached_availability_) {
+    return;
+  }
+  availability_check_pending_ = true;
+  CheckAvailabilityCoroutine();
+}
+
+winrt::fire_and_forget LocalAuthPlugin::CheckAvailabilityCoroutine() {
+  Availability availability;
+  int generation;
+  do {
+    generation = availability_generation_;
+    LOCAL_AUTH_TRACE_SCOPE("CheckAvailabilityAsync");
+    availability = co_await user_consent_verifier_->CheckAvailabilityAsync();
+  } while (generation != availability_generation_);
+
+  availability_check_pending_ = false;
+  cached_availability_ = availability;
+  std::vector<std::function<void(Availability)>> callbacks =
+      std::move(availability_callbacks_);
+  availability_callbacks_.clear();
+  for (const auto& callback : callbacks) {
+    callback(availability);
   }
+}
 
+// Starts authentication process.
+winrt::fire_and_forget LocalAuthPlugin::AuthenticateCoroutine(
+    std::wstring reason, std::function<void(ErrorOr<bool> reply)> result) {
+  using winrt::Windows::Security::Credentials::UI::
+      UserConsentVerificationResult;
   try {
-    winrt::Windows::Security::Credentials::UI::UserConsentVerificationResult
-        consent_result =
-            co_await user_consent_verifier_->RequestVerificationForWindowAsync(
-                reason);
+    UserConsentVerificationResult consent_result;
+    {
+      LOCAL_AUTH_TRACE_SCOPE("RequestVerificationForWindowAsync");
+      consent_result =
+          co_await user_consent_verifier_->RequestVerificationForWindowAsync(
+              reason);
+    }
+
+    // The cached availability was out of date, so report what a fresh check
+    // would have, and check again next time.
+    std::optional<Availability> actual_availability;
+    switch (consent_result) {
+      case UserConsentVerificationResult::DeviceNotPresent:
+        actual_availability = Availability::DeviceNotPresent;
+        break;
+      case UserConsentVerificationResult::NotConfiguredForUser:
+        actual_availability = Availability::NotConfiguredForUser;
+        break;
+      case UserConsentVerificationResult::DisabledByPolicy:
+        actual_availability = Availability::DisabledByPolicy;
+        break;
+      default:
+        break;
+    }
+    if (actual_availability) {
+      InvalidateAvailability();
+      result(ErrorForAvailability(actual_availability.value()).value());
+      co_return;
+    }
 
-    result(consent_result == winrt::Windows::Security::Credentials::UI::
-                                 UserConsentVerificationResult::Verified);
+    result(consent_result == UserConsentVerificationResult::Verified);
   } catch (...) {
     result(false);
   }
 }
 
-// Returns whether the device supports Windows Hello or not.
-winrt::fire_and_forget LocalAuthPlugin::IsDeviceSupportedCoroutine(
-    std::function<void(ErrorOr<bool> reply)> result) {
-  winrt::Windows::Security::Credentials::UI::UserConsentVerifierAvailability
-      ucv_availability =
-          co_await user_consent_verifier_->CheckAvailabilityAsync();
-  result(ucv_availability == winrt::Windows::Security::Credentials::UI::
-                                 UserConsentVerifierAvailability::Available);
-}
-
 }  // namespace local_auth_windows
@@ -76,6 +76,13 @@ class LocalAuthApi {
   virtual void Authenticate(
       const std::string& localized_reason,
       std::function<void(ErrorOr<bool> reply)> result) = 0;
+  // Ensures that Windows Hello availability is cached, completing once it
+  // is known.
+  //
+  // Calling this ahead of [isDeviceSupported] or [authenticate] hides the
+  // latency of waking up the biometric sensors.
+  virtual void Prewarm(
+      std::function<void(std::optional<FlutterError> reply)> result) = 0;
 
   // The codec used by LocalAuthApi.
   static const flutter::StandardMessageCodec& GetCodec();
@@ -5,6 +5,7 @@
 #include "include/local_auth_windows/local_auth_plugin.h"
 
 #include <gmock/gmock.h>
+#include <dbt.h>
 #include <gtest/gtest.h>
 #include <windows.h>
 
@@ -135,5 +136,154 @@ TEST(LocalAuthPlugin, AuthenticateHandlerWorksWhenNotAuthorized) {
   EXPECT_FALSE(result.value());
 }
 
+TEST(LocalAuthPlugin, IsDeviceSupportedUsesCachedAvailability) {
+  std::unique_ptr<MockUserConsentVerifier> mockConsentVerifier =
+      std::make_unique<MockUserConsentVerifier>();
+
+  EXPECT_CALL(*mockConsentVerifier, CheckAvailabilityAsync)
+      .Times(1)
+      .WillOnce([]() -> winrt::Windows::Foundation::IAsyncOperation<
+                         winrt::Windows::Security::Credentials::UI::
+                             UserConsentVerifierAvailability> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerifierAvailability::Available;
+      });
+
+  LocalAuthPlugin plugin(std::move(mockConsentVerifier));
+  for (int i = 0; i < 2; ++i) {
+    ErrorOr<bool> result(false);
+    plugin.IsDeviceSupported(
+        [&result](ErrorOr<bool> reply) { result = reply; });
+
+    EXPECT_FALSE(result.has_error());
+    EXPECT_TRUE(result.value());
+  }
+}
+
+TEST(LocalAuthPlugin, DeviceChangeInvalidatesCachedAvailability) {
+  std::unique_ptr<MockUserConsentVerifier> mockConsentVerifier =
+      std::make_unique<MockUserConsentVerifier>();
+
+  EXPECT_CALL(*mockConsentVerifier, CheckAvailabilityAsync)
+      .Times(2)
+      .WillOnce([]() -> winrt::Windows::Foundation::IAsyncOperation<
+                         winrt::Windows::Security::Credentials::UI::
+                             UserConsentVerifierAvailability> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerifierAvailability::DeviceNotPresent;
+      })
+      .WillOnce([]() -> winrt::Windows::Foundation::IAsyncOperation<
+                         winrt::Windows::Security::Credentials::UI::
+                             UserConsentVerifierAvailability> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerifierAvailability::Available;
+      });
+
+  LocalAuthPlugin plugin(std::move(mockConsentVerifier));
+  ErrorOr<bool> result(true);
+  plugin.IsDeviceSupported([&result](ErrorOr<bool> reply) { result = reply; });
+  EXPECT_FALSE(result.value());
+
+  // The refresh starts immediately, rather than on the next request.
+  plugin.HandleWindowProc(nullptr, WM_DEVICECHANGE, DBT_DEVNODES_CHANGED, 0);
+
+  plugin.IsDeviceSupported([&result](ErrorOr<bool> reply) { result = reply; });
+  EXPECT_FALSE(result.has_error());
+  EXPECT_TRUE(result.value());
+}
+
+TEST(LocalAuthPlugin, PrewarmChecksAvailability) {
+  std::unique_ptr<MockUserConsentVerifier> mockConsentVerifier =
+      std::make_unique<MockUserConsentVerifier>();
+
+  EXPECT_CALL(*mockConsentVerifier, CheckAvailabilityAsync)
+      .Times(1)
+      .WillOnce([]() -> winrt::Windows::Foundation::IAsyncOperation<
+                         winrt::Windows::Security::Credentials::UI::
+                             UserConsentVerifierAvailability> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerifierAvailability::Available;
+      });
+
+  LocalAuthPlugin plugin(std::move(mockConsentVerifier));
+  bool prewarmed = false;
+  plugin.Prewarm([&prewarmed](std::optional<FlutterError> reply) {
+    EXPECT_FALSE(reply.has_value());
+    prewarmed = true;
+  });
+  EXPECT_TRUE(prewarmed);
+
+  // Uses the availability from the prewarm call.
+  ErrorOr<bool> result(false);
+  plugin.IsDeviceSupported([&result](ErrorOr<bool> reply) { result = reply; });
+  EXPECT_TRUE(result.value());
+}
+
+TEST(LocalAuthPlugin, AuthenticateHandlerFailsWhenNotEnrolled) {
+  std::unique_ptr<MockUserConsentVerifier> mockConsentVerifier =
+      std::make_unique<MockUserConsentVerifier>();
+
+  EXPECT_CALL(*mockConsentVerifier, CheckAvailabilityAsync)
+      .Times(1)
+      .WillOnce([]() -> winrt::Windows::Foundation::IAsyncOperation<
+                         winrt::Windows::Security::Credentials::UI::
+                             UserConsentVerifierAvailability> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerifierAvailability::NotConfiguredForUser;
+      });
+  EXPECT_CALL(*mockConsentVerifier, RequestVerificationForWindowAsync)
+      .Times(0);
+
+  LocalAuthPlugin plugin(std::move(mockConsentVerifier));
+  ErrorOr<bool> result(true);
+  plugin.Authenticate("My Reason",
+                      [&result](ErrorOr<bool> reply) { result = reply; });
+
+  ASSERT_TRUE(result.has_error());
+  EXPECT_EQ(result.error().code(), "NotEnrolled");
+}
+
+TEST(LocalAuthPlugin, AuthenticateHandlerReportsStaleCachedAvailability) {
+  std::unique_ptr<MockUserConsentVerifier> mockConsentVerifier =
+      std::make_unique<MockUserConsentVerifier>();
+
+  EXPECT_CALL(*mockConsentVerifier, CheckAvailabilityAsync)
+      .Times(2)
+      .WillOnce([]() -> winrt::Windows::Foundation::IAsyncOperation<
+                         winrt::Windows::Security::Credentials::UI::
+                             UserConsentVerifierAvailability> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerifierAvailability::Available;
+      })
+      .WillOnce([]() -> winrt::Windows::Foundation::IAsyncOperation<
+                         winrt::Windows::Security::Credentials::UI::
+                             UserConsentVerifierAvailability> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerifierAvailability::DeviceNotPresent;
+      });
+
+  EXPECT_CALL(*mockConsentVerifier, RequestVerificationForWindowAsync)
+      .Times(1)
+      .WillOnce([](std::wstring localizedReason)
+                    -> winrt::Windows::Foundation::IAsyncOperation<
+                        winrt::Windows::Security::Credentials::UI::
+                            UserConsentVerificationResult> {
+        co_return winrt::Windows::Security::Credentials::UI::
+            UserConsentVerificationResult::DeviceNotPresent;
+      });
+
+  LocalAuthPlugin plugin(std::move(mockConsentVerifier));
+  ErrorOr<bool> result(true);
+  plugin.Authenticate("My Reason",
+                      [&result](ErrorOr<bool> reply) { result = reply; });
+
+  ASSERT_TRUE(result.has_error());
+  EXPECT_EQ(result.error().code(), "NoHardware");
+
+  plugin.IsDeviceSupported([&result](ErrorOr<bool> reply) { result = reply; });
+  EXPECT_FALSE(result.has_error());
+  EXPECT_FALSE(result.value());
+}
+
 }  // namespace test
 }  // namespace local_auth_windows
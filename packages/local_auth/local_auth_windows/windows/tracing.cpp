@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tracing.h"
+
+namespace local_auth_windows {
+
+// The provider id is derived from the provider name, so that tracing tools
+// can enable it as "*Flutter.LocalAuth.Windows".
+TRACELOGGING_DEFINE_PROVIDER(
+    g_local_auth_trace_provider, "Flutter.LocalAuth.Windows",
+    // {73d90494-69e6-5407-4b4a-c78c7954101b}
+    (0x73d90494, 0x69e6, 0x5407, 0x4b, 0x4a, 0xc7, 0x8c, 0x79, 0x54, 0x10,
+     0x1b));
+
+namespace {
+
+windows_plugin_utils::TraceProviderRegistration& GetRegistration() {
+  static windows_plugin_utils::TraceProviderRegistration registration(
+      g_local_auth_trace_provider);
+  return registration;
+}
+
+}  // namespace
+
+void RegisterTraceProvider() { GetRegistration().Register(); }
+
+void UnregisterTraceProvider() { GetRegistration().Unregister(); }
+
+}  // namespace local_auth_windows
@@ -39,6 +39,26 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   return (result == [NSNull null]) ? nil : result;
 }
 
+static void WriteInteger(FlutterStandardWriter *writer, NSInteger value) {
+  int64_t int64Value = value;
+  [writer writeByte:4];
+  [writer writeBytes:&int64Value length:sizeof(int64Value)];
+}
+
+static NSInteger ReadInteger(FlutterStandardReader *reader) {
+  UInt8 type = [reader readByte];
+  if (type == 3) {
+    int32_t value;
+    [reader readBytes:&value length:sizeof(value)];
+    return value;
+  } else if (type == 4) {
+    int64_t value;
+    [reader readBytes:&value length:sizeof(value)];
+    return (NSInteger)value;
+  }
+  return [[reader readValueOfType:type] integerValue];
+}
+
 @implementation PGNCodeBox
 - (instancetype)initWithValue:(PGNCode)value {
   self = [super init];
@@ -53,6 +73,8 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (PGNMessageData *)fromList:(NSArray *)list;
 + (nullable PGNMessageData *)nullableFromList:(NSArray *)list;
 - (NSArray *)toList;
++ (nullable PGNMessageData *)nullableFromCodecReader:(FlutterStandardReader *)reader;
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer;
 @end
 
 @implementation PGNMessageData
@@ -78,6 +100,19 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (nullable PGNMessageData *)nullableFromList:(NSArray *)list {
   return (list) ? [PGNMessageData fromList:list] : nil;
 }
++ (nullable PGNMessageData *)nullableFromCodecReader:(FlutterStandardReader *)reader {
+  UInt8 type = [reader readByte];
+  if (type != 12) {
+    return [PGNMessageData nullableFromList:[reader readValueOfType:type]];
+  }
+  [reader readSize];
+  PGNMessageData *pigeonResult = [[PGNMessageData alloc] init];
+  pigeonResult.name = [reader readValue];
+  pigeonResult.description = [reader readValue];
+  pigeonResult.code = ReadInteger(reader);
+  pigeonResult.data = [reader readValue];
+  return pigeonResult;
+}
 - (NSArray *)toList {
   return @[
     self.name ?: [NSNull null],
@@ -86,6 +121,14 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     self.data ?: [NSNull null],
   ];
 }
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer {
+  [writer writeByte:12];
+  [writer writeSize:4];
+  [writer writeValue:self.name];
+  [writer writeValue:self.description];
+  WriteInteger(writer, self.code);
+  [writer writeValue:self.data];
+}
 @end
 
 @interface PGNExampleHostApiCodecReader : FlutterStandardReader
@@ -94,7 +137,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (nullable id)readValueOfType:(UInt8)type {
   switch (type) {
     case 128:
-      return [PGNMessageData fromList:[self readValue]];
+      return [PGNMessageData nullableFromCodecReader:self];
     default:
       return [super readValueOfType:type];
   }
@@ -107,7 +150,7 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (void)writeValue:(id)value {
   if ([value isKindOfClass:[PGNMessageData class]]) {
     [self writeByte:128];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else {
     [super writeValue:value];
   }
@@ -13,9 +13,12 @@
 #include <flutter/encodable_value.h>
 #include <flutter/standard_message_codec.h>
 
+#include <cstring>
 #include <map>
 #include <optional>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace pigeon_example {
 using flutter::BasicMessageChannel;
@@ -24,26 +27,272 @@ using flutter::EncodableList;
 using flutter::EncodableMap;
 using flutter::EncodableValue;
 
-FlutterError CreateConnectionError(const std::string channel_name) {
+FlutterError CreateConnectionError(const std::string& channel_name) {
   return FlutterError(
       "channel-error",
       "Unable to establish connection on channel: '" + channel_name + "'.",
       EncodableValue(""));
 }
 
+namespace {
+// Writes |size| in the standard codec's variable length encoding.
+void WriteSize(size_t size, flutter::ByteStreamWriter* stream) {
+  if (size < 254) {
+    stream->WriteByte(static_cast<uint8_t>(size));
+  } else if (size <= 0xffff) {
+    stream->WriteByte(254);
+    const uint16_t value = static_cast<uint16_t>(size);
+    stream->WriteBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+  } else {
+    stream->WriteByte(255);
+    const uint32_t value = static_cast<uint32_t>(size);
+    stream->WriteBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+  }
+}
+
+// Writes the header of a list of |size| values.
+void WriteListHeader(size_t size, flutter::ByteStreamWriter* stream) {
+  stream->WriteByte(12);
+  WriteSize(size, stream);
+}
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteString(const std::string& value, flutter::ByteStreamWriter* stream) {
+  stream->WriteByte(7);
+  WriteSize(value.size(), stream);
+  if (!value.empty()) {
+    stream->WriteBytes(reinterpret_cast<const uint8_t*>(value.data()),
+                       value.size());
+  }
+}
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteMap(const EncodableMap& value,
+              const flutter::StandardCodecSerializer& serializer,
+              flutter::ByteStreamWriter* stream) {
+  stream->WriteByte(13);
+  WriteSize(value.size(), stream);
+  for (const auto& pair : value) {
+    serializer.WriteValue(pair.first, stream);
+    serializer.WriteValue(pair.second, stream);
+  }
+}
+}  // namespace
+
+namespace {
+// Reads a message in place from the buffer it was received in, rather than
+// decoding it into a heap-allocated EncodableValue.
+class MessageReader : public flutter::ByteStreamReader {
+ public:
+  MessageReader(const uint8_t* bytes, size_t size)
+      : bytes_(bytes), size_(size) {}
+
+  // Returns true if a read went past the end of the message, or found a
+  // value of an unexpected type.
+  bool has_error() const { return has_error_; }
+
+  uint8_t ReadByte() override {
+    if (location_ >= size_) {
+      has_error_ = true;
+      return 0;
+    }
+    return bytes_[location_++];
+  }
+
+  void ReadBytes(uint8_t* buffer, size_t length) override {
+    if (length > size_ - location_) {
+      has_error_ = true;
+      location_ = size_;
+      return;
+    }
+    std::memcpy(buffer, bytes_ + location_, length);
+    location_ += length;
+  }
+
+  void ReadAlignment(uint8_t alignment) override {
+    const size_t mod = location_ % alignment;
+    if (mod != 0) {
+      const size_t padding = alignment - mod;
+      location_ = padding > size_ - location_ ? size_ : location_ + padding;
+    }
+  }
+
+ protected:
+  // Reads a size in the standard codec's variable length encoding.
+  size_t ReadSize() {
+    const uint8_t byte = ReadByte();
+    if (byte < 254) {
+      return byte;
+    }
+    if (byte == 254) {
+      uint16_t value = 0;
+      ReadBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+      return value;
+    }
+    uint32_t value = 0;
+    ReadBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    return value;
+  }
+
+  const uint8_t* bytes_;
+  size_t size_;
+  size_t location_ = 0;
+  bool has_error_ = false;
+};
+
+// Writes a message into a buffer owned by the current thread, which is reused
+// by every message sent from that thread. Once the buffer has grown to fit the
+// largest message, encoding a message does not allocate.
+//
+// BinaryMessenger::Send copies the message, so the buffer can be reused as
+// soon as it returns. Only one writer may be alive on a thread at a time.
+class MessageWriter : public flutter::ByteStreamWriter {
+ public:
+  MessageWriter() : buffer_(GetThreadBuffer()) { buffer_.clear(); }
+
+  const uint8_t* data() const { return buffer_.data(); }
+  size_t size() const { return buffer_.size(); }
+
+  void WriteByte(uint8_t byte) override { buffer_.push_back(byte); }
+
+  void WriteBytes(const uint8_t* bytes, size_t length) override {
+    buffer_.insert(buffer_.end(), bytes, bytes + length);
+  }
+
+  void WriteAlignment(uint8_t alignment) override {
+    const size_t mod = buffer_.size() % alignment;
+    if (mod != 0) {
+      buffer_.insert(buffer_.end(), alignment - mod, 0);
+    }
+  }
+
+ private:
+  static std::vector<uint8_t>& GetThreadBuffer() {
+    thread_local std::vector<uint8_t> buffer;
+    return buffer;
+  }
+
+  std::vector<uint8_t>& buffer_;
+};
+}  // namespace
+
+namespace {
+// Wraps an error in the reply to a host API method.
+EncodableValue PigeonWrapError(std::string_view error_message) {
+  return EncodableValue(
+      EncodableList{EncodableValue(std::string(error_message)),
+                    EncodableValue("Error"), EncodableValue()});
+}
+
+EncodableValue PigeonWrapError(const FlutterError& error) {
+  return EncodableValue(EncodableList{EncodableValue(error.code()),
+                                      EncodableValue(error.message()),
+                                      error.details()});
+}
+
+// Wraps a value returned by a host API method in |Wrapper|, which is
+// EncodableValue or CustomEncodableValue. Enums are sent as their index.
+template <typename Wrapper, typename T>
+EncodableValue PigeonWrapValue(T&& value) {
+  if constexpr (std::is_enum_v<std::decay_t<T>>) {
+    return Wrapper(static_cast<int>(value));
+  } else {
+    return Wrapper(std::forward<T>(value));
+  }
+}
+
+template <typename Wrapper, typename T>
+EncodableValue PigeonWrapValue(std::optional<T>&& value) {
+  if (!value) {
+    return EncodableValue();
+  }
+  return PigeonWrapValue<Wrapper>(std::move(value).value());
+}
+
+// Sends the value or the error returned by a host API method.
+//
+// Ideally this code would use an initializer list to create an EncodableList
+// inline, which would be less code. However, that would always copy the
+// element, so the slightly more verbose create-and-push approach is used
+// instead.
+template <typename Wrapper, typename T, typename Reply>
+void PigeonReply(const Reply& reply, ErrorOr<T>&& output) {
+  if (output.has_error()) {
+    reply(PigeonWrapError(output.error()));
+    return;
+  }
+  EncodableList wrapped;
+  wrapped.push_back(PigeonWrapValue<Wrapper>(std::move(output).TakeValue()));
+  reply(EncodableValue(std::move(wrapped)));
+}
+
+// Sends the error returned by a host API method that returns void, if any.
+template <typename Reply>
+void PigeonReply(const Reply& reply, std::optional<FlutterError>&& output) {
+  if (output.has_value()) {
+    reply(PigeonWrapError(output.value()));
+    return;
+  }
+  EncodableList wrapped;
+  wrapped.push_back(EncodableValue());
+  reply(EncodableValue(std::move(wrapped)));
+}
+
+// Unwraps the arguments of a message to a host API method, calls the method
+// on |host_api| and replies.
+template <typename Api>
+using PigeonHostMethodHandler =
+    void (*)(Api* host_api, const EncodableValue& message,
+             const flutter::MessageReply<EncodableValue>& reply);
+
+// Handles the messages on |channel_name| with |handler|, or removes the
+// handler if |api| is null.
+//
+// Handlers are plain functions, so that every method of |Api| shares one
+// message handler type.
+template <typename Api>
+void PigeonSetUpHostMethod(flutter::BinaryMessenger* binary_messenger,
+                           const char* channel_name,
+                           const flutter::MessageCodec<EncodableValue>* codec,
+                           Api* api, PigeonHostMethodHandler<Api> handler) {
+  BasicMessageChannel<> channel(binary_messenger, channel_name, codec);
+  if (api == nullptr) {
+    channel.SetMessageHandler(nullptr);
+    return;
+  }
+  channel.SetMessageHandler(
+      [api, handler](const EncodableValue& message,
+                     const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          handler(api, message, reply);
+        } catch (const std::exception& exception) {
+          // There is a potential here for `reply` to be called twice, which
+          // is a violation of the API contract, because there's no way of
+          // knowing whether or not the plugin code called `reply` before
+          // throwing. Since use of `@async` suggests that the reply is
+          // probably not sent within the scope of the stack, err on the
+          // side of potential double-call rather than no call (which is
+          // also an API violation) so that unexpected errors have a better
+          // chance of being caught and handled in a useful way.
+          reply(PigeonWrapError(exception.what()));
+        }
+      });
+}
+}  // namespace
+
 // MessageData
 
-MessageData::MessageData(const Code& code, const EncodableMap& data)
-    : code_(code), data_(data) {}
+MessageData::MessageData(const Code& code, EncodableMap data)
+    : code_(code), data_(std::move(data)) {}
 
 MessageData::MessageData(const std::string* name,
                          const std::string* description, const Code& code,
-                         const EncodableMap& data)
+                         EncodableMap data)
     : name_(name ? std::optional<std::string>(*name) : std::nullopt),
       description_(description ? std::optional<std::string>(*description)
                                : std::nullopt),
       code_(code),
-      data_(data) {}
+      data_(std::move(data)) {}
 
 const std::string* MessageData::name() const {
   return name_ ? &(*name_) : nullptr;
@@ -76,6 +325,10 @@ const EncodableMap& MessageData::data() const { return data_; }
 
 void MessageData::set_data(const EncodableMap& value_arg) { data_ = value_arg; }
 
+void MessageData::set_data(EncodableMap&& value_arg) {
+  data_ = std::move(value_arg);
+}
+
 EncodableList MessageData::ToEncodableList() const {
   EncodableList list;
   list.reserve(4);
@@ -87,16 +340,35 @@ EncodableList MessageData::ToEncodableList() const {
   return list;
 }
 
-MessageData MessageData::FromEncodableList(const EncodableList& list) {
+void MessageData::WriteEncodableList(
+    const flutter::StandardCodecSerializer& serializer,
+    flutter::ByteStreamWriter* stream) const {
+  WriteListHeader(4, stream);
+  if (name_) {
+    WriteString(*name_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (description_) {
+    WriteString(*description_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  serializer.WriteValue(EncodableValue((int)code_), stream);
+  WriteMap(data_, serializer, stream);
+}
+
+MessageData MessageData::FromEncodableList(EncodableList list) {
   MessageData decoded((Code)(std::get<int32_t>(list[2])),
-                      std::get<EncodableMap>(list[3]));
+                      std::get<EncodableMap>(std::move(list[3])));
   auto& encodable_name = list[0];
   if (!encodable_name.IsNull()) {
-    decoded.set_name(std::get<std::string>(encodable_name));
+    decoded.set_name(std::get<std::string>(std::move(encodable_name)));
   }
   auto& encodable_description = list[1];
   if (!encodable_description.IsNull()) {
-    decoded.set_description(std::get<std::string>(encodable_description));
+    decoded.set_description(
+        std::get<std::string>(std::move(encodable_description)));
   }
   return decoded;
 }
@@ -120,10 +392,8 @@ void ExampleHostApiCodecSerializer::WriteValue(
           std::get_if<CustomEncodableValue>(&value)) {
     if (custom_value->type() == typeid(MessageData)) {
       stream->WriteByte(128);
-      WriteValue(
-          EncodableValue(
-              std::any_cast<MessageData>(*custom_value).ToEncodableList()),
-          stream);
+      std::any_cast<const MessageData&>(*custom_value)
+          .WriteEncodableList(*this, stream);
       return;
     }
   }
@@ -140,120 +410,62 @@ const flutter::StandardMessageCodec& ExampleHostApi::GetCodec() {
 // `binary_messenger`.
 void ExampleHostApi::SetUp(flutter::BinaryMessenger* binary_messenger,
                            ExampleHostApi* api) {
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_example_package.ExampleHostApi."
-        "getHostLanguage",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              ErrorOr<std::string> output = api->GetHostLanguage();
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_example_package.ExampleHostApi.add",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_arg = args.at(0);
-              if (encodable_a_arg.IsNull()) {
-                reply(WrapError("a_arg unexpectedly null."));
-                return;
-              }
-              const int64_t a_arg = encodable_a_arg.LongValue();
-              const auto& encodable_b_arg = args.at(1);
-              if (encodable_b_arg.IsNull()) {
-                reply(WrapError("b_arg unexpectedly null."));
-                return;
-              }
-              const int64_t b_arg = encodable_b_arg.LongValue();
-              ErrorOr<int64_t> output = api->Add(a_arg, b_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_example_package.ExampleHostApi.sendMessage",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_message_arg = args.at(0);
-              if (encodable_message_arg.IsNull()) {
-                reply(WrapError("message_arg unexpectedly null."));
-                return;
-              }
-              const auto& message_arg = std::any_cast<const MessageData&>(
-                  std::get<CustomEncodableValue>(encodable_message_arg));
-              api->SendMessage(message_arg, [reply](ErrorOr<bool>&& output) {
-                if (output.has_error()) {
-                  reply(WrapError(output.error()));
-                  return;
-                }
-                EncodableList wrapped;
-                wrapped.push_back(
-                    EncodableValue(std::move(output).TakeValue()));
-                reply(EncodableValue(std::move(wrapped)));
-              });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
+  PigeonSetUpHostMethod<ExampleHostApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_example_package.ExampleHostApi."
+      "getHostLanguage",
+      &GetCodec(), api,
+      [](ExampleHostApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        PigeonReply<EncodableValue>(reply, host_api->GetHostLanguage());
+      });
+  PigeonSetUpHostMethod<ExampleHostApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_example_package.ExampleHostApi.add",
+      &GetCodec(), api,
+      [](ExampleHostApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_arg = args.at(0);
+        if (encodable_a_arg.IsNull()) {
+          reply(WrapError("a_arg unexpectedly null."));
+          return;
+        }
+        const int64_t a_arg = encodable_a_arg.LongValue();
+        const auto& encodable_b_arg = args.at(1);
+        if (encodable_b_arg.IsNull()) {
+          reply(WrapError("b_arg unexpectedly null."));
+          return;
+        }
+        const int64_t b_arg = encodable_b_arg.LongValue();
+        PigeonReply<EncodableValue>(reply, host_api->Add(a_arg, b_arg));
+      });
+  PigeonSetUpHostMethod<ExampleHostApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_example_package.ExampleHostApi.sendMessage",
+      &GetCodec(), api,
+      [](ExampleHostApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_message_arg = args.at(0);
+        if (encodable_message_arg.IsNull()) {
+          reply(WrapError("message_arg unexpectedly null."));
+          return;
+        }
+        const auto& message_arg = std::any_cast<const MessageData&>(
+            std::get<CustomEncodableValue>(encodable_message_arg));
+        host_api->SendMessage(message_arg, [reply](ErrorOr<bool>&& output) {
+          PigeonReply<EncodableValue>(reply, std::move(output));
+        });
+      });
 }
 
 EncodableValue ExampleHostApi::WrapError(std::string_view error_message) {
-  return EncodableValue(
-      EncodableList{EncodableValue(std::string(error_message)),
-                    EncodableValue("Error"), EncodableValue()});
+  return PigeonWrapError(error_message);
 }
 
 EncodableValue ExampleHostApi::WrapError(const FlutterError& error) {
-  return EncodableValue(EncodableList{EncodableValue(error.code()),
-                                      EncodableValue(error.message()),
-                                      error.details()});
+  return PigeonWrapError(error);
 }
 
 // Generated class from Pigeon that represents Flutter messages that can be
@@ -273,18 +485,27 @@ void MessageFlutterApi::FlutterMethod(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_example_package.MessageFlutterApi."
       "flutterMethod";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_string_arg ? EncodableValue(*a_string_arg) : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  flutter::StandardCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              flutter::StandardCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -21,12 +21,14 @@ namespace pigeon_example {
 
 class FlutterError {
  public:
-  explicit FlutterError(const std::string& code) : code_(code) {}
-  explicit FlutterError(const std::string& code, const std::string& message)
-      : code_(code), message_(message) {}
-  explicit FlutterError(const std::string& code, const std::string& message,
-                        const flutter::EncodableValue& details)
-      : code_(code), message_(message), details_(details) {}
+  explicit FlutterError(std::string code) : code_(std::move(code)) {}
+  explicit FlutterError(std::string code, std::string message)
+      : code_(std::move(code)), message_(std::move(message)) {}
+  explicit FlutterError(std::string code, std::string message,
+                        flutter::EncodableValue details)
+      : code_(std::move(code)),
+        message_(std::move(message)),
+        details_(std::move(details)) {}
 
   const std::string& code() const { return code_; }
   const std::string& message() const { return message_; }
@@ -42,19 +44,20 @@ template <class T>
 class ErrorOr {
  public:
   ErrorOr(const T& rhs) : v_(rhs) {}
-  ErrorOr(const T&& rhs) : v_(std::move(rhs)) {}
+  ErrorOr(T&& rhs) : v_(std::move(rhs)) {}
   ErrorOr(const FlutterError& rhs) : v_(rhs) {}
-  ErrorOr(const FlutterError&& rhs) : v_(std::move(rhs)) {}
+  ErrorOr(FlutterError&& rhs) : v_(std::move(rhs)) {}
 
   bool has_error() const { return std::holds_alternative<FlutterError>(v_); }
   const T& value() const { return std::get<T>(v_); };
   const FlutterError& error() const { return std::get<FlutterError>(v_); };
+  // Moves the value out of the result, which must not be an error.
+  T TakeValue() && { return std::get<T>(std::move(v_)); }
 
  private:
   friend class ExampleHostApi;
   friend class MessageFlutterApi;
   ErrorOr() = default;
-  T TakeValue() && { return std::get<T>(std::move(v_)); }
 
   std::variant<T, FlutterError> v_;
 };
@@ -65,11 +68,11 @@ enum class Code { one = 0, two = 1 };
 class MessageData {
  public:
   // Constructs an object setting all non-nullable fields.
-  explicit MessageData(const Code& code, const flutter::EncodableMap& data);
+  explicit MessageData(const Code& code, flutter::EncodableMap data);
 
   // Constructs an object setting all fields.
   explicit MessageData(const std::string* name, const std::string* description,
-                       const Code& code, const flutter::EncodableMap& data);
+                       const Code& code, flutter::EncodableMap data);
 
   const std::string* name() const;
   void set_name(const std::string_view* value_arg);
@@ -84,10 +87,13 @@ class MessageData {
 
   const flutter::EncodableMap& data() const;
   void set_data(const flutter::EncodableMap& value_arg);
+  void set_data(flutter::EncodableMap&& value_arg);
 
  private:
-  static MessageData FromEncodableList(const flutter::EncodableList& list);
+  static MessageData FromEncodableList(flutter::EncodableList list);
   flutter::EncodableList ToEncodableList() const;
+  void WriteEncodableList(const flutter::StandardCodecSerializer& serializer,
+                          flutter::ByteStreamWriter* stream) const;
   friend class ExampleHostApi;
   friend class ExampleHostApiCodecSerializer;
   friend class MessageFlutterApi;
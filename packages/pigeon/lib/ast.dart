@@ -34,6 +34,8 @@ class Method extends Node {
     this.objcSelector = '',
     this.swiftFunction = '',
     this.taskQueueType = TaskQueueType.serial,
+    this.cppZeroCopy = false,
+    this.objcZeroCopy = false,
     this.documentationComments = const <String>[],
   });
 
@@ -61,6 +63,14 @@ class Method extends Node {
   /// Specifies how handlers are dispatched with respect to threading.
   TaskQueueType taskQueueType;
 
+  /// Whether the C++ host implementation receives typed data arguments as
+  /// views into the message buffer rather than as copies.
+  bool cppZeroCopy;
+
+  /// Whether the Objective-C host implementation receives typed data
+  /// arguments as views of the incoming message rather than as copies.
+  bool objcZeroCopy;
+
   /// List of documentation comments, separated by line.
   ///
   /// Lines should not include the comment marker itself, but should include any
@@ -86,6 +96,10 @@ class Api extends Node {
     required this.location,
     required this.methods,
     this.dartHostTestHandler,
+    this.isBatched = false,
+    this.singleChannel = false,
+    this.isStream = false,
+    this.isFfi = false,
     this.documentationComments = const <String>[],
   });
 
@@ -101,6 +115,24 @@ class Api extends Node {
   /// The name of the Dart test interface to generate to help with testing.
   String? dartHostTestHandler;
 
+  /// Whether calls to this Flutter API are buffered on the host and sent to
+  /// Flutter together, where the generator supports it.
+  bool isBatched;
+
+  /// Whether all methods of this host API are received on one channel, where
+  /// the generator supports it.
+  bool singleChannel;
+
+  /// Whether each method of this host API is a stream of events sent to
+  /// Flutter, where the generator supports it.
+  ///
+  /// The return type of a method is the type of its events.
+  bool isStream;
+
+  /// Whether the methods of this host API are called through `dart:ffi`
+  /// instead of a channel, where the generator supports it.
+  bool isFfi;
+
   /// List of documentation comments, separated by line.
   ///
   /// Lines should not include the comment marker itself, but should include any
@@ -6,7 +6,7 @@ import 'ast.dart';
 import 'functional.dart';
 import 'generator.dart';
 import 'generator_tools.dart';
-import 'pigeon_lib.dart' show Error;
+import 'pigeon_lib.dart' show Error, TaskQueueType;
 
 /// General comment opening token.
 const String _commentPrefix = '//';
@@ -28,6 +28,9 @@ class CppOptions {
     this.namespace,
     this.copyrightHeader,
     this.headerOutPath,
+    this.useCoroutines,
+    this.lazyDecoding,
+    this.typedCollections,
   });
 
   /// The path to the header that will get placed in the source filed (example:
@@ -43,6 +46,28 @@ class CppOptions {
   /// The path to the output header file location.
   final String? headerOutPath;
 
+  /// Whether asynchronous host API methods return an awaitable `Task` for use
+  /// with C++20 coroutines, rather than taking a result callback.
+  ///
+  /// The generated code must then be compiled as C++20.
+  final bool? useCoroutines;
+
+  /// Whether data class fields holding other data classes are decoded on
+  /// first access, rather than when the enclosing class is decoded.
+  ///
+  /// Getters for those fields then modify the object, so a decoded object
+  /// must not be read from multiple threads at once.
+  final bool? lazyDecoding;
+
+  /// Whether data class fields of typed `List` and `Map` types are stored as
+  /// `std::vector` and `std::map` of their element types, rather than as
+  /// `flutter::EncodableList` and `flutter::EncodableMap`.
+  ///
+  /// Only `bool`, `int`, `double`, `String` and data class elements are
+  /// supported, and data classes can't be map keys. Other fields keep the
+  /// untyped collections.
+  final bool? typedCollections;
+
   /// Creates a [CppOptions] from a Map representation where:
   /// `x = CppOptions.fromMap(x.toMap())`.
   static CppOptions fromMap(Map<String, Object> map) {
@@ -51,6 +76,9 @@ class CppOptions {
       namespace: map['namespace'] as String?,
       copyrightHeader: map['copyrightHeader'] as Iterable<String>?,
       headerOutPath: map['cppHeaderOut'] as String?,
+      useCoroutines: map['useCoroutines'] as bool?,
+      lazyDecoding: map['lazyDecoding'] as bool?,
+      typedCollections: map['typedCollections'] as bool?,
     );
   }
 
@@ -61,6 +89,9 @@ class CppOptions {
       if (headerIncludePath != null) 'header': headerIncludePath!,
       if (namespace != null) 'namespace': namespace!,
       if (copyrightHeader != null) 'copyrightHeader': copyrightHeader!,
+      if (useCoroutines != null) 'useCoroutines': useCoroutines!,
+      if (lazyDecoding != null) 'lazyDecoding': lazyDecoding!,
+      if (typedCollections != null) 'typedCollections': typedCollections!,
     };
     return result;
   }
@@ -136,16 +167,31 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
     indent.writeln('#ifndef $guardName');
     indent.writeln('#define $guardName');
 
+    final bool hasStreamApis = _hasStreamApis(root);
     _writeSystemHeaderIncludeBlock(indent, <String>[
       'flutter/basic_message_channel.h',
       'flutter/binary_messenger.h',
       'flutter/encodable_value.h',
+      if (hasStreamApis) ...<String>[
+        'flutter/event_channel.h',
+        'flutter/event_sink.h',
+      ],
       'flutter/standard_message_codec.h',
+      if (hasStreamApis) 'flutter/standard_method_codec.h',
     ]);
     indent.newln();
+    final bool hasBackgroundMethods = _hasBackgroundTaskQueueMethods(root);
+    final bool hasTasks = _usesCoroutineTasks(generatorOptions, root);
     _writeSystemHeaderIncludeBlock(indent, <String>[
+      if (hasTasks) 'coroutine',
+      if (hasStreamApis) 'deque',
+      if (hasTasks) 'exception',
+      if (hasBackgroundMethods || hasStreamApis) 'functional',
       'map',
+      if (hasStreamApis) 'memory',
       'string',
+      if (hasTasks) 'utility',
+      if (_hasTypedCollectionFields(generatorOptions, root)) 'vector',
       'optional',
     ]);
     indent.newln();
@@ -200,6 +246,21 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
     if (hasHostApi) {
       _writeErrorOr(indent, friends: root.apis.map((Api api) => api.name));
     }
+    if (_hasZeroCopyMethods(root)) {
+      _writeTypedDataView(indent);
+    }
+    if (_hasBackgroundTaskQueueMethods(root)) {
+      _writePlatformTaskRunner(indent);
+    }
+    if (_usesCoroutineTasks(generatorOptions, root)) {
+      _writeTask(indent);
+    }
+    if (_hasStreamApis(root)) {
+      _writeStreamOverflowPolicy(indent);
+    }
+    if (_hasFfiApis(root)) {
+      _writeFfiTypes(indent, root);
+    }
     if (hasFlutterApi) {
       // Nothing yet.
     }
@@ -241,18 +302,20 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
             orderedFields.where((NamedType type) => !type.type.isNullable);
         // Minimal constructor, if needed.
         if (requiredFields.length != orderedFields.length) {
-          _writeClassConstructor(root, indent, classDefinition, requiredFields,
+          _writeClassConstructor(generatorOptions, root, indent,
+              classDefinition, requiredFields,
               'Constructs an object setting all non-nullable fields.');
         }
         // All-field constructor.
-        _writeClassConstructor(root, indent, classDefinition, orderedFields,
+        _writeClassConstructor(generatorOptions, root, indent,
+            classDefinition, orderedFields,
             'Constructs an object setting all fields.');
 
         for (final NamedType field in orderedFields) {
           addDocumentationComments(
               indent, field.documentationComments, _docCommentSpec);
-          final HostDatatype baseDatatype =
-              getFieldHostDatatype(field, _baseCppTypeForBuiltinDartType);
+          final HostDatatype baseDatatype = _getDataClassFieldHostDatatype(
+              generatorOptions, field, _baseCppTypeForBuiltinDartType);
           // Declare a getter and setter.
           _writeFunctionDeclaration(indent, _makeGetterName(field),
               returnType: _getterReturnType(baseDatatype), isConst: true);
@@ -273,17 +336,40 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
                   '${_unownedArgumentType(nonNullType)} value_arg'
                 ]);
           }
+          if (_hasMoveSetter(baseDatatype)) {
+            // Add a setter that takes ownership of the argument, to avoid
+            // copying large values such as typed data.
+            _writeFunctionDeclaration(indent, setterName,
+                returnType: _voidType,
+                parameters: <String>[
+                  '${_nonNullableType(baseDatatype).datatype}&& value_arg'
+                ]);
+          }
           indent.newln();
         }
       });
 
       _writeAccessBlock(indent, _ClassAccess.private, () {
+        if (_hasLazyNonNullableFields(
+            generatorOptions, root, classDefinition)) {
+          // Used by FromEncodableList, which sets the fields directly since
+          // lazy fields have no decoded value to pass to a constructor.
+          _writeFunctionDeclaration(indent, classDefinition.name,
+              isConstructor: true);
+        }
         _writeFunctionDeclaration(indent, 'FromEncodableList',
             returnType: classDefinition.name,
-            parameters: <String>['const flutter::EncodableList& list'],
+            parameters: <String>['flutter::EncodableList list'],
             isStatic: true);
         _writeFunctionDeclaration(indent, 'ToEncodableList',
             returnType: 'flutter::EncodableList', isConst: true);
+        _writeFunctionDeclaration(indent, 'WriteEncodableList',
+            returnType: _voidType,
+            parameters: <String>[
+              'const flutter::StandardCodecSerializer& serializer',
+              'flutter::ByteStreamWriter* stream',
+            ],
+            isConst: true);
         for (final Class friend in root.classes) {
           if (friend != classDefinition &&
               friend.fields.any((NamedType element) =>
@@ -302,10 +388,19 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
         }
 
         for (final NamedType field in orderedFields) {
-          final HostDatatype hostDatatype =
-              getFieldHostDatatype(field, _baseCppTypeForBuiltinDartType);
-          indent.writeln(
-              '${_valueType(hostDatatype)} ${_makeInstanceVariableName(field)};');
+          final HostDatatype hostDatatype = _getDataClassFieldHostDatatype(
+              generatorOptions, field, _baseCppTypeForBuiltinDartType);
+          if (_isLazyField(generatorOptions, root, field)) {
+            // The decoded value, and the encoded value it is decoded from on
+            // first access. At most one of them is set.
+            indent.writeln(
+                'mutable std::optional<${hostDatatype.datatype}> ${_makeInstanceVariableName(field)};');
+            indent.writeln(
+                'mutable std::optional<flutter::EncodableList> ${_makeEncodedInstanceVariableName(field)};');
+          } else {
+            indent.writeln(
+                '${_valueType(hostDatatype)} ${_makeInstanceVariableName(field)};');
+          }
         }
       });
     }, nestCount: 0);
@@ -324,6 +419,10 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
     if (getCodecClasses(api, root).isNotEmpty) {
       _writeCodec(generatorOptions, root, indent, api);
     }
+    if (api.isBatched) {
+      _writeBatchedFlutterApi(indent, api);
+      return;
+    }
     const List<String> generatedMessages = <String>[
       ' Generated class from Pigeon that represents Flutter messages that can be called from C++.'
     ];
@@ -365,6 +464,61 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
     indent.newln();
   }
 
+  void _writeBatchedFlutterApi(Indent indent, Api api) {
+    const List<String> generatedMessages = <String>[
+      ' Generated class from Pigeon that represents Flutter messages that can be called from C++.',
+      '',
+      ' Calls are buffered, and sent to Flutter together in one message when',
+      ' `Flush` is called or `max_batch_size` calls are buffered. Batched calls',
+      ' are one-way, so errors from Flutter are not reported.',
+    ];
+    addDocumentationComments(indent, api.documentationComments, _docCommentSpec,
+        generatorComments: generatedMessages);
+    indent.write('class ${api.name} ');
+    indent.addScoped('{', '};', () {
+      _writeAccessBlock(indent, _ClassAccess.public, () {
+        _writeFunctionDeclaration(indent, api.name,
+            parameters: <String>['flutter::BinaryMessenger* binary_messenger']);
+        _writeFunctionDeclaration(indent, api.name, parameters: <String>[
+          'flutter::BinaryMessenger* binary_messenger',
+          'size_t max_batch_size',
+        ]);
+        _writeFunctionDeclaration(indent, 'GetCodec',
+            returnType: 'const flutter::StandardMessageCodec&', isStatic: true);
+        for (final Method func in api.methods) {
+          addDocumentationComments(
+              indent, func.documentationComments, _docCommentSpec);
+          final Iterable<String> argTypes =
+              func.parameters.map((NamedType arg) {
+            final HostDatatype hostType =
+                getFieldHostDatatype(arg, _baseCppTypeForBuiltinDartType);
+            return _flutterApiArgumentType(hostType);
+          });
+          final Iterable<String> argNames =
+              indexMap(func.parameters, _getArgumentName);
+          _writeFunctionDeclaration(indent, _makeMethodName(func),
+              returnType: _voidType,
+              parameters: map2(argTypes, argNames,
+                  (String x, String y) => '$x $y').toList());
+        }
+        indent.writeln(
+            '$_commentPrefix Sends the buffered calls to Flutter, in the order they were made.');
+        _writeFunctionDeclaration(indent, 'Flush', returnType: _voidType);
+        indent.writeln('$_commentPrefix The number of buffered calls.');
+        _writeFunctionDeclaration(indent, 'pending_call_count',
+            returnType: 'size_t', isConst: true);
+      });
+      indent.addScoped(' private:', null, () {
+        indent.writeln('flutter::BinaryMessenger* binary_messenger_;');
+        indent.writeln('size_t max_batch_size_;');
+        indent.writeln(
+            '$_commentPrefix Method index and argument list pairs of the buffered calls.');
+        indent.writeln('flutter::EncodableList pending_calls_;');
+      });
+    }, nestCount: 0);
+    indent.newln();
+  }
+
   @override
   void writeHostApi(
     CppOptions generatorOptions,
@@ -374,9 +528,19 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
     required String dartPackageName,
   }) {
     assert(api.location == ApiLocation.host);
+    if (api.isFfi) {
+      _writeFfiHostApi(indent, api);
+      return;
+    }
     if (getCodecClasses(api, root).isNotEmpty) {
       _writeCodec(generatorOptions, root, indent, api);
     }
+    if (api.isStream) {
+      for (final Method func in api.methods) {
+        _writeStreamApi(indent, api, func);
+      }
+      return;
+    }
     const List<String> generatedMessages = <String>[
       ' Generated interface from Pigeon that represents a handler of messages from Flutter.'
     ];
@@ -404,6 +568,9 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
           if (method.parameters.isNotEmpty) {
             final Iterable<String> argTypes =
                 method.parameters.map((NamedType arg) {
+              if (_isZeroCopyArgument(method, arg)) {
+                return _zeroCopyArgumentType(arg.type);
+              }
               final HostDatatype hostType =
                   getFieldHostDatatype(arg, _baseCppTypeForBuiltinDartType);
               return _hostApiArgumentType(hostType);
@@ -419,7 +586,10 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
           addDocumentationComments(
               indent, method.documentationComments, _docCommentSpec);
           final String methodReturn;
-          if (method.isAsynchronous) {
+          if (method.isAsynchronous &&
+              (generatorOptions.useCoroutines ?? false)) {
+            methodReturn = 'Task<$returnTypeName>';
+          } else if (method.isAsynchronous) {
             methodReturn = _voidType;
             parameters.add('std::function<void($returnTypeName reply)> result');
           } else {
@@ -437,12 +607,22 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
             returnType: 'const flutter::StandardMessageCodec&', isStatic: true);
         indent.writeln(
             '$_commentPrefix Sets up an instance of `${api.name}` to handle messages through the `binary_messenger`.');
+        if (_hasBackgroundTaskQueueMethods(root, api: api)) {
+          indent.writeln(
+              '$_commentPrefix Methods that use a background task queue run on a thread owned by the API.');
+          indent.writeln(
+              '$_commentPrefix Their replies are posted to `platform_task_runner`, so that they are sent on the platform thread.');
+          indent.writeln(
+              '$_commentPrefix If it is null, those methods reply with an error instead of running.');
+        }
         _writeFunctionDeclaration(indent, 'SetUp',
             returnType: _voidType,
             isStatic: true,
             parameters: <String>[
               'flutter::BinaryMessenger* binary_messenger',
               '${api.name}* api',
+              if (_hasBackgroundTaskQueueMethods(root, api: api))
+                'PlatformTaskRunner platform_task_runner',
             ]);
         _writeFunctionDeclaration(indent, 'WrapError',
             returnType: 'flutter::EncodableValue',
@@ -459,12 +639,189 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
     }, nestCount: 0);
   }
 
-  void _writeClassConstructor(Root root, Indent indent, Class classDefinition,
-      Iterable<NamedType> params, String docComment) {
+  void _writeFfiHostApi(Indent indent, Api api) {
+    const List<String> generatedMessages = <String>[
+      ' Generated interface from Pigeon that represents a handler of calls from Flutter through dart:ffi.',
+      '',
+      ' Methods are called synchronously on the thread of the calling isolate,',
+      ' which may not be the platform thread, so they must be thread-safe.',
+    ];
+    addDocumentationComments(indent, api.documentationComments, _docCommentSpec,
+        generatorComments: generatedMessages);
+    indent.write('class ${api.name} ');
+    indent.addScoped('{', '};', () {
+      _writeAccessBlock(indent, _ClassAccess.public, () {
+        // Prevent copying/assigning.
+        _writeFunctionDeclaration(indent, api.name,
+            parameters: <String>['const ${api.name}&'], deleted: true);
+        _writeFunctionDeclaration(indent, 'operator=',
+            returnType: '${api.name}&',
+            parameters: <String>['const ${api.name}&'],
+            deleted: true);
+        // No-op virtual destructor.
+        _writeFunctionDeclaration(indent, '~${api.name}',
+            isVirtual: true, inlineNoop: true);
+        for (final Method method in api.methods) {
+          final HostDatatype returnType = getHostDatatype(
+              method.returnType, _baseCppTypeForBuiltinDartType);
+          final List<String> parameters = <String>[
+            for (final Parameter arg in method.parameters)
+              '${_hostApiArgumentType(getFieldHostDatatype(arg, _baseCppTypeForBuiltinDartType))} '
+                  '${_makeVariableName(arg)}',
+          ];
+          addDocumentationComments(
+              indent, method.documentationComments, _docCommentSpec);
+          _writeFunctionDeclaration(indent, _makeMethodName(method),
+              returnType: _hostApiReturnType(returnType),
+              parameters: parameters,
+              isVirtual: true,
+              isPureVirtual: true);
+        }
+        indent.newln();
+        indent.writeln(
+            '$_commentPrefix Sets the instance of `${api.name}` that handles calls from Flutter, or removes it if `api` is null.');
+        indent.writeln(
+            '$_commentPrefix The instance must outlive the calls that are made while it is set.');
+        _writeFunctionDeclaration(indent, 'SetUp',
+            returnType: _voidType,
+            isStatic: true,
+            parameters: <String>['${api.name}* api']);
+      });
+      _writeAccessBlock(indent, _ClassAccess.protected, () {
+        indent.writeln('${api.name}() = default;');
+      });
+    }, nestCount: 0);
+    indent.newln();
+    indent.writeln(
+        '$_commentPrefix The functions of ${api.name} that Flutter calls through dart:ffi.');
+    indent.writeln(
+        '$_commentPrefix They return false and set `error` if the call fails.');
+    indent.write('extern "C" ');
+    indent.addScoped('{', '}', () {
+      for (final Method method in api.methods) {
+        indent.writeln(
+            'PIGEON_FFI_EXPORT bool ${makeFfiFunctionName(api, method)}(${_ffiFunctionParameters(method).join(', ')});');
+      }
+      indent.writeln(
+          '$_commentPrefix Frees a string returned by a function of ${api.name}.');
+      indent.writeln(
+          'PIGEON_FFI_EXPORT void ${makeFfiFreeStringFunctionName(api)}(char* string);');
+    }, nestCount: 0);
+  }
+
+  void _writeStreamApi(Indent indent, Api api, Method func) {
+    final String className = _getStreamClassName(api, func);
+    final HostDatatype eventType =
+        getHostDatatype(func.returnType, _baseCppTypeForBuiltinDartType);
+    final List<String> generatedMessages = <String>[
+      ' Generated class from Pigeon that sends the `${func.name}` events of ${api.name} to Flutter.',
+      '',
+      ' Flutter grants credit for the events it is ready to receive. Events sent',
+      ' without credit are queued, and once `max_queue_size` events are queued',
+      ' `overflow_policy` decides which event is dropped. Events sent while',
+      ' Flutter is not listening are discarded.',
+      '',
+      ' Must be created, used and destroyed on the platform thread.',
+    ];
+    addDocumentationComments(indent, api.documentationComments, _docCommentSpec,
+        generatorComments: generatedMessages);
+    indent.write('class $className ');
+    indent.addScoped('{', '};', () {
+      _writeAccessBlock(indent, _ClassAccess.public, () {
+        _writeFunctionDeclaration(indent, className,
+            isConstructor: true,
+            parameters: <String>['flutter::BinaryMessenger* binary_messenger']);
+        _writeFunctionDeclaration(indent, className,
+            isConstructor: true,
+            parameters: <String>[
+              'flutter::BinaryMessenger* binary_messenger',
+              'size_t max_queue_size',
+              'StreamOverflowPolicy overflow_policy',
+            ]);
+        _writeFunctionDeclaration(indent, '~$className');
+        indent.newln();
+        // Prevent copying, since the channel handlers refer to the instance.
+        _writeFunctionDeclaration(indent, className,
+            parameters: <String>['const $className&'], deleted: true);
+        _writeFunctionDeclaration(indent, 'operator=',
+            returnType: '$className&',
+            parameters: <String>['const $className&'],
+            deleted: true);
+        indent.newln();
+        _writeFunctionDeclaration(indent, 'GetCodec',
+            returnType: 'const flutter::StandardMethodCodec&', isStatic: true);
+        indent.writeln(
+            '$_commentPrefix Sets the functions that are called when Flutter starts and stops listening.');
+        _writeFunctionDeclaration(indent, 'SetListenHandlers',
+            returnType: _voidType,
+            parameters: <String>[
+              'std::function<void()> on_listen',
+              'std::function<void()> on_cancel',
+            ]);
+        addDocumentationComments(
+            indent, func.documentationComments, _docCommentSpec);
+        indent.writeln(
+            '$_commentPrefix Sends `event` to Flutter if it has credit, or queues it otherwise.');
+        _writeFunctionDeclaration(indent, 'Send',
+            returnType: _voidType,
+            parameters: <String>['${_flutterApiArgumentType(eventType)} event']);
+        indent.writeln(
+            '$_commentPrefix Ends the stream once the queued events have been sent.');
+        _writeFunctionDeclaration(indent, 'EndOfStream', returnType: _voidType);
+        indent.writeln('$_commentPrefix Whether Flutter is listening.');
+        _writeFunctionDeclaration(indent, 'is_listening',
+            returnType: 'bool', isConst: true);
+        indent.writeln('$_commentPrefix The number of events waiting for credit.');
+        _writeFunctionDeclaration(indent, 'queued_event_count',
+            returnType: 'size_t', isConst: true);
+        indent.writeln(
+            '$_commentPrefix The number of events dropped because the queue was full.');
+        _writeFunctionDeclaration(indent, 'dropped_event_count',
+            returnType: 'size_t', isConst: true);
+      });
+      _writeAccessBlock(indent, _ClassAccess.private, () {
+        _writeFunctionDeclaration(indent, 'OnListen',
+            returnType: _voidType,
+            parameters: <String>[
+              'int64_t credit',
+              'std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> sink',
+            ]);
+        _writeFunctionDeclaration(indent, 'OnCancel', returnType: _voidType);
+        _writeFunctionDeclaration(indent, 'AddCredit',
+            returnType: _voidType, parameters: <String>['int64_t credit']);
+        _writeFunctionDeclaration(indent, 'SendQueuedEvents',
+            returnType: _voidType);
+        indent.newln();
+        indent.writeln('size_t max_queue_size_;');
+        indent.writeln('StreamOverflowPolicy overflow_policy_;');
+        indent.writeln(
+            'std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>> event_channel_;');
+        indent.writeln(
+            'std::unique_ptr<flutter::BasicMessageChannel<flutter::EncodableValue>> credit_channel_;');
+        indent.writeln(
+            '$_commentPrefix Set while Flutter is listening.');
+        indent.writeln(
+            'std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> sink_;');
+        indent.writeln('std::deque<flutter::EncodableValue> queue_;');
+        indent.writeln(
+            '$_commentPrefix The number of events Flutter is ready to receive.');
+        indent.writeln('int64_t credit_ = 0;');
+        indent.writeln('size_t dropped_event_count_ = 0;');
+        indent.writeln('bool end_of_stream_ = false;');
+        indent.writeln('std::function<void()> on_listen_;');
+        indent.writeln('std::function<void()> on_cancel_;');
+      });
+    }, nestCount: 0);
+    indent.newln();
+  }
+
+  void _writeClassConstructor(CppOptions generatorOptions, Root root,
+      Indent indent, Class classDefinition, Iterable<NamedType> params,
+      String docComment) {
     final List<String> paramStrings = params.map((NamedType param) {
-      final HostDatatype hostDatatype =
-          getFieldHostDatatype(param, _baseCppTypeForBuiltinDartType);
-      return '${_hostApiArgumentType(hostDatatype)} ${_makeVariableName(param)}';
+      final HostDatatype hostDatatype = _getDataClassFieldHostDatatype(
+          generatorOptions, param, _baseCppTypeForBuiltinDartType);
+      return '${_constructorArgumentType(hostDatatype)} ${_makeVariableName(param)}';
     }).toList();
     indent.writeln('$_commentPrefix $docComment');
     _writeFunctionDeclaration(indent, classDefinition.name,
@@ -516,12 +873,12 @@ class CppHeaderGenerator extends StructuredGenerator<CppOptions> {
 
 class FlutterError {
  public:
-\texplicit FlutterError(const std::string& code)
-\t\t: code_(code) {}
-\texplicit FlutterError(const std::string& code, const std::string& message)
-\t\t: code_(code), message_(message) {}
-\texplicit FlutterError(const std::string& code, const std::string& message, const flutter::EncodableValue& details)
-\t\t: code_(code), message_(message), details_(details) {}
+\texplicit FlutterError(std::string code)
+\t\t: code_(std::move(code)) {}
+\texplicit FlutterError(std::string code, std::string message)
+\t\t: code_(std::move(code)), message_(std::move(message)) {}
+\texplicit FlutterError(std::string code, std::string message, flutter::EncodableValue details)
+\t\t: code_(std::move(code)), message_(std::move(message)), details_(std::move(details)) {}
 
 \tconst std::string& code() const { return code_; }
 \tconst std::string& message() const { return message_; }
@@ -544,24 +901,206 @@ class FlutterError {
 template<class T> class ErrorOr {
  public:
 \tErrorOr(const T& rhs) : v_(rhs) {}
-\tErrorOr(const T&& rhs) : v_(std::move(rhs)) {}
+\tErrorOr(T&& rhs) : v_(std::move(rhs)) {}
 \tErrorOr(const FlutterError& rhs) : v_(rhs) {}
-\tErrorOr(const FlutterError&& rhs) : v_(std::move(rhs)) {}
+\tErrorOr(FlutterError&& rhs) : v_(std::move(rhs)) {}
 
 \tbool has_error() const { return std::holds_alternative<FlutterError>(v_); }
 \tconst T& value() const { return std::get<T>(v_); };
 \tconst FlutterError& error() const { return std::get<FlutterError>(v_); };
+\t// Moves the value out of the result, which must not be an error.
+\tT TakeValue() && { return std::get<T>(std::move(v_)); }
 
  private:
 $friendLines
 \tErrorOr() = default;
-\tT TakeValue() && { return std::get<T>(std::move(v_)); }
 
 \tstd::variant<T, FlutterError> v_;
 };
 ''');
   }
 
+  void _writeTypedDataView(Indent indent) {
+    indent.format('''
+
+// A read-only view of typed data in the message being handled.
+//
+// The view is only valid until the method that receives it returns; copy the
+// data to keep it for longer.
+template<class T> class TypedDataView {
+ public:
+\tTypedDataView() = default;
+\tTypedDataView(const T* data, size_t size) : data_(data), size_(size) {}
+
+\tconst T* data() const { return data_; }
+\tsize_t size() const { return size_; }
+\tbool empty() const { return size_ == 0; }
+\tconst T* begin() const { return data_; }
+\tconst T* end() const { return data_ + size_; }
+\tconst T& operator[](size_t index) const { return data_[index]; }
+
+ private:
+\tconst T* data_ = nullptr;
+\tsize_t size_ = 0;
+};
+''');
+  }
+
+  void _writePlatformTaskRunner(Indent indent) {
+    indent.format('''
+
+// Runs |task| on the platform thread.
+using PlatformTaskRunner = std::function<void(std::function<void()> task)>;
+''');
+  }
+
+  void _writeFfiTypes(Indent indent, Root root) {
+    indent.format('''
+
+#ifndef PIGEON_FFI_EXPORT
+#ifdef _WIN32
+#define PIGEON_FFI_EXPORT __declspec(dllexport)
+#else
+#define PIGEON_FFI_EXPORT __attribute__((visibility("default")))
+#endif
+#endif
+
+// The error set by a call through dart:ffi that fails. Its strings are freed
+// by the caller.
+struct PigeonFfiError {
+\tchar* code;
+\tchar* message;
+};''');
+    for (final Class classDefinition in _getFfiStructClasses(root)) {
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix ${classDefinition.name}, passed through dart:ffi as a plain struct.');
+      indent.write('struct ${_getFfiStructName(classDefinition.name)} ');
+      indent.addScoped('{', '};', () {
+        for (final NamedType field
+            in getFieldsInSerializationOrder(classDefinition)) {
+          indent.writeln(
+              '${_ffiCType(field.type)} ${_makeVariableName(field)};');
+        }
+      });
+    }
+  }
+
+  void _writeStreamOverflowPolicy(Indent indent) {
+    indent.format('''
+
+// Which event a stream drops when an event is sent while its queue is full.
+enum class StreamOverflowPolicy {
+\t// Drops the oldest queued event, so that Flutter gets the latest events.
+\tkDropOldest,
+\t// Drops the event being sent, so that Flutter gets every queued event.
+\tkDropNewest,
+};''');
+  }
+
+  void _writeTask(Indent indent) {
+    indent.format('''
+
+// The result of an asynchronous host API method, as a C++20 coroutine.
+//
+// The coroutine starts when it is awaited, or when the message handler that
+// called the method waits for its result. An exception that escapes the
+// coroutine is rethrown to the coroutine awaiting it, or sent as an error
+// reply to Flutter.
+template<class T> class Task {
+ public:
+\t// Sends |result| with |reply|.
+\tusing Completion = void (*)(T&& result, const flutter::MessageReply<flutter::EncodableValue>& reply);
+\t// Wraps the message of an exception that escaped the coroutine in an error.
+\tusing ErrorWrapper = flutter::EncodableValue (*)(std::string_view error_message);
+
+\tclass promise_type {
+\t private:
+\t\tstruct FinalAwaiter {
+\t\t\tbool await_ready() noexcept { return false; }
+\t\t\tstd::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+\t\t\t\tpromise_type& promise = handle.promise();
+\t\t\t\tif (promise.completion_ == nullptr) {
+\t\t\t\t\treturn promise.continuation_ ? promise.continuation_ : std::noop_coroutine();
+\t\t\t\t}
+\t\t\t\t// Nothing owns a task started by Then, so it cleans itself up.
+\t\t\t\ttry {
+\t\t\t\t\tpromise.completion_(promise.TakeResult(), promise.reply_);
+\t\t\t\t} catch (const std::exception& exception) {
+\t\t\t\t\tpromise.reply_(promise.wrap_error_(exception.what()));
+\t\t\t\t}
+\t\t\t\thandle.destroy();
+\t\t\t\treturn std::noop_coroutine();
+\t\t\t}
+\t\t\tvoid await_resume() noexcept {}
+\t\t};
+
+\t public:
+\t\tTask get_return_object() {
+\t\t\treturn Task(std::coroutine_handle<promise_type>::from_promise(*this));
+\t\t}
+\t\tstd::suspend_always initial_suspend() noexcept { return {}; }
+\t\tFinalAwaiter final_suspend() noexcept { return {}; }
+\t\tvoid return_value(T value) { result_.emplace(std::move(value)); }
+\t\tvoid unhandled_exception() { exception_ = std::current_exception(); }
+
+\t private:
+\t\tfriend class Task;
+
+\t\tT TakeResult() {
+\t\t\tif (exception_) {
+\t\t\t\tstd::rethrow_exception(exception_);
+\t\t\t}
+\t\t\treturn std::move(*result_);
+\t\t}
+
+\t\tstd::optional<T> result_;
+\t\tstd::exception_ptr exception_;
+\t\tstd::coroutine_handle<> continuation_;
+\t\tflutter::MessageReply<flutter::EncodableValue> reply_;
+\t\tCompletion completion_ = nullptr;
+\t\tErrorWrapper wrap_error_ = nullptr;
+\t};
+
+\tTask(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+\t~Task() {
+\t\tif (handle_) {
+\t\t\thandle_.destroy();
+\t\t}
+\t}
+
+\t// Prevent copying.
+\tTask(const Task&) = delete;
+\tTask& operator=(const Task&) = delete;
+
+\tbool await_ready() const noexcept { return false; }
+\tstd::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+\t\thandle_.promise().continuation_ = continuation;
+\t\treturn handle_;
+\t}
+\tT await_resume() { return handle_.promise().TakeResult(); }
+
+\t// Starts the task, and calls |completion| with its result and |reply| when
+\t// it finishes.
+\t//
+\t// Used by the generated message handlers. The completion is stored in the
+\t// coroutine frame, so no closure is allocated.
+\tvoid Then(const flutter::MessageReply<flutter::EncodableValue>& reply, Completion completion, ErrorWrapper wrap_error) && {
+\t\tpromise_type& promise = handle_.promise();
+\t\tpromise.reply_ = reply;
+\t\tpromise.completion_ = completion;
+\t\tpromise.wrap_error_ = wrap_error;
+\t\tstd::exchange(handle_, nullptr).resume();
+\t}
+
+ private:
+\texplicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+\tstd::coroutine_handle<promise_type> handle_;
+};
+''');
+  }
+
   @override
   void writeCloseNamespace(
     CppOptions generatorOptions,
@@ -612,12 +1151,24 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
       'flutter/basic_message_channel.h',
       'flutter/binary_messenger.h',
       'flutter/encodable_value.h',
+      if (_hasStreamApis(root)) 'flutter/event_stream_handler_functions.h',
       'flutter/standard_message_codec.h',
     ]);
     indent.newln();
+    final bool hasFfiApis = _hasFfiApis(root);
+    final bool hasBackgroundMethods = _hasBackgroundTaskQueueMethods(root);
     _writeSystemHeaderIncludeBlock(indent, <String>[
+      if (hasFfiApis) 'atomic',
+      if (hasBackgroundMethods) 'condition_variable',
+      if (_usesMessageBuffers(root) || hasFfiApis) 'cstring',
+      if (hasBackgroundMethods) 'deque',
       'map',
+      if (hasBackgroundMethods) 'memory',
+      if (hasBackgroundMethods) 'mutex',
       'string',
+      if (hasBackgroundMethods) 'thread',
+      if (_hasChannelHostApis(root)) 'type_traits',
+      if (hasBackgroundMethods || _hasChannelHostApis(root)) 'utility',
       'optional',
     ]);
     indent.newln();
@@ -656,54 +1207,713 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
     indent.newln();
     _writeFunctionDefinition(indent, 'CreateConnectionError',
         returnType: 'FlutterError',
-        parameters: <String>['const std::string channel_name'], body: () {
+        parameters: <String>['const std::string& channel_name'], body: () {
       indent.format('''
   return FlutterError(
       "channel-error",
       "Unable to establish connection on channel: '" + channel_name + "'.",
       EncodableValue(""));''');
     });
+    if (root.classes.isNotEmpty) {
+      _writeFieldWriters(generatorOptions, root, indent);
+    }
+    if (_usesMessageBuffers(root)) {
+      _writeMessageBuffers(indent);
+    }
+    if (_hasZeroCopyMethods(root)) {
+      _writeZeroCopyMessageReader(indent);
+    }
+    if (_hasBackgroundTaskQueueMethods(root)) {
+      _writeTaskQueue(indent);
+    }
+    if (_hasFfiApis(root)) {
+      _writeFfiErrorHelpers(indent);
+    }
+    if (_hasChannelHostApis(root)) {
+      _writeHostApiRuntime(indent);
+    }
   }
 
-  @override
-  void writeDataClass(
-    CppOptions generatorOptions,
-    Root root,
-    Indent indent,
-    Class classDefinition, {
-    required String dartPackageName,
-  }) {
-    indent.writeln('$_commentPrefix ${classDefinition.name}');
+  /// Writes the templates that every host API method handler in the file
+  /// shares, so that a handler is a function that only unwraps its arguments
+  /// and calls the method.
+  void _writeHostApiRuntime(Indent indent) {
     indent.newln();
+    indent.format('''
+namespace {
+// Wraps an error in the reply to a host API method.
+EncodableValue PigeonWrapError(std::string_view error_message) {
+\treturn EncodableValue(EncodableList{
+\t\tEncodableValue(std::string(error_message)),
+\t\tEncodableValue("Error"),
+\t\tEncodableValue()
+\t});
+}
 
-    final Iterable<NamedType> orderedFields =
-        getFieldsInSerializationOrder(classDefinition);
-    final Iterable<NamedType> requiredFields =
-        orderedFields.where((NamedType type) => !type.type.isNullable);
-    // Minimal constructor, if needed.
-    if (requiredFields.length != orderedFields.length) {
-      _writeClassConstructor(root, indent, classDefinition, requiredFields);
-    }
-    // All-field constructor.
-    _writeClassConstructor(root, indent, classDefinition, orderedFields);
+EncodableValue PigeonWrapError(const FlutterError& error) {
+\treturn EncodableValue(EncodableList{
+\t\tEncodableValue(error.code()),
+\t\tEncodableValue(error.message()),
+\t\terror.details()
+\t});
+}
 
-    // Getters and setters.
-    for (final NamedType field in orderedFields) {
-      _writeCppSourceClassField(
-          generatorOptions, root, indent, classDefinition, field);
-    }
+// Wraps a value returned by a host API method in |Wrapper|, which is
+// EncodableValue or CustomEncodableValue. Enums are sent as their index.
+template <typename Wrapper, typename T>
+EncodableValue PigeonWrapValue(T&& value) {
+\tif constexpr (std::is_enum_v<std::decay_t<T>>) {
+\t\treturn Wrapper(static_cast<int>(value));
+\t} else {
+\t\treturn Wrapper(std::forward<T>(value));
+\t}
+}
 
-    // Serialization.
-    writeClassEncode(
-      generatorOptions,
-      root,
-      indent,
-      classDefinition,
-      dartPackageName: dartPackageName,
-    );
+template <typename Wrapper, typename T>
+EncodableValue PigeonWrapValue(std::optional<T>&& value) {
+\tif (!value) {
+\t\treturn EncodableValue();
+\t}
+\treturn PigeonWrapValue<Wrapper>(std::move(value).value());
+}
 
-    // Deserialization.
-    writeClassDecode(
+// Sends the value or the error returned by a host API method.
+//
+// Ideally this code would use an initializer list to create an EncodableList
+// inline, which would be less code. However, that would always copy the
+// element, so the slightly more verbose create-and-push approach is used
+// instead.
+template <typename Wrapper, typename T, typename Reply>
+void PigeonReply(const Reply& reply, ErrorOr<T>&& output) {
+\tif (output.has_error()) {
+\t\treply(PigeonWrapError(output.error()));
+\t\treturn;
+\t}
+\tEncodableList wrapped;
+\twrapped.push_back(PigeonWrapValue<Wrapper>(std::move(output).TakeValue()));
+\treply(EncodableValue(std::move(wrapped)));
+}
+
+// Sends the error returned by a host API method that returns void, if any.
+template <typename Reply>
+void PigeonReply(const Reply& reply, std::optional<FlutterError>&& output) {
+\tif (output.has_value()) {
+\t\treply(PigeonWrapError(output.value()));
+\t\treturn;
+\t}
+\tEncodableList wrapped;
+\twrapped.push_back(EncodableValue());
+\treply(EncodableValue(std::move(wrapped)));
+}
+
+// Unwraps the arguments of a message to a host API method, calls the method
+// on |host_api| and replies.
+template <typename Api>
+using PigeonHostMethodHandler = void (*)(
+\t\tApi* host_api,
+\t\tconst EncodableValue& message,
+\t\tconst flutter::MessageReply<EncodableValue>& reply);
+
+// Handles the messages on |channel_name| with |handler|, or removes the
+// handler if |api| is null.
+//
+// Handlers are plain functions, so that every method of |Api| shares one
+// message handler type.
+template <typename Api>
+void PigeonSetUpHostMethod(
+\t\tflutter::BinaryMessenger* binary_messenger,
+\t\tconst char* channel_name,
+\t\tconst flutter::MessageCodec<EncodableValue>* codec,
+\t\tApi* api,
+\t\tPigeonHostMethodHandler<Api> handler) {
+\tBasicMessageChannel<> channel(binary_messenger, channel_name, codec);
+\tif (api == nullptr) {
+\t\tchannel.SetMessageHandler(nullptr);
+\t\treturn;
+\t}
+\tchannel.SetMessageHandler([api, handler](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+\t\ttry {
+\t\t\thandler(api, message, reply);
+\t\t} catch (const std::exception& exception) {
+\t\t\t// There is a potential here for `reply` to be called twice, which
+\t\t\t// is a violation of the API contract, because there's no way of
+\t\t\t// knowing whether or not the plugin code called `reply` before
+\t\t\t// throwing. Since use of `@async` suggests that the reply is
+\t\t\t// probably not sent within the scope of the stack, err on the
+\t\t\t// side of potential double-call rather than no call (which is
+\t\t\t// also an API violation) so that unexpected errors have a better
+\t\t\t// chance of being caught and handled in a useful way.
+\t\t\treply(PigeonWrapError(exception.what()));
+\t\t}
+\t});
+}
+}  // namespace''');
+  }
+
+  /// Writes the helpers that return strings and errors through dart:ffi.
+  void _writeFfiErrorHelpers(Indent indent) {
+    indent.writeln(
+        '$_commentPrefix Copies `value` into a string that Flutter frees with the FreeString function of the API.');
+    _writeFunctionDefinition(indent, 'PigeonFfiCopyString',
+        returnType: 'char*',
+        parameters: <String>['const std::string& value'], body: () {
+      indent.writeln('char* copy = new char[value.size() + 1];');
+      indent.writeln('std::memcpy(copy, value.c_str(), value.size() + 1);');
+      indent.writeln('return copy;');
+    });
+    _writeFunctionDefinition(indent, 'PigeonFfiSetError',
+        returnType: _voidType,
+        parameters: <String>[
+          'PigeonFfiError* error',
+          'const std::string& code',
+          'const std::string& message',
+        ], body: () {
+      indent.writeln('error->code = PigeonFfiCopyString(code);');
+      indent.writeln('error->message = PigeonFfiCopyString(message);');
+    });
+  }
+
+  /// Writes the queue that host API methods with a background task queue run
+  /// on, and the helper that sends replies from it on the platform thread.
+  ///
+  /// Both are in an anonymous namespace, so that Pigeon files generated into
+  /// the same namespace do not define the same symbols.
+  void _writeTaskQueue(Indent indent) {
+    indent.newln();
+    indent.format('''
+namespace {
+// Runs the handlers of host API methods that use a background task queue,
+// one at a time and in the order they are received, on a thread owned by the
+// queue.
+class TaskQueue {
+ public:
+	TaskQueue() : thread_([this]() { RunTasks(); }) {}
+
+	~TaskQueue() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopped_ = true;
+		}
+		condition_.notify_one();
+		// Finishes the tasks already in the queue, so that the API is not called
+		// after its handlers are removed.
+		thread_.join();
+	}
+
+	// Prevent copying.
+	TaskQueue(const TaskQueue&) = delete;
+	TaskQueue& operator=(const TaskQueue&) = delete;
+
+	// Adds |task| to the end of the queue.
+	void Post(std::function<void()> task) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			tasks_.push_back(std::move(task));
+		}
+		condition_.notify_one();
+	}
+
+ private:
+	void RunTasks() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		for (;;) {
+			condition_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+			if (tasks_.empty()) {
+				return;
+			}
+			std::function<void()> task = std::move(tasks_.front());
+			tasks_.pop_front();
+			lock.unlock();
+			task();
+			lock.lock();
+		}
+	}
+
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	std::deque<std::function<void()>> tasks_;
+	bool stopped_ = false;
+	// Declared last, so that the members it uses exist before it starts.
+	std::thread thread_;
+};
+
+// Returns a reply that is sent on the platform thread with
+// |platform_task_runner|, which must not be null.
+flutter::MessageReply<EncodableValue> ReplyOnPlatformThread(
+		const PlatformTaskRunner& platform_task_runner,
+		const flutter::MessageReply<EncodableValue>& reply) {
+	return [platform_task_runner, reply](const EncodableValue& response) {
+		platform_task_runner([reply, response]() { reply(response); });
+	};
+}
+}  // namespace''');
+  }
+
+  /// Writes the helpers that data classes use to write their fields directly
+  /// to a stream, in the encoding the standard codec uses for the
+  /// EncodableValue holding them.
+  void _writeFieldWriters(
+      CppOptions generatorOptions, Root root, Indent indent) {
+    bool hasFieldOfType(bool Function(String baseName) test) {
+      return root.classes.any((Class c) =>
+          c.fields.any((NamedType field) => test(field.type.baseName)));
+    }
+
+    // Typed collection fields are written by WriteTypedList and
+    // WriteTypedMap instead of WriteList and WriteMap.
+    bool hasUntypedFieldOfType(String baseName) {
+      return root.classes.any((Class c) => c.fields.any((NamedType field) =>
+          field.type.baseName == baseName &&
+          _typedCollectionType(generatorOptions, field.type) == null));
+    }
+
+    final bool hasTypedCollections =
+        _hasTypedCollectionFields(generatorOptions, root);
+    final bool hasTypedStringElements = root.classes.any((Class c) =>
+        c.fields.any((NamedType field) =>
+            _typedCollectionType(generatorOptions, field.type) != null &&
+            field.type.typeArguments
+                .any((TypeDeclaration type) => type.baseName == 'String')));
+
+    // Lazy fields that were never decoded are written as lists.
+    final bool hasLazyFields = root.classes.any((Class c) => c.fields
+        .any((NamedType field) => _isLazyField(generatorOptions, root, field)));
+
+    indent.newln();
+    indent.writeln('namespace {');
+    indent.format('''
+// Writes |size| in the standard codec's variable length encoding.
+void WriteSize(size_t size, flutter::ByteStreamWriter* stream) {
+	if (size < 254) {
+		stream->WriteByte(static_cast<uint8_t>(size));
+	} else if (size <= 0xffff) {
+		stream->WriteByte(254);
+		const uint16_t value = static_cast<uint16_t>(size);
+		stream->WriteBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+	} else {
+		stream->WriteByte(255);
+		const uint32_t value = static_cast<uint32_t>(size);
+		stream->WriteBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+	}
+}
+
+// Writes the header of a list of |size| values.
+void WriteListHeader(size_t size, flutter::ByteStreamWriter* stream) {
+	stream->WriteByte(12);
+	WriteSize(size, stream);
+}''');
+    if (hasTypedStringElements ||
+        hasFieldOfType((String baseName) => baseName == 'String')) {
+      indent.format('''
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteString(const std::string& value, flutter::ByteStreamWriter* stream) {
+	stream->WriteByte(7);
+	WriteSize(value.size(), stream);
+	if (!value.empty()) {
+		stream->WriteBytes(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+	}
+}''');
+    }
+    if (hasFieldOfType(typedDataTypes.contains)) {
+      indent.format('''
+
+// Writes |value| as the standard codec writes an EncodableValue holding it,
+// with the codec type |type|.
+template<class T> void WriteTypedData(uint8_t type, const std::vector<T>& value, flutter::ByteStreamWriter* stream) {
+	stream->WriteByte(type);
+	WriteSize(value.size(), stream);
+	if (!value.empty()) {
+		stream->WriteAlignment(static_cast<uint8_t>(sizeof(T)));
+		stream->WriteBytes(reinterpret_cast<const uint8_t*>(value.data()), value.size() * sizeof(T));
+	}
+}''');
+    }
+    if (hasLazyFields || hasUntypedFieldOfType('List')) {
+      indent.format('''
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteList(const EncodableList& value, const flutter::StandardCodecSerializer& serializer, flutter::ByteStreamWriter* stream) {
+	WriteListHeader(value.size(), stream);
+	for (const EncodableValue& element : value) {
+		serializer.WriteValue(element, stream);
+	}
+}''');
+    }
+    if (hasUntypedFieldOfType('Map')) {
+      indent.format('''
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteMap(const EncodableMap& value, const flutter::StandardCodecSerializer& serializer, flutter::ByteStreamWriter* stream) {
+	stream->WriteByte(13);
+	WriteSize(value.size(), stream);
+	for (const auto& pair : value) {
+		serializer.WriteValue(pair.first, stream);
+		serializer.WriteValue(pair.second, stream);
+	}
+}''');
+    }
+    if (hasTypedCollections) {
+      _writeTypedCollectionHelpers(generatorOptions, root, indent,
+          hasStringElements: hasTypedStringElements);
+    }
+    indent.writeln('}  // namespace');
+  }
+
+  /// Writes the helpers that convert typed collection fields to and from
+  /// EncodableLists and EncodableMaps, and write them directly to a stream.
+  void _writeTypedCollectionHelpers(
+      CppOptions generatorOptions, Root root, Indent indent,
+      {required bool hasStringElements}) {
+    indent.format('''
+
+// Converts typed collection elements of type |T| to and from the
+// EncodableValues the standard codec encodes them as.
+template<class T> struct ElementCodec {
+\tstatic EncodableValue Encode(const T& value) { return EncodableValue(value); }
+\tstatic T Decode(EncodableValue value) { return std::get<T>(std::move(value)); }
+};
+
+template<> struct ElementCodec<int64_t> {
+\tstatic EncodableValue Encode(int64_t value) { return EncodableValue(value); }
+\t// Values that fit in 32 bits are decoded as int32_t.
+\tstatic int64_t Decode(const EncodableValue& value) { return value.LongValue(); }
+};
+
+template<class T> struct ElementCodec<std::optional<T>> {
+\tstatic EncodableValue Encode(const std::optional<T>& value) {
+\t\treturn value ? ElementCodec<T>::Encode(*value) : EncodableValue();
+\t}
+\tstatic std::optional<T> Decode(EncodableValue value) {
+\t\tif (value.IsNull()) {
+\t\t\treturn std::nullopt;
+\t\t}
+\t\treturn ElementCodec<T>::Decode(std::move(value));
+\t}
+};''');
+    for (final Class classDefinition
+        in _typedCollectionElementClasses(generatorOptions, root)) {
+      final String name = classDefinition.name;
+      indent.format('''
+
+template<> struct ElementCodec<$name> {
+\tstatic EncodableValue Encode(const $name& value) { return CustomEncodableValue(value); }
+\tstatic $name Decode(const EncodableValue& value) {
+\t\treturn std::any_cast<const $name&>(std::get<CustomEncodableValue>(value));
+\t}
+};''');
+    }
+    indent.format('''
+
+// Returns an EncodableList holding the elements of |list|.
+template<class T> EncodableList TypedListToEncodable(const std::vector<T>& list) {
+\tEncodableList result;
+\tresult.reserve(list.size());
+\tfor (const T& element : list) {
+\t\tresult.push_back(ElementCodec<T>::Encode(element));
+\t}
+\treturn result;
+}
+
+// Returns a |Vector| holding the elements of |list|, which are moved out of
+// it.
+template<class Vector> Vector TypedListFromEncodable(EncodableList list) {
+\tVector result;
+\tresult.reserve(list.size());
+\tfor (EncodableValue& element : list) {
+\t\tresult.push_back(ElementCodec<typename Vector::value_type>::Decode(std::move(element)));
+\t}
+\treturn result;
+}
+
+// Returns an EncodableMap holding the entries of |map|.
+template<class K, class V> EncodableMap TypedMapToEncodable(const std::map<K, V>& map) {
+\tEncodableMap result;
+\tfor (const auto& pair : map) {
+\t\tresult.emplace(ElementCodec<K>::Encode(pair.first), ElementCodec<V>::Encode(pair.second));
+\t}
+\treturn result;
+}
+
+// Returns a |Map| holding the entries of |map|, whose values are moved out of
+// it.
+template<class Map> Map TypedMapFromEncodable(EncodableMap map) {
+\tMap result;
+\tfor (auto& pair : map) {
+\t\tresult.emplace(ElementCodec<typename Map::key_type>::Decode(pair.first), ElementCodec<typename Map::mapped_type>::Decode(std::move(pair.second)));
+\t}
+\treturn result;
+}
+
+// Writes |value| as the standard codec writes the EncodableValue it is
+// encoded as.
+template<class T> void WriteElement(const T& value, const flutter::StandardCodecSerializer& serializer, flutter::ByteStreamWriter* stream) {
+\tserializer.WriteValue(ElementCodec<T>::Encode(value), stream);
+}''');
+    if (hasStringElements) {
+      indent.format('''
+
+void WriteElement(const std::string& value, const flutter::StandardCodecSerializer&, flutter::ByteStreamWriter* stream) {
+\tWriteString(value, stream);
+}''');
+    }
+    indent.format('''
+
+template<class T> void WriteElement(const std::optional<T>& value, const flutter::StandardCodecSerializer& serializer, flutter::ByteStreamWriter* stream) {
+\tif (value) {
+\t\tWriteElement(*value, serializer, stream);
+\t} else {
+\t\tserializer.WriteValue(EncodableValue(), stream);
+\t}
+}
+
+// Writes |value| as the standard codec writes the EncodableList it is
+// encoded as, without creating that list.
+template<class T> void WriteTypedList(const std::vector<T>& value, const flutter::StandardCodecSerializer& serializer, flutter::ByteStreamWriter* stream) {
+\tWriteListHeader(value.size(), stream);
+\tfor (const T& element : value) {
+\t\tWriteElement(element, serializer, stream);
+\t}
+}
+
+// Writes |value| as the standard codec writes the EncodableMap it is
+// encoded as, without creating that map.
+template<class K, class V> void WriteTypedMap(const std::map<K, V>& value, const flutter::StandardCodecSerializer& serializer, flutter::ByteStreamWriter* stream) {
+\tstream->WriteByte(13);
+\tWriteSize(value.size(), stream);
+\tfor (const auto& pair : value) {
+\t\tWriteElement(pair.first, serializer, stream);
+\t\tWriteElement(pair.second, serializer, stream);
+\t}
+}''');
+  }
+
+  /// Writes the classes that read messages in place from the buffer they
+  /// were received in, and write them into a reused per-thread buffer.
+  void _writeMessageBuffers(Indent indent) {
+    indent.format('''
+
+namespace {
+// Reads a message in place from the buffer it was received in, rather than
+// decoding it into a heap-allocated EncodableValue.
+class MessageReader : public flutter::ByteStreamReader {
+ public:
+\tMessageReader(const uint8_t* bytes, size_t size)
+\t\t: bytes_(bytes), size_(size) {}
+
+\t// Returns true if a read went past the end of the message, or found a
+\t// value of an unexpected type.
+\tbool has_error() const { return has_error_; }
+
+\tuint8_t ReadByte() override {
+\t\tif (location_ >= size_) {
+\t\t\thas_error_ = true;
+\t\t\treturn 0;
+\t\t}
+\t\treturn bytes_[location_++];
+\t}
+
+\tvoid ReadBytes(uint8_t* buffer, size_t length) override {
+\t\tif (length > size_ - location_) {
+\t\t\thas_error_ = true;
+\t\t\tlocation_ = size_;
+\t\t\treturn;
+\t\t}
+\t\tstd::memcpy(buffer, bytes_ + location_, length);
+\t\tlocation_ += length;
+\t}
+
+\tvoid ReadAlignment(uint8_t alignment) override {
+\t\tconst size_t mod = location_ % alignment;
+\t\tif (mod != 0) {
+\t\t\tconst size_t padding = alignment - mod;
+\t\t\tlocation_ = padding > size_ - location_ ? size_ : location_ + padding;
+\t\t}
+\t}
+
+ protected:
+\t// Reads a size in the standard codec's variable length encoding.
+\tsize_t ReadSize() {
+\t\tconst uint8_t byte = ReadByte();
+\t\tif (byte < 254) {
+\t\t\treturn byte;
+\t\t}
+\t\tif (byte == 254) {
+\t\t\tuint16_t value = 0;
+\t\t\tReadBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+\t\t\treturn value;
+\t\t}
+\t\tuint32_t value = 0;
+\t\tReadBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+\t\treturn value;
+\t}
+
+\tconst uint8_t* bytes_;
+\tsize_t size_;
+\tsize_t location_ = 0;
+\tbool has_error_ = false;
+};
+
+// Writes a message into a buffer owned by the current thread, which is reused
+// by every message sent from that thread. Once the buffer has grown to fit the
+// largest message, encoding a message does not allocate.
+//
+// BinaryMessenger::Send copies the message, so the buffer can be reused as
+// soon as it returns. Only one writer may be alive on a thread at a time.
+class MessageWriter : public flutter::ByteStreamWriter {
+ public:
+\tMessageWriter() : buffer_(GetThreadBuffer()) { buffer_.clear(); }
+
+\tconst uint8_t* data() const { return buffer_.data(); }
+\tsize_t size() const { return buffer_.size(); }
+
+\tvoid WriteByte(uint8_t byte) override { buffer_.push_back(byte); }
+
+\tvoid WriteBytes(const uint8_t* bytes, size_t length) override {
+\t\tbuffer_.insert(buffer_.end(), bytes, bytes + length);
+\t}
+
+\tvoid WriteAlignment(uint8_t alignment) override {
+\t\tconst size_t mod = buffer_.size() % alignment;
+\t\tif (mod != 0) {
+\t\t\tbuffer_.insert(buffer_.end(), alignment - mod, 0);
+\t\t}
+\t}
+
+ private:
+\tstatic std::vector<uint8_t>& GetThreadBuffer() {
+\t\tthread_local std::vector<uint8_t> buffer;
+\t\treturn buffer;
+\t}
+
+\tstd::vector<uint8_t>& buffer_;
+};
+}  // namespace''');
+  }
+
+  void _writeZeroCopyMessageReader(Indent indent) {
+    indent.format('''
+
+namespace {
+// Reads a message in place, so that typed data and string arguments can be
+// passed to the API as views into the message buffer rather than copied out of
+// it.
+class ZeroCopyMessageReader : public MessageReader {
+ public:
+\tusing MessageReader::MessageReader;
+
+\t// Reads the header of an argument list with |count| elements.
+\tvoid ReadArgumentListHeader(size_t count) {
+\t\tif (ReadByte() != kListType || ReadSize() != count) {
+\t\t\thas_error_ = true;
+\t\t}
+\t}
+
+\t// Returns a view of the typed data value of codec type |type| at the
+\t// current position, or std::nullopt if the value is null.
+\ttemplate<class T> std::optional<TypedDataView<T>> ReadTypedDataView(uint8_t type) {
+\t\tconst uint8_t value_type = ReadByte();
+\t\tif (value_type == kNullType) {
+\t\t\treturn std::nullopt;
+\t\t}
+\t\tconst size_t count = ReadSize();
+\t\tReadAlignment(static_cast<uint8_t>(sizeof(T)));
+\t\tif (value_type != type || count > (size_ - location_) / sizeof(T)) {
+\t\t\thas_error_ = true;
+\t\t\treturn std::nullopt;
+\t\t}
+\t\tconst T* data = reinterpret_cast<const T*>(bytes_ + location_);
+\t\tlocation_ += count * sizeof(T);
+\t\treturn TypedDataView<T>(data, count);
+\t}
+
+\t// Returns a view of the UTF-8 string value at the current position, or
+\t// std::nullopt if the value is null.
+\tstd::optional<std::string_view> ReadStringView() {
+\t\tconst uint8_t value_type = ReadByte();
+\t\tif (value_type == kNullType) {
+\t\t\treturn std::nullopt;
+\t\t}
+\t\tconst size_t length = ReadSize();
+\t\tif (value_type != kStringType || length > size_ - location_) {
+\t\t\thas_error_ = true;
+\t\t\treturn std::nullopt;
+\t\t}
+\t\tconst char* data = reinterpret_cast<const char*>(bytes_ + location_);
+\t\tlocation_ += length;
+\t\treturn std::string_view(data, length);
+\t}
+
+\t// Reads the codec type of the data class value at the current position,
+\t// which is followed by the list of its fields.
+\t//
+\t// Returns false if the value is null, or is not of codec type |type|.
+\tbool ReadDataClassType(uint8_t type) {
+\t\tconst uint8_t value_type = ReadByte();
+\t\tif (value_type == kNullType) {
+\t\t\treturn false;
+\t\t}
+\t\tif (value_type != type) {
+\t\t\thas_error_ = true;
+\t\t\treturn false;
+\t\t}
+\t\treturn true;
+\t}
+
+ private:
+\tstatic constexpr uint8_t kNullType = 0;
+\tstatic constexpr uint8_t kStringType = 7;
+\tstatic constexpr uint8_t kListType = 12;
+};
+}  // namespace''');
+  }
+
+  @override
+  void writeDataClass(
+    CppOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Class classDefinition, {
+    required String dartPackageName,
+  }) {
+    indent.writeln('$_commentPrefix ${classDefinition.name}');
+    indent.newln();
+
+    final Iterable<NamedType> orderedFields =
+        getFieldsInSerializationOrder(classDefinition);
+    final Iterable<NamedType> requiredFields =
+        orderedFields.where((NamedType type) => !type.type.isNullable);
+    // Minimal constructor, if needed.
+    if (requiredFields.length != orderedFields.length) {
+      _writeClassConstructor(
+          generatorOptions, root, indent, classDefinition, requiredFields);
+    }
+    // All-field constructor.
+    _writeClassConstructor(
+        generatorOptions, root, indent, classDefinition, orderedFields);
+    if (_hasLazyNonNullableFields(generatorOptions, root, classDefinition)) {
+      // Private constructor for FromEncodableList; see the header.
+      _writeFunctionDefinition(indent, classDefinition.name,
+          scope: classDefinition.name);
+    }
+
+    // Getters and setters.
+    for (final NamedType field in orderedFields) {
+      _writeCppSourceClassField(
+          generatorOptions, root, indent, classDefinition, field);
+    }
+
+    // Serialization.
+    writeClassEncode(
+      generatorOptions,
+      root,
+      indent,
+      classDefinition,
+      dartPackageName: dartPackageName,
+    );
+
+    // Deserialization.
+    writeClassDecode(
       generatorOptions,
       root,
       indent,
@@ -730,6 +1940,30 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
           in getFieldsInSerializationOrder(classDefinition)) {
         final HostDatatype hostDatatype =
             getFieldHostDatatype(field, _shortBaseCppTypeForBuiltinDartType);
+        if (_typedCollectionType(generatorOptions, field.type) != null) {
+          final String instanceVariableName = _makeInstanceVariableName(field);
+          final String converter = field.type.baseName == 'List'
+              ? 'TypedListToEncodable'
+              : 'TypedMapToEncodable';
+          indent.writeln(field.type.isNullable
+              ? 'list.push_back($instanceVariableName ? EncodableValue($converter(*$instanceVariableName)) : EncodableValue());'
+              : 'list.push_back(EncodableValue($converter($instanceVariableName)));');
+          continue;
+        }
+        if (_isLazyField(generatorOptions, root, field)) {
+          // Values that were never decoded are passed through as is.
+          final String encodedInstanceVariableName =
+              _makeEncodedInstanceVariableName(field);
+          final String decodedValue = _wrappedHostApiArgumentExpression(
+              root,
+              _makeInstanceVariableName(field),
+              field.type,
+              _nullableType(hostDatatype),
+              preSerializeClasses: true);
+          indent.writeln(
+              'list.push_back($encodedInstanceVariableName ? EncodableValue(*$encodedInstanceVariableName) : $decodedValue);');
+          continue;
+        }
         final String encodableValue = _wrappedHostApiArgumentExpression(
             root, _makeInstanceVariableName(field), field.type, hostDatatype,
             preSerializeClasses: true);
@@ -737,6 +1971,93 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
       }
       indent.writeln('return list;');
     });
+    indent.newln();
+    final bool usesSerializer = classDefinition.fields.any((NamedType field) =>
+        field.type.isNullable ||
+        !(field.type.baseName == 'String' ||
+            typedDataTypes.contains(field.type.baseName)));
+    _writeFunctionDefinition(indent, 'WriteEncodableList',
+        scope: classDefinition.name,
+        returnType: _voidType,
+        parameters: <String>[
+          // Leave the serializer unnamed if no field uses it, to avoid unused
+          // parameter warnings.
+          'const flutter::StandardCodecSerializer&${usesSerializer ? ' serializer' : ''}',
+          'flutter::ByteStreamWriter* stream',
+        ],
+        isConst: true, body: () {
+      indent.writeln(
+          'WriteListHeader(${classDefinition.fields.length}, stream);');
+      for (final NamedType field
+          in getFieldsInSerializationOrder(classDefinition)) {
+        final String instanceVariableName = _makeInstanceVariableName(field);
+        if (_isLazyField(generatorOptions, root, field)) {
+          final String encodedInstanceVariableName =
+              _makeEncodedInstanceVariableName(field);
+          indent.writeScoped('if ($encodedInstanceVariableName) {',
+              '} else if ($instanceVariableName) {', () {
+            indent.writeln(
+                'WriteList(*$encodedInstanceVariableName, serializer, stream);');
+          });
+          indent.addScoped(null, '} else {', () {
+            indent.writeln(_fieldWriteStatement(
+                generatorOptions, root, field.type, '*$instanceVariableName',
+                memberAccess: '$instanceVariableName->'));
+          });
+          indent.addScoped(null, '}', () {
+            indent.writeln('serializer.WriteValue(EncodableValue(), stream);');
+          });
+        } else if (field.type.isNullable) {
+          indent.writeScoped('if ($instanceVariableName) {', '} else {', () {
+            indent.writeln(_fieldWriteStatement(
+                generatorOptions, root, field.type, '*$instanceVariableName',
+                memberAccess: '$instanceVariableName->'));
+          });
+          indent.addScoped(null, '}', () {
+            indent.writeln('serializer.WriteValue(EncodableValue(), stream);');
+          });
+        } else {
+          indent.writeln(_fieldWriteStatement(
+              generatorOptions, root, field.type, instanceVariableName,
+              memberAccess: '$instanceVariableName.'));
+        }
+      }
+    });
+  }
+
+  /// Returns the statement that writes the non-null field value [value] of
+  /// [type] to `stream`, in the same encoding as `ToEncodableList` but
+  /// without copying the value into an EncodableValue.
+  ///
+  /// [memberAccess] is the prefix used to call a method on the value.
+  String _fieldWriteStatement(CppOptions generatorOptions, Root root,
+      TypeDeclaration type, String value,
+      {required String memberAccess}) {
+    if (_typedCollectionType(generatorOptions, type) != null) {
+      return type.baseName == 'List'
+          ? 'WriteTypedList($value, serializer, stream);'
+          : 'WriteTypedMap($value, serializer, stream);';
+    }
+    if (root.classes.any((Class c) => c.name == type.baseName)) {
+      return '${memberAccess}WriteEncodableList(serializer, stream);';
+    }
+    if (root.enums.any((Enum e) => e.name == type.baseName)) {
+      return 'serializer.WriteValue(EncodableValue((int)$value), stream);';
+    }
+    switch (type.baseName) {
+      case 'String':
+        return 'WriteString($value, stream);';
+      case 'List':
+        return 'WriteList($value, serializer, stream);';
+      case 'Map':
+        return 'WriteMap($value, serializer, stream);';
+      case 'Object':
+        return 'serializer.WriteValue($value, stream);';
+    }
+    if (typedDataTypes.contains(type.baseName)) {
+      return 'WriteTypedData(${_typedDataCodecTypes[type.baseName]}, $value, stream);';
+    }
+    return 'serializer.WriteValue(EncodableValue($value), stream);';
   }
 
   @override
@@ -750,12 +2071,19 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
     // Returns the expression to convert the given EncodableValue to a field
     // value.
     String getValueExpression(NamedType field, String encodable) {
+      final String? typedCollectionType =
+          _typedCollectionType(generatorOptions, field.type);
+      if (typedCollectionType != null) {
+        return field.type.baseName == 'List'
+            ? 'TypedListFromEncodable<$typedCollectionType>(std::get<EncodableList>(std::move($encodable)))'
+            : 'TypedMapFromEncodable<$typedCollectionType>(std::get<EncodableMap>(std::move($encodable)))';
+      }
       if (field.type.isEnum) {
         return '(${field.type.baseName})(std::get<int32_t>($encodable))';
       } else if (field.type.baseName == 'int') {
         return '$encodable.LongValue()';
       } else if (field.type.baseName == 'Object') {
-        return encodable;
+        return 'std::move($encodable)';
       } else {
         final HostDatatype hostDatatype =
             getFieldHostDatatype(field, _shortBaseCppTypeForBuiltinDartType);
@@ -763,9 +2091,11 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
             root.classes
                 .map((Class x) => x.name)
                 .contains(field.type.baseName)) {
-          return '${hostDatatype.datatype}::FromEncodableList(std::get<EncodableList>($encodable))';
-        } else {
+          return '${hostDatatype.datatype}::FromEncodableList(std::get<EncodableList>(std::move($encodable)))';
+        } else if (_isPodType(hostDatatype)) {
           return 'std::get<${hostDatatype.datatype}>($encodable)';
+        } else {
+          return 'std::get<${hostDatatype.datatype}>(std::move($encodable))';
         }
       }
     }
@@ -773,7 +2103,17 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
     _writeFunctionDefinition(indent, 'FromEncodableList',
         scope: classDefinition.name,
         returnType: classDefinition.name,
-        parameters: <String>['const EncodableList& list'], body: () {
+        parameters: <String>['EncodableList list'], body: () {
+      // The list is taken by value so that the field values can be moved out
+      // of it rather than copied. The values are not allocated from a
+      // per-message std::pmr arena: the fields are std::string, std::vector,
+      // EncodableList and EncodableMap, which use the default allocator, and
+      // even MessageReader and ZeroCopyMessageReader, which read from the
+      // message buffer, decode them through
+      // flutter::StandardCodecSerializer::ReadValue. Arena-backed fields
+      // would change the type of every generated field and still need a copy
+      // out of the EncodableValue. Where the allocations matter,
+      // @CppZeroCopy avoids them by viewing the message buffer instead.
       const String instanceVariable = 'decoded';
       final Iterable<_IndexedField> indexedFields = indexMap(
           getFieldsInSerializationOrder(classDefinition),
@@ -783,16 +2123,37 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
       final Iterable<_IndexedField> nonNullableFields = indexedFields
           .where((_IndexedField field) => !field.field.type.isNullable);
 
-      // Non-nullable fields must be set via the constructor.
-      String constructorArgs = nonNullableFields
-          .map((_IndexedField param) =>
-              getValueExpression(param.field, 'list[${param.index}]'))
-          .join(',\n\t');
-      if (constructorArgs.isNotEmpty) {
-        constructorArgs = '(\n\t$constructorArgs)';
+      // Returns the statement that stores the encoded value of a lazy field,
+      // to be decoded on first access.
+      String lazyFieldStatement(NamedType field, String encodable) {
+        return '$instanceVariable.${_makeEncodedInstanceVariableName(field)} = std::get<EncodableList>(std::move($encodable));';
+      }
+
+      if (_hasLazyNonNullableFields(generatorOptions, root, classDefinition)) {
+        // Lazy fields have no value to pass to the constructor, so all
+        // non-nullable fields are set directly.
+        indent.writeln('${classDefinition.name} $instanceVariable;');
+        for (final _IndexedField entry in nonNullableFields) {
+          final String encodable = 'list[${entry.index}]';
+          if (_isLazyField(generatorOptions, root, entry.field)) {
+            indent.writeln(lazyFieldStatement(entry.field, encodable));
+          } else {
+            indent.writeln(
+                '$instanceVariable.${_makeInstanceVariableName(entry.field)} = ${getValueExpression(entry.field, encodable)};');
+          }
+        }
+      } else {
+        // Non-nullable fields must be set via the constructor.
+        String constructorArgs = nonNullableFields
+            .map((_IndexedField param) =>
+                getValueExpression(param.field, 'list[${param.index}]'))
+            .join(',\n\t');
+        if (constructorArgs.isNotEmpty) {
+          constructorArgs = '(\n\t$constructorArgs)';
+        }
+        indent.format(
+            '${classDefinition.name} $instanceVariable$constructorArgs;');
       }
-      indent
-          .format('${classDefinition.name} $instanceVariable$constructorArgs;');
 
       // Add the nullable fields via setters, since converting the encodable
       // values to the pointer types that the convenience constructor uses for
@@ -807,7 +2168,11 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
         final String valueExpression =
             getValueExpression(field, encodableFieldName);
         indent.writeScoped('if (!$encodableFieldName.IsNull()) {', '}', () {
-          indent.writeln('$instanceVariable.$setterName($valueExpression);');
+          if (_isLazyField(generatorOptions, root, field)) {
+            indent.writeln(lazyFieldStatement(field, encodableFieldName));
+          } else {
+            indent.writeln('$instanceVariable.$setterName($valueExpression);');
+          }
         });
       }
 
@@ -830,6 +2195,11 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
     if (getCodecClasses(api, root).isNotEmpty) {
       _writeCodec(generatorOptions, root, indent, api);
     }
+    if (api.isBatched) {
+      _writeBatchedFlutterApi(root, indent, api,
+          dartPackageName: dartPackageName);
+      return;
+    }
     indent.writeln(
         '$_commentPrefix Generated class from Pigeon that represents Flutter messages that can be called from C++.');
     _writeFunctionDefinition(indent, api.name,
@@ -866,12 +2236,8 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
           scope: api.name,
           returnType: _voidType,
           parameters: parameters, body: () {
-        const String channel = 'channel';
         indent.writeln(
             'const std::string channel_name = "${makeChannelName(api, func, dartPackageName)}";');
-        indent.writeln(
-            'auto channel = std::make_unique<BasicMessageChannel<>>(binary_messenger_, '
-            'channel_name, &GetCodec());');
 
         // Convert arguments to EncodableValue versions.
         const String argumentListVariableName = 'encoded_api_arguments';
@@ -889,7 +2255,10 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
           });
         }
 
-        indent.write('$channel->Send($argumentListVariableName, '
+        indent.writeln('MessageWriter writer;');
+        indent.writeln(
+            '$codeSerializerName::GetInstance().WriteValue($argumentListVariableName, &writer);');
+        indent.write('binary_messenger_->Send(channel_name, writer.data(), writer.size(), '
             // ignore: missing_whitespace_between_adjacent_strings
             '[channel_name, on_success = std::move(on_success), on_error = std::move(on_error)]'
             '(const uint8_t* reply, size_t reply_size) ');
@@ -898,185 +2267,784 @@ class CppSourceGenerator extends StructuredGenerator<CppOptions> {
           successCallbackArgument = 'return_value';
           final String encodedReplyName = 'encodable_$successCallbackArgument';
           final String listReplyName = 'list_$successCallbackArgument';
+          // Decode into a local value rather than through the codec, which
+          // would heap-allocate it.
+          indent.writeln('EncodableValue $encodedReplyName;');
+          indent.writeScoped('if (reply_size > 0) {', '}', () {
+            indent.writeln('MessageReader reader(reply, reply_size);');
+            indent.writeln(
+                'EncodableValue value = $codeSerializerName::GetInstance().ReadValue(&reader);');
+            indent.writeScoped('if (!reader.has_error()) {', '}', () {
+              indent.writeln('$encodedReplyName = std::move(value);');
+            });
+          });
           indent.writeln(
-              'std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);');
-          indent.writeln('const auto& $encodedReplyName = *response;');
+              'const auto* $listReplyName = std::get_if<EncodableList>(&$encodedReplyName);');
+          indent.writeScoped('if ($listReplyName) {', '} ', () {
+            indent.writeScoped('if ($listReplyName->size() > 1) {', '} ', () {
+              indent.writeln(
+                  'on_error(FlutterError(std::get<std::string>($listReplyName->at(0)), std::get<std::string>($listReplyName->at(1)), $listReplyName->at(2)));');
+            }, addTrailingNewline: false);
+            indent.addScoped('else {', '}', () {
+              if (func.returnType.isVoid) {
+                successCallbackArgument = '';
+              } else {
+                _writeEncodableValueArgumentUnwrapping(
+                  indent,
+                  root,
+                  returnType,
+                  argName: successCallbackArgument,
+                  encodableArgName: '$listReplyName->at(0)',
+                  apiType: ApiType.flutter,
+                );
+              }
+              indent.writeln('on_success($successCallbackArgument);');
+            });
+          }, addTrailingNewline: false);
+          indent.addScoped('else {', '} ', () {
+            indent.writeln('on_error(CreateConnectionError(channel_name));');
+          });
+        });
+      });
+    }
+  }
+
+  void _writeBatchedFlutterApi(Root root, Indent indent, Api api,
+      {required String dartPackageName}) {
+    indent.writeln(
+        '$_commentPrefix Generated class from Pigeon that represents Flutter messages that can be called from C++.');
+    _writeFunctionDefinition(indent, api.name,
+        scope: api.name,
+        parameters: <String>['flutter::BinaryMessenger* binary_messenger'],
+        initializers: <String>[
+          '${api.name}(binary_messenger, $_defaultMaxBatchSize)'
+        ]);
+    _writeFunctionDefinition(indent, api.name,
+        scope: api.name,
+        parameters: <String>[
+          'flutter::BinaryMessenger* binary_messenger',
+          'size_t max_batch_size',
+        ],
+        initializers: <String>[
+          'binary_messenger_(binary_messenger)',
+          'max_batch_size_(max_batch_size)',
+        ]);
+    final String codeSerializerName = getCodecClasses(api, root).isNotEmpty
+        ? _getCodecSerializerName(api)
+        : _defaultCodecSerializer;
+    _writeFunctionDefinition(indent, 'GetCodec',
+        scope: api.name,
+        returnType: 'const flutter::StandardMessageCodec&', body: () {
+      indent.writeln(
+          'return flutter::StandardMessageCodec::GetInstance(&$codeSerializerName::GetInstance());');
+    });
+    enumerate(api.methods, (int index, Method func) {
+      final Iterable<_HostNamedType> hostParameters =
+          indexMap(func.parameters, (int i, NamedType arg) {
+        final HostDatatype hostType =
+            getFieldHostDatatype(arg, _shortBaseCppTypeForBuiltinDartType);
+        return _HostNamedType(_getSafeArgumentName(i, arg), hostType, arg.type);
+      });
+      _writeFunctionDefinition(indent, _makeMethodName(func),
+          scope: api.name,
+          returnType: _voidType,
+          parameters: hostParameters
+              .map((_HostNamedType arg) =>
+                  '${_flutterApiArgumentType(arg.hostType)} ${arg.name}')
+              .toList(), body: () {
+        indent.writeln('pending_calls_.push_back(EncodableValue($index));');
+        if (func.parameters.isEmpty) {
+          indent.writeln(
+              'pending_calls_.push_back(EncodableValue(EncodableList()));');
+        } else {
+          indent.write('pending_calls_.push_back(');
+          indent.addScoped('EncodableValue(EncodableList{', '}));', () {
+            for (final _HostNamedType param in hostParameters) {
+              final String encodedArgument = _wrappedHostApiArgumentExpression(
+                  root, param.name, param.originalType, param.hostType,
+                  preSerializeClasses: false);
+              indent.writeln('$encodedArgument,');
+            }
+          });
+        }
+        indent.writeScoped(
+            'if (pending_call_count() >= max_batch_size_) {', '}', () {
+          indent.writeln('Flush();');
+        });
+      });
+    });
+    _writeFunctionDefinition(indent, 'Flush',
+        scope: api.name, returnType: _voidType, body: () {
+      indent.writeScoped('if (pending_calls_.empty()) {', '}', () {
+        indent.writeln('return;');
+      });
+      indent.writeln('EncodableValue batch(std::move(pending_calls_));');
+      indent.writeln('pending_calls_.clear();');
+      indent.writeln('MessageWriter writer;');
+      indent.writeln(
+          '$codeSerializerName::GetInstance().WriteValue(batch, &writer);');
+      indent.writeln(
+          'binary_messenger_->Send("${makeBatchChannelName(api, dartPackageName)}", writer.data(), writer.size());');
+    });
+    _writeFunctionDefinition(indent, 'pending_call_count',
+        scope: api.name, returnType: 'size_t', isConst: true, body: () {
+      indent.writeln('return pending_calls_.size() / 2;');
+    });
+  }
+
+  @override
+  void writeHostApi(
+    CppOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Api api, {
+    required String dartPackageName,
+  }) {
+    assert(api.location == ApiLocation.host);
+    if (api.isFfi) {
+      _writeFfiHostApi(root, indent, api);
+      return;
+    }
+    if (getCodecClasses(api, root).isNotEmpty) {
+      _writeCodec(generatorOptions, root, indent, api);
+    }
+    if (api.isStream) {
+      for (final Method func in api.methods) {
+        _writeStreamApi(root, indent, api, func,
+            dartPackageName: dartPackageName);
+      }
+      return;
+    }
+
+    final String codeSerializerName = getCodecClasses(api, root).isNotEmpty
+        ? _getCodecSerializerName(api)
+        : _defaultCodecSerializer;
+    indent.writeln('/// The codec used by ${api.name}.');
+    _writeFunctionDefinition(indent, 'GetCodec',
+        scope: api.name,
+        returnType: 'const flutter::StandardMessageCodec&', body: () {
+      indent.writeln(
+          'return flutter::StandardMessageCodec::GetInstance(&$codeSerializerName::GetInstance());');
+    });
+    indent.writeln(
+        '$_commentPrefix Sets up an instance of `${api.name}` to handle messages through the `binary_messenger`.');
+    final bool hasBackgroundMethods =
+        _hasBackgroundTaskQueueMethods(root, api: api);
+    final bool useCoroutines = generatorOptions.useCoroutines ?? false;
+    _writeFunctionDefinition(indent, 'SetUp',
+        scope: api.name,
+        returnType: _voidType,
+        parameters: <String>[
+          'flutter::BinaryMessenger* binary_messenger',
+          '${api.name}* api',
+          if (hasBackgroundMethods) 'PlatformTaskRunner platform_task_runner',
+        ], body: () {
+      if (hasBackgroundMethods) {
+        indent.format('''
+// Runs the methods that use a background task queue. It is shared by their
+// message handlers, and destroyed once they are all removed.
+std::shared_ptr<TaskQueue> task_queue;
+if (api != nullptr) {
+\ttask_queue = std::make_shared<TaskQueue>();
+}''');
+      }
+      if (api.singleChannel) {
+        _writeSingleChannelHostApiSetUp(indent, root, api,
+            dartPackageName: dartPackageName, useCoroutines: useCoroutines);
+        return;
+      }
+      for (final Method method in api.methods) {
+        final String channelName =
+            makeChannelName(api, method, dartPackageName);
+        if (method.cppZeroCopy) {
+          _writeZeroCopyHostMethodSetUp(indent, root, api, method,
+              channelName: channelName,
+              codecSerializerName: codeSerializerName);
+          continue;
+        }
+        if (!_usesBackgroundTaskQueue(method)) {
+          indent.writeln(
+              'PigeonSetUpHostMethod<${api.name}>(binary_messenger, "$channelName", &GetCodec(), api,');
+          indent.nest(2, () {
+            indent.write(
+                '[](${api.name}* host_api, const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) ');
+            indent.addScoped('{', '});', () {
+              if (method.parameters.isNotEmpty) {
+                indent.writeln(
+                    'const auto& args = std::get<EncodableList>(message);');
+              }
+              _writeHostMethodCall(indent, root, method,
+                  argumentOffset: 0,
+                  useCoroutines: useCoroutines,
+                  apiName: 'host_api');
+            });
+          });
+          continue;
+        }
+        indent.writeScoped('{', '}', () {
+          indent.writeln(
+              'auto channel = std::make_unique<BasicMessageChannel<>>(binary_messenger, '
+              '"$channelName", &GetCodec());');
+          indent.writeScoped('if (api != nullptr) {', '} else {', () {
+            indent.write(
+                'channel->SetMessageHandler([api, task_queue, platform_task_runner](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) ');
+            indent.addScoped('{', '});', () {
+              _writeBackgroundHostMethodCall(indent, root, method,
+                  argumentOffset: 0, useCoroutines: useCoroutines);
+            });
+          });
+          indent.addScoped(null, '}', () {
+            indent.writeln('channel->SetMessageHandler(nullptr);');
+          });
+        });
+      }
+    });
+
+    _writeFunctionDefinition(indent, 'WrapError',
+        scope: api.name,
+        returnType: 'EncodableValue',
+        parameters: <String>['std::string_view error_message'], body: () {
+      indent.writeln('return PigeonWrapError(error_message);');
+    });
+    _writeFunctionDefinition(indent, 'WrapError',
+        scope: api.name,
+        returnType: 'EncodableValue',
+        parameters: <String>['const FlutterError& error'], body: () {
+      indent.writeln('return PigeonWrapError(error);');
+    });
+  }
+
+  void _writeFfiHostApi(Root root, Indent indent, Api api) {
+    final String instanceName =
+        'pigeon_${_snakeCaseFromCamelCase(api.name)}_instance';
+    indent.writeln(
+        '$_commentPrefix The instance of `${api.name}` that handles calls from Flutter.');
+    indent.writeln('static std::atomic<${api.name}*> $instanceName{nullptr};');
+    indent.newln();
+    _writeFunctionDefinition(indent, 'SetUp',
+        scope: api.name,
+        returnType: _voidType,
+        parameters: <String>['${api.name}* api'], body: () {
+      indent.writeln('$instanceName.store(api);');
+    });
+    for (final Method method in api.methods) {
+      _writeFunctionDefinition(indent, makeFfiFunctionName(api, method),
+          returnType: 'bool',
+          parameters: _ffiFunctionParameters(method), body: () {
+        indent.writeln('${api.name}* api = $instanceName.load();');
+        indent.writeScoped('if (api == nullptr) {', '}', () {
+          indent.writeln(
+              'PigeonFfiSetError(error, "channel-error", "${api.name} has not been set up.");');
+          indent.writeln('return false;');
+        });
+        final List<String> arguments = <String>[
+          for (final Parameter param in method.parameters)
+            _ffiArgumentExpression(root, param),
+        ];
+        final String call =
+            'api->${_makeMethodName(method)}(${arguments.join(', ')})';
+        final HostDatatype returnType = getHostDatatype(
+            method.returnType, _shortBaseCppTypeForBuiltinDartType);
+        indent.writeScoped('try {', '}', () {
+          if (method.returnType.isVoid) {
+            indent.writeln('std::optional<FlutterError> output = $call;');
+            indent.writeScoped('if (output.has_value()) {', '}', () {
+              indent.writeln(
+                  'PigeonFfiSetError(error, output->code(), output->message());');
+              indent.writeln('return false;');
+            });
+          } else {
+            indent.writeln('${_hostApiReturnType(returnType)} output = $call;');
+            indent.writeScoped('if (output.has_error()) {', '}', () {
+              indent.writeln(
+                  'PigeonFfiSetError(error, output.error().code(), output.error().message());');
+              indent.writeln('return false;');
+            });
+            _writeFfiResultAssignment(root, indent, method.returnType);
+          }
+          indent.writeln('return true;');
+        }, addTrailingNewline: false);
+        indent.add(' catch (const std::exception& exception) ');
+        indent.addScoped('{', '}', () {
+          indent.writeln(
+              'PigeonFfiSetError(error, exception.what(), "Error");');
+          indent.writeln('return false;');
+        });
+      });
+    }
+    _writeFunctionDefinition(indent, makeFfiFreeStringFunctionName(api),
+        returnType: _voidType, parameters: <String>['char* string'], body: () {
+      indent.writeln('delete[] string;');
+    });
+  }
+
+  /// Returns the expression that converts the `extern "C"` argument [param]
+  /// to the argument of the C++ method.
+  String _ffiArgumentExpression(Root root, Parameter param) {
+    final String name = _makeVariableName(param);
+    final Iterable<Class> classes =
+        root.classes.where((Class c) => c.name == param.type.baseName);
+    if (classes.isEmpty) {
+      return name;
+    }
+    final Iterable<String> fields = getFieldsInSerializationOrder(classes.first)
+        .map((NamedType field) => '$name.${_makeVariableName(field)}');
+    return '${classes.first.name}(${fields.join(', ')})';
+  }
+
+  /// Writes the assignment of the value of `output` to the result pointer of
+  /// an `extern "C"` function.
+  void _writeFfiResultAssignment(
+      Root root, Indent indent, TypeDeclaration returnType) {
+    if (returnType.baseName == 'String') {
+      indent.writeln('*result = PigeonFfiCopyString(output.value());');
+      return;
+    }
+    final Iterable<Class> classes =
+        root.classes.where((Class c) => c.name == returnType.baseName);
+    if (classes.isEmpty) {
+      indent.writeln('*result = output.value();');
+      return;
+    }
+    indent.writeln('const ${classes.first.name}& value = output.value();');
+    final Iterable<String> fields = getFieldsInSerializationOrder(classes.first)
+        .map((NamedType field) => 'value.${_makeGetterName(field)}()');
+    indent.writeln(
+        '*result = ${_getFfiStructName(classes.first.name)}{${fields.join(', ')}};');
+  }
+
+  void _writeStreamApi(Root root, Indent indent, Api api, Method func,
+      {required String dartPackageName}) {
+    final String className = _getStreamClassName(api, func);
+    final HostDatatype eventType =
+        getHostDatatype(func.returnType, _shortBaseCppTypeForBuiltinDartType);
+    final String codeSerializerName = getCodecClasses(api, root).isNotEmpty
+        ? _getCodecSerializerName(api)
+        : _defaultCodecSerializer;
+    _writeFunctionDefinition(indent, className,
+        scope: className,
+        parameters: <String>['flutter::BinaryMessenger* binary_messenger'],
+        initializers: <String>[
+          '$className(binary_messenger, $_defaultMaxStreamQueueSize, StreamOverflowPolicy::kDropOldest)'
+        ]);
+    _writeFunctionDefinition(indent, className,
+        scope: className,
+        parameters: <String>[
+          'flutter::BinaryMessenger* binary_messenger',
+          'size_t max_queue_size',
+          'StreamOverflowPolicy overflow_policy',
+        ],
+        initializers: <String>[
+          'max_queue_size_(max_queue_size)',
+          'overflow_policy_(overflow_policy)',
+        ], body: () {
+      indent.writeln(
+          'event_channel_ = std::make_unique<flutter::EventChannel<EncodableValue>>(binary_messenger, '
+          '"${makeChannelName(api, func, dartPackageName)}", &GetCodec());');
+      indent.format('''
+event_channel_->SetStreamHandler(std::make_unique<flutter::StreamHandlerFunctions<EncodableValue>>(
+\t[this](const EncodableValue* arguments, std::unique_ptr<flutter::EventSink<EncodableValue>>&& events)
+\t\t\t-> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+\t\t// Flutter listens with the number of events it is ready to receive.
+\t\tOnListen(arguments && !arguments->IsNull() ? arguments->LongValue() : 0, std::move(events));
+\t\treturn nullptr;
+\t},
+\t[this](const EncodableValue* arguments)
+\t\t\t-> std::unique_ptr<flutter::StreamHandlerError<EncodableValue>> {
+\t\tOnCancel();
+\t\treturn nullptr;
+\t}));''');
+      indent.writeln(
+          'credit_channel_ = std::make_unique<BasicMessageChannel<>>(binary_messenger, '
+          '"${makeStreamCreditChannelName(api, func, dartPackageName)}", '
+          '&flutter::StandardMessageCodec::GetInstance(&$codeSerializerName::GetInstance()));');
+      indent.format('''
+credit_channel_->SetMessageHandler([this](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+\tAddCredit(message.LongValue());
+\treply(EncodableValue());
+});''');
+    });
+    _writeFunctionDefinition(indent, '~$className', scope: className,
+        body: () {
+      indent.writeln('event_channel_->SetStreamHandler(nullptr);');
+      indent.writeln('credit_channel_->SetMessageHandler(nullptr);');
+    });
+    _writeFunctionDefinition(indent, 'GetCodec',
+        scope: className,
+        returnType: 'const flutter::StandardMethodCodec&', body: () {
+      indent.writeln(
+          'return flutter::StandardMethodCodec::GetInstance(&$codeSerializerName::GetInstance());');
+    });
+    _writeFunctionDefinition(indent, 'SetListenHandlers',
+        scope: className,
+        returnType: _voidType,
+        parameters: <String>[
+          'std::function<void()> on_listen',
+          'std::function<void()> on_cancel',
+        ], body: () {
+      indent.writeln('on_listen_ = std::move(on_listen);');
+      indent.writeln('on_cancel_ = std::move(on_cancel);');
+    });
+    final String encodedEvent = _wrappedHostApiArgumentExpression(
+        root, 'event', func.returnType, eventType,
+        preSerializeClasses: false);
+    _writeFunctionDefinition(indent, 'Send',
+        scope: className,
+        returnType: _voidType,
+        parameters: <String>['${_flutterApiArgumentType(eventType)} event'],
+        body: () {
+      indent.format('''
+if (!sink_ || end_of_stream_) {
+\treturn;
+}
+if (credit_ > 0 && queue_.empty()) {
+\t--credit_;
+\tsink_->Success($encodedEvent);
+\treturn;
+}
+if (queue_.size() >= max_queue_size_) {
+\t++dropped_event_count_;
+\tif (overflow_policy_ == StreamOverflowPolicy::kDropNewest || queue_.empty()) {
+\t\treturn;
+\t}
+\tqueue_.pop_front();
+}
+queue_.push_back($encodedEvent);''');
+    });
+    _writeFunctionDefinition(indent, 'EndOfStream',
+        scope: className, returnType: _voidType, body: () {
+      indent.writeScoped('if (!sink_) {', '}', () {
+        indent.writeln('return;');
+      });
+      indent.writeln('end_of_stream_ = true;');
+      indent.writeln('SendQueuedEvents();');
+    });
+    _writeFunctionDefinition(indent, 'is_listening',
+        scope: className, returnType: 'bool', isConst: true, body: () {
+      indent.writeln('return sink_ != nullptr;');
+    });
+    _writeFunctionDefinition(indent, 'queued_event_count',
+        scope: className, returnType: 'size_t', isConst: true, body: () {
+      indent.writeln('return queue_.size();');
+    });
+    _writeFunctionDefinition(indent, 'dropped_event_count',
+        scope: className, returnType: 'size_t', isConst: true, body: () {
+      indent.writeln('return dropped_event_count_;');
+    });
+    _writeFunctionDefinition(indent, 'OnListen',
+        scope: className,
+        returnType: _voidType,
+        parameters: <String>[
+          'int64_t credit',
+          'std::unique_ptr<flutter::EventSink<EncodableValue>> sink',
+        ], body: () {
+      indent.writeln('sink_ = std::move(sink);');
+      indent.writeln('credit_ = credit;');
+      indent.writeln('queue_.clear();');
+      indent.writeln('end_of_stream_ = false;');
+      indent.writeScoped('if (on_listen_) {', '}', () {
+        indent.writeln('on_listen_();');
+      });
+    });
+    _writeFunctionDefinition(indent, 'OnCancel',
+        scope: className, returnType: _voidType, body: () {
+      indent.writeln('sink_.reset();');
+      indent.writeln('credit_ = 0;');
+      indent.writeln('queue_.clear();');
+      indent.writeln('end_of_stream_ = false;');
+      indent.writeScoped('if (on_cancel_) {', '}', () {
+        indent.writeln('on_cancel_();');
+      });
+    });
+    _writeFunctionDefinition(indent, 'AddCredit',
+        scope: className,
+        returnType: _voidType,
+        parameters: <String>['int64_t credit'], body: () {
+      indent.writeScoped('if (!sink_) {', '}', () {
+        indent.writeln('return;');
+      });
+      indent.writeln('credit_ += credit;');
+      indent.writeln('SendQueuedEvents();');
+    });
+    _writeFunctionDefinition(indent, 'SendQueuedEvents',
+        scope: className, returnType: _voidType, body: () {
+      indent.format('''
+while (credit_ > 0 && !queue_.empty()) {
+\t--credit_;
+\tsink_->Success(queue_.front());
+\tqueue_.pop_front();
+}
+if (end_of_stream_ && queue_.empty()) {
+\tsink_->EndOfStream();
+\tsink_.reset();
+\tend_of_stream_ = false;
+}''');
+    });
+  }
+
+  /// Writes the code to unwrap the arguments of [method] from `args`, starting
+  /// at [argumentOffset], call the API method, and reply with its result.
+  void _writeHostMethodCall(Indent indent, Root root, Method method,
+      {required int argumentOffset,
+      required bool useCoroutines,
+      String apiName = 'api'}) {
+    final List<String> methodArgument = <String>[];
+    enumerate(method.parameters, (int index, NamedType arg) {
+      final String argName = _getSafeArgumentName(index, arg);
+      final String encodableArgName = '${_encodablePrefix}_$argName';
+      indent.writeln(
+          'const auto& $encodableArgName = args.at(${index + argumentOffset});');
+      methodArgument.add(_writeHostApiArgumentUnwrapping(indent, root, arg,
+          argName: argName, encodableArgName: encodableArgName));
+    });
+
+    final HostDatatype returnType = getHostDatatype(
+        method.returnType, _shortBaseCppTypeForBuiltinDartType);
+    final String returnTypeName = _hostApiReturnType(returnType);
+    if (method.isAsynchronous && useCoroutines) {
+      // The completion doesn't capture anything, so it is passed as a
+      // function pointer and stored in the coroutine frame.
+      indent.format(
+        '$apiName->${_makeMethodName(method)}(${methodArgument.join(', ')}).Then(${indent.newline}'
+        '\t\treply,${indent.newline}'
+        '\t\t[]($returnTypeName&& output, const flutter::MessageReply<EncodableValue>& task_reply) {${indent.newline}'
+        '\t\t\t${_replyStatement(root, method.returnType, 'std::move(output)', reply: 'task_reply')}${indent.newline}'
+        '\t\t},${indent.newline}'
+        '\t\t&WrapError);',
+      );
+      return;
+    }
+    if (method.isAsynchronous) {
+      methodArgument.add(
+        '[reply]($returnTypeName&& output) {${indent.newline}'
+        '\t${_replyStatement(root, method.returnType, 'std::move(output)')}${indent.newline}'
+        '}',
+      );
+    }
+    final String call =
+        '$apiName->${_makeMethodName(method)}(${methodArgument.join(', ')})';
+    if (method.isAsynchronous) {
+      indent.format('$call;');
+    } else {
+      indent.writeln(_replyStatement(root, method.returnType, call));
+    }
+  }
+
+  /// Writes the code to run [method] on the API's `task_queue`, with a `reply`
+  /// that is sent on the platform thread.
+  ///
+  /// The message is copied into the task, since it is only valid until the
+  /// message handler returns.
+  void _writeBackgroundHostMethodCall(Indent indent, Root root, Method method,
+      {required int argumentOffset, required bool useCoroutines}) {
+    // The embedder requires channel replies on the platform thread, so a
+    // missing runner is reported to the caller rather than replying from the
+    // task queue's thread.
+    indent.writeScoped('if (!platform_task_runner) {', '}', () {
+      indent.writeln(
+          'reply(WrapError("${method.name} runs on a background task queue, which needs the platform_task_runner passed to SetUp."));');
+      indent.writeln('return;');
+    });
+    indent.write(
+        'task_queue->Post([api, message, reply = ReplyOnPlatformThread(platform_task_runner, reply)]() ');
+    indent.addScoped('{', '});', () {
+      indent.writeScoped('try {', '}', () {
+        if (method.parameters.isNotEmpty) {
           indent.writeln(
-              'const auto* $listReplyName = std::get_if<EncodableList>(&$encodedReplyName);');
-          indent.writeScoped('if ($listReplyName) {', '} ', () {
-            indent.writeScoped('if ($listReplyName->size() > 1) {', '} ', () {
-              indent.writeln(
-                  'on_error(FlutterError(std::get<std::string>($listReplyName->at(0)), std::get<std::string>($listReplyName->at(1)), $listReplyName->at(2)));');
-            }, addTrailingNewline: false);
-            indent.addScoped('else {', '}', () {
-              if (func.returnType.isVoid) {
-                successCallbackArgument = '';
-              } else {
-                _writeEncodableValueArgumentUnwrapping(
-                  indent,
-                  root,
-                  returnType,
-                  argName: successCallbackArgument,
-                  encodableArgName: '$listReplyName->at(0)',
-                  apiType: ApiType.flutter,
-                );
-              }
-              indent.writeln('on_success($successCallbackArgument);');
+              'const auto& args = std::get<EncodableList>(message);');
+        }
+        _writeHostMethodCall(indent, root, method,
+            argumentOffset: argumentOffset, useCoroutines: useCoroutines);
+      }, addTrailingNewline: false);
+      indent.add(' catch (const std::exception& exception) ');
+      indent.addScoped('{', '}', () {
+        indent.writeln('reply(WrapError(exception.what()));');
+      });
+    });
+  }
+
+  /// Writes the set up of a host API that receives all of its methods on one
+  /// channel, with the method index as the first element of each message.
+  void _writeSingleChannelHostApiSetUp(Indent indent, Root root, Api api,
+      {required String dartPackageName, required bool useCoroutines}) {
+    indent.writeln(
+        'auto channel = std::make_unique<BasicMessageChannel<>>(binary_messenger, '
+        '"${makeDispatchChannelName(api, dartPackageName)}", &GetCodec());');
+    final String captures = _hasBackgroundTaskQueueMethods(root, api: api)
+        ? 'api, task_queue, platform_task_runner'
+        : 'api';
+    indent.writeScoped('if (api != nullptr) {', '} else {', () {
+      indent.write(
+          'channel->SetMessageHandler([$captures](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) ');
+      indent.addScoped('{', '});', () {
+        indent.writeScoped('try {', '}', () {
+          indent.write(
+              'switch (std::get<EncodableList>(message).at(0).LongValue()) ');
+          indent.addScoped('{', '}', () {
+            enumerate(api.methods, (int index, Method method) {
+              indent.writeScoped('case $index: {', '}', () {
+                if (_usesBackgroundTaskQueue(method)) {
+                  _writeBackgroundHostMethodCall(indent, root, method,
+                      argumentOffset: 1, useCoroutines: useCoroutines);
+                } else {
+                  if (method.parameters.isNotEmpty) {
+                    indent.writeln(
+                        'const auto& args = std::get<EncodableList>(message);');
+                  }
+                  _writeHostMethodCall(indent, root, method,
+                      argumentOffset: 1, useCoroutines: useCoroutines);
+                }
+                indent.writeln('return;');
+              });
+            });
+            indent.writeln('default:');
+            indent.nest(1, () {
+              indent.writeln('reply(WrapError("Unknown method index."));');
             });
-          }, addTrailingNewline: false);
-          indent.addScoped('else {', '} ', () {
-            indent.writeln('on_error(CreateConnectionError(channel_name));');
           });
+        }, addTrailingNewline: false);
+        indent.add(' catch (const std::exception& exception) ');
+        indent.addScoped('{', '}', () {
+          indent.writeln('reply(WrapError(exception.what()));');
         });
       });
-    }
+    });
+    indent.addScoped(null, '}', () {
+      indent.writeln('channel->SetMessageHandler(nullptr);');
+    });
   }
 
-  @override
-  void writeHostApi(
-    CppOptions generatorOptions,
-    Root root,
+  /// Writes the code to check and unwrap the host API argument [arg] from an
+  /// existing EncodableValue variable called [encodableArgName], and returns
+  /// the expression to pass it to the API method.
+  String _writeHostApiArgumentUnwrapping(
     Indent indent,
-    Api api, {
-    required String dartPackageName,
+    Root root,
+    NamedType arg, {
+    required String argName,
+    required String encodableArgName,
   }) {
-    assert(api.location == ApiLocation.host);
-    if (getCodecClasses(api, root).isNotEmpty) {
-      _writeCodec(generatorOptions, root, indent, api);
+    final HostDatatype hostType = getHostDatatype(arg.type,
+        (TypeDeclaration x) => _shortBaseCppTypeForBuiltinDartType(x));
+    if (!arg.type.isNullable) {
+      indent.writeScoped('if ($encodableArgName.IsNull()) {', '}', () {
+        indent.writeln('reply(WrapError("$argName unexpectedly null."));');
+        indent.writeln('return;');
+      });
     }
+    _writeEncodableValueArgumentUnwrapping(
+      indent,
+      root,
+      hostType,
+      argName: argName,
+      encodableArgName: encodableArgName,
+      apiType: ApiType.host,
+    );
+    final String unwrapEnum = arg.type.isEnum && arg.type.isNullable
+        ? ' ? &(*$argName) : nullptr'
+        : '';
+    return '$argName$unwrapEnum';
+  }
 
-    final String codeSerializerName = getCodecClasses(api, root).isNotEmpty
-        ? _getCodecSerializerName(api)
-        : _defaultCodecSerializer;
-    indent.writeln('/// The codec used by ${api.name}.');
-    _writeFunctionDefinition(indent, 'GetCodec',
-        scope: api.name,
-        returnType: 'const flutter::StandardMessageCodec&', body: () {
-      indent.writeln(
-          'return flutter::StandardMessageCodec::GetInstance(&$codeSerializerName::GetInstance());');
-    });
-    indent.writeln(
-        '$_commentPrefix Sets up an instance of `${api.name}` to handle messages through the `binary_messenger`.');
-    _writeFunctionDefinition(indent, 'SetUp',
-        scope: api.name,
-        returnType: _voidType,
-        parameters: <String>[
-          'flutter::BinaryMessenger* binary_messenger',
-          '${api.name}* api'
-        ], body: () {
-      for (final Method method in api.methods) {
-        final String channelName =
-            makeChannelName(api, method, dartPackageName);
-        indent.writeScoped('{', '}', () {
-          indent.writeln(
-              'auto channel = std::make_unique<BasicMessageChannel<>>(binary_messenger, '
-              '"$channelName", &GetCodec());');
-          indent.writeScoped('if (api != nullptr) {', '} else {', () {
-            indent.write(
-                'channel->SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) ');
-            indent.addScoped('{', '});', () {
-              indent.writeScoped('try {', '}', () {
-                final List<String> methodArgument = <String>[];
-                if (method.parameters.isNotEmpty) {
+  /// Writes the set up of a `@CppZeroCopy` host API method.
+  ///
+  /// The handler is registered with the binary messenger directly, so that the
+  /// message can be read in place and typed data arguments passed as views
+  /// into the message buffer, which is valid until the handler returns.
+  ///
+  /// Data class arguments are decoded from the message straight into the
+  /// class, rather than into a CustomEncodableValue holding a copy of it, and
+  /// are then moved into the implementation.
+  void _writeZeroCopyHostMethodSetUp(
+    Indent indent,
+    Root root,
+    Api api,
+    Method method, {
+    required String channelName,
+    required String codecSerializerName,
+  }) {
+    assert(method.cppZeroCopy && !method.isAsynchronous);
+    indent.writeScoped('{', '}', () {
+      indent.writeScoped('if (api != nullptr) {', '} else {', () {
+        indent.write(
+            'binary_messenger->SetMessageHandler("$channelName", [api](const uint8_t* message, size_t message_size, flutter::BinaryReply binary_reply) ');
+        indent.addScoped('{', '});', () {
+          indent.write(
+              'auto reply = [&binary_reply](const EncodableValue& response) ');
+          indent.addScoped('{', '};', () {
+            indent.writeln('MessageWriter writer;');
+            indent.writeln(
+                '$codecSerializerName::GetInstance().WriteValue(response, &writer);');
+            indent.writeln('binary_reply(writer.data(), writer.size());');
+          });
+          indent.writeScoped('try {', '}', () {
+            indent.writeln(
+                'ZeroCopyMessageReader reader(message, message_size);');
+            indent.writeln(
+                'reader.ReadArgumentListHeader(${method.parameters.length});');
+            final List<String> argNames = <String>[];
+            enumerate(method.parameters, (int index, NamedType arg) {
+              final String argName = _getSafeArgumentName(index, arg);
+              argNames.add(argName);
+              if (arg.type.isClass) {
+                final String className = arg.type.baseName;
+                final int codecType = getCodecClasses(api, root)
+                    .firstWhere((EnumeratedClass c) => c.name == className)
+                    .enumeration;
+                indent.writeln('std::optional<$className> $argName;');
+                indent.writeScoped(
+                    'if (reader.ReadDataClassType($codecType)) {', '}', () {
                   indent.writeln(
-                      'const auto& args = std::get<EncodableList>(message);');
-
-                  enumerate(method.parameters, (int index, NamedType arg) {
-                    final HostDatatype hostType = getHostDatatype(
-                        arg.type,
-                        (TypeDeclaration x) =>
-                            _shortBaseCppTypeForBuiltinDartType(x));
-                    final String argName = _getSafeArgumentName(index, arg);
-
-                    final String encodableArgName =
-                        '${_encodablePrefix}_$argName';
+                      '$argName = $className::FromEncodableList(std::get<EncodableList>($codecSerializerName::GetInstance().ReadValue(&reader)));');
+                });
+              } else if (_isZeroCopyArgument(method, arg)) {
+                indent.writeln(
+                    'const auto $argName = ${_zeroCopyReadExpression(arg.type)};');
+              } else {
+                indent.writeln(
+                    'const EncodableValue ${_encodablePrefix}_$argName = $codecSerializerName::GetInstance().ReadValue(&reader);');
+              }
+            });
+            indent.writeScoped('if (reader.has_error()) {', '}', () {
+              indent.writeln('reply(WrapError("Invalid message."));');
+              indent.writeln('return;');
+            });
+            final List<String> methodArgument = <String>[];
+            enumerate(method.parameters, (int index, NamedType arg) {
+              final String argName = argNames[index];
+              if (_isZeroCopyArgument(method, arg)) {
+                if (arg.type.isNullable) {
+                  methodArgument.add('$argName ? &(*$argName) : nullptr');
+                } else {
+                  indent.writeScoped('if (!$argName) {', '}', () {
                     indent.writeln(
-                        'const auto& $encodableArgName = args.at($index);');
-                    if (!arg.type.isNullable) {
-                      indent.writeScoped(
-                          'if ($encodableArgName.IsNull()) {', '}', () {
-                        indent.writeln(
-                            'reply(WrapError("$argName unexpectedly null."));');
-                        indent.writeln('return;');
-                      });
-                    }
-                    _writeEncodableValueArgumentUnwrapping(
-                      indent,
-                      root,
-                      hostType,
-                      argName: argName,
-                      encodableArgName: encodableArgName,
-                      apiType: ApiType.host,
-                    );
-                    final String unwrapEnum =
-                        arg.type.isEnum && arg.type.isNullable
-                            ? ' ? &(*$argName) : nullptr'
-                            : '';
-                    methodArgument.add('$argName$unwrapEnum');
+                        'reply(WrapError("$argName unexpectedly null."));');
+                    indent.writeln('return;');
                   });
+                  methodArgument.add(arg.type.isClass
+                      ? 'std::move(*$argName)'
+                      : '*$argName');
                 }
-
-                final HostDatatype returnType = getHostDatatype(
-                    method.returnType, _shortBaseCppTypeForBuiltinDartType);
-                final String returnTypeName = _hostApiReturnType(returnType);
-                if (method.isAsynchronous) {
-                  methodArgument.add(
-                    '[reply]($returnTypeName&& output) {${indent.newline}'
-                    '${_wrapResponse(indent, root, method.returnType, prefix: '\t')}${indent.newline}'
-                    '}',
-                  );
-                }
-                final String call =
-                    'api->${_makeMethodName(method)}(${methodArgument.join(', ')})';
-                if (method.isAsynchronous) {
-                  indent.format('$call;');
-                } else {
-                  indent.writeln('$returnTypeName output = $call;');
-                  indent.format(_wrapResponse(indent, root, method.returnType));
-                }
-              }, addTrailingNewline: false);
-              indent.add(' catch (const std::exception& exception) ');
-              indent.addScoped('{', '}', () {
-                // There is a potential here for `reply` to be called twice, which
-                // is a violation of the API contract, because there's no way of
-                // knowing whether or not the plugin code called `reply` before
-                // throwing. Since use of `@async` suggests that the reply is
-                // probably not sent within the scope of the stack, err on the
-                // side of potential double-call rather than no call (which is
-                // also an API violation) so that unexpected errors have a better
-                // chance of being caught and handled in a useful way.
-                indent.writeln('reply(WrapError(exception.what()));');
-              });
+              } else {
+                methodArgument.add(_writeHostApiArgumentUnwrapping(
+                    indent, root, arg,
+                    argName: argName,
+                    encodableArgName: '${_encodablePrefix}_$argName'));
+              }
             });
-          });
-          indent.addScoped(null, '}', () {
-            indent.writeln('channel->SetMessageHandler(nullptr);');
+            indent.writeln(_replyStatement(root, method.returnType,
+                'api->${_makeMethodName(method)}(${methodArgument.join(', ')})'));
+          }, addTrailingNewline: false);
+          indent.add(' catch (const std::exception& exception) ');
+          indent.addScoped('{', '}', () {
+            indent.writeln('reply(WrapError(exception.what()));');
           });
         });
-      }
-    });
-
-    _writeFunctionDefinition(indent, 'WrapError',
-        scope: api.name,
-        returnType: 'EncodableValue',
-        parameters: <String>['std::string_view error_message'], body: () {
-      indent.format('''
-return EncodableValue(EncodableList{
-\tEncodableValue(std::string(error_message)),
-\tEncodableValue("Error"),
-\tEncodableValue()
-});''');
-    });
-    _writeFunctionDefinition(indent, 'WrapError',
-        scope: api.name,
-        returnType: 'EncodableValue',
-        parameters: <String>['const FlutterError& error'], body: () {
-      indent.format('''
-return EncodableValue(EncodableList{
-\tEncodableValue(error.code()),
-\tEncodableValue(error.message()),
-\terror.details()
-});''');
+      });
+      indent.addScoped(null, '}', () {
+        indent.writeln(
+            'binary_messenger->SetMessageHandler("$channelName", nullptr);');
+      });
     });
   }
 
@@ -1132,7 +3100,7 @@ return EncodableValue(EncodableList{
           indent.addScoped('{', '}', () {
             indent.writeln('stream->WriteByte(${customClass.enumeration});');
             indent.writeln(
-                'WriteValue(EncodableValue(std::any_cast<${customClass.name}>(*custom_value).ToEncodableList()), stream);');
+                'std::any_cast<const ${customClass.name}&>(*custom_value).WriteEncodableList(*this, stream);');
             indent.writeln('return;');
           });
         }
@@ -1141,12 +3109,13 @@ return EncodableValue(EncodableList{
     });
   }
 
-  void _writeClassConstructor(Root root, Indent indent, Class classDefinition,
-      Iterable<NamedType> params) {
+  void _writeClassConstructor(CppOptions generatorOptions, Root root,
+      Indent indent, Class classDefinition, Iterable<NamedType> params) {
     final Iterable<_HostNamedType> hostParams = params.map((NamedType param) {
       return _HostNamedType(
         _makeVariableName(param),
-        getFieldHostDatatype(
+        _getDataClassFieldHostDatatype(
+          generatorOptions,
           param,
           _shortBaseCppTypeForBuiltinDartType,
         ),
@@ -1156,11 +3125,11 @@ return EncodableValue(EncodableList{
 
     final List<String> paramStrings = hostParams
         .map((_HostNamedType param) =>
-            '${_hostApiArgumentType(param.hostType)} ${param.name}')
+            '${_constructorArgumentType(param.hostType)} ${param.name}')
         .toList();
     final List<String> initializerStrings = hostParams
         .map((_HostNamedType param) =>
-            '${param.name}_(${_fieldValueExpression(param.hostType, param.name)})')
+            '${param.name}_(${_constructorFieldValueExpression(param.hostType, param.name)})')
         .toList();
     _writeFunctionDefinition(indent, classDefinition.name,
         scope: classDefinition.name,
@@ -1170,13 +3139,30 @@ return EncodableValue(EncodableList{
 
   void _writeCppSourceClassField(CppOptions generatorOptions, Root root,
       Indent indent, Class classDefinition, NamedType field) {
-    final HostDatatype hostDatatype =
-        getFieldHostDatatype(field, _shortBaseCppTypeForBuiltinDartType);
+    final HostDatatype hostDatatype = _getDataClassFieldHostDatatype(
+        generatorOptions, field, _shortBaseCppTypeForBuiltinDartType);
     final String instanceVariableName = _makeInstanceVariableName(field);
+    final String encodedInstanceVariableName =
+        _makeEncodedInstanceVariableName(field);
     final String setterName = _makeSetterName(field);
-    final String returnExpression = hostDatatype.isNullable
-        ? '$instanceVariableName ? &(*$instanceVariableName) : nullptr'
-        : instanceVariableName;
+    final bool isLazy = _isLazyField(generatorOptions, root, field);
+    final String returnExpression;
+    if (hostDatatype.isNullable) {
+      returnExpression =
+          '$instanceVariableName ? &(*$instanceVariableName) : nullptr';
+    } else if (isLazy) {
+      returnExpression = '*$instanceVariableName';
+    } else {
+      returnExpression = instanceVariableName;
+    }
+
+    // Discards any value that has not been decoded yet, after a setter
+    // replaced it.
+    void writeEncodedValueReset() {
+      if (isLazy) {
+        indent.writeln('$encodedInstanceVariableName.reset();');
+      }
+    }
 
     // Writes a setter treating the type as [type], to allow generating multiple
     // setter variants.
@@ -1193,6 +3179,7 @@ return EncodableValue(EncodableList{
         body: () {
           indent.writeln(
               '$instanceVariableName = ${_fieldValueExpression(type, setterArgumentName)};');
+          writeEncodedValueReset();
         },
       );
     }
@@ -1204,6 +3191,13 @@ return EncodableValue(EncodableList{
       returnType: _getterReturnType(hostDatatype),
       isConst: true,
       body: () {
+        if (isLazy) {
+          indent.writeScoped('if ($encodedInstanceVariableName) {', '}', () {
+            indent.writeln(
+                '$instanceVariableName = ${hostDatatype.datatype}::FromEncodableList(std::move(*$encodedInstanceVariableName));');
+            indent.writeln('$encodedInstanceVariableName.reset();');
+          });
+        }
         indent.writeln('return $returnExpression;');
       },
     );
@@ -1212,6 +3206,22 @@ return EncodableValue(EncodableList{
       // Write the non-nullable variant; see _writeCppHeaderDataClass.
       writeSetter(_nonNullableType(hostDatatype));
     }
+    if (_hasMoveSetter(hostDatatype)) {
+      // Write the ownership-taking variant; see _writeCppHeaderDataClass.
+      _writeFunctionDefinition(
+        indent,
+        setterName,
+        scope: classDefinition.name,
+        returnType: _voidType,
+        parameters: <String>[
+          '${_nonNullableType(hostDatatype).datatype}&& value_arg'
+        ],
+        body: () {
+          indent.writeln('$instanceVariableName = std::move(value_arg);');
+          writeEncodedValueReset();
+        },
+      );
+    }
 
     indent.newln();
   }
@@ -1228,58 +3238,30 @@ return EncodableValue(EncodableList{
         : variable;
   }
 
-  String _wrapResponse(Indent indent, Root root, TypeDeclaration returnType,
-      {String prefix = ''}) {
-    final String nonErrorPath;
-    final String errorCondition;
-    final String errorGetter;
+  /// Returns the value to use when initializing a field of the given type
+  /// from a constructor argument of that type.
+  ///
+  /// Non-nullable, non-POD arguments are taken by value, so they are moved
+  /// into the field.
+  String _constructorFieldValueExpression(HostDatatype type, String variable) {
+    return _isMovableType(type)
+        ? 'std::move($variable)'
+        : _fieldValueExpression(type, variable);
+  }
 
-    const String nullValue = 'EncodableValue()';
-    String enumPrefix = '';
-    if (returnType.isEnum) {
-      enumPrefix = '(int) ';
-    }
+  /// Returns the statement that sends the host API method result [output]
+  /// with [reply].
+  String _replyStatement(Root root, TypeDeclaration returnType, String output,
+      {String reply = 'reply'}) {
     if (returnType.isVoid) {
-      nonErrorPath = '${prefix}wrapped.push_back($nullValue);';
-      errorCondition = 'output.has_value()';
-      errorGetter = 'value';
-    } else {
-      final HostDatatype hostType =
-          getHostDatatype(returnType, _shortBaseCppTypeForBuiltinDartType);
-
-      const String extractedValue = 'std::move(output).TakeValue()';
-      final String wrapperType = hostType.isBuiltin || returnType.isEnum
-          ? 'EncodableValue'
-          : 'CustomEncodableValue';
-      if (returnType.isNullable) {
-        // The value is a std::optional, so needs an extra layer of
-        // handling.
-        nonErrorPath = '''
-${prefix}auto output_optional = $extractedValue;
-${prefix}if (output_optional) {
-$prefix\twrapped.push_back($wrapperType(${enumPrefix}std::move(output_optional).value()));
-$prefix} else {
-$prefix\twrapped.push_back($nullValue);
-$prefix}''';
-      } else {
-        nonErrorPath =
-            '${prefix}wrapped.push_back($wrapperType($enumPrefix$extractedValue));';
-      }
-      errorCondition = 'output.has_error()';
-      errorGetter = 'error';
-    }
-    // Ideally this code would use an initializer list to create
-    // an EncodableList inline, which would be less code. However,
-    // that would always copy the element, so the slightly more
-    // verbose create-and-push approach is used instead.
-    return '''
-${prefix}if ($errorCondition) {
-$prefix\treply(WrapError(output.$errorGetter()));
-$prefix\treturn;
-$prefix}
-${prefix}EncodableList wrapped;
-$nonErrorPath
-${prefix}reply(EncodableValue(std::move(wrapped)));''';
+      return 'PigeonReply($reply, $output);';
+    }
+    final HostDatatype hostType =
+        getHostDatatype(returnType, _shortBaseCppTypeForBuiltinDartType);
+    final String wrapperType = hostType.isBuiltin || returnType.isEnum
+        ? 'EncodableValue'
+        : 'CustomEncodableValue';
+    return 'PigeonReply<$wrapperType>($reply, $output);';
   }
 
   @override
@@ -1441,6 +3423,13 @@ String _getCodecSerializerName(Api api) => '${api.name}CodecSerializer';
 
 const String _encodablePrefix = 'encodable';
 
+/// The default number of calls a batched Flutter API buffers before sending
+/// them.
+const int _defaultMaxBatchSize = 64;
+
+/// The default number of events a stream queues while Flutter has no credit.
+const int _defaultMaxStreamQueueSize = 64;
+
 String _getArgumentName(int count, NamedType argument) =>
     argument.name.isEmpty ? 'arg$count' : _makeVariableName(argument);
 
@@ -1458,6 +3447,16 @@ HostDatatype _nonNullableType(HostDatatype type) {
   );
 }
 
+/// Returns a nullable variant of [type].
+HostDatatype _nullableType(HostDatatype type) {
+  return HostDatatype(
+    datatype: type.datatype,
+    isBuiltin: type.isBuiltin,
+    isNullable: true,
+    isEnum: type.isEnum,
+  );
+}
+
 String _pascalCaseFromCamelCase(String camelCase) =>
     camelCase[0].toUpperCase() + camelCase.substring(1);
 
@@ -1485,6 +3484,9 @@ String _makeVariableName(NamedType field) =>
 String _makeInstanceVariableName(NamedType field) =>
     '${_makeVariableName(field)}_';
 
+String _makeEncodedInstanceVariableName(NamedType field) =>
+    'encoded_${_makeVariableName(field)}_';
+
 // TODO(stuartmorgan): Remove this in favor of _isPodType once callers have
 // all been updated to using HostDatatypes.
 bool _isReferenceType(String dataType) {
@@ -1513,6 +3515,168 @@ bool _isPodType(HostDatatype type) {
   return !_isReferenceType(type.datatype);
 }
 
+/// The C++ element types of the typed data types, by Dart type.
+const Map<String, String> _typedDataElementTypes = <String, String>{
+  'Uint8List': 'uint8_t',
+  'Int32List': 'int32_t',
+  'Int64List': 'int64_t',
+  'Float64List': 'double',
+};
+
+/// The standard codec type IDs of the typed data types, by Dart type.
+const Map<String, int> _typedDataCodecTypes = <String, int>{
+  'Uint8List': 8,
+  'Int32List': 9,
+  'Int64List': 10,
+  'Float64List': 11,
+};
+
+/// Returns true if [root] has any `@StreamApi`.
+bool _hasStreamApis(Root root) {
+  return root.apis.any((Api api) => api.isStream && api.methods.isNotEmpty);
+}
+
+/// Returns true if [root] has any host API whose methods are called through
+/// channels, which share the host API runtime.
+bool _hasChannelHostApis(Root root) {
+  return root.apis.any((Api api) =>
+      api.location == ApiLocation.host && !api.isStream && !api.isFfi);
+}
+
+/// Returns true if [root] has any `@FfiHostApi`.
+bool _hasFfiApis(Root root) {
+  return root.apis.any((Api api) => api.isFfi && api.methods.isNotEmpty);
+}
+
+/// Returns the data classes that are passed as plain structs to the
+/// `@FfiHostApi`s in [root].
+Iterable<Class> _getFfiStructClasses(Root root) {
+  final Set<String> typeNames = <String>{
+    for (final Api api in root.apis)
+      if (api.isFfi)
+        for (final Method method in api.methods) ...<String>[
+          method.returnType.baseName,
+          for (final Parameter param in method.parameters) param.type.baseName,
+        ],
+  };
+  return root.classes.where(
+      (Class classDefinition) => typeNames.contains(classDefinition.name));
+}
+
+/// Returns the name of the plain struct that passes the data class
+/// [className] through dart:ffi.
+String _getFfiStructName(String className) => 'PigeonFfi$className';
+
+/// Returns the C type of [type] in the `extern "C"` functions of a
+/// `@FfiHostApi`, as an argument if [isArgument] is true, or otherwise as a
+/// struct field or the target of a result pointer.
+String _ffiCType(TypeDeclaration type, {bool isArgument = false}) {
+  switch (type.baseName) {
+    case 'bool':
+      return 'bool';
+    case 'int':
+      return 'int64_t';
+    case 'double':
+      return 'double';
+    case 'String':
+      return isArgument ? 'const char*' : 'char*';
+  }
+  return _getFfiStructName(type.baseName);
+}
+
+/// Returns the parameters of the `extern "C"` function for the `@FfiHostApi`
+/// method [func].
+List<String> _ffiFunctionParameters(Method func) {
+  return <String>[
+    for (final Parameter param in func.parameters)
+      '${_ffiCType(param.type, isArgument: true)} ${_makeVariableName(param)}',
+    if (!func.returnType.isVoid) '${_ffiCType(func.returnType)}* result',
+    'PigeonFfiError* error',
+  ];
+}
+
+/// Returns the name of the C++ class that sends the events of the stream
+/// [func] of the `@StreamApi` [api].
+String _getStreamClassName(Api api, Method func) =>
+    '${api.name}${_makeMethodName(func)}';
+
+/// Returns true if any host API method in [root] uses `@CppZeroCopy`.
+bool _hasZeroCopyMethods(Root root) {
+  return root.apis.any((Api api) =>
+      api.location == ApiLocation.host &&
+      api.methods.any((Method method) => method.cppZeroCopy));
+}
+
+/// Returns true if [root] sends or replies to messages through the generated
+/// `MessageReader` and `MessageWriter`, rather than through a
+/// `BasicMessageChannel`.
+bool _usesMessageBuffers(Root root) {
+  return _hasZeroCopyMethods(root) ||
+      root.apis.any((Api api) =>
+          api.location == ApiLocation.flutter && api.methods.isNotEmpty);
+}
+
+/// Returns true if any asynchronous host API method in [root] returns a
+/// coroutine `Task`.
+bool _usesCoroutineTasks(CppOptions options, Root root) {
+  return (options.useCoroutines ?? false) &&
+      root.apis.any((Api api) =>
+          api.location == ApiLocation.host &&
+          api.methods.any((Method method) => method.isAsynchronous));
+}
+
+/// Returns true if the handler of the host API [method] runs on a background
+/// thread.
+bool _usesBackgroundTaskQueue(Method method) {
+  return method.taskQueueType != TaskQueueType.serial;
+}
+
+/// Returns true if any host API method in [root], or in [api] if it is given,
+/// runs on a background thread.
+bool _hasBackgroundTaskQueueMethods(Root root, {Api? api}) {
+  return (api == null ? root.apis : <Api>[api]).any((Api candidate) =>
+      candidate.location == ApiLocation.host &&
+      candidate.methods.any(_usesBackgroundTaskQueue));
+}
+
+/// Returns true if [arg] of [method] is passed to the host API implementation
+/// as a view into the message buffer, or as a data class it can take
+/// ownership of.
+bool _isZeroCopyArgument(Method method, NamedType arg) {
+  return method.cppZeroCopy &&
+      (typedDataTypes.contains(arg.type.baseName) ||
+          arg.type.baseName == 'String' ||
+          arg.type.isClass);
+}
+
+/// Returns the C++ argument type used for the typed data, string or data
+/// class [type] in `@CppZeroCopy` methods.
+String _zeroCopyArgumentType(TypeDeclaration type) {
+  if (type.isClass) {
+    // Passed by rvalue so that the implementation can move the decoded
+    // fields out of it. A nullable argument may be moved from as well.
+    return type.isNullable ? '${type.baseName}*' : '${type.baseName}&&';
+  }
+  if (type.baseName == 'String') {
+    return type.isNullable ? 'const std::string_view*' : 'std::string_view';
+  }
+  return _hostApiArgumentType(HostDatatype(
+    datatype: 'TypedDataView<${_typedDataElementTypes[type.baseName]}>',
+    isBuiltin: true,
+    isNullable: type.isNullable,
+    isEnum: false,
+  ));
+}
+
+/// Returns the expression that reads the view of the typed data or string
+/// [type] from the `ZeroCopyMessageReader` named `reader`.
+String _zeroCopyReadExpression(TypeDeclaration type) {
+  if (type.baseName == 'String') {
+    return 'reader.ReadStringView()';
+  }
+  return 'reader.ReadTypedDataView<${_typedDataElementTypes[type.baseName]}>(${_typedDataCodecTypes[type.baseName]})';
+}
+
 String? _baseCppTypeForBuiltinDartType(
   TypeDeclaration type, {
   bool includeFlutterNamespace = true,
@@ -1539,6 +3703,131 @@ String? _baseCppTypeForBuiltinDartType(
   }
 }
 
+/// Returns true if the data class field [field] is decoded on first access,
+/// rather than when the enclosing class is decoded.
+bool _isLazyField(CppOptions options, Root root, NamedType field) {
+  return (options.lazyDecoding ?? false) &&
+      root.classes.any((Class c) => c.name == field.type.baseName);
+}
+
+/// Returns true if [classDefinition] has a non-nullable field that is decoded
+/// on first access.
+bool _hasLazyNonNullableFields(
+    CppOptions options, Root root, Class classDefinition) {
+  return classDefinition.fields.any((NamedType field) =>
+      !field.type.isNullable && _isLazyField(options, root, field));
+}
+
+/// The C++ types of the builtin typed collection elements, by Dart type.
+const Map<String, String> _typedCollectionBuiltinElementTypes =
+    <String, String>{
+  'bool': 'bool',
+  'int': 'int64_t',
+  'double': 'double',
+  'String': 'std::string',
+};
+
+/// Returns the C++ type of the elements of a typed collection with the type
+/// argument [type], or null if it can't be stored in a typed collection.
+///
+/// Data classes can't be map keys, since they have no ordering.
+String? _typedCollectionElementType(TypeDeclaration type,
+    {required bool isMapKey}) {
+  final String? baseType = type.isClass
+      ? (isMapKey ? null : type.baseName)
+      : _typedCollectionBuiltinElementTypes[type.baseName];
+  if (baseType == null) {
+    return null;
+  }
+  return type.isNullable ? 'std::optional<$baseType>' : baseType;
+}
+
+/// Returns the typed std::vector or std::map type used for the data class
+/// field type [type], or null if the field is stored as an EncodableList or
+/// EncodableMap.
+String? _typedCollectionType(CppOptions options, TypeDeclaration type) {
+  if (!(options.typedCollections ?? false)) {
+    return null;
+  }
+  final List<TypeDeclaration> typeArguments = type.typeArguments;
+  if (type.baseName == 'List' && typeArguments.length == 1) {
+    final String? elementType =
+        _typedCollectionElementType(typeArguments[0], isMapKey: false);
+    return elementType == null ? null : 'std::vector<$elementType>';
+  }
+  if (type.baseName == 'Map' && typeArguments.length == 2) {
+    final String? keyType =
+        _typedCollectionElementType(typeArguments[0], isMapKey: true);
+    final String? valueType =
+        _typedCollectionElementType(typeArguments[1], isMapKey: false);
+    return keyType == null || valueType == null
+        ? null
+        : 'std::map<$keyType, $valueType>';
+  }
+  return null;
+}
+
+/// Returns the host datatype of the data class field [field], which is a
+/// typed collection if [_typedCollectionType] allows it.
+HostDatatype _getDataClassFieldHostDatatype(CppOptions options,
+    NamedType field, String? Function(TypeDeclaration) builtinResolver) {
+  final String? typedCollectionType =
+      _typedCollectionType(options, field.type);
+  if (typedCollectionType != null) {
+    return HostDatatype(
+      datatype: typedCollectionType,
+      isBuiltin: true,
+      isNullable: field.type.isNullable,
+      isEnum: false,
+    );
+  }
+  return getFieldHostDatatype(field, builtinResolver);
+}
+
+/// Returns the data classes used as typed collection elements by the fields
+/// of the data classes in [root].
+Iterable<Class> _typedCollectionElementClasses(CppOptions options, Root root) {
+  final Set<String> names = <String>{};
+  for (final Class classDefinition in root.classes) {
+    for (final NamedType field in classDefinition.fields) {
+      if (_typedCollectionType(options, field.type) != null) {
+        names.addAll(field.type.typeArguments
+            .where((TypeDeclaration type) => type.isClass)
+            .map((TypeDeclaration type) => type.baseName));
+      }
+    }
+  }
+  return root.classes.where((Class c) => names.contains(c.name));
+}
+
+/// Returns true if any data class field in [root] is a typed collection.
+bool _hasTypedCollectionFields(CppOptions options, Root root) {
+  return root.classes.any((Class c) => c.fields.any((NamedType field) =>
+      _typedCollectionType(options, field.type) != null));
+}
+
+/// Returns true if [type] is a non-nullable type that data class constructors
+/// take by value and move into the field.
+bool _isMovableType(HostDatatype type) {
+  return !type.isNullable && !_isPodType(type) && !type.isEnum;
+}
+
+/// Returns true if data class fields of [type] get a setter taking an rvalue
+/// reference, in addition to the copying setters.
+///
+/// Strings are excluded, since a `std::string&&` overload would make calls
+/// with string literals ambiguous with the `std::string_view` setter.
+bool _hasMoveSetter(HostDatatype type) {
+  return _isMovableType(_nonNullableType(type)) &&
+      type.datatype != 'std::string';
+}
+
+/// Returns the C++ type to use for a data class constructor argument of the
+/// given type.
+String _constructorArgumentType(HostDatatype type) {
+  return _isMovableType(type) ? type.datatype : _hostApiArgumentType(type);
+}
+
 /// Returns the C++ type to use in a value context (variable declaration,
 /// pass-by-value, etc.) for the given C++ base type.
 String _valueType(HostDatatype type) {
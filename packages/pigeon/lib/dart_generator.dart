@@ -28,6 +28,10 @@ const DocumentCommentSpecification _docCommentSpec =
 /// The standard codec for Flutter, used for any non custom codecs and extended for custom codecs.
 const String _standardMessageCodec = 'StandardMessageCodec';
 
+/// The default number of events a `@StreamApi` stream lets the host send ahead
+/// of the events Flutter has received.
+const int _defaultStreamCredit = 64;
+
 /// Options that control how Dart code will be generated.
 class DartOptions {
   /// Constructor for DartOptions.
@@ -106,11 +110,19 @@ class DartGenerator extends StructuredGenerator<DartOptions> {
     Indent indent, {
     required String dartPackageName,
   }) {
+    final bool hasFfiApis =
+        root.apis.any((Api api) => api.isFfi && api.methods.isNotEmpty);
     indent.writeln("import 'dart:async';");
+    if (hasFfiApis) {
+      indent.writeln("import 'dart:ffi' as ffi;");
+    }
     indent.writeln(
       "import 'dart:typed_data' show Float64List, Int32List, Int64List, Uint8List;",
     );
     indent.newln();
+    if (hasFfiApis) {
+      indent.writeln("import 'package:ffi/ffi.dart' as ffi;");
+    }
     indent.writeln(
         "import 'package:flutter/foundation.dart' show ReadBuffer, WriteBuffer;");
     indent.writeln("import 'package:flutter/services.dart';");
@@ -394,35 +406,8 @@ $resultAt != null
                   const String argsArray = 'args';
                   indent.writeln(
                       'final List<Object?> $argsArray = (message as List<Object?>?)!;');
-                  String argNameFunc(int index, NamedType type) =>
-                      _getSafeArgumentName(index, type);
-                  enumerate(func.parameters, (int count, NamedType arg) {
-                    final String argType = _addGenericTypes(arg.type);
-                    final String argName = argNameFunc(count, arg);
-                    final String genericArgType =
-                        _makeGenericTypeArguments(arg.type);
-                    final String castCall = _makeGenericCastCall(arg.type);
-
-                    final String leftHandSide = 'final $argType? $argName';
-                    if (arg.type.isEnum) {
-                      indent.writeln(
-                          '$leftHandSide = $argsArray[$count] == null ? null : $argType.values[$argsArray[$count]! as int];');
-                    } else {
-                      indent.writeln(
-                          '$leftHandSide = ($argsArray[$count] as $genericArgType?)${castCall.isEmpty ? '' : '?$castCall'};');
-                    }
-                    if (!arg.type.isNullable) {
-                      indent.writeln('assert($argName != null,');
-                      indent.writeln(
-                          "    'Argument for $channelName was null, expected non-null $argType.');");
-                    }
-                  });
-                  final Iterable<String> argNames =
-                      indexMap(func.parameters, (int index, NamedType field) {
-                    final String name = _getSafeArgumentName(index, field);
-                    return '$name${field.type.isNullable ? '' : '!'}';
-                  });
-                  call = 'api.${func.name}(${argNames.join(', ')})';
+                  call = _writeFlutterApiArgumentDecoding(
+                      indent, func, channelName, argsArray);
                 }
                 indent.writeScoped('try {', '} ', () {
                   if (func.returnType.isVoid) {
@@ -462,6 +447,112 @@ $resultAt != null
             });
           });
         }
+        if (api.isBatched && !isMockHandler) {
+          _writeFlutterApiBatchHandler(indent, api,
+              dartPackageName: dartPackageName);
+        }
+      });
+    });
+  }
+
+  /// Writes the code to decode the arguments of [func] from [argsArray], and
+  /// returns the expression that calls [func] on `api` with them.
+  String _writeFlutterApiArgumentDecoding(
+      Indent indent, Method func, String channelName, String argsArray) {
+    enumerate(func.parameters, (int count, NamedType arg) {
+      final String argType = _addGenericTypes(arg.type);
+      final String argName = _getSafeArgumentName(count, arg);
+      final String genericArgType = _makeGenericTypeArguments(arg.type);
+      final String castCall = _makeGenericCastCall(arg.type);
+
+      final String leftHandSide = 'final $argType? $argName';
+      if (arg.type.isEnum) {
+        indent.writeln(
+            '$leftHandSide = $argsArray[$count] == null ? null : $argType.values[$argsArray[$count]! as int];');
+      } else {
+        indent.writeln(
+            '$leftHandSide = ($argsArray[$count] as $genericArgType?)${castCall.isEmpty ? '' : '?$castCall'};');
+      }
+      if (!arg.type.isNullable) {
+        indent.writeln('assert($argName != null,');
+        indent.writeln(
+            "    'Argument for $channelName was null, expected non-null $argType.');");
+      }
+    });
+    final Iterable<String> argNames =
+        indexMap(func.parameters, (int index, NamedType field) {
+      final String name = _getSafeArgumentName(index, field);
+      return '$name${field.type.isNullable ? '' : '!'}';
+    });
+    return 'api.${func.name}(${argNames.join(', ')})';
+  }
+
+  /// Writes the handler for the batched calls to the Flutter API [api].
+  ///
+  /// A batch is a flat list of method index and argument list pairs, which
+  /// are dispatched in order.
+  void _writeFlutterApiBatchHandler(Indent indent, Api api,
+      {required String dartPackageName}) {
+    final String channelName = makeBatchChannelName(api, dartPackageName);
+    indent.write('');
+    indent.addScoped('{', '}', () {
+      indent.writeln(
+        'final BasicMessageChannel<Object?> ${_varNamePrefix}channel = BasicMessageChannel<Object?>(',
+      );
+      indent.nest(2, () {
+        indent.writeln("'$channelName', $_pigeonChannelCodec,");
+        indent.writeln(
+          'binaryMessenger: binaryMessenger);',
+        );
+      });
+      indent.write('if (api == null) ');
+      indent.addScoped('{', '}', () {
+        indent.writeln('${_varNamePrefix}channel.setMessageHandler(null);');
+      }, addTrailingNewline: false);
+      indent.add(' else ');
+      indent.addScoped('{', '}', () {
+        indent.write(
+          '${_varNamePrefix}channel.setMessageHandler((Object? message) async ',
+        );
+        indent.addScoped('{', '});', () {
+          indent.writeln('assert(message != null,');
+          indent.writeln("'Argument for $channelName was null.');");
+          indent.writeln(
+              'final List<Object?> calls = (message as List<Object?>?)!;');
+          indent.writeScoped('try {', '} ', () {
+            indent.write('for (int i = 0; i + 1 < calls.length; i += 2) ');
+            indent.addScoped('{', '}', () {
+              indent.writeln('final int methodIndex = calls[i]! as int;');
+              enumerate(api.methods, (int index, Method func) {
+                if (index == 0) {
+                  indent.write('');
+                } else {
+                  indent.add(' else ');
+                }
+                indent.addScoped('if (methodIndex == $index) {', '}', () {
+                  String call = 'api.${func.name}()';
+                  if (func.parameters.isNotEmpty) {
+                    indent.writeln(
+                        'final List<Object?> args = (calls[i + 1] as List<Object?>?)!;');
+                    call = _writeFlutterApiArgumentDecoding(indent, func,
+                        makeChannelName(api, func, dartPackageName), 'args');
+                  }
+                  indent.writeln(
+                      func.isAsynchronous ? 'await $call;' : '$call;');
+                }, addTrailingNewline: index == api.methods.length - 1);
+              });
+            });
+            indent.writeln('return wrapResponse(empty: true);');
+          }, addTrailingNewline: false);
+          indent.addScoped('on PlatformException catch (e) {', '}', () {
+            indent.writeln('return wrapResponse(error: e);');
+          }, addTrailingNewline: false);
+
+          indent.writeScoped('catch (e) {', '}', () {
+            indent.writeln(
+                "return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));");
+          });
+        });
       });
     });
   }
@@ -492,11 +583,20 @@ $resultAt != null
     required String dartPackageName,
   }) {
     assert(api.location == ApiLocation.host);
+    if (api.isFfi) {
+      _writeFfiHostApi(indent, root, api);
+      return;
+    }
     String codecName = _standardMessageCodec;
     if (getCodecClasses(api, root).isNotEmpty) {
       codecName = _getCodecName(api);
       _writeCodec(indent, codecName, api, root);
     }
+    if (api.isStream) {
+      _writeStreamApi(indent, api, codecName,
+          dartPackageName: dartPackageName);
+      return;
+    }
     indent.newln();
     bool first = true;
     addDocumentationComments(
@@ -515,7 +615,7 @@ final BinaryMessenger? ${_varNamePrefix}binaryMessenger;
       indent.writeln(
           'static const MessageCodec<Object?> $_pigeonChannelCodec = $codecName();');
       indent.newln();
-      for (final Method func in api.methods) {
+      for (final (int methodIndex, Method func) in api.methods.indexed) {
         if (!first) {
           indent.newln();
         } else {
@@ -525,25 +625,33 @@ final BinaryMessenger? ${_varNamePrefix}binaryMessenger;
             indent, func.documentationComments, _docCommentSpec);
         String argSignature = '';
         String sendArgument = 'null';
-        if (func.parameters.isNotEmpty) {
-          final Iterable<String> argExpressions =
-              indexMap(func.parameters, (int index, NamedType type) {
+        final List<String> argExpressions = <String>[
+          // Single channel APIs send the method index ahead of the arguments.
+          if (api.singleChannel) '$methodIndex',
+          ...indexMap(func.parameters, (int index, NamedType type) {
             final String name = _getParameterName(index, type);
             if (type.type.isEnum) {
               return '$name${type.type.isNullable ? '?' : ''}.index';
             } else {
               return name;
             }
-          });
+          }),
+        ];
+        if (argExpressions.isNotEmpty) {
           sendArgument = '<Object?>[${argExpressions.join(', ')}]';
+        }
+        if (func.parameters.isNotEmpty) {
           argSignature = _getMethodParameterSignature(func);
         }
+        final String channelName = api.singleChannel
+            ? makeDispatchChannelName(api, dartPackageName)
+            : makeChannelName(api, func, dartPackageName);
         indent.write(
           'Future<${_addGenericTypesNullable(func.returnType)}> ${func.name}($argSignature) async ',
         );
         indent.addScoped('{', '}', () {
           indent.writeln(
-              "const String ${_varNamePrefix}channelName = '${makeChannelName(api, func, dartPackageName)}';");
+              "const String ${_varNamePrefix}channelName = '$channelName';");
           indent.writeScoped(
               'final BasicMessageChannel<Object?> ${_varNamePrefix}channel = BasicMessageChannel<Object?>(',
               ');', () {
@@ -607,6 +715,232 @@ if (${_varNamePrefix}replyList == null) {
     });
   }
 
+  /// Writes the class for the `@FfiHostApi` [api], whose methods call the
+  /// `extern "C"` functions of the host synchronously through `dart:ffi`.
+  ///
+  /// Arguments and results are passed in memory allocated for the call, and
+  /// strings returned by the host are freed with its FreeString function.
+  void _writeFfiHostApi(Indent indent, Root root, Api api) {
+    indent.newln();
+    addDocumentationComments(
+        indent, api.documentationComments, _docCommentSpec);
+    indent.write('class ${api.name} ');
+    indent.addScoped('{', '}', () {
+      indent.format('''
+/// Constructor for [${api.name}].  The [library] named argument is the library
+/// that the host code is built into.  If it is left null, the symbols of the
+/// process are used, which include those of the loaded plugins.
+${api.name}({ffi.DynamicLibrary? library})
+\t\t: ${_varNamePrefix}library = library ?? ffi.DynamicLibrary.process();
+final ffi.DynamicLibrary ${_varNamePrefix}library;
+''');
+      indent.writeln(
+          'late final void Function(ffi.Pointer<ffi.Utf8>) ${_varNamePrefix}freeString =');
+      indent.nest(2, () {
+        indent.writeln(
+            '${_varNamePrefix}library.lookupFunction<ffi.Void Function(ffi.Pointer<ffi.Utf8>), '
+            "void Function(ffi.Pointer<ffi.Utf8>)>('${makeFfiFreeStringFunctionName(api)}');");
+      });
+      for (final Method func in api.methods) {
+        final String functionName = '$_varNamePrefix${func.name}Function';
+        final List<TypeDeclaration> cParameterTypes = <TypeDeclaration>[
+          for (final Parameter param in func.parameters) param.type,
+        ];
+        final String nativeSignature = <String>[
+          for (final TypeDeclaration type in cParameterTypes)
+            _ffiNativeType(type),
+          if (!func.returnType.isVoid)
+            'ffi.Pointer<${_ffiNativeType(func.returnType)}>',
+          'ffi.Pointer<_PigeonFfiError>',
+        ].join(', ');
+        final String dartSignature = <String>[
+          for (final TypeDeclaration type in cParameterTypes)
+            _ffiDartType(type),
+          if (!func.returnType.isVoid)
+            'ffi.Pointer<${_ffiNativeType(func.returnType)}>',
+          'ffi.Pointer<_PigeonFfiError>',
+        ].join(', ');
+        indent.newln();
+        indent.writeln(
+            'late final bool Function($dartSignature) $functionName =');
+        indent.nest(2, () {
+          indent.writeln(
+              '${_varNamePrefix}library.lookupFunction<ffi.Bool Function($nativeSignature), '
+              "bool Function($dartSignature)>('${makeFfiFunctionName(api, func)}');");
+        });
+        indent.newln();
+        addDocumentationComments(
+            indent, func.documentationComments, _docCommentSpec);
+        final String argSignature =
+            func.parameters.isEmpty ? '' : _getMethodParameterSignature(func);
+        indent.write(
+            '${_addGenericTypesNullable(func.returnType)} ${func.name}($argSignature) ');
+        indent.addScoped('{', '}', () {
+          indent.write(
+              'return ffi.using((ffi.Arena ${_varNamePrefix}arena) ');
+          indent.addScoped('{', '});', () {
+            final List<String> arguments = <String>[];
+            for (final (int index, Parameter param)
+                in func.parameters.indexed) {
+              final String name = _getParameterName(index, param);
+              if (param.type.baseName == 'String') {
+                arguments.add(
+                    '$name.toNativeUtf8(allocator: ${_varNamePrefix}arena)');
+              } else if (ffiPrimitiveTypes.contains(param.type.baseName)) {
+                arguments.add(name);
+              } else {
+                final String structName = '$_varNamePrefix${name}Struct';
+                indent.writeln(
+                    'final ${_ffiNativeType(param.type)} $structName =');
+                final Iterable<String> fieldNames =
+                    getFieldsInSerializationOrder(
+                            _getClass(root, param.type.baseName))
+                        .map((NamedType field) => field.name);
+                indent.nest(2, () {
+                  indent.writeln(
+                      '${_varNamePrefix}arena<${_ffiNativeType(param.type)}>().ref');
+                  for (final String field in fieldNames) {
+                    indent.writeln('..$field = $name.$field'
+                        '${field == fieldNames.last ? ';' : ''}');
+                  }
+                });
+                arguments.add(structName);
+              }
+            }
+            if (!func.returnType.isVoid) {
+              indent.writeln(
+                  'final ffi.Pointer<${_ffiNativeType(func.returnType)}> ${_varNamePrefix}result =');
+              indent.nest(2, () {
+                indent.writeln(
+                    '${_varNamePrefix}arena<${_ffiNativeType(func.returnType)}>();');
+              });
+              arguments.add('${_varNamePrefix}result');
+            }
+            indent.writeln(
+                'final ffi.Pointer<_PigeonFfiError> ${_varNamePrefix}error =');
+            indent.nest(2, () {
+              indent.writeln('${_varNamePrefix}arena<_PigeonFfiError>();');
+            });
+            arguments.add('${_varNamePrefix}error');
+            indent.writeScoped(
+                'if (!$functionName(${arguments.join(', ')})) {', '}', () {
+              indent.writeln(
+                  'throw _createFfiException(${_varNamePrefix}error.ref, ${_varNamePrefix}freeString);');
+            });
+            _writeFfiReturn(indent, root, func.returnType);
+          });
+        });
+      }
+    });
+  }
+
+  /// Writes the statements that return the value of the result pointer of an
+  /// `extern "C"` function as a [returnType].
+  void _writeFfiReturn(Indent indent, Root root, TypeDeclaration returnType) {
+    const String result = '${_varNamePrefix}result';
+    if (returnType.isVoid) {
+      return;
+    } else if (returnType.baseName == 'String') {
+      indent.writeln(
+          'final String ${_varNamePrefix}value = $result.value.toDartString();');
+      indent.writeln('${_varNamePrefix}freeString($result.value);');
+      indent.writeln('return ${_varNamePrefix}value;');
+    } else if (ffiPrimitiveTypes.contains(returnType.baseName)) {
+      indent.writeln('return $result.value;');
+    } else {
+      indent.writeln('return ${returnType.baseName}(');
+      indent.nest(1, () {
+        for (final NamedType field in getFieldsInSerializationOrder(
+            _getClass(root, returnType.baseName))) {
+          indent.writeln('${field.name}: $result.ref.${field.name},');
+        }
+      });
+      indent.writeln(');');
+    }
+  }
+
+  /// Writes the class for the `@StreamApi` [api], with a method that returns a
+  /// `Stream` for each of its event channels.
+  ///
+  /// Flutter starts listening with the number of events the host may send, and
+  /// grants more credit on a separate channel once it has received half of
+  /// them.
+  void _writeStreamApi(Indent indent, Api api, String codecName,
+      {required String dartPackageName}) {
+    indent.newln();
+    addDocumentationComments(
+        indent, api.documentationComments, _docCommentSpec);
+    indent.write('class ${api.name} ');
+    indent.addScoped('{', '}', () {
+      indent.format('''
+/// Constructor for [${api.name}].  The [binaryMessenger] named argument is
+/// available for dependency injection.  If it is left null, the default
+/// BinaryMessenger will be used which routes to the host platform.
+${api.name}({BinaryMessenger? binaryMessenger})
+\t\t: ${_varNamePrefix}binaryMessenger = binaryMessenger;
+final BinaryMessenger? ${_varNamePrefix}binaryMessenger;
+''');
+      indent.writeln(
+          'static const MessageCodec<Object?> $_pigeonChannelCodec = $codecName();');
+      for (final Method func in api.methods) {
+        indent.newln();
+        addDocumentationComments(
+            indent, func.documentationComments, _docCommentSpec);
+        indent.writeln(
+            '$_docCommentPrefix The host sends at most [credit] events ahead of the ones');
+        indent.writeln(
+            '$_docCommentPrefix Flutter has received. The stream should have one listener.');
+        final String returnType = _makeGenericTypeArguments(func.returnType);
+        final String genericCastCall = _makeGenericCastCall(func.returnType);
+        final String event;
+        if (func.returnType.isEnum) {
+          event = func.returnType.isNullable
+              ? 'event == null ? null : $returnType.values[event as int]'
+              : '$returnType.values[event! as int]';
+        } else {
+          final String nullHandler = func.returnType.isNullable
+              ? (genericCastCall.isEmpty ? '' : '?')
+              : '!';
+          event = '(event as $returnType?)$nullHandler$genericCastCall';
+        }
+        indent.write(
+            'Stream<${_addGenericTypesNullable(func.returnType)}> ${func.name}({int credit = $_defaultStreamCredit}) ');
+        indent.addScoped('{', '}', () {
+          indent.writeln('assert(credit > 0);');
+          indent.writeScoped(
+              'final EventChannel ${_varNamePrefix}channel = EventChannel(',
+              ');', () {
+            indent.writeln("'${makeChannelName(api, func, dartPackageName)}',");
+            indent.writeln('const StandardMethodCodec($codecName()),');
+            indent.writeln('${_varNamePrefix}binaryMessenger,');
+          });
+          indent.writeScoped(
+              'final BasicMessageChannel<Object?> ${_varNamePrefix}creditChannel = BasicMessageChannel<Object?>(',
+              ');', () {
+            indent.writeln(
+                "'${makeStreamCreditChannelName(api, func, dartPackageName)}',");
+            indent.writeln('$_pigeonChannelCodec,');
+            indent
+                .writeln('binaryMessenger: ${_varNamePrefix}binaryMessenger,');
+          });
+          indent.writeln('int ${_varNamePrefix}received = 0;');
+          indent.write(
+              'return ${_varNamePrefix}channel.receiveBroadcastStream(credit).map((Object? event) ');
+          indent.addScoped('{', '});', () {
+            indent.writeln('${_varNamePrefix}received += 1;');
+            indent.writeScoped(
+                'if (${_varNamePrefix}received * 2 >= credit) {', '}', () {
+              indent.writeln(
+                  '${_varNamePrefix}creditChannel.send(${_varNamePrefix}received);');
+              indent.writeln('${_varNamePrefix}received = 0;');
+            });
+            indent.writeln('return $event;');
+          });
+        });
+      }
+    });
+  }
+
   /// Generates Dart source code for test support libraries based on the given AST
   /// represented by [root], outputting the code to [sink]. [sourceOutPath] is the
   /// path of the generated dart code to be tested. [testOutPath] is where the
@@ -697,7 +1031,9 @@ if (${_varNamePrefix}replyList == null) {
     required String dartPackageName,
   }) {
     final bool hasHostApi = root.apis.any((Api api) =>
-        api.methods.isNotEmpty && api.location == ApiLocation.host);
+        api.methods.isNotEmpty &&
+        api.location == ApiLocation.host &&
+        !api.isFfi);
     final bool hasFlutterApi = root.apis.any((Api api) =>
         api.methods.isNotEmpty && api.location == ApiLocation.flutter);
 
@@ -707,6 +1043,64 @@ if (${_varNamePrefix}replyList == null) {
     if (hasFlutterApi) {
       _writeWrapResponse(generatorOptions, root, indent);
     }
+    if (root.apis.any((Api api) => api.isFfi && api.methods.isNotEmpty)) {
+      _writeFfiTypes(indent, root);
+    }
+  }
+
+  /// Writes the structs that are passed to the `extern "C"` functions of the
+  /// `@FfiHostApi`s, and the helper that throws the errors they return.
+  void _writeFfiTypes(Indent indent, Root root) {
+    indent.newln();
+    indent.format('''
+final class _PigeonFfiError extends ffi.Struct {
+\texternal ffi.Pointer<ffi.Utf8> code;
+\texternal ffi.Pointer<ffi.Utf8> message;
+}
+
+PlatformException _createFfiException(
+\t_PigeonFfiError error, void Function(ffi.Pointer<ffi.Utf8>) freeString) {
+\tfinal PlatformException exception = PlatformException(
+\t\tcode: error.code.toDartString(),
+\t\tmessage: error.message.toDartString(),
+\t);
+\tfreeString(error.code);
+\tfreeString(error.message);
+\treturn exception;
+}''');
+    final Set<String> structNames = <String>{
+      for (final Api api in root.apis)
+        if (api.isFfi)
+          for (final Method method in api.methods)
+            for (final TypeDeclaration type in <TypeDeclaration>[
+              method.returnType,
+              ...method.parameters.map((Parameter param) => param.type),
+            ])
+              if (!type.isVoid &&
+                  type.baseName != 'String' &&
+                  !ffiPrimitiveTypes.contains(type.baseName))
+                type.baseName,
+    };
+    for (final Class classDefinition in root.classes) {
+      if (!structNames.contains(classDefinition.name)) {
+        continue;
+      }
+      indent.newln();
+      indent.write(
+          'final class ${_ffiStructName(classDefinition.name)} extends ffi.Struct ');
+      indent.addScoped('{', '}', () {
+        bool first = true;
+        for (final NamedType field
+            in getFieldsInSerializationOrder(classDefinition)) {
+          if (!first) {
+            indent.newln();
+          }
+          first = false;
+          indent.writeln('@${_ffiNativeType(field.type)}()');
+          indent.writeln('external ${field.type.baseName} ${field.name};');
+        }
+      });
+    }
   }
 
   /// Writes [wrapResponse] method.
@@ -799,6 +1193,39 @@ void _writeCodec(Indent indent, String codecName, Api api, Root root) {
   });
 }
 
+/// Returns the name of the struct that passes the data class [className] to
+/// the `extern "C"` functions of a `@FfiHostApi`.
+String _ffiStructName(String className) => '_PigeonFfi$className';
+
+/// Returns the `dart:ffi` native type of [type] in the `extern "C"` functions
+/// of a `@FfiHostApi`.
+String _ffiNativeType(TypeDeclaration type) {
+  switch (type.baseName) {
+    case 'bool':
+      return 'ffi.Bool';
+    case 'int':
+      return 'ffi.Int64';
+    case 'double':
+      return 'ffi.Double';
+    case 'String':
+      return 'ffi.Pointer<ffi.Utf8>';
+  }
+  return _ffiStructName(type.baseName);
+}
+
+/// Returns the Dart type that `dart:ffi` uses for an argument of [type] to the
+/// `extern "C"` functions of a `@FfiHostApi`.
+String _ffiDartType(TypeDeclaration type) {
+  if (ffiPrimitiveTypes.contains(type.baseName)) {
+    return type.baseName;
+  }
+  return _ffiNativeType(type);
+}
+
+/// Returns the data class named [name] in [root].
+Class _getClass(Root root, String name) => root.classes
+    .firstWhere((Class classDefinition) => classDefinition.name == name);
+
 /// Creates a Dart type where all type arguments are [Objects].
 String _makeGenericTypeArguments(TypeDeclaration type) {
   return type.typeArguments.isNotEmpty
@@ -13,7 +13,7 @@ import 'ast.dart';
 /// The current version of pigeon.
 ///
 /// This must match the version in pubspec.yaml.
-const String pigeonVersion = '14.0.0';
+const String pigeonVersion = '14.18.2';
 
 /// Read all the content from [stdin] to a String.
 String readStdin() {
@@ -169,6 +169,45 @@ String makeChannelName(Api api, Method func, String dartPackageName) {
   return 'dev.flutter.pigeon.$dartPackageName.${api.name}.${func.name}';
 }
 
+/// Create the generated channel name for the batched calls to [api].
+String makeBatchChannelName(Api api, String dartPackageName) {
+  return 'dev.flutter.pigeon.$dartPackageName.${api.name}.__pigeon_batch';
+}
+
+/// Creates the name of the channel that receives every method of a host [api]
+/// marked with `singleChannel`.
+String makeDispatchChannelName(Api api, String dartPackageName) {
+  return 'dev.flutter.pigeon.$dartPackageName.${api.name}.__pigeon_dispatch';
+}
+
+/// Creates the name of the channel on which Flutter grants credit for the
+/// events of the stream [func] of a `@StreamApi` [api].
+String makeStreamCreditChannelName(
+    Api api, Method func, String dartPackageName) {
+  return '${makeChannelName(api, func, dartPackageName)}.__pigeon_credit';
+}
+
+/// Creates the name of the `extern "C"` function that calls the method [func]
+/// of a `@FfiHostApi` [api].
+String makeFfiFunctionName(Api api, Method func) {
+  return 'pigeon_${api.name}_${func.name}';
+}
+
+/// Creates the name of the `extern "C"` function that frees the strings
+/// returned by the functions of a `@FfiHostApi` [api].
+String makeFfiFreeStringFunctionName(Api api) {
+  return 'pigeon_${api.name}_FreeString';
+}
+
+/// Whether [classDefinition] can be passed to a `@FfiHostApi` as a plain
+/// struct, which requires it to have fields, all of [ffiPrimitiveTypes].
+bool isFfiStruct(Class classDefinition) {
+  return classDefinition.fields.isNotEmpty &&
+      classDefinition.fields.every((NamedType field) =>
+          !field.type.isNullable &&
+          ffiPrimitiveTypes.contains(field.type.baseName));
+}
+
 // TODO(tarrinneal): Determine whether HostDataType is needed.
 
 /// Represents the mapping of a Dart datatype to a Host datatype.
@@ -371,6 +410,23 @@ const List<String> validTypes = <String>[
   'Object',
 ];
 
+/// Supported typed data datatypes, which are encoded as contiguous arrays of
+/// elements.
+const List<String> typedDataTypes = <String>[
+  'Uint8List',
+  'Int32List',
+  'Int64List',
+  'Float64List',
+];
+
+/// Datatypes that are passed by value to the `extern "C"` functions of a
+/// `@FfiHostApi`.
+const List<String> ffiPrimitiveTypes = <String>[
+  'bool',
+  'int',
+  'double',
+];
+
 /// Custom codecs' custom types are enumerated from 255 down to this number to
 /// avoid collisions with the StandardMessageCodec.
 const int _minimumCodecFieldKey = 128;
@@ -0,0 +1,1541 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'ast.dart';
+import 'functional.dart';
+import 'generator.dart';
+import 'generator_tools.dart';
+
+/// General comment opening token.
+const String _commentPrefix = '//';
+
+/// Documentation comment spec.
+const DocumentCommentSpecification _docCommentSpec =
+    DocumentCommentSpecification(_commentPrefix);
+
+/// The module used when none is given in [GObjectOptions].
+const String _defaultModule = 'pigeon';
+
+/// Options that control how GObject code will be generated.
+class GObjectOptions {
+  /// Creates a [GObjectOptions] object
+  const GObjectOptions({
+    this.headerIncludePath,
+    this.module,
+    this.copyrightHeader,
+    this.headerOutPath,
+  });
+
+  /// The path to the header that will get placed in the source filed (example:
+  /// "foo.h").
+  final String? headerIncludePath;
+
+  /// The snake_case module name used to prefix the generated types and
+  /// functions (example: "url_launcher" produces `UrlLauncherFoo` and
+  /// `url_launcher_foo_new`).
+  final String? module;
+
+  /// A copyright header that will get prepended to generated code.
+  final Iterable<String>? copyrightHeader;
+
+  /// The path to the output header file location.
+  final String? headerOutPath;
+
+  /// Creates a [GObjectOptions] from a Map representation where:
+  /// `x = GObjectOptions.fromMap(x.toMap())`.
+  static GObjectOptions fromMap(Map<String, Object> map) {
+    return GObjectOptions(
+      headerIncludePath: map['header'] as String?,
+      module: map['module'] as String?,
+      copyrightHeader: map['copyrightHeader'] as Iterable<String>?,
+      headerOutPath: map['gobjectHeaderOut'] as String?,
+    );
+  }
+
+  /// Converts a [GObjectOptions] to a Map representation where:
+  /// `x = GObjectOptions.fromMap(x.toMap())`.
+  Map<String, Object> toMap() {
+    final Map<String, Object> result = <String, Object>{
+      if (headerIncludePath != null) 'header': headerIncludePath!,
+      if (module != null) 'module': module!,
+      if (copyrightHeader != null) 'copyrightHeader': copyrightHeader!,
+    };
+    return result;
+  }
+
+  /// Overrides any non-null parameters from [options] into this to make a new
+  /// [GObjectOptions].
+  GObjectOptions merge(GObjectOptions options) {
+    return GObjectOptions.fromMap(mergeMaps(toMap(), options.toMap()));
+  }
+}
+
+/// Class that manages all GObject code generation.
+class GObjectGenerator extends Generator<OutputFileOptions<GObjectOptions>> {
+  /// Constructor.
+  const GObjectGenerator();
+
+  /// Generates GObject file of type specified in [generatorOptions]
+  @override
+  void generate(
+    OutputFileOptions<GObjectOptions> generatorOptions,
+    Root root,
+    StringSink sink, {
+    required String dartPackageName,
+  }) {
+    assert(generatorOptions.fileType == FileType.header ||
+        generatorOptions.fileType == FileType.source);
+    if (generatorOptions.fileType == FileType.header) {
+      const GObjectHeaderGenerator().generate(
+        generatorOptions.languageOptions,
+        root,
+        sink,
+        dartPackageName: dartPackageName,
+      );
+    } else if (generatorOptions.fileType == FileType.source) {
+      const GObjectSourceGenerator().generate(
+        generatorOptions.languageOptions,
+        root,
+        sink,
+        dartPackageName: dartPackageName,
+      );
+    }
+  }
+}
+
+/// Writes GObject header (.h) file to sink.
+class GObjectHeaderGenerator extends StructuredGenerator<GObjectOptions> {
+  /// Constructor.
+  const GObjectHeaderGenerator();
+
+  @override
+  void writeFilePrologue(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    if (generatorOptions.copyrightHeader != null) {
+      addLines(indent, generatorOptions.copyrightHeader!, linePrefix: '// ');
+    }
+    indent.writeln('$_commentPrefix ${getGeneratedCodeWarning()}');
+    indent.writeln('$_commentPrefix $seeAlsoWarning');
+    indent.newln();
+  }
+
+  @override
+  void writeFileImports(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    final String guardName = _getGuardName(generatorOptions.headerIncludePath);
+    indent.writeln('#ifndef $guardName');
+    indent.writeln('#define $guardName');
+    indent.newln();
+    indent.writeln('#include <flutter_linux/flutter_linux.h>');
+  }
+
+  @override
+  void writeOpenNamespace(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    indent.newln();
+    indent.writeln('G_BEGIN_DECLS');
+  }
+
+  @override
+  void writeEnum(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Enum anEnum, {
+    required String dartPackageName,
+  }) {
+    final String module = _getModule(generatorOptions);
+    final String enumName = _getClassName(module, anEnum.name);
+    indent.newln();
+    addDocumentationComments(
+        indent, anEnum.documentationComments, _docCommentSpec);
+    indent.write('typedef enum ');
+    indent.addScoped('{', '} $enumName;', () {
+      enumerate(anEnum.members, (int index, final EnumMember member) {
+        addDocumentationComments(
+            indent, member.documentationComments, _docCommentSpec);
+        indent.writeln(
+            '${_getEnumValue(module, anEnum.name, member.name)} = $index${index == anEnum.members.length - 1 ? '' : ','}');
+      });
+    });
+  }
+
+  @override
+  void writeDataClasses(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    // Declare the classes used by the fields of classes that come before them.
+    final String module = _getModule(generatorOptions);
+    final Set<String> forwardDeclarations = <String>{};
+    enumerate(root.classes, (int index, Class classDefinition) {
+      for (final NamedType field in classDefinition.fields) {
+        if (field.type.isClass &&
+            root.classes.indexWhere(
+                    (Class aClass) => aClass.name == field.type.baseName) >=
+                index) {
+          forwardDeclarations.add(field.type.baseName);
+        }
+      }
+    });
+    if (forwardDeclarations.isNotEmpty) {
+      indent.newln();
+      for (final String name in forwardDeclarations) {
+        final String className = _getClassName(module, name);
+        indent.writeln('typedef struct _$className $className;');
+      }
+    }
+    super.writeDataClasses(generatorOptions, root, indent,
+        dartPackageName: dartPackageName);
+  }
+
+  @override
+  void writeDataClass(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Class classDefinition, {
+    required String dartPackageName,
+  }) {
+    final String module = _getModule(generatorOptions);
+    final String className = _getClassName(module, classDefinition.name);
+    final String methodPrefix = _getMethodPrefix(module, classDefinition.name);
+
+    indent.newln();
+    addDocumentationComments(
+        indent, classDefinition.documentationComments, _docCommentSpec,
+        generatorComments: <String>[
+          ' Generated class from Pigeon that represents data sent in messages.'
+        ]);
+    _writeDeclareFinalType(indent, module, classDefinition.name);
+
+    indent.newln();
+    indent.writeln('$_commentPrefix Creates a new #$className object.');
+    final List<String> constructorArgs = <String>[
+      for (final NamedType field in classDefinition.fields)
+        ..._getArgumentDeclarations(
+            module, field.type, _snakeCaseFromCamelCase(field.name)),
+    ];
+    indent.writeln(
+        '$className* ${methodPrefix}_new(${_joinArguments(constructorArgs)});');
+
+    for (final NamedType field in classDefinition.fields) {
+      final String fieldName = _snakeCaseFromCamelCase(field.name);
+      indent.newln();
+      addDocumentationComments(
+          indent, field.documentationComments, _docCommentSpec);
+      indent.writeln(
+          '${_getGetterDeclaration(module, className, methodPrefix, fieldName, field.type)};');
+    }
+  }
+
+  @override
+  void writeFlutterApi(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Api api, {
+    required String dartPackageName,
+  }) {}
+
+  @override
+  void writeHostApi(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Api api, {
+    required String dartPackageName,
+  }) {
+    if (api.methods.isEmpty) {
+      return;
+    }
+    final String module = _getModule(generatorOptions);
+    final String apiName = _getClassName(module, api.name);
+    final String methodPrefix = _getMethodPrefix(module, api.name);
+    final String vtableName = _getVTableName(module, api.name);
+
+    if (_hasAsyncMethods(api)) {
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix Holds the reply to a message until an asynchronous method of');
+      indent.writeln('$_commentPrefix #$vtableName responds to it.');
+      _writeDeclareFinalType(indent, module, '${api.name}ResponseHandle');
+    }
+
+    for (final Method method
+        in api.methods.where((Method m) => !m.isAsynchronous)) {
+      final String responseName = _getResponseName(module, api.name, method);
+      final String responseMethodPrefix =
+          _getResponseMethodPrefix(module, api.name, method);
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix The response to a call to ${api.name}.${method.name}.');
+      _writeDeclareFinalType(indent, module,
+          '${api.name}${_pascalCaseFromCamelCase(method.name)}Response');
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix Creates a successful response to ${api.name}.${method.name}.');
+      indent.writeln(
+          '$responseName* ${responseMethodPrefix}_new(${_joinArguments(_getReturnValueArguments(module, method))});');
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix Creates an error response to ${api.name}.${method.name}.');
+      indent.writeln(
+          '$responseName* ${responseMethodPrefix}_new_error(${_errorArguments.join(', ')});');
+    }
+
+    indent.newln();
+    addDocumentationComments(
+        indent, api.documentationComments, _docCommentSpec,
+        generatorComments: <String>[
+          ' The methods of ${api.name} implemented on the platform side.',
+          '',
+          ' Methods that are NULL respond to messages with an error.',
+        ]);
+    indent.write('typedef struct ');
+    indent.addScoped('{', '} $vtableName;', () {
+      for (final Method method in api.methods) {
+        addDocumentationComments(
+            indent, method.documentationComments, _docCommentSpec);
+        final List<String> args = <String>[
+          ..._getMethodArguments(module, method),
+          if (method.isAsynchronous) '${apiName}ResponseHandle* response_handle',
+          'gpointer user_data',
+        ];
+        final String returnType = method.isAsynchronous
+            ? 'void'
+            : '${_getResponseName(module, api.name, method)}*';
+        indent.writeln(
+            '$returnType (*${_snakeCaseFromCamelCase(method.name)})(${args.join(', ')});');
+      }
+    });
+
+    indent.newln();
+    indent.writeln(
+        '$_commentPrefix Handles the messages of ${api.name} sent on [messenger] by');
+    indent.writeln(
+        '$_commentPrefix calling the methods of [vtable] with [user_data].');
+    indent.writeln('$_commentPrefix');
+    indent.writeln(
+        '$_commentPrefix [user_data_free_func] is called on [user_data] once the handlers');
+    indent.writeln('$_commentPrefix are replaced or cleared.');
+    indent.writeln(
+        'void ${methodPrefix}_set_method_handlers(FlBinaryMessenger* messenger, const $vtableName* vtable, gpointer user_data, GDestroyNotify user_data_free_func);');
+    indent.newln();
+    indent.writeln(
+        '$_commentPrefix Stops handling the messages of ${api.name} sent on [messenger].');
+    indent.writeln(
+        'void ${methodPrefix}_clear_method_handlers(FlBinaryMessenger* messenger);');
+
+    for (final Method method
+        in api.methods.where((Method m) => m.isAsynchronous)) {
+      final String methodName = _snakeCaseFromCamelCase(method.name);
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix Responds to an asynchronous call to ${api.name}.${method.name}.');
+      indent.writeln(
+          'void ${methodPrefix}_respond_$methodName(${<String>[
+        '${apiName}ResponseHandle* response_handle',
+        ..._getReturnValueArguments(module, method),
+      ].join(', ')});');
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix Responds to an asynchronous call to ${api.name}.${method.name} with an');
+      indent.writeln('$_commentPrefix error.');
+      indent.writeln(
+          'void ${methodPrefix}_respond_error_$methodName(${<String>[
+        '${apiName}ResponseHandle* response_handle',
+        ..._errorArguments,
+      ].join(', ')});');
+    }
+  }
+
+  @override
+  void writeCloseNamespace(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    indent.newln();
+    indent.writeln('G_END_DECLS');
+    indent.newln();
+    final String guardName = _getGuardName(generatorOptions.headerIncludePath);
+    indent.writeln('#endif  // $guardName');
+  }
+}
+
+/// Writes GObject source (.cc) file to sink.
+class GObjectSourceGenerator extends StructuredGenerator<GObjectOptions> {
+  /// Constructor.
+  const GObjectSourceGenerator();
+
+  @override
+  void writeFilePrologue(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    if (generatorOptions.copyrightHeader != null) {
+      addLines(indent, generatorOptions.copyrightHeader!, linePrefix: '// ');
+    }
+    indent.writeln('$_commentPrefix ${getGeneratedCodeWarning()}');
+    indent.writeln('$_commentPrefix $seeAlsoWarning');
+    indent.newln();
+  }
+
+  @override
+  void writeFileImports(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    indent.writeln('#include "${generatorOptions.headerIncludePath}"');
+    if (root.classes.any((Class aClass) => aClass.fields
+        .any((NamedType field) => _isTypedData(field.type)))) {
+      indent.newln();
+      indent.writeln('#include <cstring>');
+    }
+  }
+
+  @override
+  void writeGeneralUtilities(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent, {
+    required String dartPackageName,
+  }) {
+    if (!root.apis.any((Api api) =>
+        api.location == ApiLocation.host && api.methods.isNotEmpty)) {
+      return;
+    }
+    final String module = _getModule(generatorOptions);
+
+    indent.newln();
+    indent.writeln(
+        'static FlValue* ${module}_error_response_new(${_errorArguments.join(', ')}) {');
+    indent.nest(1, () {
+      indent.format('''
+FlValue* response = fl_value_new_list();
+fl_value_append_take(response, fl_value_new_string(code));
+fl_value_append_take(response, message != nullptr ? fl_value_new_string(message) : fl_value_new_null());
+fl_value_append_take(response, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+return response;''');
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    indent.writeln(
+        'static void ${module}_respond(FlBasicMessageChannel* channel, FlBasicMessageChannelResponseHandle* response_handle, FlValue* response, const gchar* method_name) {');
+    indent.nest(1, () {
+      indent.format('''
+g_autoptr(GError) error = nullptr;
+if (!fl_basic_message_channel_respond(channel, response_handle, response, &error)) {
+\tg_warning("Failed to send response to %s: %s", method_name, error->message);
+}''');
+    });
+    indent.writeln('}');
+  }
+
+  @override
+  void writeDataClass(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Class classDefinition, {
+    required String dartPackageName,
+  }) {
+    final String module = _getModule(generatorOptions);
+    final String className = _getClassName(module, classDefinition.name);
+    final String methodPrefix = _getMethodPrefix(module, classDefinition.name);
+    final String castMacro = _getCastMacro(module, classDefinition.name);
+    final String testMacro = _getTypeCheckMacro(module, classDefinition.name);
+
+    indent.newln();
+    indent.write('struct _$className ');
+    indent.addScoped('{', '};', () {
+      indent.writeln('GObject parent_instance;');
+      indent.newln();
+      for (final NamedType field in classDefinition.fields) {
+        final String fieldName = _snakeCaseFromCamelCase(field.name);
+        indent.writeln('${_getFieldType(module, field.type)} $fieldName;');
+        if (_isTypedData(field.type)) {
+          indent.writeln('size_t ${fieldName}_length;');
+        }
+      }
+    });
+
+    indent.newln();
+    indent.writeln('G_DEFINE_TYPE($className, $methodPrefix, G_TYPE_OBJECT)');
+
+    indent.newln();
+    indent.writeln('static void ${methodPrefix}_dispose(GObject* object) {');
+    indent.nest(1, () {
+      indent.writeln('$className* self = $castMacro(object);');
+      for (final NamedType field in classDefinition.fields) {
+        final String? clear = _getClearStatement(
+            field.type, 'self->${_snakeCaseFromCamelCase(field.name)}');
+        if (clear != null) {
+          indent.writeln(clear);
+        }
+      }
+      indent.writeln(
+          'G_OBJECT_CLASS(${methodPrefix}_parent_class)->dispose(object);');
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    indent.writeln('static void ${methodPrefix}_init($className* self) {}');
+
+    indent.newln();
+    indent.writeln(
+        'static void ${methodPrefix}_class_init(${className}Class* klass) {');
+    indent.nest(1, () {
+      indent.writeln(
+          'G_OBJECT_CLASS(klass)->dispose = ${methodPrefix}_dispose;');
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    final List<String> constructorArgs = <String>[
+      for (final NamedType field in classDefinition.fields)
+        ..._getArgumentDeclarations(
+            module, field.type, _snakeCaseFromCamelCase(field.name)),
+    ];
+    indent.writeln(
+        '$className* ${methodPrefix}_new(${_joinArguments(constructorArgs)}) {');
+    indent.nest(1, () {
+      indent.writeln(
+          '$className* self = $castMacro(g_object_new(${methodPrefix}_get_type(), nullptr));');
+      for (final NamedType field in classDefinition.fields) {
+        _writeFieldAssignment(
+            indent, module, field.type, _snakeCaseFromCamelCase(field.name));
+      }
+      indent.writeln('return self;');
+    });
+    indent.writeln('}');
+
+    for (final NamedType field in classDefinition.fields) {
+      final String fieldName = _snakeCaseFromCamelCase(field.name);
+      indent.newln();
+      indent.writeln(
+          '${_getGetterDeclaration(module, className, methodPrefix, fieldName, field.type)} {');
+      indent.nest(1, () {
+        indent.writeln(
+            'g_return_val_if_fail($testMacro(self), ${_getDefaultValue(module, field.type)});');
+        if (_isTypedData(field.type)) {
+          indent.writeScoped('if (length != nullptr) {', '}', () {
+            indent.writeln('*length = self->${fieldName}_length;');
+          });
+        }
+        indent.writeln('return self->$fieldName;');
+      });
+      indent.writeln('}');
+    }
+
+    // Only classes sent by a host API are serialized, and unused static
+    // functions would fail builds that treat warnings as errors.
+    if (_getSerializedClassNames(root).contains(classDefinition.name)) {
+      _writeToList(indent, module, root, classDefinition);
+      _writeNewFromList(indent, module, classDefinition);
+    }
+  }
+
+  void _writeToList(
+      Indent indent, String module, Root root, Class classDefinition) {
+    final String className = _getClassName(module, classDefinition.name);
+    final String methodPrefix = _getMethodPrefix(module, classDefinition.name);
+    indent.newln();
+    indent.writeln(
+        'static FlValue* ${methodPrefix}_to_list($className* self) {');
+    indent.nest(1, () {
+      indent.writeln('FlValue* values = fl_value_new_list();');
+      for (final NamedType field in classDefinition.fields) {
+        final String fieldName = 'self->${_snakeCaseFromCamelCase(field.name)}';
+        indent.writeln(
+            'fl_value_append_take(values, ${_makeFlValue(module, root, field.type, fieldName, lengthVariableName: '${fieldName}_length')});');
+      }
+      indent.writeln('return values;');
+    });
+    indent.writeln('}');
+  }
+
+  void _writeNewFromList(Indent indent, String module, Class classDefinition) {
+    final String className = _getClassName(module, classDefinition.name);
+    final String methodPrefix = _getMethodPrefix(module, classDefinition.name);
+    indent.newln();
+    indent.writeln(
+        'static $className* ${methodPrefix}_new_from_list(FlValue* values) {');
+    indent.nest(1, () {
+      final List<String> args = <String>[];
+      enumerate(classDefinition.fields, (int index, NamedType field) {
+        final String argName = _getSafeArgumentName(field.name);
+        indent.writeln(
+            'FlValue* value$index = fl_value_get_list_value(values, $index);');
+        _writeFlValueToArgument(indent, module, field.type, argName, 'value$index');
+        args.addAll(<String>[
+          argName,
+          if (_isTypedData(field.type)) '${argName}_length',
+        ]);
+      });
+      indent.writeln('return ${methodPrefix}_new(${args.join(', ')});');
+    });
+    indent.writeln('}');
+  }
+
+  @override
+  void writeFlutterApi(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Api api, {
+    required String dartPackageName,
+  }) {}
+
+  @override
+  void writeHostApi(
+    GObjectOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Api api, {
+    required String dartPackageName,
+  }) {
+    if (api.methods.isEmpty) {
+      return;
+    }
+    final String module = _getModule(generatorOptions);
+    final String apiName = _getClassName(module, api.name);
+    final String methodPrefix = _getMethodPrefix(module, api.name);
+    final String vtableName = _getVTableName(module, api.name);
+    final List<EnumeratedClass> codecClasses =
+        getCodecClasses(api, root).toList();
+
+    if (codecClasses.isNotEmpty) {
+      _writeCodec(indent, module, api, codecClasses);
+    }
+
+    for (final Method method
+        in api.methods.where((Method m) => !m.isAsynchronous)) {
+      _writeResponse(indent, module, root, api, method);
+    }
+
+    // The private object that owns the user data of the method handlers.
+    indent.newln();
+    indent.writeln(
+        'G_DECLARE_FINAL_TYPE($apiName, $methodPrefix, ${_getTypeMacroPrefix(module, api.name)}, GObject)');
+    indent.newln();
+    indent.write('struct _$apiName ');
+    indent.addScoped('{', '};', () {
+      indent.writeln('GObject parent_instance;');
+      indent.newln();
+      indent.writeln('const $vtableName* vtable;');
+      indent.writeln('gpointer user_data;');
+      indent.writeln('GDestroyNotify user_data_free_func;');
+    });
+    indent.newln();
+    indent.writeln('G_DEFINE_TYPE($apiName, $methodPrefix, G_TYPE_OBJECT)');
+    indent.newln();
+    indent.writeln('static void ${methodPrefix}_dispose(GObject* object) {');
+    indent.nest(1, () {
+      indent.writeln('$apiName* self = ${_getCastMacro(module, api.name)}(object);');
+      indent.writeScoped(
+          'if (self->user_data != nullptr && self->user_data_free_func != nullptr) {',
+          '}', () {
+        indent.writeln('self->user_data_free_func(self->user_data);');
+      });
+      indent.writeln('self->user_data = nullptr;');
+      indent.writeln(
+          'G_OBJECT_CLASS(${methodPrefix}_parent_class)->dispose(object);');
+    });
+    indent.writeln('}');
+    indent.newln();
+    indent.writeln('static void ${methodPrefix}_init($apiName* self) {}');
+    indent.newln();
+    indent.writeln(
+        'static void ${methodPrefix}_class_init(${apiName}Class* klass) {');
+    indent.nest(1, () {
+      indent.writeln(
+          'G_OBJECT_CLASS(klass)->dispose = ${methodPrefix}_dispose;');
+    });
+    indent.writeln('}');
+    indent.newln();
+    indent.writeln(
+        'static $apiName* ${methodPrefix}_new(const $vtableName* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {');
+    indent.nest(1, () {
+      indent.writeln(
+          '$apiName* self = ${_getCastMacro(module, api.name)}(g_object_new(${methodPrefix}_get_type(), nullptr));');
+      indent.writeln('self->vtable = vtable;');
+      indent.writeln('self->user_data = user_data;');
+      indent.writeln('self->user_data_free_func = user_data_free_func;');
+      indent.writeln('return self;');
+    });
+    indent.writeln('}');
+
+    if (_hasAsyncMethods(api)) {
+      _writeResponseHandle(indent, module, api);
+    }
+
+    for (final Method method in api.methods) {
+      _writeMethodHandler(indent, module, api, method);
+    }
+
+    final String codecType = codecClasses.isNotEmpty
+        ? _getClassName(module, '${api.name}Codec')
+        : 'FlStandardMessageCodec';
+    final String codecConstructor = codecClasses.isNotEmpty
+        ? '${_getMethodPrefix(module, '${api.name}Codec')}_new()'
+        : 'fl_standard_message_codec_new()';
+
+    if (api.singleChannel) {
+      indent.newln();
+      indent.writeln(
+          'typedef void (*${apiName}MethodHandler)($apiName* self, FlBasicMessageChannel* channel, FlValue* args, size_t arg_offset, FlBasicMessageChannelResponseHandle* response_handle);');
+      indent.newln();
+      indent.writeln(
+          '$_commentPrefix The handlers of the methods of ${api.name}, by method index.');
+      indent.write(
+          'static const ${apiName}MethodHandler ${methodPrefix}_method_handlers[] = ');
+      indent.addScoped('{', '};', () {
+        for (final Method method in api.methods) {
+          indent.writeln(
+              '${methodPrefix}_${_snakeCaseFromCamelCase(method.name)}_handle,');
+        }
+      });
+      indent.newln();
+      indent.writeln(
+          'static void ${methodPrefix}_dispatch_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {');
+      indent.nest(1, () {
+        indent.writeln(
+            'int64_t method_index = fl_value_get_int(fl_value_get_list_value(message_, 0));');
+        indent.writeScoped(
+            'if (method_index < 0 || static_cast<size_t>(method_index) >= G_N_ELEMENTS(${methodPrefix}_method_handlers)) {',
+            '}', () {
+          indent.writeln(
+              'g_autoptr(FlValue) response = ${module}_error_response_new("Unknown method index.", "Error", nullptr);');
+          indent.writeln(
+              '${module}_respond(channel, response_handle, response, "${api.name}");');
+          indent.writeln('return;');
+        });
+        indent.writeln(
+            '${methodPrefix}_method_handlers[method_index](${_getCastMacro(module, api.name)}(user_data), channel, message_, 1, response_handle);');
+      });
+      indent.writeln('}');
+    } else {
+      for (final Method method in api.methods) {
+        final String methodName = _snakeCaseFromCamelCase(method.name);
+        indent.newln();
+        indent.writeln(
+            'static void ${methodPrefix}_${methodName}_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {');
+        indent.nest(1, () {
+          indent.writeln(
+              '${methodPrefix}_${methodName}_handle(${_getCastMacro(module, api.name)}(user_data), channel, message_, 0, response_handle);');
+        });
+        indent.writeln('}');
+      }
+    }
+
+    final List<_Channel> channels = api.singleChannel
+        ? <_Channel>[
+            _Channel(
+              name: 'dispatch',
+              channelName: makeDispatchChannelName(api, dartPackageName),
+              callback: '${methodPrefix}_dispatch_cb',
+            ),
+          ]
+        : <_Channel>[
+            for (final Method method in api.methods)
+              _Channel(
+                name: _snakeCaseFromCamelCase(method.name),
+                channelName: makeChannelName(api, method, dartPackageName),
+                callback:
+                    '${methodPrefix}_${_snakeCaseFromCamelCase(method.name)}_cb',
+              ),
+          ];
+
+    indent.newln();
+    indent.writeln(
+        'void ${methodPrefix}_set_method_handlers(FlBinaryMessenger* messenger, const $vtableName* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {');
+    indent.nest(1, () {
+      indent.writeln(
+          'g_autoptr($apiName) api_data = ${methodPrefix}_new(vtable, user_data, user_data_free_func);');
+      indent.newln();
+      indent.writeln('g_autoptr($codecType) codec = $codecConstructor;');
+      for (final _Channel channel in channels) {
+        indent.writeln(
+            'g_autoptr(FlBasicMessageChannel) ${channel.name}_channel = fl_basic_message_channel_new(messenger, "${channel.channelName}", FL_MESSAGE_CODEC(codec));');
+        indent.writeln(
+            'fl_basic_message_channel_set_message_handler(${channel.name}_channel, ${channel.callback}, g_object_ref(api_data), g_object_unref);');
+      }
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    indent.writeln(
+        'void ${methodPrefix}_clear_method_handlers(FlBinaryMessenger* messenger) {');
+    indent.nest(1, () {
+      indent.writeln('g_autoptr($codecType) codec = $codecConstructor;');
+      for (final _Channel channel in channels) {
+        indent.writeln(
+            'g_autoptr(FlBasicMessageChannel) ${channel.name}_channel = fl_basic_message_channel_new(messenger, "${channel.channelName}", FL_MESSAGE_CODEC(codec));');
+        indent.writeln(
+            'fl_basic_message_channel_set_message_handler(${channel.name}_channel, nullptr, nullptr, nullptr);');
+      }
+    });
+    indent.writeln('}');
+
+    for (final Method method
+        in api.methods.where((Method m) => m.isAsynchronous)) {
+      _writeAsyncResponders(indent, module, root, api, method);
+    }
+  }
+
+  /// Writes the [FlStandardMessageCodec] subclass that encodes the data
+  /// classes used by [api] as custom [FlValue] objects.
+  void _writeCodec(Indent indent, String module, Api api,
+      List<EnumeratedClass> codecClasses) {
+    final String codecName = _getClassName(module, '${api.name}Codec');
+    final String codecPrefix = _getMethodPrefix(module, '${api.name}Codec');
+
+    indent.newln();
+    indent.writeln(
+        'G_DECLARE_FINAL_TYPE($codecName, $codecPrefix, ${_getTypeMacroPrefix(module, '${api.name}Codec')}, FlStandardMessageCodec)');
+    indent.newln();
+    indent.write('struct _$codecName ');
+    indent.addScoped('{', '};', () {
+      indent.writeln('FlStandardMessageCodec parent_instance;');
+    });
+    indent.newln();
+    indent.writeln(
+        'G_DEFINE_TYPE($codecName, $codecPrefix, fl_standard_message_codec_get_type())');
+
+    for (final EnumeratedClass customClass in codecClasses) {
+      final String className = _getClassName(module, customClass.name);
+      final String classPrefix = _getMethodPrefix(module, customClass.name);
+      indent.newln();
+      indent.writeln(
+          'static gboolean ${codecPrefix}_write_$classPrefix(FlStandardMessageCodec* codec, GByteArray* buffer, $className* value, GError** error) {');
+      indent.nest(1, () {
+        indent.writeln('uint8_t type = ${customClass.enumeration};');
+        indent.writeln('g_byte_array_append(buffer, &type, sizeof(uint8_t));');
+        indent.writeln(
+            'g_autoptr(FlValue) values = ${classPrefix}_to_list(value);');
+        indent.writeln(
+            'return fl_standard_message_codec_write_value(codec, buffer, values, error);');
+      });
+      indent.writeln('}');
+    }
+
+    indent.newln();
+    indent.writeln(
+        'static gboolean ${codecPrefix}_write_value(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {');
+    indent.nest(1, () {
+      indent.writeScoped(
+          'if (fl_value_get_type(value) == FL_VALUE_TYPE_CUSTOM) {', '}', () {
+        indent.writeln(
+            'GObject* object = fl_value_get_custom_value_object(value);');
+        for (final EnumeratedClass customClass in codecClasses) {
+          indent.writeScoped(
+              'if (${_getTypeCheckMacro(module, customClass.name)}(object)) {',
+              '}', () {
+            indent.writeln(
+                'return ${codecPrefix}_write_${_getMethodPrefix(module, customClass.name)}(codec, buffer, ${_getCastMacro(module, customClass.name)}(object), error);');
+          });
+        }
+      });
+      indent.newln();
+      indent.writeln(
+          'return FL_STANDARD_MESSAGE_CODEC_CLASS(${codecPrefix}_parent_class)->write_value(codec, buffer, value, error);');
+    });
+    indent.writeln('}');
+
+    for (final EnumeratedClass customClass in codecClasses) {
+      final String className = _getClassName(module, customClass.name);
+      final String classPrefix = _getMethodPrefix(module, customClass.name);
+      indent.newln();
+      indent.writeln(
+          'static FlValue* ${codecPrefix}_read_$classPrefix(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {');
+      indent.nest(1, () {
+        indent.writeln(
+            'g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);');
+        indent.writeScoped('if (values == nullptr) {', '}', () {
+          indent.writeln('return nullptr;');
+        });
+        indent.newln();
+        indent.writeln(
+            'g_autoptr($className) value = ${classPrefix}_new_from_list(values);');
+        indent.writeScoped('if (value == nullptr) {', '}', () {
+          indent.writeln(
+              'g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Failed to create ${customClass.name} from list");');
+          indent.writeln('return nullptr;');
+        });
+        indent.newln();
+        indent.writeln(
+            'return fl_value_new_custom_object(${customClass.enumeration}, G_OBJECT(value));');
+      });
+      indent.writeln('}');
+    }
+
+    indent.newln();
+    indent.writeln(
+        'static FlValue* ${codecPrefix}_read_value_of_type(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, int type, GError** error) {');
+    indent.nest(1, () {
+      indent.writeScoped('switch (type) {', '}', () {
+        for (final EnumeratedClass customClass in codecClasses) {
+          indent.writeln('case ${customClass.enumeration}:');
+          indent.nest(1, () {
+            indent.writeln(
+                'return ${codecPrefix}_read_${_getMethodPrefix(module, customClass.name)}(codec, buffer, offset, error);');
+          });
+        }
+        indent.writeln('default:');
+        indent.nest(1, () {
+          indent.writeln(
+              'return FL_STANDARD_MESSAGE_CODEC_CLASS(${codecPrefix}_parent_class)->read_value_of_type(codec, buffer, offset, type, error);');
+        });
+      });
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    indent.writeln('static void ${codecPrefix}_init($codecName* self) {}');
+    indent.newln();
+    indent.writeln(
+        'static void ${codecPrefix}_class_init(${codecName}Class* klass) {');
+    indent.nest(1, () {
+      indent.writeln(
+          'FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->write_value = ${codecPrefix}_write_value;');
+      indent.writeln(
+          'FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->read_value_of_type = ${codecPrefix}_read_value_of_type;');
+    });
+    indent.writeln('}');
+    indent.newln();
+    indent.writeln('static $codecName* ${codecPrefix}_new() {');
+    indent.nest(1, () {
+      indent.writeln(
+          'return ${_getCastMacro(module, '${api.name}Codec')}(g_object_new(${codecPrefix}_get_type(), nullptr));');
+    });
+    indent.writeln('}');
+  }
+
+  /// Writes the response object returned by the synchronous [method].
+  void _writeResponse(
+      Indent indent, String module, Root root, Api api, Method method) {
+    final String typeName =
+        '${api.name}${_pascalCaseFromCamelCase(method.name)}Response';
+    final String responseName = _getClassName(module, typeName);
+    final String responsePrefix = _getMethodPrefix(module, typeName);
+    final String castMacro = _getCastMacro(module, typeName);
+
+    indent.newln();
+    indent.write('struct _$responseName ');
+    indent.addScoped('{', '};', () {
+      indent.writeln('GObject parent_instance;');
+      indent.newln();
+      indent.writeln('FlValue* value;');
+    });
+    indent.newln();
+    indent.writeln(
+        'G_DEFINE_TYPE($responseName, $responsePrefix, G_TYPE_OBJECT)');
+    indent.newln();
+    indent.writeln('static void ${responsePrefix}_dispose(GObject* object) {');
+    indent.nest(1, () {
+      indent.writeln('$responseName* self = $castMacro(object);');
+      indent.writeln('g_clear_pointer(&self->value, fl_value_unref);');
+      indent.writeln(
+          'G_OBJECT_CLASS(${responsePrefix}_parent_class)->dispose(object);');
+    });
+    indent.writeln('}');
+    indent.newln();
+    indent.writeln('static void ${responsePrefix}_init($responseName* self) {}');
+    indent.newln();
+    indent.writeln(
+        'static void ${responsePrefix}_class_init(${responseName}Class* klass) {');
+    indent.nest(1, () {
+      indent.writeln(
+          'G_OBJECT_CLASS(klass)->dispose = ${responsePrefix}_dispose;');
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    indent.writeln(
+        '$responseName* ${responsePrefix}_new(${_joinArguments(_getReturnValueArguments(module, method))}) {');
+    indent.nest(1, () {
+      indent.writeln(
+          '$responseName* self = $castMacro(g_object_new(${responsePrefix}_get_type(), nullptr));');
+      indent.writeln('self->value = fl_value_new_list();');
+      indent.writeln(
+          'fl_value_append_take(self->value, ${_makeReturnFlValue(module, root, method)});');
+      indent.writeln('return self;');
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    indent.writeln(
+        '$responseName* ${responsePrefix}_new_error(${_errorArguments.join(', ')}) {');
+    indent.nest(1, () {
+      indent.writeln(
+          '$responseName* self = $castMacro(g_object_new(${responsePrefix}_get_type(), nullptr));');
+      indent.writeln(
+          'self->value = ${module}_error_response_new(code, message, details);');
+      indent.writeln('return self;');
+    });
+    indent.writeln('}');
+  }
+
+  /// Writes the object that keeps the reply to a message of [api] alive until
+  /// an asynchronous method responds.
+  void _writeResponseHandle(Indent indent, String module, Api api) {
+    final String typeName = '${api.name}ResponseHandle';
+    final String handleName = _getClassName(module, typeName);
+    final String handlePrefix = _getMethodPrefix(module, typeName);
+    final String castMacro = _getCastMacro(module, typeName);
+
+    indent.newln();
+    indent.write('struct _$handleName ');
+    indent.addScoped('{', '};', () {
+      indent.writeln('GObject parent_instance;');
+      indent.newln();
+      indent.writeln('FlBasicMessageChannel* channel;');
+      indent.writeln('FlBasicMessageChannelResponseHandle* response_handle;');
+    });
+    indent.newln();
+    indent.writeln('G_DEFINE_TYPE($handleName, $handlePrefix, G_TYPE_OBJECT)');
+    indent.newln();
+    indent.writeln('static void ${handlePrefix}_dispose(GObject* object) {');
+    indent.nest(1, () {
+      indent.writeln('$handleName* self = $castMacro(object);');
+      indent.writeln('g_clear_object(&self->channel);');
+      indent.writeln('g_clear_object(&self->response_handle);');
+      indent.writeln(
+          'G_OBJECT_CLASS(${handlePrefix}_parent_class)->dispose(object);');
+    });
+    indent.writeln('}');
+    indent.newln();
+    indent.writeln('static void ${handlePrefix}_init($handleName* self) {}');
+    indent.newln();
+    indent.writeln(
+        'static void ${handlePrefix}_class_init(${handleName}Class* klass) {');
+    indent.nest(1, () {
+      indent.writeln('G_OBJECT_CLASS(klass)->dispose = ${handlePrefix}_dispose;');
+    });
+    indent.writeln('}');
+    indent.newln();
+    indent.writeln(
+        'static $handleName* ${handlePrefix}_new(FlBasicMessageChannel* channel, FlBasicMessageChannelResponseHandle* response_handle) {');
+    indent.nest(1, () {
+      indent.writeln(
+          '$handleName* self = $castMacro(g_object_new(${handlePrefix}_get_type(), nullptr));');
+      indent.writeln('self->channel = FL_BASIC_MESSAGE_CHANNEL(g_object_ref(channel));');
+      indent.writeln(
+          'self->response_handle = FL_BASIC_MESSAGE_CHANNEL_RESPONSE_HANDLE(g_object_ref(response_handle));');
+      indent.writeln('return self;');
+    });
+    indent.writeln('}');
+  }
+
+  /// Writes the function that decodes the arguments of [method] starting at
+  /// `arg_offset` and calls the matching entry of the vtable.
+  void _writeMethodHandler(
+      Indent indent, String module, Api api, Method method) {
+    final String apiName = _getClassName(module, api.name);
+    final String methodPrefix = _getMethodPrefix(module, api.name);
+    final String methodName = _snakeCaseFromCamelCase(method.name);
+    final String qualifiedName = '${api.name}.${method.name}';
+
+    indent.newln();
+    indent.writeln(
+        'static void ${methodPrefix}_${methodName}_handle($apiName* self, FlBasicMessageChannel* channel, FlValue* args, size_t arg_offset, FlBasicMessageChannelResponseHandle* response_handle) {');
+    indent.nest(1, () {
+      indent.writeScoped(
+          'if (self->vtable == nullptr || self->vtable->$methodName == nullptr) {',
+          '}', () {
+        indent.writeln(
+            'g_autoptr(FlValue) response = ${module}_error_response_new("Unimplemented", "$qualifiedName is not implemented", nullptr);');
+        indent.writeln(
+            '${module}_respond(channel, response_handle, response, "$qualifiedName");');
+        indent.writeln('return;');
+      });
+      indent.newln();
+      final List<String> args = <String>[];
+      enumerate(method.parameters, (int index, NamedType param) {
+        final String argName = _getSafeArgumentName(param.name);
+        indent.writeln(
+            'FlValue* value$index = fl_value_get_list_value(args, arg_offset + $index);');
+        _writeFlValueToArgument(indent, module, param.type, argName, 'value$index');
+        args.addAll(<String>[
+          argName,
+          if (_isTypedData(param.type)) '${argName}_length',
+        ]);
+      });
+      if (method.isAsynchronous) {
+        final String handlePrefix =
+            _getMethodPrefix(module, '${api.name}ResponseHandle');
+        indent.writeln(
+            'g_autoptr(${apiName}ResponseHandle) handle = ${handlePrefix}_new(channel, response_handle);');
+        indent.writeln(
+            'self->vtable->$methodName(${<String>[
+          ...args,
+          'handle',
+          'self->user_data'
+        ].join(', ')});');
+      } else {
+        indent.writeln(
+            'g_autoptr(${_getResponseName(module, api.name, method)}) response = self->vtable->$methodName(${<String>[
+          ...args,
+          'self->user_data'
+        ].join(', ')});');
+        indent.writeScoped('if (response == nullptr) {', '}', () {
+          indent.writeln(
+              'g_warning("No response returned to %s", "$qualifiedName");');
+          indent.writeln('return;');
+        });
+        indent.newln();
+        indent.writeln(
+            '${module}_respond(channel, response_handle, response->value, "$qualifiedName");');
+      }
+    });
+    indent.writeln('}');
+  }
+
+  /// Writes the functions that respond to the asynchronous [method].
+  void _writeAsyncResponders(
+      Indent indent, String module, Root root, Api api, Method method) {
+    final String apiName = _getClassName(module, api.name);
+    final String methodPrefix = _getMethodPrefix(module, api.name);
+    final String methodName = _snakeCaseFromCamelCase(method.name);
+    final String qualifiedName = '${api.name}.${method.name}';
+
+    indent.newln();
+    indent.writeln('void ${methodPrefix}_respond_$methodName(${<String>[
+      '${apiName}ResponseHandle* response_handle',
+      ..._getReturnValueArguments(module, method),
+    ].join(', ')}) {');
+    indent.nest(1, () {
+      indent.writeln('g_autoptr(FlValue) response = fl_value_new_list();');
+      indent.writeln(
+          'fl_value_append_take(response, ${_makeReturnFlValue(module, root, method)});');
+      indent.writeln(
+          '${module}_respond(response_handle->channel, response_handle->response_handle, response, "$qualifiedName");');
+    });
+    indent.writeln('}');
+
+    indent.newln();
+    indent.writeln('void ${methodPrefix}_respond_error_$methodName(${<String>[
+      '${apiName}ResponseHandle* response_handle',
+      ..._errorArguments,
+    ].join(', ')}) {');
+    indent.nest(1, () {
+      indent.writeln(
+          'g_autoptr(FlValue) response = ${module}_error_response_new(code, message, details);');
+      indent.writeln(
+          '${module}_respond(response_handle->channel, response_handle->response_handle, response, "$qualifiedName");');
+    });
+    indent.writeln('}');
+  }
+}
+
+/// A channel registered by the method handlers of a host API.
+class _Channel {
+  const _Channel({
+    required this.name,
+    required this.channelName,
+    required this.callback,
+  });
+
+  /// The prefix of the local variable holding the channel.
+  final String name;
+
+  /// The name of the channel.
+  final String channelName;
+
+  /// The function that handles messages on the channel.
+  final String callback;
+}
+
+/// The arguments of the functions that create error responses.
+const List<String> _errorArguments = <String>[
+  'const gchar* code',
+  'const gchar* message',
+  'FlValue* details',
+];
+
+/// The C element types of the typed data types, by Dart type.
+const Map<String, String> _typedDataElementTypes = <String, String>{
+  'Uint8List': 'uint8_t',
+  'Int32List': 'int32_t',
+  'Int64List': 'int64_t',
+  'Float64List': 'double',
+};
+
+/// The [FlValue] function suffixes of the typed data types, by Dart type.
+const Map<String, String> _typedDataFlValueNames = <String, String>{
+  'Uint8List': 'uint8_list',
+  'Int32List': 'int32_list',
+  'Int64List': 'int64_list',
+  'Float64List': 'float_list',
+};
+
+/// The C types of the primitive Dart types that are passed by value.
+const Map<String, String> _primitiveTypes = <String, String>{
+  'bool': 'gboolean',
+  'int': 'int64_t',
+  'double': 'double',
+};
+
+/// The [FlValue] function suffixes of the primitive Dart types.
+const Map<String, String> _primitiveFlValueNames = <String, String>{
+  'bool': 'bool',
+  'int': 'int',
+  'double': 'float',
+};
+
+String _getModule(GObjectOptions options) => options.module ?? _defaultModule;
+
+/// Returns the names of the data classes encoded by the codec of any host API.
+Set<String> _getSerializedClassNames(Root root) {
+  return <String>{
+    for (final Api api in root.apis)
+      if (api.location == ApiLocation.host && api.methods.isNotEmpty)
+        ...getCodecClasses(api, root)
+            .map((EnumeratedClass customClass) => customClass.name),
+  };
+}
+
+bool _hasAsyncMethods(Api api) =>
+    api.methods.any((Method method) => method.isAsynchronous);
+
+bool _isTypedData(TypeDeclaration type) =>
+    _typedDataElementTypes.containsKey(type.baseName);
+
+/// Returns true if [type] is held as an [FlValue] rather than a C type.
+bool _isFlValue(TypeDeclaration type) =>
+    type.baseName == 'List' ||
+    type.baseName == 'Map' ||
+    type.baseName == 'Object';
+
+/// Returns true if [type] is passed by value when non-nullable, and as a
+/// pointer to the value when nullable.
+bool _isValueType(TypeDeclaration type) =>
+    type.isEnum || _primitiveTypes.containsKey(type.baseName);
+
+/// Returns the C type of a non-nullable [type] passed by value.
+String _getValueType(String module, TypeDeclaration type) => type.isEnum
+    ? _getClassName(module, type.baseName)
+    : _primitiveTypes[type.baseName]!;
+
+/// Returns the C type of an argument of [type].
+String _getArgumentType(String module, TypeDeclaration type) {
+  if (_isValueType(type)) {
+    final String valueType = _getValueType(module, type);
+    return type.isNullable ? '$valueType*' : valueType;
+  } else if (type.baseName == 'String') {
+    return 'const gchar*';
+  } else if (_isTypedData(type)) {
+    return 'const ${_typedDataElementTypes[type.baseName]}*';
+  } else if (type.isClass) {
+    return '${_getClassName(module, type.baseName)}*';
+  }
+  return 'FlValue*';
+}
+
+/// Returns the C type of a data class field of [type].
+String _getFieldType(String module, TypeDeclaration type) {
+  if (type.baseName == 'String') {
+    return 'gchar*';
+  } else if (_isTypedData(type)) {
+    return '${_typedDataElementTypes[type.baseName]}*';
+  }
+  return _getArgumentType(module, type);
+}
+
+/// Returns the argument declarations used to pass a value of [type] named
+/// [name], which includes the length of typed data.
+List<String> _getArgumentDeclarations(
+    String module, TypeDeclaration type, String name) {
+  return <String>[
+    '${_getArgumentType(module, type)} $name',
+    if (_isTypedData(type)) 'size_t ${name}_length',
+  ];
+}
+
+/// Joins argument declarations into a C parameter list.
+String _joinArguments(List<String> args) =>
+    args.isEmpty ? 'void' : args.join(', ');
+
+/// Returns the argument declarations of the vtable entry for [method].
+List<String> _getMethodArguments(String module, Method method) {
+  return <String>[
+    for (final NamedType param in method.parameters)
+      ..._getArgumentDeclarations(
+          module, param.type, _snakeCaseFromCamelCase(param.name)),
+  ];
+}
+
+/// Returns the argument declarations of the functions that return a value
+/// from [method].
+List<String> _getReturnValueArguments(String module, Method method) {
+  if (method.returnType.isVoid) {
+    return <String>[];
+  }
+  return _getArgumentDeclarations(module, method.returnType, 'return_value');
+}
+
+/// Returns the expression that creates the [FlValue] holding the value
+/// returned from [method].
+String _makeReturnFlValue(String module, Root root, Method method) {
+  if (method.returnType.isVoid) {
+    return 'fl_value_new_null()';
+  }
+  return _makeFlValue(module, root, method.returnType, 'return_value',
+      lengthVariableName: 'return_value_length');
+}
+
+/// Returns the getter declaration, without a trailing semicolon, for the field
+/// [fieldName] of [type].
+String _getGetterDeclaration(String module, String className,
+    String methodPrefix, String fieldName, TypeDeclaration type) {
+  final String returnType = _getArgumentType(module, type);
+  if (_isTypedData(type)) {
+    return '$returnType ${methodPrefix}_get_$fieldName($className* self, size_t* length)';
+  }
+  return '$returnType ${methodPrefix}_get_$fieldName($className* self)';
+}
+
+/// Returns the value returned from a getter for [type] when the object is
+/// invalid.
+String _getDefaultValue(String module, TypeDeclaration type) {
+  if (type.isNullable || !_isValueType(type)) {
+    return 'nullptr';
+  } else if (type.isEnum) {
+    return 'static_cast<${_getClassName(module, type.baseName)}>(0)';
+  } else if (type.baseName == 'bool') {
+    return 'FALSE';
+  }
+  return '0';
+}
+
+/// Returns the statement that releases the data class field [variableName]
+/// of [type], or null if there is nothing to release.
+String? _getClearStatement(TypeDeclaration type, String variableName) {
+  if (type.isClass) {
+    return 'g_clear_object(&$variableName);';
+  } else if (_isFlValue(type)) {
+    return 'g_clear_pointer(&$variableName, fl_value_unref);';
+  } else if (type.baseName == 'String' ||
+      _isTypedData(type) ||
+      (_isValueType(type) && type.isNullable)) {
+    return 'g_clear_pointer(&$variableName, g_free);';
+  }
+  return null;
+}
+
+/// Writes the statements that copy the constructor argument [name] of [type]
+/// into the field of the same name.
+void _writeFieldAssignment(
+    Indent indent, String module, TypeDeclaration type, String name) {
+  if (_isValueType(type)) {
+    if (!type.isNullable) {
+      indent.writeln('self->$name = $name;');
+      return;
+    }
+    final String valueType = _getValueType(module, type);
+    indent.writeScoped('if ($name != nullptr) {', '}', () {
+      indent.writeln(
+          'self->$name = static_cast<$valueType*>(g_malloc(sizeof($valueType)));');
+      indent.writeln('*self->$name = *$name;');
+    }, addTrailingNewline: false);
+    indent.addScoped(' else {', '}', () {
+      indent.writeln('self->$name = nullptr;');
+    });
+  } else if (type.baseName == 'String') {
+    indent.writeln('self->$name = g_strdup($name);');
+  } else if (_isTypedData(type)) {
+    final String elementType = _typedDataElementTypes[type.baseName]!;
+    indent.writeln(
+        'self->$name = static_cast<$elementType*>(g_malloc(sizeof($elementType) * ${name}_length));');
+    indent.writeln(
+        'memcpy(self->$name, $name, sizeof($elementType) * ${name}_length);');
+    indent.writeln('self->${name}_length = ${name}_length;');
+  } else if (type.isClass) {
+    final String castMacro = _getCastMacro(module, type.baseName);
+    indent.writeln(
+        'self->$name = $name != nullptr ? $castMacro(g_object_ref($name)) : nullptr;');
+  } else {
+    indent.writeln(
+        'self->$name = $name != nullptr ? fl_value_ref($name) : nullptr;');
+  }
+}
+
+/// Returns the expression that creates a new [FlValue] holding the value of
+/// [variableName], which is of [type].
+String _makeFlValue(
+    String module, Root root, TypeDeclaration type, String variableName,
+    {required String lengthVariableName}) {
+  final String value;
+  if (type.isEnum) {
+    value = 'fl_value_new_int(static_cast<int64_t>('
+        '${type.isNullable ? '*' : ''}$variableName))';
+  } else if (_isValueType(type)) {
+    value = 'fl_value_new_${_primitiveFlValueNames[type.baseName]}('
+        '${type.isNullable ? '*' : ''}$variableName)';
+  } else if (type.baseName == 'String') {
+    value = 'fl_value_new_string($variableName)';
+  } else if (_isTypedData(type)) {
+    value = 'fl_value_new_${_typedDataFlValueNames[type.baseName]}('
+        '$variableName, $lengthVariableName)';
+  } else if (type.isClass) {
+    value = 'fl_value_new_custom_object(${_getCustomTypeId(root, type)}, '
+        'G_OBJECT($variableName))';
+  } else {
+    value = 'fl_value_ref($variableName)';
+  }
+  if (type.isNullable || type.baseName == 'Object') {
+    return '$variableName != nullptr ? $value : fl_value_new_null()';
+  }
+  return value;
+}
+
+/// Returns the [FlValue] custom type used to hold the data class [type].
+///
+/// The codecs recognise data classes by their GType, so this only has to be
+/// unique within the file.
+int _getCustomTypeId(Root root, TypeDeclaration type) {
+  return 128 +
+      root.classes.indexWhere((Class aClass) => aClass.name == type.baseName);
+}
+
+/// Writes the declaration of [argName], which is of [type], read from the
+/// [FlValue] expression [valueName].
+void _writeFlValueToArgument(Indent indent, String module,
+    TypeDeclaration type, String argName, String valueName) {
+  final String getter;
+  if (type.isEnum) {
+    getter = 'static_cast<${_getValueType(module, type)}>('
+        'fl_value_get_int($valueName))';
+  } else if (_isValueType(type)) {
+    getter = 'fl_value_get_${_primitiveFlValueNames[type.baseName]}($valueName)';
+  } else if (type.baseName == 'String') {
+    getter = 'fl_value_get_string($valueName)';
+  } else if (_isTypedData(type)) {
+    getter = 'fl_value_get_${_typedDataFlValueNames[type.baseName]}($valueName)';
+  } else if (type.isClass) {
+    getter = '${_getCastMacro(module, type.baseName)}('
+        'fl_value_get_custom_value_object($valueName))';
+  } else {
+    getter = valueName;
+  }
+
+  final String argType = _getArgumentType(module, type);
+  if (!type.isNullable && type.baseName != 'Object') {
+    indent.writeln('$argType $argName = $getter;');
+    if (_isTypedData(type)) {
+      indent.writeln('size_t ${argName}_length = fl_value_get_length($valueName);');
+    }
+    return;
+  }
+
+  indent.writeln('$argType $argName = nullptr;');
+  if (_isValueType(type)) {
+    indent.writeln('${_getValueType(module, type)} ${argName}_value;');
+  } else if (_isTypedData(type)) {
+    indent.writeln('size_t ${argName}_length = 0;');
+  }
+  indent.writeScoped(
+      'if (fl_value_get_type($valueName) != FL_VALUE_TYPE_NULL) {', '}', () {
+    if (_isValueType(type)) {
+      indent.writeln('${argName}_value = $getter;');
+      indent.writeln('$argName = &${argName}_value;');
+    } else {
+      indent.writeln('$argName = $getter;');
+      if (_isTypedData(type)) {
+        indent.writeln('${argName}_length = fl_value_get_length($valueName);');
+      }
+    }
+  });
+}
+
+/// Writes the `G_DECLARE_FINAL_TYPE` of the GObject named [name].
+void _writeDeclareFinalType(Indent indent, String module, String name) {
+  indent.writeln(
+      'G_DECLARE_FINAL_TYPE(${_getClassName(module, name)}, ${_getMethodPrefix(module, name)}, ${_getTypeMacroPrefix(module, name)}, GObject)');
+}
+
+/// Returns the name of the C type for [name], e.g. `UrlLauncherFoo`.
+String _getClassName(String module, String name) =>
+    '${_pascalCaseFromSnakeCase(module)}$name';
+
+/// Returns the prefix of the functions of [name], e.g. `url_launcher_foo`.
+String _getMethodPrefix(String module, String name) =>
+    '${module}_${_snakeCaseFromCamelCase(name)}';
+
+/// Returns the module and type parts of the type macros of [name], e.g.
+/// `URL_LAUNCHER, FOO`.
+String _getTypeMacroPrefix(String module, String name) =>
+    '${module.toUpperCase()}, ${_snakeCaseFromCamelCase(name).toUpperCase()}';
+
+/// Returns the macro that casts to [name], e.g. `URL_LAUNCHER_FOO`.
+String _getCastMacro(String module, String name) =>
+    '${module.toUpperCase()}_${_snakeCaseFromCamelCase(name).toUpperCase()}';
+
+/// Returns the macro that checks for [name], e.g. `URL_LAUNCHER_IS_FOO`.
+String _getTypeCheckMacro(String module, String name) =>
+    '${module.toUpperCase()}_IS_${_snakeCaseFromCamelCase(name).toUpperCase()}';
+
+/// Returns the name of the value [memberName] of the enum [enumName], e.g.
+/// `URL_LAUNCHER_COLOR_DARK_RED`.
+String _getEnumValue(String module, String enumName, String memberName) =>
+    '${_getCastMacro(module, enumName)}_${_snakeCaseFromCamelCase(memberName).toUpperCase()}';
+
+String _getVTableName(String module, String apiName) =>
+    '${_getClassName(module, apiName)}VTable';
+
+String _getResponseName(String module, String apiName, Method method) =>
+    _getClassName(
+        module, '$apiName${_pascalCaseFromCamelCase(method.name)}Response');
+
+String _getResponseMethodPrefix(String module, String apiName, Method method) =>
+    _getMethodPrefix(
+        module, '$apiName${_pascalCaseFromCamelCase(method.name)}Response');
+
+String _getSafeArgumentName(String name) =>
+    '${_snakeCaseFromCamelCase(name)}_arg';
+
+String _pascalCaseFromCamelCase(String camelCase) =>
+    camelCase[0].toUpperCase() + camelCase.substring(1);
+
+String _snakeCaseFromCamelCase(String camelCase) {
+  return camelCase.replaceAllMapped(RegExp(r'[A-Z]'),
+      (Match m) => '${m.start == 0 ? '' : '_'}${m[0]!.toLowerCase()}');
+}
+
+String _pascalCaseFromSnakeCase(String snakeCase) {
+  final String camelCase = snakeCase.replaceAllMapped(
+      RegExp(r'_([a-z])'), (Match m) => m[1]!.toUpperCase());
+  return _pascalCaseFromCamelCase(camelCase);
+}
+
+String _getGuardName(String? headerFileName) {
+  const String prefix = 'PIGEON_';
+  if (headerFileName != null) {
+    return '$prefix${headerFileName.replaceAll('.', '_').toUpperCase()}_';
+  } else {
+    return '${prefix}H_';
+  }
+}
@@ -15,6 +15,21 @@ const String _docCommentPrefix = '///';
 const DocumentCommentSpecification _docCommentSpec =
     DocumentCommentSpecification(_docCommentPrefix);
 
+// The type bytes of the standard message codec for the values that generated
+// data classes and `@ObjCZeroCopy` methods read and write directly.
+const int _standardFieldNull = 0;
+const int _standardFieldTrue = 1;
+const int _standardFieldFalse = 2;
+const int _standardFieldInt32 = 3;
+const int _standardFieldInt64 = 4;
+const int _standardFieldFloat64 = 6;
+const int _standardFieldString = 7;
+const int _standardFieldUint8List = 8;
+const int _standardFieldInt32List = 9;
+const int _standardFieldInt64List = 10;
+const int _standardFieldFloat64List = 11;
+const int _standardFieldList = 12;
+
 /// Options that control how Objective-C code will be generated.
 class ObjcOptions {
   /// Parametric constructor for ObjcOptions.
@@ -556,6 +571,44 @@ class ObjcSourceGenerator extends StructuredGenerator<ObjcOptions> {
         }
       });
     });
+    // Writes the same bytes as writing the result of toList, without creating
+    // the array or boxing primitive fields.
+    indent.write('- (void)writeToCodecWriter:(FlutterStandardWriter *)writer ');
+    indent.addScoped('{', '}', () {
+      indent.writeln('[writer writeByte:$_standardFieldList];');
+      indent.writeln('[writer writeSize:${classDefinition.fields.length}];');
+      for (final NamedType field in classDefinition.fields) {
+        _writeFieldToCodecWriter(indent, field);
+      }
+    });
+  }
+
+  void _writeFieldToCodecWriter(Indent indent, NamedType field) {
+    final String value = 'self.${field.name}';
+    if (field.type.isClass) {
+      indent.writeScoped('if ($value) {', '} else {', () {
+        indent.writeln('[$value writeToCodecWriter:writer];');
+      });
+      indent.nest(1, () {
+        indent.writeln('[writer writeValue:[NSNull null]];');
+      });
+      indent.writeln('}');
+    } else if (field.type.isEnum && field.type.isNullable) {
+      indent.writeScoped('if ($value) {', '} else {', () {
+        indent.writeln('WriteInteger(writer, $value.value);');
+      });
+      indent.nest(1, () {
+        indent.writeln('[writer writeValue:[NSNull null]];');
+      });
+      indent.writeln('}');
+    } else {
+      final String? primitive = _codecPrimitiveName(field.type);
+      if (primitive != null) {
+        indent.writeln('Write$primitive(writer, $value);');
+      } else {
+        indent.writeln('[writer writeValue:$value];');
+      }
+    }
   }
 
   @override
@@ -599,6 +652,42 @@ class ObjcSourceGenerator extends StructuredGenerator<ObjcOptions> {
     indent.addScoped('{', '}', () {
       indent.writeln('return (list) ? [$className fromList:list] : nil;');
     });
+
+    // Reads the fields directly from the message, rather than from an array
+    // of boxed values.
+    indent.write(
+        '+ (nullable $className *)nullableFromCodecReader:(FlutterStandardReader *)reader ');
+    indent.addScoped('{', '}', () {
+      indent.writeln('UInt8 type = [reader readByte];');
+      indent.writeScoped('if (type != $_standardFieldList) {', '}', () {
+        indent.writeln(
+            'return [$className nullableFromList:[reader readValueOfType:type]];');
+      });
+      indent.writeln('[reader readSize];');
+      const String resultName = 'pigeonResult';
+      indent.writeln('$className *$resultName = [[$className alloc] init];');
+      for (final NamedType field
+          in getFieldsInSerializationOrder(classDefinition)) {
+        final String valueExpression;
+        final String? primitive = _codecPrimitiveName(field.type);
+        if (field.type.isClass) {
+          valueExpression =
+              '[${_className(generatorOptions.prefix, field.type.baseName)} nullableFromCodecReader:reader]';
+        } else if (primitive != null) {
+          valueExpression = 'Read$primitive(reader)';
+        } else if (field.type.isEnum) {
+          indent.writeln(
+              'NSNumber *${field.name}AsNumber = [reader readValue];');
+          indent.writeln(
+              '${_enumName(field.type.baseName, suffix: ' *', prefix: generatorOptions.prefix, box: true)}${field.name} = ${field.name}AsNumber == nil ? nil : [[${_enumName(field.type.baseName, prefix: generatorOptions.prefix, box: true)} alloc] initWithValue:[${field.name}AsNumber integerValue]];');
+          valueExpression = field.name;
+        } else {
+          valueExpression = '[reader readValue]';
+        }
+        indent.writeln('$resultName.${field.name} = $valueExpression;');
+      }
+      indent.writeln('return $resultName;');
+    });
   }
 
   void _writeCodecAndGetter(
@@ -672,6 +761,12 @@ class ObjcSourceGenerator extends StructuredGenerator<ObjcOptions> {
             indent.writeln(
                 'NSObject<FlutterTaskQueue> *$taskQueue = [binaryMessenger makeBackgroundTaskQueue];');
           }
+          if (func.objcZeroCopy) {
+            _writeZeroCopyHostMethodSetUp(
+                generatorOptions, root, indent, api, apiName, func, taskQueue,
+                dartPackageName: dartPackageName);
+            return;
+          }
           _writeChannelAllocation(
             generatorOptions,
             indent,
@@ -716,6 +811,194 @@ class ObjcSourceGenerator extends StructuredGenerator<ObjcOptions> {
       indent.newln();
     }
     _writeGetNullableObjectAtIndex(indent);
+    _writeCodecPrimitiveHelpers(indent, root);
+    if (_hasZeroCopyMethods(root)) {
+      _writeZeroCopyReader(indent);
+    }
+  }
+
+  /// Writes the functions that decode the arguments of `@ObjCZeroCopy`
+  /// methods straight from the message, with typed data as views of it.
+  void _writeZeroCopyReader(Indent indent) {
+    indent.newln();
+    indent.format('''
+static void ZeroCopyReadBytes(NSData *message, NSUInteger *position, void *destination, NSUInteger length) {
+\t[message getBytes:destination range:NSMakeRange(*position, length)];
+\t*position += length;
+}
+
+static UInt8 ZeroCopyReadByte(NSData *message, NSUInteger *position) {
+\tUInt8 value;
+\tZeroCopyReadBytes(message, position, &value, sizeof(value));
+\treturn value;
+}
+
+static NSUInteger ZeroCopyReadSize(NSData *message, NSUInteger *position) {
+\tUInt8 byte = ZeroCopyReadByte(message, position);
+\tif (byte < 254) {
+\t\treturn byte;
+\t} else if (byte == 254) {
+\t\tUInt16 value;
+\t\tZeroCopyReadBytes(message, position, &value, sizeof(value));
+\t\treturn value;
+\t}
+\tUInt32 value;
+\tZeroCopyReadBytes(message, position, &value, sizeof(value));
+\treturn value;
+}
+
+static void ZeroCopyReadAlignment(NSUInteger *position, NSUInteger alignment) {
+\tNSUInteger mod = *position % alignment;
+\tif (mod) {
+\t\t*position += alignment - mod;
+\t}
+}
+
+// Returns the next |length| bytes of |message| as a view that keeps |message|
+// alive, rather than as a copy.
+static NSData *ZeroCopyReadView(NSData *message, NSUInteger *position, NSUInteger length) {
+\tNSRange range = NSMakeRange(*position, length);
+\tif (NSMaxRange(range) > message.length) {
+\t\t[NSException raise:NSRangeException format:@"Message is too short to read %lu bytes at %lu.", (unsigned long)length, (unsigned long)range.location];
+\t}
+\t*position += length;
+\treturn [[NSData alloc] initWithBytesNoCopy:(UInt8 *)message.bytes + range.location length:length deallocator:^(void *bytes, NSUInteger bytesLength) {
+\t\t// Releasing this block releases |message|.
+\t\t(void)message;
+\t}];
+}
+
+static NSData *ZeroCopyReadTypedData(NSData *message, NSUInteger *position, NSUInteger elementSize) {
+\tNSUInteger elementCount = ZeroCopyReadSize(message, position);
+\tZeroCopyReadAlignment(position, elementSize);
+\treturn ZeroCopyReadView(message, position, elementCount * elementSize);
+}
+
+// Reads the header of the argument list of a message to an `@ObjCZeroCopy`
+// method, leaving |position| at the first argument.
+static void ZeroCopyReadArgumentListHeader(NSData *message, NSUInteger *position) {
+\tUInt8 type = ZeroCopyReadByte(message, position);
+\tif (type != $_standardFieldList) {
+\t\t[NSException raise:NSInternalInconsistencyException format:@"Unexpected message type %d.", type];
+\t}
+\tZeroCopyReadSize(message, position);
+}
+
+// Reads the next argument of a message to an `@ObjCZeroCopy` method.
+static id ZeroCopyReadValue(NSData *message, NSUInteger *position) {
+\tUInt8 type = ZeroCopyReadByte(message, position);
+\tswitch (type) {
+\t\tcase $_standardFieldNull:
+\t\t\treturn nil;
+\t\tcase $_standardFieldTrue:
+\t\t\treturn @YES;
+\t\tcase $_standardFieldFalse:
+\t\t\treturn @NO;
+\t\tcase $_standardFieldInt32: {
+\t\t\tint32_t value;
+\t\t\tZeroCopyReadBytes(message, position, &value, sizeof(value));
+\t\t\treturn @(value);
+\t\t}
+\t\tcase $_standardFieldInt64: {
+\t\t\tint64_t value;
+\t\t\tZeroCopyReadBytes(message, position, &value, sizeof(value));
+\t\t\treturn @(value);
+\t\t}
+\t\tcase $_standardFieldFloat64: {
+\t\t\tdouble value;
+\t\t\tZeroCopyReadAlignment(position, 8);
+\t\t\tZeroCopyReadBytes(message, position, &value, sizeof(value));
+\t\t\treturn @(value);
+\t\t}
+\t\tcase $_standardFieldString: {
+\t\t\tNSUInteger length = ZeroCopyReadSize(message, position);
+\t\t\treturn [[NSString alloc] initWithData:ZeroCopyReadView(message, position, length) encoding:NSUTF8StringEncoding];
+\t\t}
+\t\tcase $_standardFieldUint8List:
+\t\t\treturn [FlutterStandardTypedData typedDataWithBytes:ZeroCopyReadTypedData(message, position, 1)];
+\t\tcase $_standardFieldInt32List:
+\t\t\treturn [FlutterStandardTypedData typedDataWithInt32:ZeroCopyReadTypedData(message, position, 4)];
+\t\tcase $_standardFieldInt64List:
+\t\t\treturn [FlutterStandardTypedData typedDataWithInt64:ZeroCopyReadTypedData(message, position, 8)];
+\t\tcase $_standardFieldFloat64List:
+\t\t\treturn [FlutterStandardTypedData typedDataWithFloat64:ZeroCopyReadTypedData(message, position, 8)];
+\t\tdefault:
+\t\t\t[NSException raise:NSInternalInconsistencyException format:@"Unsupported argument type %d.", type];
+\t\t\treturn nil;
+\t}
+}''');
+  }
+
+  /// Writes the functions that data classes use to read and write their
+  /// non-nullable primitive fields without boxing them, for the primitive
+  /// types [root] has fields of.
+  void _writeCodecPrimitiveHelpers(Indent indent, Root root) {
+    final Set<String> primitives = <String>{
+      for (final Class classDefinition in root.classes)
+        for (final NamedType field in classDefinition.fields)
+          if (field.type.isEnum && field.type.isNullable)
+            'Integer'
+          else if (_codecPrimitiveName(field.type) != null)
+            _codecPrimitiveName(field.type)!,
+    };
+    if (primitives.contains('Integer')) {
+      indent.newln();
+      indent.format('''
+static void WriteInteger(FlutterStandardWriter *writer, NSInteger value) {
+\tint64_t int64Value = value;
+\t[writer writeByte:$_standardFieldInt64];
+\t[writer writeBytes:&int64Value length:sizeof(int64Value)];
+}
+
+static NSInteger ReadInteger(FlutterStandardReader *reader) {
+\tUInt8 type = [reader readByte];
+\tif (type == $_standardFieldInt32) {
+\t\tint32_t value;
+\t\t[reader readBytes:&value length:sizeof(value)];
+\t\treturn value;
+\t} else if (type == $_standardFieldInt64) {
+\t\tint64_t value;
+\t\t[reader readBytes:&value length:sizeof(value)];
+\t\treturn (NSInteger)value;
+\t}
+\treturn [[reader readValueOfType:type] integerValue];
+}''');
+    }
+    if (primitives.contains('Double')) {
+      indent.newln();
+      indent.format('''
+static void WriteDouble(FlutterStandardWriter *writer, double value) {
+\t[writer writeByte:$_standardFieldFloat64];
+\t[writer writeAlignment:8];
+\t[writer writeBytes:&value length:sizeof(value)];
+}
+
+static double ReadDouble(FlutterStandardReader *reader) {
+\tUInt8 type = [reader readByte];
+\tif (type == $_standardFieldFloat64) {
+\t\tdouble value;
+\t\t[reader readAlignment:8];
+\t\t[reader readBytes:&value length:sizeof(value)];
+\t\treturn value;
+\t}
+\treturn [[reader readValueOfType:type] doubleValue];
+}''');
+    }
+    if (primitives.contains('Bool')) {
+      indent.newln();
+      indent.format('''
+static void WriteBool(FlutterStandardWriter *writer, BOOL value) {
+\t[writer writeByte:value ? $_standardFieldTrue : $_standardFieldFalse];
+}
+
+static BOOL ReadBool(FlutterStandardReader *reader) {
+\tUInt8 type = [reader readByte];
+\tif (type == $_standardFieldTrue || type == $_standardFieldFalse) {
+\t\treturn type == $_standardFieldTrue;
+\t}
+\treturn [[reader readValueOfType:type] boolValue];
+}''');
+    }
   }
 
   void _writeWrapError(Indent indent) {
@@ -745,14 +1028,47 @@ static FlutterError *createConnectionError(NSString *channelName) {
 }''');
   }
 
+  /// Writes the set up of an `@ObjCZeroCopy` host API method, which handles
+  /// the raw message instead of one decoded by the codec.
+  void _writeZeroCopyHostMethodSetUp(
+    ObjcOptions generatorOptions,
+    Root root,
+    Indent indent,
+    Api api,
+    String apiName,
+    Method func,
+    String? taskQueue, {
+    required String dartPackageName,
+  }) {
+    const String channelName = 'channelName';
+    indent.writeln(
+        'NSString *$channelName = @"${makeChannelName(api, func, dartPackageName)}";');
+    indent.write('if (api) ');
+    indent.addScoped('{', '}', () {
+      _writeChannelApiBinding(
+          generatorOptions, root, indent, apiName, func, channelName,
+          zeroCopyTaskQueue: taskQueue);
+    }, addTrailingNewline: false);
+    indent.add(' else ');
+    indent.addScoped('{', '}', () {
+      indent.writeln(
+          '[binaryMessenger setMessageHandlerOnChannel:$channelName binaryMessageHandler:nil];');
+    });
+  }
+
+  /// Writes the message handler of [func] on [channel].
+  ///
+  /// If [func] uses `@ObjCZeroCopy`, [channel] is the name of the channel,
+  /// and the handler decodes the arguments from the raw message itself and
+  /// runs on [zeroCopyTaskQueue], if any.
   void _writeChannelApiBinding(ObjcOptions generatorOptions, Root root,
-      Indent indent, String apiName, Method func, String channel) {
-    void unpackArgs(String variable) {
-      indent.writeln('NSArray *args = $variable;');
+      Indent indent, String apiName, Method func, String channel,
+      {String? zeroCopyTaskQueue}) {
+    void unpackArgs(String Function(int index) valueGetterAt) {
       int count = 0;
       for (final NamedType arg in func.parameters) {
         final String argName = _getSafeArgName(count, arg);
-        final String valueGetter = 'GetNullableObjectAtIndex(args, $count)';
+        final String valueGetter = valueGetterAt(count);
         final String? primitiveExtractionMethod =
             _nsnumberExtractionMethod(arg.type);
         final _ObjcType objcArgType = _objcTypeForDartType(
@@ -847,9 +1163,24 @@ static FlutterError *createConnectionError(NSString *channelName) {
     final String selector = _getSelector(func, lastSelectorComponent);
     indent.writeln(
         'NSCAssert([api respondsToSelector:@selector($selector)], @"$apiName api (%@) doesn\'t respond to @selector($selector)", api);');
-    indent.write(
-        '[$channel setMessageHandler:^(id _Nullable message, FlutterReply callback) ');
-    indent.addScoped('{', '}];', () {
+    if (func.objcZeroCopy) {
+      indent.write(
+          '[binaryMessenger setMessageHandlerOnChannel:$channel binaryMessageHandler:^(NSData *_Nullable message, FlutterBinaryReply reply) ');
+    } else {
+      indent.write(
+          '[$channel setMessageHandler:^(id _Nullable message, FlutterReply callback) ');
+    }
+    final String handlerEnd = zeroCopyTaskQueue == null
+        ? '}];'
+        : '} taskQueue:$zeroCopyTaskQueue];';
+    indent.addScoped('{', handlerEnd, () {
+      if (func.objcZeroCopy) {
+        indent.writeScoped(
+            'FlutterReply callback = ^(id _Nullable response) {', '};', () {
+          indent.writeln(
+              'reply([${_getCodecGetterName(null, apiName)}() encode:response]);');
+        });
+      }
       final _ObjcType returnType = _objcTypeForDartType(
         generatorOptions.prefix, func.returnType,
         // Nullability is required since the return must be nil if NSError is set.
@@ -864,8 +1195,13 @@ static FlutterError *createConnectionError(NSString *channelName) {
               (String selectorComponent, String argName) {
         return '$selectorComponent:$argName';
       }).join(' ');
-      if (func.parameters.isNotEmpty) {
-        unpackArgs('message');
+      if (func.parameters.isNotEmpty && func.objcZeroCopy) {
+        indent.writeln('NSUInteger position = 0;');
+        indent.writeln('ZeroCopyReadArgumentListHeader(message, &position);');
+        unpackArgs((_) => 'ZeroCopyReadValue(message, &position)');
+      } else if (func.parameters.isNotEmpty) {
+        indent.writeln('NSArray *args = message;');
+        unpackArgs((int index) => 'GetNullableObjectAtIndex(args, $index)');
       }
       if (func.isAsynchronous) {
         writeAsyncBindings(selectorComponents, callSignature, returnType);
@@ -918,6 +1254,10 @@ static FlutterError *createConnectionError(NSString *channelName) {
     indent
         .writeln('+ (nullable $className *)nullableFromList:(NSArray *)list;');
     indent.writeln('- (NSArray *)toList;');
+    indent.writeln(
+        '+ (nullable $className *)nullableFromCodecReader:(FlutterStandardReader *)reader;');
+    indent
+        .writeln('- (void)writeToCodecWriter:(FlutterStandardWriter *)writer;');
     indent.writeln('@end');
   }
 
@@ -978,7 +1318,7 @@ static FlutterError *createConnectionError(NSString *channelName) {
           indent.writeln('case ${customClass.enumeration}: ');
           indent.nest(1, () {
             indent.writeln(
-                'return [${_className(options.prefix, customClass.name)} fromList:[self readValue]];');
+                'return [${_className(options.prefix, customClass.name)} nullableFromCodecReader:self];');
           });
         }
         indent.writeln('default:');
@@ -1004,7 +1344,7 @@ static FlutterError *createConnectionError(NSString *channelName) {
             'if ([value isKindOfClass:[${_className(options.prefix, customClass.name)} class]]) ');
         indent.addScoped('{', '} else ', () {
           indent.writeln('[self writeByte:${customClass.enumeration}];');
-          indent.writeln('[self writeValue:[value toList]];');
+          indent.writeln('[value writeToCodecWriter:self];');
         }, addTrailingNewline: false);
       }
       indent.addScoped('{', '}', () {
@@ -1267,6 +1607,13 @@ const Map<String, _ObjcType> _objcTypeForNonNullableDartTypeMap =
   'Object': _ObjcType(baseName: 'id'),
 };
 
+/// Returns true if any host API method in [root] uses `@ObjCZeroCopy`.
+bool _hasZeroCopyMethods(Root root) {
+  return root.apis.any((Api api) =>
+      api.location == ApiLocation.host &&
+      api.methods.any((Method method) => method.objcZeroCopy));
+}
+
 bool _usesPrimitive(TypeDeclaration type) {
   // Only non-nullable types are unboxed.
   if (!type.isNullable) {
@@ -1294,6 +1641,20 @@ String _collectionSafeExpression(
 
 /// Returns the method to convert [type] from a boxed NSNumber to its
 /// corresponding primitive value, if any.
+/// Returns the name used in the codec helper functions for the primitive
+/// [type] of a data class field, if it is read and written without boxing.
+String? _codecPrimitiveName(TypeDeclaration type) {
+  switch (_nsnumberExtractionMethod(type)) {
+    case 'integerValue':
+      return 'Integer';
+    case 'doubleValue':
+      return 'Double';
+    case 'boolValue':
+      return 'Bool';
+  }
+  return null;
+}
+
 String? _nsnumberExtractionMethod(
   TypeDeclaration type,
 ) {
@@ -6,6 +6,7 @@ export 'dart:typed_data' show Float64List, Int32List, Int64List, Uint8List;
 
 export 'cpp_generator.dart' show CppOptions;
 export 'dart_generator.dart' show DartOptions;
+export 'gobject_generator.dart' show GObjectOptions;
 export 'java_generator.dart' show JavaOptions;
 export 'kotlin_generator.dart' show KotlinOptions;
 export 'objc_generator.dart' show ObjcOptions;
@@ -30,6 +30,7 @@ import 'cpp_generator.dart';
 import 'dart_generator.dart';
 import 'generator_tools.dart';
 import 'generator_tools.dart' as generator_tools;
+import 'gobject_generator.dart';
 import 'java_generator.dart';
 import 'kotlin_generator.dart';
 import 'objc_generator.dart';
@@ -59,7 +60,7 @@ class ConfigurePigeon {
 /// generated host-platform interface.
 class HostApi {
   /// Parametric constructor for [HostApi].
-  const HostApi({this.dartHostTestHandler});
+  const HostApi({this.dartHostTestHandler, this.singleChannel = false});
 
   /// The name of an interface generated for tests. Implement this
   /// interface and invoke `[name of this handler].setup` to receive
@@ -75,6 +76,16 @@ class HostApi {
   ///
   /// Defaults to `null` in which case no handler will be generated.
   final String? dartHostTestHandler;
+
+  /// Whether all methods of this API are sent on one channel, with the index
+  /// of the method at the start of each message, instead of one channel per
+  /// method.
+  ///
+  /// This reduces the number of channels the host registers. It is currently
+  /// only supported by the Dart and C++ generators.
+  ///
+  /// Defaults to `false`.
+  final bool singleChannel;
 }
 
 /// Metadata to annotate a Pigeon API implemented by Flutter.
@@ -88,6 +99,50 @@ class FlutterApi {
   const FlutterApi();
 }
 
+/// Metadata to annotate a Pigeon API implemented by Flutter, whose calls from
+/// C++ are batched.
+///
+/// This is like [FlutterApi], but the generated C++ class buffers calls and
+/// sends them to Flutter together in one message, when `Flush` is called or
+/// when the buffer is full. Methods must return `void`, since batched calls
+/// don't get replies. Other generators treat it like [FlutterApi].
+class BatchedFlutterApi {
+  /// Parametric constructor for [BatchedFlutterApi].
+  const BatchedFlutterApi();
+}
+
+/// Metadata to annotate a Pigeon API whose methods are streams of events sent
+/// from the host to Flutter.
+///
+/// Each method takes no arguments, and its return type is the type of its
+/// events. The generated Dart method returns a `Stream` of them, received on an
+/// `EventChannel`. Flutter grants the host credit for the events it can
+/// receive, and the generated C++ class queues the events it has no credit for
+/// in a bounded queue, dropping events when the queue is full.
+///
+/// This is currently only supported by the Dart and C++ generators.
+class StreamApi {
+  /// Parametric constructor for [StreamApi].
+  const StreamApi();
+}
+
+/// Metadata to annotate a Pigeon API implemented by the host, whose methods
+/// are called from Dart through `dart:ffi` instead of a channel.
+///
+/// The generated C++ code exports an `extern "C"` function for each method,
+/// and the generated Dart class calls it synchronously, on the thread of the
+/// calling isolate, so the C++ methods must be thread-safe. Methods must be
+/// synchronous, and can only take and return non-nullable `bool`, `int`,
+/// `double` and `String` values, and data classes whose fields are all
+/// non-nullable `bool`, `int` or `double` values, which are passed as plain
+/// structs. The generated Dart code depends on `package:ffi`.
+///
+/// This is currently only supported by the Dart and C++ generators.
+class FfiHostApi {
+  /// Parametric constructor for [FfiHostApi].
+  const FfiHostApi();
+}
+
 /// Metadata to annotation methods to control the selector used for objc output.
 /// The number of components in the provided selector must match the number of
 /// arguments in the annotated method.
@@ -142,6 +197,42 @@ class TaskQueue {
   final TaskQueueType type;
 }
 
+/// Metadata annotation to pass typed data and `String` arguments of a HostApi
+/// method to the C++ implementation as views into the message buffer, rather
+/// than copying them into `std::vector`s and `std::string`s.
+///
+/// Data class arguments are decoded directly from the message and passed by
+/// rvalue reference, or as a non-const pointer if nullable, so that the
+/// implementation can take ownership of them without copying.
+///
+/// The views are only valid until the method returns, so this can't be used
+/// with `@async` methods.
+/// For example:
+///   @CppZeroCopy() void processFrame(Uint8List bytes, int width, int height);
+///   @CppZeroCopy() void log(String tag, String message);
+class CppZeroCopy {
+  /// Constructor.
+  const CppZeroCopy();
+}
+
+/// Metadata annotation to pass typed data arguments of a HostApi method to the
+/// Objective-C implementation as views of the incoming message, rather than
+/// copying them out of it.
+///
+/// Each `FlutterStandardTypedData` argument keeps the message alive for as
+/// long as it is retained. The other parameters must be `String`, `bool`,
+/// `int` or `double`.
+///
+/// Replies need no annotation: a `FlutterStandardTypedData` that wraps native
+/// memory with `-[NSData initWithBytesNoCopy:length:deallocator:]` is encoded
+/// straight from that memory, and released once the reply is encoded.
+/// For example:
+///   @ObjCZeroCopy() void processFrame(Uint8List bytes, int width, int height);
+class ObjCZeroCopy {
+  /// Constructor.
+  const ObjCZeroCopy();
+}
+
 /// Represents an error as a result of parsing and generating code.
 class Error {
   /// Parametric constructor for Error.
@@ -185,6 +276,9 @@ class PigeonOptions {
     this.cppHeaderOut,
     this.cppSourceOut,
     this.cppOptions,
+    this.gobjectHeaderOut,
+    this.gobjectSourceOut,
+    this.gobjectOptions,
     this.dartOptions,
     this.copyrightHeader,
     this.oneLanguage,
@@ -239,6 +333,15 @@ class PigeonOptions {
   /// Options that control how C++ will be generated.
   final CppOptions? cppOptions;
 
+  /// Path to the ".h" GObject file that will be generated.
+  final String? gobjectHeaderOut;
+
+  /// Path to the ".cc" GObject file that will be generated.
+  final String? gobjectSourceOut;
+
+  /// Options that control how GObject code will be generated.
+  final GObjectOptions? gobjectOptions;
+
   /// Options that control how Dart will be generated.
   final DartOptions? dartOptions;
 
@@ -289,6 +392,12 @@ class PigeonOptions {
       cppOptions: map.containsKey('cppOptions')
           ? CppOptions.fromMap(map['cppOptions']! as Map<String, Object>)
           : null,
+      gobjectHeaderOut: map['gobjectHeaderOut'] as String?,
+      gobjectSourceOut: map['gobjectSourceOut'] as String?,
+      gobjectOptions: map.containsKey('gobjectOptions')
+          ? GObjectOptions.fromMap(
+              map['gobjectOptions']! as Map<String, Object>)
+          : null,
       dartOptions: map.containsKey('dartOptions')
           ? DartOptions.fromMap(map['dartOptions']! as Map<String, Object>)
           : null,
@@ -320,6 +429,9 @@ class PigeonOptions {
       if (cppHeaderOut != null) 'cppHeaderOut': cppHeaderOut!,
       if (cppSourceOut != null) 'cppSourceOut': cppSourceOut!,
       if (cppOptions != null) 'cppOptions': cppOptions!.toMap(),
+      if (gobjectHeaderOut != null) 'gobjectHeaderOut': gobjectHeaderOut!,
+      if (gobjectSourceOut != null) 'gobjectSourceOut': gobjectSourceOut!,
+      if (gobjectOptions != null) 'gobjectOptions': gobjectOptions!.toMap(),
       if (dartOptions != null) 'dartOptions': dartOptions!.toMap(),
       if (copyrightHeader != null) 'copyrightHeader': copyrightHeader!,
       if (astOut != null) 'astOut': astOut!,
@@ -579,7 +691,8 @@ class ObjcGeneratorAdapter implements GeneratorAdapter {
   }
 
   @override
-  List<Error> validate(PigeonOptions options, Root root) => <Error>[];
+  List<Error> validate(PigeonOptions options, Root root) =>
+      _validateDartAndCppOnlyApis(root, 'Objective-C');
 }
 
 /// A [GeneratorAdapter] that generates Java source code.
@@ -616,7 +729,8 @@ class JavaGeneratorAdapter implements GeneratorAdapter {
       _openSink(options.javaOut, basePath: options.basePath ?? '');
 
   @override
-  List<Error> validate(PigeonOptions options, Root root) => <Error>[];
+  List<Error> validate(PigeonOptions options, Root root) =>
+      _validateDartAndCppOnlyApis(root, 'Java');
 }
 
 /// A [GeneratorAdapter] that generates Swift source code.
@@ -651,7 +765,8 @@ class SwiftGeneratorAdapter implements GeneratorAdapter {
       _openSink(options.swiftOut, basePath: options.basePath ?? '');
 
   @override
-  List<Error> validate(PigeonOptions options, Root root) => <Error>[];
+  List<Error> validate(PigeonOptions options, Root root) =>
+      _validateDartAndCppOnlyApis(root, 'Swift');
 }
 
 /// A [GeneratorAdapter] that generates C++ source code.
@@ -698,6 +813,76 @@ class CppGeneratorAdapter implements GeneratorAdapter {
   List<Error> validate(PigeonOptions options, Root root) => <Error>[];
 }
 
+/// A [GeneratorAdapter] that generates GObject source code for Linux.
+class GObjectGeneratorAdapter implements GeneratorAdapter {
+  /// Constructor for [GObjectGeneratorAdapter].
+  GObjectGeneratorAdapter(
+      {this.fileTypeList = const <FileType>[FileType.header, FileType.source]});
+
+  @override
+  List<FileType> fileTypeList;
+
+  @override
+  void generate(
+      StringSink sink, PigeonOptions options, Root root, FileType fileType) {
+    final GObjectOptions gobjectOptions =
+        options.gobjectOptions ?? const GObjectOptions();
+    final GObjectOptions gobjectOptionsWithHeader =
+        gobjectOptions.merge(GObjectOptions(
+      copyrightHeader: options.copyrightHeader != null
+          ? _lineReader(
+              path.posix.join(options.basePath ?? '', options.copyrightHeader))
+          : null,
+    ));
+    final OutputFileOptions<GObjectOptions> outputFileOptions =
+        OutputFileOptions<GObjectOptions>(
+            fileType: fileType, languageOptions: gobjectOptionsWithHeader);
+    const GObjectGenerator generator = GObjectGenerator();
+    generator.generate(
+      outputFileOptions,
+      root,
+      sink,
+      dartPackageName: options.getPackageName(),
+    );
+  }
+
+  @override
+  IOSink? shouldGenerate(PigeonOptions options, FileType fileType) {
+    if (fileType == FileType.source) {
+      return _openSink(options.gobjectSourceOut,
+          basePath: options.basePath ?? '');
+    } else {
+      return _openSink(options.gobjectHeaderOut,
+          basePath: options.basePath ?? '');
+    }
+  }
+
+  @override
+  List<Error> validate(PigeonOptions options, Root root) => <Error>[
+        for (final Api api in root.apis)
+          if (api.location == ApiLocation.flutter && api.methods.isNotEmpty)
+            Error(
+              message:
+                  'FlutterApi is not supported by the GObject generator, in API: "${api.name}"',
+            )
+          else if (api.isStream)
+            Error(
+              message:
+                  'StreamApi is not supported by the GObject generator, in API: "${api.name}"',
+            )
+          else if (api.isFfi)
+            Error(
+              message:
+                  'FfiHostApi is not supported by the GObject generator, in API: "${api.name}"',
+            )
+          else if (api.isBatched)
+            Error(
+              message:
+                  'Batched APIs are not supported by the GObject generator, in API: "${api.name}"',
+            ),
+      ];
+}
+
 /// A [GeneratorAdapter] that generates Kotlin source code.
 class KotlinGeneratorAdapter implements GeneratorAdapter {
   /// Constructor for [KotlinGeneratorAdapter].
@@ -732,7 +917,31 @@ class KotlinGeneratorAdapter implements GeneratorAdapter {
       _openSink(options.kotlinOut, basePath: options.basePath ?? '');
 
   @override
-  List<Error> validate(PigeonOptions options, Root root) => <Error>[];
+  List<Error> validate(PigeonOptions options, Root root) =>
+      _validateDartAndCppOnlyApis(root, 'Kotlin');
+}
+
+/// Returns an error for each API in [root] marked with `singleChannel`,
+/// `@StreamApi` or `@FfiHostApi`, for generators that don't support them.
+List<Error> _validateDartAndCppOnlyApis(Root root, String generatorName) {
+  return <Error>[
+    for (final Api api in root.apis)
+      if (api.singleChannel)
+        Error(
+          message:
+              'singleChannel is not supported by the $generatorName generator, in API: "${api.name}"',
+        )
+      else if (api.isStream)
+        Error(
+          message:
+              'StreamApi is not supported by the $generatorName generator, in API: "${api.name}"',
+        )
+      else if (api.isFfi)
+        Error(
+          message:
+              'FfiHostApi is not supported by the $generatorName generator, in API: "${api.name}"',
+        ),
+  ];
 }
 
 dart_ast.Annotation? _findMetadata(
@@ -788,6 +997,12 @@ List<Error> _validateAst(Root root, String source) {
     }
   }
   for (final Api api in root.apis) {
+    if (api.singleChannel && api.dartHostTestHandler != null) {
+      result.add(Error(
+        message:
+            'singleChannel can not be combined with dartHostTestHandler in API: "${api.name}"',
+      ));
+    }
     for (final Method method in api.methods) {
       for (final Parameter param in method.parameters) {
         if (param.type.baseName.isEmpty) {
@@ -838,12 +1053,147 @@ List<Error> _validateAst(Root root, String source) {
           lineNumber: _calculateLineNumberNullable(source, method.offset),
         ));
       }
+      if (api.isStream) {
+        if (method.parameters.isNotEmpty ||
+            method.returnType.isVoid ||
+            method.isAsynchronous) {
+          result.add(Error(
+            message:
+                'StreamApi methods must take no arguments and return their event type, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+        if (method.taskQueueType != TaskQueueType.serial ||
+            method.cppZeroCopy) {
+          result.add(Error(
+            message:
+                'StreamApi methods can not use TaskQueue or CppZeroCopy, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+      }
+      if (api.isFfi) {
+        if (method.isAsynchronous) {
+          result.add(Error(
+            message:
+                'FfiHostApi methods must be synchronous, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+        if (method.taskQueueType != TaskQueueType.serial ||
+            method.cppZeroCopy) {
+          result.add(Error(
+            message:
+                'FfiHostApi methods can not use TaskQueue or CppZeroCopy, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+        for (final TypeDeclaration type in <TypeDeclaration>[
+          if (!method.returnType.isVoid) method.returnType,
+          for (final Parameter param in method.parameters) param.type,
+        ]) {
+          if (!_isFfiType(root, type)) {
+            result.add(Error(
+              message:
+                  'Unsupported FfiHostApi datatype:"${type.baseName}${type.isNullable ? '?' : ''}", in method "${method.name}" in API: "${api.name}"',
+              lineNumber: _calculateLineNumberNullable(source, method.offset),
+            ));
+          }
+        }
+      }
+      if (api.isBatched && !method.returnType.isVoid) {
+        result.add(Error(
+          message:
+              'BatchedFlutterApi methods must return void, in method "${method.name}" in API: "${api.name}"',
+          lineNumber: _calculateLineNumberNullable(source, method.offset),
+        ));
+      }
+      if (method.cppZeroCopy) {
+        if (api.location != ApiLocation.host || method.isAsynchronous) {
+          result.add(Error(
+            message:
+                'CppZeroCopy is only supported on synchronous HostApi methods, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        } else if (!method.parameters.any((Parameter param) =>
+            typedDataTypes.contains(param.type.baseName) ||
+            param.type.baseName == 'String' ||
+            root.classes.any((Class c) => c.name == param.type.baseName))) {
+          result.add(Error(
+            message:
+                'CppZeroCopy requires a typed data, String or data class parameter, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+        if (method.taskQueueType != TaskQueueType.serial) {
+          result.add(Error(
+            message:
+                'CppZeroCopy can not be combined with a background TaskQueue, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+        if (api.singleChannel) {
+          result.add(Error(
+            message:
+                'CppZeroCopy is not supported in singleChannel APIs, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+      }
+      if (method.objcZeroCopy) {
+        if (api.location != ApiLocation.host) {
+          result.add(Error(
+            message:
+                'ObjCZeroCopy is only supported on HostApi methods, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        } else if (!method.parameters.any((Parameter param) =>
+            typedDataTypes.contains(param.type.baseName))) {
+          result.add(Error(
+            message:
+                'ObjCZeroCopy requires a typed data parameter, in method "${method.name}" in API: "${api.name}"',
+            lineNumber: _calculateLineNumberNullable(source, method.offset),
+          ));
+        }
+        for (final Parameter param in method.parameters) {
+          if (!typedDataTypes.contains(param.type.baseName) &&
+              !_objcZeroCopyScalarTypes.contains(param.type.baseName)) {
+            result.add(Error(
+              message:
+                  'Unsupported ObjCZeroCopy parameter type:"${param.type.baseName}", in method "${method.name}" in API: "${api.name}"',
+              lineNumber: _calculateLineNumberNullable(source, param.offset),
+            ));
+          }
+        }
+      }
     }
   }
 
   return result;
 }
 
+/// The types, besides typed data, that `@ObjCZeroCopy` methods can take.
+const List<String> _objcZeroCopyScalarTypes = <String>[
+  'String',
+  'bool',
+  'int',
+  'double',
+];
+
+/// Whether [type] can be passed through the `extern "C"` functions of a
+/// `@FfiHostApi`.
+bool _isFfiType(Root root, TypeDeclaration type) {
+  if (type.isNullable) {
+    return false;
+  }
+  if (ffiPrimitiveTypes.contains(type.baseName) || type.baseName == 'String') {
+    return true;
+  }
+  final Iterable<Class> classes =
+      root.classes.where((Class c) => c.name == type.baseName);
+  return classes.isNotEmpty && isFfiStruct(classes.first);
+}
+
 class _FindInitializer extends dart_ast_visitor.RecursiveAstVisitor<Object?> {
   dart_ast.Expression? initializer;
   @override
@@ -1051,6 +1401,7 @@ class _RootBuilder extends dart_ast_visitor.RecursiveAstVisitor<Object?> {
         final dart_ast.Annotation hostApi = node.metadata.firstWhere(
             (dart_ast.Annotation element) => element.name.name == 'HostApi');
         String? dartHostTestHandler;
+        bool singleChannel = false;
         if (hostApi.arguments != null) {
           for (final dart_ast.Expression expression
               in hostApi.arguments!.arguments) {
@@ -1062,6 +1413,12 @@ class _RootBuilder extends dart_ast_visitor.RecursiveAstVisitor<Object?> {
                     is dart_ast.SimpleStringLiteral) {
                   dartHostTestHandler = dartHostTestHandlerExpression.value;
                 }
+              } else if (expression.name.label.name == 'singleChannel') {
+                final dart_ast.Expression singleChannelExpression =
+                    expression.expression;
+                if (singleChannelExpression is dart_ast.BooleanLiteral) {
+                  singleChannel = singleChannelExpression.value;
+                }
               }
             }
           }
@@ -1071,14 +1428,35 @@ class _RootBuilder extends dart_ast_visitor.RecursiveAstVisitor<Object?> {
           location: ApiLocation.host,
           methods: <Method>[],
           dartHostTestHandler: dartHostTestHandler,
+          singleChannel: singleChannel,
           documentationComments:
               _documentationCommentsParser(node.documentationComment?.tokens),
         );
-      } else if (_hasMetadata(node.metadata, 'FlutterApi')) {
+      } else if (_hasMetadata(node.metadata, 'FlutterApi') ||
+          _hasMetadata(node.metadata, 'BatchedFlutterApi')) {
         _currentApi = Api(
           name: node.name.lexeme,
           location: ApiLocation.flutter,
           methods: <Method>[],
+          isBatched: _hasMetadata(node.metadata, 'BatchedFlutterApi'),
+          documentationComments:
+              _documentationCommentsParser(node.documentationComment?.tokens),
+        );
+      } else if (_hasMetadata(node.metadata, 'StreamApi')) {
+        _currentApi = Api(
+          name: node.name.lexeme,
+          location: ApiLocation.host,
+          methods: <Method>[],
+          isStream: true,
+          documentationComments:
+              _documentationCommentsParser(node.documentationComment?.tokens),
+        );
+      } else if (_hasMetadata(node.metadata, 'FfiHostApi')) {
+        _currentApi = Api(
+          name: node.name.lexeme,
+          location: ApiLocation.host,
+          methods: <Method>[],
+          isFfi: true,
           documentationComments:
               _documentationCommentsParser(node.documentationComment?.tokens),
         );
@@ -1189,6 +1567,8 @@ class _RootBuilder extends dart_ast_visitor.RecursiveAstVisitor<Object?> {
     final List<Parameter> arguments =
         parameters.parameters.map(formalParameterToPigeonParameter).toList();
     final bool isAsynchronous = _hasMetadata(node.metadata, 'async');
+    final bool cppZeroCopy = _hasMetadata(node.metadata, 'CppZeroCopy');
+    final bool objcZeroCopy = _hasMetadata(node.metadata, 'ObjCZeroCopy');
     final String objcSelector = _findMetadata(node.metadata, 'ObjCSelector')
             ?.arguments
             ?.arguments
@@ -1233,6 +1613,8 @@ class _RootBuilder extends dart_ast_visitor.RecursiveAstVisitor<Object?> {
           swiftFunction: swiftFunction,
           offset: node.offset,
           taskQueueType: taskQueueType,
+          cppZeroCopy: cppZeroCopy,
+          objcZeroCopy: objcZeroCopy,
           documentationComments:
               _documentationCommentsParser(node.documentationComment?.tokens),
         ),
@@ -1493,6 +1875,22 @@ ${_argParser.usage}''';
     )
     ..addOption('cpp_namespace',
         help: 'The namespace that generated C++ code will be in.')
+    ..addFlag('cpp_use_coroutines',
+        help:
+            'Makes asynchronous C++ host API methods return C++20 coroutine tasks.')
+    ..addFlag('cpp_lazy_decoding',
+        help:
+            'Decodes nested data classes in C++ on first access to the field.')
+    ..addFlag('cpp_typed_collections',
+        help:
+            'Stores typed List and Map fields of C++ data classes as std::vector and std::map.')
+    ..addOption('gobject_header_out',
+        help: 'Path to generated GObject header file (.h).')
+    ..addOption('gobject_source_out',
+        help: 'Path to generated GObject classes file (.cc).')
+    ..addOption('gobject_module',
+        help:
+            'The snake_case module name that prefixes generated GObject types and functions.')
     ..addOption('objc_header_out',
         help: 'Path to generated Objective-C header file (.h).')
     ..addOption('objc_prefix',
@@ -1546,6 +1944,14 @@ ${_argParser.usage}''';
       cppSourceOut: results['cpp_source_out'] as String?,
       cppOptions: CppOptions(
         namespace: results['cpp_namespace'] as String?,
+        useCoroutines: results['cpp_use_coroutines'] as bool?,
+        lazyDecoding: results['cpp_lazy_decoding'] as bool?,
+        typedCollections: results['cpp_typed_collections'] as bool?,
+      ),
+      gobjectHeaderOut: results['gobject_header_out'] as String?,
+      gobjectSourceOut: results['gobject_source_out'] as String?,
+      gobjectOptions: GObjectOptions(
+        module: results['gobject_module'] as String?,
       ),
       copyrightHeader: results['copyright_header'] as String?,
       oneLanguage: results['one_language'] as bool?,
@@ -1603,6 +2009,7 @@ ${_argParser.usage}''';
           SwiftGeneratorAdapter(),
           KotlinGeneratorAdapter(),
           CppGeneratorAdapter(),
+          GObjectGeneratorAdapter(),
           DartTestGeneratorAdapter(),
           ObjcGeneratorAdapter(),
           AstGeneratorAdapter(),
@@ -1671,6 +2078,14 @@ ${_argParser.usage}''';
                   headerIncludePath: path.basename(options.cppHeaderOut!)))));
     }
 
+    if (options.gobjectHeaderOut != null) {
+      options = options.merge(PigeonOptions(
+          gobjectOptions: (options.gobjectOptions ?? const GObjectOptions())
+              .merge(GObjectOptions(
+                  headerIncludePath:
+                      path.basename(options.gobjectHeaderOut!)))));
+    }
+
     for (final GeneratorAdapter adapter in safeGeneratorAdapters) {
       for (final FileType fileType in adapter.fileTypeList) {
         final IOSink? sink = adapter.shouldGenerate(options, fileType);
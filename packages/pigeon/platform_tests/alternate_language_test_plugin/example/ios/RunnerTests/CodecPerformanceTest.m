@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import Flutter;
+@import XCTest;
+
+@import alternate_language_test_plugin;
+
+#import "EchoMessenger.h"
+
+/// Number of round trips made in each measured block.
+static const NSInteger kRoundTripsPerMeasurement = 1000;
+
+/// Returns an AllTypes with every collection populated, and a byte array of |byteArraySize| bytes.
+static AllTypes *CreateAllTypes(NSUInteger byteArraySize) {
+  NSMutableData *bytes = [NSMutableData dataWithLength:byteArraySize];
+  return [AllTypes
+      makeWithABool:YES
+              anInt:42
+            anInt64:1LL << 40
+            aDouble:3.14
+         aByteArray:[FlutterStandardTypedData typedDataWithBytes:bytes]
+        a4ByteArray:[FlutterStandardTypedData
+                        typedDataWithInt32:[NSMutableData dataWithLength:4 * sizeof(int32_t)]]
+        a8ByteArray:[FlutterStandardTypedData
+                        typedDataWithInt64:[NSMutableData dataWithLength:4 * sizeof(int64_t)]]
+        aFloatArray:[FlutterStandardTypedData
+                        typedDataWithFloat64:[NSMutableData dataWithLength:4 * sizeof(double)]]
+              aList:@[ @(1), @"two", @(3.0) ]
+               aMap:@{@"one" : @(1), @"two" : @(2)}
+             anEnum:AnEnumTwo
+            aString:@"a string"
+           anObject:@"an object"];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+/// Measures the cost of round trips through the generated codec.
+///
+/// Each call is encoded, decoded, echoed and decoded again by EchoBinaryMessenger, so dividing the
+/// reported time by the number of calls in the block gives the cost of one round trip.
+@interface CodecPerformanceTest : XCTestCase
+@end
+
+///////////////////////////////////////////////////////////////////////////////////////////
+@implementation CodecPerformanceTest
+
+- (FlutterIntegrationCoreApi *)createApi {
+  EchoBinaryMessenger *binaryMessenger =
+      [[EchoBinaryMessenger alloc] initWithCodec:FlutterIntegrationCoreApiGetCodec()];
+  return [[FlutterIntegrationCoreApi alloc] initWithBinaryMessenger:binaryMessenger];
+}
+
+- (void)testAllTypesRoundTripPerformance {
+  FlutterIntegrationCoreApi *api = [self createApi];
+  AllTypes *everything = CreateAllTypes(16);
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < kRoundTripsPerMeasurement; i++) {
+      [api echoAllTypes:everything
+             completion:^(AllTypes *_Nullable result, FlutterError *_Nullable error) {
+               XCTAssertNotNil(result);
+             }];
+    }
+  }];
+}
+
+- (void)testAllNullableTypesRoundTripPerformance {
+  FlutterIntegrationCoreApi *api = [self createApi];
+  AllNullableTypes *everything = [[AllNullableTypes alloc] init];
+  everything.aNullableBool = @YES;
+  everything.aNullableInt = @(42);
+  everything.aNullableDouble = @(3.14);
+  everything.aNullableString = @"a string";
+  everything.aNullableByteArray =
+      [FlutterStandardTypedData typedDataWithBytes:[NSMutableData dataWithLength:1024]];
+  everything.aNullableList = @[ @(1), @"two" ];
+  everything.aNullableMap = @{@"one" : @(1)};
+  everything.aNullableEnum = [[AnEnumBox alloc] initWithValue:AnEnumThree];
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < kRoundTripsPerMeasurement; i++) {
+      [api echoAllNullableTypes:everything
+                     completion:^(AllNullableTypes *_Nullable result,
+                                  FlutterError *_Nullable error) {
+                       XCTAssertNotNil(result);
+                     }];
+    }
+  }];
+}
+
+- (void)testLargeUint8ListRoundTripPerformance {
+  FlutterIntegrationCoreApi *api = [self createApi];
+  FlutterStandardTypedData *data =
+      [FlutterStandardTypedData typedDataWithBytes:[NSMutableData dataWithLength:1024 * 1024]];
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < kRoundTripsPerMeasurement / 10; i++) {
+      [api echoUint8List:data
+              completion:^(FlutterStandardTypedData *_Nullable result,
+                           FlutterError *_Nullable error) {
+                XCTAssertEqual(result.data.length, data.data.length);
+              }];
+    }
+  }];
+}
+
+@end
@@ -40,6 +40,55 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
   return (result == [NSNull null]) ? nil : result;
 }
 
+static void WriteInteger(FlutterStandardWriter *writer, NSInteger value) {
+  int64_t int64Value = value;
+  [writer writeByte:4];
+  [writer writeBytes:&int64Value length:sizeof(int64Value)];
+}
+
+static NSInteger ReadInteger(FlutterStandardReader *reader) {
+  UInt8 type = [reader readByte];
+  if (type == 3) {
+    int32_t value;
+    [reader readBytes:&value length:sizeof(value)];
+    return value;
+  } else if (type == 4) {
+    int64_t value;
+    [reader readBytes:&value length:sizeof(value)];
+    return (NSInteger)value;
+  }
+  return [[reader readValueOfType:type] integerValue];
+}
+
+static void WriteDouble(FlutterStandardWriter *writer, double value) {
+  [writer writeByte:6];
+  [writer writeAlignment:8];
+  [writer writeBytes:&value length:sizeof(value)];
+}
+
+static double ReadDouble(FlutterStandardReader *reader) {
+  UInt8 type = [reader readByte];
+  if (type == 6) {
+    double value;
+    [reader readAlignment:8];
+    [reader readBytes:&value length:sizeof(value)];
+    return value;
+  }
+  return [[reader readValueOfType:type] doubleValue];
+}
+
+static void WriteBool(FlutterStandardWriter *writer, BOOL value) {
+  [writer writeByte:value ? 1 : 2];
+}
+
+static BOOL ReadBool(FlutterStandardReader *reader) {
+  UInt8 type = [reader readByte];
+  if (type == 1 || type == 2) {
+    return type == 1;
+  }
+  return [[reader readValueOfType:type] boolValue];
+}
+
 @implementation AnEnumBox
 - (instancetype)initWithValue:(AnEnum)value {
   self = [super init];
@@ -54,24 +103,32 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (AllTypes *)fromList:(NSArray *)list;
 + (nullable AllTypes *)nullableFromList:(NSArray *)list;
 - (NSArray *)toList;
++ (nullable AllTypes *)nullableFromCodecReader:(FlutterStandardReader *)reader;
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer;
 @end
 
 @interface AllNullableTypes ()
 + (AllNullableTypes *)fromList:(NSArray *)list;
 + (nullable AllNullableTypes *)nullableFromList:(NSArray *)list;
 - (NSArray *)toList;
++ (nullable AllNullableTypes *)nullableFromCodecReader:(FlutterStandardReader *)reader;
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer;
 @end
 
 @interface AllClassesWrapper ()
 + (AllClassesWrapper *)fromList:(NSArray *)list;
 + (nullable AllClassesWrapper *)nullableFromList:(NSArray *)list;
 - (NSArray *)toList;
++ (nullable AllClassesWrapper *)nullableFromCodecReader:(FlutterStandardReader *)reader;
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer;
 @end
 
 @interface TestMessage ()
 + (TestMessage *)fromList:(NSArray *)list;
 + (nullable TestMessage *)nullableFromList:(NSArray *)list;
 - (NSArray *)toList;
++ (nullable TestMessage *)nullableFromCodecReader:(FlutterStandardReader *)reader;
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer;
 @end
 
 @implementation AllTypes
@@ -124,6 +181,28 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (nullable AllTypes *)nullableFromList:(NSArray *)list {
   return (list) ? [AllTypes fromList:list] : nil;
 }
++ (nullable AllTypes *)nullableFromCodecReader:(FlutterStandardReader *)reader {
+  UInt8 type = [reader readByte];
+  if (type != 12) {
+    return [AllTypes nullableFromList:[reader readValueOfType:type]];
+  }
+  [reader readSize];
+  AllTypes *pigeonResult = [[AllTypes alloc] init];
+  pigeonResult.aBool = ReadBool(reader);
+  pigeonResult.anInt = ReadInteger(reader);
+  pigeonResult.anInt64 = ReadInteger(reader);
+  pigeonResult.aDouble = ReadDouble(reader);
+  pigeonResult.aByteArray = [reader readValue];
+  pigeonResult.a4ByteArray = [reader readValue];
+  pigeonResult.a8ByteArray = [reader readValue];
+  pigeonResult.aFloatArray = [reader readValue];
+  pigeonResult.aList = [reader readValue];
+  pigeonResult.aMap = [reader readValue];
+  pigeonResult.anEnum = ReadInteger(reader);
+  pigeonResult.aString = [reader readValue];
+  pigeonResult.anObject = [reader readValue];
+  return pigeonResult;
+}
 - (NSArray *)toList {
   return @[
     @(self.aBool),
@@ -141,6 +220,23 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     self.anObject ?: [NSNull null],
   ];
 }
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer {
+  [writer writeByte:12];
+  [writer writeSize:13];
+  WriteBool(writer, self.aBool);
+  WriteInteger(writer, self.anInt);
+  WriteInteger(writer, self.anInt64);
+  WriteDouble(writer, self.aDouble);
+  [writer writeValue:self.aByteArray];
+  [writer writeValue:self.a4ByteArray];
+  [writer writeValue:self.a8ByteArray];
+  [writer writeValue:self.aFloatArray];
+  [writer writeValue:self.aList];
+  [writer writeValue:self.aMap];
+  WriteInteger(writer, self.anEnum);
+  [writer writeValue:self.aString];
+  [writer writeValue:self.anObject];
+}
 @end
 
 @implementation AllNullableTypes
@@ -208,6 +304,36 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (nullable AllNullableTypes *)nullableFromList:(NSArray *)list {
   return (list) ? [AllNullableTypes fromList:list] : nil;
 }
++ (nullable AllNullableTypes *)nullableFromCodecReader:(FlutterStandardReader *)reader {
+  UInt8 type = [reader readByte];
+  if (type != 12) {
+    return [AllNullableTypes nullableFromList:[reader readValueOfType:type]];
+  }
+  [reader readSize];
+  AllNullableTypes *pigeonResult = [[AllNullableTypes alloc] init];
+  pigeonResult.aNullableBool = [reader readValue];
+  pigeonResult.aNullableInt = [reader readValue];
+  pigeonResult.aNullableInt64 = [reader readValue];
+  pigeonResult.aNullableDouble = [reader readValue];
+  pigeonResult.aNullableByteArray = [reader readValue];
+  pigeonResult.aNullable4ByteArray = [reader readValue];
+  pigeonResult.aNullable8ByteArray = [reader readValue];
+  pigeonResult.aNullableFloatArray = [reader readValue];
+  pigeonResult.aNullableList = [reader readValue];
+  pigeonResult.aNullableMap = [reader readValue];
+  pigeonResult.nullableNestedList = [reader readValue];
+  pigeonResult.nullableMapWithAnnotations = [reader readValue];
+  pigeonResult.nullableMapWithObject = [reader readValue];
+  NSNumber *aNullableEnumAsNumber = [reader readValue];
+  AnEnumBox *aNullableEnum =
+      aNullableEnumAsNumber == nil
+          ? nil
+          : [[AnEnumBox alloc] initWithValue:[aNullableEnumAsNumber integerValue]];
+  pigeonResult.aNullableEnum = aNullableEnum;
+  pigeonResult.aNullableString = [reader readValue];
+  pigeonResult.aNullableObject = [reader readValue];
+  return pigeonResult;
+}
 - (NSArray *)toList {
   return @[
     self.aNullableBool ?: [NSNull null],
@@ -229,6 +355,30 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
     self.aNullableObject ?: [NSNull null],
   ];
 }
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer {
+  [writer writeByte:12];
+  [writer writeSize:16];
+  [writer writeValue:self.aNullableBool];
+  [writer writeValue:self.aNullableInt];
+  [writer writeValue:self.aNullableInt64];
+  [writer writeValue:self.aNullableDouble];
+  [writer writeValue:self.aNullableByteArray];
+  [writer writeValue:self.aNullable4ByteArray];
+  [writer writeValue:self.aNullable8ByteArray];
+  [writer writeValue:self.aNullableFloatArray];
+  [writer writeValue:self.aNullableList];
+  [writer writeValue:self.aNullableMap];
+  [writer writeValue:self.nullableNestedList];
+  [writer writeValue:self.nullableMapWithAnnotations];
+  [writer writeValue:self.nullableMapWithObject];
+  if (self.aNullableEnum) {
+    WriteInteger(writer, self.aNullableEnum.value);
+  } else {
+    [writer writeValue:[NSNull null]];
+  }
+  [writer writeValue:self.aNullableString];
+  [writer writeValue:self.aNullableObject];
+}
 @end
 
 @implementation AllClassesWrapper
@@ -249,12 +399,37 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (nullable AllClassesWrapper *)nullableFromList:(NSArray *)list {
   return (list) ? [AllClassesWrapper fromList:list] : nil;
 }
++ (nullable AllClassesWrapper *)nullableFromCodecReader:(FlutterStandardReader *)reader {
+  UInt8 type = [reader readByte];
+  if (type != 12) {
+    return [AllClassesWrapper nullableFromList:[reader readValueOfType:type]];
+  }
+  [reader readSize];
+  AllClassesWrapper *pigeonResult = [[AllClassesWrapper alloc] init];
+  pigeonResult.allNullableTypes = [AllNullableTypes nullableFromCodecReader:reader];
+  pigeonResult.allTypes = [AllTypes nullableFromCodecReader:reader];
+  return pigeonResult;
+}
 - (NSArray *)toList {
   return @[
     (self.allNullableTypes ? [self.allNullableTypes toList] : [NSNull null]),
     (self.allTypes ? [self.allTypes toList] : [NSNull null]),
   ];
 }
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer {
+  [writer writeByte:12];
+  [writer writeSize:2];
+  if (self.allNullableTypes) {
+    [self.allNullableTypes writeToCodecWriter:writer];
+  } else {
+    [writer writeValue:[NSNull null]];
+  }
+  if (self.allTypes) {
+    [self.allTypes writeToCodecWriter:writer];
+  } else {
+    [writer writeValue:[NSNull null]];
+  }
+}
 @end
 
 @implementation TestMessage
@@ -271,11 +446,26 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 + (nullable TestMessage *)nullableFromList:(NSArray *)list {
   return (list) ? [TestMessage fromList:list] : nil;
 }
++ (nullable TestMessage *)nullableFromCodecReader:(FlutterStandardReader *)reader {
+  UInt8 type = [reader readByte];
+  if (type != 12) {
+    return [TestMessage nullableFromList:[reader readValueOfType:type]];
+  }
+  [reader readSize];
+  TestMessage *pigeonResult = [[TestMessage alloc] init];
+  pigeonResult.testList = [reader readValue];
+  return pigeonResult;
+}
 - (NSArray *)toList {
   return @[
     self.testList ?: [NSNull null],
   ];
 }
+- (void)writeToCodecWriter:(FlutterStandardWriter *)writer {
+  [writer writeByte:12];
+  [writer writeSize:1];
+  [writer writeValue:self.testList];
+}
 @end
 
 @interface HostIntegrationCoreApiCodecReader : FlutterStandardReader
@@ -284,13 +474,13 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (nullable id)readValueOfType:(UInt8)type {
   switch (type) {
     case 128:
-      return [AllClassesWrapper fromList:[self readValue]];
+      return [AllClassesWrapper nullableFromCodecReader:self];
     case 129:
-      return [AllNullableTypes fromList:[self readValue]];
+      return [AllNullableTypes nullableFromCodecReader:self];
     case 130:
-      return [AllTypes fromList:[self readValue]];
+      return [AllTypes nullableFromCodecReader:self];
     case 131:
-      return [TestMessage fromList:[self readValue]];
+      return [TestMessage nullableFromCodecReader:self];
     default:
       return [super readValueOfType:type];
   }
@@ -303,16 +493,16 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (void)writeValue:(id)value {
   if ([value isKindOfClass:[AllClassesWrapper class]]) {
     [self writeByte:128];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else if ([value isKindOfClass:[AllNullableTypes class]]) {
     [self writeByte:129];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else if ([value isKindOfClass:[AllTypes class]]) {
     [self writeByte:130];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else if ([value isKindOfClass:[TestMessage class]]) {
     [self writeByte:131];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else {
     [super writeValue:value];
   }
@@ -2211,13 +2401,13 @@ void SetUpHostIntegrationCoreApi(id<FlutterBinaryMessenger> binaryMessenger,
 - (nullable id)readValueOfType:(UInt8)type {
   switch (type) {
     case 128:
-      return [AllClassesWrapper fromList:[self readValue]];
+      return [AllClassesWrapper nullableFromCodecReader:self];
     case 129:
-      return [AllNullableTypes fromList:[self readValue]];
+      return [AllNullableTypes nullableFromCodecReader:self];
     case 130:
-      return [AllTypes fromList:[self readValue]];
+      return [AllTypes nullableFromCodecReader:self];
     case 131:
-      return [TestMessage fromList:[self readValue]];
+      return [TestMessage nullableFromCodecReader:self];
     default:
       return [super readValueOfType:type];
   }
@@ -2230,16 +2420,16 @@ void SetUpHostIntegrationCoreApi(id<FlutterBinaryMessenger> binaryMessenger,
 - (void)writeValue:(id)value {
   if ([value isKindOfClass:[AllClassesWrapper class]]) {
     [self writeByte:128];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else if ([value isKindOfClass:[AllNullableTypes class]]) {
     [self writeByte:129];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else if ([value isKindOfClass:[AllTypes class]]) {
     [self writeByte:130];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else if ([value isKindOfClass:[TestMessage class]]) {
     [self writeByte:131];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else {
     [super writeValue:value];
   }
@@ -2954,7 +3144,7 @@ void SetUpHostSmallApi(id<FlutterBinaryMessenger> binaryMessenger, NSObject<Host
 - (nullable id)readValueOfType:(UInt8)type {
   switch (type) {
     case 128:
-      return [TestMessage fromList:[self readValue]];
+      return [TestMessage nullableFromCodecReader:self];
     default:
       return [super readValueOfType:type];
   }
@@ -2967,7 +3157,7 @@ void SetUpHostSmallApi(id<FlutterBinaryMessenger> binaryMessenger, NSObject<Host
 - (void)writeValue:(id)value {
   if ([value isKindOfClass:[TestMessage class]]) {
     [self writeByte:128];
-    [self writeValue:[value toList]];
+    [value writeToCodecWriter:self];
   } else {
     [super writeValue:value];
   }
@@ -0,0 +1,191 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <benchmark/benchmark.h>
+#include <flutter/encodable_value.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "pigeon/core_tests.gen.h"
+#include "test/utils/fake_host_messenger.h"
+#include "test_plugin.h"
+
+namespace {
+
+// Number of calls to the global operator new since the process started.
+std::atomic<uint64_t> g_allocation_count{0};
+
+}  // namespace
+
+// Replaces the global allocation functions so that the benchmarks can report
+// heap allocations per call. The array forms forward to these by default.
+void* operator new(size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+
+namespace core_tests_pigeontest {
+
+namespace {
+
+using flutter::CustomEncodableValue;
+using flutter::EncodableList;
+using flutter::EncodableMap;
+using flutter::EncodableValue;
+using test_plugin::TestPlugin;
+using testing::FakeHostMessenger;
+
+constexpr char kChannelPrefix[] =
+    "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi.";
+
+// Sizes of the byte arrays sent by the large payload benchmarks.
+constexpr size_t kByteArraySizes[] = {1024, 64 * 1024, 1024 * 1024,
+                                      8 * 1024 * 1024};
+
+// Returns an AllTypes with every collection populated, and a byte array of
+// |byte_array_size| bytes.
+AllTypes CreateAllTypes(size_t byte_array_size) {
+  return AllTypes(
+      true, 42, 1LL << 40, 3.14, std::vector<uint8_t>(byte_array_size, 0x80),
+      std::vector<int32_t>{1, 2, 3, 4}, std::vector<int64_t>{1, 2, 3, 4},
+      std::vector<double>{1.0, 2.0, 3.0, 4.0},
+      EncodableList{EncodableValue(1), EncodableValue("two"),
+                    EncodableValue(3.0)},
+      EncodableMap{{EncodableValue("one"), EncodableValue(1)},
+                   {EncodableValue("two"), EncodableValue(2)}},
+      AnEnum::two, "a string", EncodableValue("an object"));
+}
+
+// Returns an AllNullableTypes with every field set.
+AllNullableTypes CreateAllNullableTypes() {
+  AllNullableTypes everything;
+  everything.set_a_nullable_bool(true);
+  everything.set_a_nullable_int(int64_t{42});
+  everything.set_a_nullable_int64(int64_t{1} << 40);
+  everything.set_a_nullable_double(3.14);
+  everything.set_a_nullable_byte_array(std::vector<uint8_t>(1024, 0x80));
+  everything.set_a_nullable4_byte_array(std::vector<int32_t>{1, 2, 3, 4});
+  everything.set_a_nullable8_byte_array(std::vector<int64_t>{1, 2, 3, 4});
+  everything.set_a_nullable_float_array(std::vector<double>{1.0, 2.0});
+  everything.set_a_nullable_list(
+      EncodableList{EncodableValue(1), EncodableValue("two")});
+  everything.set_a_nullable_map(
+      EncodableMap{{EncodableValue("one"), EncodableValue(1)}});
+  everything.set_nullable_nested_list(
+      EncodableList{EncodableValue(EncodableList{EncodableValue(true)})});
+  everything.set_nullable_map_with_annotations(
+      EncodableMap{{EncodableValue("key"), EncodableValue("value")}});
+  everything.set_nullable_map_with_object(
+      EncodableMap{{EncodableValue("key"), EncodableValue(1)}});
+  everything.set_a_nullable_enum(AnEnum::three);
+  everything.set_a_nullable_string("a string");
+  everything.set_a_nullable_object(EncodableValue("an object"));
+  return everything;
+}
+
+// Calls the |HostIntegrationCoreApi| method |method| with |arguments| through
+// a FakeHostMessenger on every iteration.
+//
+// Reports round trips per second as items per second, heap allocations per
+// call, and the bytes encoded per call in both directions. The fake messenger
+// encodes the message and decodes the reply like the engine would, so its
+// work is included in every measurement.
+void BM_HostRoundTrip(benchmark::State& state, const std::string& method,
+                      const EncodableList& arguments) {
+  FakeHostMessenger messenger(&HostIntegrationCoreApi::GetCodec());
+  TestPlugin api(&messenger);
+  HostIntegrationCoreApi::SetUp(&messenger, &api);
+
+  const std::string channel = std::string(kChannelPrefix) + method;
+  const EncodableValue message(arguments);
+
+  // Checks the call succeeds, and measures the encoded size of both sides.
+  EncodableValue reply;
+  messenger.SendHostMessage(
+      channel, message,
+      [&reply](const EncodableValue& value) { reply = value; });
+  const auto* reply_list = std::get_if<EncodableList>(&reply);
+  if (!reply_list || reply_list->size() != 1) {
+    state.SkipWithError("Host API call failed");
+    return;
+  }
+  const flutter::MessageCodec<EncodableValue>& codec =
+      HostIntegrationCoreApi::GetCodec();
+  const int64_t bytes_per_call =
+      static_cast<int64_t>(codec.EncodeMessage(message)->size() +
+                           codec.EncodeMessage(reply)->size());
+
+  const uint64_t allocations_before =
+      g_allocation_count.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    bool replied = false;
+    messenger.SendHostMessage(channel, message,
+                              [&replied](const EncodableValue& value) {
+                                benchmark::DoNotOptimize(&value);
+                                replied = true;
+                              });
+    if (!replied) {
+      state.SkipWithError("Host API did not reply");
+      break;
+    }
+  }
+  const uint64_t allocations =
+      g_allocation_count.load(std::memory_order_relaxed) - allocations_before;
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          bytes_per_call);
+  state.counters["allocs_per_call"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  state.counters["bytes_per_call"] =
+      benchmark::Counter(static_cast<double>(bytes_per_call));
+}
+
+// Registers the round trip benchmarks for data classes and byte arrays.
+int RegisterHostRoundTripBenchmarks() {
+  benchmark::RegisterBenchmark(
+      "HostIntegrationCoreApi/echoAllTypes", BM_HostRoundTrip,
+      std::string("echoAllTypes"),
+      EncodableList{CustomEncodableValue(CreateAllTypes(16))});
+  benchmark::RegisterBenchmark(
+      "HostIntegrationCoreApi/echoAllNullableTypes/empty", BM_HostRoundTrip,
+      std::string("echoAllNullableTypes"),
+      EncodableList{CustomEncodableValue(AllNullableTypes())});
+  benchmark::RegisterBenchmark(
+      "HostIntegrationCoreApi/echoAllNullableTypes/full", BM_HostRoundTrip,
+      std::string("echoAllNullableTypes"),
+      EncodableList{CustomEncodableValue(CreateAllNullableTypes())});
+
+  for (size_t size : kByteArraySizes) {
+    const std::string suffix = "/" + std::to_string(size);
+    benchmark::RegisterBenchmark(
+        ("HostIntegrationCoreApi/echoUint8List" + suffix).c_str(),
+        BM_HostRoundTrip, std::string("echoUint8List"),
+        EncodableList{EncodableValue(std::vector<uint8_t>(size, 0x80))});
+    benchmark::RegisterBenchmark(
+        ("HostIntegrationCoreApi/echoAllTypes" + suffix).c_str(),
+        BM_HostRoundTrip, std::string("echoAllTypes"),
+        EncodableList{CustomEncodableValue(CreateAllTypes(size))});
+  }
+  return 0;
+}
+
+const int kHostRoundTripBenchmarksRegistered =
+    RegisterHostRoundTripBenchmarks();
+
+}  // namespace
+
+}  // namespace core_tests_pigeontest
@@ -14,9 +14,12 @@
 #include <flutter/encodable_value.h>
 #include <flutter/standard_message_codec.h>
 
+#include <cstring>
 #include <map>
 #include <optional>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace core_tests_pigeontest {
 using flutter::BasicMessageChannel;
@@ -25,36 +28,305 @@ using flutter::EncodableList;
 using flutter::EncodableMap;
 using flutter::EncodableValue;
 
-FlutterError CreateConnectionError(const std::string channel_name) {
+FlutterError CreateConnectionError(const std::string& channel_name) {
   return FlutterError(
       "channel-error",
       "Unable to establish connection on channel: '" + channel_name + "'.",
       EncodableValue(""));
 }
 
+namespace {
+// Writes |size| in the standard codec's variable length encoding.
+void WriteSize(size_t size, flutter::ByteStreamWriter* stream) {
+  if (size < 254) {
+    stream->WriteByte(static_cast<uint8_t>(size));
+  } else if (size <= 0xffff) {
+    stream->WriteByte(254);
+    const uint16_t value = static_cast<uint16_t>(size);
+    stream->WriteBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+  } else {
+    stream->WriteByte(255);
+    const uint32_t value = static_cast<uint32_t>(size);
+    stream->WriteBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+  }
+}
+
+// Writes the header of a list of |size| values.
+void WriteListHeader(size_t size, flutter::ByteStreamWriter* stream) {
+  stream->WriteByte(12);
+  WriteSize(size, stream);
+}
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteString(const std::string& value, flutter::ByteStreamWriter* stream) {
+  stream->WriteByte(7);
+  WriteSize(value.size(), stream);
+  if (!value.empty()) {
+    stream->WriteBytes(reinterpret_cast<const uint8_t*>(value.data()),
+                       value.size());
+  }
+}
+
+// Writes |value| as the standard codec writes an EncodableValue holding it,
+// with the codec type |type|.
+template <class T>
+void WriteTypedData(uint8_t type, const std::vector<T>& value,
+                    flutter::ByteStreamWriter* stream) {
+  stream->WriteByte(type);
+  WriteSize(value.size(), stream);
+  if (!value.empty()) {
+    stream->WriteAlignment(static_cast<uint8_t>(sizeof(T)));
+    stream->WriteBytes(reinterpret_cast<const uint8_t*>(value.data()),
+                       value.size() * sizeof(T));
+  }
+}
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteList(const EncodableList& value,
+               const flutter::StandardCodecSerializer& serializer,
+               flutter::ByteStreamWriter* stream) {
+  WriteListHeader(value.size(), stream);
+  for (const EncodableValue& element : value) {
+    serializer.WriteValue(element, stream);
+  }
+}
+
+// Writes |value| as the standard codec writes an EncodableValue holding it.
+void WriteMap(const EncodableMap& value,
+              const flutter::StandardCodecSerializer& serializer,
+              flutter::ByteStreamWriter* stream) {
+  stream->WriteByte(13);
+  WriteSize(value.size(), stream);
+  for (const auto& pair : value) {
+    serializer.WriteValue(pair.first, stream);
+    serializer.WriteValue(pair.second, stream);
+  }
+}
+}  // namespace
+
+namespace {
+// Reads a message in place from the buffer it was received in, rather than
+// decoding it into a heap-allocated EncodableValue.
+class MessageReader : public flutter::ByteStreamReader {
+ public:
+  MessageReader(const uint8_t* bytes, size_t size)
+      : bytes_(bytes), size_(size) {}
+
+  // Returns true if a read went past the end of the message, or found a
+  // value of an unexpected type.
+  bool has_error() const { return has_error_; }
+
+  uint8_t ReadByte() override {
+    if (location_ >= size_) {
+      has_error_ = true;
+      return 0;
+    }
+    return bytes_[location_++];
+  }
+
+  void ReadBytes(uint8_t* buffer, size_t length) override {
+    if (length > size_ - location_) {
+      has_error_ = true;
+      location_ = size_;
+      return;
+    }
+    std::memcpy(buffer, bytes_ + location_, length);
+    location_ += length;
+  }
+
+  void ReadAlignment(uint8_t alignment) override {
+    const size_t mod = location_ % alignment;
+    if (mod != 0) {
+      const size_t padding = alignment - mod;
+      location_ = padding > size_ - location_ ? size_ : location_ + padding;
+    }
+  }
+
+ protected:
+  // Reads a size in the standard codec's variable length encoding.
+  size_t ReadSize() {
+    const uint8_t byte = ReadByte();
+    if (byte < 254) {
+      return byte;
+    }
+    if (byte == 254) {
+      uint16_t value = 0;
+      ReadBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+      return value;
+    }
+    uint32_t value = 0;
+    ReadBytes(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    return value;
+  }
+
+  const uint8_t* bytes_;
+  size_t size_;
+  size_t location_ = 0;
+  bool has_error_ = false;
+};
+
+// Writes a message into a buffer owned by the current thread, which is reused
+// by every message sent from that thread. Once the buffer has grown to fit the
+// largest message, encoding a message does not allocate.
+//
+// BinaryMessenger::Send copies the message, so the buffer can be reused as
+// soon as it returns. Only one writer may be alive on a thread at a time.
+class MessageWriter : public flutter::ByteStreamWriter {
+ public:
+  MessageWriter() : buffer_(GetThreadBuffer()) { buffer_.clear(); }
+
+  const uint8_t* data() const { return buffer_.data(); }
+  size_t size() const { return buffer_.size(); }
+
+  void WriteByte(uint8_t byte) override { buffer_.push_back(byte); }
+
+  void WriteBytes(const uint8_t* bytes, size_t length) override {
+    buffer_.insert(buffer_.end(), bytes, bytes + length);
+  }
+
+  void WriteAlignment(uint8_t alignment) override {
+    const size_t mod = buffer_.size() % alignment;
+    if (mod != 0) {
+      buffer_.insert(buffer_.end(), alignment - mod, 0);
+    }
+  }
+
+ private:
+  static std::vector<uint8_t>& GetThreadBuffer() {
+    thread_local std::vector<uint8_t> buffer;
+    return buffer;
+  }
+
+  std::vector<uint8_t>& buffer_;
+};
+}  // namespace
+
+namespace {
+// Wraps an error in the reply to a host API method.
+EncodableValue PigeonWrapError(std::string_view error_message) {
+  return EncodableValue(
+      EncodableList{EncodableValue(std::string(error_message)),
+                    EncodableValue("Error"), EncodableValue()});
+}
+
+EncodableValue PigeonWrapError(const FlutterError& error) {
+  return EncodableValue(EncodableList{EncodableValue(error.code()),
+                                      EncodableValue(error.message()),
+                                      error.details()});
+}
+
+// Wraps a value returned by a host API method in |Wrapper|, which is
+// EncodableValue or CustomEncodableValue. Enums are sent as their index.
+template <typename Wrapper, typename T>
+EncodableValue PigeonWrapValue(T&& value) {
+  if constexpr (std::is_enum_v<std::decay_t<T>>) {
+    return Wrapper(static_cast<int>(value));
+  } else {
+    return Wrapper(std::forward<T>(value));
+  }
+}
+
+template <typename Wrapper, typename T>
+EncodableValue PigeonWrapValue(std::optional<T>&& value) {
+  if (!value) {
+    return EncodableValue();
+  }
+  return PigeonWrapValue<Wrapper>(std::move(value).value());
+}
+
+// Sends the value or the error returned by a host API method.
+//
+// Ideally this code would use an initializer list to create an EncodableList
+// inline, which would be less code. However, that would always copy the
+// element, so the slightly more verbose create-and-push approach is used
+// instead.
+template <typename Wrapper, typename T, typename Reply>
+void PigeonReply(const Reply& reply, ErrorOr<T>&& output) {
+  if (output.has_error()) {
+    reply(PigeonWrapError(output.error()));
+    return;
+  }
+  EncodableList wrapped;
+  wrapped.push_back(PigeonWrapValue<Wrapper>(std::move(output).TakeValue()));
+  reply(EncodableValue(std::move(wrapped)));
+}
+
+// Sends the error returned by a host API method that returns void, if any.
+template <typename Reply>
+void PigeonReply(const Reply& reply, std::optional<FlutterError>&& output) {
+  if (output.has_value()) {
+    reply(PigeonWrapError(output.value()));
+    return;
+  }
+  EncodableList wrapped;
+  wrapped.push_back(EncodableValue());
+  reply(EncodableValue(std::move(wrapped)));
+}
+
+// Unwraps the arguments of a message to a host API method, calls the method
+// on |host_api| and replies.
+template <typename Api>
+using PigeonHostMethodHandler =
+    void (*)(Api* host_api, const EncodableValue& message,
+             const flutter::MessageReply<EncodableValue>& reply);
+
+// Handles the messages on |channel_name| with |handler|, or removes the
+// handler if |api| is null.
+//
+// Handlers are plain functions, so that every method of |Api| shares one
+// message handler type.
+template <typename Api>
+void PigeonSetUpHostMethod(flutter::BinaryMessenger* binary_messenger,
+                           const char* channel_name,
+                           const flutter::MessageCodec<EncodableValue>* codec,
+                           Api* api, PigeonHostMethodHandler<Api> handler) {
+  BasicMessageChannel<> channel(binary_messenger, channel_name, codec);
+  if (api == nullptr) {
+    channel.SetMessageHandler(nullptr);
+    return;
+  }
+  channel.SetMessageHandler(
+      [api, handler](const EncodableValue& message,
+                     const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          handler(api, message, reply);
+        } catch (const std::exception& exception) {
+          // There is a potential here for `reply` to be called twice, which
+          // is a violation of the API contract, because there's no way of
+          // knowing whether or not the plugin code called `reply` before
+          // throwing. Since use of `@async` suggests that the reply is
+          // probably not sent within the scope of the stack, err on the
+          // side of potential double-call rather than no call (which is
+          // also an API violation) so that unexpected errors have a better
+          // chance of being caught and handled in a useful way.
+          reply(PigeonWrapError(exception.what()));
+        }
+      });
+}
+}  // namespace
+
 // AllTypes
 
 AllTypes::AllTypes(bool a_bool, int64_t an_int, int64_t an_int64,
-                   double a_double, const std::vector<uint8_t>& a_byte_array,
-                   const std::vector<int32_t>& a4_byte_array,
-                   const std::vector<int64_t>& a8_byte_array,
-                   const std::vector<double>& a_float_array,
-                   const EncodableList& a_list, const EncodableMap& a_map,
-                   const AnEnum& an_enum, const std::string& a_string,
-                   const EncodableValue& an_object)
+                   double a_double, std::vector<uint8_t> a_byte_array,
+                   std::vector<int32_t> a4_byte_array,
+                   std::vector<int64_t> a8_byte_array,
+                   std::vector<double> a_float_array, EncodableList a_list,
+                   EncodableMap a_map, const AnEnum& an_enum,
+                   std::string a_string, EncodableValue an_object)
     : a_bool_(a_bool),
       an_int_(an_int),
       an_int64_(an_int64),
       a_double_(a_double),
-      a_byte_array_(a_byte_array),
-      a4_byte_array_(a4_byte_array),
-      a8_byte_array_(a8_byte_array),
-      a_float_array_(a_float_array),
-      a_list_(a_list),
-      a_map_(a_map),
+      a_byte_array_(std::move(a_byte_array)),
+      a4_byte_array_(std::move(a4_byte_array)),
+      a8_byte_array_(std::move(a8_byte_array)),
+      a_float_array_(std::move(a_float_array)),
+      a_list_(std::move(a_list)),
+      a_map_(std::move(a_map)),
       an_enum_(an_enum),
-      a_string_(a_string),
-      an_object_(an_object) {}
+      a_string_(std::move(a_string)),
+      an_object_(std::move(an_object)) {}
 
 bool AllTypes::a_bool() const { return a_bool_; }
 
@@ -80,6 +352,10 @@ void AllTypes::set_a_byte_array(const std::vector<uint8_t>& value_arg) {
   a_byte_array_ = value_arg;
 }
 
+void AllTypes::set_a_byte_array(std::vector<uint8_t>&& value_arg) {
+  a_byte_array_ = std::move(value_arg);
+}
+
 const std::vector<int32_t>& AllTypes::a4_byte_array() const {
   return a4_byte_array_;
 }
@@ -88,6 +364,10 @@ void AllTypes::set_a4_byte_array(const std::vector<int32_t>& value_arg) {
   a4_byte_array_ = value_arg;
 }
 
+void AllTypes::set_a4_byte_array(std::vector<int32_t>&& value_arg) {
+  a4_byte_array_ = std::move(value_arg);
+}
+
 const std::vector<int64_t>& AllTypes::a8_byte_array() const {
   return a8_byte_array_;
 }
@@ -96,6 +376,10 @@ void AllTypes::set_a8_byte_array(const std::vector<int64_t>& value_arg) {
   a8_byte_array_ = value_arg;
 }
 
+void AllTypes::set_a8_byte_array(std::vector<int64_t>&& value_arg) {
+  a8_byte_array_ = std::move(value_arg);
+}
+
 const std::vector<double>& AllTypes::a_float_array() const {
   return a_float_array_;
 }
@@ -104,16 +388,28 @@ void AllTypes::set_a_float_array(const std::vector<double>& value_arg) {
   a_float_array_ = value_arg;
 }
 
+void AllTypes::set_a_float_array(std::vector<double>&& value_arg) {
+  a_float_array_ = std::move(value_arg);
+}
+
 const EncodableList& AllTypes::a_list() const { return a_list_; }
 
 void AllTypes::set_a_list(const EncodableList& value_arg) {
   a_list_ = value_arg;
 }
 
+void AllTypes::set_a_list(EncodableList&& value_arg) {
+  a_list_ = std::move(value_arg);
+}
+
 const EncodableMap& AllTypes::a_map() const { return a_map_; }
 
 void AllTypes::set_a_map(const EncodableMap& value_arg) { a_map_ = value_arg; }
 
+void AllTypes::set_a_map(EncodableMap&& value_arg) {
+  a_map_ = std::move(value_arg);
+}
+
 const AnEnum& AllTypes::an_enum() const { return an_enum_; }
 
 void AllTypes::set_an_enum(const AnEnum& value_arg) { an_enum_ = value_arg; }
@@ -130,6 +426,10 @@ void AllTypes::set_an_object(const EncodableValue& value_arg) {
   an_object_ = value_arg;
 }
 
+void AllTypes::set_an_object(EncodableValue&& value_arg) {
+  an_object_ = std::move(value_arg);
+}
+
 EncodableList AllTypes::ToEncodableList() const {
   EncodableList list;
   list.reserve(13);
@@ -149,15 +449,37 @@ EncodableList AllTypes::ToEncodableList() const {
   return list;
 }
 
-AllTypes AllTypes::FromEncodableList(const EncodableList& list) {
+void AllTypes::WriteEncodableList(
+    const flutter::StandardCodecSerializer& serializer,
+    flutter::ByteStreamWriter* stream) const {
+  WriteListHeader(13, stream);
+  serializer.WriteValue(EncodableValue(a_bool_), stream);
+  serializer.WriteValue(EncodableValue(an_int_), stream);
+  serializer.WriteValue(EncodableValue(an_int64_), stream);
+  serializer.WriteValue(EncodableValue(a_double_), stream);
+  WriteTypedData(8, a_byte_array_, stream);
+  WriteTypedData(9, a4_byte_array_, stream);
+  WriteTypedData(10, a8_byte_array_, stream);
+  WriteTypedData(11, a_float_array_, stream);
+  WriteList(a_list_, serializer, stream);
+  WriteMap(a_map_, serializer, stream);
+  serializer.WriteValue(EncodableValue((int)an_enum_), stream);
+  WriteString(a_string_, stream);
+  serializer.WriteValue(an_object_, stream);
+}
+
+AllTypes AllTypes::FromEncodableList(EncodableList list) {
   AllTypes decoded(
       std::get<bool>(list[0]), list[1].LongValue(), list[2].LongValue(),
-      std::get<double>(list[3]), std::get<std::vector<uint8_t>>(list[4]),
-      std::get<std::vector<int32_t>>(list[5]),
-      std::get<std::vector<int64_t>>(list[6]),
-      std::get<std::vector<double>>(list[7]), std::get<EncodableList>(list[8]),
-      std::get<EncodableMap>(list[9]), (AnEnum)(std::get<int32_t>(list[10])),
-      std::get<std::string>(list[11]), list[12]);
+      std::get<double>(list[3]),
+      std::get<std::vector<uint8_t>>(std::move(list[4])),
+      std::get<std::vector<int32_t>>(std::move(list[5])),
+      std::get<std::vector<int64_t>>(std::move(list[6])),
+      std::get<std::vector<double>>(std::move(list[7])),
+      std::get<EncodableList>(std::move(list[8])),
+      std::get<EncodableMap>(std::move(list[9])),
+      (AnEnum)(std::get<int32_t>(list[10])),
+      std::get<std::string>(std::move(list[11])), std::move(list[12]));
   return decoded;
 }
 
@@ -297,6 +619,11 @@ void AllNullableTypes::set_a_nullable_byte_array(
   a_nullable_byte_array_ = value_arg;
 }
 
+void AllNullableTypes::set_a_nullable_byte_array(
+    std::vector<uint8_t>&& value_arg) {
+  a_nullable_byte_array_ = std::move(value_arg);
+}
+
 const std::vector<int32_t>* AllNullableTypes::a_nullable4_byte_array() const {
   return a_nullable4_byte_array_ ? &(*a_nullable4_byte_array_) : nullptr;
 }
@@ -313,6 +640,11 @@ void AllNullableTypes::set_a_nullable4_byte_array(
   a_nullable4_byte_array_ = value_arg;
 }
 
+void AllNullableTypes::set_a_nullable4_byte_array(
+    std::vector<int32_t>&& value_arg) {
+  a_nullable4_byte_array_ = std::move(value_arg);
+}
+
 const std::vector<int64_t>* AllNullableTypes::a_nullable8_byte_array() const {
   return a_nullable8_byte_array_ ? &(*a_nullable8_byte_array_) : nullptr;
 }
@@ -329,6 +661,11 @@ void AllNullableTypes::set_a_nullable8_byte_array(
   a_nullable8_byte_array_ = value_arg;
 }
 
+void AllNullableTypes::set_a_nullable8_byte_array(
+    std::vector<int64_t>&& value_arg) {
+  a_nullable8_byte_array_ = std::move(value_arg);
+}
+
 const std::vector<double>* AllNullableTypes::a_nullable_float_array() const {
   return a_nullable_float_array_ ? &(*a_nullable_float_array_) : nullptr;
 }
@@ -344,6 +681,11 @@ void AllNullableTypes::set_a_nullable_float_array(
   a_nullable_float_array_ = value_arg;
 }
 
+void AllNullableTypes::set_a_nullable_float_array(
+    std::vector<double>&& value_arg) {
+  a_nullable_float_array_ = std::move(value_arg);
+}
+
 const EncodableList* AllNullableTypes::a_nullable_list() const {
   return a_nullable_list_ ? &(*a_nullable_list_) : nullptr;
 }
@@ -357,6 +699,10 @@ void AllNullableTypes::set_a_nullable_list(const EncodableList& value_arg) {
   a_nullable_list_ = value_arg;
 }
 
+void AllNullableTypes::set_a_nullable_list(EncodableList&& value_arg) {
+  a_nullable_list_ = std::move(value_arg);
+}
+
 const EncodableMap* AllNullableTypes::a_nullable_map() const {
   return a_nullable_map_ ? &(*a_nullable_map_) : nullptr;
 }
@@ -370,6 +716,10 @@ void AllNullableTypes::set_a_nullable_map(const EncodableMap& value_arg) {
   a_nullable_map_ = value_arg;
 }
 
+void AllNullableTypes::set_a_nullable_map(EncodableMap&& value_arg) {
+  a_nullable_map_ = std::move(value_arg);
+}
+
 const EncodableList* AllNullableTypes::nullable_nested_list() const {
   return nullable_nested_list_ ? &(*nullable_nested_list_) : nullptr;
 }
@@ -385,6 +735,10 @@ void AllNullableTypes::set_nullable_nested_list(
   nullable_nested_list_ = value_arg;
 }
 
+void AllNullableTypes::set_nullable_nested_list(EncodableList&& value_arg) {
+  nullable_nested_list_ = std::move(value_arg);
+}
+
 const EncodableMap* AllNullableTypes::nullable_map_with_annotations() const {
   return nullable_map_with_annotations_ ? &(*nullable_map_with_annotations_)
                                         : nullptr;
@@ -401,6 +755,11 @@ void AllNullableTypes::set_nullable_map_with_annotations(
   nullable_map_with_annotations_ = value_arg;
 }
 
+void AllNullableTypes::set_nullable_map_with_annotations(
+    EncodableMap&& value_arg) {
+  nullable_map_with_annotations_ = std::move(value_arg);
+}
+
 const EncodableMap* AllNullableTypes::nullable_map_with_object() const {
   return nullable_map_with_object_ ? &(*nullable_map_with_object_) : nullptr;
 }
@@ -416,6 +775,10 @@ void AllNullableTypes::set_nullable_map_with_object(
   nullable_map_with_object_ = value_arg;
 }
 
+void AllNullableTypes::set_nullable_map_with_object(EncodableMap&& value_arg) {
+  nullable_map_with_object_ = std::move(value_arg);
+}
+
 const AnEnum* AllNullableTypes::a_nullable_enum() const {
   return a_nullable_enum_ ? &(*a_nullable_enum_) : nullptr;
 }
@@ -456,6 +819,10 @@ void AllNullableTypes::set_a_nullable_object(const EncodableValue& value_arg) {
   a_nullable_object_ = value_arg;
 }
 
+void AllNullableTypes::set_a_nullable_object(EncodableValue&& value_arg) {
+  a_nullable_object_ = std::move(value_arg);
+}
+
 EncodableList AllNullableTypes::ToEncodableList() const {
   EncodableList list;
   list.reserve(16);
@@ -499,8 +866,93 @@ EncodableList AllNullableTypes::ToEncodableList() const {
   return list;
 }
 
-AllNullableTypes AllNullableTypes::FromEncodableList(
-    const EncodableList& list) {
+void AllNullableTypes::WriteEncodableList(
+    const flutter::StandardCodecSerializer& serializer,
+    flutter::ByteStreamWriter* stream) const {
+  WriteListHeader(16, stream);
+  if (a_nullable_bool_) {
+    serializer.WriteValue(EncodableValue(*a_nullable_bool_), stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_int_) {
+    serializer.WriteValue(EncodableValue(*a_nullable_int_), stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_int64_) {
+    serializer.WriteValue(EncodableValue(*a_nullable_int64_), stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_double_) {
+    serializer.WriteValue(EncodableValue(*a_nullable_double_), stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_byte_array_) {
+    WriteTypedData(8, *a_nullable_byte_array_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable4_byte_array_) {
+    WriteTypedData(9, *a_nullable4_byte_array_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable8_byte_array_) {
+    WriteTypedData(10, *a_nullable8_byte_array_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_float_array_) {
+    WriteTypedData(11, *a_nullable_float_array_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_list_) {
+    WriteList(*a_nullable_list_, serializer, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_map_) {
+    WriteMap(*a_nullable_map_, serializer, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (nullable_nested_list_) {
+    WriteList(*nullable_nested_list_, serializer, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (nullable_map_with_annotations_) {
+    WriteMap(*nullable_map_with_annotations_, serializer, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (nullable_map_with_object_) {
+    WriteMap(*nullable_map_with_object_, serializer, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_enum_) {
+    serializer.WriteValue(EncodableValue((int)*a_nullable_enum_), stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_string_) {
+    WriteString(*a_nullable_string_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+  if (a_nullable_object_) {
+    serializer.WriteValue(*a_nullable_object_, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+}
+
+AllNullableTypes AllNullableTypes::FromEncodableList(EncodableList list) {
   AllNullableTypes decoded;
   auto& encodable_a_nullable_bool = list[0];
   if (!encodable_a_nullable_bool.IsNull()) {
@@ -521,48 +973,48 @@ AllNullableTypes AllNullableTypes::FromEncodableList(
   }
   auto& encodable_a_nullable_byte_array = list[4];
   if (!encodable_a_nullable_byte_array.IsNull()) {
-    decoded.set_a_nullable_byte_array(
-        std::get<std::vector<uint8_t>>(encodable_a_nullable_byte_array));
+    decoded.set_a_nullable_byte_array(std::get<std::vector<uint8_t>>(
+        std::move(encodable_a_nullable_byte_array)));
   }
   auto& encodable_a_nullable4_byte_array = list[5];
   if (!encodable_a_nullable4_byte_array.IsNull()) {
-    decoded.set_a_nullable4_byte_array(
-        std::get<std::vector<int32_t>>(encodable_a_nullable4_byte_array));
+    decoded.set_a_nullable4_byte_array(std::get<std::vector<int32_t>>(
+        std::move(encodable_a_nullable4_byte_array)));
   }
   auto& encodable_a_nullable8_byte_array = list[6];
   if (!encodable_a_nullable8_byte_array.IsNull()) {
-    decoded.set_a_nullable8_byte_array(
-        std::get<std::vector<int64_t>>(encodable_a_nullable8_byte_array));
+    decoded.set_a_nullable8_byte_array(std::get<std::vector<int64_t>>(
+        std::move(encodable_a_nullable8_byte_array)));
   }
   auto& encodable_a_nullable_float_array = list[7];
   if (!encodable_a_nullable_float_array.IsNull()) {
-    decoded.set_a_nullable_float_array(
-        std::get<std::vector<double>>(encodable_a_nullable_float_array));
+    decoded.set_a_nullable_float_array(std::get<std::vector<double>>(
+        std::move(encodable_a_nullable_float_array)));
   }
   auto& encodable_a_nullable_list = list[8];
   if (!encodable_a_nullable_list.IsNull()) {
     decoded.set_a_nullable_list(
-        std::get<EncodableList>(encodable_a_nullable_list));
+        std::get<EncodableList>(std::move(encodable_a_nullable_list)));
   }
   auto& encodable_a_nullable_map = list[9];
   if (!encodable_a_nullable_map.IsNull()) {
     decoded.set_a_nullable_map(
-        std::get<EncodableMap>(encodable_a_nullable_map));
+        std::get<EncodableMap>(std::move(encodable_a_nullable_map)));
   }
   auto& encodable_nullable_nested_list = list[10];
   if (!encodable_nullable_nested_list.IsNull()) {
     decoded.set_nullable_nested_list(
-        std::get<EncodableList>(encodable_nullable_nested_list));
+        std::get<EncodableList>(std::move(encodable_nullable_nested_list)));
   }
   auto& encodable_nullable_map_with_annotations = list[11];
   if (!encodable_nullable_map_with_annotations.IsNull()) {
-    decoded.set_nullable_map_with_annotations(
-        std::get<EncodableMap>(encodable_nullable_map_with_annotations));
+    decoded.set_nullable_map_with_annotations(std::get<EncodableMap>(
+        std::move(encodable_nullable_map_with_annotations)));
   }
   auto& encodable_nullable_map_with_object = list[12];
   if (!encodable_nullable_map_with_object.IsNull()) {
     decoded.set_nullable_map_with_object(
-        std::get<EncodableMap>(encodable_nullable_map_with_object));
+        std::get<EncodableMap>(std::move(encodable_nullable_map_with_object)));
   }
   auto& encodable_a_nullable_enum = list[13];
   if (!encodable_a_nullable_enum.IsNull()) {
@@ -572,23 +1024,23 @@ AllNullableTypes AllNullableTypes::FromEncodableList(
   auto& encodable_a_nullable_string = list[14];
   if (!encodable_a_nullable_string.IsNull()) {
     decoded.set_a_nullable_string(
-        std::get<std::string>(encodable_a_nullable_string));
+        std::get<std::string>(std::move(encodable_a_nullable_string)));
   }
   auto& encodable_a_nullable_object = list[15];
   if (!encodable_a_nullable_object.IsNull()) {
-    decoded.set_a_nullable_object(encodable_a_nullable_object);
+    decoded.set_a_nullable_object(std::move(encodable_a_nullable_object));
   }
   return decoded;
 }
 
 // AllClassesWrapper
 
-AllClassesWrapper::AllClassesWrapper(const AllNullableTypes& all_nullable_types)
-    : all_nullable_types_(all_nullable_types) {}
+AllClassesWrapper::AllClassesWrapper(AllNullableTypes all_nullable_types)
+    : all_nullable_types_(std::move(all_nullable_types)) {}
 
-AllClassesWrapper::AllClassesWrapper(const AllNullableTypes& all_nullable_types,
+AllClassesWrapper::AllClassesWrapper(AllNullableTypes all_nullable_types,
                                      const AllTypes* all_types)
-    : all_nullable_types_(all_nullable_types),
+    : all_nullable_types_(std::move(all_nullable_types)),
       all_types_(all_types ? std::optional<AllTypes>(*all_types)
                            : std::nullopt) {}
 
@@ -601,6 +1053,10 @@ void AllClassesWrapper::set_all_nullable_types(
   all_nullable_types_ = value_arg;
 }
 
+void AllClassesWrapper::set_all_nullable_types(AllNullableTypes&& value_arg) {
+  all_nullable_types_ = std::move(value_arg);
+}
+
 const AllTypes* AllClassesWrapper::all_types() const {
   return all_types_ ? &(*all_types_) : nullptr;
 }
@@ -613,6 +1069,10 @@ void AllClassesWrapper::set_all_types(const AllTypes& value_arg) {
   all_types_ = value_arg;
 }
 
+void AllClassesWrapper::set_all_types(AllTypes&& value_arg) {
+  all_types_ = std::move(value_arg);
+}
+
 EncodableList AllClassesWrapper::ToEncodableList() const {
   EncodableList list;
   list.reserve(2);
@@ -622,14 +1082,25 @@ EncodableList AllClassesWrapper::ToEncodableList() const {
   return list;
 }
 
-AllClassesWrapper AllClassesWrapper::FromEncodableList(
-    const EncodableList& list) {
-  AllClassesWrapper decoded(
-      AllNullableTypes::FromEncodableList(std::get<EncodableList>(list[0])));
+void AllClassesWrapper::WriteEncodableList(
+    const flutter::StandardCodecSerializer& serializer,
+    flutter::ByteStreamWriter* stream) const {
+  WriteListHeader(2, stream);
+  all_nullable_types_.WriteEncodableList(serializer, stream);
+  if (all_types_) {
+    all_types_->WriteEncodableList(serializer, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+}
+
+AllClassesWrapper AllClassesWrapper::FromEncodableList(EncodableList list) {
+  AllClassesWrapper decoded(AllNullableTypes::FromEncodableList(
+      std::get<EncodableList>(std::move(list[0]))));
   auto& encodable_all_types = list[1];
   if (!encodable_all_types.IsNull()) {
     decoded.set_all_types(AllTypes::FromEncodableList(
-        std::get<EncodableList>(encodable_all_types)));
+        std::get<EncodableList>(std::move(encodable_all_types))));
   }
   return decoded;
 }
@@ -655,6 +1126,10 @@ void TestMessage::set_test_list(const EncodableList& value_arg) {
   test_list_ = value_arg;
 }
 
+void TestMessage::set_test_list(EncodableList&& value_arg) {
+  test_list_ = std::move(value_arg);
+}
+
 EncodableList TestMessage::ToEncodableList() const {
   EncodableList list;
   list.reserve(1);
@@ -662,11 +1137,23 @@ EncodableList TestMessage::ToEncodableList() const {
   return list;
 }
 
-TestMessage TestMessage::FromEncodableList(const EncodableList& list) {
+void TestMessage::WriteEncodableList(
+    const flutter::StandardCodecSerializer& serializer,
+    flutter::ByteStreamWriter* stream) const {
+  WriteListHeader(1, stream);
+  if (test_list_) {
+    WriteList(*test_list_, serializer, stream);
+  } else {
+    serializer.WriteValue(EncodableValue(), stream);
+  }
+}
+
+TestMessage TestMessage::FromEncodableList(EncodableList list) {
   TestMessage decoded;
   auto& encodable_test_list = list[0];
   if (!encodable_test_list.IsNull()) {
-    decoded.set_test_list(std::get<EncodableList>(encodable_test_list));
+    decoded.set_test_list(
+        std::get<EncodableList>(std::move(encodable_test_list)));
   }
   return decoded;
 }
@@ -675,3053 +1162,1427 @@ HostIntegrationCoreApiCodecSerializer::HostIntegrationCoreApiCodecSerializer() {
 }
 
 EncodableValue HostIntegrationCoreApiCodecSerializer::ReadValueOfType(
-    uint8_t type, flutter::ByteStreamReader* stream) const {
-  switch (type) {
-    case 128:
-      return CustomEncodableValue(AllClassesWrapper::FromEncodableList(
-          std::get<EncodableList>(ReadValue(stream))));
-    case 129:
-      return CustomEncodableValue(AllNullableTypes::FromEncodableList(
-          std::get<EncodableList>(ReadValue(stream))));
-    case 130:
-      return CustomEncodableValue(AllTypes::FromEncodableList(
-          std::get<EncodableList>(ReadValue(stream))));
-    case 131:
-      return CustomEncodableValue(TestMessage::FromEncodableList(
-          std::get<EncodableList>(ReadValue(stream))));
-    default:
-      return flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
-  }
-}
-
-void HostIntegrationCoreApiCodecSerializer::WriteValue(
-    const EncodableValue& value, flutter::ByteStreamWriter* stream) const {
-  if (const CustomEncodableValue* custom_value =
-          std::get_if<CustomEncodableValue>(&value)) {
-    if (custom_value->type() == typeid(AllClassesWrapper)) {
-      stream->WriteByte(128);
-      WriteValue(EncodableValue(std::any_cast<AllClassesWrapper>(*custom_value)
-                                    .ToEncodableList()),
-                 stream);
-      return;
-    }
-    if (custom_value->type() == typeid(AllNullableTypes)) {
-      stream->WriteByte(129);
-      WriteValue(
-          EncodableValue(
-              std::any_cast<AllNullableTypes>(*custom_value).ToEncodableList()),
-          stream);
-      return;
-    }
-    if (custom_value->type() == typeid(AllTypes)) {
-      stream->WriteByte(130);
-      WriteValue(EncodableValue(
-                     std::any_cast<AllTypes>(*custom_value).ToEncodableList()),
-                 stream);
-      return;
-    }
-    if (custom_value->type() == typeid(TestMessage)) {
-      stream->WriteByte(131);
-      WriteValue(
-          EncodableValue(
-              std::any_cast<TestMessage>(*custom_value).ToEncodableList()),
-          stream);
-      return;
-    }
-  }
-  flutter::StandardCodecSerializer::WriteValue(value, stream);
-}
-
-/// The codec used by HostIntegrationCoreApi.
-const flutter::StandardMessageCodec& HostIntegrationCoreApi::GetCodec() {
-  return flutter::StandardMessageCodec::GetInstance(
-      &HostIntegrationCoreApiCodecSerializer::GetInstance());
-}
-
-// Sets up an instance of `HostIntegrationCoreApi` to handle messages through
-// the `binary_messenger`.
-void HostIntegrationCoreApi::SetUp(flutter::BinaryMessenger* binary_messenger,
-                                   HostIntegrationCoreApi* api) {
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "noop",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              std::optional<FlutterError> output = api->Noop();
-              if (output.has_value()) {
-                reply(WrapError(output.value()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue());
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAllTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_everything_arg = args.at(0);
-              if (encodable_everything_arg.IsNull()) {
-                reply(WrapError("everything_arg unexpectedly null."));
-                return;
-              }
-              const auto& everything_arg = std::any_cast<const AllTypes&>(
-                  std::get<CustomEncodableValue>(encodable_everything_arg));
-              ErrorOr<AllTypes> output = api->EchoAllTypes(everything_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(
-                  CustomEncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "throwError",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              ErrorOr<std::optional<EncodableValue>> output = api->ThrowError();
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "throwErrorFromVoid",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              std::optional<FlutterError> output = api->ThrowErrorFromVoid();
-              if (output.has_value()) {
-                reply(WrapError(output.value()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue());
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "throwFlutterError",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              ErrorOr<std::optional<EncodableValue>> output =
-                  api->ThrowFlutterError();
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_int_arg = args.at(0);
-              if (encodable_an_int_arg.IsNull()) {
-                reply(WrapError("an_int_arg unexpectedly null."));
-                return;
-              }
-              const int64_t an_int_arg = encodable_an_int_arg.LongValue();
-              ErrorOr<int64_t> output = api->EchoInt(an_int_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoDouble",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_double_arg = args.at(0);
-              if (encodable_a_double_arg.IsNull()) {
-                reply(WrapError("a_double_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_double_arg =
-                  std::get<double>(encodable_a_double_arg);
-              ErrorOr<double> output = api->EchoDouble(a_double_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoBool",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_bool_arg = args.at(0);
-              if (encodable_a_bool_arg.IsNull()) {
-                reply(WrapError("a_bool_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_bool_arg = std::get<bool>(encodable_a_bool_arg);
-              ErrorOr<bool> output = api->EchoBool(a_bool_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_string_arg = args.at(0);
-              if (encodable_a_string_arg.IsNull()) {
-                reply(WrapError("a_string_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_string_arg =
-                  std::get<std::string>(encodable_a_string_arg);
-              ErrorOr<std::string> output = api->EchoString(a_string_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoUint8List",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_uint8_list_arg = args.at(0);
-              if (encodable_a_uint8_list_arg.IsNull()) {
-                reply(WrapError("a_uint8_list_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_uint8_list_arg =
-                  std::get<std::vector<uint8_t>>(encodable_a_uint8_list_arg);
-              ErrorOr<std::vector<uint8_t>> output =
-                  api->EchoUint8List(a_uint8_list_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoObject",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_object_arg = args.at(0);
-              if (encodable_an_object_arg.IsNull()) {
-                reply(WrapError("an_object_arg unexpectedly null."));
-                return;
-              }
-              const auto& an_object_arg = encodable_an_object_arg;
-              ErrorOr<EncodableValue> output = api->EchoObject(an_object_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoList",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_list_arg = args.at(0);
-              if (encodable_a_list_arg.IsNull()) {
-                reply(WrapError("a_list_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_list_arg =
-                  std::get<EncodableList>(encodable_a_list_arg);
-              ErrorOr<EncodableList> output = api->EchoList(a_list_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoMap",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_map_arg = args.at(0);
-              if (encodable_a_map_arg.IsNull()) {
-                reply(WrapError("a_map_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_map_arg =
-                  std::get<EncodableMap>(encodable_a_map_arg);
-              ErrorOr<EncodableMap> output = api->EchoMap(a_map_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoClassWrapper",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_wrapper_arg = args.at(0);
-              if (encodable_wrapper_arg.IsNull()) {
-                reply(WrapError("wrapper_arg unexpectedly null."));
-                return;
-              }
-              const auto& wrapper_arg = std::any_cast<const AllClassesWrapper&>(
-                  std::get<CustomEncodableValue>(encodable_wrapper_arg));
-              ErrorOr<AllClassesWrapper> output =
-                  api->EchoClassWrapper(wrapper_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(
-                  CustomEncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoEnum",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_enum_arg = args.at(0);
-              if (encodable_an_enum_arg.IsNull()) {
-                reply(WrapError("an_enum_arg unexpectedly null."));
-                return;
-              }
-              const AnEnum& an_enum_arg =
-                  (AnEnum)encodable_an_enum_arg.LongValue();
-              ErrorOr<AnEnum> output = api->EchoEnum(an_enum_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(
-                  EncodableValue((int)std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNamedDefaultString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_string_arg = args.at(0);
-              if (encodable_a_string_arg.IsNull()) {
-                reply(WrapError("a_string_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_string_arg =
-                  std::get<std::string>(encodable_a_string_arg);
-              ErrorOr<std::string> output =
-                  api->EchoNamedDefaultString(a_string_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoOptionalDefaultDouble",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_double_arg = args.at(0);
-              if (encodable_a_double_arg.IsNull()) {
-                reply(WrapError("a_double_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_double_arg =
-                  std::get<double>(encodable_a_double_arg);
-              ErrorOr<double> output =
-                  api->EchoOptionalDefaultDouble(a_double_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoRequiredInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_int_arg = args.at(0);
-              if (encodable_an_int_arg.IsNull()) {
-                reply(WrapError("an_int_arg unexpectedly null."));
-                return;
-              }
-              const int64_t an_int_arg = encodable_an_int_arg.LongValue();
-              ErrorOr<int64_t> output = api->EchoRequiredInt(an_int_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAllNullableTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_everything_arg = args.at(0);
-              const auto* everything_arg =
-                  &(std::any_cast<const AllNullableTypes&>(
-                      std::get<CustomEncodableValue>(
-                          encodable_everything_arg)));
-              ErrorOr<std::optional<AllNullableTypes>> output =
-                  api->EchoAllNullableTypes(everything_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    CustomEncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "extractNestedNullableString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_wrapper_arg = args.at(0);
-              if (encodable_wrapper_arg.IsNull()) {
-                reply(WrapError("wrapper_arg unexpectedly null."));
-                return;
-              }
-              const auto& wrapper_arg = std::any_cast<const AllClassesWrapper&>(
-                  std::get<CustomEncodableValue>(encodable_wrapper_arg));
-              ErrorOr<std::optional<std::string>> output =
-                  api->ExtractNestedNullableString(wrapper_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "createNestedNullableString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_nullable_string_arg = args.at(0);
-              const auto* nullable_string_arg =
-                  std::get_if<std::string>(&encodable_nullable_string_arg);
-              ErrorOr<AllClassesWrapper> output =
-                  api->CreateNestedNullableString(nullable_string_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(
-                  CustomEncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "sendMultipleNullableTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_bool_arg = args.at(0);
-              const auto* a_nullable_bool_arg =
-                  std::get_if<bool>(&encodable_a_nullable_bool_arg);
-              const auto& encodable_a_nullable_int_arg = args.at(1);
-              const int64_t a_nullable_int_arg_value =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? 0
-                      : encodable_a_nullable_int_arg.LongValue();
-              const auto* a_nullable_int_arg =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? nullptr
-                      : &a_nullable_int_arg_value;
-              const auto& encodable_a_nullable_string_arg = args.at(2);
-              const auto* a_nullable_string_arg =
-                  std::get_if<std::string>(&encodable_a_nullable_string_arg);
-              ErrorOr<AllNullableTypes> output = api->SendMultipleNullableTypes(
-                  a_nullable_bool_arg, a_nullable_int_arg,
-                  a_nullable_string_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(
-                  CustomEncodableValue(std::move(output).TakeValue()));
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_int_arg = args.at(0);
-              const int64_t a_nullable_int_arg_value =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? 0
-                      : encodable_a_nullable_int_arg.LongValue();
-              const auto* a_nullable_int_arg =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? nullptr
-                      : &a_nullable_int_arg_value;
-              ErrorOr<std::optional<int64_t>> output =
-                  api->EchoNullableInt(a_nullable_int_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableDouble",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_double_arg = args.at(0);
-              const auto* a_nullable_double_arg =
-                  std::get_if<double>(&encodable_a_nullable_double_arg);
-              ErrorOr<std::optional<double>> output =
-                  api->EchoNullableDouble(a_nullable_double_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableBool",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_bool_arg = args.at(0);
-              const auto* a_nullable_bool_arg =
-                  std::get_if<bool>(&encodable_a_nullable_bool_arg);
-              ErrorOr<std::optional<bool>> output =
-                  api->EchoNullableBool(a_nullable_bool_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_string_arg = args.at(0);
-              const auto* a_nullable_string_arg =
-                  std::get_if<std::string>(&encodable_a_nullable_string_arg);
-              ErrorOr<std::optional<std::string>> output =
-                  api->EchoNullableString(a_nullable_string_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableUint8List",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_uint8_list_arg = args.at(0);
-              const auto* a_nullable_uint8_list_arg =
-                  std::get_if<std::vector<uint8_t>>(
-                      &encodable_a_nullable_uint8_list_arg);
-              ErrorOr<std::optional<std::vector<uint8_t>>> output =
-                  api->EchoNullableUint8List(a_nullable_uint8_list_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableObject",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_object_arg = args.at(0);
-              const auto* a_nullable_object_arg =
-                  &encodable_a_nullable_object_arg;
-              ErrorOr<std::optional<EncodableValue>> output =
-                  api->EchoNullableObject(a_nullable_object_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableList",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_list_arg = args.at(0);
-              const auto* a_nullable_list_arg =
-                  std::get_if<EncodableList>(&encodable_a_nullable_list_arg);
-              ErrorOr<std::optional<EncodableList>> output =
-                  api->EchoNullableList(a_nullable_list_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableMap",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_map_arg = args.at(0);
-              const auto* a_nullable_map_arg =
-                  std::get_if<EncodableMap>(&encodable_a_nullable_map_arg);
-              ErrorOr<std::optional<EncodableMap>> output =
-                  api->EchoNullableMap(a_nullable_map_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNullableEnum",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_enum_arg = args.at(0);
-              const int64_t an_enum_arg_value =
-                  encodable_an_enum_arg.IsNull()
-                      ? 0
-                      : encodable_an_enum_arg.LongValue();
-              const auto an_enum_arg =
-                  encodable_an_enum_arg.IsNull()
-                      ? std::nullopt
-                      : std::make_optional<AnEnum>(
-                            static_cast<AnEnum>(an_enum_arg_value));
-              ErrorOr<std::optional<AnEnum>> output = api->EchoNullableEnum(
-                  an_enum_arg ? &(*an_enum_arg) : nullptr);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue((int)std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoOptionalNullableInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_int_arg = args.at(0);
-              const int64_t a_nullable_int_arg_value =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? 0
-                      : encodable_a_nullable_int_arg.LongValue();
-              const auto* a_nullable_int_arg =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? nullptr
-                      : &a_nullable_int_arg_value;
-              ErrorOr<std::optional<int64_t>> output =
-                  api->EchoOptionalNullableInt(a_nullable_int_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoNamedNullableString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_string_arg = args.at(0);
-              const auto* a_nullable_string_arg =
-                  std::get_if<std::string>(&encodable_a_nullable_string_arg);
-              ErrorOr<std::optional<std::string>> output =
-                  api->EchoNamedNullableString(a_nullable_string_arg);
-              if (output.has_error()) {
-                reply(WrapError(output.error()));
-                return;
-              }
-              EncodableList wrapped;
-              auto output_optional = std::move(output).TakeValue();
-              if (output_optional) {
-                wrapped.push_back(
-                    EncodableValue(std::move(output_optional).value()));
-              } else {
-                wrapped.push_back(EncodableValue());
-              }
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "noopAsync",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->NoopAsync([reply](std::optional<FlutterError>&& output) {
-                if (output.has_value()) {
-                  reply(WrapError(output.value()));
-                  return;
-                }
-                EncodableList wrapped;
-                wrapped.push_back(EncodableValue());
-                reply(EncodableValue(std::move(wrapped)));
-              });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_int_arg = args.at(0);
-              if (encodable_an_int_arg.IsNull()) {
-                reply(WrapError("an_int_arg unexpectedly null."));
-                return;
-              }
-              const int64_t an_int_arg = encodable_an_int_arg.LongValue();
-              api->EchoAsyncInt(an_int_arg, [reply](ErrorOr<int64_t>&& output) {
-                if (output.has_error()) {
-                  reply(WrapError(output.error()));
-                  return;
-                }
-                EncodableList wrapped;
-                wrapped.push_back(
-                    EncodableValue(std::move(output).TakeValue()));
-                reply(EncodableValue(std::move(wrapped)));
-              });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncDouble",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_double_arg = args.at(0);
-              if (encodable_a_double_arg.IsNull()) {
-                reply(WrapError("a_double_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_double_arg =
-                  std::get<double>(encodable_a_double_arg);
-              api->EchoAsyncDouble(
-                  a_double_arg, [reply](ErrorOr<double>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncBool",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_bool_arg = args.at(0);
-              if (encodable_a_bool_arg.IsNull()) {
-                reply(WrapError("a_bool_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_bool_arg = std::get<bool>(encodable_a_bool_arg);
-              api->EchoAsyncBool(a_bool_arg, [reply](ErrorOr<bool>&& output) {
-                if (output.has_error()) {
-                  reply(WrapError(output.error()));
-                  return;
-                }
-                EncodableList wrapped;
-                wrapped.push_back(
-                    EncodableValue(std::move(output).TakeValue()));
-                reply(EncodableValue(std::move(wrapped)));
-              });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_string_arg = args.at(0);
-              if (encodable_a_string_arg.IsNull()) {
-                reply(WrapError("a_string_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_string_arg =
-                  std::get<std::string>(encodable_a_string_arg);
-              api->EchoAsyncString(
-                  a_string_arg, [reply](ErrorOr<std::string>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncUint8List",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_uint8_list_arg = args.at(0);
-              if (encodable_a_uint8_list_arg.IsNull()) {
-                reply(WrapError("a_uint8_list_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_uint8_list_arg =
-                  std::get<std::vector<uint8_t>>(encodable_a_uint8_list_arg);
-              api->EchoAsyncUint8List(
-                  a_uint8_list_arg,
-                  [reply](ErrorOr<std::vector<uint8_t>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncObject",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_object_arg = args.at(0);
-              if (encodable_an_object_arg.IsNull()) {
-                reply(WrapError("an_object_arg unexpectedly null."));
-                return;
-              }
-              const auto& an_object_arg = encodable_an_object_arg;
-              api->EchoAsyncObject(
-                  an_object_arg, [reply](ErrorOr<EncodableValue>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncList",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_list_arg = args.at(0);
-              if (encodable_a_list_arg.IsNull()) {
-                reply(WrapError("a_list_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_list_arg =
-                  std::get<EncodableList>(encodable_a_list_arg);
-              api->EchoAsyncList(
-                  a_list_arg, [reply](ErrorOr<EncodableList>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncMap",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_map_arg = args.at(0);
-              if (encodable_a_map_arg.IsNull()) {
-                reply(WrapError("a_map_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_map_arg =
-                  std::get<EncodableMap>(encodable_a_map_arg);
-              api->EchoAsyncMap(
-                  a_map_arg, [reply](ErrorOr<EncodableMap>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncEnum",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_enum_arg = args.at(0);
-              if (encodable_an_enum_arg.IsNull()) {
-                reply(WrapError("an_enum_arg unexpectedly null."));
-                return;
-              }
-              const AnEnum& an_enum_arg =
-                  (AnEnum)encodable_an_enum_arg.LongValue();
-              api->EchoAsyncEnum(
-                  an_enum_arg, [reply](ErrorOr<AnEnum>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue((int)std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "throwAsyncError",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->ThrowAsyncError(
-                  [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "throwAsyncErrorFromVoid",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->ThrowAsyncErrorFromVoid(
-                  [reply](std::optional<FlutterError>&& output) {
-                    if (output.has_value()) {
-                      reply(WrapError(output.value()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(EncodableValue());
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "throwAsyncFlutterError",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->ThrowAsyncFlutterError(
-                  [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncAllTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_everything_arg = args.at(0);
-              if (encodable_everything_arg.IsNull()) {
-                reply(WrapError("everything_arg unexpectedly null."));
-                return;
-              }
-              const auto& everything_arg = std::any_cast<const AllTypes&>(
-                  std::get<CustomEncodableValue>(encodable_everything_arg));
-              api->EchoAsyncAllTypes(
-                  everything_arg, [reply](ErrorOr<AllTypes>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        CustomEncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableAllNullableTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_everything_arg = args.at(0);
-              const auto* everything_arg =
-                  &(std::any_cast<const AllNullableTypes&>(
-                      std::get<CustomEncodableValue>(
-                          encodable_everything_arg)));
-              api->EchoAsyncNullableAllNullableTypes(
-                  everything_arg,
-                  [reply](ErrorOr<std::optional<AllNullableTypes>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(CustomEncodableValue(
-                          std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_int_arg = args.at(0);
-              const int64_t an_int_arg_value =
-                  encodable_an_int_arg.IsNull()
-                      ? 0
-                      : encodable_an_int_arg.LongValue();
-              const auto* an_int_arg =
-                  encodable_an_int_arg.IsNull() ? nullptr : &an_int_arg_value;
-              api->EchoAsyncNullableInt(
-                  an_int_arg,
-                  [reply](ErrorOr<std::optional<int64_t>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableDouble",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_double_arg = args.at(0);
-              const auto* a_double_arg =
-                  std::get_if<double>(&encodable_a_double_arg);
-              api->EchoAsyncNullableDouble(
-                  a_double_arg,
-                  [reply](ErrorOr<std::optional<double>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableBool",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_bool_arg = args.at(0);
-              const auto* a_bool_arg = std::get_if<bool>(&encodable_a_bool_arg);
-              api->EchoAsyncNullableBool(
-                  a_bool_arg, [reply](ErrorOr<std::optional<bool>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_string_arg = args.at(0);
-              const auto* a_string_arg =
-                  std::get_if<std::string>(&encodable_a_string_arg);
-              api->EchoAsyncNullableString(
-                  a_string_arg,
-                  [reply](ErrorOr<std::optional<std::string>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableUint8List",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_uint8_list_arg = args.at(0);
-              const auto* a_uint8_list_arg = std::get_if<std::vector<uint8_t>>(
-                  &encodable_a_uint8_list_arg);
-              api->EchoAsyncNullableUint8List(
-                  a_uint8_list_arg,
-                  [reply](
-                      ErrorOr<std::optional<std::vector<uint8_t>>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableObject",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_object_arg = args.at(0);
-              const auto* an_object_arg = &encodable_an_object_arg;
-              api->EchoAsyncNullableObject(
-                  an_object_arg,
-                  [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableList",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_list_arg = args.at(0);
-              const auto* a_list_arg =
-                  std::get_if<EncodableList>(&encodable_a_list_arg);
-              api->EchoAsyncNullableList(
-                  a_list_arg,
-                  [reply](ErrorOr<std::optional<EncodableList>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableMap",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_map_arg = args.at(0);
-              const auto* a_map_arg =
-                  std::get_if<EncodableMap>(&encodable_a_map_arg);
-              api->EchoAsyncNullableMap(
-                  a_map_arg,
-                  [reply](ErrorOr<std::optional<EncodableMap>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "echoAsyncNullableEnum",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_enum_arg = args.at(0);
-              const int64_t an_enum_arg_value =
-                  encodable_an_enum_arg.IsNull()
-                      ? 0
-                      : encodable_an_enum_arg.LongValue();
-              const auto an_enum_arg =
-                  encodable_an_enum_arg.IsNull()
-                      ? std::nullopt
-                      : std::make_optional<AnEnum>(
-                            static_cast<AnEnum>(an_enum_arg_value));
-              api->EchoAsyncNullableEnum(
-                  an_enum_arg ? &(*an_enum_arg) : nullptr,
-                  [reply](ErrorOr<std::optional<AnEnum>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(EncodableValue(
-                          (int)std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterNoop",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->CallFlutterNoop(
-                  [reply](std::optional<FlutterError>&& output) {
-                    if (output.has_value()) {
-                      reply(WrapError(output.value()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(EncodableValue());
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterThrowError",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->CallFlutterThrowError(
-                  [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterThrowErrorFromVoid",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->CallFlutterThrowErrorFromVoid(
-                  [reply](std::optional<FlutterError>&& output) {
-                    if (output.has_value()) {
-                      reply(WrapError(output.value()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(EncodableValue());
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoAllTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_everything_arg = args.at(0);
-              if (encodable_everything_arg.IsNull()) {
-                reply(WrapError("everything_arg unexpectedly null."));
-                return;
-              }
-              const auto& everything_arg = std::any_cast<const AllTypes&>(
-                  std::get<CustomEncodableValue>(encodable_everything_arg));
-              api->CallFlutterEchoAllTypes(
-                  everything_arg, [reply](ErrorOr<AllTypes>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        CustomEncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoAllNullableTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_everything_arg = args.at(0);
-              const auto* everything_arg =
-                  &(std::any_cast<const AllNullableTypes&>(
-                      std::get<CustomEncodableValue>(
-                          encodable_everything_arg)));
-              api->CallFlutterEchoAllNullableTypes(
-                  everything_arg,
-                  [reply](ErrorOr<std::optional<AllNullableTypes>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(CustomEncodableValue(
-                          std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterSendMultipleNullableTypes",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_nullable_bool_arg = args.at(0);
-              const auto* a_nullable_bool_arg =
-                  std::get_if<bool>(&encodable_a_nullable_bool_arg);
-              const auto& encodable_a_nullable_int_arg = args.at(1);
-              const int64_t a_nullable_int_arg_value =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? 0
-                      : encodable_a_nullable_int_arg.LongValue();
-              const auto* a_nullable_int_arg =
-                  encodable_a_nullable_int_arg.IsNull()
-                      ? nullptr
-                      : &a_nullable_int_arg_value;
-              const auto& encodable_a_nullable_string_arg = args.at(2);
-              const auto* a_nullable_string_arg =
-                  std::get_if<std::string>(&encodable_a_nullable_string_arg);
-              api->CallFlutterSendMultipleNullableTypes(
-                  a_nullable_bool_arg, a_nullable_int_arg,
-                  a_nullable_string_arg,
-                  [reply](ErrorOr<AllNullableTypes>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        CustomEncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoBool",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_bool_arg = args.at(0);
-              if (encodable_a_bool_arg.IsNull()) {
-                reply(WrapError("a_bool_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_bool_arg = std::get<bool>(encodable_a_bool_arg);
-              api->CallFlutterEchoBool(
-                  a_bool_arg, [reply](ErrorOr<bool>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_int_arg = args.at(0);
-              if (encodable_an_int_arg.IsNull()) {
-                reply(WrapError("an_int_arg unexpectedly null."));
-                return;
-              }
-              const int64_t an_int_arg = encodable_an_int_arg.LongValue();
-              api->CallFlutterEchoInt(
-                  an_int_arg, [reply](ErrorOr<int64_t>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoDouble",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_double_arg = args.at(0);
-              if (encodable_a_double_arg.IsNull()) {
-                reply(WrapError("a_double_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_double_arg =
-                  std::get<double>(encodable_a_double_arg);
-              api->CallFlutterEchoDouble(
-                  a_double_arg, [reply](ErrorOr<double>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_string_arg = args.at(0);
-              if (encodable_a_string_arg.IsNull()) {
-                reply(WrapError("a_string_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_string_arg =
-                  std::get<std::string>(encodable_a_string_arg);
-              api->CallFlutterEchoString(
-                  a_string_arg, [reply](ErrorOr<std::string>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoUint8List",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_list_arg = args.at(0);
-              if (encodable_a_list_arg.IsNull()) {
-                reply(WrapError("a_list_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_list_arg =
-                  std::get<std::vector<uint8_t>>(encodable_a_list_arg);
-              api->CallFlutterEchoUint8List(
-                  a_list_arg, [reply](ErrorOr<std::vector<uint8_t>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoList",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_list_arg = args.at(0);
-              if (encodable_a_list_arg.IsNull()) {
-                reply(WrapError("a_list_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_list_arg =
-                  std::get<EncodableList>(encodable_a_list_arg);
-              api->CallFlutterEchoList(
-                  a_list_arg, [reply](ErrorOr<EncodableList>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoMap",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_map_arg = args.at(0);
-              if (encodable_a_map_arg.IsNull()) {
-                reply(WrapError("a_map_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_map_arg =
-                  std::get<EncodableMap>(encodable_a_map_arg);
-              api->CallFlutterEchoMap(
-                  a_map_arg, [reply](ErrorOr<EncodableMap>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue(std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoEnum",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_enum_arg = args.at(0);
-              if (encodable_an_enum_arg.IsNull()) {
-                reply(WrapError("an_enum_arg unexpectedly null."));
-                return;
-              }
-              const AnEnum& an_enum_arg =
-                  (AnEnum)encodable_an_enum_arg.LongValue();
-              api->CallFlutterEchoEnum(
-                  an_enum_arg, [reply](ErrorOr<AnEnum>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    wrapped.push_back(
-                        EncodableValue((int)std::move(output).TakeValue()));
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableBool",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_bool_arg = args.at(0);
-              const auto* a_bool_arg = std::get_if<bool>(&encodable_a_bool_arg);
-              api->CallFlutterEchoNullableBool(
-                  a_bool_arg, [reply](ErrorOr<std::optional<bool>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableInt",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_int_arg = args.at(0);
-              const int64_t an_int_arg_value =
-                  encodable_an_int_arg.IsNull()
-                      ? 0
-                      : encodable_an_int_arg.LongValue();
-              const auto* an_int_arg =
-                  encodable_an_int_arg.IsNull() ? nullptr : &an_int_arg_value;
-              api->CallFlutterEchoNullableInt(
-                  an_int_arg,
-                  [reply](ErrorOr<std::optional<int64_t>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableDouble",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_double_arg = args.at(0);
-              const auto* a_double_arg =
-                  std::get_if<double>(&encodable_a_double_arg);
-              api->CallFlutterEchoNullableDouble(
-                  a_double_arg,
-                  [reply](ErrorOr<std::optional<double>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableString",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_string_arg = args.at(0);
-              const auto* a_string_arg =
-                  std::get_if<std::string>(&encodable_a_string_arg);
-              api->CallFlutterEchoNullableString(
-                  a_string_arg,
-                  [reply](ErrorOr<std::optional<std::string>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
+    uint8_t type, flutter::ByteStreamReader* stream) const {
+  switch (type) {
+    case 128:
+      return CustomEncodableValue(AllClassesWrapper::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 129:
+      return CustomEncodableValue(AllNullableTypes::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 130:
+      return CustomEncodableValue(AllTypes::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    case 131:
+      return CustomEncodableValue(TestMessage::FromEncodableList(
+          std::get<EncodableList>(ReadValue(stream))));
+    default:
+      return flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
   }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableUint8List",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_list_arg = args.at(0);
-              const auto* a_list_arg =
-                  std::get_if<std::vector<uint8_t>>(&encodable_a_list_arg);
-              api->CallFlutterEchoNullableUint8List(
-                  a_list_arg,
-                  [reply](
-                      ErrorOr<std::optional<std::vector<uint8_t>>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
+}
+
+void HostIntegrationCoreApiCodecSerializer::WriteValue(
+    const EncodableValue& value, flutter::ByteStreamWriter* stream) const {
+  if (const CustomEncodableValue* custom_value =
+          std::get_if<CustomEncodableValue>(&value)) {
+    if (custom_value->type() == typeid(AllClassesWrapper)) {
+      stream->WriteByte(128);
+      std::any_cast<const AllClassesWrapper&>(*custom_value)
+          .WriteEncodableList(*this, stream);
+      return;
     }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableList",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_list_arg = args.at(0);
-              const auto* a_list_arg =
-                  std::get_if<EncodableList>(&encodable_a_list_arg);
-              api->CallFlutterEchoNullableList(
-                  a_list_arg,
-                  [reply](ErrorOr<std::optional<EncodableList>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
+    if (custom_value->type() == typeid(AllNullableTypes)) {
+      stream->WriteByte(129);
+      std::any_cast<const AllNullableTypes&>(*custom_value)
+          .WriteEncodableList(*this, stream);
+      return;
     }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableMap",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_map_arg = args.at(0);
-              const auto* a_map_arg =
-                  std::get_if<EncodableMap>(&encodable_a_map_arg);
-              api->CallFlutterEchoNullableMap(
-                  a_map_arg,
-                  [reply](ErrorOr<std::optional<EncodableMap>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(
-                          EncodableValue(std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
+    if (custom_value->type() == typeid(AllTypes)) {
+      stream->WriteByte(130);
+      std::any_cast<const AllTypes&>(*custom_value)
+          .WriteEncodableList(*this, stream);
+      return;
     }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
-        "callFlutterEchoNullableEnum",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_an_enum_arg = args.at(0);
-              const int64_t an_enum_arg_value =
-                  encodable_an_enum_arg.IsNull()
-                      ? 0
-                      : encodable_an_enum_arg.LongValue();
-              const auto an_enum_arg =
-                  encodable_an_enum_arg.IsNull()
-                      ? std::nullopt
-                      : std::make_optional<AnEnum>(
-                            static_cast<AnEnum>(an_enum_arg_value));
-              api->CallFlutterEchoNullableEnum(
-                  an_enum_arg ? &(*an_enum_arg) : nullptr,
-                  [reply](ErrorOr<std::optional<AnEnum>>&& output) {
-                    if (output.has_error()) {
-                      reply(WrapError(output.error()));
-                      return;
-                    }
-                    EncodableList wrapped;
-                    auto output_optional = std::move(output).TakeValue();
-                    if (output_optional) {
-                      wrapped.push_back(EncodableValue(
-                          (int)std::move(output_optional).value()));
-                    } else {
-                      wrapped.push_back(EncodableValue());
-                    }
-                    reply(EncodableValue(std::move(wrapped)));
-                  });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
+    if (custom_value->type() == typeid(TestMessage)) {
+      stream->WriteByte(131);
+      std::any_cast<const TestMessage&>(*custom_value)
+          .WriteEncodableList(*this, stream);
+      return;
     }
   }
+  flutter::StandardCodecSerializer::WriteValue(value, stream);
+}
+
+/// The codec used by HostIntegrationCoreApi.
+const flutter::StandardMessageCodec& HostIntegrationCoreApi::GetCodec() {
+  return flutter::StandardMessageCodec::GetInstance(
+      &HostIntegrationCoreApiCodecSerializer::GetInstance());
+}
+
+// Sets up an instance of `HostIntegrationCoreApi` to handle messages through
+// the `binary_messenger`.
+void HostIntegrationCoreApi::SetUp(flutter::BinaryMessenger* binary_messenger,
+                                   HostIntegrationCoreApi* api) {
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "noop",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        PigeonReply(reply, host_api->Noop());
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAllTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_everything_arg = args.at(0);
+        if (encodable_everything_arg.IsNull()) {
+          reply(WrapError("everything_arg unexpectedly null."));
+          return;
+        }
+        const auto& everything_arg = std::any_cast<const AllTypes&>(
+            std::get<CustomEncodableValue>(encodable_everything_arg));
+        PigeonReply<CustomEncodableValue>(
+            reply, host_api->EchoAllTypes(everything_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "throwError",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        PigeonReply<EncodableValue>(reply, host_api->ThrowError());
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "throwErrorFromVoid",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        PigeonReply(reply, host_api->ThrowErrorFromVoid());
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "throwFlutterError",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        PigeonReply<EncodableValue>(reply, host_api->ThrowFlutterError());
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_int_arg = args.at(0);
+        if (encodable_an_int_arg.IsNull()) {
+          reply(WrapError("an_int_arg unexpectedly null."));
+          return;
+        }
+        const int64_t an_int_arg = encodable_an_int_arg.LongValue();
+        PigeonReply<EncodableValue>(reply, host_api->EchoInt(an_int_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoDouble",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_double_arg = args.at(0);
+        if (encodable_a_double_arg.IsNull()) {
+          reply(WrapError("a_double_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_double_arg =
+            std::get<double>(encodable_a_double_arg);
+        PigeonReply<EncodableValue>(reply, host_api->EchoDouble(a_double_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoBool",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_bool_arg = args.at(0);
+        if (encodable_a_bool_arg.IsNull()) {
+          reply(WrapError("a_bool_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_bool_arg = std::get<bool>(encodable_a_bool_arg);
+        PigeonReply<EncodableValue>(reply, host_api->EchoBool(a_bool_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_string_arg = args.at(0);
+        if (encodable_a_string_arg.IsNull()) {
+          reply(WrapError("a_string_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_string_arg =
+            std::get<std::string>(encodable_a_string_arg);
+        PigeonReply<EncodableValue>(reply, host_api->EchoString(a_string_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoUint8List",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_uint8_list_arg = args.at(0);
+        if (encodable_a_uint8_list_arg.IsNull()) {
+          reply(WrapError("a_uint8_list_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_uint8_list_arg =
+            std::get<std::vector<uint8_t>>(encodable_a_uint8_list_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoUint8List(a_uint8_list_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoObject",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_object_arg = args.at(0);
+        if (encodable_an_object_arg.IsNull()) {
+          reply(WrapError("an_object_arg unexpectedly null."));
+          return;
+        }
+        const auto& an_object_arg = encodable_an_object_arg;
+        PigeonReply<EncodableValue>(reply, host_api->EchoObject(an_object_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoList",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_list_arg = args.at(0);
+        if (encodable_a_list_arg.IsNull()) {
+          reply(WrapError("a_list_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_list_arg =
+            std::get<EncodableList>(encodable_a_list_arg);
+        PigeonReply<EncodableValue>(reply, host_api->EchoList(a_list_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoMap",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_map_arg = args.at(0);
+        if (encodable_a_map_arg.IsNull()) {
+          reply(WrapError("a_map_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_map_arg =
+            std::get<EncodableMap>(encodable_a_map_arg);
+        PigeonReply<EncodableValue>(reply, host_api->EchoMap(a_map_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoClassWrapper",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_wrapper_arg = args.at(0);
+        if (encodable_wrapper_arg.IsNull()) {
+          reply(WrapError("wrapper_arg unexpectedly null."));
+          return;
+        }
+        const auto& wrapper_arg = std::any_cast<const AllClassesWrapper&>(
+            std::get<CustomEncodableValue>(encodable_wrapper_arg));
+        PigeonReply<CustomEncodableValue>(
+            reply, host_api->EchoClassWrapper(wrapper_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoEnum",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_enum_arg = args.at(0);
+        if (encodable_an_enum_arg.IsNull()) {
+          reply(WrapError("an_enum_arg unexpectedly null."));
+          return;
+        }
+        const AnEnum& an_enum_arg =
+            (AnEnum)encodable_an_enum_arg.LongValue();
+        PigeonReply<EncodableValue>(reply, host_api->EchoEnum(an_enum_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNamedDefaultString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_string_arg = args.at(0);
+        if (encodable_a_string_arg.IsNull()) {
+          reply(WrapError("a_string_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_string_arg =
+            std::get<std::string>(encodable_a_string_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNamedDefaultString(a_string_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoOptionalDefaultDouble",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_double_arg = args.at(0);
+        if (encodable_a_double_arg.IsNull()) {
+          reply(WrapError("a_double_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_double_arg =
+            std::get<double>(encodable_a_double_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoOptionalDefaultDouble(a_double_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoRequiredInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_int_arg = args.at(0);
+        if (encodable_an_int_arg.IsNull()) {
+          reply(WrapError("an_int_arg unexpectedly null."));
+          return;
+        }
+        const int64_t an_int_arg = encodable_an_int_arg.LongValue();
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoRequiredInt(an_int_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAllNullableTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_everything_arg = args.at(0);
+        const auto* everything_arg =
+            &(std::any_cast<const AllNullableTypes&>(
+                std::get<CustomEncodableValue>(
+                    encodable_everything_arg)));
+        PigeonReply<CustomEncodableValue>(
+            reply, host_api->EchoAllNullableTypes(everything_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "extractNestedNullableString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_wrapper_arg = args.at(0);
+        if (encodable_wrapper_arg.IsNull()) {
+          reply(WrapError("wrapper_arg unexpectedly null."));
+          return;
+        }
+        const auto& wrapper_arg = std::any_cast<const AllClassesWrapper&>(
+            std::get<CustomEncodableValue>(encodable_wrapper_arg));
+        PigeonReply<EncodableValue>(
+            reply, host_api->ExtractNestedNullableString(wrapper_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "createNestedNullableString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_nullable_string_arg = args.at(0);
+        const auto* nullable_string_arg =
+            std::get_if<std::string>(&encodable_nullable_string_arg);
+        PigeonReply<CustomEncodableValue>(
+            reply, host_api->CreateNestedNullableString(nullable_string_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "sendMultipleNullableTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_bool_arg = args.at(0);
+        const auto* a_nullable_bool_arg =
+            std::get_if<bool>(&encodable_a_nullable_bool_arg);
+        const auto& encodable_a_nullable_int_arg = args.at(1);
+        const int64_t a_nullable_int_arg_value =
+            encodable_a_nullable_int_arg.IsNull()
+                ? 0
+                : encodable_a_nullable_int_arg.LongValue();
+        const auto* a_nullable_int_arg =
+            encodable_a_nullable_int_arg.IsNull()
+                ? nullptr
+                : &a_nullable_int_arg_value;
+        const auto& encodable_a_nullable_string_arg = args.at(2);
+        const auto* a_nullable_string_arg =
+            std::get_if<std::string>(&encodable_a_nullable_string_arg);
+        PigeonReply<CustomEncodableValue>(
+            reply, host_api->SendMultipleNullableTypes(a_nullable_bool_arg,
+                                                       a_nullable_int_arg,
+                                                       a_nullable_string_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_int_arg = args.at(0);
+        const int64_t a_nullable_int_arg_value =
+            encodable_a_nullable_int_arg.IsNull()
+                ? 0
+                : encodable_a_nullable_int_arg.LongValue();
+        const auto* a_nullable_int_arg =
+            encodable_a_nullable_int_arg.IsNull()
+                ? nullptr
+                : &a_nullable_int_arg_value;
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableInt(a_nullable_int_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableDouble",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_double_arg = args.at(0);
+        const auto* a_nullable_double_arg =
+            std::get_if<double>(&encodable_a_nullable_double_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableDouble(a_nullable_double_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableBool",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_bool_arg = args.at(0);
+        const auto* a_nullable_bool_arg =
+            std::get_if<bool>(&encodable_a_nullable_bool_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableBool(a_nullable_bool_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_string_arg = args.at(0);
+        const auto* a_nullable_string_arg =
+            std::get_if<std::string>(&encodable_a_nullable_string_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableString(a_nullable_string_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableUint8List",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_uint8_list_arg = args.at(0);
+        const auto* a_nullable_uint8_list_arg =
+            std::get_if<std::vector<uint8_t>>(
+                &encodable_a_nullable_uint8_list_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableUint8List(a_nullable_uint8_list_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableObject",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_object_arg = args.at(0);
+        const auto* a_nullable_object_arg =
+            &encodable_a_nullable_object_arg;
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableObject(a_nullable_object_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableList",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_list_arg = args.at(0);
+        const auto* a_nullable_list_arg =
+            std::get_if<EncodableList>(&encodable_a_nullable_list_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableList(a_nullable_list_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableMap",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_map_arg = args.at(0);
+        const auto* a_nullable_map_arg =
+            std::get_if<EncodableMap>(&encodable_a_nullable_map_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableMap(a_nullable_map_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNullableEnum",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_enum_arg = args.at(0);
+        const int64_t an_enum_arg_value =
+            encodable_an_enum_arg.IsNull()
+                ? 0
+                : encodable_an_enum_arg.LongValue();
+        const auto an_enum_arg =
+            encodable_an_enum_arg.IsNull()
+                ? std::nullopt
+                : std::make_optional<AnEnum>(
+                      static_cast<AnEnum>(an_enum_arg_value));
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNullableEnum(an_enum_arg ? &(*an_enum_arg)
+                                                          : nullptr));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoOptionalNullableInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_int_arg = args.at(0);
+        const int64_t a_nullable_int_arg_value =
+            encodable_a_nullable_int_arg.IsNull()
+                ? 0
+                : encodable_a_nullable_int_arg.LongValue();
+        const auto* a_nullable_int_arg =
+            encodable_a_nullable_int_arg.IsNull()
+                ? nullptr
+                : &a_nullable_int_arg_value;
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoOptionalNullableInt(a_nullable_int_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoNamedNullableString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_string_arg = args.at(0);
+        const auto* a_nullable_string_arg =
+            std::get_if<std::string>(&encodable_a_nullable_string_arg);
+        PigeonReply<EncodableValue>(
+            reply, host_api->EchoNamedNullableString(a_nullable_string_arg));
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "noopAsync",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->NoopAsync([reply](std::optional<FlutterError>&& output) {
+          PigeonReply(reply, std::move(output));
+        });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_int_arg = args.at(0);
+        if (encodable_an_int_arg.IsNull()) {
+          reply(WrapError("an_int_arg unexpectedly null."));
+          return;
+        }
+        const int64_t an_int_arg = encodable_an_int_arg.LongValue();
+        host_api->EchoAsyncInt(an_int_arg, [reply](ErrorOr<int64_t>&& output) {
+          PigeonReply<EncodableValue>(reply, std::move(output));
+        });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncDouble",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_double_arg = args.at(0);
+        if (encodable_a_double_arg.IsNull()) {
+          reply(WrapError("a_double_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_double_arg =
+            std::get<double>(encodable_a_double_arg);
+        host_api->EchoAsyncDouble(
+            a_double_arg, [reply](ErrorOr<double>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncBool",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_bool_arg = args.at(0);
+        if (encodable_a_bool_arg.IsNull()) {
+          reply(WrapError("a_bool_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_bool_arg = std::get<bool>(encodable_a_bool_arg);
+        host_api->EchoAsyncBool(a_bool_arg, [reply](ErrorOr<bool>&& output) {
+          PigeonReply<EncodableValue>(reply, std::move(output));
+        });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_string_arg = args.at(0);
+        if (encodable_a_string_arg.IsNull()) {
+          reply(WrapError("a_string_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_string_arg =
+            std::get<std::string>(encodable_a_string_arg);
+        host_api->EchoAsyncString(
+            a_string_arg, [reply](ErrorOr<std::string>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncUint8List",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_uint8_list_arg = args.at(0);
+        if (encodable_a_uint8_list_arg.IsNull()) {
+          reply(WrapError("a_uint8_list_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_uint8_list_arg =
+            std::get<std::vector<uint8_t>>(encodable_a_uint8_list_arg);
+        host_api->EchoAsyncUint8List(
+            a_uint8_list_arg,
+            [reply](ErrorOr<std::vector<uint8_t>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncObject",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_object_arg = args.at(0);
+        if (encodable_an_object_arg.IsNull()) {
+          reply(WrapError("an_object_arg unexpectedly null."));
+          return;
+        }
+        const auto& an_object_arg = encodable_an_object_arg;
+        host_api->EchoAsyncObject(
+            an_object_arg, [reply](ErrorOr<EncodableValue>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncList",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_list_arg = args.at(0);
+        if (encodable_a_list_arg.IsNull()) {
+          reply(WrapError("a_list_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_list_arg =
+            std::get<EncodableList>(encodable_a_list_arg);
+        host_api->EchoAsyncList(
+            a_list_arg, [reply](ErrorOr<EncodableList>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncMap",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_map_arg = args.at(0);
+        if (encodable_a_map_arg.IsNull()) {
+          reply(WrapError("a_map_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_map_arg =
+            std::get<EncodableMap>(encodable_a_map_arg);
+        host_api->EchoAsyncMap(
+            a_map_arg, [reply](ErrorOr<EncodableMap>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncEnum",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_enum_arg = args.at(0);
+        if (encodable_an_enum_arg.IsNull()) {
+          reply(WrapError("an_enum_arg unexpectedly null."));
+          return;
+        }
+        const AnEnum& an_enum_arg =
+            (AnEnum)encodable_an_enum_arg.LongValue();
+        host_api->EchoAsyncEnum(
+            an_enum_arg, [reply](ErrorOr<AnEnum>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "throwAsyncError",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->ThrowAsyncError(
+            [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "throwAsyncErrorFromVoid",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->ThrowAsyncErrorFromVoid(
+            [reply](std::optional<FlutterError>&& output) {
+              PigeonReply(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "throwAsyncFlutterError",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->ThrowAsyncFlutterError(
+            [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncAllTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_everything_arg = args.at(0);
+        if (encodable_everything_arg.IsNull()) {
+          reply(WrapError("everything_arg unexpectedly null."));
+          return;
+        }
+        const auto& everything_arg = std::any_cast<const AllTypes&>(
+            std::get<CustomEncodableValue>(encodable_everything_arg));
+        host_api->EchoAsyncAllTypes(
+            everything_arg, [reply](ErrorOr<AllTypes>&& output) {
+              PigeonReply<CustomEncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableAllNullableTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_everything_arg = args.at(0);
+        const auto* everything_arg =
+            &(std::any_cast<const AllNullableTypes&>(
+                std::get<CustomEncodableValue>(
+                    encodable_everything_arg)));
+        host_api->EchoAsyncNullableAllNullableTypes(
+            everything_arg,
+            [reply](ErrorOr<std::optional<AllNullableTypes>>&& output) {
+              PigeonReply<CustomEncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_int_arg = args.at(0);
+        const int64_t an_int_arg_value =
+            encodable_an_int_arg.IsNull()
+                ? 0
+                : encodable_an_int_arg.LongValue();
+        const auto* an_int_arg =
+            encodable_an_int_arg.IsNull() ? nullptr : &an_int_arg_value;
+        host_api->EchoAsyncNullableInt(
+            an_int_arg,
+            [reply](ErrorOr<std::optional<int64_t>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableDouble",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_double_arg = args.at(0);
+        const auto* a_double_arg =
+            std::get_if<double>(&encodable_a_double_arg);
+        host_api->EchoAsyncNullableDouble(
+            a_double_arg,
+            [reply](ErrorOr<std::optional<double>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableBool",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_bool_arg = args.at(0);
+        const auto* a_bool_arg = std::get_if<bool>(&encodable_a_bool_arg);
+        host_api->EchoAsyncNullableBool(
+            a_bool_arg, [reply](ErrorOr<std::optional<bool>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_string_arg = args.at(0);
+        const auto* a_string_arg =
+            std::get_if<std::string>(&encodable_a_string_arg);
+        host_api->EchoAsyncNullableString(
+            a_string_arg,
+            [reply](ErrorOr<std::optional<std::string>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableUint8List",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_uint8_list_arg = args.at(0);
+        const auto* a_uint8_list_arg = std::get_if<std::vector<uint8_t>>(
+            &encodable_a_uint8_list_arg);
+        host_api->EchoAsyncNullableUint8List(
+            a_uint8_list_arg,
+            [reply](
+                ErrorOr<std::optional<std::vector<uint8_t>>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableObject",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_object_arg = args.at(0);
+        const auto* an_object_arg = &encodable_an_object_arg;
+        host_api->EchoAsyncNullableObject(
+            an_object_arg,
+            [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableList",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_list_arg = args.at(0);
+        const auto* a_list_arg =
+            std::get_if<EncodableList>(&encodable_a_list_arg);
+        host_api->EchoAsyncNullableList(
+            a_list_arg,
+            [reply](ErrorOr<std::optional<EncodableList>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableMap",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_map_arg = args.at(0);
+        const auto* a_map_arg =
+            std::get_if<EncodableMap>(&encodable_a_map_arg);
+        host_api->EchoAsyncNullableMap(
+            a_map_arg,
+            [reply](ErrorOr<std::optional<EncodableMap>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "echoAsyncNullableEnum",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_enum_arg = args.at(0);
+        const int64_t an_enum_arg_value =
+            encodable_an_enum_arg.IsNull()
+                ? 0
+                : encodable_an_enum_arg.LongValue();
+        const auto an_enum_arg =
+            encodable_an_enum_arg.IsNull()
+                ? std::nullopt
+                : std::make_optional<AnEnum>(
+                      static_cast<AnEnum>(an_enum_arg_value));
+        host_api->EchoAsyncNullableEnum(
+            an_enum_arg ? &(*an_enum_arg) : nullptr,
+            [reply](ErrorOr<std::optional<AnEnum>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterNoop",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->CallFlutterNoop(
+            [reply](std::optional<FlutterError>&& output) {
+              PigeonReply(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterThrowError",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->CallFlutterThrowError(
+            [reply](ErrorOr<std::optional<EncodableValue>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterThrowErrorFromVoid",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->CallFlutterThrowErrorFromVoid(
+            [reply](std::optional<FlutterError>&& output) {
+              PigeonReply(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoAllTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_everything_arg = args.at(0);
+        if (encodable_everything_arg.IsNull()) {
+          reply(WrapError("everything_arg unexpectedly null."));
+          return;
+        }
+        const auto& everything_arg = std::any_cast<const AllTypes&>(
+            std::get<CustomEncodableValue>(encodable_everything_arg));
+        host_api->CallFlutterEchoAllTypes(
+            everything_arg, [reply](ErrorOr<AllTypes>&& output) {
+              PigeonReply<CustomEncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoAllNullableTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_everything_arg = args.at(0);
+        const auto* everything_arg =
+            &(std::any_cast<const AllNullableTypes&>(
+                std::get<CustomEncodableValue>(
+                    encodable_everything_arg)));
+        host_api->CallFlutterEchoAllNullableTypes(
+            everything_arg,
+            [reply](ErrorOr<std::optional<AllNullableTypes>>&& output) {
+              PigeonReply<CustomEncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterSendMultipleNullableTypes",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_nullable_bool_arg = args.at(0);
+        const auto* a_nullable_bool_arg =
+            std::get_if<bool>(&encodable_a_nullable_bool_arg);
+        const auto& encodable_a_nullable_int_arg = args.at(1);
+        const int64_t a_nullable_int_arg_value =
+            encodable_a_nullable_int_arg.IsNull()
+                ? 0
+                : encodable_a_nullable_int_arg.LongValue();
+        const auto* a_nullable_int_arg =
+            encodable_a_nullable_int_arg.IsNull()
+                ? nullptr
+                : &a_nullable_int_arg_value;
+        const auto& encodable_a_nullable_string_arg = args.at(2);
+        const auto* a_nullable_string_arg =
+            std::get_if<std::string>(&encodable_a_nullable_string_arg);
+        host_api->CallFlutterSendMultipleNullableTypes(
+            a_nullable_bool_arg, a_nullable_int_arg,
+            a_nullable_string_arg,
+            [reply](ErrorOr<AllNullableTypes>&& output) {
+              PigeonReply<CustomEncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoBool",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_bool_arg = args.at(0);
+        if (encodable_a_bool_arg.IsNull()) {
+          reply(WrapError("a_bool_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_bool_arg = std::get<bool>(encodable_a_bool_arg);
+        host_api->CallFlutterEchoBool(
+            a_bool_arg, [reply](ErrorOr<bool>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_int_arg = args.at(0);
+        if (encodable_an_int_arg.IsNull()) {
+          reply(WrapError("an_int_arg unexpectedly null."));
+          return;
+        }
+        const int64_t an_int_arg = encodable_an_int_arg.LongValue();
+        host_api->CallFlutterEchoInt(
+            an_int_arg, [reply](ErrorOr<int64_t>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoDouble",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_double_arg = args.at(0);
+        if (encodable_a_double_arg.IsNull()) {
+          reply(WrapError("a_double_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_double_arg =
+            std::get<double>(encodable_a_double_arg);
+        host_api->CallFlutterEchoDouble(
+            a_double_arg, [reply](ErrorOr<double>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_string_arg = args.at(0);
+        if (encodable_a_string_arg.IsNull()) {
+          reply(WrapError("a_string_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_string_arg =
+            std::get<std::string>(encodable_a_string_arg);
+        host_api->CallFlutterEchoString(
+            a_string_arg, [reply](ErrorOr<std::string>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoUint8List",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_list_arg = args.at(0);
+        if (encodable_a_list_arg.IsNull()) {
+          reply(WrapError("a_list_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_list_arg =
+            std::get<std::vector<uint8_t>>(encodable_a_list_arg);
+        host_api->CallFlutterEchoUint8List(
+            a_list_arg, [reply](ErrorOr<std::vector<uint8_t>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoList",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_list_arg = args.at(0);
+        if (encodable_a_list_arg.IsNull()) {
+          reply(WrapError("a_list_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_list_arg =
+            std::get<EncodableList>(encodable_a_list_arg);
+        host_api->CallFlutterEchoList(
+            a_list_arg, [reply](ErrorOr<EncodableList>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoMap",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_map_arg = args.at(0);
+        if (encodable_a_map_arg.IsNull()) {
+          reply(WrapError("a_map_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_map_arg =
+            std::get<EncodableMap>(encodable_a_map_arg);
+        host_api->CallFlutterEchoMap(
+            a_map_arg, [reply](ErrorOr<EncodableMap>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoEnum",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_enum_arg = args.at(0);
+        if (encodable_an_enum_arg.IsNull()) {
+          reply(WrapError("an_enum_arg unexpectedly null."));
+          return;
+        }
+        const AnEnum& an_enum_arg =
+            (AnEnum)encodable_an_enum_arg.LongValue();
+        host_api->CallFlutterEchoEnum(
+            an_enum_arg, [reply](ErrorOr<AnEnum>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableBool",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_bool_arg = args.at(0);
+        const auto* a_bool_arg = std::get_if<bool>(&encodable_a_bool_arg);
+        host_api->CallFlutterEchoNullableBool(
+            a_bool_arg, [reply](ErrorOr<std::optional<bool>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableInt",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_int_arg = args.at(0);
+        const int64_t an_int_arg_value =
+            encodable_an_int_arg.IsNull()
+                ? 0
+                : encodable_an_int_arg.LongValue();
+        const auto* an_int_arg =
+            encodable_an_int_arg.IsNull() ? nullptr : &an_int_arg_value;
+        host_api->CallFlutterEchoNullableInt(
+            an_int_arg,
+            [reply](ErrorOr<std::optional<int64_t>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableDouble",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_double_arg = args.at(0);
+        const auto* a_double_arg =
+            std::get_if<double>(&encodable_a_double_arg);
+        host_api->CallFlutterEchoNullableDouble(
+            a_double_arg,
+            [reply](ErrorOr<std::optional<double>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableString",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_string_arg = args.at(0);
+        const auto* a_string_arg =
+            std::get_if<std::string>(&encodable_a_string_arg);
+        host_api->CallFlutterEchoNullableString(
+            a_string_arg,
+            [reply](ErrorOr<std::optional<std::string>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableUint8List",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_list_arg = args.at(0);
+        const auto* a_list_arg =
+            std::get_if<std::vector<uint8_t>>(&encodable_a_list_arg);
+        host_api->CallFlutterEchoNullableUint8List(
+            a_list_arg,
+            [reply](
+                ErrorOr<std::optional<std::vector<uint8_t>>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableList",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_list_arg = args.at(0);
+        const auto* a_list_arg =
+            std::get_if<EncodableList>(&encodable_a_list_arg);
+        host_api->CallFlutterEchoNullableList(
+            a_list_arg,
+            [reply](ErrorOr<std::optional<EncodableList>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableMap",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_map_arg = args.at(0);
+        const auto* a_map_arg =
+            std::get_if<EncodableMap>(&encodable_a_map_arg);
+        host_api->CallFlutterEchoNullableMap(
+            a_map_arg,
+            [reply](ErrorOr<std::optional<EncodableMap>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
+  PigeonSetUpHostMethod<HostIntegrationCoreApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi."
+      "callFlutterEchoNullableEnum",
+      &GetCodec(), api,
+      [](HostIntegrationCoreApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_an_enum_arg = args.at(0);
+        const int64_t an_enum_arg_value =
+            encodable_an_enum_arg.IsNull()
+                ? 0
+                : encodable_an_enum_arg.LongValue();
+        const auto an_enum_arg =
+            encodable_an_enum_arg.IsNull()
+                ? std::nullopt
+                : std::make_optional<AnEnum>(
+                      static_cast<AnEnum>(an_enum_arg_value));
+        host_api->CallFlutterEchoNullableEnum(
+            an_enum_arg ? &(*an_enum_arg) : nullptr,
+            [reply](ErrorOr<std::optional<AnEnum>>&& output) {
+              PigeonReply<EncodableValue>(reply, std::move(output));
+            });
+      });
 }
 
 EncodableValue HostIntegrationCoreApi::WrapError(
@@ -3732,9 +2593,7 @@ EncodableValue HostIntegrationCoreApi::WrapError(
 }
 
 EncodableValue HostIntegrationCoreApi::WrapError(const FlutterError& error) {
-  return EncodableValue(EncodableList{EncodableValue(error.code()),
-                                      EncodableValue(error.message()),
-                                      error.details()});
+  return PigeonWrapError(error);
 }
 
 FlutterIntegrationCoreApiCodecSerializer::
@@ -3766,32 +2625,26 @@ void FlutterIntegrationCoreApiCodecSerializer::WriteValue(
           std::get_if<CustomEncodableValue>(&value)) {
     if (custom_value->type() == typeid(AllClassesWrapper)) {
       stream->WriteByte(128);
-      WriteValue(EncodableValue(std::any_cast<AllClassesWrapper>(*custom_value)
-                                    .ToEncodableList()),
-                 stream);
+      std::any_cast<const AllClassesWrapper&>(*custom_value)
+          .WriteEncodableList(*this, stream);
       return;
     }
     if (custom_value->type() == typeid(AllNullableTypes)) {
       stream->WriteByte(129);
-      WriteValue(
-          EncodableValue(
-              std::any_cast<AllNullableTypes>(*custom_value).ToEncodableList()),
-          stream);
+      std::any_cast<const AllNullableTypes&>(*custom_value)
+          .WriteEncodableList(*this, stream);
       return;
     }
     if (custom_value->type() == typeid(AllTypes)) {
       stream->WriteByte(130);
-      WriteValue(EncodableValue(
-                     std::any_cast<AllTypes>(*custom_value).ToEncodableList()),
-                 stream);
+      std::any_cast<const AllTypes&>(*custom_value)
+          .WriteEncodableList(*this, stream);
       return;
     }
     if (custom_value->type() == typeid(TestMessage)) {
       stream->WriteByte(131);
-      WriteValue(
-          EncodableValue(
-              std::any_cast<TestMessage>(*custom_value).ToEncodableList()),
-          stream);
+      std::any_cast<const TestMessage&>(*custom_value)
+          .WriteEncodableList(*this, stream);
       return;
     }
   }
@@ -3815,16 +2668,25 @@ void FlutterIntegrationCoreApi::Noop(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "noop";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue();
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -3848,16 +2710,25 @@ void FlutterIntegrationCoreApi::ThrowError(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "throwError";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue();
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -3882,16 +2753,25 @@ void FlutterIntegrationCoreApi::ThrowErrorFromVoid(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "throwErrorFromVoid";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue();
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -3916,18 +2796,27 @@ void FlutterIntegrationCoreApi::EchoAllTypes(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoAllTypes";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       CustomEncodableValue(everything_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -3954,18 +2843,27 @@ void FlutterIntegrationCoreApi::EchoAllNullableTypes(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoAllNullableTypes";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       everything_arg ? CustomEncodableValue(*everything_arg) : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -3993,8 +2891,6 @@ void FlutterIntegrationCoreApi::SendMultipleNullableTypes(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "sendMultipleNullableTypes";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_nullable_bool_arg ? EncodableValue(*a_nullable_bool_arg)
                           : EncodableValue(),
@@ -4003,13 +2899,24 @@ void FlutterIntegrationCoreApi::SendMultipleNullableTypes(
       a_nullable_string_arg ? EncodableValue(*a_nullable_string_arg)
                             : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4035,18 +2942,27 @@ void FlutterIntegrationCoreApi::EchoBool(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoBool";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_bool_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4071,18 +2987,27 @@ void FlutterIntegrationCoreApi::EchoInt(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoInt";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(an_int_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4107,19 +3032,26 @@ void FlutterIntegrationCoreApi::EchoDouble(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoDouble";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_double_arg),
   });
-  channel->Send(encoded_api_arguments, [channel_name,
-                                        on_success = std::move(on_success),
-                                        on_error = std::move(on_error)](
-                                           const uint8_t* reply,
-                                           size_t reply_size) {
-    std::unique_ptr<EncodableValue> response =
-        GetCodec().DecodeMessage(reply, reply_size);
-    const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(channel_name, writer.data(), writer.size(),
+                          [channel_name, on_success = std::move(on_success),
+                           on_error = std::move(on_error)](
+                              const uint8_t* reply, size_t reply_size) {
+    EncodableValue encodable_return_value;
+    if (reply_size > 0) {
+      MessageReader reader(reply, reply_size);
+      EncodableValue value =
+          FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+              &reader);
+      if (!reader.has_error()) {
+        encodable_return_value = std::move(value);
+      }
+    }
     const auto* list_return_value =
         std::get_if<EncodableList>(&encodable_return_value);
     if (list_return_value) {
@@ -4144,18 +3076,27 @@ void FlutterIntegrationCoreApi::EchoString(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoString";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_string_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4182,18 +3123,27 @@ void FlutterIntegrationCoreApi::EchoUint8List(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoUint8List";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_list_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4220,18 +3170,27 @@ void FlutterIntegrationCoreApi::EchoList(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoList";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_list_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4258,18 +3217,27 @@ void FlutterIntegrationCoreApi::EchoMap(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoMap";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_map_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4295,18 +3263,27 @@ void FlutterIntegrationCoreApi::EchoEnum(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoEnum";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue((int)an_enum_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4332,19 +3309,26 @@ void FlutterIntegrationCoreApi::EchoNullableBool(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableBool";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_bool_arg ? EncodableValue(*a_bool_arg) : EncodableValue(),
   });
-  channel->Send(encoded_api_arguments, [channel_name,
-                                        on_success = std::move(on_success),
-                                        on_error = std::move(on_error)](
-                                           const uint8_t* reply,
-                                           size_t reply_size) {
-    std::unique_ptr<EncodableValue> response =
-        GetCodec().DecodeMessage(reply, reply_size);
-    const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(channel_name, writer.data(), writer.size(),
+                          [channel_name, on_success = std::move(on_success),
+                           on_error = std::move(on_error)](
+                              const uint8_t* reply, size_t reply_size) {
+    EncodableValue encodable_return_value;
+    if (reply_size > 0) {
+      MessageReader reader(reply, reply_size);
+      EncodableValue value =
+          FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+              &reader);
+      if (!reader.has_error()) {
+        encodable_return_value = std::move(value);
+      }
+    }
     const auto* list_return_value =
         std::get_if<EncodableList>(&encodable_return_value);
     if (list_return_value) {
@@ -4368,19 +3352,26 @@ void FlutterIntegrationCoreApi::EchoNullableInt(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableInt";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       an_int_arg ? EncodableValue(*an_int_arg) : EncodableValue(),
   });
-  channel->Send(encoded_api_arguments, [channel_name,
-                                        on_success = std::move(on_success),
-                                        on_error = std::move(on_error)](
-                                           const uint8_t* reply,
-                                           size_t reply_size) {
-    std::unique_ptr<EncodableValue> response =
-        GetCodec().DecodeMessage(reply, reply_size);
-    const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(channel_name, writer.data(), writer.size(),
+                          [channel_name, on_success = std::move(on_success),
+                           on_error = std::move(on_error)](
+                              const uint8_t* reply, size_t reply_size) {
+    EncodableValue encodable_return_value;
+    if (reply_size > 0) {
+      MessageReader reader(reply, reply_size);
+      EncodableValue value =
+          FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+              &reader);
+      if (!reader.has_error()) {
+        encodable_return_value = std::move(value);
+      }
+    }
     const auto* list_return_value =
         std::get_if<EncodableList>(&encodable_return_value);
     if (list_return_value) {
@@ -4409,18 +3400,27 @@ void FlutterIntegrationCoreApi::EchoNullableDouble(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableDouble";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_double_arg ? EncodableValue(*a_double_arg) : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4447,18 +3447,27 @@ void FlutterIntegrationCoreApi::EchoNullableString(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableString";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_string_arg ? EncodableValue(*a_string_arg) : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4485,18 +3494,27 @@ void FlutterIntegrationCoreApi::EchoNullableUint8List(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableUint8List";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_list_arg ? EncodableValue(*a_list_arg) : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4523,18 +3541,27 @@ void FlutterIntegrationCoreApi::EchoNullableList(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableList";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_list_arg ? EncodableValue(*a_list_arg) : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4561,18 +3588,27 @@ void FlutterIntegrationCoreApi::EchoNullableMap(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableMap";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       a_map_arg ? EncodableValue(*a_map_arg) : EncodableValue(),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4598,19 +3634,26 @@ void FlutterIntegrationCoreApi::EchoNullableEnum(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoNullableEnum";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       an_enum_arg ? EncodableValue((int)(*an_enum_arg)) : EncodableValue(),
   });
-  channel->Send(encoded_api_arguments, [channel_name,
-                                        on_success = std::move(on_success),
-                                        on_error = std::move(on_error)](
-                                           const uint8_t* reply,
-                                           size_t reply_size) {
-    std::unique_ptr<EncodableValue> response =
-        GetCodec().DecodeMessage(reply, reply_size);
-    const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(channel_name, writer.data(), writer.size(),
+                          [channel_name, on_success = std::move(on_success),
+                           on_error = std::move(on_error)](
+                              const uint8_t* reply, size_t reply_size) {
+    EncodableValue encodable_return_value;
+    if (reply_size > 0) {
+      MessageReader reader(reply, reply_size);
+      EncodableValue value =
+          FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+              &reader);
+      if (!reader.has_error()) {
+        encodable_return_value = std::move(value);
+      }
+    }
     const auto* list_return_value =
         std::get_if<EncodableList>(&encodable_return_value);
     if (list_return_value) {
@@ -4640,16 +3683,25 @@ void FlutterIntegrationCoreApi::NoopAsync(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "noopAsync";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue();
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4674,18 +3726,27 @@ void FlutterIntegrationCoreApi::EchoAsyncString(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterIntegrationCoreApi."
       "echoAsyncString";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_string_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterIntegrationCoreApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterIntegrationCoreApiCodecSerializer::GetInstance().ReadValue(
+                  &reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4715,44 +3776,22 @@ const flutter::StandardMessageCodec& HostTrivialApi::GetCodec() {
 // `binary_messenger`.
 void HostTrivialApi::SetUp(flutter::BinaryMessenger* binary_messenger,
                            HostTrivialApi* api) {
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostTrivialApi.noop",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              std::optional<FlutterError> output = api->Noop();
-              if (output.has_value()) {
-                reply(WrapError(output.value()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue());
-              reply(EncodableValue(std::move(wrapped)));
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
+  PigeonSetUpHostMethod<HostTrivialApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostTrivialApi.noop",
+      &GetCodec(), api,
+      [](HostTrivialApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        PigeonReply(reply, host_api->Noop());
+      });
 }
 
 EncodableValue HostTrivialApi::WrapError(std::string_view error_message) {
-  return EncodableValue(
-      EncodableList{EncodableValue(std::string(error_message)),
-                    EncodableValue("Error"), EncodableValue()});
+  return PigeonWrapError(error_message);
 }
 
 EncodableValue HostTrivialApi::WrapError(const FlutterError& error) {
-  return EncodableValue(EncodableList{EncodableValue(error.code()),
-                                      EncodableValue(error.message()),
-                                      error.details()});
+  return PigeonWrapError(error);
 }
 
 /// The codec used by HostSmallApi.
@@ -4765,81 +3804,42 @@ const flutter::StandardMessageCodec& HostSmallApi::GetCodec() {
 // `binary_messenger`.
 void HostSmallApi::SetUp(flutter::BinaryMessenger* binary_messenger,
                          HostSmallApi* api) {
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostSmallApi.echo",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              const auto& args = std::get<EncodableList>(message);
-              const auto& encodable_a_string_arg = args.at(0);
-              if (encodable_a_string_arg.IsNull()) {
-                reply(WrapError("a_string_arg unexpectedly null."));
-                return;
-              }
-              const auto& a_string_arg =
-                  std::get<std::string>(encodable_a_string_arg);
-              api->Echo(a_string_arg, [reply](ErrorOr<std::string>&& output) {
-                if (output.has_error()) {
-                  reply(WrapError(output.error()));
-                  return;
-                }
-                EncodableList wrapped;
-                wrapped.push_back(
-                    EncodableValue(std::move(output).TakeValue()));
-                reply(EncodableValue(std::move(wrapped)));
-              });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
-  {
-    auto channel = std::make_unique<BasicMessageChannel<>>(
-        binary_messenger,
-        "dev.flutter.pigeon.pigeon_integration_tests.HostSmallApi.voidVoid",
-        &GetCodec());
-    if (api != nullptr) {
-      channel->SetMessageHandler(
-          [api](const EncodableValue& message,
-                const flutter::MessageReply<EncodableValue>& reply) {
-            try {
-              api->VoidVoid([reply](std::optional<FlutterError>&& output) {
-                if (output.has_value()) {
-                  reply(WrapError(output.value()));
-                  return;
-                }
-                EncodableList wrapped;
-                wrapped.push_back(EncodableValue());
-                reply(EncodableValue(std::move(wrapped)));
-              });
-            } catch (const std::exception& exception) {
-              reply(WrapError(exception.what()));
-            }
-          });
-    } else {
-      channel->SetMessageHandler(nullptr);
-    }
-  }
+  PigeonSetUpHostMethod<HostSmallApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostSmallApi.echo",
+      &GetCodec(), api,
+      [](HostSmallApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        const auto& args = std::get<EncodableList>(message);
+        const auto& encodable_a_string_arg = args.at(0);
+        if (encodable_a_string_arg.IsNull()) {
+          reply(WrapError("a_string_arg unexpectedly null."));
+          return;
+        }
+        const auto& a_string_arg =
+            std::get<std::string>(encodable_a_string_arg);
+        host_api->Echo(a_string_arg, [reply](ErrorOr<std::string>&& output) {
+          PigeonReply<EncodableValue>(reply, std::move(output));
+        });
+      });
+  PigeonSetUpHostMethod<HostSmallApi>(
+      binary_messenger,
+      "dev.flutter.pigeon.pigeon_integration_tests.HostSmallApi.voidVoid",
+      &GetCodec(), api,
+      [](HostSmallApi* host_api, const EncodableValue& message,
+         const flutter::MessageReply<EncodableValue>& reply) {
+        host_api->VoidVoid([reply](std::optional<FlutterError>&& output) {
+          PigeonReply(reply, std::move(output));
+        });
+      });
 }
 
 EncodableValue HostSmallApi::WrapError(std::string_view error_message) {
-  return EncodableValue(
-      EncodableList{EncodableValue(std::string(error_message)),
-                    EncodableValue("Error"), EncodableValue()});
+  return PigeonWrapError(error_message);
 }
 
 EncodableValue HostSmallApi::WrapError(const FlutterError& error) {
-  return EncodableValue(EncodableList{EncodableValue(error.code()),
-                                      EncodableValue(error.message()),
-                                      error.details()});
+  return PigeonWrapError(error);
 }
 
 FlutterSmallApiCodecSerializer::FlutterSmallApiCodecSerializer() {}
@@ -4861,10 +3861,8 @@ void FlutterSmallApiCodecSerializer::WriteValue(
           std::get_if<CustomEncodableValue>(&value)) {
     if (custom_value->type() == typeid(TestMessage)) {
       stream->WriteByte(128);
-      WriteValue(
-          EncodableValue(
-              std::any_cast<TestMessage>(*custom_value).ToEncodableList()),
-          stream);
+      std::any_cast<const TestMessage&>(*custom_value)
+          .WriteEncodableList(*this, stream);
       return;
     }
   }
@@ -4888,18 +3886,26 @@ void FlutterSmallApi::EchoWrappedList(
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterSmallApi."
       "echoWrappedList";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       CustomEncodableValue(msg_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterSmallApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterSmallApiCodecSerializer::GetInstance().ReadValue(&reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
@@ -4925,18 +3931,26 @@ void FlutterSmallApi::EchoString(
     std::function<void(const FlutterError&)>&& on_error) {
   const std::string channel_name =
       "dev.flutter.pigeon.pigeon_integration_tests.FlutterSmallApi.echoString";
-  auto channel = std::make_unique<BasicMessageChannel<>>(
-      binary_messenger_, channel_name, &GetCodec());
   EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
       EncodableValue(a_string_arg),
   });
-  channel->Send(
-      encoded_api_arguments, [channel_name, on_success = std::move(on_success),
-                              on_error = std::move(on_error)](
-                                 const uint8_t* reply, size_t reply_size) {
-        std::unique_ptr<EncodableValue> response =
-            GetCodec().DecodeMessage(reply, reply_size);
-        const auto& encodable_return_value = *response;
+  MessageWriter writer;
+  FlutterSmallApiCodecSerializer::GetInstance().WriteValue(
+      encoded_api_arguments, &writer);
+  binary_messenger_->Send(
+      channel_name, writer.data(), writer.size(),
+      [channel_name, on_success = std::move(on_success),
+       on_error = std::move(on_error)](const uint8_t* reply,
+                                       size_t reply_size) {
+        EncodableValue encodable_return_value;
+        if (reply_size > 0) {
+          MessageReader reader(reply, reply_size);
+          EncodableValue value =
+              FlutterSmallApiCodecSerializer::GetInstance().ReadValue(&reader);
+          if (!reader.has_error()) {
+            encodable_return_value = std::move(value);
+          }
+        }
         const auto* list_return_value =
             std::get_if<EncodableList>(&encodable_return_value);
         if (list_return_value) {
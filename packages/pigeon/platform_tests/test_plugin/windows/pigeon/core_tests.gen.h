@@ -24,12 +24,14 @@ class CoreTestsTest;
 
 class FlutterError {
  public:
-  explicit FlutterError(const std::string& code) : code_(code) {}
-  explicit FlutterError(const std::string& code, const std::string& message)
-      : code_(code), message_(message) {}
-  explicit FlutterError(const std::string& code, const std::string& message,
-                        const flutter::EncodableValue& details)
-      : code_(code), message_(message), details_(details) {}
+  explicit FlutterError(std::string code) : code_(std::move(code)) {}
+  explicit FlutterError(std::string code, std::string message)
+      : code_(std::move(code)), message_(std::move(message)) {}
+  explicit FlutterError(std::string code, std::string message,
+                        flutter::EncodableValue details)
+      : code_(std::move(code)),
+        message_(std::move(message)),
+        details_(std::move(details)) {}
 
   const std::string& code() const { return code_; }
   const std::string& message() const { return message_; }
@@ -45,13 +47,15 @@ template <class T>
 class ErrorOr {
  public:
   ErrorOr(const T& rhs) : v_(rhs) {}
-  ErrorOr(const T&& rhs) : v_(std::move(rhs)) {}
+  ErrorOr(T&& rhs) : v_(std::move(rhs)) {}
   ErrorOr(const FlutterError& rhs) : v_(rhs) {}
-  ErrorOr(const FlutterError&& rhs) : v_(std::move(rhs)) {}
+  ErrorOr(FlutterError&& rhs) : v_(std::move(rhs)) {}
 
   bool has_error() const { return std::holds_alternative<FlutterError>(v_); }
   const T& value() const { return std::get<T>(v_); };
   const FlutterError& error() const { return std::get<FlutterError>(v_); };
+  // Moves the value out of the result, which must not be an error.
+  T TakeValue() && { return std::get<T>(std::move(v_)); }
 
  private:
   friend class HostIntegrationCoreApi;
@@ -60,7 +64,6 @@ class ErrorOr {
   friend class HostSmallApi;
   friend class FlutterSmallApi;
   ErrorOr() = default;
-  T TakeValue() && { return std::get<T>(std::move(v_)); }
 
   std::variant<T, FlutterError> v_;
 };
@@ -74,14 +77,13 @@ class AllTypes {
  public:
   // Constructs an object setting all fields.
   explicit AllTypes(bool a_bool, int64_t an_int, int64_t an_int64,
-                    double a_double, const std::vector<uint8_t>& a_byte_array,
-                    const std::vector<int32_t>& a4_byte_array,
-                    const std::vector<int64_t>& a8_byte_array,
-                    const std::vector<double>& a_float_array,
-                    const flutter::EncodableList& a_list,
-                    const flutter::EncodableMap& a_map, const AnEnum& an_enum,
-                    const std::string& a_string,
-                    const flutter::EncodableValue& an_object);
+                    double a_double, std::vector<uint8_t> a_byte_array,
+                    std::vector<int32_t> a4_byte_array,
+                    std::vector<int64_t> a8_byte_array,
+                    std::vector<double> a_float_array,
+                    flutter::EncodableList a_list, flutter::EncodableMap a_map,
+                    const AnEnum& an_enum, std::string a_string,
+                    flutter::EncodableValue an_object);
 
   bool a_bool() const;
   void set_a_bool(bool value_arg);
@@ -97,21 +99,27 @@ class AllTypes {
 
   const std::vector<uint8_t>& a_byte_array() const;
   void set_a_byte_array(const std::vector<uint8_t>& value_arg);
+  void set_a_byte_array(std::vector<uint8_t>&& value_arg);
 
   const std::vector<int32_t>& a4_byte_array() const;
   void set_a4_byte_array(const std::vector<int32_t>& value_arg);
+  void set_a4_byte_array(std::vector<int32_t>&& value_arg);
 
   const std::vector<int64_t>& a8_byte_array() const;
   void set_a8_byte_array(const std::vector<int64_t>& value_arg);
+  void set_a8_byte_array(std::vector<int64_t>&& value_arg);
 
   const std::vector<double>& a_float_array() const;
   void set_a_float_array(const std::vector<double>& value_arg);
+  void set_a_float_array(std::vector<double>&& value_arg);
 
   const flutter::EncodableList& a_list() const;
   void set_a_list(const flutter::EncodableList& value_arg);
+  void set_a_list(flutter::EncodableList&& value_arg);
 
   const flutter::EncodableMap& a_map() const;
   void set_a_map(const flutter::EncodableMap& value_arg);
+  void set_a_map(flutter::EncodableMap&& value_arg);
 
   const AnEnum& an_enum() const;
   void set_an_enum(const AnEnum& value_arg);
@@ -121,10 +129,13 @@ class AllTypes {
 
   const flutter::EncodableValue& an_object() const;
   void set_an_object(const flutter::EncodableValue& value_arg);
+  void set_an_object(flutter::EncodableValue&& value_arg);
 
  private:
-  static AllTypes FromEncodableList(const flutter::EncodableList& list);
+  static AllTypes FromEncodableList(flutter::EncodableList list);
   flutter::EncodableList ToEncodableList() const;
+  void WriteEncodableList(const flutter::StandardCodecSerializer& serializer,
+                          flutter::ByteStreamWriter* stream) const;
   friend class AllClassesWrapper;
   friend class HostIntegrationCoreApi;
   friend class HostIntegrationCoreApiCodecSerializer;
@@ -195,40 +206,49 @@ class AllNullableTypes {
   const std::vector<uint8_t>* a_nullable_byte_array() const;
   void set_a_nullable_byte_array(const std::vector<uint8_t>* value_arg);
   void set_a_nullable_byte_array(const std::vector<uint8_t>& value_arg);
+  void set_a_nullable_byte_array(std::vector<uint8_t>&& value_arg);
 
   const std::vector<int32_t>* a_nullable4_byte_array() const;
   void set_a_nullable4_byte_array(const std::vector<int32_t>* value_arg);
   void set_a_nullable4_byte_array(const std::vector<int32_t>& value_arg);
+  void set_a_nullable4_byte_array(std::vector<int32_t>&& value_arg);
 
   const std::vector<int64_t>* a_nullable8_byte_array() const;
   void set_a_nullable8_byte_array(const std::vector<int64_t>* value_arg);
   void set_a_nullable8_byte_array(const std::vector<int64_t>& value_arg);
+  void set_a_nullable8_byte_array(std::vector<int64_t>&& value_arg);
 
   const std::vector<double>* a_nullable_float_array() const;
   void set_a_nullable_float_array(const std::vector<double>* value_arg);
   void set_a_nullable_float_array(const std::vector<double>& value_arg);
+  void set_a_nullable_float_array(std::vector<double>&& value_arg);
 
   const flutter::EncodableList* a_nullable_list() const;
   void set_a_nullable_list(const flutter::EncodableList* value_arg);
   void set_a_nullable_list(const flutter::EncodableList& value_arg);
+  void set_a_nullable_list(flutter::EncodableList&& value_arg);
 
   const flutter::EncodableMap* a_nullable_map() const;
   void set_a_nullable_map(const flutter::EncodableMap* value_arg);
   void set_a_nullable_map(const flutter::EncodableMap& value_arg);
+  void set_a_nullable_map(flutter::EncodableMap&& value_arg);
 
   const flutter::EncodableList* nullable_nested_list() const;
   void set_nullable_nested_list(const flutter::EncodableList* value_arg);
   void set_nullable_nested_list(const flutter::EncodableList& value_arg);
+  void set_nullable_nested_list(flutter::EncodableList&& value_arg);
 
   const flutter::EncodableMap* nullable_map_with_annotations() const;
   void set_nullable_map_with_annotations(
       const flutter::EncodableMap* value_arg);
   void set_nullable_map_with_annotations(
       const flutter::EncodableMap& value_arg);
+  void set_nullable_map_with_annotations(flutter::EncodableMap&& value_arg);
 
   const flutter::EncodableMap* nullable_map_with_object() const;
   void set_nullable_map_with_object(const flutter::EncodableMap* value_arg);
   void set_nullable_map_with_object(const flutter::EncodableMap& value_arg);
+  void set_nullable_map_with_object(flutter::EncodableMap&& value_arg);
 
   const AnEnum* a_nullable_enum() const;
   void set_a_nullable_enum(const AnEnum* value_arg);
@@ -241,10 +261,13 @@ class AllNullableTypes {
   const flutter::EncodableValue* a_nullable_object() const;
   void set_a_nullable_object(const flutter::EncodableValue* value_arg);
   void set_a_nullable_object(const flutter::EncodableValue& value_arg);
+  void set_a_nullable_object(flutter::EncodableValue&& value_arg);
 
  private:
-  static AllNullableTypes FromEncodableList(const flutter::EncodableList& list);
+  static AllNullableTypes FromEncodableList(flutter::EncodableList list);
   flutter::EncodableList ToEncodableList() const;
+  void WriteEncodableList(const flutter::StandardCodecSerializer& serializer,
+                          flutter::ByteStreamWriter* stream) const;
   friend class AllClassesWrapper;
   friend class HostIntegrationCoreApi;
   friend class HostIntegrationCoreApiCodecSerializer;
@@ -285,23 +308,26 @@ class AllNullableTypes {
 class AllClassesWrapper {
  public:
   // Constructs an object setting all non-nullable fields.
-  explicit AllClassesWrapper(const AllNullableTypes& all_nullable_types);
+  explicit AllClassesWrapper(AllNullableTypes all_nullable_types);
 
   // Constructs an object setting all fields.
-  explicit AllClassesWrapper(const AllNullableTypes& all_nullable_types,
+  explicit AllClassesWrapper(AllNullableTypes all_nullable_types,
                              const AllTypes* all_types);
 
   const AllNullableTypes& all_nullable_types() const;
   void set_all_nullable_types(const AllNullableTypes& value_arg);
+  void set_all_nullable_types(AllNullableTypes&& value_arg);
 
   const AllTypes* all_types() const;
   void set_all_types(const AllTypes* value_arg);
   void set_all_types(const AllTypes& value_arg);
+  void set_all_types(AllTypes&& value_arg);
 
  private:
-  static AllClassesWrapper FromEncodableList(
-      const flutter::EncodableList& list);
+  static AllClassesWrapper FromEncodableList(flutter::EncodableList list);
   flutter::EncodableList ToEncodableList() const;
+  void WriteEncodableList(const flutter::StandardCodecSerializer& serializer,
+                          flutter::ByteStreamWriter* stream) const;
   friend class HostIntegrationCoreApi;
   friend class HostIntegrationCoreApiCodecSerializer;
   friend class FlutterIntegrationCoreApi;
@@ -331,10 +357,13 @@ class TestMessage {
   const flutter::EncodableList* test_list() const;
   void set_test_list(const flutter::EncodableList* value_arg);
   void set_test_list(const flutter::EncodableList& value_arg);
+  void set_test_list(flutter::EncodableList&& value_arg);
 
  private:
-  static TestMessage FromEncodableList(const flutter::EncodableList& list);
+  static TestMessage FromEncodableList(flutter::EncodableList list);
   flutter::EncodableList ToEncodableList() const;
+  void WriteEncodableList(const flutter::StandardCodecSerializer& serializer,
+                          flutter::ByteStreamWriter* stream) const;
   friend class HostIntegrationCoreApi;
   friend class HostIntegrationCoreApiCodecSerializer;
   friend class FlutterIntegrationCoreApi;
@@ -0,0 +1,258 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <flutter/encodable_value.h>
+#include <gtest/gtest.h>
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "pigeon/core_tests.gen.h"
+#include "test/utils/fake_host_messenger.h"
+#include "test_plugin.h"
+
+namespace {
+
+// Number and total size of the calls to the global operator new since the
+// process started.
+std::atomic<uint64_t> g_allocation_count{0};
+std::atomic<uint64_t> g_allocated_bytes{0};
+
+}  // namespace
+
+// Replaces the global allocation functions so that the tests can check the
+// heap allocations of each call. The array forms forward to these by default.
+void* operator new(size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+
+namespace core_tests_pigeontest {
+
+namespace {
+
+using flutter::CustomEncodableValue;
+using flutter::EncodableList;
+using flutter::EncodableMap;
+using flutter::EncodableValue;
+using test_plugin::TestPlugin;
+using testing::FakeHostMessenger;
+
+constexpr char kChannelPrefix[] =
+    "dev.flutter.pigeon.pigeon_integration_tests.HostIntegrationCoreApi.";
+
+// Sizes of the byte arrays echoed by the tests.
+constexpr size_t kByteArraySizes[] = {1024, 64 * 1024, 1024 * 1024,
+                                      8 * 1024 * 1024, 64 * 1024 * 1024};
+
+// Number of entries of the echoed lists and maps.
+constexpr size_t kCollectionEntryCount = 100000;
+
+// Times a byte array is allocated by an echo: the encoded message, the
+// decoded argument, the returned value, the encoded reply and the decoded
+// reply. Results are moved into the reply.
+constexpr uint64_t kByteArrayCopiesPerEcho = 5;
+
+// Allocations of an echo that do not depend on the size of the payload, such
+// as the messenger callbacks.
+constexpr uint64_t kFixedAllocationBytes = 16 * 1024;
+
+// Heap usage and duration of a host API call.
+struct EchoStats {
+  uint64_t allocation_count = 0;
+  uint64_t allocated_bytes = 0;
+  double seconds = 0;
+};
+
+// Calls the |HostIntegrationCoreApi| method |method| with |argument| through
+// a FakeHostMessenger, and sets |result| to the value it returned.
+//
+// The stats cover encoding the message, handling it, and decoding the reply,
+// like a call from Dart would.
+EchoStats Echo(const std::string& method, const EncodableValue& argument,
+               EncodableValue* result) {
+  FakeHostMessenger messenger(&HostIntegrationCoreApi::GetCodec());
+  TestPlugin api(&messenger);
+  HostIntegrationCoreApi::SetUp(&messenger, &api);
+
+  const std::string channel = std::string(kChannelPrefix) + method;
+  const EncodableValue message(EncodableList{argument});
+
+  EchoStats stats;
+  bool replied = false;
+  const uint64_t allocation_count_before =
+      g_allocation_count.load(std::memory_order_relaxed);
+  const uint64_t allocated_bytes_before =
+      g_allocated_bytes.load(std::memory_order_relaxed);
+  const auto start = std::chrono::steady_clock::now();
+  messenger.SendHostMessage(
+      channel, message, [&](const EncodableValue& reply) {
+        // Stops measuring before copying the result out of the reply.
+        stats.seconds = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+        stats.allocation_count =
+            g_allocation_count.load(std::memory_order_relaxed) -
+            allocation_count_before;
+        stats.allocated_bytes =
+            g_allocated_bytes.load(std::memory_order_relaxed) -
+            allocated_bytes_before;
+
+        const auto* reply_list = std::get_if<EncodableList>(&reply);
+        if (reply_list && reply_list->size() == 1) {
+          *result = (*reply_list)[0];
+          replied = true;
+        }
+      });
+  if (!replied) {
+    ADD_FAILURE() << method << " did not reply with a value";
+  }
+  return stats;
+}
+
+// Records the throughput of an echo of |bytes| bytes as a test property, which
+// appears in the XML test report.
+void RecordThroughput(const std::string& name, size_t bytes,
+                      const EchoStats& stats) {
+  if (stats.seconds <= 0) {
+    return;
+  }
+  ::testing::Test::RecordProperty(
+      name + "_mb_per_s",
+      static_cast<int>(static_cast<double>(bytes) / stats.seconds / 1e6));
+}
+
+// Returns an AllClassesWrapper whose nested list is nested |depth| times.
+AllClassesWrapper CreateNestedWrapper(size_t depth) {
+  EncodableList nested_list{EncodableValue(true)};
+  for (size_t i = 0; i < depth; i++) {
+    nested_list = EncodableList{EncodableValue(std::move(nested_list))};
+  }
+  AllNullableTypes all_nullable_types;
+  all_nullable_types.set_nullable_nested_list(std::move(nested_list));
+  all_nullable_types.set_a_nullable_byte_array(
+      std::vector<uint8_t>(1024, 0x80));
+  return AllClassesWrapper(std::move(all_nullable_types));
+}
+
+// Returns the number of times the nested list of |wrapper| is nested.
+size_t GetNestingDepth(const AllClassesWrapper& wrapper) {
+  const EncodableList* nested_list =
+      wrapper.all_nullable_types().nullable_nested_list();
+  size_t depth = 0;
+  while (nested_list && nested_list->size() == 1) {
+    nested_list = std::get_if<EncodableList>(&(*nested_list)[0]);
+    if (nested_list) {
+      depth++;
+    }
+  }
+  return depth;
+}
+
+}  // namespace
+
+TEST(LargePayload, EchoUint8ListCopiesPayloadAFixedNumberOfTimes) {
+  uint64_t smallest_allocation_count = 0;
+  for (size_t size : kByteArraySizes) {
+    SCOPED_TRACE(size);
+    std::vector<uint8_t> bytes(size, 0x80);
+    bytes.front() = 0x01;
+    bytes.back() = 0x02;
+
+    EncodableValue result;
+    const EchoStats stats =
+        Echo("echoUint8List", EncodableValue(bytes), &result);
+    const auto* echoed = std::get_if<std::vector<uint8_t>>(&result);
+    ASSERT_TRUE(echoed);
+    EXPECT_EQ(*echoed, bytes);
+
+    EXPECT_LE(stats.allocated_bytes,
+              kByteArrayCopiesPerEcho * size + kFixedAllocationBytes);
+    // Each copy is a single allocation, whatever the size of the payload.
+    if (smallest_allocation_count == 0) {
+      smallest_allocation_count = stats.allocation_count;
+    }
+    EXPECT_LE(stats.allocation_count, smallest_allocation_count + 8);
+
+    RecordThroughput("echoUint8List_" + std::to_string(size), size, stats);
+  }
+}
+
+TEST(LargePayload, EchoListDoesNotAllocatePerEntry) {
+  EncodableList list;
+  list.reserve(kCollectionEntryCount);
+  for (size_t i = 0; i < kCollectionEntryCount; i++) {
+    list.push_back(EncodableValue(static_cast<int64_t>(i) << 32));
+  }
+
+  EncodableValue result;
+  const EchoStats stats = Echo("echoList", EncodableValue(list), &result);
+  const auto* echoed = std::get_if<EncodableList>(&result);
+  ASSERT_TRUE(echoed);
+  EXPECT_EQ(*echoed, list);
+
+  // Integers are stored inline, so only the list buffers are allocated.
+  EXPECT_LT(stats.allocation_count, kCollectionEntryCount / 100);
+
+  RecordThroughput("echoList", kCollectionEntryCount * sizeof(int64_t),
+                   stats);
+}
+
+TEST(LargePayload, EchoMapAllocatesOnlyMapNodes) {
+  EncodableMap map;
+  for (size_t i = 0; i < kCollectionEntryCount; i++) {
+    map.emplace(EncodableValue(static_cast<int64_t>(i)), EncodableValue(true));
+  }
+
+  EncodableValue result;
+  const EchoStats stats = Echo("echoMap", EncodableValue(map), &result);
+  const auto* echoed = std::get_if<EncodableMap>(&result);
+  ASSERT_TRUE(echoed);
+  EXPECT_EQ(*echoed, map);
+
+  // The decoded argument, the returned value and the decoded reply each
+  // allocate one node per entry.
+  EXPECT_LT(stats.allocation_count, 4 * kCollectionEntryCount);
+
+  RecordThroughput("echoMap", kCollectionEntryCount * sizeof(int64_t), stats);
+}
+
+TEST(LargePayload, EchoClassWrapperScalesLinearlyWithNesting) {
+  constexpr size_t kDepth = 64;
+
+  EchoStats stats[2];
+  for (size_t i = 0; i < 2; i++) {
+    const size_t depth = kDepth << i;
+    SCOPED_TRACE(depth);
+
+    EncodableValue result;
+    stats[i] = Echo("echoClassWrapper",
+                    CustomEncodableValue(CreateNestedWrapper(depth)), &result);
+    const auto* echoed = std::get_if<CustomEncodableValue>(&result);
+    ASSERT_TRUE(echoed);
+    EXPECT_EQ(
+        GetNestingDepth(std::any_cast<const AllClassesWrapper&>(*echoed)),
+        depth);
+  }
+
+  // Doubling the depth at most doubles the work.
+  EXPECT_LE(stats[1].allocation_count, 2 * stats[0].allocation_count);
+  EXPECT_LE(stats[1].allocated_bytes, 2 * stats[0].allocated_bytes);
+}
+
+}  // namespace core_tests_pigeontest
@@ -5,7 +5,7 @@
 import 'package:pigeon/ast.dart';
 import 'package:pigeon/cpp_generator.dart';
 import 'package:pigeon/generator_tools.dart';
-import 'package:pigeon/pigeon.dart' show Error;
+import 'package:pigeon/pigeon.dart' show Error, TaskQueueType;
 import 'package:test/test.dart';
 
 const String DEFAULT_PACKAGE_NAME = 'test_package';
@@ -271,6 +271,978 @@ void main() {
     }
   });
 
+  test('ErrorOr moves values in and out', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'getBytes',
+          parameters: <Parameter>[],
+          returnType:
+              const TypeDeclaration(baseName: 'Uint8List', isNullable: false),
+        )
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('ErrorOr(T&& rhs) : v_(std::move(rhs)) {}'));
+      expect(code,
+          contains('ErrorOr(FlutterError&& rhs) : v_(std::move(rhs)) {}'));
+      expect(code, isNot(contains('const T&&')));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('class ErrorOr {'),
+            contains(' public:'),
+            contains('  T TakeValue() && {'),
+            contains(' private:'),
+          ]));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(
+          code,
+          contains('wrapped.push_back('
+              'PigeonWrapValue<Wrapper>(std::move(output).TakeValue()));'));
+      expect(code, contains('reply(EncodableValue(std::move(wrapped)));'));
+      expect(
+          code,
+          contains(
+              'PigeonReply<EncodableValue>(reply, host_api->GetBytes());'));
+    }
+  });
+
+  test('codec writes classes without copying them', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'doSomething',
+          parameters: <Parameter>[
+            Parameter(
+                type: TypeDeclaration(
+                  baseName: 'Metadata',
+                  isNullable: false,
+                  associatedClass: emptyClass,
+                ),
+                name: 'metadata')
+          ],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        )
+      ])
+    ], classes: <Class>[
+      Class(name: 'Metadata', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'String', isNullable: false),
+            name: 'name'),
+        NamedType(
+            type:
+                const TypeDeclaration(baseName: 'Uint8List', isNullable: true),
+            name: 'thumbnail'),
+        NamedType(
+            type: TypeDeclaration(
+              baseName: 'Nested',
+              isNullable: false,
+              associatedClass: emptyClass,
+            ),
+            name: 'nested'),
+        NamedType(
+            type: const TypeDeclaration(baseName: 'List', isNullable: true),
+            name: 'tags'),
+      ]),
+      Class(name: 'Nested', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: false),
+            name: 'value'),
+      ]),
+    ], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const CppGenerator generator = CppGenerator();
+    final OutputFileOptions<CppOptions> generatorOptions =
+        OutputFileOptions<CppOptions>(
+      fileType: FileType.source,
+      languageOptions: const CppOptions(),
+    );
+    generator.generate(generatorOptions, root, sink,
+        dartPackageName: DEFAULT_PACKAGE_NAME);
+    final String code = sink.toString();
+
+    expect(
+        code,
+        contains('std::any_cast<const Metadata&>(*custom_value)'
+            '.WriteEncodableList(*this, stream);'));
+    expect(code, isNot(contains('std::any_cast<Metadata>')));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('void Metadata::WriteEncodableList('),
+          contains('WriteListHeader(4, stream);'),
+          contains('WriteString(name_, stream);'),
+          contains('WriteTypedData(8, *thumbnail_, stream);'),
+          contains('nested_.WriteEncodableList(serializer, stream);'),
+          contains('WriteList(*tags_, serializer, stream);'),
+        ]));
+    expect(code,
+        contains('serializer.WriteValue(EncodableValue(value_), stream);'));
+    expect(code, isNot(contains('void WriteMap(')));
+  });
+
+  test('batched flutter api buffers calls', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.flutter,
+          isBatched: true,
+          methods: <Method>[
+            Method(
+              name: 'onReading',
+              parameters: <Parameter>[
+                Parameter(
+                    type:
+                        const TypeDeclaration(baseName: 'int', isNullable: false),
+                    name: 'value')
+              ],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+          ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('void OnReading(int64_t value);'));
+      expect(code, contains('void Flush();'));
+      expect(
+          code,
+          contains('Api(flutter::BinaryMessenger* binary_messenger, '
+              'size_t max_batch_size);'));
+      expect(code, isNot(contains('on_success')));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains(': Api(binary_messenger, 64)'));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('void Api::OnReading(int64_t value_arg) {'),
+            contains('pending_calls_.push_back(EncodableValue(0));'),
+            contains('EncodableValue(value_arg),'),
+            contains('if (pending_call_count() >= max_batch_size_) {'),
+            contains('Flush();'),
+          ]));
+      expect(
+          code,
+          contains(
+              '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.__pigeon_batch"'));
+      expect(code, contains('channel.Send(batch);'));
+    }
+  });
+
+  test('single channel host api dispatches on method index', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.host,
+          singleChannel: true,
+          methods: <Method>[
+            Method(
+              name: 'doSomething',
+              parameters: <Parameter>[
+                Parameter(
+                    type:
+                        const TypeDeclaration(baseName: 'int', isNullable: false),
+                    name: 'value')
+              ],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+            Method(
+              name: 'doSomethingElse',
+              parameters: <Parameter>[],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+          ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const CppGenerator generator = CppGenerator();
+    final OutputFileOptions<CppOptions> generatorOptions =
+        OutputFileOptions<CppOptions>(
+      fileType: FileType.source,
+      languageOptions: const CppOptions(),
+    );
+    generator.generate(generatorOptions, root, sink,
+        dartPackageName: DEFAULT_PACKAGE_NAME);
+    final String code = sink.toString();
+
+    expect(
+        code,
+        contains(
+            '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.__pigeon_dispatch"'));
+    expect(
+        code,
+        isNot(contains(
+            '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.doSomething"')));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('switch (args.at(0).LongValue()) {'),
+          contains('case 0: {'),
+          contains('const auto& encodable_value_arg = args.at(1);'),
+          contains('PigeonReply(reply, api->DoSomething(value_arg));'),
+          contains('case 1: {'),
+          contains('PigeonReply(reply, api->DoSomethingElse());'),
+          contains('default:'),
+          contains('reply(WrapError("Unknown method index."));'),
+        ]));
+  });
+
+  test('background task queue', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'hashFile',
+          parameters: <Parameter>[
+            Parameter(
+                type: const TypeDeclaration(
+                    baseName: 'String', isNullable: false),
+                name: 'path')
+          ],
+          returnType:
+              const TypeDeclaration(baseName: 'String', isNullable: false),
+          taskQueueType: TaskQueueType.serialBackgroundThread,
+        ),
+        Method(
+          name: 'ping',
+          parameters: <Parameter>[],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        ),
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('using PlatformTaskRunner ='));
+      expect(code, isNot(contains('TaskQueue')));
+      expect(code, isNot(contains('#include <thread>')));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('static void SetUp('),
+            contains('Api* api,'),
+            contains('PlatformTaskRunner platform_task_runner);'),
+          ]));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#include <thread>'));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('namespace {'),
+            contains('class TaskQueue {'),
+            contains('void Post(std::function<void()> task) {'),
+            contains('}  // namespace'),
+          ]));
+      expect(code, contains('task_queue = std::make_shared<TaskQueue>();'));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.hashFile"'),
+            contains('[api, task_queue, platform_task_runner]'),
+            contains('if (!platform_task_runner) {'),
+            contains('reply(WrapError("hashFile runs on a background task '
+                'queue, which needs the platform_task_runner passed to '
+                'SetUp."));'),
+            contains('return;'),
+            contains('task_queue->Post([api, message, reply = '
+                'ReplyOnPlatformThread(platform_task_runner, reply)]() {'),
+            contains('api->HashFile(path_arg));'),
+            contains('PigeonSetUpHostMethod<Api>(binary_messenger, '
+                '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.ping"'),
+            contains('[](Api* host_api, const EncodableValue& message, '),
+            contains('PigeonReply(reply, host_api->Ping());'),
+          ]));
+    }
+  });
+
+  test('background task queue replies only through the platform runner', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'hashFile',
+          parameters: <Parameter>[],
+          returnType:
+              const TypeDeclaration(baseName: 'String', isNullable: false),
+          taskQueueType: TaskQueueType.serialBackgroundThread,
+        ),
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const CppGenerator generator = CppGenerator();
+    final OutputFileOptions<CppOptions> generatorOptions =
+        OutputFileOptions<CppOptions>(
+      fileType: FileType.source,
+      languageOptions: const CppOptions(),
+    );
+    generator.generate(generatorOptions, root, sink,
+        dartPackageName: DEFAULT_PACKAGE_NAME);
+    final String code = sink.toString();
+
+    // The only reply made on the task queue's thread is the wrapped one,
+    // which posts to the runner.
+    final int replyHelperStart = code.indexOf('ReplyOnPlatformThread(');
+    final String replyHelper = code.substring(replyHelperStart,
+        code.indexOf('}  // namespace', replyHelperStart));
+    expect(replyHelper, isNot(contains('return reply;')));
+    expect(
+        replyHelper,
+        contains('platform_task_runner([reply, response]() '
+            '{ reply(response); });'));
+
+    final String taskBody = code.substring(code.indexOf('task_queue->Post('));
+    expect(
+        taskBody,
+        startsWith('task_queue->Post([api, message, reply = '
+            'ReplyOnPlatformThread(platform_task_runner, reply)]() {'));
+
+    // Without a runner, the handler replies on the platform thread it was
+    // called on, before anything is posted to the task queue.
+    final String handler = code.substring(
+        code.indexOf('[api, task_queue, platform_task_runner]'),
+        code.indexOf('task_queue->Post('));
+    expect(handler, contains('if (!platform_task_runner) {'));
+    expect(handler, contains('return;'));
+  });
+
+  test('no task queue without background methods', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'ping',
+          parameters: <Parameter>[],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        ),
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const CppGenerator generator = CppGenerator();
+    final OutputFileOptions<CppOptions> generatorOptions =
+        OutputFileOptions<CppOptions>(
+      fileType: FileType.header,
+      languageOptions: const CppOptions(),
+    );
+    generator.generate(generatorOptions, root, sink,
+        dartPackageName: DEFAULT_PACKAGE_NAME);
+    final String code = sink.toString();
+
+    expect(code, isNot(contains('TaskQueue')));
+    expect(code, isNot(contains('#include <thread>')));
+  });
+
+  test('host api methods share one runtime', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'ping',
+          parameters: <Parameter>[],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        ),
+        Method(
+          name: 'getCount',
+          parameters: <Parameter>[],
+          returnType: const TypeDeclaration(baseName: 'int', isNullable: true),
+        ),
+      ]),
+      Api(name: 'OtherApi', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'ping',
+          parameters: <Parameter>[],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        ),
+      ]),
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const CppGenerator generator = CppGenerator();
+    final OutputFileOptions<CppOptions> generatorOptions =
+        OutputFileOptions<CppOptions>(
+      fileType: FileType.source,
+      languageOptions: const CppOptions(),
+    );
+    generator.generate(generatorOptions, root, sink,
+        dartPackageName: DEFAULT_PACKAGE_NAME);
+    final String code = sink.toString();
+
+    expect(code, contains('#include <type_traits>'));
+    expect('void PigeonSetUpHostMethod('.allMatches(code).length, 1);
+    expect('EncodableValue PigeonWrapError('.allMatches(code).length, 2);
+    // Method handlers capture nothing, so they don't each add a lambda type.
+    expect(code, isNot(contains('[api](')));
+    expect(code, isNot(contains('std::make_unique<BasicMessageChannel<>>')));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('PigeonSetUpHostMethod<Api>(binary_messenger, '
+              '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.ping"'),
+          contains('PigeonReply(reply, host_api->Ping());'),
+          contains('PigeonSetUpHostMethod<Api>(binary_messenger, '
+              '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.getCount"'),
+          contains('PigeonReply<EncodableValue>(reply, host_api->GetCount());'),
+          contains('PigeonSetUpHostMethod<OtherApi>(binary_messenger, '
+              '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.OtherApi.ping"'),
+          contains('return PigeonWrapError(error_message);'),
+        ]));
+  });
+
+  test('stream api queues events without credit', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.host,
+          isStream: true,
+          methods: <Method>[
+            Method(
+              name: 'readings',
+              parameters: <Parameter>[],
+              returnType: TypeDeclaration(
+                baseName: 'Reading',
+                isNullable: false,
+                associatedClass: emptyClass,
+              ),
+            ),
+          ])
+    ], classes: <Class>[
+      Class(name: 'Reading', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: true),
+            name: 'value')
+      ]),
+    ], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#include <flutter/event_channel.h>'));
+      expect(code, contains('enum class StreamOverflowPolicy {'));
+      expect(code, contains('class ApiReadings {'));
+      expect(
+          code,
+          contains('ApiReadings(flutter::BinaryMessenger* binary_messenger, '
+              'size_t max_queue_size, StreamOverflowPolicy overflow_policy);'));
+      expect(code, contains('void Send(const Reading& event);'));
+      expect(code, contains('std::deque<flutter::EncodableValue> queue_;'));
+      // Stream APIs don't get a host API interface.
+      expect(code, isNot(contains('static void SetUp(')));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#include <flutter/event_stream_handler_functions.h>'));
+      expect(
+          code,
+          contains(
+              ': ApiReadings(binary_messenger, 64, StreamOverflowPolicy::kDropOldest)'));
+      expect(code,
+          contains('"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.readings"'));
+      expect(
+          code,
+          contains(
+              '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.readings.__pigeon_credit"'));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('void ApiReadings::Send(const Reading& event) {'),
+            contains('if (credit_ > 0 && queue_.empty()) {'),
+            contains('sink_->Success(CustomEncodableValue(event));'),
+            contains('if (queue_.size() >= max_queue_size_) {'),
+            contains('++dropped_event_count_;'),
+            contains('queue_.pop_front();'),
+            contains('queue_.push_back(CustomEncodableValue(event));'),
+          ]));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('void ApiReadings::AddCredit(int64_t credit) {'),
+            contains('credit_ += credit;'),
+            contains('SendQueuedEvents();'),
+          ]));
+    }
+  });
+
+  test('ffi host api exports extern "C" functions', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.host,
+          isFfi: true,
+          methods: <Method>[
+            Method(
+              name: 'add',
+              parameters: <Parameter>[
+                Parameter(
+                    name: 'a',
+                    type: const TypeDeclaration(
+                        baseName: 'int', isNullable: false)),
+                Parameter(
+                    name: 'b',
+                    type: const TypeDeclaration(
+                        baseName: 'int', isNullable: false)),
+              ],
+              returnType:
+                  const TypeDeclaration(baseName: 'int', isNullable: false),
+            ),
+            Method(
+              name: 'greet',
+              parameters: <Parameter>[
+                Parameter(
+                    name: 'name',
+                    type: const TypeDeclaration(
+                        baseName: 'String', isNullable: false)),
+              ],
+              returnType:
+                  const TypeDeclaration(baseName: 'String', isNullable: false),
+            ),
+            Method(
+              name: 'move',
+              parameters: <Parameter>[
+                Parameter(
+                    name: 'point',
+                    type: TypeDeclaration(
+                      baseName: 'Point',
+                      isNullable: false,
+                      associatedClass: emptyClass,
+                    )),
+              ],
+              returnType: TypeDeclaration(
+                baseName: 'Point',
+                isNullable: false,
+                associatedClass: emptyClass,
+              ),
+            ),
+            Method(
+              name: 'reset',
+              parameters: <Parameter>[],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+          ])
+    ], classes: <Class>[
+      Class(name: 'Point', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: false),
+            name: 'x'),
+        NamedType(
+            type: const TypeDeclaration(baseName: 'double', isNullable: false),
+            name: 'yOffset'),
+      ]),
+    ], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#define PIGEON_FFI_EXPORT'));
+      expect(code, contains('struct PigeonFfiError {'));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('struct PigeonFfiPoint {'),
+            contains('int64_t x;'),
+            contains('double y_offset;'),
+          ]));
+      expect(code,
+          contains('virtual ErrorOr<int64_t> Add(int64_t a, int64_t b) = 0;'));
+      expect(
+          code,
+          contains(
+              'virtual ErrorOr<std::string> Greet(const std::string& name) = 0;'));
+      expect(code, contains('static void SetUp(Api* api);'));
+      expect(
+          code,
+          contains(
+              'PIGEON_FFI_EXPORT bool pigeon_Api_add(int64_t a, int64_t b, int64_t* result, PigeonFfiError* error);'));
+      expect(
+          code,
+          contains(
+              'PIGEON_FFI_EXPORT bool pigeon_Api_greet(const char* name, char** result, PigeonFfiError* error);'));
+      expect(
+          code,
+          contains(
+              'PIGEON_FFI_EXPORT bool pigeon_Api_move(PigeonFfiPoint point, PigeonFfiPoint* result, PigeonFfiError* error);'));
+      expect(
+          code,
+          contains(
+              'PIGEON_FFI_EXPORT bool pigeon_Api_reset(PigeonFfiError* error);'));
+      expect(code,
+          contains('PIGEON_FFI_EXPORT void pigeon_Api_FreeString(char* string);'));
+      // FFI APIs aren't set up on a binary messenger.
+      expect(code, isNot(contains('flutter::BinaryMessenger* binary_messenger,')));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#include <atomic>'));
+      expect(code, contains('static std::atomic<Api*> pigeon_api_instance{nullptr};'));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains(
+                'bool pigeon_Api_add(int64_t a, int64_t b, int64_t* result, PigeonFfiError* error) {'),
+            contains('Api* api = pigeon_api_instance.load();'),
+            contains('if (api == nullptr) {'),
+            contains('ErrorOr<int64_t> output = api->Add(a, b);'),
+            contains(
+                'PigeonFfiSetError(error, output.error().code(), output.error().message());'),
+            contains('*result = output.value();'),
+            contains('catch (const std::exception& exception) {'),
+          ]));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('ErrorOr<std::string> output = api->Greet(name);'),
+            contains('*result = PigeonFfiCopyString(output.value());'),
+          ]));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains(
+                'ErrorOr<Point> output = api->Move(Point(point.x, point.y_offset));'),
+            contains('const Point& value = output.value();'),
+            contains('*result = PigeonFfiPoint{value.x(), value.y_offset()};'),
+          ]));
+      expect(code,
+          contains('std::optional<FlutterError> output = api->Reset();'));
+      expect(code, isNot(contains('BasicMessageChannel<>>(binary_messenger')));
+    }
+  });
+
+  test('CppZeroCopy passes typed data as views', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'processFrame',
+          parameters: <Parameter>[
+            Parameter(
+                type: const TypeDeclaration(
+                    baseName: 'Uint8List', isNullable: false),
+                name: 'bytes'),
+            Parameter(
+                type: const TypeDeclaration(
+                    baseName: 'Float64List', isNullable: true),
+                name: 'weights'),
+            Parameter(
+                type: const TypeDeclaration(baseName: 'int', isNullable: false),
+                name: 'width'),
+          ],
+          returnType: const TypeDeclaration.voidDeclaration(),
+          cppZeroCopy: true,
+        )
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('class TypedDataView {'));
+      expect(
+          code,
+          contains('ProcessFrame(const TypedDataView<uint8_t>& bytes, '
+              'const TypedDataView<double>* weights, int64_t width)'));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#include <cstring>'));
+      expect(code, contains('class ZeroCopyMessageReader'));
+      expect(code, isNot(contains('BasicMessageChannel<>>')));
+      expect(
+          code,
+          contains(
+              'const auto bytes_arg = reader.ReadTypedDataView<uint8_t>(8);'));
+      expect(
+          code,
+          contains('const auto weights_arg = '
+              'reader.ReadTypedDataView<double>(11);'));
+      expect(
+          code,
+          contains('const EncodableValue encodable_width_arg = '
+              'flutter::StandardCodecSerializer::GetInstance()'
+              '.ReadValue(&reader);'));
+      expect(
+          code,
+          contains('api->ProcessFrame(*bytes_arg, '
+              'weights_arg ? &(*weights_arg) : nullptr, width_arg)'));
+      expect(code, contains('MessageWriter writer;'));
+      expect(code, isNot(contains('EncodeMessage')));
+    }
+  });
+
+  test('CppZeroCopy passes strings as views', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'log',
+          parameters: <Parameter>[
+            Parameter(
+                type:
+                    const TypeDeclaration(baseName: 'String', isNullable: true),
+                name: 'tag'),
+            Parameter(
+                type: const TypeDeclaration(
+                    baseName: 'String', isNullable: false),
+                name: 'message'),
+          ],
+          returnType: const TypeDeclaration.voidDeclaration(),
+          cppZeroCopy: true,
+        )
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(
+          code,
+          contains(
+              'Log(const std::string_view* tag, std::string_view message)'));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('std::optional<std::string_view> ReadStringView()'));
+      expect(code, contains('const auto tag_arg = reader.ReadStringView();'));
+      expect(
+          code, contains('const auto message_arg = reader.ReadStringView();'));
+      expect(
+          code,
+          contains(
+              'api->Log(tag_arg ? &(*tag_arg) : nullptr, *message_arg)'));
+    }
+  });
+
+  test('CppZeroCopy moves data class arguments', () {
+    final Class frameClass = Class(name: 'Frame', fields: <NamedType>[
+      NamedType(
+          type: const TypeDeclaration(baseName: 'Uint8List', isNullable: false),
+          name: 'bytes'),
+    ]);
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'processFrames',
+          parameters: <Parameter>[
+            Parameter(
+                type: TypeDeclaration(
+                  baseName: 'Frame',
+                  isNullable: false,
+                  associatedClass: frameClass,
+                ),
+                name: 'frame'),
+            Parameter(
+                type: TypeDeclaration(
+                  baseName: 'Frame',
+                  isNullable: true,
+                  associatedClass: frameClass,
+                ),
+                name: 'previous'),
+          ],
+          returnType: const TypeDeclaration.voidDeclaration(),
+          cppZeroCopy: true,
+        )
+      ])
+    ], classes: <Class>[
+      frameClass
+    ], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('ProcessFrames(Frame&& frame, Frame* previous)'));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('bool ReadDataClassType(uint8_t type)'));
+      expect(code, contains('std::optional<Frame> frame_arg;'));
+      expect(code, contains('if (reader.ReadDataClassType(128)) {'));
+      expect(
+          code,
+          contains('frame_arg = Frame::FromEncodableList('
+              'std::get<EncodableList>(ApiCodecSerializer::GetInstance()'
+              '.ReadValue(&reader)));'));
+      expect(
+          code,
+          contains('api->ProcessFrames(std::move(*frame_arg), '
+              'previous_arg ? &(*previous_arg) : nullptr)'));
+    }
+  });
+
+  test('TypedDataView is only generated for CppZeroCopy', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'processFrame',
+          parameters: <Parameter>[
+            Parameter(
+                type: const TypeDeclaration(
+                    baseName: 'Uint8List', isNullable: false),
+                name: 'bytes'),
+          ],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        )
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const CppGenerator generator = CppGenerator();
+    final OutputFileOptions<CppOptions> generatorOptions =
+        OutputFileOptions<CppOptions>(
+      fileType: FileType.header,
+      languageOptions: const CppOptions(),
+    );
+    generator.generate(generatorOptions, root, sink,
+        dartPackageName: DEFAULT_PACKAGE_NAME);
+    final String code = sink.toString();
+
+    expect(code, isNot(contains('TypedDataView')));
+    expect(code, contains('const std::vector<uint8_t>& bytes'));
+  });
+
   test('Spaces before {', () {
     final Root root = Root(apis: <Api>[
       Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
@@ -576,6 +1548,11 @@ void main() {
           contains('void set_nullable_string(std::string_view value_arg)'));
       expect(
           code, contains('void set_nullable_nested(const Nested& value_arg)'));
+      // Non-POD setters should have variants that take ownership, except for
+      // strings, where they would be ambiguous with the string_view variant.
+      expect(code, contains('void set_nullable_nested(Nested&& value_arg)'));
+      expect(code, isNot(contains('set_nullable_string(std::string&&')));
+      expect(code, isNot(contains('set_nullable_bool(bool&&')));
       // Instance variables should be std::optionals.
       expect(code, contains('std::optional<bool> nullable_bool_'));
       expect(code, contains('std::optional<int64_t> nullable_int_'));
@@ -750,6 +1727,21 @@ void main() {
       // Other non-POD setters should take const references.
       expect(code,
           contains('void set_non_nullable_nested(const Nested& value_arg)'));
+      // Non-POD setters should have variants that take ownership.
+      expect(
+          code, contains('void set_non_nullable_nested(Nested&& value_arg)'));
+      // The constructor should take non-POD fields by value.
+      expect(
+          code,
+          contains(RegExp(r'explicit Input\(\s*bool non_nullable_bool,\s*'
+              r'int64_t non_nullable_int,\s*'
+              r'std::string non_nullable_string,\s*'
+              r'Nested non_nullable_nested\s*\)')));
+      // Deserialization should take the list by value.
+      expect(
+          code,
+          contains(
+              'static Input FromEncodableList(flutter::EncodableList list)'));
       // Instance variables should be plain types.
       expect(code, contains('bool non_nullable_bool_;'));
       expect(code, contains('int64_t non_nullable_int_;'));
@@ -790,6 +1782,21 @@ void main() {
       expect(code, contains('non_nullable_int_ = value_arg;'));
       expect(code, contains('non_nullable_string_ = value_arg;'));
       expect(code, contains('non_nullable_nested_ = value_arg;'));
+      expect(code, contains('non_nullable_nested_ = std::move(value_arg);'));
+      // The constructor moves non-POD arguments into the fields.
+      expect(code, contains('non_nullable_bool_(non_nullable_bool)'));
+      expect(code,
+          contains('non_nullable_string_(std::move(non_nullable_string))'));
+      expect(code,
+          contains('non_nullable_nested_(std::move(non_nullable_nested))'));
+      // Deserialization moves values out of the list.
+      expect(code, contains('Input::FromEncodableList(EncodableList list)'));
+      expect(code, contains('std::get<bool>(list[0])'));
+      expect(code, contains('std::get<std::string>(std::move(list[2]))'));
+      expect(
+          code,
+          contains('Nested::FromEncodableList('
+              'std::get<EncodableList>(std::move(list[3])))'));
       // Serialization uses the value directly.
       expect(code, contains('EncodableValue(non_nullable_bool_)'));
       expect(code, contains('non_nullable_nested_.ToEncodableList()'));
@@ -1486,6 +2493,47 @@ void main() {
     }
   });
 
+  test('flutter api messages use reused buffers', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.flutter, methods: <Method>[
+        Method(
+          name: 'doSomething',
+          parameters: <Parameter>[
+            Parameter(
+                type: const TypeDeclaration(baseName: 'int', isNullable: false),
+                name: 'value'),
+          ],
+          returnType: const TypeDeclaration(baseName: 'int', isNullable: false),
+        ),
+      ]),
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const CppGenerator generator = CppGenerator();
+    final OutputFileOptions<CppOptions> generatorOptions =
+        OutputFileOptions<CppOptions>(
+      fileType: FileType.source,
+      languageOptions: const CppOptions(),
+    );
+    generator.generate(generatorOptions, root, sink,
+        dartPackageName: DEFAULT_PACKAGE_NAME);
+    final String code = sink.toString();
+    expect(code, contains('class MessageWriter'));
+    expect(code, contains('thread_local std::vector<uint8_t> buffer;'));
+    expect(code, isNot(contains('class ZeroCopyMessageReader')));
+    expect(code, isNot(contains('std::make_unique<BasicMessageChannel<>>')));
+    expect(
+        code,
+        contains('flutter::StandardCodecSerializer::GetInstance()'
+            '.WriteValue(encoded_api_arguments, &writer);'));
+    expect(
+        code,
+        contains('binary_messenger_->Send(channel_name, writer.data(), '
+            'writer.size(), '));
+    // Replies are decoded into a local value rather than a unique_ptr.
+    expect(code, isNot(contains('DecodeMessage')));
+    expect(code, contains('MessageReader reader(reply, reply_size);'));
+  });
+
   test('flutter non-nullable arguments map correctly', () {
     final Root root = Root(apis: <Api>[
       Api(name: 'Api', location: ApiLocation.flutter, methods: <Method>[
@@ -2035,6 +3083,287 @@ void main() {
     expect(code, contains('[reply]('));
   });
 
+  test('async host api methods return coroutine tasks', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'doSomething',
+          parameters: <Parameter>[
+            Parameter(
+                type: const TypeDeclaration(
+                  baseName: 'int',
+                  isNullable: false,
+                ),
+                name: 'value')
+          ],
+          returnType:
+              const TypeDeclaration(baseName: 'double', isNullable: false),
+          isAsynchronous: true,
+        ),
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(useCoroutines: true),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#include <coroutine>'));
+      expect(code, contains('template<class T> class Task {'));
+      expect(
+          code,
+          contains(
+              'virtual Task<ErrorOr<double>> DoSomething(int64_t value) = 0;'));
+      expect(code, isNot(contains('std::function<void(ErrorOr<double>')));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(useCoroutines: true),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('api->DoSomething(value_arg).Then('),
+            contains('reply,'),
+            contains('[](ErrorOr<double>&& output, '
+                'const flutter::MessageReply<EncodableValue>& task_reply) {'),
+            contains('PigeonReply<EncodableValue>('
+                'task_reply, std::move(output));'),
+            contains('&WrapError);'),
+          ]));
+      expect(code, isNot(contains('[reply](')));
+    }
+  });
+
+  test('lazy decoding defers decoding nested data classes', () {
+    final Class innerClass = Class(name: 'Inner', fields: <NamedType>[
+      NamedType(
+          type: const TypeDeclaration(baseName: 'String', isNullable: true),
+          name: 'name'),
+    ]);
+    final Root root = Root(apis: <Api>[], classes: <Class>[
+      innerClass,
+      Class(name: 'Outer', fields: <NamedType>[
+        NamedType(
+            type: TypeDeclaration(
+              baseName: 'Inner',
+              isNullable: false,
+              associatedClass: innerClass,
+            ),
+            name: 'inner'),
+        NamedType(
+            type: TypeDeclaration(
+              baseName: 'Inner',
+              isNullable: true,
+              associatedClass: innerClass,
+            ),
+            name: 'optionalInner'),
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: false),
+            name: 'count'),
+      ]),
+    ], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(lazyDecoding: true),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('mutable std::optional<Inner> inner_;'));
+      expect(
+          code,
+          contains(
+              'mutable std::optional<flutter::EncodableList> encoded_inner_;'));
+      expect(code, contains('mutable std::optional<Inner> optional_inner_;'));
+      expect(code, contains('int64_t count_;'));
+      expect(code, contains('  Outer();'));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(lazyDecoding: true),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('const Inner& Outer::inner() const {'),
+            contains('if (encoded_inner_) {'),
+            contains(
+                'inner_ = Inner::FromEncodableList(std::move(*encoded_inner_));'),
+            contains('encoded_inner_.reset();'),
+            contains('return *inner_;'),
+          ]));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('Outer Outer::FromEncodableList(EncodableList list) {'),
+            contains('Outer decoded;'),
+            contains('decoded.encoded_inner_ = '
+                'std::get<EncodableList>(std::move(list[0]));'),
+            contains('decoded.count_ = list[2].LongValue();'),
+            contains('decoded.encoded_optional_inner_ = '
+                'std::get<EncodableList>(std::move(encodable_optional_inner));'),
+          ]));
+      expect(
+          code, contains('WriteList(*encoded_inner_, serializer, stream);'));
+      expect(code, isNot(contains('Inner::FromEncodableList(std::get')));
+    }
+  });
+
+  test('typed collections store typed List and Map fields', () {
+    final Class innerClass = Class(name: 'Inner', fields: <NamedType>[
+      NamedType(
+          type: const TypeDeclaration(baseName: 'String', isNullable: true),
+          name: 'name'),
+    ]);
+    final Root root = Root(apis: <Api>[], classes: <Class>[
+      innerClass,
+      Class(name: 'Outer', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(
+                baseName: 'List',
+                isNullable: false,
+                typeArguments: <TypeDeclaration>[
+                  TypeDeclaration(baseName: 'int', isNullable: true),
+                ]),
+            name: 'counts'),
+        NamedType(
+            type: TypeDeclaration(
+                baseName: 'Map',
+                isNullable: true,
+                typeArguments: <TypeDeclaration>[
+                  const TypeDeclaration(baseName: 'String', isNullable: false),
+                  TypeDeclaration(
+                    baseName: 'Inner',
+                    isNullable: false,
+                    associatedClass: innerClass,
+                  ),
+                ]),
+            name: 'innersByName'),
+        NamedType(
+            type: const TypeDeclaration(
+                baseName: 'List',
+                isNullable: false,
+                typeArguments: <TypeDeclaration>[
+                  TypeDeclaration(baseName: 'Object', isNullable: true),
+                ]),
+            name: 'objects'),
+      ]),
+    ], enums: <Enum>[]);
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(typedCollections: true),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('#include <vector>'));
+      expect(
+          code,
+          contains(
+              'const std::vector<std::optional<int64_t>>& counts() const;'));
+      expect(
+          code,
+          contains(
+              'void set_counts(std::vector<std::optional<int64_t>>&& value_arg);'));
+      expect(code, contains('std::vector<std::optional<int64_t>> counts_;'));
+      expect(
+          code,
+          contains(
+              'std::optional<std::map<std::string, Inner>> inners_by_name_;'));
+      // Collections of unsupported element types stay untyped.
+      expect(code, contains('flutter::EncodableList objects_;'));
+    }
+    {
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.source,
+        languageOptions: const CppOptions(typedCollections: true),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('template<> struct ElementCodec<Inner> {'));
+      expect(
+          code,
+          contains(
+              'list.push_back(EncodableValue(TypedListToEncodable(counts_)));'));
+      expect(
+          code,
+          contains('list.push_back(inners_by_name_ ? '
+              'EncodableValue(TypedMapToEncodable(*inners_by_name_)) : '
+              'EncodableValue());'));
+      expect(
+          code.split('\n'),
+          containsAllInOrder(<Matcher>[
+            contains('WriteTypedList(counts_, serializer, stream);'),
+            contains('WriteTypedMap(*inners_by_name_, serializer, stream);'),
+            contains('WriteList(objects_, serializer, stream);'),
+          ]));
+      expect(
+          code,
+          contains('TypedListFromEncodable<std::vector<std::optional<int64_t>>>'
+              '(std::get<EncodableList>(std::move(list[0])))'));
+      expect(
+          code,
+          contains('TypedMapFromEncodable<std::map<std::string, Inner>>'
+              '(std::get<EncodableMap>(std::move(encodable_inners_by_name)))'));
+    }
+    {
+      // Without the option, the fields keep the untyped collections.
+      final StringBuffer sink = StringBuffer();
+      const CppGenerator generator = CppGenerator();
+      final OutputFileOptions<CppOptions> generatorOptions =
+          OutputFileOptions<CppOptions>(
+        fileType: FileType.header,
+        languageOptions: const CppOptions(),
+      );
+      generator.generate(generatorOptions, root, sink,
+          dartPackageName: DEFAULT_PACKAGE_NAME);
+      final String code = sink.toString();
+
+      expect(code, contains('flutter::EncodableList counts_;'));
+      expect(code,
+          contains('std::optional<flutter::EncodableMap> inners_by_name_;'));
+      expect(code, isNot(contains('#include <vector>')));
+    }
+  });
+
   test('connection error contains channel name', () {
     final Root root = Root(
       apis: <Api>[
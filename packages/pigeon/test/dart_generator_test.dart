@@ -356,6 +356,238 @@ void main() {
     expect(code, contains('Output doSomething(Input input)'));
   });
 
+  test('batched flutterApi', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.flutter,
+          isBatched: true,
+          methods: <Method>[
+            Method(
+              name: 'onReading',
+              parameters: <Parameter>[
+                Parameter(
+                    type:
+                        const TypeDeclaration(baseName: 'int', isNullable: false),
+                    name: 'value')
+              ],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+            Method(
+              name: 'onDone',
+              parameters: <Parameter>[],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+          ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const DartGenerator generator = DartGenerator();
+    generator.generate(
+      const DartOptions(),
+      root,
+      sink,
+      dartPackageName: DEFAULT_PACKAGE_NAME,
+    );
+    final String code = sink.toString();
+    // The per-method channels are still set up, for other host languages.
+    expect(code,
+        contains("'dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.onReading'"));
+    expect(code,
+        contains("'dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.__pigeon_batch'"));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('for (int i = 0; i + 1 < calls.length; i += 2) {'),
+          contains('if (methodIndex == 0) {'),
+          contains('api.onReading(arg_value!);'),
+          contains('} else if (methodIndex == 1) {'),
+          contains('api.onDone();'),
+        ]));
+  });
+
+  test('single channel host api', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.host,
+          singleChannel: true,
+          methods: <Method>[
+            Method(
+              name: 'doSomething',
+              parameters: <Parameter>[
+                Parameter(
+                    type:
+                        const TypeDeclaration(baseName: 'int', isNullable: false),
+                    name: 'value')
+              ],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+            Method(
+              name: 'doSomethingElse',
+              parameters: <Parameter>[],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+          ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const DartGenerator generator = DartGenerator();
+    generator.generate(
+      const DartOptions(),
+      root,
+      sink,
+      dartPackageName: DEFAULT_PACKAGE_NAME,
+    );
+    final String code = sink.toString();
+    expect(
+        code,
+        isNot(contains(
+            "'dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.doSomething'")));
+    expect(
+        code,
+        contains(
+            "'dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.__pigeon_dispatch'"));
+    expect(code, contains('.send(<Object?>[0, value])'));
+    expect(code, contains('.send(<Object?>[1])'));
+  });
+
+  test('stream api', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.host,
+          isStream: true,
+          methods: <Method>[
+            Method(
+              name: 'readings',
+              parameters: <Parameter>[],
+              returnType:
+                  const TypeDeclaration(baseName: 'int', isNullable: false),
+            ),
+          ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const DartGenerator generator = DartGenerator();
+    generator.generate(
+      const DartOptions(),
+      root,
+      sink,
+      dartPackageName: DEFAULT_PACKAGE_NAME,
+    );
+    final String code = sink.toString();
+    expect(code, contains('Stream<int> readings({int credit = 64}) {'));
+    expect(code,
+        contains("'dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.readings',"));
+    expect(code, contains('const StandardMethodCodec(StandardMessageCodec()),'));
+    expect(
+        code,
+        contains(
+            "'dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.readings.__pigeon_credit',"));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('receiveBroadcastStream(credit).map((Object? event) {'),
+          contains('if (__pigeon_received * 2 >= credit) {'),
+          contains('__pigeon_creditChannel.send(__pigeon_received);'),
+          contains('return (event as int?)!;'),
+        ]));
+    expect(code, isNot(contains('Future<int> readings(')));
+  });
+
+  test('ffi host api', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.host,
+          isFfi: true,
+          methods: <Method>[
+            Method(
+              name: 'greet',
+              parameters: <Parameter>[
+                Parameter(
+                    name: 'name',
+                    type: const TypeDeclaration(
+                        baseName: 'String', isNullable: false)),
+              ],
+              returnType:
+                  const TypeDeclaration(baseName: 'String', isNullable: false),
+            ),
+            Method(
+              name: 'move',
+              parameters: <Parameter>[
+                Parameter(
+                    name: 'point',
+                    type: TypeDeclaration(
+                      baseName: 'Point',
+                      isNullable: false,
+                      associatedClass: emptyClass,
+                    )),
+              ],
+              returnType: TypeDeclaration(
+                baseName: 'Point',
+                isNullable: false,
+                associatedClass: emptyClass,
+              ),
+            ),
+          ])
+    ], classes: <Class>[
+      Class(name: 'Point', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: false),
+            name: 'x'),
+        NamedType(
+            type: const TypeDeclaration(baseName: 'double', isNullable: false),
+            name: 'y'),
+      ]),
+    ], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const DartGenerator generator = DartGenerator();
+    generator.generate(
+      const DartOptions(),
+      root,
+      sink,
+      dartPackageName: DEFAULT_PACKAGE_NAME,
+    );
+    final String code = sink.toString();
+    expect(code, contains("import 'dart:ffi' as ffi;"));
+    expect(code, contains("import 'package:ffi/ffi.dart' as ffi;"));
+    expect(code, contains('Api({ffi.DynamicLibrary? library})'));
+    expect(code, contains("'pigeon_Api_greet'"));
+    expect(code, contains("'pigeon_Api_FreeString'"));
+    expect(code, contains('String greet(String name) {'));
+    expect(
+        code,
+        contains(
+            'ffi.Bool Function(ffi.Pointer<ffi.Utf8>, ffi.Pointer<ffi.Pointer<ffi.Utf8>>, ffi.Pointer<_PigeonFfiError>)'));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('name.toNativeUtf8(allocator: __pigeon_arena)'),
+          contains('throw _createFfiException('),
+          contains('__pigeon_result.value.toDartString();'),
+          contains('__pigeon_freeString(__pigeon_result.value);'),
+        ]));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('final class _PigeonFfiPoint extends ffi.Struct {'),
+          contains('@ffi.Int64()'),
+          contains('external int x;'),
+          contains('@ffi.Double()'),
+          contains('external double y;'),
+        ]));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('Point move(Point point) {'),
+          contains('..x = point.x'),
+          contains('..y = point.y;'),
+          contains('return Point('),
+          contains('x: __pigeon_result.ref.x,'),
+        ]));
+    // FFI APIs don't use channels.
+    expect(code, isNot(contains('BasicMessageChannel')));
+  });
+
   test('host void', () {
     final Root root = Root(apis: <Api>[
       Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
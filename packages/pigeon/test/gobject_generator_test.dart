@@ -0,0 +1,349 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:pigeon/ast.dart';
+import 'package:pigeon/generator_tools.dart';
+import 'package:pigeon/gobject_generator.dart';
+import 'package:test/test.dart';
+
+const String DEFAULT_PACKAGE_NAME = 'test_package';
+
+final Class emptyClass = Class(name: 'className', fields: <NamedType>[
+  NamedType(
+    name: 'namedTypeName',
+    type: const TypeDeclaration(baseName: 'baseName', isNullable: false),
+  )
+]);
+
+String _generate(Root root, FileType fileType,
+    {GObjectOptions options =
+        const GObjectOptions(headerIncludePath: 'messages.g.h')}) {
+  final StringBuffer sink = StringBuffer();
+  const GObjectGenerator generator = GObjectGenerator();
+  generator.generate(
+    OutputFileOptions<GObjectOptions>(
+        fileType: fileType, languageOptions: options),
+    root,
+    sink,
+    dartPackageName: DEFAULT_PACKAGE_NAME,
+  );
+  return sink.toString();
+}
+
+void main() {
+  test('gen one api', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'doSomething',
+          parameters: <Parameter>[
+            Parameter(
+                type: TypeDeclaration(
+                  baseName: 'Input',
+                  isNullable: false,
+                  associatedClass: emptyClass,
+                ),
+                name: 'input')
+          ],
+          returnType: TypeDeclaration(
+            baseName: 'Output',
+            isNullable: false,
+            associatedClass: emptyClass,
+          ),
+        )
+      ])
+    ], classes: <Class>[
+      Class(name: 'Input', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'String', isNullable: true),
+            name: 'input')
+      ]),
+      Class(name: 'Output', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'String', isNullable: true),
+            name: 'output')
+      ])
+    ], enums: <Enum>[]);
+    const GObjectOptions options = GObjectOptions(
+        headerIncludePath: 'messages.g.h', module: 'test_plugin');
+    {
+      final String code = _generate(root, FileType.header, options: options);
+      expect(code, contains('#include <flutter_linux/flutter_linux.h>'));
+      expect(code, contains('G_BEGIN_DECLS'));
+      expect(
+          code,
+          contains(
+              'G_DECLARE_FINAL_TYPE(TestPluginInput, test_plugin_input, TEST_PLUGIN, INPUT, GObject)'));
+      expect(code,
+          contains('TestPluginInput* test_plugin_input_new(const gchar* input);'));
+      expect(code,
+          contains('const gchar* test_plugin_input_get_input(TestPluginInput* self);'));
+      expect(
+          code,
+          contains(
+              'TestPluginApiDoSomethingResponse* (*do_something)(TestPluginInput* input, gpointer user_data);'));
+      expect(
+          code,
+          contains(
+              'TestPluginApiDoSomethingResponse* test_plugin_api_do_something_response_new(TestPluginOutput* return_value);'));
+      expect(
+          code,
+          contains(
+              'void test_plugin_api_set_method_handlers(FlBinaryMessenger* messenger, const TestPluginApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func);'));
+      expect(code, contains('G_END_DECLS'));
+    }
+    {
+      final String code = _generate(root, FileType.source, options: options);
+      expect(code, contains('#include "messages.g.h"'));
+      expect(
+          code,
+          contains(
+              'G_DECLARE_FINAL_TYPE(TestPluginApiCodec, test_plugin_api_codec, TEST_PLUGIN, API_CODEC, FlStandardMessageCodec)'));
+      expect(code, contains('if (TEST_PLUGIN_IS_INPUT(object)) {'));
+      expect(code, contains('case 128:'));
+      expect(code, contains('static FlValue* test_plugin_input_to_list('));
+      expect(code,
+          contains('static TestPluginInput* test_plugin_input_new_from_list('));
+      expect(
+          code,
+          contains(
+              '"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.doSomething"'));
+      expect(
+          code,
+          contains(
+              'fl_basic_message_channel_set_message_handler(do_something_channel, test_plugin_api_do_something_cb, g_object_ref(api_data), g_object_unref);'));
+    }
+  });
+
+  test('module defaults to pigeon', () {
+    final Root root = Root(apis: <Api>[], classes: <Class>[
+      Class(name: 'Foo', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: false),
+            name: 'someValue')
+      ]),
+    ], enums: <Enum>[]);
+    final String code = _generate(root, FileType.header);
+    expect(code, contains('PigeonFoo* pigeon_foo_new(int64_t some_value);'));
+    expect(
+        code, contains('int64_t pigeon_foo_get_some_value(PigeonFoo* self);'));
+  });
+
+  test('classes not sent by an api are not serialized', () {
+    final Root root = Root(apis: <Api>[], classes: <Class>[
+      Class(name: 'Foo', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: false),
+            name: 'value')
+      ]),
+    ], enums: <Enum>[]);
+    final String code = _generate(root, FileType.source);
+    expect(code, contains('PigeonFoo* pigeon_foo_new(int64_t value) {'));
+    expect(code, isNot(contains('pigeon_foo_to_list')));
+    expect(code, isNot(contains('pigeon_foo_new_from_list')));
+  });
+
+  test('enums', () {
+    final Root root = Root(apis: <Api>[], classes: <Class>[], enums: <Enum>[
+      Enum(name: 'Color', members: <EnumMember>[
+        EnumMember(name: 'red'),
+        EnumMember(name: 'darkBlue'),
+      ]),
+    ]);
+    final String code = _generate(root, FileType.header);
+    expect(code, contains('PIGEON_COLOR_RED = 0,'));
+    expect(code, contains('PIGEON_COLOR_DARK_BLUE = 1'));
+    expect(code, contains('} PigeonColor;'));
+  });
+
+  test('nullable arguments are passed as pointers', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'doSomething',
+          parameters: <Parameter>[
+            Parameter(
+                type: const TypeDeclaration(baseName: 'int', isNullable: true),
+                name: 'count'),
+            Parameter(
+                type:
+                    const TypeDeclaration(baseName: 'String', isNullable: true),
+                name: 'label'),
+          ],
+          returnType: const TypeDeclaration(baseName: 'bool', isNullable: true),
+        )
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final String code = _generate(root, FileType.header);
+      expect(
+          code,
+          contains(
+              'PigeonApiDoSomethingResponse* (*do_something)(int64_t* count, const gchar* label, gpointer user_data);'));
+      expect(
+          code,
+          contains(
+              'PigeonApiDoSomethingResponse* pigeon_api_do_something_response_new(gboolean* return_value);'));
+    }
+    {
+      final String code = _generate(root, FileType.source);
+      expect(code, contains('int64_t* count_arg = nullptr;'));
+      expect(code, contains('int64_t count_arg_value;'));
+      expect(code,
+          contains('if (fl_value_get_type(value0) != FL_VALUE_TYPE_NULL) {'));
+      expect(
+          code,
+          contains(
+              'return_value != nullptr ? fl_value_new_bool(*return_value) : fl_value_new_null()'));
+      // No data classes, so the standard codec is used directly.
+      expect(code,
+          contains('g_autoptr(FlStandardMessageCodec) codec = fl_standard_message_codec_new();'));
+    }
+  });
+
+  test('typed data is passed with a length', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'send',
+          parameters: <Parameter>[
+            Parameter(
+                type: const TypeDeclaration(
+                    baseName: 'Uint8List', isNullable: false),
+                name: 'data'),
+          ],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        )
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final String code = _generate(root, FileType.header);
+      expect(
+          code,
+          contains(
+              'PigeonApiSendResponse* (*send)(const uint8_t* data, size_t data_length, gpointer user_data);'));
+      expect(code,
+          contains('PigeonApiSendResponse* pigeon_api_send_response_new(void);'));
+    }
+    {
+      final String code = _generate(root, FileType.source);
+      expect(code,
+          contains('const uint8_t* data_arg = fl_value_get_uint8_list(value0);'));
+      expect(code,
+          contains('size_t data_arg_length = fl_value_get_length(value0);'));
+      expect(
+          code,
+          contains(
+              'self->vtable->send(data_arg, data_arg_length, self->user_data);'));
+    }
+  });
+
+  test('async methods respond through a handle', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'fetch',
+          parameters: <Parameter>[],
+          returnType:
+              const TypeDeclaration(baseName: 'String', isNullable: false),
+          isAsynchronous: true,
+        )
+      ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    {
+      final String code = _generate(root, FileType.header);
+      expect(
+          code,
+          contains(
+              'G_DECLARE_FINAL_TYPE(PigeonApiResponseHandle, pigeon_api_response_handle, PIGEON, API_RESPONSE_HANDLE, GObject)'));
+      expect(
+          code,
+          contains(
+              'void (*fetch)(PigeonApiResponseHandle* response_handle, gpointer user_data);'));
+      expect(
+          code,
+          contains(
+              'void pigeon_api_respond_fetch(PigeonApiResponseHandle* response_handle, const gchar* return_value);'));
+      expect(
+          code,
+          contains(
+              'void pigeon_api_respond_error_fetch(PigeonApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);'));
+      expect(code, isNot(contains('PigeonApiFetchResponse')));
+    }
+    {
+      final String code = _generate(root, FileType.source);
+      expect(
+          code,
+          contains(
+              'g_autoptr(PigeonApiResponseHandle) handle = pigeon_api_response_handle_new(channel, response_handle);'));
+      expect(code, contains('self->vtable->fetch(handle, self->user_data);'));
+    }
+  });
+
+  test('single channel api uses a dispatch table', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+          name: 'Api',
+          location: ApiLocation.host,
+          singleChannel: true,
+          methods: <Method>[
+            Method(
+              name: 'first',
+              parameters: <Parameter>[
+                Parameter(
+                    type: const TypeDeclaration(
+                        baseName: 'int', isNullable: false),
+                    name: 'value'),
+              ],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+            Method(
+              name: 'second',
+              parameters: <Parameter>[],
+              returnType: const TypeDeclaration.voidDeclaration(),
+            ),
+          ])
+    ], classes: <Class>[], enums: <Enum>[]);
+    final String code = _generate(root, FileType.source);
+    expect(
+        code,
+        contains(
+            'static const PigeonApiMethodHandler pigeon_api_method_handlers[] = {'));
+    expect(code, contains('pigeon_api_first_handle,'));
+    expect(code, contains('pigeon_api_second_handle,'));
+    expect(code, contains('"Unknown method index."'));
+    expect(
+        code,
+        contains(
+            'pigeon_api_method_handlers[method_index](PIGEON_API(user_data), channel, message_, 1, response_handle);'));
+    expect(
+        code,
+        contains(
+            'FlValue* value0 = fl_value_get_list_value(args, arg_offset + 0);'));
+    expect(code,
+        contains('"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.__pigeon_dispatch"'));
+    expect(code, isNot(contains('"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.first"')));
+  });
+
+  test('classes used before they are defined are forward declared', () {
+    final Class inner = Class(name: 'Inner', fields: <NamedType>[
+      NamedType(
+          type: const TypeDeclaration(baseName: 'int', isNullable: false),
+          name: 'value')
+    ]);
+    final Root root = Root(apis: <Api>[], classes: <Class>[
+      Class(name: 'Outer', fields: <NamedType>[
+        NamedType(
+            type: TypeDeclaration(
+                baseName: 'Inner', isNullable: true, associatedClass: inner),
+            name: 'inner')
+      ]),
+      inner,
+    ], enums: <Enum>[]);
+    final String code = _generate(root, FileType.header);
+    expect(code, contains('typedef struct _PigeonInner PigeonInner;'));
+    expect(code.indexOf('typedef struct _PigeonInner PigeonInner;'),
+        lessThan(code.indexOf('PigeonOuter* pigeon_outer_new(')));
+  });
+}
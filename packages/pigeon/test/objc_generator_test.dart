@@ -604,6 +604,83 @@ void main() {
         code, contains('self.nested ? [self.nested toList] : [NSNull null]'));
   });
 
+  test('data classes are read and written directly by the codec', () {
+    final Root root = Root(apis: <Api>[
+      Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+        Method(
+          name: 'doSomething',
+          parameters: <Parameter>[
+            Parameter(
+                type: TypeDeclaration(
+                  baseName: 'Nested',
+                  associatedClass: emptyClass,
+                  isNullable: false,
+                ),
+                name: 'nested')
+          ],
+          returnType: const TypeDeclaration.voidDeclaration(),
+        )
+      ])
+    ], classes: <Class>[
+      Class(name: 'Input', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'String', isNullable: true),
+            name: 'input')
+      ]),
+      Class(name: 'Nested', fields: <NamedType>[
+        NamedType(
+            type: const TypeDeclaration(baseName: 'int', isNullable: false),
+            name: 'count'),
+        NamedType(
+            type: const TypeDeclaration(baseName: 'bool', isNullable: false),
+            name: 'enabled'),
+        NamedType(
+            type: TypeDeclaration(
+              baseName: 'Input',
+              associatedClass: emptyClass,
+              isNullable: true,
+            ),
+            name: 'nested')
+      ])
+    ], enums: <Enum>[]);
+    final StringBuffer sink = StringBuffer();
+    const ObjcGenerator generator = ObjcGenerator();
+    final OutputFileOptions<ObjcOptions> generatorOptions =
+        OutputFileOptions<ObjcOptions>(
+      fileType: FileType.source,
+      languageOptions: const ObjcOptions(headerIncludePath: 'foo.h'),
+    );
+    generator.generate(
+      generatorOptions,
+      root,
+      sink,
+      dartPackageName: DEFAULT_PACKAGE_NAME,
+    );
+    final String code = sink.toString();
+    expect(code, contains('static void WriteInteger('));
+    expect(code, contains('static BOOL ReadBool('));
+    expect(code, isNot(contains('static void WriteDouble(')));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains(
+              '- (void)writeToCodecWriter:(FlutterStandardWriter *)writer {'),
+          contains('[writer writeByte:12];'),
+          contains('[writer writeSize:3];'),
+          contains('WriteInteger(writer, self.count);'),
+          contains('WriteBool(writer, self.enabled);'),
+          contains('[self.nested writeToCodecWriter:writer];'),
+        ]));
+    expect(code, contains('pigeonResult.count = ReadInteger(reader);'));
+    expect(
+        code,
+        contains(
+            'pigeonResult.nested = [Input nullableFromCodecReader:reader];'));
+    expect(code, contains('return [Nested nullableFromCodecReader:self];'));
+    expect(code, contains('[value writeToCodecWriter:self];'));
+    expect(code, isNot(contains('[self writeValue:[value toList]];')));
+  });
+
   test('prefix class header', () {
     final Root root = Root(apis: <Api>[], classes: <Class>[
       Class(name: 'Foobar', fields: <NamedType>[
@@ -2628,6 +2705,120 @@ void main() {
     expect(code, contains('taskQueue:taskQueue'));
   });
 
+  test('ObjCZeroCopy reads typed data as views of the message', () {
+    final Root root = Root(
+      apis: <Api>[
+        Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+          Method(
+            name: 'processFrame',
+            returnType: const TypeDeclaration.voidDeclaration(),
+            parameters: <Parameter>[
+              Parameter(
+                name: 'bytes',
+                type: const TypeDeclaration(
+                  baseName: 'Uint8List',
+                  isNullable: false,
+                ),
+              ),
+              Parameter(
+                name: 'width',
+                type: const TypeDeclaration(
+                  baseName: 'int',
+                  isNullable: false,
+                ),
+              ),
+            ],
+            objcZeroCopy: true,
+          ),
+          Method(
+            name: 'ping',
+            returnType: const TypeDeclaration.voidDeclaration(),
+            parameters: <Parameter>[],
+          ),
+        ])
+      ],
+      classes: <Class>[],
+      enums: <Enum>[],
+    );
+    final StringBuffer sink = StringBuffer();
+    const ObjcGenerator generator = ObjcGenerator();
+    final OutputFileOptions<ObjcOptions> generatorOptions =
+        OutputFileOptions<ObjcOptions>(
+      fileType: FileType.source,
+      languageOptions: const ObjcOptions(prefix: 'ABC'),
+    );
+    generator.generate(
+      generatorOptions,
+      root,
+      sink,
+      dartPackageName: DEFAULT_PACKAGE_NAME,
+    );
+    final String code = sink.toString();
+    expect(code, contains('static id ZeroCopyReadValue('));
+    expect(code, contains('initWithBytesNoCopy:'));
+    expect(
+        code.split('\n'),
+        containsAllInOrder(<Matcher>[
+          contains('NSString *channelName = '
+              '@"dev.flutter.pigeon.$DEFAULT_PACKAGE_NAME.Api.processFrame";'),
+          contains('[binaryMessenger setMessageHandlerOnChannel:channelName '
+              'binaryMessageHandler:^(NSData *_Nullable message, '
+              'FlutterBinaryReply reply) {'),
+          contains('reply([ABCApiGetCodec() encode:response]);'),
+          contains('ZeroCopyReadArgumentListHeader(message, &position);'),
+          contains('FlutterStandardTypedData *arg_bytes = '
+              'ZeroCopyReadValue(message, &position);'),
+          contains('NSInteger arg_width = '
+              '[ZeroCopyReadValue(message, &position) integerValue];'),
+          contains('[api processFrameBytes:arg_bytes width:arg_width '
+              'error:&error];'),
+          contains('[binaryMessenger setMessageHandlerOnChannel:channelName '
+              'binaryMessageHandler:nil];'),
+          contains('[channel setMessageHandler:^(id _Nullable message, '
+              'FlutterReply callback) {'),
+        ]));
+  });
+
+  test('zero copy reader is only generated for ObjCZeroCopy', () {
+    final Root root = Root(
+      apis: <Api>[
+        Api(name: 'Api', location: ApiLocation.host, methods: <Method>[
+          Method(
+            name: 'processFrame',
+            returnType: const TypeDeclaration.voidDeclaration(),
+            parameters: <Parameter>[
+              Parameter(
+                name: 'bytes',
+                type: const TypeDeclaration(
+                  baseName: 'Uint8List',
+                  isNullable: false,
+                ),
+              ),
+            ],
+          ),
+        ])
+      ],
+      classes: <Class>[],
+      enums: <Enum>[],
+    );
+    final StringBuffer sink = StringBuffer();
+    const ObjcGenerator generator = ObjcGenerator();
+    final OutputFileOptions<ObjcOptions> generatorOptions =
+        OutputFileOptions<ObjcOptions>(
+      fileType: FileType.source,
+      languageOptions: const ObjcOptions(),
+    );
+    generator.generate(
+      generatorOptions,
+      root,
+      sink,
+      dartPackageName: DEFAULT_PACKAGE_NAME,
+    );
+    final String code = sink.toString();
+    expect(code, isNot(contains('ZeroCopyRead')));
+    expect(code, contains('NSArray *args = message;'));
+  });
+
   test('transfers documentation comments', () {
     final List<String> comments = <String>[
       ' api comment',
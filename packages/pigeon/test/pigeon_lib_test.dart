@@ -122,12 +122,42 @@ void main() {
     expect(opts.cppHeaderOut, equals('foo.h'));
   });
 
+  test('parse args - gobject_header_out', () {
+    final PigeonOptions opts =
+        Pigeon.parseArgs(<String>['--gobject_header_out', 'foo.h']);
+    expect(opts.gobjectHeaderOut, equals('foo.h'));
+  });
+
+  test('parse args - gobject_module', () {
+    final PigeonOptions opts =
+        Pigeon.parseArgs(<String>['--gobject_module', 'url_launcher']);
+    expect(opts.gobjectOptions?.module, equals('url_launcher'));
+  });
+
   test('parse args - java_use_generated_annotation', () {
     final PigeonOptions opts =
         Pigeon.parseArgs(<String>['--java_use_generated_annotation']);
     expect(opts.javaOptions!.useGeneratedAnnotation, isTrue);
   });
 
+  test('parse args - cpp_use_coroutines', () {
+    final PigeonOptions opts =
+        Pigeon.parseArgs(<String>['--cpp_use_coroutines']);
+    expect(opts.cppOptions!.useCoroutines, isTrue);
+  });
+
+  test('parse args - cpp_lazy_decoding', () {
+    final PigeonOptions opts =
+        Pigeon.parseArgs(<String>['--cpp_lazy_decoding']);
+    expect(opts.cppOptions!.lazyDecoding, isTrue);
+  });
+
+  test('parse args - cpp_typed_collections', () {
+    final PigeonOptions opts =
+        Pigeon.parseArgs(<String>['--cpp_typed_collections']);
+    expect(opts.cppOptions!.typedCollections, isTrue);
+  });
+
   test('parse args - cpp_source_out', () {
     final PigeonOptions opts =
         Pigeon.parseArgs(<String>['--cpp_source_out', 'foo.cpp']);
@@ -1281,6 +1311,337 @@ abstract class Api {
         contains('Unsupported TaskQueue specification'));
   });
 
+  test('batched flutter api', () {
+    const String code = '''
+@BatchedFlutterApi()
+abstract class Api {
+  void onReading(int value);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 0);
+    expect(results.root.apis[0].location, equals(ApiLocation.flutter));
+    expect(results.root.apis[0].isBatched, isTrue);
+  });
+
+  test('batched flutter api with return value', () {
+    const String code = '''
+@BatchedFlutterApi()
+abstract class Api {
+  int onReading(int value);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(results.errors[0].message,
+        contains('BatchedFlutterApi methods must return void'));
+  });
+
+  test('stream api', () {
+    const String code = '''
+class Reading {
+  int? value;
+}
+
+@StreamApi()
+abstract class Api {
+  Reading readings();
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 0);
+    expect(results.root.apis[0].location, equals(ApiLocation.host));
+    expect(results.root.apis[0].isStream, isTrue);
+    expect(results.root.classes.map((Class c) => c.name), contains('Reading'));
+  });
+
+  test('stream api with arguments', () {
+    const String code = '''
+@StreamApi()
+abstract class Api {
+  int readings(int rate);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(
+        results.errors[0].message,
+        contains(
+            'StreamApi methods must take no arguments and return their event type'));
+  });
+
+  test('stream api is rejected by the Kotlin generator', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+        name: 'Api',
+        location: ApiLocation.host,
+        isStream: true,
+        methods: <Method>[],
+      ),
+    ], classes: <Class>[], enums: <Enum>[]);
+    final List<Error> errors =
+        KotlinGeneratorAdapter().validate(const PigeonOptions(), root);
+    expect(errors.length, 1);
+    expect(errors[0].message,
+        contains('StreamApi is not supported by the Kotlin generator'));
+  });
+
+  test('ffi host api', () {
+    const String code = '''
+class Point {
+  late int x;
+  late double y;
+}
+
+@FfiHostApi()
+abstract class Api {
+  Point move(Point point, String name, bool flag);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 0);
+    expect(results.root.apis[0].location, equals(ApiLocation.host));
+    expect(results.root.apis[0].isFfi, isTrue);
+  });
+
+  test('ffi host api with unsupported types', () {
+    const String code = '''
+class Message {
+  String? text;
+}
+
+@FfiHostApi()
+abstract class Api {
+  int? count(Message message);
+  @async
+  void wait();
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 3);
+    expect(results.errors[0].message,
+        contains('Unsupported FfiHostApi datatype:"int?"'));
+    expect(results.errors[1].message,
+        contains('Unsupported FfiHostApi datatype:"Message"'));
+    expect(results.errors[2].message,
+        contains('FfiHostApi methods must be synchronous'));
+  });
+
+  test('ffi host api is rejected by the Swift generator', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+        name: 'Api',
+        location: ApiLocation.host,
+        isFfi: true,
+        methods: <Method>[],
+      ),
+    ], classes: <Class>[], enums: <Enum>[]);
+    final List<Error> errors =
+        SwiftGeneratorAdapter().validate(const PigeonOptions(), root);
+    expect(errors.length, 1);
+    expect(errors[0].message,
+        contains('FfiHostApi is not supported by the Swift generator'));
+  });
+
+  test('single channel host api', () {
+    const String code = '''
+@HostApi(singleChannel: true)
+abstract class Api {
+  void doSomething(int value);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 0);
+    expect(results.root.apis[0].singleChannel, isTrue);
+  });
+
+  test('single channel host api with dartHostTestHandler', () {
+    const String code = '''
+@HostApi(singleChannel: true, dartHostTestHandler: 'ApiTestHandler')
+abstract class Api {
+  void doSomething(int value);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(results.errors[0].message,
+        contains('singleChannel can not be combined with dartHostTestHandler'));
+  });
+
+  test('single channel host api is rejected by the Java generator', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+        name: 'Api',
+        location: ApiLocation.host,
+        singleChannel: true,
+        methods: <Method>[],
+      ),
+    ], classes: <Class>[], enums: <Enum>[]);
+    final List<Error> errors =
+        JavaGeneratorAdapter().validate(const PigeonOptions(), root);
+    expect(errors.length, 1);
+    expect(errors[0].message,
+        contains('singleChannel is not supported by the Java generator'));
+  });
+
+  test('flutter api is rejected by the GObject generator', () {
+    final Root root = Root(apis: <Api>[
+      Api(
+        name: 'Api',
+        location: ApiLocation.flutter,
+        methods: <Method>[
+          Method(
+            name: 'doSomething',
+            returnType: const TypeDeclaration.voidDeclaration(),
+            parameters: <Parameter>[],
+          ),
+        ],
+      ),
+    ], classes: <Class>[], enums: <Enum>[]);
+    final List<Error> errors =
+        GObjectGeneratorAdapter().validate(const PigeonOptions(), root);
+    expect(errors.length, 1);
+    expect(errors[0].message,
+        contains('FlutterApi is not supported by the GObject generator'));
+  });
+
+  test('cpp zero copy with background task queue', () {
+    const String code = '''
+@HostApi()
+abstract class Api {
+  @CppZeroCopy()
+  @TaskQueue(type: TaskQueueType.serialBackgroundThread)
+  void processFrame(Uint8List frame);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(
+        results.errors[0].message,
+        contains(
+            'CppZeroCopy can not be combined with a background TaskQueue'));
+  });
+
+  test('cpp zero copy specified', () {
+    const String code = '''
+@HostApi()
+abstract class Api {
+  @CppZeroCopy()
+  void processFrame(Uint8List bytes, int width);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 0);
+    expect(results.root.apis[0].methods[0].cppZeroCopy, isTrue);
+  });
+
+  test('unsupported cpp zero copy on async method', () {
+    const String code = '''
+@HostApi()
+abstract class Api {
+  @async
+  @CppZeroCopy()
+  void processFrame(Uint8List bytes);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(results.errors[0].message,
+        contains('CppZeroCopy is only supported on synchronous HostApi'));
+  });
+
+  test('cpp zero copy without typed data', () {
+    const String code = '''
+@HostApi()
+abstract class Api {
+  @CppZeroCopy()
+  void processFrame(int width);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(results.errors[0].message,
+        contains('CppZeroCopy requires a typed data, String or data class '
+            'parameter'));
+  });
+
+  test('objc zero copy specified', () {
+    const String code = '''
+@HostApi()
+abstract class Api {
+  @async
+  @ObjCZeroCopy()
+  void processFrame(Uint8List bytes, int width, String? label);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 0);
+    expect(results.root.apis[0].methods[0].objcZeroCopy, isTrue);
+    expect(results.root.apis[0].methods[0].cppZeroCopy, isFalse);
+  });
+
+  test('objc zero copy without typed data', () {
+    const String code = '''
+@HostApi()
+abstract class Api {
+  @ObjCZeroCopy()
+  void log(String message);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(results.errors[0].message,
+        contains('ObjCZeroCopy requires a typed data parameter'));
+  });
+
+  test('unsupported objc zero copy parameter type', () {
+    const String code = '''
+class Frame {
+  int? width;
+}
+
+@HostApi()
+abstract class Api {
+  @ObjCZeroCopy()
+  void processFrame(Uint8List bytes, Frame frame);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(results.errors[0].message,
+        contains('Unsupported ObjCZeroCopy parameter type:"Frame"'));
+  });
+
+  test('unsupported objc zero copy on FlutterApi', () {
+    const String code = '''
+@FlutterApi()
+abstract class Api {
+  @ObjCZeroCopy()
+  void processFrame(Uint8List bytes);
+}
+''';
+
+    final ParseResults results = parseSource(code);
+    expect(results.errors.length, 1);
+    expect(results.errors[0].message,
+        contains('ObjCZeroCopy is only supported on HostApi methods'));
+  });
+
   test('generator validation', () async {
     final Completer<void> completer = Completer<void>();
     withTempFile('foo.dart', (File input) async {
@@ -7,6 +7,7 @@
 #include <optional>
 
 #include "flutter/generated_plugin_registrant.h"
+#include "utils.h"
 
 FlutterWindow::FlutterWindow(const flutter::DartProject& project)
     : project_(project) {}
@@ -28,8 +29,17 @@ bool FlutterWindow::OnCreate() {
   if (!flutter_controller_->engine() || !flutter_controller_->view()) {
     return false;
   }
+  LogStartupMilestone("engine ready");
   RegisterPlugins(flutter_controller_->engine());
   SetChildContent(flutter_controller_->view()->GetNativeWindow());
+
+  // Keep the window hidden until Flutter has rendered something into it, so
+  // the user never sees an empty window while the engine starts.
+  flutter_controller_->engine()->SetNextFrameCallback([&]() {
+    LogStartupMilestone("first frame");
+    this->Show();
+  });
+
   return true;
 }
 
@@ -6,6 +6,8 @@
 #include <flutter/flutter_view_controller.h>
 #include <windows.h>
 
+#include <thread>
+
 #include "flutter_window.h"
 #include "utils.h"
 
@@ -21,6 +23,10 @@ int APIENTRY wWinMain(_In_ HINSTANCE instance, _In_opt_ HINSTANCE prev,
   // plugins.
   ::CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
 
+  // Warm the file cache with the engine's data files while the window and
+  // engine are created.
+  std::thread prefetch_thread(PrefetchFlutterData, L"data");
+
   flutter::DartProject project(L"data");
 
   std::vector<std::string> command_line_arguments = GetCommandLineArguments();
@@ -30,7 +36,8 @@ int APIENTRY wWinMain(_In_ HINSTANCE instance, _In_opt_ HINSTANCE prev,
   FlutterWindow window(project);
   Win32Window::Point origin(10, 10);
   Win32Window::Size size(1280, 720);
-  if (!window.CreateAndShow(L"wasm", origin, size)) {
+  if (!window.Create(L"wasm", origin, size)) {
+    prefetch_thread.join();
     return EXIT_FAILURE;
   }
   window.SetQuitOnClose(true);
@@ -41,6 +48,7 @@ int APIENTRY wWinMain(_In_ HINSTANCE instance, _In_opt_ HINSTANCE prev,
     ::DispatchMessage(&msg);
   }
 
+  prefetch_thread.join();
   ::CoUninitialize();
   return EXIT_SUCCESS;
 }
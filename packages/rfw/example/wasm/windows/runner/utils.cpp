@@ -10,6 +10,7 @@
 #include <windows.h>
 
 #include <iostream>
+#include <memory>
 
 void CreateAndAttachConsole() {
   if (::AllocConsole()) {
@@ -65,3 +66,57 @@ std::string Utf8FromUtf16(const wchar_t* utf16_string) {
   }
   return utf8_string;
 }
+
+void PrefetchFlutterData(const std::wstring& data_directory) {
+  wchar_t executable_path[MAX_PATH];
+  DWORD length = ::GetModuleFileNameW(nullptr, executable_path, MAX_PATH);
+  if (length == 0 || length == MAX_PATH) {
+    return;
+  }
+  std::wstring directory(executable_path, length);
+  directory = directory.substr(0, directory.find_last_of(L'\\') + 1) +
+              data_directory + L"\\";
+
+  // The AOT snapshot is only present in profile and release builds, and the
+  // kernel blob only in debug builds.
+  const wchar_t* files[] = {L"app.so", L"icudtl.dat",
+                            L"flutter_assets\\kernel_blob.bin"};
+  constexpr DWORD kChunkSize = 1 << 20;
+  auto buffer = std::make_unique<char[]>(kChunkSize);
+  for (const wchar_t* file : files) {
+    HANDLE handle = ::CreateFileW((directory + file).c_str(), GENERIC_READ,
+                                  FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+      continue;
+    }
+    DWORD bytes_read;
+    while (::ReadFile(handle, buffer.get(), kChunkSize, &bytes_read,
+                      nullptr) &&
+           bytes_read > 0) {
+    }
+    ::CloseHandle(handle);
+  }
+}
+
+void LogStartupMilestone(const char* milestone) {
+#ifndef NDEBUG
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  if (!::GetProcessTimes(::GetCurrentProcess(), &creation_time, &exit_time,
+                         &kernel_time, &user_time)) {
+    return;
+  }
+  FILETIME now;
+  ::GetSystemTimePreciseAsFileTime(&now);
+
+  ULARGE_INTEGER start, current;
+  start.LowPart = creation_time.dwLowDateTime;
+  start.HighPart = creation_time.dwHighDateTime;
+  current.LowPart = now.dwLowDateTime;
+  current.HighPart = now.dwHighDateTime;
+  // FILETIME values are in 100-nanosecond intervals.
+  double elapsed_ms = (current.QuadPart - start.QuadPart) / 10000.0;
+  std::cout << "Startup: " << milestone << " after " << elapsed_ms << " ms"
+            << std::endl;
+#endif
+}
@@ -20,4 +20,14 @@ std::string Utf8FromUtf16(const wchar_t* utf16_string);
 // encoded in UTF-8. Returns an empty std::vector<std::string> on failure.
 std::vector<std::string> GetCommandLineArguments();
 
+// Reads the engine's data files in |data_directory|, a path relative to the
+// executable like the one given to flutter::DartProject, so that they are in
+// the file cache when the engine loads them. Meant to run on a background
+// thread while the window and engine are created.
+void PrefetchFlutterData(const std::wstring& data_directory);
+
+// Prints |milestone| with the time elapsed since the process was created.
+// Does nothing in profile and release builds.
+void LogStartupMilestone(const char* milestone);
+
 #endif  // RUNNER_UTILS_H_
@@ -104,8 +104,8 @@ Win32Window::~Win32Window() {
   Destroy();
 }
 
-bool Win32Window::CreateAndShow(const std::wstring& title, const Point& origin,
-                                const Size& size) {
+bool Win32Window::Create(const std::wstring& title, const Point& origin,
+                         const Size& size) {
   Destroy();
 
   const wchar_t* window_class =
@@ -118,7 +118,7 @@ bool Win32Window::CreateAndShow(const std::wstring& title, const Point& origin,
   double scale_factor = dpi / 96.0;
 
   HWND window = CreateWindow(
-      window_class, title.c_str(), WS_OVERLAPPEDWINDOW | WS_VISIBLE,
+      window_class, title.c_str(), WS_OVERLAPPEDWINDOW,
       Scale(origin.x, scale_factor), Scale(origin.y, scale_factor),
       Scale(size.width, scale_factor), Scale(size.height, scale_factor),
       nullptr, nullptr, GetModuleHandle(nullptr), this);
@@ -130,6 +130,8 @@ bool Win32Window::CreateAndShow(const std::wstring& title, const Point& origin,
   return OnCreate();
 }
 
+bool Win32Window::Show() { return ShowWindow(window_handle_, SW_SHOWNORMAL); }
+
 // static
 LRESULT CALLBACK Win32Window::WndProc(HWND const window, UINT const message,
                                       WPARAM const wparam,
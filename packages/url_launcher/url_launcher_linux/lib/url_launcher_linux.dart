@@ -29,6 +29,21 @@ class UrlLauncherLinux extends UrlLauncherPlatform {
     ).then((bool? value) => value ?? false);
   }
 
+  /// Returns whether each of [urls] can be launched, in the same order.
+  ///
+  /// This checks all of the URLs in a single platform call, which is cheaper
+  /// than calling [canLaunch] for each URL.
+  Future<List<bool>> canLaunchUrls(List<String> urls) async {
+    final List<bool?>? results = await _channel.invokeListMethod<bool?>(
+      'canLaunchUrls',
+      <String, Object>{'urls': urls},
+    );
+    return List<bool>.generate(
+        urls.length,
+        (int i) =>
+            results != null && i < results.length && (results[i] ?? false));
+  }
+
   @override
   Future<bool> launch(
     String url, {
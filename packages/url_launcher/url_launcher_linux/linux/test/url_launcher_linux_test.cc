@@ -64,6 +64,75 @@ TEST(UrlLauncherPlugin, CanLaunchFailureInvalidFileExtension) {
                              expected));
 }
 
+TEST(UrlLauncherPlugin, CanLaunchUrls) {
+  g_autoptr(FlValue) urls = fl_value_new_list();
+  fl_value_append_take(urls, fl_value_new_string("https://flutter.dev"));
+  fl_value_append_take(urls, fl_value_new_string("madeup:scheme"));
+  fl_value_append_take(urls, fl_value_new_string("file:///"));
+  fl_value_append_take(urls, fl_value_new_string(""));
+  fl_value_append_take(urls, fl_value_new_int(42));
+  g_autoptr(FlValue) args = fl_value_new_map();
+  fl_value_set_string(args, "urls", urls);
+  g_autoptr(FlMethodResponse) response = can_launch_urls(nullptr, args);
+  ASSERT_NE(response, nullptr);
+  ASSERT_TRUE(FL_IS_METHOD_SUCCESS_RESPONSE(response));
+  g_autoptr(FlValue) expected = fl_value_new_list();
+  fl_value_append_take(expected, fl_value_new_bool(true));
+  fl_value_append_take(expected, fl_value_new_bool(false));
+  fl_value_append_take(expected, fl_value_new_bool(true));
+  fl_value_append_take(expected, fl_value_new_bool(false));
+  fl_value_append_take(expected, fl_value_new_bool(false));
+  EXPECT_TRUE(fl_value_equal(fl_method_success_response_get_result(
+                                 FL_METHOD_SUCCESS_RESPONSE(response)),
+                             expected));
+}
+
+TEST(UrlLauncherPlugin, CanLaunchUrlsMissingList) {
+  g_autoptr(FlValue) args = fl_value_new_map();
+  g_autoptr(FlMethodResponse) response = can_launch_urls(nullptr, args);
+  ASSERT_NE(response, nullptr);
+  EXPECT_TRUE(FL_IS_METHOD_ERROR_RESPONSE(response));
+}
+
+TEST(UrlLauncherPlugin, LaunchMissingUrl) {
+  g_autoptr(FlValue) args = fl_value_new_map();
+  // A call with bad arguments is answered right away, without launching.
+  g_autoptr(FlMethodResponse) response = launch(nullptr, args, nullptr);
+  ASSERT_NE(response, nullptr);
+  ASSERT_TRUE(FL_IS_METHOD_ERROR_RESPONSE(response));
+  EXPECT_STREQ(fl_method_error_response_get_code(
+                   FL_METHOD_ERROR_RESPONSE(response)),
+               "Bad Arguments");
+}
+
+TEST(UrlLauncherPlugin, LaunchMalformedArguments) {
+  g_autoptr(FlValue) args = fl_value_new_string("https://flutter.dev");
+  g_autoptr(FlMethodResponse) response = launch(nullptr, args, nullptr);
+  ASSERT_NE(response, nullptr);
+  ASSERT_TRUE(FL_IS_METHOD_ERROR_RESPONSE(response));
+  EXPECT_STREQ(fl_method_error_response_get_code(
+                   FL_METHOD_ERROR_RESPONSE(response)),
+               "Bad Arguments");
+}
+
+TEST(UrlLauncherPlugin, CanLaunchUsesHandlerCache) {
+  g_autoptr(FlUrlLauncherPlugin) plugin = FL_URL_LAUNCHER_PLUGIN(
+      g_object_new(fl_url_launcher_plugin_get_type(), nullptr));
+  // Repeated lookups of the same scheme must give the same result, whether
+  // or not they come from the cache.
+  for (int i = 0; i < 2; i++) {
+    g_autoptr(FlValue) args = fl_value_new_map();
+    fl_value_set_string_take(args, "url",
+                             fl_value_new_string("HTTPS://flutter.dev"));
+    g_autoptr(FlMethodResponse) response = can_launch(plugin, args);
+    ASSERT_TRUE(FL_IS_METHOD_SUCCESS_RESPONSE(response));
+    g_autoptr(FlValue) expected = fl_value_new_bool(true);
+    EXPECT_TRUE(fl_value_equal(fl_method_success_response_get_result(
+                                   FL_METHOD_SUCCESS_RESPONSE(response)),
+                               expected));
+  }
+}
+
 // For consistency with the established mobile implementations,
 // an invalid URL should return false, not an error.
 TEST(UrlLauncherPlugin, CanLaunchFailureInvalidUrl) {
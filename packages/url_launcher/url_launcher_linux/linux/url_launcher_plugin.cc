@@ -16,8 +16,10 @@ const char kChannelName[] = "plugins.flutter.io/url_launcher_linux";
 const char kBadArgumentsError[] = "Bad Arguments";
 const char kLaunchError[] = "Launch Error";
 const char kCanLaunchMethod[] = "canLaunch";
+const char kCanLaunchUrlsMethod[] = "canLaunchUrls";
 const char kLaunchMethod[] = "launch";
 const char kUrlKey[] = "url";
+const char kUrlsKey[] = "urls";
 
 struct _FlUrlLauncherPlugin {
   GObject parent_instance;
@@ -26,6 +28,15 @@ struct _FlUrlLauncherPlugin {
 
   // Connection to Flutter engine.
   FlMethodChannel* channel;
+
+  // Reports changes to installed applications, which invalidate
+  // handler_cache.
+  GAppInfoMonitor* app_info_monitor;
+
+  // Default handlers, keyed by "scheme:<scheme>" or
+  // "type:<content type>:<requires URI support>". A NULL value records that
+  // there is no handler.
+  GHashTable* handler_cache;
 };
 
 G_DEFINE_TYPE(FlUrlLauncherPlugin, fl_url_launcher_plugin, g_object_get_type())
@@ -45,16 +56,75 @@ static gchar* get_url(FlValue* args, GError** error) {
   return g_strdup(fl_value_get_string(url_value));
 }
 
+// Returns a new reference to the default handler for |key|, using the cache
+// in |self| if there is one, and otherwise calling |lookup| with |argument|.
+static GAppInfo* get_handler(FlUrlLauncherPlugin* self, const gchar* key,
+                             GAppInfo* (*lookup)(const gchar*, gboolean),
+                             const gchar* argument, gboolean flag) {
+  gpointer cached;
+  if (self != nullptr &&
+      g_hash_table_lookup_extended(self->handler_cache, key, nullptr,
+                                   &cached)) {
+    return cached == nullptr ? nullptr
+                             : G_APP_INFO(g_object_ref(G_APP_INFO(cached)));
+  }
+
+  GAppInfo* app_info = lookup(argument, flag);
+  if (self != nullptr) {
+    g_hash_table_insert(self->handler_cache, g_strdup(key),
+                        app_info == nullptr ? nullptr : g_object_ref(app_info));
+  }
+  return app_info;
+}
+
+// Adapts g_app_info_get_default_for_uri_scheme to get_handler.
+static GAppInfo* default_for_uri_scheme(const gchar* scheme, gboolean unused) {
+  return g_app_info_get_default_for_uri_scheme(scheme);
+}
+
 // Checks if URI has launchable file resource.
+//
+// This is equivalent to g_file_query_default_handler, but caches the handler
+// lookup by content type, since only the content type query needs to touch
+// the file.
 static gboolean can_launch_uri_with_file_resource(FlUrlLauncherPlugin* self,
                                                   const gchar* url) {
-  g_autoptr(GError) error = nullptr;
   g_autoptr(GFile) file = g_file_new_for_uri(url);
+  g_autoptr(GFileInfo) info =
+      g_file_query_info(file, G_FILE_ATTRIBUTE_STANDARD_CONTENT_TYPE,
+                        G_FILE_QUERY_INFO_NONE, nullptr, nullptr);
+  if (info == nullptr) {
+    return FALSE;
+  }
+  const gchar* content_type = g_file_info_get_content_type(info);
+  if (content_type == nullptr) {
+    return FALSE;
+  }
+  // Non-local files need a handler that can open them by URI.
+  gboolean must_support_uris = !g_file_is_native(file);
+  g_autofree gchar* key =
+      g_strdup_printf("type:%s:%d", content_type, must_support_uris);
   g_autoptr(GAppInfo) app_info =
-      g_file_query_default_handler(file, NULL, &error);
+      get_handler(self, key, g_app_info_get_default_for_type, content_type,
+                  must_support_uris);
   return app_info != nullptr;
 }
 
+// Returns TRUE if |url| can be launched.
+static gboolean can_launch_url(FlUrlLauncherPlugin* self, const gchar* url) {
+  g_autofree gchar* scheme = g_uri_parse_scheme(url);
+  if (scheme == nullptr) {
+    return FALSE;
+  }
+
+  // Schemes are case-insensitive.
+  g_autofree gchar* lower_scheme = g_ascii_strdown(scheme, -1);
+  g_autofree gchar* key = g_strconcat("scheme:", lower_scheme, nullptr);
+  g_autoptr(GAppInfo) app_info =
+      get_handler(self, key, default_for_uri_scheme, lower_scheme, FALSE);
+  return app_info != nullptr || can_launch_uri_with_file_resource(self, url);
+}
+
 // Called to check if a URL can be launched.
 FlMethodResponse* can_launch(FlUrlLauncherPlugin* self, FlValue* args) {
   g_autoptr(GError) error = nullptr;
@@ -64,24 +134,66 @@ FlMethodResponse* can_launch(FlUrlLauncherPlugin* self, FlValue* args) {
         kBadArgumentsError, error->message, nullptr));
   }
 
-  gboolean is_launchable = FALSE;
-  g_autofree gchar* scheme = g_uri_parse_scheme(url);
-  if (scheme != nullptr) {
-    g_autoptr(GAppInfo) app_info =
-        g_app_info_get_default_for_uri_scheme(scheme);
-    is_launchable = app_info != nullptr;
+  g_autoptr(FlValue) result = fl_value_new_bool(can_launch_url(self, url));
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
 
-    if (!is_launchable) {
-      is_launchable = can_launch_uri_with_file_resource(self, url);
-    }
+// Called to check if each of a list of URLs can be launched.
+FlMethodResponse* can_launch_urls(FlUrlLauncherPlugin* self, FlValue* args) {
+  FlValue* urls = fl_value_get_type(args) == FL_VALUE_TYPE_MAP
+                      ? fl_value_lookup_string(args, kUrlsKey)
+                      : nullptr;
+  if (urls == nullptr || fl_value_get_type(urls) != FL_VALUE_TYPE_LIST) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        kBadArgumentsError, "Missing URL list", nullptr));
   }
 
-  g_autoptr(FlValue) result = fl_value_new_bool(is_launchable);
+  g_autoptr(FlValue) result = fl_value_new_list();
+  for (size_t i = 0; i < fl_value_get_length(urls); i++) {
+    FlValue* url = fl_value_get_list_value(urls, i);
+    fl_value_append_take(
+        result, fl_value_new_bool(
+                    fl_value_get_type(url) == FL_VALUE_TYPE_STRING &&
+                    can_launch_url(self, fl_value_get_string(url))));
+  }
   return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
 }
 
+// Sends |response| to the call it answers.
+static void respond(FlMethodCall* method_call, FlMethodResponse* response) {
+  g_autoptr(GError) error = nullptr;
+  if (!fl_method_call_respond(method_call, response, &error))
+    g_warning("Failed to send method call response: %s", error->message);
+}
+
+// Called when launching a URL completes, to respond to the launch call, which
+// is |user_data|.
+static void launch_finished_cb(GObject* object, GAsyncResult* result,
+                               gpointer user_data) {
+  g_autoptr(FlMethodCall) method_call = FL_METHOD_CALL(user_data);
+
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(FlMethodResponse) response = nullptr;
+  if (g_app_info_launch_default_for_uri_finish(result, &error)) {
+    g_autoptr(FlValue) value = fl_value_new_bool(TRUE);
+    response = FL_METHOD_RESPONSE(fl_method_success_response_new(value));
+  } else {
+    g_autofree gchar* message =
+        g_strdup_printf("Failed to launch URL: %s", error->message);
+    response = FL_METHOD_RESPONSE(
+        fl_method_error_response_new(kLaunchError, message, nullptr));
+  }
+  respond(method_call, response);
+}
+
 // Called when a URL should launch.
-static FlMethodResponse* launch(FlUrlLauncherPlugin* self, FlValue* args) {
+//
+// Starting the default handler can take a long time, for example when a
+// browser is started through D-Bus activation or a portal, so the URL is
+// launched asynchronously and |method_call| is answered once that completes,
+// leaving the main loop free in the meantime.
+FlMethodResponse* launch(FlUrlLauncherPlugin* self, FlValue* args,
+                         FlMethodCall* method_call) {
   g_autoptr(GError) error = nullptr;
   g_autofree gchar* url = get_url(args, &error);
   if (url == nullptr) {
@@ -89,23 +201,21 @@ static FlMethodResponse* launch(FlUrlLauncherPlugin* self, FlValue* args) {
         kBadArgumentsError, error->message, nullptr));
   }
 
+  // Launching from the view's display lets the handler take focus from the
+  // window.
+  g_autoptr(GAppLaunchContext) context = nullptr;
   FlView* view = fl_plugin_registrar_get_view(self->registrar);
-  gboolean launched;
   if (view != nullptr) {
-    GtkWindow* window = GTK_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(view)));
-    launched = gtk_show_uri_on_window(window, url, GDK_CURRENT_TIME, &error);
-  } else {
-    launched = g_app_info_launch_default_for_uri(url, nullptr, &error);
+    GdkAppLaunchContext* gdk_context =
+        gdk_display_get_app_launch_context(gtk_widget_get_display(
+            gtk_widget_get_toplevel(GTK_WIDGET(view))));
+    gdk_app_launch_context_set_timestamp(gdk_context, GDK_CURRENT_TIME);
+    context = G_APP_LAUNCH_CONTEXT(gdk_context);
   }
-  if (!launched) {
-    g_autofree gchar* message =
-        g_strdup_printf("Failed to launch URL: %s", error->message);
-    return FL_METHOD_RESPONSE(
-        fl_method_error_response_new(kLaunchError, message, nullptr));
-  }
-
-  g_autoptr(FlValue) result = fl_value_new_bool(TRUE);
-  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+  g_app_info_launch_default_for_uri_async(url, context, nullptr,
+                                          launch_finished_cb,
+                                          g_object_ref(method_call));
+  return nullptr;
 }
 
 // Called when a method call is received from Flutter.
@@ -117,16 +227,21 @@ static void method_call_cb(FlMethodChannel* channel, FlMethodCall* method_call,
   FlValue* args = fl_method_call_get_args(method_call);
 
   g_autoptr(FlMethodResponse) response = nullptr;
-  if (strcmp(method, kCanLaunchMethod) == 0)
+  if (strcmp(method, kCanLaunchMethod) == 0) {
     response = can_launch(self, args);
-  else if (strcmp(method, kLaunchMethod) == 0)
-    response = launch(self, args);
-  else
+  } else if (strcmp(method, kCanLaunchUrlsMethod) == 0) {
+    response = can_launch_urls(self, args);
+  } else if (strcmp(method, kLaunchMethod) == 0) {
+    response = launch(self, args, method_call);
+    if (response == nullptr) {
+      // Responds once the URL has launched.
+      return;
+    }
+  } else {
     response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
+  }
 
-  g_autoptr(GError) error = nullptr;
-  if (!fl_method_call_respond(method_call, response, &error))
-    g_warning("Failed to send method call response: %s", error->message);
+  respond(method_call, response);
 }
 
 static void fl_url_launcher_plugin_dispose(GObject* object) {
@@ -134,10 +249,28 @@ static void fl_url_launcher_plugin_dispose(GObject* object) {
 
   g_clear_object(&self->registrar);
   g_clear_object(&self->channel);
+  if (self->app_info_monitor != nullptr) {
+    g_signal_handlers_disconnect_by_data(self->app_info_monitor, self);
+    g_clear_object(&self->app_info_monitor);
+  }
+  g_clear_pointer(&self->handler_cache, g_hash_table_unref);
 
   G_OBJECT_CLASS(fl_url_launcher_plugin_parent_class)->dispose(object);
 }
 
+// Called when the set of installed applications or their associations change.
+static void app_info_changed_cb(GAppInfoMonitor* monitor, gpointer user_data) {
+  FlUrlLauncherPlugin* self = FL_URL_LAUNCHER_PLUGIN(user_data);
+  g_hash_table_remove_all(self->handler_cache);
+}
+
+// Releases a handler_cache value, which may be NULL.
+static void handler_cache_value_free(gpointer value) {
+  if (value != nullptr) {
+    g_object_unref(value);
+  }
+}
+
 static void fl_url_launcher_plugin_class_init(FlUrlLauncherPluginClass* klass) {
   G_OBJECT_CLASS(klass)->dispose = fl_url_launcher_plugin_dispose;
 }
@@ -158,7 +291,15 @@ FlUrlLauncherPlugin* fl_url_launcher_plugin_new(FlPluginRegistrar* registrar) {
   return self;
 }
 
-static void fl_url_launcher_plugin_init(FlUrlLauncherPlugin* self) {}
+static void fl_url_launcher_plugin_init(FlUrlLauncherPlugin* self) {
+  self->handler_cache = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                              handler_cache_value_free);
+  // The monitor only emits signals once the application database has been
+  // loaded, which the first handler lookup does.
+  self->app_info_monitor = g_app_info_monitor_get();
+  g_signal_connect(self->app_info_monitor, "changed",
+                   G_CALLBACK(app_info_changed_cb), self);
+}
 
 void url_launcher_plugin_register_with_registrar(FlPluginRegistrar* registrar) {
   FlUrlLauncherPlugin* plugin = fl_url_launcher_plugin_new(registrar);
@@ -12,3 +12,13 @@
 
 // Handles the canLaunch method call.
 FlMethodResponse* can_launch(FlUrlLauncherPlugin* self, FlValue* args);
+
+// Handles the canLaunchUrls method call.
+FlMethodResponse* can_launch_urls(FlUrlLauncherPlugin* self, FlValue* args);
+
+// Handles the launch method call.
+//
+// Returns the response if the call can be answered right away, or nullptr if
+// |method_call| is answered once the URL has launched.
+FlMethodResponse* launch(FlUrlLauncherPlugin* self, FlValue* args,
+                         FlMethodCall* method_call);
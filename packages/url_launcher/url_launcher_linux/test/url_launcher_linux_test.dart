@@ -53,6 +53,29 @@ void main() {
       expect(canLaunch, false);
     });
 
+    test('canLaunchUrls', () async {
+      final UrlLauncherLinux launcher = UrlLauncherLinux();
+      await launcher
+          .canLaunchUrls(<String>['http://example.com/', 'madeup:scheme']);
+      expect(
+        log,
+        <Matcher>[
+          isMethodCall('canLaunchUrls', arguments: <String, Object>{
+            'urls': <String>['http://example.com/', 'madeup:scheme'],
+          })
+        ],
+      );
+    });
+
+    test('canLaunchUrls should return false for each URL if platform returns null',
+        () async {
+      final UrlLauncherLinux launcher = UrlLauncherLinux();
+      final List<bool> canLaunch = await launcher
+          .canLaunchUrls(<String>['http://example.com/', 'madeup:scheme']);
+
+      expect(canLaunch, <bool>[false, false]);
+    });
+
     test('launch', () async {
       final UrlLauncherLinux launcher = UrlLauncherLinux();
       await launcher.launch(
@@ -30,6 +30,15 @@ class UrlLauncherWindows extends UrlLauncherPlatform {
     return _hostApi.canLaunchUrl(url);
   }
 
+  /// Returns whether each of [urls] can be launched, in the same order.
+  ///
+  /// This is equivalent to calling [canLaunch] for each URL, but checks them
+  /// all in a single call to the host.
+  Future<List<bool>> canLaunchUrls(List<String> urls) async {
+    final List<bool?> results = await _hostApi.canLaunchUrls(urls);
+    return results.map((bool? result) => result ?? false).toList();
+  }
+
   @override
   Future<bool> launch(
     String url, {
@@ -14,5 +14,7 @@ import 'package:pigeon/pigeon.dart';
 @HostApi(dartHostTestHandler: 'TestUrlLauncherApi')
 abstract class UrlLauncherApi {
   bool canLaunchUrl(String url);
+  List<bool> canLaunchUrls(List<String> urls);
+  @async
   void launchUrl(String url);
 }
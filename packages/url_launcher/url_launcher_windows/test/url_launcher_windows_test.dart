@@ -42,6 +42,19 @@ void main() {
     });
   });
 
+  group('canLaunchUrls', () {
+    test('returns a result per URL', () async {
+      api.canLaunch = true;
+
+      final List<bool> result = await plugin.canLaunchUrls(
+          <String>['http://example.com/', 'https://example.com/']);
+
+      expect(result, <bool>[true, true]);
+      expect(api.argumentList,
+          <String>['http://example.com/', 'https://example.com/']);
+    });
+  });
+
   group('launch', () {
     test('handles success', () async {
       api.canLaunch = true;
@@ -122,9 +135,13 @@ class _FakeUrlLauncherApi implements UrlLauncherApi {
   /// The argument that was passed to an API call.
   String? argument;
 
+  /// The list argument that was passed to an API call.
+  List<String?>? argumentList;
+
   /// Controls the behavior of the fake implementations.
   ///
   /// - [canLaunchUrl] returns this value.
+  /// - [canLaunchUrls] returns this value for each URL.
   /// - [launchUrl] throws if this is false.
   bool canLaunch = false;
 
@@ -134,6 +151,12 @@ class _FakeUrlLauncherApi implements UrlLauncherApi {
     return canLaunch;
   }
 
+  @override
+  Future<List<bool?>> canLaunchUrls(List<String?> urls) async {
+    argumentList = urls;
+    return List<bool?>.filled(urls.length, canLaunch);
+  }
+
   @override
   Future<void> launchUrl(String url) async {
     argument = url;
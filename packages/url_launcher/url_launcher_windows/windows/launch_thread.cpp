@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#include "launch_thread.h"
+
+#include <objbase.h>
+#include <windows.h>
+
+#include <cassert>
+#include <utility>
+
+namespace url_launcher_windows {
+
+LaunchThread::LaunchThread()
+    : wake_event_(::CreateEvent(nullptr, FALSE, FALSE, nullptr)) {
+  assert(wake_event_ != nullptr);
+  thread_ = std::thread(&LaunchThread::Run, this);
+}
+
+LaunchThread::~LaunchThread() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  ::SetEvent(wake_event_);
+  thread_.join();
+  ::CloseHandle(wake_event_);
+}
+
+void LaunchThread::PostTask(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(std::move(task));
+  }
+  ::SetEvent(wake_event_);
+}
+
+void LaunchThread::Run() {
+  HRESULT com_result = ::CoInitializeEx(
+      nullptr, COINIT_APARTMENTTHREADED | COINIT_DISABLE_OLE1DDE);
+  while (true) {
+    DWORD wait_result = ::MsgWaitForMultipleObjectsEx(
+        1, &wake_event_, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+    if (wait_result == WAIT_OBJECT_0 + 1) {
+      MSG message;
+      while (::PeekMessage(&message, nullptr, 0, 0, PM_REMOVE)) {
+        ::TranslateMessage(&message);
+        ::DispatchMessage(&message);
+      }
+    } else if (!RunQueuedTasks()) {
+      break;
+    }
+  }
+  if (SUCCEEDED(com_result)) {
+    ::CoUninitialize();
+  }
+}
+
+bool LaunchThread::RunQueuedTasks() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (tasks_.empty()) {
+        return !stopping_;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+}  // namespace url_launcher_windows
@@ -0,0 +1,59 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#ifndef PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_LAUNCH_THREAD_H_
+#define PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_LAUNCH_THREAD_H_
+
+#include <windows.h>
+
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "task_runner.h"
+
+namespace url_launcher_windows {
+
+// A TaskRunner backed by a dedicated single-threaded apartment thread, so that
+// slow URL handlers can start without blocking the platform thread.
+//
+// ShellExecuteEx requires COM to be initialized, and the thread pumps window
+// messages while idle, as required for an STA thread.
+class LaunchThread : public TaskRunner {
+ public:
+  LaunchThread();
+
+  // Stops the thread after any already-posted tasks have run. This blocks
+  // until the thread exits.
+  virtual ~LaunchThread();
+
+  // Disallow copy and assign.
+  LaunchThread(const LaunchThread&) = delete;
+  LaunchThread& operator=(const LaunchThread&) = delete;
+
+  // TaskRunner:
+  void PostTask(std::function<void()> task) override;
+
+ private:
+  // The thread's main loop.
+  void Run();
+
+  // Runs all currently queued tasks. Returns false if the thread should exit.
+  bool RunQueuedTasks();
+
+  // Guards |tasks_| and |stopping_|.
+  std::mutex mutex_;
+  std::queue<std::function<void()>> tasks_;
+  bool stopping_ = false;
+
+  // An auto-reset event signaled when tasks are posted or the thread should
+  // stop.
+  HANDLE wake_event_;
+
+  std::thread thread_;
+};
+
+}  // namespace url_launcher_windows
+
+#endif  // PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_LAUNCH_THREAD_H_
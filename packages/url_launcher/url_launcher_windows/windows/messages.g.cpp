@@ -66,6 +66,39 @@ void UrlLauncherApi::SetUp(flutter::BinaryMessenger* binary_messenger,
       channel->SetMessageHandler(nullptr);
     }
   }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger, "dev.flutter.pigeon.UrlLauncherApi.canLaunchUrls",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_urls_arg = args.at(0);
+              if (encodable_urls_arg.IsNull()) {
+                reply(WrapError("urls_arg unexpectedly null."));
+                return;
+              }
+              const auto& urls_arg =
+                  std::get<EncodableList>(encodable_urls_arg);
+              ErrorOr<EncodableList> output = api->CanLaunchUrls(urls_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
   {
     auto channel = std::make_unique<BasicMessageChannel<>>(
         binary_messenger, "dev.flutter.pigeon.UrlLauncherApi.launchUrl",
@@ -82,14 +115,16 @@ void UrlLauncherApi::SetUp(flutter::BinaryMessenger* binary_messenger,
                 return;
               }
               const auto& url_arg = std::get<std::string>(encodable_url_arg);
-              std::optional<FlutterError> output = api->LaunchUrl(url_arg);
-              if (output.has_value()) {
-                reply(WrapError(output.value()));
-                return;
-              }
-              EncodableList wrapped;
-              wrapped.push_back(EncodableValue());
-              reply(EncodableValue(std::move(wrapped)));
+              api->LaunchUrl(
+                  url_arg, [reply](std::optional<FlutterError>&& output) {
+                    if (output.has_value()) {
+                      reply(WrapError(output.value()));
+                      return;
+                    }
+                    EncodableList wrapped;
+                    wrapped.push_back(EncodableValue());
+                    reply(EncodableValue(std::move(wrapped)));
+                  });
             } catch (const std::exception& exception) {
               reply(WrapError(exception.what()));
             }
@@ -66,7 +66,11 @@ class UrlLauncherApi {
   UrlLauncherApi& operator=(const UrlLauncherApi&) = delete;
   virtual ~UrlLauncherApi() {}
   virtual ErrorOr<bool> CanLaunchUrl(const std::string& url) = 0;
-  virtual std::optional<FlutterError> LaunchUrl(const std::string& url) = 0;
+  virtual ErrorOr<flutter::EncodableList> CanLaunchUrls(
+      const flutter::EncodableList& urls) = 0;
+  virtual void LaunchUrl(
+      const std::string& url,
+      std::function<void(std::optional<FlutterError> reply)> result) = 0;
 
   // The codec used by UrlLauncherApi.
   static const flutter::StandardMessageCodec& GetCodec();
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 #include "system_apis.h"
 
+#include <shellapi.h>
 #include <windows.h>
 
 namespace url_launcher_windows {
@@ -28,11 +29,30 @@ LSTATUS SystemApisImpl::RegQueryValueExW(HKEY key, LPCWSTR value_name,
   return ::RegQueryValueExW(key, value_name, nullptr, type, data, data_size);
 }
 
-HINSTANCE SystemApisImpl::ShellExecuteW(HWND hwnd, LPCWSTR operation,
-                                        LPCWSTR file, LPCWSTR parameters,
-                                        LPCWSTR directory, int show_flags) {
-  return ::ShellExecuteW(hwnd, operation, file, parameters, directory,
-                         show_flags);
+LSTATUS SystemApisImpl::RegNotifyChangeKeyValue(HKEY key, BOOL watch_subtree,
+                                                DWORD notify_filter,
+                                                HANDLE event,
+                                                BOOL asynchronous) {
+  return ::RegNotifyChangeKeyValue(key, watch_subtree, notify_filter, event,
+                                   asynchronous);
+}
+
+BOOL SystemApisImpl::ShellExecuteExW(SHELLEXECUTEINFOW* execute_info) {
+  return ::ShellExecuteExW(execute_info);
+}
+
+HANDLE SystemApisImpl::CreateEventW(LPSECURITY_ATTRIBUTES attributes,
+                                    BOOL manual_reset, BOOL initial_state,
+                                    LPCWSTR name) {
+  return ::CreateEventW(attributes, manual_reset, initial_state, name);
+}
+
+DWORD SystemApisImpl::WaitForSingleObject(HANDLE handle, DWORD milliseconds) {
+  return ::WaitForSingleObject(handle, milliseconds);
+}
+
+BOOL SystemApisImpl::CloseHandle(HANDLE handle) {
+  return ::CloseHandle(handle);
 }
 
 }  // namespace url_launcher_windows
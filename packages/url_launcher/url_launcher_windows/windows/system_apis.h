@@ -1,6 +1,7 @@
 // Copyright 2013 The Flutter Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <shellapi.h>
 #include <windows.h>
 
 namespace url_launcher_windows {
@@ -26,10 +27,24 @@ class SystemApis {
   virtual LSTATUS RegOpenKeyExW(HKEY key, LPCWSTR sub_key, DWORD options,
                                 REGSAM desired, PHKEY result) = 0;
 
-  // Wrapper for ShellExecute.
-  virtual HINSTANCE ShellExecuteW(HWND hwnd, LPCWSTR operation, LPCWSTR file,
-                                  LPCWSTR parameters, LPCWSTR directory,
-                                  int show_flags) = 0;
+  // Wrapper for RegNotifyChangeKeyValue.
+  virtual LSTATUS RegNotifyChangeKeyValue(HKEY key, BOOL watch_subtree,
+                                          DWORD notify_filter, HANDLE event,
+                                          BOOL asynchronous) = 0;
+
+  // Wrapper for ShellExecuteEx.
+  virtual BOOL ShellExecuteExW(SHELLEXECUTEINFOW* execute_info) = 0;
+
+  // Wrapper for CreateEvent.
+  virtual HANDLE CreateEventW(LPSECURITY_ATTRIBUTES attributes,
+                              BOOL manual_reset, BOOL initial_state,
+                              LPCWSTR name) = 0;
+
+  // Wrapper for WaitForSingleObject.
+  virtual DWORD WaitForSingleObject(HANDLE handle, DWORD milliseconds) = 0;
+
+  // Wrapper for CloseHandle.
+  virtual BOOL CloseHandle(HANDLE handle) = 0;
 };
 
 // Implementation of SystemApis using the Win32 APIs.
@@ -48,9 +63,15 @@ class SystemApisImpl : public SystemApis {
                                 REGSAM desired, PHKEY result);
   virtual LSTATUS RegQueryValueExW(HKEY key, LPCWSTR value_name, LPDWORD type,
                                    LPBYTE data, LPDWORD data_size);
-  virtual HINSTANCE ShellExecuteW(HWND hwnd, LPCWSTR operation, LPCWSTR file,
-                                  LPCWSTR parameters, LPCWSTR directory,
-                                  int show_flags);
+  virtual LSTATUS RegNotifyChangeKeyValue(HKEY key, BOOL watch_subtree,
+                                          DWORD notify_filter, HANDLE event,
+                                          BOOL asynchronous);
+  virtual BOOL ShellExecuteExW(SHELLEXECUTEINFOW* execute_info);
+  virtual HANDLE CreateEventW(LPSECURITY_ATTRIBUTES attributes,
+                              BOOL manual_reset, BOOL initial_state,
+                              LPCWSTR name);
+  virtual DWORD WaitForSingleObject(HANDLE handle, DWORD milliseconds);
+  virtual BOOL CloseHandle(HANDLE handle);
 };
 
 }  // namespace url_launcher_windows
@@ -0,0 +1,24 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+#ifndef PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_TASK_RUNNER_H_
+#define PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_TASK_RUNNER_H_
+
+#include <functional>
+
+namespace url_launcher_windows {
+
+// Interface for scheduling work on a specific thread, to allow for running
+// everything synchronously in unit tests.
+class TaskRunner {
+ public:
+  virtual ~TaskRunner() = default;
+
+  // Schedules |task| to run on the runner's thread. Tasks posted from a single
+  // thread run in the order they were posted.
+  virtual void PostTask(std::function<void()> task) = 0;
+};
+
+}  // namespace url_launcher_windows
+
+#endif  // PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_TASK_RUNNER_H_
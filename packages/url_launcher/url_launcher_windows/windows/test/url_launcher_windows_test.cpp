@@ -20,8 +20,10 @@ namespace test {
 
 namespace {
 
+using flutter::EncodableList;
 using flutter::EncodableMap;
 using flutter::EncodableValue;
+using ::testing::_;
 using ::testing::DoAll;
 using ::testing::Pointee;
 using ::testing::Return;
@@ -38,12 +40,39 @@ class MockSystemApis : public SystemApis {
               (HKEY key, LPCWSTR sub_key, DWORD options, REGSAM desired,
                PHKEY result),
               (override));
-  MOCK_METHOD(HINSTANCE, ShellExecuteW,
-              (HWND hwnd, LPCWSTR operation, LPCWSTR file, LPCWSTR parameters,
-               LPCWSTR directory, int show_flags),
+  MOCK_METHOD(LSTATUS, RegNotifyChangeKeyValue,
+              (HKEY key, BOOL watch_subtree, DWORD notify_filter, HANDLE event,
+               BOOL asynchronous),
               (override));
+  MOCK_METHOD(BOOL, ShellExecuteExW, (SHELLEXECUTEINFOW * execute_info),
+              (override));
+  MOCK_METHOD(HANDLE, CreateEventW,
+              (LPSECURITY_ATTRIBUTES attributes, BOOL manual_reset,
+               BOOL initial_state, LPCWSTR name),
+              (override));
+  MOCK_METHOD(DWORD, WaitForSingleObject, (HANDLE handle, DWORD milliseconds),
+              (override));
+  MOCK_METHOD(BOOL, CloseHandle, (HANDLE handle), (override));
 };
 
+// Sets up |system| so that the plugin successfully watches the registry for
+// changes, which enables caching.
+void ExpectRegistryWatch(MockSystemApis& system) {
+  HANDLE fake_event = reinterpret_cast<HANDLE>(2);
+  HKEY fake_user_classes_key = reinterpret_cast<HKEY>(3);
+  EXPECT_CALL(system, CreateEventW).WillRepeatedly(Return(fake_event));
+  EXPECT_CALL(system, RegOpenKeyExW(HKEY_CURRENT_USER, _, _, KEY_NOTIFY, _))
+      .WillOnce(DoAll(SetArgPointee<4>(fake_user_classes_key),
+                      Return(ERROR_SUCCESS)));
+  EXPECT_CALL(system, RegNotifyChangeKeyValue)
+      .WillRepeatedly(Return(ERROR_SUCCESS));
+  EXPECT_CALL(system, RegCloseKey(fake_user_classes_key))
+      .WillOnce(Return(ERROR_SUCCESS));
+  EXPECT_CALL(system, CloseHandle(fake_event))
+      .Times(2)
+      .WillRepeatedly(Return(TRUE));
+}
+
 }  // namespace
 
 TEST(UrlLauncherPlugin, CanLaunchSuccessTrue) {
@@ -94,30 +123,134 @@ TEST(UrlLauncherPlugin, CanLaunchHandlesOpenFailure) {
   EXPECT_FALSE(result.value());
 }
 
+TEST(UrlLauncherPlugin, CanLaunchCachesResult) {
+  std::unique_ptr<MockSystemApis> system = std::make_unique<MockSystemApis>();
+  ExpectRegistryWatch(*system);
+  EXPECT_CALL(*system, WaitForSingleObject)
+      .WillRepeatedly(Return(WAIT_TIMEOUT));
+
+  // The scheme should only be looked up once, regardless of case.
+  HKEY fake_key = reinterpret_cast<HKEY>(1);
+  EXPECT_CALL(*system, RegOpenKeyExW(HKEY_CLASSES_ROOT, _, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<4>(fake_key), Return(ERROR_SUCCESS)));
+  EXPECT_CALL(*system, RegQueryValueExW).WillOnce(Return(ERROR_SUCCESS));
+  EXPECT_CALL(*system, RegCloseKey(fake_key)).WillOnce(Return(ERROR_SUCCESS));
+
+  UrlLauncherPlugin plugin(std::move(system));
+  ErrorOr<bool> first = plugin.CanLaunchUrl("https://some.url.com");
+  ErrorOr<bool> second = plugin.CanLaunchUrl("HTTPS://other.url.com");
+
+  ASSERT_FALSE(first.has_error());
+  EXPECT_TRUE(first.value());
+  ASSERT_FALSE(second.has_error());
+  EXPECT_TRUE(second.value());
+}
+
+TEST(UrlLauncherPlugin, CanLaunchInvalidatesCacheOnRegistryChange) {
+  std::unique_ptr<MockSystemApis> system = std::make_unique<MockSystemApis>();
+  ExpectRegistryWatch(*system);
+  // Report no change for the first lookup, and a change before the second.
+  EXPECT_CALL(*system, WaitForSingleObject)
+      .WillOnce(Return(WAIT_TIMEOUT))
+      .WillOnce(Return(WAIT_TIMEOUT))
+      .WillRepeatedly(Return(WAIT_OBJECT_0));
+
+  HKEY fake_key = reinterpret_cast<HKEY>(1);
+  EXPECT_CALL(*system, RegOpenKeyExW(HKEY_CLASSES_ROOT, _, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          DoAll(SetArgPointee<4>(fake_key), Return(ERROR_SUCCESS)));
+  EXPECT_CALL(*system, RegQueryValueExW)
+      .WillOnce(Return(ERROR_FILE_NOT_FOUND))
+      .WillOnce(Return(ERROR_SUCCESS));
+  EXPECT_CALL(*system, RegCloseKey(fake_key))
+      .Times(2)
+      .WillRepeatedly(Return(ERROR_SUCCESS));
+
+  UrlLauncherPlugin plugin(std::move(system));
+  ErrorOr<bool> before = plugin.CanLaunchUrl("custom:thing");
+  ErrorOr<bool> after = plugin.CanLaunchUrl("custom:thing");
+
+  ASSERT_FALSE(before.has_error());
+  EXPECT_FALSE(before.value());
+  ASSERT_FALSE(after.has_error());
+  EXPECT_TRUE(after.value());
+}
+
+TEST(UrlLauncherPlugin, CanLaunchUrlsReturnsResultPerUrl) {
+  std::unique_ptr<MockSystemApis> system = std::make_unique<MockSystemApis>();
+  ExpectRegistryWatch(*system);
+  EXPECT_CALL(*system, WaitForSingleObject)
+      .WillRepeatedly(Return(WAIT_TIMEOUT));
+
+  // Only https has a handler, and it should only be looked up once.
+  HKEY fake_key = reinterpret_cast<HKEY>(1);
+  EXPECT_CALL(*system, RegOpenKeyExW(HKEY_CLASSES_ROOT, _, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<4>(fake_key), Return(ERROR_SUCCESS)))
+      .WillOnce(Return(ERROR_FILE_NOT_FOUND));
+  EXPECT_CALL(*system, RegQueryValueExW).WillOnce(Return(ERROR_SUCCESS));
+  EXPECT_CALL(*system, RegCloseKey(fake_key)).WillOnce(Return(ERROR_SUCCESS));
+
+  UrlLauncherPlugin plugin(std::move(system));
+  ErrorOr<EncodableList> result = plugin.CanLaunchUrls(EncodableList({
+      EncodableValue("https://some.url.com"),
+      EncodableValue("unknown:thing"),
+      EncodableValue("https://other.url.com"),
+      EncodableValue("no scheme"),
+  }));
+
+  ASSERT_FALSE(result.has_error());
+  EXPECT_EQ(result.value(), EncodableList({
+                                EncodableValue(true),
+                                EncodableValue(false),
+                                EncodableValue(true),
+                                EncodableValue(false),
+                            }));
+}
+
 TEST(UrlLauncherPlugin, LaunchSuccess) {
   std::unique_ptr<MockSystemApis> system = std::make_unique<MockSystemApis>();
 
-  // Return a success value (>32) from launching.
-  EXPECT_CALL(*system, ShellExecuteW)
-      .WillOnce(Return(reinterpret_cast<HINSTANCE>(33)));
+  // Return success from launching, and validate the arguments.
+  EXPECT_CALL(*system, ShellExecuteExW)
+      .WillOnce([](SHELLEXECUTEINFOW* execute_info) {
+        EXPECT_EQ(std::wstring(execute_info->lpFile), L"https://some.url.com");
+        EXPECT_EQ(std::wstring(execute_info->lpVerb), L"open");
+        EXPECT_TRUE(execute_info->fMask & SEE_MASK_ASYNCOK);
+        return TRUE;
+      });
 
   UrlLauncherPlugin plugin(std::move(system));
-  std::optional<FlutterError> error = plugin.LaunchUrl("https://some.url.com");
+  std::optional<std::optional<FlutterError>> reply;
+  plugin.LaunchUrl("https://some.url.com",
+                   [&reply](std::optional<FlutterError> error) {
+                     reply.emplace(std::move(error));
+                   });
 
-  EXPECT_FALSE(error.has_value());
+  ASSERT_TRUE(reply.has_value());
+  EXPECT_FALSE(reply.value().has_value());
 }
 
 TEST(UrlLauncherPlugin, LaunchReportsFailure) {
   std::unique_ptr<MockSystemApis> system = std::make_unique<MockSystemApis>();
 
-  // Return a faile value (<=32) from launching.
-  EXPECT_CALL(*system, ShellExecuteW)
-      .WillOnce(Return(reinterpret_cast<HINSTANCE>(32)));
+  // Return failure from launching, with a ShellExecute error code.
+  EXPECT_CALL(*system, ShellExecuteExW)
+      .WillOnce([](SHELLEXECUTEINFOW* execute_info) {
+        execute_info->hInstApp = reinterpret_cast<HINSTANCE>(SE_ERR_NOASSOC);
+        return FALSE;
+      });
 
   UrlLauncherPlugin plugin(std::move(system));
-  std::optional<FlutterError> error = plugin.LaunchUrl("https://some.url.com");
+  std::optional<std::optional<FlutterError>> reply;
+  plugin.LaunchUrl("https://some.url.com",
+                   [&reply](std::optional<FlutterError> error) {
+                     reply.emplace(std::move(error));
+                   });
 
-  EXPECT_TRUE(error.has_value());
+  ASSERT_TRUE(reply.has_value());
+  ASSERT_TRUE(reply.value().has_value());
+  EXPECT_EQ(reply.value().value().code(), "open_error");
 }
 
 }  // namespace test
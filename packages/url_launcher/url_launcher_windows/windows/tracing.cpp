@@ -0,0 +1,31 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tracing.h"
+
+namespace url_launcher_windows {
+
+// The provider id is derived from the provider name, so that tracing tools
+// can enable it as "*Flutter.UrlLauncher.Windows".
+TRACELOGGING_DEFINE_PROVIDER(
+    g_url_launcher_trace_provider, "Flutter.UrlLauncher.Windows",
+    // {d9cee6bf-3d75-5038-e514-7c0bc01a9736}
+    (0xd9cee6bf, 0x3d75, 0x5038, 0xe5, 0x14, 0x7c, 0x0b, 0xc0, 0x1a, 0x97,
+     0x36));
+
+namespace {
+
+windows_plugin_utils::TraceProviderRegistration& GetRegistration() {
+  static windows_plugin_utils::TraceProviderRegistration registration(
+      g_url_launcher_trace_provider);
+  return registration;
+}
+
+}  // namespace
+
+void RegisterTraceProvider() { GetRegistration().Register(); }
+
+void UnregisterTraceProvider() { GetRegistration().Unregister(); }
+
+}  // namespace url_launcher_windows
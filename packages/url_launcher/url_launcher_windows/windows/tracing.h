@@ -0,0 +1,38 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_TRACING_H_
+#define PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_TRACING_H_
+
+#include "trace_activity.h"
+
+namespace url_launcher_windows {
+
+// The TraceLogging provider of the plugin, "Flutter.UrlLauncher.Windows".
+//
+// Events can be recorded with WPR or any other ETW tracing tool by enabling
+// the provider as "*Flutter.UrlLauncher.Windows".
+TRACELOGGING_DECLARE_PROVIDER(g_url_launcher_trace_provider);
+
+// Registers the trace provider with ETW. Registrations are counted, and the
+// provider stays registered until each one has been balanced by a call to
+// UnregisterTraceProvider.
+void RegisterTraceProvider();
+
+// Balances a call to RegisterTraceProvider.
+void UnregisterTraceProvider();
+
+}  // namespace url_launcher_windows
+
+// Traces the rest of the enclosing scope as an activity named |name|.
+#define URL_LAUNCHER_TRACE_SCOPE(name)                  \
+  ::windows_plugin_utils::TraceActivity trace_activity( \
+      ::url_launcher_windows::g_url_launcher_trace_provider, name)
+
+// Like URL_LAUNCHER_TRACE_SCOPE, also recording |detail| with the activity.
+#define URL_LAUNCHER_TRACE_SCOPE_WITH_DETAIL(name, detail) \
+  ::windows_plugin_utils::TraceActivity trace_activity(    \
+      ::url_launcher_windows::g_url_launcher_trace_provider, name, detail)
+
+#endif  // PACKAGES_URL_LAUNCHER_URL_LAUNCHER_WINDOWS_WINDOWS_TRACING_H_
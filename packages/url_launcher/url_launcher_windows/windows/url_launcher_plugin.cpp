@@ -3,47 +3,41 @@
 // found in the LICENSE file.
 #include "url_launcher_plugin.h"
 
+#include <flutter/flutter_view.h>
 #include <flutter/method_channel.h>
 #include <flutter/plugin_registrar_windows.h>
 #include <flutter/standard_method_codec.h>
 #include <windows.h>
 
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "launch_thread.h"
 #include "messages.g.h"
+#include "string_utils.h"
+#include "tracing.h"
 
 namespace url_launcher_windows {
+using windows_plugin_utils::Utf16FromUtf8;
 
 namespace {
 
+using flutter::EncodableList;
 using flutter::EncodableMap;
 using flutter::EncodableValue;
 
-// Converts the given UTF-8 string to UTF-16.
-std::wstring Utf16FromUtf8(const std::string& utf8_string) {
-  if (utf8_string.empty()) {
-    return std::wstring();
-  }
-  int target_length =
-      ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, utf8_string.data(),
-                            static_cast<int>(utf8_string.length()), nullptr, 0);
-  if (target_length == 0) {
-    return std::wstring();
-  }
-  std::wstring utf16_string;
-  utf16_string.resize(target_length);
-  int converted_length =
-      ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, utf8_string.data(),
-                            static_cast<int>(utf8_string.length()),
-                            utf16_string.data(), target_length);
-  if (converted_length == 0) {
-    return std::wstring();
-  }
-  return utf16_string;
-}
+// The changes to class registration keys that can affect URL handlers.
+constexpr DWORD kRegistryNotifyFilter = REG_NOTIFY_CHANGE_NAME |
+                                        REG_NOTIFY_CHANGE_LAST_SET |
+                                        REG_NOTIFY_THREAD_AGNOSTIC;
 
 // Returns the URL argument from |method_call| if it is present, otherwise
 // returns an empty string.
@@ -59,34 +53,209 @@ std::string GetUrlArgument(const flutter::MethodCall<>& method_call) {
   return url;
 }
 
+// Returns the lowercased scheme of |url|, or nullopt if it doesn't have one.
+std::optional<std::string> GetScheme(const std::string& url) {
+  size_t separator_location = url.find(":");
+  if (separator_location == std::string::npos) {
+    return std::nullopt;
+  }
+  // Schemes are ASCII, and registry keys are case-insensitive.
+  std::string scheme = url.substr(0, separator_location);
+  std::transform(scheme.begin(), scheme.end(), scheme.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return scheme;
+}
+
+// A TaskRunner that runs tasks immediately on the calling thread.
+class InlineTaskRunner : public TaskRunner {
+ public:
+  InlineTaskRunner() {}
+  virtual ~InlineTaskRunner() {}
+
+  // Disallow copy and assign.
+  InlineTaskRunner(const InlineTaskRunner&) = delete;
+  InlineTaskRunner& operator=(const InlineTaskRunner&) = delete;
+
+  void PostTask(std::function<void()> task) override { task(); }
+};
+
+// A TaskRunner that runs tasks on the platform thread, by posting them to the
+// Flutter view's top-level window.
+class PlatformThreadTaskRunner : public TaskRunner {
+ public:
+  explicit PlatformThreadTaskRunner(flutter::PluginRegistrarWindows* registrar)
+      : registrar_(registrar),
+        task_message_(::RegisterWindowMessage(
+            L"UrlLauncherWindowsPlatformThreadTask")) {
+    window_proc_id_ = registrar_->RegisterTopLevelWindowProcDelegate(
+        [this](HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam) {
+          return HandleWindowProc(hwnd, message, wparam, lparam);
+        });
+  }
+
+  virtual ~PlatformThreadTaskRunner() {
+    registrar_->UnregisterTopLevelWindowProcDelegate(window_proc_id_);
+  }
+
+  // Disallow copy and assign.
+  PlatformThreadTaskRunner(const PlatformThreadTaskRunner&) = delete;
+  PlatformThreadTaskRunner& operator=(const PlatformThreadTaskRunner&) =
+      delete;
+
+  void PostTask(std::function<void()> task) override {
+    // Ownership is passed through the message, and reclaimed in
+    // HandleWindowProc.
+    auto* task_pointer = new std::function<void()>(std::move(task));
+    HWND window =
+        ::GetAncestor(registrar_->GetView()->GetNativeWindow(), GA_ROOT);
+    if (!::PostMessage(window, task_message_, 0,
+                       reinterpret_cast<LPARAM>(task_pointer))) {
+      delete task_pointer;
+    }
+  }
+
+ private:
+  std::optional<LRESULT> HandleWindowProc(HWND hwnd, UINT message,
+                                          WPARAM wparam, LPARAM lparam) {
+    if (message != task_message_) {
+      return std::nullopt;
+    }
+    std::unique_ptr<std::function<void()>> task(
+        reinterpret_cast<std::function<void()>*>(lparam));
+    (*task)();
+    return 0;
+  }
+
+  flutter::PluginRegistrarWindows* registrar_;
+  UINT task_message_;
+  int window_proc_id_ = -1;
+};
+
+// Launches |url| using |system_apis|, returning an error on failure.
+std::optional<FlutterError> LaunchUrlWithShell(SystemApis* system_apis,
+                                               const std::string& url) {
+  std::wstring url_wide = Utf16FromUtf8(url);
+
+  SHELLEXECUTEINFOW execute_info = {};
+  execute_info.cbSize = sizeof(execute_info);
+  // Allow the shell to finish starting the handler on a background thread,
+  // rather than waiting for it here.
+  execute_info.fMask = SEE_MASK_ASYNCOK;
+  execute_info.lpVerb = L"open";
+  execute_info.lpFile = url_wide.c_str();
+  execute_info.nShow = SW_SHOWNORMAL;
+
+  BOOL launched;
+  {
+    URL_LAUNCHER_TRACE_SCOPE("ShellExecuteExW");
+    launched = system_apis->ShellExecuteExW(&execute_info);
+  }
+  if (!launched) {
+    // On failure, hInstApp is set to one of the SE_ERR_* values, as
+    // ShellExecute would return.
+    int status = static_cast<int>(
+        reinterpret_cast<INT_PTR>(execute_info.hInstApp));
+    std::ostringstream error_message;
+    error_message << "Failed to open " << url << ": ShellExecute error code "
+                  << status;
+    return FlutterError("open_error", error_message.str());
+  }
+  return std::nullopt;
+}
+
 }  // namespace
 
 // static
 void UrlLauncherPlugin::RegisterWithRegistrar(
-    flutter::PluginRegistrar* registrar) {
+    flutter::PluginRegistrarWindows* registrar) {
   std::unique_ptr<UrlLauncherPlugin> plugin =
-      std::make_unique<UrlLauncherPlugin>();
+      std::make_unique<UrlLauncherPlugin>(
+          std::make_unique<SystemApisImpl>(), std::make_unique<LaunchThread>(),
+          std::make_unique<PlatformThreadTaskRunner>(registrar));
   UrlLauncherApi::SetUp(registrar->messenger(), plugin.get());
   registrar->AddPlugin(std::move(plugin));
 }
 
-UrlLauncherPlugin::UrlLauncherPlugin()
-    : system_apis_(std::make_unique<SystemApisImpl>()) {}
+UrlLauncherPlugin::UrlLauncherPlugin(
+    std::unique_ptr<SystemApis> system_apis,
+    std::unique_ptr<TaskRunner> launch_task_runner,
+    std::unique_ptr<TaskRunner> platform_task_runner)
+    : system_apis_(std::move(system_apis)),
+      platform_task_runner_(std::move(platform_task_runner)),
+      launch_task_runner_(std::move(launch_task_runner)) {
+  RegisterTraceProvider();
+  StartWatchingRegistry();
+}
 
 UrlLauncherPlugin::UrlLauncherPlugin(std::unique_ptr<SystemApis> system_apis)
-    : system_apis_(std::move(system_apis)) {}
+    : UrlLauncherPlugin(std::move(system_apis),
+                        std::make_unique<InlineTaskRunner>(),
+                        std::make_unique<InlineTaskRunner>()) {}
 
-UrlLauncherPlugin::~UrlLauncherPlugin() = default;
+UrlLauncherPlugin::~UrlLauncherPlugin() {
+  StopWatchingRegistry();
+  UnregisterTraceProvider();
+}
 
 ErrorOr<bool> UrlLauncherPlugin::CanLaunchUrl(const std::string& url) {
-  size_t separator_location = url.find(":");
-  if (separator_location == std::string::npos) {
-    return false;
+  URL_LAUNCHER_TRACE_SCOPE("CanLaunchUrl");
+  std::optional<std::string> scheme = GetScheme(url);
+  return scheme && HasUrlHandler(scheme.value());
+}
+
+ErrorOr<EncodableList> UrlLauncherPlugin::CanLaunchUrls(
+    const EncodableList& urls) {
+  URL_LAUNCHER_TRACE_SCOPE("CanLaunchUrls");
+  EncodableList results;
+  results.reserve(urls.size());
+  for (const EncodableValue& url_value : urls) {
+    const auto* url = std::get_if<std::string>(&url_value);
+    std::optional<std::string> scheme =
+        url ? GetScheme(*url) : std::optional<std::string>();
+    results.push_back(EncodableValue(scheme && HasUrlHandler(scheme.value())));
   }
-  std::wstring scheme = Utf16FromUtf8(url.substr(0, separator_location));
+  return results;
+}
+
+void UrlLauncherPlugin::LaunchUrl(
+    const std::string& url,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  URL_LAUNCHER_TRACE_SCOPE("LaunchUrl");
+  // Some handlers take a long time to start, so launch off of the platform
+  // thread and reply once the shell is done.
+  launch_task_runner_->PostTask(
+      [system_apis = system_apis_.get(), url,
+       platform_runner = platform_task_runner_.get(),
+       result = std::move(result)]() {
+        std::optional<FlutterError> error =
+            LaunchUrlWithShell(system_apis, url);
+        platform_runner->PostTask([result, error]() { result(error); });
+      });
+}
 
+bool UrlLauncherPlugin::HasUrlHandler(const std::string& scheme) {
+  if (registry_watches_.empty()) {
+    return QueryUrlHandler(scheme);
+  }
+  if (HaveRegistryClassesChanged()) {
+    scheme_handler_cache_.clear();
+  }
+  auto cached = scheme_handler_cache_.find(scheme);
+  if (cached != scheme_handler_cache_.end()) {
+    return cached->second;
+  }
+  bool has_handler = QueryUrlHandler(scheme);
+  // Watching may have stopped if re-arming a watch failed.
+  if (!registry_watches_.empty()) {
+    scheme_handler_cache_[scheme] = has_handler;
+  }
+  return has_handler;
+}
+
+bool UrlLauncherPlugin::QueryUrlHandler(const std::string& scheme) {
+  std::wstring wide_scheme = Utf16FromUtf8(scheme);
   HKEY key = nullptr;
-  if (system_apis_->RegOpenKeyExW(HKEY_CLASSES_ROOT, scheme.c_str(), 0,
+  if (system_apis_->RegOpenKeyExW(HKEY_CLASSES_ROOT, wide_scheme.c_str(), 0,
                                   KEY_QUERY_VALUE, &key) != ERROR_SUCCESS) {
     return false;
   }
@@ -97,22 +266,73 @@ ErrorOr<bool> UrlLauncherPlugin::CanLaunchUrl(const std::string& url) {
   return has_handler;
 }
 
-std::optional<FlutterError> UrlLauncherPlugin::LaunchUrl(
-    const std::string& url) {
-  std::wstring url_wide = Utf16FromUtf8(url);
+void UrlLauncherPlugin::StartWatchingRegistry() {
+  // HKEY_CLASSES_ROOT is a merged view of the machine and per-user classes;
+  // watch the per-user classes directly as well, since changes there are
+  // where most handler registrations happen.
+  const std::pair<HKEY, const wchar_t*> keys_to_watch[] = {
+      {HKEY_CLASSES_ROOT, nullptr},
+      {HKEY_CURRENT_USER, L"Software\\Classes"},
+  };
+  for (const auto& [root, sub_key] : keys_to_watch) {
+    RegistryWatch watch;
+    watch.event = system_apis_->CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    if (watch.event == nullptr) {
+      StopWatchingRegistry();
+      return;
+    }
+    if (sub_key) {
+      if (system_apis_->RegOpenKeyExW(root, sub_key, 0, KEY_NOTIFY,
+                                      &watch.key) != ERROR_SUCCESS) {
+        system_apis_->CloseHandle(watch.event);
+        StopWatchingRegistry();
+        return;
+      }
+      watch.owns_key = true;
+    } else {
+      watch.key = root;
+    }
+    registry_watches_.push_back(watch);
+    if (!ArmRegistryWatch(watch)) {
+      StopWatchingRegistry();
+      return;
+    }
+  }
+}
+
+void UrlLauncherPlugin::StopWatchingRegistry() {
+  for (const RegistryWatch& watch : registry_watches_) {
+    // Closing the key cancels the pending notification.
+    if (watch.owns_key) {
+      system_apis_->RegCloseKey(watch.key);
+    }
+    system_apis_->CloseHandle(watch.event);
+  }
+  registry_watches_.clear();
+  scheme_handler_cache_.clear();
+}
 
-  int status = static_cast<int>(reinterpret_cast<INT_PTR>(
-      system_apis_->ShellExecuteW(nullptr, TEXT("open"), url_wide.c_str(),
-                                  nullptr, nullptr, SW_SHOWNORMAL)));
+bool UrlLauncherPlugin::ArmRegistryWatch(const RegistryWatch& watch) {
+  return system_apis_->RegNotifyChangeKeyValue(watch.key, TRUE,
+                                               kRegistryNotifyFilter,
+                                               watch.event,
+                                               TRUE) == ERROR_SUCCESS;
+}
 
-  // Per ::ShellExecuteW documentation, anything >32 indicates success.
-  if (status <= 32) {
-    std::ostringstream error_message;
-    error_message << "Failed to open " << url << ": ShellExecute error code "
-                  << status;
-    return FlutterError("open_error", error_message.str());
+bool UrlLauncherPlugin::HaveRegistryClassesChanged() {
+  bool changed = false;
+  for (const RegistryWatch& watch : registry_watches_) {
+    // The events are auto-reset, so this also clears the signal.
+    if (system_apis_->WaitForSingleObject(watch.event, 0) == WAIT_OBJECT_0) {
+      changed = true;
+      // Notifications are one-shot, so request the next one.
+      if (!ArmRegistryWatch(watch)) {
+        StopWatchingRegistry();
+        return true;
+      }
+    }
   }
-  return std::nullopt;
+  return changed;
 }
 
 }  // namespace url_launcher_windows
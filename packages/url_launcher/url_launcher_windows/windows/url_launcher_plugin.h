@@ -5,23 +5,34 @@
 #include <flutter/plugin_registrar_windows.h>
 #include <windows.h>
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "messages.g.h"
 #include "system_apis.h"
+#include "task_runner.h"
 
 namespace url_launcher_windows {
 
 class UrlLauncherPlugin : public flutter::Plugin, public UrlLauncherApi {
  public:
-  static void RegisterWithRegistrar(flutter::PluginRegistrar* registrar);
+  static void RegisterWithRegistrar(
+      flutter::PluginRegistrarWindows* registrar);
 
-  UrlLauncherPlugin();
+  // Creates a plugin instance that launches URLs using |launch_task_runner|,
+  // and delivers the results using |platform_task_runner|, which must run
+  // tasks on the thread that platform channel messages are handled on.
+  UrlLauncherPlugin(std::unique_ptr<SystemApis> system_apis,
+                    std::unique_ptr<TaskRunner> launch_task_runner,
+                    std::unique_ptr<TaskRunner> platform_task_runner);
 
-  // Creates a plugin instance with the given SystemApi instance.
+  // Creates a plugin instance with the given SystemApi instance, which
+  // launches URLs synchronously.
   //
   // Exists for unit testing with mock implementations.
   UrlLauncherPlugin(std::unique_ptr<SystemApis> system_apis);
@@ -34,10 +45,59 @@ class UrlLauncherPlugin : public flutter::Plugin, public UrlLauncherApi {
 
   // UrlLauncherApi:
   ErrorOr<bool> CanLaunchUrl(const std::string& url) override;
-  std::optional<FlutterError> LaunchUrl(const std::string& url) override;
+  ErrorOr<flutter::EncodableList> CanLaunchUrls(
+      const flutter::EncodableList& urls) override;
+  void LaunchUrl(
+      const std::string& url,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
 
  private:
+  // A registry key that is being watched for changes that could affect which
+  // schemes have handlers.
+  struct RegistryWatch {
+    HKEY key = nullptr;
+    // True if |key| was opened by the plugin, and so must be closed.
+    bool owns_key = false;
+    // The event signalled when |key| changes.
+    HANDLE event = nullptr;
+  };
+
+  // Returns true if |scheme| has a registered URL handler, using the cached
+  // result if the registry hasn't changed since it was looked up.
+  bool HasUrlHandler(const std::string& scheme);
+
+  // Looks up whether |scheme| has a registered URL handler in the registry.
+  bool QueryUrlHandler(const std::string& scheme);
+
+  // Starts watching the class registration keys, enabling caching if
+  // successful.
+  void StartWatchingRegistry();
+
+  // Stops watching the class registration keys, which disables caching.
+  void StopWatchingRegistry();
+
+  // Requests notification of the next change to |watch|'s key.
+  bool ArmRegistryWatch(const RegistryWatch& watch);
+
+  // Returns true if any of the watched keys have changed since the last call.
+  bool HaveRegistryClassesChanged();
+
   std::unique_ptr<SystemApis> system_apis_;
+
+  // The runner for delivering launch results back to the platform thread.
+  std::unique_ptr<TaskRunner> platform_task_runner_;
+
+  // The runner that URLs are launched on. This is declared after the members
+  // that its tasks use, so that it is destroyed (finishing any pending
+  // launches) before them.
+  std::unique_ptr<TaskRunner> launch_task_runner_;
+
+  // The keys being watched. This is empty if watching failed, in which case
+  // lookups aren't cached.
+  std::vector<RegistryWatch> registry_watches_;
+
+  // Cached results of HasUrlHandler, keyed by lowercase scheme.
+  std::map<std::string, bool> scheme_handler_cache_;
 };
 
 }  // namespace url_launcher_windows
@@ -20,6 +20,16 @@
  */
 @property(nonatomic, assign) BOOL running;
 
+/**
+ * The rate, in frames per second, at which the callback should fire, or 0 to fire on every
+ * display refresh.
+ *
+ * The callback may fire faster when the display can't match the rate exactly, but not slower.
+ *
+ * Defaults to 0.
+ */
+@property(nonatomic, assign) double preferredFramesPerSecond;
+
 /**
  * Initializes a display link that calls the given callback when fired.
  *
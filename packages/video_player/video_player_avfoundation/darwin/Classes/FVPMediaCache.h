@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// What is known about a cached resource from the responses it was downloaded with.
+@interface FVPMediaCacheContentInfo : NSObject
+/// The total length of the resource, in bytes.
+@property(nonatomic, assign) int64_t contentLength;
+/// The uniform type identifier of the resource, if known.
+@property(nonatomic, copy, nullable) NSString *contentType;
+/// Whether the server serves byte ranges of the resource.
+@property(nonatomic, assign) BOOL byteRangeAccessSupported;
+@end
+
+/// A disk cache of byte ranges of media resources, keyed by URL.
+///
+/// Resources are removed least recently used first once the cached bytes exceed the maximum size.
+/// Methods may be called from any thread.
+@interface FVPMediaCache : NSObject
+/// Creates a cache that stores its files in the given directory, picking up the ones stored there
+/// by earlier instances.
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL maximumSize:(int64_t)maximumSize;
+
+/// The number of bytes that the cache keeps on disk. Lowering it removes resources right away.
+@property(nonatomic, assign) int64_t maximumSize;
+
+/// Returns what is known about the resource at the given URL, or nil if nothing is cached.
+- (nullable FVPMediaCacheContentInfo *)contentInfoForURL:(NSURL *)url;
+
+- (void)setContentInfo:(FVPMediaCacheContentInfo *)contentInfo forURL:(NSURL *)url;
+
+/// Returns the cached bytes of the resource at the given URL from the given offset, up to the
+/// given length or the first byte that isn't cached, or nil if the byte at the offset isn't cached.
+- (nullable NSData *)dataForURL:(NSURL *)url offset:(int64_t)offset length:(int64_t)length;
+
+/// Returns the offset of the first cached byte at or after the given offset, or -1 if there is
+/// none.
+- (int64_t)firstCachedOffsetForURL:(NSURL *)url fromOffset:(int64_t)offset;
+
+/// Returns the offset of the first byte at or after the given offset that isn't cached.
+- (int64_t)firstUncachedOffsetForURL:(NSURL *)url fromOffset:(int64_t)offset;
+
+/// Stores bytes of the resource at the given URL, starting at the given offset.
+///
+/// Bytes that would make the resource alone exceed the maximum size are dropped.
+- (void)storeData:(NSData *)data forURL:(NSURL *)url offset:(int64_t)offset;
+
+/// Removes all cached resources.
+- (void)removeAllData;
+@end
+
+NS_ASSUME_NONNULL_END
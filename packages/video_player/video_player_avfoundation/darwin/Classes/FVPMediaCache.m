@@ -0,0 +1,381 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FVPMediaCache.h"
+
+#import <CommonCrypto/CommonDigest.h>
+
+#if !__has_feature(objc_arc)
+#error Code Requires ARC.
+#endif
+
+/// How long changes to a resource's metadata are collected before they are written to disk.
+static const int64_t kFVPMetadataSaveDelay = 1 * NSEC_PER_SEC;
+
+/// Returns the name of the files of the resource at the given URL.
+static NSString *FVPMediaCacheKeyForURL(NSURL *url) {
+  NSData *urlData = [url.absoluteString dataUsingEncoding:NSUTF8StringEncoding];
+  unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+  CC_SHA256(urlData.bytes, (CC_LONG)urlData.length, digest);
+  NSMutableString *key = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+  for (int i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+    [key appendFormat:@"%02x", digest[i]];
+  }
+  return key;
+}
+
+/// Returns the first offset at or after the given one that isn't in the index set.
+static int64_t FVPFirstOffsetNotInIndexSet(NSIndexSet *indexSet, int64_t offset) {
+  __block int64_t result = offset;
+  [indexSet enumerateRangesUsingBlock:^(NSRange range, BOOL *stop) {
+    if ((int64_t)range.location > offset) {
+      *stop = YES;
+    } else if ((int64_t)NSMaxRange(range) > offset) {
+      result = (int64_t)NSMaxRange(range);
+      *stop = YES;
+    }
+  }];
+  return result;
+}
+
+@implementation FVPMediaCacheContentInfo
+@end
+
+/// A cached resource. Only accessed on the cache's queue.
+@interface FVPMediaCacheEntry : NSObject
+/// The name of the resource's files in the cache directory, without extension.
+@property(nonatomic, copy) NSString *key;
+@property(nonatomic, strong, nullable) FVPMediaCacheContentInfo *contentInfo;
+/// The byte offsets of the resource that are stored in its data file.
+@property(nonatomic, strong) NSMutableIndexSet *cachedOffsets;
+@property(nonatomic, strong) NSDate *lastAccessDate;
+/// Whether the metadata has changed since it was last written to disk.
+@property(nonatomic, assign) BOOL metadataNeedsSave;
+@end
+
+@implementation FVPMediaCacheEntry
+@end
+
+@interface FVPMediaCache ()
+@property(nonatomic, readonly) NSURL *directoryURL;
+@property(nonatomic, readonly) dispatch_queue_t queue;
+@property(nonatomic, readonly) NSMutableDictionary<NSString *, FVPMediaCacheEntry *> *entries;
+@end
+
+@implementation FVPMediaCache {
+  int64_t _maximumSize;
+}
+
+- (instancetype)initWithDirectoryURL:(NSURL *)directoryURL maximumSize:(int64_t)maximumSize {
+  self = [super init];
+  if (self) {
+    _directoryURL = directoryURL;
+    _maximumSize = maximumSize;
+    _queue = dispatch_queue_create("io.flutter.video_player.media_cache", DISPATCH_QUEUE_SERIAL);
+    _entries = [NSMutableDictionary dictionary];
+    // Calls made before the stored entries are loaded wait behind this on the queue.
+    dispatch_async(_queue, ^{
+      [self loadEntries];
+      [self evictEntriesExceptKey:nil];
+    });
+  }
+  return self;
+}
+
+- (int64_t)maximumSize {
+  __block int64_t maximumSize;
+  dispatch_sync(self.queue, ^{
+    maximumSize = self->_maximumSize;
+  });
+  return maximumSize;
+}
+
+- (void)setMaximumSize:(int64_t)maximumSize {
+  dispatch_sync(self.queue, ^{
+    self->_maximumSize = maximumSize;
+    [self evictEntriesExceptKey:nil];
+  });
+}
+
+- (nullable FVPMediaCacheContentInfo *)contentInfoForURL:(NSURL *)url {
+  __block FVPMediaCacheContentInfo *contentInfo;
+  dispatch_sync(self.queue, ^{
+    contentInfo = self.entries[FVPMediaCacheKeyForURL(url)].contentInfo;
+  });
+  return contentInfo;
+}
+
+- (void)setContentInfo:(FVPMediaCacheContentInfo *)contentInfo forURL:(NSURL *)url {
+  dispatch_sync(self.queue, ^{
+    FVPMediaCacheEntry *entry = [self entryForKey:FVPMediaCacheKeyForURL(url)];
+    FVPMediaCacheContentInfo *previousInfo = entry.contentInfo;
+    if (previousInfo && previousInfo.contentLength != contentInfo.contentLength) {
+      // The resource changed on the server, so the cached bytes are stale.
+      [self removeDataOfEntry:entry];
+    }
+    entry.contentInfo = contentInfo;
+    [self setNeedsSaveForEntry:entry];
+  });
+}
+
+- (nullable NSData *)dataForURL:(NSURL *)url offset:(int64_t)offset length:(int64_t)length {
+  __block NSData *data;
+  dispatch_sync(self.queue, ^{
+    FVPMediaCacheEntry *entry = self.entries[FVPMediaCacheKeyForURL(url)];
+    if (!entry || offset < 0 || length <= 0 ||
+        ![entry.cachedOffsets containsIndex:(NSUInteger)offset]) {
+      return;
+    }
+    int64_t cachedEnd = FVPFirstOffsetNotInIndexSet(entry.cachedOffsets, offset);
+    NSUInteger readLength = (NSUInteger)MIN(length, cachedEnd - offset);
+    NSFileHandle *handle = [NSFileHandle fileHandleForReadingFromURL:[self dataURLForEntry:entry]
+                                                               error:nil];
+    @try {
+      [handle seekToFileOffset:(unsigned long long)offset];
+      data = [handle readDataOfLength:readLength];
+    } @catch (NSException *exception) {
+      data = nil;
+    }
+    [handle closeFile];
+    if (data.length != readLength) {
+      // The data file no longer matches the metadata, so start the resource over.
+      [self removeDataOfEntry:entry];
+      data = nil;
+      return;
+    }
+    entry.lastAccessDate = [NSDate date];
+    [self setNeedsSaveForEntry:entry];
+  });
+  return data;
+}
+
+- (int64_t)firstCachedOffsetForURL:(NSURL *)url fromOffset:(int64_t)offset {
+  __block int64_t cachedOffset = -1;
+  dispatch_sync(self.queue, ^{
+    NSIndexSet *cachedOffsets = self.entries[FVPMediaCacheKeyForURL(url)].cachedOffsets;
+    NSUInteger index = [cachedOffsets indexGreaterThanOrEqualToIndex:(NSUInteger)offset];
+    if (cachedOffsets && index != NSNotFound) {
+      cachedOffset = (int64_t)index;
+    }
+  });
+  return cachedOffset;
+}
+
+- (int64_t)firstUncachedOffsetForURL:(NSURL *)url fromOffset:(int64_t)offset {
+  __block int64_t uncachedOffset = offset;
+  dispatch_sync(self.queue, ^{
+    NSIndexSet *cachedOffsets = self.entries[FVPMediaCacheKeyForURL(url)].cachedOffsets;
+    if (cachedOffsets) {
+      uncachedOffset = FVPFirstOffsetNotInIndexSet(cachedOffsets, offset);
+    }
+  });
+  return uncachedOffset;
+}
+
+- (void)storeData:(NSData *)data forURL:(NSURL *)url offset:(int64_t)offset {
+  if (data.length == 0 || offset < 0) {
+    return;
+  }
+  dispatch_sync(self.queue, ^{
+    FVPMediaCacheEntry *entry = [self entryForKey:FVPMediaCacheKeyForURL(url)];
+    NSRange range = NSMakeRange((NSUInteger)offset, data.length);
+    int64_t newLength =
+        (int64_t)(range.length - [entry.cachedOffsets countOfIndexesInRange:range]);
+    if ((int64_t)entry.cachedOffsets.count + newLength > self->_maximumSize) {
+      return;
+    }
+    NSURL *dataURL = [self dataURLForEntry:entry];
+    if (![[NSFileManager defaultManager] fileExistsAtPath:dataURL.path]) {
+      [[NSFileManager defaultManager] createFileAtPath:dataURL.path contents:nil attributes:nil];
+    }
+    NSFileHandle *handle = [NSFileHandle fileHandleForWritingToURL:dataURL error:nil];
+    if (!handle) {
+      return;
+    }
+    @try {
+      [handle seekToFileOffset:(unsigned long long)offset];
+      [handle writeData:data];
+      // Only record the bytes once they are written, so that the metadata never claims more than
+      // the data file holds.
+      [entry.cachedOffsets addIndexesInRange:range];
+    } @catch (NSException *exception) {
+      // Most likely out of disk space; the bytes just aren't cached.
+    }
+    [handle closeFile];
+    entry.lastAccessDate = [NSDate date];
+    [self setNeedsSaveForEntry:entry];
+    [self evictEntriesExceptKey:entry.key];
+  });
+}
+
+- (void)removeAllData {
+  dispatch_sync(self.queue, ^{
+    for (FVPMediaCacheEntry *entry in self.entries.allValues) {
+      [self removeEntry:entry];
+    }
+  });
+}
+
+#pragma mark - Private, only called on the queue
+
+- (NSURL *)dataURLForEntry:(FVPMediaCacheEntry *)entry {
+  return
+      [self.directoryURL URLByAppendingPathComponent:[entry.key stringByAppendingString:@".data"]];
+}
+
+- (NSURL *)metadataURLForEntry:(FVPMediaCacheEntry *)entry {
+  return
+      [self.directoryURL URLByAppendingPathComponent:[entry.key stringByAppendingString:@".plist"]];
+}
+
+- (FVPMediaCacheEntry *)entryForKey:(NSString *)key {
+  FVPMediaCacheEntry *entry = self.entries[key];
+  if (!entry) {
+    entry = [[FVPMediaCacheEntry alloc] init];
+    entry.key = key;
+    entry.cachedOffsets = [NSMutableIndexSet indexSet];
+    entry.lastAccessDate = [NSDate date];
+    self.entries[key] = entry;
+  }
+  return entry;
+}
+
+- (void)loadEntries {
+  NSFileManager *fileManager = [NSFileManager defaultManager];
+  [fileManager createDirectoryAtURL:self.directoryURL
+        withIntermediateDirectories:YES
+                         attributes:nil
+                              error:nil];
+  NSArray<NSURL *> *fileURLs = [fileManager contentsOfDirectoryAtURL:self.directoryURL
+                                          includingPropertiesForKeys:nil
+                                                             options:0
+                                                               error:nil];
+  for (NSURL *fileURL in fileURLs) {
+    if (![fileURL.pathExtension isEqualToString:@"plist"]) {
+      continue;
+    }
+    FVPMediaCacheEntry *entry = [[FVPMediaCacheEntry alloc] init];
+    entry.key = fileURL.URLByDeletingPathExtension.lastPathComponent;
+    if (![self readMetadataOfEntry:entry fromURL:fileURL]) {
+      [self removeEntry:entry];
+      continue;
+    }
+    self.entries[entry.key] = entry;
+  }
+  // Data files without metadata were left behind by a resource whose metadata was never saved.
+  for (NSURL *fileURL in fileURLs) {
+    NSString *key = fileURL.URLByDeletingPathExtension.lastPathComponent;
+    if ([fileURL.pathExtension isEqualToString:@"data"] && !self.entries[key]) {
+      [fileManager removeItemAtURL:fileURL error:nil];
+    }
+  }
+}
+
+- (BOOL)readMetadataOfEntry:(FVPMediaCacheEntry *)entry fromURL:(NSURL *)url {
+  NSData *data = [NSData dataWithContentsOfURL:url];
+  if (!data) {
+    return NO;
+  }
+  NSDictionary *metadata = [NSPropertyListSerialization propertyListWithData:data
+                                                                     options:0
+                                                                      format:NULL
+                                                                       error:nil];
+  if (![metadata isKindOfClass:[NSDictionary class]]) {
+    return NO;
+  }
+  NSNumber *contentLength = metadata[@"contentLength"];
+  if (contentLength) {
+    entry.contentInfo = [[FVPMediaCacheContentInfo alloc] init];
+    entry.contentInfo.contentLength = contentLength.longLongValue;
+    entry.contentInfo.contentType = metadata[@"contentType"];
+    entry.contentInfo.byteRangeAccessSupported =
+        [metadata[@"byteRangeAccessSupported"] boolValue];
+  }
+  entry.cachedOffsets = [NSMutableIndexSet indexSet];
+  for (NSArray<NSNumber *> *range in metadata[@"ranges"]) {
+    NSUInteger location = range[0].unsignedIntegerValue;
+    [entry.cachedOffsets addIndexesInRange:NSMakeRange(location, range[1].unsignedIntegerValue)];
+  }
+  entry.lastAccessDate = metadata[@"lastAccessDate"] ?: [NSDate distantPast];
+  return YES;
+}
+
+- (void)setNeedsSaveForEntry:(FVPMediaCacheEntry *)entry {
+  if (entry.metadataNeedsSave) {
+    return;
+  }
+  entry.metadataNeedsSave = YES;
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, kFVPMetadataSaveDelay), self.queue, ^{
+    // Skip entries that were removed in the meantime.
+    if (entry.metadataNeedsSave && self.entries[entry.key] == entry) {
+      [self saveMetadataOfEntry:entry];
+    }
+  });
+}
+
+- (void)saveMetadataOfEntry:(FVPMediaCacheEntry *)entry {
+  entry.metadataNeedsSave = NO;
+  NSMutableArray<NSArray<NSNumber *> *> *ranges = [NSMutableArray array];
+  [entry.cachedOffsets enumerateRangesUsingBlock:^(NSRange range, BOOL *stop) {
+    [ranges addObject:@[ @(range.location), @(range.length) ]];
+  }];
+  NSMutableDictionary *metadata = [@{
+    @"ranges" : ranges,
+    @"lastAccessDate" : entry.lastAccessDate,
+  } mutableCopy];
+  FVPMediaCacheContentInfo *contentInfo = entry.contentInfo;
+  if (contentInfo) {
+    metadata[@"contentLength"] = @(contentInfo.contentLength);
+    metadata[@"byteRangeAccessSupported"] = @(contentInfo.byteRangeAccessSupported);
+    if (contentInfo.contentType) {
+      metadata[@"contentType"] = contentInfo.contentType;
+    }
+  }
+  NSData *data = [NSPropertyListSerialization dataWithPropertyList:metadata
+                                                            format:NSPropertyListBinaryFormat_v1_0
+                                                           options:0
+                                                             error:nil];
+  [data writeToURL:[self metadataURLForEntry:entry] atomically:YES];
+}
+
+/// Removes the cached bytes of the entry, but keeps the entry itself.
+- (void)removeDataOfEntry:(FVPMediaCacheEntry *)entry {
+  [[NSFileManager defaultManager] removeItemAtURL:[self dataURLForEntry:entry] error:nil];
+  [entry.cachedOffsets removeAllIndexes];
+  [self setNeedsSaveForEntry:entry];
+}
+
+- (void)removeEntry:(FVPMediaCacheEntry *)entry {
+  [self.entries removeObjectForKey:entry.key];
+  [[NSFileManager defaultManager] removeItemAtURL:[self dataURLForEntry:entry] error:nil];
+  [[NSFileManager defaultManager] removeItemAtURL:[self metadataURLForEntry:entry] error:nil];
+}
+
+/// Removes the least recently used entries, other than the one with the given key, until the
+/// cached bytes fit within the maximum size.
+- (void)evictEntriesExceptKey:(nullable NSString *)key {
+  int64_t size = 0;
+  for (FVPMediaCacheEntry *entry in self.entries.allValues) {
+    size += (int64_t)entry.cachedOffsets.count;
+  }
+  if (size <= _maximumSize) {
+    return;
+  }
+  NSArray<FVPMediaCacheEntry *> *entries = [self.entries.allValues
+      sortedArrayUsingComparator:^NSComparisonResult(FVPMediaCacheEntry *a, FVPMediaCacheEntry *b) {
+        return [a.lastAccessDate compare:b.lastAccessDate];
+      }];
+  for (FVPMediaCacheEntry *entry in entries) {
+    if (size <= _maximumSize) {
+      break;
+    }
+    if ([entry.key isEqualToString:key]) {
+      continue;
+    }
+    size -= (int64_t)entry.cachedOffsets.count;
+    [self removeEntry:entry];
+  }
+}
+
+@end
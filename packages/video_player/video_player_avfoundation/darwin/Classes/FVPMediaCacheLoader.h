@@ -0,0 +1,40 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <AVFoundation/AVFoundation.h>
+
+#import "FVPMediaCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Loads the media of assets through a FVPMediaCache, so that bytes that were downloaded before
+/// are read from disk, and only the missing ones are downloaded.
+///
+/// Assets created by the loader only keep a weak reference to it, so it must outlive them.
+@interface FVPMediaCacheLoader : NSObject <AVAssetResourceLoaderDelegate>
+- (instancetype)initWithCache:(FVPMediaCache *)cache;
+
+@property(nonatomic, readonly) FVPMediaCache *cache;
+
+/// Returns whether the resource at the given URL can be loaded through the cache.
+///
+/// HLS playlists can't, since AVFoundation loads the segments that they list itself.
++ (BOOL)canCacheURL:(NSURL *)url;
+
+/// Returns an asset that loads the resource at the given URL through the cache, sending the given
+/// HTTP headers with its requests.
+- (AVURLAsset *)assetWithURL:(NSURL *)url
+                 httpHeaders:(NSDictionary<NSString *, NSString *> *)headers;
+
+/// Downloads the start of the resource at the given URL into the cache, up to the part that plays
+/// for the given number of seconds at the resource's average bit rate.
+- (void)prefetchURL:(NSURL *)url
+        httpHeaders:(NSDictionary<NSString *, NSString *> *)headers
+           duration:(NSTimeInterval)duration;
+
+/// Cancels all downloads. The loader can't load anything afterwards.
+- (void)invalidate;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,399 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FVPMediaCacheLoader.h"
+
+#if TARGET_OS_OSX
+#import <CoreServices/CoreServices.h>
+#else
+#import <MobileCoreServices/MobileCoreServices.h>
+#endif
+
+#if !__has_feature(objc_arc)
+#error Code Requires ARC.
+#endif
+
+/// Prepended to the scheme of the URLs of assets created by the loader, so that AVFoundation asks
+/// the loader for their bytes rather than loading them itself.
+static NSString *const kFVPMediaCacheSchemePrefix = @"fvp-cache-";
+
+/// The most cached bytes handed to a loading request at once, so that long cached ranges aren't
+/// read into memory all at once, and requests can be cancelled in between.
+static const int64_t kFVPMaxCachedChunkLength = 1024 * 1024;
+
+/// Returns the URL of the resource that the given asset URL loads, or nil if it wasn't created by
+/// the loader.
+static NSURL *_Nullable FVPResourceURLForAssetURL(NSURL *assetURL) {
+  NSURLComponents *components = [NSURLComponents componentsWithURL:assetURL
+                                           resolvingAgainstBaseURL:NO];
+  if (![components.scheme hasPrefix:kFVPMediaCacheSchemePrefix]) {
+    return nil;
+  }
+  components.scheme = [components.scheme substringFromIndex:kFVPMediaCacheSchemePrefix.length];
+  return components.URL;
+}
+
+/// Returns the value of the given header of the response, ignoring the case of its name.
+static NSString *_Nullable FVPHeaderValue(NSHTTPURLResponse *response, NSString *name) {
+  for (NSString *key in response.allHeaderFields) {
+    if ([key caseInsensitiveCompare:name] == NSOrderedSame) {
+      return response.allHeaderFields[key];
+    }
+  }
+  return nil;
+}
+
+/// Returns the uniform type identifier for the given MIME type, if any.
+static NSString *_Nullable FVPContentTypeForMIMEType(NSString *_Nullable mimeType) {
+  if (!mimeType) {
+    return nil;
+  }
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+  // TODO: Use UTType once the minimum deployment targets are iOS 14 and macOS 11.
+  CFStringRef contentType = UTTypeCreatePreferredIdentifierForTag(
+      kUTTagClassMIMEType, (__bridge CFStringRef)mimeType, NULL);
+#pragma clang diagnostic pop
+  return (__bridge_transfer NSString *)contentType;
+}
+
+static void FVPFillContentInformationRequest(
+    AVAssetResourceLoadingContentInformationRequest *request,
+    FVPMediaCacheContentInfo *contentInfo) {
+  request.contentType = contentInfo.contentType;
+  request.contentLength = contentInfo.contentLength;
+  request.byteRangeAccessSupported = contentInfo.byteRangeAccessSupported;
+}
+
+/// A download of a range of a resource into the cache.
+@interface FVPMediaCacheDownload : NSObject
+@property(nonatomic, strong) NSURL *url;
+@property(nonatomic, strong) NSURLSessionDataTask *task;
+/// The offset of the next byte to be received.
+@property(nonatomic, assign) int64_t offset;
+/// The offset that the download started at.
+@property(nonatomic, assign) int64_t startOffset;
+/// The offset to stop downloading at, or -1 to download to the end of the resource.
+@property(nonatomic, assign) int64_t endOffset;
+/// The request that the downloaded bytes are handed to as well, if it isn't a prefetch.
+@property(nonatomic, strong, nullable) AVAssetResourceLoadingRequest *loadingRequest;
+/// The error to fail the loading request with, if the response couldn't be used.
+@property(nonatomic, strong, nullable) NSError *error;
+@end
+
+@implementation FVPMediaCacheDownload
+@end
+
+@interface FVPMediaCacheLoader () <NSURLSessionDataDelegate>
+/// The queue that resource loader and URL session callbacks, and everything else, run on.
+@property(nonatomic, readonly) dispatch_queue_t queue;
+@property(nonatomic, readonly) NSURLSession *session;
+/// The HTTP headers to send for each resource URL, from the latest asset created for it.
+@property(nonatomic, readonly)
+    NSMutableDictionary<NSURL *, NSDictionary<NSString *, NSString *> *> *headersByURL;
+/// The downloads in progress, by task identifier.
+@property(nonatomic, readonly) NSMutableDictionary<NSNumber *, FVPMediaCacheDownload *> *downloads;
+/// The assets being loaded for prefetching, kept alive until their duration is known.
+@property(nonatomic, readonly) NSMutableSet<AVURLAsset *> *prefetchingAssets;
+@end
+
+@implementation FVPMediaCacheLoader
+
+- (instancetype)initWithCache:(FVPMediaCache *)cache {
+  self = [super init];
+  if (self) {
+    _cache = cache;
+    _queue = dispatch_queue_create("io.flutter.video_player.media_cache_loader",
+                                   DISPATCH_QUEUE_SERIAL);
+    NSOperationQueue *delegateQueue = [[NSOperationQueue alloc] init];
+    delegateQueue.maxConcurrentOperationCount = 1;
+    delegateQueue.underlyingQueue = _queue;
+    NSURLSessionConfiguration *configuration =
+        [NSURLSessionConfiguration defaultSessionConfiguration];
+    _session = [NSURLSession sessionWithConfiguration:configuration
+                                             delegate:self
+                                        delegateQueue:delegateQueue];
+    _headersByURL = [NSMutableDictionary dictionary];
+    _downloads = [NSMutableDictionary dictionary];
+    _prefetchingAssets = [NSMutableSet set];
+  }
+  return self;
+}
+
++ (BOOL)canCacheURL:(NSURL *)url {
+  NSString *scheme = url.scheme.lowercaseString;
+  NSString *extension = url.pathExtension.lowercaseString;
+  return ([scheme isEqualToString:@"http"] || [scheme isEqualToString:@"https"]) &&
+         ![extension isEqualToString:@"m3u8"] && ![extension isEqualToString:@"m3u"];
+}
+
+- (AVURLAsset *)assetWithURL:(NSURL *)url
+                 httpHeaders:(NSDictionary<NSString *, NSString *> *)headers {
+  NSURLComponents *components = [NSURLComponents componentsWithURL:url
+                                           resolvingAgainstBaseURL:NO];
+  components.scheme = [kFVPMediaCacheSchemePrefix stringByAppendingString:components.scheme];
+  NSDictionary<NSString *, NSString *> *headersCopy = [headers copy];
+  // Resource loader callbacks for the asset are queued after this.
+  dispatch_async(self.queue, ^{
+    self.headersByURL[url] = headersCopy;
+  });
+  AVURLAsset *asset = [AVURLAsset URLAssetWithURL:components.URL options:nil];
+  [asset.resourceLoader setDelegate:self queue:self.queue];
+  return asset;
+}
+
+- (void)prefetchURL:(NSURL *)url
+        httpHeaders:(NSDictionary<NSString *, NSString *> *)headers
+           duration:(NSTimeInterval)duration {
+  AVURLAsset *asset = [self assetWithURL:url httpHeaders:headers];
+  dispatch_async(self.queue, ^{
+    [self.prefetchingAssets addObject:asset];
+  });
+  // Loading the duration downloads the parts of the resource that describe it, such as the movie
+  // header, through the cache, which also tells its length.
+  [asset loadValuesAsynchronouslyForKeys:@[ @"duration" ]
+                       completionHandler:^{
+                         dispatch_async(self.queue, ^{
+                           [self.prefetchingAssets removeObject:asset];
+                           [self prefetchStartOfAsset:asset url:url duration:duration];
+                         });
+                       }];
+}
+
+- (void)invalidate {
+  [self.session invalidateAndCancel];
+}
+
+#pragma mark - Private, only called on the queue
+
+- (void)prefetchStartOfAsset:(AVURLAsset *)asset
+                         url:(NSURL *)url
+                    duration:(NSTimeInterval)duration {
+  if ([asset statusOfValueForKey:@"duration" error:nil] != AVKeyValueStatusLoaded) {
+    return;
+  }
+  NSTimeInterval assetDuration = CMTimeGetSeconds(asset.duration);
+  FVPMediaCacheContentInfo *contentInfo = [self.cache contentInfoForURL:url];
+  // Live streams have no duration, so there is no telling how much to download.
+  if (!contentInfo || !isfinite(assetDuration) || assetDuration <= 0) {
+    return;
+  }
+  double fraction = MIN(MAX(duration / assetDuration, 0), 1);
+  int64_t endOffset = (int64_t)ceil(contentInfo.contentLength * fraction);
+  // Only the first gap is filled; the bytes after it were cached by an earlier player.
+  int64_t offset = [self.cache firstUncachedOffsetForURL:url fromOffset:0];
+  if (offset >= endOffset) {
+    return;
+  }
+  int64_t nextCachedOffset = [self.cache firstCachedOffsetForURL:url fromOffset:offset];
+  if (nextCachedOffset >= 0) {
+    endOffset = MIN(endOffset, nextCachedOffset);
+  }
+  [self startDownloadWithURL:url offset:offset endOffset:endOffset loadingRequest:nil];
+}
+
+/// Hands cached bytes to the loading request, and downloads the missing ones once it reaches them.
+- (void)continueLoadingRequest:(AVAssetResourceLoadingRequest *)loadingRequest url:(NSURL *)url {
+  if (loadingRequest.isCancelled || loadingRequest.isFinished) {
+    return;
+  }
+  FVPMediaCacheContentInfo *contentInfo = [self.cache contentInfoForURL:url];
+  AVAssetResourceLoadingDataRequest *dataRequest = loadingRequest.dataRequest;
+  int64_t offset = dataRequest ? dataRequest.currentOffset : 0;
+  if (loadingRequest.contentInformationRequest) {
+    if (!contentInfo) {
+      // The response to the download fills in the content information. Without a data request,
+      // only the first byte is asked for.
+      int64_t endOffset =
+          dataRequest ? [self endOffsetOfDataRequest:dataRequest contentInfo:nil] : 1;
+      [self startDownloadWithURL:url
+                          offset:offset
+                       endOffset:endOffset
+                  loadingRequest:loadingRequest];
+      return;
+    }
+    FVPFillContentInformationRequest(loadingRequest.contentInformationRequest, contentInfo);
+  }
+  if (!dataRequest) {
+    [loadingRequest finishLoading];
+    return;
+  }
+
+  int64_t endOffset = [self endOffsetOfDataRequest:dataRequest contentInfo:contentInfo];
+  if (endOffset >= 0 && offset >= endOffset) {
+    [loadingRequest finishLoading];
+    return;
+  }
+  int64_t length = kFVPMaxCachedChunkLength;
+  if (endOffset >= 0) {
+    length = MIN(length, endOffset - offset);
+  }
+  NSData *data = [self.cache dataForURL:url offset:offset length:length];
+  if (data) {
+    [dataRequest respondWithData:data];
+    // Continue asynchronously, so that AVFoundation can cancel the request in between.
+    dispatch_async(self.queue, ^{
+      [self continueLoadingRequest:loadingRequest url:url];
+    });
+    return;
+  }
+  // Stop downloading at the next cached byte, to read the bytes from there from the cache.
+  int64_t nextCachedOffset = [self.cache firstCachedOffsetForURL:url fromOffset:offset];
+  if (nextCachedOffset >= 0 && (endOffset < 0 || nextCachedOffset < endOffset)) {
+    endOffset = nextCachedOffset;
+  }
+  [self startDownloadWithURL:url offset:offset endOffset:endOffset loadingRequest:loadingRequest];
+}
+
+/// Returns the offset at which the data request ends, or -1 if it is unknown.
+- (int64_t)endOffsetOfDataRequest:(AVAssetResourceLoadingDataRequest *)dataRequest
+                      contentInfo:(nullable FVPMediaCacheContentInfo *)contentInfo {
+  if (dataRequest.requestsAllDataToEndOfResource) {
+    return contentInfo ? contentInfo.contentLength : -1;
+  }
+  return dataRequest.requestedOffset + dataRequest.requestedLength;
+}
+
+- (void)startDownloadWithURL:(NSURL *)url
+                      offset:(int64_t)offset
+                   endOffset:(int64_t)endOffset
+              loadingRequest:(nullable AVAssetResourceLoadingRequest *)loadingRequest {
+  NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:url];
+  [self.headersByURL[url]
+      enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *value, BOOL *stop) {
+        [request setValue:value forHTTPHeaderField:name];
+      }];
+  NSString *range = endOffset >= 0
+                        ? [NSString stringWithFormat:@"bytes=%lld-%lld", offset, endOffset - 1]
+                        : [NSString stringWithFormat:@"bytes=%lld-", offset];
+  [request setValue:range forHTTPHeaderField:@"Range"];
+
+  FVPMediaCacheDownload *download = [[FVPMediaCacheDownload alloc] init];
+  download.url = url;
+  download.task = [self.session dataTaskWithRequest:request];
+  download.offset = offset;
+  download.startOffset = offset;
+  download.endOffset = endOffset;
+  download.loadingRequest = loadingRequest;
+  self.downloads[@(download.task.taskIdentifier)] = download;
+  [download.task resume];
+}
+
+#pragma mark - AVAssetResourceLoaderDelegate
+
+- (BOOL)resourceLoader:(AVAssetResourceLoader *)resourceLoader
+    shouldWaitForLoadingOfRequestedResource:(AVAssetResourceLoadingRequest *)loadingRequest {
+  NSURL *url = FVPResourceURLForAssetURL(loadingRequest.request.URL);
+  if (!url) {
+    return NO;
+  }
+  [self continueLoadingRequest:loadingRequest url:url];
+  return YES;
+}
+
+- (void)resourceLoader:(AVAssetResourceLoader *)resourceLoader
+    didCancelLoadingRequest:(AVAssetResourceLoadingRequest *)loadingRequest {
+  for (FVPMediaCacheDownload *download in self.downloads.allValues) {
+    if (download.loadingRequest == loadingRequest) {
+      // Nothing else waits for the rest of the bytes.
+      download.loadingRequest = nil;
+      [download.task cancel];
+    }
+  }
+}
+
+#pragma mark - NSURLSessionDataDelegate
+
+- (void)URLSession:(NSURLSession *)session
+              dataTask:(NSURLSessionDataTask *)dataTask
+    didReceiveResponse:(NSURLResponse *)response
+     completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler {
+  FVPMediaCacheDownload *download = self.downloads[@(dataTask.taskIdentifier)];
+  NSHTTPURLResponse *httpResponse =
+      [response isKindOfClass:[NSHTTPURLResponse class]] ? (NSHTTPURLResponse *)response : nil;
+  FVPMediaCacheContentInfo *contentInfo = [[FVPMediaCacheContentInfo alloc] init];
+  contentInfo.contentType = FVPContentTypeForMIMEType(response.MIMEType);
+  if (httpResponse.statusCode == 206) {
+    // "bytes <first>-<last>/<length>", where the length may be "*" if unknown.
+    NSString *contentRange = FVPHeaderValue(httpResponse, @"Content-Range");
+    NSString *length = [contentRange componentsSeparatedByString:@"/"].lastObject;
+    contentInfo.contentLength = [length isEqualToString:@"*"] ? -1 : length.longLongValue;
+    contentInfo.byteRangeAccessSupported = YES;
+  } else if (httpResponse.statusCode == 200) {
+    // The server ignored the range, and sends the whole resource.
+    contentInfo.contentLength = response.expectedContentLength;
+    contentInfo.byteRangeAccessSupported = NO;
+    download.offset = 0;
+  } else {
+    download.error = [NSError errorWithDomain:NSURLErrorDomain
+                                         code:NSURLErrorBadServerResponse
+                                     userInfo:nil];
+    completionHandler(NSURLSessionResponseCancel);
+    return;
+  }
+  if (contentInfo.contentLength > 0) {
+    [self.cache setContentInfo:contentInfo forURL:download.url];
+  }
+  AVAssetResourceLoadingContentInformationRequest *contentInformationRequest =
+      download.loadingRequest.contentInformationRequest;
+  if (contentInformationRequest) {
+    FVPFillContentInformationRequest(contentInformationRequest, contentInfo);
+  }
+  completionHandler(NSURLSessionResponseAllow);
+}
+
+- (void)URLSession:(NSURLSession *)session
+          dataTask:(NSURLSessionDataTask *)dataTask
+    didReceiveData:(NSData *)data {
+  FVPMediaCacheDownload *download = self.downloads[@(dataTask.taskIdentifier)];
+  if (!download) {
+    return;
+  }
+  [self.cache storeData:data forURL:download.url offset:download.offset];
+  AVAssetResourceLoadingRequest *loadingRequest = download.loadingRequest;
+  AVAssetResourceLoadingDataRequest *dataRequest = loadingRequest.dataRequest;
+  if (dataRequest && !loadingRequest.isCancelled && !loadingRequest.isFinished) {
+    // If the server ignored the range, the bytes before the request's offset aren't for it.
+    int64_t skipLength = dataRequest.currentOffset - download.offset;
+    if (skipLength >= 0 && skipLength < (int64_t)data.length) {
+      NSRange range = NSMakeRange((NSUInteger)skipLength, data.length - (NSUInteger)skipLength);
+      [dataRequest respondWithData:[data subdataWithRange:range]];
+    }
+  }
+  download.offset += (int64_t)data.length;
+  // A server that ignored the range keeps sending bytes past the end of the requested ones.
+  if (download.endOffset >= 0 && download.offset >= download.endOffset) {
+    [dataTask cancel];
+  }
+}
+
+- (void)URLSession:(NSURLSession *)session
+                    task:(NSURLSessionTask *)task
+    didCompleteWithError:(nullable NSError *)error {
+  NSNumber *taskIdentifier = @(task.taskIdentifier);
+  FVPMediaCacheDownload *download = self.downloads[taskIdentifier];
+  [self.downloads removeObjectForKey:taskIdentifier];
+  AVAssetResourceLoadingRequest *loadingRequest = download.loadingRequest;
+  if (!loadingRequest || loadingRequest.isCancelled || loadingRequest.isFinished) {
+    return;
+  }
+  BOOL reachedEnd = download.endOffset >= 0 && download.offset >= download.endOffset;
+  NSError *downloadError = download.error ?: (reachedEnd ? nil : error);
+  if (!downloadError && download.offset <= download.startOffset) {
+    // Nothing was received, so downloading again wouldn't get any further.
+    downloadError = [NSError errorWithDomain:NSURLErrorDomain
+                                        code:NSURLErrorZeroByteResource
+                                    userInfo:nil];
+  }
+  if (downloadError) {
+    [loadingRequest finishLoadingWithError:downloadError];
+  } else if (![self.cache contentInfoForURL:download.url]) {
+    // Without a known length, the end of the download is the end of the resource.
+    [loadingRequest finishLoading];
+  } else {
+    [self continueLoadingRequest:loadingRequest url:download.url];
+  }
+}
+
+@end
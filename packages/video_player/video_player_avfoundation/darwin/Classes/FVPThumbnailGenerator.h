@@ -0,0 +1,42 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <AVFoundation/AVFoundation.h>
+
+#if TARGET_OS_OSX
+#import <FlutterMacOS/FlutterMacOS.h>
+#else
+#import <Flutter/Flutter.h>
+#endif
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Generates JPEG thumbnails of an asset at a batch of times, sending each one to an event stream
+/// as soon as it is ready.
+///
+/// Generation starts when the stream is listened to. Each thumbnail is sent as a map with its
+/// "requestedTime" and actual "time" in milliseconds, and its JPEG "bytes". A thumbnail that can't
+/// be generated is sent as an error, and the stream ends after the last one.
+@interface FVPThumbnailGenerator : NSObject <FlutterStreamHandler>
+/// Creates a generator for the given times, in milliseconds.
+///
+/// Thumbnails fit in the given maximum size, or keep the video's size if it is CGSizeZero, and are
+/// taken from frames at most the given tolerance away from the requested times.
+- (instancetype)initWithAsset:(AVAsset *)asset
+                        times:(NSArray<NSNumber *> *)times
+                  maximumSize:(CGSize)maximumSize
+                    tolerance:(CMTime)tolerance;
+
+/// The channel that the thumbnails are sent on.
+@property(nonatomic, strong, nullable) FlutterEventChannel *eventChannel;
+
+/// Called on the main thread once the listener has cancelled the stream, which it does after the
+/// stream ends too.
+@property(nonatomic, copy, nullable) void (^cancellationHandler)(void);
+
+/// Stops generating thumbnails without sending anything more to the stream.
+- (void)cancel;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,138 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FVPThumbnailGenerator.h"
+
+#import <ImageIO/ImageIO.h>
+
+/// The JPEG quality of thumbnails, from 0 to 1.
+static const double kFVPThumbnailJPEGQuality = 0.8;
+
+/// Returns the given image encoded as JPEG, or nil if it can't be encoded.
+static NSData *_Nullable FVPJPEGDataForImage(CGImageRef image) {
+  NSMutableData *data = [NSMutableData data];
+  CGImageDestinationRef destination = CGImageDestinationCreateWithData(
+      (__bridge CFMutableDataRef)data, CFSTR("public.jpeg"), 1, NULL);
+  if (!destination) {
+    return nil;
+  }
+  NSDictionary *properties = @{
+    (__bridge NSString *)kCGImageDestinationLossyCompressionQuality : @(kFVPThumbnailJPEGQuality)
+  };
+  CGImageDestinationAddImage(destination, image, (__bridge CFDictionaryRef)properties);
+  BOOL encoded = CGImageDestinationFinalize(destination);
+  CFRelease(destination);
+  return encoded ? data : nil;
+}
+
+static int64_t FVPMillisecondsForTime(CMTime time) {
+  return CMTIME_IS_NUMERIC(time) ? (int64_t)llround(CMTimeGetSeconds(time) * 1000) : 0;
+}
+
+@interface FVPThumbnailGenerator ()
+@property(nonatomic, readonly) AVAssetImageGenerator *imageGenerator;
+@property(nonatomic, readonly) NSArray<NSValue *> *times;
+// The sink of the listener, until the last thumbnail is sent or generation is cancelled. Only
+// accessed on the main thread.
+@property(nonatomic, copy, nullable) FlutterEventSink eventSink;
+// The number of requested times that no thumbnail or error has been sent for yet.
+@property(nonatomic, assign) NSUInteger remainingCount;
+@end
+
+@implementation FVPThumbnailGenerator
+- (instancetype)initWithAsset:(AVAsset *)asset
+                        times:(NSArray<NSNumber *> *)times
+                  maximumSize:(CGSize)maximumSize
+                    tolerance:(CMTime)tolerance {
+  self = [super init];
+  if (self) {
+    _imageGenerator = [AVAssetImageGenerator assetImageGeneratorWithAsset:asset];
+    // Match the orientation that the video plays in.
+    _imageGenerator.appliesPreferredTrackTransform = YES;
+    _imageGenerator.maximumSize = maximumSize;
+    _imageGenerator.requestedTimeToleranceBefore = tolerance;
+    _imageGenerator.requestedTimeToleranceAfter = tolerance;
+    NSMutableArray<NSValue *> *timeValues = [NSMutableArray arrayWithCapacity:times.count];
+    for (NSNumber *time in times) {
+      [timeValues addObject:[NSValue valueWithCMTime:CMTimeMake(time.longLongValue, 1000)]];
+    }
+    _times = timeValues;
+  }
+  return self;
+}
+
+- (void)cancel {
+  self.eventSink = nil;
+  [self.imageGenerator cancelAllCGImageGeneration];
+}
+
+- (void)handleImageData:(nullable NSData *)data
+          requestedTime:(CMTime)requestedTime
+             actualTime:(CMTime)actualTime
+                  error:(nullable NSError *)error {
+  FlutterEventSink eventSink = self.eventSink;
+  if (!eventSink) {
+    return;
+  }
+  if (data) {
+    eventSink(@{
+      @"requestedTime" : @(FVPMillisecondsForTime(requestedTime)),
+      @"time" : @(FVPMillisecondsForTime(actualTime)),
+      @"bytes" : [FlutterStandardTypedData typedDataWithBytes:data],
+    });
+  } else {
+    NSString *message = error.localizedDescription ?: @"The thumbnail could not be generated";
+    NSDictionary *details = @{@"requestedTime" : @(FVPMillisecondsForTime(requestedTime))};
+    eventSink([FlutterError errorWithCode:@"VideoError" message:message details:details]);
+  }
+  self.remainingCount--;
+  if (self.remainingCount == 0) {
+    eventSink(FlutterEndOfEventStream);
+    self.eventSink = nil;
+  }
+}
+
+#pragma mark FlutterStreamHandler
+
+- (FlutterError *_Nullable)onListenWithArguments:(id _Nullable)arguments
+                                       eventSink:(nonnull FlutterEventSink)events {
+  if (self.times.count == 0) {
+    events(FlutterEndOfEventStream);
+    return nil;
+  }
+  self.eventSink = events;
+  self.remainingCount = self.times.count;
+  __weak typeof(self) weakSelf = self;
+  [self.imageGenerator
+      generateCGImagesAsynchronouslyForTimes:self.times
+                           completionHandler:^(CMTime requestedTime, CGImageRef _Nullable image,
+                                               CMTime actualTime,
+                                               AVAssetImageGeneratorResult result,
+                                               NSError *_Nullable error) {
+                             if (result == AVAssetImageGeneratorCancelled) {
+                               return;
+                             }
+                             // Encode on the generator's thread, to keep the main thread free.
+                             NSData *data = nil;
+                             if (result == AVAssetImageGeneratorSucceeded && image) {
+                               data = FVPJPEGDataForImage(image);
+                             }
+                             dispatch_async(dispatch_get_main_queue(), ^{
+                               [weakSelf handleImageData:data
+                                           requestedTime:requestedTime
+                                              actualTime:actualTime
+                                                   error:error];
+                             });
+                           }];
+  return nil;
+}
+
+- (FlutterError *_Nullable)onCancelWithArguments:(id _Nullable)arguments {
+  [self cancel];
+  if (self.cancellationHandler) {
+    self.cancellationHandler();
+  }
+  return nil;
+}
+@end
@@ -10,6 +10,8 @@
 
 #import "AVAssetTrackUtils.h"
 #import "FVPDisplayLink.h"
+#import "FVPMediaCacheLoader.h"
+#import "FVPThumbnailGenerator.h"
 #import "messages.g.h"
 
 #if !__has_feature(objc_arc)
@@ -30,6 +32,12 @@
 // while implementing macOS, but iOS should very likely be doing the check as well. See
 // https://github.com/flutter/flutter/issues/138427.
 @property(nonatomic, assign) BOOL skipBufferAvailabilityCheck;
+// The number of times the display link fired without a new frame being available. Only counted
+// when the buffer availability check isn't skipped.
+@property(atomic, assign) int64_t idleDisplayLinkFireCount;
+// The frame rate of the video, or 0 if it isn't known. Guarded by the FVPSharedDisplayLink that
+// drives this updater.
+@property(nonatomic, assign) double frameRate;
 @end
 
 @implementation FVPFrameUpdater
@@ -51,6 +59,8 @@
     if ([self.videoOutput hasNewPixelBufferForItemTime:outputItemTime]) {
       _lastKnownAvailableTime = outputItemTime;
       reportFrame = YES;
+    } else {
+      self.idleDisplayLinkFireCount++;
     }
   }
   if (reportFrame) {
@@ -84,6 +94,246 @@
 
 @end
 
+/**
+ * Drives the frame updaters of all players from a single display link, so that playing several
+ * videos at once costs one display link (and on macOS, one display link thread) and one main
+ * thread callback per frame, rather than one of each per video.
+ */
+@interface FVPSharedDisplayLink : NSObject
+- (instancetype)initWithDisplayLinkFactory:(id<FVPDisplayLinkFactory>)displayLinkFactory
+                                 registrar:(NSObject<FlutterPluginRegistrar> *)registrar;
+
+/**
+ * Starts or stops calling the given frame updater each time the display link fires. The display
+ * link runs while at least one frame updater is running.
+ *
+ * Can be called on any thread.
+ */
+- (void)setRunning:(BOOL)running forFrameUpdater:(FVPFrameUpdater *)frameUpdater;
+
+/**
+ * Sets the frame rate of the given frame updater's video, or 0 if it isn't known. The display
+ * link fires at the highest frame rate of the running frame updaters, or at the display's refresh
+ * rate if any of them is unknown.
+ *
+ * Can be called on any thread.
+ */
+- (void)setFrameRate:(double)frameRate forFrameUpdater:(FVPFrameUpdater *)frameUpdater;
+@end
+
+@interface FVPSharedDisplayLink ()
+// The display link shared by all frame updaters.
+@property(nonatomic, readonly) FVPDisplayLink *displayLink;
+// The frame updaters to call when the display link fires. Guarded by @synchronized(self).
+@property(nonatomic, readonly) NSMutableSet<FVPFrameUpdater *> *runningFrameUpdaters;
+@end
+
+@implementation FVPSharedDisplayLink
+- (instancetype)initWithDisplayLinkFactory:(id<FVPDisplayLinkFactory>)displayLinkFactory
+                                 registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
+  self = [super init];
+  if (self) {
+    _runningFrameUpdaters = [NSMutableSet set];
+    __weak typeof(self) weakSelf = self;
+    _displayLink = [displayLinkFactory displayLinkWithRegistrar:registrar
+                                                       callback:^() {
+                                                         [weakSelf displayLinkFired];
+                                                       }];
+  }
+  return self;
+}
+
+- (void)setRunning:(BOOL)running forFrameUpdater:(FVPFrameUpdater *)frameUpdater {
+  @synchronized(self) {
+    if (running) {
+      [self.runningFrameUpdaters addObject:frameUpdater];
+    } else {
+      [self.runningFrameUpdaters removeObject:frameUpdater];
+    }
+    [self updatePreferredFramesPerSecond];
+    BOOL displayLinkShouldRun = self.runningFrameUpdaters.count > 0;
+    if (self.displayLink.running != displayLinkShouldRun) {
+      self.displayLink.running = displayLinkShouldRun;
+    }
+  }
+}
+
+- (void)setFrameRate:(double)frameRate forFrameUpdater:(FVPFrameUpdater *)frameUpdater {
+  @synchronized(self) {
+    frameUpdater.frameRate = frameRate;
+    [self updatePreferredFramesPerSecond];
+  }
+}
+
+// Must be called within @synchronized(self).
+- (void)updatePreferredFramesPerSecond {
+  double framesPerSecond = 0;
+  for (FVPFrameUpdater *frameUpdater in self.runningFrameUpdaters) {
+    if (frameUpdater.frameRate <= 0) {
+      // A video with an unknown rate may need every display refresh.
+      framesPerSecond = 0;
+      break;
+    }
+    framesPerSecond = MAX(framesPerSecond, frameUpdater.frameRate);
+  }
+  if (self.displayLink.preferredFramesPerSecond != framesPerSecond) {
+    self.displayLink.preferredFramesPerSecond = framesPerSecond;
+  }
+}
+
+- (void)displayLinkFired {
+  NSArray<FVPFrameUpdater *> *frameUpdaters;
+  @synchronized(self) {
+    frameUpdaters = self.runningFrameUpdaters.allObjects;
+  }
+  // The display link fires on the main thread, so every player's frame is reported to the engine
+  // from this one callback.
+  for (FVPFrameUpdater *frameUpdater in frameUpdaters) {
+    [frameUpdater displayLinkFired];
+  }
+}
+@end
+
+/**
+ * Keeps the AVPlayers of disposed video players so that new video players can reuse them, since
+ * swapping the item of an existing AVPlayer is cheaper than setting up a new one. This matters
+ * for apps that create and dispose players in quick succession, such as a scrolling video feed.
+ *
+ * Only used on the main thread.
+ */
+@interface FVPPlayerPool : NSObject <FVPAVFactory>
+- (instancetype)initWithAVFactory:(id<FVPAVFactory>)avFactory;
+
+/// Returns a player that is no longer in use to the pool. It must not have a current item.
+- (void)recyclePlayer:(AVPlayer *)player;
+
+/// Drops all pooled players.
+- (void)removeAllPlayers;
+@end
+
+/// The maximum number of unused players FVPPlayerPool keeps around.
+static const NSUInteger kFVPMaxPooledPlayerCount = 2;
+
+@interface FVPPlayerPool ()
+@property(nonatomic, readonly) id<FVPAVFactory> avFactory;
+@property(nonatomic, readonly) NSMutableArray<AVPlayer *> *players;
+@end
+
+@implementation FVPPlayerPool
+- (instancetype)initWithAVFactory:(id<FVPAVFactory>)avFactory {
+  self = [super init];
+  if (self) {
+    _avFactory = avFactory;
+    _players = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (AVPlayer *)playerWithPlayerItem:(AVPlayerItem *)playerItem {
+  AVPlayer *player = self.players.lastObject;
+  if (!player) {
+    return [self.avFactory playerWithPlayerItem:playerItem];
+  }
+  [self.players removeLastObject];
+  [player replaceCurrentItemWithPlayerItem:playerItem];
+  return player;
+}
+
+- (AVPlayerItemVideoOutput *)videoOutputWithPixelBufferAttributes:
+    (NSDictionary<NSString *, id> *)attributes {
+  return [self.avFactory videoOutputWithPixelBufferAttributes:attributes];
+}
+
+- (void)recyclePlayer:(AVPlayer *)player {
+  if (!player || self.players.count >= kFVPMaxPooledPlayerCount ||
+      [self.players containsObject:player]) {
+    return;
+  }
+  // Undo anything the previous video player changed, so that the next one starts from the same
+  // state as a new AVPlayer.
+  [player pause];
+  player.rate = 0.0;
+  player.volume = 1.0;
+  player.muted = NO;
+  player.actionAtItemEnd = AVPlayerActionAtItemEndPause;
+  [self.players addObject:player];
+}
+
+- (void)removeAllPlayers {
+  [self.players removeAllObjects];
+}
+@end
+
+/// A player item created by `preload:` ahead of the `create:` call that plays it.
+@interface FVPPreloadedItem : NSObject
+@property(nonatomic, copy) NSString *uri;
+@property(nonatomic, copy) NSDictionary<NSString *, NSString *> *httpHeaders;
+@property(nonatomic, strong) AVPlayerItem *item;
+@end
+
+@implementation FVPPreloadedItem
+@end
+
+/// The maximum number of preloaded items kept until a `create:` call picks them up. Preloading
+/// more drops the oldest ones.
+static const NSUInteger kFVPMaxPreloadedItemCount = 4;
+
+/// Returns a new asset for the given URL, which sends the given HTTP headers with its requests, and
+/// loads through the given media cache loader, if any, when the URL can be cached.
+static AVURLAsset *FVPAssetWithURL(NSURL *url, NSDictionary<NSString *, NSString *> *headers,
+                                   FVPMediaCacheLoader *_Nullable mediaCacheLoader) {
+  if (mediaCacheLoader && [FVPMediaCacheLoader canCacheURL:url]) {
+    return [mediaCacheLoader assetWithURL:url httpHeaders:headers];
+  }
+  NSDictionary<NSString *, id> *options = nil;
+  if ([headers count] != 0) {
+    options = @{@"AVURLAssetHTTPHeaderFieldsKey" : headers};
+  }
+  return [AVURLAsset URLAssetWithURL:url options:options];
+}
+
+/// Returns a new player item for an asset created by FVPAssetWithURL.
+static AVPlayerItem *FVPPlayerItemWithURL(NSURL *url,
+                                          NSDictionary<NSString *, NSString *> *headers,
+                                          FVPMediaCacheLoader *_Nullable mediaCacheLoader) {
+  return [AVPlayerItem playerItemWithAsset:FVPAssetWithURL(url, headers, mediaCacheLoader)];
+}
+
+/// The number of bytes that the media cache keeps on disk until told otherwise.
+static const int64_t kFVPDefaultMediaCacheMaximumSize = 512 * 1024 * 1024;
+
+/// The minimum time between the buffering updates of a player until told otherwise.
+static const NSTimeInterval kFVPDefaultBufferingUpdateInterval = 0.25;
+
+/// How a player's video output delivers frames to the engine.
+@interface FVPVideoOutputSettings : NSObject
+/// The pixel format of the output's pixel buffers.
+@property(nonatomic, assign) OSType pixelFormatType;
+/// The size that frames larger than it are scaled down to fit, or CGSizeZero to output frames at
+/// the video's own size.
+@property(nonatomic, assign) CGSize maximumSize;
+/// Whether players only play audio, without creating a video output.
+@property(nonatomic, assign) BOOL audioOnly;
+@end
+
+@implementation FVPVideoOutputSettings
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _pixelFormatType = kCVPixelFormatType_32BGRA;
+    _maximumSize = CGSizeZero;
+  }
+  return self;
+}
+@end
+
+/// Returns the largest size with the aspect ratio of the given size that fits within the given
+/// maximum size, rounded down to even dimensions as required by 4:2:0 pixel formats.
+static CGSize FVPSizeFittingWithinSize(CGSize size, CGSize maximumSize) {
+  CGFloat scale = MIN(maximumSize.width / size.width, maximumSize.height / size.height);
+  return CGSizeMake(floor(size.width * scale / 2) * 2, floor(size.height * scale / 2) * 2);
+}
+
 #pragma mark -
 
 @interface FVPVideoPlayer ()
@@ -101,19 +351,54 @@
 @property(nonatomic, readonly) BOOL isInitialized;
 // The updater that drives callbacks to the engine to indicate that a new frame is ready.
 @property(nonatomic) FVPFrameUpdater *frameUpdater;
-// The display link that drives frameUpdater.
-@property(nonatomic) FVPDisplayLink *displayLink;
+// The display link, shared with other players, that drives frameUpdater.
+@property(nonatomic) FVPSharedDisplayLink *displayLink;
+// The pool that the player is returned to on disposal, if any.
+@property(nonatomic, weak) FVPPlayerPool *playerPool;
+// The factory that created videoOutput, used to replace it with a scaled down one if needed.
+@property(nonatomic) id<FVPAVFactory> avFactory;
+// How videoOutput delivers frames.
+@property(nonatomic) FVPVideoOutputSettings *videoOutputSettings;
 // Whether a new frame needs to be provided to the engine regardless of the current play/pause state
 // (e.g., after a seek while paused). If YES, the display link should continue to run until the next
 // frame is successfully provided.
 @property(nonatomic, assign) BOOL waitingForFrame;
+// The number of times copyPixelBuffer had no frame to return. Only incremented on the raster
+// thread.
+@property(atomic, assign) int64_t nullPixelBufferCount;
+// How far seeks may land from the requested position, on either side. Zero for exact seeks.
+@property(nonatomic, assign) CMTime seekTolerance;
+// Whether seeks are coalesced for scrubbing, so that only the latest requested position is seeked
+// to once the seek in progress finishes.
+@property(nonatomic, assign) BOOL scrubbing;
+// Whether a seek issued while scrubbing hasn't finished yet.
+@property(nonatomic, assign) BOOL scrubSeekInProgress;
+// The latest position requested while scrubbing that hasn't been seeked to yet, if any, and the
+// handler to call once it has.
+@property(nonatomic, assign) BOOL hasPendingScrubLocation;
+@property(nonatomic, assign) int64_t pendingScrubLocation;
+@property(nonatomic, copy) void (^pendingScrubCompletionHandler)(BOOL);
+// The loaded time ranges last sent in a buffering update, as [start, end] pairs in milliseconds.
+@property(nonatomic, copy, nullable) NSArray<NSArray<NSNumber *> *> *lastBufferedRanges;
+// When the last buffering update was sent, in CACurrentMediaTime() seconds.
+@property(nonatomic, assign) CFTimeInterval lastBufferingUpdateTime;
+// Whether a buffering update is scheduled for when the interval since the last one ends.
+@property(nonatomic, assign) BOOL bufferingUpdateScheduled;
 
 - (instancetype)initWithURL:(NSURL *)url
                frameUpdater:(FVPFrameUpdater *)frameUpdater
-                displayLink:(FVPDisplayLink *)displayLink
+                displayLink:(FVPSharedDisplayLink *)displayLink
                 httpHeaders:(nonnull NSDictionary<NSString *, NSString *> *)headers
                   avFactory:(id<FVPAVFactory>)avFactory
+        videoOutputSettings:(FVPVideoOutputSettings *)videoOutputSettings
                   registrar:(NSObject<FlutterPluginRegistrar> *)registrar;
+
+- (instancetype)initWithPlayerItem:(AVPlayerItem *)item
+                      frameUpdater:(FVPFrameUpdater *)frameUpdater
+                       displayLink:(FVPSharedDisplayLink *)displayLink
+                         avFactory:(id<FVPAVFactory>)avFactory
+               videoOutputSettings:(FVPVideoOutputSettings *)videoOutputSettings
+                         registrar:(NSObject<FlutterPluginRegistrar> *)registrar;
 @end
 
 static void *timeRangeContext = &timeRangeContext;
@@ -126,8 +411,9 @@ static void *rateContext = &rateContext;
 @implementation FVPVideoPlayer
 - (instancetype)initWithAsset:(NSString *)asset
                  frameUpdater:(FVPFrameUpdater *)frameUpdater
-                  displayLink:(FVPDisplayLink *)displayLink
+                  displayLink:(FVPSharedDisplayLink *)displayLink
                     avFactory:(id<FVPAVFactory>)avFactory
+          videoOutputSettings:(FVPVideoOutputSettings *)videoOutputSettings
                     registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
   NSString *path = [[NSBundle mainBundle] pathForResource:asset ofType:nil];
 #if TARGET_OS_OSX
@@ -142,6 +428,7 @@ static void *rateContext = &rateContext;
                displayLink:displayLink
                httpHeaders:@{}
                  avFactory:avFactory
+       videoOutputSettings:videoOutputSettings
                  registrar:registrar];
 }
 
@@ -254,33 +541,33 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 
 - (instancetype)initWithURL:(NSURL *)url
                frameUpdater:(FVPFrameUpdater *)frameUpdater
-                displayLink:(FVPDisplayLink *)displayLink
+                displayLink:(FVPSharedDisplayLink *)displayLink
                 httpHeaders:(nonnull NSDictionary<NSString *, NSString *> *)headers
                   avFactory:(id<FVPAVFactory>)avFactory
+        videoOutputSettings:(FVPVideoOutputSettings *)videoOutputSettings
                   registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
-  NSDictionary<NSString *, id> *options = nil;
-  if ([headers count] != 0) {
-    options = @{@"AVURLAssetHTTPHeaderFieldsKey" : headers};
-  }
-  AVURLAsset *urlAsset = [AVURLAsset URLAssetWithURL:url options:options];
-  AVPlayerItem *item = [AVPlayerItem playerItemWithAsset:urlAsset];
-  return [self initWithPlayerItem:item
+  return [self initWithPlayerItem:FVPPlayerItemWithURL(url, headers, nil)
                      frameUpdater:frameUpdater
-                      displayLink:(FVPDisplayLink *)displayLink
+                      displayLink:displayLink
                         avFactory:avFactory
+              videoOutputSettings:videoOutputSettings
                         registrar:registrar];
 }
 
 - (instancetype)initWithPlayerItem:(AVPlayerItem *)item
                       frameUpdater:(FVPFrameUpdater *)frameUpdater
-                       displayLink:(FVPDisplayLink *)displayLink
+                       displayLink:(FVPSharedDisplayLink *)displayLink
                          avFactory:(id<FVPAVFactory>)avFactory
+               videoOutputSettings:(FVPVideoOutputSettings *)videoOutputSettings
                          registrar:(NSObject<FlutterPluginRegistrar> *)registrar {
   self = [super init];
   NSAssert(self, @"super init cannot be nil");
 
   _registrar = registrar;
   _frameUpdater = frameUpdater;
+  _seekTolerance = kCMTimeZero;
+  _audioOnly = videoOutputSettings.audioOnly;
+  _bufferingUpdateInterval = kFVPDefaultBufferingUpdateInterval;
 
   AVAsset *asset = [item asset];
   void (^assetCompletionHandler)(void) = ^{
@@ -290,6 +577,12 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
         AVAssetTrack *videoTrack = tracks[0];
         void (^trackCompletionHandler)(void) = ^{
           if (self->_disposed) return;
+          if ([videoTrack statusOfValueForKey:@"nominalFrameRate"
+                                        error:nil] == AVKeyValueStatusLoaded) {
+            // Lets the display link fire only as often as the video has new frames.
+            [self.displayLink setFrameRate:videoTrack.nominalFrameRate
+                           forFrameUpdater:self.frameUpdater];
+          }
           if ([videoTrack statusOfValueForKey:@"preferredTransform"
                                         error:nil] == AVKeyValueStatusLoaded) {
             // Rotate the video by using a videoComposition and the preferredTransform
@@ -305,7 +598,7 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
             item.videoComposition = videoComposition;
           }
         };
-        [videoTrack loadValuesAsynchronouslyForKeys:@[ @"preferredTransform" ]
+        [videoTrack loadValuesAsynchronouslyForKeys:@[ @"preferredTransform", @"nominalFrameRate" ]
                                   completionHandler:trackCompletionHandler];
       }
     }
@@ -319,17 +612,20 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   // video streams (not just iOS 16).  (https://github.com/flutter/flutter/issues/109116). An
   // invisible AVPlayerLayer is used to overwrite the protection of pixel buffers in those streams
   // for issue #1, and restore the correct width and height for issue #2.
-  _playerLayer = [AVPlayerLayer playerLayerWithPlayer:_player];
+  // Audio-only players never read frames, so the layer is only attached to the player when
+  // switching to video.
+  _playerLayer = [AVPlayerLayer playerLayerWithPlayer:_audioOnly ? nil : _player];
   [self.flutterViewLayer addSublayer:_playerLayer];
 
   // Configure output.
   _displayLink = displayLink;
-  NSDictionary *pixBuffAttributes = @{
-    (id)kCVPixelBufferPixelFormatTypeKey : @(kCVPixelFormatType_32BGRA),
-    (id)kCVPixelBufferIOSurfacePropertiesKey : @{}
-  };
-  _videoOutput = [avFactory videoOutputWithPixelBufferAttributes:pixBuffAttributes];
-  frameUpdater.videoOutput = _videoOutput;
+  _avFactory = avFactory;
+  _videoOutputSettings = videoOutputSettings;
+  if (!_audioOnly) {
+    _videoOutput = [avFactory
+        videoOutputWithPixelBufferAttributes:[self pixelBufferAttributesWithSize:CGSizeZero]];
+    frameUpdater.videoOutput = _videoOutput;
+  }
 #if TARGET_OS_IOS
   // See TODO on this property in FVPFrameUpdater.
   frameUpdater.skipBufferAvailabilityCheck = YES;
@@ -342,20 +638,99 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   return self;
 }
 
+/// Returns the attributes of the pixel buffers for videoOutput, scaled to the given size unless it
+/// is CGSizeZero.
+- (NSDictionary *)pixelBufferAttributesWithSize:(CGSize)size {
+  OSType pixelFormatType = self.videoOutputSettings.pixelFormatType;
+  NSMutableDictionary *attributes = [@{
+    (id)kCVPixelBufferPixelFormatTypeKey : @(pixelFormatType),
+    (id)kCVPixelBufferIOSurfacePropertiesKey : @{}
+  } mutableCopy];
+  if (pixelFormatType != kCVPixelFormatType_32BGRA) {
+    // The engine converts other formats to RGB in a shader, so make sure that the planes can be
+    // wrapped as Metal textures.
+    attributes[(id)kCVPixelBufferMetalCompatibilityKey] = @YES;
+  }
+  if (!CGSizeEqualToSize(size, CGSizeZero)) {
+    attributes[(id)kCVPixelBufferWidthKey] = @(size.width);
+    attributes[(id)kCVPixelBufferHeightKey] = @(size.height);
+  }
+  return attributes;
+}
+
+/// Replaces videoOutput with one that scales frames down to fit within the maximum output size,
+/// if the item's frames are larger than that.
+///
+/// Must be called before videoOutput is added to the item, since the output's pixel buffer
+/// attributes can't be changed afterwards.
+- (void)scaleVideoOutputForItem:(AVPlayerItem *)item {
+  CGSize maximumSize = self.videoOutputSettings.maximumSize;
+  CGSize presentationSize = item.presentationSize;
+  if (CGSizeEqualToSize(maximumSize, CGSizeZero) || presentationSize.width <= 0 ||
+      presentationSize.height <= 0 ||
+      (presentationSize.width <= maximumSize.width &&
+       presentationSize.height <= maximumSize.height)) {
+    return;
+  }
+  CGSize size = FVPSizeFittingWithinSize(presentationSize, maximumSize);
+  // The display link only starts once the player is initialized, which is after this, so the
+  // engine has not read from the previous output yet.
+  _videoOutput = [self.avFactory
+      videoOutputWithPixelBufferAttributes:[self pixelBufferAttributesWithSize:size]];
+  self.frameUpdater.videoOutput = _videoOutput;
+}
+
+/// Enables or disables the item's video tracks, so that frames aren't decoded while only audio is
+/// played.
+- (void)setVideoTracksEnabled:(BOOL)enabled forItem:(AVPlayerItem *)item {
+  for (AVPlayerItemTrack *track in item.tracks) {
+    if ([track.assetTrack.mediaType isEqualToString:AVMediaTypeVideo]) {
+      track.enabled = enabled;
+    }
+  }
+}
+
+- (void)setAudioOnly:(BOOL)audioOnly {
+  if (_disposed || _audioOnly == audioOnly) {
+    return;
+  }
+  _audioOnly = audioOnly;
+  AVPlayerItem *item = self.player.currentItem;
+  if (audioOnly) {
+    // Stop driving frames to the engine before removing the output they are read from. The texture
+    // stays registered, since it identifies the player.
+    self.waitingForFrame = NO;
+    [self.displayLink setRunning:NO forFrameUpdater:self.frameUpdater];
+    [item removeOutput:_videoOutput];
+    _videoOutput = nil;
+    self.frameUpdater.videoOutput = nil;
+    _playerLayer.player = nil;
+    [self setVideoTracksEnabled:NO forItem:item];
+  } else {
+    _playerLayer.player = _player;
+    [self setVideoTracksEnabled:YES forItem:item];
+    _videoOutput = [self.avFactory
+        videoOutputWithPixelBufferAttributes:[self pixelBufferAttributesWithSize:CGSizeZero]];
+    self.frameUpdater.videoOutput = _videoOutput;
+    // Otherwise the output is added once the item is ready to play.
+    if (item.status == AVPlayerItemStatusReadyToPlay) {
+      [self scaleVideoOutputForItem:item];
+      [item addOutput:_videoOutput];
+    }
+    if (_isInitialized) {
+      // Run the display link until the current frame is shown, even if paused.
+      self.waitingForFrame = YES;
+      [self.displayLink setRunning:YES forFrameUpdater:self.frameUpdater];
+    }
+  }
+}
+
 - (void)observeValueForKeyPath:(NSString *)path
                       ofObject:(id)object
                         change:(NSDictionary *)change
                        context:(void *)context {
   if (context == timeRangeContext) {
-    if (_eventSink != nil) {
-      NSMutableArray<NSArray<NSNumber *> *> *values = [[NSMutableArray alloc] init];
-      for (NSValue *rangeValue in [object loadedTimeRanges]) {
-        CMTimeRange range = [rangeValue CMTimeRangeValue];
-        int64_t start = FVPCMTimeToMillis(range.start);
-        [values addObject:@[ @(start), @(start + FVPCMTimeToMillis(range.duration)) ]];
-      }
-      _eventSink(@{@"event" : @"bufferingUpdate", @"values" : values});
-    }
+    [self scheduleBufferingUpdate];
   } else if (context == statusContext) {
     AVPlayerItem *item = (AVPlayerItem *)object;
     switch (item.status) {
@@ -371,7 +746,14 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
       case AVPlayerItemStatusUnknown:
         break;
       case AVPlayerItemStatusReadyToPlay:
-        [item addOutput:_videoOutput];
+        if (_audioOnly) {
+          [self setVideoTracksEnabled:NO forItem:item];
+        } else {
+          if (![item.outputs containsObject:_videoOutput]) {
+            [self scaleVideoOutputForItem:item];
+          }
+          [item addOutput:_videoOutput];
+        }
         [self setupEventSinkIfReadyToPlay];
         [self updatePlayingState];
         break;
@@ -416,7 +798,7 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   } else {
     [_player pause];
   }
-  _displayLink.running = _isPlaying;
+  [_displayLink setRunning:_isPlaying && !_audioOnly forFrameUpdater:_frameUpdater];
 }
 
 - (void)setupEventSinkIfReadyToPlay {
@@ -448,8 +830,8 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 
     // The player has not yet initialized when it has no size, unless it is an audio-only track.
     // HLS m3u8 video files never load any tracks, and are also not yet initialized until they have
-    // a size.
-    if ((hasVideoTracks || hasNoTracks) && height == CGSizeZero.height &&
+    // a size. Audio-only players don't wait for a size, since their video tracks are disabled.
+    if (!_audioOnly && (hasVideoTracks || hasNoTracks) && height == CGSizeZero.height &&
         width == CGSizeZero.width) {
       return;
     }
@@ -491,18 +873,61 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 }
 
 - (void)seekTo:(int64_t)location completionHandler:(void (^)(BOOL))completionHandler {
+  if (!self.scrubbing) {
+    [self performSeekTo:location completionHandler:completionHandler];
+    return;
+  }
+  // Seeking to every position a scrubber passes through queues up far more seeks than can be
+  // decoded, so instead only seek to the latest position once the seek in progress has finished.
+  // See https://developer.apple.com/library/archive/qa/qa1820/_index.html.
+  if (self.hasPendingScrubLocation && self.pendingScrubCompletionHandler) {
+    self.pendingScrubCompletionHandler(NO);
+  }
+  self.hasPendingScrubLocation = YES;
+  self.pendingScrubLocation = location;
+  self.pendingScrubCompletionHandler = completionHandler;
+  if (!self.scrubSeekInProgress) {
+    [self seekToPendingScrubLocation];
+  }
+}
+
+- (void)seekToPendingScrubLocation {
+  if (!self.hasPendingScrubLocation) {
+    self.scrubSeekInProgress = NO;
+    return;
+  }
+  void (^completionHandler)(BOOL) = self.pendingScrubCompletionHandler;
+  self.hasPendingScrubLocation = NO;
+  self.pendingScrubCompletionHandler = nil;
+  self.scrubSeekInProgress = YES;
+  __weak typeof(self) weakSelf = self;
+  [self performSeekTo:self.pendingScrubLocation
+      completionHandler:^(BOOL completed) {
+        if (completionHandler) {
+          completionHandler(completed);
+        }
+        dispatch_async(dispatch_get_main_queue(), ^{
+          [weakSelf seekToPendingScrubLocation];
+        });
+      }];
+}
+
+- (void)performSeekTo:(int64_t)location completionHandler:(void (^)(BOOL))completionHandler {
   CMTime previousCMTime = _player.currentTime;
   CMTime targetCMTime = CMTimeMake(location, 1000);
   CMTimeValue duration = _player.currentItem.asset.duration.value;
+  CMTime tolerance = self.seekTolerance;
   // Without adding tolerance when seeking to duration,
   // seekToTime will never complete, and this call will hang.
   // see issue https://github.com/flutter/flutter/issues/124475.
-  CMTime tolerance = location == duration ? CMTimeMake(1, 1000) : kCMTimeZero;
+  if (location == duration && CMTimeCompare(tolerance, CMTimeMake(1, 1000)) < 0) {
+    tolerance = CMTimeMake(1, 1000);
+  }
   [_player seekToTime:targetCMTime
         toleranceBefore:tolerance
          toleranceAfter:tolerance
       completionHandler:^(BOOL completed) {
-        if (CMTimeCompare(self.player.currentTime, previousCMTime) != 0) {
+        if (!self.audioOnly && CMTimeCompare(self.player.currentTime, previousCMTime) != 0) {
           // Ensure that a frame is drawn once available, even if currently paused. In theory a race
           // is possible here where the new frame has already drawn by the time this code runs, and
           // the display link stays on indefinitely, but that should be relatively harmless. This
@@ -510,7 +935,7 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
           // available because the seek completing doesn't guarantee that the pixel buffer is
           // already available.
           self.waitingForFrame = YES;
-          self.displayLink.running = YES;
+          [self.displayLink setRunning:YES forFrameUpdater:self.frameUpdater];
         }
 
         if (completionHandler) {
@@ -551,32 +976,83 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   _player.rate = speed;
 }
 
+- (void)setPreferredPeakBitRate:(double)bitRate {
+  _player.currentItem.preferredPeakBitRate = bitRate;
+}
+
+- (void)setPreferredMaximumResolution:(CGSize)resolution {
+  _player.currentItem.preferredMaximumResolution = resolution;
+}
+
+- (void)setPreferredForwardBufferDuration:(NSTimeInterval)duration {
+  _player.currentItem.preferredForwardBufferDuration = duration;
+}
+
 - (CVPixelBufferRef)copyPixelBuffer {
+  // Read the output once, since switching to audio-only removes it on the main thread.
+  AVPlayerItemVideoOutput *videoOutput = _videoOutput;
+  if (!videoOutput) {
+    // Audio-only players have no frames to provide.
+    return NULL;
+  }
   CVPixelBufferRef buffer = NULL;
-  CMTime outputItemTime = [_videoOutput itemTimeForHostTime:CACurrentMediaTime()];
-  if ([_videoOutput hasNewPixelBufferForItemTime:outputItemTime]) {
-    buffer = [_videoOutput copyPixelBufferForItemTime:outputItemTime itemTimeForDisplay:NULL];
+  CMTime outputItemTime = [videoOutput itemTimeForHostTime:CACurrentMediaTime()];
+  if ([videoOutput hasNewPixelBufferForItemTime:outputItemTime]) {
+    buffer = [videoOutput copyPixelBufferForItemTime:outputItemTime itemTimeForDisplay:NULL];
   } else {
     // If the current time isn't available yet, use the time that was checked when informing the
     // engine that a frame was available (if any).
     CMTime lastAvailableTime = self.frameUpdater.lastKnownAvailableTime;
     if (CMTIME_IS_VALID(lastAvailableTime)) {
-      buffer = [_videoOutput copyPixelBufferForItemTime:lastAvailableTime itemTimeForDisplay:NULL];
+      buffer = [videoOutput copyPixelBufferForItemTime:lastAvailableTime itemTimeForDisplay:NULL];
     }
   }
 
+  if (!buffer) {
+    self.nullPixelBufferCount++;
+  }
+
   if (self.waitingForFrame && buffer) {
     self.waitingForFrame = NO;
     // If the display link was only running temporarily to pick up a new frame while the video was
     // paused, stop it again.
     if (!self.isPlaying) {
-      self.displayLink.running = NO;
+      [self.displayLink setRunning:NO forFrameUpdater:self.frameUpdater];
     }
   }
 
   return buffer;
 }
 
+- (FVPPlaybackStatsMessage *)playbackStatsWithTextureId:(int64_t)textureId {
+  AVPlayerItem *item = self.player.currentItem;
+  NSArray<AVPlayerItemAccessLogEvent *> *events = item.accessLog.events;
+  NSInteger stallCount = 0;
+  NSInteger droppedVideoFrameCount = 0;
+  for (AVPlayerItemAccessLogEvent *event in events) {
+    // Both are negative when unknown.
+    stallCount += MAX(event.numberOfStalls, 0);
+    droppedVideoFrameCount += MAX(event.numberOfDroppedVideoFrames, 0);
+  }
+  // The bit rates of the variant currently playing, and the time it took to start playing the
+  // first one. All are negative when unknown.
+  AVPlayerItemAccessLogEvent *latestEvent = events.lastObject;
+  NSNumber *indicatedBitrate =
+      latestEvent.indicatedBitrate >= 0 ? @(latestEvent.indicatedBitrate) : nil;
+  NSNumber *observedBitrate =
+      latestEvent.observedBitrate >= 0 ? @(latestEvent.observedBitrate) : nil;
+  NSTimeInterval startupTime = events.firstObject ? events.firstObject.startupTime : -1;
+  return [FVPPlaybackStatsMessage makeWithTextureId:textureId
+                                   indicatedBitrate:indicatedBitrate
+                                    observedBitrate:observedBitrate
+                                        startupTime:startupTime >= 0 ? @(startupTime) : nil
+                                         stallCount:stallCount
+                             droppedVideoFrameCount:droppedVideoFrameCount
+                                         errorCount:(NSInteger)item.errorLog.events.count
+                           idleDisplayLinkFireCount:self.frameUpdater.idleDisplayLinkFireCount
+                               nullPixelBufferCount:self.nullPixelBufferCount];
+}
+
 - (void)onTextureUnregistered:(NSObject<FlutterTexture> *)texture {
   dispatch_async(dispatch_get_main_queue(), ^{
     [self dispose];
@@ -588,9 +1064,51 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   return nil;
 }
 
+// Sends a buffering update now if the update interval has passed since the last one, or once it
+// has otherwise, so that ranges loading quickly don't flood the event channel.
+- (void)scheduleBufferingUpdate {
+  if (_eventSink == nil || self.bufferingUpdateScheduled) {
+    return;
+  }
+  NSTimeInterval delay =
+      self.lastBufferingUpdateTime + self.bufferingUpdateInterval - CACurrentMediaTime();
+  if (delay <= 0) {
+    [self sendBufferingUpdate];
+    return;
+  }
+  self.bufferingUpdateScheduled = YES;
+  __weak typeof(self) weakSelf = self;
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   weakSelf.bufferingUpdateScheduled = NO;
+                   [weakSelf sendBufferingUpdate];
+                 });
+}
+
+// Sends the current loaded time ranges, unless they are the ones last sent.
+- (void)sendBufferingUpdate {
+  if (_eventSink == nil || _disposed) {
+    return;
+  }
+  NSMutableArray<NSArray<NSNumber *> *> *values = [[NSMutableArray alloc] init];
+  for (NSValue *rangeValue in self.player.currentItem.loadedTimeRanges) {
+    CMTimeRange range = [rangeValue CMTimeRangeValue];
+    int64_t start = FVPCMTimeToMillis(range.start);
+    [values addObject:@[ @(start), @(start + FVPCMTimeToMillis(range.duration)) ]];
+  }
+  if ([values isEqualToArray:self.lastBufferedRanges]) {
+    return;
+  }
+  self.lastBufferedRanges = values;
+  self.lastBufferingUpdateTime = CACurrentMediaTime();
+  _eventSink(@{@"event" : @"bufferingUpdate", @"values" : values});
+}
+
 - (FlutterError *_Nullable)onListenWithArguments:(id _Nullable)arguments
                                        eventSink:(nonnull FlutterEventSink)events {
   _eventSink = events;
+  // A new listener hasn't seen any ranges yet.
+  self.lastBufferedRanges = nil;
   // TODO(@recastrodiaz): remove the line below when the race condition is resolved:
   // https://github.com/flutter/flutter/issues/21483
   // This line ensures the 'initialized' event is sent when the event
@@ -614,11 +1132,17 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 
   _disposed = YES;
   [_playerLayer removeFromSuperlayer];
+  // The layer lives until the texture is unregistered, so it must let go of the player before the
+  // player is handed to the next video player.
+  _playerLayer.player = nil;
+  [_displayLink setRunning:NO forFrameUpdater:_frameUpdater];
   _displayLink = nil;
   [self removeKeyValueObservers];
 
   [self.player replaceCurrentItemWithPlayerItem:nil];
   [[NSNotificationCenter defaultCenter] removeObserver:self];
+  [self.playerPool recyclePlayer:_player];
+  _player = nil;
 }
 
 - (void)dispose {
@@ -660,7 +1184,23 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 @property(readonly, weak, nonatomic) NSObject<FlutterBinaryMessenger> *messenger;
 @property(readonly, strong, nonatomic) NSObject<FlutterPluginRegistrar> *registrar;
 @property(nonatomic, strong) id<FVPDisplayLinkFactory> displayLinkFactory;
+// The display link that drives the frame updaters of all players.
+@property(nonatomic, strong) FVPSharedDisplayLink *sharedDisplayLink;
 @property(nonatomic, strong) id<FVPAVFactory> avFactory;
+// Hands out the AVPlayers of disposed players before asking avFactory for new ones.
+@property(nonatomic, strong) FVPPlayerPool *playerPool;
+// How the video outputs of players created from now on deliver frames.
+@property(nonatomic, strong) FVPVideoOutputSettings *videoOutputSettings;
+// Items created by `preload:` that no `create:` call has picked up yet, oldest first.
+@property(nonatomic, strong) NSMutableArray<FVPPreloadedItem *> *preloadedItems;
+// Loads media through the disk cache. Created when the cache is first enabled, and kept afterwards,
+// since the assets that use it only hold a weak reference to it.
+@property(nonatomic, strong, nullable) FVPMediaCacheLoader *mediaCacheLoader;
+// Whether players created from now on, and prefetches, use mediaCacheLoader.
+@property(nonatomic, assign) BOOL mediaCacheEnabled;
+// The thumbnail generators whose streams haven't been cancelled yet, by request ID.
+@property(nonatomic, strong)
+    NSMutableDictionary<NSNumber *, FVPThumbnailGenerator *> *thumbnailGeneratorsByRequestId;
 @end
 
 @implementation FVPVideoPlayerPlugin
@@ -690,6 +1230,10 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   _registrar = registrar;
   _displayLinkFactory = displayLinkFactory ?: [[FVPDefaultDisplayLinkFactory alloc] init];
   _avFactory = avFactory ?: [[FVPDefaultAVFactory alloc] init];
+  _playerPool = [[FVPPlayerPool alloc] initWithAVFactory:_avFactory];
+  _preloadedItems = [NSMutableArray array];
+  _thumbnailGeneratorsByRequestId = [NSMutableDictionary dictionary];
+  _videoOutputSettings = [[FVPVideoOutputSettings alloc] init];
   _playersByTextureId = [NSMutableDictionary dictionaryWithCapacity:1];
   return self;
 }
@@ -697,6 +1241,10 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 - (void)detachFromEngineForRegistrar:(NSObject<FlutterPluginRegistrar> *)registrar {
   [self.playersByTextureId.allValues makeObjectsPerformSelector:@selector(disposeSansEventChannel)];
   [self.playersByTextureId removeAllObjects];
+  [self.playerPool removeAllPlayers];
+  [self.preloadedItems removeAllObjects];
+  [self removeAllThumbnailGenerators];
+  [self.mediaCacheLoader invalidate];
   // TODO(57151): This should be commented out when 57151's fix lands on stable.
   // This is the correct behavior we never did it in the past and the engine
   // doesn't currently support it.
@@ -713,6 +1261,7 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
            binaryMessenger:_messenger];
   [eventChannel setStreamHandler:player];
   player.eventChannel = eventChannel;
+  player.playerPool = self.playerPool;
   self.playersByTextureId[@(textureId)] = player;
   FVPTextureMessage *result = [FVPTextureMessage makeWithTextureId:textureId];
   return result;
@@ -730,15 +1279,128 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
         [player dispose];
       }];
   [self.playersByTextureId removeAllObjects];
+  [self.playerPool removeAllPlayers];
+  [self.preloadedItems removeAllObjects];
+  [self removeAllThumbnailGenerators];
+  self.videoOutputSettings = [[FVPVideoOutputSettings alloc] init];
+  self.mediaCacheEnabled = NO;
+}
+
+- (void)preload:(FVPPreloadMessage *)input error:(FlutterError **)error {
+  FVPPreloadedItem *preloadedItem = [self preloadedItemForURI:input.uri
+                                                  httpHeaders:input.httpHeaders];
+  if (preloadedItem) {
+    // Move it to the back, so that it is the last to be dropped.
+    [self.preloadedItems removeObject:preloadedItem];
+  } else {
+    preloadedItem = [[FVPPreloadedItem alloc] init];
+    preloadedItem.uri = input.uri;
+    preloadedItem.httpHeaders = input.httpHeaders;
+    preloadedItem.item = FVPPlayerItemWithURL([NSURL URLWithString:input.uri], input.httpHeaders,
+                                              self.enabledMediaCacheLoader);
+    // Start loading what the player needs before it can become ready to play.
+    NSArray<NSString *> *keys = @[ @"playable", @"duration", @"tracks" ];
+    [preloadedItem.item.asset loadValuesAsynchronouslyForKeys:keys completionHandler:nil];
+  }
+  if (input.preferredForwardBufferDuration) {
+    preloadedItem.item.preferredForwardBufferDuration =
+        input.preferredForwardBufferDuration.doubleValue;
+  }
+  [self.preloadedItems addObject:preloadedItem];
+  if (self.preloadedItems.count > kFVPMaxPreloadedItemCount) {
+    [self.preloadedItems removeObjectAtIndex:0];
+  }
+}
+
+- (void)prefetch:(FVPPrefetchMessage *)input error:(FlutterError **)error {
+  NSURL *url = [NSURL URLWithString:input.uri];
+  FVPMediaCacheLoader *mediaCacheLoader = self.enabledMediaCacheLoader;
+  // Without the cache, there is nowhere to keep the bytes until a player needs them.
+  if (!url || !mediaCacheLoader || ![FVPMediaCacheLoader canCacheURL:url]) {
+    return;
+  }
+  [mediaCacheLoader prefetchURL:url httpHeaders:input.httpHeaders duration:input.duration];
+}
+
+- (void)generateThumbnails:(FVPThumbnailsMessage *)input error:(FlutterError **)error {
+  AVAsset *asset = nil;
+  if (input.textureId) {
+    // Share the player's asset, whose tracks and media are already loaded.
+    asset = self.playersByTextureId[input.textureId].player.currentItem.asset;
+  } else if (input.uri) {
+    NSURL *url = [NSURL URLWithString:input.uri];
+    if (url) {
+      asset = FVPAssetWithURL(url, input.httpHeaders, self.enabledMediaCacheLoader);
+    }
+  }
+  if (!asset) {
+    *error = [FlutterError errorWithCode:@"video_player"
+                                 message:@"No video to generate thumbnails from"
+                                 details:nil];
+    return;
+  }
+
+  CMTime tolerance = input.tolerance ? CMTimeMake(input.tolerance.longLongValue, 1000)
+                                     : kCMTimePositiveInfinity;
+  FVPThumbnailGenerator *generator =
+      [[FVPThumbnailGenerator alloc] initWithAsset:asset
+                                             times:input.times
+                                       maximumSize:CGSizeMake(input.maxWidth, input.maxHeight)
+                                         tolerance:tolerance];
+  NSNumber *requestId = @(input.requestId);
+  FlutterEventChannel *eventChannel = [FlutterEventChannel
+      eventChannelWithName:[NSString stringWithFormat:@"flutter.io/videoPlayer/thumbnails%@",
+                                                      requestId]
+           binaryMessenger:_messenger];
+  [eventChannel setStreamHandler:generator];
+  generator.eventChannel = eventChannel;
+  __weak typeof(self) weakSelf = self;
+  generator.cancellationHandler = ^{
+    // Tear the channel down after the cancel message that called this has been handled.
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [weakSelf removeThumbnailGeneratorForRequestId:requestId];
+    });
+  };
+  self.thumbnailGeneratorsByRequestId[requestId] = generator;
+}
+
+- (void)removeThumbnailGeneratorForRequestId:(NSNumber *)requestId {
+  FVPThumbnailGenerator *generator = self.thumbnailGeneratorsByRequestId[requestId];
+  [self.thumbnailGeneratorsByRequestId removeObjectForKey:requestId];
+  [generator cancel];
+  [generator.eventChannel setStreamHandler:nil];
+}
+
+- (void)removeAllThumbnailGenerators {
+  for (NSNumber *requestId in self.thumbnailGeneratorsByRequestId.allKeys) {
+    [self removeThumbnailGeneratorForRequestId:requestId];
+  }
+}
+
+/// Returns the media cache loader if players should use it, or nil otherwise.
+- (nullable FVPMediaCacheLoader *)enabledMediaCacheLoader {
+  return self.mediaCacheEnabled ? self.mediaCacheLoader : nil;
+}
+
+- (nullable FVPPreloadedItem *)preloadedItemForURI:(NSString *)uri
+                                       httpHeaders:(NSDictionary<NSString *, NSString *> *)headers {
+  for (FVPPreloadedItem *preloadedItem in self.preloadedItems) {
+    if ([preloadedItem.uri isEqualToString:uri] &&
+        [preloadedItem.httpHeaders isEqualToDictionary:headers]) {
+      return preloadedItem;
+    }
+  }
+  return nil;
 }
 
 - (FVPTextureMessage *)create:(FVPCreateMessage *)input error:(FlutterError **)error {
   FVPFrameUpdater *frameUpdater = [[FVPFrameUpdater alloc] initWithRegistry:_registry];
-  FVPDisplayLink *displayLink =
-      [self.displayLinkFactory displayLinkWithRegistrar:_registrar
-                                               callback:^() {
-                                                 [frameUpdater displayLinkFired];
-                                               }];
+  if (!self.sharedDisplayLink) {
+    self.sharedDisplayLink =
+        [[FVPSharedDisplayLink alloc] initWithDisplayLinkFactory:self.displayLinkFactory
+                                                       registrar:_registrar];
+  }
+  FVPSharedDisplayLink *displayLink = self.sharedDisplayLink;
 
   FVPVideoPlayer *player;
   if (input.asset) {
@@ -752,7 +1414,8 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
       player = [[FVPVideoPlayer alloc] initWithAsset:assetPath
                                         frameUpdater:frameUpdater
                                          displayLink:displayLink
-                                           avFactory:_avFactory
+                                           avFactory:self.playerPool
+                                 videoOutputSettings:self.videoOutputSettings
                                            registrar:self.registrar];
       return [self onPlayerSetup:player frameUpdater:frameUpdater];
     } @catch (NSException *exception) {
@@ -760,12 +1423,27 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
       return nil;
     }
   } else if (input.uri) {
-    player = [[FVPVideoPlayer alloc] initWithURL:[NSURL URLWithString:input.uri]
-                                    frameUpdater:frameUpdater
-                                     displayLink:displayLink
-                                     httpHeaders:input.httpHeaders
-                                       avFactory:_avFactory
-                                       registrar:self.registrar];
+    FVPPreloadedItem *preloadedItem = [self preloadedItemForURI:input.uri
+                                                    httpHeaders:input.httpHeaders];
+    if (preloadedItem) {
+      // An item can only be played by one player, so later players of the same URI start over.
+      [self.preloadedItems removeObject:preloadedItem];
+      player = [[FVPVideoPlayer alloc] initWithPlayerItem:preloadedItem.item
+                                             frameUpdater:frameUpdater
+                                              displayLink:displayLink
+                                                avFactory:self.playerPool
+                                      videoOutputSettings:self.videoOutputSettings
+                                                registrar:self.registrar];
+    } else {
+      AVPlayerItem *item = FVPPlayerItemWithURL([NSURL URLWithString:input.uri], input.httpHeaders,
+                                                self.enabledMediaCacheLoader);
+      player = [[FVPVideoPlayer alloc] initWithPlayerItem:item
+                                             frameUpdater:frameUpdater
+                                              displayLink:displayLink
+                                                avFactory:self.playerPool
+                                      videoOutputSettings:self.videoOutputSettings
+                                                registrar:self.registrar];
+    }
     return [self onPlayerSetup:player frameUpdater:frameUpdater];
   } else {
     *error = [FlutterError errorWithCode:@"video_player" message:@"not implemented" details:nil];
@@ -776,24 +1454,13 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 - (void)dispose:(FVPTextureMessage *)input error:(FlutterError **)error {
   NSNumber *playerKey = @(input.textureId);
   FVPVideoPlayer *player = self.playersByTextureId[playerKey];
-  [self.registry unregisterTexture:input.textureId];
   [self.playersByTextureId removeObjectForKey:playerKey];
-  // If the Flutter contains https://github.com/flutter/engine/pull/12695,
-  // the `player` is disposed via `onTextureUnregistered` at the right time.
-  // Without https://github.com/flutter/engine/pull/12695, there is no guarantee that the
-  // texture has completed the un-reregistration. It may leads a crash if we dispose the
-  // `player` before the texture is unregistered. We add a dispatch_after hack to make sure the
-  // texture is unregistered before we dispose the `player`.
-  //
-  // TODO(cyanglaz): Remove this dispatch block when
-  // https://github.com/flutter/flutter/commit/8159a9906095efc9af8b223f5e232cb63542ad0b is in
-  // stable And update the min flutter version of the plugin to the stable version.
-  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(1 * NSEC_PER_SEC)),
-                 dispatch_get_main_queue(), ^{
-                   if (!player.disposed) {
-                     [player dispose];
-                   }
-                 });
+  // Release the player item, and with it the decoder, network connections and video output
+  // buffers, right away rather than once the engine gets around to unregistering the texture.
+  // Until then the engine may still ask for frames, which the detached video output simply
+  // doesn't have. The event channel is torn down in `onTextureUnregistered:`.
+  [player disposeSansEventChannel];
+  [self.registry unregisterTexture:input.textureId];
 }
 
 - (void)setLooping:(FVPLoopingMessage *)input error:(FlutterError **)error {
@@ -811,6 +1478,21 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   [player setPlaybackSpeed:input.speed];
 }
 
+- (void)setPlaybackConstraints:(FVPPlaybackConstraintsMessage *)input
+                         error:(FlutterError **)error {
+  FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
+  if (input.preferredPeakBitRate) {
+    [player setPreferredPeakBitRate:input.preferredPeakBitRate.doubleValue];
+  }
+  if (input.preferredMaximumWidth && input.preferredMaximumHeight) {
+    [player setPreferredMaximumResolution:CGSizeMake(input.preferredMaximumWidth.doubleValue,
+                                                     input.preferredMaximumHeight.doubleValue)];
+  }
+  if (input.preferredForwardBufferDuration) {
+    [player setPreferredForwardBufferDuration:input.preferredForwardBufferDuration.doubleValue];
+  }
+}
+
 - (void)play:(FVPTextureMessage *)input error:(FlutterError **)error {
   FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
   [player play];
@@ -823,6 +1505,18 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
   return result;
 }
 
+- (FVPPlaybackStatsMessage *)playbackStats:(FVPTextureMessage *)input
+                                     error:(FlutterError **)error {
+  FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
+  if (!player) {
+    *error = [FlutterError errorWithCode:@"video_player"
+                                 message:@"No player with the given texture ID"
+                                 details:nil];
+    return nil;
+  }
+  return [player playbackStatsWithTextureId:input.textureId];
+}
+
 - (void)seekTo:(FVPPositionMessage *)input
     completion:(void (^)(FlutterError *_Nullable))completion {
   FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
@@ -834,6 +1528,27 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
       }];
 }
 
+- (void)setSeekMode:(FVPSeekModeMessage *)input error:(FlutterError **)error {
+  FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
+  // Without a tolerance, let AVPlayer pick whichever nearby position, typically a keyframe, it can
+  // reach fastest.
+  player.seekTolerance = input.tolerance
+                             ? CMTimeMakeWithSeconds(input.tolerance.doubleValue, NSEC_PER_SEC)
+                             : kCMTimePositiveInfinity;
+  player.scrubbing = input.scrubbing;
+}
+
+- (void)setBufferingUpdateInterval:(FVPBufferingUpdateIntervalMessage *)input
+                             error:(FlutterError **)error {
+  FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
+  player.bufferingUpdateInterval = MAX(input.interval, 0) / 1000.0;
+}
+
+- (void)setAudioOnly:(FVPAudioOnlyMessage *)input error:(FlutterError **)error {
+  FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
+  player.audioOnly = input.audioOnly;
+}
+
 - (void)pause:(FVPTextureMessage *)input error:(FlutterError **)error {
   FVPVideoPlayer *player = self.playersByTextureId[@(input.textureId)];
   [player pause];
@@ -854,4 +1569,38 @@ NS_INLINE CGFloat radiansToDegrees(CGFloat radians) {
 #endif
 }
 
+- (void)setVideoOutputOptions:(FVPVideoOutputOptionsMessage *)input
+                        error:(FlutterError *_Nullable __autoreleasing *)error {
+  // Players keep the settings they were created with, so replace rather than modify them.
+  FVPVideoOutputSettings *settings = [[FVPVideoOutputSettings alloc] init];
+  if (input.useYuvPixelFormat) {
+    settings.pixelFormatType = kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
+  }
+  if (input.maximumWidth && input.maximumHeight) {
+    settings.maximumSize =
+        CGSizeMake(input.maximumWidth.doubleValue, input.maximumHeight.doubleValue);
+  }
+  settings.audioOnly = input.audioOnly;
+  self.videoOutputSettings = settings;
+}
+
+- (void)setCacheOptions:(FVPCacheOptionsMessage *)input
+                  error:(FlutterError *_Nullable __autoreleasing *)error {
+  int64_t maximumSize =
+      input.maximumSize > 0 ? input.maximumSize : kFVPDefaultMediaCacheMaximumSize;
+  if (input.enabled && !self.mediaCacheLoader) {
+    NSURL *cachesURL = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory
+                                                              inDomains:NSUserDomainMask]
+                           .firstObject;
+    NSURL *directoryURL = [cachesURL URLByAppendingPathComponent:@"video_player_avfoundation"];
+    FVPMediaCache *cache = [[FVPMediaCache alloc] initWithDirectoryURL:directoryURL
+                                                           maximumSize:maximumSize];
+    self.mediaCacheLoader = [[FVPMediaCacheLoader alloc] initWithCache:cache];
+  } else if (input.enabled) {
+    self.mediaCacheLoader.cache.maximumSize = maximumSize;
+  }
+  // Players already created keep loading through the cache.
+  self.mediaCacheEnabled = input.enabled;
+}
+
 @end
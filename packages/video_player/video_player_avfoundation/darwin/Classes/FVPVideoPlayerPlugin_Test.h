@@ -35,6 +35,12 @@
 // for issue #1, and restore the correct width and height for issue #2.
 @property(readonly, nonatomic) AVPlayerLayer *playerLayer;
 @property(readonly, nonatomic) int64_t position;
+// Whether only audio is played. While set, the player has no video output and doesn't drive the
+// display link.
+@property(nonatomic) BOOL audioOnly;
+// The minimum time between buffering updates, in seconds. Updates that would come sooner are
+// coalesced into one sent when the interval ends. Defaults to 0.25.
+@property(nonatomic) NSTimeInterval bufferingUpdateInterval;
 
 - (void)onTextureUnregistered:(NSObject<FlutterTexture> *)texture;
 @end
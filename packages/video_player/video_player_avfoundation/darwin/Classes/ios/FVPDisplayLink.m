@@ -69,4 +69,21 @@
   self.displayLink.paused = !running;
 }
 
+- (void)setPreferredFramesPerSecond:(double)preferredFramesPerSecond {
+  _preferredFramesPerSecond = preferredFramesPerSecond;
+  if (@available(iOS 15.0, *)) {
+    if (preferredFramesPerSecond <= 0) {
+      self.displayLink.preferredFrameRateRange = CAFrameRateRangeDefault;
+      return;
+    }
+    // Allow any faster rate, so that the system can pick one the display supports without ever
+    // going below the requested one.
+    float minimum = (float)preferredFramesPerSecond;
+    float maximum = MAX(minimum, (float)self.displayLink.maximumFramesPerSecond);
+    self.displayLink.preferredFrameRateRange = CAFrameRateRangeMake(minimum, maximum, minimum);
+  } else {
+    self.displayLink.preferredFramesPerSecond = (NSInteger)ceil(preferredFramesPerSecond);
+  }
+}
+
 @end
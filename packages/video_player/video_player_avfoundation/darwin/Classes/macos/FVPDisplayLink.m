@@ -7,21 +7,78 @@
 #import <CoreVideo/CoreVideo.h>
 #import <Foundation/Foundation.h>
 
+/**
+ * Receives the CVDisplayLink callbacks on the display link thread, and forwards the ones that fall
+ * on the preferred cadence to a main-thread dispatch source.
+ *
+ * CVDisplayLink always fires on every refresh of its display, so skipping callbacks here is what
+ * keeps the main thread from waking up more often than the preferred rate.
+ */
+@interface FVPDisplayLinkCadence : NSObject
+/** The dispatch source that drives the callback on the main thread. */
+@property(nonatomic, readonly) dispatch_source_t source;
+/** The rate to forward callbacks at, or 0 to forward all of them. */
+@property(atomic, assign) double preferredFramesPerSecond;
+
+- (instancetype)initWithSource:(dispatch_source_t)source;
+
+/** Forwards the callback for the given output time if it falls on the cadence. */
+- (void)displayLinkFiredWithOutputTime:(const CVTimeStamp *)outputTime;
+@end
+
+@implementation FVPDisplayLinkCadence {
+  // The display time, in seconds, from which the next callback is forwarded. Only accessed on the
+  // display link thread.
+  double _nextForwardTime;
+}
+
+- (instancetype)initWithSource:(dispatch_source_t)source {
+  self = [super init];
+  if (self) {
+    _source = source;
+  }
+  return self;
+}
+
+- (void)displayLinkFiredWithOutputTime:(const CVTimeStamp *)outputTime {
+  double preferredFramesPerSecond = self.preferredFramesPerSecond;
+  if (preferredFramesPerSecond > 0 && outputTime->videoTimeScale > 0) {
+    double time = (double)outputTime->videoTime / outputTime->videoTimeScale;
+    double refreshPeriod = (double)outputTime->videoRefreshPeriod / outputTime->videoTimeScale;
+    double interval = 1.0 / preferredFramesPerSecond;
+    // Refreshes don't land exactly on the cadence, so forward the one closest to it rather than
+    // the first one after it, which would lower the rate.
+    if (time + refreshPeriod / 2 < _nextForwardTime) {
+      return;
+    }
+    // Keep the cadence steady, unless callbacks were missed or the rate changed, in which case
+    // restart it from now.
+    _nextForwardTime = time - _nextForwardTime < interval ? _nextForwardTime + interval
+                                                           : time + interval;
+  }
+  // Trigger the main-thread dispatch queue, to drive the callback there.
+  dispatch_source_merge_data(self.source, 1);
+}
+@end
+
+#pragma mark -
+
 @interface FVPDisplayLink ()
 // The underlying display link implementation.
 @property(nonatomic, assign) CVDisplayLinkRef displayLink;
 // A dispatch source to move display link callbacks to the main thread.
 @property(nonatomic, strong) dispatch_source_t displayLinkSource;
+// Skips display link callbacks to match preferredFramesPerSecond. Passed as the context of the
+// display link callback, so it must outlive the display link.
+@property(nonatomic, strong) FVPDisplayLinkCadence *cadence;
 // The plugin registrar, to get screen information.
 @property(nonatomic, weak) NSObject<FlutterPluginRegistrar> *registrar;
 @end
 
 static CVReturn DisplayLinkCallback(CVDisplayLinkRef displayLink, const CVTimeStamp *now,
                                     const CVTimeStamp *outputTime, CVOptionFlags flagsIn,
-                                    CVOptionFlags *flagsOut, void *displayLinkSource) {
-  // Trigger the main-thread dispatch queue, to drive the callback there.
-  __weak dispatch_source_t source = (__bridge dispatch_source_t)displayLinkSource;
-  dispatch_source_merge_data(source, 1);
+                                    CVOptionFlags *flagsOut, void *cadence) {
+  [(__bridge FVPDisplayLinkCadence *)cadence displayLinkFiredWithOutputTime:outputTime];
   return kCVReturnSuccess;
 }
 
@@ -41,9 +98,10 @@ static CVReturn DisplayLinkCallback(CVDisplayLinkRef displayLink, const CVTimeSt
       }
     });
     dispatch_resume(_displayLinkSource);
+    _cadence = [[FVPDisplayLinkCadence alloc] initWithSource:_displayLinkSource];
     if (CVDisplayLinkCreateWithActiveCGDisplays(&_displayLink) == kCVReturnSuccess) {
       CVDisplayLinkSetOutputCallback(_displayLink, &DisplayLinkCallback,
-                                     (__bridge void *)(_displayLinkSource));
+                                     (__bridge void *)(_cadence));
     }
   }
   return self;
@@ -81,4 +139,9 @@ static CVReturn DisplayLinkCallback(CVDisplayLinkRef displayLink, const CVTimeSt
   }
 }
 
+- (void)setPreferredFramesPerSecond:(double)preferredFramesPerSecond {
+  _preferredFramesPerSecond = preferredFramesPerSecond;
+  self.cadence.preferredFramesPerSecond = preferredFramesPerSecond;
+}
+
 @end
@@ -17,8 +17,18 @@ NS_ASSUME_NONNULL_BEGIN
 @class FVPLoopingMessage;
 @class FVPVolumeMessage;
 @class FVPPlaybackSpeedMessage;
+@class FVPPlaybackConstraintsMessage;
+@class FVPPlaybackStatsMessage;
 @class FVPPositionMessage;
+@class FVPSeekModeMessage;
+@class FVPAudioOnlyMessage;
+@class FVPBufferingUpdateIntervalMessage;
 @class FVPCreateMessage;
+@class FVPPreloadMessage;
+@class FVPPrefetchMessage;
+@class FVPThumbnailsMessage;
+@class FVPVideoOutputOptionsMessage;
+@class FVPCacheOptionsMessage;
 @class FVPMixWithOthersMessage;
 
 @interface FVPTextureMessage : NSObject
@@ -52,6 +62,44 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic, assign) double speed;
 @end
 
+@interface FVPPlaybackConstraintsMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithTextureId:(NSInteger)textureId
+              preferredPeakBitRate:(nullable NSNumber *)preferredPeakBitRate
+             preferredMaximumWidth:(nullable NSNumber *)preferredMaximumWidth
+            preferredMaximumHeight:(nullable NSNumber *)preferredMaximumHeight
+    preferredForwardBufferDuration:(nullable NSNumber *)preferredForwardBufferDuration;
+@property(nonatomic, assign) NSInteger textureId;
+@property(nonatomic, strong, nullable) NSNumber *preferredPeakBitRate;
+@property(nonatomic, strong, nullable) NSNumber *preferredMaximumWidth;
+@property(nonatomic, strong, nullable) NSNumber *preferredMaximumHeight;
+@property(nonatomic, strong, nullable) NSNumber *preferredForwardBufferDuration;
+@end
+
+@interface FVPPlaybackStatsMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithTextureId:(NSInteger)textureId
+                 indicatedBitrate:(nullable NSNumber *)indicatedBitrate
+                  observedBitrate:(nullable NSNumber *)observedBitrate
+                      startupTime:(nullable NSNumber *)startupTime
+                       stallCount:(NSInteger)stallCount
+           droppedVideoFrameCount:(NSInteger)droppedVideoFrameCount
+                       errorCount:(NSInteger)errorCount
+         idleDisplayLinkFireCount:(NSInteger)idleDisplayLinkFireCount
+             nullPixelBufferCount:(NSInteger)nullPixelBufferCount;
+@property(nonatomic, assign) NSInteger textureId;
+@property(nonatomic, strong, nullable) NSNumber *indicatedBitrate;
+@property(nonatomic, strong, nullable) NSNumber *observedBitrate;
+@property(nonatomic, strong, nullable) NSNumber *startupTime;
+@property(nonatomic, assign) NSInteger stallCount;
+@property(nonatomic, assign) NSInteger droppedVideoFrameCount;
+@property(nonatomic, assign) NSInteger errorCount;
+@property(nonatomic, assign) NSInteger idleDisplayLinkFireCount;
+@property(nonatomic, assign) NSInteger nullPixelBufferCount;
+@end
+
 @interface FVPPositionMessage : NSObject
 /// `init` unavailable to enforce nonnull fields, see the `make` class method.
 - (instancetype)init NS_UNAVAILABLE;
@@ -60,6 +108,33 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic, assign) NSInteger position;
 @end
 
+@interface FVPSeekModeMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithTextureId:(NSInteger)textureId
+                        tolerance:(nullable NSNumber *)tolerance
+                        scrubbing:(BOOL)scrubbing;
+@property(nonatomic, assign) NSInteger textureId;
+@property(nonatomic, strong, nullable) NSNumber *tolerance;
+@property(nonatomic, assign) BOOL scrubbing;
+@end
+
+@interface FVPAudioOnlyMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithTextureId:(NSInteger)textureId audioOnly:(BOOL)audioOnly;
+@property(nonatomic, assign) NSInteger textureId;
+@property(nonatomic, assign) BOOL audioOnly;
+@end
+
+@interface FVPBufferingUpdateIntervalMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithTextureId:(NSInteger)textureId interval:(NSInteger)interval;
+@property(nonatomic, assign) NSInteger textureId;
+@property(nonatomic, assign) NSInteger interval;
+@end
+
 @interface FVPCreateMessage : NSObject
 /// `init` unavailable to enforce nonnull fields, see the `make` class method.
 - (instancetype)init NS_UNAVAILABLE;
@@ -75,6 +150,70 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic, copy) NSDictionary<NSString *, NSString *> *httpHeaders;
 @end
 
+@interface FVPPreloadMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithUri:(NSString *)uri
+                       httpHeaders:(NSDictionary<NSString *, NSString *> *)httpHeaders
+    preferredForwardBufferDuration:(nullable NSNumber *)preferredForwardBufferDuration;
+@property(nonatomic, copy) NSString *uri;
+@property(nonatomic, copy) NSDictionary<NSString *, NSString *> *httpHeaders;
+@property(nonatomic, strong, nullable) NSNumber *preferredForwardBufferDuration;
+@end
+
+@interface FVPPrefetchMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithUri:(NSString *)uri
+                httpHeaders:(NSDictionary<NSString *, NSString *> *)httpHeaders
+                   duration:(double)duration;
+@property(nonatomic, copy) NSString *uri;
+@property(nonatomic, copy) NSDictionary<NSString *, NSString *> *httpHeaders;
+@property(nonatomic, assign) double duration;
+@end
+
+@interface FVPThumbnailsMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithRequestId:(NSInteger)requestId
+                        textureId:(nullable NSNumber *)textureId
+                              uri:(nullable NSString *)uri
+                      httpHeaders:(NSDictionary<NSString *, NSString *> *)httpHeaders
+                            times:(NSArray<NSNumber *> *)times
+                         maxWidth:(double)maxWidth
+                        maxHeight:(double)maxHeight
+                        tolerance:(nullable NSNumber *)tolerance;
+@property(nonatomic, assign) NSInteger requestId;
+@property(nonatomic, strong, nullable) NSNumber *textureId;
+@property(nonatomic, copy, nullable) NSString *uri;
+@property(nonatomic, copy) NSDictionary<NSString *, NSString *> *httpHeaders;
+@property(nonatomic, copy) NSArray<NSNumber *> *times;
+@property(nonatomic, assign) double maxWidth;
+@property(nonatomic, assign) double maxHeight;
+@property(nonatomic, strong, nullable) NSNumber *tolerance;
+@end
+
+@interface FVPVideoOutputOptionsMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithUseYuvPixelFormat:(BOOL)useYuvPixelFormat
+                             maximumWidth:(nullable NSNumber *)maximumWidth
+                            maximumHeight:(nullable NSNumber *)maximumHeight
+                                audioOnly:(BOOL)audioOnly;
+@property(nonatomic, assign) BOOL useYuvPixelFormat;
+@property(nonatomic, strong, nullable) NSNumber *maximumWidth;
+@property(nonatomic, strong, nullable) NSNumber *maximumHeight;
+@property(nonatomic, assign) BOOL audioOnly;
+@end
+
+@interface FVPCacheOptionsMessage : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithEnabled:(BOOL)enabled maximumSize:(NSInteger)maximumSize;
+@property(nonatomic, assign) BOOL enabled;
+@property(nonatomic, assign) NSInteger maximumSize;
+@end
+
 @interface FVPMixWithOthersMessage : NSObject
 /// `init` unavailable to enforce nonnull fields, see the `make` class method.
 - (instancetype)init NS_UNAVAILABLE;
@@ -90,19 +229,36 @@ NSObject<FlutterMessageCodec> *FVPAVFoundationVideoPlayerApiGetCodec(void);
 /// @return `nil` only when `error != nil`.
 - (nullable FVPTextureMessage *)create:(FVPCreateMessage *)msg
                                  error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)preload:(FVPPreloadMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)prefetch:(FVPPrefetchMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)generateThumbnails:(FVPThumbnailsMessage *)msg
+                     error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)dispose:(FVPTextureMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)setLooping:(FVPLoopingMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)setVolume:(FVPVolumeMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)setPlaybackSpeed:(FVPPlaybackSpeedMessage *)msg
                    error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setPlaybackConstraints:(FVPPlaybackConstraintsMessage *)msg
+                         error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)play:(FVPTextureMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
 /// @return `nil` only when `error != nil`.
 - (nullable FVPPositionMessage *)position:(FVPTextureMessage *)msg
                                     error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable FVPPlaybackStatsMessage *)playbackStats:(FVPTextureMessage *)msg
+                                              error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)seekTo:(FVPPositionMessage *)msg completion:(void (^)(FlutterError *_Nullable))completion;
+- (void)setSeekMode:(FVPSeekModeMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setAudioOnly:(FVPAudioOnlyMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setBufferingUpdateInterval:(FVPBufferingUpdateIntervalMessage *)msg
+                             error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)pause:(FVPTextureMessage *)msg error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)setMixWithOthers:(FVPMixWithOthersMessage *)msg
                    error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setVideoOutputOptions:(FVPVideoOutputOptionsMessage *)msg
+                        error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setCacheOptions:(FVPCacheOptionsMessage *)msg
+                  error:(FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void SetUpFVPAVFoundationVideoPlayerApi(
@@ -53,18 +53,78 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (NSArray *)toList;
 @end
 
+@interface FVPPlaybackConstraintsMessage ()
++ (FVPPlaybackConstraintsMessage *)fromList:(NSArray *)list;
++ (nullable FVPPlaybackConstraintsMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface FVPPlaybackStatsMessage ()
++ (FVPPlaybackStatsMessage *)fromList:(NSArray *)list;
++ (nullable FVPPlaybackStatsMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
 @interface FVPPositionMessage ()
 + (FVPPositionMessage *)fromList:(NSArray *)list;
 + (nullable FVPPositionMessage *)nullableFromList:(NSArray *)list;
 - (NSArray *)toList;
 @end
 
+@interface FVPSeekModeMessage ()
++ (FVPSeekModeMessage *)fromList:(NSArray *)list;
++ (nullable FVPSeekModeMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface FVPAudioOnlyMessage ()
++ (FVPAudioOnlyMessage *)fromList:(NSArray *)list;
++ (nullable FVPAudioOnlyMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface FVPBufferingUpdateIntervalMessage ()
++ (FVPBufferingUpdateIntervalMessage *)fromList:(NSArray *)list;
++ (nullable FVPBufferingUpdateIntervalMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
 @interface FVPCreateMessage ()
 + (FVPCreateMessage *)fromList:(NSArray *)list;
 + (nullable FVPCreateMessage *)nullableFromList:(NSArray *)list;
 - (NSArray *)toList;
 @end
 
+@interface FVPPreloadMessage ()
++ (FVPPreloadMessage *)fromList:(NSArray *)list;
++ (nullable FVPPreloadMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface FVPPrefetchMessage ()
++ (FVPPrefetchMessage *)fromList:(NSArray *)list;
++ (nullable FVPPrefetchMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface FVPThumbnailsMessage ()
++ (FVPThumbnailsMessage *)fromList:(NSArray *)list;
++ (nullable FVPThumbnailsMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface FVPVideoOutputOptionsMessage ()
++ (FVPVideoOutputOptionsMessage *)fromList:(NSArray *)list;
++ (nullable FVPVideoOutputOptionsMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
+@interface FVPCacheOptionsMessage ()
++ (FVPCacheOptionsMessage *)fromList:(NSArray *)list;
++ (nullable FVPCacheOptionsMessage *)nullableFromList:(NSArray *)list;
+- (NSArray *)toList;
+@end
+
 @interface FVPMixWithOthersMessage ()
 + (FVPMixWithOthersMessage *)fromList:(NSArray *)list;
 + (nullable FVPMixWithOthersMessage *)nullableFromList:(NSArray *)list;
@@ -164,6 +224,96 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 }
 @end
 
+@implementation FVPPlaybackConstraintsMessage
++ (instancetype)makeWithTextureId:(NSInteger)textureId
+              preferredPeakBitRate:(nullable NSNumber *)preferredPeakBitRate
+             preferredMaximumWidth:(nullable NSNumber *)preferredMaximumWidth
+            preferredMaximumHeight:(nullable NSNumber *)preferredMaximumHeight
+    preferredForwardBufferDuration:(nullable NSNumber *)preferredForwardBufferDuration {
+  FVPPlaybackConstraintsMessage *pigeonResult = [[FVPPlaybackConstraintsMessage alloc] init];
+  pigeonResult.textureId = textureId;
+  pigeonResult.preferredPeakBitRate = preferredPeakBitRate;
+  pigeonResult.preferredMaximumWidth = preferredMaximumWidth;
+  pigeonResult.preferredMaximumHeight = preferredMaximumHeight;
+  pigeonResult.preferredForwardBufferDuration = preferredForwardBufferDuration;
+  return pigeonResult;
+}
++ (FVPPlaybackConstraintsMessage *)fromList:(NSArray *)list {
+  FVPPlaybackConstraintsMessage *pigeonResult = [[FVPPlaybackConstraintsMessage alloc] init];
+  pigeonResult.textureId = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.preferredPeakBitRate = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.preferredMaximumWidth = GetNullableObjectAtIndex(list, 2);
+  pigeonResult.preferredMaximumHeight = GetNullableObjectAtIndex(list, 3);
+  pigeonResult.preferredForwardBufferDuration = GetNullableObjectAtIndex(list, 4);
+  return pigeonResult;
+}
++ (nullable FVPPlaybackConstraintsMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPPlaybackConstraintsMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.textureId),
+    self.preferredPeakBitRate ?: [NSNull null],
+    self.preferredMaximumWidth ?: [NSNull null],
+    self.preferredMaximumHeight ?: [NSNull null],
+    self.preferredForwardBufferDuration ?: [NSNull null],
+  ];
+}
+@end
+
+@implementation FVPPlaybackStatsMessage
++ (instancetype)makeWithTextureId:(NSInteger)textureId
+                 indicatedBitrate:(nullable NSNumber *)indicatedBitrate
+                  observedBitrate:(nullable NSNumber *)observedBitrate
+                      startupTime:(nullable NSNumber *)startupTime
+                       stallCount:(NSInteger)stallCount
+           droppedVideoFrameCount:(NSInteger)droppedVideoFrameCount
+                       errorCount:(NSInteger)errorCount
+         idleDisplayLinkFireCount:(NSInteger)idleDisplayLinkFireCount
+             nullPixelBufferCount:(NSInteger)nullPixelBufferCount {
+  FVPPlaybackStatsMessage *pigeonResult = [[FVPPlaybackStatsMessage alloc] init];
+  pigeonResult.textureId = textureId;
+  pigeonResult.indicatedBitrate = indicatedBitrate;
+  pigeonResult.observedBitrate = observedBitrate;
+  pigeonResult.startupTime = startupTime;
+  pigeonResult.stallCount = stallCount;
+  pigeonResult.droppedVideoFrameCount = droppedVideoFrameCount;
+  pigeonResult.errorCount = errorCount;
+  pigeonResult.idleDisplayLinkFireCount = idleDisplayLinkFireCount;
+  pigeonResult.nullPixelBufferCount = nullPixelBufferCount;
+  return pigeonResult;
+}
++ (FVPPlaybackStatsMessage *)fromList:(NSArray *)list {
+  FVPPlaybackStatsMessage *pigeonResult = [[FVPPlaybackStatsMessage alloc] init];
+  pigeonResult.textureId = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.indicatedBitrate = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.observedBitrate = GetNullableObjectAtIndex(list, 2);
+  pigeonResult.startupTime = GetNullableObjectAtIndex(list, 3);
+  pigeonResult.stallCount = [GetNullableObjectAtIndex(list, 4) integerValue];
+  pigeonResult.droppedVideoFrameCount = [GetNullableObjectAtIndex(list, 5) integerValue];
+  pigeonResult.errorCount = [GetNullableObjectAtIndex(list, 6) integerValue];
+  pigeonResult.idleDisplayLinkFireCount = [GetNullableObjectAtIndex(list, 7) integerValue];
+  pigeonResult.nullPixelBufferCount = [GetNullableObjectAtIndex(list, 8) integerValue];
+  return pigeonResult;
+}
++ (nullable FVPPlaybackStatsMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPPlaybackStatsMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.textureId),
+    self.indicatedBitrate ?: [NSNull null],
+    self.observedBitrate ?: [NSNull null],
+    self.startupTime ?: [NSNull null],
+    @(self.stallCount),
+    @(self.droppedVideoFrameCount),
+    @(self.errorCount),
+    @(self.idleDisplayLinkFireCount),
+    @(self.nullPixelBufferCount),
+  ];
+}
+@end
+
 @implementation FVPPositionMessage
 + (instancetype)makeWithTextureId:(NSInteger)textureId position:(NSInteger)position {
   FVPPositionMessage *pigeonResult = [[FVPPositionMessage alloc] init];
@@ -188,6 +338,85 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 }
 @end
 
+@implementation FVPSeekModeMessage
++ (instancetype)makeWithTextureId:(NSInteger)textureId
+                        tolerance:(nullable NSNumber *)tolerance
+                        scrubbing:(BOOL)scrubbing {
+  FVPSeekModeMessage *pigeonResult = [[FVPSeekModeMessage alloc] init];
+  pigeonResult.textureId = textureId;
+  pigeonResult.tolerance = tolerance;
+  pigeonResult.scrubbing = scrubbing;
+  return pigeonResult;
+}
++ (FVPSeekModeMessage *)fromList:(NSArray *)list {
+  FVPSeekModeMessage *pigeonResult = [[FVPSeekModeMessage alloc] init];
+  pigeonResult.textureId = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.tolerance = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.scrubbing = [GetNullableObjectAtIndex(list, 2) boolValue];
+  return pigeonResult;
+}
++ (nullable FVPSeekModeMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPSeekModeMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.textureId),
+    self.tolerance ?: [NSNull null],
+    @(self.scrubbing),
+  ];
+}
+@end
+
+@implementation FVPAudioOnlyMessage
++ (instancetype)makeWithTextureId:(NSInteger)textureId audioOnly:(BOOL)audioOnly {
+  FVPAudioOnlyMessage *pigeonResult = [[FVPAudioOnlyMessage alloc] init];
+  pigeonResult.textureId = textureId;
+  pigeonResult.audioOnly = audioOnly;
+  return pigeonResult;
+}
++ (FVPAudioOnlyMessage *)fromList:(NSArray *)list {
+  FVPAudioOnlyMessage *pigeonResult = [[FVPAudioOnlyMessage alloc] init];
+  pigeonResult.textureId = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.audioOnly = [GetNullableObjectAtIndex(list, 1) boolValue];
+  return pigeonResult;
+}
++ (nullable FVPAudioOnlyMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPAudioOnlyMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.textureId),
+    @(self.audioOnly),
+  ];
+}
+@end
+
+@implementation FVPBufferingUpdateIntervalMessage
++ (instancetype)makeWithTextureId:(NSInteger)textureId interval:(NSInteger)interval {
+  FVPBufferingUpdateIntervalMessage *pigeonResult =
+      [[FVPBufferingUpdateIntervalMessage alloc] init];
+  pigeonResult.textureId = textureId;
+  pigeonResult.interval = interval;
+  return pigeonResult;
+}
++ (FVPBufferingUpdateIntervalMessage *)fromList:(NSArray *)list {
+  FVPBufferingUpdateIntervalMessage *pigeonResult =
+      [[FVPBufferingUpdateIntervalMessage alloc] init];
+  pigeonResult.textureId = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.interval = [GetNullableObjectAtIndex(list, 1) integerValue];
+  return pigeonResult;
+}
++ (nullable FVPBufferingUpdateIntervalMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPBufferingUpdateIntervalMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.textureId),
+    @(self.interval),
+  ];
+}
+@end
+
 @implementation FVPCreateMessage
 + (instancetype)makeWithAsset:(nullable NSString *)asset
                           uri:(nullable NSString *)uri
@@ -225,6 +454,170 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 }
 @end
 
+@implementation FVPPreloadMessage
++ (instancetype)makeWithUri:(NSString *)uri
+                       httpHeaders:(NSDictionary<NSString *, NSString *> *)httpHeaders
+    preferredForwardBufferDuration:(nullable NSNumber *)preferredForwardBufferDuration {
+  FVPPreloadMessage *pigeonResult = [[FVPPreloadMessage alloc] init];
+  pigeonResult.uri = uri;
+  pigeonResult.httpHeaders = httpHeaders;
+  pigeonResult.preferredForwardBufferDuration = preferredForwardBufferDuration;
+  return pigeonResult;
+}
++ (FVPPreloadMessage *)fromList:(NSArray *)list {
+  FVPPreloadMessage *pigeonResult = [[FVPPreloadMessage alloc] init];
+  pigeonResult.uri = GetNullableObjectAtIndex(list, 0);
+  pigeonResult.httpHeaders = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.preferredForwardBufferDuration = GetNullableObjectAtIndex(list, 2);
+  return pigeonResult;
+}
++ (nullable FVPPreloadMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPPreloadMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    self.uri ?: [NSNull null],
+    self.httpHeaders ?: [NSNull null],
+    self.preferredForwardBufferDuration ?: [NSNull null],
+  ];
+}
+@end
+
+@implementation FVPPrefetchMessage
++ (instancetype)makeWithUri:(NSString *)uri
+                httpHeaders:(NSDictionary<NSString *, NSString *> *)httpHeaders
+                   duration:(double)duration {
+  FVPPrefetchMessage *pigeonResult = [[FVPPrefetchMessage alloc] init];
+  pigeonResult.uri = uri;
+  pigeonResult.httpHeaders = httpHeaders;
+  pigeonResult.duration = duration;
+  return pigeonResult;
+}
++ (FVPPrefetchMessage *)fromList:(NSArray *)list {
+  FVPPrefetchMessage *pigeonResult = [[FVPPrefetchMessage alloc] init];
+  pigeonResult.uri = GetNullableObjectAtIndex(list, 0);
+  pigeonResult.httpHeaders = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.duration = [GetNullableObjectAtIndex(list, 2) doubleValue];
+  return pigeonResult;
+}
++ (nullable FVPPrefetchMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPPrefetchMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    self.uri ?: [NSNull null],
+    self.httpHeaders ?: [NSNull null],
+    @(self.duration),
+  ];
+}
+@end
+
+@implementation FVPThumbnailsMessage
++ (instancetype)makeWithRequestId:(NSInteger)requestId
+                        textureId:(nullable NSNumber *)textureId
+                              uri:(nullable NSString *)uri
+                      httpHeaders:(NSDictionary<NSString *, NSString *> *)httpHeaders
+                            times:(NSArray<NSNumber *> *)times
+                         maxWidth:(double)maxWidth
+                        maxHeight:(double)maxHeight
+                        tolerance:(nullable NSNumber *)tolerance {
+  FVPThumbnailsMessage *pigeonResult = [[FVPThumbnailsMessage alloc] init];
+  pigeonResult.requestId = requestId;
+  pigeonResult.textureId = textureId;
+  pigeonResult.uri = uri;
+  pigeonResult.httpHeaders = httpHeaders;
+  pigeonResult.times = times;
+  pigeonResult.maxWidth = maxWidth;
+  pigeonResult.maxHeight = maxHeight;
+  pigeonResult.tolerance = tolerance;
+  return pigeonResult;
+}
++ (FVPThumbnailsMessage *)fromList:(NSArray *)list {
+  FVPThumbnailsMessage *pigeonResult = [[FVPThumbnailsMessage alloc] init];
+  pigeonResult.requestId = [GetNullableObjectAtIndex(list, 0) integerValue];
+  pigeonResult.textureId = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.uri = GetNullableObjectAtIndex(list, 2);
+  pigeonResult.httpHeaders = GetNullableObjectAtIndex(list, 3);
+  pigeonResult.times = GetNullableObjectAtIndex(list, 4);
+  pigeonResult.maxWidth = [GetNullableObjectAtIndex(list, 5) doubleValue];
+  pigeonResult.maxHeight = [GetNullableObjectAtIndex(list, 6) doubleValue];
+  pigeonResult.tolerance = GetNullableObjectAtIndex(list, 7);
+  return pigeonResult;
+}
++ (nullable FVPThumbnailsMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPThumbnailsMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.requestId),
+    self.textureId ?: [NSNull null],
+    self.uri ?: [NSNull null],
+    self.httpHeaders ?: [NSNull null],
+    self.times ?: [NSNull null],
+    @(self.maxWidth),
+    @(self.maxHeight),
+    self.tolerance ?: [NSNull null],
+  ];
+}
+@end
+
+@implementation FVPVideoOutputOptionsMessage
++ (instancetype)makeWithUseYuvPixelFormat:(BOOL)useYuvPixelFormat
+                             maximumWidth:(nullable NSNumber *)maximumWidth
+                            maximumHeight:(nullable NSNumber *)maximumHeight
+                                audioOnly:(BOOL)audioOnly {
+  FVPVideoOutputOptionsMessage *pigeonResult = [[FVPVideoOutputOptionsMessage alloc] init];
+  pigeonResult.useYuvPixelFormat = useYuvPixelFormat;
+  pigeonResult.maximumWidth = maximumWidth;
+  pigeonResult.maximumHeight = maximumHeight;
+  pigeonResult.audioOnly = audioOnly;
+  return pigeonResult;
+}
++ (FVPVideoOutputOptionsMessage *)fromList:(NSArray *)list {
+  FVPVideoOutputOptionsMessage *pigeonResult = [[FVPVideoOutputOptionsMessage alloc] init];
+  pigeonResult.useYuvPixelFormat = [GetNullableObjectAtIndex(list, 0) boolValue];
+  pigeonResult.maximumWidth = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.maximumHeight = GetNullableObjectAtIndex(list, 2);
+  pigeonResult.audioOnly = [GetNullableObjectAtIndex(list, 3) boolValue];
+  return pigeonResult;
+}
++ (nullable FVPVideoOutputOptionsMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPVideoOutputOptionsMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.useYuvPixelFormat),
+    self.maximumWidth ?: [NSNull null],
+    self.maximumHeight ?: [NSNull null],
+    @(self.audioOnly),
+  ];
+}
+@end
+
+@implementation FVPCacheOptionsMessage
++ (instancetype)makeWithEnabled:(BOOL)enabled maximumSize:(NSInteger)maximumSize {
+  FVPCacheOptionsMessage *pigeonResult = [[FVPCacheOptionsMessage alloc] init];
+  pigeonResult.enabled = enabled;
+  pigeonResult.maximumSize = maximumSize;
+  return pigeonResult;
+}
++ (FVPCacheOptionsMessage *)fromList:(NSArray *)list {
+  FVPCacheOptionsMessage *pigeonResult = [[FVPCacheOptionsMessage alloc] init];
+  pigeonResult.enabled = [GetNullableObjectAtIndex(list, 0) boolValue];
+  pigeonResult.maximumSize = [GetNullableObjectAtIndex(list, 1) integerValue];
+  return pigeonResult;
+}
++ (nullable FVPCacheOptionsMessage *)nullableFromList:(NSArray *)list {
+  return (list) ? [FVPCacheOptionsMessage fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    @(self.enabled),
+    @(self.maximumSize),
+  ];
+}
+@end
+
 @implementation FVPMixWithOthersMessage
 + (instancetype)makeWithMixWithOthers:(BOOL)mixWithOthers {
   FVPMixWithOthersMessage *pigeonResult = [[FVPMixWithOthersMessage alloc] init];
@@ -252,18 +645,38 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 - (nullable id)readValueOfType:(UInt8)type {
   switch (type) {
     case 128:
-      return [FVPCreateMessage fromList:[self readValue]];
+      return [FVPAudioOnlyMessage fromList:[self readValue]];
     case 129:
-      return [FVPLoopingMessage fromList:[self readValue]];
+      return [FVPBufferingUpdateIntervalMessage fromList:[self readValue]];
     case 130:
-      return [FVPMixWithOthersMessage fromList:[self readValue]];
+      return [FVPCacheOptionsMessage fromList:[self readValue]];
     case 131:
-      return [FVPPlaybackSpeedMessage fromList:[self readValue]];
+      return [FVPCreateMessage fromList:[self readValue]];
     case 132:
-      return [FVPPositionMessage fromList:[self readValue]];
+      return [FVPLoopingMessage fromList:[self readValue]];
     case 133:
-      return [FVPTextureMessage fromList:[self readValue]];
+      return [FVPMixWithOthersMessage fromList:[self readValue]];
     case 134:
+      return [FVPPlaybackConstraintsMessage fromList:[self readValue]];
+    case 135:
+      return [FVPPlaybackSpeedMessage fromList:[self readValue]];
+    case 136:
+      return [FVPPlaybackStatsMessage fromList:[self readValue]];
+    case 137:
+      return [FVPPositionMessage fromList:[self readValue]];
+    case 138:
+      return [FVPPrefetchMessage fromList:[self readValue]];
+    case 139:
+      return [FVPPreloadMessage fromList:[self readValue]];
+    case 140:
+      return [FVPSeekModeMessage fromList:[self readValue]];
+    case 141:
+      return [FVPTextureMessage fromList:[self readValue]];
+    case 142:
+      return [FVPThumbnailsMessage fromList:[self readValue]];
+    case 143:
+      return [FVPVideoOutputOptionsMessage fromList:[self readValue]];
+    case 144:
       return [FVPVolumeMessage fromList:[self readValue]];
     default:
       return [super readValueOfType:type];
@@ -275,27 +688,57 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 @end
 @implementation FVPAVFoundationVideoPlayerApiCodecWriter
 - (void)writeValue:(id)value {
-  if ([value isKindOfClass:[FVPCreateMessage class]]) {
+  if ([value isKindOfClass:[FVPAudioOnlyMessage class]]) {
     [self writeByte:128];
     [self writeValue:[value toList]];
-  } else if ([value isKindOfClass:[FVPLoopingMessage class]]) {
+  } else if ([value isKindOfClass:[FVPBufferingUpdateIntervalMessage class]]) {
     [self writeByte:129];
     [self writeValue:[value toList]];
-  } else if ([value isKindOfClass:[FVPMixWithOthersMessage class]]) {
+  } else if ([value isKindOfClass:[FVPCacheOptionsMessage class]]) {
     [self writeByte:130];
     [self writeValue:[value toList]];
-  } else if ([value isKindOfClass:[FVPPlaybackSpeedMessage class]]) {
+  } else if ([value isKindOfClass:[FVPCreateMessage class]]) {
     [self writeByte:131];
     [self writeValue:[value toList]];
-  } else if ([value isKindOfClass:[FVPPositionMessage class]]) {
+  } else if ([value isKindOfClass:[FVPLoopingMessage class]]) {
     [self writeByte:132];
     [self writeValue:[value toList]];
-  } else if ([value isKindOfClass:[FVPTextureMessage class]]) {
+  } else if ([value isKindOfClass:[FVPMixWithOthersMessage class]]) {
     [self writeByte:133];
     [self writeValue:[value toList]];
-  } else if ([value isKindOfClass:[FVPVolumeMessage class]]) {
+  } else if ([value isKindOfClass:[FVPPlaybackConstraintsMessage class]]) {
     [self writeByte:134];
     [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPPlaybackSpeedMessage class]]) {
+    [self writeByte:135];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPPlaybackStatsMessage class]]) {
+    [self writeByte:136];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPPositionMessage class]]) {
+    [self writeByte:137];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPPrefetchMessage class]]) {
+    [self writeByte:138];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPPreloadMessage class]]) {
+    [self writeByte:139];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPSeekModeMessage class]]) {
+    [self writeByte:140];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPTextureMessage class]]) {
+    [self writeByte:141];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPThumbnailsMessage class]]) {
+    [self writeByte:142];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPVideoOutputOptionsMessage class]]) {
+    [self writeByte:143];
+    [self writeValue:[value toList]];
+  } else if ([value isKindOfClass:[FVPVolumeMessage class]]) {
+    [self writeByte:144];
+    [self writeValue:[value toList]];
   } else {
     [super writeValue:value];
   }
@@ -367,6 +810,72 @@ void SetUpFVPAVFoundationVideoPlayerApi(id<FlutterBinaryMessenger> binaryMesseng
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:
+               @"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.preload"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert(
+          [api respondsToSelector:@selector(preload:error:)],
+          @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to @selector(preload:error:)",
+          api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPPreloadMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api preload:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:
+               @"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.prefetch"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert(
+          [api respondsToSelector:@selector(prefetch:error:)],
+          @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to @selector(prefetch:error:)",
+          api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPPrefetchMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api prefetch:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"generateThumbnails"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(generateThumbnails:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(generateThumbnails:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPThumbnailsMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api generateThumbnails:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
            initWithName:
@@ -455,6 +964,28 @@ void SetUpFVPAVFoundationVideoPlayerApi(id<FlutterBinaryMessenger> binaryMesseng
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"setPlaybackConstraints"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setPlaybackConstraints:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(setPlaybackConstraints:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPPlaybackConstraintsMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setPlaybackConstraints:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
            initWithName:
@@ -498,6 +1029,28 @@ void SetUpFVPAVFoundationVideoPlayerApi(id<FlutterBinaryMessenger> binaryMesseng
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"getPlaybackStats"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(playbackStats:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(playbackStats:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPTextureMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        FVPPlaybackStatsMessage *output = [api playbackStats:arg_msg error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
            initWithName:
@@ -521,6 +1074,72 @@ void SetUpFVPAVFoundationVideoPlayerApi(id<FlutterBinaryMessenger> binaryMesseng
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"setSeekMode"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setSeekMode:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(setSeekMode:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPSeekModeMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setSeekMode:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"setAudioOnly"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setAudioOnly:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(setAudioOnly:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPAudioOnlyMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setAudioOnly:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"setBufferingUpdateInterval"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setBufferingUpdateInterval:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(setBufferingUpdateInterval:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPBufferingUpdateIntervalMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setBufferingUpdateInterval:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
            initWithName:
@@ -565,4 +1184,48 @@ void SetUpFVPAVFoundationVideoPlayerApi(id<FlutterBinaryMessenger> binaryMesseng
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"setVideoOutputOptions"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setVideoOutputOptions:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(setVideoOutputOptions:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPVideoOutputOptionsMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setVideoOutputOptions:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi."
+                        @"setCacheOptions"
+        binaryMessenger:binaryMessenger
+                  codec:FVPAVFoundationVideoPlayerApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setCacheOptions:error:)],
+                @"FVPAVFoundationVideoPlayerApi api (%@) doesn't respond to "
+                @"@selector(setCacheOptions:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        FVPCacheOptionsMessage *arg_msg = GetNullableObjectAtIndex(args, 0);
+        FlutterError *error;
+        [api setCacheOptions:arg_msg error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
@@ -8,6 +8,9 @@
 
 #import <OCMock/OCMock.h>
 #import <video_player_avfoundation/AVAssetTrackUtils.h>
+#import <video_player_avfoundation/FVPMediaCache.h>
+#import <video_player_avfoundation/FVPMediaCacheLoader.h>
+#import <video_player_avfoundation/FVPThumbnailGenerator.h>
 #import <video_player_avfoundation/FVPVideoPlayerPlugin_Test.h>
 
 // TODO(stuartmorgan): Convert to using mock registrars instead.
@@ -66,6 +69,7 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
 @property(readonly, nonatomic) NSNumber *beforeTolerance;
 @property(readonly, nonatomic) NSNumber *afterTolerance;
 @property(readonly, assign) CMTime lastSeekTime;
+@property(readonly, assign) NSInteger seekCount;
 @end
 
 @implementation StubAVPlayer
@@ -77,6 +81,7 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
   _beforeTolerance = [NSNumber numberWithLong:toleranceBefore.value];
   _afterTolerance = [NSNumber numberWithLong:toleranceAfter.value];
   _lastSeekTime = time;
+  _seekCount++;
   [super seekToTime:time
         toleranceBefore:toleranceBefore
          toleranceAfter:toleranceAfter
@@ -89,6 +94,8 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
 
 @property(nonatomic, strong) StubAVPlayer *stubAVPlayer;
 @property(nonatomic, strong) AVPlayerItemVideoOutput *output;
+// The attributes that the last video output was requested with.
+@property(nonatomic, copy) NSDictionary<NSString *, id> *lastPixelBufferAttributes;
 
 - (instancetype)initWithPlayer:(StubAVPlayer *)stubAVPlayer
                         output:(AVPlayerItemVideoOutput *)output;
@@ -113,6 +120,7 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
 
 - (AVPlayerItemVideoOutput *)videoOutputWithPixelBufferAttributes:
     (NSDictionary<NSString *, id> *)attributes {
+  _lastPixelBufferAttributes = attributes;
   return _output ?: [[AVPlayerItemVideoOutput alloc] initWithPixelBufferAttributes:attributes];
 }
 
@@ -318,6 +326,108 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
   OCMVerify(never(), [mockDisplayLink setRunning:NO]);
 }
 
+- (void)testPlayersShareOneDisplayLink {
+  NSObject<FlutterTextureRegistry> *mockTextureRegistry =
+      OCMProtocolMock(@protocol(FlutterTextureRegistry));
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"PlayersShareOneDisplayLink"];
+  NSObject<FlutterPluginRegistrar> *partialRegistrar = OCMPartialMock(registrar);
+  OCMStub([partialRegistrar textures]).andReturn(mockTextureRegistry);
+  FVPDisplayLink *mockDisplayLink =
+      OCMPartialMock([[FVPDisplayLink alloc] initWithRegistrar:registrar
+                                                      callback:^(){
+                                                      }]);
+  __block NSUInteger displayLinkCount = 0;
+  id mockDisplayLinkFactory = OCMProtocolMock(@protocol(FVPDisplayLinkFactory));
+  OCMStub([mockDisplayLinkFactory displayLinkWithRegistrar:OCMOCK_ANY callback:OCMOCK_ANY])
+      .andDo(^(NSInvocation *invocation) {
+        displayLinkCount++;
+      })
+      .andReturn(mockDisplayLink);
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      [[FVPVideoPlayerPlugin alloc] initWithAVFactory:nil
+                                   displayLinkFactory:mockDisplayLinkFactory
+                                            registrar:partialRegistrar];
+
+  FlutterError *initalizationError;
+  [videoPlayerPlugin initialize:&initalizationError];
+  XCTAssertNil(initalizationError);
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/hls/bee.m3u8"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FlutterError *createError;
+  FVPTextureMessage *firstTextureMessage = [videoPlayerPlugin create:create error:&createError];
+  FVPTextureMessage *secondTextureMessage = [videoPlayerPlugin create:create error:&createError];
+  XCTAssertNil(createError);
+  XCTAssertNotNil(firstTextureMessage);
+  XCTAssertNotNil(secondTextureMessage);
+
+  XCTAssertEqual(displayLinkCount, 1);
+}
+
+- (void)testDisplayLinkFiresAtVideoFrameRate {
+  NSObject<FlutterTextureRegistry> *mockTextureRegistry =
+      OCMProtocolMock(@protocol(FlutterTextureRegistry));
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"DisplayLinkFiresAtVideoFrameRate"];
+  NSObject<FlutterPluginRegistrar> *partialRegistrar = OCMPartialMock(registrar);
+  OCMStub([partialRegistrar textures]).andReturn(mockTextureRegistry);
+  FVPDisplayLink *displayLink = [[FVPDisplayLink alloc] initWithRegistrar:registrar
+                                                                 callback:^(){
+                                                                 }];
+  StubFVPDisplayLinkFactory *stubDisplayLinkFactory =
+      [[StubFVPDisplayLinkFactory alloc] initWithDisplayLink:displayLink];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      [[FVPVideoPlayerPlugin alloc] initWithAVFactory:nil
+                                   displayLinkFactory:stubDisplayLinkFactory
+                                            registrar:partialRegistrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  XCTAssertEqual(displayLink.preferredFramesPerSecond, 0);
+
+  XCTestExpectation *initializedExpectation = [self expectationWithDescription:@"initialized"];
+  [player onListenWithArguments:nil
+                      eventSink:^(NSDictionary<NSString *, id> *event) {
+                        if ([event[@"event"] isEqualToString:@"initialized"]) {
+                          [initializedExpectation fulfill];
+                        }
+                      }];
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+
+  // The rate is set once the player runs and its video track is loaded, in either order.
+  [self keyValueObservingExpectationForObject:displayLink
+                                      keyPath:@"preferredFramesPerSecond"
+                                      handler:^BOOL(id observedObject, NSDictionary *change) {
+                                        return displayLink.preferredFramesPerSecond > 0;
+                                      }];
+  [videoPlayerPlugin play:textureMessage error:&error];
+  XCTAssertNil(error);
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+  AVAssetTrack *videoTrack =
+      [player.player.currentItem.asset tracksWithMediaType:AVMediaTypeVideo].firstObject;
+  XCTAssertEqualWithAccuracy(displayLink.preferredFramesPerSecond, videoTrack.nominalFrameRate,
+                             0.001);
+
+  // A stopped player no longer sets the rate.
+  [videoPlayerPlugin pause:textureMessage error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqual(displayLink.preferredFramesPerSecond, 0);
+}
+
 - (void)testDeregistersFromPlayer {
   NSObject<FlutterPluginRegistrar> *registrar =
       [GetPluginRegistry() registrarForPlugin:@"testDeregistersFromPlayer"];
@@ -349,6 +459,592 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
   [self waitForExpectationsWithTimeout:30.0 handler:nil];
 }
 
+- (void)testCreateUsesPreloadedItem {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testCreateUsesPreloadedItem"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+
+  NSString *uri = @"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4";
+  [videoPlayerPlugin preload:[FVPPreloadMessage makeWithUri:uri
+                                                httpHeaders:@{}
+                             preferredForwardBufferDuration:@5]
+                       error:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage makeWithAsset:nil
+                                                         uri:uri
+                                                 packageName:nil
+                                                  formatHint:nil
+                                                 httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  XCTAssertEqual(player.player.currentItem.preferredForwardBufferDuration, 5);
+
+  // The preloaded item is used only once.
+  FVPTextureMessage *secondTextureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *secondPlayer =
+      videoPlayerPlugin.playersByTextureId[@(secondTextureMessage.textureId)];
+  XCTAssertEqual(secondPlayer.player.currentItem.preferredForwardBufferDuration, 0);
+}
+
+- (void)testCreateReusesPlayerOfDisposedPlayer {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testCreateReusesPlayerOfDisposedPlayer"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  AVPlayer *avPlayer = player.player;
+  [player setVolume:0];
+
+  [videoPlayerPlugin dispose:textureMessage error:&error];
+  XCTAssertNil(error);
+  XCTAssertNil(avPlayer.currentItem);
+
+  FVPTextureMessage *secondTextureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *secondPlayer =
+      videoPlayerPlugin.playersByTextureId[@(secondTextureMessage.textureId)];
+  XCTAssertEqual(secondPlayer.player, avPlayer);
+  XCTAssertNotNil(secondPlayer.player.currentItem);
+  XCTAssertEqual(secondPlayer.player.volume, 1.0);
+}
+
+- (void)testRecycledPlayerMatchesNewPlayer {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testRecycledPlayerMatchesNewPlayer"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  AVPlayer *avPlayer = player.player;
+  AVPlayerLayer *playerLayer = player.playerLayer;
+  XCTAssertEqual(playerLayer.player, avPlayer);
+  NSInteger textureId = textureMessage.textureId;
+  [videoPlayerPlugin setVolume:[FVPVolumeMessage makeWithTextureId:textureId volume:0.5]
+                         error:&error];
+  [videoPlayerPlugin play:textureMessage error:&error];
+  [videoPlayerPlugin setPlaybackSpeed:[FVPPlaybackSpeedMessage makeWithTextureId:textureId
+                                                                           speed:1.5]
+                                error:&error];
+  XCTAssertNil(error);
+  avPlayer.muted = YES;
+
+  // The texture is still registered with the engine, and the disposed player keeps its layer,
+  // when the next player is created.
+  [videoPlayerPlugin dispose:textureMessage error:&error];
+  XCTAssertNil(error);
+  XCTAssertNil(playerLayer.player);
+  XCTAssertNil(player.player);
+
+  FVPTextureMessage *secondTextureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *secondPlayer =
+      videoPlayerPlugin.playersByTextureId[@(secondTextureMessage.textureId)];
+  XCTAssertEqual(secondPlayer.player, avPlayer);
+  XCTAssertNil(playerLayer.player);
+  XCTAssertEqual(secondPlayer.playerLayer.player, avPlayer);
+
+  AVPlayer *newPlayer = [AVPlayer playerWithPlayerItem:nil];
+  newPlayer.actionAtItemEnd = AVPlayerActionAtItemEndNone;
+  XCTAssertEqual(avPlayer.rate, newPlayer.rate);
+  XCTAssertEqual(avPlayer.volume, newPlayer.volume);
+  XCTAssertEqual(avPlayer.muted, newPlayer.muted);
+  XCTAssertEqual(avPlayer.actionAtItemEnd, newPlayer.actionAtItemEnd);
+
+  [player onTextureUnregistered:player];
+  XCTAssertEqual(secondPlayer.player, avPlayer);
+  XCTAssertNotNil(secondPlayer.player.currentItem);
+}
+
+- (void)testDisposeReleasesPlayerItemImmediately {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testDisposeReleasesPlayerItemImmediately"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  AVPlayer *avPlayer = player.player;
+  XCTAssertNotNil(avPlayer.currentItem);
+
+  [videoPlayerPlugin dispose:textureMessage error:&error];
+  XCTAssertNil(error);
+  XCTAssertNil(avPlayer.currentItem);
+  XCTAssertEqual(avPlayer.rate, 0);
+
+  // The engine unregistering the texture afterwards must not dispose the player a second time.
+  [player onTextureUnregistered:player];
+}
+
+- (void)testSetPlaybackConstraints {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testSetPlaybackConstraints"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/hls/bee.m3u8"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  AVPlayerItem *item =
+      videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)].player.currentItem;
+
+  FVPPlaybackConstraintsMessage *constraints;
+  constraints = [FVPPlaybackConstraintsMessage makeWithTextureId:textureMessage.textureId
+                                            preferredPeakBitRate:@500000
+                                           preferredMaximumWidth:@640
+                                          preferredMaximumHeight:@360
+                                  preferredForwardBufferDuration:@3];
+  [videoPlayerPlugin setPlaybackConstraints:constraints error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqual(item.preferredPeakBitRate, 500000);
+  XCTAssertTrue(CGSizeEqualToSize(item.preferredMaximumResolution, CGSizeMake(640, 360)));
+  XCTAssertEqual(item.preferredForwardBufferDuration, 3);
+
+  // Constraints that are not given are left unchanged.
+  constraints = [FVPPlaybackConstraintsMessage makeWithTextureId:textureMessage.textureId
+                                            preferredPeakBitRate:@0
+                                           preferredMaximumWidth:nil
+                                          preferredMaximumHeight:nil
+                                  preferredForwardBufferDuration:nil];
+  [videoPlayerPlugin setPlaybackConstraints:constraints error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqual(item.preferredPeakBitRate, 0);
+  XCTAssertTrue(CGSizeEqualToSize(item.preferredMaximumResolution, CGSizeMake(640, 360)));
+  XCTAssertEqual(item.preferredForwardBufferDuration, 3);
+}
+
+- (void)testSetVideoOutputOptionsAppliesToNewPlayers {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testSetVideoOutputOptionsAppliesToNewPlayers"];
+  StubFVPAVFactory *stubAVFactory = [[StubFVPAVFactory alloc] initWithPlayer:nil output:nil];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      [[FVPVideoPlayerPlugin alloc] initWithAVFactory:stubAVFactory
+                                   displayLinkFactory:nil
+                                            registrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  NSDictionary<NSString *, id> *attributes = stubAVFactory.lastPixelBufferAttributes;
+  XCTAssertEqualObjects(attributes[(id)kCVPixelBufferPixelFormatTypeKey],
+                        @(kCVPixelFormatType_32BGRA));
+  XCTAssertNil(attributes[(id)kCVPixelBufferMetalCompatibilityKey]);
+
+  FVPVideoOutputOptionsMessage *options =
+      [FVPVideoOutputOptionsMessage makeWithUseYuvPixelFormat:YES
+                                                 maximumWidth:nil
+                                                maximumHeight:nil
+                                                    audioOnly:NO];
+  [videoPlayerPlugin setVideoOutputOptions:options error:&error];
+  XCTAssertNil(error);
+  [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  attributes = stubAVFactory.lastPixelBufferAttributes;
+  XCTAssertEqualObjects(attributes[(id)kCVPixelBufferPixelFormatTypeKey],
+                        @(kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange));
+  XCTAssertEqualObjects(attributes[(id)kCVPixelBufferMetalCompatibilityKey], @YES);
+  // The size is only limited once the video's size is known.
+  XCTAssertNil(attributes[(id)kCVPixelBufferWidthKey]);
+}
+
+- (void)testAudioOnlyPlayerHasNoVideoOutput {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testAudioOnlyPlayerHasNoVideoOutput"];
+  StubFVPAVFactory *stubAVFactory = [[StubFVPAVFactory alloc] initWithPlayer:nil output:nil];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      [[FVPVideoPlayerPlugin alloc] initWithAVFactory:stubAVFactory
+                                   displayLinkFactory:nil
+                                            registrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+  FVPVideoOutputOptionsMessage *options =
+      [FVPVideoOutputOptionsMessage makeWithUseYuvPixelFormat:NO
+                                                 maximumWidth:nil
+                                                maximumHeight:nil
+                                                    audioOnly:YES];
+  [videoPlayerPlugin setVideoOutputOptions:options error:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  XCTAssertTrue(player.audioOnly);
+  XCTAssertNil(stubAVFactory.lastPixelBufferAttributes);
+  XCTAssertNil(player.playerLayer.player);
+  XCTAssertTrue([player copyPixelBuffer] == NULL);
+}
+
+- (void)testSetAudioOnlyRemovesAndRestoresVideoOutput {
+  NSObject<FlutterTextureRegistry> *mockTextureRegistry =
+      OCMProtocolMock(@protocol(FlutterTextureRegistry));
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testSetAudioOnlyRemovesAndRestoresVideoOutput"];
+  NSObject<FlutterPluginRegistrar> *partialRegistrar = OCMPartialMock(registrar);
+  OCMStub([partialRegistrar textures]).andReturn(mockTextureRegistry);
+  FVPDisplayLink *mockDisplayLink =
+      OCMPartialMock([[FVPDisplayLink alloc] initWithRegistrar:registrar
+                                                      callback:^(){
+                                                      }]);
+  StubFVPDisplayLinkFactory *stubDisplayLinkFactory =
+      [[StubFVPDisplayLinkFactory alloc] initWithDisplayLink:mockDisplayLink];
+  StubFVPAVFactory *stubAVFactory = [[StubFVPAVFactory alloc] initWithPlayer:nil output:nil];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      [[FVPVideoPlayerPlugin alloc] initWithAVFactory:stubAVFactory
+                                   displayLinkFactory:stubDisplayLinkFactory
+                                            registrar:partialRegistrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  XCTAssertNotNil(player.playerLayer.player);
+
+  [videoPlayerPlugin setAudioOnly:[FVPAudioOnlyMessage makeWithTextureId:textureMessage.textureId
+                                                               audioOnly:YES]
+                            error:&error];
+  XCTAssertNil(error);
+  XCTAssertTrue(player.audioOnly);
+  XCTAssertNil(player.playerLayer.player);
+  XCTAssertTrue([player copyPixelBuffer] == NULL);
+
+  stubAVFactory.lastPixelBufferAttributes = nil;
+  [videoPlayerPlugin setAudioOnly:[FVPAudioOnlyMessage makeWithTextureId:textureMessage.textureId
+                                                               audioOnly:NO]
+                            error:&error];
+  XCTAssertNil(error);
+  XCTAssertFalse(player.audioOnly);
+  XCTAssertNotNil(player.playerLayer.player);
+  XCTAssertNotNil(stubAVFactory.lastPixelBufferAttributes);
+}
+
+- (NSURL *)temporaryMediaCacheDirectoryURL {
+  NSURL *directoryURL = [NSURL fileURLWithPath:NSTemporaryDirectory()
+                                   isDirectory:YES];
+  directoryURL = [directoryURL URLByAppendingPathComponent:[NSUUID UUID].UUIDString
+                                               isDirectory:YES];
+  [self addTeardownBlock:^{
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+  }];
+  return directoryURL;
+}
+
+- (void)testMediaCacheStoresRanges {
+  FVPMediaCache *cache =
+      [[FVPMediaCache alloc] initWithDirectoryURL:[self temporaryMediaCacheDirectoryURL]
+                                      maximumSize:1024];
+  NSURL *url = [NSURL URLWithString:@"https://example.com/video.mp4"];
+  XCTAssertNil([cache dataForURL:url offset:0 length:10]);
+
+  [cache storeData:[@"0123" dataUsingEncoding:NSUTF8StringEncoding] forURL:url offset:0];
+  [cache storeData:[@"89" dataUsingEncoding:NSUTF8StringEncoding] forURL:url offset:8];
+
+  NSData *data = [cache dataForURL:url offset:1 length:10];
+  XCTAssertEqualObjects([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding],
+                        @"123");
+  XCTAssertNil([cache dataForURL:url offset:4 length:2]);
+  XCTAssertEqual([cache firstUncachedOffsetForURL:url fromOffset:0], 4);
+  XCTAssertEqual([cache firstCachedOffsetForURL:url fromOffset:4], 8);
+  XCTAssertEqual([cache firstCachedOffsetForURL:url fromOffset:10], -1);
+}
+
+- (void)testMediaCachePersistsAcrossInstances {
+  NSURL *directoryURL = [self temporaryMediaCacheDirectoryURL];
+  NSURL *url = [NSURL URLWithString:@"https://example.com/video.mp4"];
+  FVPMediaCache *cache = [[FVPMediaCache alloc] initWithDirectoryURL:directoryURL
+                                                         maximumSize:1024];
+  FVPMediaCacheContentInfo *contentInfo = [[FVPMediaCacheContentInfo alloc] init];
+  contentInfo.contentLength = 10;
+  contentInfo.contentType = @"public.mpeg-4";
+  contentInfo.byteRangeAccessSupported = YES;
+  [cache setContentInfo:contentInfo forURL:url];
+  [cache storeData:[@"0123" dataUsingEncoding:NSUTF8StringEncoding] forURL:url offset:0];
+
+  // Metadata is saved shortly after the last change.
+  XCTestExpectation *saved = [self expectationWithDescription:@"metadata saved"];
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(2 * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   [saved fulfill];
+                 });
+  [self waitForExpectationsWithTimeout:5 handler:nil];
+
+  FVPMediaCache *reopenedCache = [[FVPMediaCache alloc] initWithDirectoryURL:directoryURL
+                                                                 maximumSize:1024];
+  FVPMediaCacheContentInfo *reopenedInfo = [reopenedCache contentInfoForURL:url];
+  XCTAssertEqual(reopenedInfo.contentLength, 10);
+  XCTAssertEqualObjects(reopenedInfo.contentType, @"public.mpeg-4");
+  XCTAssertTrue(reopenedInfo.byteRangeAccessSupported);
+  NSData *data = [reopenedCache dataForURL:url offset:0 length:10];
+  XCTAssertEqualObjects([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding],
+                        @"0123");
+}
+
+- (void)testMediaCacheEvictsLeastRecentlyUsedResources {
+  FVPMediaCache *cache =
+      [[FVPMediaCache alloc] initWithDirectoryURL:[self temporaryMediaCacheDirectoryURL]
+                                      maximumSize:10];
+  NSURL *firstURL = [NSURL URLWithString:@"https://example.com/first.mp4"];
+  NSURL *secondURL = [NSURL URLWithString:@"https://example.com/second.mp4"];
+  NSURL *thirdURL = [NSURL URLWithString:@"https://example.com/third.mp4"];
+  NSData *data = [@"0123" dataUsingEncoding:NSUTF8StringEncoding];
+  [cache storeData:data forURL:firstURL offset:0];
+  [cache storeData:data forURL:secondURL offset:0];
+  // Reading the first resource makes the second one the least recently used.
+  XCTAssertNotNil([cache dataForURL:firstURL offset:0 length:4]);
+
+  [cache storeData:data forURL:thirdURL offset:0];
+
+  XCTAssertNotNil([cache dataForURL:firstURL offset:0 length:4]);
+  XCTAssertNil([cache dataForURL:secondURL offset:0 length:4]);
+  XCTAssertNotNil([cache dataForURL:thirdURL offset:0 length:4]);
+
+  // A resource larger than the cache is not stored.
+  [cache storeData:[NSMutableData dataWithLength:11] forURL:secondURL offset:0];
+  XCTAssertNil([cache dataForURL:secondURL offset:0 length:4]);
+}
+
+- (void)testMediaCacheLoaderCanCacheURL {
+  XCTAssertTrue(
+      [FVPMediaCacheLoader canCacheURL:[NSURL URLWithString:@"https://example.com/a.mp4"]]);
+  XCTAssertTrue([FVPMediaCacheLoader canCacheURL:[NSURL URLWithString:@"http://example.com/a"]]);
+  XCTAssertFalse(
+      [FVPMediaCacheLoader canCacheURL:[NSURL URLWithString:@"https://example.com/a.m3u8"]]);
+  XCTAssertFalse([FVPMediaCacheLoader canCacheURL:[NSURL fileURLWithPath:@"/tmp/a.mp4"]]);
+}
+
+- (void)testCreateUsesMediaCacheOnlyWhenEnabled {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testCreateUsesMediaCacheOnlyWhenEnabled"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  AVURLAsset *asset = (AVURLAsset *)player.player.currentItem.asset;
+  XCTAssertEqualObjects(asset.URL.scheme, @"https");
+
+  [videoPlayerPlugin setCacheOptions:[FVPCacheOptionsMessage makeWithEnabled:YES maximumSize:0]
+                               error:&error];
+  XCTAssertNil(error);
+  textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  asset = (AVURLAsset *)player.player.currentItem.asset;
+  XCTAssertEqualObjects(asset.URL.scheme, @"fvp-cache-https");
+  XCTAssertNotNil(asset.resourceLoader.delegate);
+
+  [videoPlayerPlugin setCacheOptions:[FVPCacheOptionsMessage makeWithEnabled:NO maximumSize:0]
+                               error:&error];
+  XCTAssertNil(error);
+  textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  asset = (AVURLAsset *)player.player.currentItem.asset;
+  XCTAssertEqualObjects(asset.URL.scheme, @"https");
+}
+
+- (void)testThumbnailGeneratorSendsThumbnailsThenEnds {
+  NSURL *url =
+      [NSURL URLWithString:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"];
+  FVPThumbnailGenerator *generator =
+      [[FVPThumbnailGenerator alloc] initWithAsset:[AVURLAsset URLAssetWithURL:url options:nil]
+                                             times:@[ @0, @1000 ]
+                                       maximumSize:CGSizeMake(64, 64)
+                                         tolerance:kCMTimePositiveInfinity];
+
+  NSMutableArray<NSDictionary *> *thumbnails = [NSMutableArray array];
+  XCTestExpectation *endExpectation = [self expectationWithDescription:@"stream ended"];
+  [generator onListenWithArguments:nil
+                         eventSink:^(id event) {
+                           if (event == FlutterEndOfEventStream) {
+                             [endExpectation fulfill];
+                           } else {
+                             XCTAssertTrue([event isKindOfClass:[NSDictionary class]]);
+                             [thumbnails addObject:event];
+                           }
+                         }];
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+
+  XCTAssertEqual(thumbnails.count, 2);
+  for (NSDictionary *thumbnail in thumbnails) {
+    XCTAssertNotNil(thumbnail[@"requestedTime"]);
+    XCTAssertNotNil(thumbnail[@"time"]);
+    FlutterStandardTypedData *bytes = thumbnail[@"bytes"];
+    XCTAssertGreaterThan(bytes.data.length, 0u);
+  }
+}
+
+- (void)testPlaybackStats {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testPlaybackStats"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+
+  FVPPlaybackStatsMessage *stats = [videoPlayerPlugin playbackStats:textureMessage error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqual(stats.textureId, textureMessage.textureId);
+  XCTAssertEqual(stats.nullPixelBufferCount, 0);
+  XCTAssertEqual(stats.idleDisplayLinkFireCount, 0);
+
+  FVPTextureMessage *unknownTexture = [FVPTextureMessage makeWithTextureId:-1];
+  stats = [videoPlayerPlugin playbackStats:unknownTexture error:&error];
+  XCTAssertNil(stats);
+  XCTAssertNotNil(error);
+}
+
+- (void)testBufferingUpdatesAreThrottled {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"testBufferingUpdatesAreThrottled"];
+  FVPVideoPlayerPlugin *videoPlayerPlugin =
+      (FVPVideoPlayerPlugin *)[[FVPVideoPlayerPlugin alloc] initWithRegistrar:registrar];
+
+  FlutterError *error;
+  [videoPlayerPlugin initialize:&error];
+  XCTAssertNil(error);
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [videoPlayerPlugin create:create error:&error];
+  XCTAssertNil(error);
+  FVPVideoPlayer *player = videoPlayerPlugin.playersByTextureId[@(textureMessage.textureId)];
+  XCTAssertEqualWithAccuracy(player.bufferingUpdateInterval, 0.25, 0.0001);
+
+  [videoPlayerPlugin
+      setBufferingUpdateInterval:[FVPBufferingUpdateIntervalMessage
+                                     makeWithTextureId:textureMessage.textureId
+                                              interval:60 * 60 * 1000]
+                           error:&error];
+  XCTAssertNil(error);
+  XCTAssertEqualWithAccuracy(player.bufferingUpdateInterval, 60 * 60, 0.0001);
+
+  __block NSUInteger bufferingUpdateCount = 0;
+  XCTestExpectation *initializedExpectation = [self expectationWithDescription:@"initialized"];
+  [player onListenWithArguments:nil
+                      eventSink:^(NSDictionary<NSString *, id> *event) {
+                        if ([event[@"event"] isEqualToString:@"bufferingUpdate"]) {
+                          bufferingUpdateCount++;
+                        } else if ([event[@"event"] isEqualToString:@"initialized"]) {
+                          [initializedExpectation fulfill];
+                        }
+                      }];
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+  [videoPlayerPlugin play:textureMessage error:&error];
+  XCTAssertNil(error);
+
+  // Let the video load for a while; its ranges change many times, but only the first change is
+  // sent within the interval.
+  XCTestExpectation *loadedExpectation = [self expectationWithDescription:@"loaded for a while"];
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(3 * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   [loadedExpectation fulfill];
+                 });
+  [self waitForExpectationsWithTimeout:10.0 handler:nil];
+  XCTAssertLessThanOrEqual(bufferingUpdateCount, 1u);
+}
+
 - (void)testBufferingStateFromPlayer {
   NSObject<FlutterPluginRegistrar> *registrar =
       [GetPluginRegistry() registrarForPlugin:@"testLiveStreamBufferEndFromPlayer"];
@@ -491,6 +1187,98 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
   XCTAssertEqual([stubAVPlayer.afterTolerance intValue], 0);
 }
 
+- (void)testSeekModeSetsSeekTolerance {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"TestSeekModeSetsSeekTolerance"];
+
+  StubAVPlayer *stubAVPlayer = [[StubAVPlayer alloc] init];
+  StubFVPAVFactory *stubAVFactory = [[StubFVPAVFactory alloc] initWithPlayer:stubAVPlayer
+                                                                      output:nil];
+  FVPVideoPlayerPlugin *pluginWithMockAVPlayer =
+      [[FVPVideoPlayerPlugin alloc] initWithAVFactory:stubAVFactory
+                                   displayLinkFactory:nil
+                                            registrar:registrar];
+
+  FlutterError *error;
+  [pluginWithMockAVPlayer initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [pluginWithMockAVPlayer create:create error:&error];
+  NSInteger textureId = textureMessage.textureId;
+
+  FVPSeekModeMessage *seekMode = [FVPSeekModeMessage makeWithTextureId:textureId
+                                                             tolerance:@0.5
+                                                             scrubbing:NO];
+  [pluginWithMockAVPlayer setSeekMode:seekMode error:&error];
+  XCTAssertNil(error);
+
+  XCTestExpectation *seekExpectation =
+      [self expectationWithDescription:@"seekTo uses the tolerance of the seek mode"];
+  FVPPositionMessage *message = [FVPPositionMessage makeWithTextureId:textureId position:1234];
+  [pluginWithMockAVPlayer seekTo:message
+                      completion:^(FlutterError *_Nullable error) {
+                        [seekExpectation fulfill];
+                      }];
+
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+  XCTAssertEqual([stubAVPlayer.beforeTolerance longValue], NSEC_PER_SEC / 2);
+  XCTAssertEqual([stubAVPlayer.afterTolerance longValue], NSEC_PER_SEC / 2);
+}
+
+- (void)testScrubbingSeeksOnlyToLatestPosition {
+  NSObject<FlutterPluginRegistrar> *registrar =
+      [GetPluginRegistry() registrarForPlugin:@"TestScrubbingSeeksOnlyToLatestPosition"];
+
+  StubAVPlayer *stubAVPlayer = [[StubAVPlayer alloc] init];
+  StubFVPAVFactory *stubAVFactory = [[StubFVPAVFactory alloc] initWithPlayer:stubAVPlayer
+                                                                      output:nil];
+  FVPVideoPlayerPlugin *pluginWithMockAVPlayer =
+      [[FVPVideoPlayerPlugin alloc] initWithAVFactory:stubAVFactory
+                                   displayLinkFactory:nil
+                                            registrar:registrar];
+
+  FlutterError *error;
+  [pluginWithMockAVPlayer initialize:&error];
+  XCTAssertNil(error);
+
+  FVPCreateMessage *create = [FVPCreateMessage
+      makeWithAsset:nil
+                uri:@"https://flutter.github.io/assets-for-api-docs/assets/videos/bee.mp4"
+        packageName:nil
+         formatHint:nil
+        httpHeaders:@{}];
+  FVPTextureMessage *textureMessage = [pluginWithMockAVPlayer create:create error:&error];
+  NSInteger textureId = textureMessage.textureId;
+
+  FVPSeekModeMessage *seekMode = [FVPSeekModeMessage makeWithTextureId:textureId
+                                                             tolerance:@0
+                                                             scrubbing:YES];
+  [pluginWithMockAVPlayer setSeekMode:seekMode error:&error];
+  XCTAssertNil(error);
+
+  for (NSInteger position = 1000; position <= 3000; position += 1000) {
+    NSString *description = [NSString stringWithFormat:@"seek to %ld completes", (long)position];
+    XCTestExpectation *seekExpectation = [self expectationWithDescription:description];
+    FVPPositionMessage *message = [FVPPositionMessage makeWithTextureId:textureId
+                                                               position:position];
+    [pluginWithMockAVPlayer seekTo:message
+                        completion:^(FlutterError *_Nullable error) {
+                          [seekExpectation fulfill];
+                        }];
+  }
+
+  [self waitForExpectationsWithTimeout:30.0 handler:nil];
+  // The seek to 2000 was superseded before the seek to 1000 finished.
+  XCTAssertEqual(stubAVPlayer.seekCount, 2);
+  XCTAssertEqual(CMTimeCompare(stubAVPlayer.lastSeekTime, CMTimeMake(3000, 1000)), 0);
+}
+
 - (void)testSeekToleranceWhenSeekingToEnd {
   NSObject<FlutterPluginRegistrar> *registrar =
       [GetPluginRegistry() registrarForPlugin:@"TestSeekToEndTolerance"];
@@ -622,9 +1410,8 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
     XCTAssertNil(error);
   }
 
-  // [FVPVideoPlayerPlugin dispose:error:] selector is dispatching the [FVPVideoPlayer dispose] call
-  // with a 1-second delay keeping a strong reference to the player. The polling ensures the player
-  // was truly deallocated.
+  // The engine may still hold the player until it has unregistered the texture. The polling ensures
+  // the player was truly deallocated.
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
   [self expectationForPredicate:[NSPredicate predicateWithFormat:@"self != nil"]
@@ -678,9 +1465,8 @@ NSObject<FlutterPluginRegistry> *GetPluginRegistry(void) {
     XCTAssertNil(error);
   }
 
-  // [FVPVideoPlayerPlugin dispose:error:] selector is dispatching the [FVPVideoPlayer dispose] call
-  // with a 1-second delay keeping a strong reference to the player. The polling ensures the player
-  // was truly deallocated.
+  // The engine may still hold the player until it has unregistered the texture. The polling ensures
+  // the player was truly deallocated.
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
   [self expectationForPredicate:[NSPredicate predicateWithFormat:@"self != nil"]
@@ -9,12 +9,26 @@ import 'package:flutter/widgets.dart';
 import 'package:video_player_platform_interface/video_player_platform_interface.dart';
 
 import 'messages.g.dart';
+import 'playback_stats.dart';
+import 'video_thumbnail.dart';
 
 /// An iOS implementation of [VideoPlayerPlatform] that uses the
 /// Pigeon-generated [VideoPlayerApi].
 class AVFoundationVideoPlayer extends VideoPlayerPlatform {
   final AVFoundationVideoPlayerApi _api = AVFoundationVideoPlayerApi();
 
+  // The size, in physical pixels, that each player's view was last laid out
+  // at, as last sent to the host.
+  final Map<int, Size> _renderedSizes = <int, Size>{};
+
+  // The players whose maximum resolution was set with
+  // [setPlaybackConstraints], which takes precedence over their rendered size.
+  final Set<int> _playersWithMaximumResolution = <int>{};
+
+  // The ID of the next [generateThumbnails] request, which names the event
+  // channel its thumbnails are sent on.
+  int _nextThumbnailsRequestId = 0;
+
   /// Registers this class as the default instance of [VideoPlayerPlatform].
   static void registerWith() {
     VideoPlayerPlatform.instance = AVFoundationVideoPlayer();
@@ -22,11 +36,15 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
 
   @override
   Future<void> init() {
+    _renderedSizes.clear();
+    _playersWithMaximumResolution.clear();
     return _api.initialize();
   }
 
   @override
   Future<void> dispose(int textureId) {
+    _renderedSizes.remove(textureId);
+    _playersWithMaximumResolution.remove(textureId);
     return _api.dispose(TextureMessage(textureId: textureId));
   }
 
@@ -66,6 +84,104 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
     return response.textureId;
   }
 
+  /// Starts loading the network video at [uri] ahead of playback.
+  ///
+  /// A later [create] call with a network [DataSource] for the same [uri] and
+  /// [httpHeaders] picks up the preloaded video, so it becomes ready to play
+  /// sooner. [preferredForwardBufferDuration] sets how far ahead of the
+  /// playhead the player should buffer; when null, the player decides.
+  Future<void> preload(
+    String uri, {
+    Map<String, String> httpHeaders = const <String, String>{},
+    Duration? preferredForwardBufferDuration,
+  }) {
+    return _api.preload(PreloadMessage(
+      uri: uri,
+      httpHeaders: httpHeaders,
+      preferredForwardBufferDuration: preferredForwardBufferDuration == null
+          ? null
+          : preferredForwardBufferDuration.inMicroseconds /
+              Duration.microsecondsPerSecond,
+    ));
+  }
+
+  /// Downloads the first [duration] of the network video at [uri] into the
+  /// disk cache, so that a player created for it later starts without
+  /// waiting for the network.
+  ///
+  /// How many bytes that takes is estimated from the video's average bit
+  /// rate. Does nothing unless the cache is enabled with [setCacheOptions].
+  Future<void> prefetch(
+    String uri, {
+    Map<String, String> httpHeaders = const <String, String>{},
+    required Duration duration,
+  }) {
+    return _api.prefetch(PrefetchMessage(
+      uri: uri,
+      httpHeaders: httpHeaders,
+      duration: duration.inMicroseconds / Duration.microsecondsPerSecond,
+    ));
+  }
+
+  /// Generates JPEG thumbnails of a video at each of [times], such as for the
+  /// frames of a scrub bar, emitting each one as soon as it is ready.
+  ///
+  /// The frames are read from the player with [textureId] if given, sharing
+  /// the media it has already loaded, or from [uri] otherwise. Thumbnails fit
+  /// in [maxSize] if given, and may show a frame up to [tolerance] away from
+  /// the requested time, which makes them much faster to generate. A null
+  /// [tolerance] allows any distance, typically picking the nearest keyframe.
+  ///
+  /// A thumbnail that can't be generated is emitted as a [PlatformException],
+  /// and the stream closes after the last one. Cancelling the subscription
+  /// stops generating the remaining thumbnails.
+  Stream<AVFoundationVideoThumbnail> generateThumbnails({
+    int? textureId,
+    String? uri,
+    Map<String, String> httpHeaders = const <String, String>{},
+    required List<Duration> times,
+    Size? maxSize,
+    Duration? tolerance,
+  }) async* {
+    assert(textureId != null || uri != null,
+        'Either textureId or uri must be provided.');
+    final int requestId = _nextThumbnailsRequestId++;
+    await _api.generateThumbnails(ThumbnailsMessage(
+      requestId: requestId,
+      textureId: textureId,
+      uri: uri,
+      httpHeaders: httpHeaders,
+      times: times.map((Duration time) => time.inMilliseconds).toList(),
+      maxWidth: maxSize?.width ?? 0,
+      maxHeight: maxSize?.height ?? 0,
+      tolerance: tolerance?.inMilliseconds,
+    ));
+    yield* EventChannel('flutter.io/videoPlayer/thumbnails$requestId')
+        .receiveBroadcastStream()
+        .map((dynamic event) {
+      final Map<dynamic, dynamic> map = event as Map<dynamic, dynamic>;
+      return AVFoundationVideoThumbnail(
+        requestedTime: Duration(milliseconds: map['requestedTime'] as int),
+        time: Duration(milliseconds: map['time'] as int),
+        bytes: map['bytes'] as Uint8List,
+      );
+    });
+  }
+
+  /// Sets whether players created after this call, and [prefetch], keep the
+  /// network videos they download in a disk cache, so that videos that are
+  /// played again are read from disk rather than downloaded again.
+  ///
+  /// [maximumSize] is the number of bytes the cache keeps, 512 MiB when null.
+  /// The videos that were played least recently are removed first. HLS
+  /// streams aren't cached.
+  Future<void> setCacheOptions({required bool enabled, int? maximumSize}) {
+    return _api.setCacheOptions(CacheOptionsMessage(
+      enabled: enabled,
+      maximumSize: maximumSize ?? 0,
+    ));
+  }
+
   @override
   Future<void> setLooping(int textureId, bool looping) {
     return _api.setLooping(LoopingMessage(
@@ -74,6 +190,43 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
     ));
   }
 
+  /// Limits the network and decoding resources used by the player with
+  /// [textureId], for example for small players in a feed.
+  ///
+  /// [preferredPeakBitRate] caps the bit rate, in bits per second, of the HLS
+  /// variants the player chooses. [preferredMaximumResolution] caps their
+  /// resolution, in pixels. [preferredForwardBufferDuration] sets how far
+  /// ahead of the playhead the player buffers. Null arguments leave the
+  /// corresponding constraint unchanged, and zero values remove it.
+  ///
+  /// Unless a maximum resolution is set here, the player limits itself to the
+  /// size its view is rendered at.
+  Future<void> setPlaybackConstraints(
+    int textureId, {
+    double? preferredPeakBitRate,
+    Size? preferredMaximumResolution,
+    Duration? preferredForwardBufferDuration,
+  }) {
+    Size? maximumResolution = preferredMaximumResolution;
+    if (maximumResolution == Size.zero) {
+      _playersWithMaximumResolution.remove(textureId);
+      // Fall back to the rendered size, if it is known.
+      maximumResolution = _renderedSizes[textureId] ?? Size.zero;
+    } else if (maximumResolution != null) {
+      _playersWithMaximumResolution.add(textureId);
+    }
+    return _api.setPlaybackConstraints(PlaybackConstraintsMessage(
+      textureId: textureId,
+      preferredPeakBitRate: preferredPeakBitRate,
+      preferredMaximumWidth: maximumResolution?.width,
+      preferredMaximumHeight: maximumResolution?.height,
+      preferredForwardBufferDuration: preferredForwardBufferDuration == null
+          ? null
+          : preferredForwardBufferDuration.inMicroseconds /
+              Duration.microsecondsPerSecond,
+    ));
+  }
+
   @override
   Future<void> play(int textureId) {
     return _api.play(TextureMessage(textureId: textureId));
@@ -110,6 +263,50 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
     ));
   }
 
+  /// Sets how precisely [seekTo] seeks for the player with [textureId].
+  ///
+  /// When [scrubbing] is true, a seek requested while another one is still in
+  /// progress doesn't start right away. Once the seek in progress finishes,
+  /// the player only seeks to the position that was requested last, which
+  /// keeps it close behind a scrubber that requests many positions per second.
+  Future<void> setSeekMode(
+    int textureId,
+    AVFoundationSeekMode mode, {
+    bool scrubbing = false,
+  }) {
+    final Duration? tolerance = mode.tolerance;
+    return _api.setSeekMode(SeekModeMessage(
+      textureId: textureId,
+      tolerance: tolerance == null
+          ? null
+          : tolerance.inMicroseconds / Duration.microsecondsPerSecond,
+      scrubbing: scrubbing,
+    ));
+  }
+
+  /// Sets whether the player with [textureId] only plays audio.
+  ///
+  /// While [audioOnly] is true, the player doesn't decode video frames or
+  /// hand them to Flutter, so its texture keeps showing the last frame, if
+  /// any. Switching back to video shows the current frame again.
+  Future<void> setAudioOnly(int textureId, bool audioOnly) {
+    return _api.setAudioOnly(
+        AudioOnlyMessage(textureId: textureId, audioOnly: audioOnly));
+  }
+
+  /// Sets the minimum time between the buffering updates of the player with
+  /// [textureId], which is 250 milliseconds until set.
+  ///
+  /// Changes to the buffered ranges that come sooner are combined into one
+  /// update sent once [interval] has passed, and updates whose ranges haven't
+  /// changed at millisecond precision are skipped. Longer intervals cost less
+  /// while many players are loading at once. [Duration.zero] sends every
+  /// change as it happens.
+  Future<void> setBufferingUpdateInterval(int textureId, Duration interval) {
+    return _api.setBufferingUpdateInterval(BufferingUpdateIntervalMessage(
+        textureId: textureId, interval: interval.inMilliseconds));
+  }
+
   @override
   Future<Duration> getPosition(int textureId) async {
     final PositionMessage response =
@@ -117,6 +314,28 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
     return Duration(milliseconds: response.position);
   }
 
+  /// Returns statistics about how well the player with [textureId] has been
+  /// playing so far.
+  Future<AVFoundationPlaybackStats> getPlaybackStats(int textureId) async {
+    final PlaybackStatsMessage response =
+        await _api.getPlaybackStats(TextureMessage(textureId: textureId));
+    final double? startupTime = response.startupTime;
+    return AVFoundationPlaybackStats(
+      indicatedBitrate: response.indicatedBitrate,
+      observedBitrate: response.observedBitrate,
+      startupTime: startupTime == null
+          ? null
+          : Duration(
+              microseconds:
+                  (startupTime * Duration.microsecondsPerSecond).round()),
+      stallCount: response.stallCount,
+      droppedVideoFrameCount: response.droppedVideoFrameCount,
+      errorCount: response.errorCount,
+      idleDisplayLinkFireCount: response.idleDisplayLinkFireCount,
+      nullPixelBufferCount: response.nullPixelBufferCount,
+    );
+  }
+
   @override
   Stream<VideoEvent> videoEventsFor(int textureId) {
     return _eventChannelFor(textureId)
@@ -159,7 +378,31 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
 
   @override
   Widget buildView(int textureId) {
-    return Texture(textureId: textureId);
+    return LayoutBuilder(
+      builder: (BuildContext context, BoxConstraints constraints) {
+        final double devicePixelRatio =
+            MediaQuery.maybeDevicePixelRatioOf(context) ?? 1.0;
+        _updateRenderedSize(textureId, constraints.biggest * devicePixelRatio);
+        return Texture(textureId: textureId);
+      },
+    );
+  }
+
+  // Lets the player with [textureId] skip HLS variants that are larger than
+  // the [size] its view is rendered at.
+  void _updateRenderedSize(int textureId, Size size) {
+    if (!size.isFinite || size.isEmpty || _renderedSizes[textureId] == size) {
+      return;
+    }
+    _renderedSizes[textureId] = size;
+    if (_playersWithMaximumResolution.contains(textureId)) {
+      return;
+    }
+    _api.setPlaybackConstraints(PlaybackConstraintsMessage(
+      textureId: textureId,
+      preferredMaximumWidth: size.width,
+      preferredMaximumHeight: size.height,
+    ));
   }
 
   @override
@@ -168,6 +411,29 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
         .setMixWithOthers(MixWithOthersMessage(mixWithOthers: mixWithOthers));
   }
 
+  /// Sets how players created after this call hand video frames to Flutter.
+  ///
+  /// [pixelFormat] is the format the frames are decoded into. [maximumSize]
+  /// scales frames that are larger than it down to fit, keeping their aspect
+  /// ratio, which saves memory bandwidth for players that are shown small.
+  /// When null, frames keep the size of the video.
+  ///
+  /// If [audioOnly] is true, players are created without a video output, as
+  /// for [setAudioOnly]. Their size may be reported as zero, since they don't
+  /// wait for it to be known before being initialized.
+  Future<void> setVideoOutputOptions({
+    AVFoundationPixelFormat pixelFormat = AVFoundationPixelFormat.bgra,
+    Size? maximumSize,
+    bool audioOnly = false,
+  }) {
+    return _api.setVideoOutputOptions(VideoOutputOptionsMessage(
+      useYuvPixelFormat: pixelFormat == AVFoundationPixelFormat.yuv420BiPlanar,
+      maximumWidth: maximumSize?.width,
+      maximumHeight: maximumSize?.height,
+      audioOnly: audioOnly,
+    ));
+  }
+
   EventChannel _eventChannelFor(int textureId) {
     return EventChannel('flutter.io/videoPlayer/videoEvents$textureId');
   }
@@ -188,3 +454,38 @@ class AVFoundationVideoPlayer extends VideoPlayerPlatform {
     );
   }
 }
+
+/// How precisely a player seeks.
+class AVFoundationSeekMode {
+  /// Seeks to exactly the requested position.
+  ///
+  /// This is the default. It decodes every frame from the keyframe before the
+  /// requested position, which can take a while for videos with few
+  /// keyframes.
+  const AVFoundationSeekMode.exact() : tolerance = Duration.zero;
+
+  /// Seeks to whichever position near the requested one is fastest to reach,
+  /// typically the nearest keyframe.
+  const AVFoundationSeekMode.keyframe() : tolerance = null;
+
+  /// Seeks to a position at most [tolerance] before or after the requested
+  /// one.
+  const AVFoundationSeekMode.tolerance(Duration this.tolerance);
+
+  /// How far seeks may land from the requested position, or null if there is
+  /// no limit.
+  final Duration? tolerance;
+}
+
+/// The pixel formats that players can decode video frames into.
+enum AVFoundationPixelFormat {
+  /// 32-bit BGRA, which the decoder converts every frame to.
+  bgra,
+
+  /// The decoder's native biplanar 4:2:0 YUV format, which Flutter converts to
+  /// RGB on the GPU while drawing.
+  ///
+  /// This skips a color conversion per frame and needs less memory bandwidth
+  /// than [bgra], which matters most for high resolution video.
+  yuv420BiPlanar,
+}
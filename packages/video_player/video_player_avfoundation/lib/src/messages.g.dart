@@ -121,6 +121,108 @@ class PlaybackSpeedMessage {
   }
 }
 
+class PlaybackConstraintsMessage {
+  PlaybackConstraintsMessage({
+    required this.textureId,
+    this.preferredPeakBitRate,
+    this.preferredMaximumWidth,
+    this.preferredMaximumHeight,
+    this.preferredForwardBufferDuration,
+  });
+
+  int textureId;
+
+  double? preferredPeakBitRate;
+
+  double? preferredMaximumWidth;
+
+  double? preferredMaximumHeight;
+
+  double? preferredForwardBufferDuration;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      preferredPeakBitRate,
+      preferredMaximumWidth,
+      preferredMaximumHeight,
+      preferredForwardBufferDuration,
+    ];
+  }
+
+  static PlaybackConstraintsMessage decode(Object result) {
+    result as List<Object?>;
+    return PlaybackConstraintsMessage(
+      textureId: result[0]! as int,
+      preferredPeakBitRate: result[1] as double?,
+      preferredMaximumWidth: result[2] as double?,
+      preferredMaximumHeight: result[3] as double?,
+      preferredForwardBufferDuration: result[4] as double?,
+    );
+  }
+}
+
+class PlaybackStatsMessage {
+  PlaybackStatsMessage({
+    required this.textureId,
+    this.indicatedBitrate,
+    this.observedBitrate,
+    this.startupTime,
+    required this.stallCount,
+    required this.droppedVideoFrameCount,
+    required this.errorCount,
+    required this.idleDisplayLinkFireCount,
+    required this.nullPixelBufferCount,
+  });
+
+  int textureId;
+
+  double? indicatedBitrate;
+
+  double? observedBitrate;
+
+  double? startupTime;
+
+  int stallCount;
+
+  int droppedVideoFrameCount;
+
+  int errorCount;
+
+  int idleDisplayLinkFireCount;
+
+  int nullPixelBufferCount;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      indicatedBitrate,
+      observedBitrate,
+      startupTime,
+      stallCount,
+      droppedVideoFrameCount,
+      errorCount,
+      idleDisplayLinkFireCount,
+      nullPixelBufferCount,
+    ];
+  }
+
+  static PlaybackStatsMessage decode(Object result) {
+    result as List<Object?>;
+    return PlaybackStatsMessage(
+      textureId: result[0]! as int,
+      indicatedBitrate: result[1] as double?,
+      observedBitrate: result[2] as double?,
+      startupTime: result[3] as double?,
+      stallCount: result[4]! as int,
+      droppedVideoFrameCount: result[5]! as int,
+      errorCount: result[6]! as int,
+      idleDisplayLinkFireCount: result[7]! as int,
+      nullPixelBufferCount: result[8]! as int,
+    );
+  }
+}
+
 class PositionMessage {
   PositionMessage({
     required this.textureId,
@@ -147,6 +249,89 @@ class PositionMessage {
   }
 }
 
+class SeekModeMessage {
+  SeekModeMessage({
+    required this.textureId,
+    this.tolerance,
+    required this.scrubbing,
+  });
+
+  int textureId;
+
+  double? tolerance;
+
+  bool scrubbing;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      tolerance,
+      scrubbing,
+    ];
+  }
+
+  static SeekModeMessage decode(Object result) {
+    result as List<Object?>;
+    return SeekModeMessage(
+      textureId: result[0]! as int,
+      tolerance: result[1] as double?,
+      scrubbing: result[2]! as bool,
+    );
+  }
+}
+
+class AudioOnlyMessage {
+  AudioOnlyMessage({
+    required this.textureId,
+    required this.audioOnly,
+  });
+
+  int textureId;
+
+  bool audioOnly;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      audioOnly,
+    ];
+  }
+
+  static AudioOnlyMessage decode(Object result) {
+    result as List<Object?>;
+    return AudioOnlyMessage(
+      textureId: result[0]! as int,
+      audioOnly: result[1]! as bool,
+    );
+  }
+}
+
+class BufferingUpdateIntervalMessage {
+  BufferingUpdateIntervalMessage({
+    required this.textureId,
+    required this.interval,
+  });
+
+  int textureId;
+
+  int interval;
+
+  Object encode() {
+    return <Object?>[
+      textureId,
+      interval,
+    ];
+  }
+
+  static BufferingUpdateIntervalMessage decode(Object result) {
+    result as List<Object?>;
+    return BufferingUpdateIntervalMessage(
+      textureId: result[0]! as int,
+      interval: result[1]! as int,
+    );
+  }
+}
+
 class CreateMessage {
   CreateMessage({
     this.asset,
@@ -189,6 +374,189 @@ class CreateMessage {
   }
 }
 
+class PreloadMessage {
+  PreloadMessage({
+    required this.uri,
+    required this.httpHeaders,
+    this.preferredForwardBufferDuration,
+  });
+
+  String uri;
+
+  Map<String?, String?> httpHeaders;
+
+  double? preferredForwardBufferDuration;
+
+  Object encode() {
+    return <Object?>[
+      uri,
+      httpHeaders,
+      preferredForwardBufferDuration,
+    ];
+  }
+
+  static PreloadMessage decode(Object result) {
+    result as List<Object?>;
+    return PreloadMessage(
+      uri: result[0]! as String,
+      httpHeaders:
+          (result[1] as Map<Object?, Object?>?)!.cast<String?, String?>(),
+      preferredForwardBufferDuration: result[2] as double?,
+    );
+  }
+}
+
+class PrefetchMessage {
+  PrefetchMessage({
+    required this.uri,
+    required this.httpHeaders,
+    required this.duration,
+  });
+
+  String uri;
+
+  Map<String?, String?> httpHeaders;
+
+  double duration;
+
+  Object encode() {
+    return <Object?>[
+      uri,
+      httpHeaders,
+      duration,
+    ];
+  }
+
+  static PrefetchMessage decode(Object result) {
+    result as List<Object?>;
+    return PrefetchMessage(
+      uri: result[0]! as String,
+      httpHeaders:
+          (result[1] as Map<Object?, Object?>?)!.cast<String?, String?>(),
+      duration: result[2]! as double,
+    );
+  }
+}
+
+class ThumbnailsMessage {
+  ThumbnailsMessage({
+    required this.requestId,
+    this.textureId,
+    this.uri,
+    required this.httpHeaders,
+    required this.times,
+    required this.maxWidth,
+    required this.maxHeight,
+    this.tolerance,
+  });
+
+  int requestId;
+
+  int? textureId;
+
+  String? uri;
+
+  Map<String?, String?> httpHeaders;
+
+  List<int?> times;
+
+  double maxWidth;
+
+  double maxHeight;
+
+  int? tolerance;
+
+  Object encode() {
+    return <Object?>[
+      requestId,
+      textureId,
+      uri,
+      httpHeaders,
+      times,
+      maxWidth,
+      maxHeight,
+      tolerance,
+    ];
+  }
+
+  static ThumbnailsMessage decode(Object result) {
+    result as List<Object?>;
+    return ThumbnailsMessage(
+      requestId: result[0]! as int,
+      textureId: result[1] as int?,
+      uri: result[2] as String?,
+      httpHeaders:
+          (result[3] as Map<Object?, Object?>?)!.cast<String?, String?>(),
+      times: (result[4] as List<Object?>?)!.cast<int?>(),
+      maxWidth: result[5]! as double,
+      maxHeight: result[6]! as double,
+      tolerance: result[7] as int?,
+    );
+  }
+}
+
+class VideoOutputOptionsMessage {
+  VideoOutputOptionsMessage({
+    required this.useYuvPixelFormat,
+    this.maximumWidth,
+    this.maximumHeight,
+    required this.audioOnly,
+  });
+
+  bool useYuvPixelFormat;
+
+  double? maximumWidth;
+
+  double? maximumHeight;
+
+  bool audioOnly;
+
+  Object encode() {
+    return <Object?>[
+      useYuvPixelFormat,
+      maximumWidth,
+      maximumHeight,
+      audioOnly,
+    ];
+  }
+
+  static VideoOutputOptionsMessage decode(Object result) {
+    result as List<Object?>;
+    return VideoOutputOptionsMessage(
+      useYuvPixelFormat: result[0]! as bool,
+      maximumWidth: result[1] as double?,
+      maximumHeight: result[2] as double?,
+      audioOnly: result[3]! as bool,
+    );
+  }
+}
+
+class CacheOptionsMessage {
+  CacheOptionsMessage({
+    required this.enabled,
+    required this.maximumSize,
+  });
+
+  bool enabled;
+
+  int maximumSize;
+
+  Object encode() {
+    return <Object?>[
+      enabled,
+      maximumSize,
+    ];
+  }
+
+  static CacheOptionsMessage decode(Object result) {
+    result as List<Object?>;
+    return CacheOptionsMessage(
+      enabled: result[0]! as bool,
+      maximumSize: result[1]! as int,
+    );
+  }
+}
+
 class MixWithOthersMessage {
   MixWithOthersMessage({
     required this.mixWithOthers,
@@ -214,27 +582,57 @@ class _AVFoundationVideoPlayerApiCodec extends StandardMessageCodec {
   const _AVFoundationVideoPlayerApiCodec();
   @override
   void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is CreateMessage) {
+    if (value is AudioOnlyMessage) {
       buffer.putUint8(128);
       writeValue(buffer, value.encode());
-    } else if (value is LoopingMessage) {
+    } else if (value is BufferingUpdateIntervalMessage) {
       buffer.putUint8(129);
       writeValue(buffer, value.encode());
-    } else if (value is MixWithOthersMessage) {
+    } else if (value is CacheOptionsMessage) {
       buffer.putUint8(130);
       writeValue(buffer, value.encode());
-    } else if (value is PlaybackSpeedMessage) {
+    } else if (value is CreateMessage) {
       buffer.putUint8(131);
       writeValue(buffer, value.encode());
-    } else if (value is PositionMessage) {
+    } else if (value is LoopingMessage) {
       buffer.putUint8(132);
       writeValue(buffer, value.encode());
-    } else if (value is TextureMessage) {
+    } else if (value is MixWithOthersMessage) {
       buffer.putUint8(133);
       writeValue(buffer, value.encode());
-    } else if (value is VolumeMessage) {
+    } else if (value is PlaybackConstraintsMessage) {
       buffer.putUint8(134);
       writeValue(buffer, value.encode());
+    } else if (value is PlaybackSpeedMessage) {
+      buffer.putUint8(135);
+      writeValue(buffer, value.encode());
+    } else if (value is PlaybackStatsMessage) {
+      buffer.putUint8(136);
+      writeValue(buffer, value.encode());
+    } else if (value is PositionMessage) {
+      buffer.putUint8(137);
+      writeValue(buffer, value.encode());
+    } else if (value is PrefetchMessage) {
+      buffer.putUint8(138);
+      writeValue(buffer, value.encode());
+    } else if (value is PreloadMessage) {
+      buffer.putUint8(139);
+      writeValue(buffer, value.encode());
+    } else if (value is SeekModeMessage) {
+      buffer.putUint8(140);
+      writeValue(buffer, value.encode());
+    } else if (value is TextureMessage) {
+      buffer.putUint8(141);
+      writeValue(buffer, value.encode());
+    } else if (value is ThumbnailsMessage) {
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
+    } else if (value is VideoOutputOptionsMessage) {
+      buffer.putUint8(143);
+      writeValue(buffer, value.encode());
+    } else if (value is VolumeMessage) {
+      buffer.putUint8(144);
+      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -244,18 +642,38 @@ class _AVFoundationVideoPlayerApiCodec extends StandardMessageCodec {
   Object? readValueOfType(int type, ReadBuffer buffer) {
     switch (type) {
       case 128:
-        return CreateMessage.decode(readValue(buffer)!);
+        return AudioOnlyMessage.decode(readValue(buffer)!);
       case 129:
-        return LoopingMessage.decode(readValue(buffer)!);
+        return BufferingUpdateIntervalMessage.decode(readValue(buffer)!);
       case 130:
-        return MixWithOthersMessage.decode(readValue(buffer)!);
+        return CacheOptionsMessage.decode(readValue(buffer)!);
       case 131:
-        return PlaybackSpeedMessage.decode(readValue(buffer)!);
+        return CreateMessage.decode(readValue(buffer)!);
       case 132:
-        return PositionMessage.decode(readValue(buffer)!);
+        return LoopingMessage.decode(readValue(buffer)!);
       case 133:
-        return TextureMessage.decode(readValue(buffer)!);
+        return MixWithOthersMessage.decode(readValue(buffer)!);
       case 134:
+        return PlaybackConstraintsMessage.decode(readValue(buffer)!);
+      case 135:
+        return PlaybackSpeedMessage.decode(readValue(buffer)!);
+      case 136:
+        return PlaybackStatsMessage.decode(readValue(buffer)!);
+      case 137:
+        return PositionMessage.decode(readValue(buffer)!);
+      case 138:
+        return PrefetchMessage.decode(readValue(buffer)!);
+      case 139:
+        return PreloadMessage.decode(readValue(buffer)!);
+      case 140:
+        return SeekModeMessage.decode(readValue(buffer)!);
+      case 141:
+        return TextureMessage.decode(readValue(buffer)!);
+      case 142:
+        return ThumbnailsMessage.decode(readValue(buffer)!);
+      case 143:
+        return VideoOutputOptionsMessage.decode(readValue(buffer)!);
+      case 144:
         return VolumeMessage.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
@@ -323,6 +741,75 @@ class AVFoundationVideoPlayerApi {
     }
   }
 
+  Future<void> preload(PreloadMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.preload',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> prefetch(PrefetchMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.prefetch',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> generateThumbnails(ThumbnailsMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.generateThumbnails',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
   Future<void> dispose(TextureMessage arg_msg) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.dispose',
@@ -415,6 +902,30 @@ class AVFoundationVideoPlayerApi {
     }
   }
 
+  Future<void> setPlaybackConstraints(
+      PlaybackConstraintsMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.setPlaybackConstraints',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
   Future<void> play(TextureMessage arg_msg) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.play',
@@ -466,6 +977,34 @@ class AVFoundationVideoPlayerApi {
     }
   }
 
+  Future<PlaybackStatsMessage> getPlaybackStats(TextureMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.getPlaybackStats',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as PlaybackStatsMessage?)!;
+    }
+  }
+
   Future<void> seekTo(PositionMessage arg_msg) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.seekTo',
@@ -489,6 +1028,76 @@ class AVFoundationVideoPlayerApi {
     }
   }
 
+  Future<void> setSeekMode(SeekModeMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.setSeekMode',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setAudioOnly(AudioOnlyMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.setAudioOnly',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setBufferingUpdateInterval(
+      BufferingUpdateIntervalMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.setBufferingUpdateInterval',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
   Future<void> pause(TextureMessage arg_msg) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
         'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.pause',
@@ -534,4 +1143,50 @@ class AVFoundationVideoPlayerApi {
       return;
     }
   }
+
+  Future<void> setVideoOutputOptions(VideoOutputOptionsMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.setVideoOutputOptions',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setCacheOptions(CacheOptionsMessage arg_msg) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.video_player_avfoundation.AVFoundationVideoPlayerApi.setCacheOptions',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_msg]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
 }
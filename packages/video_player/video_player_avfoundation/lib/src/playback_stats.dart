@@ -0,0 +1,51 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// A snapshot of how well a video has been playing, for monitoring playback
+/// health.
+///
+/// The network figures come from the player item's access and error logs, so
+/// they are only available for streamed video.
+class AVFoundationPlaybackStats {
+  /// Creates a snapshot of playback statistics.
+  const AVFoundationPlaybackStats({
+    this.indicatedBitrate,
+    this.observedBitrate,
+    this.startupTime,
+    required this.stallCount,
+    required this.droppedVideoFrameCount,
+    required this.errorCount,
+    required this.idleDisplayLinkFireCount,
+    required this.nullPixelBufferCount,
+  });
+
+  /// The bit rate, in bits per second, that the current stream variant
+  /// advertises, or null if unknown.
+  final double? indicatedBitrate;
+
+  /// The download bit rate, in bits per second, measured for the current
+  /// stream variant, or null if unknown.
+  final double? observedBitrate;
+
+  /// How long playback took to start, or null if unknown.
+  final Duration? startupTime;
+
+  /// The number of times playback stalled waiting for data.
+  final int stallCount;
+
+  /// The number of video frames the decoder dropped.
+  final int droppedVideoFrameCount;
+
+  /// The number of network and decoding errors that were logged.
+  final int errorCount;
+
+  /// The number of display refreshes at which no new frame was ready.
+  ///
+  /// Only counted on macOS. iOS hands the engine a frame at every refresh,
+  /// so see [nullPixelBufferCount] there instead.
+  final int idleDisplayLinkFireCount;
+
+  /// The number of times Flutter asked for a frame and none was available.
+  final int nullPixelBufferCount;
+}
@@ -0,0 +1,26 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'dart:typed_data';
+
+/// A still image of a video, generated by
+/// [AVFoundationVideoPlayer.generateThumbnails].
+class AVFoundationVideoThumbnail {
+  /// Creates a thumbnail.
+  const AVFoundationVideoThumbnail({
+    required this.requestedTime,
+    required this.time,
+    required this.bytes,
+  });
+
+  /// The time that the thumbnail was requested at.
+  final Duration requestedTime;
+
+  /// The time of the frame that the thumbnail shows, which may differ from
+  /// [requestedTime] within the requested tolerance.
+  final Duration time;
+
+  /// The thumbnail, encoded as JPEG.
+  final Uint8List bytes;
+}
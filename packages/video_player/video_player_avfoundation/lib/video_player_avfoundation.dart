@@ -3,3 +3,5 @@
 // found in the LICENSE file.
 
 export 'src/avfoundation_video_player.dart';
+export 'src/playback_stats.dart';
+export 'src/video_thumbnail.dart';
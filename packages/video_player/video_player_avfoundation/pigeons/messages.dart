@@ -37,12 +37,67 @@ class PlaybackSpeedMessage {
   double speed;
 }
 
+class PlaybackConstraintsMessage {
+  PlaybackConstraintsMessage(this.textureId);
+  int textureId;
+  // Null fields leave the corresponding constraint unchanged, and 0 removes it.
+  double? preferredPeakBitRate;
+  double? preferredMaximumWidth;
+  double? preferredMaximumHeight;
+  // In seconds.
+  double? preferredForwardBufferDuration;
+}
+
+class PlaybackStatsMessage {
+  PlaybackStatsMessage({
+    required this.textureId,
+    required this.stallCount,
+    required this.droppedVideoFrameCount,
+    required this.errorCount,
+    required this.idleDisplayLinkFireCount,
+    required this.nullPixelBufferCount,
+  });
+  int textureId;
+  // From the latest access log event, in bits per second.
+  double? indicatedBitrate;
+  double? observedBitrate;
+  // In seconds.
+  double? startupTime;
+  int stallCount;
+  int droppedVideoFrameCount;
+  int errorCount;
+  int idleDisplayLinkFireCount;
+  int nullPixelBufferCount;
+}
+
 class PositionMessage {
   PositionMessage(this.textureId, this.position);
   int textureId;
   int position;
 }
 
+class SeekModeMessage {
+  SeekModeMessage(this.textureId, this.scrubbing);
+  int textureId;
+  // How far, in seconds, seeks may land from the requested position. Null
+  // lets the player seek to whichever nearby position is fastest to reach.
+  double? tolerance;
+  bool scrubbing;
+}
+
+class AudioOnlyMessage {
+  AudioOnlyMessage(this.textureId, this.audioOnly);
+  int textureId;
+  bool audioOnly;
+}
+
+class BufferingUpdateIntervalMessage {
+  BufferingUpdateIntervalMessage(this.textureId, this.interval);
+  int textureId;
+  // The minimum time between buffering updates, in milliseconds.
+  int interval;
+}
+
 class CreateMessage {
   CreateMessage({required this.httpHeaders});
   String? asset;
@@ -52,6 +107,66 @@ class CreateMessage {
   Map<String?, String?> httpHeaders;
 }
 
+class PreloadMessage {
+  PreloadMessage({required this.uri, required this.httpHeaders});
+  String uri;
+  Map<String?, String?> httpHeaders;
+  // The preferred forward buffer duration, in seconds.
+  double? preferredForwardBufferDuration;
+}
+
+class PrefetchMessage {
+  PrefetchMessage({
+    required this.uri,
+    required this.httpHeaders,
+    required this.duration,
+  });
+  String uri;
+  Map<String?, String?> httpHeaders;
+  // How much of the start of the video to download, in seconds.
+  double duration;
+}
+
+class ThumbnailsMessage {
+  ThumbnailsMessage({
+    required this.requestId,
+    required this.httpHeaders,
+    required this.times,
+    required this.maxWidth,
+    required this.maxHeight,
+  });
+  // Identifies the event channel that the thumbnails are sent on.
+  int requestId;
+  // The player whose asset to read the thumbnails from, if any. Otherwise,
+  // they are read from [uri].
+  int? textureId;
+  String? uri;
+  Map<String?, String?> httpHeaders;
+  // In milliseconds.
+  List<int?> times;
+  // In pixels, or 0 for no limit.
+  double maxWidth;
+  double maxHeight;
+  // How far, in milliseconds, each thumbnail may be from its requested time,
+  // or null for no limit.
+  int? tolerance;
+}
+
+class VideoOutputOptionsMessage {
+  VideoOutputOptionsMessage(this.useYuvPixelFormat, this.audioOnly);
+  bool useYuvPixelFormat;
+  double? maximumWidth;
+  double? maximumHeight;
+  bool audioOnly;
+}
+
+class CacheOptionsMessage {
+  CacheOptionsMessage(this.enabled, this.maximumSize);
+  bool enabled;
+  // In bytes.
+  int maximumSize;
+}
+
 class MixWithOthersMessage {
   MixWithOthersMessage(this.mixWithOthers);
   bool mixWithOthers;
@@ -63,6 +178,12 @@ abstract class AVFoundationVideoPlayerApi {
   void initialize();
   @ObjCSelector('create:')
   TextureMessage create(CreateMessage msg);
+  @ObjCSelector('preload:')
+  void preload(PreloadMessage msg);
+  @ObjCSelector('prefetch:')
+  void prefetch(PrefetchMessage msg);
+  @ObjCSelector('generateThumbnails:')
+  void generateThumbnails(ThumbnailsMessage msg);
   @ObjCSelector('dispose:')
   void dispose(TextureMessage msg);
   @ObjCSelector('setLooping:')
@@ -71,15 +192,29 @@ abstract class AVFoundationVideoPlayerApi {
   void setVolume(VolumeMessage msg);
   @ObjCSelector('setPlaybackSpeed:')
   void setPlaybackSpeed(PlaybackSpeedMessage msg);
+  @ObjCSelector('setPlaybackConstraints:')
+  void setPlaybackConstraints(PlaybackConstraintsMessage msg);
   @ObjCSelector('play:')
   void play(TextureMessage msg);
   @ObjCSelector('position:')
   PositionMessage position(TextureMessage msg);
+  @ObjCSelector('playbackStats:')
+  PlaybackStatsMessage getPlaybackStats(TextureMessage msg);
   @async
   @ObjCSelector('seekTo:')
   void seekTo(PositionMessage msg);
+  @ObjCSelector('setSeekMode:')
+  void setSeekMode(SeekModeMessage msg);
+  @ObjCSelector('setAudioOnly:')
+  void setAudioOnly(AudioOnlyMessage msg);
+  @ObjCSelector('setBufferingUpdateInterval:')
+  void setBufferingUpdateInterval(BufferingUpdateIntervalMessage msg);
   @ObjCSelector('pause:')
   void pause(TextureMessage msg);
   @ObjCSelector('setMixWithOthers:')
   void setMixWithOthers(MixWithOthersMessage msg);
+  @ObjCSelector('setVideoOutputOptions:')
+  void setVideoOutputOptions(VideoOutputOptionsMessage msg);
+  @ObjCSelector('setCacheOptions:')
+  void setCacheOptions(CacheOptionsMessage msg);
 }
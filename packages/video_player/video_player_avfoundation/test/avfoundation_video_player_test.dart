@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 import 'package:flutter/services.dart';
+import 'package:flutter/widgets.dart';
 import 'package:flutter_test/flutter_test.dart';
 import 'package:video_player_avfoundation/src/messages.g.dart';
 import 'package:video_player_avfoundation/video_player_avfoundation.dart';
@@ -19,6 +20,15 @@ class _ApiLogger implements TestHostVideoPlayerApi {
   VolumeMessage? volumeMessage;
   PlaybackSpeedMessage? playbackSpeedMessage;
   MixWithOthersMessage? mixWithOthersMessage;
+  PreloadMessage? preloadMessage;
+  PlaybackConstraintsMessage? playbackConstraintsMessage;
+  VideoOutputOptionsMessage? videoOutputOptionsMessage;
+  SeekModeMessage? seekModeMessage;
+  AudioOnlyMessage? audioOnlyMessage;
+  BufferingUpdateIntervalMessage? bufferingUpdateIntervalMessage;
+  PrefetchMessage? prefetchMessage;
+  CacheOptionsMessage? cacheOptionsMessage;
+  ThumbnailsMessage? thumbnailsMessage;
 
   @override
   TextureMessage create(CreateMessage arg) {
@@ -27,6 +37,30 @@ class _ApiLogger implements TestHostVideoPlayerApi {
     return TextureMessage(textureId: 3);
   }
 
+  @override
+  void preload(PreloadMessage arg) {
+    log.add('preload');
+    preloadMessage = arg;
+  }
+
+  @override
+  void prefetch(PrefetchMessage arg) {
+    log.add('prefetch');
+    prefetchMessage = arg;
+  }
+
+  @override
+  void generateThumbnails(ThumbnailsMessage arg) {
+    log.add('generateThumbnails');
+    thumbnailsMessage = arg;
+  }
+
+  @override
+  void setCacheOptions(CacheOptionsMessage arg) {
+    log.add('setCacheOptions');
+    cacheOptionsMessage = arg;
+  }
+
   @override
   void dispose(TextureMessage arg) {
     log.add('dispose');
@@ -56,6 +90,12 @@ class _ApiLogger implements TestHostVideoPlayerApi {
     mixWithOthersMessage = arg;
   }
 
+  @override
+  void setVideoOutputOptions(VideoOutputOptionsMessage arg) {
+    log.add('setVideoOutputOptions');
+    videoOutputOptionsMessage = arg;
+  }
+
   @override
   PositionMessage position(TextureMessage arg) {
     log.add('position');
@@ -63,12 +103,47 @@ class _ApiLogger implements TestHostVideoPlayerApi {
     return PositionMessage(textureId: arg.textureId, position: 234);
   }
 
+  @override
+  PlaybackStatsMessage getPlaybackStats(TextureMessage arg) {
+    log.add('getPlaybackStats');
+    textureMessage = arg;
+    return PlaybackStatsMessage(
+      textureId: arg.textureId,
+      indicatedBitrate: 2000000,
+      observedBitrate: 5500000,
+      startupTime: 0.25,
+      stallCount: 2,
+      droppedVideoFrameCount: 12,
+      errorCount: 1,
+      idleDisplayLinkFireCount: 30,
+      nullPixelBufferCount: 4,
+    );
+  }
+
   @override
   Future<void> seekTo(PositionMessage arg) async {
     log.add('seekTo');
     positionMessage = arg;
   }
 
+  @override
+  void setSeekMode(SeekModeMessage arg) {
+    log.add('setSeekMode');
+    seekModeMessage = arg;
+  }
+
+  @override
+  void setAudioOnly(AudioOnlyMessage arg) {
+    log.add('setAudioOnly');
+    audioOnlyMessage = arg;
+  }
+
+  @override
+  void setBufferingUpdateInterval(BufferingUpdateIntervalMessage arg) {
+    log.add('setBufferingUpdateInterval');
+    bufferingUpdateIntervalMessage = arg;
+  }
+
   @override
   void setLooping(LoopingMessage arg) {
     log.add('setLooping');
@@ -86,6 +161,12 @@ class _ApiLogger implements TestHostVideoPlayerApi {
     log.add('setPlaybackSpeed');
     playbackSpeedMessage = arg;
   }
+
+  @override
+  void setPlaybackConstraints(PlaybackConstraintsMessage arg) {
+    log.add('setPlaybackConstraints');
+    playbackConstraintsMessage = arg;
+  }
 }
 
 void main() {
@@ -158,6 +239,50 @@ void main() {
       expect(textureId, 3);
     });
 
+    test('preload', () async {
+      await player.preload(
+        'someUri',
+        httpHeaders: <String, String>{'Authorization': 'Bearer token'},
+        preferredForwardBufferDuration: const Duration(milliseconds: 2500),
+      );
+      expect(log.log.last, 'preload');
+      expect(log.preloadMessage?.uri, 'someUri');
+      expect(log.preloadMessage?.httpHeaders,
+          <String, String>{'Authorization': 'Bearer token'});
+      expect(log.preloadMessage?.preferredForwardBufferDuration, 2.5);
+    });
+
+    test('prefetch', () async {
+      await player.prefetch(
+        'someUri',
+        httpHeaders: <String, String>{'Authorization': 'Bearer token'},
+        duration: const Duration(milliseconds: 4500),
+      );
+      expect(log.log.last, 'prefetch');
+      expect(log.prefetchMessage?.uri, 'someUri');
+      expect(log.prefetchMessage?.httpHeaders,
+          <String, String>{'Authorization': 'Bearer token'});
+      expect(log.prefetchMessage?.duration, 4.5);
+    });
+
+    test('setCacheOptions', () async {
+      await player.setCacheOptions(enabled: true, maximumSize: 1000000);
+      expect(log.log.last, 'setCacheOptions');
+      expect(log.cacheOptionsMessage?.enabled, true);
+      expect(log.cacheOptionsMessage?.maximumSize, 1000000);
+
+      await player.setCacheOptions(enabled: false);
+      expect(log.cacheOptionsMessage?.enabled, false);
+      expect(log.cacheOptionsMessage?.maximumSize, 0);
+    });
+
+    test('preload without forward buffer duration', () async {
+      await player.preload('someUri');
+      expect(log.log.last, 'preload');
+      expect(log.preloadMessage?.httpHeaders, <String, String>{});
+      expect(log.preloadMessage?.preferredForwardBufferDuration, null);
+    });
+
     test('create with network (some headers)', () async {
       final int? textureId = await player.create(DataSource(
         sourceType: DataSourceType.network,
@@ -191,6 +316,83 @@ void main() {
       expect(log.loopingMessage?.isLooping, true);
     });
 
+    test('setPlaybackConstraints', () async {
+      await player.setPlaybackConstraints(
+        1,
+        preferredPeakBitRate: 500000,
+        preferredMaximumResolution: const Size(640, 360),
+        preferredForwardBufferDuration: const Duration(seconds: 3),
+      );
+      expect(log.log.last, 'setPlaybackConstraints');
+      expect(log.playbackConstraintsMessage?.textureId, 1);
+      expect(log.playbackConstraintsMessage?.preferredPeakBitRate, 500000);
+      expect(log.playbackConstraintsMessage?.preferredMaximumWidth, 640);
+      expect(log.playbackConstraintsMessage?.preferredMaximumHeight, 360);
+      expect(
+          log.playbackConstraintsMessage?.preferredForwardBufferDuration, 3);
+    });
+
+    test('setPlaybackConstraints leaves unset constraints unchanged',
+        () async {
+      await player.setPlaybackConstraints(1, preferredPeakBitRate: 0);
+      expect(log.playbackConstraintsMessage?.preferredPeakBitRate, 0);
+      expect(log.playbackConstraintsMessage?.preferredMaximumWidth, null);
+      expect(log.playbackConstraintsMessage?.preferredMaximumHeight, null);
+      expect(log.playbackConstraintsMessage?.preferredForwardBufferDuration,
+          null);
+    });
+
+    testWidgets('buildView limits the resolution to the rendered size',
+        (WidgetTester tester) async {
+      await tester.pumpWidget(MediaQuery(
+        data: const MediaQueryData(devicePixelRatio: 2),
+        child: Center(
+          child: SizedBox(
+            width: 160,
+            height: 90,
+            child: player.buildView(2),
+          ),
+        ),
+      ));
+      expect(log.log.last, 'setPlaybackConstraints');
+      expect(log.playbackConstraintsMessage?.textureId, 2);
+      expect(log.playbackConstraintsMessage?.preferredMaximumWidth, 320);
+      expect(log.playbackConstraintsMessage?.preferredMaximumHeight, 180);
+      expect(log.playbackConstraintsMessage?.preferredPeakBitRate, null);
+
+      // Laying out again at the same size doesn't resend it.
+      log.log.clear();
+      await tester.pumpWidget(MediaQuery(
+        data: const MediaQueryData(devicePixelRatio: 2),
+        child: Center(
+          child: SizedBox(
+            width: 160,
+            height: 90,
+            child: player.buildView(2),
+          ),
+        ),
+      ));
+      expect(log.log, isEmpty);
+    });
+
+    testWidgets('buildView does not override an explicit maximum resolution',
+        (WidgetTester tester) async {
+      await player.setPlaybackConstraints(4,
+          preferredMaximumResolution: const Size(640, 360));
+      log.log.clear();
+      await tester.pumpWidget(MediaQuery(
+        data: const MediaQueryData(devicePixelRatio: 2),
+        child: Center(
+          child: SizedBox(
+            width: 160,
+            height: 90,
+            child: player.buildView(4),
+          ),
+        ),
+      ));
+      expect(log.log, isEmpty);
+    });
+
     test('play', () async {
       await player.play(1);
       expect(log.log.last, 'play');
@@ -213,6 +415,40 @@ void main() {
       expect(log.mixWithOthersMessage?.mixWithOthers, false);
     });
 
+    test('setVideoOutputOptions', () async {
+      await player.setVideoOutputOptions(
+        pixelFormat: AVFoundationPixelFormat.yuv420BiPlanar,
+        maximumSize: const Size(1280, 720),
+        audioOnly: true,
+      );
+      expect(log.log.last, 'setVideoOutputOptions');
+      expect(log.videoOutputOptionsMessage?.useYuvPixelFormat, true);
+      expect(log.videoOutputOptionsMessage?.maximumWidth, 1280);
+      expect(log.videoOutputOptionsMessage?.maximumHeight, 720);
+      expect(log.videoOutputOptionsMessage?.audioOnly, true);
+
+      await player.setVideoOutputOptions();
+      expect(log.videoOutputOptionsMessage?.useYuvPixelFormat, false);
+      expect(log.videoOutputOptionsMessage?.maximumWidth, null);
+      expect(log.videoOutputOptionsMessage?.maximumHeight, null);
+      expect(log.videoOutputOptionsMessage?.audioOnly, false);
+    });
+
+    test('setAudioOnly', () async {
+      await player.setAudioOnly(1, true);
+      expect(log.log.last, 'setAudioOnly');
+      expect(log.audioOnlyMessage?.textureId, 1);
+      expect(log.audioOnlyMessage?.audioOnly, true);
+    });
+
+    test('setBufferingUpdateInterval', () async {
+      await player.setBufferingUpdateInterval(
+          1, const Duration(milliseconds: 500));
+      expect(log.log.last, 'setBufferingUpdateInterval');
+      expect(log.bufferingUpdateIntervalMessage?.textureId, 1);
+      expect(log.bufferingUpdateIntervalMessage?.interval, 500);
+    });
+
     test('setVolume', () async {
       await player.setVolume(1, 0.7);
       expect(log.log.last, 'setVolume');
@@ -234,6 +470,29 @@ void main() {
       expect(log.positionMessage?.position, 12345);
     });
 
+    test('setSeekMode', () async {
+      await player.setSeekMode(
+        1,
+        const AVFoundationSeekMode.tolerance(Duration(milliseconds: 500)),
+        scrubbing: true,
+      );
+      expect(log.log.last, 'setSeekMode');
+      expect(log.seekModeMessage?.textureId, 1);
+      expect(log.seekModeMessage?.tolerance, 0.5);
+      expect(log.seekModeMessage?.scrubbing, true);
+    });
+
+    test('setSeekMode exact', () async {
+      await player.setSeekMode(1, const AVFoundationSeekMode.exact());
+      expect(log.seekModeMessage?.tolerance, 0);
+      expect(log.seekModeMessage?.scrubbing, false);
+    });
+
+    test('setSeekMode keyframe', () async {
+      await player.setSeekMode(1, const AVFoundationSeekMode.keyframe());
+      expect(log.seekModeMessage?.tolerance, null);
+    });
+
     test('getPosition', () async {
       final Duration position = await player.getPosition(1);
       expect(log.log.last, 'position');
@@ -241,6 +500,99 @@ void main() {
       expect(position, const Duration(milliseconds: 234));
     });
 
+    test('getPlaybackStats', () async {
+      final AVFoundationPlaybackStats stats = await player.getPlaybackStats(1);
+      expect(log.log.last, 'getPlaybackStats');
+      expect(log.textureMessage?.textureId, 1);
+      expect(stats.indicatedBitrate, 2000000);
+      expect(stats.observedBitrate, 5500000);
+      expect(stats.startupTime, const Duration(milliseconds: 250));
+      expect(stats.stallCount, 2);
+      expect(stats.droppedVideoFrameCount, 12);
+      expect(stats.errorCount, 1);
+      expect(stats.idleDisplayLinkFireCount, 30);
+      expect(stats.nullPixelBufferCount, 4);
+    });
+
+    test('generateThumbnails', () async {
+      // The first request of the player.
+      const String mockChannel = 'flutter.io/videoPlayer/thumbnails0';
+      _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+          .defaultBinaryMessenger
+          .setMockMessageHandler(
+        mockChannel,
+        (ByteData? message) async {
+          final MethodCall methodCall =
+              const StandardMethodCodec().decodeMethodCall(message);
+          if (methodCall.method == 'listen') {
+            await _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+                .defaultBinaryMessenger
+                .handlePlatformMessage(
+                    mockChannel,
+                    const StandardMethodCodec()
+                        .encodeSuccessEnvelope(<String, dynamic>{
+                      'requestedTime': 1000,
+                      'time': 1020,
+                      'bytes': Uint8List.fromList(<int>[1, 2, 3]),
+                    }),
+                    (ByteData? data) {});
+            await _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+                .defaultBinaryMessenger
+                .handlePlatformMessage(
+                    mockChannel,
+                    const StandardMethodCodec().encodeErrorEnvelope(
+                        code: 'VideoError',
+                        details: <String, dynamic>{'requestedTime': 2000}),
+                    (ByteData? data) {});
+            await _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
+                .defaultBinaryMessenger
+                .handlePlatformMessage(mockChannel, null, (ByteData? data) {});
+
+            return const StandardMethodCodec().encodeSuccessEnvelope(null);
+          } else if (methodCall.method == 'cancel') {
+            return const StandardMethodCodec().encodeSuccessEnvelope(null);
+          } else {
+            fail('Expected listen or cancel');
+          }
+        },
+      );
+
+      final Stream<AVFoundationVideoThumbnail> thumbnails =
+          player.generateThumbnails(
+        textureId: 3,
+        times: const <Duration>[
+          Duration(seconds: 1),
+          Duration(seconds: 2),
+        ],
+        maxSize: const Size(160, 90),
+        tolerance: const Duration(milliseconds: 100),
+      );
+      await expectLater(
+          thumbnails,
+          emitsInOrder(<dynamic>[
+            isA<AVFoundationVideoThumbnail>()
+                .having((AVFoundationVideoThumbnail thumbnail) =>
+                    thumbnail.requestedTime, 'requestedTime',
+                    const Duration(seconds: 1))
+                .having((AVFoundationVideoThumbnail thumbnail) =>
+                    thumbnail.time, 'time',
+                    const Duration(milliseconds: 1020))
+                .having((AVFoundationVideoThumbnail thumbnail) =>
+                    thumbnail.bytes, 'bytes', <int>[1, 2, 3]),
+            emitsError(isA<PlatformException>()),
+            emitsDone,
+          ]));
+
+      expect(log.log.last, 'generateThumbnails');
+      expect(log.thumbnailsMessage?.requestId, 0);
+      expect(log.thumbnailsMessage?.textureId, 3);
+      expect(log.thumbnailsMessage?.uri, null);
+      expect(log.thumbnailsMessage?.times, <int>[1000, 2000]);
+      expect(log.thumbnailsMessage?.maxWidth, 160);
+      expect(log.thumbnailsMessage?.maxHeight, 90);
+      expect(log.thumbnailsMessage?.tolerance, 100);
+    });
+
     test('videoEventsFor', () async {
       const String mockChannel = 'flutter.io/videoPlayer/videoEvents123';
       _ambiguate(TestDefaultBinaryMessengerBinding.instance)!
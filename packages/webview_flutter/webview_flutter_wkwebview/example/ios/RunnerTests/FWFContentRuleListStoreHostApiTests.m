@@ -0,0 +1,129 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import Flutter;
+@import XCTest;
+@import webview_flutter_wkwebview;
+
+#import <OCMock/OCMock.h>
+
+@interface FWFContentRuleListStoreHostApiTests : XCTestCase
+@end
+
+@implementation FWFContentRuleListStoreHostApiTests
+- (void)testCreateDefaultStoreWithIdentifier {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFContentRuleListStoreHostApiImpl *hostAPI =
+      [[FWFContentRuleListStoreHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createDefaultStoreWithIdentifier:0 error:&error];
+  WKContentRuleListStore *store =
+      (WKContentRuleListStore *)[instanceManager instanceForIdentifier:0];
+  XCTAssertEqualObjects(store, [WKContentRuleListStore defaultStore]);
+  XCTAssertNil(error);
+}
+
+- (void)testCompileContentRuleList {
+  WKContentRuleListStore *mockStore = OCMClassMock([WKContentRuleListStore class]);
+  WKContentRuleList *mockRuleList = OCMClassMock([WKContentRuleList class]);
+  OCMStub([mockStore
+      compileContentRuleListForIdentifier:@"blocker"
+                   encodedContentRuleList:@"[]"
+                        completionHandler:([OCMArg invokeBlockWithArgs:mockRuleList,
+                                                                       [NSNull null], nil])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockStore withIdentifier:0];
+
+  FWFContentRuleListStoreHostApiImpl *hostAPI =
+      [[FWFContentRuleListStoreHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *__block blockError = [FlutterError errorWithCode:@"" message:nil details:nil];
+  [hostAPI compileContentRuleListForStoreWithIdentifier:0
+                                     ruleListIdentifier:@"blocker"
+                                 encodedContentRuleList:@"[]"
+                                             completion:^(FlutterError *error) {
+                                               blockError = error;
+                                             }];
+  XCTAssertNil(blockError);
+}
+
+- (void)testCompileContentRuleListWithError {
+  WKContentRuleListStore *mockStore = OCMClassMock([WKContentRuleListStore class]);
+  NSError *compileError = [NSError errorWithDomain:WKErrorDomain
+                                              code:WKErrorContentRuleListStoreCompileFailed
+                                          userInfo:nil];
+  OCMStub([mockStore
+      compileContentRuleListForIdentifier:@"blocker"
+                   encodedContentRuleList:@"invalid"
+                        completionHandler:([OCMArg invokeBlockWithArgs:[NSNull null],
+                                                                       compileError, nil])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockStore withIdentifier:0];
+
+  FWFContentRuleListStoreHostApiImpl *hostAPI =
+      [[FWFContentRuleListStoreHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *__block blockError;
+  [hostAPI compileContentRuleListForStoreWithIdentifier:0
+                                     ruleListIdentifier:@"blocker"
+                                 encodedContentRuleList:@"invalid"
+                                             completion:^(FlutterError *error) {
+                                               blockError = error;
+                                             }];
+  XCTAssertEqualObjects(blockError.code, @"FWFContentRuleListError");
+  XCTAssertEqual(((FWFNSErrorData *)blockError.details).code,
+                 WKErrorContentRuleListStoreCompileFailed);
+}
+
+- (void)testContainsContentRuleList {
+  WKContentRuleListStore *mockStore = OCMClassMock([WKContentRuleListStore class]);
+  OCMStub([mockStore
+      getAvailableContentRuleListIdentifiers:([OCMArg invokeBlockWithArgs:@[ @"blocker" ], nil])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockStore withIdentifier:0];
+
+  FWFContentRuleListStoreHostApiImpl *hostAPI =
+      [[FWFContentRuleListStoreHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  NSNumber __block *containsBlocker;
+  NSNumber __block *containsOther;
+  [hostAPI containsContentRuleListForStoreWithIdentifier:0
+                                      ruleListIdentifier:@"blocker"
+                                              completion:^(NSNumber *result, FlutterError *error) {
+                                                containsBlocker = result;
+                                              }];
+  [hostAPI containsContentRuleListForStoreWithIdentifier:0
+                                      ruleListIdentifier:@"other"
+                                              completion:^(NSNumber *result, FlutterError *error) {
+                                                containsOther = result;
+                                              }];
+  XCTAssertEqualObjects(containsBlocker, @YES);
+  XCTAssertEqualObjects(containsOther, @NO);
+}
+
+- (void)testRemoveContentRuleList {
+  WKContentRuleListStore *mockStore = OCMClassMock([WKContentRuleListStore class]);
+  OCMStub([mockStore
+      removeContentRuleListForIdentifier:@"blocker"
+                       completionHandler:([OCMArg invokeBlockWithArgs:[NSNull null], nil])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockStore withIdentifier:0];
+
+  FWFContentRuleListStoreHostApiImpl *hostAPI =
+      [[FWFContentRuleListStoreHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *__block blockError = [FlutterError errorWithCode:@"" message:nil details:nil];
+  [hostAPI removeContentRuleListForStoreWithIdentifier:0
+                                    ruleListIdentifier:@"blocker"
+                                            completion:^(FlutterError *error) {
+                                              blockError = error;
+                                            }];
+  XCTAssertNil(blockError);
+}
+@end
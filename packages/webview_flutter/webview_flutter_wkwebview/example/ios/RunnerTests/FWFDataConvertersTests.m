@@ -44,6 +44,30 @@
                         [NSHTTPCookie cookieWithProperties:@{NSHTTPCookieName : @"cookieName"}]);
 }
 
+- (void)testFWFNSHttpCookieDataFromNSHTTPCookie {
+  NSHTTPCookie *cookie = [NSHTTPCookie cookieWithProperties:@{
+    NSHTTPCookieName : @"cookieName",
+    NSHTTPCookieValue : @"cookieValue",
+    NSHTTPCookieDomain : @"flutter.dev",
+    NSHTTPCookiePath : @"/",
+    NSHTTPCookieExpires : [NSDate dateWithTimeIntervalSince1970:0],
+  }];
+
+  FWFNSHttpCookieData *data = FWFNSHttpCookieDataFromNativeNSHTTPCookie(cookie);
+  NSUInteger expiresIndex = [data.propertyKeys
+      indexOfObjectPassingTest:^BOOL(FWFNSHttpCookiePropertyKeyEnumData *key, NSUInteger index,
+                                     BOOL *stop) {
+        return key.value == FWFNSHttpCookiePropertyKeyEnumExpires;
+      }];
+  XCTAssertNotEqual(expiresIndex, NSNotFound);
+  XCTAssertEqualObjects(data.propertyValues[expiresIndex], @"Thu, 01 Jan 1970 00:00:00 GMT");
+
+  NSHTTPCookie *convertedCookie = FWFNativeNSHTTPCookieFromCookieData(data);
+  XCTAssertEqualObjects(convertedCookie.name, @"cookieName");
+  XCTAssertEqualObjects(convertedCookie.value, @"cookieValue");
+  XCTAssertEqualObjects(convertedCookie.expiresDate, [NSDate dateWithTimeIntervalSince1970:0]);
+}
+
 - (void)testFWFWKUserScriptFromScriptData {
   WKUserScript *userScript = FWFNativeWKUserScriptFromScriptData([FWFWKUserScriptData
        makeWithSource:@"mySource"
@@ -75,6 +99,29 @@
   XCTAssertEqual(data.navigationType, FWFWKNavigationTypeReload);
 }
 
+- (void)testFWFWKNavigationActionDataWithRequestURLFromNavigationAction {
+  WKNavigationAction *mockNavigationAction = OCMClassMock([WKNavigationAction class]);
+
+  OCMStub([mockNavigationAction navigationType]).andReturn(WKNavigationTypeReload);
+
+  NSMutableURLRequest *request =
+      [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://www.flutter.dev/"]];
+  request.HTTPMethod = @"POST";
+  request.allHTTPHeaderFields = @{@"a" : @"field"};
+  OCMStub([mockNavigationAction request]).andReturn(request);
+
+  WKFrameInfo *mockFrameInfo = OCMClassMock([WKFrameInfo class]);
+  OCMStub([mockFrameInfo isMainFrame]).andReturn(YES);
+  OCMStub([mockNavigationAction targetFrame]).andReturn(mockFrameInfo);
+
+  FWFWKNavigationActionData *data =
+      FWFWKNavigationActionDataWithRequestURLFromNativeWKNavigationAction(mockNavigationAction);
+  XCTAssertEqualObjects(data.request.url, @"https://www.flutter.dev/");
+  XCTAssertNil(data.request.httpMethod);
+  XCTAssertEqualObjects(data.request.allHttpHeaderFields, @{});
+  XCTAssertEqual(data.navigationType, FWFWKNavigationTypeReload);
+}
+
 - (void)testFWFNSUrlRequestDataFromNSURLRequest {
   NSMutableURLRequest *request =
       [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://www.flutter.dev/"]];
@@ -124,6 +171,26 @@
   XCTAssertEqualObjects(data.body, @"message");
 }
 
+- (void)testFWFWKScriptMessageDataFromWKScriptMessageWithBinaryBody {
+  WKScriptMessage *mockScriptMessage = OCMClassMock([WKScriptMessage class]);
+  OCMStub([mockScriptMessage name]).andReturn(@"name");
+  OCMStub([mockScriptMessage body]).andReturn(@{FWFJavaScriptBinaryDataKey : @"AQID"});
+
+  FWFWKScriptMessageData *data = FWFWKScriptMessageDataFromNativeWKScriptMessage(mockScriptMessage);
+  XCTAssertTrue([data.body isKindOfClass:[FlutterStandardTypedData class]]);
+  const uint8_t expectedBytes[] = {1, 2, 3};
+  XCTAssertEqualObjects(((FlutterStandardTypedData *)data.body).data,
+                        [NSData dataWithBytes:expectedBytes length:3]);
+}
+
+- (void)testFWFValueFromJavaScriptValueLeavesOtherObjectsUnchanged {
+  NSDictionary *value = @{FWFJavaScriptBinaryDataKey : @"AQID", @"other" : @"value"};
+  XCTAssertEqualObjects(FWFValueFromJavaScriptValue(value), value);
+  XCTAssertEqualObjects(FWFValueFromJavaScriptValue(@{FWFJavaScriptBinaryDataKey : @1}),
+                        @{FWFJavaScriptBinaryDataKey : @1});
+  XCTAssertNil(FWFValueFromJavaScriptValue(nil));
+}
+
 - (void)testFWFWKSecurityOriginDataFromWKSecurityOrigin {
   WKSecurityOrigin *mockSecurityOrigin = OCMClassMock([WKSecurityOrigin class]);
   OCMStub([mockSecurityOrigin host]).andReturn(@"host");
@@ -52,4 +52,76 @@
       completionHandler:OCMOCK_ANY]);
   XCTAssertNil(blockError);
 }
+
+- (void)testSetCookies {
+  WKHTTPCookieStore *mockHttpCookieStore = OCMClassMock([WKHTTPCookieStore class]);
+  OCMStub([mockHttpCookieStore setCookie:[OCMArg any]
+                       completionHandler:([OCMArg invokeBlock])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockHttpCookieStore withIdentifier:0];
+
+  FWFHTTPCookieStoreHostApiImpl *hostAPI =
+      [[FWFHTTPCookieStoreHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  NSArray<FWFNSHttpCookiePropertyKeyEnumData *> *propertyKeys = @[
+    [FWFNSHttpCookiePropertyKeyEnumData makeWithValue:FWFNSHttpCookiePropertyKeyEnumName],
+    [FWFNSHttpCookiePropertyKeyEnumData makeWithValue:FWFNSHttpCookiePropertyKeyEnumValue],
+    [FWFNSHttpCookiePropertyKeyEnumData makeWithValue:FWFNSHttpCookiePropertyKeyEnumDomain],
+    [FWFNSHttpCookiePropertyKeyEnumData makeWithValue:FWFNSHttpCookiePropertyKeyEnumPath],
+  ];
+  NSArray<FWFNSHttpCookieData *> *cookies = @[
+    [FWFNSHttpCookieData makeWithPropertyKeys:propertyKeys
+                               propertyValues:@[ @"a", @"b", @"flutter.dev", @"/" ]],
+    [FWFNSHttpCookieData makeWithPropertyKeys:propertyKeys
+                               propertyValues:@[ @"c", @"d", @"flutter.dev", @"/" ]],
+  ];
+
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Wait for completion."];
+  FlutterError *__block blockError;
+  [hostAPI setCookiesForStoreWithIdentifier:0
+                                    cookies:cookies
+                                 completion:^(FlutterError *error) {
+                                   blockError = error;
+                                   [expectation fulfill];
+                                 }];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+  OCMVerify(times(2), [mockHttpCookieStore setCookie:[OCMArg any]
+                                   completionHandler:OCMOCK_ANY]);
+  XCTAssertNil(blockError);
+}
+
+- (void)testGetAllCookies {
+  WKHTTPCookieStore *mockHttpCookieStore = OCMClassMock([WKHTTPCookieStore class]);
+  NSHTTPCookie *cookie = [NSHTTPCookie cookieWithProperties:@{
+    NSHTTPCookieName : @"a",
+    NSHTTPCookieValue : @"b",
+    NSHTTPCookieDomain : @"flutter.dev",
+    NSHTTPCookiePath : @"/",
+  }];
+  OCMStub([mockHttpCookieStore getAllCookies:([OCMArg invokeBlockWithArgs:@[ cookie ], nil])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockHttpCookieStore withIdentifier:0];
+
+  FWFHTTPCookieStoreHostApiImpl *hostAPI =
+      [[FWFHTTPCookieStoreHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  NSArray<FWFNSHttpCookieData *> *__block returnValue;
+  FlutterError *__block blockError;
+  [hostAPI allCookiesForStoreWithIdentifier:0
+                                 completion:^(NSArray<FWFNSHttpCookieData *> *cookies,
+                                              FlutterError *error) {
+                                   returnValue = cookies;
+                                   blockError = error;
+                                 }];
+
+  XCTAssertEqual(returnValue.count, 1);
+  NSHTTPCookie *convertedCookie = FWFNativeNSHTTPCookieFromCookieData(returnValue.firstObject);
+  XCTAssertEqualObjects(convertedCookie.name, @"a");
+  XCTAssertEqualObjects(convertedCookie.value, @"b");
+  XCTAssertEqualObjects(convertedCookie.domain, @"flutter.dev");
+  XCTAssertNil(blockError);
+}
 @end
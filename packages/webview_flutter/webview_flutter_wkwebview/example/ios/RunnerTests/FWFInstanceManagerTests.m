@@ -68,4 +68,48 @@
   XCTAssertNotEqual([instanceManager identifierWithStrongReferenceForInstance:url1],
                     [instanceManager identifierWithStrongReferenceForInstance:url2]);
 }
+
+- (void)testConcurrentLookups {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  NSMutableArray<NSObject *> *objects = [NSMutableArray array];
+  for (long identifier = 0; identifier < 100; identifier++) {
+    NSObject *object = [[NSObject alloc] init];
+    [objects addObject:object];
+    [instanceManager addDartCreatedInstance:object withIdentifier:identifier];
+  }
+
+  NSObject *__block missingInstance = nil;
+  dispatch_apply(10000, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+    long identifier = i % 100;
+    if ([instanceManager instanceForIdentifier:identifier] != objects[identifier] ||
+        [instanceManager identifierWithStrongReferenceForInstance:objects[identifier]] !=
+            identifier) {
+      missingInstance = objects[identifier];
+    }
+    if (i % 10 == 0) {
+      [instanceManager addHostCreatedInstance:[[NSObject alloc] init]];
+    }
+  });
+
+  XCTAssertNil(missingInstance);
+  XCTAssertEqual([instanceManager strongInstanceCount], 1100);
+}
+
+- (void)testInstanceForIdentifierPerformance {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  NSMutableArray<NSObject *> *objects = [NSMutableArray array];
+  for (long identifier = 0; identifier < 1000; identifier++) {
+    NSObject *object = [[NSObject alloc] init];
+    [objects addObject:object];
+    [instanceManager addDartCreatedInstance:object withIdentifier:identifier];
+  }
+
+  [self measureBlock:^{
+    for (int i = 0; i < 100000; i++) {
+      long identifier = i % 1000;
+      [instanceManager instanceForIdentifier:identifier];
+      [instanceManager identifierWithStrongReferenceForInstance:objects[identifier]];
+    }
+  }];
+}
 @end
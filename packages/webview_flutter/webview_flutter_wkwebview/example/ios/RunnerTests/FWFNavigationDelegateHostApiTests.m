@@ -147,6 +147,158 @@
   XCTAssertEqual(callbackPolicy, WKNavigationActionPolicyCancel);
 }
 
+- (void)testSetNavigationPolicyRules {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFNavigationDelegateHostApiImpl *hostAPI = [[FWFNavigationDelegateHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+  NSArray<FWFWKNavigationPolicyRuleData *> *rules = @[
+    [FWFWKNavigationPolicyRuleData makeWithHost:@"Example.com"
+                                         scheme:nil
+                                     urlPattern:nil
+                                         policy:FWFWKNavigationActionPolicyEnumCancel],
+    [FWFWKNavigationPolicyRuleData makeWithHost:nil
+                                         scheme:@"https"
+                                     urlPattern:@"\\.pdf$"
+                                         policy:FWFWKNavigationActionPolicyEnumAllow],
+  ];
+  [hostAPI setNavigationPolicyRulesForDelegateWithIdentifier:0
+                                                       rules:rules
+                            forwardsOnlyMainFrameNavigations:YES
+                                                       error:&error];
+  XCTAssertNil(error);
+
+  FWFNavigationDelegate *navigationDelegate =
+      (FWFNavigationDelegate *)[instanceManager instanceForIdentifier:0];
+  XCTAssertTrue(navigationDelegate.forwardsOnlyMainFrameNavigations);
+  XCTAssertEqual(navigationDelegate.navigationPolicyRules.count, 2);
+
+  FWFNavigationPolicyRule *hostRule = navigationDelegate.navigationPolicyRules[0];
+  XCTAssertEqual(hostRule.policy, WKNavigationActionPolicyCancel);
+  XCTAssertTrue([hostRule matchesURL:[NSURL URLWithString:@"https://example.com/a"]]);
+  XCTAssertTrue([hostRule matchesURL:[NSURL URLWithString:@"http://ads.EXAMPLE.com"]]);
+  XCTAssertFalse([hostRule matchesURL:[NSURL URLWithString:@"https://notexample.com"]]);
+
+  FWFNavigationPolicyRule *patternRule = navigationDelegate.navigationPolicyRules[1];
+  XCTAssertEqual(patternRule.policy, WKNavigationActionPolicyAllow);
+  XCTAssertTrue([patternRule matchesURL:[NSURL URLWithString:@"https://flutter.dev/a.pdf"]]);
+  XCTAssertFalse([patternRule matchesURL:[NSURL URLWithString:@"http://flutter.dev/a.pdf"]]);
+  XCTAssertFalse([patternRule matchesURL:[NSURL URLWithString:@"https://flutter.dev/a.html"]]);
+}
+
+- (void)testSetIncludesRequestDetails {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFNavigationDelegateHostApiImpl *hostAPI = [[FWFNavigationDelegateHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+
+  FWFNavigationDelegate *navigationDelegate =
+      (FWFNavigationDelegate *)[instanceManager instanceForIdentifier:0];
+  XCTAssertFalse(navigationDelegate.includesRequestDetails);
+
+  [hostAPI setIncludesRequestDetailsForDelegateWithIdentifier:0
+                                       includesRequestDetails:YES
+                                                        error:&error];
+  XCTAssertNil(error);
+  XCTAssertTrue(navigationDelegate.includesRequestDetails);
+}
+
+- (void)testSetNavigationPolicyRulesWithInvalidPattern {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFNavigationDelegateHostApiImpl *hostAPI = [[FWFNavigationDelegateHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+  FWFWKNavigationPolicyRuleData *rule =
+      [FWFWKNavigationPolicyRuleData makeWithHost:nil
+                                           scheme:nil
+                                       urlPattern:@"("
+                                           policy:FWFWKNavigationActionPolicyEnumCancel];
+  [hostAPI setNavigationPolicyRulesForDelegateWithIdentifier:0
+                                                       rules:@[ rule ]
+                            forwardsOnlyMainFrameNavigations:NO
+                                                       error:&error];
+  XCTAssertEqualObjects(error.code, @"FWFNavigationPolicyRuleParsingError");
+
+  FWFNavigationDelegate *navigationDelegate =
+      (FWFNavigationDelegate *)[instanceManager instanceForIdentifier:0];
+  XCTAssertEqual(navigationDelegate.navigationPolicyRules.count, 0);
+}
+
+- (void)testDecidePolicyForNavigationActionWithMatchingRule {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+
+  FWFNavigationDelegate *mockDelegate = [self mockNavigationDelegateWithManager:instanceManager
+                                                                     identifier:0];
+  FWFNavigationDelegateFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+
+  OCMStub([mockDelegate navigationDelegateAPI]).andReturn(mockFlutterAPI);
+  mockDelegate.navigationPolicyRules = @[ [[FWFNavigationPolicyRule alloc]
+      initWithHost:@"ads.flutter.dev"
+            scheme:nil
+        URLPattern:nil
+            policy:WKNavigationActionPolicyCancel] ];
+
+  WKNavigationAction *mockNavigationAction = OCMClassMock([WKNavigationAction class]);
+  OCMStub([mockNavigationAction request])
+      .andReturn([NSURLRequest requestWithURL:[NSURL URLWithString:@"https://ads.flutter.dev/a"]]);
+
+  OCMReject([mockFlutterAPI decidePolicyForNavigationActionForDelegate:OCMOCK_ANY
+                                                                webView:OCMOCK_ANY
+                                                       navigationAction:OCMOCK_ANY
+                                                             completion:OCMOCK_ANY]);
+
+  WKNavigationActionPolicy __block callbackPolicy = -1;
+  [mockDelegate webView:OCMClassMock([WKWebView class])
+      decidePolicyForNavigationAction:mockNavigationAction
+                      decisionHandler:^(WKNavigationActionPolicy policy) {
+                        callbackPolicy = policy;
+                      }];
+  XCTAssertEqual(callbackPolicy, WKNavigationActionPolicyCancel);
+}
+
+- (void)testDecidePolicyForSubframeNavigationActionWhenOnlyMainFrameIsForwarded {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+
+  FWFNavigationDelegate *mockDelegate = [self mockNavigationDelegateWithManager:instanceManager
+                                                                     identifier:0];
+  FWFNavigationDelegateFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+
+  OCMStub([mockDelegate navigationDelegateAPI]).andReturn(mockFlutterAPI);
+  mockDelegate.forwardsOnlyMainFrameNavigations = YES;
+
+  WKNavigationAction *mockNavigationAction = OCMClassMock([WKNavigationAction class]);
+  OCMStub([mockNavigationAction request])
+      .andReturn([NSURLRequest requestWithURL:[NSURL URLWithString:@"https://www.flutter.dev"]]);
+
+  WKFrameInfo *mockFrameInfo = OCMClassMock([WKFrameInfo class]);
+  OCMStub([mockFrameInfo isMainFrame]).andReturn(NO);
+  OCMStub([mockNavigationAction targetFrame]).andReturn(mockFrameInfo);
+
+  OCMReject([mockFlutterAPI decidePolicyForNavigationActionForDelegate:OCMOCK_ANY
+                                                                webView:OCMOCK_ANY
+                                                       navigationAction:OCMOCK_ANY
+                                                             completion:OCMOCK_ANY]);
+
+  WKNavigationActionPolicy __block callbackPolicy = -1;
+  [mockDelegate webView:OCMClassMock([WKWebView class])
+      decidePolicyForNavigationAction:mockNavigationAction
+                      decisionHandler:^(WKNavigationActionPolicy policy) {
+                        callbackPolicy = policy;
+                      }];
+  XCTAssertEqual(callbackPolicy, WKNavigationActionPolicyAllow);
+}
+
 - (void)testDidFailNavigation {
   FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
 
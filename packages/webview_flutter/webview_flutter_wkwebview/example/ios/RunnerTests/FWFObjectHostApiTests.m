@@ -114,6 +114,26 @@
   XCTAssertNil(error);
 }
 
+- (void)testDisposeReturnsWebViewToPool API_AVAILABLE(ios(14.0)) {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFWebViewPool *pool = [[FWFWebViewPool alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  WKWebViewConfiguration *configuration = [[WKWebViewConfiguration alloc] init];
+  [pool prewarmWebViewsWithConfiguration:configuration count:1];
+  [instanceManager addDartCreatedInstance:[pool dequeueWebViewWithConfiguration:configuration]
+                           withIdentifier:0];
+
+  FWFObjectHostApiImpl *hostAPI =
+      [[FWFObjectHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI disposeObjectWithIdentifier:0 error:&error];
+  XCTAssertEqual(pool.idleWebViewCount, 1);
+  XCTAssertNil(error);
+}
+
 - (void)testObserveValueForKeyPath {
   FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
 
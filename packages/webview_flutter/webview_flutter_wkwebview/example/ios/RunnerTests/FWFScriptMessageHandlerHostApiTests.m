@@ -84,4 +84,58 @@
                                                                                 class]]
                                            completion:OCMOCK_ANY]);
 }
+
+- (void)testSetMessageBatching {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFScriptMessageHandlerHostApiImpl *hostAPI = [[FWFScriptMessageHandlerHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+  [hostAPI setMessageBatchingForHandlerWithIdentifier:0 maxBatchSize:@(4) error:&error];
+
+  FWFScriptMessageHandler *scriptMessageHandler =
+      (FWFScriptMessageHandler *)[instanceManager instanceForIdentifier:0];
+  XCTAssertEqual(scriptMessageHandler.maxMessageBatchSize, 4);
+
+  [hostAPI setMessageBatchingForHandlerWithIdentifier:0 maxBatchSize:nil error:&error];
+  XCTAssertEqual(scriptMessageHandler.maxMessageBatchSize, 0);
+  XCTAssertNil(error);
+}
+
+- (void)testDidReceiveScriptMessagesSendsFullBatch {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+
+  FWFScriptMessageHandler *mockHandler = [self mockHandlerWithManager:instanceManager identifier:0];
+  FWFScriptMessageHandlerFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+
+  OCMStub([mockHandler scriptMessageHandlerAPI]).andReturn(mockFlutterAPI);
+  mockHandler.maxMessageBatchSize = 2;
+
+  WKUserContentController *userContentController = [[WKUserContentController alloc] init];
+  [instanceManager addDartCreatedInstance:userContentController withIdentifier:1];
+
+  WKScriptMessage *mockScriptMessage = OCMClassMock([WKScriptMessage class]);
+  OCMStub([mockScriptMessage name]).andReturn(@"name");
+  OCMStub([mockScriptMessage body]).andReturn(@"message");
+
+  [[mockFlutterAPI reject] didReceiveScriptMessageForHandlerWithIdentifier:0
+                                          userContentControllerIdentifier:1
+                                                                  message:OCMOCK_ANY
+                                                               completion:OCMOCK_ANY];
+
+  [mockHandler userContentController:userContentController
+             didReceiveScriptMessage:mockScriptMessage];
+  [mockHandler userContentController:userContentController
+             didReceiveScriptMessage:mockScriptMessage];
+  OCMVerify([mockFlutterAPI
+      didReceiveScriptMessagesForHandlerWithIdentifier:0
+                       userContentControllerIdentifier:1
+                                              messages:[OCMArg checkWithBlock:^BOOL(id value) {
+                                                return [value count] == 2;
+                                              }]
+                                            completion:OCMOCK_ANY]);
+}
 @end
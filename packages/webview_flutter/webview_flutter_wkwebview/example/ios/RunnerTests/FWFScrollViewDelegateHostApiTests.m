@@ -0,0 +1,169 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import Flutter;
+@import XCTest;
+@import webview_flutter_wkwebview;
+
+#import <OCMock/OCMock.h>
+
+@interface FWFScrollViewDelegateHostApiTests : XCTestCase
+@end
+
+@implementation FWFScrollViewDelegateHostApiTests
+/**
+ * Creates a partially mocked FWFScrollViewDelegate and adds it to instanceManager.
+ *
+ * @param instanceManager Instance manager to add the delegate to.
+ * @param maximumFrequency Maximum number of scroll events sent to Dart per second.
+ * @param minimumDelta Minimum content offset change before a scroll event is sent to Dart.
+ *
+ * @return A mock FWFScrollViewDelegate.
+ */
+- (id)mockDelegateWithManager:(FWFInstanceManager *)instanceManager
+             maximumFrequency:(double)maximumFrequency
+                 minimumDelta:(double)minimumDelta {
+  FWFScrollViewDelegate *delegate = [[FWFScrollViewDelegate alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager
+             maximumFrequency:maximumFrequency
+                 minimumDelta:minimumDelta];
+
+  [instanceManager addDartCreatedInstance:delegate withIdentifier:0];
+  return OCMPartialMock(delegate);
+}
+
+/**
+ * Creates a  mock FWFScrollViewDelegateFlutterApiImpl with instanceManager.
+ *
+ * @param instanceManager Instance manager passed to the Flutter API.
+ *
+ * @return A mock FWFScrollViewDelegateFlutterApiImpl.
+ */
+- (id)mockFlutterApiWithManager:(FWFInstanceManager *)instanceManager {
+  FWFScrollViewDelegateFlutterApiImpl *flutterAPI = [[FWFScrollViewDelegateFlutterApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+  return OCMPartialMock(flutterAPI);
+}
+
+- (void)testCreateWithIdentifier {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFScrollViewDelegateHostApiImpl *hostAPI = [[FWFScrollViewDelegateHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 maximumFrequency:4 minimumDelta:2 error:&error];
+  FWFScrollViewDelegate *delegate =
+      (FWFScrollViewDelegate *)[instanceManager instanceForIdentifier:0];
+
+  XCTAssertTrue([delegate conformsToProtocol:@protocol(UIScrollViewDelegate)]);
+  XCTAssertEqual(delegate.minimumInterval, 0.25);
+  XCTAssertEqual(delegate.minimumDelta, 2);
+  XCTAssertNil(error);
+}
+
+- (void)testScrollViewDidScroll {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+
+  FWFScrollViewDelegate *mockDelegate = [self mockDelegateWithManager:instanceManager
+                                                     maximumFrequency:0
+                                                         minimumDelta:0];
+  FWFScrollViewDelegateFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+
+  OCMStub([mockDelegate scrollViewDelegateAPI]).andReturn(mockFlutterAPI);
+
+  UIScrollView *scrollView = [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, 500, 500)];
+  scrollView.contentOffset = CGPointMake(1, 2);
+  [instanceManager addDartCreatedInstance:scrollView withIdentifier:1];
+
+  [mockDelegate scrollViewDidScroll:scrollView];
+  OCMVerify([mockFlutterAPI scrollViewDidScrollWithIdentifier:0
+                                       uiScrollViewIdentifier:1
+                                                            x:1
+                                                            y:2
+                                                   completion:OCMOCK_ANY]);
+}
+
+- (void)testScrollViewDidScrollIgnoresSmallOffsetChanges {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+
+  FWFScrollViewDelegate *mockDelegate = [self mockDelegateWithManager:instanceManager
+                                                     maximumFrequency:0
+                                                         minimumDelta:10];
+  FWFScrollViewDelegateFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+
+  OCMStub([mockDelegate scrollViewDelegateAPI]).andReturn(mockFlutterAPI);
+
+  UIScrollView *scrollView = [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, 500, 500)];
+  [instanceManager addDartCreatedInstance:scrollView withIdentifier:1];
+
+  scrollView.contentOffset = CGPointMake(0, 5);
+  [mockDelegate scrollViewDidScroll:scrollView];
+  OCMVerify([mockFlutterAPI scrollViewDidScrollWithIdentifier:0
+                                       uiScrollViewIdentifier:1
+                                                            x:0
+                                                            y:5
+                                                   completion:OCMOCK_ANY]);
+
+  OCMReject([mockFlutterAPI scrollViewDidScrollWithIdentifier:0
+                                       uiScrollViewIdentifier:1
+                                                            x:0
+                                                            y:9
+                                                   completion:OCMOCK_ANY]);
+  scrollView.contentOffset = CGPointMake(0, 9);
+  [mockDelegate scrollViewDidScroll:scrollView];
+
+  scrollView.contentOffset = CGPointMake(0, 15);
+  [mockDelegate scrollViewDidScroll:scrollView];
+  OCMVerify([mockFlutterAPI scrollViewDidScrollWithIdentifier:0
+                                       uiScrollViewIdentifier:1
+                                                            x:0
+                                                            y:15
+                                                   completion:OCMOCK_ANY]);
+}
+
+- (void)testScrollViewDidScrollIsThrottled {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+
+  FWFScrollViewDelegate *mockDelegate = [self mockDelegateWithManager:instanceManager
+                                                     maximumFrequency:1
+                                                         minimumDelta:0];
+  FWFScrollViewDelegateFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+
+  OCMStub([mockDelegate scrollViewDelegateAPI]).andReturn(mockFlutterAPI);
+
+  UIScrollView *scrollView = [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, 500, 500)];
+  [instanceManager addDartCreatedInstance:scrollView withIdentifier:1];
+
+  scrollView.contentOffset = CGPointMake(0, 1);
+  [mockDelegate scrollViewDidScroll:scrollView];
+  OCMVerify([mockFlutterAPI scrollViewDidScrollWithIdentifier:0
+                                       uiScrollViewIdentifier:1
+                                                            x:0
+                                                            y:1
+                                                   completion:OCMOCK_ANY]);
+
+  OCMReject([mockFlutterAPI scrollViewDidScrollWithIdentifier:0
+                                       uiScrollViewIdentifier:1
+                                                            x:0
+                                                            y:2
+                                                   completion:OCMOCK_ANY]);
+  scrollView.contentOffset = CGPointMake(0, 2);
+  [mockDelegate scrollViewDidScroll:scrollView];
+
+  // The offset a scroll settles on is reported even when it arrives too early.
+  scrollView.contentOffset = CGPointMake(0, 3);
+  [mockDelegate scrollViewDidEndDecelerating:scrollView];
+  OCMVerify([mockFlutterAPI scrollViewDidScrollWithIdentifier:0
+                                       uiScrollViewIdentifier:1
+                                                            x:0
+                                                            y:3
+                                                   completion:OCMOCK_ANY]);
+}
+@end
@@ -61,4 +61,25 @@
   XCTAssertEqual(scrollView.contentOffset.y, 2);
   XCTAssertNil(error);
 }
+
+- (void)testSetDelegateForScrollView {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+
+  UIScrollView *scrollView = [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, 500, 500)];
+  FWFScrollViewDelegate *delegate = [[FWFScrollViewDelegate alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager
+             maximumFrequency:0
+                 minimumDelta:0];
+  [instanceManager addDartCreatedInstance:scrollView withIdentifier:0];
+  [instanceManager addDartCreatedInstance:delegate withIdentifier:1];
+
+  FWFScrollViewHostApiImpl *hostAPI =
+      [[FWFScrollViewHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI setDelegateForScrollViewWithIdentifier:0 uiScrollViewDelegateIdentifier:@1 error:&error];
+  XCTAssertEqualObjects(scrollView.delegate, delegate);
+  XCTAssertNil(error);
+}
 @end
@@ -0,0 +1,289 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import Flutter;
+@import XCTest;
+@import webview_flutter_wkwebview;
+
+#import <OCMock/OCMock.h>
+
+@interface FWFURLSchemeHandlerHostApiTests : XCTestCase
+@property(nonatomic) NSString *directoryPath;
+@end
+
+@implementation FWFURLSchemeHandlerHostApiTests
+- (void)setUp {
+  self.directoryPath =
+      [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+  [[NSFileManager defaultManager] createDirectoryAtPath:self.directoryPath
+                            withIntermediateDirectories:YES
+                                             attributes:nil
+                                                  error:nil];
+  [@"<html></html>" writeToFile:[self.directoryPath stringByAppendingPathComponent:@"index.html"]
+                     atomically:YES
+                       encoding:NSUTF8StringEncoding
+                          error:nil];
+}
+
+- (void)tearDown {
+  [[NSFileManager defaultManager] removeItemAtPath:self.directoryPath error:nil];
+}
+
+/**
+ * Creates a partially mocked FWFURLSchemeHandler and adds it to instanceManager.
+ *
+ * @param instanceManager Instance manager to add the handler to.
+ * @param identifier Identifier for the handler added to the instanceManager.
+ *
+ * @return A mock FWFURLSchemeHandler.
+ */
+- (id)mockHandlerWithManager:(FWFInstanceManager *)instanceManager identifier:(long)identifier {
+  FWFURLSchemeHandler *handler = [[FWFURLSchemeHandler alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  [instanceManager addDartCreatedInstance:handler withIdentifier:identifier];
+  return OCMPartialMock(handler);
+}
+
+/**
+ * Creates a mock FWFURLSchemeHandlerFlutterApiImpl with instanceManager.
+ *
+ * @param instanceManager Instance manager passed to the Flutter API.
+ *
+ * @return A mock FWFURLSchemeHandlerFlutterApiImpl.
+ */
+- (id)mockFlutterApiWithManager:(FWFInstanceManager *)instanceManager {
+  FWFURLSchemeHandlerFlutterApiImpl *flutterAPI = [[FWFURLSchemeHandlerFlutterApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+  return OCMPartialMock(flutterAPI);
+}
+
+/// Returns a mock WKURLSchemeTask for a GET request of `URLString`.
+- (id)mockTaskWithURLString:(NSString *)URLString {
+  id mockTask = OCMProtocolMock(@protocol(WKURLSchemeTask));
+  OCMStub([mockTask request])
+      .andReturn([NSURLRequest requestWithURL:[NSURL URLWithString:URLString]]);
+  return mockTask;
+}
+
+- (void)testCreateWithIdentifier {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandlerHostApiImpl *hostAPI = [[FWFURLSchemeHandlerHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+
+  FWFURLSchemeHandler *handler = (FWFURLSchemeHandler *)[instanceManager instanceForIdentifier:0];
+
+  XCTAssertTrue([handler conformsToProtocol:@protocol(WKURLSchemeHandler)]);
+  XCTAssertNil(error);
+}
+
+- (void)testFileRouteAnswersTaskWithFile {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandler *handler = [self mockHandlerWithManager:instanceManager identifier:0];
+  FWFURLSchemeHandlerFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+  OCMStub([handler URLSchemeHandlerAPI]).andReturn(mockFlutterAPI);
+  OCMReject([mockFlutterAPI startURLSchemeTaskForHandler:OCMOCK_ANY
+                                                 webView:OCMOCK_ANY
+                                          taskIdentifier:0
+                                                 request:OCMOCK_ANY
+                                              completion:OCMOCK_ANY]);
+  [handler addRouteWithPathPrefix:@"/" directoryPath:self.directoryPath];
+
+  id mockTask = [self mockTaskWithURLString:@"app://localhost/"];
+  XCTestExpectation *finished = [self expectationWithDescription:@"didFinish"];
+  OCMStub([mockTask didFinish]).andDo(^(NSInvocation *invocation) {
+    [finished fulfill];
+  });
+
+  [handler webView:OCMClassMock([WKWebView class]) startURLSchemeTask:mockTask];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+  OCMVerify([mockTask didReceiveResponse:[OCMArg checkWithBlock:^BOOL(NSHTTPURLResponse *response) {
+                        return response.statusCode == 200 &&
+                               [response.MIMEType isEqualToString:@"text/html"];
+                      }]]);
+  OCMVerify([mockTask
+      didReceiveData:[@"<html></html>" dataUsingEncoding:NSUTF8StringEncoding]]);
+}
+
+- (void)testFileRouteAnswersMissingFileWithNotFound {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandler *handler = [self mockHandlerWithManager:instanceManager identifier:0];
+  [handler addRouteWithPathPrefix:@"/" directoryPath:self.directoryPath];
+
+  id mockTask = [self mockTaskWithURLString:@"app://localhost/missing.js"];
+  XCTestExpectation *finished = [self expectationWithDescription:@"didFinish"];
+  OCMStub([mockTask didFinish]).andDo(^(NSInvocation *invocation) {
+    [finished fulfill];
+  });
+
+  [handler webView:OCMClassMock([WKWebView class]) startURLSchemeTask:mockTask];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+  OCMVerify([mockTask didReceiveResponse:[OCMArg checkWithBlock:^BOOL(NSHTTPURLResponse *response) {
+                        return response.statusCode == 404;
+                      }]]);
+}
+
+- (void)testFileRouteDoesNotAnswerWithFilesOutsideOfDirectory {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandler *handler = [self mockHandlerWithManager:instanceManager identifier:0];
+  NSString *subdirectoryPath = [self.directoryPath stringByAppendingPathComponent:@"www"];
+  [[NSFileManager defaultManager] createDirectoryAtPath:subdirectoryPath
+                            withIntermediateDirectories:YES
+                                             attributes:nil
+                                                  error:nil];
+  [handler addRouteWithPathPrefix:@"/" directoryPath:subdirectoryPath];
+
+  id mockTask = [self mockTaskWithURLString:@"app://localhost/..%2Findex.html"];
+  XCTestExpectation *finished = [self expectationWithDescription:@"didFinish"];
+  OCMStub([mockTask didFinish]).andDo(^(NSInvocation *invocation) {
+    [finished fulfill];
+  });
+
+  [handler webView:OCMClassMock([WKWebView class]) startURLSchemeTask:mockTask];
+  [self waitForExpectationsWithTimeout:5.0 handler:nil];
+
+  OCMVerify([mockTask didReceiveResponse:[OCMArg checkWithBlock:^BOOL(NSHTTPURLResponse *response) {
+                        return response.statusCode == 404;
+                      }]]);
+}
+
+- (void)testAddFlutterAssetRoute {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandler *mockHandler = [self mockHandlerWithManager:instanceManager identifier:0];
+
+  FWFAssetManager *mockAssetManager = OCMClassMock([FWFAssetManager class]);
+  OCMStub([mockAssetManager lookupKeyForAsset:@"assets/www"]).andReturn(@"flutter_assets/www");
+
+  NSBundle *mockBundle = OCMClassMock([NSBundle class]);
+  OCMStub([mockBundle bundlePath]).andReturn(@"/app");
+
+  FWFURLSchemeHandlerHostApiImpl *hostAPI = [[FWFURLSchemeHandlerHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager
+                       bundle:mockBundle
+                 assetManager:mockAssetManager];
+
+  FlutterError *error;
+  [hostAPI addFlutterAssetRouteForHandlerWithIdentifier:0
+                                             pathPrefix:@"/"
+                                         assetDirectory:@"assets/www"
+                                                  error:&error];
+
+  XCTAssertNil(error);
+  OCMVerify([mockHandler addRouteWithPathPrefix:@"/" directoryPath:@"/app/flutter_assets/www"]);
+}
+
+- (void)testStartAndStopURLSchemeTaskWithoutRoute {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandler *mockHandler = [self mockHandlerWithManager:instanceManager identifier:0];
+  FWFURLSchemeHandlerFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+  OCMStub([mockHandler URLSchemeHandlerAPI]).andReturn(mockFlutterAPI);
+
+  WKWebView *webView = [[WKWebView alloc] init];
+  [instanceManager addDartCreatedInstance:webView withIdentifier:1];
+
+  id mockTask = [self mockTaskWithURLString:@"app://localhost/api"];
+  [mockHandler webView:webView startURLSchemeTask:mockTask];
+  id requestMatcher = [OCMArg checkWithBlock:^BOOL(FWFNSUrlRequestData *request) {
+    return [request.url isEqualToString:@"app://localhost/api"];
+  }];
+  OCMVerify([mockFlutterAPI startURLSchemeTaskForHandlerWithIdentifier:0
+                                                     webViewIdentifier:1
+                                                        taskIdentifier:0
+                                                               request:requestMatcher
+                                                            completion:OCMOCK_ANY]);
+
+  [mockHandler webView:webView stopURLSchemeTask:mockTask];
+  OCMVerify([mockFlutterAPI stopURLSchemeTaskForHandlerWithIdentifier:0
+                                                    webViewIdentifier:1
+                                                       taskIdentifier:0
+                                                           completion:OCMOCK_ANY]);
+}
+
+- (void)testAnswerTaskFromDart {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandler *mockHandler = [self mockHandlerWithManager:instanceManager identifier:0];
+  FWFURLSchemeHandlerFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+  OCMStub([mockHandler URLSchemeHandlerAPI]).andReturn(mockFlutterAPI);
+  OCMStub([mockFlutterAPI startURLSchemeTaskForHandler:OCMOCK_ANY
+                                               webView:OCMOCK_ANY
+                                        taskIdentifier:0
+                                               request:OCMOCK_ANY
+                                            completion:OCMOCK_ANY]);
+
+  id mockTask = [self mockTaskWithURLString:@"app://localhost/api"];
+  [mockHandler webView:OCMClassMock([WKWebView class]) startURLSchemeTask:mockTask];
+
+  FWFURLSchemeHandlerHostApiImpl *hostAPI = [[FWFURLSchemeHandlerHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI didReceiveResponseForHandlerWithIdentifier:0
+                                       taskIdentifier:0
+                                           statusCode:201
+                                              headers:@{@"Content-Type" : @"application/json"}
+                                                error:&error];
+  OCMVerify([mockTask didReceiveResponse:[OCMArg checkWithBlock:^BOOL(NSHTTPURLResponse *response) {
+                        return response.statusCode == 201 &&
+                               [response.MIMEType isEqualToString:@"application/json"];
+                      }]]);
+
+  NSData *data = [@"{}" dataUsingEncoding:NSUTF8StringEncoding];
+  [hostAPI didReceiveDataForHandlerWithIdentifier:0
+                                   taskIdentifier:0
+                                             data:[FlutterStandardTypedData typedDataWithBytes:data]
+                                            error:&error];
+  OCMVerify([mockTask didReceiveData:data]);
+
+  [hostAPI didFinishForHandlerWithIdentifier:0 taskIdentifier:0 error:&error];
+  OCMVerify([mockTask didFinish]);
+  XCTAssertNil(error);
+
+  // A finished task is forgotten.
+  XCTAssertNil([mockHandler requestURLForTaskWithIdentifier:0]);
+}
+
+- (void)testFailTaskFromDart {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFURLSchemeHandler *mockHandler = [self mockHandlerWithManager:instanceManager identifier:0];
+  FWFURLSchemeHandlerFlutterApiImpl *mockFlutterAPI =
+      [self mockFlutterApiWithManager:instanceManager];
+  OCMStub([mockHandler URLSchemeHandlerAPI]).andReturn(mockFlutterAPI);
+  OCMStub([mockFlutterAPI startURLSchemeTaskForHandler:OCMOCK_ANY
+                                               webView:OCMOCK_ANY
+                                        taskIdentifier:0
+                                               request:OCMOCK_ANY
+                                            completion:OCMOCK_ANY]);
+
+  id mockTask = [self mockTaskWithURLString:@"app://localhost/api"];
+  [mockHandler webView:OCMClassMock([WKWebView class]) startURLSchemeTask:mockTask];
+
+  FWFURLSchemeHandlerHostApiImpl *hostAPI = [[FWFURLSchemeHandlerHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI didFailForHandlerWithIdentifier:0
+                            taskIdentifier:0
+                          errorDescription:@"description"
+                                     error:&error];
+
+  XCTAssertNil(error);
+  OCMVerify([mockTask didFailWithError:[OCMArg checkWithBlock:^BOOL(NSError *taskError) {
+                        return [taskError.localizedDescription isEqualToString:@"description"];
+                      }]]);
+}
+@end
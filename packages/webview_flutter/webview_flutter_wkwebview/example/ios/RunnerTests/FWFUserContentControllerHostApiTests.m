@@ -124,4 +124,48 @@
   OCMVerify([mockUserContentController removeAllUserScripts]);
   XCTAssertNil(error);
 }
+
+- (void)testAddContentRuleList {
+  WKUserContentController *mockUserContentController =
+      OCMClassMock([WKUserContentController class]);
+  WKContentRuleListStore *mockStore = OCMClassMock([WKContentRuleListStore class]);
+  WKContentRuleList *mockRuleList = OCMClassMock([WKContentRuleList class]);
+  OCMStub([mockStore
+      lookUpContentRuleListForIdentifier:@"blocker"
+                       completionHandler:([OCMArg invokeBlockWithArgs:mockRuleList,
+                                                                      [NSNull null], nil])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockUserContentController withIdentifier:0];
+  [instanceManager addDartCreatedInstance:mockStore withIdentifier:1];
+
+  FWFUserContentControllerHostApiImpl *hostAPI =
+      [[FWFUserContentControllerHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *__block blockError = [FlutterError errorWithCode:@"" message:nil details:nil];
+  [hostAPI addContentRuleListForControllerWithIdentifier:0
+                                         storeIdentifier:1
+                                      ruleListIdentifier:@"blocker"
+                                              completion:^(FlutterError *error) {
+                                                blockError = error;
+                                              }];
+  OCMVerify([mockUserContentController addContentRuleList:mockRuleList]);
+  XCTAssertNil(blockError);
+}
+
+- (void)testRemoveAllContentRuleLists {
+  WKUserContentController *mockUserContentController =
+      OCMClassMock([WKUserContentController class]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockUserContentController withIdentifier:0];
+
+  FWFUserContentControllerHostApiImpl *hostAPI =
+      [[FWFUserContentControllerHostApiImpl alloc] initWithInstanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI removeAllContentRuleListsForControllerWithIdentifier:0 error:&error];
+  OCMVerify([mockUserContentController removeAllContentRuleLists]);
+  XCTAssertNil(error);
+}
 @end
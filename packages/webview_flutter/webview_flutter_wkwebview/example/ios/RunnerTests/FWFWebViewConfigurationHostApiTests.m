@@ -105,4 +105,68 @@
                                                    WKAudiovisualMediaTypeVideo)]);
   XCTAssertNil(error);
 }
+
+- (void)testUseSharedProcessPool {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFWebViewConfigurationHostApiImpl *hostAPI = [[FWFWebViewConfigurationHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+  [hostAPI createWithIdentifier:1 error:&error];
+  [hostAPI useSharedProcessPoolForConfigurationWithIdentifier:0 error:&error];
+  [hostAPI useSharedProcessPoolForConfigurationWithIdentifier:1 error:&error];
+
+  WKWebViewConfiguration *firstConfiguration =
+      (WKWebViewConfiguration *)[instanceManager instanceForIdentifier:0];
+  WKWebViewConfiguration *secondConfiguration =
+      (WKWebViewConfiguration *)[instanceManager instanceForIdentifier:1];
+  XCTAssertEqual(firstConfiguration.processPool, secondConfiguration.processPool);
+  XCTAssertNil(error);
+}
+
+- (void)testSetURLSchemeHandler {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFWebViewConfigurationHostApiImpl *hostAPI = [[FWFWebViewConfigurationHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+  FWFURLSchemeHandler *handler = [[FWFURLSchemeHandler alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+  [instanceManager addDartCreatedInstance:handler withIdentifier:1];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+  [hostAPI setURLSchemeHandlerForConfigurationWithIdentifier:0
+                                           handlerIdentifier:1
+                                                      scheme:@"app"
+                                                       error:&error];
+
+  WKWebViewConfiguration *configuration =
+      (WKWebViewConfiguration *)[instanceManager instanceForIdentifier:0];
+  XCTAssertEqual([configuration urlSchemeHandlerForURLScheme:@"app"], handler);
+  XCTAssertTrue([FWFURLSchemeHandler.registeredURLSchemes containsObject:@"app"]);
+  XCTAssertNil(error);
+}
+
+- (void)testSetURLSchemeHandlerForSchemeHandledByWebKit {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFWebViewConfigurationHostApiImpl *hostAPI = [[FWFWebViewConfigurationHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+  FWFURLSchemeHandler *handler = [[FWFURLSchemeHandler alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+  [instanceManager addDartCreatedInstance:handler withIdentifier:1];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:0 error:&error];
+  [hostAPI setURLSchemeHandlerForConfigurationWithIdentifier:0
+                                           handlerIdentifier:1
+                                                      scheme:@"https"
+                                                       error:&error];
+
+  XCTAssertEqualObjects(error.code, @"FWFURLSchemeHandledByWebKitError");
+}
 @end
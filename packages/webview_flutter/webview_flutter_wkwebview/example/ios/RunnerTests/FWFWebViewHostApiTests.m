@@ -29,6 +29,26 @@ static bool feq(CGFloat a, CGFloat b) { return fabs(b - a) < FLT_EPSILON; }
   XCTAssertNil(error);
 }
 
+- (void)testCreateWithPrewarmedWebView {
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  FWFWebViewHostApiImpl *hostAPI = [[FWFWebViewHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  [instanceManager addDartCreatedInstance:[[WKWebViewConfiguration alloc] init] withIdentifier:0];
+
+  FlutterError *error;
+  [hostAPI prewarmWebViewsWithConfigurationIdentifier:0 count:1 error:&error];
+  [hostAPI createWithIdentifier:1 configurationIdentifier:0 error:&error];
+  [hostAPI createWithIdentifier:2 configurationIdentifier:0 error:&error];
+
+  FWFWebView *prewarmedWebView = (FWFWebView *)[instanceManager instanceForIdentifier:1];
+  FWFWebView *newWebView = (FWFWebView *)[instanceManager instanceForIdentifier:2];
+  XCTAssertNotNil(prewarmedWebView.webViewPool);
+  XCTAssertNil(newWebView.webViewPool);
+  XCTAssertNil(error);
+}
+
 - (void)testLoadRequest {
   FWFWebView *mockWebView = OCMClassMock([FWFWebView class]);
 
@@ -380,6 +400,82 @@ static bool feq(CGFloat a, CGFloat b) { return fabs(b - a) < FLT_EPSILON; }
   XCTAssertNil(returnError);
 }
 
+- (void)testEvaluateJavaScriptAsJSON {
+  FWFWebView *mockWebView = OCMClassMock([FWFWebView class]);
+
+  OCMStub([mockWebView
+      evaluateJavaScript:@"JSON.stringify(eval([\"document.title\"][0]))"
+       completionHandler:([OCMArg invokeBlockWithArgs:@"\"title\"", [NSNull null], nil])]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockWebView withIdentifier:0];
+
+  FWFWebViewHostApiImpl *hostAPI = [[FWFWebViewHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  NSString __block *returnValue;
+  FlutterError __block *returnError;
+  [hostAPI evaluateJavaScriptAsJSONForWebViewWithIdentifier:0
+                                           javaScriptString:@"document.title"
+                                                 completion:^(NSString *result,
+                                                              FlutterError *error) {
+                                                   returnValue = result;
+                                                   returnError = error;
+                                                 }];
+
+  XCTAssertEqualObjects(returnValue, @"\"title\"");
+  XCTAssertNil(returnError);
+}
+
+- (void)testCallAsyncJavaScriptWithBinaryData {
+  if (@available(iOS 14.0, *)) {
+    FWFWebView *mockWebView = OCMClassMock([FWFWebView class]);
+
+    NSDictionary __block *javaScriptArguments;
+    OCMStub([mockWebView
+        callAsyncJavaScript:[OCMArg checkWithBlock:^BOOL(NSString *javaScript) {
+          return [javaScript containsString:@"data = __flutterBase64ToBytes(data);"] &&
+                 [javaScript containsString:@"return data;"];
+        }]
+                  arguments:[OCMArg checkWithBlock:^BOOL(NSDictionary *arguments) {
+                    javaScriptArguments = arguments;
+                    return YES;
+                  }]
+                    inFrame:nil
+             inContentWorld:WKContentWorld.pageWorld
+          completionHandler:([OCMArg invokeBlockWithArgs:@{FWFJavaScriptBinaryDataKey : @"AQID"},
+                                                         [NSNull null], nil])]);
+
+    FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+    [instanceManager addDartCreatedInstance:mockWebView withIdentifier:0];
+
+    FWFWebViewHostApiImpl *hostAPI = [[FWFWebViewHostApiImpl alloc]
+        initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+                instanceManager:instanceManager];
+
+    const uint8_t bytes[] = {1, 2, 3};
+    NSData *data = [NSData dataWithBytes:bytes length:3];
+    FlutterStandardTypedData *typedData = [FlutterStandardTypedData typedDataWithBytes:data];
+
+    id __block returnValue;
+    FlutterError __block *returnError;
+    [hostAPI
+        callAsyncJavaScriptForWebViewWithIdentifier:0
+                                       functionBody:@"return data;"
+                                          arguments:@{@"data" : typedData, @"count" : @3}
+                                         completion:^(id result, FlutterError *error) {
+                                           returnValue = result;
+                                           returnError = error;
+                                         }];
+
+    XCTAssertEqualObjects(javaScriptArguments, (@{@"data" : @"AQID", @"count" : @3}));
+    XCTAssertTrue([returnValue isKindOfClass:[FlutterStandardTypedData class]]);
+    XCTAssertEqualObjects(((FlutterStandardTypedData *)returnValue).data, data);
+    XCTAssertNil(returnError);
+  }
+}
+
 - (void)testEvaluateJavaScriptReturnsNSErrorData {
   FWFWebView *mockWebView = OCMClassMock([FWFWebView class]);
 
@@ -506,4 +602,76 @@ static bool feq(CGFloat a, CGFloat b) { return fabs(b - a) < FLT_EPSILON; }
                         userAgent);
   XCTAssertNil(error);
 }
+
+- (void)testSetSuspendsWhenOffscreen {
+  FWFWebView *mockWebView = OCMClassMock([FWFWebView class]);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  [instanceManager addDartCreatedInstance:mockWebView withIdentifier:0];
+
+  FWFWebViewHostApiImpl *hostAPI = [[FWFWebViewHostApiImpl alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI setSuspendsWhenOffscreenForWebViewWithIdentifier:0
+                                                   suspends:YES
+                                         idleTimeoutSeconds:@30
+                                                      error:&error];
+  OCMVerify([mockWebView setSuspendsWhenOffscreen:YES idleTimeout:30]);
+  XCTAssertNil(error);
+}
+
+- (void)testSuspendRequiresOffscreenSuspensionOutOfWindow API_AVAILABLE(ios(15.0)) {
+  FWFWebView *webView = [[FWFWebView alloc]
+        initWithFrame:CGRectMake(0, 0, 300, 300)
+        configuration:[[WKWebViewConfiguration alloc] init]
+      binaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+      instanceManager:[[FWFInstanceManager alloc] init]];
+
+  [webView suspend];
+  XCTAssertFalse(webView.isSuspended);
+
+  UIWindow *window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 300, 300)];
+  [window addSubview:webView];
+  [webView setSuspendsWhenOffscreen:YES idleTimeout:0];
+  [webView suspend];
+  XCTAssertFalse(webView.isSuspended);
+}
+
+- (void)testSuspendedPageIsRestoredBeforeLoad API_AVAILABLE(ios(15.0)) {
+  FWFWebView *webView = [[FWFWebView alloc]
+        initWithFrame:CGRectMake(0, 0, 300, 300)
+        configuration:[[WKWebViewConfiguration alloc] init]
+      binaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+      instanceManager:[[FWFInstanceManager alloc] init]];
+
+  id mockDelegate = OCMProtocolMock(@protocol(WKNavigationDelegate));
+  __block XCTestExpectation *loadExpectation = [self expectationWithDescription:@"first load"];
+  OCMStub([mockDelegate webView:webView didFinishNavigation:OCMOCK_ANY])
+      .andDo(^(NSInvocation *invocation) {
+        [loadExpectation fulfill];
+      });
+  webView.navigationDelegate = mockDelegate;
+
+  NSURL *firstURL = [NSURL URLWithString:@"https://www.flutter.dev/first"];
+  [webView loadHTMLString:@"<p>first</p>" baseURL:firstURL];
+  [self waitForExpectations:@[ loadExpectation ] timeout:10];
+
+  [webView setSuspendsWhenOffscreen:YES idleTimeout:0];
+  [webView suspend];
+  XCTAssertTrue(webView.isSuspended);
+  XCTAssertEqualObjects(webView.URL, firstURL);
+
+  // The delegate only hears about the load requested from Dart, after the page is restored.
+  loadExpectation = [self expectationWithDescription:@"second load"];
+  NSURL *secondURL = [NSURL URLWithString:@"https://www.flutter.dev/second"];
+  [webView loadHTMLString:@"<p>second</p>" baseURL:secondURL];
+  [self waitForExpectations:@[ loadExpectation ] timeout:10];
+
+  XCTAssertFalse(webView.isSuspended);
+  XCTAssertEqualObjects(webView.URL, secondURL);
+  XCTAssertEqual(webView.navigationDelegate, mockDelegate);
+  XCTAssertTrue(webView.canGoBack);
+}
 @end
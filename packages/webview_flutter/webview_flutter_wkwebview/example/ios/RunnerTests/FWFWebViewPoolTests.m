@@ -0,0 +1,85 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import Flutter;
+@import XCTest;
+@import webview_flutter_wkwebview;
+
+#import <OCMock/OCMock.h>
+
+@interface FWFWebViewPoolTests : XCTestCase
+@end
+
+@implementation FWFWebViewPoolTests
+- (void)testDequeueWebViewWithConfiguration {
+  FWFWebViewPool *pool = [[FWFWebViewPool alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:[[FWFInstanceManager alloc] init]];
+
+  WKWebViewConfiguration *configuration = [[WKWebViewConfiguration alloc] init];
+  [pool prewarmWebViewsWithConfiguration:configuration count:2];
+  XCTAssertEqual(pool.idleWebViewCount, 2);
+
+  FWFWebView *webView = [pool dequeueWebViewWithConfiguration:configuration];
+  XCTAssertNotNil(webView);
+  XCTAssertEqual(webView.webViewPool, pool);
+  XCTAssertEqual(pool.idleWebViewCount, 1);
+}
+
+- (void)testDequeueWebViewWithDifferentConfiguration {
+  FWFWebViewPool *pool = [[FWFWebViewPool alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:[[FWFInstanceManager alloc] init]];
+
+  WKWebViewConfiguration *configuration = [[WKWebViewConfiguration alloc] init];
+  configuration.allowsInlineMediaPlayback = NO;
+  [pool prewarmWebViewsWithConfiguration:configuration count:1];
+
+  WKWebViewConfiguration *otherConfiguration = [[WKWebViewConfiguration alloc] init];
+  otherConfiguration.allowsInlineMediaPlayback = YES;
+  XCTAssertNil([pool dequeueWebViewWithConfiguration:otherConfiguration]);
+  XCTAssertEqual(pool.idleWebViewCount, 1);
+}
+
+- (void)testRecycleWebView API_AVAILABLE(ios(14.0)) {
+  FWFWebViewPool *pool = [[FWFWebViewPool alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:[[FWFInstanceManager alloc] init]];
+
+  WKWebViewConfiguration *configuration = [[WKWebViewConfiguration alloc] init];
+  [pool prewarmWebViewsWithConfiguration:configuration count:1];
+
+  FWFWebView *webView = [pool dequeueWebViewWithConfiguration:configuration];
+  [webView.configuration.userContentController
+      addUserScript:[[WKUserScript alloc] initWithSource:@""
+                                           injectionTime:WKUserScriptInjectionTimeAtDocumentEnd
+                                        forMainFrameOnly:YES]];
+  [webView addObserver:webView
+            forKeyPath:@"estimatedProgress"
+               options:NSKeyValueObservingOptionNew
+               context:nil];
+
+  [pool recycleWebView:webView];
+  XCTAssertEqual(pool.idleWebViewCount, 1);
+  XCTAssertEqual(webView.configuration.userContentController.userScripts.count, 0);
+  XCTAssertEqual([pool dequeueWebViewWithConfiguration:configuration], webView);
+  XCTAssertFalse(webView.canGoBack);
+}
+
+- (void)testRecycleWebViewInViewHierarchy API_AVAILABLE(ios(14.0)) {
+  FWFWebViewPool *pool = [[FWFWebViewPool alloc]
+      initWithBinaryMessenger:OCMProtocolMock(@protocol(FlutterBinaryMessenger))
+              instanceManager:[[FWFInstanceManager alloc] init]];
+
+  WKWebViewConfiguration *configuration = [[WKWebViewConfiguration alloc] init];
+  [pool prewarmWebViewsWithConfiguration:configuration count:1];
+
+  FWFWebView *webView = [pool dequeueWebViewWithConfiguration:configuration];
+  UIView *superview = [[UIView alloc] init];
+  [superview addSubview:webView];
+
+  [pool recycleWebView:webView];
+  XCTAssertEqual(pool.idleWebViewCount, 0);
+}
+@end
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+@import Flutter;
+@import XCTest;
+@import webview_flutter_wkwebview;
+
+#import <OCMock/OCMock.h>
+
+@interface FWFWebViewTextureHostApiTests : XCTestCase
+@end
+
+@implementation FWFWebViewTextureHostApiTests
+- (void)testCreateWithIdentifier {
+  NSObject<FlutterTextureRegistry> *mockTextureRegistry =
+      OCMProtocolMock(@protocol(FlutterTextureRegistry));
+  OCMStub([mockTextureRegistry registerTexture:[OCMArg any]]).andReturn(5);
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  WKWebView *webView = [[WKWebView alloc] init];
+  [instanceManager addDartCreatedInstance:webView withIdentifier:0];
+
+  FWFWebViewTextureHostApiImpl *hostAPI =
+      [[FWFWebViewTextureHostApiImpl alloc] initWithTextureRegistry:mockTextureRegistry
+                                                    instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:1 webViewIdentifier:0 error:&error];
+  FWFWebViewTexture *texture = (FWFWebViewTexture *)[instanceManager instanceForIdentifier:1];
+  XCTAssertTrue([texture isKindOfClass:[FWFWebViewTexture class]]);
+  XCTAssertEqualObjects(texture.webView, webView);
+  XCTAssertNil(error);
+
+  NSNumber *textureId = [hostAPI textureIdForTextureWithIdentifier:1 error:&error];
+  XCTAssertEqualObjects(textureId, @5);
+  XCTAssertNil(error);
+}
+
+- (void)testSetSize {
+  NSObject<FlutterTextureRegistry> *mockTextureRegistry =
+      OCMProtocolMock(@protocol(FlutterTextureRegistry));
+
+  FWFInstanceManager *instanceManager = [[FWFInstanceManager alloc] init];
+  WKWebView *webView = [[WKWebView alloc] init];
+  [instanceManager addDartCreatedInstance:webView withIdentifier:0];
+
+  FWFWebViewTextureHostApiImpl *hostAPI =
+      [[FWFWebViewTextureHostApiImpl alloc] initWithTextureRegistry:mockTextureRegistry
+                                                    instanceManager:instanceManager];
+
+  FlutterError *error;
+  [hostAPI createWithIdentifier:1 webViewIdentifier:0 error:&error];
+  [hostAPI setSizeForTextureWithIdentifier:1 width:320 height:480 error:&error];
+  XCTAssertTrue(CGSizeEqualToSize(webView.frame.size, CGSizeMake(320, 480)));
+  XCTAssertNil(error);
+}
+
+- (void)testUnregistersTextureWhenDeallocated {
+  NSObject<FlutterTextureRegistry> *mockTextureRegistry =
+      OCMProtocolMock(@protocol(FlutterTextureRegistry));
+  OCMStub([mockTextureRegistry registerTexture:[OCMArg any]]).andReturn(5);
+
+  WKWebView *webView = [[WKWebView alloc] init];
+  @autoreleasepool {
+    FWFWebViewTexture *texture = [[FWFWebViewTexture alloc] initWithWebView:webView
+                                                            textureRegistry:mockTextureRegistry];
+    XCTAssertEqual(texture.textureId, 5);
+  }
+
+  OCMVerify([mockTextureRegistry unregisterTexture:5]);
+}
+@end
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #import "FLTWebViewFlutterPlugin.h"
+#import "FWFContentRuleListStoreHostApi.h"
 #import "FWFGeneratedWebKitApis.h"
 #import "FWFHTTPCookieStoreHostApi.h"
 #import "FWFInstanceManager.h"
@@ -10,13 +11,16 @@
 #import "FWFObjectHostApi.h"
 #import "FWFPreferencesHostApi.h"
 #import "FWFScriptMessageHandlerHostApi.h"
+#import "FWFScrollViewDelegateHostApi.h"
 #import "FWFScrollViewHostApi.h"
 #import "FWFUIDelegateHostApi.h"
 #import "FWFUIViewHostApi.h"
 #import "FWFURLHostApi.h"
+#import "FWFURLSchemeHandlerHostApi.h"
 #import "FWFUserContentControllerHostApi.h"
 #import "FWFWebViewConfigurationHostApi.h"
 #import "FWFWebViewHostApi.h"
+#import "FWFWebViewTextureHostApi.h"
 #import "FWFWebsiteDataStoreHostApi.h"
 
 @interface FWFWebViewFactory : NSObject <FlutterPlatformViewFactory>
@@ -69,6 +73,9 @@
   SetUpFWFWKHttpCookieStoreHostApi(
       registrar.messenger,
       [[FWFHTTPCookieStoreHostApiImpl alloc] initWithInstanceManager:instanceManager]);
+  SetUpFWFWKContentRuleListStoreHostApi(
+      registrar.messenger,
+      [[FWFContentRuleListStoreHostApiImpl alloc] initWithInstanceManager:instanceManager]);
   SetUpFWFWKNavigationDelegateHostApi(
       registrar.messenger,
       [[FWFNavigationDelegateHostApiImpl alloc] initWithBinaryMessenger:registrar.messenger
@@ -83,6 +90,10 @@
                                                           instanceManager:instanceManager]);
   SetUpFWFUIScrollViewHostApi(registrar.messenger, [[FWFScrollViewHostApiImpl alloc]
                                                        initWithInstanceManager:instanceManager]);
+  SetUpFWFUIScrollViewDelegateHostApi(
+      registrar.messenger,
+      [[FWFScrollViewDelegateHostApiImpl alloc] initWithBinaryMessenger:registrar.messenger
+                                                        instanceManager:instanceManager]);
   SetUpFWFWKUIDelegateHostApi(registrar.messenger, [[FWFUIDelegateHostApiImpl alloc]
                                                        initWithBinaryMessenger:registrar.messenger
                                                                instanceManager:instanceManager]);
@@ -101,6 +112,14 @@
   SetUpFWFWKWebViewHostApi(registrar.messenger, [[FWFWebViewHostApiImpl alloc]
                                                     initWithBinaryMessenger:registrar.messenger
                                                             instanceManager:instanceManager]);
+  SetUpFWFWKWebViewTextureHostApi(
+      registrar.messenger,
+      [[FWFWebViewTextureHostApiImpl alloc] initWithTextureRegistry:registrar.textures
+                                                    instanceManager:instanceManager]);
+  SetUpFWFWKURLSchemeHandlerHostApi(
+      registrar.messenger,
+      [[FWFURLSchemeHandlerHostApiImpl alloc] initWithBinaryMessenger:registrar.messenger
+                                                      instanceManager:instanceManager]);
   SetUpFWFNSUrlHostApi(registrar.messenger,
                        [[FWFURLHostApiImpl alloc] initWithBinaryMessenger:registrar.messenger
                                                           instanceManager:instanceManager]);
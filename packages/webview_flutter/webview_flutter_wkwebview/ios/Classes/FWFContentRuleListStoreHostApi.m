@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FWFContentRuleListStoreHostApi.h"
+#import "FWFDataConverters.h"
+
+static FlutterError *FWFFlutterErrorFromContentRuleListError(NSError *error) {
+  return [FlutterError errorWithCode:@"FWFContentRuleListError"
+                             message:error.localizedDescription
+                             details:FWFNSErrorDataFromNativeNSError(error)];
+}
+
+@interface FWFContentRuleListStoreHostApiImpl ()
+// InstanceManager must be weak to prevent a circular reference with the object it stores.
+@property(nonatomic, weak) FWFInstanceManager *instanceManager;
+@end
+
+@implementation FWFContentRuleListStoreHostApiImpl
+- (instancetype)initWithInstanceManager:(FWFInstanceManager *)instanceManager {
+  self = [self init];
+  if (self) {
+    _instanceManager = instanceManager;
+  }
+  return self;
+}
+
+- (WKContentRuleListStore *)contentRuleListStoreForIdentifier:(NSInteger)identifier {
+  return (WKContentRuleListStore *)[self.instanceManager instanceForIdentifier:identifier];
+}
+
+- (void)createDefaultStoreWithIdentifier:(NSInteger)identifier
+                                   error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  [self.instanceManager addDartCreatedInstance:[WKContentRuleListStore defaultStore]
+                                withIdentifier:identifier];
+}
+
+- (void)compileContentRuleListForStoreWithIdentifier:(NSInteger)identifier
+                                  ruleListIdentifier:(nonnull NSString *)ruleListIdentifier
+                              encodedContentRuleList:(nonnull NSString *)encodedContentRuleList
+                                          completion:(nonnull void (^)(FlutterError *_Nullable))
+                                                         completion {
+  [[self contentRuleListStoreForIdentifier:identifier]
+      compileContentRuleListForIdentifier:ruleListIdentifier
+                   encodedContentRuleList:encodedContentRuleList
+                        completionHandler:^(WKContentRuleList *ruleList, NSError *error) {
+                          completion(error ? FWFFlutterErrorFromContentRuleListError(error) : nil);
+                        }];
+}
+
+- (void)containsContentRuleListForStoreWithIdentifier:(NSInteger)identifier
+                                   ruleListIdentifier:(nonnull NSString *)ruleListIdentifier
+                                           completion:(nonnull void (^)(NSNumber *_Nullable,
+                                                                        FlutterError *_Nullable))
+                                                          completion {
+  [[self contentRuleListStoreForIdentifier:identifier]
+      getAvailableContentRuleListIdentifiers:^(NSArray<NSString *> *identifiers) {
+        completion(@([identifiers containsObject:ruleListIdentifier]), nil);
+      }];
+}
+
+- (void)removeContentRuleListForStoreWithIdentifier:(NSInteger)identifier
+                                 ruleListIdentifier:(nonnull NSString *)ruleListIdentifier
+                                         completion:
+                                             (nonnull void (^)(FlutterError *_Nullable))completion {
+  [[self contentRuleListStoreForIdentifier:identifier]
+      removeContentRuleListForIdentifier:ruleListIdentifier
+                       completionHandler:^(NSError *error) {
+                         completion(error ? FWFFlutterErrorFromContentRuleListError(error) : nil);
+                       }];
+}
+@end
@@ -46,6 +46,29 @@ extern NSKeyValueObservingOptions FWFNativeNSKeyValueObservingOptionsFromEnumDat
 extern NSHTTPCookiePropertyKey _Nullable FWFNativeNSHTTPCookiePropertyKeyFromEnumData(
     FWFNSHttpCookiePropertyKeyEnumData *data);
 
+/**
+ * Converts an NSHTTPCookiePropertyKey to an FWFNSHttpCookiePropertyKeyEnumData.
+ *
+ * @param key The cookie property key to convert.
+ *
+ * @return An FWFNSHttpCookiePropertyKeyEnumData or nil if key could not be converted.
+ */
+extern FWFNSHttpCookiePropertyKeyEnumData *_Nullable
+FWFNSHttpCookiePropertyKeyEnumDataFromNativeNSHTTPCookiePropertyKey(NSHTTPCookiePropertyKey key);
+
+/**
+ * Converts an NSHTTPCookie to an FWFNSHttpCookieData.
+ *
+ * Properties without a matching FWFNSHttpCookiePropertyKeyEnum are dropped. Dates are converted
+ * to strings in the format of the `Expires` cookie attribute and URLs to absolute strings, so the
+ * returned data can be converted back with FWFNativeNSHTTPCookieFromCookieData.
+ *
+ * @param cookie The object containing information to create an FWFNSHttpCookieData.
+ *
+ * @return An FWFNSHttpCookieData.
+ */
+extern FWFNSHttpCookieData *FWFNSHttpCookieDataFromNativeNSHTTPCookie(NSHTTPCookie *cookie);
+
 /**
  * Converts a WKUserScriptData to a WKUserScript.
  *
@@ -95,6 +118,18 @@ extern NSString *_Nullable FWFNativeWKWebsiteDataTypeFromEnumData(
 extern FWFWKNavigationActionData *FWFWKNavigationActionDataFromNativeWKNavigationAction(
     WKNavigationAction *action);
 
+/**
+ * Converts a WKNavigationAction to an FWFWKNavigationActionData whose request only contains a URL.
+ *
+ * The HTTP method, body and header fields of the request are not copied.
+ *
+ * @param action The object containing information to create a WKNavigationActionData.
+ *
+ * @return A FWFWKNavigationActionData.
+ */
+extern FWFWKNavigationActionData *
+FWFWKNavigationActionDataWithRequestURLFromNativeWKNavigationAction(WKNavigationAction *action);
+
 /**
  * Converts a NSURLRequest to an FWFNSUrlRequestData.
  *
@@ -142,6 +177,24 @@ extern FWFNSErrorData *FWFNSErrorDataFromNativeNSError(NSError *error);
 extern FWFNSKeyValueChangeKeyEnumData *FWFNSKeyValueChangeKeyEnumDataFromNativeNSKeyValueChangeKey(
     NSKeyValueChangeKey key);
 
+/**
+ * The key of the object that JavaScript sends in place of binary data.
+ *
+ * WebKit only passes property list types between JavaScript and native code, so binary data is
+ * sent as a base64 string in an object with this single key.
+ */
+extern NSString *const FWFJavaScriptBinaryDataKey;
+
+/**
+ * Converts a value received from JavaScript to a value that can be sent to Dart.
+ *
+ * @param value A value received from JavaScript.
+ *
+ * @return A FlutterStandardTypedData if value holds binary data under FWFJavaScriptBinaryDataKey,
+ *         otherwise value.
+ */
+extern id _Nullable FWFValueFromJavaScriptValue(id _Nullable value);
+
 /**
  * Converts a WKScriptMessage to an FWFWKScriptMessageData.
  *
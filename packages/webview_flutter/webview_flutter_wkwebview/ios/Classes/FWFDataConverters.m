@@ -99,6 +99,79 @@ NSHTTPCookiePropertyKey _Nullable FWFNativeNSHTTPCookiePropertyKeyFromEnumData(
   return nil;
 }
 
+FWFNSHttpCookiePropertyKeyEnumData *_Nullable
+FWFNSHttpCookiePropertyKeyEnumDataFromNativeNSHTTPCookiePropertyKey(NSHTTPCookiePropertyKey key) {
+  FWFNSHttpCookiePropertyKeyEnum value;
+  if ([key isEqualToString:NSHTTPCookieComment]) {
+    value = FWFNSHttpCookiePropertyKeyEnumComment;
+  } else if ([key isEqualToString:NSHTTPCookieCommentURL]) {
+    value = FWFNSHttpCookiePropertyKeyEnumCommentUrl;
+  } else if ([key isEqualToString:NSHTTPCookieDiscard]) {
+    value = FWFNSHttpCookiePropertyKeyEnumDiscard;
+  } else if ([key isEqualToString:NSHTTPCookieDomain]) {
+    value = FWFNSHttpCookiePropertyKeyEnumDomain;
+  } else if ([key isEqualToString:NSHTTPCookieExpires]) {
+    value = FWFNSHttpCookiePropertyKeyEnumExpires;
+  } else if ([key isEqualToString:NSHTTPCookieMaximumAge]) {
+    value = FWFNSHttpCookiePropertyKeyEnumMaximumAge;
+  } else if ([key isEqualToString:NSHTTPCookieName]) {
+    value = FWFNSHttpCookiePropertyKeyEnumName;
+  } else if ([key isEqualToString:NSHTTPCookieOriginURL]) {
+    value = FWFNSHttpCookiePropertyKeyEnumOriginUrl;
+  } else if ([key isEqualToString:NSHTTPCookiePath]) {
+    value = FWFNSHttpCookiePropertyKeyEnumPath;
+  } else if ([key isEqualToString:NSHTTPCookiePort]) {
+    value = FWFNSHttpCookiePropertyKeyEnumPort;
+  } else if ([key isEqualToString:NSHTTPCookieSecure]) {
+    value = FWFNSHttpCookiePropertyKeyEnumSecure;
+  } else if ([key isEqualToString:NSHTTPCookieValue]) {
+    value = FWFNSHttpCookiePropertyKeyEnumValue;
+  } else if ([key isEqualToString:NSHTTPCookieVersion]) {
+    value = FWFNSHttpCookiePropertyKeyEnumVersion;
+  } else if (@available(iOS 13.0, *)) {
+    if ([key isEqualToString:NSHTTPCookieSameSitePolicy]) {
+      value = FWFNSHttpCookiePropertyKeyEnumSameSitePolicy;
+    } else {
+      return nil;
+    }
+  } else {
+    return nil;
+  }
+
+  return [FWFNSHttpCookiePropertyKeyEnumData makeWithValue:value];
+}
+
+FWFNSHttpCookieData *FWFNSHttpCookieDataFromNativeNSHTTPCookie(NSHTTPCookie *cookie) {
+  static NSDateFormatter *expiresDateFormatter;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    expiresDateFormatter = [[NSDateFormatter alloc] init];
+    expiresDateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    expiresDateFormatter.timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+    expiresDateFormatter.dateFormat = @"EEE, dd MMM yyyy HH:mm:ss 'GMT'";
+  });
+
+  NSMutableArray<FWFNSHttpCookiePropertyKeyEnumData *> *propertyKeys = [NSMutableArray array];
+  NSMutableArray<id> *propertyValues = [NSMutableArray array];
+  [cookie.properties enumerateKeysAndObjectsUsingBlock:^(NSHTTPCookiePropertyKey key, id value,
+                                                         BOOL *stop) {
+    FWFNSHttpCookiePropertyKeyEnumData *keyData =
+        FWFNSHttpCookiePropertyKeyEnumDataFromNativeNSHTTPCookiePropertyKey(key);
+    if (!keyData) {
+      return;
+    }
+
+    if ([value isKindOfClass:[NSDate class]]) {
+      value = [expiresDateFormatter stringFromDate:value];
+    } else if ([value isKindOfClass:[NSURL class]]) {
+      value = ((NSURL *)value).absoluteString;
+    }
+    [propertyKeys addObject:keyData];
+    [propertyValues addObject:value];
+  }];
+  return [FWFNSHttpCookieData makeWithPropertyKeys:propertyKeys propertyValues:propertyValues];
+}
+
 extern WKUserScript *FWFNativeWKUserScriptFromScriptData(FWFWKUserScriptData *data) {
   return [[WKUserScript alloc]
         initWithSource:data.source
@@ -165,6 +238,19 @@ FWFWKNavigationActionData *FWFWKNavigationActionDataFromNativeWKNavigationAction
        navigationType:FWFWKNavigationTypeFromNativeWKNavigationType(action.navigationType)];
 }
 
+FWFWKNavigationActionData *FWFWKNavigationActionDataWithRequestURLFromNativeWKNavigationAction(
+    WKNavigationAction *action) {
+  FWFNSUrlRequestData *requestData =
+      [FWFNSUrlRequestData makeWithUrl:action.request.URL.absoluteString
+                            httpMethod:nil
+                              httpBody:nil
+                   allHttpHeaderFields:@{}];
+  return [FWFWKNavigationActionData
+      makeWithRequest:requestData
+          targetFrame:FWFWKFrameInfoDataFromNativeWKFrameInfo(action.targetFrame)
+       navigationType:FWFWKNavigationTypeFromNativeWKNavigationType(action.navigationType)];
+}
+
 FWFNSUrlRequestData *FWFNSUrlRequestDataFromNativeNSURLRequest(NSURLRequest *request) {
   return [FWFNSUrlRequestData
               makeWithUrl:request.URL.absoluteString
@@ -227,8 +313,23 @@ FWFNSKeyValueChangeKeyEnumData *FWFNSKeyValueChangeKeyEnumDataFromNativeNSKeyVal
   return nil;
 }
 
+NSString *const FWFJavaScriptBinaryDataKey = @"__flutterBinaryData";
+
+id _Nullable FWFValueFromJavaScriptValue(id _Nullable value) {
+  if (![value isKindOfClass:[NSDictionary class]] || [value count] != 1) {
+    return value;
+  }
+  id encodedData = ((NSDictionary *)value)[FWFJavaScriptBinaryDataKey];
+  if (![encodedData isKindOfClass:[NSString class]]) {
+    return value;
+  }
+  NSData *data = [[NSData alloc] initWithBase64EncodedString:encodedData options:0];
+  return data ? [FlutterStandardTypedData typedDataWithBytes:data] : value;
+}
+
 FWFWKScriptMessageData *FWFWKScriptMessageDataFromNativeWKScriptMessage(WKScriptMessage *message) {
-  return [FWFWKScriptMessageData makeWithName:message.name body:message.body];
+  return [FWFWKScriptMessageData makeWithName:message.name
+                                         body:FWFValueFromJavaScriptValue(message.body)];
 }
 
 FWFWKNavigationType FWFWKNavigationTypeFromNativeWKNavigationType(WKNavigationType type) {
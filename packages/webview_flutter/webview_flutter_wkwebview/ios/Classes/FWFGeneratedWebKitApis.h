@@ -281,6 +281,7 @@ typedef NS_ENUM(NSUInteger, FWFWKMediaCaptureType) {
 @class FWFWKScriptMessageData;
 @class FWFWKSecurityOriginData;
 @class FWFNSHttpCookieData;
+@class FWFWKNavigationPolicyRuleData;
 @class FWFObjectOrIdentifier;
 
 @interface FWFNSKeyValueObservingOptionsEnumData : NSObject
@@ -449,6 +450,26 @@ typedef NS_ENUM(NSUInteger, FWFWKMediaCaptureType) {
 @property(nonatomic, copy) NSArray<id> *propertyValues;
 @end
 
+/// A rule that decides the policy of matching navigation actions without
+/// calling `WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction`.
+///
+/// A rule matches a URL when each of its non-null fields match.
+@interface FWFWKNavigationPolicyRuleData : NSObject
+/// `init` unavailable to enforce nonnull fields, see the `make` class method.
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)makeWithHost:(nullable NSString *)host
+                      scheme:(nullable NSString *)scheme
+                  urlPattern:(nullable NSString *)urlPattern
+                      policy:(FWFWKNavigationActionPolicyEnum)policy;
+/// The host the URL must have, or one of its subdomains.
+@property(nonatomic, copy, nullable) NSString *host;
+/// The scheme the URL must have.
+@property(nonatomic, copy, nullable) NSString *scheme;
+/// A regular expression that must match a part of the URL.
+@property(nonatomic, copy, nullable) NSString *urlPattern;
+@property(nonatomic, assign) FWFWKNavigationActionPolicyEnum policy;
+@end
+
 /// An object that can represent either a value supported by
 /// `StandardMessageCodec`, a data class in this pigeon file, or an identifier
 /// of an object stored in an `InstanceManager`.
@@ -525,11 +546,46 @@ NSObject<FlutterMessageCodec> *FWFUIScrollViewHostApiGetCodec(void);
                                                 toX:(double)x
                                                   y:(double)y
                                               error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setDelegateForScrollViewWithIdentifier:(NSInteger)identifier
+                uiScrollViewDelegateIdentifier:(nullable NSNumber *)uiScrollViewDelegateIdentifier
+                                         error:(FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void SetUpFWFUIScrollViewHostApi(id<FlutterBinaryMessenger> binaryMessenger,
                                         NSObject<FWFUIScrollViewHostApi> *_Nullable api);
 
+/// The codec used by FWFUIScrollViewDelegateHostApi.
+NSObject<FlutterMessageCodec> *FWFUIScrollViewDelegateHostApiGetCodec(void);
+
+/// Mirror of UIScrollViewDelegate.
+///
+/// See https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc.
+@protocol FWFUIScrollViewDelegateHostApi
+- (void)createWithIdentifier:(NSInteger)identifier
+            maximumFrequency:(double)maximumFrequency
+                minimumDelta:(double)minimumDelta
+                       error:(FlutterError *_Nullable *_Nonnull)error;
+@end
+
+extern void SetUpFWFUIScrollViewDelegateHostApi(
+    id<FlutterBinaryMessenger> binaryMessenger,
+    NSObject<FWFUIScrollViewDelegateHostApi> *_Nullable api);
+
+/// The codec used by FWFUIScrollViewDelegateFlutterApi.
+NSObject<FlutterMessageCodec> *FWFUIScrollViewDelegateFlutterApiGetCodec(void);
+
+/// Handles callbacks from a UIScrollViewDelegate instance.
+///
+/// See https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc.
+@interface FWFUIScrollViewDelegateFlutterApi : NSObject
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger;
+- (void)scrollViewDidScrollWithIdentifier:(NSInteger)identifier
+                   uiScrollViewIdentifier:(NSInteger)uiScrollViewIdentifier
+                                        x:(double)x
+                                        y:(double)y
+                               completion:(void (^)(FlutterError *_Nullable))completion;
+@end
+
 /// The codec used by FWFWKWebViewConfigurationHostApi.
 NSObject<FlutterMessageCodec> *FWFWKWebViewConfigurationHostApiGetCodec(void);
 
@@ -559,6 +615,12 @@ NSObject<FlutterMessageCodec> *FWFWKWebViewConfigurationHostApiGetCodec(void);
                                                             error:
                                                                 (FlutterError *_Nullable *_Nonnull)
                                                                     error;
+- (void)useSharedProcessPoolForConfigurationWithIdentifier:(NSInteger)identifier
+                                                     error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setURLSchemeHandlerForConfigurationWithIdentifier:(NSInteger)identifier
+                                        handlerIdentifier:(NSInteger)handlerIdentifier
+                                                   scheme:(NSString *)scheme
+                                                    error:(FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void SetUpFWFWKWebViewConfigurationHostApi(
@@ -604,12 +666,45 @@ NSObject<FlutterMessageCodec> *FWFWKUserContentControllerHostApiGetCodec(void);
                                            error:(FlutterError *_Nullable *_Nonnull)error;
 - (void)removeAllUserScriptsForControllerWithIdentifier:(NSInteger)identifier
                                                   error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)addContentRuleListForControllerWithIdentifier:(NSInteger)identifier
+                                      storeIdentifier:(NSInteger)storeIdentifier
+                                   ruleListIdentifier:(NSString *)ruleListIdentifier
+                                           completion:(void (^)(FlutterError *_Nullable))completion;
+- (void)removeAllContentRuleListsForControllerWithIdentifier:(NSInteger)identifier
+                                                       error:(FlutterError *_Nullable *_Nonnull)
+                                                                 error;
 @end
 
 extern void SetUpFWFWKUserContentControllerHostApi(
     id<FlutterBinaryMessenger> binaryMessenger,
     NSObject<FWFWKUserContentControllerHostApi> *_Nullable api);
 
+/// The codec used by FWFWKContentRuleListStoreHostApi.
+NSObject<FlutterMessageCodec> *FWFWKContentRuleListStoreHostApiGetCodec(void);
+
+/// Mirror of WKContentRuleListStore.
+///
+/// See https://developer.apple.com/documentation/webkit/wkcontentruleliststore?language=objc.
+@protocol FWFWKContentRuleListStoreHostApi
+- (void)createDefaultStoreWithIdentifier:(NSInteger)identifier
+                                   error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)compileContentRuleListForStoreWithIdentifier:(NSInteger)identifier
+                                  ruleListIdentifier:(NSString *)ruleListIdentifier
+                              encodedContentRuleList:(NSString *)encodedContentRuleList
+                                          completion:(void (^)(FlutterError *_Nullable))completion;
+- (void)containsContentRuleListForStoreWithIdentifier:(NSInteger)identifier
+                                   ruleListIdentifier:(NSString *)ruleListIdentifier
+                                           completion:(void (^)(NSNumber *_Nullable,
+                                                                FlutterError *_Nullable))completion;
+- (void)removeContentRuleListForStoreWithIdentifier:(NSInteger)identifier
+                                 ruleListIdentifier:(NSString *)ruleListIdentifier
+                                         completion:(void (^)(FlutterError *_Nullable))completion;
+@end
+
+extern void SetUpFWFWKContentRuleListStoreHostApi(
+    id<FlutterBinaryMessenger> binaryMessenger,
+    NSObject<FWFWKContentRuleListStoreHostApi> *_Nullable api);
+
 /// The codec used by FWFWKPreferencesHostApi.
 NSObject<FlutterMessageCodec> *FWFWKPreferencesHostApiGetCodec(void);
 
@@ -636,6 +731,9 @@ NSObject<FlutterMessageCodec> *FWFWKScriptMessageHandlerHostApiGetCodec(void);
 /// See https://developer.apple.com/documentation/webkit/wkscriptmessagehandler?language=objc.
 @protocol FWFWKScriptMessageHandlerHostApi
 - (void)createWithIdentifier:(NSInteger)identifier error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setMessageBatchingForHandlerWithIdentifier:(NSInteger)identifier
+                                      maxBatchSize:(nullable NSNumber *)maxBatchSize
+                                             error:(FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void SetUpFWFWKScriptMessageHandlerHostApi(
@@ -655,6 +753,12 @@ NSObject<FlutterMessageCodec> *FWFWKScriptMessageHandlerFlutterApiGetCodec(void)
                                                 message:(FWFWKScriptMessageData *)message
                                              completion:
                                                  (void (^)(FlutterError *_Nullable))completion;
+- (void)didReceiveScriptMessagesForHandlerWithIdentifier:(NSInteger)identifier
+                         userContentControllerIdentifier:(NSInteger)userContentControllerIdentifier
+                                                messages:
+                                                    (NSArray<FWFWKScriptMessageData *> *)messages
+                                              completion:
+                                                  (void (^)(FlutterError *_Nullable))completion;
 @end
 
 /// The codec used by FWFWKNavigationDelegateHostApi.
@@ -665,6 +769,16 @@ NSObject<FlutterMessageCodec> *FWFWKNavigationDelegateHostApiGetCodec(void);
 /// See https://developer.apple.com/documentation/webkit/wknavigationdelegate?language=objc.
 @protocol FWFWKNavigationDelegateHostApi
 - (void)createWithIdentifier:(NSInteger)identifier error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)
+    setNavigationPolicyRulesForDelegateWithIdentifier:(NSInteger)identifier
+                                                rules:(NSArray<FWFWKNavigationPolicyRuleData *> *)
+                                                          rules
+                     forwardsOnlyMainFrameNavigations:(BOOL)forwardsOnlyMainFrameNavigations
+                                                error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setIncludesRequestDetailsForDelegateWithIdentifier:(NSInteger)identifier
+                                    includesRequestDetails:(BOOL)includesRequestDetails
+                                                     error:
+                                                         (FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void SetUpFWFWKNavigationDelegateHostApi(
@@ -817,12 +931,29 @@ NSObject<FlutterMessageCodec> *FWFWKWebViewHostApiGetCodec(void);
                                   javaScriptString:(NSString *)javaScriptString
                                         completion:(void (^)(id _Nullable,
                                                              FlutterError *_Nullable))completion;
+- (void)evaluateJavaScriptAsJSONForWebViewWithIdentifier:(NSInteger)identifier
+                                        javaScriptString:(NSString *)javaScriptString
+                                              completion:(void (^)(NSString *_Nullable,
+                                                                   FlutterError *_Nullable))
+                                                             completion;
+- (void)callAsyncJavaScriptForWebViewWithIdentifier:(NSInteger)identifier
+                                       functionBody:(NSString *)functionBody
+                                          arguments:(NSDictionary<NSString *, id> *)arguments
+                                         completion:(void (^)(id _Nullable,
+                                                              FlutterError *_Nullable))completion;
 - (void)setInspectableForWebViewWithIdentifier:(NSInteger)identifier
                                    inspectable:(BOOL)inspectable
                                          error:(FlutterError *_Nullable *_Nonnull)error;
 - (nullable NSString *)customUserAgentForWebViewWithIdentifier:(NSInteger)identifier
                                                          error:(FlutterError *_Nullable *_Nonnull)
                                                                    error;
+- (void)prewarmWebViewsWithConfigurationIdentifier:(NSInteger)configurationIdentifier
+                                             count:(NSInteger)count
+                                             error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setSuspendsWhenOffscreenForWebViewWithIdentifier:(NSInteger)identifier
+                                                suspends:(BOOL)suspends
+                                      idleTimeoutSeconds:(nullable NSNumber *)idleTimeoutSeconds
+                                                   error:(FlutterError *_Nullable *_Nonnull)error;
 @end
 
 extern void SetUpFWFWKWebViewHostApi(id<FlutterBinaryMessenger> binaryMessenger,
@@ -879,6 +1010,12 @@ NSObject<FlutterMessageCodec> *FWFWKHttpCookieStoreHostApiGetCodec(void);
 - (void)setCookieForStoreWithIdentifier:(NSInteger)identifier
                                  cookie:(FWFNSHttpCookieData *)cookie
                              completion:(void (^)(FlutterError *_Nullable))completion;
+- (void)setCookiesForStoreWithIdentifier:(NSInteger)identifier
+                                 cookies:(NSArray<FWFNSHttpCookieData *> *)cookies
+                              completion:(void (^)(FlutterError *_Nullable))completion;
+- (void)allCookiesForStoreWithIdentifier:(NSInteger)identifier
+                              completion:(void (^)(NSArray<FWFNSHttpCookieData *> *_Nullable,
+                                                   FlutterError *_Nullable))completion;
 @end
 
 extern void SetUpFWFWKHttpCookieStoreHostApi(id<FlutterBinaryMessenger> binaryMessenger,
@@ -919,4 +1056,94 @@ NSObject<FlutterMessageCodec> *FWFNSUrlFlutterApiGetCodec(void);
                   completion:(void (^)(FlutterError *_Nullable))completion;
 @end
 
+/// The codec used by FWFWKWebViewTextureHostApi.
+NSObject<FlutterMessageCodec> *FWFWKWebViewTextureHostApiGetCodec(void);
+
+/// Host API for a Flutter texture that displays snapshots of a WKWebView.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See
+/// https://developer.apple.com/documentation/webkit/wkwebview/2873260-takesnapshotwithconfiguration?language=objc.
+@protocol FWFWKWebViewTextureHostApi
+- (void)createWithIdentifier:(NSInteger)identifier
+           webViewIdentifier:(NSInteger)webViewIdentifier
+                       error:(FlutterError *_Nullable *_Nonnull)error;
+/// @return `nil` only when `error != nil`.
+- (nullable NSNumber *)textureIdForTextureWithIdentifier:(NSInteger)identifier
+                                                   error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)setSizeForTextureWithIdentifier:(NSInteger)identifier
+                                  width:(double)width
+                                 height:(double)height
+                                  error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)updateTextureWithIdentifier:(NSInteger)identifier
+                         completion:(void (^)(FlutterError *_Nullable))completion;
+@end
+
+extern void SetUpFWFWKWebViewTextureHostApi(id<FlutterBinaryMessenger> binaryMessenger,
+                                            NSObject<FWFWKWebViewTextureHostApi> *_Nullable api);
+
+/// The codec used by FWFWKURLSchemeHandlerHostApi.
+NSObject<FlutterMessageCodec> *FWFWKURLSchemeHandlerHostApiGetCodec(void);
+
+/// Host API for `WKURLSchemeHandler`.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc.
+@protocol FWFWKURLSchemeHandlerHostApi
+- (void)createWithIdentifier:(NSInteger)identifier error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)addFileRouteForHandlerWithIdentifier:(NSInteger)identifier
+                                  pathPrefix:(NSString *)pathPrefix
+                               directoryPath:(NSString *)directoryPath
+                                       error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)addFlutterAssetRouteForHandlerWithIdentifier:(NSInteger)identifier
+                                          pathPrefix:(NSString *)pathPrefix
+                                      assetDirectory:(NSString *)assetDirectory
+                                               error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)didReceiveResponseForHandlerWithIdentifier:(NSInteger)identifier
+                                    taskIdentifier:(NSInteger)taskIdentifier
+                                        statusCode:(NSInteger)statusCode
+                                           headers:(NSDictionary<NSString *, NSString *> *)headers
+                                             error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)didReceiveDataForHandlerWithIdentifier:(NSInteger)identifier
+                                taskIdentifier:(NSInteger)taskIdentifier
+                                          data:(FlutterStandardTypedData *)data
+                                         error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)didFinishForHandlerWithIdentifier:(NSInteger)identifier
+                           taskIdentifier:(NSInteger)taskIdentifier
+                                    error:(FlutterError *_Nullable *_Nonnull)error;
+- (void)didFailForHandlerWithIdentifier:(NSInteger)identifier
+                         taskIdentifier:(NSInteger)taskIdentifier
+                       errorDescription:(NSString *)errorDescription
+                                  error:(FlutterError *_Nullable *_Nonnull)error;
+@end
+
+extern void SetUpFWFWKURLSchemeHandlerHostApi(
+    id<FlutterBinaryMessenger> binaryMessenger,
+    NSObject<FWFWKURLSchemeHandlerHostApi> *_Nullable api);
+
+/// The codec used by FWFWKURLSchemeHandlerFlutterApi.
+NSObject<FlutterMessageCodec> *FWFWKURLSchemeHandlerFlutterApiGetCodec(void);
+
+/// Handles callbacks from a WKURLSchemeHandler instance.
+///
+/// See https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc.
+@interface FWFWKURLSchemeHandlerFlutterApi : NSObject
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger;
+- (void)startURLSchemeTaskForHandlerWithIdentifier:(NSInteger)identifier
+                                 webViewIdentifier:(NSInteger)webViewIdentifier
+                                    taskIdentifier:(NSInteger)taskIdentifier
+                                           request:(FWFNSUrlRequestData *)request
+                                        completion:(void (^)(FlutterError *_Nullable))completion;
+- (void)stopURLSchemeTaskForHandlerWithIdentifier:(NSInteger)identifier
+                                webViewIdentifier:(NSInteger)webViewIdentifier
+                                   taskIdentifier:(NSInteger)taskIdentifier
+                                       completion:(void (^)(FlutterError *_Nullable))completion;
+@end
+
 NS_ASSUME_NONNULL_END
@@ -703,6 +703,39 @@ static id GetNullableObjectAtIndex(NSArray *array, NSInteger key) {
 }
 @end
 
+@implementation FWFWKNavigationPolicyRuleData
++ (instancetype)makeWithHost:(nullable NSString *)host
+                      scheme:(nullable NSString *)scheme
+                  urlPattern:(nullable NSString *)urlPattern
+                      policy:(FWFWKNavigationActionPolicyEnum)policy {
+  FWFWKNavigationPolicyRuleData *pigeonResult = [[FWFWKNavigationPolicyRuleData alloc] init];
+  pigeonResult.host = host;
+  pigeonResult.scheme = scheme;
+  pigeonResult.urlPattern = urlPattern;
+  pigeonResult.policy = policy;
+  return pigeonResult;
+}
++ (FWFWKNavigationPolicyRuleData *)fromList:(NSArray *)list {
+  FWFWKNavigationPolicyRuleData *pigeonResult = [[FWFWKNavigationPolicyRuleData alloc] init];
+  pigeonResult.host = GetNullableObjectAtIndex(list, 0);
+  pigeonResult.scheme = GetNullableObjectAtIndex(list, 1);
+  pigeonResult.urlPattern = GetNullableObjectAtIndex(list, 2);
+  pigeonResult.policy = [GetNullableObjectAtIndex(list, 3) integerValue];
+  return pigeonResult;
+}
++ (nullable FWFWKNavigationPolicyRuleData *)nullableFromList:(NSArray *)list {
+  return (list) ? [FWFWKNavigationPolicyRuleData fromList:list] : nil;
+}
+- (NSArray *)toList {
+  return @[
+    self.host ?: [NSNull null],
+    self.scheme ?: [NSNull null],
+    self.urlPattern ?: [NSNull null],
+    @(self.policy),
+  ];
+}
+@end
+
 @implementation FWFObjectOrIdentifier
 + (instancetype)makeWithValue:(nullable id)value isIdentifier:(BOOL)isIdentifier {
   FWFObjectOrIdentifier *pigeonResult = [[FWFObjectOrIdentifier alloc] init];
@@ -1021,7 +1054,117 @@ void SetUpFWFUIScrollViewHostApi(id<FlutterBinaryMessenger> binaryMessenger,
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewHostApi.setDelegate"
+        binaryMessenger:binaryMessenger
+                  codec:FWFUIScrollViewHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (setDelegateForScrollViewWithIdentifier:uiScrollViewDelegateIdentifier:error:)],
+                @"FWFUIScrollViewHostApi api (%@) doesn't respond to "
+                @"@selector(setDelegateForScrollViewWithIdentifier:uiScrollViewDelegateIdentifier:"
+                @"error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSNumber *arg_uiScrollViewDelegateIdentifier = GetNullableObjectAtIndex(args, 1);
+        FlutterError *error;
+        [api setDelegateForScrollViewWithIdentifier:arg_identifier
+                     uiScrollViewDelegateIdentifier:arg_uiScrollViewDelegateIdentifier
+                                              error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+}
+NSObject<FlutterMessageCodec> *FWFUIScrollViewDelegateHostApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  return sSharedObject;
+}
+
+void SetUpFWFUIScrollViewDelegateHostApi(id<FlutterBinaryMessenger> binaryMessenger,
+                                         NSObject<FWFUIScrollViewDelegateHostApi> *api) {
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateHostApi.create"
+        binaryMessenger:binaryMessenger
+                  codec:FWFUIScrollViewDelegateHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (createWithIdentifier:maximumFrequency:minimumDelta:error:)],
+                @"FWFUIScrollViewDelegateHostApi api (%@) doesn't respond to "
+                @"@selector(createWithIdentifier:maximumFrequency:minimumDelta:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        double arg_maximumFrequency = [GetNullableObjectAtIndex(args, 1) doubleValue];
+        double arg_minimumDelta = [GetNullableObjectAtIndex(args, 2) doubleValue];
+        FlutterError *error;
+        [api createWithIdentifier:arg_identifier
+                 maximumFrequency:arg_maximumFrequency
+                     minimumDelta:arg_minimumDelta
+                            error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+}
+NSObject<FlutterMessageCodec> *FWFUIScrollViewDelegateFlutterApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  return sSharedObject;
+}
+
+@interface FWFUIScrollViewDelegateFlutterApi ()
+@property(nonatomic, strong) NSObject<FlutterBinaryMessenger> *binaryMessenger;
+@end
+
+@implementation FWFUIScrollViewDelegateFlutterApi
+
+- (instancetype)initWithBinaryMessenger:(NSObject<FlutterBinaryMessenger> *)binaryMessenger {
+  self = [super init];
+  if (self) {
+    _binaryMessenger = binaryMessenger;
+  }
+  return self;
+}
+- (void)scrollViewDidScrollWithIdentifier:(NSInteger)arg_identifier
+                   uiScrollViewIdentifier:(NSInteger)arg_uiScrollViewIdentifier
+                                        x:(double)arg_x
+                                        y:(double)arg_y
+                               completion:(void (^)(FlutterError *_Nullable))completion {
+  FlutterBasicMessageChannel *channel = [FlutterBasicMessageChannel
+      messageChannelWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                             @"UIScrollViewDelegateFlutterApi.scrollViewDidScroll"
+             binaryMessenger:self.binaryMessenger
+                       codec:FWFUIScrollViewDelegateFlutterApiGetCodec()];
+  [channel
+      sendMessage:@[ @(arg_identifier), @(arg_uiScrollViewIdentifier), @(arg_x), @(arg_y) ]
+            reply:^(NSArray<id> *reply) {
+              if (reply != nil) {
+                if (reply.count > 1) {
+                  completion([FlutterError errorWithCode:reply[0]
+                                                 message:reply[1]
+                                                 details:reply[2]]);
+                } else {
+                  completion(nil);
+                }
+              } else {
+                completion([FlutterError errorWithCode:@"channel-error"
+                                               message:@"Unable to establish connection on channel."
+                                               details:@""]);
+              }
+            }];
 }
+@end
 @interface FWFWKWebViewConfigurationHostApiCodecReader : FlutterStandardReader
 @end
 @implementation FWFWKWebViewConfigurationHostApiCodecReader
@@ -1203,6 +1346,59 @@ void SetUpFWFWKWebViewConfigurationHostApi(id<FlutterBinaryMessenger> binaryMess
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKWebViewConfigurationHostApi.useSharedProcessPool"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewConfigurationHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (useSharedProcessPoolForConfigurationWithIdentifier:error:)],
+                @"FWFWKWebViewConfigurationHostApi api (%@) doesn't respond to "
+                @"@selector(useSharedProcessPoolForConfigurationWithIdentifier:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        FlutterError *error;
+        [api useSharedProcessPoolForConfigurationWithIdentifier:arg_identifier error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKWebViewConfigurationHostApi.setURLSchemeHandler"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewConfigurationHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (setURLSchemeHandlerForConfigurationWithIdentifier:
+                                                      handlerIdentifier:scheme:error:)],
+                @"FWFWKWebViewConfigurationHostApi api (%@) doesn't respond to "
+                @"@selector(setURLSchemeHandlerForConfigurationWithIdentifier:handlerIdentifier:"
+                @"scheme:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_handlerIdentifier = [GetNullableObjectAtIndex(args, 1) integerValue];
+        NSString *arg_scheme = GetNullableObjectAtIndex(args, 2);
+        FlutterError *error;
+        [api setURLSchemeHandlerForConfigurationWithIdentifier:arg_identifier
+                                             handlerIdentifier:arg_handlerIdentifier
+                                                        scheme:arg_scheme
+                                                         error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
 NSObject<FlutterMessageCodec> *FWFWKWebViewConfigurationFlutterApiGetCodec(void) {
   static FlutterStandardMessageCodec *sSharedObject = nil;
@@ -1460,6 +1656,178 @@ void SetUpFWFWKUserContentControllerHostApi(id<FlutterBinaryMessenger> binaryMes
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKUserContentControllerHostApi.addContentRuleList"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKUserContentControllerHostApiGetCodec()];
+    if (api) {
+      NSCAssert(
+          [api respondsToSelector:@selector
+               (addContentRuleListForControllerWithIdentifier:
+                                              storeIdentifier:ruleListIdentifier:completion:)],
+          @"FWFWKUserContentControllerHostApi api (%@) doesn't respond to "
+          @"@selector(addContentRuleListForControllerWithIdentifier:storeIdentifier:"
+          @"ruleListIdentifier:completion:)",
+          api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_storeIdentifier = [GetNullableObjectAtIndex(args, 1) integerValue];
+        NSString *arg_ruleListIdentifier = GetNullableObjectAtIndex(args, 2);
+        [api addContentRuleListForControllerWithIdentifier:arg_identifier
+                                           storeIdentifier:arg_storeIdentifier
+                                        ruleListIdentifier:arg_ruleListIdentifier
+                                                completion:^(FlutterError *_Nullable error) {
+                                                  callback(wrapResult(nil, error));
+                                                }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKUserContentControllerHostApi.removeAllContentRuleLists"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKUserContentControllerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (removeAllContentRuleListsForControllerWithIdentifier:error:)],
+                @"FWFWKUserContentControllerHostApi api (%@) doesn't respond to "
+                @"@selector(removeAllContentRuleListsForControllerWithIdentifier:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        FlutterError *error;
+        [api removeAllContentRuleListsForControllerWithIdentifier:arg_identifier error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+}
+NSObject<FlutterMessageCodec> *FWFWKContentRuleListStoreHostApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  return sSharedObject;
+}
+
+void SetUpFWFWKContentRuleListStoreHostApi(id<FlutterBinaryMessenger> binaryMessenger,
+                                           NSObject<FWFWKContentRuleListStoreHostApi> *api) {
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKContentRuleListStoreHostApi.createDefaultStore"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKContentRuleListStoreHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(createDefaultStoreWithIdentifier:error:)],
+                @"FWFWKContentRuleListStoreHostApi api (%@) doesn't respond to "
+                @"@selector(createDefaultStoreWithIdentifier:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        FlutterError *error;
+        [api createDefaultStoreWithIdentifier:arg_identifier error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKContentRuleListStoreHostApi.compileContentRuleList"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKContentRuleListStoreHostApiGetCodec()];
+    if (api) {
+      NSCAssert(
+          [api respondsToSelector:@selector
+               (compileContentRuleListForStoreWithIdentifier:
+                                          ruleListIdentifier:encodedContentRuleList:completion:)],
+          @"FWFWKContentRuleListStoreHostApi api (%@) doesn't respond to "
+          @"@selector(compileContentRuleListForStoreWithIdentifier:ruleListIdentifier:"
+          @"encodedContentRuleList:completion:)",
+          api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSString *arg_ruleListIdentifier = GetNullableObjectAtIndex(args, 1);
+        NSString *arg_encodedContentRuleList = GetNullableObjectAtIndex(args, 2);
+        [api compileContentRuleListForStoreWithIdentifier:arg_identifier
+                                       ruleListIdentifier:arg_ruleListIdentifier
+                                   encodedContentRuleList:arg_encodedContentRuleList
+                                               completion:^(FlutterError *_Nullable error) {
+                                                 callback(wrapResult(nil, error));
+                                               }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKContentRuleListStoreHostApi.containsContentRuleList"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKContentRuleListStoreHostApiGetCodec()];
+    if (api) {
+      NSCAssert(
+          [api respondsToSelector:@selector
+               (containsContentRuleListForStoreWithIdentifier:ruleListIdentifier:completion:)],
+          @"FWFWKContentRuleListStoreHostApi api (%@) doesn't respond to "
+          @"@selector(containsContentRuleListForStoreWithIdentifier:ruleListIdentifier:"
+          @"completion:)",
+          api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSString *arg_ruleListIdentifier = GetNullableObjectAtIndex(args, 1);
+        [api containsContentRuleListForStoreWithIdentifier:arg_identifier
+                                        ruleListIdentifier:arg_ruleListIdentifier
+                                                completion:^(NSNumber *_Nullable output,
+                                                             FlutterError *_Nullable error) {
+                                                  callback(wrapResult(output, error));
+                                                }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKContentRuleListStoreHostApi.removeContentRuleList"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKContentRuleListStoreHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (removeContentRuleListForStoreWithIdentifier:ruleListIdentifier:completion:)],
+                @"FWFWKContentRuleListStoreHostApi api (%@) doesn't respond to "
+                @"@selector(removeContentRuleListForStoreWithIdentifier:ruleListIdentifier:"
+                @"completion:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSString *arg_ruleListIdentifier = GetNullableObjectAtIndex(args, 1);
+        [api removeContentRuleListForStoreWithIdentifier:arg_identifier
+                                      ruleListIdentifier:arg_ruleListIdentifier
+                                              completion:^(FlutterError *_Nullable error) {
+                                                callback(wrapResult(nil, error));
+                                              }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
 NSObject<FlutterMessageCodec> *FWFWKPreferencesHostApiGetCodec(void) {
   static FlutterStandardMessageCodec *sSharedObject = nil;
@@ -1553,23 +1921,49 @@ void SetUpFWFWKScriptMessageHandlerHostApi(id<FlutterBinaryMessenger> binaryMess
       [channel setMessageHandler:nil];
     }
   }
-}
-@interface FWFWKScriptMessageHandlerFlutterApiCodecReader : FlutterStandardReader
-@end
-@implementation FWFWKScriptMessageHandlerFlutterApiCodecReader
-- (nullable id)readValueOfType:(UInt8)type {
-  switch (type) {
-    case 128:
-      return [FWFWKScriptMessageData fromList:[self readValue]];
-    default:
-      return [super readValueOfType:type];
-  }
-}
-@end
-
-@interface FWFWKScriptMessageHandlerFlutterApiCodecWriter : FlutterStandardWriter
-@end
-@implementation FWFWKScriptMessageHandlerFlutterApiCodecWriter
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKScriptMessageHandlerHostApi.setMessageBatching"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKScriptMessageHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (setMessageBatchingForHandlerWithIdentifier:maxBatchSize:error:)],
+                @"FWFWKScriptMessageHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(setMessageBatchingForHandlerWithIdentifier:maxBatchSize:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSNumber *arg_maxBatchSize = GetNullableObjectAtIndex(args, 1);
+        FlutterError *error;
+        [api setMessageBatchingForHandlerWithIdentifier:arg_identifier
+                                           maxBatchSize:arg_maxBatchSize
+                                                  error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+}
+@interface FWFWKScriptMessageHandlerFlutterApiCodecReader : FlutterStandardReader
+@end
+@implementation FWFWKScriptMessageHandlerFlutterApiCodecReader
+- (nullable id)readValueOfType:(UInt8)type {
+  switch (type) {
+    case 128:
+      return [FWFWKScriptMessageData fromList:[self readValue]];
+    default:
+      return [super readValueOfType:type];
+  }
+}
+@end
+
+@interface FWFWKScriptMessageHandlerFlutterApiCodecWriter : FlutterStandardWriter
+@end
+@implementation FWFWKScriptMessageHandlerFlutterApiCodecWriter
 - (void)writeValue:(id)value {
   if ([value isKindOfClass:[FWFWKScriptMessageData class]]) {
     [self writeByte:128];
@@ -1645,11 +2039,84 @@ NSObject<FlutterMessageCodec> *FWFWKScriptMessageHandlerFlutterApiGetCodec(void)
               }
             }];
 }
+- (void)
+    didReceiveScriptMessagesForHandlerWithIdentifier:(NSInteger)arg_identifier
+                     userContentControllerIdentifier:(NSInteger)arg_userContentControllerIdentifier
+                                            messages:
+                                                (NSArray<FWFWKScriptMessageData *> *)arg_messages
+                                          completion:(void (^)(FlutterError *_Nullable))completion {
+  FlutterBasicMessageChannel *channel = [FlutterBasicMessageChannel
+      messageChannelWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                             @"WKScriptMessageHandlerFlutterApi.didReceiveScriptMessages"
+             binaryMessenger:self.binaryMessenger
+                       codec:FWFWKScriptMessageHandlerFlutterApiGetCodec()];
+  [channel
+      sendMessage:@[
+        @(arg_identifier), @(arg_userContentControllerIdentifier), arg_messages ?: [NSNull null]
+      ]
+            reply:^(NSArray<id> *reply) {
+              if (reply != nil) {
+                if (reply.count > 1) {
+                  completion([FlutterError errorWithCode:reply[0]
+                                                 message:reply[1]
+                                                 details:reply[2]]);
+                } else {
+                  completion(nil);
+                }
+              } else {
+                completion([FlutterError errorWithCode:@"channel-error"
+                                               message:@"Unable to establish connection on channel."
+                                               details:@""]);
+              }
+            }];
+}
+@end
+
+@interface FWFWKNavigationDelegateHostApiCodecReader : FlutterStandardReader
+@end
+@implementation FWFWKNavigationDelegateHostApiCodecReader
+- (nullable id)readValueOfType:(UInt8)type {
+  switch (type) {
+    case 128:
+      return [FWFWKNavigationPolicyRuleData fromList:[self readValue]];
+    default:
+      return [super readValueOfType:type];
+  }
+}
+@end
+
+@interface FWFWKNavigationDelegateHostApiCodecWriter : FlutterStandardWriter
+@end
+@implementation FWFWKNavigationDelegateHostApiCodecWriter
+- (void)writeValue:(id)value {
+  if ([value isKindOfClass:[FWFWKNavigationPolicyRuleData class]]) {
+    [self writeByte:128];
+    [self writeValue:[value toList]];
+  } else {
+    [super writeValue:value];
+  }
+}
+@end
+
+@interface FWFWKNavigationDelegateHostApiCodecReaderWriter : FlutterStandardReaderWriter
+@end
+@implementation FWFWKNavigationDelegateHostApiCodecReaderWriter
+- (FlutterStandardWriter *)writerWithData:(NSMutableData *)data {
+  return [[FWFWKNavigationDelegateHostApiCodecWriter alloc] initWithData:data];
+}
+- (FlutterStandardReader *)readerWithData:(NSData *)data {
+  return [[FWFWKNavigationDelegateHostApiCodecReader alloc] initWithData:data];
+}
 @end
 
 NSObject<FlutterMessageCodec> *FWFWKNavigationDelegateHostApiGetCodec(void) {
   static FlutterStandardMessageCodec *sSharedObject = nil;
-  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  static dispatch_once_t sPred = 0;
+  dispatch_once(&sPred, ^{
+    FWFWKNavigationDelegateHostApiCodecReaderWriter *readerWriter =
+        [[FWFWKNavigationDelegateHostApiCodecReaderWriter alloc] init];
+    sSharedObject = [FlutterStandardMessageCodec codecWithReaderWriter:readerWriter];
+  });
   return sSharedObject;
 }
 
@@ -1677,6 +2144,65 @@ void SetUpFWFWKNavigationDelegateHostApi(id<FlutterBinaryMessenger> binaryMessen
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi."
+                        @"setNavigationPolicyRules"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKNavigationDelegateHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (setNavigationPolicyRulesForDelegateWithIdentifier:
+                                                                  rules:
+                                       forwardsOnlyMainFrameNavigations:error:)],
+                @"FWFWKNavigationDelegateHostApi api (%@) doesn't respond to "
+                @"@selector(setNavigationPolicyRulesForDelegateWithIdentifier:rules:"
+                @"forwardsOnlyMainFrameNavigations:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSArray<FWFWKNavigationPolicyRuleData *> *arg_rules = GetNullableObjectAtIndex(args, 1);
+        BOOL arg_forwardsOnlyMainFrameNavigations = [GetNullableObjectAtIndex(args, 2) boolValue];
+        FlutterError *error;
+        [api setNavigationPolicyRulesForDelegateWithIdentifier:arg_identifier
+                                                         rules:arg_rules
+                              forwardsOnlyMainFrameNavigations:arg_forwardsOnlyMainFrameNavigations
+                                                         error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi."
+                        @"setIncludesRequestDetails"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKNavigationDelegateHostApiGetCodec()];
+    if (api) {
+      NSCAssert(
+          [api respondsToSelector:@selector
+               (setIncludesRequestDetailsForDelegateWithIdentifier:includesRequestDetails:error:)],
+          @"FWFWKNavigationDelegateHostApi api (%@) doesn't respond to "
+          @"@selector(setIncludesRequestDetailsForDelegateWithIdentifier:includesRequestDetails:"
+          @"error:)",
+          api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        BOOL arg_includesRequestDetails = [GetNullableObjectAtIndex(args, 1) boolValue];
+        FlutterError *error;
+        [api setIncludesRequestDetailsForDelegateWithIdentifier:arg_identifier
+                                         includesRequestDetails:arg_includesRequestDetails
+                                                          error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
 @interface FWFWKNavigationDelegateFlutterApiCodecReader : FlutterStandardReader
 @end
@@ -2762,6 +3288,66 @@ void SetUpFWFWKWebViewHostApi(id<FlutterBinaryMessenger> binaryMessenger,
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi."
+                        @"evaluateJavaScriptAsJson"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (evaluateJavaScriptAsJSONForWebViewWithIdentifier:
+                                                      javaScriptString:completion:)],
+                @"FWFWKWebViewHostApi api (%@) doesn't respond to "
+                @"@selector(evaluateJavaScriptAsJSONForWebViewWithIdentifier:javaScriptString:"
+                @"completion:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSString *arg_javaScriptString = GetNullableObjectAtIndex(args, 1);
+        [api evaluateJavaScriptAsJSONForWebViewWithIdentifier:arg_identifier
+                                             javaScriptString:arg_javaScriptString
+                                                   completion:^(NSString *_Nullable output,
+                                                                FlutterError *_Nullable error) {
+                                                     callback(wrapResult(output, error));
+                                                   }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:
+               @"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.callAsyncJavaScript"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (callAsyncJavaScriptForWebViewWithIdentifier:
+                                                     functionBody:arguments:completion:)],
+                @"FWFWKWebViewHostApi api (%@) doesn't respond to "
+                @"@selector(callAsyncJavaScriptForWebViewWithIdentifier:functionBody:arguments:"
+                @"completion:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSString *arg_functionBody = GetNullableObjectAtIndex(args, 1);
+        NSDictionary<NSString *, id> *arg_arguments = GetNullableObjectAtIndex(args, 2);
+        [api callAsyncJavaScriptForWebViewWithIdentifier:arg_identifier
+                                            functionBody:arg_functionBody
+                                               arguments:arg_arguments
+                                              completion:^(id _Nullable output,
+                                                           FlutterError *_Nullable error) {
+                                                callback(wrapResult(output, error));
+                                              }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
   {
     FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
            initWithName:
@@ -2811,6 +3397,61 @@ void SetUpFWFWKWebViewHostApi(id<FlutterBinaryMessenger> binaryMessenger,
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.prewarm"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(prewarmWebViewsWithConfigurationIdentifier:
+                                                                                   count:error:)],
+                @"FWFWKWebViewHostApi api (%@) doesn't respond to "
+                @"@selector(prewarmWebViewsWithConfigurationIdentifier:count:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_configurationIdentifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_count = [GetNullableObjectAtIndex(args, 1) integerValue];
+        FlutterError *error;
+        [api prewarmWebViewsWithConfigurationIdentifier:arg_configurationIdentifier
+                                                  count:arg_count
+                                                  error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi."
+                        @"setSuspendsWhenOffscreen"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (setSuspendsWhenOffscreenForWebViewWithIdentifier:
+                                                              suspends:idleTimeoutSeconds:error:)],
+                @"FWFWKWebViewHostApi api (%@) doesn't respond to "
+                @"@selector(setSuspendsWhenOffscreenForWebViewWithIdentifier:suspends:"
+                @"idleTimeoutSeconds:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        BOOL arg_suspends = [GetNullableObjectAtIndex(args, 1) boolValue];
+        NSNumber *arg_idleTimeoutSeconds = GetNullableObjectAtIndex(args, 2);
+        FlutterError *error;
+        [api setSuspendsWhenOffscreenForWebViewWithIdentifier:arg_identifier
+                                                     suspends:arg_suspends
+                                           idleTimeoutSeconds:arg_idleTimeoutSeconds
+                                                        error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
 NSObject<FlutterMessageCodec> *FWFWKUIDelegateHostApiGetCodec(void) {
   static FlutterStandardMessageCodec *sSharedObject = nil;
@@ -3105,6 +3746,56 @@ void SetUpFWFWKHttpCookieStoreHostApi(id<FlutterBinaryMessenger> binaryMessenger
       [channel setMessageHandler:nil];
     }
   }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:
+               @"dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookies"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKHttpCookieStoreHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(setCookiesForStoreWithIdentifier:
+                                                                          cookies:completion:)],
+                @"FWFWKHttpCookieStoreHostApi api (%@) doesn't respond to "
+                @"@selector(setCookiesForStoreWithIdentifier:cookies:completion:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSArray<FWFNSHttpCookieData *> *arg_cookies = GetNullableObjectAtIndex(args, 1);
+        [api setCookiesForStoreWithIdentifier:arg_identifier
+                                      cookies:arg_cookies
+                                   completion:^(FlutterError *_Nullable error) {
+                                     callback(wrapResult(nil, error));
+                                   }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:
+               @"dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.getAllCookies"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKHttpCookieStoreHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(allCookiesForStoreWithIdentifier:completion:)],
+                @"FWFWKHttpCookieStoreHostApi api (%@) doesn't respond to "
+                @"@selector(allCookiesForStoreWithIdentifier:completion:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        [api allCookiesForStoreWithIdentifier:arg_identifier
+                                   completion:^(NSArray<FWFNSHttpCookieData *> *_Nullable output,
+                                                FlutterError *_Nullable error) {
+                                     callback(wrapResult(output, error));
+                                   }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
 }
 NSObject<FlutterMessageCodec> *FWFNSUrlHostApiGetCodec(void) {
   static FlutterStandardMessageCodec *sSharedObject = nil;
@@ -3181,3 +3872,432 @@ NSObject<FlutterMessageCodec> *FWFNSUrlFlutterApiGetCodec(void) {
             }];
 }
 @end
+
+NSObject<FlutterMessageCodec> *FWFWKWebViewTextureHostApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  return sSharedObject;
+}
+
+void SetUpFWFWKWebViewTextureHostApi(id<FlutterBinaryMessenger> binaryMessenger,
+                                     NSObject<FWFWKWebViewTextureHostApi> *api) {
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.create"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewTextureHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(createWithIdentifier:webViewIdentifier:error:)],
+                @"FWFWKWebViewTextureHostApi api (%@) doesn't respond to "
+                @"@selector(createWithIdentifier:webViewIdentifier:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_webViewIdentifier = [GetNullableObjectAtIndex(args, 1) integerValue];
+        FlutterError *error;
+        [api createWithIdentifier:arg_identifier
+                webViewIdentifier:arg_webViewIdentifier
+                            error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:
+               @"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.getTextureId"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewTextureHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(textureIdForTextureWithIdentifier:error:)],
+                @"FWFWKWebViewTextureHostApi api (%@) doesn't respond to "
+                @"@selector(textureIdForTextureWithIdentifier:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        FlutterError *error;
+        NSNumber *output = [api textureIdForTextureWithIdentifier:arg_identifier error:&error];
+        callback(wrapResult(output, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.setSize"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewTextureHostApiGetCodec()];
+    if (api) {
+      NSCAssert(
+          [api respondsToSelector:@selector(setSizeForTextureWithIdentifier:width:height:error:)],
+          @"FWFWKWebViewTextureHostApi api (%@) doesn't respond to "
+          @"@selector(setSizeForTextureWithIdentifier:width:height:error:)",
+          api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        double arg_width = [GetNullableObjectAtIndex(args, 1) doubleValue];
+        double arg_height = [GetNullableObjectAtIndex(args, 2) doubleValue];
+        FlutterError *error;
+        [api setSizeForTextureWithIdentifier:arg_identifier
+                                       width:arg_width
+                                      height:arg_height
+                                       error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.update"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKWebViewTextureHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(updateTextureWithIdentifier:completion:)],
+                @"FWFWKWebViewTextureHostApi api (%@) doesn't respond to "
+                @"@selector(updateTextureWithIdentifier:completion:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        [api updateTextureWithIdentifier:arg_identifier
+                              completion:^(FlutterError *_Nullable error) {
+                                callback(wrapResult(nil, error));
+                              }];
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+}
+NSObject<FlutterMessageCodec> *FWFWKURLSchemeHandlerHostApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  sSharedObject = [FlutterStandardMessageCodec sharedInstance];
+  return sSharedObject;
+}
+
+void SetUpFWFWKURLSchemeHandlerHostApi(id<FlutterBinaryMessenger> binaryMessenger,
+                                       NSObject<FWFWKURLSchemeHandlerHostApi> *api) {
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKURLSchemeHandlerHostApi.create"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKURLSchemeHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector(createWithIdentifier:error:)],
+                @"FWFWKURLSchemeHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(createWithIdentifier:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        FlutterError *error;
+        [api createWithIdentifier:arg_identifier error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKURLSchemeHandlerHostApi.addFileRoute"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKURLSchemeHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (addFileRouteForHandlerWithIdentifier:pathPrefix:directoryPath:error:)],
+                @"FWFWKURLSchemeHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(addFileRouteForHandlerWithIdentifier:pathPrefix:directoryPath:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSString *arg_pathPrefix = GetNullableObjectAtIndex(args, 1);
+        NSString *arg_directoryPath = GetNullableObjectAtIndex(args, 2);
+        FlutterError *error;
+        [api addFileRouteForHandlerWithIdentifier:arg_identifier
+                                       pathPrefix:arg_pathPrefix
+                                    directoryPath:arg_directoryPath
+                                            error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKURLSchemeHandlerHostApi.addFlutterAssetRoute"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKURLSchemeHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (addFlutterAssetRouteForHandlerWithIdentifier:
+                                                        pathPrefix:assetDirectory:error:)],
+                @"FWFWKURLSchemeHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(addFlutterAssetRouteForHandlerWithIdentifier:pathPrefix:"
+                @"assetDirectory:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSString *arg_pathPrefix = GetNullableObjectAtIndex(args, 1);
+        NSString *arg_assetDirectory = GetNullableObjectAtIndex(args, 2);
+        FlutterError *error;
+        [api addFlutterAssetRouteForHandlerWithIdentifier:arg_identifier
+                                               pathPrefix:arg_pathPrefix
+                                           assetDirectory:arg_assetDirectory
+                                                    error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKURLSchemeHandlerHostApi.didReceiveResponse"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKURLSchemeHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (didReceiveResponseForHandlerWithIdentifier:
+                                                  taskIdentifier:statusCode:headers:error:)],
+                @"FWFWKURLSchemeHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(didReceiveResponseForHandlerWithIdentifier:taskIdentifier:statusCode:"
+                @"headers:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_taskIdentifier = [GetNullableObjectAtIndex(args, 1) integerValue];
+        NSInteger arg_statusCode = [GetNullableObjectAtIndex(args, 2) integerValue];
+        NSDictionary<NSString *, NSString *> *arg_headers = GetNullableObjectAtIndex(args, 3);
+        FlutterError *error;
+        [api didReceiveResponseForHandlerWithIdentifier:arg_identifier
+                                         taskIdentifier:arg_taskIdentifier
+                                             statusCode:arg_statusCode
+                                                headers:arg_headers
+                                                  error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKURLSchemeHandlerHostApi.didReceiveData"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKURLSchemeHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (didReceiveDataForHandlerWithIdentifier:taskIdentifier:data:error:)],
+                @"FWFWKURLSchemeHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(didReceiveDataForHandlerWithIdentifier:taskIdentifier:data:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_taskIdentifier = [GetNullableObjectAtIndex(args, 1) integerValue];
+        FlutterStandardTypedData *arg_data = GetNullableObjectAtIndex(args, 2);
+        FlutterError *error;
+        [api didReceiveDataForHandlerWithIdentifier:arg_identifier
+                                     taskIdentifier:arg_taskIdentifier
+                                               data:arg_data
+                                              error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKURLSchemeHandlerHostApi.didFinish"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKURLSchemeHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (didFinishForHandlerWithIdentifier:taskIdentifier:error:)],
+                @"FWFWKURLSchemeHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(didFinishForHandlerWithIdentifier:taskIdentifier:error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_taskIdentifier = [GetNullableObjectAtIndex(args, 1) integerValue];
+        FlutterError *error;
+        [api didFinishForHandlerWithIdentifier:arg_identifier
+                                taskIdentifier:arg_taskIdentifier
+                                         error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+  {
+    FlutterBasicMessageChannel *channel = [[FlutterBasicMessageChannel alloc]
+           initWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                        @"WKURLSchemeHandlerHostApi.didFail"
+        binaryMessenger:binaryMessenger
+                  codec:FWFWKURLSchemeHandlerHostApiGetCodec()];
+    if (api) {
+      NSCAssert([api respondsToSelector:@selector
+                     (didFailForHandlerWithIdentifier:taskIdentifier:errorDescription:error:)],
+                @"FWFWKURLSchemeHandlerHostApi api (%@) doesn't respond to "
+                @"@selector(didFailForHandlerWithIdentifier:taskIdentifier:errorDescription:"
+                @"error:)",
+                api);
+      [channel setMessageHandler:^(id _Nullable message, FlutterReply callback) {
+        NSArray *args = message;
+        NSInteger arg_identifier = [GetNullableObjectAtIndex(args, 0) integerValue];
+        NSInteger arg_taskIdentifier = [GetNullableObjectAtIndex(args, 1) integerValue];
+        NSString *arg_errorDescription = GetNullableObjectAtIndex(args, 2);
+        FlutterError *error;
+        [api didFailForHandlerWithIdentifier:arg_identifier
+                              taskIdentifier:arg_taskIdentifier
+                            errorDescription:arg_errorDescription
+                                       error:&error];
+        callback(wrapResult(nil, error));
+      }];
+    } else {
+      [channel setMessageHandler:nil];
+    }
+  }
+}
+@interface FWFWKURLSchemeHandlerFlutterApiCodecReader : FlutterStandardReader
+@end
+@implementation FWFWKURLSchemeHandlerFlutterApiCodecReader
+- (nullable id)readValueOfType:(UInt8)type {
+  switch (type) {
+    case 128:
+      return [FWFNSUrlRequestData fromList:[self readValue]];
+    default:
+      return [super readValueOfType:type];
+  }
+}
+@end
+
+@interface FWFWKURLSchemeHandlerFlutterApiCodecWriter : FlutterStandardWriter
+@end
+@implementation FWFWKURLSchemeHandlerFlutterApiCodecWriter
+- (void)writeValue:(id)value {
+  if ([value isKindOfClass:[FWFNSUrlRequestData class]]) {
+    [self writeByte:128];
+    [self writeValue:[value toList]];
+  } else {
+    [super writeValue:value];
+  }
+}
+@end
+
+@interface FWFWKURLSchemeHandlerFlutterApiCodecReaderWriter : FlutterStandardReaderWriter
+@end
+@implementation FWFWKURLSchemeHandlerFlutterApiCodecReaderWriter
+- (FlutterStandardWriter *)writerWithData:(NSMutableData *)data {
+  return [[FWFWKURLSchemeHandlerFlutterApiCodecWriter alloc] initWithData:data];
+}
+- (FlutterStandardReader *)readerWithData:(NSData *)data {
+  return [[FWFWKURLSchemeHandlerFlutterApiCodecReader alloc] initWithData:data];
+}
+@end
+
+NSObject<FlutterMessageCodec> *FWFWKURLSchemeHandlerFlutterApiGetCodec(void) {
+  static FlutterStandardMessageCodec *sSharedObject = nil;
+  static dispatch_once_t sPred = 0;
+  dispatch_once(&sPred, ^{
+    FWFWKURLSchemeHandlerFlutterApiCodecReaderWriter *readerWriter =
+        [[FWFWKURLSchemeHandlerFlutterApiCodecReaderWriter alloc] init];
+    sSharedObject = [FlutterStandardMessageCodec codecWithReaderWriter:readerWriter];
+  });
+  return sSharedObject;
+}
+
+@interface FWFWKURLSchemeHandlerFlutterApi ()
+@property(nonatomic, strong) NSObject<FlutterBinaryMessenger> *binaryMessenger;
+@end
+
+@implementation FWFWKURLSchemeHandlerFlutterApi
+
+- (instancetype)initWithBinaryMessenger:(NSObject<FlutterBinaryMessenger> *)binaryMessenger {
+  self = [super init];
+  if (self) {
+    _binaryMessenger = binaryMessenger;
+  }
+  return self;
+}
+- (void)startURLSchemeTaskForHandlerWithIdentifier:(NSInteger)arg_identifier
+                                 webViewIdentifier:(NSInteger)arg_webViewIdentifier
+                                    taskIdentifier:(NSInteger)arg_taskIdentifier
+                                           request:(FWFNSUrlRequestData *)arg_request
+                                        completion:(void (^)(FlutterError *_Nullable))completion {
+  FlutterBasicMessageChannel *channel = [FlutterBasicMessageChannel
+      messageChannelWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                             @"WKURLSchemeHandlerFlutterApi.startURLSchemeTask"
+             binaryMessenger:self.binaryMessenger
+                       codec:FWFWKURLSchemeHandlerFlutterApiGetCodec()];
+  [channel
+      sendMessage:@[
+        @(arg_identifier), @(arg_webViewIdentifier), @(arg_taskIdentifier),
+        arg_request ?: [NSNull null]
+      ]
+            reply:^(NSArray<id> *reply) {
+              if (reply != nil) {
+                if (reply.count > 1) {
+                  completion([FlutterError errorWithCode:reply[0]
+                                                 message:reply[1]
+                                                 details:reply[2]]);
+                } else {
+                  completion(nil);
+                }
+              } else {
+                completion([FlutterError errorWithCode:@"channel-error"
+                                               message:@"Unable to establish connection on channel."
+                                               details:@""]);
+              }
+            }];
+}
+- (void)stopURLSchemeTaskForHandlerWithIdentifier:(NSInteger)arg_identifier
+                                webViewIdentifier:(NSInteger)arg_webViewIdentifier
+                                   taskIdentifier:(NSInteger)arg_taskIdentifier
+                                       completion:(void (^)(FlutterError *_Nullable))completion {
+  FlutterBasicMessageChannel *channel = [FlutterBasicMessageChannel
+      messageChannelWithName:@"dev.flutter.pigeon.webview_flutter_wkwebview."
+                             @"WKURLSchemeHandlerFlutterApi.stopURLSchemeTask"
+             binaryMessenger:self.binaryMessenger
+                       codec:FWFWKURLSchemeHandlerFlutterApiGetCodec()];
+  [channel
+      sendMessage:@[ @(arg_identifier), @(arg_webViewIdentifier), @(arg_taskIdentifier) ]
+            reply:^(NSArray<id> *reply) {
+              if (reply != nil) {
+                if (reply.count > 1) {
+                  completion([FlutterError errorWithCode:reply[0]
+                                                 message:reply[1]
+                                                 details:reply[2]]);
+                } else {
+                  completion(nil);
+                }
+              } else {
+                completion([FlutterError errorWithCode:@"channel-error"
+                                               message:@"Unable to establish connection on channel."
+                                               details:@""]);
+              }
+            }];
+}
+@end
@@ -43,4 +43,43 @@
                                             completion(nil);
                                           }];
 }
+
+- (void)setCookiesForStoreWithIdentifier:(NSInteger)identifier
+                                 cookies:(nonnull NSArray<FWFNSHttpCookieData *> *)cookies
+                              completion:(nonnull void (^)(FlutterError *_Nullable))completion {
+  WKHTTPCookieStore *cookieStore = [self HTTPCookieStoreForIdentifier:identifier];
+
+  // All cookies are set concurrently and the reply is sent once the last one has been stored.
+  dispatch_group_t group = dispatch_group_create();
+  for (FWFNSHttpCookieData *cookie in cookies) {
+    NSHTTPCookie *nsCookie = FWFNativeNSHTTPCookieFromCookieData(cookie);
+    if (!nsCookie) {
+      continue;
+    }
+
+    dispatch_group_enter(group);
+    [cookieStore setCookie:nsCookie
+         completionHandler:^{
+           dispatch_group_leave(group);
+         }];
+  }
+  dispatch_group_notify(group, dispatch_get_main_queue(), ^{
+    completion(nil);
+  });
+}
+
+- (void)allCookiesForStoreWithIdentifier:(NSInteger)identifier
+                              completion:
+                                  (nonnull void (^)(NSArray<FWFNSHttpCookieData *> *_Nullable,
+                                                    FlutterError *_Nullable))completion {
+  WKHTTPCookieStore *cookieStore = [self HTTPCookieStoreForIdentifier:identifier];
+  [cookieStore getAllCookies:^(NSArray<NSHTTPCookie *> *cookies) {
+    NSMutableArray<FWFNSHttpCookieData *> *cookieData =
+        [NSMutableArray arrayWithCapacity:cookies.count];
+    for (NSHTTPCookie *cookie in cookies) {
+      [cookieData addObject:FWFNSHttpCookieDataFromNativeNSHTTPCookie(cookie)];
+    }
+    completion(cookieData, nil);
+  }];
+}
 @end
@@ -6,6 +6,7 @@
 #import "FWFInstanceManager_Test.h"
 
 #import <objc/runtime.h>
+#import <os/lock.h>
 
 // Attaches to an object to receive a callback when the object is deallocated.
 @interface FWFFinalizer : NSObject
@@ -46,8 +47,11 @@
 }
 @end
 
-@interface FWFInstanceManager ()
-@property dispatch_queue_t lockQueue;
+@interface FWFInstanceManager () {
+  // Guards the map tables. Lookups are far more frequent than writes and hold the lock only for a
+  // map table access, so an uncontended lock is taken without leaving the calling thread.
+  os_unfair_lock _lock;
+}
 @property NSMapTable<NSObject *, NSNumber *> *identifiers;
 @property NSMapTable<NSNumber *, NSObject *> *weakInstances;
 @property NSMapTable<NSNumber *, NSObject *> *strongInstances;
@@ -65,7 +69,7 @@ static long const FWFMinHostCreatedIdentifier = 65536;
   if (self) {
     _deallocCallback = _deallocCallback ? _deallocCallback : ^(long identifier) {
     };
-    _lockQueue = dispatch_queue_create("FWFInstanceManager", DISPATCH_QUEUE_SERIAL);
+    _lock = OS_UNFAIR_LOCK_INIT;
     // Pointer equality is used to prevent collisions of objects that override the `isEqualTo:`
     // method.
     _identifiers =
@@ -93,40 +97,38 @@ static long const FWFMinHostCreatedIdentifier = 65536;
 - (void)addDartCreatedInstance:(NSObject *)instance withIdentifier:(long)instanceIdentifier {
   NSParameterAssert(instance);
   NSParameterAssert(instanceIdentifier >= 0);
-  dispatch_async(_lockQueue, ^{
-    [self addInstance:instance withIdentifier:instanceIdentifier];
-  });
+  os_unfair_lock_lock(&_lock);
+  [self addInstance:instance withIdentifier:instanceIdentifier];
+  os_unfair_lock_unlock(&_lock);
 }
 
 - (long)addHostCreatedInstance:(nonnull NSObject *)instance {
   NSParameterAssert(instance);
-  long __block identifier = -1;
-  dispatch_sync(_lockQueue, ^{
-    identifier = self.nextIdentifier++;
-    [self addInstance:instance withIdentifier:identifier];
-  });
+  os_unfair_lock_lock(&_lock);
+  long identifier = self.nextIdentifier++;
+  [self addInstance:instance withIdentifier:identifier];
+  os_unfair_lock_unlock(&_lock);
   return identifier;
 }
 
 - (nullable NSObject *)removeInstanceWithIdentifier:(long)instanceIdentifier {
-  NSObject *__block instance = nil;
-  dispatch_sync(_lockQueue, ^{
-    instance = [self.strongInstances objectForKey:@(instanceIdentifier)];
-    if (instance) {
-      [self.strongInstances removeObjectForKey:@(instanceIdentifier)];
-    }
-  });
+  os_unfair_lock_lock(&_lock);
+  NSObject *instance = [self.strongInstances objectForKey:@(instanceIdentifier)];
+  if (instance) {
+    [self.strongInstances removeObjectForKey:@(instanceIdentifier)];
+  }
+  os_unfair_lock_unlock(&_lock);
   return instance;
 }
 
 - (nullable NSObject *)instanceForIdentifier:(long)instanceIdentifier {
-  NSObject *__block instance = nil;
-  dispatch_sync(_lockQueue, ^{
-    instance = [self.weakInstances objectForKey:@(instanceIdentifier)];
-  });
+  os_unfair_lock_lock(&_lock);
+  NSObject *instance = [self.weakInstances objectForKey:@(instanceIdentifier)];
+  os_unfair_lock_unlock(&_lock);
   return instance;
 }
 
+// Must be called while holding the lock.
 - (void)addInstance:(nonnull NSObject *)instance withIdentifier:(long)instanceIdentifier {
   [self.identifiers setObject:@(instanceIdentifier) forKey:instance];
   [self.weakInstances setObject:instance forKey:@(instanceIdentifier)];
@@ -137,37 +139,33 @@ static long const FWFMinHostCreatedIdentifier = 65536;
 }
 
 - (long)identifierWithStrongReferenceForInstance:(nonnull NSObject *)instance {
-  NSNumber *__block identifierNumber = nil;
-  dispatch_sync(_lockQueue, ^{
-    identifierNumber = [self.identifiers objectForKey:instance];
-    if (identifierNumber) {
-      [self.strongInstances setObject:instance forKey:identifierNumber];
-    }
-  });
+  os_unfair_lock_lock(&_lock);
+  NSNumber *identifierNumber = [self.identifiers objectForKey:instance];
+  if (identifierNumber) {
+    [self.strongInstances setObject:instance forKey:identifierNumber];
+  }
+  os_unfair_lock_unlock(&_lock);
   return identifierNumber ? identifierNumber.longValue : NSNotFound;
 }
 
 - (BOOL)containsInstance:(nonnull NSObject *)instance {
-  BOOL __block containsInstance;
-  dispatch_sync(_lockQueue, ^{
-    containsInstance = [self.identifiers objectForKey:instance];
-  });
+  os_unfair_lock_lock(&_lock);
+  BOOL containsInstance = [self.identifiers objectForKey:instance] != nil;
+  os_unfair_lock_unlock(&_lock);
   return containsInstance;
 }
 
 - (NSUInteger)strongInstanceCount {
-  NSUInteger __block count = -1;
-  dispatch_sync(_lockQueue, ^{
-    count = self.strongInstances.count;
-  });
+  os_unfair_lock_lock(&_lock);
+  NSUInteger count = self.strongInstances.count;
+  os_unfair_lock_unlock(&_lock);
   return count;
 }
 
 - (NSUInteger)weakInstanceCount {
-  NSUInteger __block count = -1;
-  dispatch_sync(_lockQueue, ^{
-    count = self.weakInstances.count;
-  });
+  os_unfair_lock_lock(&_lock);
+  NSUInteger count = self.weakInstances.count;
+  os_unfair_lock_unlock(&_lock);
   return count;
 }
 @end
@@ -22,12 +22,55 @@ NS_ASSUME_NONNULL_BEGIN
                         instanceManager:(FWFInstanceManager *)instanceManager;
 @end
 
+/**
+ * A rule that decides the policy of navigation actions to matching URLs without calling Dart.
+ */
+@interface FWFNavigationPolicyRule : NSObject
+@property(nonatomic, readonly) WKNavigationActionPolicy policy;
+
+/**
+ * Initializes a rule that matches a URL when each of the non-nil conditions match.
+ *
+ * @param host The host the URL must have, or one of its subdomains.
+ * @param scheme The scheme the URL must have.
+ * @param URLPattern A regular expression that must match a part of the URL.
+ * @param policy The policy of the navigation actions to matching URLs.
+ */
+- (instancetype)initWithHost:(nullable NSString *)host
+                      scheme:(nullable NSString *)scheme
+                  URLPattern:(nullable NSRegularExpression *)URLPattern
+                      policy:(WKNavigationActionPolicy)policy;
+
+- (BOOL)matchesURL:(NSURL *)URL;
+@end
+
 /**
  * Implementation of WKNavigationDelegate for FWFNavigationDelegateHostApiImpl.
  */
 @interface FWFNavigationDelegate : FWFObject <WKNavigationDelegate>
 @property(readonly, nonnull, nonatomic) FWFNavigationDelegateFlutterApiImpl *navigationDelegateAPI;
 
+/**
+ * Rules that decide the policy of navigation actions without calling Dart.
+ *
+ * The first rule that matches the URL of a navigation action decides its policy. Navigation actions
+ * that match no rule are sent to Dart.
+ */
+@property(nonatomic, copy) NSArray<FWFNavigationPolicyRule *> *navigationPolicyRules;
+
+/**
+ * Whether navigation actions in subframes that match no rule are allowed without calling Dart.
+ */
+@property(nonatomic) BOOL forwardsOnlyMainFrameNavigations;
+
+/**
+ * Whether the HTTP method, body and header fields of requests are sent to Dart with navigation
+ * actions.
+ *
+ * When NO, only the URL of a request is sent. Defaults to NO.
+ */
+@property(nonatomic) BOOL includesRequestDetails;
+
 - (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
                         instanceManager:(FWFInstanceManager *)instanceManager;
 @end
@@ -59,7 +59,9 @@
   NSInteger webViewIdentifier =
       [self.instanceManager identifierWithStrongReferenceForInstance:webView];
   FWFWKNavigationActionData *navigationActionData =
-      FWFWKNavigationActionDataFromNativeWKNavigationAction(navigationAction);
+      instance.includesRequestDetails
+          ? FWFWKNavigationActionDataFromNativeWKNavigationAction(navigationAction)
+          : FWFWKNavigationActionDataWithRequestURLFromNativeWKNavigationAction(navigationAction);
   [self
       decidePolicyForNavigationActionForDelegateWithIdentifier:[self identifierForDelegate:instance]
                                              webViewIdentifier:webViewIdentifier
@@ -104,6 +106,54 @@
 }
 @end
 
+@interface FWFNavigationPolicyRule ()
+@property(nonatomic, copy, nullable) NSString *host;
+@property(nonatomic, copy, nullable) NSString *scheme;
+@property(nonatomic, nullable) NSRegularExpression *URLPattern;
+@end
+
+@implementation FWFNavigationPolicyRule
+- (instancetype)initWithHost:(nullable NSString *)host
+                      scheme:(nullable NSString *)scheme
+                  URLPattern:(nullable NSRegularExpression *)URLPattern
+                      policy:(WKNavigationActionPolicy)policy {
+  self = [self init];
+  if (self) {
+    _host = [host lowercaseString];
+    _scheme = [scheme lowercaseString];
+    _URLPattern = URLPattern;
+    _policy = policy;
+  }
+  return self;
+}
+
+- (BOOL)matchesURL:(NSURL *)URL {
+  if (self.scheme && ![self.scheme isEqualToString:[URL.scheme lowercaseString]]) {
+    return NO;
+  }
+  if (self.host) {
+    NSString *host = [URL.host lowercaseString];
+    if (!host) {
+      return NO;
+    }
+    if (![host isEqualToString:self.host] &&
+        ![host hasSuffix:[@"." stringByAppendingString:self.host]]) {
+      return NO;
+    }
+  }
+  if (self.URLPattern) {
+    NSString *string = URL.absoluteString;
+    NSRange match = [self.URLPattern rangeOfFirstMatchInString:string
+                                                       options:0
+                                                         range:NSMakeRange(0, string.length)];
+    if (match.location == NSNotFound) {
+      return NO;
+    }
+  }
+  return YES;
+}
+@end
+
 @implementation FWFNavigationDelegate
 - (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
                         instanceManager:(FWFInstanceManager *)instanceManager {
@@ -112,6 +162,7 @@
     _navigationDelegateAPI =
         [[FWFNavigationDelegateFlutterApiImpl alloc] initWithBinaryMessenger:binaryMessenger
                                                              instanceManager:instanceManager];
+    _navigationPolicyRules = @[];
   }
   return self;
 }
@@ -137,6 +188,20 @@
 - (void)webView:(WKWebView *)webView
     decidePolicyForNavigationAction:(WKNavigationAction *)navigationAction
                     decisionHandler:(void (^)(WKNavigationActionPolicy))decisionHandler {
+  NSURL *URL = navigationAction.request.URL;
+  for (FWFNavigationPolicyRule *rule in self.navigationPolicyRules) {
+    if ([rule matchesURL:URL]) {
+      decisionHandler(rule.policy);
+      return;
+    }
+  }
+  // A nil target frame is a request for a new window, which is handled like a main frame.
+  WKFrameInfo *targetFrame = navigationAction.targetFrame;
+  if (self.forwardsOnlyMainFrameNavigations && targetFrame && !targetFrame.isMainFrame) {
+    decisionHandler(WKNavigationActionPolicyAllow);
+    return;
+  }
+
   [self.navigationDelegateAPI
       decidePolicyForNavigationActionForDelegate:self
                                          webView:webView
@@ -211,4 +276,48 @@
                                              instanceManager:self.instanceManager];
   [self.instanceManager addDartCreatedInstance:navigationDelegate withIdentifier:identifier];
 }
+
+- (void)setNavigationPolicyRulesForDelegateWithIdentifier:(NSInteger)identifier
+                                                    rules:
+                                                        (NSArray<FWFWKNavigationPolicyRuleData *> *)
+                                                            rules
+                         forwardsOnlyMainFrameNavigations:(BOOL)forwardsOnlyMainFrameNavigations
+                                                    error:(FlutterError *_Nullable __autoreleasing
+                                                               *_Nonnull)error {
+  NSMutableArray<FWFNavigationPolicyRule *> *policyRules =
+      [NSMutableArray arrayWithCapacity:rules.count];
+  for (FWFWKNavigationPolicyRuleData *rule in rules) {
+    NSRegularExpression *URLPattern;
+    if (rule.urlPattern) {
+      NSError *regexError;
+      URLPattern = [NSRegularExpression regularExpressionWithPattern:rule.urlPattern
+                                                             options:0
+                                                               error:&regexError];
+      if (!URLPattern) {
+        *error = [FlutterError
+            errorWithCode:@"FWFNavigationPolicyRuleParsingError"
+                  message:@"Failed parsing the URL pattern of a navigation policy rule."
+                  details:[NSString stringWithFormat:@"Pattern was: '%@'", rule.urlPattern]];
+        return;
+      }
+    }
+    WKNavigationActionPolicy policy = FWFNativeWKNavigationActionPolicyFromEnumData(
+        [FWFWKNavigationActionPolicyEnumData makeWithValue:rule.policy]);
+    [policyRules addObject:[[FWFNavigationPolicyRule alloc] initWithHost:rule.host
+                                                                  scheme:rule.scheme
+                                                              URLPattern:URLPattern
+                                                                  policy:policy]];
+  }
+
+  FWFNavigationDelegate *navigationDelegate = [self navigationDelegateForIdentifier:identifier];
+  navigationDelegate.navigationPolicyRules = policyRules;
+  navigationDelegate.forwardsOnlyMainFrameNavigations = forwardsOnlyMainFrameNavigations;
+}
+
+- (void)setIncludesRequestDetailsForDelegateWithIdentifier:(NSInteger)identifier
+                                    includesRequestDetails:(BOOL)includesRequestDetails
+                                                     error:(FlutterError *_Nullable __autoreleasing
+                                                                *_Nonnull)error {
+  [self navigationDelegateForIdentifier:identifier].includesRequestDetails = includesRequestDetails;
+}
 @end
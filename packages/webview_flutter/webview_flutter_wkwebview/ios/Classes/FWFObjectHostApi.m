@@ -6,6 +6,7 @@
 #import <objc/runtime.h>
 #import "FWFDataConverters.h"
 #import "FWFURLHostApi.h"
+#import "FWFWebViewPool.h"
 
 @interface FWFObjectFlutterApiImpl ()
 // BinaryMessenger must be weak to prevent a circular reference with the host API it
@@ -142,6 +143,10 @@
 
 - (void)disposeObjectWithIdentifier:(NSInteger)identifier
                               error:(FlutterError *_Nullable *_Nonnull)error {
-  [self.instanceManager removeInstanceWithIdentifier:identifier];
+  NSObject *object = [self.instanceManager removeInstanceWithIdentifier:identifier];
+  if ([object isKindOfClass:[FWFWebView class]]) {
+    FWFWebView *webView = (FWFWebView *)object;
+    [webView.webViewPool recycleWebView:webView];
+  }
 }
 @end
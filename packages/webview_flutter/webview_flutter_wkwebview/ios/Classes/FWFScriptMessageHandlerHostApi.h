@@ -11,6 +11,8 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class FWFScriptMessageHandler;
+
 /**
  * Flutter api implementation for WKScriptMessageHandler.
  *
@@ -19,6 +21,15 @@ NS_ASSUME_NONNULL_BEGIN
 @interface FWFScriptMessageHandlerFlutterApiImpl : FWFWKScriptMessageHandlerFlutterApi
 - (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
                         instanceManager:(FWFInstanceManager *)instanceManager;
+
+/**
+ * Sends script messages that were received by the same handler and user content controller to
+ * Dart in a single message.
+ */
+- (void)didReceiveScriptMessagesForHandler:(FWFScriptMessageHandler *)instance
+                     userContentController:(WKUserContentController *)userContentController
+                                  messages:(NSArray<FWFWKScriptMessageData *> *)messages
+                                completion:(void (^)(FlutterError *_Nullable))completion;
 @end
 
 /**
@@ -28,6 +39,19 @@ NS_ASSUME_NONNULL_BEGIN
 @property(readonly, nonnull, nonatomic)
     FWFScriptMessageHandlerFlutterApiImpl *scriptMessageHandlerAPI;
 
+/**
+ * The number of script messages that are queued before they are sent to Dart, or 0 to send each
+ * message as it is received.
+ *
+ * Queued messages are also sent once a frame has passed since the first of them was received.
+ */
+@property(nonatomic) NSUInteger maxMessageBatchSize;
+
+/**
+ * Sends the queued script messages to Dart.
+ */
+- (void)flushScriptMessages;
+
 - (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
                         instanceManager:(FWFInstanceManager *)instanceManager;
 @end
@@ -36,6 +36,27 @@
                                                 message:messageData
                                              completion:completion];
 }
+
+- (void)didReceiveScriptMessagesForHandler:(FWFScriptMessageHandler *)instance
+                     userContentController:(WKUserContentController *)userContentController
+                                  messages:(NSArray<FWFWKScriptMessageData *> *)messages
+                                completion:(void (^)(FlutterError *_Nullable))completion {
+  NSInteger userContentControllerIdentifier =
+      [self.instanceManager identifierWithStrongReferenceForInstance:userContentController];
+  [self didReceiveScriptMessagesForHandlerWithIdentifier:[self identifierForHandler:instance]
+                         userContentControllerIdentifier:userContentControllerIdentifier
+                                                messages:messages
+                                              completion:completion];
+}
+@end
+
+// The delay after the first queued script message at which the queue is sent, about one frame.
+static const int64_t FWFScriptMessageBatchDelay = NSEC_PER_SEC / 60;
+
+@interface FWFScriptMessageHandler ()
+@property(nonatomic) NSMutableArray<FWFWKScriptMessageData *> *pendingMessages;
+@property(nonatomic, nullable) WKUserContentController *pendingUserContentController;
+@property(nonatomic) BOOL flushScheduled;
 @end
 
 @implementation FWFScriptMessageHandler
@@ -46,12 +67,40 @@
     _scriptMessageHandlerAPI =
         [[FWFScriptMessageHandlerFlutterApiImpl alloc] initWithBinaryMessenger:binaryMessenger
                                                                instanceManager:instanceManager];
+    _pendingMessages = [NSMutableArray array];
   }
   return self;
 }
 
+- (void)setMaxMessageBatchSize:(NSUInteger)maxMessageBatchSize {
+  _maxMessageBatchSize = maxMessageBatchSize;
+  if (self.pendingMessages.count >= maxMessageBatchSize) {
+    [self flushScriptMessages];
+  }
+}
+
+- (void)flushScriptMessages {
+  if (self.pendingMessages.count == 0) {
+    return;
+  }
+  NSArray<FWFWKScriptMessageData *> *messages = [self.pendingMessages copy];
+  [self.pendingMessages removeAllObjects];
+  [self.scriptMessageHandlerAPI didReceiveScriptMessagesForHandler:self
+                                             userContentController:self.pendingUserContentController
+                                                          messages:messages
+                                                        completion:^(FlutterError *error) {
+                                                          NSAssert(!error, @"%@", error);
+                                                        }];
+  self.pendingUserContentController = nil;
+}
+
 - (void)userContentController:(nonnull WKUserContentController *)userContentController
       didReceiveScriptMessage:(nonnull WKScriptMessage *)message {
+  if (self.maxMessageBatchSize > 0) {
+    [self queueScriptMessage:message userContentController:userContentController];
+    return;
+  }
+
   [self.scriptMessageHandlerAPI didReceiveScriptMessageForHandler:self
                                             userContentController:userContentController
                                                           message:message
@@ -59,6 +108,30 @@
                                                          NSAssert(!error, @"%@", error);
                                                        }];
 }
+
+- (void)queueScriptMessage:(WKScriptMessage *)message
+     userContentController:(WKUserContentController *)userContentController {
+  // A batch is sent for a single user content controller, so messages stay in order when one
+  // handler is added to several controllers.
+  if (self.pendingUserContentController != userContentController) {
+    [self flushScriptMessages];
+  }
+  // The body of a message is read while it is received, because WebKit owns the message.
+  [self.pendingMessages addObject:FWFWKScriptMessageDataFromNativeWKScriptMessage(message)];
+  self.pendingUserContentController = userContentController;
+
+  if (self.pendingMessages.count >= self.maxMessageBatchSize) {
+    [self flushScriptMessages];
+  } else if (!self.flushScheduled) {
+    self.flushScheduled = YES;
+    __weak FWFScriptMessageHandler *weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, FWFScriptMessageBatchDelay),
+                   dispatch_get_main_queue(), ^{
+                     weakSelf.flushScheduled = NO;
+                     [weakSelf flushScriptMessages];
+                   });
+  }
+}
 @end
 
 @interface FWFScriptMessageHandlerHostApiImpl ()
@@ -91,4 +164,12 @@
                                                instanceManager:self.instanceManager];
   [self.instanceManager addDartCreatedInstance:scriptMessageHandler withIdentifier:identifier];
 }
+
+- (void)setMessageBatchingForHandlerWithIdentifier:(NSInteger)identifier
+                                      maxBatchSize:(nullable NSNumber *)maxBatchSize
+                                             error:(FlutterError *_Nullable *_Nonnull)error {
+  FWFScriptMessageHandler *scriptMessageHandler =
+      [self scriptMessageHandlerForIdentifier:@(identifier)];
+  scriptMessageHandler.maxMessageBatchSize = maxBatchSize ? maxBatchSize.unsignedIntegerValue : 0;
+}
 @end
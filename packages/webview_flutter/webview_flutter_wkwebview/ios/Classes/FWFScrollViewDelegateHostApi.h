@@ -0,0 +1,57 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Flutter/Flutter.h>
+#import <UIKit/UIKit.h>
+
+#import "FWFGeneratedWebKitApis.h"
+#import "FWFInstanceManager.h"
+#import "FWFObjectHostApi.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Flutter api implementation for UIScrollViewDelegate.
+ *
+ * Handles making callbacks to Dart for a UIScrollViewDelegate.
+ */
+@interface FWFScrollViewDelegateFlutterApiImpl : FWFUIScrollViewDelegateFlutterApi
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager;
+@end
+
+/**
+ * Implementation of UIScrollViewDelegate for FWFScrollViewDelegateHostApiImpl.
+ *
+ * Scroll events are throttled before they are sent to Dart. An event is only sent when the
+ * content offset has moved by at least `minimumDelta` points on either axis and at most
+ * `maximumFrequency` times per second. The last offset of a throttled burst is always sent, so
+ * Dart ends up with the offset the scroll view settled on.
+ */
+@interface FWFScrollViewDelegate : FWFObject <UIScrollViewDelegate>
+@property(readonly, nonnull, nonatomic) FWFScrollViewDelegateFlutterApiImpl *scrollViewDelegateAPI;
+
+/// The minimum time between two events sent to Dart. Zero when events are not throttled.
+@property(readonly, nonatomic) NSTimeInterval minimumInterval;
+
+/// The minimum distance the content offset must move before an event is sent to Dart.
+@property(readonly, nonatomic) double minimumDelta;
+
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager
+                       maximumFrequency:(double)maximumFrequency
+                           minimumDelta:(double)minimumDelta;
+@end
+
+/**
+ * Host api implementation for UIScrollViewDelegate.
+ *
+ * Handles creating UIScrollViewDelegate that intercommunicate with a paired Dart object.
+ */
+@interface FWFScrollViewDelegateHostApiImpl : NSObject <FWFUIScrollViewDelegateHostApi>
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager;
+@end
+
+NS_ASSUME_NONNULL_END
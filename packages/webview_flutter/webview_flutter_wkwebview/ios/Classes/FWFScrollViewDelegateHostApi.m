@@ -0,0 +1,166 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FWFScrollViewDelegateHostApi.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+@interface FWFScrollViewDelegateFlutterApiImpl ()
+// InstanceManager must be weak to prevent a circular reference with the object it stores.
+@property(nonatomic, weak) FWFInstanceManager *instanceManager;
+@end
+
+@implementation FWFScrollViewDelegateFlutterApiImpl
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager {
+  self = [self initWithBinaryMessenger:binaryMessenger];
+  if (self) {
+    _instanceManager = instanceManager;
+  }
+  return self;
+}
+
+- (long)identifierForDelegate:(FWFScrollViewDelegate *)instance {
+  return [self.instanceManager identifierWithStrongReferenceForInstance:instance];
+}
+
+- (void)scrollViewDidScrollForDelegate:(FWFScrollViewDelegate *)instance
+                          uiScrollView:(UIScrollView *)scrollView
+                         contentOffset:(CGPoint)contentOffset
+                            completion:(void (^)(FlutterError *_Nullable))completion {
+  [self scrollViewDidScrollWithIdentifier:[self identifierForDelegate:instance]
+                   uiScrollViewIdentifier:[self.instanceManager
+                                              identifierWithStrongReferenceForInstance:scrollView]
+                                        x:contentOffset.x
+                                        y:contentOffset.y
+                               completion:completion];
+}
+@end
+
+@interface FWFScrollViewDelegate ()
+@property(nonatomic) CFTimeInterval lastReportTime;
+@property(nonatomic) CGPoint lastReportedContentOffset;
+@property(nonatomic) BOOL hasReportedContentOffset;
+@property(nonatomic) BOOL hasPendingReport;
+@end
+
+@implementation FWFScrollViewDelegate
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager
+                       maximumFrequency:(double)maximumFrequency
+                           minimumDelta:(double)minimumDelta {
+  self = [super initWithBinaryMessenger:binaryMessenger instanceManager:instanceManager];
+  if (self) {
+    _scrollViewDelegateAPI =
+        [[FWFScrollViewDelegateFlutterApiImpl alloc] initWithBinaryMessenger:binaryMessenger
+                                                             instanceManager:instanceManager];
+    _minimumInterval = maximumFrequency > 0 ? 1.0 / maximumFrequency : 0;
+    _minimumDelta = MAX(minimumDelta, 0);
+    _lastReportTime = -DBL_MAX;
+  }
+  return self;
+}
+
+- (void)reportContentOffsetOfScrollView:(UIScrollView *)scrollView {
+  CGPoint contentOffset = scrollView.contentOffset;
+  if (self.hasReportedContentOffset &&
+      CGPointEqualToPoint(contentOffset, self.lastReportedContentOffset)) {
+    return;
+  }
+
+  self.hasReportedContentOffset = YES;
+  self.lastReportedContentOffset = contentOffset;
+  self.lastReportTime = CACurrentMediaTime();
+  [self.scrollViewDelegateAPI scrollViewDidScrollForDelegate:self
+                                                uiScrollView:scrollView
+                                               contentOffset:contentOffset
+                                                  completion:^(FlutterError *error) {
+                                                    NSAssert(!error, @"%@", error);
+                                                  }];
+}
+
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView {
+  CGPoint contentOffset = scrollView.contentOffset;
+  if (self.hasReportedContentOffset &&
+      fabs(contentOffset.x - self.lastReportedContentOffset.x) < self.minimumDelta &&
+      fabs(contentOffset.y - self.lastReportedContentOffset.y) < self.minimumDelta) {
+    return;
+  }
+
+  CFTimeInterval remainingInterval =
+      self.minimumInterval - (CACurrentMediaTime() - self.lastReportTime);
+  if (remainingInterval <= 0) {
+    [self reportContentOffsetOfScrollView:scrollView];
+    return;
+  }
+
+  // Events that arrive too early are coalesced into a single report at the end of the interval.
+  // The report reads the content offset when it fires, so it always carries the latest position.
+  if (!self.hasPendingReport) {
+    self.hasPendingReport = YES;
+    __weak FWFScrollViewDelegate *weakSelf = self;
+    __weak UIScrollView *weakScrollView = scrollView;
+    dispatch_after(
+        dispatch_time(DISPATCH_TIME_NOW, (int64_t)(remainingInterval * NSEC_PER_SEC)),
+        dispatch_get_main_queue(), ^{
+          FWFScrollViewDelegate *strongSelf = weakSelf;
+          UIScrollView *strongScrollView = weakScrollView;
+          strongSelf.hasPendingReport = NO;
+          if (strongScrollView) {
+            [strongSelf reportContentOffsetOfScrollView:strongScrollView];
+          }
+        });
+  }
+}
+
+- (void)scrollViewDidEndDragging:(UIScrollView *)scrollView willDecelerate:(BOOL)decelerate {
+  if (!decelerate) {
+    [self reportContentOffsetOfScrollView:scrollView];
+  }
+}
+
+- (void)scrollViewDidEndDecelerating:(UIScrollView *)scrollView {
+  [self reportContentOffsetOfScrollView:scrollView];
+}
+
+- (void)scrollViewDidEndScrollingAnimation:(UIScrollView *)scrollView {
+  [self reportContentOffsetOfScrollView:scrollView];
+}
+
+- (void)scrollViewDidScrollToTop:(UIScrollView *)scrollView {
+  [self reportContentOffsetOfScrollView:scrollView];
+}
+@end
+
+@interface FWFScrollViewDelegateHostApiImpl ()
+// BinaryMessenger must be weak to prevent a circular reference with the host API it
+// references.
+@property(nonatomic, weak) id<FlutterBinaryMessenger> binaryMessenger;
+// InstanceManager must be weak to prevent a circular reference with the object it stores.
+@property(nonatomic, weak) FWFInstanceManager *instanceManager;
+@end
+
+@implementation FWFScrollViewDelegateHostApiImpl
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager {
+  self = [self init];
+  if (self) {
+    _binaryMessenger = binaryMessenger;
+    _instanceManager = instanceManager;
+  }
+  return self;
+}
+
+- (void)createWithIdentifier:(NSInteger)identifier
+            maximumFrequency:(double)maximumFrequency
+                minimumDelta:(double)minimumDelta
+                       error:(FlutterError *_Nullable *_Nonnull)error {
+  FWFScrollViewDelegate *delegate =
+      [[FWFScrollViewDelegate alloc] initWithBinaryMessenger:self.binaryMessenger
+                                             instanceManager:self.instanceManager
+                                            maximumFrequency:maximumFrequency
+                                                minimumDelta:minimumDelta];
+  [self.instanceManager addDartCreatedInstance:delegate withIdentifier:identifier];
+}
+@end
@@ -52,4 +52,12 @@
                                               error:(FlutterError *_Nullable *_Nonnull)error {
   [[self scrollViewForIdentifier:identifier] setContentOffset:CGPointMake(x, y)];
 }
+
+- (void)setDelegateForScrollViewWithIdentifier:(NSInteger)identifier
+                uiScrollViewDelegateIdentifier:(nullable NSNumber *)uiScrollViewDelegateIdentifier
+                                         error:(FlutterError *_Nullable *_Nonnull)error {
+  id<UIScrollViewDelegate> delegate = (id<UIScrollViewDelegate>)[self.instanceManager
+      instanceForIdentifier:uiScrollViewDelegateIdentifier.longValue];
+  [[self scrollViewForIdentifier:identifier] setDelegate:delegate];
+}
 @end
@@ -0,0 +1,120 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Flutter/Flutter.h>
+#import <WebKit/WebKit.h>
+
+#import "FWFGeneratedWebKitApis.h"
+#import "FWFInstanceManager.h"
+#import "FWFObjectHostApi.h"
+#import "FWFWebViewHostApi.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class FWFURLSchemeHandler;
+
+/**
+ * Flutter api implementation for WKURLSchemeHandler.
+ *
+ * Handles making callbacks to Dart for a WKURLSchemeHandler.
+ */
+@interface FWFURLSchemeHandlerFlutterApiImpl : FWFWKURLSchemeHandlerFlutterApi
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager;
+
+- (void)startURLSchemeTaskForHandler:(FWFURLSchemeHandler *)instance
+                             webView:(WKWebView *)webView
+                      taskIdentifier:(NSInteger)taskIdentifier
+                             request:(NSURLRequest *)request
+                          completion:(void (^)(FlutterError *_Nullable))completion;
+
+- (void)stopURLSchemeTaskForHandler:(FWFURLSchemeHandler *)instance
+                            webView:(WKWebView *)webView
+                     taskIdentifier:(NSInteger)taskIdentifier
+                         completion:(void (^)(FlutterError *_Nullable))completion;
+@end
+
+/**
+ * Implementation of WKURLSchemeHandler for FWFURLSchemeHandlerHostApiImpl.
+ *
+ * Requests whose URL path starts with the path prefix of a route are answered natively with the
+ * file at the rest of the path in the route's directory, so large files are memory mapped instead
+ * of being copied through Dart. Other requests are sent to Dart, which answers them through
+ * FWFURLSchemeHandlerHostApiImpl, possibly in several chunks of data.
+ */
+@interface FWFURLSchemeHandler : FWFObject <WKURLSchemeHandler>
+@property(readonly, nonnull, nonatomic) FWFURLSchemeHandlerFlutterApiImpl *URLSchemeHandlerAPI;
+
+/**
+ * The schemes that a URL scheme handler has been set for on any configuration.
+ *
+ * WKWebViewConfiguration doesn't list its URL scheme handlers, so the handlers of two
+ * configurations are compared for these schemes.
+ */
+@property(class, nonatomic, readonly) NSSet<NSString *> *registeredURLSchemes;
+
++ (void)registerURLScheme:(NSString *)scheme;
+
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager;
+
+/**
+ * Answers requests whose URL path starts with `pathPrefix` with files in `directoryPath`.
+ *
+ * Routes are matched in the order they are added.
+ */
+- (void)addRouteWithPathPrefix:(NSString *)pathPrefix directoryPath:(NSString *)directoryPath;
+
+/**
+ * Sends a response for a task that was sent to Dart.
+ *
+ * Does nothing if the task has been stopped or finished.
+ */
+- (void)didReceiveResponse:(NSURLResponse *)response
+     forTaskWithIdentifier:(NSInteger)taskIdentifier;
+
+/**
+ * Sends data for a task that was sent to Dart.
+ *
+ * Does nothing if the task has been stopped or finished.
+ */
+- (void)didReceiveData:(NSData *)data forTaskWithIdentifier:(NSInteger)taskIdentifier;
+
+/**
+ * Finishes a task that was sent to Dart.
+ *
+ * Does nothing if the task has been stopped or finished.
+ */
+- (void)didFinishTaskWithIdentifier:(NSInteger)taskIdentifier;
+
+/**
+ * Fails a task that was sent to Dart.
+ *
+ * Does nothing if the task has been stopped or finished.
+ */
+- (void)didFailTaskWithIdentifier:(NSInteger)taskIdentifier error:(NSError *)error;
+
+/**
+ * Returns the URL of the request of a task that was sent to Dart, or nil if the task has been
+ * stopped or finished.
+ */
+- (nullable NSURL *)requestURLForTaskWithIdentifier:(NSInteger)taskIdentifier;
+@end
+
+/**
+ * Host api implementation for WKURLSchemeHandler.
+ *
+ * Handles creating WKURLSchemeHandler that intercommunicate with a paired Dart object.
+ */
+@interface FWFURLSchemeHandlerHostApiImpl : NSObject <FWFWKURLSchemeHandlerHostApi>
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager;
+
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager
+                                 bundle:(NSBundle *)bundle
+                           assetManager:(FWFAssetManager *)assetManager;
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,388 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FWFURLSchemeHandlerHostApi.h"
+#import "FWFDataConverters.h"
+
+// The MIME type of a file served by a route, by path extension. Types WebKit is strict about,
+// like `application/wasm` for streaming compilation, are not known to every version of iOS.
+static NSString *FWFMIMETypeForPathExtension(NSString *pathExtension) {
+  static NSDictionary<NSString *, NSString *> *MIMETypes;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    MIMETypes = @{
+      @"css" : @"text/css",
+      @"gif" : @"image/gif",
+      @"htm" : @"text/html",
+      @"html" : @"text/html",
+      @"ico" : @"image/x-icon",
+      @"jpeg" : @"image/jpeg",
+      @"jpg" : @"image/jpeg",
+      @"js" : @"text/javascript",
+      @"json" : @"application/json",
+      @"map" : @"application/json",
+      @"mjs" : @"text/javascript",
+      @"mp3" : @"audio/mpeg",
+      @"mp4" : @"video/mp4",
+      @"otf" : @"font/otf",
+      @"pdf" : @"application/pdf",
+      @"png" : @"image/png",
+      @"svg" : @"image/svg+xml",
+      @"ttf" : @"font/ttf",
+      @"txt" : @"text/plain",
+      @"wasm" : @"application/wasm",
+      @"webm" : @"video/webm",
+      @"webp" : @"image/webp",
+      @"woff" : @"font/woff",
+      @"woff2" : @"font/woff2",
+      @"xml" : @"application/xml",
+    };
+  });
+  return MIMETypes[pathExtension.lowercaseString] ?: @"application/octet-stream";
+}
+
+@interface FWFURLSchemeHandlerFlutterApiImpl ()
+// InstanceManager must be weak to prevent a circular reference with the object it stores.
+@property(nonatomic, weak) FWFInstanceManager *instanceManager;
+@end
+
+@implementation FWFURLSchemeHandlerFlutterApiImpl
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager {
+  self = [self initWithBinaryMessenger:binaryMessenger];
+  if (self) {
+    _instanceManager = instanceManager;
+  }
+  return self;
+}
+
+- (long)identifierForHandler:(FWFURLSchemeHandler *)instance {
+  return [self.instanceManager identifierWithStrongReferenceForInstance:instance];
+}
+
+- (void)startURLSchemeTaskForHandler:(FWFURLSchemeHandler *)instance
+                             webView:(WKWebView *)webView
+                      taskIdentifier:(NSInteger)taskIdentifier
+                             request:(NSURLRequest *)request
+                          completion:(void (^)(FlutterError *_Nullable))completion {
+  NSInteger webViewIdentifier =
+      [self.instanceManager identifierWithStrongReferenceForInstance:webView];
+  FWFNSUrlRequestData *requestData = FWFNSUrlRequestDataFromNativeNSURLRequest(request);
+  [self startURLSchemeTaskForHandlerWithIdentifier:[self identifierForHandler:instance]
+                                 webViewIdentifier:webViewIdentifier
+                                    taskIdentifier:taskIdentifier
+                                           request:requestData
+                                        completion:completion];
+}
+
+- (void)stopURLSchemeTaskForHandler:(FWFURLSchemeHandler *)instance
+                            webView:(WKWebView *)webView
+                     taskIdentifier:(NSInteger)taskIdentifier
+                         completion:(void (^)(FlutterError *_Nullable))completion {
+  NSInteger webViewIdentifier =
+      [self.instanceManager identifierWithStrongReferenceForInstance:webView];
+  [self stopURLSchemeTaskForHandlerWithIdentifier:[self identifierForHandler:instance]
+                                webViewIdentifier:webViewIdentifier
+                                   taskIdentifier:taskIdentifier
+                                       completion:completion];
+}
+@end
+
+@interface FWFURLSchemeRoute : NSObject
+@property(nonatomic, copy) NSString *pathPrefix;
+@property(nonatomic, copy) NSString *directoryPath;
+@end
+
+@implementation FWFURLSchemeRoute
+@end
+
+@interface FWFURLSchemeHandler ()
+@property(nonatomic) NSMutableArray<FWFURLSchemeRoute *> *routes;
+// Tasks that were sent to Dart and haven't been stopped or finished, by identifier.
+@property(nonatomic) NSMutableDictionary<NSNumber *, id<WKURLSchemeTask>> *dartTasks;
+// Tasks that are answered with a file and haven't been stopped or finished, by identifier.
+@property(nonatomic) NSMutableDictionary<NSNumber *, id<WKURLSchemeTask>> *fileTasks;
+@property(nonatomic) NSInteger nextTaskIdentifier;
+// Files are opened off the main thread, so a slow disk doesn't block the UI.
+@property(nonatomic) dispatch_queue_t fileQueue;
+@end
+
+// Accessed on the main thread.
+static NSMutableSet<NSString *> *FWFRegisteredURLSchemes;
+
+@implementation FWFURLSchemeHandler
++ (NSSet<NSString *> *)registeredURLSchemes {
+  return [FWFRegisteredURLSchemes copy] ?: [NSSet set];
+}
+
++ (void)registerURLScheme:(NSString *)scheme {
+  if (!FWFRegisteredURLSchemes) {
+    FWFRegisteredURLSchemes = [NSMutableSet set];
+  }
+  [FWFRegisteredURLSchemes addObject:scheme.lowercaseString];
+}
+
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager {
+  self = [super initWithBinaryMessenger:binaryMessenger instanceManager:instanceManager];
+  if (self) {
+    _URLSchemeHandlerAPI =
+        [[FWFURLSchemeHandlerFlutterApiImpl alloc] initWithBinaryMessenger:binaryMessenger
+                                                           instanceManager:instanceManager];
+    _routes = [NSMutableArray array];
+    _dartTasks = [NSMutableDictionary dictionary];
+    _fileTasks = [NSMutableDictionary dictionary];
+    _fileQueue = dispatch_queue_create("io.flutter.webview.urlSchemeFileQueue", NULL);
+  }
+  return self;
+}
+
+- (void)addRouteWithPathPrefix:(NSString *)pathPrefix directoryPath:(NSString *)directoryPath {
+  FWFURLSchemeRoute *route = [[FWFURLSchemeRoute alloc] init];
+  route.pathPrefix = pathPrefix;
+  route.directoryPath = directoryPath.stringByStandardizingPath;
+  [self.routes addObject:route];
+}
+
+// Returns the path of the file that answers `URL`, an empty string if `URL` matches a route but
+// would resolve outside of its directory, or nil if `URL` doesn't match a route.
+- (nullable NSString *)filePathForURL:(NSURL *)URL {
+  NSString *path = URL.path.length > 0 ? URL.path : @"/";
+  for (FWFURLSchemeRoute *route in self.routes) {
+    if (![path hasPrefix:route.pathPrefix]) {
+      continue;
+    }
+    NSString *relativePath = [path substringFromIndex:route.pathPrefix.length];
+    if (relativePath.length == 0 || [relativePath hasSuffix:@"/"]) {
+      relativePath = [relativePath stringByAppendingString:@"index.html"];
+    }
+    NSString *filePath =
+        [route.directoryPath stringByAppendingPathComponent:relativePath].stringByStandardizingPath;
+    // `..` components must not reach files outside of the route's directory.
+    if (![filePath hasPrefix:[route.directoryPath stringByAppendingString:@"/"]]) {
+      return @"";
+    }
+    return filePath;
+  }
+  return nil;
+}
+
+- (void)webView:(WKWebView *)webView startURLSchemeTask:(id<WKURLSchemeTask>)urlSchemeTask {
+  NSInteger taskIdentifier = self.nextTaskIdentifier++;
+  NSString *filePath = [self filePathForURL:urlSchemeTask.request.URL];
+  if (filePath) {
+    self.fileTasks[@(taskIdentifier)] = urlSchemeTask;
+    [self answerTaskWithIdentifier:taskIdentifier withFileAtPath:filePath];
+    return;
+  }
+
+  self.dartTasks[@(taskIdentifier)] = urlSchemeTask;
+  [self.URLSchemeHandlerAPI startURLSchemeTaskForHandler:self
+                                                 webView:webView
+                                          taskIdentifier:taskIdentifier
+                                                 request:urlSchemeTask.request
+                                              completion:^(FlutterError *error) {
+                                                NSAssert(!error, @"%@", error);
+                                              }];
+}
+
+- (void)webView:(WKWebView *)webView stopURLSchemeTask:(id<WKURLSchemeTask>)urlSchemeTask {
+  // WebKit raises an exception when a stopped task is used, so a stopped task is forgotten.
+  NSNumber *fileTaskIdentifier = [self identifierOfTask:urlSchemeTask inTasks:self.fileTasks];
+  if (fileTaskIdentifier) {
+    [self.fileTasks removeObjectForKey:fileTaskIdentifier];
+    return;
+  }
+
+  NSNumber *dartTaskIdentifier = [self identifierOfTask:urlSchemeTask inTasks:self.dartTasks];
+  if (dartTaskIdentifier) {
+    [self.dartTasks removeObjectForKey:dartTaskIdentifier];
+    [self.URLSchemeHandlerAPI stopURLSchemeTaskForHandler:self
+                                                  webView:webView
+                                           taskIdentifier:dartTaskIdentifier.integerValue
+                                               completion:^(FlutterError *error) {
+                                                 NSAssert(!error, @"%@", error);
+                                               }];
+  }
+}
+
+- (nullable NSNumber *)identifierOfTask:(id<WKURLSchemeTask>)task
+                                inTasks:(NSDictionary<NSNumber *, id<WKURLSchemeTask>> *)tasks {
+  return [tasks keysOfEntriesPassingTest:^BOOL(NSNumber *key, id<WKURLSchemeTask> value,
+                                               BOOL *stop) {
+           return value == task;
+         }].anyObject;
+}
+
+- (void)answerTaskWithIdentifier:(NSInteger)taskIdentifier withFileAtPath:(NSString *)filePath {
+  NSURL *URL = self.fileTasks[@(taskIdentifier)].request.URL;
+  __weak FWFURLSchemeHandler *weakSelf = self;
+  dispatch_async(self.fileQueue, ^{
+    // A mapped file is paged in as WebKit reads it, instead of being copied into memory first.
+    NSError *error;
+    NSData *data = filePath.length > 0 ? [NSData dataWithContentsOfFile:filePath
+                                                                options:NSDataReadingMappedIfSafe
+                                                                  error:&error]
+                                       : nil;
+    NSInteger statusCode = 200;
+    NSDictionary<NSString *, NSString *> *headers;
+    if (data) {
+      headers = @{
+        @"Content-Type" : FWFMIMETypeForPathExtension(filePath.pathExtension),
+        @"Content-Length" : @(data.length).stringValue,
+      };
+    } else {
+      statusCode = 404;
+      headers = @{@"Content-Length" : @"0"};
+    }
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:URL
+                                                              statusCode:statusCode
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:headers];
+    dispatch_async(dispatch_get_main_queue(), ^{
+      id<WKURLSchemeTask> task = weakSelf.fileTasks[@(taskIdentifier)];
+      if (!task) {
+        return;
+      }
+      [weakSelf.fileTasks removeObjectForKey:@(taskIdentifier)];
+      [task didReceiveResponse:response];
+      if (data.length > 0) {
+        [task didReceiveData:data];
+      }
+      [task didFinish];
+    });
+  });
+}
+
+- (void)didReceiveResponse:(NSURLResponse *)response
+     forTaskWithIdentifier:(NSInteger)taskIdentifier {
+  [self.dartTasks[@(taskIdentifier)] didReceiveResponse:response];
+}
+
+- (void)didReceiveData:(NSData *)data forTaskWithIdentifier:(NSInteger)taskIdentifier {
+  [self.dartTasks[@(taskIdentifier)] didReceiveData:data];
+}
+
+- (void)didFinishTaskWithIdentifier:(NSInteger)taskIdentifier {
+  id<WKURLSchemeTask> task = self.dartTasks[@(taskIdentifier)];
+  [self.dartTasks removeObjectForKey:@(taskIdentifier)];
+  [task didFinish];
+}
+
+- (void)didFailTaskWithIdentifier:(NSInteger)taskIdentifier error:(NSError *)error {
+  id<WKURLSchemeTask> task = self.dartTasks[@(taskIdentifier)];
+  [self.dartTasks removeObjectForKey:@(taskIdentifier)];
+  [task didFailWithError:error];
+}
+
+- (nullable NSURL *)requestURLForTaskWithIdentifier:(NSInteger)taskIdentifier {
+  return self.dartTasks[@(taskIdentifier)].request.URL;
+}
+@end
+
+@interface FWFURLSchemeHandlerHostApiImpl ()
+// BinaryMessenger must be weak to prevent a circular reference with the host API it
+// references.
+@property(nonatomic, weak) id<FlutterBinaryMessenger> binaryMessenger;
+// InstanceManager must be weak to prevent a circular reference with the object it stores.
+@property(nonatomic, weak) FWFInstanceManager *instanceManager;
+@property NSBundle *bundle;
+@property FWFAssetManager *assetManager;
+@end
+
+@implementation FWFURLSchemeHandlerHostApiImpl
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager {
+  return [self initWithBinaryMessenger:binaryMessenger
+                       instanceManager:instanceManager
+                                bundle:[NSBundle mainBundle]
+                          assetManager:[[FWFAssetManager alloc] init]];
+}
+
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager
+                                 bundle:(NSBundle *)bundle
+                           assetManager:(FWFAssetManager *)assetManager {
+  self = [self init];
+  if (self) {
+    _binaryMessenger = binaryMessenger;
+    _instanceManager = instanceManager;
+    _bundle = bundle;
+    _assetManager = assetManager;
+  }
+  return self;
+}
+
+- (FWFURLSchemeHandler *)URLSchemeHandlerForIdentifier:(NSInteger)identifier {
+  return (FWFURLSchemeHandler *)[self.instanceManager instanceForIdentifier:identifier];
+}
+
+- (void)createWithIdentifier:(NSInteger)identifier error:(FlutterError *_Nullable *_Nonnull)error {
+  FWFURLSchemeHandler *URLSchemeHandler =
+      [[FWFURLSchemeHandler alloc] initWithBinaryMessenger:self.binaryMessenger
+                                           instanceManager:self.instanceManager];
+  [self.instanceManager addDartCreatedInstance:URLSchemeHandler withIdentifier:identifier];
+}
+
+- (void)addFileRouteForHandlerWithIdentifier:(NSInteger)identifier
+                                  pathPrefix:(NSString *)pathPrefix
+                               directoryPath:(NSString *)directoryPath
+                                       error:(FlutterError *_Nullable *_Nonnull)error {
+  [[self URLSchemeHandlerForIdentifier:identifier] addRouteWithPathPrefix:pathPrefix
+                                                            directoryPath:directoryPath];
+}
+
+- (void)addFlutterAssetRouteForHandlerWithIdentifier:(NSInteger)identifier
+                                          pathPrefix:(NSString *)pathPrefix
+                                      assetDirectory:(NSString *)assetDirectory
+                                               error:(FlutterError *_Nullable *_Nonnull)error {
+  NSString *assetPath = [self.assetManager lookupKeyForAsset:assetDirectory];
+  [[self URLSchemeHandlerForIdentifier:identifier]
+      addRouteWithPathPrefix:pathPrefix
+               directoryPath:[self.bundle.bundlePath stringByAppendingPathComponent:assetPath]];
+}
+
+- (void)didReceiveResponseForHandlerWithIdentifier:(NSInteger)identifier
+                                    taskIdentifier:(NSInteger)taskIdentifier
+                                        statusCode:(NSInteger)statusCode
+                                           headers:(NSDictionary<NSString *, NSString *> *)headers
+                                             error:(FlutterError *_Nullable *_Nonnull)error {
+  FWFURLSchemeHandler *URLSchemeHandler = [self URLSchemeHandlerForIdentifier:identifier];
+  NSURL *URL = [URLSchemeHandler requestURLForTaskWithIdentifier:taskIdentifier];
+  if (!URL) {
+    return;
+  }
+  NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:URL
+                                                            statusCode:statusCode
+                                                           HTTPVersion:@"HTTP/1.1"
+                                                          headerFields:headers];
+  [URLSchemeHandler didReceiveResponse:response forTaskWithIdentifier:taskIdentifier];
+}
+
+- (void)didReceiveDataForHandlerWithIdentifier:(NSInteger)identifier
+                                taskIdentifier:(NSInteger)taskIdentifier
+                                          data:(FlutterStandardTypedData *)data
+                                         error:(FlutterError *_Nullable *_Nonnull)error {
+  [[self URLSchemeHandlerForIdentifier:identifier] didReceiveData:data.data
+                                            forTaskWithIdentifier:taskIdentifier];
+}
+
+- (void)didFinishForHandlerWithIdentifier:(NSInteger)identifier
+                           taskIdentifier:(NSInteger)taskIdentifier
+                                    error:(FlutterError *_Nullable *_Nonnull)error {
+  [[self URLSchemeHandlerForIdentifier:identifier] didFinishTaskWithIdentifier:taskIdentifier];
+}
+
+- (void)didFailForHandlerWithIdentifier:(NSInteger)identifier
+                         taskIdentifier:(NSInteger)taskIdentifier
+                       errorDescription:(NSString *)errorDescription
+                                  error:(FlutterError *_Nullable *_Nonnull)error {
+  NSError *taskError =
+      [NSError errorWithDomain:NSURLErrorDomain
+                          code:NSURLErrorUnknown
+                      userInfo:@{NSLocalizedDescriptionKey : errorDescription}];
+  [[self URLSchemeHandlerForIdentifier:identifier] didFailTaskWithIdentifier:taskIdentifier
+                                                                        error:taskError];
+}
+@end
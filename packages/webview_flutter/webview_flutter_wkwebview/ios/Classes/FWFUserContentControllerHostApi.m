@@ -77,4 +77,34 @@
   [[self userContentControllerForIdentifier:identifier] removeAllUserScripts];
 }
 
+- (void)addContentRuleListForControllerWithIdentifier:(NSInteger)identifier
+                                      storeIdentifier:(NSInteger)storeIdentifier
+                                   ruleListIdentifier:(nonnull NSString *)ruleListIdentifier
+                                           completion:(nonnull void (^)(FlutterError *_Nullable))
+                                                          completion {
+  WKUserContentController *userContentController =
+      [self userContentControllerForIdentifier:identifier];
+  WKContentRuleListStore *store =
+      (WKContentRuleListStore *)[self.instanceManager instanceForIdentifier:storeIdentifier];
+  // Looking up a rule list maps its compiled form from disk, so it isn't parsed again.
+  [store lookUpContentRuleListForIdentifier:ruleListIdentifier
+                          completionHandler:^(WKContentRuleList *ruleList, NSError *error) {
+                            if (error) {
+                              completion([FlutterError
+                                  errorWithCode:@"FWFContentRuleListError"
+                                        message:error.localizedDescription
+                                        details:FWFNSErrorDataFromNativeNSError(error)]);
+                              return;
+                            }
+                            [userContentController addContentRuleList:ruleList];
+                            completion(nil);
+                          }];
+}
+
+- (void)removeAllContentRuleListsForControllerWithIdentifier:(NSInteger)identifier
+                                                       error:(FlutterError *_Nullable *_Nonnull)
+                                                                 error {
+  [[self userContentControllerForIdentifier:identifier] removeAllContentRuleLists];
+}
+
 @end
@@ -4,6 +4,7 @@
 
 #import "FWFWebViewConfigurationHostApi.h"
 #import "FWFDataConverters.h"
+#import "FWFURLSchemeHandlerHostApi.h"
 #import "FWFWebViewConfigurationHostApi.h"
 
 @interface FWFWebViewConfigurationFlutterApiImpl ()
@@ -132,4 +133,37 @@
   }
   [configuration setMediaTypesRequiringUserActionForPlayback:typesInt];
 }
+
+- (void)useSharedProcessPoolForConfigurationWithIdentifier:(NSInteger)identifier
+                                                     error:(FlutterError *_Nullable *_Nonnull)
+                                                               error {
+  // Web views that share a process pool share their web content processes, so the pages and
+  // scripts they have already loaded don't need to be loaded again in a new process.
+  static WKProcessPool *sharedProcessPool;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedProcessPool = [[WKProcessPool alloc] init];
+  });
+  [self webViewConfigurationForIdentifier:identifier].processPool = sharedProcessPool;
+}
+
+- (void)setURLSchemeHandlerForConfigurationWithIdentifier:(NSInteger)identifier
+                                        handlerIdentifier:(NSInteger)handlerIdentifier
+                                                   scheme:(NSString *)scheme
+                                                    error:(FlutterError *_Nullable *_Nonnull)
+                                                              error {
+  // WebKit raises an exception for schemes it handles itself, like `https`.
+  if ([WKWebView handlesURLScheme:scheme]) {
+    *error = [FlutterError
+        errorWithCode:@"FWFURLSchemeHandledByWebKitError"
+              message:[NSString stringWithFormat:@"The URL scheme %@ is handled by WebKit.", scheme]
+              details:nil];
+    return;
+  }
+  FWFURLSchemeHandler *handler =
+      (FWFURLSchemeHandler *)[self.instanceManager instanceForIdentifier:handlerIdentifier];
+  [[self webViewConfigurationForIdentifier:identifier] setURLSchemeHandler:handler
+                                                              forURLScheme:scheme];
+  [FWFURLSchemeHandler registerURLScheme:scheme];
+}
 @end
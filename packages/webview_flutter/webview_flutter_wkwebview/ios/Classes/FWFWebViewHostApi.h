@@ -11,6 +11,8 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class FWFWebViewPool;
+
 /**
  * A set of Flutter and Dart assets used by a `FlutterEngine` to initialize execution.
  *
@@ -26,10 +28,55 @@ NS_ASSUME_NONNULL_BEGIN
 @interface FWFWebView : WKWebView <FlutterPlatformView>
 @property(readonly, nonnull, nonatomic) FWFObjectFlutterApiImpl *objectApi;
 
+/**
+ * The pool this web view returns to when it is disposed from Dart, if any.
+ */
+@property(nonatomic, weak, nullable) FWFWebViewPool *webViewPool;
+
 - (instancetype)initWithFrame:(CGRect)frame
                 configuration:(nonnull WKWebViewConfiguration *)configuration
               binaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
               instanceManager:(FWFInstanceManager *)instanceManager;
+
+/**
+ * Resets the state set by the previous user of this web view and loads an empty page.
+ *
+ * Removes the delegates, the observers the web view added for itself, the user scripts, the
+ * script message handlers and the content rule lists.
+ */
+- (void)prepareForReuse API_AVAILABLE(ios(14.0));
+
+/**
+ * Hides the current back-forward history from `canGoBack`, `canGoForward`, `goBack` and
+ * `goForward`.
+ *
+ * WebKit provides no way to clear the back-forward list of a web view.
+ */
+- (void)discardBackForwardHistory;
+
+/**
+ * Whether the page of this web view is unloaded to free its memory while the web view is out of
+ * a window, and restored when the web view moves back into a window.
+ *
+ * The page is unloaded when the app receives a memory warning, or after the web view has been out
+ * of a window for `idleTimeout` seconds if `idleTimeout` is positive. Requires iOS 15, which
+ * provides `interactionState`.
+ */
+- (void)setSuspendsWhenOffscreen:(BOOL)suspends idleTimeout:(NSTimeInterval)idleTimeout;
+
+/**
+ * Whether the page is unloaded, or being restored, by offscreen suspension.
+ *
+ * While suspended, the navigation delegate and key-value observers sent to Dart don't receive the
+ * callbacks of the unloading and restoring loads, and `URL`, `title`, `canGoBack` and
+ * `canGoForward` return the values of the unloaded page.
+ */
+@property(nonatomic, readonly, getter=isSuspended) BOOL suspended;
+
+/**
+ * Unloads the page if offscreen suspension is enabled and the web view is out of a window.
+ */
+- (void)suspend;
 @end
 
 /**
@@ -4,6 +4,36 @@
 
 #import "FWFWebViewHostApi.h"
 #import "FWFDataConverters.h"
+#import "FWFWebViewPool.h"
+
+// Wraps the function body passed to callAsyncJavaScript. Binary arguments are passed as base64
+// strings and are decoded to a Uint8Array before the body runs, and a returned ArrayBuffer or
+// typed array is sent back as a base64 string under FWFJavaScriptBinaryDataKey.
+static NSString *const FWFAsyncJavaScriptTemplate =
+    @"const __flutterBase64ToBytes = (string) => {\n"
+    @"  const binary = atob(string);\n"
+    @"  const bytes = new Uint8Array(binary.length);\n"
+    @"  for (let i = 0; i < binary.length; i++) {\n"
+    @"    bytes[i] = binary.charCodeAt(i);\n"
+    @"  }\n"
+    @"  return bytes;\n"
+    @"};\n"
+    @"%@"
+    @"const __flutterResult = await (async () => {\n"
+    @"%@\n"
+    @"})();\n"
+    @"if (__flutterResult instanceof ArrayBuffer || ArrayBuffer.isView(__flutterResult)) {\n"
+    @"  const bytes = __flutterResult instanceof ArrayBuffer\n"
+    @"      ? new Uint8Array(__flutterResult)\n"
+    @"      : new Uint8Array(\n"
+    @"          __flutterResult.buffer, __flutterResult.byteOffset, __flutterResult.byteLength);\n"
+    @"  let binary = '';\n"
+    @"  for (let i = 0; i < bytes.length; i += 0x8000) {\n"
+    @"    binary += String.fromCharCode.apply(null, bytes.subarray(i, i + 0x8000));\n"
+    @"  }\n"
+    @"  return {'%@': btoa(binary)};\n"
+    @"}\n"
+    @"return __flutterResult;";
 
 @implementation FWFAssetManager
 - (NSString *)lookupKeyForAsset:(NSString *)asset {
@@ -11,6 +41,39 @@
 }
 @end
 
+@interface FWFWebView () <WKNavigationDelegate>
+// Key paths this web view observes on itself, which are removed when the web view is reused.
+@property(nonatomic) NSMutableArray<NSString *> *selfObservedKeyPaths;
+// Back-forward list items that are hidden by discardBackForwardHistory.
+@property(nonatomic) NSMutableSet<WKBackForwardListItem *> *discardedBackForwardItems;
+
+@property(nonatomic) BOOL suspendsWhenOffscreen;
+@property(nonatomic) NSTimeInterval suspensionIdleTimeout;
+// Incremented when the web view moves into or out of a window, which cancels a pending idle
+// suspension.
+@property(nonatomic) NSUInteger windowGeneration;
+// Taken when the web view leaves a window, and shown over the page while it is restored.
+@property(nonatomic, nullable) UIImage *offscreenSnapshot;
+@property(nonatomic, nullable) UIImageView *snapshotView;
+// The state of the unloaded page, which is only set while the web view is suspended.
+@property(nonatomic, nullable) id suspendedInteractionState;
+@property(nonatomic, nullable) NSURL *suspendedURL;
+@property(nonatomic, copy, nullable) NSString *suspendedTitle;
+@property(nonatomic) BOOL suspendedCanGoBack;
+@property(nonatomic) BOOL suspendedCanGoForward;
+// The number of the oldest back items that were hidden by discardBackForwardHistory. Restored
+// items are new objects, so they are hidden again by position.
+@property(nonatomic) NSUInteger suspendedHiddenBackItemCount;
+// The navigation delegate that receives callbacks again once the page is restored.
+@property(nonatomic, weak, nullable) id<WKNavigationDelegate> suspendedNavigationDelegate;
+@property(nonatomic, getter=isRestoring) BOOL restoring;
+// The load of the empty page that unloads a suspended page, whose callbacks don't end a
+// restoration that starts before it completes.
+@property(nonatomic, nullable) WKNavigation *unloadNavigation;
+// Loads and scripts requested while suspended, which run once the page is restored.
+@property(nonatomic) NSMutableArray<dispatch_block_t> *pendingRestorationBlocks;
+@end
+
 @implementation FWFWebView
 - (instancetype)initWithFrame:(CGRect)frame
                 configuration:(nonnull WKWebViewConfiguration *)configuration
@@ -20,6 +83,9 @@
   if (self) {
     _objectApi = [[FWFObjectFlutterApiImpl alloc] initWithBinaryMessenger:binaryMessenger
                                                           instanceManager:instanceManager];
+    _selfObservedKeyPaths = [NSMutableArray array];
+    _discardedBackForwardItems = [NSMutableSet set];
+    _pendingRestorationBlocks = [NSMutableArray array];
 
     self.scrollView.contentInsetAdjustmentBehavior = UIScrollViewContentInsetAdjustmentNever;
     if (@available(iOS 13.0, *)) {
@@ -48,6 +114,10 @@
                       ofObject:(id)object
                         change:(NSDictionary<NSKeyValueChangeKey, id> *)change
                        context:(void *)context {
+  // The unloading and restoring loads of a suspended page are not reported.
+  if (self.suspended) {
+    return;
+  }
   [self.objectApi observeValueForObject:self
                                 keyPath:keyPath
                                  object:object
@@ -57,6 +127,390 @@
                              }];
 }
 
+- (void)addObserver:(NSObject *)observer
+         forKeyPath:(NSString *)keyPath
+            options:(NSKeyValueObservingOptions)options
+            context:(void *)context {
+  [super addObserver:observer forKeyPath:keyPath options:options context:context];
+  if (observer == self) {
+    [self.selfObservedKeyPaths addObject:keyPath];
+  }
+}
+
+- (void)removeObserver:(NSObject *)observer forKeyPath:(NSString *)keyPath {
+  [super removeObserver:observer forKeyPath:keyPath];
+  if (observer == self) {
+    NSUInteger index = [self.selfObservedKeyPaths indexOfObject:keyPath];
+    if (index != NSNotFound) {
+      [self.selfObservedKeyPaths removeObjectAtIndex:index];
+    }
+  }
+}
+
+- (BOOL)canGoBack {
+  if (self.suspended) {
+    return self.suspendedCanGoBack;
+  }
+  return [super canGoBack] &&
+         ![self.discardedBackForwardItems containsObject:self.backForwardList.backItem];
+}
+
+- (BOOL)canGoForward {
+  if (self.suspended) {
+    return self.suspendedCanGoForward;
+  }
+  return [super canGoForward] &&
+         ![self.discardedBackForwardItems containsObject:self.backForwardList.forwardItem];
+}
+
+- (WKNavigation *)goBack {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf goBack];
+      }]) {
+    return nil;
+  }
+  return [self canGoBack] ? [super goBack] : nil;
+}
+
+- (WKNavigation *)goForward {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf goForward];
+      }]) {
+    return nil;
+  }
+  return [self canGoForward] ? [super goForward] : nil;
+}
+
+- (WKNavigation *)loadRequest:(NSURLRequest *)request {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf loadRequest:request];
+      }]) {
+    return nil;
+  }
+  return [super loadRequest:request];
+}
+
+- (WKNavigation *)loadHTMLString:(NSString *)string baseURL:(NSURL *)baseURL {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf loadHTMLString:string baseURL:baseURL];
+      }]) {
+    return nil;
+  }
+  return [super loadHTMLString:string baseURL:baseURL];
+}
+
+- (WKNavigation *)loadFileURL:(NSURL *)URL allowingReadAccessToURL:(NSURL *)readAccessURL {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf loadFileURL:URL allowingReadAccessToURL:readAccessURL];
+      }]) {
+    return nil;
+  }
+  return [super loadFileURL:URL allowingReadAccessToURL:readAccessURL];
+}
+
+- (WKNavigation *)reload {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf reload];
+      }]) {
+    return nil;
+  }
+  return [super reload];
+}
+
+- (void)evaluateJavaScript:(NSString *)javaScriptString
+         completionHandler:(void (^)(id, NSError *))completionHandler {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf evaluateJavaScript:javaScriptString completionHandler:completionHandler];
+      }]) {
+    return;
+  }
+  [super evaluateJavaScript:javaScriptString completionHandler:completionHandler];
+}
+
+- (void)callAsyncJavaScript:(NSString *)functionBody
+                  arguments:(NSDictionary<NSString *, id> *)arguments
+                    inFrame:(WKFrameInfo *)frame
+             inContentWorld:(WKContentWorld *)contentWorld
+          completionHandler:(void (^)(id, NSError *))completionHandler API_AVAILABLE(ios(14.0)) {
+  __weak FWFWebView *weakSelf = self;
+  if ([self deferUntilRestored:^{
+        [weakSelf callAsyncJavaScript:functionBody
+                            arguments:arguments
+                              inFrame:frame
+                       inContentWorld:contentWorld
+                    completionHandler:completionHandler];
+      }]) {
+    return;
+  }
+  [super callAsyncJavaScript:functionBody
+                   arguments:arguments
+                     inFrame:frame
+              inContentWorld:contentWorld
+           completionHandler:completionHandler];
+}
+
+- (NSURL *)URL {
+  return self.suspended ? self.suspendedURL : [super URL];
+}
+
+- (NSString *)title {
+  return self.suspended ? self.suspendedTitle : [super title];
+}
+
+- (void)setNavigationDelegate:(id<WKNavigationDelegate>)navigationDelegate {
+  if (self.suspended) {
+    self.suspendedNavigationDelegate = navigationDelegate;
+  } else {
+    [super setNavigationDelegate:navigationDelegate];
+  }
+}
+
+- (void)setSuspendsWhenOffscreen:(BOOL)suspends idleTimeout:(NSTimeInterval)idleTimeout {
+  self.suspendsWhenOffscreen = suspends;
+  self.suspensionIdleTimeout = idleTimeout;
+  self.windowGeneration++;
+
+  NSNotificationCenter *center = [NSNotificationCenter defaultCenter];
+  [center removeObserver:self name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+  if (suspends) {
+    [center addObserver:self
+               selector:@selector(didReceiveMemoryWarning:)
+                   name:UIApplicationDidReceiveMemoryWarningNotification
+                 object:nil];
+    if (!self.window) {
+      [self scheduleIdleSuspension];
+    }
+  }
+}
+
+- (BOOL)isSuspended {
+  return self.suspendedInteractionState != nil;
+}
+
+- (void)didReceiveMemoryWarning:(NSNotification *)notification {
+  [self suspend];
+}
+
+- (void)willMoveToWindow:(UIWindow *)newWindow {
+  [super willMoveToWindow:newWindow];
+  if (@available(iOS 15.0, *)) {
+    if (!newWindow && self.window && self.suspendsWhenOffscreen && !self.suspended) {
+      // WebKit doesn't render a web view outside of a window, so the snapshot that covers the
+      // page while it is restored is taken now.
+      __weak FWFWebView *weakSelf = self;
+      [self takeSnapshotWithConfiguration:nil
+                        completionHandler:^(UIImage *snapshot, NSError *error) {
+                          if (!weakSelf.window) {
+                            weakSelf.offscreenSnapshot = snapshot;
+                          }
+                        }];
+    }
+  }
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+  self.windowGeneration++;
+  if (self.window) {
+    if (self.suspended) {
+      [self restoreSuspendedPage];
+    } else {
+      self.offscreenSnapshot = nil;
+    }
+  } else if (self.suspendsWhenOffscreen) {
+    [self scheduleIdleSuspension];
+  }
+}
+
+- (void)scheduleIdleSuspension {
+  if (self.suspensionIdleTimeout <= 0) {
+    return;
+  }
+  NSUInteger windowGeneration = self.windowGeneration;
+  __weak FWFWebView *weakSelf = self;
+  dispatch_after(
+      dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.suspensionIdleTimeout * NSEC_PER_SEC)),
+      dispatch_get_main_queue(), ^{
+        if (weakSelf.windowGeneration == windowGeneration) {
+          [weakSelf suspend];
+        }
+      });
+}
+
+- (void)suspend {
+  if (@available(iOS 15.0, *)) {
+    WKBackForwardListItem *currentItem = self.backForwardList.currentItem;
+    if (!self.suspendsWhenOffscreen || self.suspended || self.window || !currentItem ||
+        [self.discardedBackForwardItems containsObject:currentItem]) {
+      return;
+    }
+    id interactionState = self.interactionState;
+    if (!interactionState) {
+      return;
+    }
+
+    NSUInteger hiddenBackItemCount = 0;
+    for (WKBackForwardListItem *item in self.backForwardList.backList) {
+      if ([self.discardedBackForwardItems containsObject:item]) {
+        hiddenBackItemCount++;
+      }
+    }
+    self.suspendedHiddenBackItemCount = hiddenBackItemCount;
+    self.suspendedURL = [super URL];
+    self.suspendedTitle = [super title];
+    self.suspendedCanGoBack = [self canGoBack];
+    self.suspendedCanGoForward = [self canGoForward];
+    self.suspendedNavigationDelegate = [super navigationDelegate];
+    [super setNavigationDelegate:nil];
+    self.suspendedInteractionState = interactionState;
+
+    // Navigating away releases the page's documents, scripts and decoded resources, which lets
+    // WebKit shrink or reclaim the content process.
+    [super stopLoading];
+    self.unloadNavigation = [super loadHTMLString:@"" baseURL:nil];
+  }
+}
+
+// Returns NO if the web view isn't suspended. Otherwise restores the page and returns YES, and
+// `block` runs once the page is restored, so loads and scripts apply to the restored page.
+- (BOOL)deferUntilRestored:(dispatch_block_t)block {
+  if (!self.suspended) {
+    return NO;
+  }
+  [self.pendingRestorationBlocks addObject:block];
+  [self restoreSuspendedPage];
+  return YES;
+}
+
+- (void)restoreSuspendedPage {
+  if (@available(iOS 15.0, *)) {
+    if (self.restoring) {
+      return;
+    }
+    self.restoring = YES;
+    if (self.offscreenSnapshot && self.window) {
+      self.snapshotView = [[UIImageView alloc] initWithImage:self.offscreenSnapshot];
+      self.snapshotView.frame = self.bounds;
+      self.snapshotView.autoresizingMask =
+          UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+      [self addSubview:self.snapshotView];
+    }
+    // The restoring load reports to this web view, which ends the restoration when it completes.
+    [super setNavigationDelegate:self];
+    self.interactionState = self.suspendedInteractionState;
+  }
+}
+
+- (void)finishRestoration {
+  if (!self.restoring) {
+    return;
+  }
+  [self.snapshotView removeFromSuperview];
+  self.snapshotView = nil;
+  self.offscreenSnapshot = nil;
+
+  [self.discardedBackForwardItems removeAllObjects];
+  NSArray<WKBackForwardListItem *> *backList = self.backForwardList.backList;
+  NSUInteger hiddenBackItemCount = MIN(self.suspendedHiddenBackItemCount, backList.count);
+  [self.discardedBackForwardItems
+      addObjectsFromArray:[backList subarrayWithRange:NSMakeRange(0, hiddenBackItemCount)]];
+
+  id<WKNavigationDelegate> navigationDelegate = self.suspendedNavigationDelegate;
+  [self discardSuspendedState];
+  [super setNavigationDelegate:navigationDelegate];
+
+  NSArray<dispatch_block_t> *pendingBlocks = [self.pendingRestorationBlocks copy];
+  [self.pendingRestorationBlocks removeAllObjects];
+  for (dispatch_block_t block in pendingBlocks) {
+    block();
+  }
+
+  if (!self.window && self.suspendsWhenOffscreen) {
+    [self scheduleIdleSuspension];
+  }
+}
+
+- (void)discardSuspendedState {
+  self.restoring = NO;
+  self.suspendedInteractionState = nil;
+  self.suspendedURL = nil;
+  self.suspendedTitle = nil;
+  self.suspendedNavigationDelegate = nil;
+  self.unloadNavigation = nil;
+}
+
+- (void)webView:(WKWebView *)webView didFinishNavigation:(WKNavigation *)navigation {
+  if (navigation != self.unloadNavigation) {
+    [self finishRestoration];
+  }
+}
+
+- (void)webView:(WKWebView *)webView
+    didFailNavigation:(WKNavigation *)navigation
+            withError:(NSError *)error {
+  if (navigation != self.unloadNavigation) {
+    [self finishRestoration];
+  }
+}
+
+- (void)webView:(WKWebView *)webView
+    didFailProvisionalNavigation:(WKNavigation *)navigation
+                       withError:(NSError *)error {
+  if (navigation != self.unloadNavigation) {
+    [self finishRestoration];
+  }
+}
+
+- (void)webViewWebContentProcessDidTerminate:(WKWebView *)webView {
+  [self finishRestoration];
+}
+
+- (void)prepareForReuse {
+  [self setSuspendsWhenOffscreen:NO idleTimeout:0];
+  [self.snapshotView removeFromSuperview];
+  self.snapshotView = nil;
+  self.offscreenSnapshot = nil;
+  [self.pendingRestorationBlocks removeAllObjects];
+  [self discardSuspendedState];
+
+  [self stopLoading];
+  for (NSString *keyPath in [self.selfObservedKeyPaths copy]) {
+    [self removeObserver:self forKeyPath:keyPath];
+  }
+  self.navigationDelegate = nil;
+  self.UIDelegate = nil;
+  self.customUserAgent = nil;
+  self.allowsBackForwardNavigationGestures = NO;
+  self.opaque = YES;
+  self.backgroundColor = nil;
+  self.scrollView.backgroundColor = nil;
+  self.scrollView.contentOffset = CGPointZero;
+
+  WKWebViewConfiguration *configuration = self.configuration;
+  [configuration.userContentController removeAllUserScripts];
+  [configuration.userContentController removeAllScriptMessageHandlers];
+  [configuration.userContentController removeAllContentRuleLists];
+  [configuration.preferences setJavaScriptEnabled:YES];
+
+  [self loadHTMLString:@"" baseURL:nil];
+}
+
+- (void)discardBackForwardHistory {
+  WKBackForwardList *backForwardList = self.backForwardList;
+  [self.discardedBackForwardItems addObjectsFromArray:backForwardList.backList];
+  [self.discardedBackForwardItems addObjectsFromArray:backForwardList.forwardList];
+  if (backForwardList.currentItem) {
+    [self.discardedBackForwardItems addObject:backForwardList.currentItem];
+  }
+}
+
 - (nonnull UIView *)view {
   return self;
 }
@@ -70,6 +524,7 @@
 @property(nonatomic, weak) FWFInstanceManager *instanceManager;
 @property NSBundle *bundle;
 @property FWFAssetManager *assetManager;
+@property FWFWebViewPool *webViewPool;
 @end
 
 @implementation FWFWebViewHostApiImpl
@@ -91,6 +546,8 @@
     _instanceManager = instanceManager;
     _bundle = bundle;
     _assetManager = assetManager;
+    _webViewPool = [[FWFWebViewPool alloc] initWithBinaryMessenger:binaryMessenger
+                                                   instanceManager:instanceManager];
   }
   return self;
 }
@@ -113,10 +570,13 @@
                        error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
   WKWebViewConfiguration *configuration = (WKWebViewConfiguration *)[self.instanceManager
       instanceForIdentifier:configurationIdentifier];
-  FWFWebView *webView = [[FWFWebView alloc] initWithFrame:CGRectMake(0, 0, 0, 0)
-                                            configuration:configuration
-                                          binaryMessenger:self.binaryMessenger
-                                          instanceManager:self.instanceManager];
+  FWFWebView *webView = [self.webViewPool dequeueWebViewWithConfiguration:configuration];
+  if (!webView) {
+    webView = [[FWFWebView alloc] initWithFrame:CGRectMake(0, 0, 0, 0)
+                                  configuration:configuration
+                                binaryMessenger:self.binaryMessenger
+                                instanceManager:self.instanceManager];
+  }
   [self.instanceManager addDartCreatedInstance:webView withIdentifier:identifier];
 }
 
@@ -198,6 +658,99 @@
        }];
 }
 
+- (void)evaluateJavaScriptAsJSONForWebViewWithIdentifier:(NSInteger)identifier
+                                        javaScriptString:(nonnull NSString *)javaScriptString
+                                              completion:
+                                                  (nonnull void (^)(NSString *_Nullable,
+                                                                    FlutterError *_Nullable))
+                                                      completion {
+  // The script is embedded as a JSON string literal so it is evaluated verbatim, and the result is
+  // serialized in the page so only a single string crosses back over the bridge.
+  NSData *scriptLiteralData = [NSJSONSerialization dataWithJSONObject:@[ javaScriptString ]
+                                                              options:0
+                                                                error:nil];
+  if (!scriptLiteralData) {
+    completion(nil, [FlutterError errorWithCode:@"FWFEvaluateJavaScriptError"
+                                        message:@"Failed encoding JavaScript."
+                                        details:nil]);
+    return;
+  }
+  NSString *scriptLiteral = [[NSString alloc] initWithData:scriptLiteralData
+                                                  encoding:NSUTF8StringEncoding];
+  NSString *wrappedJavaScript =
+      [NSString stringWithFormat:@"JSON.stringify(eval(%@[0]))", scriptLiteral];
+
+  [[self webViewForIdentifier:identifier]
+      evaluateJavaScript:wrappedJavaScript
+       completionHandler:^(id _Nullable result, NSError *_Nullable error) {
+         if (error) {
+           completion(nil, [FlutterError errorWithCode:@"FWFEvaluateJavaScriptError"
+                                               message:@"Failed evaluating JavaScript."
+                                               details:FWFNSErrorDataFromNativeNSError(error)]);
+           return;
+         }
+         completion([result isKindOfClass:[NSString class]] ? result : nil, nil);
+       }];
+}
+
+- (void)
+    callAsyncJavaScriptForWebViewWithIdentifier:(NSInteger)identifier
+                                   functionBody:(nonnull NSString *)functionBody
+                                      arguments:(nonnull NSDictionary<NSString *, id> *)arguments
+                                     completion:(nonnull void (^)(id _Nullable,
+                                                                  FlutterError *_Nullable))
+                                                    completion {
+  if (@available(iOS 14.0, *)) {
+    NSMutableDictionary<NSString *, id> *javaScriptArguments =
+        [NSMutableDictionary dictionaryWithCapacity:arguments.count];
+    NSMutableString *argumentDecoders = [NSMutableString string];
+    [arguments enumerateKeysAndObjectsUsingBlock:^(NSString *name, id value, BOOL *stop) {
+      if ([value isKindOfClass:[FlutterStandardTypedData class]]) {
+        javaScriptArguments[name] =
+            [((FlutterStandardTypedData *)value).data base64EncodedStringWithOptions:0];
+        [argumentDecoders appendFormat:@"%@ = __flutterBase64ToBytes(%@);\n", name, name];
+      } else {
+        javaScriptArguments[name] = value;
+      }
+    }];
+
+    NSString *javaScript = [NSString stringWithFormat:FWFAsyncJavaScriptTemplate, argumentDecoders,
+                                                      functionBody, FWFJavaScriptBinaryDataKey];
+    [[self webViewForIdentifier:identifier]
+        callAsyncJavaScript:javaScript
+                  arguments:javaScriptArguments
+                    inFrame:nil
+             inContentWorld:WKContentWorld.pageWorld
+          completionHandler:^(id _Nullable result, NSError *_Nullable error) {
+            if (error) {
+              completion(nil,
+                         [FlutterError errorWithCode:@"FWFCallAsyncJavaScriptError"
+                                             message:@"Failed calling JavaScript."
+                                             details:FWFNSErrorDataFromNativeNSError(error)]);
+              return;
+            }
+
+            id returnValue = FWFValueFromJavaScriptValue(result);
+            if ([returnValue isKindOfClass:[NSNull class]]) {
+              returnValue = nil;
+            } else if (returnValue && ![returnValue isKindOfClass:[NSString class]] &&
+                       ![returnValue isKindOfClass:[NSNumber class]] &&
+                       ![returnValue isKindOfClass:[FlutterStandardTypedData class]]) {
+              NSLog(@"Return type of callAsyncJavaScript is not directly supported: %@. Returned "
+                    @"description of value.",
+                    NSStringFromClass([returnValue class]));
+              returnValue = [returnValue description];
+            }
+            completion(returnValue, nil);
+          }];
+  } else {
+    completion(nil, [FlutterError
+                        errorWithCode:@"FWFUnsupportedVersionError"
+                              message:@"callAsyncJavaScript is only supported on versions 14+."
+                              details:nil]);
+  }
+}
+
 - (void)setInspectableForWebViewWithIdentifier:(NSInteger)identifier
                                    inspectable:(BOOL)inspectable
                                          error:(FlutterError *_Nullable *_Nonnull)error {
@@ -307,4 +860,20 @@
                                           (FlutterError *_Nullable __autoreleasing *_Nonnull)error {
   return [[self webViewForIdentifier:identifier] customUserAgent];
 }
+
+- (void)prewarmWebViewsWithConfigurationIdentifier:(NSInteger)configurationIdentifier
+                                             count:(NSInteger)count
+                                             error:(FlutterError *_Nullable *_Nonnull)error {
+  WKWebViewConfiguration *configuration = (WKWebViewConfiguration *)[self.instanceManager
+      instanceForIdentifier:configurationIdentifier];
+  [self.webViewPool prewarmWebViewsWithConfiguration:configuration count:count];
+}
+
+- (void)setSuspendsWhenOffscreenForWebViewWithIdentifier:(NSInteger)identifier
+                                                suspends:(BOOL)suspends
+                                      idleTimeoutSeconds:(nullable NSNumber *)idleTimeoutSeconds
+                                                   error:(FlutterError *_Nullable *_Nonnull)error {
+  [[self webViewForIdentifier:identifier] setSuspendsWhenOffscreen:suspends
+                                                      idleTimeout:idleTimeoutSeconds.doubleValue];
+}
 @end
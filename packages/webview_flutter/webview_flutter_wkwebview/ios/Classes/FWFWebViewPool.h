@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Flutter/Flutter.h>
+#import <WebKit/WebKit.h>
+
+#import "FWFInstanceManager.h"
+#import "FWFWebViewHostApi.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Keeps idle FWFWebViews that are handed out instead of creating a new web view.
+ *
+ * Web views are created ahead of time with `prewarmWebViewsWithConfiguration:count:` and load an
+ * empty page, so their web content process is already running when they are handed out. A web
+ * view handed out by the pool returns to it when it is disposed from Dart.
+ */
+@interface FWFWebViewPool : NSObject
+/**
+ * The number of web views waiting to be handed out.
+ */
+@property(nonatomic, readonly) NSUInteger idleWebViewCount;
+
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager;
+
+/**
+ * Creates `count` web views with `configuration` and adds them to the pool.
+ *
+ * The pool keeps at most as many idle web views as have been prewarmed.
+ */
+- (void)prewarmWebViewsWithConfiguration:(WKWebViewConfiguration *)configuration
+                                   count:(NSUInteger)count;
+
+/**
+ * Removes and returns an idle web view created with a configuration equivalent to
+ * `configuration`.
+ *
+ * @return An idle web view or nil if the pool doesn't contain one for `configuration`.
+ */
+- (nullable FWFWebView *)dequeueWebViewWithConfiguration:(WKWebViewConfiguration *)configuration;
+
+/**
+ * Resets a web view handed out by this pool and adds it back to the pool.
+ *
+ * The web view is dropped instead if it is still in a view hierarchy, if the pool is full or if
+ * its script message handlers can't be removed (iOS < 14).
+ */
+- (void)recycleWebView:(FWFWebView *)webView;
+@end
+
+NS_ASSUME_NONNULL_END
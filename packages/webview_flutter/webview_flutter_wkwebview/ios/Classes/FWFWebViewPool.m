@@ -0,0 +1,99 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FWFWebViewPool.h"
+#import "FWFURLSchemeHandlerHostApi.h"
+
+// Whether a web view created with `configuration` behaves like one created with `other`. Only the
+// properties that are set on a configuration before a web view is created with it are compared.
+static BOOL FWFWebViewConfigurationsAreEquivalent(WKWebViewConfiguration *configuration,
+                                                  WKWebViewConfiguration *other) {
+  if (configuration.allowsInlineMediaPlayback != other.allowsInlineMediaPlayback ||
+      configuration.mediaTypesRequiringUserActionForPlayback !=
+          other.mediaTypesRequiringUserActionForPlayback ||
+      configuration.websiteDataStore != other.websiteDataStore) {
+    return NO;
+  }
+  for (NSString *scheme in FWFURLSchemeHandler.registeredURLSchemes) {
+    if ([configuration urlSchemeHandlerForURLScheme:scheme] !=
+        [other urlSchemeHandlerForURLScheme:scheme]) {
+      return NO;
+    }
+  }
+  if (@available(iOS 14.0, *)) {
+    if (configuration.limitsNavigationsToAppBoundDomains !=
+        other.limitsNavigationsToAppBoundDomains) {
+      return NO;
+    }
+  }
+  if (@available(iOS 15.0, *)) {
+    // All web views share a single process pool on iOS 15+.
+    return YES;
+  }
+  return configuration.processPool == other.processPool;
+}
+
+@interface FWFWebViewPool ()
+// BinaryMessenger must be weak to prevent a circular reference with the host API it
+// references.
+@property(nonatomic, weak) id<FlutterBinaryMessenger> binaryMessenger;
+// InstanceManager must be weak to prevent a circular reference with the object it stores.
+@property(nonatomic, weak) FWFInstanceManager *instanceManager;
+@property(nonatomic) NSMutableArray<FWFWebView *> *idleWebViews;
+@property(nonatomic) NSUInteger capacity;
+@end
+
+@implementation FWFWebViewPool
+- (instancetype)initWithBinaryMessenger:(id<FlutterBinaryMessenger>)binaryMessenger
+                        instanceManager:(FWFInstanceManager *)instanceManager {
+  self = [self init];
+  if (self) {
+    _binaryMessenger = binaryMessenger;
+    _instanceManager = instanceManager;
+    _idleWebViews = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (NSUInteger)idleWebViewCount {
+  return self.idleWebViews.count;
+}
+
+- (void)prewarmWebViewsWithConfiguration:(WKWebViewConfiguration *)configuration
+                                   count:(NSUInteger)count {
+  self.capacity += count;
+  for (NSUInteger i = 0; i < count; i++) {
+    FWFWebView *webView = [[FWFWebView alloc] initWithFrame:CGRectMake(0, 0, 0, 0)
+                                              configuration:configuration
+                                            binaryMessenger:self.binaryMessenger
+                                            instanceManager:self.instanceManager];
+    webView.webViewPool = self;
+    // Loading a page launches the web content process the web view renders with.
+    [webView loadHTMLString:@"" baseURL:nil];
+    [self.idleWebViews addObject:webView];
+  }
+}
+
+- (nullable FWFWebView *)dequeueWebViewWithConfiguration:(WKWebViewConfiguration *)configuration {
+  for (NSUInteger i = 0; i < self.idleWebViews.count; i++) {
+    FWFWebView *webView = self.idleWebViews[i];
+    if (FWFWebViewConfigurationsAreEquivalent(webView.configuration, configuration)) {
+      [self.idleWebViews removeObjectAtIndex:i];
+      [webView discardBackForwardHistory];
+      return webView;
+    }
+  }
+  return nil;
+}
+
+- (void)recycleWebView:(FWFWebView *)webView {
+  if (webView.superview || self.idleWebViews.count >= self.capacity) {
+    return;
+  }
+  if (@available(iOS 14.0, *)) {
+    [webView prepareForReuse];
+    [self.idleWebViews addObject:webView];
+  }
+}
+@end
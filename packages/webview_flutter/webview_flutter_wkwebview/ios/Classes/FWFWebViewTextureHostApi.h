@@ -0,0 +1,46 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Flutter/Flutter.h>
+#import <WebKit/WebKit.h>
+
+#import "FWFGeneratedWebKitApis.h"
+#import "FWFInstanceManager.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * A FlutterTexture that displays snapshots of a WKWebView.
+ *
+ * A snapshot is taken whenever the web view finishes loading, when its size changes and when
+ * `updateWithCompletion:` is called. WebKit only renders web views that are part of a window, so
+ * the web view is added behind the content of the application's window when it has none.
+ */
+@interface FWFWebViewTexture : NSObject <FlutterTexture>
+@property(readonly, nonatomic) WKWebView *webView;
+
+/// The identifier of the texture in the `FlutterTextureRegistry`.
+@property(readonly, nonatomic) int64_t textureId;
+
+- (instancetype)initWithWebView:(WKWebView *)webView
+                textureRegistry:(NSObject<FlutterTextureRegistry> *)textureRegistry;
+
+/// Sets the size of the web view in points and takes a new snapshot when it changed.
+- (void)setSize:(CGSize)size;
+
+/// Takes a snapshot of the web view and marks a new frame of the texture as available.
+- (void)updateWithCompletion:(void (^)(NSError *_Nullable error))completion;
+@end
+
+/**
+ * Host api implementation for FWFWebViewTexture.
+ *
+ * Handles creating FWFWebViewTexture that intercommunicate with a paired Dart object.
+ */
+@interface FWFWebViewTextureHostApiImpl : NSObject <FWFWKWebViewTextureHostApi>
+- (instancetype)initWithTextureRegistry:(NSObject<FlutterTextureRegistry> *)textureRegistry
+                        instanceManager:(FWFInstanceManager *)instanceManager;
+@end
+
+NS_ASSUME_NONNULL_END
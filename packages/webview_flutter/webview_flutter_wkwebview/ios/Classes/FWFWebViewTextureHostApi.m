@@ -0,0 +1,237 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "FWFWebViewTextureHostApi.h"
+#import "FWFDataConverters.h"
+
+static void *FWFWebViewTextureLoadingContext = &FWFWebViewTextureLoadingContext;
+
+static CVPixelBufferRef _Nullable FWFCreatePixelBufferFromImage(CGImageRef image) {
+  size_t width = CGImageGetWidth(image);
+  size_t height = CGImageGetHeight(image);
+  NSDictionary *attributes = @{
+    (NSString *)kCVPixelBufferIOSurfacePropertiesKey : @{},
+    (NSString *)kCVPixelBufferCGBitmapContextCompatibilityKey : @YES,
+  };
+
+  CVPixelBufferRef pixelBuffer = NULL;
+  if (CVPixelBufferCreate(kCFAllocatorDefault, width, height, kCVPixelFormatType_32BGRA,
+                          (__bridge CFDictionaryRef)attributes,
+                          &pixelBuffer) != kCVReturnSuccess) {
+    return NULL;
+  }
+
+  CVPixelBufferLockBaseAddress(pixelBuffer, 0);
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+  CGContextRef context = CGBitmapContextCreate(
+      CVPixelBufferGetBaseAddress(pixelBuffer), width, height, 8,
+      CVPixelBufferGetBytesPerRow(pixelBuffer), colorSpace,
+      kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little);
+  if (context) {
+    CGContextDrawImage(context, CGRectMake(0, 0, width, height), image);
+    CGContextRelease(context);
+  }
+  CGColorSpaceRelease(colorSpace);
+  CVPixelBufferUnlockBaseAddress(pixelBuffer, 0);
+
+  if (!context) {
+    CVPixelBufferRelease(pixelBuffer);
+    return NULL;
+  }
+  return pixelBuffer;
+}
+
+/**
+ * The object registered with the FlutterTextureRegistry on behalf of an FWFWebViewTexture.
+ *
+ * The registry keeps a strong reference to registered textures, so registering the
+ * FWFWebViewTexture directly would keep it alive after Dart disposes of it.
+ */
+@interface FWFWebViewTextureProxy : NSObject <FlutterTexture>
+@property(nonatomic, weak) FWFWebViewTexture *texture;
+@end
+
+@implementation FWFWebViewTextureProxy
+- (CVPixelBufferRef _Nullable)copyPixelBuffer {
+  return [self.texture copyPixelBuffer];
+}
+@end
+
+@interface FWFWebViewTexture ()
+// TextureRegistry must be weak to prevent a circular reference with the texture it registers.
+@property(nonatomic, weak) NSObject<FlutterTextureRegistry> *textureRegistry;
+@property(nonatomic) BOOL addedWebViewToWindow;
+@end
+
+@implementation FWFWebViewTexture {
+  // Accessed from the raster thread in copyPixelBuffer, so it is guarded by @synchronized(self).
+  CVPixelBufferRef _pixelBuffer;
+}
+
+- (instancetype)initWithWebView:(WKWebView *)webView
+                textureRegistry:(NSObject<FlutterTextureRegistry> *)textureRegistry {
+  self = [self init];
+  if (self) {
+    _webView = webView;
+    _textureRegistry = textureRegistry;
+
+    FWFWebViewTextureProxy *proxy = [[FWFWebViewTextureProxy alloc] init];
+    proxy.texture = self;
+    _textureId = [textureRegistry registerTexture:proxy];
+
+    [webView addObserver:self
+              forKeyPath:@"loading"
+                 options:NSKeyValueObservingOptionNew
+                 context:FWFWebViewTextureLoadingContext];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [_webView removeObserver:self
+                forKeyPath:@"loading"
+                   context:FWFWebViewTextureLoadingContext];
+  [_textureRegistry unregisterTexture:_textureId];
+  if (_addedWebViewToWindow) {
+    [_webView removeFromSuperview];
+  }
+  CVPixelBufferRelease(_pixelBuffer);
+}
+
+- (CVPixelBufferRef _Nullable)copyPixelBuffer {
+  @synchronized(self) {
+    return _pixelBuffer ? CVPixelBufferRetain(_pixelBuffer) : NULL;
+  }
+}
+
+- (void)setSize:(CGSize)size {
+  if (CGSizeEqualToSize(self.webView.frame.size, size)) {
+    return;
+  }
+
+  CGRect frame = self.webView.frame;
+  frame.size = size;
+  self.webView.frame = frame;
+  [self updateWithCompletion:^(NSError *error){
+  }];
+}
+
+- (void)updateWithCompletion:(void (^)(NSError *_Nullable error))completion {
+  [self attachWebViewToWindowIfNeeded];
+
+  __weak FWFWebViewTexture *weakSelf = self;
+  [self.webView
+      takeSnapshotWithConfiguration:[[WKSnapshotConfiguration alloc] init]
+                  completionHandler:^(UIImage *_Nullable snapshot, NSError *_Nullable error) {
+                    FWFWebViewTexture *strongSelf = weakSelf;
+                    if (strongSelf && snapshot.CGImage) {
+                      [strongSelf setPixelBufferFromImage:snapshot.CGImage];
+                    }
+                    completion(error);
+                  }];
+}
+
+- (void)setPixelBufferFromImage:(CGImageRef)image {
+  CVPixelBufferRef pixelBuffer = FWFCreatePixelBufferFromImage(image);
+  if (!pixelBuffer) {
+    return;
+  }
+
+  @synchronized(self) {
+    CVPixelBufferRelease(_pixelBuffer);
+    _pixelBuffer = pixelBuffer;
+  }
+  [self.textureRegistry textureFrameAvailable:self.textureId];
+}
+
+// WebKit does not render web views outside of a window, so a web view that is only displayed
+// through this texture is placed behind the content of the application's window.
+- (void)attachWebViewToWindowIfNeeded {
+  if (self.webView.window) {
+    return;
+  }
+
+  id<UIApplicationDelegate> delegate = UIApplication.sharedApplication.delegate;
+  if (![delegate respondsToSelector:@selector(window)] || !delegate.window) {
+    return;
+  }
+
+  self.webView.userInteractionEnabled = NO;
+  [delegate.window insertSubview:self.webView atIndex:0];
+  self.addedWebViewToWindow = YES;
+}
+
+- (void)observeValueForKeyPath:(NSString *)keyPath
+                      ofObject:(id)object
+                        change:(NSDictionary<NSKeyValueChangeKey, id> *)change
+                       context:(void *)context {
+  if (context != FWFWebViewTextureLoadingContext) {
+    [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+    return;
+  }
+
+  if (!self.webView.loading) {
+    [self updateWithCompletion:^(NSError *error){
+    }];
+  }
+}
+@end
+
+@interface FWFWebViewTextureHostApiImpl ()
+// TextureRegistry must be weak to prevent a circular reference with the textures it registers.
+@property(nonatomic, weak) NSObject<FlutterTextureRegistry> *textureRegistry;
+// InstanceManager must be weak to prevent a circular reference with the object it stores.
+@property(nonatomic, weak) FWFInstanceManager *instanceManager;
+@end
+
+@implementation FWFWebViewTextureHostApiImpl
+- (instancetype)initWithTextureRegistry:(NSObject<FlutterTextureRegistry> *)textureRegistry
+                        instanceManager:(FWFInstanceManager *)instanceManager {
+  self = [self init];
+  if (self) {
+    _textureRegistry = textureRegistry;
+    _instanceManager = instanceManager;
+  }
+  return self;
+}
+
+- (FWFWebViewTexture *)textureForIdentifier:(NSInteger)identifier {
+  return (FWFWebViewTexture *)[self.instanceManager instanceForIdentifier:identifier];
+}
+
+- (void)createWithIdentifier:(NSInteger)identifier
+           webViewIdentifier:(NSInteger)webViewIdentifier
+                       error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  WKWebView *webView = (WKWebView *)[self.instanceManager instanceForIdentifier:webViewIdentifier];
+  FWFWebViewTexture *texture = [[FWFWebViewTexture alloc] initWithWebView:webView
+                                                          textureRegistry:self.textureRegistry];
+  [self.instanceManager addDartCreatedInstance:texture withIdentifier:identifier];
+}
+
+- (nullable NSNumber *)
+    textureIdForTextureWithIdentifier:(NSInteger)identifier
+                                error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  return @([self textureForIdentifier:identifier].textureId);
+}
+
+- (void)setSizeForTextureWithIdentifier:(NSInteger)identifier
+                                  width:(double)width
+                                 height:(double)height
+                                  error:(FlutterError *_Nullable __autoreleasing *_Nonnull)error {
+  [[self textureForIdentifier:identifier] setSize:CGSizeMake(width, height)];
+}
+
+- (void)updateTextureWithIdentifier:(NSInteger)identifier
+                         completion:(nonnull void (^)(FlutterError *_Nullable))completion {
+  [[self textureForIdentifier:identifier] updateWithCompletion:^(NSError *error) {
+    if (error) {
+      completion([FlutterError errorWithCode:@"FWFSnapshotError"
+                                     message:@"Failed taking a snapshot of the web view."
+                                     details:FWFNSErrorDataFromNativeNSError(error)]);
+    } else {
+      completion(nil);
+    }
+  }];
+}
+@end
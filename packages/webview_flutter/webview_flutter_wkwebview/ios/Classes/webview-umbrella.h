@@ -5,6 +5,7 @@
 #import <Foundation/Foundation.h>
 
 #import "FLTWebViewFlutterPlugin.h"
+#import "FWFContentRuleListStoreHostApi.h"
 #import "FWFDataConverters.h"
 #import "FWFGeneratedWebKitApis.h"
 #import "FWFHTTPCookieStoreHostApi.h"
@@ -13,12 +14,16 @@
 #import "FWFObjectHostApi.h"
 #import "FWFPreferencesHostApi.h"
 #import "FWFScriptMessageHandlerHostApi.h"
+#import "FWFScrollViewDelegateHostApi.h"
 #import "FWFScrollViewHostApi.h"
 #import "FWFUIDelegateHostApi.h"
 #import "FWFUIViewHostApi.h"
 #import "FWFURLHostApi.h"
+#import "FWFURLSchemeHandlerHostApi.h"
 #import "FWFUserContentControllerHostApi.h"
 #import "FWFWebViewConfigurationHostApi.h"
 #import "FWFWebViewFlutterWKWebViewExternalAPI.h"
 #import "FWFWebViewHostApi.h"
+#import "FWFWebViewPool.h"
+#import "FWFWebViewTextureHostApi.h"
 #import "FWFWebsiteDataStoreHostApi.h"
@@ -653,6 +653,49 @@ class NSHttpCookieData {
   }
 }
 
+/// A rule that decides the policy of matching navigation actions without
+/// calling `WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction`.
+///
+/// A rule matches a URL when each of its non-null fields match.
+class WKNavigationPolicyRuleData {
+  WKNavigationPolicyRuleData({
+    this.host,
+    this.scheme,
+    this.urlPattern,
+    required this.policy,
+  });
+
+  /// The host the URL must have, or one of its subdomains.
+  String? host;
+
+  /// The scheme the URL must have.
+  String? scheme;
+
+  /// A regular expression that must match a part of the URL.
+  String? urlPattern;
+
+  WKNavigationActionPolicyEnum policy;
+
+  Object encode() {
+    return <Object?>[
+      host,
+      scheme,
+      urlPattern,
+      policy.index,
+    ];
+  }
+
+  static WKNavigationPolicyRuleData decode(Object result) {
+    result as List<Object?>;
+    return WKNavigationPolicyRuleData(
+      host: result[0] as String?,
+      scheme: result[1] as String?,
+      urlPattern: result[2] as String?,
+      policy: WKNavigationActionPolicyEnum.values[result[3]! as int],
+    );
+  }
+}
+
 /// An object that can represent either a value supported by
 /// `StandardMessageCodec`, a data class in this pigeon file, or an identifier
 /// of an object stored in an `InstanceManager`.
@@ -975,6 +1018,121 @@ class UIScrollViewHostApi {
       return;
     }
   }
+
+  Future<void> setDelegate(
+      int arg_identifier, int? arg_uiScrollViewDelegateIdentifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewHostApi.setDelegate',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_identifier, arg_uiScrollViewDelegateIdentifier])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+}
+
+/// Mirror of UIScrollViewDelegate.
+///
+/// See https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc.
+class UIScrollViewDelegateHostApi {
+  /// Constructor for [UIScrollViewDelegateHostApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  UIScrollViewDelegateHostApi({BinaryMessenger? binaryMessenger})
+      : _binaryMessenger = binaryMessenger;
+  final BinaryMessenger? _binaryMessenger;
+
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  Future<void> create(int arg_identifier, double arg_maximumFrequency,
+      double arg_minimumDelta) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateHostApi.create',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(
+            <Object?>[arg_identifier, arg_maximumFrequency, arg_minimumDelta])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+}
+
+/// Handles callbacks from a UIScrollViewDelegate instance.
+///
+/// See https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc.
+abstract class UIScrollViewDelegateFlutterApi {
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  void scrollViewDidScroll(
+      int identifier, int uiScrollViewIdentifier, double x, double y);
+
+  static void setup(UIScrollViewDelegateFlutterApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateFlutterApi.scrollViewDidScroll',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateFlutterApi.scrollViewDidScroll was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateFlutterApi.scrollViewDidScroll was null, expected non-null int.');
+          final int? arg_uiScrollViewIdentifier = (args[1] as int?);
+          assert(arg_uiScrollViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateFlutterApi.scrollViewDidScroll was null, expected non-null int.');
+          final double? arg_x = (args[2] as double?);
+          assert(arg_x != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateFlutterApi.scrollViewDidScroll was null, expected non-null double.');
+          final double? arg_y = (args[3] as double?);
+          assert(arg_y != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateFlutterApi.scrollViewDidScroll was null, expected non-null double.');
+          try {
+            api.scrollViewDidScroll(arg_identifier!,
+                arg_uiScrollViewIdentifier!, arg_x!, arg_y!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
 }
 
 class _WKWebViewConfigurationHostApiCodec extends StandardMessageCodec {
@@ -1133,6 +1291,54 @@ class WKWebViewConfigurationHostApi {
       return;
     }
   }
+
+  Future<void> useSharedProcessPool(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.useSharedProcessPool',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setURLSchemeHandler(
+      int arg_identifier, int arg_handlerIdentifier, String arg_scheme) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.setURLSchemeHandler',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_identifier, arg_handlerIdentifier, arg_scheme])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
 }
 
 /// Handles callbacks from a WKWebViewConfiguration instance.
@@ -1360,30 +1566,18 @@ class WKUserContentControllerHostApi {
       return;
     }
   }
-}
-
-/// Mirror of WKUserPreferences.
-///
-/// See https://developer.apple.com/documentation/webkit/wkpreferences?language=objc.
-class WKPreferencesHostApi {
-  /// Constructor for [WKPreferencesHostApi].  The [binaryMessenger] named argument is
-  /// available for dependency injection.  If it is left null, the default
-  /// BinaryMessenger will be used which routes to the host platform.
-  WKPreferencesHostApi({BinaryMessenger? binaryMessenger})
-      : _binaryMessenger = binaryMessenger;
-  final BinaryMessenger? _binaryMessenger;
-
-  static const MessageCodec<Object?> codec = StandardMessageCodec();
 
-  Future<void> createFromWebViewConfiguration(
-      int arg_identifier, int arg_configurationIdentifier) async {
+  Future<void> addContentRuleList(int arg_identifier, int arg_storeIdentifier,
+      String arg_ruleListIdentifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.addContentRuleList',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList = await channel
-            .send(<Object?>[arg_identifier, arg_configurationIdentifier])
-        as List<Object?>?;
+    final List<Object?>? replyList = await channel.send(<Object?>[
+      arg_identifier,
+      arg_storeIdentifier,
+      arg_ruleListIdentifier
+    ]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -1400,14 +1594,13 @@ class WKPreferencesHostApi {
     }
   }
 
-  Future<void> setJavaScriptEnabled(
-      int arg_identifier, bool arg_enabled) async {
+  Future<void> removeAllContentRuleLists(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.removeAllContentRuleLists',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList = await channel
-        .send(<Object?>[arg_identifier, arg_enabled]) as List<Object?>?;
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -1425,22 +1618,22 @@ class WKPreferencesHostApi {
   }
 }
 
-/// Mirror of WKScriptMessageHandler.
+/// Mirror of WKContentRuleListStore.
 ///
-/// See https://developer.apple.com/documentation/webkit/wkscriptmessagehandler?language=objc.
-class WKScriptMessageHandlerHostApi {
-  /// Constructor for [WKScriptMessageHandlerHostApi].  The [binaryMessenger] named argument is
+/// See https://developer.apple.com/documentation/webkit/wkcontentruleliststore?language=objc.
+class WKContentRuleListStoreHostApi {
+  /// Constructor for [WKContentRuleListStoreHostApi].  The [binaryMessenger] named argument is
   /// available for dependency injection.  If it is left null, the default
   /// BinaryMessenger will be used which routes to the host platform.
-  WKScriptMessageHandlerHostApi({BinaryMessenger? binaryMessenger})
+  WKContentRuleListStoreHostApi({BinaryMessenger? binaryMessenger})
       : _binaryMessenger = binaryMessenger;
   final BinaryMessenger? _binaryMessenger;
 
   static const MessageCodec<Object?> codec = StandardMessageCodec();
 
-  Future<void> create(int arg_identifier) async {
+  Future<void> createDefaultStore(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.createDefaultStore',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
@@ -1460,89 +1653,161 @@ class WKScriptMessageHandlerHostApi {
       return;
     }
   }
-}
 
-class _WKScriptMessageHandlerFlutterApiCodec extends StandardMessageCodec {
-  const _WKScriptMessageHandlerFlutterApiCodec();
-  @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is WKScriptMessageData) {
-      buffer.putUint8(128);
-      writeValue(buffer, value.encode());
+  Future<void> compileContentRuleList(int arg_identifier,
+      String arg_ruleListIdentifier, String arg_encodedContentRuleList) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.compileContentRuleList',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(<Object?>[
+      arg_identifier,
+      arg_ruleListIdentifier,
+      arg_encodedContentRuleList
+    ]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
     } else {
-      super.writeValue(buffer, value);
+      return;
     }
   }
 
-  @override
-  Object? readValueOfType(int type, ReadBuffer buffer) {
-    switch (type) {
-      case 128:
-        return WKScriptMessageData.decode(readValue(buffer)!);
-      default:
-        return super.readValueOfType(type, buffer);
+  Future<bool> containsContentRuleList(
+      int arg_identifier, String arg_ruleListIdentifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.containsContentRuleList',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier, arg_ruleListIdentifier])
+            as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as bool?)!;
     }
   }
-}
-
-/// Handles callbacks from a WKScriptMessageHandler instance.
-///
-/// See https://developer.apple.com/documentation/webkit/wkscriptmessagehandler?language=objc.
-abstract class WKScriptMessageHandlerFlutterApi {
-  static const MessageCodec<Object?> codec =
-      _WKScriptMessageHandlerFlutterApiCodec();
 
-  void didReceiveScriptMessage(int identifier,
-      int userContentControllerIdentifier, WKScriptMessageData message);
-
-  static void setup(WKScriptMessageHandlerFlutterApi? api,
-      {BinaryMessenger? binaryMessenger}) {
-    {
-      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage',
-          codec,
-          binaryMessenger: binaryMessenger);
-      if (api == null) {
-        channel.setMessageHandler(null);
-      } else {
-        channel.setMessageHandler((Object? message) async {
-          assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null.');
-          final List<Object?> args = (message as List<Object?>?)!;
-          final int? arg_identifier = (args[0] as int?);
-          assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null, expected non-null int.');
-          final int? arg_userContentControllerIdentifier = (args[1] as int?);
-          assert(arg_userContentControllerIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null, expected non-null int.');
-          final WKScriptMessageData? arg_message =
-              (args[2] as WKScriptMessageData?);
-          assert(arg_message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null, expected non-null WKScriptMessageData.');
-          try {
-            api.didReceiveScriptMessage(arg_identifier!,
-                arg_userContentControllerIdentifier!, arg_message!);
-            return wrapResponse(empty: true);
-          } on PlatformException catch (e) {
-            return wrapResponse(error: e);
-          } catch (e) {
-            return wrapResponse(
-                error: PlatformException(code: 'error', message: e.toString()));
-          }
-        });
-      }
+  Future<void> removeContentRuleList(
+      int arg_identifier, String arg_ruleListIdentifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.removeContentRuleList',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier, arg_ruleListIdentifier])
+            as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
     }
   }
 }
 
-/// Mirror of WKNavigationDelegate.
+/// Mirror of WKUserPreferences.
 ///
-/// See https://developer.apple.com/documentation/webkit/wknavigationdelegate?language=objc.
-class WKNavigationDelegateHostApi {
-  /// Constructor for [WKNavigationDelegateHostApi].  The [binaryMessenger] named argument is
+/// See https://developer.apple.com/documentation/webkit/wkpreferences?language=objc.
+class WKPreferencesHostApi {
+  /// Constructor for [WKPreferencesHostApi].  The [binaryMessenger] named argument is
   /// available for dependency injection.  If it is left null, the default
   /// BinaryMessenger will be used which routes to the host platform.
-  WKNavigationDelegateHostApi({BinaryMessenger? binaryMessenger})
+  WKPreferencesHostApi({BinaryMessenger? binaryMessenger})
+      : _binaryMessenger = binaryMessenger;
+  final BinaryMessenger? _binaryMessenger;
+
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  Future<void> createFromWebViewConfiguration(
+      int arg_identifier, int arg_configurationIdentifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_identifier, arg_configurationIdentifier])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setJavaScriptEnabled(
+      int arg_identifier, bool arg_enabled) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_identifier, arg_enabled]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+}
+
+/// Mirror of WKScriptMessageHandler.
+///
+/// See https://developer.apple.com/documentation/webkit/wkscriptmessagehandler?language=objc.
+class WKScriptMessageHandlerHostApi {
+  /// Constructor for [WKScriptMessageHandlerHostApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  WKScriptMessageHandlerHostApi({BinaryMessenger? binaryMessenger})
       : _binaryMessenger = binaryMessenger;
   final BinaryMessenger? _binaryMessenger;
 
@@ -1550,7 +1815,7 @@ class WKNavigationDelegateHostApi {
 
   Future<void> create(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
@@ -1570,27 +1835,39 @@ class WKNavigationDelegateHostApi {
       return;
     }
   }
+
+  Future<void> setMessageBatching(
+      int arg_identifier, int? arg_maxBatchSize) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.setMessageBatching',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_identifier, arg_maxBatchSize]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
 }
 
-class _WKNavigationDelegateFlutterApiCodec extends StandardMessageCodec {
-  const _WKNavigationDelegateFlutterApiCodec();
+class _WKScriptMessageHandlerFlutterApiCodec extends StandardMessageCodec {
+  const _WKScriptMessageHandlerFlutterApiCodec();
   @override
   void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSErrorData) {
+    if (value is WKScriptMessageData) {
       buffer.putUint8(128);
       writeValue(buffer, value.encode());
-    } else if (value is NSUrlRequestData) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.encode());
-    } else if (value is WKFrameInfoData) {
-      buffer.putUint8(130);
-      writeValue(buffer, value.encode());
-    } else if (value is WKNavigationActionData) {
-      buffer.putUint8(131);
-      writeValue(buffer, value.encode());
-    } else if (value is WKNavigationActionPolicyEnumData) {
-      buffer.putUint8(132);
-      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -1600,52 +1877,31 @@ class _WKNavigationDelegateFlutterApiCodec extends StandardMessageCodec {
   Object? readValueOfType(int type, ReadBuffer buffer) {
     switch (type) {
       case 128:
-        return NSErrorData.decode(readValue(buffer)!);
-      case 129:
-        return NSUrlRequestData.decode(readValue(buffer)!);
-      case 130:
-        return WKFrameInfoData.decode(readValue(buffer)!);
-      case 131:
-        return WKNavigationActionData.decode(readValue(buffer)!);
-      case 132:
-        return WKNavigationActionPolicyEnumData.decode(readValue(buffer)!);
+        return WKScriptMessageData.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
   }
 }
 
-/// Handles callbacks from a WKNavigationDelegate instance.
+/// Handles callbacks from a WKScriptMessageHandler instance.
 ///
-/// See https://developer.apple.com/documentation/webkit/wknavigationdelegate?language=objc.
-abstract class WKNavigationDelegateFlutterApi {
+/// See https://developer.apple.com/documentation/webkit/wkscriptmessagehandler?language=objc.
+abstract class WKScriptMessageHandlerFlutterApi {
   static const MessageCodec<Object?> codec =
-      _WKNavigationDelegateFlutterApiCodec();
-
-  void didFinishNavigation(int identifier, int webViewIdentifier, String? url);
-
-  void didStartProvisionalNavigation(
-      int identifier, int webViewIdentifier, String? url);
-
-  Future<WKNavigationActionPolicyEnumData> decidePolicyForNavigationAction(
-      int identifier,
-      int webViewIdentifier,
-      WKNavigationActionData navigationAction);
-
-  void didFailNavigation(
-      int identifier, int webViewIdentifier, NSErrorData error);
+      _WKScriptMessageHandlerFlutterApiCodec();
 
-  void didFailProvisionalNavigation(
-      int identifier, int webViewIdentifier, NSErrorData error);
+  void didReceiveScriptMessage(int identifier,
+      int userContentControllerIdentifier, WKScriptMessageData message);
 
-  void webViewWebContentProcessDidTerminate(
-      int identifier, int webViewIdentifier);
+  void didReceiveScriptMessages(int identifier,
+      int userContentControllerIdentifier, List<WKScriptMessageData?> messages);
 
-  static void setup(WKNavigationDelegateFlutterApi? api,
+  static void setup(WKScriptMessageHandlerFlutterApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1653,18 +1909,21 @@ abstract class WKNavigationDelegateFlutterApi {
       } else {
         channel.setMessageHandler((Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation was null, expected non-null int.');
-          final String? arg_url = (args[2] as String?);
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null, expected non-null int.');
+          final int? arg_userContentControllerIdentifier = (args[1] as int?);
+          assert(arg_userContentControllerIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null, expected non-null int.');
+          final WKScriptMessageData? arg_message =
+              (args[2] as WKScriptMessageData?);
+          assert(arg_message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessage was null, expected non-null WKScriptMessageData.');
           try {
-            api.didFinishNavigation(
-                arg_identifier!, arg_webViewIdentifier!, arg_url);
+            api.didReceiveScriptMessage(arg_identifier!,
+                arg_userContentControllerIdentifier!, arg_message!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1677,7 +1936,7 @@ abstract class WKNavigationDelegateFlutterApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessages',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1685,153 +1944,21 @@ abstract class WKNavigationDelegateFlutterApi {
       } else {
         channel.setMessageHandler((Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessages was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation was null, expected non-null int.');
-          final String? arg_url = (args[2] as String?);
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessages was null, expected non-null int.');
+          final int? arg_userContentControllerIdentifier = (args[1] as int?);
+          assert(arg_userContentControllerIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessages was null, expected non-null int.');
+          final List<WKScriptMessageData?>? arg_messages =
+              (args[2] as List<Object?>?)?.cast<WKScriptMessageData?>();
+          assert(arg_messages != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerFlutterApi.didReceiveScriptMessages was null, expected non-null List<WKScriptMessageData?>.');
           try {
-            api.didStartProvisionalNavigation(
-                arg_identifier!, arg_webViewIdentifier!, arg_url);
-            return wrapResponse(empty: true);
-          } on PlatformException catch (e) {
-            return wrapResponse(error: e);
-          } catch (e) {
-            return wrapResponse(
-                error: PlatformException(code: 'error', message: e.toString()));
-          }
-        });
-      }
-    }
-    {
-      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction',
-          codec,
-          binaryMessenger: binaryMessenger);
-      if (api == null) {
-        channel.setMessageHandler(null);
-      } else {
-        channel.setMessageHandler((Object? message) async {
-          assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null.');
-          final List<Object?> args = (message as List<Object?>?)!;
-          final int? arg_identifier = (args[0] as int?);
-          assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null, expected non-null int.');
-          final WKNavigationActionData? arg_navigationAction =
-              (args[2] as WKNavigationActionData?);
-          assert(arg_navigationAction != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null, expected non-null WKNavigationActionData.');
-          try {
-            final WKNavigationActionPolicyEnumData output =
-                await api.decidePolicyForNavigationAction(arg_identifier!,
-                    arg_webViewIdentifier!, arg_navigationAction!);
-            return wrapResponse(result: output);
-          } on PlatformException catch (e) {
-            return wrapResponse(error: e);
-          } catch (e) {
-            return wrapResponse(
-                error: PlatformException(code: 'error', message: e.toString()));
-          }
-        });
-      }
-    }
-    {
-      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation',
-          codec,
-          binaryMessenger: binaryMessenger);
-      if (api == null) {
-        channel.setMessageHandler(null);
-      } else {
-        channel.setMessageHandler((Object? message) async {
-          assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null.');
-          final List<Object?> args = (message as List<Object?>?)!;
-          final int? arg_identifier = (args[0] as int?);
-          assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null, expected non-null int.');
-          final NSErrorData? arg_error = (args[2] as NSErrorData?);
-          assert(arg_error != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null, expected non-null NSErrorData.');
-          try {
-            api.didFailNavigation(
-                arg_identifier!, arg_webViewIdentifier!, arg_error!);
-            return wrapResponse(empty: true);
-          } on PlatformException catch (e) {
-            return wrapResponse(error: e);
-          } catch (e) {
-            return wrapResponse(
-                error: PlatformException(code: 'error', message: e.toString()));
-          }
-        });
-      }
-    }
-    {
-      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation',
-          codec,
-          binaryMessenger: binaryMessenger);
-      if (api == null) {
-        channel.setMessageHandler(null);
-      } else {
-        channel.setMessageHandler((Object? message) async {
-          assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null.');
-          final List<Object?> args = (message as List<Object?>?)!;
-          final int? arg_identifier = (args[0] as int?);
-          assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null, expected non-null int.');
-          final NSErrorData? arg_error = (args[2] as NSErrorData?);
-          assert(arg_error != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null, expected non-null NSErrorData.');
-          try {
-            api.didFailProvisionalNavigation(
-                arg_identifier!, arg_webViewIdentifier!, arg_error!);
-            return wrapResponse(empty: true);
-          } on PlatformException catch (e) {
-            return wrapResponse(error: e);
-          } catch (e) {
-            return wrapResponse(
-                error: PlatformException(code: 'error', message: e.toString()));
-          }
-        });
-      }
-    }
-    {
-      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate',
-          codec,
-          binaryMessenger: binaryMessenger);
-      if (api == null) {
-        channel.setMessageHandler(null);
-      } else {
-        channel.setMessageHandler((Object? message) async {
-          assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate was null.');
-          final List<Object?> args = (message as List<Object?>?)!;
-          final int? arg_identifier = (args[0] as int?);
-          assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate was null, expected non-null int.');
-          try {
-            api.webViewWebContentProcessDidTerminate(
-                arg_identifier!, arg_webViewIdentifier!);
+            api.didReceiveScriptMessages(arg_identifier!,
+                arg_userContentControllerIdentifier!, arg_messages!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1845,11 +1972,11 @@ abstract class WKNavigationDelegateFlutterApi {
   }
 }
 
-class _NSObjectHostApiCodec extends StandardMessageCodec {
-  const _NSObjectHostApiCodec();
+class _WKNavigationDelegateHostApiCodec extends StandardMessageCodec {
+  const _WKNavigationDelegateHostApiCodec();
   @override
   void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSKeyValueObservingOptionsEnumData) {
+    if (value is WKNavigationPolicyRuleData) {
       buffer.putUint8(128);
       writeValue(buffer, value.encode());
     } else {
@@ -1861,29 +1988,30 @@ class _NSObjectHostApiCodec extends StandardMessageCodec {
   Object? readValueOfType(int type, ReadBuffer buffer) {
     switch (type) {
       case 128:
-        return NSKeyValueObservingOptionsEnumData.decode(readValue(buffer)!);
+        return WKNavigationPolicyRuleData.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
   }
 }
 
-/// Mirror of NSObject.
+/// Mirror of WKNavigationDelegate.
 ///
-/// See https://developer.apple.com/documentation/objectivec/nsobject.
-class NSObjectHostApi {
-  /// Constructor for [NSObjectHostApi].  The [binaryMessenger] named argument is
+/// See https://developer.apple.com/documentation/webkit/wknavigationdelegate?language=objc.
+class WKNavigationDelegateHostApi {
+  /// Constructor for [WKNavigationDelegateHostApi].  The [binaryMessenger] named argument is
   /// available for dependency injection.  If it is left null, the default
   /// BinaryMessenger will be used which routes to the host platform.
-  NSObjectHostApi({BinaryMessenger? binaryMessenger})
+  WKNavigationDelegateHostApi({BinaryMessenger? binaryMessenger})
       : _binaryMessenger = binaryMessenger;
   final BinaryMessenger? _binaryMessenger;
 
-  static const MessageCodec<Object?> codec = _NSObjectHostApiCodec();
+  static const MessageCodec<Object?> codec =
+      _WKNavigationDelegateHostApiCodec();
 
-  Future<void> dispose(int arg_identifier) async {
+  Future<void> create(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
@@ -1904,20 +2032,18 @@ class NSObjectHostApi {
     }
   }
 
-  Future<void> addObserver(
+  Future<void> setNavigationPolicyRules(
       int arg_identifier,
-      int arg_observerIdentifier,
-      String arg_keyPath,
-      List<NSKeyValueObservingOptionsEnumData?> arg_options) async {
+      List<WKNavigationPolicyRuleData?> arg_rules,
+      bool arg_forwardsOnlyMainFrameNavigations) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setNavigationPolicyRules',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList = await channel.send(<Object?>[
       arg_identifier,
-      arg_observerIdentifier,
-      arg_keyPath,
-      arg_options
+      arg_rules,
+      arg_forwardsOnlyMainFrameNavigations
     ]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
@@ -1935,14 +2061,14 @@ class NSObjectHostApi {
     }
   }
 
-  Future<void> removeObserver(int arg_identifier, int arg_observerIdentifier,
-      String arg_keyPath) async {
+  Future<void> setIncludesRequestDetails(
+      int arg_identifier, bool arg_includesRequestDetails) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setIncludesRequestDetails',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList = await channel.send(
-            <Object?>[arg_identifier, arg_observerIdentifier, arg_keyPath])
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_identifier, arg_includesRequestDetails])
         as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
@@ -1961,16 +2087,25 @@ class NSObjectHostApi {
   }
 }
 
-class _NSObjectFlutterApiCodec extends StandardMessageCodec {
-  const _NSObjectFlutterApiCodec();
+class _WKNavigationDelegateFlutterApiCodec extends StandardMessageCodec {
+  const _WKNavigationDelegateFlutterApiCodec();
   @override
   void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSKeyValueChangeKeyEnumData) {
+    if (value is NSErrorData) {
       buffer.putUint8(128);
       writeValue(buffer, value.encode());
-    } else if (value is ObjectOrIdentifier) {
+    } else if (value is NSUrlRequestData) {
       buffer.putUint8(129);
       writeValue(buffer, value.encode());
+    } else if (value is WKFrameInfoData) {
+      buffer.putUint8(130);
+      writeValue(buffer, value.encode());
+    } else if (value is WKNavigationActionData) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    } else if (value is WKNavigationActionPolicyEnumData) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -1980,35 +2115,52 @@ class _NSObjectFlutterApiCodec extends StandardMessageCodec {
   Object? readValueOfType(int type, ReadBuffer buffer) {
     switch (type) {
       case 128:
-        return NSKeyValueChangeKeyEnumData.decode(readValue(buffer)!);
+        return NSErrorData.decode(readValue(buffer)!);
       case 129:
-        return ObjectOrIdentifier.decode(readValue(buffer)!);
+        return NSUrlRequestData.decode(readValue(buffer)!);
+      case 130:
+        return WKFrameInfoData.decode(readValue(buffer)!);
+      case 131:
+        return WKNavigationActionData.decode(readValue(buffer)!);
+      case 132:
+        return WKNavigationActionPolicyEnumData.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
   }
 }
 
-/// Handles callbacks from an NSObject instance.
+/// Handles callbacks from a WKNavigationDelegate instance.
 ///
-/// See https://developer.apple.com/documentation/objectivec/nsobject.
-abstract class NSObjectFlutterApi {
-  static const MessageCodec<Object?> codec = _NSObjectFlutterApiCodec();
+/// See https://developer.apple.com/documentation/webkit/wknavigationdelegate?language=objc.
+abstract class WKNavigationDelegateFlutterApi {
+  static const MessageCodec<Object?> codec =
+      _WKNavigationDelegateFlutterApiCodec();
 
-  void observeValue(
+  void didFinishNavigation(int identifier, int webViewIdentifier, String? url);
+
+  void didStartProvisionalNavigation(
+      int identifier, int webViewIdentifier, String? url);
+
+  Future<WKNavigationActionPolicyEnumData> decidePolicyForNavigationAction(
       int identifier,
-      String keyPath,
-      int objectIdentifier,
-      List<NSKeyValueChangeKeyEnumData?> changeKeys,
-      List<ObjectOrIdentifier?> changeValues);
+      int webViewIdentifier,
+      WKNavigationActionData navigationAction);
 
-  void dispose(int identifier);
+  void didFailNavigation(
+      int identifier, int webViewIdentifier, NSErrorData error);
 
-  static void setup(NSObjectFlutterApi? api,
+  void didFailProvisionalNavigation(
+      int identifier, int webViewIdentifier, NSErrorData error);
+
+  void webViewWebContentProcessDidTerminate(
+      int identifier, int webViewIdentifier);
+
+  static void setup(WKNavigationDelegateFlutterApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -2016,28 +2168,18 @@ abstract class NSObjectFlutterApi {
       } else {
         channel.setMessageHandler((Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null int.');
-          final String? arg_keyPath = (args[1] as String?);
-          assert(arg_keyPath != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null String.');
-          final int? arg_objectIdentifier = (args[2] as int?);
-          assert(arg_objectIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null int.');
-          final List<NSKeyValueChangeKeyEnumData?>? arg_changeKeys =
-              (args[3] as List<Object?>?)?.cast<NSKeyValueChangeKeyEnumData?>();
-          assert(arg_changeKeys != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null List<NSKeyValueChangeKeyEnumData?>.');
-          final List<ObjectOrIdentifier?>? arg_changeValues =
-              (args[4] as List<Object?>?)?.cast<ObjectOrIdentifier?>();
-          assert(arg_changeValues != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null List<ObjectOrIdentifier?>.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFinishNavigation was null, expected non-null int.');
+          final String? arg_url = (args[2] as String?);
           try {
-            api.observeValue(arg_identifier!, arg_keyPath!,
-                arg_objectIdentifier!, arg_changeKeys!, arg_changeValues!);
+            api.didFinishNavigation(
+                arg_identifier!, arg_webViewIdentifier!, arg_url);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -2050,7 +2192,7 @@ abstract class NSObjectFlutterApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.dispose',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -2058,13 +2200,18 @@ abstract class NSObjectFlutterApi {
       } else {
         channel.setMessageHandler((Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.dispose was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.dispose was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didStartProvisionalNavigation was null, expected non-null int.');
+          final String? arg_url = (args[2] as String?);
           try {
-            api.dispose(arg_identifier!);
+            api.didStartProvisionalNavigation(
+                arg_identifier!, arg_webViewIdentifier!, arg_url);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -2075,19 +2222,387 @@ abstract class NSObjectFlutterApi {
         });
       }
     }
-  }
-}
-
-class _WKWebViewHostApiCodec extends StandardMessageCodec {
-  const _WKWebViewHostApiCodec();
-  @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSErrorData) {
-      buffer.putUint8(128);
-      writeValue(buffer, value.encode());
-    } else if (value is NSHttpCookieData) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.encode());
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null, expected non-null int.');
+          final WKNavigationActionData? arg_navigationAction =
+              (args[2] as WKNavigationActionData?);
+          assert(arg_navigationAction != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction was null, expected non-null WKNavigationActionData.');
+          try {
+            final WKNavigationActionPolicyEnumData output =
+                await api.decidePolicyForNavigationAction(arg_identifier!,
+                    arg_webViewIdentifier!, arg_navigationAction!);
+            return wrapResponse(result: output);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null, expected non-null int.');
+          final NSErrorData? arg_error = (args[2] as NSErrorData?);
+          assert(arg_error != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailNavigation was null, expected non-null NSErrorData.');
+          try {
+            api.didFailNavigation(
+                arg_identifier!, arg_webViewIdentifier!, arg_error!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null, expected non-null int.');
+          final NSErrorData? arg_error = (args[2] as NSErrorData?);
+          assert(arg_error != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.didFailProvisionalNavigation was null, expected non-null NSErrorData.');
+          try {
+            api.didFailProvisionalNavigation(
+                arg_identifier!, arg_webViewIdentifier!, arg_error!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateFlutterApi.webViewWebContentProcessDidTerminate was null, expected non-null int.');
+          try {
+            api.webViewWebContentProcessDidTerminate(
+                arg_identifier!, arg_webViewIdentifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
+
+class _NSObjectHostApiCodec extends StandardMessageCodec {
+  const _NSObjectHostApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSKeyValueObservingOptionsEnumData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSKeyValueObservingOptionsEnumData.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Mirror of NSObject.
+///
+/// See https://developer.apple.com/documentation/objectivec/nsobject.
+class NSObjectHostApi {
+  /// Constructor for [NSObjectHostApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  NSObjectHostApi({BinaryMessenger? binaryMessenger})
+      : _binaryMessenger = binaryMessenger;
+  final BinaryMessenger? _binaryMessenger;
+
+  static const MessageCodec<Object?> codec = _NSObjectHostApiCodec();
+
+  Future<void> dispose(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> addObserver(
+      int arg_identifier,
+      int arg_observerIdentifier,
+      String arg_keyPath,
+      List<NSKeyValueObservingOptionsEnumData?> arg_options) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(<Object?>[
+      arg_identifier,
+      arg_observerIdentifier,
+      arg_keyPath,
+      arg_options
+    ]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> removeObserver(int arg_identifier, int arg_observerIdentifier,
+      String arg_keyPath) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(
+            <Object?>[arg_identifier, arg_observerIdentifier, arg_keyPath])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+}
+
+class _NSObjectFlutterApiCodec extends StandardMessageCodec {
+  const _NSObjectFlutterApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSKeyValueChangeKeyEnumData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else if (value is ObjectOrIdentifier) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSKeyValueChangeKeyEnumData.decode(readValue(buffer)!);
+      case 129:
+        return ObjectOrIdentifier.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Handles callbacks from an NSObject instance.
+///
+/// See https://developer.apple.com/documentation/objectivec/nsobject.
+abstract class NSObjectFlutterApi {
+  static const MessageCodec<Object?> codec = _NSObjectFlutterApiCodec();
+
+  void observeValue(
+      int identifier,
+      String keyPath,
+      int objectIdentifier,
+      List<NSKeyValueChangeKeyEnumData?> changeKeys,
+      List<ObjectOrIdentifier?> changeValues);
+
+  void dispose(int identifier);
+
+  static void setup(NSObjectFlutterApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null int.');
+          final String? arg_keyPath = (args[1] as String?);
+          assert(arg_keyPath != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null String.');
+          final int? arg_objectIdentifier = (args[2] as int?);
+          assert(arg_objectIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null int.');
+          final List<NSKeyValueChangeKeyEnumData?>? arg_changeKeys =
+              (args[3] as List<Object?>?)?.cast<NSKeyValueChangeKeyEnumData?>();
+          assert(arg_changeKeys != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null List<NSKeyValueChangeKeyEnumData?>.');
+          final List<ObjectOrIdentifier?>? arg_changeValues =
+              (args[4] as List<Object?>?)?.cast<ObjectOrIdentifier?>();
+          assert(arg_changeValues != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.observeValue was null, expected non-null List<ObjectOrIdentifier?>.');
+          try {
+            api.observeValue(arg_identifier!, arg_keyPath!,
+                arg_objectIdentifier!, arg_changeKeys!, arg_changeValues!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.dispose',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.dispose was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectFlutterApi.dispose was null, expected non-null int.');
+          try {
+            api.dispose(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
+
+class _WKWebViewHostApiCodec extends StandardMessageCodec {
+  const _WKWebViewHostApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSErrorData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else if (value is NSHttpCookieData) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
     } else if (value is NSHttpCookiePropertyKeyEnumData) {
       buffer.putUint8(130);
       writeValue(buffer, value.encode());
@@ -2418,17 +2933,240 @@ class WKWebViewHostApi {
         details: replyList[2],
       );
     } else {
-      return;
+      return;
+    }
+  }
+
+  Future<bool> canGoBack(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as bool?)!;
+    }
+  }
+
+  Future<bool> canGoForward(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as bool?)!;
+    }
+  }
+
+  Future<void> goBack(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> goForward(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> reload(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<String?> getTitle(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return (replyList[0] as String?);
+    }
+  }
+
+  Future<void> setAllowsBackForwardNavigationGestures(
+      int arg_identifier, bool arg_allow) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_identifier, arg_allow]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> setCustomUserAgent(
+      int arg_identifier, String? arg_userAgent) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_identifier, arg_userAgent]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<Object?> evaluateJavaScript(
+      int arg_identifier, String arg_javaScriptString) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier, arg_javaScriptString])
+            as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return replyList[0];
     }
   }
 
-  Future<bool> canGoBack(int arg_identifier) async {
+  Future<String?> evaluateJavaScriptAsJson(
+      int arg_identifier, String arg_javaScriptString) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScriptAsJson',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
-        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+        await channel.send(<Object?>[arg_identifier, arg_javaScriptString])
+            as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2440,23 +3178,20 @@ class WKWebViewHostApi {
         message: replyList[1] as String?,
         details: replyList[2],
       );
-    } else if (replyList[0] == null) {
-      throw PlatformException(
-        code: 'null-error',
-        message: 'Host platform returned null value for non-null return value.',
-      );
     } else {
-      return (replyList[0] as bool?)!;
+      return (replyList[0] as String?);
     }
   }
 
-  Future<bool> canGoForward(int arg_identifier) async {
+  Future<Object?> callAsyncJavaScript(int arg_identifier,
+      String arg_functionBody, Map<String?, Object?> arg_arguments) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.callAsyncJavaScript',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList =
-        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_identifier, arg_functionBody, arg_arguments])
+        as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2468,23 +3203,18 @@ class WKWebViewHostApi {
         message: replyList[1] as String?,
         details: replyList[2],
       );
-    } else if (replyList[0] == null) {
-      throw PlatformException(
-        code: 'null-error',
-        message: 'Host platform returned null value for non-null return value.',
-      );
     } else {
-      return (replyList[0] as bool?)!;
+      return replyList[0];
     }
   }
 
-  Future<void> goBack(int arg_identifier) async {
+  Future<void> setInspectable(int arg_identifier, bool arg_inspectable) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList =
-        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_identifier, arg_inspectable]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2501,9 +3231,9 @@ class WKWebViewHostApi {
     }
   }
 
-  Future<void> goForward(int arg_identifier) async {
+  Future<String?> getCustomUserAgent(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
@@ -2520,17 +3250,18 @@ class WKWebViewHostApi {
         details: replyList[2],
       );
     } else {
-      return;
+      return (replyList[0] as String?);
     }
   }
 
-  Future<void> reload(int arg_identifier) async {
+  Future<void> prewarm(int arg_configurationIdentifier, int arg_count) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.prewarm',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
-        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+        await channel.send(<Object?>[arg_configurationIdentifier, arg_count])
+            as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2547,13 +3278,15 @@ class WKWebViewHostApi {
     }
   }
 
-  Future<String?> getTitle(int arg_identifier) async {
+  Future<void> setSuspendsWhenOffscreen(int arg_identifier, bool arg_suspends,
+      double? arg_idleTimeoutSeconds) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setSuspendsWhenOffscreen',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList =
-        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    final List<Object?>? replyList = await channel.send(
+            <Object?>[arg_identifier, arg_suspends, arg_idleTimeoutSeconds])
+        as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2566,18 +3299,31 @@ class WKWebViewHostApi {
         details: replyList[2],
       );
     } else {
-      return (replyList[0] as String?);
+      return;
     }
   }
+}
 
-  Future<void> setAllowsBackForwardNavigationGestures(
-      int arg_identifier, bool arg_allow) async {
+/// Mirror of WKUIDelegate.
+///
+/// See https://developer.apple.com/documentation/webkit/wkuidelegate?language=objc.
+class WKUIDelegateHostApi {
+  /// Constructor for [WKUIDelegateHostApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  WKUIDelegateHostApi({BinaryMessenger? binaryMessenger})
+      : _binaryMessenger = binaryMessenger;
+  final BinaryMessenger? _binaryMessenger;
+
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  Future<void> create(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList = await channel
-        .send(<Object?>[arg_identifier, arg_allow]) as List<Object?>?;
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2593,15 +3339,209 @@ class WKWebViewHostApi {
       return;
     }
   }
+}
+
+class _WKUIDelegateFlutterApiCodec extends StandardMessageCodec {
+  const _WKUIDelegateFlutterApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSUrlRequestData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else if (value is WKFrameInfoData) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
+    } else if (value is WKMediaCaptureTypeData) {
+      buffer.putUint8(130);
+      writeValue(buffer, value.encode());
+    } else if (value is WKNavigationActionData) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    } else if (value is WKPermissionDecisionData) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
+    } else if (value is WKSecurityOriginData) {
+      buffer.putUint8(133);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSUrlRequestData.decode(readValue(buffer)!);
+      case 129:
+        return WKFrameInfoData.decode(readValue(buffer)!);
+      case 130:
+        return WKMediaCaptureTypeData.decode(readValue(buffer)!);
+      case 131:
+        return WKNavigationActionData.decode(readValue(buffer)!);
+      case 132:
+        return WKPermissionDecisionData.decode(readValue(buffer)!);
+      case 133:
+        return WKSecurityOriginData.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Handles callbacks from a WKUIDelegate instance.
+///
+/// See https://developer.apple.com/documentation/webkit/wkuidelegate?language=objc.
+abstract class WKUIDelegateFlutterApi {
+  static const MessageCodec<Object?> codec = _WKUIDelegateFlutterApiCodec();
+
+  void onCreateWebView(int identifier, int webViewIdentifier,
+      int configurationIdentifier, WKNavigationActionData navigationAction);
+
+  /// Callback to Dart function `WKUIDelegate.requestMediaCapturePermission`.
+  Future<WKPermissionDecisionData> requestMediaCapturePermission(
+      int identifier,
+      int webViewIdentifier,
+      WKSecurityOriginData origin,
+      WKFrameInfoData frame,
+      WKMediaCaptureTypeData type);
+
+  static void setup(WKUIDelegateFlutterApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null int.');
+          final int? arg_configurationIdentifier = (args[2] as int?);
+          assert(arg_configurationIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null int.');
+          final WKNavigationActionData? arg_navigationAction =
+              (args[3] as WKNavigationActionData?);
+          assert(arg_navigationAction != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null WKNavigationActionData.');
+          try {
+            api.onCreateWebView(arg_identifier!, arg_webViewIdentifier!,
+                arg_configurationIdentifier!, arg_navigationAction!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null int.');
+          final WKSecurityOriginData? arg_origin =
+              (args[2] as WKSecurityOriginData?);
+          assert(arg_origin != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null WKSecurityOriginData.');
+          final WKFrameInfoData? arg_frame = (args[3] as WKFrameInfoData?);
+          assert(arg_frame != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null WKFrameInfoData.');
+          final WKMediaCaptureTypeData? arg_type =
+              (args[4] as WKMediaCaptureTypeData?);
+          assert(arg_type != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null WKMediaCaptureTypeData.');
+          try {
+            final WKPermissionDecisionData output =
+                await api.requestMediaCapturePermission(arg_identifier!,
+                    arg_webViewIdentifier!, arg_origin!, arg_frame!, arg_type!);
+            return wrapResponse(result: output);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
+
+class _WKHttpCookieStoreHostApiCodec extends StandardMessageCodec {
+  const _WKHttpCookieStoreHostApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSHttpCookieData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else if (value is NSHttpCookiePropertyKeyEnumData) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSHttpCookieData.decode(readValue(buffer)!);
+      case 129:
+        return NSHttpCookiePropertyKeyEnumData.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
 
-  Future<void> setCustomUserAgent(
-      int arg_identifier, String? arg_userAgent) async {
+/// Mirror of WKHttpCookieStore.
+///
+/// See https://developer.apple.com/documentation/webkit/wkhttpcookiestore?language=objc.
+class WKHttpCookieStoreHostApi {
+  /// Constructor for [WKHttpCookieStoreHostApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  WKHttpCookieStoreHostApi({BinaryMessenger? binaryMessenger})
+      : _binaryMessenger = binaryMessenger;
+  final BinaryMessenger? _binaryMessenger;
+
+  static const MessageCodec<Object?> codec = _WKHttpCookieStoreHostApiCodec();
+
+  Future<void> createFromWebsiteDataStore(
+      int arg_identifier, int arg_websiteDataStoreIdentifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList = await channel
-        .send(<Object?>[arg_identifier, arg_userAgent]) as List<Object?>?;
+            .send(<Object?>[arg_identifier, arg_websiteDataStoreIdentifier])
+        as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2618,15 +3558,14 @@ class WKWebViewHostApi {
     }
   }
 
-  Future<Object?> evaluateJavaScript(
-      int arg_identifier, String arg_javaScriptString) async {
+  Future<void> setCookie(
+      int arg_identifier, NSHttpCookieData arg_cookie) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList =
-        await channel.send(<Object?>[arg_identifier, arg_javaScriptString])
-            as List<Object?>?;
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_identifier, arg_cookie]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2639,17 +3578,18 @@ class WKWebViewHostApi {
         details: replyList[2],
       );
     } else {
-      return replyList[0];
+      return;
     }
   }
 
-  Future<void> setInspectable(int arg_identifier, bool arg_inspectable) async {
+  Future<void> setCookies(
+      int arg_identifier, List<NSHttpCookieData?> arg_cookies) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookies',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList = await channel
-        .send(<Object?>[arg_identifier, arg_inspectable]) as List<Object?>?;
+        .send(<Object?>[arg_identifier, arg_cookies]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2666,9 +3606,9 @@ class WKWebViewHostApi {
     }
   }
 
-  Future<String?> getCustomUserAgent(int arg_identifier) async {
+  Future<List<NSHttpCookieData?>> getAllCookies(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.getAllCookies',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
@@ -2684,28 +3624,37 @@ class WKWebViewHostApi {
         message: replyList[1] as String?,
         details: replyList[2],
       );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
     } else {
-      return (replyList[0] as String?);
+      return (replyList[0] as List<Object?>?)!.cast<NSHttpCookieData?>();
     }
   }
 }
 
-/// Mirror of WKUIDelegate.
+/// Host API for `NSUrl`.
 ///
-/// See https://developer.apple.com/documentation/webkit/wkuidelegate?language=objc.
-class WKUIDelegateHostApi {
-  /// Constructor for [WKUIDelegateHostApi].  The [binaryMessenger] named argument is
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/foundation/nsurl?language=objc.
+class NSUrlHostApi {
+  /// Constructor for [NSUrlHostApi].  The [binaryMessenger] named argument is
   /// available for dependency injection.  If it is left null, the default
   /// BinaryMessenger will be used which routes to the host platform.
-  WKUIDelegateHostApi({BinaryMessenger? binaryMessenger})
+  NSUrlHostApi({BinaryMessenger? binaryMessenger})
       : _binaryMessenger = binaryMessenger;
   final BinaryMessenger? _binaryMessenger;
 
   static const MessageCodec<Object?> codec = StandardMessageCodec();
 
-  Future<void> create(int arg_identifier) async {
+  Future<String?> getAbsoluteString(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList =
@@ -2722,81 +3671,27 @@ class WKUIDelegateHostApi {
         details: replyList[2],
       );
     } else {
-      return;
-    }
-  }
-}
-
-class _WKUIDelegateFlutterApiCodec extends StandardMessageCodec {
-  const _WKUIDelegateFlutterApiCodec();
-  @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSUrlRequestData) {
-      buffer.putUint8(128);
-      writeValue(buffer, value.encode());
-    } else if (value is WKFrameInfoData) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.encode());
-    } else if (value is WKMediaCaptureTypeData) {
-      buffer.putUint8(130);
-      writeValue(buffer, value.encode());
-    } else if (value is WKNavigationActionData) {
-      buffer.putUint8(131);
-      writeValue(buffer, value.encode());
-    } else if (value is WKPermissionDecisionData) {
-      buffer.putUint8(132);
-      writeValue(buffer, value.encode());
-    } else if (value is WKSecurityOriginData) {
-      buffer.putUint8(133);
-      writeValue(buffer, value.encode());
-    } else {
-      super.writeValue(buffer, value);
-    }
-  }
-
-  @override
-  Object? readValueOfType(int type, ReadBuffer buffer) {
-    switch (type) {
-      case 128:
-        return NSUrlRequestData.decode(readValue(buffer)!);
-      case 129:
-        return WKFrameInfoData.decode(readValue(buffer)!);
-      case 130:
-        return WKMediaCaptureTypeData.decode(readValue(buffer)!);
-      case 131:
-        return WKNavigationActionData.decode(readValue(buffer)!);
-      case 132:
-        return WKPermissionDecisionData.decode(readValue(buffer)!);
-      case 133:
-        return WKSecurityOriginData.decode(readValue(buffer)!);
-      default:
-        return super.readValueOfType(type, buffer);
+      return (replyList[0] as String?);
     }
   }
 }
 
-/// Handles callbacks from a WKUIDelegate instance.
+/// Flutter API for `NSUrl`.
 ///
-/// See https://developer.apple.com/documentation/webkit/wkuidelegate?language=objc.
-abstract class WKUIDelegateFlutterApi {
-  static const MessageCodec<Object?> codec = _WKUIDelegateFlutterApiCodec();
-
-  void onCreateWebView(int identifier, int webViewIdentifier,
-      int configurationIdentifier, WKNavigationActionData navigationAction);
+/// This class may handle instantiating and adding Dart instances that are
+/// attached to a native instance or receiving callback methods from an
+/// overridden native class.
+///
+/// See https://developer.apple.com/documentation/foundation/nsurl?language=objc.
+abstract class NSUrlFlutterApi {
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
 
-  /// Callback to Dart function `WKUIDelegate.requestMediaCapturePermission`.
-  Future<WKPermissionDecisionData> requestMediaCapturePermission(
-      int identifier,
-      int webViewIdentifier,
-      WKSecurityOriginData origin,
-      WKFrameInfoData frame,
-      WKMediaCaptureTypeData type);
+  void create(int identifier);
 
-  static void setup(WKUIDelegateFlutterApi? api,
-      {BinaryMessenger? binaryMessenger}) {
+  static void setup(NSUrlFlutterApi? api, {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlFlutterApi.create',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -2804,24 +3699,13 @@ abstract class WKUIDelegateFlutterApi {
       } else {
         channel.setMessageHandler((Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlFlutterApi.create was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null int.');
-          final int? arg_configurationIdentifier = (args[2] as int?);
-          assert(arg_configurationIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null int.');
-          final WKNavigationActionData? arg_navigationAction =
-              (args[3] as WKNavigationActionData?);
-          assert(arg_navigationAction != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.onCreateWebView was null, expected non-null WKNavigationActionData.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlFlutterApi.create was null, expected non-null int.');
           try {
-            api.onCreateWebView(arg_identifier!, arg_webViewIdentifier!,
-                arg_configurationIdentifier!, arg_navigationAction!);
+            api.create(arg_identifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -2832,101 +3716,175 @@ abstract class WKUIDelegateFlutterApi {
         });
       }
     }
-    {
-      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission',
-          codec,
-          binaryMessenger: binaryMessenger);
-      if (api == null) {
-        channel.setMessageHandler(null);
-      } else {
-        channel.setMessageHandler((Object? message) async {
-          assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null.');
-          final List<Object?> args = (message as List<Object?>?)!;
-          final int? arg_identifier = (args[0] as int?);
-          assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null int.');
-          final int? arg_webViewIdentifier = (args[1] as int?);
-          assert(arg_webViewIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null int.');
-          final WKSecurityOriginData? arg_origin =
-              (args[2] as WKSecurityOriginData?);
-          assert(arg_origin != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null WKSecurityOriginData.');
-          final WKFrameInfoData? arg_frame = (args[3] as WKFrameInfoData?);
-          assert(arg_frame != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null WKFrameInfoData.');
-          final WKMediaCaptureTypeData? arg_type =
-              (args[4] as WKMediaCaptureTypeData?);
-          assert(arg_type != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateFlutterApi.requestMediaCapturePermission was null, expected non-null WKMediaCaptureTypeData.');
-          try {
-            final WKPermissionDecisionData output =
-                await api.requestMediaCapturePermission(arg_identifier!,
-                    arg_webViewIdentifier!, arg_origin!, arg_frame!, arg_type!);
-            return wrapResponse(result: output);
-          } on PlatformException catch (e) {
-            return wrapResponse(error: e);
-          } catch (e) {
-            return wrapResponse(
-                error: PlatformException(code: 'error', message: e.toString()));
-          }
-        });
-      }
+  }
+}
+
+/// Host API for a Flutter texture that displays snapshots of a WKWebView.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/webkit/wkwebview/2873260-takesnapshotwithconfiguration?language=objc.
+class WKWebViewTextureHostApi {
+  /// Constructor for [WKWebViewTextureHostApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  WKWebViewTextureHostApi({BinaryMessenger? binaryMessenger})
+      : _binaryMessenger = binaryMessenger;
+  final BinaryMessenger? _binaryMessenger;
+
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  Future<void> create(int arg_identifier, int arg_webViewIdentifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.create',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier, arg_webViewIdentifier])
+            as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<int> getTextureId(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.getTextureId',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else if (replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (replyList[0] as int?)!;
     }
   }
-}
 
-class _WKHttpCookieStoreHostApiCodec extends StandardMessageCodec {
-  const _WKHttpCookieStoreHostApiCodec();
-  @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSHttpCookieData) {
-      buffer.putUint8(128);
-      writeValue(buffer, value.encode());
-    } else if (value is NSHttpCookiePropertyKeyEnumData) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.encode());
+  Future<void> setSize(
+      int arg_identifier, double arg_width, double arg_height) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.setSize',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier, arg_width, arg_height])
+            as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
     } else {
-      super.writeValue(buffer, value);
+      return;
     }
   }
 
-  @override
-  Object? readValueOfType(int type, ReadBuffer buffer) {
-    switch (type) {
-      case 128:
-        return NSHttpCookieData.decode(readValue(buffer)!);
-      case 129:
-        return NSHttpCookiePropertyKeyEnumData.decode(readValue(buffer)!);
-      default:
-        return super.readValueOfType(type, buffer);
+  Future<void> update(int arg_identifier) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.update',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
     }
   }
 }
 
-/// Mirror of WKHttpCookieStore.
+/// Host API for `WKURLSchemeHandler`.
 ///
-/// See https://developer.apple.com/documentation/webkit/wkhttpcookiestore?language=objc.
-class WKHttpCookieStoreHostApi {
-  /// Constructor for [WKHttpCookieStoreHostApi].  The [binaryMessenger] named argument is
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc.
+class WKURLSchemeHandlerHostApi {
+  /// Constructor for [WKURLSchemeHandlerHostApi].  The [binaryMessenger] named argument is
   /// available for dependency injection.  If it is left null, the default
   /// BinaryMessenger will be used which routes to the host platform.
-  WKHttpCookieStoreHostApi({BinaryMessenger? binaryMessenger})
+  WKURLSchemeHandlerHostApi({BinaryMessenger? binaryMessenger})
       : _binaryMessenger = binaryMessenger;
   final BinaryMessenger? _binaryMessenger;
 
-  static const MessageCodec<Object?> codec = _WKHttpCookieStoreHostApiCodec();
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
 
-  Future<void> createFromWebsiteDataStore(
-      int arg_identifier, int arg_websiteDataStoreIdentifier) async {
+  Future<void> create(int arg_identifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.create',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList =
+        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  Future<void> addFileRoute(int arg_identifier, String arg_pathPrefix,
+      String arg_directoryPath) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFileRoute',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList = await channel
-            .send(<Object?>[arg_identifier, arg_websiteDataStoreIdentifier])
+            .send(<Object?>[arg_identifier, arg_pathPrefix, arg_directoryPath])
         as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
@@ -2944,14 +3902,15 @@ class WKHttpCookieStoreHostApi {
     }
   }
 
-  Future<void> setCookie(
-      int arg_identifier, NSHttpCookieData arg_cookie) async {
+  Future<void> addFlutterAssetRoute(int arg_identifier, String arg_pathPrefix,
+      String arg_assetDirectory) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFlutterAssetRoute',
         codec,
         binaryMessenger: _binaryMessenger);
     final List<Object?>? replyList = await channel
-        .send(<Object?>[arg_identifier, arg_cookie]) as List<Object?>?;
+            .send(<Object?>[arg_identifier, arg_pathPrefix, arg_assetDirectory])
+        as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -2967,32 +3926,67 @@ class WKHttpCookieStoreHostApi {
       return;
     }
   }
-}
 
-/// Host API for `NSUrl`.
-///
-/// This class may handle instantiating and adding native object instances that
-/// are attached to a Dart instance or method calls on the associated native
-/// class or an instance of the class.
-///
-/// See https://developer.apple.com/documentation/foundation/nsurl?language=objc.
-class NSUrlHostApi {
-  /// Constructor for [NSUrlHostApi].  The [binaryMessenger] named argument is
-  /// available for dependency injection.  If it is left null, the default
-  /// BinaryMessenger will be used which routes to the host platform.
-  NSUrlHostApi({BinaryMessenger? binaryMessenger})
-      : _binaryMessenger = binaryMessenger;
-  final BinaryMessenger? _binaryMessenger;
+  Future<void> didReceiveResponse(int arg_identifier, int arg_taskIdentifier,
+      int arg_statusCode, Map<String?, String?> arg_headers) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveResponse',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(<Object?>[
+      arg_identifier,
+      arg_taskIdentifier,
+      arg_statusCode,
+      arg_headers
+    ]) as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
 
-  static const MessageCodec<Object?> codec = StandardMessageCodec();
+  Future<void> didReceiveData(
+      int arg_identifier, int arg_taskIdentifier, Uint8List arg_data) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveData',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel
+            .send(<Object?>[arg_identifier, arg_taskIdentifier, arg_data])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
 
-  Future<String?> getAbsoluteString(int arg_identifier) async {
+  Future<void> didFinish(int arg_identifier, int arg_taskIdentifier) async {
     final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-        'dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString',
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFinish',
         codec,
         binaryMessenger: _binaryMessenger);
-    final List<Object?>? replyList =
-        await channel.send(<Object?>[arg_identifier]) as List<Object?>?;
+    final List<Object?>? replyList = await channel
+        .send(<Object?>[arg_identifier, arg_taskIdentifier]) as List<Object?>?;
     if (replyList == null) {
       throw PlatformException(
         code: 'channel-error',
@@ -3005,27 +3999,77 @@ class NSUrlHostApi {
         details: replyList[2],
       );
     } else {
-      return (replyList[0] as String?);
+      return;
+    }
+  }
+
+  Future<void> didFail(int arg_identifier, int arg_taskIdentifier,
+      String arg_errorDescription) async {
+    final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+        'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFail',
+        codec,
+        binaryMessenger: _binaryMessenger);
+    final List<Object?>? replyList = await channel.send(
+            <Object?>[arg_identifier, arg_taskIdentifier, arg_errorDescription])
+        as List<Object?>?;
+    if (replyList == null) {
+      throw PlatformException(
+        code: 'channel-error',
+        message: 'Unable to establish connection on channel.',
+      );
+    } else if (replyList.length > 1) {
+      throw PlatformException(
+        code: replyList[0]! as String,
+        message: replyList[1] as String?,
+        details: replyList[2],
+      );
+    } else {
+      return;
     }
   }
 }
 
-/// Flutter API for `NSUrl`.
-///
-/// This class may handle instantiating and adding Dart instances that are
-/// attached to a native instance or receiving callback methods from an
-/// overridden native class.
+class _WKURLSchemeHandlerFlutterApiCodec extends StandardMessageCodec {
+  const _WKURLSchemeHandlerFlutterApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSUrlRequestData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSUrlRequestData.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Handles callbacks from a WKURLSchemeHandler instance.
 ///
-/// See https://developer.apple.com/documentation/foundation/nsurl?language=objc.
-abstract class NSUrlFlutterApi {
-  static const MessageCodec<Object?> codec = StandardMessageCodec();
+/// See https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc.
+abstract class WKURLSchemeHandlerFlutterApi {
+  static const MessageCodec<Object?> codec =
+      _WKURLSchemeHandlerFlutterApiCodec();
 
-  void create(int identifier);
+  void startURLSchemeTask(int identifier, int webViewIdentifier,
+      int taskIdentifier, NSUrlRequestData request);
 
-  static void setup(NSUrlFlutterApi? api, {BinaryMessenger? binaryMessenger}) {
+  void stopURLSchemeTask(
+      int identifier, int webViewIdentifier, int taskIdentifier);
+
+  static void setup(WKURLSchemeHandlerFlutterApi? api,
+      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlFlutterApi.create',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.startURLSchemeTask',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -3033,13 +4077,57 @@ abstract class NSUrlFlutterApi {
       } else {
         channel.setMessageHandler((Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlFlutterApi.create was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.startURLSchemeTask was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlFlutterApi.create was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.startURLSchemeTask was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.startURLSchemeTask was null, expected non-null int.');
+          final int? arg_taskIdentifier = (args[2] as int?);
+          assert(arg_taskIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.startURLSchemeTask was null, expected non-null int.');
+          final NSUrlRequestData? arg_request = (args[3] as NSUrlRequestData?);
+          assert(arg_request != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.startURLSchemeTask was null, expected non-null NSUrlRequestData.');
           try {
-            api.create(arg_identifier!);
+            api.startURLSchemeTask(arg_identifier!, arg_webViewIdentifier!,
+                arg_taskIdentifier!, arg_request!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.stopURLSchemeTask',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        channel.setMessageHandler(null);
+      } else {
+        channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.stopURLSchemeTask was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.stopURLSchemeTask was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.stopURLSchemeTask was null, expected non-null int.');
+          final int? arg_taskIdentifier = (args[2] as int?);
+          assert(arg_taskIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerFlutterApi.stopURLSchemeTask was null, expected non-null int.');
+          try {
+            api.stopURLSchemeTask(
+                arg_identifier!, arg_webViewIdentifier!, arg_taskIdentifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
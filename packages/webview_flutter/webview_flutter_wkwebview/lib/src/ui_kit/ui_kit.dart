@@ -10,6 +10,7 @@ import 'package:flutter/services.dart';
 import '../common/instance_manager.dart';
 import '../foundation/foundation.dart';
 import '../web_kit/web_kit.dart';
+import '../web_kit/web_kit_api_impls.dart';
 import 'ui_kit_api_impls.dart';
 
 /// A view that allows the scrolling and zooming of its contained views.
@@ -75,6 +76,13 @@ class UIScrollView extends UIView {
     return _scrollViewApi.setContentOffsetForInstances(this, offset);
   }
 
+  /// Set the delegate to this scroll view.
+  ///
+  /// Represents [UIScrollView.delegate](https://developer.apple.com/documentation/uikit/uiscrollview/1619430-delegate?language=objc).
+  Future<void> setDelegate(UIScrollViewDelegate? delegate) {
+    return _scrollViewApi.setDelegateForInstances(this, delegate);
+  }
+
   @override
   UIScrollView copy() {
     return UIScrollView.detached(
@@ -85,6 +93,86 @@ class UIScrollView extends UIView {
   }
 }
 
+/// Responds to scroll events of a [UIScrollView].
+///
+/// Scroll events are throttled on the native side before they are sent to
+/// Dart, so a fast scroll doesn't flood the platform channel with messages.
+///
+/// Wraps [UIScrollViewDelegate](https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc).
+@immutable
+class UIScrollViewDelegate extends NSObject {
+  /// Constructs a [UIScrollViewDelegate].
+  UIScrollViewDelegate({
+    this.scrollViewDidScroll,
+    this.maximumFrequency = 0,
+    this.minimumDelta = 0,
+    super.observeValue,
+    super.binaryMessenger,
+    super.instanceManager,
+  })  : _scrollViewDelegateApi = UIScrollViewDelegateHostApiImpl(
+          binaryMessenger: binaryMessenger,
+          instanceManager: instanceManager,
+        ),
+        super.detached() {
+    // Ensures FlutterApis for the WebKit library are set up.
+    WebKitFlutterApis.instance.ensureSetUp();
+    _scrollViewDelegateApi.createForInstances(this);
+  }
+
+  /// Constructs a [UIScrollViewDelegate] without creating the associated
+  /// Objective-C object.
+  ///
+  /// This should only be used by subclasses created by this library or to
+  /// create copies.
+  UIScrollViewDelegate.detached({
+    this.scrollViewDidScroll,
+    this.maximumFrequency = 0,
+    this.minimumDelta = 0,
+    super.observeValue,
+    super.binaryMessenger,
+    super.instanceManager,
+  })  : _scrollViewDelegateApi = UIScrollViewDelegateHostApiImpl(
+          binaryMessenger: binaryMessenger,
+          instanceManager: instanceManager,
+        ),
+        super.detached();
+
+  final UIScrollViewDelegateHostApiImpl _scrollViewDelegateApi;
+
+  /// Called when the user scrolls the content of [scrollView].
+  ///
+  /// [x] and [y] are the new content offset of [scrollView].
+  ///
+  /// {@macro webview_flutter_wkwebview.foundation.callbacks}
+  final void Function(
+    UIScrollView scrollView,
+    double x,
+    double y,
+  )? scrollViewDidScroll;
+
+  /// The maximum number of times per second [scrollViewDidScroll] is called.
+  ///
+  /// The last content offset of a scroll is always reported. A value of `0`
+  /// reports every scroll event.
+  final double maximumFrequency;
+
+  /// The minimum distance, in points, the content offset must move along
+  /// either axis before [scrollViewDidScroll] is called again.
+  final double minimumDelta;
+
+  @override
+  UIScrollViewDelegate copy() {
+    return UIScrollViewDelegate.detached(
+      scrollViewDidScroll: scrollViewDidScroll,
+      maximumFrequency: maximumFrequency,
+      minimumDelta: minimumDelta,
+      observeValue: observeValue,
+      binaryMessenger: _scrollViewDelegateApi.binaryMessenger,
+      instanceManager: _scrollViewDelegateApi.instanceManager,
+    );
+  }
+}
+
 /// Manages the content for a rectangular area on the screen.
 ///
 /// Wraps [UIView](https://developer.apple.com/documentation/uikit/uiview?language=objc).
@@ -178,6 +178,34 @@ class WKFrameInfo {
   final bool isMainFrame;
 }
 
+/// A rule that decides the policy of navigation actions to matching URLs
+/// without calling [WKNavigationDelegate.decidePolicyForNavigationAction].
+///
+/// A rule matches a URL when each of its non-null conditions match.
+@immutable
+class WKNavigationPolicyRule {
+  /// Constructs a [WKNavigationPolicyRule].
+  const WKNavigationPolicyRule({
+    this.host,
+    this.scheme,
+    this.urlPattern,
+    required this.policy,
+  });
+
+  /// The host the URL must have, or one of its subdomains.
+  final String? host;
+
+  /// The scheme the URL must have.
+  final String? scheme;
+
+  /// A regular expression, in the syntax of `NSRegularExpression`, that must
+  /// match a part of the URL.
+  final String? urlPattern;
+
+  /// The policy of the navigation actions to matching URLs.
+  final WKNavigationActionPolicy policy;
+}
+
 /// A script that the web view injects into a webpage.
 ///
 /// Wraps [WKUserScript](https://developer.apple.com/documentation/webkit/wkuserscript?language=objc).
@@ -398,6 +426,21 @@ class WKHttpCookieStore extends NSObject {
     return _httpCookieStoreApi.setCookieForInstances(this, cookie);
   }
 
+  /// Adds multiple cookies to the cookie store.
+  ///
+  /// The cookies are stored concurrently and the returned future completes
+  /// once all of them have been added.
+  Future<void> setCookies(List<NSHttpCookie> cookies) {
+    return _httpCookieStoreApi.setCookiesForInstances(this, cookies);
+  }
+
+  /// Fetches all stored cookies.
+  ///
+  /// Properties that have no matching [NSHttpCookiePropertyKey] are omitted.
+  Future<List<NSHttpCookie>> getAllCookies() {
+    return _httpCookieStoreApi.getAllCookiesForInstances(this);
+  }
+
   @override
   WKHttpCookieStore copy() {
     return WKHttpCookieStore.detached(
@@ -459,6 +502,21 @@ class WKScriptMessageHandler extends NSObject {
     WKScriptMessage message,
   ) didReceiveScriptMessage;
 
+  /// Sets whether script messages are queued natively and sent in batches.
+  ///
+  /// When [maxBatchSize] is not null, script messages are queued and sent
+  /// once [maxBatchSize] of them are queued, or about a frame after the first
+  /// of them was received. [didReceiveScriptMessage] is still called once for
+  /// each message, in order. When [maxBatchSize] is null, each message is sent
+  /// as it is received.
+  Future<void> setMessageBatching({int? maxBatchSize}) {
+    assert(maxBatchSize == null || maxBatchSize > 0);
+    return _scriptMessageHandlerApi.setMessageBatchingForInstances(
+      this,
+      maxBatchSize,
+    );
+  }
+
   @override
   WKScriptMessageHandler copy() {
     return WKScriptMessageHandler.detached(
@@ -577,6 +635,32 @@ class WKUserContentController extends NSObject {
     return _userContentControllerApi.removeAllUserScriptsForInstances(this);
   }
 
+  /// Adds the content rule list compiled into [store] under [identifier].
+  ///
+  /// The rule list must have been compiled with
+  /// [WKContentRuleListStore.compileContentRuleList] first.
+  ///
+  /// Only supported on iOS version 11+.
+  Future<void> addContentRuleList(
+    WKContentRuleListStore store,
+    String identifier,
+  ) {
+    return _userContentControllerApi.addContentRuleListForInstances(
+      this,
+      store,
+      identifier,
+    );
+  }
+
+  /// Removes all content rule lists from the user content controller.
+  ///
+  /// Only supported on iOS version 11+.
+  Future<void> removeAllContentRuleLists() {
+    return _userContentControllerApi.removeAllContentRuleListsForInstances(
+      this,
+    );
+  }
+
   @override
   WKUserContentController copy() {
     return WKUserContentController.detached(
@@ -587,6 +671,84 @@ class WKUserContentController extends NSObject {
   }
 }
 
+/// An object that compiles and stores content rule lists on disk.
+///
+/// Compiled rule lists persist across app launches, so a rule list only needs
+/// to be compiled once and can be looked up by its identifier afterwards.
+///
+/// Wraps [WKContentRuleListStore](https://developer.apple.com/documentation/webkit/wkcontentruleliststore?language=objc).
+@immutable
+class WKContentRuleListStore extends NSObject {
+  /// Constructs a [WKContentRuleListStore] without creating the associated
+  /// Objective-C object.
+  ///
+  /// This should only be used by subclasses created by this library or to
+  /// create copies.
+  WKContentRuleListStore.detached({
+    super.observeValue,
+    super.binaryMessenger,
+    super.instanceManager,
+  })  : _contentRuleListStoreApi = WKContentRuleListStoreHostApiImpl(
+          binaryMessenger: binaryMessenger,
+          instanceManager: instanceManager,
+        ),
+        super.detached();
+
+  factory WKContentRuleListStore._defaultStore() {
+    final WKContentRuleListStore store = WKContentRuleListStore.detached();
+    store._contentRuleListStoreApi.createDefaultStoreForInstances(store);
+    return store;
+  }
+
+  /// Default store for content rule lists.
+  ///
+  /// Only supported on iOS version 11+.
+  static final WKContentRuleListStore defaultStore =
+      WKContentRuleListStore._defaultStore();
+
+  final WKContentRuleListStoreHostApiImpl _contentRuleListStoreApi;
+
+  /// Compiles [encodedContentRuleList] and stores it under [identifier].
+  ///
+  /// [encodedContentRuleList] is a JSON array of content blocker rules. A
+  /// rule list previously stored under [identifier] is replaced.
+  Future<void> compileContentRuleList(
+    String identifier,
+    String encodedContentRuleList,
+  ) {
+    return _contentRuleListStoreApi.compileContentRuleListForInstances(
+      this,
+      identifier,
+      encodedContentRuleList,
+    );
+  }
+
+  /// Whether a compiled rule list is stored under [identifier].
+  Future<bool> containsContentRuleList(String identifier) {
+    return _contentRuleListStoreApi.containsContentRuleListForInstances(
+      this,
+      identifier,
+    );
+  }
+
+  /// Removes the compiled rule list stored under [identifier].
+  Future<void> removeContentRuleList(String identifier) {
+    return _contentRuleListStoreApi.removeContentRuleListForInstances(
+      this,
+      identifier,
+    );
+  }
+
+  @override
+  WKContentRuleListStore copy() {
+    return WKContentRuleListStore.detached(
+      observeValue: observeValue,
+      binaryMessenger: _contentRuleListStoreApi.binaryMessenger,
+      instanceManager: _contentRuleListStoreApi.instanceManager,
+    );
+  }
+}
+
 /// A collection of properties that you use to initialize a web view.
 ///
 /// Wraps [WKWebViewConfiguration](https://developer.apple.com/documentation/webkit/wkwebviewconfiguration?language=objc).
@@ -709,6 +871,33 @@ class WKWebViewConfiguration extends NSObject {
     );
   }
 
+  /// Makes web views created with this configuration share a single web
+  /// content process pool.
+  ///
+  /// Sharing a process pool lets web views share cookies and cached resources
+  /// in memory and avoids spawning a new web content process per web view. It
+  /// has no effect on iOS 15+, where all web views already share one pool.
+  ///
+  /// Sets [WKWebViewConfiguration.processPool](https://developer.apple.com/documentation/webkit/wkwebviewconfiguration/1455628-processpool?language=objc).
+  Future<void> useSharedProcessPool() {
+    return _webViewConfigurationApi.useSharedProcessPoolForInstances(this);
+  }
+
+  /// Registers [handler] to load resources of URLs with [scheme].
+  ///
+  /// [scheme] must not be a scheme that WebKit handles, like `https`, and a
+  /// handler must be set before a web view is created with this
+  /// configuration.
+  ///
+  /// Calls [WKWebViewConfiguration.setURLSchemeHandler:forURLScheme:](https://developer.apple.com/documentation/webkit/wkwebviewconfiguration/2875766-seturlschemehandler?language=objc).
+  Future<void> setURLSchemeHandler(WKURLSchemeHandler handler, String scheme) {
+    return _webViewConfigurationApi.setURLSchemeHandlerForInstances(
+      this,
+      handler,
+      scheme,
+    );
+  }
+
   @override
   WKWebViewConfiguration copy() {
     return WKWebViewConfiguration.detached(
@@ -901,6 +1090,35 @@ class WKNavigationDelegate extends NSObject {
   /// {@macro webview_flutter_wkwebview.foundation.callbacks}
   final void Function(WKWebView webView)? webViewWebContentProcessDidTerminate;
 
+  /// Sets rules that decide the policy of navigation actions natively.
+  ///
+  /// The first rule that matches the URL of a navigation action decides its
+  /// policy without calling [decidePolicyForNavigationAction]. Navigation
+  /// actions that match no rule are sent to [decidePolicyForNavigationAction],
+  /// except that subframe navigations are allowed natively when
+  /// [forwardsOnlyMainFrameNavigations] is true.
+  Future<void> setNavigationPolicyRules(
+    List<WKNavigationPolicyRule> rules, {
+    bool forwardsOnlyMainFrameNavigations = false,
+  }) {
+    return _navigationDelegateApi.setNavigationPolicyRulesForInstances(
+      this,
+      rules,
+      forwardsOnlyMainFrameNavigations,
+    );
+  }
+
+  /// Sets whether the [NSUrlRequest] of the navigation actions sent to
+  /// [decidePolicyForNavigationAction] includes its method, body and headers.
+  ///
+  /// Defaults to false, in which case only the URL of the request is sent.
+  Future<void> setIncludesRequestDetails(bool includesRequestDetails) {
+    return _navigationDelegateApi.setIncludesRequestDetailsForInstances(
+      this,
+      includesRequestDetails,
+    );
+  }
+
   @override
   WKNavigationDelegate copy() {
     return WKNavigationDelegate.detached(
@@ -1107,6 +1325,48 @@ class WKWebView extends UIView {
     );
   }
 
+  /// Evaluates the specified JavaScript string and returns its value
+  /// serialized with `JSON.stringify`.
+  ///
+  /// The value is serialized inside the page, so nested objects and arrays are
+  /// returned as a single string instead of being converted value by value.
+  /// Returns null when the value has no JSON representation, such as
+  /// `undefined` or a function.
+  ///
+  /// The script is run with `eval`, so this fails on pages whose Content
+  /// Security Policy does not allow `unsafe-eval`. Throws a
+  /// `PlatformException` if an error occurs.
+  Future<String?> evaluateJavaScriptAsJson(String javaScriptString) {
+    return _webViewApi.evaluateJavaScriptAsJsonForInstances(
+      this,
+      javaScriptString,
+    );
+  }
+
+  /// Calls [functionBody] as the body of an async JavaScript function.
+  ///
+  /// Each entry of [arguments] is passed to the function as a variable with
+  /// the entry's key as its name. A `Uint8List` value is passed as a
+  /// `Uint8Array`, and a returned `ArrayBuffer` or typed array is returned as
+  /// a `Uint8List`. Binary data is copied as base64 across the JavaScript
+  /// boundary natively, so it is never encoded in Dart or in the script
+  /// source.
+  ///
+  /// Only supported on iOS 14+. Throws a `PlatformException` if an error
+  /// occurs.
+  ///
+  /// Calls [WKWebView.callAsyncJavaScript](https://developer.apple.com/documentation/webkit/wkwebview/3656441-callasyncjavascript?language=objc).
+  Future<Object?> callAsyncJavaScript(
+    String functionBody, {
+    Map<String, Object?> arguments = const <String, Object?>{},
+  }) {
+    return _webViewApi.callAsyncJavaScriptForInstances(
+      this,
+      functionBody,
+      arguments,
+    );
+  }
+
   /// Enables debugging of web contents (HTML / CSS / JavaScript) in the
   /// underlying WebView.
   ///
@@ -1132,6 +1392,48 @@ class WKWebView extends UIView {
     return _webViewApi.getCustomUserAgentForInstances(this);
   }
 
+  /// Sets whether the page is unloaded to free its memory while the web view
+  /// is offscreen, and restored when the web view is shown again.
+  ///
+  /// The page is unloaded when the app receives a memory warning, or after the
+  /// web view has been offscreen for [idleTimeout] if it is not null. Its
+  /// `interactionState` is restored when the web view is shown again, or when
+  /// a page is loaded or JavaScript runs, behind a snapshot of the page. The
+  /// navigation delegate and observers don't receive the callbacks of the
+  /// unloading and restoring loads.
+  ///
+  /// Has no effect before iOS 15.
+  Future<void> setSuspendsWhenOffscreen(
+    bool suspends, {
+    Duration? idleTimeout,
+  }) {
+    return _webViewApi.setSuspendsWhenOffscreenForInstances(
+      this,
+      suspends,
+      idleTimeout,
+    );
+  }
+
+  /// Creates [count] web views with [configuration] ahead of time.
+  ///
+  /// Each prewarmed web view loads an empty page so its web content process
+  /// is already running. A [WKWebView] constructed later with an equivalent
+  /// configuration takes a prewarmed web view instead of creating a new one.
+  /// When it is disposed, the web view is reset and returned to the pool.
+  ///
+  /// Returning web views to the pool is only supported on iOS 14+.
+  static Future<void> prewarm(
+    WKWebViewConfiguration configuration, {
+    required int count,
+    BinaryMessenger? binaryMessenger,
+    InstanceManager? instanceManager,
+  }) {
+    return WKWebViewHostApiImpl(
+      binaryMessenger: binaryMessenger,
+      instanceManager: instanceManager,
+    ).prewarmForInstances(configuration, count);
+  }
+
   @override
   WKWebView copy() {
     return WKWebView.detached(
@@ -1141,3 +1443,233 @@ class WKWebView extends UIView {
     );
   }
 }
+
+/// A Flutter texture that displays snapshots of a [WKWebView].
+///
+/// A snapshot is taken when the web view finishes loading, when its size
+/// changes and when [update] is called. The texture does not forward touches
+/// to the web view.
+///
+/// Snapshots are taken with [WKWebView.takeSnapshotWithConfiguration](https://developer.apple.com/documentation/webkit/wkwebview/2873260-takesnapshotwithconfiguration?language=objc).
+@immutable
+class WKWebViewTexture extends NSObject {
+  /// Constructs a [WKWebViewTexture] that displays snapshots of [webView].
+  WKWebViewTexture(
+    WKWebView webView, {
+    super.observeValue,
+    super.binaryMessenger,
+    super.instanceManager,
+  })  : _webViewTextureApi = WKWebViewTextureHostApiImpl(
+          binaryMessenger: binaryMessenger,
+          instanceManager: instanceManager,
+        ),
+        super.detached() {
+    _webViewTextureApi.createForInstances(this, webView);
+  }
+
+  /// Constructs a [WKWebViewTexture] without creating the associated
+  /// Objective-C object.
+  ///
+  /// This should only be used outside of tests by subclasses created by this
+  /// library or to create a copy for an InstanceManager.
+  WKWebViewTexture.detached({
+    super.observeValue,
+    super.binaryMessenger,
+    super.instanceManager,
+  })  : _webViewTextureApi = WKWebViewTextureHostApiImpl(
+          binaryMessenger: binaryMessenger,
+          instanceManager: instanceManager,
+        ),
+        super.detached();
+
+  final WKWebViewTextureHostApiImpl _webViewTextureApi;
+
+  /// The id of the texture to pass to a `Texture` widget.
+  Future<int> getTextureId() {
+    return _webViewTextureApi.getTextureIdForInstances(this);
+  }
+
+  /// Sets the size of the web view in logical pixels.
+  ///
+  /// A new snapshot is taken when the size changes.
+  Future<void> setSize(double width, double height) {
+    return _webViewTextureApi.setSizeForInstances(this, width, height);
+  }
+
+  /// Takes a new snapshot of the web view.
+  Future<void> update() {
+    return _webViewTextureApi.updateForInstances(this);
+  }
+
+  @override
+  WKWebViewTexture copy() {
+    return WKWebViewTexture.detached(
+      observeValue: observeValue,
+      binaryMessenger: _webViewTextureApi.binaryMessenger,
+      instanceManager: _webViewTextureApi.instanceManager,
+    );
+  }
+}
+
+/// A task that loads a resource for a [WKURLSchemeHandler].
+///
+/// The resource is sent with one call to [didReceiveResponse], any number of
+/// calls to [didReceiveData] and a final call to [didFinish], or with a call
+/// to [didFail]. Calls after the task was stopped are ignored.
+///
+/// Wraps [WKURLSchemeTask](https://developer.apple.com/documentation/webkit/wkurlschemetask?language=objc).
+@immutable
+class WKURLSchemeTask {
+  /// Constructs a [WKURLSchemeTask].
+  @visibleForTesting
+  const WKURLSchemeTask({
+    required this.handler,
+    required this.identifier,
+    required this.request,
+  });
+
+  /// The handler that received this task.
+  final WKURLSchemeHandler handler;
+
+  /// Identifies this task among the tasks of [handler].
+  final int identifier;
+
+  /// The request for the resource.
+  final NSUrlRequest request;
+
+  /// Sends the response for the resource.
+  Future<void> didReceiveResponse({
+    int statusCode = 200,
+    Map<String, String> headers = const <String, String>{},
+  }) {
+    return handler._urlSchemeHandlerApi.didReceiveResponseForInstances(
+      handler,
+      identifier,
+      statusCode,
+      headers,
+    );
+  }
+
+  /// Sends the next chunk of data of the resource.
+  Future<void> didReceiveData(Uint8List data) {
+    return handler._urlSchemeHandlerApi.didReceiveDataForInstances(
+      handler,
+      identifier,
+      data,
+    );
+  }
+
+  /// Completes the resource.
+  Future<void> didFinish() {
+    return handler._urlSchemeHandlerApi.didFinishForInstances(
+      handler,
+      identifier,
+    );
+  }
+
+  /// Fails loading the resource with an error described by [description].
+  Future<void> didFail(String description) {
+    return handler._urlSchemeHandlerApi.didFailForInstances(
+      handler,
+      identifier,
+      description,
+    );
+  }
+}
+
+/// Loads resources of URLs with a custom scheme.
+///
+/// Requests whose URL path starts with the path prefix of a route added with
+/// [addFileRoute] or [addFlutterAssetRoute] are answered natively with the
+/// memory mapped file at the rest of the path in the route's directory, and a
+/// `404` response when the file doesn't exist. The path `/` in a route's
+/// directory is answered with its `index.html`. Other requests are sent to
+/// [startURLSchemeTask].
+///
+/// Wraps [WKURLSchemeHandler](https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc).
+@immutable
+class WKURLSchemeHandler extends NSObject {
+  /// Constructs a [WKURLSchemeHandler].
+  WKURLSchemeHandler({
+    required this.startURLSchemeTask,
+    this.stopURLSchemeTask,
+    super.observeValue,
+    super.binaryMessenger,
+    super.instanceManager,
+  })  : _urlSchemeHandlerApi = WKURLSchemeHandlerHostApiImpl(
+          binaryMessenger: binaryMessenger,
+          instanceManager: instanceManager,
+        ),
+        super.detached() {
+    // Ensures FlutterApis for the WebKit library are set up.
+    WebKitFlutterApis.instance.ensureSetUp();
+    _urlSchemeHandlerApi.createForInstances(this);
+  }
+
+  /// Constructs a [WKURLSchemeHandler] without creating the associated
+  /// Objective-C object.
+  ///
+  /// This should only be used by subclasses created by this library or to
+  /// create copies.
+  WKURLSchemeHandler.detached({
+    required this.startURLSchemeTask,
+    this.stopURLSchemeTask,
+    super.observeValue,
+    super.binaryMessenger,
+    super.instanceManager,
+  })  : _urlSchemeHandlerApi = WKURLSchemeHandlerHostApiImpl(
+          binaryMessenger: binaryMessenger,
+          instanceManager: instanceManager,
+        ),
+        super.detached();
+
+  final WKURLSchemeHandlerHostApiImpl _urlSchemeHandlerApi;
+
+  /// Asks the handler to begin loading the resource of a task.
+  ///
+  /// {@macro webview_flutter_wkwebview.foundation.callbacks}
+  final void Function(WKWebView webView, WKURLSchemeTask task)
+      startURLSchemeTask;
+
+  /// Tells the handler to stop loading the resource of the task with
+  /// [taskIdentifier], after which the task must not be used.
+  ///
+  /// {@macro webview_flutter_wkwebview.foundation.callbacks}
+  final void Function(WKWebView webView, int taskIdentifier)?
+      stopURLSchemeTask;
+
+  /// Answers requests whose URL path starts with [pathPrefix] with files in
+  /// [directoryPath].
+  ///
+  /// Routes are matched in the order they are added.
+  Future<void> addFileRoute(String pathPrefix, String directoryPath) {
+    return _urlSchemeHandlerApi.addFileRouteForInstances(
+      this,
+      pathPrefix,
+      directoryPath,
+    );
+  }
+
+  /// Answers requests whose URL path starts with [pathPrefix] with the Flutter
+  /// assets in [assetDirectory].
+  ///
+  /// Routes are matched in the order they are added.
+  Future<void> addFlutterAssetRoute(String pathPrefix, String assetDirectory) {
+    return _urlSchemeHandlerApi.addFlutterAssetRouteForInstances(
+      this,
+      pathPrefix,
+      assetDirectory,
+    );
+  }
+
+  @override
+  WKURLSchemeHandler copy() {
+    return WKURLSchemeHandler.detached(
+      startURLSchemeTask: startURLSchemeTask,
+      stopURLSchemeTask: stopURLSchemeTask,
+      observeValue: observeValue,
+      binaryMessenger: _urlSchemeHandlerApi.binaryMessenger,
+      instanceManager: _urlSchemeHandlerApi.instanceManager,
+    );
+  }
+}
@@ -8,6 +8,8 @@ import 'package:flutter/services.dart';
 import '../common/instance_manager.dart';
 import '../common/web_kit.g.dart';
 import '../foundation/foundation.dart';
+import '../ui_kit/ui_kit.dart';
+import '../ui_kit/ui_kit_api_impls.dart';
 import 'web_kit.dart';
 
 export '../common/web_kit.g.dart'
@@ -64,6 +66,21 @@ extension _NSHttpCookieConverter on NSHttpCookie {
   }
 }
 
+extension _NSHttpCookieDataConverter on NSHttpCookieData {
+  NSHttpCookie toNSHttpCookie() {
+    final Map<NSHttpCookiePropertyKey, Object> properties =
+        <NSHttpCookiePropertyKey, Object>{};
+    for (int i = 0; i < propertyKeys.length; i++) {
+      final NSHttpCookiePropertyKey key = NSHttpCookiePropertyKey.values
+          .firstWhere((NSHttpCookiePropertyKey element) {
+        return element.name == propertyKeys[i]!.value.name;
+      });
+      properties[key] = propertyValues[i]!;
+    }
+    return NSHttpCookie.withProperties(properties);
+  }
+}
+
 extension _WKNavigationActionPolicyConverter on WKNavigationActionPolicy {
   WKNavigationActionPolicyEnumData toWKNavigationActionPolicyEnumData() {
     return WKNavigationActionPolicyEnumData(
@@ -74,6 +91,17 @@ extension _WKNavigationActionPolicyConverter on WKNavigationActionPolicy {
   }
 }
 
+extension _WKNavigationPolicyRuleConverter on WKNavigationPolicyRule {
+  WKNavigationPolicyRuleData toWKNavigationPolicyRuleData() {
+    return WKNavigationPolicyRuleData(
+      host: host,
+      scheme: scheme,
+      urlPattern: urlPattern,
+      policy: policy.toWKNavigationActionPolicyEnumData().value,
+    );
+  }
+}
+
 extension _NSHttpCookiePropertyKeyConverter on NSHttpCookiePropertyKey {
   NSHttpCookiePropertyKeyEnumData toNSHttpCookiePropertyKeyEnumData() {
     late final NSHttpCookiePropertyKeyEnum value;
@@ -251,9 +279,15 @@ class WebKitFlutterApis {
         scriptMessageHandler = WKScriptMessageHandlerFlutterApiImpl(
           instanceManager: instanceManager,
         ),
+        scrollViewDelegate = UIScrollViewDelegateFlutterApiImpl(
+          instanceManager: instanceManager,
+        ),
         uiDelegate = WKUIDelegateFlutterApiImpl(
           instanceManager: instanceManager,
         ),
+        urlSchemeHandler = WKURLSchemeHandlerFlutterApiImpl(
+          instanceManager: instanceManager,
+        ),
         webViewConfiguration = WKWebViewConfigurationFlutterApiImpl(
           binaryMessenger: binaryMessenger,
           instanceManager: instanceManager,
@@ -283,10 +317,18 @@ class WebKitFlutterApis {
   @visibleForTesting
   final WKScriptMessageHandlerFlutterApiImpl scriptMessageHandler;
 
+  /// Flutter Api for [UIScrollViewDelegate].
+  @visibleForTesting
+  final UIScrollViewDelegateFlutterApiImpl scrollViewDelegate;
+
   /// Flutter Api for [WKUIDelegate].
   @visibleForTesting
   final WKUIDelegateFlutterApiImpl uiDelegate;
 
+  /// Flutter Api for [WKURLSchemeHandler].
+  @visibleForTesting
+  final WKURLSchemeHandlerFlutterApiImpl urlSchemeHandler;
+
   /// Flutter Api for [WKWebViewConfiguration].
   @visibleForTesting
   final WKWebViewConfigurationFlutterApiImpl webViewConfiguration;
@@ -302,10 +344,18 @@ class WebKitFlutterApis {
         scriptMessageHandler,
         binaryMessenger: _binaryMessenger,
       );
+      UIScrollViewDelegateFlutterApi.setup(
+        scrollViewDelegate,
+        binaryMessenger: _binaryMessenger,
+      );
       WKUIDelegateFlutterApi.setup(
         uiDelegate,
         binaryMessenger: _binaryMessenger,
       );
+      WKURLSchemeHandlerFlutterApi.setup(
+        urlSchemeHandler,
+        binaryMessenger: _binaryMessenger,
+      );
       WKWebViewConfigurationFlutterApi.setup(
         webViewConfiguration,
         binaryMessenger: _binaryMessenger,
@@ -389,6 +439,17 @@ class WKScriptMessageHandlerHostApiImpl extends WKScriptMessageHandlerHostApi {
   Future<void> createForInstances(WKScriptMessageHandler instance) {
     return create(instanceManager.addDartCreatedInstance(instance));
   }
+
+  /// Calls [setMessageBatching] with the ids of the provided object instances.
+  Future<void> setMessageBatchingForInstances(
+    WKScriptMessageHandler instance,
+    int? maxBatchSize,
+  ) {
+    return setMessageBatching(
+      instanceManager.getIdentifier(instance)!,
+      maxBatchSize,
+    );
+  }
 }
 
 /// Flutter api implementation for [WKScriptMessageHandler].
@@ -418,6 +479,25 @@ class WKScriptMessageHandlerFlutterApiImpl
       message.toWKScriptMessage(),
     );
   }
+
+  @override
+  void didReceiveScriptMessages(
+    int identifier,
+    int userContentControllerIdentifier,
+    List<WKScriptMessageData?> messages,
+  ) {
+    final WKScriptMessageHandler handler = _getHandler(identifier);
+    final WKUserContentController userContentController =
+        instanceManager.getInstanceWithWeakReference(
+      userContentControllerIdentifier,
+    )! as WKUserContentController;
+    for (final WKScriptMessageData? message in messages) {
+      handler.didReceiveScriptMessage(
+        userContentController,
+        message!.toWKScriptMessage(),
+      );
+    }
+  }
 }
 
 /// Host api implementation for [WKPreferences].
@@ -500,6 +580,35 @@ class WKHttpCookieStoreHostApiImpl extends WKHttpCookieStoreHostApi {
       cookie.toNSHttpCookieData(),
     );
   }
+
+  /// Calls [setCookies] with the ids of the provided object instances.
+  Future<void> setCookiesForInstances(
+    WKHttpCookieStore instance,
+    List<NSHttpCookie> cookies,
+  ) {
+    return setCookies(
+      instanceManager.getIdentifier(instance)!,
+      cookies
+          .map<NSHttpCookieData>(
+            (NSHttpCookie cookie) => cookie.toNSHttpCookieData(),
+          )
+          .toList(),
+    );
+  }
+
+  /// Calls [getAllCookies] with the ids of the provided object instances.
+  Future<List<NSHttpCookie>> getAllCookiesForInstances(
+    WKHttpCookieStore instance,
+  ) async {
+    final List<NSHttpCookieData?> cookies = await getAllCookies(
+      instanceManager.getIdentifier(instance)!,
+    );
+    return cookies
+        .map<NSHttpCookie>(
+          (NSHttpCookieData? cookie) => cookie!.toNSHttpCookie(),
+        )
+        .toList();
+  }
 }
 
 /// Host api implementation for [WKUserContentController].
@@ -582,6 +691,85 @@ class WKUserContentControllerHostApiImpl
   ) {
     return removeAllUserScripts(instanceManager.getIdentifier(instance)!);
   }
+
+  /// Calls [addContentRuleList] with the ids of the provided object instances.
+  Future<void> addContentRuleListForInstances(
+    WKUserContentController instance,
+    WKContentRuleListStore store,
+    String ruleListIdentifier,
+  ) {
+    return addContentRuleList(
+      instanceManager.getIdentifier(instance)!,
+      instanceManager.getIdentifier(store)!,
+      ruleListIdentifier,
+    );
+  }
+
+  /// Calls [removeAllContentRuleLists] with the ids of the provided object instances.
+  Future<void> removeAllContentRuleListsForInstances(
+    WKUserContentController instance,
+  ) {
+    return removeAllContentRuleLists(instanceManager.getIdentifier(instance)!);
+  }
+}
+
+/// Host api implementation for [WKContentRuleListStore].
+class WKContentRuleListStoreHostApiImpl extends WKContentRuleListStoreHostApi {
+  /// Constructs a [WKContentRuleListStoreHostApiImpl].
+  WKContentRuleListStoreHostApiImpl({
+    this.binaryMessenger,
+    InstanceManager? instanceManager,
+  })  : instanceManager = instanceManager ?? NSObject.globalInstanceManager,
+        super(binaryMessenger: binaryMessenger);
+
+  /// Sends binary data across the Flutter platform barrier.
+  ///
+  /// If it is null, the default BinaryMessenger will be used which routes to
+  /// the host platform.
+  final BinaryMessenger? binaryMessenger;
+
+  /// Maintains instances stored to communicate with Objective-C objects.
+  final InstanceManager instanceManager;
+
+  /// Calls [createDefaultStore] with the ids of the provided object instances.
+  Future<void> createDefaultStoreForInstances(WKContentRuleListStore instance) {
+    return createDefaultStore(instanceManager.addDartCreatedInstance(instance));
+  }
+
+  /// Calls [compileContentRuleList] with the ids of the provided object instances.
+  Future<void> compileContentRuleListForInstances(
+    WKContentRuleListStore instance,
+    String ruleListIdentifier,
+    String encodedContentRuleList,
+  ) {
+    return compileContentRuleList(
+      instanceManager.getIdentifier(instance)!,
+      ruleListIdentifier,
+      encodedContentRuleList,
+    );
+  }
+
+  /// Calls [containsContentRuleList] with the ids of the provided object instances.
+  Future<bool> containsContentRuleListForInstances(
+    WKContentRuleListStore instance,
+    String ruleListIdentifier,
+  ) {
+    return containsContentRuleList(
+      instanceManager.getIdentifier(instance)!,
+      ruleListIdentifier,
+    );
+  }
+
+  /// Calls [removeContentRuleList] with the ids of the provided object instances.
+  Future<void> removeContentRuleListForInstances(
+    WKContentRuleListStore instance,
+    String ruleListIdentifier,
+  ) {
+    return removeContentRuleList(
+      instanceManager.getIdentifier(instance)!,
+      ruleListIdentifier,
+    );
+  }
 }
 
 /// Host api implementation for [WKWebViewConfiguration].
@@ -650,6 +838,26 @@ class WKWebViewConfigurationHostApiImpl extends WKWebViewConfigurationHostApi {
       _toWKAudiovisualMediaTypeEnumData(types).toList(),
     );
   }
+
+  /// Calls [useSharedProcessPool] with the ids of the provided object instances.
+  Future<void> useSharedProcessPoolForInstances(
+    WKWebViewConfiguration instance,
+  ) {
+    return useSharedProcessPool(instanceManager.getIdentifier(instance)!);
+  }
+
+  /// Calls [setURLSchemeHandler] with the ids of the provided object instances.
+  Future<void> setURLSchemeHandlerForInstances(
+    WKWebViewConfiguration instance,
+    WKURLSchemeHandler handler,
+    String scheme,
+  ) {
+    return setURLSchemeHandler(
+      instanceManager.getIdentifier(instance)!,
+      instanceManager.getIdentifier(handler)!,
+      scheme,
+    );
+  }
 }
 
 /// Flutter api implementation for [WKWebViewConfiguration].
@@ -791,6 +999,37 @@ class WKNavigationDelegateHostApiImpl extends WKNavigationDelegateHostApi {
   Future<void> createForInstances(WKNavigationDelegate instance) async {
     return create(instanceManager.addDartCreatedInstance(instance));
   }
+
+  /// Calls [setNavigationPolicyRules] with the ids of the provided object
+  /// instances.
+  Future<void> setNavigationPolicyRulesForInstances(
+    WKNavigationDelegate instance,
+    List<WKNavigationPolicyRule> rules,
+    bool forwardsOnlyMainFrameNavigations,
+  ) {
+    return setNavigationPolicyRules(
+      instanceManager.getIdentifier(instance)!,
+      rules
+          .map<WKNavigationPolicyRuleData>(
+            (WKNavigationPolicyRule rule) =>
+                rule.toWKNavigationPolicyRuleData(),
+          )
+          .toList(),
+      forwardsOnlyMainFrameNavigations,
+    );
+  }
+
+  /// Calls [setIncludesRequestDetails] with the ids of the provided object
+  /// instances.
+  Future<void> setIncludesRequestDetailsForInstances(
+    WKNavigationDelegate instance,
+    bool includesRequestDetails,
+  ) {
+    return setIncludesRequestDetails(
+      instanceManager.getIdentifier(instance)!,
+      includesRequestDetails,
+    );
+  }
 }
 
 /// Flutter api implementation for [WKNavigationDelegate].
@@ -1067,6 +1306,57 @@ class WKWebViewHostApiImpl extends WKWebViewHostApi {
     }
   }
 
+  /// Calls [evaluateJavaScriptAsJson] with the ids of the provided object
+  /// instances.
+  Future<String?> evaluateJavaScriptAsJsonForInstances(
+    WKWebView instance,
+    String javaScriptString,
+  ) async {
+    try {
+      return await evaluateJavaScriptAsJson(
+        instanceManager.getIdentifier(instance)!,
+        javaScriptString,
+      );
+    } on PlatformException catch (exception) {
+      if (exception.details is! NSErrorData) {
+        rethrow;
+      }
+
+      throw PlatformException(
+        code: exception.code,
+        message: exception.message,
+        stacktrace: exception.stacktrace,
+        details: (exception.details as NSErrorData).toNSError(),
+      );
+    }
+  }
+
+  /// Calls [callAsyncJavaScript] with the ids of the provided object instances.
+  Future<Object?> callAsyncJavaScriptForInstances(
+    WKWebView instance,
+    String functionBody,
+    Map<String, Object?> arguments,
+  ) async {
+    try {
+      return await callAsyncJavaScript(
+        instanceManager.getIdentifier(instance)!,
+        functionBody,
+        arguments,
+      );
+    } on PlatformException catch (exception) {
+      if (exception.details is! NSErrorData) {
+        rethrow;
+      }
+
+      throw PlatformException(
+        code: exception.code,
+        message: exception.message,
+        stacktrace: exception.stacktrace,
+        details: (exception.details as NSErrorData).toNSError(),
+      );
+    }
+  }
+
   /// Calls [setInspectable] with the ids of the provided object instances.
   Future<void> setInspectableForInstances(
     WKWebView instance,
@@ -1083,6 +1373,22 @@ class WKWebViewHostApiImpl extends WKWebViewHostApi {
     return getCustomUserAgent(instanceManager.getIdentifier(instance)!);
   }
 
+  /// Calls [setSuspendsWhenOffscreen] with the ids of the provided object
+  /// instances.
+  Future<void> setSuspendsWhenOffscreenForInstances(
+    WKWebView instance,
+    bool suspends,
+    Duration? idleTimeout,
+  ) {
+    return setSuspendsWhenOffscreen(
+      instanceManager.getIdentifier(instance)!,
+      suspends,
+      idleTimeout == null
+          ? null
+          : idleTimeout.inMicroseconds / Duration.microsecondsPerSecond,
+    );
+  }
+
   /// Calls [setNavigationDelegate] with the ids of the provided object instances.
   Future<void> setNavigationDelegateForInstances(
     WKWebView instance,
@@ -1104,4 +1410,207 @@ class WKWebViewHostApiImpl extends WKWebViewHostApi {
       delegate != null ? instanceManager.getIdentifier(delegate)! : null,
     );
   }
+
+  /// Calls [prewarm] with the ids of the provided object instances.
+  Future<void> prewarmForInstances(
+    WKWebViewConfiguration configuration,
+    int count,
+  ) {
+    return prewarm(instanceManager.getIdentifier(configuration)!, count);
+  }
+}
+
+/// Host api implementation for [WKWebViewTexture].
+class WKWebViewTextureHostApiImpl extends WKWebViewTextureHostApi {
+  /// Constructs a [WKWebViewTextureHostApiImpl].
+  WKWebViewTextureHostApiImpl({
+    this.binaryMessenger,
+    InstanceManager? instanceManager,
+  })  : instanceManager = instanceManager ?? NSObject.globalInstanceManager,
+        super(binaryMessenger: binaryMessenger);
+
+  /// Sends binary data across the Flutter platform barrier.
+  ///
+  /// If it is null, the default BinaryMessenger will be used which routes to
+  /// the host platform.
+  final BinaryMessenger? binaryMessenger;
+
+  /// Maintains instances stored to communicate with Objective-C objects.
+  final InstanceManager instanceManager;
+
+  /// Calls [create] with the ids of the provided object instances.
+  Future<void> createForInstances(
+    WKWebViewTexture instance,
+    WKWebView webView,
+  ) {
+    return create(
+      instanceManager.addDartCreatedInstance(instance),
+      instanceManager.getIdentifier(webView)!,
+    );
+  }
+
+  /// Calls [getTextureId] with the ids of the provided object instances.
+  Future<int> getTextureIdForInstances(WKWebViewTexture instance) {
+    return getTextureId(instanceManager.getIdentifier(instance)!);
+  }
+
+  /// Calls [setSize] with the ids of the provided object instances.
+  Future<void> setSizeForInstances(
+    WKWebViewTexture instance,
+    double width,
+    double height,
+  ) {
+    return setSize(instanceManager.getIdentifier(instance)!, width, height);
+  }
+
+  /// Calls [update] with the ids of the provided object instances.
+  Future<void> updateForInstances(WKWebViewTexture instance) {
+    return update(instanceManager.getIdentifier(instance)!);
+  }
+}
+
+/// Host api implementation for [WKURLSchemeHandler].
+class WKURLSchemeHandlerHostApiImpl extends WKURLSchemeHandlerHostApi {
+  /// Constructs a [WKURLSchemeHandlerHostApiImpl].
+  WKURLSchemeHandlerHostApiImpl({
+    this.binaryMessenger,
+    InstanceManager? instanceManager,
+  })  : instanceManager = instanceManager ?? NSObject.globalInstanceManager,
+        super(binaryMessenger: binaryMessenger);
+
+  /// Sends binary data across the Flutter platform barrier.
+  ///
+  /// If it is null, the default BinaryMessenger will be used which routes to
+  /// the host platform.
+  final BinaryMessenger? binaryMessenger;
+
+  /// Maintains instances stored to communicate with Objective-C objects.
+  final InstanceManager instanceManager;
+
+  /// Calls [create] with the ids of the provided object instances.
+  Future<void> createForInstances(WKURLSchemeHandler instance) {
+    return create(instanceManager.addDartCreatedInstance(instance));
+  }
+
+  /// Calls [addFileRoute] with the ids of the provided object instances.
+  Future<void> addFileRouteForInstances(
+    WKURLSchemeHandler instance,
+    String pathPrefix,
+    String directoryPath,
+  ) {
+    return addFileRoute(
+      instanceManager.getIdentifier(instance)!,
+      pathPrefix,
+      directoryPath,
+    );
+  }
+
+  /// Calls [addFlutterAssetRoute] with the ids of the provided object
+  /// instances.
+  Future<void> addFlutterAssetRouteForInstances(
+    WKURLSchemeHandler instance,
+    String pathPrefix,
+    String assetDirectory,
+  ) {
+    return addFlutterAssetRoute(
+      instanceManager.getIdentifier(instance)!,
+      pathPrefix,
+      assetDirectory,
+    );
+  }
+
+  /// Calls [didReceiveResponse] with the ids of the provided object instances.
+  Future<void> didReceiveResponseForInstances(
+    WKURLSchemeHandler instance,
+    int taskIdentifier,
+    int statusCode,
+    Map<String, String> headers,
+  ) {
+    return didReceiveResponse(
+      instanceManager.getIdentifier(instance)!,
+      taskIdentifier,
+      statusCode,
+      headers,
+    );
+  }
+
+  /// Calls [didReceiveData] with the ids of the provided object instances.
+  Future<void> didReceiveDataForInstances(
+    WKURLSchemeHandler instance,
+    int taskIdentifier,
+    Uint8List data,
+  ) {
+    return didReceiveData(
+      instanceManager.getIdentifier(instance)!,
+      taskIdentifier,
+      data,
+    );
+  }
+
+  /// Calls [didFinish] with the ids of the provided object instances.
+  Future<void> didFinishForInstances(
+    WKURLSchemeHandler instance,
+    int taskIdentifier,
+  ) {
+    return didFinish(instanceManager.getIdentifier(instance)!, taskIdentifier);
+  }
+
+  /// Calls [didFail] with the ids of the provided object instances.
+  Future<void> didFailForInstances(
+    WKURLSchemeHandler instance,
+    int taskIdentifier,
+    String errorDescription,
+  ) {
+    return didFail(
+      instanceManager.getIdentifier(instance)!,
+      taskIdentifier,
+      errorDescription,
+    );
+  }
+}
+
+/// Flutter api implementation for [WKURLSchemeHandler].
+class WKURLSchemeHandlerFlutterApiImpl extends WKURLSchemeHandlerFlutterApi {
+  /// Constructs a [WKURLSchemeHandlerFlutterApiImpl].
+  WKURLSchemeHandlerFlutterApiImpl({InstanceManager? instanceManager})
+      : instanceManager = instanceManager ?? NSObject.globalInstanceManager;
+
+  /// Maintains instances stored to communicate with native language objects.
+  final InstanceManager instanceManager;
+
+  WKURLSchemeHandler _getHandler(int identifier) {
+    return instanceManager.getInstanceWithWeakReference(identifier)!;
+  }
+
+  @override
+  void startURLSchemeTask(
+    int identifier,
+    int webViewIdentifier,
+    int taskIdentifier,
+    NSUrlRequestData request,
+  ) {
+    final WKURLSchemeHandler handler = _getHandler(identifier);
+    handler.startURLSchemeTask(
+      instanceManager.getInstanceWithWeakReference(webViewIdentifier)!
+          as WKWebView,
+      WKURLSchemeTask(
+        handler: handler,
+        identifier: taskIdentifier,
+        request: request.toNSUrlRequest(),
+      ),
+    );
+  }
+
+  @override
+  void stopURLSchemeTask(
+    int identifier,
+    int webViewIdentifier,
+    int taskIdentifier,
+  ) {
+    _getHandler(identifier).stopURLSchemeTask?.call(
+          instanceManager.getInstanceWithWeakReference(webViewIdentifier)!
+              as WKWebView,
+          taskIdentifier,
+        );
+  }
 }
@@ -4,6 +4,7 @@
 
 import 'common/instance_manager.dart';
 import 'foundation/foundation.dart';
+import 'ui_kit/ui_kit.dart';
 import 'web_kit/web_kit.dart';
 
 // This convenience method was added because Dart doesn't support constant
@@ -11,6 +12,9 @@ import 'web_kit/web_kit.dart';
 WKWebsiteDataStore _defaultWebsiteDataStore() =>
     WKWebsiteDataStore.defaultDataStore;
 
+WKContentRuleListStore _defaultContentRuleListStore() =>
+    WKContentRuleListStore.defaultStore;
+
 /// Handles constructing objects and calling static methods for the WebKit
 /// native library.
 ///
@@ -27,8 +31,13 @@ class WebKitProxy {
     this.createWebViewConfiguration = WKWebViewConfiguration.new,
     this.createScriptMessageHandler = WKScriptMessageHandler.new,
     this.defaultWebsiteDataStore = _defaultWebsiteDataStore,
+    this.defaultContentRuleListStore = _defaultContentRuleListStore,
     this.createNavigationDelegate = WKNavigationDelegate.new,
     this.createUIDelegate = WKUIDelegate.new,
+    this.createScrollViewDelegate = UIScrollViewDelegate.new,
+    this.createWebViewTexture = WKWebViewTexture.new,
+    this.prewarmWebViews = WKWebView.prewarm,
+    this.createURLSchemeHandler = WKURLSchemeHandler.new,
   });
 
   /// Constructs a [WKWebView].
@@ -58,6 +67,9 @@ class WebKitProxy {
   /// The default [WKWebsiteDataStore].
   final WKWebsiteDataStore Function() defaultWebsiteDataStore;
 
+  /// The default [WKContentRuleListStore].
+  final WKContentRuleListStore Function() defaultContentRuleListStore;
+
   /// Constructs a [WKNavigationDelegate].
   final WKNavigationDelegate Function({
     void Function(WKWebView webView, String? url)? didFinishNavigation,
@@ -89,4 +101,34 @@ class WebKitProxy {
     )? requestMediaCapturePermission,
     InstanceManager? instanceManager,
   }) createUIDelegate;
+
+  /// Constructs a [UIScrollViewDelegate].
+  final UIScrollViewDelegate Function({
+    void Function(UIScrollView scrollView, double x, double y)?
+        scrollViewDidScroll,
+    double maximumFrequency,
+    double minimumDelta,
+    InstanceManager? instanceManager,
+  }) createScrollViewDelegate;
+
+  /// Constructs a [WKWebViewTexture].
+  final WKWebViewTexture Function(
+    WKWebView webView, {
+    InstanceManager? instanceManager,
+  }) createWebViewTexture;
+
+  /// Calls [WKWebView.prewarm].
+  final Future<void> Function(
+    WKWebViewConfiguration configuration, {
+    required int count,
+    InstanceManager? instanceManager,
+  }) prewarmWebViews;
+
+  /// Constructs a [WKURLSchemeHandler].
+  final WKURLSchemeHandler Function({
+    required void Function(WKWebView webView, WKURLSchemeTask task)
+        startURLSchemeTask,
+    void Function(WKWebView webView, int taskIdentifier)? stopURLSchemeTask,
+    InstanceManager? instanceManager,
+  }) createURLSchemeHandler;
 }
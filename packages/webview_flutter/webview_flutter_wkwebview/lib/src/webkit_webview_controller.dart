@@ -14,6 +14,7 @@ import 'package:webview_flutter_platform_interface/webview_flutter_platform_inte
 import 'common/instance_manager.dart';
 import 'common/weak_reference_utils.dart';
 import 'foundation/foundation.dart';
+import 'ui_kit/ui_kit.dart';
 import 'web_kit/web_kit.dart';
 import 'webkit_proxy.dart';
 
@@ -37,6 +38,139 @@ enum PlaybackMediaTypes {
   }
 }
 
+/// Loads the resources of URLs with a custom scheme, registered with
+/// [WebKitWebViewControllerCreationParams.urlSchemeHandlers].
+///
+/// Requests whose URL path starts with a key of [fileRoutes] or
+/// [flutterAssetRoutes] are answered natively with the file at the rest of the
+/// path in the directory of that key. Files are memory mapped and don't pass
+/// through Dart, so large bundles load without being copied or extracted. A
+/// path that ends with `/` is answered with the `index.html` of its directory,
+/// and a missing file with a `404` response. Other requests are sent to
+/// [onRequest].
+@immutable
+class WebKitUrlSchemeHandler {
+  /// Constructs a [WebKitUrlSchemeHandler].
+  const WebKitUrlSchemeHandler({
+    this.fileRoutes = const <String, String>{},
+    this.flutterAssetRoutes = const <String, String>{},
+    this.onRequest,
+  });
+
+  /// Directories of files, such as a directory of the app container, by the
+  /// URL path prefix they answer, such as `'/'`.
+  ///
+  /// File routes are matched before Flutter asset routes.
+  final Map<String, String> fileRoutes;
+
+  /// Directories of Flutter assets, such as `'assets/www'`, by the URL path
+  /// prefix they answer.
+  final Map<String, String> flutterAssetRoutes;
+
+  /// Answers the requests that don't match a route.
+  ///
+  /// When null, these requests are answered with a `404` response.
+  final void Function(WebKitUrlSchemeRequest request)? onRequest;
+
+  WKURLSchemeHandler _toWKURLSchemeHandler(
+    WebKitProxy webKitProxy,
+    InstanceManager instanceManager,
+  ) {
+    // The requests that are being answered from Dart, by task identifier.
+    final Map<int, WebKitUrlSchemeRequest> requests =
+        <int, WebKitUrlSchemeRequest>{};
+    final WKURLSchemeHandler handler = webKitProxy.createURLSchemeHandler(
+      startURLSchemeTask: (_, WKURLSchemeTask task) {
+        final WebKitUrlSchemeRequest request = WebKitUrlSchemeRequest._(
+          task,
+          onDone: () => requests.remove(task.identifier),
+        );
+        requests[task.identifier] = request;
+        if (onRequest != null) {
+          onRequest!(request);
+        } else {
+          request.respond(statusCode: 404);
+          request.finish();
+        }
+      },
+      stopURLSchemeTask: (_, int taskIdentifier) {
+        requests.remove(taskIdentifier)?._isStopped = true;
+      },
+      instanceManager: instanceManager,
+    );
+    fileRoutes.forEach(handler.addFileRoute);
+    flutterAssetRoutes.forEach(handler.addFlutterAssetRoute);
+    return handler;
+  }
+}
+
+/// A request of a [WebKitUrlSchemeHandler] that is answered from Dart.
+///
+/// A request is answered with one call to [respond], any number of calls to
+/// [addData] and a final call to [finish], or with a call to [fail]. Data can
+/// be sent in chunks as it becomes available.
+class WebKitUrlSchemeRequest {
+  WebKitUrlSchemeRequest._(this._task, {required void Function() onDone})
+      : _onDone = onDone;
+
+  final WKURLSchemeTask _task;
+  final void Function() _onDone;
+  bool _isStopped = false;
+
+  /// The URL of the request.
+  String get url => _task.request.url;
+
+  /// The HTTP method of the request, such as `'GET'`.
+  String? get method => _task.request.httpMethod;
+
+  /// The HTTP headers of the request.
+  Map<String, String> get headers => _task.request.allHttpHeaderFields;
+
+  /// The body of the request, if any.
+  Uint8List? get body => _task.request.httpBody;
+
+  /// Whether the web view no longer needs the response, for example because
+  /// the page was closed.
+  ///
+  /// Calls on a stopped request are ignored.
+  bool get isStopped => _isStopped;
+
+  /// Sends the status code and headers of the response.
+  ///
+  /// The `Content-Type` header sets the MIME type of the response.
+  Future<void> respond({
+    int statusCode = 200,
+    Map<String, String> headers = const <String, String>{},
+  }) async {
+    if (!_isStopped) {
+      await _task.didReceiveResponse(statusCode: statusCode, headers: headers);
+    }
+  }
+
+  /// Sends the next chunk of the body of the response.
+  Future<void> addData(Uint8List data) async {
+    if (!_isStopped) {
+      await _task.didReceiveData(data);
+    }
+  }
+
+  /// Completes the response.
+  Future<void> finish() async {
+    _onDone();
+    if (!_isStopped) {
+      await _task.didFinish();
+    }
+  }
+
+  /// Fails the request with an error described by [description].
+  Future<void> fail(String description) async {
+    _onDone();
+    if (!_isStopped) {
+      await _task.didFail(description);
+    }
+  }
+}
+
 /// Object specifying creation parameters for a [WebKitWebViewController].
 @immutable
 class WebKitWebViewControllerCreationParams
@@ -50,6 +184,8 @@ class WebKitWebViewControllerCreationParams
     },
     this.allowsInlineMediaPlayback = false,
     this.limitsNavigationsToAppBoundDomains = false,
+    this.usesSharedProcessPool = false,
+    this.urlSchemeHandlers = const <String, WebKitUrlSchemeHandler>{},
     @visibleForTesting InstanceManager? instanceManager,
   }) : _instanceManager = instanceManager ?? NSObject.globalInstanceManager {
     _configuration = webKitProxy.createWebViewConfiguration(
@@ -78,6 +214,15 @@ class WebKitWebViewControllerCreationParams
         limitsNavigationsToAppBoundDomains,
       );
     }
+    if (usesSharedProcessPool) {
+      _configuration.useSharedProcessPool();
+    }
+    urlSchemeHandlers.forEach((String scheme, WebKitUrlSchemeHandler handler) {
+      _configuration.setURLSchemeHandler(
+        handler._toWKURLSchemeHandler(webKitProxy, _instanceManager),
+        scheme,
+      );
+    });
   }
 
   /// Constructs a [WebKitWebViewControllerCreationParams] using a
@@ -94,6 +239,9 @@ class WebKitWebViewControllerCreationParams
     },
     bool allowsInlineMediaPlayback = false,
     bool limitsNavigationsToAppBoundDomains = false,
+    bool usesSharedProcessPool = false,
+    Map<String, WebKitUrlSchemeHandler> urlSchemeHandlers =
+        const <String, WebKitUrlSchemeHandler>{},
     @visibleForTesting InstanceManager? instanceManager,
   }) : this(
           webKitProxy: webKitProxy,
@@ -101,6 +249,8 @@ class WebKitWebViewControllerCreationParams
           allowsInlineMediaPlayback: allowsInlineMediaPlayback,
           limitsNavigationsToAppBoundDomains:
               limitsNavigationsToAppBoundDomains,
+          usesSharedProcessPool: usesSharedProcessPool,
+          urlSchemeHandlers: urlSchemeHandlers,
           instanceManager: instanceManager,
         );
 
@@ -124,6 +274,19 @@ class WebKitWebViewControllerCreationParams
   /// Defaults to false.
   final bool limitsNavigationsToAppBoundDomains;
 
+  /// Whether the web view shares a single web content process pool with the
+  /// other web views created with this option.
+  ///
+  /// Has no effect on iOS 15+, where all web views share one process pool.
+  /// Defaults to false.
+  final bool usesSharedProcessPool;
+
+  /// Handlers that load the resources of URLs with a custom scheme, by
+  /// scheme, such as `'app'`.
+  ///
+  /// A scheme must not be one that WebKit handles, like `https`.
+  final Map<String, WebKitUrlSchemeHandler> urlSchemeHandlers;
+
   /// Handles constructing objects and calling static methods for the WebKit
   /// native library.
   @visibleForTesting
@@ -270,6 +433,14 @@ class WebKitWebViewController extends PlatformWebViewController {
 
   late final WKUIDelegate _uiDelegate;
 
+  // The native delegate is only kept alive while this instance is, because the
+  // scroll view holds its delegate weakly.
+  UIScrollViewDelegate? _scrollViewDelegate;
+
+  // Created the first time a WebKitWebViewWidget with
+  // WebKitWebViewRenderMode.texture displays this controller.
+  WKWebViewTexture? _webViewTexture;
+
   final Map<String, WebKitJavaScriptChannelParams> _javaScriptChannelParams =
       <String, WebKitJavaScriptChannelParams>{};
 
@@ -330,7 +501,7 @@ class WebKitWebViewController extends PlatformWebViewController {
   @override
   Future<void> addJavaScriptChannel(
     JavaScriptChannelParams javaScriptChannelParams,
-  ) {
+  ) async {
     final WebKitJavaScriptChannelParams webKitParams =
         javaScriptChannelParams is WebKitJavaScriptChannelParams
             ? javaScriptChannelParams
@@ -340,14 +511,20 @@ class WebKitWebViewController extends PlatformWebViewController {
 
     _javaScriptChannelParams[webKitParams.name] = webKitParams;
 
-    final String wrapperSource =
-        'window.${webKitParams.name} = webkit.messageHandlers.${webKitParams.name};';
+    final String wrapperSource = webKitParams.onBinaryMessageReceived != null
+        ? _binaryChannelWrapperSource(webKitParams.name)
+        : 'window.${webKitParams.name} = webkit.messageHandlers.${webKitParams.name};';
     final WKUserScript wrapperScript = WKUserScript(
       wrapperSource,
       WKUserScriptInjectionTime.atDocumentStart,
       isMainFrameOnly: false,
     );
     _webView.configuration.userContentController.addUserScript(wrapperScript);
+    if (webKitParams.maxMessageBatchSize != null) {
+      await webKitParams._messageHandler.setMessageBatching(
+        maxBatchSize: webKitParams.maxMessageBatchSize,
+      );
+    }
     return _webView.configuration.userContentController.addScriptMessageHandler(
       webKitParams._messageHandler,
       webKitParams.name,
@@ -418,6 +595,107 @@ class WebKitWebViewController extends PlatformWebViewController {
     }
   }
 
+  /// Runs the given JavaScript and returns its value as a JSON string.
+  ///
+  /// Unlike [runJavaScriptReturningResult], the value is serialized with
+  /// `JSON.stringify` in the page, which avoids converting large objects and
+  /// arrays value by value on the way to Dart. Decode the result with
+  /// `jsonDecode`. Returns null when the value has no JSON representation,
+  /// such as `undefined`.
+  ///
+  /// The script is run with `eval`, so this throws on pages whose Content
+  /// Security Policy does not allow `unsafe-eval`.
+  Future<String?> runJavaScriptReturningJson(String javaScript) {
+    return _webView.evaluateJavaScriptAsJson(javaScript);
+  }
+
+  /// Calls [functionBody] as the body of an async JavaScript function and
+  /// returns the value it resolves to.
+  ///
+  /// Each entry of [arguments] is passed to the function as a variable with
+  /// the entry's key as its name. A `Uint8List` value is passed as a
+  /// `Uint8Array`, and a returned `ArrayBuffer` or typed array is returned as
+  /// a `Uint8List`, without encoding the data in Dart or in the script source.
+  ///
+  /// Only supported on iOS 14+.
+  Future<Object?> callAsyncJavaScript(
+    String functionBody, {
+    Map<String, Object?> arguments = const <String, Object?>{},
+  }) {
+    return _webView.callAsyncJavaScript(functionBody, arguments: arguments);
+  }
+
+  /// Creates [count] web views ahead of time for controllers created with
+  /// [params].
+  ///
+  /// A [WebKitWebViewController] created afterwards with the same [params],
+  /// or with parameters that configure the web view the same way, takes a
+  /// prewarmed web view whose web content process is already running. This
+  /// shortens the time to the first paint of its first page. When the
+  /// controller is garbage collected, its web view is reset and returned to
+  /// the pool so it can be used by the next controller.
+  ///
+  /// Returning web views to the pool is only supported on iOS 14+.
+  static Future<void> prewarmWebViews(
+    WebKitWebViewControllerCreationParams params, {
+    int count = 1,
+  }) {
+    return params.webKitProxy.prewarmWebViews(
+      params._configuration,
+      count: count,
+      instanceManager: params._instanceManager,
+    );
+  }
+
+  /// Adds the content blocker rule list stored under [identifier] to the web
+  /// view.
+  ///
+  /// If [encodedContentRuleList] is provided and no rule list is stored under
+  /// [identifier] yet, it is compiled and stored first. Compiled rule lists
+  /// persist across app launches, so later calls with the same [identifier]
+  /// reuse the stored rule list instead of compiling it again. Use
+  /// [removeContentRuleList] to replace a stored rule list.
+  ///
+  /// Rules are applied by WebKit without a round trip to Dart, which makes
+  /// them much cheaper than blocking requests in a navigation delegate.
+  ///
+  /// Only supported on iOS 11+.
+  Future<void> addContentRuleList(
+    String identifier, {
+    String? encodedContentRuleList,
+  }) async {
+    final WKContentRuleListStore store =
+        _webKitParams.webKitProxy.defaultContentRuleListStore();
+    if (encodedContentRuleList != null &&
+        !await store.containsContentRuleList(identifier)) {
+      await store.compileContentRuleList(identifier, encodedContentRuleList);
+    }
+    return _webView.configuration.userContentController
+        .addContentRuleList(store, identifier);
+  }
+
+  /// Removes all content blocker rule lists from the web view.
+  ///
+  /// The rule lists stay stored and can be added again with
+  /// [addContentRuleList].
+  ///
+  /// Only supported on iOS 11+.
+  Future<void> removeAllContentRuleLists() {
+    return _webView.configuration.userContentController
+        .removeAllContentRuleLists();
+  }
+
+  /// Deletes the content blocker rule list stored under [identifier].
+  ///
+  /// Web views that already use the rule list are not affected.
+  ///
+  /// Only supported on iOS 11+.
+  Future<void> removeContentRuleList(String identifier) {
+    return _webKitParams.webKitProxy
+        .defaultContentRuleListStore()
+        .removeContentRuleList(identifier);
+  }
+
   @override
   Future<Object> runJavaScriptReturningResult(String javaScript) async {
     final Object? result = await _webView.evaluateJavaScript(javaScript);
@@ -455,6 +733,54 @@ class WebKitWebViewController extends PlatformWebViewController {
     return Offset(offset.x, offset.y);
   }
 
+  /// Sets a callback that is notified when the scroll position of the web view
+  /// changes.
+  ///
+  /// Scroll events are throttled before they reach Dart:
+  /// [onScrollPositionChange] is called at most [maximumFrequency] times per
+  /// second and only after the scroll position moved by at least
+  /// [minimumDelta] points along either axis. The position a scroll ends at is
+  /// always reported. A [maximumFrequency] of `0` disables the rate limit.
+  ///
+  /// Passing `null` removes the callback.
+  Future<void> setOnScrollPositionChange(
+    void Function(Offset scrollPosition)? onScrollPositionChange, {
+    double maximumFrequency = 60,
+    double minimumDelta = 0,
+  }) {
+    if (onScrollPositionChange == null) {
+      _scrollViewDelegate = null;
+      return _webView.scrollView.setDelegate(null);
+    }
+
+    _scrollViewDelegate = _webKitParams.webKitProxy.createScrollViewDelegate(
+      scrollViewDidScroll: (_, double x, double y) {
+        onScrollPositionChange(Offset(x, y));
+      },
+      maximumFrequency: maximumFrequency,
+      minimumDelta: minimumDelta,
+      instanceManager: _webKitParams._instanceManager,
+    );
+    return _webView.scrollView.setDelegate(_scrollViewDelegate);
+  }
+
+  /// Takes a new snapshot of the web view for widgets that display this
+  /// controller with [WebKitWebViewRenderMode.texture].
+  ///
+  /// Snapshots are already taken when a page finishes loading and when the
+  /// widget is resized. Call this after the content changed without a
+  /// navigation, e.g. after running JavaScript.
+  Future<void> updateTexture() async {
+    await _webViewTexture?.update();
+  }
+
+  WKWebViewTexture _getOrCreateWebViewTexture() {
+    return _webViewTexture ??= _webKitParams.webKitProxy.createWebViewTexture(
+      _webView,
+      instanceManager: _webKitParams._instanceManager,
+    );
+  }
+
   /// Whether horizontal swipe gestures trigger page navigation.
   Future<void> setAllowsBackForwardNavigationGestures(bool enabled) {
     return _webView.setAllowsBackForwardNavigationGestures(enabled);
@@ -669,6 +995,35 @@ window.addEventListener("error", function(e) {
     return _webView.setInspectable(inspectable);
   }
 
+  /// Sets whether the page is unloaded to free its memory while the web view
+  /// is offscreen, such as in an inactive tab, and restored when it is shown
+  /// again.
+  ///
+  /// Every open web view keeps a web content process with the memory of its
+  /// page, and iOS terminates these processes under memory pressure, which
+  /// forces a full reload. With suspension, the page is unloaded when the app
+  /// receives a memory warning, or after the web view has been offscreen for
+  /// [idleTimeout] if it is not null. When the web view is shown again, its
+  /// history, scroll position and form input are restored behind a snapshot
+  /// of the page. Loads and JavaScript calls made while suspended restore the
+  /// page first. The page reloads, so state that only lives in its scripts is
+  /// lost.
+  ///
+  /// Navigation callbacks are not sent for the unloading and restoring loads,
+  /// and [currentUrl], [getTitle], [canGoBack] and [canGoForward] report the
+  /// unloaded page.
+  ///
+  /// Has no effect before iOS 15.
+  Future<void> setSuspendsWhenOffscreen(
+    bool suspends, {
+    Duration? idleTimeout,
+  }) {
+    return _webView.setSuspendsWhenOffscreen(
+      suspends,
+      idleTimeout: idleTimeout,
+    );
+  }
+
   @override
   Future<String?> getUserAgent() async {
     final String? customUserAgent = await _webView.getCustomUserAgent();
@@ -690,26 +1045,28 @@ window.addEventListener("error", function(e) {
 @immutable
 class WebKitJavaScriptChannelParams extends JavaScriptChannelParams {
   /// Constructs a [WebKitJavaScriptChannelParams].
+  ///
+  /// When [maxMessageBatchSize] is not null, messages are queued natively and
+  /// sent to Dart in batches of up to [maxMessageBatchSize] messages, at most
+  /// about a frame after the first of them was posted. This reduces the
+  /// overhead of channels that receive many messages per second.
+  /// [onMessageReceived] is still called once for each message, in order.
+  ///
+  /// When [onBinaryMessageReceived] is not null, the channel's `postMessage`
+  /// also accepts an `ArrayBuffer` or typed array, and
+  /// [onBinaryMessageReceived] is called with its bytes.
   WebKitJavaScriptChannelParams({
     required super.name,
     required super.onMessageReceived,
+    this.maxMessageBatchSize,
+    this.onBinaryMessageReceived,
     @visibleForTesting WebKitProxy webKitProxy = const WebKitProxy(),
   })  : assert(name.isNotEmpty),
+        assert(maxMessageBatchSize == null || maxMessageBatchSize > 0),
         _messageHandler = webKitProxy.createScriptMessageHandler(
-          didReceiveScriptMessage: withWeakReferenceTo(
+          didReceiveScriptMessage: _createMessageReceiver(
             onMessageReceived,
-            (WeakReference<void Function(JavaScriptMessage)> weakReference) {
-              return (
-                WKUserContentController controller,
-                WKScriptMessage message,
-              ) {
-                if (weakReference.target != null) {
-                  weakReference.target!(
-                    JavaScriptMessage(message: message.body!.toString()),
-                  );
-                }
-              };
-            },
+            onBinaryMessageReceived,
           ),
         );
 
@@ -724,7 +1081,61 @@ class WebKitJavaScriptChannelParams extends JavaScriptChannelParams {
           webKitProxy: webKitProxy,
         );
 
+  /// The number of messages that are queued natively before they are sent to
+  /// Dart, or null to send each message as it is posted.
+  final int? maxMessageBatchSize;
+
+  /// Invoked when an `ArrayBuffer` or typed array is posted to the channel.
+  final void Function(Uint8List bytes)? onBinaryMessageReceived;
+
   final WKScriptMessageHandler _messageHandler;
+
+  // Only weak references to the callbacks are kept, so the message handler
+  // doesn't keep their captured objects alive.
+  static void Function(WKUserContentController, WKScriptMessage)
+      _createMessageReceiver(
+    void Function(JavaScriptMessage) onMessageReceived,
+    void Function(Uint8List)? onBinaryMessageReceived,
+  ) {
+    final WeakReference<void Function(JavaScriptMessage)> messageReference =
+        WeakReference<void Function(JavaScriptMessage)>(onMessageReceived);
+    final WeakReference<void Function(Uint8List)>? binaryMessageReference =
+        onBinaryMessageReceived != null
+            ? WeakReference<void Function(Uint8List)>(onBinaryMessageReceived)
+            : null;
+    return (WKUserContentController controller, WKScriptMessage message) {
+      final Object? body = message.body;
+      final void Function(Uint8List)? binaryMessageCallback =
+          binaryMessageReference?.target;
+      if (body is Uint8List && binaryMessageCallback != null) {
+        binaryMessageCallback(body);
+      } else if (messageReference.target != null) {
+        messageReference.target!(JavaScriptMessage(message: body!.toString()));
+      }
+    };
+  }
+}
+
+// Exposes a channel whose `postMessage` sends an `ArrayBuffer` or typed array
+// as a base64 string, which the plugin decodes natively, because WebKit only
+// passes property list types to script message handlers.
+String _binaryChannelWrapperSource(String name) {
+  return '''
+window.$name = {
+  postMessage: function(message) {
+    if (message instanceof ArrayBuffer || ArrayBuffer.isView(message)) {
+      const bytes = message instanceof ArrayBuffer
+          ? new Uint8Array(message)
+          : new Uint8Array(message.buffer, message.byteOffset, message.byteLength);
+      let binary = '';
+      for (let i = 0; i < bytes.length; i += 0x8000) {
+        binary += String.fromCharCode.apply(null, bytes.subarray(i, i + 0x8000));
+      }
+      message = {__flutterBinaryData: btoa(binary)};
+    }
+    webkit.messageHandlers.$name.postMessage(message);
+  }
+};''';
 }
 
 /// Object specifying creation parameters for a [WebKitWebViewWidget].
@@ -737,6 +1148,7 @@ class WebKitWebViewWidgetCreationParams
     required super.controller,
     super.layoutDirection,
     super.gestureRecognizers,
+    this.renderMode = WebKitWebViewRenderMode.platformView,
     @visibleForTesting InstanceManager? instanceManager,
   }) : _instanceManager = instanceManager ?? NSObject.globalInstanceManager;
 
@@ -753,6 +1165,11 @@ class WebKitWebViewWidgetCreationParams
           instanceManager: instanceManager,
         );
 
+  /// How the web view is composited into the Flutter scene.
+  ///
+  /// Defaults to [WebKitWebViewRenderMode.platformView].
+  final WebKitWebViewRenderMode renderMode;
+
   // Maintains instances used to communicate with the native objects they
   // represent.
   final InstanceManager _instanceManager;
@@ -761,6 +1178,7 @@ class WebKitWebViewWidgetCreationParams
   int get hashCode => Object.hash(
         controller,
         layoutDirection,
+        renderMode,
         _instanceManager,
       );
 
@@ -769,6 +1187,7 @@ class WebKitWebViewWidgetCreationParams
     return other is WebKitWebViewWidgetCreationParams &&
         controller == other.controller &&
         layoutDirection == other.layoutDirection &&
+        renderMode == other.renderMode &&
         _instanceManager == other._instanceManager;
   }
 }
@@ -789,6 +1208,13 @@ class WebKitWebViewWidget extends PlatformWebViewWidget {
 
   @override
   Widget build(BuildContext context) {
+    if (_webKitParams.renderMode == WebKitWebViewRenderMode.texture) {
+      return _WebKitWebViewTexture(
+        key: _webKitParams.key,
+        controller: params.controller as WebKitWebViewController,
+      );
+    }
+
     return UiKitView(
       // Setting a default key using `params` ensures the `UIKitView` recreates
       // the PlatformView when changes are made.
@@ -806,6 +1232,86 @@ class WebKitWebViewWidget extends PlatformWebViewWidget {
   }
 }
 
+/// How a [WebKitWebViewWidget] composites the web view into the Flutter
+/// scene.
+enum WebKitWebViewRenderMode {
+  /// The web view is embedded as a platform view.
+  ///
+  /// The web view is fully interactive, but every frame that shows it is
+  /// composited with the native view hierarchy.
+  platformView,
+
+  /// Snapshots of the web view are displayed in a [Texture].
+  ///
+  /// Meant for mostly static content, such as receipts or rich text cards,
+  /// that is drawn many times per frame or inside scrolling Flutter content.
+  /// The web view does not receive touches and the snapshot is only refreshed
+  /// when a page finishes loading, when the widget is resized and when
+  /// [WebKitWebViewController.updateTexture] is called.
+  texture,
+}
+
+class _WebKitWebViewTexture extends StatefulWidget {
+  const _WebKitWebViewTexture({super.key, required this.controller});
+
+  final WebKitWebViewController controller;
+
+  @override
+  State<_WebKitWebViewTexture> createState() => _WebKitWebViewTextureState();
+}
+
+class _WebKitWebViewTextureState extends State<_WebKitWebViewTexture> {
+  int? _textureId;
+  Size? _size;
+
+  @override
+  void initState() {
+    super.initState();
+    _loadTextureId();
+  }
+
+  @override
+  void didUpdateWidget(_WebKitWebViewTexture oldWidget) {
+    super.didUpdateWidget(oldWidget);
+    if (oldWidget.controller != widget.controller) {
+      _textureId = null;
+      _size = null;
+      _loadTextureId();
+    }
+  }
+
+  Future<void> _loadTextureId() async {
+    final WebKitWebViewController controller = widget.controller;
+    final int textureId =
+        await controller._getOrCreateWebViewTexture().getTextureId();
+    if (mounted && widget.controller == controller) {
+      setState(() {
+        _textureId = textureId;
+      });
+    }
+  }
+
+  @override
+  Widget build(BuildContext context) {
+    return LayoutBuilder(
+      builder: (BuildContext context, BoxConstraints constraints) {
+        final Size size = constraints.biggest;
+        if (size != _size && size.isFinite) {
+          _size = size;
+          widget.controller
+              ._getOrCreateWebViewTexture()
+              .setSize(size.width, size.height);
+        }
+
+        final int? textureId = _textureId;
+        return SizedBox.expand(
+          child: textureId != null ? Texture(textureId: textureId) : null,
+        );
+      },
+    );
+  }
+}
+
 /// An implementation of [WebResourceError] with the WebKit API.
 class WebKitWebResourceError extends WebResourceError {
   WebKitWebResourceError._(
@@ -842,6 +1348,55 @@ class WebKitWebResourceError extends WebResourceError {
   final NSError _nsError;
 }
 
+/// A rule that decides natively whether navigation requests to matching URLs
+/// proceed, without calling the callback of
+/// [WebKitNavigationDelegate.setOnNavigationRequest].
+///
+/// A rule matches a URL when each of its non-null conditions match.
+@immutable
+class WebKitNavigationPolicyRule {
+  /// Constructs a [WebKitNavigationPolicyRule].
+  const WebKitNavigationPolicyRule({
+    this.host,
+    this.scheme,
+    this.urlPattern,
+    required this.decision,
+  });
+
+  /// The host the URL must have, or one of its subdomains, such as
+  /// `'example.com'`.
+  final String? host;
+
+  /// The scheme the URL must have, such as `'https'`.
+  final String? scheme;
+
+  /// A regular expression, in the syntax of `NSRegularExpression`, that must
+  /// match a part of the URL.
+  final String? urlPattern;
+
+  /// Whether navigation requests to matching URLs proceed.
+  final NavigationDecision decision;
+
+  WKNavigationPolicyRule _toWKNavigationPolicyRule() {
+    late final WKNavigationActionPolicy policy;
+    switch (decision) {
+      case NavigationDecision.prevent:
+        policy = WKNavigationActionPolicy.cancel;
+        break;
+      case NavigationDecision.navigate:
+        policy = WKNavigationActionPolicy.allow;
+        break;
+    }
+
+    return WKNavigationPolicyRule(
+      host: host,
+      scheme: scheme,
+      urlPattern: urlPattern,
+      policy: policy,
+    );
+  }
+}
+
 /// Object specifying creation parameters for a [WebKitNavigationDelegate].
 @immutable
 class WebKitNavigationDelegateCreationParams
@@ -994,6 +1549,31 @@ class WebKitNavigationDelegate extends PlatformNavigationDelegate {
   Future<void> setOnUrlChange(UrlChangeCallback onUrlChange) async {
     _onUrlChange = onUrlChange;
   }
+
+  /// Sets rules that decide natively whether navigation requests proceed.
+  ///
+  /// The first rule that matches the URL of a navigation request decides it
+  /// without a round trip to Dart, which keeps pages that load many frames
+  /// from waiting on the callback of [setOnNavigationRequest]. Requests that
+  /// match no rule are sent to that callback, except that requests for
+  /// subframes proceed without it when [forwardsOnlyMainFrameNavigations] is
+  /// true.
+  ///
+  /// Replaces the rules set by a previous call.
+  Future<void> setNavigationPolicyRules(
+    List<WebKitNavigationPolicyRule> rules, {
+    bool forwardsOnlyMainFrameNavigations = false,
+  }) {
+    return _navigationDelegate.setNavigationPolicyRules(
+      rules
+          .map<WKNavigationPolicyRule>(
+            (WebKitNavigationPolicyRule rule) =>
+                rule._toWKNavigationPolicyRule(),
+          )
+          .toList(),
+      forwardsOnlyMainFrameNavigations: forwardsOnlyMainFrameNavigations,
+    );
+  }
 }
 
 /// WebKit implementation of [PlatformWebViewPermissionRequest].
@@ -60,21 +60,60 @@ class WebKitWebViewCookieManager extends PlatformWebViewCookieManager {
 
   @override
   Future<void> setCookie(WebViewCookie cookie) {
+    return _webkitParams._websiteDataStore.httpCookieStore.setCookie(
+      _toNSHttpCookie(cookie),
+    );
+  }
+
+  /// Sets multiple cookies for all [WKWebView] instances.
+  ///
+  /// All cookies are sent to the platform in a single message and stored
+  /// concurrently, which is faster than calling [setCookie] for each one.
+  Future<void> setCookies(List<WebViewCookie> cookies) {
+    return _webkitParams._websiteDataStore.httpCookieStore.setCookies(
+      cookies.map<NSHttpCookie>(_toNSHttpCookie).toList(),
+    );
+  }
+
+  /// Returns all cookies stored for [WKWebView] instances.
+  ///
+  /// Cookies missing a name, value or domain are omitted.
+  Future<List<WebViewCookie>> getCookies() async {
+    final List<NSHttpCookie> cookies =
+        await _webkitParams._websiteDataStore.httpCookieStore.getAllCookies();
+    return cookies
+        .where((NSHttpCookie cookie) {
+          return cookie.properties[NSHttpCookiePropertyKey.name] is String &&
+              cookie.properties[NSHttpCookiePropertyKey.value] is String &&
+              cookie.properties[NSHttpCookiePropertyKey.domain] is String;
+        })
+        .map<WebViewCookie>((NSHttpCookie cookie) {
+          final Object? path = cookie.properties[NSHttpCookiePropertyKey.path];
+          return WebViewCookie(
+            name: cookie.properties[NSHttpCookiePropertyKey.name]! as String,
+            value: cookie.properties[NSHttpCookiePropertyKey.value]! as String,
+            domain:
+                cookie.properties[NSHttpCookiePropertyKey.domain]! as String,
+            path: path is String ? path : '/',
+          );
+        })
+        .toList();
+  }
+
+  NSHttpCookie _toNSHttpCookie(WebViewCookie cookie) {
     if (!_isValidPath(cookie.path)) {
       throw ArgumentError(
         'The path property for the provided cookie was not given a legal value.',
       );
     }
 
-    return _webkitParams._websiteDataStore.httpCookieStore.setCookie(
-      NSHttpCookie.withProperties(
-        <NSHttpCookiePropertyKey, Object>{
-          NSHttpCookiePropertyKey.name: cookie.name,
-          NSHttpCookiePropertyKey.value: cookie.value,
-          NSHttpCookiePropertyKey.domain: cookie.domain,
-          NSHttpCookiePropertyKey.path: cookie.path,
-        },
-      ),
+    return NSHttpCookie.withProperties(
+      <NSHttpCookiePropertyKey, Object>{
+        NSHttpCookiePropertyKey.name: cookie.name,
+        NSHttpCookiePropertyKey.value: cookie.value,
+        NSHttpCookiePropertyKey.domain: cookie.domain,
+        NSHttpCookiePropertyKey.path: cookie.path,
+      },
     );
   }
 
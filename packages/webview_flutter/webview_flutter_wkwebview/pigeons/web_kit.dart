@@ -332,6 +332,23 @@ class NSHttpCookieData {
   late List<Object?> propertyValues;
 }
 
+/// A rule that decides the policy of matching navigation actions without
+/// calling `WKNavigationDelegateFlutterApi.decidePolicyForNavigationAction`.
+///
+/// A rule matches a URL when each of its non-null fields match.
+class WKNavigationPolicyRuleData {
+  /// The host the URL must have, or one of its subdomains.
+  String? host;
+
+  /// The scheme the URL must have.
+  String? scheme;
+
+  /// A regular expression that must match a part of the URL.
+  String? urlPattern;
+
+  late WKNavigationActionPolicyEnum policy;
+}
+
 /// An object that can represent either a value supported by
 /// `StandardMessageCodec`, a data class in this pigeon file, or an identifier
 /// of an object stored in an `InstanceManager`.
@@ -398,6 +415,36 @@ abstract class UIScrollViewHostApi {
 
   @ObjCSelector('setContentOffsetForScrollViewWithIdentifier:toX:y:')
   void setContentOffset(int identifier, double x, double y);
+
+  @ObjCSelector(
+    'setDelegateForScrollViewWithIdentifier:uiScrollViewDelegateIdentifier:',
+  )
+  void setDelegate(int identifier, int? uiScrollViewDelegateIdentifier);
+}
+
+/// Mirror of UIScrollViewDelegate.
+///
+/// See https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc.
+@HostApi(dartHostTestHandler: 'TestUIScrollViewDelegateHostApi')
+abstract class UIScrollViewDelegateHostApi {
+  @ObjCSelector('createWithIdentifier:maximumFrequency:minimumDelta:')
+  void create(int identifier, double maximumFrequency, double minimumDelta);
+}
+
+/// Handles callbacks from a UIScrollViewDelegate instance.
+///
+/// See https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc.
+@FlutterApi()
+abstract class UIScrollViewDelegateFlutterApi {
+  @ObjCSelector(
+    'scrollViewDidScrollWithIdentifier:uiScrollViewIdentifier:x:y:',
+  )
+  void scrollViewDidScroll(
+    int identifier,
+    int uiScrollViewIdentifier,
+    double x,
+    double y,
+  );
 }
 
 /// Mirror of WKWebViewConfiguration.
@@ -428,6 +475,18 @@ abstract class WKWebViewConfigurationHostApi {
     int identifier,
     List<WKAudiovisualMediaTypeEnumData> types,
   );
+
+  @ObjCSelector('useSharedProcessPoolForConfigurationWithIdentifier:')
+  void useSharedProcessPool(int identifier);
+
+  @ObjCSelector(
+    'setURLSchemeHandlerForConfigurationWithIdentifier:handlerIdentifier:scheme:',
+  )
+  void setURLSchemeHandler(
+    int identifier,
+    int handlerIdentifier,
+    String scheme,
+  );
 }
 
 /// Handles callbacks from a WKWebViewConfiguration instance.
@@ -472,6 +531,50 @@ abstract class WKUserContentControllerHostApi {
 
   @ObjCSelector('removeAllUserScriptsForControllerWithIdentifier:')
   void removeAllUserScripts(int identifier);
+
+  @ObjCSelector(
+    'addContentRuleListForControllerWithIdentifier:storeIdentifier:ruleListIdentifier:',
+  )
+  @async
+  void addContentRuleList(
+    int identifier,
+    int storeIdentifier,
+    String ruleListIdentifier,
+  );
+
+  @ObjCSelector('removeAllContentRuleListsForControllerWithIdentifier:')
+  void removeAllContentRuleLists(int identifier);
+}
+
+/// Mirror of WKContentRuleListStore.
+///
+/// See https://developer.apple.com/documentation/webkit/wkcontentruleliststore?language=objc.
+@HostApi(dartHostTestHandler: 'TestWKContentRuleListStoreHostApi')
+abstract class WKContentRuleListStoreHostApi {
+  @ObjCSelector('createDefaultStoreWithIdentifier:')
+  void createDefaultStore(int identifier);
+
+  @ObjCSelector(
+    'compileContentRuleListForStoreWithIdentifier:ruleListIdentifier:encodedContentRuleList:',
+  )
+  @async
+  void compileContentRuleList(
+    int identifier,
+    String ruleListIdentifier,
+    String encodedContentRuleList,
+  );
+
+  @ObjCSelector(
+    'containsContentRuleListForStoreWithIdentifier:ruleListIdentifier:',
+  )
+  @async
+  bool containsContentRuleList(int identifier, String ruleListIdentifier);
+
+  @ObjCSelector(
+    'removeContentRuleListForStoreWithIdentifier:ruleListIdentifier:',
+  )
+  @async
+  void removeContentRuleList(int identifier, String ruleListIdentifier);
 }
 
 /// Mirror of WKUserPreferences.
@@ -498,6 +601,9 @@ abstract class WKPreferencesHostApi {
 abstract class WKScriptMessageHandlerHostApi {
   @ObjCSelector('createWithIdentifier:')
   void create(int identifier);
+
+  @ObjCSelector('setMessageBatchingForHandlerWithIdentifier:maxBatchSize:')
+  void setMessageBatching(int identifier, int? maxBatchSize);
 }
 
 /// Handles callbacks from a WKScriptMessageHandler instance.
@@ -513,6 +619,15 @@ abstract class WKScriptMessageHandlerFlutterApi {
     int userContentControllerIdentifier,
     WKScriptMessageData message,
   );
+
+  @ObjCSelector(
+    'didReceiveScriptMessagesForHandlerWithIdentifier:userContentControllerIdentifier:messages:',
+  )
+  void didReceiveScriptMessages(
+    int identifier,
+    int userContentControllerIdentifier,
+    List<WKScriptMessageData> messages,
+  );
 }
 
 /// Mirror of WKNavigationDelegate.
@@ -522,6 +637,20 @@ abstract class WKScriptMessageHandlerFlutterApi {
 abstract class WKNavigationDelegateHostApi {
   @ObjCSelector('createWithIdentifier:')
   void create(int identifier);
+
+  @ObjCSelector(
+    'setNavigationPolicyRulesForDelegateWithIdentifier:rules:forwardsOnlyMainFrameNavigations:',
+  )
+  void setNavigationPolicyRules(
+    int identifier,
+    List<WKNavigationPolicyRuleData> rules,
+    bool forwardsOnlyMainFrameNavigations,
+  );
+
+  @ObjCSelector(
+    'setIncludesRequestDetailsForDelegateWithIdentifier:includesRequestDetails:',
+  )
+  void setIncludesRequestDetails(int identifier, bool includesRequestDetails);
 }
 
 /// Handles callbacks from a WKNavigationDelegate instance.
@@ -695,11 +824,39 @@ abstract class WKWebViewHostApi {
   @async
   Object? evaluateJavaScript(int identifier, String javaScriptString);
 
+  @ObjCSelector(
+    'evaluateJavaScriptAsJSONForWebViewWithIdentifier:javaScriptString:',
+  )
+  @async
+  String? evaluateJavaScriptAsJson(int identifier, String javaScriptString);
+
+  @ObjCSelector(
+    'callAsyncJavaScriptForWebViewWithIdentifier:functionBody:arguments:',
+  )
+  @async
+  Object? callAsyncJavaScript(
+    int identifier,
+    String functionBody,
+    Map<String, Object?> arguments,
+  );
+
   @ObjCSelector('setInspectableForWebViewWithIdentifier:inspectable:')
   void setInspectable(int identifier, bool inspectable);
 
   @ObjCSelector('customUserAgentForWebViewWithIdentifier:')
   String? getCustomUserAgent(int identifier);
+
+  @ObjCSelector('prewarmWebViewsWithConfigurationIdentifier:count:')
+  void prewarm(int configurationIdentifier, int count);
+
+  @ObjCSelector(
+    'setSuspendsWhenOffscreenForWebViewWithIdentifier:suspends:idleTimeoutSeconds:',
+  )
+  void setSuspendsWhenOffscreen(
+    int identifier,
+    bool suspends,
+    double? idleTimeoutSeconds,
+  );
 }
 
 /// Mirror of WKUIDelegate.
@@ -754,6 +911,14 @@ abstract class WKHttpCookieStoreHostApi {
   @ObjCSelector('setCookieForStoreWithIdentifier:cookie:')
   @async
   void setCookie(int identifier, NSHttpCookieData cookie);
+
+  @ObjCSelector('setCookiesForStoreWithIdentifier:cookies:')
+  @async
+  void setCookies(int identifier, List<NSHttpCookieData> cookies);
+
+  @ObjCSelector('allCookiesForStoreWithIdentifier:')
+  @async
+  List<NSHttpCookieData> getAllCookies(int identifier);
 }
 
 /// Host API for `NSUrl`.
@@ -781,3 +946,99 @@ abstract class NSUrlFlutterApi {
   @ObjCSelector('createWithIdentifier:')
   void create(int identifier);
 }
+
+/// Host API for a Flutter texture that displays snapshots of a WKWebView.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/webkit/wkwebview/2873260-takesnapshotwithconfiguration?language=objc.
+@HostApi(dartHostTestHandler: 'TestWKWebViewTextureHostApi')
+abstract class WKWebViewTextureHostApi {
+  @ObjCSelector('createWithIdentifier:webViewIdentifier:')
+  void create(int identifier, int webViewIdentifier);
+
+  @ObjCSelector('textureIdForTextureWithIdentifier:')
+  int getTextureId(int identifier);
+
+  @ObjCSelector('setSizeForTextureWithIdentifier:width:height:')
+  void setSize(int identifier, double width, double height);
+
+  @ObjCSelector('updateTextureWithIdentifier:')
+  @async
+  void update(int identifier);
+}
+
+/// Host API for `WKURLSchemeHandler`.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc.
+@HostApi(dartHostTestHandler: 'TestWKURLSchemeHandlerHostApi')
+abstract class WKURLSchemeHandlerHostApi {
+  @ObjCSelector('createWithIdentifier:')
+  void create(int identifier);
+
+  @ObjCSelector(
+    'addFileRouteForHandlerWithIdentifier:pathPrefix:directoryPath:',
+  )
+  void addFileRoute(int identifier, String pathPrefix, String directoryPath);
+
+  @ObjCSelector(
+    'addFlutterAssetRouteForHandlerWithIdentifier:pathPrefix:assetDirectory:',
+  )
+  void addFlutterAssetRoute(
+    int identifier,
+    String pathPrefix,
+    String assetDirectory,
+  );
+
+  @ObjCSelector(
+    'didReceiveResponseForHandlerWithIdentifier:taskIdentifier:statusCode:headers:',
+  )
+  void didReceiveResponse(
+    int identifier,
+    int taskIdentifier,
+    int statusCode,
+    Map<String?, String?> headers,
+  );
+
+  @ObjCSelector('didReceiveDataForHandlerWithIdentifier:taskIdentifier:data:')
+  void didReceiveData(int identifier, int taskIdentifier, Uint8List data);
+
+  @ObjCSelector('didFinishForHandlerWithIdentifier:taskIdentifier:')
+  void didFinish(int identifier, int taskIdentifier);
+
+  @ObjCSelector(
+    'didFailForHandlerWithIdentifier:taskIdentifier:errorDescription:',
+  )
+  void didFail(int identifier, int taskIdentifier, String errorDescription);
+}
+
+/// Handles callbacks from a WKURLSchemeHandler instance.
+///
+/// See https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc.
+@FlutterApi()
+abstract class WKURLSchemeHandlerFlutterApi {
+  @ObjCSelector(
+    'startURLSchemeTaskForHandlerWithIdentifier:webViewIdentifier:taskIdentifier:request:',
+  )
+  void startURLSchemeTask(
+    int identifier,
+    int webViewIdentifier,
+    int taskIdentifier,
+    NSUrlRequestData request,
+  );
+
+  @ObjCSelector(
+    'stopURLSchemeTaskForHandlerWithIdentifier:webViewIdentifier:taskIdentifier:',
+  )
+  void stopURLSchemeTask(
+    int identifier,
+    int webViewIdentifier,
+    int taskIdentifier,
+  );
+}
@@ -194,6 +194,16 @@ class MockUIScrollView extends _i1.Mock implements _i3.UIScrollView {
         returnValueForMissingStub: _i5.Future<void>.value(),
       ) as _i5.Future<void>);
   @override
+  _i5.Future<void> setDelegate(_i3.UIScrollViewDelegate? delegate) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setDelegate,
+          [delegate],
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
   _i3.UIScrollView copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -269,6 +279,30 @@ class MockWKNavigationDelegate extends _i1.Mock
     _i1.throwOnMissingStub(this);
   }
 
+  @override
+  _i5.Future<void> setNavigationPolicyRules(
+    List<_i4.WKNavigationPolicyRule>? rules, {
+    bool? forwardsOnlyMainFrameNavigations = false,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setNavigationPolicyRules,
+          [rules],
+          {#forwardsOnlyMainFrameNavigations: forwardsOnlyMainFrameNavigations},
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
+  _i5.Future<void> setIncludesRequestDetails(bool? includesRequestDetails) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setIncludesRequestDetails,
+          [includesRequestDetails],
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
   @override
   _i4.WKNavigationDelegate copy() => (super.noSuchMethod(
         Invocation.method(
@@ -408,6 +442,17 @@ class MockWKScriptMessageHandler extends _i1.Mock
         _i4.WKScriptMessage,
       ));
   @override
+  _i5.Future<void> setMessageBatching({int? maxBatchSize}) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setMessageBatching,
+          [],
+          {#maxBatchSize: maxBatchSize},
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
   _i4.WKScriptMessageHandler copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -643,6 +688,28 @@ class MockWKWebView extends _i1.Mock implements _i4.WKWebView {
         returnValue: _i5.Future<Object?>.value(),
       ) as _i5.Future<Object?>);
   @override
+  _i5.Future<String?> evaluateJavaScriptAsJson(String? javaScriptString) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #evaluateJavaScriptAsJson,
+          [javaScriptString],
+        ),
+        returnValue: _i5.Future<String?>.value(),
+      ) as _i5.Future<String?>);
+  @override
+  _i5.Future<Object?> callAsyncJavaScript(
+    String? functionBody, {
+    Map<String, Object?>? arguments = const {},
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #callAsyncJavaScript,
+          [functionBody],
+          {#arguments: arguments},
+        ),
+        returnValue: _i5.Future<Object?>.value(),
+      ) as _i5.Future<Object?>);
+  @override
   _i5.Future<void> setInspectable(bool? inspectable) => (super.noSuchMethod(
         Invocation.method(
           #setInspectable,
@@ -660,6 +727,20 @@ class MockWKWebView extends _i1.Mock implements _i4.WKWebView {
         returnValue: _i5.Future<String?>.value(),
       ) as _i5.Future<String?>);
   @override
+  _i5.Future<void> setSuspendsWhenOffscreen(
+    bool? suspends, {
+    Duration? idleTimeout,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setSuspendsWhenOffscreen,
+          [suspends],
+          {#idleTimeout: idleTimeout},
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
   _i4.WKWebView copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -791,6 +872,31 @@ class MockWKWebViewConfiguration extends _i1.Mock
         returnValueForMissingStub: _i5.Future<void>.value(),
       ) as _i5.Future<void>);
   @override
+  _i5.Future<void> useSharedProcessPool() => (super.noSuchMethod(
+        Invocation.method(
+          #useSharedProcessPool,
+          [],
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
+  _i5.Future<void> setURLSchemeHandler(
+    _i4.WKURLSchemeHandler? handler,
+    String? scheme,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setURLSchemeHandler,
+          [
+            handler,
+            scheme,
+          ],
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
   _i4.WKWebViewConfiguration copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -1041,6 +1147,31 @@ class MockWKUserContentController extends _i1.Mock
         returnValueForMissingStub: _i5.Future<void>.value(),
       ) as _i5.Future<void>);
   @override
+  _i5.Future<void> addContentRuleList(
+    _i4.WKContentRuleListStore? store,
+    String? identifier,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addContentRuleList,
+          [
+            store,
+            identifier,
+          ],
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
+  _i5.Future<void> removeAllContentRuleLists() => (super.noSuchMethod(
+        Invocation.method(
+          #removeAllContentRuleLists,
+          [],
+        ),
+        returnValue: _i5.Future<void>.value(),
+        returnValueForMissingStub: _i5.Future<void>.value(),
+      ) as _i5.Future<void>);
+  @override
   _i4.WKUserContentController copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
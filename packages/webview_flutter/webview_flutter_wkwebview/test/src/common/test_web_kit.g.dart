@@ -260,6 +260,8 @@ abstract class TestUIScrollViewHostApi {
 
   void setContentOffset(int identifier, double x, double y);
 
+  void setDelegate(int identifier, int? uiScrollViewDelegateIdentifier);
+
   static void setup(TestUIScrollViewHostApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
@@ -397,6 +399,90 @@ abstract class TestUIScrollViewHostApi {
         });
       }
     }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewHostApi.setDelegate',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewHostApi.setDelegate was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewHostApi.setDelegate was null, expected non-null int.');
+          final int? arg_uiScrollViewDelegateIdentifier = (args[1] as int?);
+          try {
+            api.setDelegate(
+                arg_identifier!, arg_uiScrollViewDelegateIdentifier);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
+
+/// Mirror of UIScrollViewDelegate.
+///
+/// See https://developer.apple.com/documentation/uikit/uiscrollviewdelegate?language=objc.
+abstract class TestUIScrollViewDelegateHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  void create(int identifier, double maximumFrequency, double minimumDelta);
+
+  static void setup(TestUIScrollViewDelegateHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateHostApi.create',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateHostApi.create was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateHostApi.create was null, expected non-null int.');
+          final double? arg_maximumFrequency = (args[1] as double?);
+          assert(arg_maximumFrequency != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateHostApi.create was null, expected non-null double.');
+          final double? arg_minimumDelta = (args[2] as double?);
+          assert(arg_minimumDelta != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.UIScrollViewDelegateHostApi.create was null, expected non-null double.');
+          try {
+            api.create(
+                arg_identifier!, arg_maximumFrequency!, arg_minimumDelta!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
   }
 }
 
@@ -443,6 +529,11 @@ abstract class TestWKWebViewConfigurationHostApi {
   void setMediaTypesRequiringUserActionForPlayback(
       int identifier, List<WKAudiovisualMediaTypeEnumData?> types);
 
+  void useSharedProcessPool(int identifier);
+
+  void setURLSchemeHandler(
+      int identifier, int handlerIdentifier, String scheme);
+
   static void setup(TestWKWebViewConfigurationHostApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
@@ -611,6 +702,73 @@ abstract class TestWKWebViewConfigurationHostApi {
         });
       }
     }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.useSharedProcessPool',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.useSharedProcessPool was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.useSharedProcessPool was null, expected non-null int.');
+          try {
+            api.useSharedProcessPool(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.setURLSchemeHandler',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.setURLSchemeHandler was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.setURLSchemeHandler was null, expected non-null int.');
+          final int? arg_handlerIdentifier = (args[1] as int?);
+          assert(arg_handlerIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.setURLSchemeHandler was null, expected non-null int.');
+          final String? arg_scheme = (args[2] as String?);
+          assert(arg_scheme != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewConfigurationHostApi.setURLSchemeHandler was null, expected non-null String.');
+          try {
+            api.setURLSchemeHandler(
+                arg_identifier!, arg_handlerIdentifier!, arg_scheme!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
   }
 }
 
@@ -665,6 +823,11 @@ abstract class TestWKUserContentControllerHostApi {
 
   void removeAllUserScripts(int identifier);
 
+  Future<void> addContentRuleList(
+      int identifier, int storeIdentifier, String ruleListIdentifier);
+
+  void removeAllContentRuleLists(int identifier);
+
   static void setup(TestWKUserContentControllerHostApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
@@ -865,27 +1028,9 @@ abstract class TestWKUserContentControllerHostApi {
         });
       }
     }
-  }
-}
-
-/// Mirror of WKUserPreferences.
-///
-/// See https://developer.apple.com/documentation/webkit/wkpreferences?language=objc.
-abstract class TestWKPreferencesHostApi {
-  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
-      TestDefaultBinaryMessengerBinding.instance;
-  static const MessageCodec<Object?> codec = StandardMessageCodec();
-
-  void createFromWebViewConfiguration(
-      int identifier, int configurationIdentifier);
-
-  void setJavaScriptEnabled(int identifier, bool enabled);
-
-  static void setup(TestWKPreferencesHostApi? api,
-      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.addContentRuleList',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -896,17 +1041,20 @@ abstract class TestWKPreferencesHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.addContentRuleList was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration was null, expected non-null int.');
-          final int? arg_configurationIdentifier = (args[1] as int?);
-          assert(arg_configurationIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.addContentRuleList was null, expected non-null int.');
+          final int? arg_storeIdentifier = (args[1] as int?);
+          assert(arg_storeIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.addContentRuleList was null, expected non-null int.');
+          final String? arg_ruleListIdentifier = (args[2] as String?);
+          assert(arg_ruleListIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.addContentRuleList was null, expected non-null String.');
           try {
-            api.createFromWebViewConfiguration(
-                arg_identifier!, arg_configurationIdentifier!);
+            await api.addContentRuleList(
+                arg_identifier!, arg_storeIdentifier!, arg_ruleListIdentifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -919,7 +1067,7 @@ abstract class TestWKPreferencesHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.removeAllContentRuleLists',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -930,16 +1078,13 @@ abstract class TestWKPreferencesHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.removeAllContentRuleLists was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled was null, expected non-null int.');
-          final bool? arg_enabled = (args[1] as bool?);
-          assert(arg_enabled != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled was null, expected non-null bool.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUserContentControllerHostApi.removeAllContentRuleLists was null, expected non-null int.');
           try {
-            api.setJavaScriptEnabled(arg_identifier!, arg_enabled!);
+            api.removeAllContentRuleLists(arg_identifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -953,21 +1098,29 @@ abstract class TestWKPreferencesHostApi {
   }
 }
 
-/// Mirror of WKScriptMessageHandler.
+/// Mirror of WKContentRuleListStore.
 ///
-/// See https://developer.apple.com/documentation/webkit/wkscriptmessagehandler?language=objc.
-abstract class TestWKScriptMessageHandlerHostApi {
+/// See https://developer.apple.com/documentation/webkit/wkcontentruleliststore?language=objc.
+abstract class TestWKContentRuleListStoreHostApi {
   static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
       TestDefaultBinaryMessengerBinding.instance;
   static const MessageCodec<Object?> codec = StandardMessageCodec();
 
-  void create(int identifier);
+  void createDefaultStore(int identifier);
 
-  static void setup(TestWKScriptMessageHandlerHostApi? api,
+  Future<void> compileContentRuleList(
+      int identifier, String ruleListIdentifier, String encodedContentRuleList);
+
+  Future<bool> containsContentRuleList(
+      int identifier, String ruleListIdentifier);
+
+  Future<void> removeContentRuleList(int identifier, String ruleListIdentifier);
+
+  static void setup(TestWKContentRuleListStoreHostApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.createDefaultStore',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -978,13 +1131,13 @@ abstract class TestWKScriptMessageHandlerHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.createDefaultStore was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.createDefaultStore was null, expected non-null int.');
           try {
-            api.create(arg_identifier!);
+            api.createDefaultStore(arg_identifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -995,24 +1148,9 @@ abstract class TestWKScriptMessageHandlerHostApi {
         });
       }
     }
-  }
-}
-
-/// Mirror of WKNavigationDelegate.
-///
-/// See https://developer.apple.com/documentation/webkit/wknavigationdelegate?language=objc.
-abstract class TestWKNavigationDelegateHostApi {
-  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
-      TestDefaultBinaryMessengerBinding.instance;
-  static const MessageCodec<Object?> codec = StandardMessageCodec();
-
-  void create(int identifier);
-
-  static void setup(TestWKNavigationDelegateHostApi? api,
-      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.compileContentRuleList',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1023,13 +1161,20 @@ abstract class TestWKNavigationDelegateHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.compileContentRuleList was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.compileContentRuleList was null, expected non-null int.');
+          final String? arg_ruleListIdentifier = (args[1] as String?);
+          assert(arg_ruleListIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.compileContentRuleList was null, expected non-null String.');
+          final String? arg_encodedContentRuleList = (args[2] as String?);
+          assert(arg_encodedContentRuleList != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.compileContentRuleList was null, expected non-null String.');
           try {
-            api.create(arg_identifier!);
+            await api.compileContentRuleList(arg_identifier!,
+                arg_ruleListIdentifier!, arg_encodedContentRuleList!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1040,52 +1185,9 @@ abstract class TestWKNavigationDelegateHostApi {
         });
       }
     }
-  }
-}
-
-class _TestNSObjectHostApiCodec extends StandardMessageCodec {
-  const _TestNSObjectHostApiCodec();
-  @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSKeyValueObservingOptionsEnumData) {
-      buffer.putUint8(128);
-      writeValue(buffer, value.encode());
-    } else {
-      super.writeValue(buffer, value);
-    }
-  }
-
-  @override
-  Object? readValueOfType(int type, ReadBuffer buffer) {
-    switch (type) {
-      case 128:
-        return NSKeyValueObservingOptionsEnumData.decode(readValue(buffer)!);
-      default:
-        return super.readValueOfType(type, buffer);
-    }
-  }
-}
-
-/// Mirror of NSObject.
-///
-/// See https://developer.apple.com/documentation/objectivec/nsobject.
-abstract class TestNSObjectHostApi {
-  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
-      TestDefaultBinaryMessengerBinding.instance;
-  static const MessageCodec<Object?> codec = _TestNSObjectHostApiCodec();
-
-  void dispose(int identifier);
-
-  void addObserver(int identifier, int observerIdentifier, String keyPath,
-      List<NSKeyValueObservingOptionsEnumData?> options);
-
-  void removeObserver(int identifier, int observerIdentifier, String keyPath);
-
-  static void setup(TestNSObjectHostApi? api,
-      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.containsContentRuleList',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1096,14 +1198,18 @@ abstract class TestNSObjectHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.containsContentRuleList was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.containsContentRuleList was null, expected non-null int.');
+          final String? arg_ruleListIdentifier = (args[1] as String?);
+          assert(arg_ruleListIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.containsContentRuleList was null, expected non-null String.');
           try {
-            api.dispose(arg_identifier!);
-            return wrapResponse(empty: true);
+            final bool output = await api.containsContentRuleList(
+                arg_identifier!, arg_ruleListIdentifier!);
+            return <Object?>[output];
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1115,7 +1221,7 @@ abstract class TestNSObjectHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.removeContentRuleList',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1126,25 +1232,17 @@ abstract class TestNSObjectHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.removeContentRuleList was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null int.');
-          final int? arg_observerIdentifier = (args[1] as int?);
-          assert(arg_observerIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null int.');
-          final String? arg_keyPath = (args[2] as String?);
-          assert(arg_keyPath != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null String.');
-          final List<NSKeyValueObservingOptionsEnumData?>? arg_options =
-              (args[3] as List<Object?>?)
-                  ?.cast<NSKeyValueObservingOptionsEnumData?>();
-          assert(arg_options != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null List<NSKeyValueObservingOptionsEnumData?>.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.removeContentRuleList was null, expected non-null int.');
+          final String? arg_ruleListIdentifier = (args[1] as String?);
+          assert(arg_ruleListIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKContentRuleListStoreHostApi.removeContentRuleList was null, expected non-null String.');
           try {
-            api.addObserver(arg_identifier!, arg_observerIdentifier!,
-                arg_keyPath!, arg_options!);
+            await api.removeContentRuleList(
+                arg_identifier!, arg_ruleListIdentifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1155,12 +1253,30 @@ abstract class TestNSObjectHostApi {
         });
       }
     }
-    {
-      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver',
-          codec,
-          binaryMessenger: binaryMessenger);
-      if (api == null) {
+  }
+}
+
+/// Mirror of WKUserPreferences.
+///
+/// See https://developer.apple.com/documentation/webkit/wkpreferences?language=objc.
+abstract class TestWKPreferencesHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  void createFromWebViewConfiguration(
+      int identifier, int configurationIdentifier);
+
+  void setJavaScriptEnabled(int identifier, bool enabled);
+
+  static void setup(TestWKPreferencesHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
         _testBinaryMessengerBinding!.defaultBinaryMessenger
             .setMockDecodedMessageHandler<Object?>(channel, null);
       } else {
@@ -1168,20 +1284,50 @@ abstract class TestNSObjectHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null, expected non-null int.');
-          final int? arg_observerIdentifier = (args[1] as int?);
-          assert(arg_observerIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null, expected non-null int.');
-          final String? arg_keyPath = (args[2] as String?);
-          assert(arg_keyPath != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null, expected non-null String.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration was null, expected non-null int.');
+          final int? arg_configurationIdentifier = (args[1] as int?);
+          assert(arg_configurationIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.createFromWebViewConfiguration was null, expected non-null int.');
           try {
-            api.removeObserver(
-                arg_identifier!, arg_observerIdentifier!, arg_keyPath!);
+            api.createFromWebViewConfiguration(
+                arg_identifier!, arg_configurationIdentifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled was null, expected non-null int.');
+          final bool? arg_enabled = (args[1] as bool?);
+          assert(arg_enabled != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKPreferencesHostApi.setJavaScriptEnabled was null, expected non-null bool.');
+          try {
+            api.setJavaScriptEnabled(arg_identifier!, arg_enabled!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1195,64 +1341,91 @@ abstract class TestNSObjectHostApi {
   }
 }
 
-class _TestWKWebViewHostApiCodec extends StandardMessageCodec {
-  const _TestWKWebViewHostApiCodec();
+/// Mirror of WKScriptMessageHandler.
+///
+/// See https://developer.apple.com/documentation/webkit/wkscriptmessagehandler?language=objc.
+abstract class TestWKScriptMessageHandlerHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  void create(int identifier);
+
+  void setMessageBatching(int identifier, int? maxBatchSize);
+
+  static void setup(TestWKScriptMessageHandlerHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.create was null, expected non-null int.');
+          try {
+            api.create(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.setMessageBatching',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.setMessageBatching was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKScriptMessageHandlerHostApi.setMessageBatching was null, expected non-null int.');
+          final int? arg_maxBatchSize = (args[1] as int?);
+          try {
+            api.setMessageBatching(arg_identifier!, arg_maxBatchSize);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
+
+class _TestWKNavigationDelegateHostApiCodec extends StandardMessageCodec {
+  const _TestWKNavigationDelegateHostApiCodec();
   @override
   void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSErrorData) {
+    if (value is WKNavigationPolicyRuleData) {
       buffer.putUint8(128);
       writeValue(buffer, value.encode());
-    } else if (value is NSHttpCookieData) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.encode());
-    } else if (value is NSHttpCookiePropertyKeyEnumData) {
-      buffer.putUint8(130);
-      writeValue(buffer, value.encode());
-    } else if (value is NSKeyValueChangeKeyEnumData) {
-      buffer.putUint8(131);
-      writeValue(buffer, value.encode());
-    } else if (value is NSKeyValueObservingOptionsEnumData) {
-      buffer.putUint8(132);
-      writeValue(buffer, value.encode());
-    } else if (value is NSUrlRequestData) {
-      buffer.putUint8(133);
-      writeValue(buffer, value.encode());
-    } else if (value is ObjectOrIdentifier) {
-      buffer.putUint8(134);
-      writeValue(buffer, value.encode());
-    } else if (value is WKAudiovisualMediaTypeEnumData) {
-      buffer.putUint8(135);
-      writeValue(buffer, value.encode());
-    } else if (value is WKFrameInfoData) {
-      buffer.putUint8(136);
-      writeValue(buffer, value.encode());
-    } else if (value is WKMediaCaptureTypeData) {
-      buffer.putUint8(137);
-      writeValue(buffer, value.encode());
-    } else if (value is WKNavigationActionData) {
-      buffer.putUint8(138);
-      writeValue(buffer, value.encode());
-    } else if (value is WKNavigationActionPolicyEnumData) {
-      buffer.putUint8(139);
-      writeValue(buffer, value.encode());
-    } else if (value is WKPermissionDecisionData) {
-      buffer.putUint8(140);
-      writeValue(buffer, value.encode());
-    } else if (value is WKScriptMessageData) {
-      buffer.putUint8(141);
-      writeValue(buffer, value.encode());
-    } else if (value is WKSecurityOriginData) {
-      buffer.putUint8(142);
-      writeValue(buffer, value.encode());
-    } else if (value is WKUserScriptData) {
-      buffer.putUint8(143);
-      writeValue(buffer, value.encode());
-    } else if (value is WKUserScriptInjectionTimeEnumData) {
-      buffer.putUint8(144);
-      writeValue(buffer, value.encode());
-    } else if (value is WKWebsiteDataTypeEnumData) {
-      buffer.putUint8(145);
-      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -1262,100 +1435,904 @@ class _TestWKWebViewHostApiCodec extends StandardMessageCodec {
   Object? readValueOfType(int type, ReadBuffer buffer) {
     switch (type) {
       case 128:
-        return NSErrorData.decode(readValue(buffer)!);
-      case 129:
-        return NSHttpCookieData.decode(readValue(buffer)!);
-      case 130:
-        return NSHttpCookiePropertyKeyEnumData.decode(readValue(buffer)!);
-      case 131:
-        return NSKeyValueChangeKeyEnumData.decode(readValue(buffer)!);
-      case 132:
-        return NSKeyValueObservingOptionsEnumData.decode(readValue(buffer)!);
-      case 133:
-        return NSUrlRequestData.decode(readValue(buffer)!);
-      case 134:
-        return ObjectOrIdentifier.decode(readValue(buffer)!);
-      case 135:
-        return WKAudiovisualMediaTypeEnumData.decode(readValue(buffer)!);
-      case 136:
-        return WKFrameInfoData.decode(readValue(buffer)!);
-      case 137:
-        return WKMediaCaptureTypeData.decode(readValue(buffer)!);
-      case 138:
-        return WKNavigationActionData.decode(readValue(buffer)!);
-      case 139:
-        return WKNavigationActionPolicyEnumData.decode(readValue(buffer)!);
-      case 140:
-        return WKPermissionDecisionData.decode(readValue(buffer)!);
-      case 141:
-        return WKScriptMessageData.decode(readValue(buffer)!);
-      case 142:
-        return WKSecurityOriginData.decode(readValue(buffer)!);
-      case 143:
-        return WKUserScriptData.decode(readValue(buffer)!);
-      case 144:
-        return WKUserScriptInjectionTimeEnumData.decode(readValue(buffer)!);
-      case 145:
-        return WKWebsiteDataTypeEnumData.decode(readValue(buffer)!);
+        return WKNavigationPolicyRuleData.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
   }
 }
 
-/// Mirror of WKWebView.
+/// Mirror of WKNavigationDelegate.
 ///
-/// See https://developer.apple.com/documentation/webkit/wkwebview?language=objc.
-abstract class TestWKWebViewHostApi {
+/// See https://developer.apple.com/documentation/webkit/wknavigationdelegate?language=objc.
+abstract class TestWKNavigationDelegateHostApi {
   static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
       TestDefaultBinaryMessengerBinding.instance;
-  static const MessageCodec<Object?> codec = _TestWKWebViewHostApiCodec();
-
-  void create(int identifier, int configurationIdentifier);
-
-  void setUIDelegate(int identifier, int? uiDelegateIdentifier);
-
-  void setNavigationDelegate(int identifier, int? navigationDelegateIdentifier);
-
-  String? getUrl(int identifier);
+  static const MessageCodec<Object?> codec =
+      _TestWKNavigationDelegateHostApiCodec();
 
-  double getEstimatedProgress(int identifier);
+  void create(int identifier);
 
-  void loadRequest(int identifier, NSUrlRequestData request);
+  void setNavigationPolicyRules(
+      int identifier,
+      List<WKNavigationPolicyRuleData?> rules,
+      bool forwardsOnlyMainFrameNavigations);
 
-  void loadHtmlString(int identifier, String string, String? baseUrl);
+  void setIncludesRequestDetails(int identifier, bool includesRequestDetails);
 
-  void loadFileUrl(int identifier, String url, String readAccessUrl);
-
-  void loadFlutterAsset(int identifier, String key);
-
-  bool canGoBack(int identifier);
-
-  bool canGoForward(int identifier);
-
-  void goBack(int identifier);
-
-  void goForward(int identifier);
-
-  void reload(int identifier);
+  static void setup(TestWKNavigationDelegateHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.create was null, expected non-null int.');
+          try {
+            api.create(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setNavigationPolicyRules',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setNavigationPolicyRules was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setNavigationPolicyRules was null, expected non-null int.');
+          final List<WKNavigationPolicyRuleData?>? arg_rules =
+              (args[1] as List<Object?>?)?.cast<WKNavigationPolicyRuleData?>();
+          assert(arg_rules != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setNavigationPolicyRules was null, expected non-null List<WKNavigationPolicyRuleData?>.');
+          final bool? arg_forwardsOnlyMainFrameNavigations = (args[2] as bool?);
+          assert(arg_forwardsOnlyMainFrameNavigations != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setNavigationPolicyRules was null, expected non-null bool.');
+          try {
+            api.setNavigationPolicyRules(arg_identifier!, arg_rules!,
+                arg_forwardsOnlyMainFrameNavigations!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setIncludesRequestDetails',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setIncludesRequestDetails was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setIncludesRequestDetails was null, expected non-null int.');
+          final bool? arg_includesRequestDetails = (args[1] as bool?);
+          assert(arg_includesRequestDetails != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKNavigationDelegateHostApi.setIncludesRequestDetails was null, expected non-null bool.');
+          try {
+            api.setIncludesRequestDetails(
+                arg_identifier!, arg_includesRequestDetails!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
 
-  String? getTitle(int identifier);
+class _TestNSObjectHostApiCodec extends StandardMessageCodec {
+  const _TestNSObjectHostApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSKeyValueObservingOptionsEnumData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
 
-  void setAllowsBackForwardNavigationGestures(int identifier, bool allow);
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSKeyValueObservingOptionsEnumData.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
 
-  void setCustomUserAgent(int identifier, String? userAgent);
+/// Mirror of NSObject.
+///
+/// See https://developer.apple.com/documentation/objectivec/nsobject.
+abstract class TestNSObjectHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = _TestNSObjectHostApiCodec();
 
-  Future<Object?> evaluateJavaScript(int identifier, String javaScriptString);
+  void dispose(int identifier);
 
-  void setInspectable(int identifier, bool inspectable);
+  void addObserver(int identifier, int observerIdentifier, String keyPath,
+      List<NSKeyValueObservingOptionsEnumData?> options);
 
-  String? getCustomUserAgent(int identifier);
+  void removeObserver(int identifier, int observerIdentifier, String keyPath);
 
-  static void setup(TestWKWebViewHostApi? api,
+  static void setup(TestNSObjectHostApi? api,
       {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.dispose was null, expected non-null int.');
+          try {
+            api.dispose(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null int.');
+          final int? arg_observerIdentifier = (args[1] as int?);
+          assert(arg_observerIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null int.');
+          final String? arg_keyPath = (args[2] as String?);
+          assert(arg_keyPath != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null String.');
+          final List<NSKeyValueObservingOptionsEnumData?>? arg_options =
+              (args[3] as List<Object?>?)
+                  ?.cast<NSKeyValueObservingOptionsEnumData?>();
+          assert(arg_options != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.addObserver was null, expected non-null List<NSKeyValueObservingOptionsEnumData?>.');
+          try {
+            api.addObserver(arg_identifier!, arg_observerIdentifier!,
+                arg_keyPath!, arg_options!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null, expected non-null int.');
+          final int? arg_observerIdentifier = (args[1] as int?);
+          assert(arg_observerIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null, expected non-null int.');
+          final String? arg_keyPath = (args[2] as String?);
+          assert(arg_keyPath != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSObjectHostApi.removeObserver was null, expected non-null String.');
+          try {
+            api.removeObserver(
+                arg_identifier!, arg_observerIdentifier!, arg_keyPath!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
+
+class _TestWKWebViewHostApiCodec extends StandardMessageCodec {
+  const _TestWKWebViewHostApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSErrorData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else if (value is NSHttpCookieData) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
+    } else if (value is NSHttpCookiePropertyKeyEnumData) {
+      buffer.putUint8(130);
+      writeValue(buffer, value.encode());
+    } else if (value is NSKeyValueChangeKeyEnumData) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    } else if (value is NSKeyValueObservingOptionsEnumData) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
+    } else if (value is NSUrlRequestData) {
+      buffer.putUint8(133);
+      writeValue(buffer, value.encode());
+    } else if (value is ObjectOrIdentifier) {
+      buffer.putUint8(134);
+      writeValue(buffer, value.encode());
+    } else if (value is WKAudiovisualMediaTypeEnumData) {
+      buffer.putUint8(135);
+      writeValue(buffer, value.encode());
+    } else if (value is WKFrameInfoData) {
+      buffer.putUint8(136);
+      writeValue(buffer, value.encode());
+    } else if (value is WKMediaCaptureTypeData) {
+      buffer.putUint8(137);
+      writeValue(buffer, value.encode());
+    } else if (value is WKNavigationActionData) {
+      buffer.putUint8(138);
+      writeValue(buffer, value.encode());
+    } else if (value is WKNavigationActionPolicyEnumData) {
+      buffer.putUint8(139);
+      writeValue(buffer, value.encode());
+    } else if (value is WKPermissionDecisionData) {
+      buffer.putUint8(140);
+      writeValue(buffer, value.encode());
+    } else if (value is WKScriptMessageData) {
+      buffer.putUint8(141);
+      writeValue(buffer, value.encode());
+    } else if (value is WKSecurityOriginData) {
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
+    } else if (value is WKUserScriptData) {
+      buffer.putUint8(143);
+      writeValue(buffer, value.encode());
+    } else if (value is WKUserScriptInjectionTimeEnumData) {
+      buffer.putUint8(144);
+      writeValue(buffer, value.encode());
+    } else if (value is WKWebsiteDataTypeEnumData) {
+      buffer.putUint8(145);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSErrorData.decode(readValue(buffer)!);
+      case 129:
+        return NSHttpCookieData.decode(readValue(buffer)!);
+      case 130:
+        return NSHttpCookiePropertyKeyEnumData.decode(readValue(buffer)!);
+      case 131:
+        return NSKeyValueChangeKeyEnumData.decode(readValue(buffer)!);
+      case 132:
+        return NSKeyValueObservingOptionsEnumData.decode(readValue(buffer)!);
+      case 133:
+        return NSUrlRequestData.decode(readValue(buffer)!);
+      case 134:
+        return ObjectOrIdentifier.decode(readValue(buffer)!);
+      case 135:
+        return WKAudiovisualMediaTypeEnumData.decode(readValue(buffer)!);
+      case 136:
+        return WKFrameInfoData.decode(readValue(buffer)!);
+      case 137:
+        return WKMediaCaptureTypeData.decode(readValue(buffer)!);
+      case 138:
+        return WKNavigationActionData.decode(readValue(buffer)!);
+      case 139:
+        return WKNavigationActionPolicyEnumData.decode(readValue(buffer)!);
+      case 140:
+        return WKPermissionDecisionData.decode(readValue(buffer)!);
+      case 141:
+        return WKScriptMessageData.decode(readValue(buffer)!);
+      case 142:
+        return WKSecurityOriginData.decode(readValue(buffer)!);
+      case 143:
+        return WKUserScriptData.decode(readValue(buffer)!);
+      case 144:
+        return WKUserScriptInjectionTimeEnumData.decode(readValue(buffer)!);
+      case 145:
+        return WKWebsiteDataTypeEnumData.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Mirror of WKWebView.
+///
+/// See https://developer.apple.com/documentation/webkit/wkwebview?language=objc.
+abstract class TestWKWebViewHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = _TestWKWebViewHostApiCodec();
+
+  void create(int identifier, int configurationIdentifier);
+
+  void setUIDelegate(int identifier, int? uiDelegateIdentifier);
+
+  void setNavigationDelegate(int identifier, int? navigationDelegateIdentifier);
+
+  String? getUrl(int identifier);
+
+  double getEstimatedProgress(int identifier);
+
+  void loadRequest(int identifier, NSUrlRequestData request);
+
+  void loadHtmlString(int identifier, String string, String? baseUrl);
+
+  void loadFileUrl(int identifier, String url, String readAccessUrl);
+
+  void loadFlutterAsset(int identifier, String key);
+
+  bool canGoBack(int identifier);
+
+  bool canGoForward(int identifier);
+
+  void goBack(int identifier);
+
+  void goForward(int identifier);
+
+  void reload(int identifier);
+
+  String? getTitle(int identifier);
+
+  void setAllowsBackForwardNavigationGestures(int identifier, bool allow);
+
+  void setCustomUserAgent(int identifier, String? userAgent);
+
+  Future<Object?> evaluateJavaScript(int identifier, String javaScriptString);
+
+  Future<String?> evaluateJavaScriptAsJson(
+      int identifier, String javaScriptString);
+
+  Future<Object?> callAsyncJavaScript(
+      int identifier, String functionBody, Map<String?, Object?> arguments);
+
+  void setInspectable(int identifier, bool inspectable);
+
+  String? getCustomUserAgent(int identifier);
+
+  void prewarm(int configurationIdentifier, int count);
+
+  void setSuspendsWhenOffscreen(
+      int identifier, bool suspends, double? idleTimeoutSeconds);
+
+  static void setup(TestWKWebViewHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create was null, expected non-null int.');
+          final int? arg_configurationIdentifier = (args[1] as int?);
+          assert(arg_configurationIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create was null, expected non-null int.');
+          try {
+            api.create(arg_identifier!, arg_configurationIdentifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setUIDelegate',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setUIDelegate was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setUIDelegate was null, expected non-null int.');
+          final int? arg_uiDelegateIdentifier = (args[1] as int?);
+          try {
+            api.setUIDelegate(arg_identifier!, arg_uiDelegateIdentifier);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setNavigationDelegate',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setNavigationDelegate was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setNavigationDelegate was null, expected non-null int.');
+          final int? arg_navigationDelegateIdentifier = (args[1] as int?);
+          try {
+            api.setNavigationDelegate(
+                arg_identifier!, arg_navigationDelegateIdentifier);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getUrl',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getUrl was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getUrl was null, expected non-null int.');
+          try {
+            final String? output = api.getUrl(arg_identifier!);
+            return <Object?>[output];
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getEstimatedProgress',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getEstimatedProgress was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getEstimatedProgress was null, expected non-null int.');
+          try {
+            final double output = api.getEstimatedProgress(arg_identifier!);
+            return <Object?>[output];
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest was null, expected non-null int.');
+          final NSUrlRequestData? arg_request = (args[1] as NSUrlRequestData?);
+          assert(arg_request != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest was null, expected non-null NSUrlRequestData.');
+          try {
+            api.loadRequest(arg_identifier!, arg_request!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString was null, expected non-null int.');
+          final String? arg_string = (args[1] as String?);
+          assert(arg_string != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString was null, expected non-null String.');
+          final String? arg_baseUrl = (args[2] as String?);
+          try {
+            api.loadHtmlString(arg_identifier!, arg_string!, arg_baseUrl);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null, expected non-null int.');
+          final String? arg_url = (args[1] as String?);
+          assert(arg_url != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null, expected non-null String.');
+          final String? arg_readAccessUrl = (args[2] as String?);
+          assert(arg_readAccessUrl != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null, expected non-null String.');
+          try {
+            api.loadFileUrl(arg_identifier!, arg_url!, arg_readAccessUrl!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset was null, expected non-null int.');
+          final String? arg_key = (args[1] as String?);
+          assert(arg_key != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset was null, expected non-null String.');
+          try {
+            api.loadFlutterAsset(arg_identifier!, arg_key!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack was null, expected non-null int.');
+          try {
+            final bool output = api.canGoBack(arg_identifier!);
+            return <Object?>[output];
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward was null, expected non-null int.');
+          try {
+            final bool output = api.canGoForward(arg_identifier!);
+            return <Object?>[output];
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack was null, expected non-null int.');
+          try {
+            api.goBack(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward was null, expected non-null int.');
+          try {
+            api.goForward(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload was null, expected non-null int.');
+          try {
+            api.reload(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1366,17 +2343,14 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create was null, expected non-null int.');
-          final int? arg_configurationIdentifier = (args[1] as int?);
-          assert(arg_configurationIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.create was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle was null, expected non-null int.');
           try {
-            api.create(arg_identifier!, arg_configurationIdentifier!);
-            return wrapResponse(empty: true);
+            final String? output = api.getTitle(arg_identifier!);
+            return <Object?>[output];
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1388,7 +2362,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setUIDelegate',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1399,14 +2373,17 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setUIDelegate was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setUIDelegate was null, expected non-null int.');
-          final int? arg_uiDelegateIdentifier = (args[1] as int?);
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures was null, expected non-null int.');
+          final bool? arg_allow = (args[1] as bool?);
+          assert(arg_allow != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures was null, expected non-null bool.');
           try {
-            api.setUIDelegate(arg_identifier!, arg_uiDelegateIdentifier);
+            api.setAllowsBackForwardNavigationGestures(
+                arg_identifier!, arg_allow!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1419,7 +2396,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setNavigationDelegate',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1430,15 +2407,14 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setNavigationDelegate was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setNavigationDelegate was null, expected non-null int.');
-          final int? arg_navigationDelegateIdentifier = (args[1] as int?);
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent was null, expected non-null int.');
+          final String? arg_userAgent = (args[1] as String?);
           try {
-            api.setNavigationDelegate(
-                arg_identifier!, arg_navigationDelegateIdentifier);
+            api.setCustomUserAgent(arg_identifier!, arg_userAgent);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1451,7 +2427,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getUrl',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1462,13 +2438,17 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getUrl was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getUrl was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript was null, expected non-null int.');
+          final String? arg_javaScriptString = (args[1] as String?);
+          assert(arg_javaScriptString != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript was null, expected non-null String.');
           try {
-            final String? output = api.getUrl(arg_identifier!);
+            final Object? output = await api.evaluateJavaScript(
+                arg_identifier!, arg_javaScriptString!);
             return <Object?>[output];
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1481,7 +2461,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getEstimatedProgress',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScriptAsJson',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1492,13 +2472,17 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getEstimatedProgress was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScriptAsJson was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getEstimatedProgress was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScriptAsJson was null, expected non-null int.');
+          final String? arg_javaScriptString = (args[1] as String?);
+          assert(arg_javaScriptString != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScriptAsJson was null, expected non-null String.');
           try {
-            final double output = api.getEstimatedProgress(arg_identifier!);
+            final String? output = await api.evaluateJavaScriptAsJson(
+                arg_identifier!, arg_javaScriptString!);
             return <Object?>[output];
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1511,7 +2495,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.callAsyncJavaScript',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1522,16 +2506,54 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.callAsyncJavaScript was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest was null, expected non-null int.');
-          final NSUrlRequestData? arg_request = (args[1] as NSUrlRequestData?);
-          assert(arg_request != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadRequest was null, expected non-null NSUrlRequestData.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.callAsyncJavaScript was null, expected non-null int.');
+          final String? arg_functionBody = (args[1] as String?);
+          assert(arg_functionBody != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.callAsyncJavaScript was null, expected non-null String.');
+          final Map<String?, Object?>? arg_arguments =
+              (args[2] as Map<Object?, Object?>?)?.cast<String?, Object?>();
+          assert(arg_arguments != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.callAsyncJavaScript was null, expected non-null Map<String?, Object?>.');
           try {
-            api.loadRequest(arg_identifier!, arg_request!);
+            final Object? output = await api.callAsyncJavaScript(
+                arg_identifier!, arg_functionBody!, arg_arguments!);
+            return <Object?>[output];
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable was null, expected non-null int.');
+          final bool? arg_inspectable = (args[1] as bool?);
+          assert(arg_inspectable != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable was null, expected non-null bool.');
+          try {
+            api.setInspectable(arg_identifier!, arg_inspectable!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1544,7 +2566,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1555,17 +2577,46 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString was null, expected non-null int.');
-          final String? arg_string = (args[1] as String?);
-          assert(arg_string != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadHtmlString was null, expected non-null String.');
-          final String? arg_baseUrl = (args[2] as String?);
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent was null, expected non-null int.');
           try {
-            api.loadHtmlString(arg_identifier!, arg_string!, arg_baseUrl);
+            final String? output = api.getCustomUserAgent(arg_identifier!);
+            return <Object?>[output];
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.prewarm',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.prewarm was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_configurationIdentifier = (args[0] as int?);
+          assert(arg_configurationIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.prewarm was null, expected non-null int.');
+          final int? arg_count = (args[1] as int?);
+          assert(arg_count != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.prewarm was null, expected non-null int.');
+          try {
+            api.prewarm(arg_configurationIdentifier!, arg_count!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1578,7 +2629,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setSuspendsWhenOffscreen',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1589,19 +2640,18 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setSuspendsWhenOffscreen was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null, expected non-null int.');
-          final String? arg_url = (args[1] as String?);
-          assert(arg_url != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null, expected non-null String.');
-          final String? arg_readAccessUrl = (args[2] as String?);
-          assert(arg_readAccessUrl != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFileUrl was null, expected non-null String.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setSuspendsWhenOffscreen was null, expected non-null int.');
+          final bool? arg_suspends = (args[1] as bool?);
+          assert(arg_suspends != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setSuspendsWhenOffscreen was null, expected non-null bool.');
+          final double? arg_idleTimeoutSeconds = (args[2] as double?);
           try {
-            api.loadFileUrl(arg_identifier!, arg_url!, arg_readAccessUrl!);
+            api.setSuspendsWhenOffscreen(
+                arg_identifier!, arg_suspends!, arg_idleTimeoutSeconds);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1612,9 +2662,105 @@ abstract class TestWKWebViewHostApi {
         });
       }
     }
+  }
+}
+
+/// Mirror of WKUIDelegate.
+///
+/// See https://developer.apple.com/documentation/webkit/wkuidelegate?language=objc.
+abstract class TestWKUIDelegateHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  void create(int identifier);
+
+  static void setup(TestWKUIDelegateHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create',
+          codec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel, null);
+      } else {
+        _testBinaryMessengerBinding!.defaultBinaryMessenger
+            .setMockDecodedMessageHandler<Object?>(channel,
+                (Object? message) async {
+          assert(message != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final int? arg_identifier = (args[0] as int?);
+          assert(arg_identifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create was null, expected non-null int.');
+          try {
+            api.create(arg_identifier!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          } catch (e) {
+            return wrapResponse(
+                error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+  }
+}
+
+class _TestWKHttpCookieStoreHostApiCodec extends StandardMessageCodec {
+  const _TestWKHttpCookieStoreHostApiCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is NSHttpCookieData) {
+      buffer.putUint8(128);
+      writeValue(buffer, value.encode());
+    } else if (value is NSHttpCookiePropertyKeyEnumData) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 128:
+        return NSHttpCookieData.decode(readValue(buffer)!);
+      case 129:
+        return NSHttpCookiePropertyKeyEnumData.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Mirror of WKHttpCookieStore.
+///
+/// See https://developer.apple.com/documentation/webkit/wkhttpcookiestore?language=objc.
+abstract class TestWKHttpCookieStoreHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec =
+      _TestWKHttpCookieStoreHostApiCodec();
+
+  void createFromWebsiteDataStore(
+      int identifier, int websiteDataStoreIdentifier);
+
+  Future<void> setCookie(int identifier, NSHttpCookieData cookie);
+
+  Future<void> setCookies(int identifier, List<NSHttpCookieData?> cookies);
+
+  Future<List<NSHttpCookieData?>> getAllCookies(int identifier);
+
+  static void setup(TestWKHttpCookieStoreHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
+    {
+      final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1625,16 +2771,17 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset was null, expected non-null int.');
-          final String? arg_key = (args[1] as String?);
-          assert(arg_key != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.loadFlutterAsset was null, expected non-null String.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore was null, expected non-null int.');
+          final int? arg_websiteDataStoreIdentifier = (args[1] as int?);
+          assert(arg_websiteDataStoreIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore was null, expected non-null int.');
           try {
-            api.loadFlutterAsset(arg_identifier!, arg_key!);
+            api.createFromWebsiteDataStore(
+                arg_identifier!, arg_websiteDataStoreIdentifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1647,7 +2794,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1658,14 +2805,17 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoBack was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie was null, expected non-null int.');
+          final NSHttpCookieData? arg_cookie = (args[1] as NSHttpCookieData?);
+          assert(arg_cookie != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie was null, expected non-null NSHttpCookieData.');
           try {
-            final bool output = api.canGoBack(arg_identifier!);
-            return <Object?>[output];
+            await api.setCookie(arg_identifier!, arg_cookie!);
+            return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1677,7 +2827,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookies',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1688,14 +2838,18 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookies was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.canGoForward was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookies was null, expected non-null int.');
+          final List<NSHttpCookieData?>? arg_cookies =
+              (args[1] as List<Object?>?)?.cast<NSHttpCookieData?>();
+          assert(arg_cookies != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookies was null, expected non-null List<NSHttpCookieData?>.');
           try {
-            final bool output = api.canGoForward(arg_identifier!);
-            return <Object?>[output];
+            await api.setCookies(arg_identifier!, arg_cookies!);
+            return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1707,7 +2861,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.getAllCookies',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1718,14 +2872,15 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.getAllCookies was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goBack was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.getAllCookies was null, expected non-null int.');
           try {
-            api.goBack(arg_identifier!);
-            return wrapResponse(empty: true);
+            final List<NSHttpCookieData?> output =
+                await api.getAllCookies(arg_identifier!);
+            return <Object?>[output];
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1735,9 +2890,27 @@ abstract class TestWKWebViewHostApi {
         });
       }
     }
+  }
+}
+
+/// Host API for `NSUrl`.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/foundation/nsurl?language=objc.
+abstract class TestNSUrlHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  String? getAbsoluteString(int identifier);
+
+  static void setup(TestNSUrlHostApi? api, {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1748,14 +2921,14 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.goForward was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString was null, expected non-null int.');
           try {
-            api.goForward(arg_identifier!);
-            return wrapResponse(empty: true);
+            final String? output = api.getAbsoluteString(arg_identifier!);
+            return <Object?>[output];
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1765,9 +2938,34 @@ abstract class TestWKWebViewHostApi {
         });
       }
     }
+  }
+}
+
+/// Host API for a Flutter texture that displays snapshots of a WKWebView.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/webkit/wkwebview/2873260-takesnapshotwithconfiguration?language=objc.
+abstract class TestWKWebViewTextureHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  void create(int identifier, int webViewIdentifier);
+
+  int getTextureId(int identifier);
+
+  void setSize(int identifier, double width, double height);
+
+  Future<void> update(int identifier);
+
+  static void setup(TestWKWebViewTextureHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.create',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1778,13 +2976,16 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.create was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.reload was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.create was null, expected non-null int.');
+          final int? arg_webViewIdentifier = (args[1] as int?);
+          assert(arg_webViewIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.create was null, expected non-null int.');
           try {
-            api.reload(arg_identifier!);
+            api.create(arg_identifier!, arg_webViewIdentifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1797,7 +2998,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.getTextureId',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1808,13 +3009,13 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.getTextureId was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getTitle was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.getTextureId was null, expected non-null int.');
           try {
-            final String? output = api.getTitle(arg_identifier!);
+            final int output = api.getTextureId(arg_identifier!);
             return <Object?>[output];
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1827,7 +3028,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.setSize',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1838,17 +3039,19 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.setSize was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures was null, expected non-null int.');
-          final bool? arg_allow = (args[1] as bool?);
-          assert(arg_allow != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setAllowsBackForwardNavigationGestures was null, expected non-null bool.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.setSize was null, expected non-null int.');
+          final double? arg_width = (args[1] as double?);
+          assert(arg_width != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.setSize was null, expected non-null double.');
+          final double? arg_height = (args[2] as double?);
+          assert(arg_height != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.setSize was null, expected non-null double.');
           try {
-            api.setAllowsBackForwardNavigationGestures(
-                arg_identifier!, arg_allow!);
+            api.setSize(arg_identifier!, arg_width!, arg_height!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1861,7 +3064,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.update',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1872,14 +3075,13 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.update was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setCustomUserAgent was null, expected non-null int.');
-          final String? arg_userAgent = (args[1] as String?);
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewTextureHostApi.update was null, expected non-null int.');
           try {
-            api.setCustomUserAgent(arg_identifier!, arg_userAgent);
+            await api.update(arg_identifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1890,9 +3092,42 @@ abstract class TestWKWebViewHostApi {
         });
       }
     }
+  }
+}
+
+/// Host API for `WKURLSchemeHandler`.
+///
+/// This class may handle instantiating and adding native object instances that
+/// are attached to a Dart instance or method calls on the associated native
+/// class or an instance of the class.
+///
+/// See https://developer.apple.com/documentation/webkit/wkurlschemehandler?language=objc.
+abstract class TestWKURLSchemeHandlerHostApi {
+  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
+      TestDefaultBinaryMessengerBinding.instance;
+  static const MessageCodec<Object?> codec = StandardMessageCodec();
+
+  void create(int identifier);
+
+  void addFileRoute(int identifier, String pathPrefix, String directoryPath);
+
+  void addFlutterAssetRoute(
+      int identifier, String pathPrefix, String assetDirectory);
+
+  void didReceiveResponse(int identifier, int taskIdentifier, int statusCode,
+      Map<String?, String?> headers);
+
+  void didReceiveData(int identifier, int taskIdentifier, Uint8List data);
+
+  void didFinish(int identifier, int taskIdentifier);
+
+  void didFail(int identifier, int taskIdentifier, String errorDescription);
+
+  static void setup(TestWKURLSchemeHandlerHostApi? api,
+      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.create',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1903,18 +3138,14 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.create was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript was null, expected non-null int.');
-          final String? arg_javaScriptString = (args[1] as String?);
-          assert(arg_javaScriptString != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.evaluateJavaScript was null, expected non-null String.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.create was null, expected non-null int.');
           try {
-            final Object? output = await api.evaluateJavaScript(
-                arg_identifier!, arg_javaScriptString!);
-            return <Object?>[output];
+            api.create(arg_identifier!);
+            return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1926,7 +3157,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFileRoute',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1937,16 +3168,20 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFileRoute was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable was null, expected non-null int.');
-          final bool? arg_inspectable = (args[1] as bool?);
-          assert(arg_inspectable != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.setInspectable was null, expected non-null bool.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFileRoute was null, expected non-null int.');
+          final String? arg_pathPrefix = (args[1] as String?);
+          assert(arg_pathPrefix != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFileRoute was null, expected non-null String.');
+          final String? arg_directoryPath = (args[2] as String?);
+          assert(arg_directoryPath != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFileRoute was null, expected non-null String.');
           try {
-            api.setInspectable(arg_identifier!, arg_inspectable!);
+            api.addFileRoute(
+                arg_identifier!, arg_pathPrefix!, arg_directoryPath!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -1959,7 +3194,7 @@ abstract class TestWKWebViewHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFlutterAssetRoute',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -1970,14 +3205,21 @@ abstract class TestWKWebViewHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFlutterAssetRoute was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKWebViewHostApi.getCustomUserAgent was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFlutterAssetRoute was null, expected non-null int.');
+          final String? arg_pathPrefix = (args[1] as String?);
+          assert(arg_pathPrefix != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFlutterAssetRoute was null, expected non-null String.');
+          final String? arg_assetDirectory = (args[2] as String?);
+          assert(arg_assetDirectory != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.addFlutterAssetRoute was null, expected non-null String.');
           try {
-            final String? output = api.getCustomUserAgent(arg_identifier!);
-            return <Object?>[output];
+            api.addFlutterAssetRoute(
+                arg_identifier!, arg_pathPrefix!, arg_assetDirectory!);
+            return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
@@ -1987,24 +3229,9 @@ abstract class TestWKWebViewHostApi {
         });
       }
     }
-  }
-}
-
-/// Mirror of WKUIDelegate.
-///
-/// See https://developer.apple.com/documentation/webkit/wkuidelegate?language=objc.
-abstract class TestWKUIDelegateHostApi {
-  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
-      TestDefaultBinaryMessengerBinding.instance;
-  static const MessageCodec<Object?> codec = StandardMessageCodec();
-
-  void create(int identifier);
-
-  static void setup(TestWKUIDelegateHostApi? api,
-      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveResponse',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -2015,13 +3242,24 @@ abstract class TestWKUIDelegateHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveResponse was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKUIDelegateHostApi.create was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveResponse was null, expected non-null int.');
+          final int? arg_taskIdentifier = (args[1] as int?);
+          assert(arg_taskIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveResponse was null, expected non-null int.');
+          final int? arg_statusCode = (args[2] as int?);
+          assert(arg_statusCode != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveResponse was null, expected non-null int.');
+          final Map<String?, String?>? arg_headers =
+              (args[3] as Map<Object?, Object?>?)?.cast<String?, String?>();
+          assert(arg_headers != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveResponse was null, expected non-null Map<String?, String?>.');
           try {
-            api.create(arg_identifier!);
+            api.didReceiveResponse(arg_identifier!, arg_taskIdentifier!,
+                arg_statusCode!, arg_headers!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -2032,56 +3270,9 @@ abstract class TestWKUIDelegateHostApi {
         });
       }
     }
-  }
-}
-
-class _TestWKHttpCookieStoreHostApiCodec extends StandardMessageCodec {
-  const _TestWKHttpCookieStoreHostApiCodec();
-  @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is NSHttpCookieData) {
-      buffer.putUint8(128);
-      writeValue(buffer, value.encode());
-    } else if (value is NSHttpCookiePropertyKeyEnumData) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.encode());
-    } else {
-      super.writeValue(buffer, value);
-    }
-  }
-
-  @override
-  Object? readValueOfType(int type, ReadBuffer buffer) {
-    switch (type) {
-      case 128:
-        return NSHttpCookieData.decode(readValue(buffer)!);
-      case 129:
-        return NSHttpCookiePropertyKeyEnumData.decode(readValue(buffer)!);
-      default:
-        return super.readValueOfType(type, buffer);
-    }
-  }
-}
-
-/// Mirror of WKHttpCookieStore.
-///
-/// See https://developer.apple.com/documentation/webkit/wkhttpcookiestore?language=objc.
-abstract class TestWKHttpCookieStoreHostApi {
-  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
-      TestDefaultBinaryMessengerBinding.instance;
-  static const MessageCodec<Object?> codec =
-      _TestWKHttpCookieStoreHostApiCodec();
-
-  void createFromWebsiteDataStore(
-      int identifier, int websiteDataStoreIdentifier);
-
-  Future<void> setCookie(int identifier, NSHttpCookieData cookie);
-
-  static void setup(TestWKHttpCookieStoreHostApi? api,
-      {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveData',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -2092,17 +3283,20 @@ abstract class TestWKHttpCookieStoreHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveData was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore was null, expected non-null int.');
-          final int? arg_websiteDataStoreIdentifier = (args[1] as int?);
-          assert(arg_websiteDataStoreIdentifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.createFromWebsiteDataStore was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveData was null, expected non-null int.');
+          final int? arg_taskIdentifier = (args[1] as int?);
+          assert(arg_taskIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveData was null, expected non-null int.');
+          final Uint8List? arg_data = (args[2] as Uint8List?);
+          assert(arg_data != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didReceiveData was null, expected non-null Uint8List.');
           try {
-            api.createFromWebsiteDataStore(
-                arg_identifier!, arg_websiteDataStoreIdentifier!);
+            api.didReceiveData(
+                arg_identifier!, arg_taskIdentifier!, arg_data!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -2115,7 +3309,7 @@ abstract class TestWKHttpCookieStoreHostApi {
     }
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFinish',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -2126,16 +3320,16 @@ abstract class TestWKHttpCookieStoreHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFinish was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie was null, expected non-null int.');
-          final NSHttpCookieData? arg_cookie = (args[1] as NSHttpCookieData?);
-          assert(arg_cookie != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKHttpCookieStoreHostApi.setCookie was null, expected non-null NSHttpCookieData.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFinish was null, expected non-null int.');
+          final int? arg_taskIdentifier = (args[1] as int?);
+          assert(arg_taskIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFinish was null, expected non-null int.');
           try {
-            await api.setCookie(arg_identifier!, arg_cookie!);
+            api.didFinish(arg_identifier!, arg_taskIdentifier!);
             return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
@@ -2146,27 +3340,9 @@ abstract class TestWKHttpCookieStoreHostApi {
         });
       }
     }
-  }
-}
-
-/// Host API for `NSUrl`.
-///
-/// This class may handle instantiating and adding native object instances that
-/// are attached to a Dart instance or method calls on the associated native
-/// class or an instance of the class.
-///
-/// See https://developer.apple.com/documentation/foundation/nsurl?language=objc.
-abstract class TestNSUrlHostApi {
-  static TestDefaultBinaryMessengerBinding? get _testBinaryMessengerBinding =>
-      TestDefaultBinaryMessengerBinding.instance;
-  static const MessageCodec<Object?> codec = StandardMessageCodec();
-
-  String? getAbsoluteString(int identifier);
-
-  static void setup(TestNSUrlHostApi? api, {BinaryMessenger? binaryMessenger}) {
     {
       final BasicMessageChannel<Object?> channel = BasicMessageChannel<Object?>(
-          'dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString',
+          'dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFail',
           codec,
           binaryMessenger: binaryMessenger);
       if (api == null) {
@@ -2177,14 +3353,21 @@ abstract class TestNSUrlHostApi {
             .setMockDecodedMessageHandler<Object?>(channel,
                 (Object? message) async {
           assert(message != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString was null.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFail was null.');
           final List<Object?> args = (message as List<Object?>?)!;
           final int? arg_identifier = (args[0] as int?);
           assert(arg_identifier != null,
-              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.NSUrlHostApi.getAbsoluteString was null, expected non-null int.');
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFail was null, expected non-null int.');
+          final int? arg_taskIdentifier = (args[1] as int?);
+          assert(arg_taskIdentifier != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFail was null, expected non-null int.');
+          final String? arg_errorDescription = (args[2] as String?);
+          assert(arg_errorDescription != null,
+              'Argument for dev.flutter.pigeon.webview_flutter_wkwebview.WKURLSchemeHandlerHostApi.didFail was null, expected non-null String.');
           try {
-            final String? output = api.getAbsoluteString(arg_identifier!);
-            return <Object?>[output];
+            api.didFail(
+                arg_identifier!, arg_taskIdentifier!, arg_errorDescription!);
+            return wrapResponse(empty: true);
           } on PlatformException catch (e) {
             return wrapResponse(error: e);
           } catch (e) {
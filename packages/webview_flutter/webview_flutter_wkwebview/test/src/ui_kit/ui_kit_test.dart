@@ -11,6 +11,7 @@ import 'package:mockito/mockito.dart';
 import 'package:webview_flutter_wkwebview/src/common/instance_manager.dart';
 import 'package:webview_flutter_wkwebview/src/ui_kit/ui_kit.dart';
 import 'package:webview_flutter_wkwebview/src/web_kit/web_kit.dart';
+import 'package:webview_flutter_wkwebview/src/web_kit/web_kit_api_impls.dart';
 
 import '../common/test_web_kit.g.dart';
 import 'ui_kit_test.mocks.dart';
@@ -19,6 +20,7 @@ import 'ui_kit_test.mocks.dart';
   TestWKWebViewConfigurationHostApi,
   TestWKWebViewHostApi,
   TestUIScrollViewHostApi,
+  TestUIScrollViewDelegateHostApi,
   TestUIViewHostApi,
 ])
 void main() {
@@ -85,6 +87,79 @@ void main() {
           10.0,
         ));
       });
+
+      test('setDelegate', () async {
+        final UIScrollViewDelegate delegate = UIScrollViewDelegate.detached(
+          instanceManager: instanceManager,
+        );
+        const int delegateIdentifier = 10;
+        instanceManager.addHostCreatedInstance(delegate, delegateIdentifier);
+
+        await scrollView.setDelegate(delegate);
+        verify(mockPlatformHostApi.setDelegate(
+          scrollViewInstanceId,
+          delegateIdentifier,
+        ));
+
+        await scrollView.setDelegate(null);
+        verify(mockPlatformHostApi.setDelegate(scrollViewInstanceId, null));
+      });
+    });
+
+    group('UIScrollViewDelegate', () {
+      // Ensure the test host api is removed after each test run.
+      tearDown(() => TestUIScrollViewDelegateHostApi.setup(null));
+
+      test('create', () async {
+        final MockTestUIScrollViewDelegateHostApi mockApi =
+            MockTestUIScrollViewDelegateHostApi();
+        TestUIScrollViewDelegateHostApi.setup(mockApi);
+
+        final UIScrollViewDelegate delegate = UIScrollViewDelegate(
+          maximumFrequency: 30.0,
+          minimumDelta: 2.0,
+          instanceManager: instanceManager,
+        );
+
+        verify(mockApi.create(
+          instanceManager.getIdentifier(delegate),
+          30.0,
+          2.0,
+        ));
+      });
+
+      test('scrollViewDidScroll', () async {
+        final UIScrollView scrollView = UIScrollView.detached(
+          instanceManager: instanceManager,
+        );
+        const int scrollViewIdentifier = 0;
+        instanceManager.addHostCreatedInstance(
+          scrollView,
+          scrollViewIdentifier,
+        );
+
+        final List<Object> arguments = <Object>[];
+        final UIScrollViewDelegate delegate = UIScrollViewDelegate.detached(
+          scrollViewDidScroll: (UIScrollView scrollView, double x, double y) {
+            arguments.addAll(<Object>[scrollView, x, y]);
+          },
+          instanceManager: instanceManager,
+        );
+        const int delegateIdentifier = 1;
+        instanceManager.addHostCreatedInstance(delegate, delegateIdentifier);
+
+        WebKitFlutterApis.instance = WebKitFlutterApis(
+          instanceManager: instanceManager,
+        );
+        WebKitFlutterApis.instance.scrollViewDelegate.scrollViewDidScroll(
+          delegateIdentifier,
+          scrollViewIdentifier,
+          5.0,
+          6.0,
+        );
+
+        expect(arguments, <Object>[scrollView, 5.0, 6.0]);
+      });
     });
 
     group('UIView', () {
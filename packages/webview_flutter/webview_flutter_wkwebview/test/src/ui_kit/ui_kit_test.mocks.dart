@@ -344,6 +344,38 @@ class MockTestWKWebViewHostApi extends _i1.Mock
         #getCustomUserAgent,
         [identifier],
       )) as String?);
+  @override
+  void prewarm(
+    int? configurationIdentifier,
+    int? count,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #prewarm,
+          [
+            configurationIdentifier,
+            count,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void setSuspendsWhenOffscreen(
+    int? identifier,
+    bool? suspends,
+    double? idleTimeoutSeconds,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setSuspendsWhenOffscreen,
+          [
+            identifier,
+            suspends,
+            idleTimeoutSeconds,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
 }
 
 /// A class which mocks [TestUIScrollViewHostApi].
@@ -412,6 +444,49 @@ class MockTestUIScrollViewHostApi extends _i1.Mock
         ),
         returnValueForMissingStub: null,
       );
+  @override
+  void setDelegate(
+    int? identifier,
+    int? uiScrollViewDelegateIdentifier,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setDelegate,
+          [
+            identifier,
+            uiScrollViewDelegateIdentifier,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+}
+
+/// A class which mocks [TestUIScrollViewDelegateHostApi].
+///
+/// See the documentation for Mockito's code generation for more information.
+class MockTestUIScrollViewDelegateHostApi extends _i1.Mock
+    implements _i2.TestUIScrollViewDelegateHostApi {
+  MockTestUIScrollViewDelegateHostApi() {
+    _i1.throwOnMissingStub(this);
+  }
+
+  @override
+  void create(
+    int? identifier,
+    double? maximumFrequency,
+    double? minimumDelta,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #create,
+          [
+            identifier,
+            maximumFrequency,
+            minimumDelta,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
 }
 
 /// A class which mocks [TestUIViewHostApi].
@@ -18,14 +18,17 @@ import '../common/test_web_kit.g.dart';
 import 'web_kit_test.mocks.dart';
 
 @GenerateMocks(<Type>[
+  TestWKContentRuleListStoreHostApi,
   TestWKHttpCookieStoreHostApi,
   TestWKNavigationDelegateHostApi,
   TestWKPreferencesHostApi,
   TestWKScriptMessageHandlerHostApi,
   TestWKUIDelegateHostApi,
+  TestWKURLSchemeHandlerHostApi,
   TestWKUserContentControllerHostApi,
   TestWKWebViewConfigurationHostApi,
   TestWKWebViewHostApi,
+  TestWKWebViewTextureHostApi,
   TestWKWebsiteDataStoreHostApi,
 ])
 void main() {
@@ -191,6 +194,62 @@ void main() {
         );
         expect(cookie.propertyValues.single, 'aComment');
       });
+
+      test('setCookies', () async {
+        await httpCookieStore.setCookies(<NSHttpCookie>[
+          const NSHttpCookie.withProperties(<NSHttpCookiePropertyKey, Object>{
+            NSHttpCookiePropertyKey.name: 'a',
+          }),
+          const NSHttpCookie.withProperties(<NSHttpCookiePropertyKey, Object>{
+            NSHttpCookiePropertyKey.name: 'b',
+          }),
+        ]);
+
+        final List<NSHttpCookieData?> cookies = verify(
+          mockPlatformHostApi.setCookies(
+            instanceManager.getIdentifier(httpCookieStore),
+            captureAny,
+          ),
+        ).captured.single as List<NSHttpCookieData?>;
+
+        expect(cookies, hasLength(2));
+        expect(
+          cookies[0]!.propertyKeys.single!.value,
+          NSHttpCookiePropertyKeyEnum.name,
+        );
+        expect(cookies[0]!.propertyValues.single, 'a');
+        expect(cookies[1]!.propertyValues.single, 'b');
+      });
+
+      test('getAllCookies', () async {
+        when(mockPlatformHostApi.getAllCookies(
+          instanceManager.getIdentifier(httpCookieStore),
+        )).thenAnswer(
+          (_) async => <NSHttpCookieData?>[
+            NSHttpCookieData(
+              propertyKeys: <NSHttpCookiePropertyKeyEnumData?>[
+                NSHttpCookiePropertyKeyEnumData(
+                  value: NSHttpCookiePropertyKeyEnum.name,
+                ),
+                NSHttpCookiePropertyKeyEnumData(
+                  value: NSHttpCookiePropertyKeyEnum.value,
+                ),
+              ],
+              propertyValues: <Object?>['a', 'b'],
+            ),
+          ],
+        );
+
+        final List<NSHttpCookie> cookies =
+            await httpCookieStore.getAllCookies();
+        expect(
+          cookies.single.properties,
+          <NSHttpCookiePropertyKey, Object>{
+            NSHttpCookiePropertyKey.name: 'a',
+            NSHttpCookiePropertyKey.value: 'b',
+          },
+        );
+      });
     });
 
     group('WKScriptMessageHandler', () {
@@ -253,6 +312,65 @@ void main() {
           completion(<Object?>[userContentController, isA<WKScriptMessage>()]),
         );
       });
+
+      test('setMessageBatching', () async {
+        await scriptMessageHandler.setMessageBatching(maxBatchSize: 8);
+        verify(mockPlatformHostApi.setMessageBatching(
+          instanceManager.getIdentifier(scriptMessageHandler),
+          8,
+        ));
+
+        await scriptMessageHandler.setMessageBatching();
+        verify(mockPlatformHostApi.setMessageBatching(
+          instanceManager.getIdentifier(scriptMessageHandler),
+          null,
+        ));
+      });
+
+      test('didReceiveScriptMessages', () async {
+        WebKitFlutterApis.instance = WebKitFlutterApis(
+          instanceManager: instanceManager,
+        );
+
+        final List<String?> receivedNames = <String?>[];
+        final List<WKUserContentController> receivedControllers =
+            <WKUserContentController>[];
+        scriptMessageHandler = WKScriptMessageHandler(
+          instanceManager: instanceManager,
+          didReceiveScriptMessage: (
+            WKUserContentController userContentController,
+            WKScriptMessage message,
+          ) {
+            receivedControllers.add(userContentController);
+            receivedNames.add(message.name);
+          },
+        );
+
+        final WKUserContentController userContentController =
+            WKUserContentController.detached(
+          instanceManager: instanceManager,
+        );
+        instanceManager.addHostCreatedInstance(userContentController, 2);
+
+        WebKitFlutterApis.instance.scriptMessageHandler
+            .didReceiveScriptMessages(
+          instanceManager.getIdentifier(scriptMessageHandler)!,
+          2,
+          <WKScriptMessageData?>[
+            WKScriptMessageData(name: 'first'),
+            WKScriptMessageData(name: 'second'),
+          ],
+        );
+
+        expect(receivedNames, <String>['first', 'second']);
+        expect(
+          receivedControllers,
+          <WKUserContentController>[
+            userContentController,
+            userContentController,
+          ],
+        );
+      });
     });
 
     group('WKPreferences', () {
@@ -388,6 +506,85 @@ void main() {
           instanceManager.getIdentifier(userContentController),
         ));
       });
+
+      test('addContentRuleList', () async {
+        final WKContentRuleListStore store = WKContentRuleListStore.detached(
+          instanceManager: instanceManager,
+        );
+        instanceManager.addDartCreatedInstance(store);
+
+        await userContentController.addContentRuleList(store, 'blocker');
+        verify(mockPlatformHostApi.addContentRuleList(
+          instanceManager.getIdentifier(userContentController),
+          instanceManager.getIdentifier(store),
+          'blocker',
+        ));
+      });
+
+      test('removeAllContentRuleLists', () async {
+        await userContentController.removeAllContentRuleLists();
+        verify(mockPlatformHostApi.removeAllContentRuleLists(
+          instanceManager.getIdentifier(userContentController),
+        ));
+      });
+    });
+
+    group('WKContentRuleListStore', () {
+      late MockTestWKContentRuleListStoreHostApi mockPlatformHostApi;
+
+      late WKContentRuleListStore store;
+
+      setUp(() {
+        mockPlatformHostApi = MockTestWKContentRuleListStoreHostApi();
+        TestWKContentRuleListStoreHostApi.setup(mockPlatformHostApi);
+
+        store = WKContentRuleListStore.detached(
+          instanceManager: instanceManager,
+        );
+        instanceManager.addDartCreatedInstance(store);
+      });
+
+      tearDown(() {
+        TestWKContentRuleListStoreHostApi.setup(null);
+      });
+
+      test('createDefaultStore', () {
+        final WKContentRuleListStore defaultStore =
+            WKContentRuleListStore.defaultStore;
+        verify(
+          mockPlatformHostApi.createDefaultStore(
+            NSObject.globalInstanceManager.getIdentifier(defaultStore),
+          ),
+        );
+      });
+
+      test('compileContentRuleList', () async {
+        await store.compileContentRuleList('blocker', '[]');
+        verify(mockPlatformHostApi.compileContentRuleList(
+          instanceManager.getIdentifier(store),
+          'blocker',
+          '[]',
+        ));
+      });
+
+      test('containsContentRuleList', () {
+        when(mockPlatformHostApi.containsContentRuleList(any, any))
+            .thenAnswer((_) => Future<bool>.value(true));
+
+        expect(store.containsContentRuleList('blocker'), completion(isTrue));
+        verify(mockPlatformHostApi.containsContentRuleList(
+          instanceManager.getIdentifier(store),
+          'blocker',
+        ));
+      });
+
+      test('removeContentRuleList', () async {
+        await store.removeContentRuleList('blocker');
+        verify(mockPlatformHostApi.removeContentRuleList(
+          instanceManager.getIdentifier(store),
+          'blocker',
+        ));
+      });
     });
 
     group('WKWebViewConfiguration', () {
@@ -468,6 +665,197 @@ void main() {
         expect(typeData[0]!.value, WKAudiovisualMediaTypeEnum.audio);
         expect(typeData[1]!.value, WKAudiovisualMediaTypeEnum.video);
       });
+
+      test('useSharedProcessPool', () {
+        webViewConfiguration.useSharedProcessPool();
+        verify(mockPlatformHostApi.useSharedProcessPool(
+          instanceManager.getIdentifier(webViewConfiguration),
+        ));
+      });
+
+      test('setURLSchemeHandler', () {
+        TestWKURLSchemeHandlerHostApi.setup(
+          MockTestWKURLSchemeHandlerHostApi(),
+        );
+        final WKURLSchemeHandler handler = WKURLSchemeHandler(
+          startURLSchemeTask: (_, __) {},
+          instanceManager: instanceManager,
+        );
+
+        webViewConfiguration.setURLSchemeHandler(handler, 'app');
+        verify(mockPlatformHostApi.setURLSchemeHandler(
+          instanceManager.getIdentifier(webViewConfiguration),
+          instanceManager.getIdentifier(handler),
+          'app',
+        ));
+
+        TestWKURLSchemeHandlerHostApi.setup(null);
+      });
+    });
+
+    group('WKURLSchemeHandler', () {
+      late MockTestWKURLSchemeHandlerHostApi mockPlatformHostApi;
+
+      late WKURLSchemeHandler urlSchemeHandler;
+
+      setUp(() async {
+        mockPlatformHostApi = MockTestWKURLSchemeHandlerHostApi();
+        TestWKURLSchemeHandlerHostApi.setup(mockPlatformHostApi);
+
+        urlSchemeHandler = WKURLSchemeHandler(
+          startURLSchemeTask: (_, __) {},
+          instanceManager: instanceManager,
+        );
+      });
+
+      tearDown(() {
+        TestWKURLSchemeHandlerHostApi.setup(null);
+      });
+
+      test('create', () async {
+        verify(mockPlatformHostApi.create(
+          instanceManager.getIdentifier(urlSchemeHandler),
+        ));
+      });
+
+      test('addFileRoute', () async {
+        await urlSchemeHandler.addFileRoute('/', '/path/to/www');
+        verify(mockPlatformHostApi.addFileRoute(
+          instanceManager.getIdentifier(urlSchemeHandler),
+          '/',
+          '/path/to/www',
+        ));
+      });
+
+      test('addFlutterAssetRoute', () async {
+        await urlSchemeHandler.addFlutterAssetRoute('/', 'assets/www');
+        verify(mockPlatformHostApi.addFlutterAssetRoute(
+          instanceManager.getIdentifier(urlSchemeHandler),
+          '/',
+          'assets/www',
+        ));
+      });
+
+      test('startURLSchemeTask', () async {
+        final Completer<List<Object?>> argsCompleter =
+            Completer<List<Object?>>();
+
+        WebKitFlutterApis.instance = WebKitFlutterApis(
+          instanceManager: instanceManager,
+        );
+
+        urlSchemeHandler = WKURLSchemeHandler(
+          instanceManager: instanceManager,
+          startURLSchemeTask: (WKWebView webView, WKURLSchemeTask task) {
+            argsCompleter.complete(<Object?>[webView, task]);
+          },
+        );
+
+        final WKWebView webView = WKWebView.detached(
+          instanceManager: instanceManager,
+        );
+        instanceManager.addHostCreatedInstance(webView, 2);
+
+        WebKitFlutterApis.instance.urlSchemeHandler.startURLSchemeTask(
+          instanceManager.getIdentifier(urlSchemeHandler)!,
+          2,
+          3,
+          NSUrlRequestData(
+            url: 'app://localhost/index.html',
+            httpMethod: 'GET',
+            allHttpHeaderFields: <String, String>{},
+          ),
+        );
+
+        final List<Object?> args = await argsCompleter.future;
+        expect(args[0], webView);
+        final WKURLSchemeTask task = args[1]! as WKURLSchemeTask;
+        expect(task.identifier, 3);
+        expect(task.request.url, 'app://localhost/index.html');
+        expect(task.request.httpMethod, 'GET');
+      });
+
+      test('stopURLSchemeTask', () async {
+        final Completer<List<Object?>> argsCompleter =
+            Completer<List<Object?>>();
+
+        WebKitFlutterApis.instance = WebKitFlutterApis(
+          instanceManager: instanceManager,
+        );
+
+        urlSchemeHandler = WKURLSchemeHandler(
+          instanceManager: instanceManager,
+          startURLSchemeTask: (_, __) {},
+          stopURLSchemeTask: (WKWebView webView, int taskIdentifier) {
+            argsCompleter.complete(<Object?>[webView, taskIdentifier]);
+          },
+        );
+
+        final WKWebView webView = WKWebView.detached(
+          instanceManager: instanceManager,
+        );
+        instanceManager.addHostCreatedInstance(webView, 2);
+
+        WebKitFlutterApis.instance.urlSchemeHandler.stopURLSchemeTask(
+          instanceManager.getIdentifier(urlSchemeHandler)!,
+          2,
+          3,
+        );
+
+        expect(argsCompleter.future, completion(<Object?>[webView, 3]));
+      });
+
+      group('WKURLSchemeTask', () {
+        late WKURLSchemeTask task;
+
+        setUp(() {
+          task = WKURLSchemeTask(
+            handler: urlSchemeHandler,
+            identifier: 3,
+            request: const NSUrlRequest(url: 'app://localhost/data'),
+          );
+        });
+
+        test('didReceiveResponse', () async {
+          await task.didReceiveResponse(
+            statusCode: 201,
+            headers: <String, String>{'Content-Type': 'application/json'},
+          );
+          verify(mockPlatformHostApi.didReceiveResponse(
+            instanceManager.getIdentifier(urlSchemeHandler),
+            3,
+            201,
+            <String, String>{'Content-Type': 'application/json'},
+          ));
+        });
+
+        test('didReceiveData', () async {
+          final Uint8List data = Uint8List.fromList(<int>[1, 2, 3]);
+          await task.didReceiveData(data);
+          verify(mockPlatformHostApi.didReceiveData(
+            instanceManager.getIdentifier(urlSchemeHandler),
+            3,
+            data,
+          ));
+        });
+
+        test('didFinish', () async {
+          await task.didFinish();
+          verify(mockPlatformHostApi.didFinish(
+            instanceManager.getIdentifier(urlSchemeHandler),
+            3,
+          ));
+        });
+
+        test('didFail', () async {
+          await task.didFail('description');
+          verify(mockPlatformHostApi.didFail(
+            instanceManager.getIdentifier(urlSchemeHandler),
+            3,
+            'description',
+          ));
+        });
+      });
     });
 
     group('WKNavigationDelegate', () {
@@ -511,6 +899,48 @@ void main() {
         ));
       });
 
+      test('setNavigationPolicyRules', () async {
+        await navigationDelegate.setNavigationPolicyRules(
+          const <WKNavigationPolicyRule>[
+            WKNavigationPolicyRule(
+              host: 'ads.example.com',
+              policy: WKNavigationActionPolicy.cancel,
+            ),
+            WKNavigationPolicyRule(
+              scheme: 'https',
+              urlPattern: r'\.pdf$',
+              policy: WKNavigationActionPolicy.allow,
+            ),
+          ],
+          forwardsOnlyMainFrameNavigations: true,
+        );
+
+        final List<WKNavigationPolicyRuleData?> rules = (verify(
+          mockPlatformHostApi.setNavigationPolicyRules(
+            instanceManager.getIdentifier(navigationDelegate),
+            captureAny,
+            true,
+          ),
+        ).captured.single as List<Object?>)
+            .cast<WKNavigationPolicyRuleData?>();
+
+        expect(rules, hasLength(2));
+        expect(rules[0]!.host, 'ads.example.com');
+        expect(rules[0]!.scheme, isNull);
+        expect(rules[0]!.policy, WKNavigationActionPolicyEnum.cancel);
+        expect(rules[1]!.scheme, 'https');
+        expect(rules[1]!.urlPattern, r'\.pdf$');
+        expect(rules[1]!.policy, WKNavigationActionPolicyEnum.allow);
+      });
+
+      test('setIncludesRequestDetails', () async {
+        await navigationDelegate.setIncludesRequestDetails(true);
+        verify(mockPlatformHostApi.setIncludesRequestDetails(
+          instanceManager.getIdentifier(navigationDelegate),
+          true,
+        ));
+      });
+
       test('didFinishNavigation', () async {
         final Completer<List<Object?>> argsCompleter =
             Completer<List<Object?>>();
@@ -685,6 +1115,62 @@ void main() {
       });
     });
 
+    group('WKWebViewTexture', () {
+      late MockTestWKWebViewTextureHostApi mockPlatformHostApi;
+
+      late WKWebView webView;
+      late WKWebViewTexture webViewTexture;
+
+      setUp(() {
+        mockPlatformHostApi = MockTestWKWebViewTextureHostApi();
+        TestWKWebViewTextureHostApi.setup(mockPlatformHostApi);
+
+        webView = WKWebView.detached(instanceManager: instanceManager);
+        instanceManager.addDartCreatedInstance(webView);
+
+        webViewTexture = WKWebViewTexture(
+          webView,
+          instanceManager: instanceManager,
+        );
+      });
+
+      tearDown(() {
+        TestWKWebViewTextureHostApi.setup(null);
+      });
+
+      test('create', () async {
+        verify(mockPlatformHostApi.create(
+          instanceManager.getIdentifier(webViewTexture),
+          instanceManager.getIdentifier(webView),
+        ));
+      });
+
+      test('getTextureId', () async {
+        when(mockPlatformHostApi.getTextureId(any)).thenReturn(7);
+
+        expect(await webViewTexture.getTextureId(), 7);
+        verify(mockPlatformHostApi.getTextureId(
+          instanceManager.getIdentifier(webViewTexture),
+        ));
+      });
+
+      test('setSize', () async {
+        await webViewTexture.setSize(320, 480);
+        verify(mockPlatformHostApi.setSize(
+          instanceManager.getIdentifier(webViewTexture),
+          320,
+          480,
+        ));
+      });
+
+      test('update', () async {
+        await webViewTexture.update();
+        verify(mockPlatformHostApi.update(
+          instanceManager.getIdentifier(webViewTexture),
+        ));
+      });
+    });
+
     group('WKWebView', () {
       late MockTestWKWebViewHostApi mockPlatformHostApi;
 
@@ -849,6 +1335,37 @@ void main() {
         expect(webView.getCustomUserAgent(), completion(userAgent));
       });
 
+      test('setSuspendsWhenOffscreen', () async {
+        await webView.setSuspendsWhenOffscreen(
+          true,
+          idleTimeout: const Duration(milliseconds: 1500),
+        );
+        verify(mockPlatformHostApi.setSuspendsWhenOffscreen(
+          webViewInstanceId,
+          true,
+          1.5,
+        ));
+
+        await webView.setSuspendsWhenOffscreen(false);
+        verify(mockPlatformHostApi.setSuspendsWhenOffscreen(
+          webViewInstanceId,
+          false,
+          null,
+        ));
+      });
+
+      test('prewarm', () async {
+        await WKWebView.prewarm(
+          webViewConfiguration,
+          count: 2,
+          instanceManager: instanceManager,
+        );
+        verify(mockPlatformHostApi.prewarm(
+          instanceManager.getIdentifier(webViewConfiguration),
+          2,
+        ));
+      });
+
       test('evaluateJavaScript', () {
         when(mockPlatformHostApi.evaluateJavaScript(webViewInstanceId, 'gogo'))
             .thenAnswer((_) => Future<String>.value('stopstop'));
@@ -880,6 +1397,61 @@ void main() {
           ),
         );
       });
+
+      test('evaluateJavaScriptAsJson', () {
+        when(mockPlatformHostApi.evaluateJavaScriptAsJson(
+          webViewInstanceId,
+          'document.title',
+        )).thenAnswer((_) => Future<String?>.value('"title"'));
+        expect(
+          webView.evaluateJavaScriptAsJson('document.title'),
+          completion('"title"'),
+        );
+      });
+
+      test('evaluateJavaScriptAsJson returns NSError', () {
+        when(mockPlatformHostApi.evaluateJavaScriptAsJson(
+          webViewInstanceId,
+          'gogo',
+        )).thenThrow(
+          PlatformException(
+            code: '',
+            details: NSErrorData(
+              code: 0,
+              domain: 'domain',
+              userInfo: <String, Object?>{
+                NSErrorUserInfoKey.NSLocalizedDescription: 'desc',
+              },
+            ),
+          ),
+        );
+        expect(
+          webView.evaluateJavaScriptAsJson('gogo'),
+          throwsA(
+            isA<PlatformException>().having(
+              (PlatformException exception) => exception.details,
+              'details',
+              isA<NSError>(),
+            ),
+          ),
+        );
+      });
+
+      test('callAsyncJavaScript', () {
+        final Uint8List bytes = Uint8List.fromList(<int>[1, 2, 3]);
+        when(mockPlatformHostApi.callAsyncJavaScript(
+          webViewInstanceId,
+          'return data;',
+          <String?, Object?>{'data': bytes},
+        )).thenAnswer((_) => Future<Uint8List>.value(bytes));
+        expect(
+          webView.callAsyncJavaScript(
+            'return data;',
+            arguments: <String, Object?>{'data': bytes},
+          ),
+          completion(bytes),
+        );
+      });
     });
 
     group('WKUIDelegate', () {
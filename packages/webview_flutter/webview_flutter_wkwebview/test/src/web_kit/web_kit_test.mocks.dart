@@ -6,6 +6,7 @@
 
 // ignore_for_file: no_leading_underscores_for_library_prefixes
 import 'dart:async' as _i3;
+import 'dart:typed_data' as _i5;
 
 import 'package:mockito/mockito.dart' as _i1;
 import 'package:webview_flutter_wkwebview/src/common/web_kit.g.dart' as _i4;
@@ -23,6 +24,74 @@ import '../common/test_web_kit.g.dart' as _i2;
 // ignore_for_file: camel_case_types
 // ignore_for_file: subtype_of_sealed_class
 
+/// A class which mocks [TestWKContentRuleListStoreHostApi].
+///
+/// See the documentation for Mockito's code generation for more information.
+class MockTestWKContentRuleListStoreHostApi extends _i1.Mock
+    implements _i2.TestWKContentRuleListStoreHostApi {
+  MockTestWKContentRuleListStoreHostApi() {
+    _i1.throwOnMissingStub(this);
+  }
+
+  @override
+  void createDefaultStore(int? identifier) => super.noSuchMethod(
+        Invocation.method(
+          #createDefaultStore,
+          [identifier],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  _i3.Future<void> compileContentRuleList(
+    int? identifier,
+    String? ruleListIdentifier,
+    String? encodedContentRuleList,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #compileContentRuleList,
+          [
+            identifier,
+            ruleListIdentifier,
+            encodedContentRuleList,
+          ],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+  @override
+  _i3.Future<bool> containsContentRuleList(
+    int? identifier,
+    String? ruleListIdentifier,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #containsContentRuleList,
+          [
+            identifier,
+            ruleListIdentifier,
+          ],
+        ),
+        returnValue: _i3.Future<bool>.value(false),
+      ) as _i3.Future<bool>);
+  @override
+  _i3.Future<void> removeContentRuleList(
+    int? identifier,
+    String? ruleListIdentifier,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #removeContentRuleList,
+          [
+            identifier,
+            ruleListIdentifier,
+          ],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+}
+
 /// A class which mocks [TestWKHttpCookieStoreHostApi].
 ///
 /// See the documentation for Mockito's code generation for more information.
@@ -63,6 +132,32 @@ class MockTestWKHttpCookieStoreHostApi extends _i1.Mock
         returnValue: _i3.Future<void>.value(),
         returnValueForMissingStub: _i3.Future<void>.value(),
       ) as _i3.Future<void>);
+  @override
+  _i3.Future<void> setCookies(
+    int? identifier,
+    List<_i4.NSHttpCookieData?>? cookies,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setCookies,
+          [
+            identifier,
+            cookies,
+          ],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+  @override
+  _i3.Future<List<_i4.NSHttpCookieData?>> getAllCookies(int? identifier) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #getAllCookies,
+          [identifier],
+        ),
+        returnValue: _i3.Future<List<_i4.NSHttpCookieData?>>.value(
+            <_i4.NSHttpCookieData?>[]),
+      ) as _i3.Future<List<_i4.NSHttpCookieData?>>);
 }
 
 /// A class which mocks [TestWKNavigationDelegateHostApi].
@@ -82,6 +177,38 @@ class MockTestWKNavigationDelegateHostApi extends _i1.Mock
         ),
         returnValueForMissingStub: null,
       );
+  @override
+  void setNavigationPolicyRules(
+    int? identifier,
+    List<_i4.WKNavigationPolicyRuleData?>? rules,
+    bool? forwardsOnlyMainFrameNavigations,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setNavigationPolicyRules,
+          [
+            identifier,
+            rules,
+            forwardsOnlyMainFrameNavigations,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void setIncludesRequestDetails(
+    int? identifier,
+    bool? includesRequestDetails,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setIncludesRequestDetails,
+          [
+            identifier,
+            includesRequestDetails,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
 }
 
 /// A class which mocks [TestWKPreferencesHostApi].
@@ -142,6 +269,21 @@ class MockTestWKScriptMessageHandlerHostApi extends _i1.Mock
         ),
         returnValueForMissingStub: null,
       );
+  @override
+  void setMessageBatching(
+    int? identifier,
+    int? maxBatchSize,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setMessageBatching,
+          [
+            identifier,
+            maxBatchSize,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
 }
 
 /// A class which mocks [TestWKUIDelegateHostApi].
@@ -163,6 +305,127 @@ class MockTestWKUIDelegateHostApi extends _i1.Mock
       );
 }
 
+/// A class which mocks [TestWKURLSchemeHandlerHostApi].
+///
+/// See the documentation for Mockito's code generation for more information.
+class MockTestWKURLSchemeHandlerHostApi extends _i1.Mock
+    implements _i2.TestWKURLSchemeHandlerHostApi {
+  MockTestWKURLSchemeHandlerHostApi() {
+    _i1.throwOnMissingStub(this);
+  }
+
+  @override
+  void create(int? identifier) => super.noSuchMethod(
+        Invocation.method(
+          #create,
+          [identifier],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void addFileRoute(
+    int? identifier,
+    String? pathPrefix,
+    String? directoryPath,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #addFileRoute,
+          [
+            identifier,
+            pathPrefix,
+            directoryPath,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void addFlutterAssetRoute(
+    int? identifier,
+    String? pathPrefix,
+    String? assetDirectory,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #addFlutterAssetRoute,
+          [
+            identifier,
+            pathPrefix,
+            assetDirectory,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void didReceiveResponse(
+    int? identifier,
+    int? taskIdentifier,
+    int? statusCode,
+    Map<String?, String?>? headers,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #didReceiveResponse,
+          [
+            identifier,
+            taskIdentifier,
+            statusCode,
+            headers,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void didReceiveData(
+    int? identifier,
+    int? taskIdentifier,
+    _i5.Uint8List? data,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #didReceiveData,
+          [
+            identifier,
+            taskIdentifier,
+            data,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void didFinish(
+    int? identifier,
+    int? taskIdentifier,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #didFinish,
+          [
+            identifier,
+            taskIdentifier,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void didFail(
+    int? identifier,
+    int? taskIdentifier,
+    String? errorDescription,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #didFail,
+          [
+            identifier,
+            taskIdentifier,
+            errorDescription,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+}
+
 /// A class which mocks [TestWKUserContentControllerHostApi].
 ///
 /// See the documentation for Mockito's code generation for more information.
@@ -250,6 +513,32 @@ class MockTestWKUserContentControllerHostApi extends _i1.Mock
         ),
         returnValueForMissingStub: null,
       );
+  @override
+  _i3.Future<void> addContentRuleList(
+    int? identifier,
+    int? storeIdentifier,
+    String? ruleListIdentifier,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addContentRuleList,
+          [
+            identifier,
+            storeIdentifier,
+            ruleListIdentifier,
+          ],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+  @override
+  void removeAllContentRuleLists(int? identifier) => super.noSuchMethod(
+        Invocation.method(
+          #removeAllContentRuleLists,
+          [identifier],
+        ),
+        returnValueForMissingStub: null,
+      );
 }
 
 /// A class which mocks [TestWKWebViewConfigurationHostApi].
@@ -329,6 +618,31 @@ class MockTestWKWebViewConfigurationHostApi extends _i1.Mock
         ),
         returnValueForMissingStub: null,
       );
+  @override
+  void useSharedProcessPool(int? identifier) => super.noSuchMethod(
+        Invocation.method(
+          #useSharedProcessPool,
+          [identifier],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void setURLSchemeHandler(
+    int? identifier,
+    int? handlerIdentifier,
+    String? scheme,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setURLSchemeHandler,
+          [
+            identifier,
+            handlerIdentifier,
+            scheme,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
 }
 
 /// A class which mocks [TestWKWebViewHostApi].
@@ -553,6 +867,38 @@ class MockTestWKWebViewHostApi extends _i1.Mock
         returnValue: _i3.Future<Object?>.value(),
       ) as _i3.Future<Object?>);
   @override
+  _i3.Future<String?> evaluateJavaScriptAsJson(
+    int? identifier,
+    String? javaScriptString,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #evaluateJavaScriptAsJson,
+          [
+            identifier,
+            javaScriptString,
+          ],
+        ),
+        returnValue: _i3.Future<String?>.value(),
+      ) as _i3.Future<String?>);
+  @override
+  _i3.Future<Object?> callAsyncJavaScript(
+    int? identifier,
+    String? functionBody,
+    Map<String?, Object?>? arguments,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #callAsyncJavaScript,
+          [
+            identifier,
+            functionBody,
+            arguments,
+          ],
+        ),
+        returnValue: _i3.Future<Object?>.value(),
+      ) as _i3.Future<Object?>);
+  @override
   void setInspectable(
     int? identifier,
     bool? inspectable,
@@ -573,6 +919,98 @@ class MockTestWKWebViewHostApi extends _i1.Mock
         #getCustomUserAgent,
         [identifier],
       )) as String?);
+  @override
+  void prewarm(
+    int? configurationIdentifier,
+    int? count,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #prewarm,
+          [
+            configurationIdentifier,
+            count,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  void setSuspendsWhenOffscreen(
+    int? identifier,
+    bool? suspends,
+    double? idleTimeoutSeconds,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setSuspendsWhenOffscreen,
+          [
+            identifier,
+            suspends,
+            idleTimeoutSeconds,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+}
+
+/// A class which mocks [TestWKWebViewTextureHostApi].
+///
+/// See the documentation for Mockito's code generation for more information.
+class MockTestWKWebViewTextureHostApi extends _i1.Mock
+    implements _i2.TestWKWebViewTextureHostApi {
+  MockTestWKWebViewTextureHostApi() {
+    _i1.throwOnMissingStub(this);
+  }
+
+  @override
+  void create(
+    int? identifier,
+    int? webViewIdentifier,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #create,
+          [
+            identifier,
+            webViewIdentifier,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  int getTextureId(int? identifier) => (super.noSuchMethod(
+        Invocation.method(
+          #getTextureId,
+          [identifier],
+        ),
+        returnValue: 0,
+      ) as int);
+  @override
+  void setSize(
+    int? identifier,
+    double? width,
+    double? height,
+  ) =>
+      super.noSuchMethod(
+        Invocation.method(
+          #setSize,
+          [
+            identifier,
+            width,
+            height,
+          ],
+        ),
+        returnValueForMissingStub: null,
+      );
+  @override
+  _i3.Future<void> update(int? identifier) => (super.noSuchMethod(
+        Invocation.method(
+          #update,
+          [identifier],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
 }
 
 /// A class which mocks [TestWKWebsiteDataStoreHostApi].
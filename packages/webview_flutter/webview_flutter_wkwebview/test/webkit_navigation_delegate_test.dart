@@ -214,6 +214,43 @@ void main() {
       expect(callbackRequest.url, 'https://www.google.com');
       expect(callbackRequest.isMainFrame, isFalse);
     });
+
+    test('setNavigationPolicyRules', () async {
+      final WebKitNavigationDelegate webKitDelegate = WebKitNavigationDelegate(
+        const WebKitNavigationDelegateCreationParams(
+          webKitProxy: WebKitProxy(
+            createNavigationDelegate: CapturingNavigationDelegate.new,
+            createUIDelegate: CapturingUIDelegate.new,
+          ),
+        ),
+      );
+
+      await webKitDelegate.setNavigationPolicyRules(
+        const <WebKitNavigationPolicyRule>[
+          WebKitNavigationPolicyRule(
+            host: 'ads.example.com',
+            decision: NavigationDecision.prevent,
+          ),
+          WebKitNavigationPolicyRule(
+            scheme: 'https',
+            decision: NavigationDecision.navigate,
+          ),
+        ],
+        forwardsOnlyMainFrameNavigations: true,
+      );
+
+      final List<WKNavigationPolicyRule> rules =
+          CapturingNavigationDelegate.lastNavigationPolicyRules;
+      expect(rules, hasLength(2));
+      expect(rules[0].host, 'ads.example.com');
+      expect(rules[0].policy, WKNavigationActionPolicy.cancel);
+      expect(rules[1].scheme, 'https');
+      expect(rules[1].policy, WKNavigationActionPolicy.allow);
+      expect(
+        CapturingNavigationDelegate.lastForwardsOnlyMainFrameNavigations,
+        isTrue,
+      );
+    });
   });
 }
 
@@ -231,6 +268,19 @@ class CapturingNavigationDelegate extends WKNavigationDelegate {
   }
   static CapturingNavigationDelegate lastCreatedDelegate =
       CapturingNavigationDelegate();
+
+  static List<WKNavigationPolicyRule> lastNavigationPolicyRules =
+      <WKNavigationPolicyRule>[];
+  static bool lastForwardsOnlyMainFrameNavigations = false;
+
+  @override
+  Future<void> setNavigationPolicyRules(
+    List<WKNavigationPolicyRule> rules, {
+    bool forwardsOnlyMainFrameNavigations = false,
+  }) async {
+    lastNavigationPolicyRules = rules;
+    lastForwardsOnlyMainFrameNavigations = forwardsOnlyMainFrameNavigations;
+  }
 }
 
 // Records the last created instance of itself.
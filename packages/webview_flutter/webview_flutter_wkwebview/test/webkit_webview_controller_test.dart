@@ -29,6 +29,8 @@ import 'webkit_webview_controller_test.mocks.dart';
   WKWebView,
   WKWebViewConfiguration,
   WKScriptMessageHandler,
+  WKContentRuleListStore,
+  WKURLSchemeHandler,
 ])
 void main() {
   WidgetsFlutterBinding.ensureInitialized();
@@ -40,6 +42,7 @@ void main() {
       WKUIDelegate? uiDelegate,
       MockWKUserContentController? mockUserContentController,
       MockWKWebsiteDataStore? mockWebsiteDataStore,
+      MockWKContentRuleListStore? mockContentRuleListStore,
       MockWKWebView Function(
         WKWebViewConfiguration configuration, {
         void Function(
@@ -100,6 +103,9 @@ void main() {
                 );
           },
           createScriptMessageHandler: WKScriptMessageHandler.detached,
+          createScrollViewDelegate: UIScrollViewDelegate.detached,
+          defaultContentRuleListStore: () =>
+              mockContentRuleListStore ?? MockWKContentRuleListStore(),
         ),
         instanceManager: instanceManager,
       );
@@ -179,6 +185,111 @@ void main() {
         );
       });
 
+      test('usesSharedProcessPool', () {
+        final MockWKWebViewConfiguration mockConfiguration =
+            MockWKWebViewConfiguration();
+
+        WebKitWebViewControllerCreationParams(
+          webKitProxy: WebKitProxy(
+            createWebViewConfiguration: ({InstanceManager? instanceManager}) {
+              return mockConfiguration;
+            },
+          ),
+          usesSharedProcessPool: true,
+        );
+
+        verify(mockConfiguration.useSharedProcessPool());
+      });
+
+      test('urlSchemeHandlers', () async {
+        final MockWKWebViewConfiguration mockConfiguration =
+            MockWKWebViewConfiguration();
+        final MockWKURLSchemeHandler mockHandler = MockWKURLSchemeHandler();
+
+        late void Function(WKWebView, WKURLSchemeTask) onStartTask;
+        void Function(WKWebView, int)? onStopTask;
+        final List<WebKitUrlSchemeRequest> requests =
+            <WebKitUrlSchemeRequest>[];
+        WebKitWebViewControllerCreationParams(
+          webKitProxy: WebKitProxy(
+            createWebViewConfiguration: ({InstanceManager? instanceManager}) {
+              return mockConfiguration;
+            },
+            createURLSchemeHandler: ({
+              required void Function(WKWebView, WKURLSchemeTask)
+                  startURLSchemeTask,
+              void Function(WKWebView, int)? stopURLSchemeTask,
+              InstanceManager? instanceManager,
+            }) {
+              onStartTask = startURLSchemeTask;
+              onStopTask = stopURLSchemeTask;
+              return mockHandler;
+            },
+          ),
+          urlSchemeHandlers: <String, WebKitUrlSchemeHandler>{
+            'app': WebKitUrlSchemeHandler(
+              fileRoutes: const <String, String>{'/': '/path/to/www'},
+              flutterAssetRoutes: const <String, String>{
+                '/assets/': 'assets/www',
+              },
+              onRequest: requests.add,
+            ),
+          },
+        );
+
+        verify(mockHandler.addFileRoute('/', '/path/to/www'));
+        verify(mockHandler.addFlutterAssetRoute('/assets/', 'assets/www'));
+        verify(mockConfiguration.setURLSchemeHandler(mockHandler, 'app'));
+
+        final MockWKWebView mockWebView = MockWKWebView();
+        final WKURLSchemeTask task = WKURLSchemeTask(
+          handler: mockHandler,
+          identifier: 3,
+          request: const NSUrlRequest(
+            url: 'app://localhost/api',
+            httpMethod: 'POST',
+          ),
+        );
+        onStartTask(mockWebView, task);
+
+        expect(requests, hasLength(1));
+        expect(requests.single.url, 'app://localhost/api');
+        expect(requests.single.method, 'POST');
+        expect(requests.single.isStopped, isFalse);
+
+        onStopTask!(mockWebView, 3);
+        expect(requests.single.isStopped, isTrue);
+      });
+
+      test('prewarmWebViews', () async {
+        final MockWKWebViewConfiguration mockConfiguration =
+            MockWKWebViewConfiguration();
+
+        WKWebViewConfiguration? prewarmedConfiguration;
+        int? prewarmedCount;
+        final WebKitWebViewControllerCreationParams params =
+            WebKitWebViewControllerCreationParams(
+          webKitProxy: WebKitProxy(
+            createWebViewConfiguration: ({InstanceManager? instanceManager}) {
+              return mockConfiguration;
+            },
+            prewarmWebViews: (
+              WKWebViewConfiguration configuration, {
+              required int count,
+              InstanceManager? instanceManager,
+            }) async {
+              prewarmedConfiguration = configuration;
+              prewarmedCount = count;
+            },
+          ),
+        );
+
+        await WebKitWebViewController.prewarmWebViews(params, count: 3);
+
+        expect(prewarmedConfiguration, mockConfiguration);
+        expect(prewarmedCount, 3);
+      });
+
       test('mediaTypesRequiringUserAction', () {
         final MockWKWebViewConfiguration mockConfiguration =
             MockWKWebViewConfiguration();
@@ -477,6 +588,105 @@ void main() {
       );
     });
 
+    test('runJavaScriptReturningJson', () {
+      final MockWKWebView mockWebView = MockWKWebView();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        createMockWebView: (_, {dynamic observeValue}) => mockWebView,
+      );
+
+      when(mockWebView.evaluateJavaScriptAsJson('[1, 2, 3]')).thenAnswer(
+        (_) => Future<String?>.value('[1,2,3]'),
+      );
+      expect(
+        controller.runJavaScriptReturningJson('[1, 2, 3]'),
+        completion('[1,2,3]'),
+      );
+    });
+
+    test('callAsyncJavaScript', () {
+      final MockWKWebView mockWebView = MockWKWebView();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        createMockWebView: (_, {dynamic observeValue}) => mockWebView,
+      );
+
+      final Uint8List bytes = Uint8List.fromList(<int>[1, 2, 3]);
+      when(mockWebView.callAsyncJavaScript(
+        'return data;',
+        arguments: <String, Object?>{'data': bytes},
+      )).thenAnswer((_) => Future<Object?>.value(bytes));
+      expect(
+        controller.callAsyncJavaScript(
+          'return data;',
+          arguments: <String, Object?>{'data': bytes},
+        ),
+        completion(bytes),
+      );
+    });
+
+    test('addContentRuleList compiles rule list when not stored', () async {
+      final MockWKUserContentController mockUserContentController =
+          MockWKUserContentController();
+      final MockWKContentRuleListStore mockStore = MockWKContentRuleListStore();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        mockUserContentController: mockUserContentController,
+        mockContentRuleListStore: mockStore,
+      );
+
+      when(mockStore.containsContentRuleList('blocker')).thenAnswer(
+        (_) => Future<bool>.value(false),
+      );
+
+      await controller.addContentRuleList(
+        'blocker',
+        encodedContentRuleList: '[]',
+      );
+
+      verifyInOrder(<Object>[
+        mockStore.compileContentRuleList('blocker', '[]'),
+        mockUserContentController.addContentRuleList(mockStore, 'blocker'),
+      ]);
+    });
+
+    test('addContentRuleList reuses stored rule list', () async {
+      final MockWKUserContentController mockUserContentController =
+          MockWKUserContentController();
+      final MockWKContentRuleListStore mockStore = MockWKContentRuleListStore();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        mockUserContentController: mockUserContentController,
+        mockContentRuleListStore: mockStore,
+      );
+
+      when(mockStore.containsContentRuleList('blocker')).thenAnswer(
+        (_) => Future<bool>.value(true),
+      );
+
+      await controller.addContentRuleList(
+        'blocker',
+        encodedContentRuleList: '[]',
+      );
+
+      verifyNever(mockStore.compileContentRuleList(any, any));
+      verify(
+        mockUserContentController.addContentRuleList(mockStore, 'blocker'),
+      );
+    });
+
+    test('removeAllContentRuleLists', () async {
+      final MockWKUserContentController mockUserContentController =
+          MockWKUserContentController();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        mockUserContentController: mockUserContentController,
+      );
+
+      await controller.removeAllContentRuleLists();
+      verify(mockUserContentController.removeAllContentRuleLists());
+    });
+
     test('runJavaScriptReturningResult throws error on null return value', () {
       final MockWKWebView mockWebView = MockWKWebView();
 
@@ -593,6 +803,36 @@ void main() {
       );
     });
 
+    test('setOnScrollPositionChange', () async {
+      final MockUIScrollView mockScrollView = MockUIScrollView();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        mockScrollView: mockScrollView,
+      );
+
+      final Completer<Offset> scrollPositionCompleter = Completer<Offset>();
+      await controller.setOnScrollPositionChange(
+        scrollPositionCompleter.complete,
+        maximumFrequency: 30.0,
+        minimumDelta: 2.0,
+      );
+
+      final UIScrollViewDelegate delegate =
+          verify(mockScrollView.setDelegate(captureAny)).captured.single
+              as UIScrollViewDelegate;
+      expect(delegate.maximumFrequency, 30.0);
+      expect(delegate.minimumDelta, 2.0);
+
+      delegate.scrollViewDidScroll!(mockScrollView, 4.0, 8.0);
+      expect(
+        scrollPositionCompleter.future,
+        completion(const Offset(4.0, 8.0)),
+      );
+
+      await controller.setOnScrollPositionChange(null);
+      verify(mockScrollView.setDelegate(null));
+    });
+
     test('disable zoom', () async {
       final MockWKUserContentController mockUserContentController =
           MockWKUserContentController();
@@ -756,6 +996,109 @@ void main() {
       );
     });
 
+    test('addJavaScriptChannel with message batching', () async {
+      final MockWKScriptMessageHandler mockMessageHandler =
+          MockWKScriptMessageHandler();
+      final WebKitProxy webKitProxy = WebKitProxy(
+        createScriptMessageHandler: ({
+          required void Function(
+            WKUserContentController userContentController,
+            WKScriptMessage message,
+          ) didReceiveScriptMessage,
+        }) {
+          return mockMessageHandler;
+        },
+      );
+
+      final WebKitJavaScriptChannelParams javaScriptChannelParams =
+          WebKitJavaScriptChannelParams(
+        name: 'name',
+        onMessageReceived: (JavaScriptMessage message) {},
+        maxMessageBatchSize: 16,
+        webKitProxy: webKitProxy,
+      );
+
+      final MockWKUserContentController mockUserContentController =
+          MockWKUserContentController();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        mockUserContentController: mockUserContentController,
+      );
+
+      await controller.addJavaScriptChannel(javaScriptChannelParams);
+      verifyInOrder(<Object>[
+        mockMessageHandler.setMessageBatching(maxBatchSize: 16),
+        mockUserContentController.addScriptMessageHandler(
+          mockMessageHandler,
+          'name',
+        ),
+      ]);
+    });
+
+    test('addJavaScriptChannel with binary messages', () async {
+      late final void Function(
+        WKUserContentController userContentController,
+        WKScriptMessage message,
+      ) receiveScriptMessage;
+      final WebKitProxy webKitProxy = WebKitProxy(
+        createScriptMessageHandler: ({
+          required void Function(
+            WKUserContentController userContentController,
+            WKScriptMessage message,
+          ) didReceiveScriptMessage,
+        }) {
+          receiveScriptMessage = didReceiveScriptMessage;
+          return WKScriptMessageHandler.detached(
+            didReceiveScriptMessage: didReceiveScriptMessage,
+          );
+        },
+      );
+
+      final List<String> messages = <String>[];
+      final List<Uint8List> binaryMessages = <Uint8List>[];
+      final WebKitJavaScriptChannelParams javaScriptChannelParams =
+          WebKitJavaScriptChannelParams(
+        name: 'name',
+        onMessageReceived: (JavaScriptMessage message) {
+          messages.add(message.message);
+        },
+        onBinaryMessageReceived: binaryMessages.add,
+        webKitProxy: webKitProxy,
+      );
+
+      final MockWKUserContentController mockUserContentController =
+          MockWKUserContentController();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        mockUserContentController: mockUserContentController,
+      );
+
+      await controller.addJavaScriptChannel(javaScriptChannelParams);
+
+      final WKUserScript userScript =
+          verify(mockUserContentController.addUserScript(captureAny))
+              .captured
+              .single as WKUserScript;
+      expect(userScript.source, contains('window.name = {'));
+      expect(
+        userScript.source,
+        contains('webkit.messageHandlers.name.postMessage(message);'),
+      );
+
+      final Uint8List bytes = Uint8List.fromList(<int>[1, 2, 3]);
+      receiveScriptMessage(
+        mockUserContentController,
+        WKScriptMessage(name: 'name', body: bytes),
+      );
+      receiveScriptMessage(
+        mockUserContentController,
+        const WKScriptMessage(name: 'name', body: 'text'),
+      );
+
+      expect(binaryMessages, <Uint8List>[bytes]);
+      expect(messages, <String>['text']);
+    });
+
     test('removeJavaScriptChannel', () async {
       final WebKitProxy webKitProxy = WebKitProxy(
         createScriptMessageHandler: ({
@@ -1200,6 +1543,23 @@ void main() {
       verify(mockWebView.setInspectable(true));
     });
 
+    test('setSuspendsWhenOffscreen', () async {
+      final MockWKWebView mockWebView = MockWKWebView();
+
+      final WebKitWebViewController controller = createControllerWithMocks(
+        createMockWebView: (_, {dynamic observeValue}) => mockWebView,
+      );
+
+      await controller.setSuspendsWhenOffscreen(
+        true,
+        idleTimeout: const Duration(seconds: 30),
+      );
+      verify(mockWebView.setSuspendsWhenOffscreen(
+        true,
+        idleTimeout: const Duration(seconds: 30),
+      ));
+    });
+
     group('Console logging', () {
       test('setConsoleLogCallback should inject the correct JavaScript',
           () async {
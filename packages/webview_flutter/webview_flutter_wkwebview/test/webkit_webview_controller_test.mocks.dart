@@ -132,6 +132,28 @@ class _FakeWKScriptMessageHandler_9 extends _i1.SmartFake
         );
 }
 
+class _FakeWKContentRuleListStore_10 extends _i1.SmartFake
+    implements _i5.WKContentRuleListStore {
+  _FakeWKContentRuleListStore_10(
+    Object parent,
+    Invocation parentInvocation,
+  ) : super(
+          parent,
+          parentInvocation,
+        );
+}
+
+class _FakeWKURLSchemeHandler_11 extends _i1.SmartFake
+    implements _i5.WKURLSchemeHandler {
+  _FakeWKURLSchemeHandler_11(
+    Object parent,
+    Invocation parentInvocation,
+  ) : super(
+          parent,
+          parentInvocation,
+        );
+}
+
 /// A class which mocks [NSUrl].
 ///
 /// See the documentation for Mockito's code generation for more information.
@@ -239,6 +261,16 @@ class MockUIScrollView extends _i1.Mock implements _i4.UIScrollView {
         returnValueForMissingStub: _i6.Future<void>.value(),
       ) as _i6.Future<void>);
   @override
+  _i6.Future<void> setDelegate(_i4.UIScrollViewDelegate? delegate) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setDelegate,
+          [delegate],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
   _i4.UIScrollView copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -435,6 +467,31 @@ class MockWKUserContentController extends _i1.Mock
         returnValueForMissingStub: _i6.Future<void>.value(),
       ) as _i6.Future<void>);
   @override
+  _i6.Future<void> addContentRuleList(
+    _i5.WKContentRuleListStore? store,
+    String? identifier,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addContentRuleList,
+          [
+            store,
+            identifier,
+          ],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i6.Future<void> removeAllContentRuleLists() => (super.noSuchMethod(
+        Invocation.method(
+          #removeAllContentRuleLists,
+          [],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
   _i5.WKUserContentController copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -751,6 +808,28 @@ class MockWKWebView extends _i1.Mock implements _i5.WKWebView {
         returnValue: _i6.Future<Object?>.value(),
       ) as _i6.Future<Object?>);
   @override
+  _i6.Future<String?> evaluateJavaScriptAsJson(String? javaScriptString) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #evaluateJavaScriptAsJson,
+          [javaScriptString],
+        ),
+        returnValue: _i6.Future<String?>.value(),
+      ) as _i6.Future<String?>);
+  @override
+  _i6.Future<Object?> callAsyncJavaScript(
+    String? functionBody, {
+    Map<String, Object?>? arguments = const {},
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #callAsyncJavaScript,
+          [functionBody],
+          {#arguments: arguments},
+        ),
+        returnValue: _i6.Future<Object?>.value(),
+      ) as _i6.Future<Object?>);
+  @override
   _i6.Future<void> setInspectable(bool? inspectable) => (super.noSuchMethod(
         Invocation.method(
           #setInspectable,
@@ -768,6 +847,20 @@ class MockWKWebView extends _i1.Mock implements _i5.WKWebView {
         returnValue: _i6.Future<String?>.value(),
       ) as _i6.Future<String?>);
   @override
+  _i6.Future<void> setSuspendsWhenOffscreen(
+    bool? suspends, {
+    Duration? idleTimeout,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setSuspendsWhenOffscreen,
+          [suspends],
+          {#idleTimeout: idleTimeout},
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
   _i5.WKWebView copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -899,6 +992,31 @@ class MockWKWebViewConfiguration extends _i1.Mock
         returnValueForMissingStub: _i6.Future<void>.value(),
       ) as _i6.Future<void>);
   @override
+  _i6.Future<void> useSharedProcessPool() => (super.noSuchMethod(
+        Invocation.method(
+          #useSharedProcessPool,
+          [],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i6.Future<void> setURLSchemeHandler(
+    _i5.WKURLSchemeHandler? handler,
+    String? scheme,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setURLSchemeHandler,
+          [
+            handler,
+            scheme,
+          ],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
   _i5.WKWebViewConfiguration copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -971,6 +1089,17 @@ class MockWKScriptMessageHandler extends _i1.Mock
         _i5.WKScriptMessage,
       ));
   @override
+  _i6.Future<void> setMessageBatching({int? maxBatchSize}) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setMessageBatching,
+          [],
+          {#maxBatchSize: maxBatchSize},
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
   _i5.WKScriptMessageHandler copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
@@ -1017,3 +1146,199 @@ class MockWKScriptMessageHandler extends _i1.Mock
         returnValueForMissingStub: _i6.Future<void>.value(),
       ) as _i6.Future<void>);
 }
+
+/// A class which mocks [WKContentRuleListStore].
+///
+/// See the documentation for Mockito's code generation for more information.
+// ignore: must_be_immutable
+class MockWKContentRuleListStore extends _i1.Mock
+    implements _i5.WKContentRuleListStore {
+  MockWKContentRuleListStore() {
+    _i1.throwOnMissingStub(this);
+  }
+
+  @override
+  _i6.Future<void> compileContentRuleList(
+    String? identifier,
+    String? encodedContentRuleList,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #compileContentRuleList,
+          [
+            identifier,
+            encodedContentRuleList,
+          ],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i6.Future<bool> containsContentRuleList(String? identifier) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #containsContentRuleList,
+          [identifier],
+        ),
+        returnValue: _i6.Future<bool>.value(false),
+      ) as _i6.Future<bool>);
+  @override
+  _i6.Future<void> removeContentRuleList(String? identifier) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #removeContentRuleList,
+          [identifier],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i5.WKContentRuleListStore copy() => (super.noSuchMethod(
+        Invocation.method(
+          #copy,
+          [],
+        ),
+        returnValue: _FakeWKContentRuleListStore_10(
+          this,
+          Invocation.method(
+            #copy,
+            [],
+          ),
+        ),
+      ) as _i5.WKContentRuleListStore);
+  @override
+  _i6.Future<void> addObserver(
+    _i2.NSObject? observer, {
+    required String? keyPath,
+    required Set<_i2.NSKeyValueObservingOptions>? options,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addObserver,
+          [observer],
+          {
+            #keyPath: keyPath,
+            #options: options,
+          },
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i6.Future<void> removeObserver(
+    _i2.NSObject? observer, {
+    required String? keyPath,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #removeObserver,
+          [observer],
+          {#keyPath: keyPath},
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+}
+
+/// A class which mocks [WKURLSchemeHandler].
+///
+/// See the documentation for Mockito's code generation for more information.
+class MockWKURLSchemeHandler extends _i1.Mock
+    implements _i5.WKURLSchemeHandler {
+  MockWKURLSchemeHandler() {
+    _i1.throwOnMissingStub(this);
+  }
+
+  @override
+  void Function(
+    _i5.WKWebView,
+    _i5.WKURLSchemeTask,
+  ) get startURLSchemeTask => (super.noSuchMethod(
+        Invocation.getter(#startURLSchemeTask),
+        returnValue: (
+          _i5.WKWebView webView,
+          _i5.WKURLSchemeTask task,
+        ) {},
+      ) as void Function(
+        _i5.WKWebView,
+        _i5.WKURLSchemeTask,
+      ));
+  @override
+  _i6.Future<void> addFileRoute(
+    String? pathPrefix,
+    String? directoryPath,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addFileRoute,
+          [
+            pathPrefix,
+            directoryPath,
+          ],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i6.Future<void> addFlutterAssetRoute(
+    String? pathPrefix,
+    String? assetDirectory,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addFlutterAssetRoute,
+          [
+            pathPrefix,
+            assetDirectory,
+          ],
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i5.WKURLSchemeHandler copy() => (super.noSuchMethod(
+        Invocation.method(
+          #copy,
+          [],
+        ),
+        returnValue: _FakeWKURLSchemeHandler_11(
+          this,
+          Invocation.method(
+            #copy,
+            [],
+          ),
+        ),
+      ) as _i5.WKURLSchemeHandler);
+  @override
+  _i6.Future<void> addObserver(
+    _i2.NSObject? observer, {
+    required String? keyPath,
+    required Set<_i2.NSKeyValueObservingOptions>? options,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addObserver,
+          [observer],
+          {
+            #keyPath: keyPath,
+            #options: options,
+          },
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+  @override
+  _i6.Future<void> removeObserver(
+    _i2.NSObject? observer, {
+    required String? keyPath,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #removeObserver,
+          [observer],
+          {#keyPath: keyPath},
+        ),
+        returnValue: _i6.Future<void>.value(),
+        returnValueForMissingStub: _i6.Future<void>.value(),
+      ) as _i6.Future<void>);
+}
@@ -81,6 +81,83 @@ void main() {
       );
     });
 
+    test('setCookies', () async {
+      final MockWKWebsiteDataStore mockWKWebsiteDataStore =
+          MockWKWebsiteDataStore();
+
+      final MockWKHttpCookieStore mockCookieStore = MockWKHttpCookieStore();
+      when(mockWKWebsiteDataStore.httpCookieStore).thenReturn(mockCookieStore);
+
+      final WebKitWebViewCookieManager manager = WebKitWebViewCookieManager(
+        WebKitWebViewCookieManagerCreationParams(
+          webKitProxy: WebKitProxy(
+            defaultWebsiteDataStore: () => mockWKWebsiteDataStore,
+          ),
+        ),
+      );
+
+      await manager.setCookies(const <WebViewCookie>[
+        WebViewCookie(name: 'a', value: 'b', domain: 'c', path: 'd'),
+        WebViewCookie(name: 'e', value: 'f', domain: 'g'),
+      ]);
+
+      final List<NSHttpCookie> cookies =
+          verify(mockCookieStore.setCookies(captureAny)).captured.single
+              as List<NSHttpCookie>;
+      expect(
+        cookies.map((NSHttpCookie cookie) => cookie.properties),
+        <Map<NSHttpCookiePropertyKey, Object>>[
+          <NSHttpCookiePropertyKey, Object>{
+            NSHttpCookiePropertyKey.name: 'a',
+            NSHttpCookiePropertyKey.value: 'b',
+            NSHttpCookiePropertyKey.domain: 'c',
+            NSHttpCookiePropertyKey.path: 'd',
+          },
+          <NSHttpCookiePropertyKey, Object>{
+            NSHttpCookiePropertyKey.name: 'e',
+            NSHttpCookiePropertyKey.value: 'f',
+            NSHttpCookiePropertyKey.domain: 'g',
+            NSHttpCookiePropertyKey.path: '/',
+          },
+        ],
+      );
+    });
+
+    test('getCookies', () async {
+      final MockWKWebsiteDataStore mockWKWebsiteDataStore =
+          MockWKWebsiteDataStore();
+
+      final MockWKHttpCookieStore mockCookieStore = MockWKHttpCookieStore();
+      when(mockWKWebsiteDataStore.httpCookieStore).thenReturn(mockCookieStore);
+      when(mockCookieStore.getAllCookies()).thenAnswer(
+        (_) async => const <NSHttpCookie>[
+          NSHttpCookie.withProperties(<NSHttpCookiePropertyKey, Object>{
+            NSHttpCookiePropertyKey.name: 'a',
+            NSHttpCookiePropertyKey.value: 'b',
+            NSHttpCookiePropertyKey.domain: 'c',
+            NSHttpCookiePropertyKey.path: 'd',
+          }),
+          NSHttpCookie.withProperties(<NSHttpCookiePropertyKey, Object>{
+            NSHttpCookiePropertyKey.name: 'e',
+          }),
+        ],
+      );
+
+      final WebKitWebViewCookieManager manager = WebKitWebViewCookieManager(
+        WebKitWebViewCookieManagerCreationParams(
+          webKitProxy: WebKitProxy(
+            defaultWebsiteDataStore: () => mockWKWebsiteDataStore,
+          ),
+        ),
+      );
+
+      final WebViewCookie cookie = (await manager.getCookies()).single;
+      expect(cookie.name, 'a');
+      expect(cookie.value, 'b');
+      expect(cookie.domain, 'c');
+      expect(cookie.path, 'd');
+    });
+
     test('setCookie throws argument error with invalid path', () async {
       final MockWKWebsiteDataStore mockWKWebsiteDataStore =
           MockWKWebsiteDataStore();
@@ -145,6 +145,25 @@ class MockWKHttpCookieStore extends _i1.Mock implements _i2.WKHttpCookieStore {
         returnValueForMissingStub: _i3.Future<void>.value(),
       ) as _i3.Future<void>);
   @override
+  _i3.Future<void> setCookies(List<_i4.NSHttpCookie>? cookies) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setCookies,
+          [cookies],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+  @override
+  _i3.Future<List<_i4.NSHttpCookie>> getAllCookies() => (super.noSuchMethod(
+        Invocation.method(
+          #getAllCookies,
+          [],
+        ),
+        returnValue:
+            _i3.Future<List<_i4.NSHttpCookie>>.value(<_i4.NSHttpCookie>[]),
+      ) as _i3.Future<List<_i4.NSHttpCookie>>);
+  @override
   _i2.WKHttpCookieStore copy() => (super.noSuchMethod(
         Invocation.method(
           #copy,
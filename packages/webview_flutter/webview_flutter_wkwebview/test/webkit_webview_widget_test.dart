@@ -14,7 +14,11 @@ import 'package:webview_flutter_wkwebview/webview_flutter_wkwebview.dart';
 
 import 'webkit_webview_widget_test.mocks.dart';
 
-@GenerateMocks(<Type>[WKUIDelegate, WKWebViewConfiguration])
+@GenerateMocks(<Type>[
+  WKUIDelegate,
+  WKWebViewConfiguration,
+  WKWebViewTexture,
+])
 void main() {
   TestWidgetsFlutterBinding.ensureInitialized();
 
@@ -43,6 +47,51 @@ void main() {
       expect(find.byKey(const Key('keyValue')), findsOneWidget);
     });
 
+    testWidgets('build with texture render mode', (WidgetTester tester) async {
+      final InstanceManager testInstanceManager = InstanceManager(
+        onWeakReferenceRemoved: (_) {},
+      );
+
+      final MockWKWebViewTexture mockWebViewTexture = MockWKWebViewTexture();
+      when(mockWebViewTexture.getTextureId()).thenAnswer((_) async => 3);
+
+      final WebKitWebViewController controller = createTestWebViewController(
+        testInstanceManager,
+        webViewTexture: mockWebViewTexture,
+      );
+
+      final WebKitWebViewWidget widget = WebKitWebViewWidget(
+        WebKitWebViewWidgetCreationParams(
+          controller: controller,
+          renderMode: WebKitWebViewRenderMode.texture,
+          instanceManager: testInstanceManager,
+        ),
+      );
+
+      await tester.pumpWidget(
+        Center(
+          child: SizedBox(
+            width: 200,
+            height: 100,
+            child: Builder(
+              builder: (BuildContext context) => widget.build(context),
+            ),
+          ),
+        ),
+      );
+      await tester.pump();
+
+      expect(find.byType(UiKitView), findsNothing);
+      expect(
+        tester.widget<Texture>(find.byType(Texture)).textureId,
+        3,
+      );
+      verify(mockWebViewTexture.setSize(200, 100));
+
+      await controller.updateTexture();
+      verify(mockWebViewTexture.update());
+    });
+
     testWidgets('Key of the PlatformView changes when the controller changes',
         (WidgetTester tester) async {
       final InstanceManager testInstanceManager = InstanceManager(
@@ -172,8 +221,9 @@ void main() {
 }
 
 WebKitWebViewController createTestWebViewController(
-  InstanceManager testInstanceManager,
-) {
+  InstanceManager testInstanceManager, {
+  WKWebViewTexture? webViewTexture,
+}) {
   return WebKitWebViewController(
     WebKitWebViewControllerCreationParams(
       webKitProxy: WebKitProxy(createWebView: (
@@ -202,6 +252,11 @@ WebKitWebViewController createTestWebViewController(
 
         testInstanceManager.addDartCreatedInstance(mockWKUIDelegate);
         return mockWKUIDelegate;
+      }, createWebViewTexture: (
+        WKWebView webView, {
+        InstanceManager? instanceManager,
+      }) {
+        return webViewTexture ?? MockWKWebViewTexture();
       }),
     ),
   );
@@ -76,6 +76,17 @@ class _FakeWKWebViewConfiguration_4 extends _i1.SmartFake
         );
 }
 
+class _FakeWKWebViewTexture_5 extends _i1.SmartFake
+    implements _i2.WKWebViewTexture {
+  _FakeWKWebViewTexture_5(
+    Object parent,
+    Invocation parentInvocation,
+  ) : super(
+          parent,
+          parentInvocation,
+        );
+}
+
 /// A class which mocks [WKUIDelegate].
 ///
 /// See the documentation for Mockito's code generation for more information.
@@ -245,3 +256,93 @@ class MockWKWebViewConfiguration extends _i1.Mock
         returnValueForMissingStub: _i3.Future<void>.value(),
       ) as _i3.Future<void>);
 }
+
+/// A class which mocks [WKWebViewTexture].
+///
+/// See the documentation for Mockito's code generation for more information.
+// ignore: must_be_immutable
+class MockWKWebViewTexture extends _i1.Mock implements _i2.WKWebViewTexture {
+  MockWKWebViewTexture() {
+    _i1.throwOnMissingStub(this);
+  }
+
+  @override
+  _i3.Future<int> getTextureId() => (super.noSuchMethod(
+        Invocation.method(
+          #getTextureId,
+          [],
+        ),
+        returnValue: _i3.Future<int>.value(0),
+      ) as _i3.Future<int>);
+  @override
+  _i3.Future<void> setSize(
+    double? width,
+    double? height,
+  ) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #setSize,
+          [
+            width,
+            height,
+          ],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+  @override
+  _i3.Future<void> update() => (super.noSuchMethod(
+        Invocation.method(
+          #update,
+          [],
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+  @override
+  _i2.WKWebViewTexture copy() => (super.noSuchMethod(
+        Invocation.method(
+          #copy,
+          [],
+        ),
+        returnValue: _FakeWKWebViewTexture_5(
+          this,
+          Invocation.method(
+            #copy,
+            [],
+          ),
+        ),
+      ) as _i2.WKWebViewTexture);
+  @override
+  _i3.Future<void> addObserver(
+    _i4.NSObject? observer, {
+    required String? keyPath,
+    required Set<_i4.NSKeyValueObservingOptions>? options,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #addObserver,
+          [observer],
+          {
+            #keyPath: keyPath,
+            #options: options,
+          },
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+  @override
+  _i3.Future<void> removeObserver(
+    _i4.NSObject? observer, {
+    required String? keyPath,
+  }) =>
+      (super.noSuchMethod(
+        Invocation.method(
+          #removeObserver,
+          [observer],
+          {#keyPath: keyPath},
+        ),
+        returnValue: _i3.Future<void>.value(),
+        returnValueForMissingStub: _i3.Future<void>.value(),
+      ) as _i3.Future<void>);
+}
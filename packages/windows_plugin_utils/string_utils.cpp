@@ -0,0 +1,191 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "string_utils.h"
+
+#include <windows.h>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#define STRING_UTILS_USE_SSE2
+#elif defined(_M_ARM64)
+#include <arm_neon.h>
+#define STRING_UTILS_USE_NEON
+#endif
+
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace windows_plugin_utils {
+
+namespace {
+
+// Copies the leading ASCII characters of |input| to |output|, widening them
+// to UTF-16, and returns how many were copied.
+//
+// Since ASCII is encoded identically in UTF-8 and UTF-16, this converts the
+// common all-ASCII case without calling into the system.
+size_t WidenAsciiPrefix(std::string_view input, wchar_t* output) {
+  const char* data = input.data();
+  const size_t length = input.length();
+  size_t i = 0;
+#if defined(STRING_UTILS_USE_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    // Any byte with the high bit set is not ASCII.
+    if (_mm_movemask_epi8(chunk) != 0) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                     _mm_unpacklo_epi8(chunk, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8),
+                     _mm_unpackhi_epi8(chunk, zero));
+  }
+#elif defined(STRING_UTILS_USE_NEON)
+  for (; i + 16 <= length; i += 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+    if (vmaxvq_u8(chunk) >= 0x80) {
+      break;
+    }
+    vst1q_u16(reinterpret_cast<uint16_t*>(output + i),
+              vmovl_u8(vget_low_u8(chunk)));
+    vst1q_u16(reinterpret_cast<uint16_t*>(output + i + 8),
+              vmovl_u8(vget_high_u8(chunk)));
+  }
+#endif
+  for (; i < length; ++i) {
+    unsigned char c = static_cast<unsigned char>(data[i]);
+    if (c >= 0x80) {
+      break;
+    }
+    output[i] = static_cast<wchar_t>(c);
+  }
+  return i;
+}
+
+// Copies the leading ASCII characters of |input| to |output|, narrowing them
+// to UTF-8, and returns how many were copied.
+size_t NarrowAsciiPrefix(std::wstring_view input, char* output) {
+  const wchar_t* data = input.data();
+  const size_t length = input.length();
+  size_t i = 0;
+#if defined(STRING_UTILS_USE_SSE2)
+  const __m128i non_ascii_bits = _mm_set1_epi16(static_cast<short>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 8));
+    __m128i non_ascii =
+        _mm_and_si128(_mm_or_si128(low, high), non_ascii_bits);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, zero)) != 0xFFFF) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                     _mm_packus_epi16(low, high));
+  }
+#elif defined(STRING_UTILS_USE_NEON)
+  for (; i + 8 <= length; i += 8) {
+    uint16x8_t chunk = vld1q_u16(reinterpret_cast<const uint16_t*>(data + i));
+    if (vmaxvq_u16(chunk) >= 0x80) {
+      break;
+    }
+    vst1_u8(reinterpret_cast<uint8_t*>(output + i), vmovn_u16(chunk));
+  }
+#endif
+  for (; i < length; ++i) {
+    if (data[i] >= 0x80) {
+      break;
+    }
+    output[i] = static_cast<char>(data[i]);
+  }
+  return i;
+}
+
+}  // namespace
+
+std::string_view Utf8FromUtf16(std::wstring_view utf16_string,
+                               std::string* buffer) {
+  // An ASCII character is a single byte of UTF-8, so the buffer starts at the
+  // input length, which fits the common all-ASCII case exactly.
+  const size_t length = utf16_string.length();
+  buffer->resize(length);
+  size_t converted_length = NarrowAsciiPrefix(utf16_string, buffer->data());
+  if (converted_length < length) {
+    // The rest starts at a non-ASCII character, so it begins on a character
+    // boundary unless the input is invalid, in which case the system
+    // conversion fails.
+    //
+    // A UTF-16 code unit never needs more than three bytes of UTF-8 (a
+    // surrogate pair needs four, for two code units), so the buffer is grown
+    // to fit that for the rest only, converted into in a single pass, then
+    // trimmed.
+    const size_t remaining = length - converted_length;
+    if (remaining > INT_MAX / 3) {
+      buffer->clear();
+      return *buffer;
+    }
+    int remaining_length = static_cast<int>(remaining);
+    buffer->resize(converted_length + remaining * 3);
+    int tail_length = ::WideCharToMultiByte(
+        CP_UTF8, WC_ERR_INVALID_CHARS, utf16_string.data() + converted_length,
+        remaining_length, buffer->data() + converted_length,
+        remaining_length * 3, nullptr, nullptr);
+    if (tail_length == 0) {
+      buffer->clear();
+      return *buffer;
+    }
+    converted_length += tail_length;
+  }
+  buffer->resize(converted_length);
+  return *buffer;
+}
+
+std::wstring_view Utf16FromUtf8(std::string_view utf8_string,
+                                std::wstring* buffer) {
+  // A UTF-8 code unit never produces more than one UTF-16 code unit, so
+  // convert in a single pass into a buffer of the input length, then trim it.
+  const size_t length = utf8_string.length();
+  if (length > INT_MAX) {
+    buffer->clear();
+    return *buffer;
+  }
+  buffer->resize(length);
+  size_t converted_length = WidenAsciiPrefix(utf8_string, buffer->data());
+  if (converted_length < length) {
+    // The rest starts at a non-ASCII byte, which is a lead byte unless the
+    // input is invalid, in which case the system conversion fails.
+    int remaining_length = static_cast<int>(length - converted_length);
+    int tail_length = ::MultiByteToWideChar(
+        CP_UTF8, MB_ERR_INVALID_CHARS, utf8_string.data() + converted_length,
+        remaining_length, buffer->data() + converted_length, remaining_length);
+    if (tail_length == 0) {
+      buffer->clear();
+      return *buffer;
+    }
+    converted_length += tail_length;
+  }
+  buffer->resize(converted_length);
+  return *buffer;
+}
+
+// Converts the given UTF-16 string to UTF-8.
+std::string Utf8FromUtf16(std::wstring_view utf16_string) {
+  std::string utf8_string;
+  Utf8FromUtf16(utf16_string, &utf8_string);
+  return utf8_string;
+}
+
+// Converts the given UTF-8 string to UTF-16.
+std::wstring Utf16FromUtf8(std::string_view utf8_string) {
+  std::wstring utf16_string;
+  Utf16FromUtf8(utf8_string, &utf16_string);
+  return utf16_string;
+}
+
+}  // namespace windows_plugin_utils
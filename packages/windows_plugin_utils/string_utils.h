@@ -0,0 +1,40 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_WINDOWS_PLUGIN_UTILS_STRING_UTILS_H_
+#define PACKAGES_WINDOWS_PLUGIN_UTILS_STRING_UTILS_H_
+
+#include <string>
+#include <string_view>
+
+namespace windows_plugin_utils {
+
+// The conversions below return an empty string if the input is not valid
+// UTF-8 or UTF-16.
+
+// Converts the given UTF-16 string to UTF-8.
+std::string Utf8FromUtf16(std::wstring_view utf16_string);
+
+// Converts the given UTF-8 string to UTF-16.
+std::wstring Utf16FromUtf8(std::string_view utf8_string);
+
+// Converts the given UTF-16 string to UTF-8 in |buffer|, reusing its
+// allocation, and returns a view of the result.
+//
+// The view is null-terminated, and is valid until |buffer| is next modified.
+// This avoids allocating for temporary conversions in loops.
+std::string_view Utf8FromUtf16(std::wstring_view utf16_string,
+                               std::string* buffer);
+
+// Converts the given UTF-8 string to UTF-16 in |buffer|, reusing its
+// allocation, and returns a view of the result.
+//
+// The view is null-terminated, and is valid until |buffer| is next modified.
+// This avoids allocating for temporary conversions in loops.
+std::wstring_view Utf16FromUtf8(std::string_view utf8_string,
+                                std::wstring* buffer);
+
+}  // namespace windows_plugin_utils
+
+#endif  // PACKAGES_WINDOWS_PLUGIN_UTILS_STRING_UTILS_H_
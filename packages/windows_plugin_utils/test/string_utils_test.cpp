@@ -0,0 +1,64 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "string_utils.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace windows_plugin_utils {
+namespace test {
+
+TEST(StringUtils, ConvertsEmptyStrings) {
+  EXPECT_EQ(Utf16FromUtf8(""), L"");
+  EXPECT_EQ(Utf8FromUtf16(L""), "");
+}
+
+TEST(StringUtils, ConvertsAscii) {
+  // Long enough to cover both the vectorized and scalar paths.
+  std::string utf8 = "C:\\Users\\someone\\Documents\\photo_0001.jpg";
+  std::wstring utf16 = L"C:\\Users\\someone\\Documents\\photo_0001.jpg";
+
+  EXPECT_EQ(Utf16FromUtf8(utf8), utf16);
+  EXPECT_EQ(Utf8FromUtf16(utf16), utf8);
+}
+
+TEST(StringUtils, ConvertsNonAscii) {
+  // Non-ASCII characters both within and after the first 16 characters, and
+  // a character outside the Basic Multilingual Plane.
+  std::string utf8 =
+      "C:\\Users\\someone\\Docs\\r\xC3\xA9sum\xC3\xA9 "
+      "\xE6\x96\x87\xE4\xBB\xB6 \xF0\x9F\x93\x84.txt";
+  std::wstring utf16 =
+      L"C:\\Users\\someone\\Docs\\r\u00E9sum\u00E9 "
+      L"\u6587\u4EF6 \U0001F4C4.txt";
+
+  EXPECT_EQ(Utf16FromUtf8(utf8), utf16);
+  EXPECT_EQ(Utf8FromUtf16(utf16), utf8);
+  EXPECT_EQ(Utf16FromUtf8("\xC3\xA9"), L"\u00E9");
+  EXPECT_EQ(Utf8FromUtf16(L"\u00E9"), "\xC3\xA9");
+}
+
+TEST(StringUtils, ReturnsEmptyStringForInvalidInput) {
+  EXPECT_EQ(Utf16FromUtf8("valid prefix \xFF"), L"");
+  EXPECT_EQ(Utf8FromUtf16(std::wstring(L"valid prefix ") + L'\xD800'), "");
+}
+
+TEST(StringUtils, ConvertsIntoReusedBuffer) {
+  std::wstring buffer;
+  EXPECT_EQ(Utf16FromUtf8("a longer string than the next one", &buffer),
+            L"a longer string than the next one");
+  std::wstring_view result = Utf16FromUtf8("short", &buffer);
+  EXPECT_EQ(result, L"short");
+  // The view can be passed to APIs that expect a null-terminated string.
+  EXPECT_EQ(result.data()[result.length()], L'\0');
+
+  std::string utf8_buffer;
+  EXPECT_EQ(Utf8FromUtf16(L"r\u00E9sum\u00E9", &utf8_buffer),
+            "r\xC3\xA9sum\xC3\xA9");
+}
+
+}  // namespace test
+}  // namespace windows_plugin_utils
@@ -0,0 +1,48 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "trace_activity.h"
+
+#include <gtest/gtest.h>
+
+namespace windows_plugin_utils {
+namespace test {
+
+TRACELOGGING_DEFINE_PROVIDER(
+    g_test_trace_provider, "Flutter.WindowsPluginUtils.Test",
+    // {f18f2fef-c19f-5b7f-cb82-992aec0a5cdb}
+    (0xf18f2fef, 0xc19f, 0x5b7f, 0xcb, 0x82, 0x99, 0x2a, 0xec, 0x0a, 0x5c,
+     0xdb));
+
+TEST(TraceActivity, RegistrationsAreCounted) {
+  TraceProviderRegistration registration(g_test_trace_provider);
+
+  // Registering a provider that is already registered fails, so nested
+  // registrations must only register it once.
+  registration.Register();
+  registration.Register();
+  registration.Unregister();
+  registration.Unregister();
+
+  // The provider can be registered again once every registration is balanced.
+  registration.Register();
+  registration.Unregister();
+}
+
+TEST(TraceActivity, CanBeTracedWithoutProvider) {
+  TraceActivity activity(g_test_trace_provider, "Test", "detail");
+}
+
+TEST(TraceActivity, CanBeTracedWithoutSession) {
+  TraceProviderRegistration registration(g_test_trace_provider);
+  registration.Register();
+  {
+    TraceActivity activity(g_test_trace_provider, "Test");
+    TraceActivity detailed_activity(g_test_trace_provider, "Test", "detail");
+  }
+  registration.Unregister();
+}
+
+}  // namespace test
+}  // namespace windows_plugin_utils
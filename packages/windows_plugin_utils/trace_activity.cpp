@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "trace_activity.h"
+
+namespace windows_plugin_utils {
+
+TraceProviderRegistration::TraceProviderRegistration(
+    TraceLoggingHProvider provider)
+    : provider_(provider) {}
+
+void TraceProviderRegistration::Register() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (users_++ == 0) {
+    TraceLoggingRegister(provider_);
+  }
+}
+
+void TraceProviderRegistration::Unregister() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (--users_ == 0) {
+    TraceLoggingUnregister(provider_);
+  }
+}
+
+TraceActivity::TraceActivity(TraceLoggingHProvider provider, const char* name,
+                             const char* detail)
+    : provider_(provider), name_(name), detail_(detail) {
+  if (!TraceLoggingProviderEnabled(provider_, 0, 0)) {
+    return;
+  }
+  enabled_ = true;
+  EventActivityIdControl(EVENT_ACTIVITY_CTRL_CREATE_ID, &activity_id_);
+  TraceLoggingWriteActivity(
+      provider_, "Activity", &activity_id_, nullptr,
+      TraceLoggingOpcode(WINEVENT_OPCODE_START),
+      TraceLoggingString(name_, "Name"),
+      TraceLoggingString(detail_ ? detail_ : "", "Detail"));
+}
+
+TraceActivity::~TraceActivity() {
+  if (!enabled_) {
+    return;
+  }
+  TraceLoggingWriteActivity(
+      provider_, "Activity", &activity_id_, nullptr,
+      TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+      TraceLoggingString(name_, "Name"),
+      TraceLoggingString(detail_ ? detail_ : "", "Detail"));
+}
+
+}  // namespace windows_plugin_utils
@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PACKAGES_WINDOWS_PLUGIN_UTILS_TRACE_ACTIVITY_H_
+#define PACKAGES_WINDOWS_PLUGIN_UTILS_TRACE_ACTIVITY_H_
+
+// windows.h must be included before TraceLoggingProvider.h.
+#include <windows.h>
+
+#include <TraceLoggingProvider.h>
+
+#include <mutex>
+
+namespace windows_plugin_utils {
+
+// Registers a TraceLogging provider with ETW. Registrations are counted, and
+// the provider stays registered until each one has been balanced by a call to
+// Unregister.
+class TraceProviderRegistration {
+ public:
+  explicit TraceProviderRegistration(TraceLoggingHProvider provider);
+
+  // Disallow copy and move.
+  TraceProviderRegistration(const TraceProviderRegistration&) = delete;
+  TraceProviderRegistration& operator=(const TraceProviderRegistration&) =
+      delete;
+
+  void Register();
+
+  // Balances a call to Register.
+  void Unregister();
+
+ private:
+  TraceLoggingHProvider provider_;
+  std::mutex mutex_;
+  int users_ = 0;
+};
+
+// Writes a start event with the given name to |provider| when created, and the
+// matching stop event when destroyed, so that trace viewers show the work done
+// in between as a single activity. |detail|, if non-null, is recorded with
+// both events.
+//
+// Nothing is written when no trace session has enabled the provider.
+class TraceActivity {
+ public:
+  // |name| and |detail| must outlive the activity.
+  TraceActivity(TraceLoggingHProvider provider, const char* name,
+                const char* detail = nullptr);
+  ~TraceActivity();
+
+  // Disallow copy and move.
+  TraceActivity(const TraceActivity&) = delete;
+  TraceActivity& operator=(const TraceActivity&) = delete;
+
+ private:
+  TraceLoggingHProvider provider_;
+  const char* name_;
+  const char* detail_;
+  bool enabled_ = false;
+  GUID activity_id_ = {};
+};
+
+}  // namespace windows_plugin_utils
+
+#endif  // PACKAGES_WINDOWS_PLUGIN_UTILS_TRACE_ACTIVITY_H_
@@ -0,0 +1,21 @@
+# Native code shared by the Windows implementations of the plugins in this
+# repository.
+#
+# A plugin's windows/CMakeLists.txt includes this file, adds
+# WINDOWS_PLUGIN_UTILS_SOURCES to its sources and WINDOWS_PLUGIN_UTILS_DIR to
+# its include directories, and adds WINDOWS_PLUGIN_UTILS_TEST_SOURCES to its
+# test runner.
+
+set(WINDOWS_PLUGIN_UTILS_DIR "${CMAKE_CURRENT_LIST_DIR}")
+
+set(WINDOWS_PLUGIN_UTILS_SOURCES
+  "${WINDOWS_PLUGIN_UTILS_DIR}/string_utils.cpp"
+  "${WINDOWS_PLUGIN_UTILS_DIR}/string_utils.h"
+  "${WINDOWS_PLUGIN_UTILS_DIR}/trace_activity.cpp"
+  "${WINDOWS_PLUGIN_UTILS_DIR}/trace_activity.h"
+)
+
+set(WINDOWS_PLUGIN_UTILS_TEST_SOURCES
+  "${WINDOWS_PLUGIN_UTILS_DIR}/test/string_utils_test.cpp"
+  "${WINDOWS_PLUGIN_UTILS_DIR}/test/trace_activity_test.cpp"
+)